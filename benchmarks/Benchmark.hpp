@@ -0,0 +1,366 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BENCHMARK_HPP
+#define EL_BENCHMARK_HPP
+
+#include <El.hpp>
+
+// Shared machinery for the performance benchmark drivers: each driver sweeps
+// over problem sizes, process grid shapes, and datatypes, times a number of
+// repetitions of each case, and reports the mean, standard deviation,
+// minimum, and maximum of the runtimes and of the (nominal) GFlop/s rates,
+// both in human-readable form and as a JSON document suitable for tracking
+// performance regressions between releases.
+
+namespace bench {
+
+using namespace El;
+
+template<typename T>
+vector<T> ParseList( const string& list )
+{
+    vector<T> values;
+    std::stringstream stream( list );
+    string item;
+    while( std::getline( stream, item, ',' ) )
+    {
+        if( item.empty() )
+            continue;
+        std::stringstream itemStream( item );
+        T value;
+        if( !(itemStream >> value) )
+            LogicError("Could not parse '",item,"' from the list ",list);
+        values.push_back( value );
+    }
+    return values;
+}
+
+struct Settings
+{
+    vector<Int> sizes;
+    // The process grid heights to sweep over (by default, every divisor of
+    // the number of processes)
+    vector<int> gridHeights;
+    // A subset of "sdcz" (float, double, Complex<float>, Complex<double>)
+    string types;
+    Int numWarmups;
+    Int numReps;
+    Int blocksize;
+    string jsonFile;
+
+    bool Wants( char type ) const
+    { return types.find(type) != string::npos; }
+};
+
+// The common command-line options; the driver must call ProcessInput after
+// registering any options of its own
+inline Settings CommonSettings
+( const string& defaultSizes, const string& defaultTypes="sdcz" )
+{
+    Settings settings;
+    settings.sizes = ParseList<Int>
+      ( Input("--sizes","comma-separated problem sizes",defaultSizes) );
+    settings.gridHeights = ParseList<int>
+      ( Input("--gridHeights","comma-separated grid heights",string("")) );
+    settings.types =
+      Input("--types","datatypes (subset of sdcz)",defaultTypes);
+    settings.numWarmups = Input("--warmups","untimed repetitions",Int(1));
+    settings.numReps = Input("--reps","timed repetitions",Int(5));
+    settings.blocksize = Input("--nb","algorithmic blocksize",Int(96));
+    settings.jsonFile = Input("--json","JSON output file",string(""));
+    return settings;
+}
+
+inline vector<int> GridHeights( const Settings& settings, mpi::Comm comm )
+{
+    const int commSize = mpi::Size( comm );
+    vector<int> heights;
+    if( settings.gridHeights.empty() )
+    {
+        for( int height=1; height<=commSize; ++height )
+            if( commSize % height == 0 )
+                heights.push_back( height );
+    }
+    else
+    {
+        for( const int height : settings.gridHeights )
+        {
+            if( height < 1 || commSize % height != 0 )
+                LogicError
+                ("Grid height ",height," does not divide ",commSize);
+            heights.push_back( height );
+        }
+    }
+    return heights;
+}
+
+inline int NumThreads()
+{
+#ifdef EL_HYBRID
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+template<typename T>
+double FlopScale() { return IsComplex<T>::value ? 4. : 1.; }
+
+struct Statistics
+{
+    double mean=0, stdDev=0, minimum=0, maximum=0;
+
+    explicit Statistics( const vector<double>& samples )
+    {
+        const Int numSamples = samples.size();
+        if( numSamples == 0 )
+            return;
+        minimum = maximum = samples[0];
+        for( const double sample : samples )
+        {
+            mean += sample;
+            minimum = Min( minimum, sample );
+            maximum = Max( maximum, sample );
+        }
+        mean /= numSamples;
+        if( numSamples > 1 )
+        {
+            for( const double sample : samples )
+                stdDev += (sample-mean)*(sample-mean);
+            stdDev = Sqrt( stdDev/(numSamples-1) );
+        }
+    }
+};
+
+// A single configuration of a benchmarked routine
+struct Case
+{
+    string routine;
+    string variant;
+    string datatype;
+    vector<pair<string,double>> params;
+    int gridHeight=1, gridWidth=1;
+    Int blocksize=0;
+
+    // The nominal number of GFlops of a single repetition (zero if there is
+    // no meaningful operation count)
+    double gFlops=0;
+    vector<double> times;
+    // Any other measurements (e.g., the number of IPM iterations)
+    vector<pair<string,double>> extras;
+    string error;
+};
+
+template<typename T>
+Case NewCase
+( const string& routine, const string& variant, const Grid& grid )
+{
+    Case benchCase;
+    benchCase.routine = routine;
+    benchCase.variant = variant;
+    benchCase.datatype = TypeName<T>();
+    benchCase.gridHeight = grid.Height();
+    benchCase.gridWidth = grid.Width();
+    return benchCase;
+}
+
+inline string JSONString( const string& str )
+{
+    ostringstream os;
+    os << '"';
+    for( const char c : str )
+    {
+        if( c == '"' || c == '\\' )
+            os << '\\' << c;
+        else if( c == '\n' )
+            os << "\\n";
+        else if( c == '\t' )
+            os << "\\t";
+        else if( (unsigned char)(c) < 0x20 )
+            os << ' ';
+        else
+            os << c;
+    }
+    os << '"';
+    return os.str();
+}
+
+inline string JSONNumber( double value )
+{
+    if( !std::isfinite(value) )
+        return "null";
+    ostringstream os;
+    os.precision( 10 );
+    os << value;
+    return os.str();
+}
+
+inline string JSONStatistics( const Statistics& stats )
+{
+    return BuildString
+    ("{\"mean\": ",JSONNumber(stats.mean),
+     ", \"stddev\": ",JSONNumber(stats.stdDev),
+     ", \"min\": ",JSONNumber(stats.minimum),
+     ", \"max\": ",JSONNumber(stats.maximum),"}");
+}
+
+inline string JSONObject( const vector<pair<string,double>>& entries )
+{
+    ostringstream os;
+    os << "{";
+    for( size_t k=0; k<entries.size(); ++k )
+        os << (k==0 ? "" : ", ") << JSONString(entries[k].first) << ": "
+           << JSONNumber(entries[k].second);
+    os << "}";
+    return os.str();
+}
+
+class Report
+{
+public:
+    Report( const string& suite, mpi::Comm comm )
+    : suite_(suite), comm_(comm) { }
+
+    void Add( const Case& benchCase )
+    {
+        ostringstream os;
+        os << benchCase.routine;
+        if( !benchCase.variant.empty() )
+            os << " (" << benchCase.variant << ")";
+        os << " " << benchCase.datatype;
+        for( const auto& param : benchCase.params )
+            os << " " << param.first << "=" << param.second;
+        os << " on a " << benchCase.gridHeight << " x "
+           << benchCase.gridWidth << " grid: ";
+        if( !benchCase.error.empty() )
+        {
+            os << "failed (" << benchCase.error << ")";
+        }
+        else
+        {
+            const Statistics timeStats( benchCase.times );
+            os << timeStats.mean << " +- " << timeStats.stdDev << " seconds";
+            if( benchCase.gFlops > 0 )
+                os << " (" << benchCase.gFlops/timeStats.mean << " GFlop/s)";
+            for( const auto& extra : benchCase.extras )
+                os << ", " << extra.first << "=" << extra.second;
+        }
+        OutputFromRoot( comm_, os.str() );
+        cases_.push_back( benchCase );
+    }
+
+    // Write the JSON document from the root process (to standard output if
+    // the filename is empty)
+    void Write( const string& filename ) const
+    {
+        if( mpi::Rank(comm_) != 0 )
+            return;
+        ostringstream os;
+        os << "{\n"
+           << "  \"suite\": " << JSONString(suite_) << ",\n"
+           << "  \"version\": "
+           << JSONString(BuildString(EL_VERSION_MAJOR,".",EL_VERSION_MINOR))
+           << ",\n"
+           << "  \"commit\": " << JSONString(EL_GIT_SHA1) << ",\n"
+           << "  \"numProcesses\": " << mpi::Size(comm_) << ",\n"
+           << "  \"numThreads\": " << NumThreads() << ",\n"
+           << "  \"timestamp\": " << std::time(nullptr) << ",\n"
+           << "  \"results\": [";
+        for( size_t k=0; k<cases_.size(); ++k )
+        {
+            const Case& benchCase = cases_[k];
+            os << (k==0 ? "\n" : ",\n")
+               << "    {\"routine\": " << JSONString(benchCase.routine)
+               << ", \"variant\": " << JSONString(benchCase.variant)
+               << ", \"datatype\": " << JSONString(benchCase.datatype)
+               << ",\n     \"params\": " << JSONObject(benchCase.params)
+               << ", \"grid\": [" << benchCase.gridHeight << ", "
+               << benchCase.gridWidth << "]"
+               << ", \"blocksize\": " << benchCase.blocksize;
+            if( !benchCase.error.empty() )
+            {
+                os << ",\n     \"error\": " << JSONString(benchCase.error)
+                   << "}";
+                continue;
+            }
+            vector<double> rates;
+            if( benchCase.gFlops > 0 )
+                for( const double time : benchCase.times )
+                    rates.push_back( benchCase.gFlops/time );
+            os << ",\n     \"seconds\": "
+               << JSONStatistics(Statistics(benchCase.times))
+               << ",\n     \"gflops\": "
+               << ( rates.empty() ? string("null") :
+                    JSONStatistics(Statistics(rates)) )
+               << ",\n     \"samples\": [";
+            for( size_t j=0; j<benchCase.times.size(); ++j )
+                os << (j==0 ? "" : ", ") << JSONNumber(benchCase.times[j]);
+            os << "]";
+            if( !benchCase.extras.empty() )
+                os << ", \"extras\": " << JSONObject(benchCase.extras);
+            os << "}";
+        }
+        os << "\n  ]\n}\n";
+
+        if( filename.empty() )
+        {
+            cout << os.str();
+        }
+        else
+        {
+            std::ofstream file( filename.c_str() );
+            if( !file.is_open() )
+                RuntimeError("Could not open ",filename);
+            file << os.str();
+        }
+    }
+
+private:
+    string suite_;
+    mpi::Comm comm_;
+    vector<Case> cases_;
+};
+
+// Time the requested number of repetitions of 'run', each preceded by an
+// untimed call to 'setup', after the requested number of (untimed) warmup
+// repetitions. Any exception (which must be thrown by every process) is
+// recorded as the failure of the case rather than aborting the sweep.
+template<typename Setup,typename Run>
+Case Time
+( Case benchCase, const Settings& settings, mpi::Comm comm,
+  Setup setup, Run run )
+{
+    benchCase.blocksize = settings.blocksize;
+    SetBlocksize( settings.blocksize );
+    try
+    {
+        Timer timer;
+        for( Int rep=0; rep<settings.numWarmups+settings.numReps; ++rep )
+        {
+            setup();
+            mpi::Barrier( comm );
+            timer.Start();
+            run();
+            mpi::Barrier( comm );
+            const double runTime = timer.Stop();
+            if( rep >= settings.numWarmups )
+                benchCase.times.push_back( runTime );
+        }
+    }
+    catch( std::exception& e )
+    {
+        benchCase.times.clear();
+        benchCase.error = e.what();
+    }
+    return benchCase;
+}
+
+} // namespace bench
+
+#endif // ifndef EL_BENCHMARK_HPP
@@ -0,0 +1,91 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename T>
+void Benchmark
+( bench::Report& report, const bench::Settings& settings, Int n,
+  int numLayers, const Grid& grid )
+{
+    DistMatrix<T> A(grid), B(grid), C(grid);
+    Uniform( A, n, n );
+    Uniform( B, n, n );
+
+    const vector<pair<GemmAlgorithm,string>> algorithms =
+      { {GEMM_DEFAULT,"default"},
+        {GEMM_SUMMA_A,"SUMMA A"},
+        {GEMM_SUMMA_B,"SUMMA B"},
+        {GEMM_SUMMA_C,"SUMMA C"},
+        {GEMM_SUMMA_DOT,"SUMMA dot"},
+        {GEMM_CANNON,"Cannon"},
+        {GEMM_25D,"2.5D"} };
+    for( const auto& algorithm : algorithms )
+    {
+        const bool layered = ( algorithm.first == GEMM_25D );
+        if( layered && (numLayers < 2 || grid.Size() % numLayers != 0) )
+            continue;
+
+        auto benchCase = bench::NewCase<T>( "Gemm", algorithm.second, grid );
+        benchCase.params = { {"m",n}, {"n",n}, {"k",n} };
+        if( layered )
+            benchCase.params.push_back( {"layers",numLayers} );
+        benchCase.gFlops = bench::FlopScale<T>()*2.*n*n*n/1.e9;
+
+        SetGemmNumLayers( layered ? numLayers : 1 );
+        report.Add
+        ( bench::Time
+          ( benchCase, settings, grid.Comm(),
+            [&]() { Zeros( C, n, n ); },
+            [&]()
+            { Gemm( NORMAL, NORMAL, T(1), A, B, T(0), C, algorithm.first ); }
+          ) );
+        SetGemmNumLayers( 1 );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const bench::Settings settings =
+          bench::CommonSettings("1000,2000,4000");
+        const int numLayers =
+          Input("--numLayers","number of layers for 2.5D Gemm",2);
+        ProcessInput();
+        PrintInputReport();
+
+        bench::Report report( "Gemm", comm );
+        for( const int gridHeight : bench::GridHeights( settings, comm ) )
+        {
+            const Grid grid( comm, gridHeight );
+            for( const Int n : settings.sizes )
+            {
+                if( settings.Wants('s') )
+                    Benchmark<float>( report, settings, n, numLayers, grid );
+                if( settings.Wants('d') )
+                    Benchmark<double>( report, settings, n, numLayers, grid );
+                if( settings.Wants('c') )
+                    Benchmark<Complex<float>>
+                    ( report, settings, n, numLayers, grid );
+                if( settings.Wants('z') )
+                    Benchmark<Complex<double>>
+                    ( report, settings, n, numLayers, grid );
+            }
+        }
+        report.Write( settings.jsonFile );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
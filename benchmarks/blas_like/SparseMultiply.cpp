@@ -0,0 +1,77 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+// Multiply the 7-point Laplacian over an n x n x n grid with a set of vectors
+template<typename F>
+void Benchmark
+( bench::Report& report, const bench::Settings& settings, Int n,
+  Int numRHS, const Grid& grid )
+{
+    DistSparseMatrix<F> A(grid);
+    Laplacian( A, n, n, n );
+    const Int N = A.Height();
+    DistMultiVec<F> X(N,numRHS,grid), Y(N,numRHS,grid);
+    MakeUniform( X );
+
+    for( const Orientation orientation : {NORMAL,ADJOINT} )
+    {
+        auto benchCase = bench::NewCase<F>
+          ( "SparseMultiply", orientation==NORMAL ? "normal" : "adjoint",
+            grid );
+        benchCase.params = { {"n",n}, {"height",N}, {"numRHS",numRHS} };
+        benchCase.gFlops =
+          bench::FlopScale<F>()*2.*A.NumEntries()*numRHS/1.e9;
+        report.Add
+        ( bench::Time
+          ( benchCase, settings, grid.Comm(),
+            [&]() { Zero( Y ); },
+            [&]() { Multiply( orientation, F(1), A, X, F(0), Y ); } ) );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const bench::Settings settings =
+          bench::CommonSettings("50,100,150");
+        const Int numRHS = Input("--numRHS","number of vectors",Int(8));
+        ProcessInput();
+        PrintInputReport();
+
+        bench::Report report( "SparseMultiply", comm );
+        for( const int gridHeight : bench::GridHeights( settings, comm ) )
+        {
+            const Grid grid( comm, gridHeight );
+            for( const Int n : settings.sizes )
+            {
+                if( settings.Wants('s') )
+                    Benchmark<float>( report, settings, n, numRHS, grid );
+                if( settings.Wants('d') )
+                    Benchmark<double>( report, settings, n, numRHS, grid );
+                if( settings.Wants('c') )
+                    Benchmark<Complex<float>>
+                    ( report, settings, n, numRHS, grid );
+                if( settings.Wants('z') )
+                    Benchmark<Complex<double>>
+                    ( report, settings, n, numRHS, grid );
+            }
+        }
+        report.Write( settings.jsonFile );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+// Solve against n right-hand sides with a (well-conditioned) lower-triangular
+// matrix of order n using each of the distributed Trsm algorithms
+template<typename F>
+void Benchmark
+( bench::Report& report, const bench::Settings& settings, Int n,
+  const Grid& grid )
+{
+    DistMatrix<F> L(grid), BOrig(grid), B(grid);
+    Uniform( L, n, n );
+    MakeTrapezoidal( LOWER, L );
+    ShiftDiagonal( L, F(n) );
+    Uniform( BOrig, n, n );
+
+    const vector<pair<TrsmAlgorithm,string>> algorithms =
+      { {TRSM_DEFAULT,"default"},
+        {TRSM_LARGE,"large"},
+        {TRSM_MEDIUM,"medium"},
+        {TRSM_SMALL,"small"},
+        {TRSM_INVERSE,"inverse"} };
+    for( const auto& algorithm : algorithms )
+    {
+        auto benchCase =
+          bench::NewCase<F>( "Trsm", "LLN "+algorithm.second, grid );
+        benchCase.params = { {"m",n}, {"n",n} };
+        benchCase.gFlops = bench::FlopScale<F>()*double(n)*n*n/1.e9;
+        report.Add
+        ( bench::Time
+          ( benchCase, settings, grid.Comm(),
+            [&]() { B = BOrig; },
+            [&]()
+            { Trsm
+              ( LEFT, LOWER, NORMAL, NON_UNIT, F(1), L, B, false,
+                algorithm.first ); } ) );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const bench::Settings settings =
+          bench::CommonSettings("1000,2000,4000");
+        ProcessInput();
+        PrintInputReport();
+
+        bench::Report report( "Trsm", comm );
+        for( const int gridHeight : bench::GridHeights( settings, comm ) )
+        {
+            const Grid grid( comm, gridHeight );
+            for( const Int n : settings.sizes )
+            {
+                if( settings.Wants('s') )
+                    Benchmark<float>( report, settings, n, grid );
+                if( settings.Wants('d') )
+                    Benchmark<double>( report, settings, n, grid );
+                if( settings.Wants('c') )
+                    Benchmark<Complex<float>>( report, settings, n, grid );
+                if( settings.Wants('z') )
+                    Benchmark<Complex<double>>( report, settings, n, grid );
+            }
+        }
+        report.Write( settings.jsonFile );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,171 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+// Time the redistribution of an n x n matrix between every pair of the
+// element-wise distributions. The minimal communication volume of a
+// redistribution is, for each process, the number of entries that it must
+// store in the target distribution but which it does not already store in
+// the source distribution; the achieved bandwidth is the maximum of this
+// volume over the processes divided by the runtime. Redistributions which
+// fall through to copy::GeneralPurpose are flagged as generic.
+
+const vector<pair<Dist,Dist>> distributions =
+  { {CIRC,CIRC}, {MC,MR}, {MC,STAR}, {MD,STAR}, {MR,MC}, {MR,STAR},
+    {STAR,MC}, {STAR,MD}, {STAR,MR}, {STAR,STAR}, {STAR,VC}, {STAR,VR},
+    {VC,STAR}, {VR,STAR} };
+
+string DistString( const pair<Dist,Dist>& dist )
+{ return BuildString("[",DistToString(dist.first),",",
+                     DistToString(dist.second),"]"); }
+
+template<typename T>
+unique_ptr<ElementalMatrix<T>>
+NewDistMatrix( const pair<Dist,Dist>& dist, const Grid& grid )
+{
+    unique_ptr<ElementalMatrix<T>> A;
+    #define GUARD(CDIST,RDIST,WRAP) \
+      dist.first == CDIST && dist.second == RDIST && ELEMENT == WRAP
+    #define PAYLOAD(CDIST,RDIST,WRAP) \
+      A.reset( new DistMatrix<T,CDIST,RDIST>(grid) );
+    #include <El/macros/GuardAndPayload.h>
+    return A;
+}
+
+// The number of entries of B which this process does not store within A
+template<typename T>
+Int NumMissing( const ElementalMatrix<T>& A, const ElementalMatrix<T>& B )
+{
+    if( !B.Participating() )
+        return 0;
+    Int numMissing = 0;
+    const Int localHeight = B.LocalHeight();
+    const Int localWidth = B.LocalWidth();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = B.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            if( !A.IsLocal( B.GlobalRow(iLoc), j ) )
+                ++numMissing;
+    }
+    return numMissing;
+}
+
+template<typename T>
+void Benchmark
+( bench::Report& report, const bench::Settings& settings, Int n,
+  double peakBandwidth, vector<string>& genericPairs, const Grid& grid )
+{
+    for( const auto& sourceDist : distributions )
+    {
+        auto A = NewDistMatrix<T>( sourceDist, grid );
+        Uniform( *A, n, n );
+        for( const auto& targetDist : distributions )
+        {
+            auto B = NewDistMatrix<T>( targetDist, grid );
+            const string pairString =
+              DistString(sourceDist)+" -> "+DistString(targetDist);
+            auto benchCase =
+              bench::NewCase<T>( "Redistribute", pairString, grid );
+            benchCase.params = { {"m",n}, {"n",n} };
+
+            const Int numGenericBefore = copy::NumGeneralPurposeCopies();
+            benchCase = bench::Time
+              ( benchCase, settings, grid.Comm(),
+                []() { },
+                [&]() { Copy( *A, *B ); } );
+            const bool localGeneric =
+              copy::NumGeneralPurposeCopies() > numGenericBefore;
+            const bool generic =
+              mpi::AllReduce( int(localGeneric), mpi::MAX, grid.Comm() );
+
+            if( benchCase.error.empty() )
+            {
+                const Int numMissing = NumMissing( *A, *B );
+                const double maxBytes = double(sizeof(T))*
+                  mpi::AllReduce( numMissing, mpi::MAX, grid.Comm() );
+                const double totalBytes = double(sizeof(T))*
+                  mpi::AllReduce( numMissing, mpi::SUM, grid.Comm() );
+                const double meanTime =
+                  bench::Statistics(benchCase.times).mean;
+                const double bandwidth = maxBytes/(1.e9*meanTime);
+                benchCase.extras =
+                  { {"generic",generic},
+                    {"minBytesPerProcess",maxBytes},
+                    {"minTotalBytes",totalBytes},
+                    {"bandwidthGBs",bandwidth} };
+                if( peakBandwidth > 0 )
+                    benchCase.extras.push_back
+                    ( {"peakFraction",bandwidth/peakBandwidth} );
+            }
+            if( generic )
+            {
+                benchCase.variant += " (generic)";
+                if( std::find
+                    ( genericPairs.begin(), genericPairs.end(), pairString )
+                    == genericPairs.end() )
+                    genericPairs.push_back( pairString );
+            }
+            report.Add( benchCase );
+        }
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const bench::Settings settings =
+          bench::CommonSettings("1000,4000","d");
+        const double peakBandwidth =
+          Input("--peakBandwidth","peak bandwidth per process in GB/s",0.);
+        ProcessInput();
+        PrintInputReport();
+
+        bench::Report report( "Redistribute", comm );
+        vector<string> genericPairs;
+        for( const int gridHeight : bench::GridHeights( settings, comm ) )
+        {
+            const Grid grid( comm, gridHeight );
+            for( const Int n : settings.sizes )
+            {
+                if( settings.Wants('s') )
+                    Benchmark<float>
+                    ( report, settings, n, peakBandwidth, genericPairs,
+                      grid );
+                if( settings.Wants('d') )
+                    Benchmark<double>
+                    ( report, settings, n, peakBandwidth, genericPairs,
+                      grid );
+                if( settings.Wants('c') )
+                    Benchmark<Complex<float>>
+                    ( report, settings, n, peakBandwidth, genericPairs,
+                      grid );
+                if( settings.Wants('z') )
+                    Benchmark<Complex<double>>
+                    ( report, settings, n, peakBandwidth, genericPairs,
+                      grid );
+            }
+        }
+        OutputFromRoot
+        (comm,genericPairs.size(),
+         " distribution pairs used the general-purpose redistribution:");
+        for( const auto& pairString : genericPairs )
+            OutputFromRoot(comm,"  ",pairString);
+        report.Write( settings.jsonFile );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+template<typename F>
+void Benchmark
+( bench::Report& report, const bench::Settings& settings, Int n,
+  const Grid& grid )
+{
+    DistMatrix<F> AOrig(grid), A(grid);
+    HermitianUniformSpectrum( AOrig, n, 1, 10 );
+    for( const UpperOrLower uplo : {LOWER,UPPER} )
+    {
+        auto benchCase = bench::NewCase<F>
+          ( "Cholesky", uplo==LOWER ? "lower" : "upper", grid );
+        benchCase.params = { {"n",n} };
+        benchCase.gFlops = bench::FlopScale<F>()*double(n)*n*n/(3.*1.e9);
+        report.Add
+        ( bench::Time
+          ( benchCase, settings, grid.Comm(),
+            [&]() { A = AOrig; },
+            [&]() { Cholesky( uplo, A ); } ) );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const bench::Settings settings =
+          bench::CommonSettings("1000,2000,4000");
+        ProcessInput();
+        PrintInputReport();
+
+        bench::Report report( "Cholesky", comm );
+        for( const int gridHeight : bench::GridHeights( settings, comm ) )
+        {
+            const Grid grid( comm, gridHeight );
+            for( const Int n : settings.sizes )
+            {
+                if( settings.Wants('s') )
+                    Benchmark<float>( report, settings, n, grid );
+                if( settings.Wants('d') )
+                    Benchmark<double>( report, settings, n, grid );
+                if( settings.Wants('c') )
+                    Benchmark<Complex<float>>( report, settings, n, grid );
+                if( settings.Wants('z') )
+                    Benchmark<Complex<double>>( report, settings, n, grid );
+            }
+        }
+        report.Write( settings.jsonFile );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+// The nominal operation counts are those of the reduction to real symmetric
+// tridiagonal form and, when eigenvectors are computed, of the
+// back-transformation
+template<typename F>
+void Benchmark
+( bench::Report& report, const bench::Settings& settings, Int n,
+  const Grid& grid )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> AOrig(grid), A(grid), Q(grid);
+    DistMatrix<Real,VR,STAR> w(grid);
+    HermitianUniformSpectrum( AOrig, n, -10, 10 );
+    const double scale = bench::FlopScale<F>()*n*n*n/1.e9;
+
+    auto benchCase = bench::NewCase<F>( "HermitianEig", "values", grid );
+    benchCase.params = { {"n",n} };
+    benchCase.gFlops = 4.*scale/3.;
+    report.Add
+    ( bench::Time
+      ( benchCase, settings, grid.Comm(),
+        [&]() { A = AOrig; },
+        [&]() { HermitianEig( LOWER, A, w ); } ) );
+
+    benchCase = bench::NewCase<F>( "HermitianEig", "vectors", grid );
+    benchCase.params = { {"n",n} };
+    benchCase.gFlops = 10.*scale/3.;
+    report.Add
+    ( bench::Time
+      ( benchCase, settings, grid.Comm(),
+        [&]() { A = AOrig; },
+        [&]() { HermitianEig( LOWER, A, w, Q ); } ) );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const bench::Settings settings =
+          bench::CommonSettings("500,1000,2000");
+        ProcessInput();
+        PrintInputReport();
+
+        bench::Report report( "HermitianEig", comm );
+        for( const int gridHeight : bench::GridHeights( settings, comm ) )
+        {
+            const Grid grid( comm, gridHeight );
+            for( const Int n : settings.sizes )
+            {
+                if( settings.Wants('s') )
+                    Benchmark<float>( report, settings, n, grid );
+                if( settings.Wants('d') )
+                    Benchmark<double>( report, settings, n, grid );
+                if( settings.Wants('c') )
+                    Benchmark<Complex<float>>( report, settings, n, grid );
+                if( settings.Wants('z') )
+                    Benchmark<Complex<double>>( report, settings, n, grid );
+            }
+        }
+        report.Write( settings.jsonFile );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,72 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+// Householder QR of a square matrix and of a tall-skinny matrix with eight
+// times as many rows as columns
+template<typename F>
+void Benchmark
+( bench::Report& report, const bench::Settings& settings, Int n,
+  const Grid& grid )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> AOrig(grid), A(grid), householderScalars(grid);
+    DistMatrix<Real> signature(grid);
+    for( const Int m : {n,8*n} )
+    {
+        Uniform( AOrig, m, n );
+        auto benchCase = bench::NewCase<F>
+          ( "QR", m==n ? "square" : "tall", grid );
+        benchCase.params = { {"m",m}, {"n",n} };
+        benchCase.gFlops =
+          bench::FlopScale<F>()*(2.*m*n*n-2.*n*n*n/3.)/1.e9;
+        report.Add
+        ( bench::Time
+          ( benchCase, settings, grid.Comm(),
+            [&]() { A = AOrig; },
+            [&]() { QR( A, householderScalars, signature ); } ) );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const bench::Settings settings =
+          bench::CommonSettings("500,1000,2000");
+        ProcessInput();
+        PrintInputReport();
+
+        bench::Report report( "QR", comm );
+        for( const int gridHeight : bench::GridHeights( settings, comm ) )
+        {
+            const Grid grid( comm, gridHeight );
+            for( const Int n : settings.sizes )
+            {
+                if( settings.Wants('s') )
+                    Benchmark<float>( report, settings, n, grid );
+                if( settings.Wants('d') )
+                    Benchmark<double>( report, settings, n, grid );
+                if( settings.Wants('c') )
+                    Benchmark<Complex<float>>( report, settings, n, grid );
+                if( settings.Wants('z') )
+                    Benchmark<Complex<double>>( report, settings, n, grid );
+            }
+        }
+        report.Write( settings.jsonFile );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
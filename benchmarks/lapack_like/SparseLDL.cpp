@@ -0,0 +1,97 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+using namespace El;
+
+// Factor the 7-point Laplacian over an n x n x n grid (using the analytic
+// nested dissection of the grid graph) and solve against a set of
+// right-hand sides. The operation counts are those of the frontal tree.
+template<typename F>
+void Benchmark
+( bench::Report& report, const bench::Settings& settings, Int n,
+  Int numRHS, const Grid& grid )
+{
+    DistSparseMatrix<F> A(grid);
+    Laplacian( A, n, n, n );
+    A *= -F(1);
+    const Int N = A.Height();
+    DistMultiVec<F> BOrig(N,numRHS,grid), B(N,numRHS,grid);
+    MakeUniform( BOrig );
+
+    DistSparseLDLFactorization<F> sparseLDLFact;
+    const vector<pair<LDLFrontType,string>> frontTypes =
+      { {LDL_1D,"1D fronts"}, {LDL_2D,"2D fronts"} };
+    for( const auto& frontType : frontTypes )
+    {
+        auto benchCase =
+          bench::NewCase<F>( "SparseLDL", frontType.second, grid );
+        benchCase.params = { {"n",n}, {"height",N} };
+        benchCase = bench::Time
+          ( benchCase, settings, grid.Comm(),
+            [&]() { sparseLDLFact.Initialize3DGridGraph( n, n, n, A ); },
+            [&]() { sparseLDLFact.Factor( frontType.first ); } );
+        if( benchCase.error.empty() )
+            benchCase.gFlops = mpi::AllReduce
+              ( sparseLDLFact.LocalFactorGFlops(), grid.Comm() );
+        report.Add( benchCase );
+
+        auto solveCase = bench::NewCase<F>
+          ( "SparseLDLSolve", frontType.second, grid );
+        solveCase.params = { {"n",n}, {"height",N}, {"numRHS",numRHS} };
+        if( !benchCase.error.empty() )
+            continue;
+        solveCase.gFlops = mpi::AllReduce
+          ( sparseLDLFact.LocalSolveGFlops(numRHS), grid.Comm() );
+        report.Add
+        ( bench::Time
+          ( solveCase, settings, grid.Comm(),
+            [&]() { B = BOrig; },
+            [&]() { sparseLDLFact.Solve( B ); } ) );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const bench::Settings settings =
+          bench::CommonSettings("20,30,40");
+        const Int numRHS =
+          Input("--numRHS","number of right-hand sides",Int(1));
+        ProcessInput();
+        PrintInputReport();
+
+        bench::Report report( "SparseLDL", comm );
+        for( const int gridHeight : bench::GridHeights( settings, comm ) )
+        {
+            const Grid grid( comm, gridHeight );
+            for( const Int n : settings.sizes )
+            {
+                if( settings.Wants('s') )
+                    Benchmark<float>( report, settings, n, numRHS, grid );
+                if( settings.Wants('d') )
+                    Benchmark<double>( report, settings, n, numRHS, grid );
+                if( settings.Wants('c') )
+                    Benchmark<Complex<float>>
+                    ( report, settings, n, numRHS, grid );
+                if( settings.Wants('z') )
+                    Benchmark<Complex<double>>
+                    ( report, settings, n, numRHS, grid );
+            }
+        }
+        report.Write( settings.jsonFile );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,329 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../Benchmark.hpp"
+#include <dirent.h>
+using namespace El;
+
+// Run a collection of (Netlib/MIPLIB-style) MPS models through the sparse
+// Mehrotra IPMs, once with the affine formulation (whose KKT system is always
+// the full one) and once with the equivalent direct formulation,
+//
+//   min [c; -c; 0]^T [x+; x-; s],
+//   s.t. [A, -A, 0; G, -G, I] [x+; x-; s] = [b; h], [x+; x-; s] >= 0,
+//
+// for each of its three KKT systems (full, augmented, and normal). One line
+// of comma-separated values is reported per model and formulation, with the
+// number of iterations, the total time spent forming the KKT systems, in
+// their factorizations, in the solves against them, and in the IPM as a
+// whole, and the relative primal and dual residuals and duality gap of the
+// final iterate.
+//
+// The models are solved by the sequential sparse IPMs, with the runs spread
+// over the processes in a round-robin fashion (so timings are the cleanest
+// with a single process per node).
+
+const string csvHeader =
+  "model,form,system,rows,cols,nonzeros,status,iterations,readSeconds,"
+  "kktSeconds,factorSeconds,solveSeconds,ipmSeconds,primalObjective,"
+  "dualObjective,relGap,relPrimalResidual,relDualResidual";
+
+vector<string> ModelFiles( const string& directory, const string& modelList )
+{
+    vector<string> models = bench::ParseList<string>( modelList );
+    if( models.empty() )
+    {
+        DIR* dir = opendir( directory.c_str() );
+        if( dir == nullptr )
+            RuntimeError("Could not open the directory ",directory);
+        while( struct dirent* entry = readdir(dir) )
+        {
+            const string name = entry->d_name;
+            if( name.size() > 4 && name.compare(name.size()-4,4,".mps") == 0 )
+                models.push_back( name );
+        }
+        closedir( dir );
+        std::sort( models.begin(), models.end() );
+    }
+    for( auto& model : models )
+        model = directory + "/" + model;
+    return models;
+}
+
+template<typename Real>
+void AffineToDirect
+( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& affineProblem,
+        DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& directProblem )
+{
+    EL_DEBUG_CSE
+    const auto& A = affineProblem.A;
+    const auto& G = affineProblem.G;
+    const Int m = A.Height();
+    const Int k = G.Height();
+    const Int n = A.Width();
+
+    Zeros( directProblem.A, m+k, 2*n+k );
+    directProblem.A.Reserve( 2*A.NumEntries()+2*G.NumEntries()+k );
+    for( Int e=0; e<A.NumEntries(); ++e )
+    {
+        directProblem.A.QueueUpdate( A.Row(e), A.Col(e), A.Value(e) );
+        directProblem.A.QueueUpdate( A.Row(e), A.Col(e)+n, -A.Value(e) );
+    }
+    for( Int e=0; e<G.NumEntries(); ++e )
+    {
+        directProblem.A.QueueUpdate( G.Row(e)+m, G.Col(e), G.Value(e) );
+        directProblem.A.QueueUpdate( G.Row(e)+m, G.Col(e)+n, -G.Value(e) );
+    }
+    for( Int i=0; i<k; ++i )
+        directProblem.A.QueueUpdate( i+m, i+2*n, Real(1) );
+    directProblem.A.ProcessQueues();
+
+    Zeros( directProblem.b, m+k, 1 );
+    for( Int i=0; i<m; ++i )
+        directProblem.b(i) = affineProblem.b(i);
+    for( Int i=0; i<k; ++i )
+        directProblem.b(i+m) = affineProblem.h(i);
+
+    Zeros( directProblem.c, 2*n+k, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        directProblem.c(j) = affineProblem.c(j);
+        directProblem.c(j+n) = -affineProblem.c(j);
+    }
+}
+
+template<typename Real>
+struct Measures
+{
+    Real primalObj=0, dualObj=0, relGap=0;
+    Real relPrimalRes=0, relDualRes=0;
+};
+
+template<typename Real>
+Measures<Real> FinalMeasures
+( const DirectLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+  const DirectLPSolution<Matrix<Real>>& solution )
+{
+    Measures<Real> measures;
+    measures.primalObj = Dot( problem.c, solution.x );
+    measures.dualObj = -Dot( problem.b, solution.y );
+    measures.relGap = Abs(measures.primalObj-measures.dualObj) /
+      (1+Abs(measures.primalObj));
+
+    Matrix<Real> primalRes( problem.b );
+    Multiply( NORMAL, Real(1), problem.A, solution.x, Real(-1), primalRes );
+    measures.relPrimalRes = Nrm2(primalRes) / (1+Nrm2(problem.b));
+
+    Matrix<Real> dualRes( problem.c );
+    Axpy( Real(-1), solution.z, dualRes );
+    Multiply( TRANSPOSE, Real(1), problem.A, solution.y, Real(1), dualRes );
+    measures.relDualRes = Nrm2(dualRes) / (1+Nrm2(problem.c));
+    return measures;
+}
+
+template<typename Real>
+Measures<Real> FinalMeasures
+( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+  const AffineLPSolution<Matrix<Real>>& solution )
+{
+    Measures<Real> measures;
+    measures.primalObj = Dot( problem.c, solution.x );
+    measures.dualObj =
+      -Dot( problem.b, solution.y ) - Dot( problem.h, solution.z );
+    measures.relGap = Abs(measures.primalObj-measures.dualObj) /
+      (1+Abs(measures.primalObj));
+
+    Matrix<Real> equalityRes( problem.b ), conicRes( problem.h );
+    Multiply( NORMAL, Real(1), problem.A, solution.x, Real(-1), equalityRes );
+    Multiply( NORMAL, Real(1), problem.G, solution.x, Real(-1), conicRes );
+    Axpy( Real(1), solution.s, conicRes );
+    measures.relPrimalRes =
+      SafeNorm( Nrm2(equalityRes), Nrm2(conicRes) ) /
+      (1+SafeNorm( Nrm2(problem.b), Nrm2(problem.h) ));
+
+    Matrix<Real> dualRes( problem.c );
+    Multiply( TRANSPOSE, Real(1), problem.A, solution.y, Real(1), dualRes );
+    Multiply( TRANSPOSE, Real(1), problem.G, solution.z, Real(1), dualRes );
+    measures.relDualRes = Nrm2(dualRes) / (1+Nrm2(problem.c));
+    return measures;
+}
+
+// Solve a single formulation and return its line of comma-separated values
+template<typename Real,typename Problem,typename Solution,typename Ctrl>
+string Solve
+( const string& model, const string& form, const string& system,
+  const Problem& problem, Solution& solution, Ctrl& ctrl, double readTime )
+{
+    MehrotraIterationInfo<Real> totals;
+    ctrl.mehrotraCtrl.iterationCallback =
+      [&]( const MehrotraIterationInfo<Real>& info )
+      {
+          totals.numIts = info.numIts;
+          totals.kktTime += info.kktTime;
+          totals.factorTime += info.factorTime;
+          totals.solveTime += info.solveTime;
+          totals.iterationTime += info.iterationTime;
+      };
+
+    string status = "converged";
+    Measures<Real> measures;
+    try
+    {
+        LP( problem, solution, ctrl );
+        measures = FinalMeasures( problem, solution );
+    }
+    catch( std::exception& e )
+    {
+        // Keep the message from breaking the comma-separated fields
+        status = e.what();
+        for( char& c : status )
+            if( c == ',' || c == '\n' || c == '"' )
+                c = ' ';
+    }
+
+    ostringstream os;
+    os.precision( 10 );
+    os << model << "," << form << "," << system << ","
+       << problem.A.Height() << "," << problem.A.Width() << ","
+       << problem.A.NumEntries() << "," << status << ","
+       << totals.numIts << "," << readTime << ","
+       << totals.kktTime << "," << totals.factorTime << ","
+       << totals.solveTime << "," << totals.iterationTime << ","
+       << measures.primalObj << "," << measures.dualObj << ","
+       << measures.relGap << "," << measures.relPrimalRes << ","
+       << measures.relDualRes << "\n";
+    return os.str();
+}
+
+template<typename Real>
+string Benchmark
+( const string& filename, bool compressed, bool presolve,
+  Real regTmp, Real regPerm, bool resolveReg, Int maxGondzioCorrs )
+{
+    EL_DEBUG_CSE
+    string model = filename.substr( filename.find_last_of('/')+1 );
+
+    Timer timer;
+    timer.Start();
+    AffineLPProblem<SparseMatrix<Real>,Matrix<Real>> affineProblem;
+    ReadMPS( affineProblem, filename, compressed );
+    const double readTime = timer.Stop();
+
+    MehrotraCtrl<Real> mehrotraCtrl;
+    mehrotraCtrl.resolveReg = resolveReg;
+    mehrotraCtrl.maxGondzioCorrs = maxGondzioCorrs;
+    if( regTmp > Real(0) )
+        mehrotraCtrl.reg0Tmp = mehrotraCtrl.reg1Tmp = mehrotraCtrl.reg2Tmp =
+          regTmp;
+    if( regPerm > Real(0) )
+        mehrotraCtrl.reg0Perm = mehrotraCtrl.reg1Perm = mehrotraCtrl.reg2Perm =
+          regPerm;
+
+    string lines;
+    {
+        lp::affine::Ctrl<Real> ctrl;
+        ctrl.presolve = presolve;
+        ctrl.mehrotraCtrl = mehrotraCtrl;
+        ctrl.mehrotraCtrl.system = FULL_KKT;
+        AffineLPSolution<Matrix<Real>> solution;
+        lines += Solve<Real>
+          ( model, "affine", "full", affineProblem, solution, ctrl,
+            readTime );
+    }
+
+    DirectLPProblem<SparseMatrix<Real>,Matrix<Real>> directProblem;
+    AffineToDirect( affineProblem, directProblem );
+    const vector<pair<KKTSystem,string>> systems =
+      { {FULL_KKT,"full"}, {AUGMENTED_KKT,"augmented"}, {NORMAL_KKT,"normal"} };
+    for( const auto& system : systems )
+    {
+        lp::direct::Ctrl<Real> ctrl(true);
+        ctrl.mehrotraCtrl = mehrotraCtrl;
+        ctrl.mehrotraCtrl.system = system.first;
+        DirectLPSolution<Matrix<Real>> solution;
+        lines += Solve<Real>
+          ( model, "direct", system.second, directProblem, solution, ctrl,
+            readTime );
+    }
+    return lines;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const string directory =
+          Input("--directory","directory of MPS models",
+                string("../data/optimization"));
+        const string modelList =
+          Input("--models","comma-separated models (default: all *.mps)",
+                string(""));
+        const bool compressed =
+          Input("--compressed","are the models compressed?",false);
+        const bool presolve =
+          Input("--presolve","presolve the affine LPs?",false);
+        const double regTmp =
+          Input("--regTmp","temporary regularization (if positive)",0.);
+        const double regPerm =
+          Input("--regPerm","permanent regularization (if positive)",0.);
+        const bool resolveReg =
+          Input("--resolveReg","iteratively remove the regularization?",true);
+        const Int maxGondzioCorrs =
+          Input("--maxGondzioCorrs","max Gondzio correctors",Int(0));
+        const string csvFile =
+          Input("--csv","CSV output file",string(""));
+        ProcessInput();
+        PrintInputReport();
+
+        const vector<string> models = ModelFiles( directory, modelList );
+        if( models.empty() )
+            LogicError("No MPS models were found in ",directory);
+
+        string localLines;
+        for( size_t k=commRank; k<models.size(); k+=commSize )
+            localLines += Benchmark<double>
+              ( models[k], compressed, presolve, regTmp, regPerm, resolveReg,
+                maxGondzioCorrs );
+
+        // Gather the lines onto the root process
+        const int localSize = localLines.size();
+        vector<int> sizes(commSize), offsets(commSize);
+        mpi::Gather( &localSize, 1, sizes.data(), 1, 0, comm );
+        const int totalSize = Scan( sizes, offsets );
+        vector<byte> lines( totalSize );
+        mpi::Gather
+        ( reinterpret_cast<const byte*>(localLines.data()), localSize,
+          lines.data(), sizes.data(), offsets.data(), 0, comm );
+
+        if( commRank == 0 )
+        {
+            const string csv =
+              csvHeader + "\n" + string( lines.begin(), lines.end() );
+            if( csvFile.empty() )
+            {
+                cout << csv;
+            }
+            else
+            {
+                std::ofstream file( csvFile.c_str() );
+                if( !file.is_open() )
+                    RuntimeError("Could not open ",csvFile);
+                file << csv;
+            }
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
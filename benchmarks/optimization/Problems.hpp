@@ -0,0 +1,87 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BENCHMARK_OPTIMIZATION_PROBLEMS_HPP
+#define EL_BENCHMARK_OPTIMIZATION_PROBLEMS_HPP
+
+#include "../Benchmark.hpp"
+
+// Random, feasible, and bounded problems in direct conic form: the m x n
+// constraint matrix is the identity in its leading m columns (so that it has
+// full row rank) plus a few random entries per row. Setting the primal
+// solution x0 and the dual slack z0 to all ones and the dual solution y0 to
+// random values and forming
+//
+//   b = A x0,  c = z0 - A^T y0 - Q x0,
+//
+// guarantees that a solution exists. The random entries are drawn from
+// collective counter-based streams and are therefore independent of the
+// process grid.
+
+namespace bench {
+
+template<typename Real>
+void RandomConstraints
+( DistSparseMatrix<Real>& A, Int m, Int n, Int numRandomPerRow )
+{
+    Zeros( A, m, n );
+    const Int localHeight = A.LocalHeight();
+    const CounterRNG rng = NewCounterRNG( true );
+    A.Reserve( localHeight*(numRandomPerRow+1) );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        A.QueueLocalUpdate( iLoc, i, Real(1) );
+        for( Int k=0; k<numRandomPerRow; ++k )
+            A.QueueLocalUpdate
+            ( iLoc, SampleUniform( rng, i, 2*k, Int(0), n ),
+              SampleUniform( rng, i, 2*k+1, Real(-1), Real(1) ) );
+    }
+    A.ProcessLocalQueues();
+}
+
+// A diagonal, positive-definite objective
+template<typename Real>
+void RandomObjective( DistSparseMatrix<Real>& Q, Int n )
+{
+    Zeros( Q, n, n );
+    const Int localHeight = Q.LocalHeight();
+    const CounterRNG rng = NewCounterRNG( true );
+    Q.Reserve( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = Q.GlobalRow(iLoc);
+        Q.QueueLocalUpdate
+        ( iLoc, i, SampleUniform( rng, i, 0, Real(1), Real(2) ) );
+    }
+    Q.ProcessLocalQueues();
+}
+
+template<typename Real>
+void FeasibleData
+( const DistSparseMatrix<Real>& A,
+  const DistSparseMatrix<Real>* Q,
+        DistMultiVec<Real>& b,
+        DistMultiVec<Real>& c )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    DistMultiVec<Real> x0(A.Grid()), y0(A.Grid());
+    Ones( x0, n, 1 );
+    Uniform( y0, m, 1 );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+    Ones( c, n, 1 );
+    Multiply( TRANSPOSE, Real(-1), A, y0, Real(1), c );
+    if( Q != nullptr )
+        Multiply( NORMAL, Real(-1), *Q, x0, Real(1), c );
+}
+
+} // namespace bench
+
+#endif // ifndef EL_BENCHMARK_OPTIMIZATION_PROBLEMS_HPP
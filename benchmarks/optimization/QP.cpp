@@ -0,0 +1,97 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "./Problems.hpp"
+using namespace El;
+
+// Solve a problem with n variables, n/2 equality constraints, and a diagonal
+// objective with the Mehrotra Predictor-Corrector IPM, using the sparse solver
+// for every size and the dense solver for those no larger than 'maxDenseSize'
+template<typename Real>
+void Benchmark
+( bench::Report& report, const bench::Settings& settings, Int n,
+  Int numRandomPerRow, Int maxDenseSize, const Grid& grid )
+{
+    const Int m = n/2;
+    DistSparseMatrix<Real> Q(grid), A(grid);
+    DistMultiVec<Real> b(grid), c(grid), x(grid), y(grid), z(grid);
+    bench::RandomConstraints( A, m, n, numRandomPerRow );
+    bench::RandomObjective( Q, n );
+    bench::FeasibleData( A, &Q, b, c );
+
+    Int numIts = 0;
+    qp::direct::Ctrl<Real> ctrl;
+    ctrl.mehrotraCtrl.iterationCallback =
+      [&]( const MehrotraIterationInfo<Real>& info ) { numIts = info.numIts; };
+    auto benchCase = bench::NewCase<Real>( "QP", "sparse", grid );
+    benchCase.params =
+      { {"m",m}, {"n",n}, {"numEntries",A.NumEntries()} };
+    benchCase = bench::Time
+      ( benchCase, settings, grid.Comm(),
+        []() { },
+        [&]() { QP( Q, A, b, c, x, y, z, ctrl ); } );
+    benchCase.extras = { {"iterations",numIts} };
+    report.Add( benchCase );
+
+    if( n > maxDenseSize )
+        return;
+    DistMatrix<Real> QDense(grid), ADense(grid), bDense(grid), cDense(grid),
+      xDense(grid), yDense(grid), zDense(grid);
+    Copy( Q, QDense );
+    Copy( A, ADense );
+    Copy( b, bDense );
+    Copy( c, cDense );
+    benchCase = bench::NewCase<Real>( "QP", "dense", grid );
+    benchCase.params = { {"m",m}, {"n",n} };
+    report.Add
+    ( bench::Time
+      ( benchCase, settings, grid.Comm(),
+        []() { },
+        [&]()
+        { QP( QDense, ADense, bDense, cDense, xDense, yDense, zDense ); } ) );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const bench::Settings settings =
+          bench::CommonSettings("1000,4000,16000","sd");
+        const Int numRandomPerRow =
+          Input("--numRandomPerRow","random entries per constraint",Int(4));
+        const Int maxDenseSize =
+          Input("--maxDenseSize","largest dense problem",Int(2000));
+        ProcessInput();
+        PrintInputReport();
+
+        bench::Report report( "QP", comm );
+        for( const int gridHeight : bench::GridHeights( settings, comm ) )
+        {
+            const Grid grid( comm, gridHeight );
+            for( const Int n : settings.sizes )
+            {
+                if( settings.Wants('s') )
+                    Benchmark<float>
+                    ( report, settings, n, numRandomPerRow, maxDenseSize,
+                      grid );
+                if( settings.Wants('d') )
+                    Benchmark<double>
+                    ( report, settings, n, numRandomPerRow, maxDenseSize,
+                      grid );
+            }
+        }
+        report.Write( settings.jsonFile );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,270 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "../optimization/Problems.hpp"
+using namespace El;
+
+// Strong and weak scaling of a single routine (Gemm, Cholesky, sparse LDL,
+// or the sparse LP IPM) over a range of process counts within one job.
+//
+// For each process count p, the first p processes of COMM_WORLD form a
+// subcommunicator (and a default-shaped Grid over it) and the problem is
+// generated with the collective counter-based streams, so that it is
+// identical for every p. In strong scaling the problem size is fixed; in
+// weak scaling it grows so that the memory per process is constant (i.e.,
+// with p^(1/2) for the dense routines, with p^(1/3) for the 3D Laplacians,
+// and with p for the LP).
+//
+// The collective profiler supplies the number of collectives and the bytes
+// moved by each process, and the runtime is compared against the
+// latency-bandwidth model
+//
+//   T_model(p) = W(p) / (p R) + alpha M(p) ceil(log2(p)) + beta B(p),
+//
+// where W(p) is the nominal work (the number of variables for the LP),
+// M(p) and B(p) are the maximum numbers of collectives and of bytes over the
+// processes, (alpha,beta) is the Gemm cost model (which can be calibrated
+// with --calibrate), and the per-process rate R is that of the smallest
+// process count after subtracting its modeled communication time. Parallel
+// efficiencies are the per-process work rates relative to that of the
+// smallest process count.
+
+Int ScaledSize( const string& routine, bool weak, Int n, int p, int p0 )
+{
+    if( !weak )
+        return n;
+    const double ratio = double(p)/double(p0);
+    double scale;
+    if( routine == "LP" )
+        scale = ratio;
+    else if( routine == "SparseLDL" )
+        scale = std::cbrt( ratio );
+    else
+        scale = Sqrt( ratio );
+    return Max( Int(std::round(n*scale)), Int(1) );
+}
+
+// Time the routine and return the nominal work of a single repetition
+template<typename Real>
+double Run
+( const string& routine, Int n, bench::Case& benchCase,
+  const bench::Settings& settings, const Grid& grid )
+{
+    // Communication within the (untimed) setup is left out of the profile
+    auto profiled = []( function<void()> setup )
+    {
+        return [=]()
+        {
+            mpi::EnableProfiling( false );
+            setup();
+            mpi::EnableProfiling( true );
+        };
+    };
+
+    double work = 0;
+    if( routine == "Gemm" )
+    {
+        DistMatrix<Real> A(grid), B(grid), C(grid);
+        Uniform( A, n, n );
+        Uniform( B, n, n );
+        benchCase = bench::Time
+          ( benchCase, settings, grid.Comm(),
+            profiled( [&]() { Zeros( C, n, n ); } ),
+            [&]() { Gemm( NORMAL, NORMAL, Real(1), A, B, Real(0), C ); } );
+        work = 2.*n*n*n;
+    }
+    else if( routine == "Cholesky" )
+    {
+        DistMatrix<Real> AOrig(grid), A(grid);
+        Uniform( AOrig, n, n );
+        MakeSymmetric( LOWER, AOrig );
+        ShiftDiagonal( AOrig, Real(n) );
+        benchCase = bench::Time
+          ( benchCase, settings, grid.Comm(),
+            profiled( [&]() { A = AOrig; } ),
+            [&]() { Cholesky( LOWER, A ); } );
+        work = double(n)*n*n/3.;
+    }
+    else if( routine == "SparseLDL" )
+    {
+        DistSparseMatrix<Real> A(grid);
+        Laplacian( A, n, n, n );
+        A *= -Real(1);
+        DistSparseLDLFactorization<Real> sparseLDLFact;
+        benchCase = bench::Time
+          ( benchCase, settings, grid.Comm(),
+            profiled
+            ( [&]() { sparseLDLFact.Initialize3DGridGraph( n, n, n, A ); } ),
+            [&]() { sparseLDLFact.Factor(); } );
+        if( benchCase.error.empty() )
+            work = 1.e9*mpi::AllReduce
+              ( sparseLDLFact.LocalFactorGFlops(), grid.Comm() );
+    }
+    else if( routine == "LP" )
+    {
+        DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>> problem;
+        DirectLPSolution<DistMultiVec<Real>> solution;
+        ForceSimpleAlignments( problem, grid );
+        ForceSimpleAlignments( solution, grid );
+        bench::RandomConstraints( problem.A, n/2, n, Int(4) );
+        bench::FeasibleData<Real>( problem.A, nullptr, problem.b, problem.c );
+        benchCase = bench::Time
+          ( benchCase, settings, grid.Comm(),
+            profiled( []() { } ),
+            [&]() { LP( problem, solution ); } );
+        work = n;
+    }
+    else
+        LogicError("Unsupported routine: ",routine);
+    return work;
+}
+
+// The maximum over the processes of the number of collectives, the bytes
+// sent or received, and the time spent within collectives
+void ProfileTotals
+( mpi::Comm comm, double& numCalls, double& bytes, double& seconds )
+{
+    numCalls = bytes = seconds = 0;
+    for( const auto& entry : mpi::Profile() )
+    {
+        numCalls += entry.numCalls;
+        bytes += Max( entry.bytesSent, entry.bytesRecv );
+        seconds += entry.seconds;
+    }
+    numCalls = mpi::AllReduce( numCalls, mpi::MAX, comm );
+    bytes = mpi::AllReduce( bytes, mpi::MAX, comm );
+    seconds = mpi::AllReduce( seconds, mpi::MAX, comm );
+}
+
+template<typename Real>
+void Scale
+( bench::Report& report, const bench::Settings& settings,
+  const string& routine, bool weak, Int baseSize,
+  const vector<int>& processCounts )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const GemmCostModel& costModel = GetGemmCostModel();
+    const int p0 = processCounts.front();
+
+    bool haveBaseline = false;
+    double baseRate=0, computeRate=0;
+    for( const int p : processCounts )
+    {
+        mpi::Comm subComm;
+        mpi::Split( comm, commRank < p ? 0 : 1, commRank, subComm );
+        if( commRank < p )
+        {
+            const Grid grid( subComm );
+            const Int n = ScaledSize( routine, weak, baseSize, p, p0 );
+            auto benchCase = bench::NewCase<Real>
+              ( routine, weak ? "weak" : "strong", grid );
+            benchCase.params = { {"n",n}, {"processes",p} };
+
+            mpi::ResetProfile();
+            mpi::EnableProfiling( true );
+            const double work =
+              Run<Real>( routine, n, benchCase, settings, grid );
+            mpi::EnableProfiling( false );
+
+            if( benchCase.error.empty() )
+            {
+                const double numRuns = settings.numWarmups+settings.numReps;
+                double numCalls, bytes, commSeconds;
+                ProfileTotals( subComm, numCalls, bytes, commSeconds );
+                numCalls /= numRuns;
+                bytes /= numRuns;
+                commSeconds /= numRuns;
+
+                const double time = bench::Statistics(benchCase.times).mean;
+                const double logP = std::ceil( std::log2( double(p) ) );
+                const double modelComm =
+                  costModel.latency*numCalls*logP +
+                  costModel.inverseBandwidth*bytes;
+                const double rate = work/(p*time);
+                if( !haveBaseline )
+                {
+                    haveBaseline = true;
+                    baseRate = rate;
+                    const double computeTime =
+                      ( time > modelComm ? time-modelComm : time );
+                    computeRate = work/(p*computeTime);
+                }
+                const double modelTime = work/(p*computeRate) + modelComm;
+                if( routine != "LP" )
+                    benchCase.gFlops = work/1.e9;
+                benchCase.extras =
+                  { {"efficiency",rate/baseRate},
+                    {"modelSeconds",modelTime},
+                    {"modelEfficiency",(work/(p*modelTime))/baseRate},
+                    {"modelCommSeconds",modelComm},
+                    {"profiledCommSeconds",commSeconds},
+                    {"collectives",numCalls},
+                    {"bytes",bytes} };
+            }
+            report.Add( benchCase );
+        }
+        mpi::Free( subComm );
+        mpi::Barrier( comm );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const bench::Settings settings = bench::CommonSettings("2000","d");
+        const string routine =
+          Input("--routine","Gemm, Cholesky, SparseLDL, or LP",
+                string("Gemm"));
+        const bool weak = Input("--weak","weak (rather than strong)?",false);
+        const string processCountList =
+          Input("--processCounts","comma-separated process counts",
+                string(""));
+        const bool calibrate =
+          Input("--calibrate","calibrate the cost model?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        vector<int> processCounts = bench::ParseList<int>( processCountList );
+        if( processCounts.empty() )
+        {
+            for( int p=1; p<commSize; p*=2 )
+                processCounts.push_back( p );
+            processCounts.push_back( commSize );
+        }
+        for( const int p : processCounts )
+            if( p < 1 || p > commSize )
+                LogicError("Invalid process count: ",p);
+        std::sort( processCounts.begin(), processCounts.end() );
+
+        if( calibrate )
+            CalibrateGemmCostModel( comm );
+        SetCounterBasedRandom( true );
+
+        bench::Report report( "Scaling", comm );
+        for( const Int n : settings.sizes )
+        {
+            if( settings.Wants('s') )
+                Scale<float>( report, settings, routine, weak, n,
+                              processCounts );
+            if( settings.Wants('d') )
+                Scale<double>( report, settings, routine, weak, n,
+                               processCounts );
+        }
+        report.Write( settings.jsonFile );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,29 @@
+#
+#  Copyright 2009-2016, Jack Poulson
+#  All rights reserved.
+#
+#  This file is part of Elemental and is under the BSD 2-Clause License,
+#  which can be found in the LICENSE file in the root directory, or at
+#  http://opensource.org/licenses/BSD-2-Clause
+#
+set(EL_HAVE_CUDA FALSE)
+if(EL_USE_CUDA)
+  # Search for the CUDA runtime along with cuBLAS and cuSOLVER (the kernels
+  # are only called from host code, so no CUDA compiler is required)
+  find_package(CUDA)
+  if(CUDA_FOUND)
+    find_library(EL_CUSOLVER_LIB NAMES cusolver
+      HINTS ${CUDA_TOOLKIT_ROOT_DIR}
+      PATH_SUFFIXES lib64 lib)
+  endif()
+  if(CUDA_FOUND AND CUDA_CUBLAS_LIBRARIES AND EL_CUSOLVER_LIB)
+    set(EL_HAVE_CUDA TRUE)
+    message(STATUS "Found CUDA ${CUDA_VERSION} with cuBLAS and cuSOLVER")
+    include_directories(${CUDA_INCLUDE_DIRS})
+    list(APPEND EXTERNAL_INCLUDE_DIRS ${CUDA_INCLUDE_DIRS})
+    set(EXTERNAL_LIBS ${EXTERNAL_LIBS}
+      ${EL_CUSOLVER_LIB} ${CUDA_CUBLAS_LIBRARIES} ${CUDA_LIBRARIES})
+  else()
+    message(STATUS "Did NOT find CUDA along with cuBLAS and cuSOLVER")
+  endif()
+endif()
@@ -47,6 +47,23 @@ set(NOEXCEPT_CODE
 check_cxx_source_compiles("${STEADYCLOCK_CODE}" EL_HAVE_STEADYCLOCK)
 check_cxx_source_compiles("${NOEXCEPT_CODE}" EL_HAVE_NOEXCEPT)
 
+# POSIX memory mapping (with access-pattern advice)
+# ===============================================
+set(MMAP_CODE
+    "#include <sys/mman.h>
+     #include <fcntl.h>
+     #include <unistd.h>
+     int main()
+     {
+         const int fd = open( \"file\", O_RDONLY );
+         void* a = mmap( 0, 1, PROT_READ, MAP_SHARED, fd, 0 );
+         madvise( a, 1, MADV_WILLNEED );
+         munmap( a, 1 );
+         close( fd );
+         return 0;
+     }")
+check_cxx_source_compiles("${MMAP_CODE}" EL_HAVE_MMAP)
+
 # C++11 random number generation
 # ==============================
 # Note: It was noticed that, for certain relatively recent Intel compiler
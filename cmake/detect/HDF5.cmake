@@ -0,0 +1,27 @@
+#
+#  Copyright 2009-2016, Jack Poulson
+#  All rights reserved.
+#
+#  This file is part of Elemental and is under the BSD 2-Clause License,
+#  which can be found in the LICENSE file in the root directory, or at
+#  http://opensource.org/licenses/BSD-2-Clause
+#
+set(EL_HAVE_HDF5 FALSE)
+if(EL_USE_HDF5)
+  # Search for HDF5 (whether or not it supports parallel I/O is detected
+  # through H5_HAVE_PARALLEL within hdf5.h)
+  find_package(HDF5 COMPONENTS C)
+  if(HDF5_FOUND)
+    set(EL_HAVE_HDF5 TRUE)
+    if(HDF5_IS_PARALLEL)
+      message(STATUS "Found parallel HDF5")
+    else()
+      message(STATUS "Found serial HDF5")
+    endif()
+    include_directories(${HDF5_INCLUDE_DIRS})
+    list(APPEND EXTERNAL_INCLUDE_DIRS ${HDF5_INCLUDE_DIRS})
+    set(EXTERNAL_LIBS ${EXTERNAL_LIBS} ${HDF5_LIBRARIES})
+  else()
+    message(STATUS "Did NOT find HDF5")
+  endif()
+endif()
@@ -230,6 +230,51 @@ set(MPIX_IALLGATHER_CODE
      }")
 El_check_c_source_compiles("${MPIX_IALLGATHER_CODE}" 
   EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
+set(MPI_SHARED_MEMORY_CODE
+    "#include \"mpi.h\"
+     int main( int argc, char* argv[] )
+     {
+       MPI_Init( &argc, &argv );
+       MPI_Comm nodeComm;
+       MPI_Comm_split_type
+       ( MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &nodeComm );
+       void* base;
+       MPI_Win win;
+       MPI_Win_allocate_shared
+       ( 8, 1, MPI_INFO_NULL, nodeComm, &base, &win );
+       MPI_Aint size;
+       int dispUnit;
+       MPI_Win_shared_query( win, 0, &size, &dispUnit, &base );
+       MPI_Win_lock_all( MPI_MODE_NOCHECK, win );
+       MPI_Win_sync( win );
+       MPI_Win_unlock_all( win );
+       MPI_Win_free( &win );
+       MPI_Finalize();
+       return 0;
+     }")
+El_check_c_source_compiles("${MPI_SHARED_MEMORY_CODE}"
+  EL_HAVE_MPI3_SHARED_MEMORY)
+set(MPI_NEIGHBORHOOD_CODE
+    "#include \"mpi.h\"
+     int main( int argc, char* argv[] )
+     {
+       MPI_Init( &argc, &argv );
+       int neighbor = 0, count = 0, displ = 0;
+       MPI_Comm graphComm;
+       MPI_Dist_graph_create_adjacent
+       ( MPI_COMM_WORLD, 1, &neighbor, MPI_UNWEIGHTED,
+                         1, &neighbor, MPI_UNWEIGHTED,
+         MPI_INFO_NULL, 0, &graphComm );
+       double sbuf, rbuf;
+       MPI_Neighbor_alltoallv
+       ( &sbuf, &count, &displ, MPI_DOUBLE,
+         &rbuf, &count, &displ, MPI_DOUBLE, graphComm );
+       MPI_Comm_free( &graphComm );
+       MPI_Finalize();
+       return 0;
+     }")
+El_check_c_source_compiles("${MPI_NEIGHBORHOOD_CODE}"
+  EL_HAVE_MPI3_NEIGHBORHOOD_COLLECTIVES)
 set(MPI_INIT_THREAD_CODE
     "#include \"mpi.h\"
      int main( int argc, char* argv[] )
@@ -0,0 +1,21 @@
+#
+#  Copyright 2009-2016, Jack Poulson
+#  All rights reserved.
+#
+#  This file is part of Elemental and is under the BSD 2-Clause License,
+#  which can be found in the LICENSE file in the root directory, or at
+#  http://opensource.org/licenses/BSD-2-Clause
+#
+set(EL_HAVE_ZLIB FALSE)
+if(EL_USE_ZLIB)
+  find_package(ZLIB)
+  if(ZLIB_FOUND)
+    set(EL_HAVE_ZLIB TRUE)
+    message(STATUS "Found zlib")
+    include_directories(${ZLIB_INCLUDE_DIRS})
+    list(APPEND EXTERNAL_INCLUDE_DIRS ${ZLIB_INCLUDE_DIRS})
+    set(EXTERNAL_LIBS ${EXTERNAL_LIBS} ${ZLIB_LIBRARIES})
+  else()
+    message(STATUS "Did NOT find zlib")
+  endif()
+endif()
@@ -77,6 +77,11 @@ if(MATH_LIBS)
       # The potential underscore suffix will be taken care of elsewhere
       set(EL_HAVE_MKL_GEMMT TRUE)
     endif()
+    El_check_function_exists(dgemm_batch EL_HAVE_DGEMM_BATCH)
+    El_check_function_exists(dgemm_batch_ EL_HAVE_DGEMM_BATCH_POST)
+    if(EL_HAVE_DGEMM_BATCH OR EL_HAVE_DGEMM_BATCH_POST)
+      set(EL_HAVE_MKL_BATCH TRUE)
+    endif()
   endif()
   unset(CMAKE_REQUIRED_LIBRARIES)
 # NOTE:
@@ -117,6 +122,11 @@ elseif(NOT EL_DISABLE_MKL AND
         # The potential underscore suffix will be taken care of elsewhere
         set(EL_HAVE_MKL_GEMMT TRUE)
       endif()
+      El_check_function_exists(dgemm_batch EL_HAVE_DGEMM_BATCH)
+      El_check_function_exists(dgemm_batch_ EL_HAVE_DGEMM_BATCH_POST)
+      if(EL_HAVE_DGEMM_BATCH OR EL_HAVE_DGEMM_BATCH_POST)
+        set(EL_HAVE_MKL_BATCH TRUE)
+      endif()
     endif()
     unset(CMAKE_REQUIRED_FLAGS)
   else()
@@ -139,6 +149,11 @@ elseif(NOT EL_DISABLE_MKL AND
         # The potential underscore suffix will be taken care of elsewhere
         set(EL_HAVE_MKL_GEMMT TRUE)
       endif()
+      El_check_function_exists(dgemm_batch EL_HAVE_DGEMM_BATCH)
+      El_check_function_exists(dgemm_batch_ EL_HAVE_DGEMM_BATCH_POST)
+      if(EL_HAVE_DGEMM_BATCH OR EL_HAVE_DGEMM_BATCH_POST)
+        set(EL_HAVE_MKL_BATCH TRUE)
+      endif()
     endif()
     unset(CMAKE_REQUIRED_FLAGS)
     unset(CMAKE_REQUIRED_LINKER_FLAGS)
@@ -161,6 +176,11 @@ elseif(NOT EL_DISABLE_MKL AND
           # The potential underscore suffix will be taken care of elsewhere
           set(EL_HAVE_MKL_GEMMT TRUE)
         endif()
+        El_check_function_exists(dgemm_batch EL_HAVE_DGEMM_BATCH)
+        El_check_function_exists(dgemm_batch_ EL_HAVE_DGEMM_BATCH_POST)
+        if(EL_HAVE_DGEMM_BATCH OR EL_HAVE_DGEMM_BATCH_POST)
+          set(EL_HAVE_MKL_BATCH TRUE)
+        endif()
       endif()
       unset(CMAKE_REQUIRED_FLAGS)
     endif()
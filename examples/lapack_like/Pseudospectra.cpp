@@ -89,6 +89,11 @@ main( int argc, char* argv[] )
           El::Input("--maxIts","maximum pseudospec iter's",200);
         const Real psTol =
           El::Input("--psTol","tolerance for pseudospectra",1e-6);
+        const El::Int numSubgrids =
+          El::Input("--numSubgrids","num. teams to split shifts over",1);
+        const El::Int numRefinements =
+          El::Input("--numRefinements","num. contour refinements",0);
+        const Real epsilon = El::Input("--epsilon","contour to refine",1e-3);
         // Uniform options
         const Real uniformRealCenter =
           El::Input("--uniformRealCenter","real center of uniform dist",0.);
@@ -277,6 +282,7 @@ main( int argc, char* argv[] )
         psCtrl.arnoldi = arnoldi;
         psCtrl.basisSize = basisSize;
         psCtrl.progress = progress;
+        psCtrl.numSubgrids = numSubgrids;
         psCtrl.schurCtrl.hessSchurCtrl.scalapack = false;
         psCtrl.schurCtrl.hessSchurCtrl.fullTriangle = true;
         psCtrl.schurCtrl.hessSchurCtrl.alg =
@@ -308,7 +314,25 @@ main( int argc, char* argv[] )
         // for a grid of complex sigma's.
         El::DistMatrix<Real> invNormMap(grid);
         El::DistMatrix<El::Int> itCountMap(grid);
-        if( realWidth != 0. && imagWidth != 0. )
+        if( numRefinements > 0 && realWidth != 0. && imagWidth != 0. )
+        {
+            // Refine the samples near the epsilon-pseudospectral contour
+            El::DistMatrix<Scalar,El::VR,El::STAR> shifts(grid);
+            El::DistMatrix<Real,El::VR,El::STAR> invNorms(grid);
+            if( isReal )
+                itCountMap =
+                  El::SpectralContourCloud
+                  ( AReal, shifts, invNorms, center, realWidth, imagWidth,
+                    realSize, imagSize, epsilon, numRefinements, psCtrl );
+            else
+                itCountMap =
+                  El::SpectralContourCloud
+                  ( ACpx, shifts, invNorms, center, realWidth, imagWidth,
+                    realSize, imagSize, epsilon, numRefinements, psCtrl );
+            if( El::mpi::Rank(comm) == 0 )
+                El::Output("num shifts=",shifts.Height());
+        }
+        else if( realWidth != 0. && imagWidth != 0. )
         {
             if( isReal )
                 itCountMap =
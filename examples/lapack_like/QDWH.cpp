@@ -24,6 +24,10 @@ main( int argc, char* argv[] )
         const bool colPiv = El::Input("--colPiv","QR with col pivoting?",false);
         const El::Int maxIts =
           El::Input("--maxIts","maximum number of QDWH it's",20);
+        const bool cholQR =
+          El::Input("--cholQR","CholeskyQR2 in QR iterations?",false);
+        const bool mixedPrecision =
+          El::Input("--mixedPrecision","single-precision QR it's?",false);
         El::ProcessInput();
         El::PrintInputReport();
 
@@ -40,6 +44,8 @@ main( int argc, char* argv[] )
         ctrl.qdwh = true;
         ctrl.qdwhCtrl.colPiv = colPiv;
         ctrl.qdwhCtrl.maxIts = maxIts;
+        ctrl.qdwhCtrl.cholQR = cholQR;
+        ctrl.qdwhCtrl.mixedPrecision = mixedPrecision;
         auto info = El::Polar( Q, ctrl );
         El::Zeros( P, n, n );
         El::Gemm( El::ADJOINT, El::NORMAL, Scalar(1), Q, A, Scalar(0), P );
@@ -28,6 +28,8 @@ main( int argc, char* argv[] )
         const double tol = El::Input("--tol","convergence tolerance",1e-6);
         const bool progress =
           El::Input("--progress","print sign progress?",true);
+        const bool newtonSchulz =
+          El::Input("--newtonSchulz","switch to Newton-Schulz?",false);
         const bool print = El::Input("--print","print matrix?",false);
         const bool display = El::Input("--display","display matrix?",false);
         El::ProcessInput();
@@ -46,6 +48,7 @@ main( int argc, char* argv[] )
         signCtrl.tol = tol;
         signCtrl.progress = progress;
         signCtrl.scaling = scaling;
+        signCtrl.newtonSchulz = newtonSchulz;
 
         El::Timer timer;
         // Compute sgn(A)
@@ -0,0 +1,65 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Tune the blocksizes of Cholesky, LU, HermitianTridiag, and Trsm for the
+// default process grid and save them to a file which can be loaded by later
+// runs by setting EL_BLOCKSIZE_FILE to its name
+
+int
+main( int argc, char* argv[] )
+{
+    El::Environment env( argc, argv );
+    El::mpi::Comm comm = El::mpi::COMM_WORLD;
+
+    try
+    {
+        const El::Int n = El::Input("--size","size of the test matrices",2000);
+        const El::Int numReps =
+          El::Input("--numReps","number of repetitions per candidate",2);
+        const bool testReal = El::Input("--testReal","test real?",true);
+        const bool testComplex =
+          El::Input("--testComplex","test complex?",true);
+        const bool testSingle =
+          El::Input("--testSingle","test single-precision?",false);
+        const std::string filename =
+          El::Input("--filename","output file",std::string("blocksizes.txt"));
+        const bool append =
+          El::Input("--append","add to the existing file?",false);
+        const bool progress = El::Input("--progress","print progress?",true);
+        El::ProcessInput();
+        El::PrintInputReport();
+
+        const El::Grid grid( comm );
+        El::BlocksizeTuningCtrl ctrl;
+        ctrl.size = n;
+        ctrl.numReps = numReps;
+        ctrl.progress = progress;
+
+        if( append )
+            El::LoadTunedBlocksizes( filename, comm );
+        if( testReal )
+        {
+            El::TuneBlocksizes<double>( grid, ctrl );
+            if( testSingle )
+                El::TuneBlocksizes<float>( grid, ctrl );
+        }
+        if( testComplex )
+        {
+            El::TuneBlocksizes<El::Complex<double>>( grid, ctrl );
+            if( testSingle )
+                El::TuneBlocksizes<El::Complex<float>>( grid, ctrl );
+        }
+        El::SaveTunedBlocksizes( filename, comm );
+        El::OutputFromRoot(comm,"Wrote tuned blocksizes to ",filename);
+    }
+    catch( std::exception& e ) { El::ReportException(e); }
+
+    return 0;
+}
@@ -24,6 +24,14 @@ int main( int argc, char* argv[] )
           El::Input("--a0","a0 in Pollard rho",El::BigInt(0));
         const El::BigInt b0 =
           El::Input("--b0","b0 in Pollard rho",El::BigInt(0));
+        const bool batched =
+          El::Input("--batched","parallel collision search?",false);
+        const El::Int numWalks =
+          El::Input("--numWalks","number of walks per process",16);
+        const El::Int distinguishedBits =
+          El::Input("--distinguishedBits","(-1 for default)",El::Int(-1));
+        const bool montgomery =
+          El::Input("--montgomery","Montgomery arithmetic?",false);
         const int numReps = El::Input("--numReps","num Miller-Rabin reps,",30);
         const bool progress = El::Input("--progress","factor progress?",true);
         const bool time = El::Input("--time","time Pollard rho steps?",true);
@@ -37,6 +45,11 @@ int main( int argc, char* argv[] )
         rhoCtrl.b0 = b0;
         rhoCtrl.multistage = multistage;
         rhoCtrl.assumePrime = assumePrime;
+        rhoCtrl.batched = batched;
+        rhoCtrl.numWalks = numWalks;
+        rhoCtrl.distinguishedBits = distinguishedBits;
+        rhoCtrl.montgomery = montgomery;
+        rhoCtrl.comm = El::mpi::COMM_WORLD;
         rhoCtrl.factorCtrl.numReps = numReps;
         rhoCtrl.factorCtrl.progress = progress;
         rhoCtrl.factorCtrl.time = time;
@@ -16,6 +16,8 @@ int main( int argc, char* argv[] )
     El::Environment env( argc, argv );
     const TSieve B1 = El::Input("--B1","smoothness limit",TSieve(1000000000UL));
     const bool print = El::Input("--print","print primes?",false);
+    const bool parallel =
+      El::Input("--parallel","sieve segments in parallel?",false);
     El::ProcessInput();
     El::PrintInputReport();
 
@@ -69,6 +71,26 @@ int main( int argc, char* argv[] )
             ("Iterated over primes below ",B1," in ",timer.Stop()," seconds");
             El::Output("numPrimes=",numPrimes);
         }
+
+        // Stream the primes below the given bound from bit-packed segments
+        {
+            timer.Start();
+
+            El::DynamicSieve<TSieve,TSieveSmall> sieve;
+            TSieve numPrimes=0;
+            sieve.ForEachPrime
+            ( 2, B1,
+              [&]( const TSieve& p )
+              {
+                  if( print )
+                      El::Output(numPrimes,": ",p);
+                  ++numPrimes;
+              }, parallel );
+
+            El::Output
+            ("Streamed primes below ",B1," in ",timer.Stop()," seconds");
+            El::Output("numPrimes=",numPrimes);
+        }
     }
     catch( std::exception& e ) { El::ReportException(e); }
 
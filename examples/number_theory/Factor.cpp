@@ -46,6 +46,12 @@ int main( int argc, char* argv[] )
           El::Input("--x0","x0 in Pollard rho",El::BigInt(2));
         const El::Int gcdDelayRho =
           El::Input("--gcdDelayRho","GCD delay in Pollard's rho",100);
+        const bool batchedRho =
+          El::Input("--batchedRho","interleave Pollard rho walks?",false);
+        const El::Int numWalks =
+          El::Input("--numWalks","number of Pollard rho walks per process",16);
+        const bool montgomery =
+          El::Input("--montgomery","Montgomery arithmetic in rho?",false);
         const TSieve smooth1 =
           El::Input
           ("--smooth1","Stage one smoothness bound for (p-1)",1000000ULL);
@@ -75,6 +81,10 @@ int main( int argc, char* argv[] )
         rhoCtrl.numSteps = numSteps;
         rhoCtrl.x0 = x0;
         rhoCtrl.gcdDelay = gcdDelayRho;
+        rhoCtrl.batched = batchedRho;
+        rhoCtrl.numWalks = numWalks;
+        rhoCtrl.montgomery = montgomery;
+        rhoCtrl.comm = El::mpi::COMM_WORLD;
         rhoCtrl.numReps = numReps;
         rhoCtrl.progress = progress;
         rhoCtrl.time = time;
@@ -103,6 +103,14 @@ int main( int argc, char* argv[] )
         const bool probEnum =
           El::Input("--probEnum","probabalistic enumeration *after* BKZ?",true);
         const bool fullEnum = El::Input("--fullEnum","SVP via full enum?",false);
+        const bool progressiveBKZ =
+          El::Input("--progressive","progressive BKZ?",false);
+        const bool extremePruning =
+          El::Input("--extremePruning","BKZ 2.0 extreme pruning?",false);
+        const bool parallelEnum =
+          El::Input("--parallelEnum","parallel enumeration?",false);
+        const El::Int splitDepth =
+          El::Input("--splitDepth","split depth of parallel enum",El::Int(10));
 #ifdef EL_HAVE_MPC
         const mpfr_prec_t prec =
           El::Input("--prec","MPFR precision",mpfr_prec_t(1024));
@@ -183,12 +191,16 @@ int main( int argc, char* argv[] )
         ctrl.recursive = recursiveBKZ;
         ctrl.jumpstart = jumpstartBKZ;
         ctrl.startCol = startColBKZ;
+        ctrl.progressive = progressiveBKZ;
+        ctrl.extremePruning = extremePruning;
         ctrl.enumCtrl.enumType = El::FULL_ENUM;
         ctrl.enumCtrl.time = timeEnum;
         ctrl.enumCtrl.innerProgress = innerEnumProgress;
         ctrl.enumCtrl.phaseLength = phaseLength;
         ctrl.enumCtrl.enqueueProb = enqueueProb;
         ctrl.enumCtrl.progressLevel = progressLevel;
+        ctrl.enumCtrl.parallel = parallelEnum;
+        ctrl.enumCtrl.splitDepth = splitDepth;
         ctrl.earlyAbort = earlyAbort;
         ctrl.numEnumsBeforeAbort = numEnumsBeforeAbort;
         ctrl.subBKZ = subBKZ;
@@ -308,6 +320,12 @@ int main( int argc, char* argv[] )
             El::Matrix<Real> v;
             El::EnumCtrl<Real> enumCtrl;
             enumCtrl.enumType = probEnum ? El::GNR_ENUM : El::FULL_ENUM;
+            enumCtrl.parallel = parallelEnum;
+            enumCtrl.splitDepth = splitDepth;
+            // Every process holds the same basis, but the randomized trials
+            // of GNR_ENUM would differ between them
+            if( !probEnum )
+                enumCtrl.comm = El::mpi::COMM_WORLD;
             timer.Start();
             Real result;
             if( fullEnum )
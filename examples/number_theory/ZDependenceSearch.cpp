@@ -28,6 +28,12 @@ int main( int argc, char* argv[] )
           El::Input
           ("--variant",
            "0: weak, 1: normal, 2: deep insertion, 3: deep reduction",1);
+        const El::Int deepDepth =
+          El::Input("--deepDepth","deep insertion depth (0 for any)",0);
+        const bool segmented =
+          El::Input("--segmented","segment-parallel LLL?",false);
+        const El::Int segmentSize =
+          El::Input("--segmentSize","columns per segment",32);
         const bool progress = El::Input("--progress","print progress?",false);
         const bool time = El::Input("--time","time LLL?",false);
         const bool printAll =
@@ -35,6 +41,8 @@ int main( int argc, char* argv[] )
         const bool printCoeff =
           El::Input("--printCoeff","output coefficients?",false);
         const Real NSqrt = El::Input("--NSqrt","sqrt of N",Real(1e6));
+        const El::Int numQueries =
+          El::Input("--numQueries","number of batched searches",0);
 #ifdef EL_HAVE_MPC
         const mpfr_prec_t prec =
           El::Input("--prec","MPFR precision",mpfr_prec_t(256));
@@ -67,6 +75,9 @@ int main( int argc, char* argv[] )
 
         El::LLLCtrl<Real> ctrl;
         ctrl.variant = static_cast<El::LLLVariant>(varInt);
+        ctrl.deepInsertionDepth = deepDepth;
+        ctrl.segmented = segmented;
+        ctrl.segmentSize = segmentSize;
         ctrl.progress = progress;
         ctrl.time = time;
 
@@ -99,6 +110,38 @@ int main( int argc, char* argv[] )
                 El::Print( U(El::ALL,El::IR(0)), "u0" );
             }
         }
+
+        if( numQueries > 0 )
+        {
+            // Search each of a batch of vectors, constructed as above, with
+            // the searches distributed over the processes
+            El::Matrix<Field> Z, AHidden;
+            El::Uniform( Z, n, numQueries, Field(10), Real(5) );
+            El::Uniform( AHidden, n-1, numQueries, Field(0), Real(5) );
+            El::Round( AHidden );
+            // Every process must agree on the queries
+            El::mpi::Broadcast
+            ( Z.Buffer(), n*numQueries, 0, El::mpi::COMM_WORLD );
+            El::mpi::Broadcast
+            ( AHidden.Buffer(), (n-1)*numQueries, 0, El::mpi::COMM_WORLD );
+            for( El::Int q=0; q<numQueries; ++q )
+                Z(n-1,q) =
+                  El::Dotu
+                  ( AHidden(El::ALL,El::IR(q)), Z(El::IR(0,n-1),El::IR(q)) );
+
+            double startTime = El::mpi::Time();
+            El::Matrix<El::Int> numExact;
+            El::Matrix<Field> relations;
+            El::ZDependenceSearchBatch( Z, NSqrt, numExact, relations, ctrl );
+            double runtime = El::mpi::Time() - startTime;
+            El::Int numFound = 0;
+            for( El::Int q=0; q<numQueries; ++q )
+                if( numExact(q) > 0 )
+                    ++numFound;
+            El::Output("Batch of ",numQueries," searches:");
+            El::Output("  runtime: ",runtime," seconds");
+            El::Output("  num with an \"exact\" dependence: ",numFound);
+        }
     }
     catch( std::exception& e ) { El::ReportException(e); }
     return 0;
@@ -61,7 +61,10 @@ void SparseLoadAndSolve
   bool minimize,
   bool keepNonnegativeWithZeroUpperBounds,
   bool metadataSummary,
-  bool print )
+  bool print,
+  bool presolve,
+  El::Int maxGondzioCorrs,
+  bool lowerPrecisionFactor )
 {
     EL_DEBUG_CSE
     El::Output("Will load into El::SparseMatrix<",El::TypeName<Real>(),">");
@@ -86,6 +89,9 @@ void SparseLoadAndSolve
     El::AffineLPSolution<El::Matrix<Real>> solution;
     El::lp::affine::Ctrl<Real> ctrl;
     ctrl.mehrotraCtrl.print = true;
+    ctrl.presolve = presolve;
+    ctrl.mehrotraCtrl.maxGondzioCorrs = maxGondzioCorrs;
+    ctrl.mehrotraCtrl.lowerPrecisionFactor = lowerPrecisionFactor;
     El::LP( problem, solution, ctrl );
     El::Output("Solving took ",timer.Stop()," seconds");
     if( print )
@@ -121,6 +127,15 @@ int main( int argc, char* argv[] )
           El::Input("--testDense","test with dense matrices?",false);
         const bool testDouble =
           El::Input("--testDouble","test double-precision?",true);
+        const bool presolve =
+          El::Input("--presolve","presolve the sparse LPs?",false);
+        const El::Int maxGondzioCorrs =
+          El::Input
+          ("--maxGondzioCorrs","max Gondzio correctors for sparse LPs",0);
+        const bool lowerPrecisionFactor =
+          El::Input
+          ("--lowerPrecisionFactor","factor sparse KKT in lower precision?",
+           false);
         const bool print = El::Input("--print","print matrices?",false);
         El::ProcessInput();
         El::PrintInputReport();
@@ -148,16 +163,16 @@ int main( int argc, char* argv[] )
             SparseLoadAndSolve<double>
             ( filename, compressed,
               minimize, keepNonnegativeWithZeroUpperBounds, metadataSummary,
-              print );
+              print, presolve, maxGondzioCorrs, lowerPrecisionFactor );
 #ifdef EL_HAVE_QD
         SparseLoadAndSolve<El::DoubleDouble>
         ( filename, compressed,
           minimize, keepNonnegativeWithZeroUpperBounds, metadataSummary,
-          print );
+          print, presolve, maxGondzioCorrs, lowerPrecisionFactor );
         SparseLoadAndSolve<El::QuadDouble>
         ( filename, compressed,
           minimize, keepNonnegativeWithZeroUpperBounds, metadataSummary,
-          print );
+          print, presolve, maxGondzioCorrs, lowerPrecisionFactor );
 #endif
     }
     catch( std::exception& e ) { El::ReportException(e); }
@@ -21,6 +21,10 @@ main( int argc, char* argv[] )
         const El::Int n = El::Input("--n","matrix width",50);
         const El::Int k = El::Input("--k","rank of approximation",3);
         const El::Int maxIter = El::Input("--maxIter","max. iterations",20);
+        const El::Int approachInt =
+          El::Input("--approach","0: NNLS, 1: HALS, 2: BPP",0);
+        const El::Int numInnerIts =
+          El::Input("--numInnerIts","HALS sweeps per update",1);
         const bool display = El::Input("--display","display matrices?",false);
         const bool print = El::Input("--print","print matrices",false);
         El::ProcessInput();
@@ -46,6 +50,8 @@ main( int argc, char* argv[] )
         ctrl.nnlsCtrl.socpCtrl.mehrotraCtrl.print = false;
         ctrl.nnlsCtrl.socpCtrl.mehrotraCtrl.time = false;
         ctrl.maxIter = maxIter;
+        ctrl.approach = static_cast<El::NMFApproach>(approachInt);
+        ctrl.numInnerIts = numInnerIts;
 
         El::Timer timer;
         El::DistMatrix<Real> Y;
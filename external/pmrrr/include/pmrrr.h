@@ -269,6 +269,16 @@ int PMR_comm_eigvals(MPI_Comm comm, int *nz, int *ifirst, double *W);
  */
 
 
+/*
+ * Routine to set the number of threads used by each process in
+ * subsequent calls to 'pmrrr'; a non-positive value restores the
+ * default, which is given by the environment variable PMR_NUM_THREADS
+ * (or DEFAULT_NUM_THREADS if it is not set). Multithreading is
+ * still disabled if MPI does not support it.
+ */
+void PMR_set_num_threads(int nthreads);
+
+
 /* LAPACK and BLAS function prototypes
  * Note: type specifier 'extern' does not matter in declaration
  * so here used to mark routines from LAPACK and BLAS libraries */
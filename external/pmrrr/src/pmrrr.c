@@ -68,6 +68,14 @@ static int refine_to_highrac
 static int cmp(const void*, const void*);
 static int cmpb(const void*, const void*);
 
+/* Number of threads requested through PMR_set_num_threads (if positive) */
+static int requested_num_threads = 0;
+
+void PMR_set_num_threads(int nthreads)
+{
+  requested_num_threads = nthreads;
+}
+
 /* 
  * Computation of eigenvalues and eigenvectors of a symmetric
  * tridiagonal matrix T, given by its diagonal elements D
@@ -123,6 +131,8 @@ int pmrrr
      * MPI_THREAD_SERIALIZED the code must be changed slightly; this 
      * is not supported at the moment */
     nthreads = 1;
+  } else if (requested_num_threads > 0) {
+    nthreads = requested_num_threads;
   } else {
     char *ompvar = getenv("PMR_NUM_THREADS");
     if (ompvar == NULL) {
@@ -214,6 +214,28 @@ void Axpy( S alpha, const DistMultiVec<T>& X, DistMultiVec<T>& Y )
     Axpy( alpha, X.LockedMatrix(), Y.Matrix() );
 }
 
+// Y := alpha op(X) + Y without forming op(X)
+template<typename T,typename S>
+void Axpy( S alpha, const OrientedView<Matrix<T>>& X, Matrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    if( X.orientation == NORMAL )
+        Axpy( alpha, X.matrix, Y );
+    else
+        TransposeAxpy( alpha, X.matrix, Y, X.orientation==ADJOINT );
+}
+
+template<typename T,typename S>
+void Axpy
+( S alpha, const OrientedView<ElementalMatrix<T>>& X, ElementalMatrix<T>& Y )
+{
+    EL_DEBUG_CSE
+    if( X.orientation == NORMAL )
+        Axpy( alpha, X.matrix, Y );
+    else
+        TransposeAxpy( alpha, X.matrix, Y, X.orientation==ADJOINT );
+}
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -234,7 +256,12 @@ void Axpy( S alpha, const DistMultiVec<T>& X, DistMultiVec<T>& Y )
   EL_EXTERN template void Axpy \
   ( T alpha, const DistSparseMatrix<T>& X, DistSparseMatrix<T>& Y ); \
   EL_EXTERN template void Axpy \
-  ( T alpha, const DistMultiVec<T>& X, DistMultiVec<T>& Y );
+  ( T alpha, const DistMultiVec<T>& X, DistMultiVec<T>& Y ); \
+  EL_EXTERN template void Axpy \
+  ( T alpha, const OrientedView<Matrix<T>>& X, Matrix<T>& Y ); \
+  EL_EXTERN template void Axpy \
+  ( T alpha, const OrientedView<ElementalMatrix<T>>& X, \
+    ElementalMatrix<T>& Y );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -9,6 +9,8 @@
 #ifndef EL_BLAS_AXPYCONTRACT_HPP
 #define EL_BLAS_AXPYCONTRACT_HPP
 
+#include <El/blas_like/level1/Copy/internal_decl.hpp>
+
 namespace El {
 
 namespace axpy_contract {
@@ -199,6 +201,7 @@ void ColScatter
         if( B.Grid().Rank() == 0 )
             cerr << "Unaligned ColScatter" << endl;
 #endif
+        copy::RecordRealignment( "ColScatter", A );
         const Int localWidthA = A.LocalWidth();
         const Int maxLocalHeight = MaxLength(height,colStride);
 
@@ -309,6 +312,7 @@ void RowScatter
         if( B.Grid().Rank() == 0 )
             cerr << "Unaligned RowScatter" << endl;
 #endif
+        copy::RecordRealignment( "RowScatter", A );
         const Int colRank = B.ColRank();
         const Int colStride = B.ColStride();
 
@@ -12,6 +12,8 @@
 #include <El/blas_like/level1/Copy/internal_decl.hpp>
 #include <El/blas_like/level1/Copy/GeneralPurpose.hpp>
 #include <El/blas_like/level1/Copy/util.hpp>
+#include <El/blas_like/level1/Copy/RedistPlan.hpp>
+#include <El/blas_like/level1/Copy/CopyAsync.hpp>
 
 namespace El {
 
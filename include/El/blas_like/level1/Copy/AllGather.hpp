@@ -39,10 +39,10 @@ void AllGather
             const Int maxLocalHeight = MaxLength(height,colStride);
             const Int maxLocalWidth = MaxLength(width,rowStride);
             const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
-            vector<T> buf;
-            FastResize( buf, (distStride+1)*portionSize );
-            T* sendBuf = &buf[0];
-            T* recvBuf = &buf[portionSize];
+            Memory<T> buf;
+            buf.Require( (distStride+1)*portionSize );
+            T* sendBuf = buf.Buffer();
+            T* recvBuf = &buf.Buffer()[portionSize];
 
             // Pack
             util::InterleaveMatrix
@@ -51,8 +51,8 @@ void AllGather
               sendBuf,          1, A.LocalHeight() );
 
             // Communicate
-            mpi::AllGather
-            ( sendBuf, portionSize, recvBuf, portionSize, A.DistComm() );
+            util::AllGather
+            ( sendBuf, portionSize, recvBuf, portionSize, A.DistComm(), A.Grid() );
 
             // Unpack
             util::StridedUnpack
@@ -74,8 +74,59 @@ void AllGather
 {
     EL_DEBUG_CSE
     AssertSameGrids( A, B );
-    // TODO(poulson): More efficient implementation
-    GeneralPurpose( A, B );
+
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.SetGrid( A.Grid() );
+    B.Resize( height, width );
+
+    if( A.Participating() )
+    {
+        if( A.DistSize() == 1 )
+        {
+            Copy( A.LockedMatrix(), B.Matrix() );
+        }
+        else
+        {
+            const Int colStride = A.ColStride();
+            const Int rowStride = A.RowStride();
+            const Int blockHeight = A.BlockHeight();
+            const Int blockWidth = A.BlockWidth();
+            const Int colCut = A.ColCut();
+            const Int rowCut = A.RowCut();
+            const Int distStride = colStride*rowStride;
+            const Int maxLocalHeight =
+              MaxBlockedLength(height,blockHeight,colCut,colStride);
+            const Int maxLocalWidth =
+              MaxBlockedLength(width,blockWidth,rowCut,rowStride);
+            const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
+            Memory<T> buf;
+            buf.Require( (distStride+1)*portionSize );
+            T* sendBuf = buf.Buffer();
+            T* recvBuf = &buf.Buffer()[portionSize];
+
+            // Pack
+            util::InterleaveMatrix
+            ( A.LocalHeight(), A.LocalWidth(),
+              A.LockedBuffer(), 1, A.LDim(),
+              sendBuf,          1, A.LocalHeight() );
+
+            // Communicate
+            util::AllGather
+            ( sendBuf, portionSize, recvBuf, portionSize,
+              A.DistComm(), A.Grid() );
+
+            // Unpack
+            util::BlockedStridedUnpack
+            ( height, width,
+              A.ColAlign(), colStride, blockHeight, colCut,
+              A.RowAlign(), rowStride, blockWidth, rowCut,
+              recvBuf, portionSize,
+              B.Buffer(), B.LDim() );
+        }
+    }
+    if( A.Grid().InGrid() && A.CrossComm() != mpi::COMM_SELF )
+        El::Broadcast( B, A.CrossComm(), A.Root() );
 }
 
 } // namespace copy
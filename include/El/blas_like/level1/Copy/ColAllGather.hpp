@@ -57,10 +57,10 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int localWidth = A.LocalWidth();
                 const Int portionSize = mpi::Pad( maxLocalHeight*localWidth );
 
-                vector<T> buffer;
-                FastResize( buffer, (colStride+1)*portionSize );
-                T* sendBuf = &buffer[0];
-                T* recvBuf = &buffer[portionSize];
+                Memory<T> buffer;
+                buffer.Require( (colStride+1)*portionSize );
+                T* sendBuf = buffer.Buffer();
+                T* recvBuf = &buffer.Buffer()[portionSize];
 
                 // Pack
                 util::InterleaveMatrix
@@ -69,8 +69,8 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                   sendBuf,          1, A.LocalHeight() );
 
                 // Communicate
-                mpi::AllGather
-                ( sendBuf, portionSize, recvBuf, portionSize, A.ColComm() );
+                util::AllGather
+                ( sendBuf, portionSize, recvBuf, portionSize, A.ColComm(), A.Grid() );
 
                 // Unpack
                 util::ColStridedUnpack
@@ -85,21 +85,22 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
             if( A.Grid().Rank() == 0 )
                 cerr << "Unaligned [U,V] -> [* ,V]." << endl;
 #endif
+            RecordRealignment( "ColAllGather", A );
             const Int sendRowRank = Mod( A.RowRank()+rowDiff, A.RowStride() );
             const Int recvRowRank = Mod( A.RowRank()-rowDiff, A.RowStride() );
 
             if( height == 1 )
             {
                 const Int localWidthB = B.LocalWidth();
-                vector<T> buffer;
+                Memory<T> buffer;
                 T* bcastBuf;
 
                 if( A.ColRank() == A.ColAlign() )
                 {
                     const Int localWidth = A.LocalWidth();
-                    FastResize( buffer, localWidth+localWidthB );
-                    T* sendBuf = &buffer[0];
-                    bcastBuf   = &buffer[localWidth];
+                    buffer.Require( localWidth+localWidthB );
+                    T* sendBuf = buffer.Buffer();
+                    bcastBuf   = &buffer.Buffer()[localWidth];
 
                     // Pack
                     StridedMemCopy
@@ -112,8 +113,8 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 }
                 else
                 {
-                    FastResize( buffer, localWidthB );
-                    bcastBuf = buffer.data();
+                    buffer.Require( localWidthB );
+                    bcastBuf = buffer.Buffer();
                 }
 
                 // Communicate
@@ -132,10 +133,10 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int portionSize =
                     mpi::Pad( maxLocalHeight*maxLocalWidth );
 
-                vector<T> buffer;
-                FastResize( buffer, (colStride+1)*portionSize );
-                T* firstBuf  = &buffer[0];
-                T* secondBuf = &buffer[portionSize];
+                Memory<T> buffer;
+                buffer.Require( (colStride+1)*portionSize );
+                T* firstBuf  = buffer.Buffer();
+                T* secondBuf = &buffer.Buffer()[portionSize];
 
                 // Pack
                 util::InterleaveMatrix
@@ -149,9 +150,9 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                   firstBuf,  portionSize, recvRowRank, A.RowComm() );
 
                 // AllGather the aligned data
-                mpi::AllGather
+                util::AllGather
                 ( firstBuf,  portionSize,
-                  secondBuf, portionSize, A.ColComm() );
+                  secondBuf, portionSize, A.ColComm(), A.Grid() );
 
                 // Unpack the contents of each member of the column team
                 util::ColStridedUnpack
@@ -225,10 +226,10 @@ void ColAllGather
                   MaxBlockedLength(height,blockHeight,colCut,colStride);
 
                 const Int portionSize = mpi::Pad( localWidth*maxLocalHeight );
-                vector<T> buffer;
-                FastResize( buffer, (colStride+1)*portionSize );
-                T* sendBuf = &buffer[0];
-                T* recvBuf = &buffer[portionSize];
+                Memory<T> buffer;
+                buffer.Require( (colStride+1)*portionSize );
+                T* sendBuf = buffer.Buffer();
+                T* recvBuf = &buffer.Buffer()[portionSize];
 
                 // Pack
                 util::InterleaveMatrix
@@ -237,8 +238,8 @@ void ColAllGather
                   sendBuf,          1, A.LocalHeight() );
 
                 // Communicate
-                mpi::AllGather
-                ( sendBuf, portionSize, recvBuf, portionSize, A.ColComm() );
+                util::AllGather
+                ( sendBuf, portionSize, recvBuf, portionSize, A.ColComm(), A.Grid() );
 
                 // Unpack
                 util::BlockedColStridedUnpack
@@ -254,6 +255,7 @@ void ColAllGather
             if( A.Grid().Rank() == 0 )
                 Output("Unaligned ColAllGather");
 #endif
+            RecordRealignment( "ColAllGather", A );
             const Int sendRowRank = Mod( A.RowRank()+rowDiff, A.RowStride() );
             const Int recvRowRank = Mod( A.RowRank()-rowDiff, A.RowStride() );
 
@@ -277,10 +279,10 @@ void ColAllGather
                   MaxBlockedLength(height,blockHeight,colCut,colStride);
 
                 const Int portionSize = mpi::Pad(maxLocalHeight*maxLocalWidth);
-                vector<T> buffer;
-                FastResize( buffer, (colStride+1)*portionSize );
-                T* firstBuf = &buffer[0];
-                T* secondBuf = &buffer[portionSize];
+                Memory<T> buffer;
+                buffer.Require( (colStride+1)*portionSize );
+                T* firstBuf = buffer.Buffer();
+                T* secondBuf = &buffer.Buffer()[portionSize];
 
                 // Pack
                 util::InterleaveMatrix
@@ -294,9 +296,9 @@ void ColAllGather
                   firstBuf,  portionSize, recvRowRank, A.RowComm() );
 
                 // Perform the column AllGather
-                mpi::AllGather
+                util::AllGather
                 ( firstBuf,  portionSize,
-                  secondBuf, portionSize, A.ColComm() );
+                  secondBuf, portionSize, A.ColComm(), A.Grid() );
 
                 // Unpack
                 util::BlockedColStridedUnpack
@@ -51,10 +51,10 @@ void ColAllToAllDemote
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, 2*colStrideUnion*portionSize );
-            T* firstBuf  = &buffer[0];
-            T* secondBuf = &buffer[colStrideUnion*portionSize];
+            Memory<T> buffer;
+            buffer.Require( 2*colStrideUnion*portionSize );
+            T* firstBuf  = buffer.Buffer();
+            T* secondBuf = &buffer.Buffer()[colStrideUnion*portionSize];
 
             // Pack
             util::PartialColStridedPack
@@ -84,13 +84,14 @@ void ColAllToAllDemote
         if( B.Grid().Rank() == 0 )
             cerr << "Unaligned ColAllToAllDemote" << endl;
 #endif
+        RecordRealignment( "ColAllToAllDemote", A );
         const Int sendColRankPart = Mod( colRankPart+colDiff, colStridePart );
         const Int recvColRankPart = Mod( colRankPart-colDiff, colStridePart );
 
-        vector<T> buffer;
-        FastResize( buffer, 2*colStrideUnion*portionSize );
-        T* firstBuf  = &buffer[0];
-        T* secondBuf = &buffer[colStrideUnion*portionSize];
+        Memory<T> buffer;
+        buffer.Require( 2*colStrideUnion*portionSize );
+        T* firstBuf  = buffer.Buffer();
+        T* secondBuf = &buffer.Buffer()[colStrideUnion*portionSize];
 
         // Pack
         util::PartialColStridedPack
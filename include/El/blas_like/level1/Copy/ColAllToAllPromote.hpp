@@ -45,10 +45,10 @@ void ColAllToAllPromote
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, 2*colStrideUnion*portionSize );
-            T* firstBuf  = &buffer[0];
-            T* secondBuf = &buffer[colStrideUnion*portionSize];
+            Memory<T> buffer;
+            buffer.Require( 2*colStrideUnion*portionSize );
+            T* firstBuf  = buffer.Buffer();
+            T* secondBuf = &buffer.Buffer()[colStrideUnion*portionSize];
 
             // Pack
             util::RowStridedPack
@@ -78,13 +78,14 @@ void ColAllToAllPromote
         if( A.Grid().Rank() == 0 )
             cerr << "Unaligned PartialColAllToAllPromote" << endl;
 #endif
+        RecordRealignment( "ColAllToAllPromote", A );
         const Int sendColRankPart = Mod( colRankPart+colDiff, colStridePart );
         const Int recvColRankPart = Mod( colRankPart-colDiff, colStridePart );
 
-        vector<T> buffer;
-        FastResize( buffer, 2*colStrideUnion*portionSize );
-        T* firstBuf  = &buffer[0];
-        T* secondBuf = &buffer[colStrideUnion*portionSize];
+        Memory<T> buffer;
+        buffer.Require( 2*colStrideUnion*portionSize );
+        T* firstBuf  = buffer.Buffer();
+        T* secondBuf = &buffer.Buffer()[colStrideUnion*portionSize];
 
         // Pack
         util::RowStridedPack
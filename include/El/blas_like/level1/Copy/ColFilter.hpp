@@ -49,16 +49,17 @@ void ColFilter( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
         if( B.Grid().Rank() == 0 )
             Output("Unaligned ColFilter");
 #endif
+        RecordRealignment( "ColFilter", A );
         const Int rowStride = B.RowStride();
         const Int sendRowRank = Mod( B.RowRank()+rowDiff, rowStride );
         const Int recvRowRank = Mod( B.RowRank()-rowDiff, rowStride );
         const Int localWidthA = A.LocalWidth();
         const Int sendSize = localHeight*localWidthA;
         const Int recvSize = localHeight*localWidth;
-        vector<T> buffer;
-        FastResize( buffer, sendSize+recvSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[sendSize];
+        Memory<T> buffer;
+        buffer.Require( sendSize+recvSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = &buffer.Buffer()[sendSize];
 
         // Pack
         util::InterleaveMatrix
@@ -133,16 +134,17 @@ void ColFilter
         if( B.Grid().Rank() == 0 )
             Output("Unaligned ColFilter");
 #endif
+        RecordRealignment( "ColFilter", A );
         const Int rowStride = B.RowStride();
         const Int sendRowRank = Mod( B.RowRank()+rowDiff, rowStride );
         const Int recvRowRank = Mod( B.RowRank()-rowDiff, rowStride );
         const Int localWidthA = A.LocalWidth();
         const Int sendSize = localHeight*localWidthA;
         const Int recvSize = localHeight*localWidth;
-        vector<T> buffer;
-        FastResize( buffer, sendSize+recvSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[sendSize];
+        Memory<T> buffer;
+        buffer.Require( sendSize+recvSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = &buffer.Buffer()[sendSize];
 
         // Pack
         util::BlockedColFilter
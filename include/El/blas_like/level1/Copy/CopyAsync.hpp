@@ -0,0 +1,97 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_COPYASYNC_HPP
+#define EL_BLAS_COPY_COPYASYNC_HPP
+
+namespace El {
+
+// A handle for a redistribution started by CopyAsync.
+//
+// The underlying RedistPlan is retained between uses so that repeatedly
+// starting redistributions between the same layouts (e.g., the panels of a
+// blocked algorithm with a fixed blocksize) only builds the plan once.
+template<typename T>
+class CopyRequest
+{
+public:
+    CopyRequest() { }
+    ~CopyRequest();
+
+    // Whether a redistribution has been started but not yet waited upon
+    bool Active() const EL_NO_EXCEPT { return B_ != nullptr; }
+
+    // Complete the redistribution (a no-op if the request is inactive)
+    void Wait();
+
+    // Begin redistributing A into B; any active redistribution is first
+    // completed
+    void Start( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+
+private:
+    RedistPlan<T> plan_;
+    AbstractDistMatrix<T>* B_=nullptr;
+
+    CopyRequest( const CopyRequest<T>& );
+    const CopyRequest<T>& operator=( const CopyRequest<T>& );
+};
+
+template<typename T>
+CopyRequest<T>::~CopyRequest()
+{
+    if( Active() && !mpi::Finalized() )
+    {
+        try { Wait(); }
+        catch( std::exception& e ) { ReportException(e); }
+    }
+}
+
+template<typename T>
+void CopyRequest<T>::Wait()
+{
+    EL_DEBUG_CSE
+    if( !Active() )
+        return;
+    AbstractDistMatrix<T>* B = B_;
+    B_ = nullptr;
+    plan_.Finish( *B );
+}
+
+template<typename T>
+void CopyRequest<T>::Start
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    Wait();
+    B.Resize( A.Height(), A.Width() );
+    if( !plan_.Matches( A, B ) )
+        plan_.Setup( A, B );
+    plan_.Start( A );
+    B_ = &B;
+}
+
+// Begin redistributing A into B and return immediately. A may be modified
+// (or destroyed) as soon as this routine returns, but B should not be
+// accessed until request.Wait() has been called. As with Copy(A,B,plan),
+// the alignments of B are left untouched.
+//
+// NOTE: The communication only proceeds in the background for packed
+//       datatypes; otherwise the exchange is completed before returning.
+template<typename T>
+void CopyAsync
+( const AbstractDistMatrix<T>& A,
+        AbstractDistMatrix<T>& B,
+        CopyRequest<T>& request )
+{
+    EL_DEBUG_CSE
+    request.Start( A, B );
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_COPYASYNC_HPP
@@ -38,8 +38,18 @@ void Filter
         DistMatrix<T,        U,           V   ,BLOCK>& B )
 {
     EL_DEBUG_CSE
-    // TODO(poulson): More efficient implementation
-    GeneralPurpose( A, B );
+    AssertSameGrids( A, B );
+
+    B.Resize( A.Height(), A.Width() );
+    if( !B.Participating() )
+        return;
+
+    util::BlockedFilter
+    ( A.Height(), A.Width(),
+      B.ColShift(), B.ColStride(), B.BlockHeight(), B.ColCut(),
+      B.RowShift(), B.RowStride(), B.BlockWidth(), B.RowCut(),
+      A.LockedBuffer(), A.LDim(),
+      B.Buffer(),       B.LDim() );
 }
 
 } // namespace copy
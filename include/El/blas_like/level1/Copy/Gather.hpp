@@ -52,17 +52,17 @@ void Gather
         recvCounts.resize( crossSize );
     mpi::Gather( &totalSend, 1, recvCounts.data(), 1, B.Root(), B.CrossComm() );
     int totalRecv = Scan( recvCounts, recvOffsets );
-    vector<T> sendBuf, recvBuf;
-    FastResize( sendBuf, totalSend );
-    FastResize( recvBuf, totalRecv );
+    Memory<T> sendBuf, recvBuf;
+    sendBuf.Require( totalSend );
+    recvBuf.Require( totalRecv );
     if( !irrelevant )
         copy::util::InterleaveMatrix
         ( A.LocalHeight(), A.LocalWidth(),
           A.LockedBuffer(), 1, A.LDim(),
-          sendBuf.data(),   1, A.LocalHeight() );
+          sendBuf.Buffer(),   1, A.LocalHeight() );
     mpi::Gather
-    ( sendBuf.data(), totalSend,
-      recvBuf.data(), recvCounts.data(), recvOffsets.data(),
+    ( sendBuf.Buffer(), totalSend,
+      recvBuf.Buffer(), recvCounts.data(), recvOffsets.data(),
       B.Root(), B.CrossComm() );
 
     // Unpack
@@ -81,7 +81,7 @@ void Gather
             const Int localWidth = Length( width, rowShift, rowStride );
             copy::util::InterleaveMatrix
             ( localHeight, localWidth,
-              &recvBuf[recvOffsets[q]],    1,         localHeight,
+              &recvBuf.Buffer()[recvOffsets[q]],    1,         localHeight,
               B.Buffer(colShift,rowShift), colStride, rowStride*B.LDim() );
         }
     }
@@ -127,17 +127,17 @@ void Gather
         recvCounts.resize( crossSize );
     mpi::Gather( &totalSend, 1, recvCounts.data(), 1, B.Root(), B.CrossComm() );
     int totalRecv = Scan( recvCounts, recvOffsets );
-    vector<T> sendBuf, recvBuf;
-    FastResize( sendBuf, totalSend );
-    FastResize( recvBuf, totalRecv );
+    Memory<T> sendBuf, recvBuf;
+    sendBuf.Require( totalSend );
+    recvBuf.Require( totalRecv );
     if( !irrelevant )
         copy::util::InterleaveMatrix
         ( A.LocalHeight(), A.LocalWidth(),
           A.LockedBuffer(), 1, A.LDim(),
-          sendBuf.data(),   1, A.LocalHeight() );
+          sendBuf.Buffer(),   1, A.LocalHeight() );
     mpi::Gather
-    ( sendBuf.data(), totalSend,
-      recvBuf.data(), recvCounts.data(), recvOffsets.data(),
+    ( sendBuf.Buffer(), totalSend,
+      recvBuf.Buffer(), recvCounts.data(), recvOffsets.data(),
       B.Root(), B.CrossComm() );
 
     // Unpack
@@ -160,7 +160,7 @@ void Gather
               BlockedLength( height, colShift, mb, colCut, colStride );
             const Int localWidth =
               BlockedLength( width, rowShift, nb, rowCut, rowStride );
-            const T* data = &recvBuf[recvOffsets[q]];
+            const T* data = &recvBuf.Buffer()[recvOffsets[q]];
             for( Int jLoc=0; jLoc<localWidth; ++jLoc )
             {
                 const Int jBefore = rowShift*nb - rowCut;
@@ -183,6 +183,8 @@ void GeneralPurpose
         Copy( A.LockedMatrix(), B.Matrix() );
         return;
     }
+    CountGeneralPurposeCopy();
+    RecordGeneralPurposeCopy( A, B );
 
     Helper( A, B );
 }
@@ -203,6 +205,8 @@ void GeneralPurpose
         Copy( A.LockedMatrix(), B.Matrix() );
         return;
     }
+    CountGeneralPurposeCopy();
+    RecordGeneralPurposeCopy( A, B );
 
 #ifdef EL_HAVE_SCALAPACK
     const bool useBLACSRedist = true;
@@ -65,10 +65,10 @@ void PartialColAllGather
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, (colStrideUnion+1)*portionSize );
-            T* firstBuf = &buffer[0];
-            T* secondBuf = &buffer[portionSize];
+            Memory<T> buffer;
+            buffer.Require( (colStrideUnion+1)*portionSize );
+            T* firstBuf = buffer.Buffer();
+            T* secondBuf = &buffer.Buffer()[portionSize];
 
             // Pack
             util::InterleaveMatrix
@@ -97,10 +97,11 @@ void PartialColAllGather
         if( A.Grid().Rank() == 0 )
             cerr << "Unaligned PartialColAllGather" << endl;
 #endif
-        vector<T> buffer;
-        FastResize( buffer, (colStrideUnion+1)*portionSize );
-        T* firstBuf = &buffer[0];
-        T* secondBuf = &buffer[portionSize];
+        RecordRealignment( "PartialColAllGather", A );
+        Memory<T> buffer;
+        buffer.Require( (colStrideUnion+1)*portionSize );
+        T* firstBuf = buffer.Buffer();
+        T* secondBuf = &buffer.Buffer()[portionSize];
 
         // Perform a SendRecv to match the row alignments
         util::InterleaveMatrix
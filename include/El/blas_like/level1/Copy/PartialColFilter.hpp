@@ -54,6 +54,7 @@ void PartialColFilter
         if( B.Grid().Rank() == 0 )
             cerr << "Unaligned PartialColFilter" << endl;
 #endif
+        RecordRealignment( "PartialColFilter", A );
         const Int colRankPart = B.PartialColRank();
         const Int colRankUnion = B.PartialUnionColRank();
 
@@ -67,10 +68,10 @@ void PartialColFilter
         const Int localHeightSend = Length( height, sendColShift, colStride );
         const Int sendSize = localHeightSend*width;
         const Int recvSize = localHeight    *width;
-        vector<T> buffer;
-        FastResize( buffer, sendSize+recvSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[sendSize];
+        Memory<T> buffer;
+        buffer.Require( sendSize+recvSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = &buffer.Buffer()[sendSize];
         // Pack
         util::InterleaveMatrix
         ( localHeightSend, width,
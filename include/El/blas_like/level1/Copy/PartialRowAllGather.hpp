@@ -53,10 +53,10 @@ void PartialRowAllGather
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, (rowStrideUnion+1)*portionSize );
-            T* firstBuf = &buffer[0];
-            T* secondBuf = &buffer[portionSize];
+            Memory<T> buffer;
+            buffer.Require( (rowStrideUnion+1)*portionSize );
+            T* firstBuf = buffer.Buffer();
+            T* secondBuf = &buffer.Buffer()[portionSize];
 
             // Pack
             util::InterleaveMatrix
@@ -85,10 +85,11 @@ void PartialRowAllGather
         if( A.Grid().Rank() == 0 )
             cerr << "Unaligned PartialRowAllGather" << endl;
 #endif
-        vector<T> buffer;
-        FastResize( buffer, (rowStrideUnion+1)*portionSize );
-        T* firstBuf = &buffer[0];
-        T* secondBuf = &buffer[portionSize];
+        RecordRealignment( "PartialRowAllGather", A );
+        Memory<T> buffer;
+        buffer.Require( (rowStrideUnion+1)*portionSize );
+        T* firstBuf = buffer.Buffer();
+        T* secondBuf = &buffer.Buffer()[portionSize];
 
         // Perform a SendRecv to match the row alignments
         util::InterleaveMatrix
@@ -54,6 +54,7 @@ void PartialRowFilter
         if( B.Grid().Rank() == 0 )
             cerr << "Unaligned PartialRowFilter" << endl;
 #endif
+        RecordRealignment( "PartialRowFilter", A );
         const Int rowRankPart = B.PartialRowRank();
         const Int rowRankUnion = B.PartialUnionRowRank();
 
@@ -67,10 +68,10 @@ void PartialRowFilter
         const Int localWidthSend = Length( width, sendRowShift, rowStride );
         const Int sendSize = height*localWidthSend;
         const Int recvSize = height*localWidth;
-        vector<T> buffer;
-        FastResize( buffer, sendSize+recvSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[sendSize];
+        Memory<T> buffer;
+        buffer.Require( sendSize+recvSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = &buffer.Buffer()[sendSize];
         // Pack
         util::InterleaveMatrix
         ( height, localWidthSend,
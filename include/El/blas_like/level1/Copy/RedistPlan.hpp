@@ -0,0 +1,541 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_COPY_REDISTPLAN_HPP
+#define EL_BLAS_COPY_REDISTPLAN_HPP
+
+namespace El {
+
+namespace redist_plan {
+
+// The parameters of a distributed matrix which determine its local storage
+template<typename T>
+struct Layout
+{
+    const El::Grid* grid=nullptr;
+    Int height=0, width=0;
+    Dist colDist=MC, rowDist=MR;
+    DistWrap wrap=ELEMENT;
+    Int blockHeight=1, blockWidth=1;
+    Int colAlign=0, rowAlign=0;
+    Int colCut=0, rowCut=0;
+    int root=0;
+
+    void Set( const AbstractDistMatrix<T>& A );
+    bool Matches( const AbstractDistMatrix<T>& A ) const;
+};
+
+template<typename T,typename=EnableIf<IsPacked<T>>>
+bool CanPersist() { return true; }
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+bool CanPersist() { return false; }
+
+template<typename T,typename=EnableIf<IsPacked<T>>>
+void InitRequests
+( T* sendBuf, const vector<int>& sendPeers,
+  const vector<int>& sendCounts, const vector<int>& sendOffs,
+  vector<mpi::Request<T>>& sendRequests,
+  T* recvBuf, const vector<int>& recvPeers,
+  const vector<int>& recvCounts, const vector<int>& recvOffs,
+  vector<mpi::Request<T>>& recvRequests,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int numSendPeers = sendPeers.size();
+    const Int numRecvPeers = recvPeers.size();
+    sendRequests.resize( numSendPeers );
+    recvRequests.resize( numRecvPeers );
+    for( Int k=0; k<numRecvPeers; ++k )
+    {
+        const int q = recvPeers[k];
+        mpi::RecvInit
+        ( &recvBuf[recvOffs[q]], recvCounts[q], q, comm, recvRequests[k] );
+    }
+    for( Int k=0; k<numSendPeers; ++k )
+    {
+        const int q = sendPeers[k];
+        mpi::SendInit
+        ( &sendBuf[sendOffs[q]], sendCounts[q], q, comm, sendRequests[k] );
+    }
+}
+
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void InitRequests
+( T* sendBuf, const vector<int>& sendPeers,
+  const vector<int>& sendCounts, const vector<int>& sendOffs,
+  vector<mpi::Request<T>>& sendRequests,
+  T* recvBuf, const vector<int>& recvPeers,
+  const vector<int>& recvCounts, const vector<int>& recvOffs,
+  vector<mpi::Request<T>>& recvRequests,
+  mpi::Comm comm )
+{ LogicError("Persistent requests require a packed datatype"); }
+
+template<typename T,typename=EnableIf<IsPacked<T>>>
+void StartAll( vector<mpi::Request<T>>& requests )
+{
+    if( !requests.empty() )
+        mpi::StartAll( requests.size(), requests.data() );
+}
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void StartAll( vector<mpi::Request<T>>& requests )
+{ LogicError("Persistent requests require a packed datatype"); }
+
+template<typename T,typename=EnableIf<IsPacked<T>>>
+void FreeAll( vector<mpi::Request<T>>& requests )
+{
+    for( auto& request : requests )
+        mpi::Free( request );
+    requests.clear();
+}
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void FreeAll( vector<mpi::Request<T>>& requests )
+{ requests.clear(); }
+
+template<typename T>
+void Layout<T>::Set( const AbstractDistMatrix<T>& A )
+{
+    grid = &A.Grid();
+    height = A.Height();
+    width = A.Width();
+    colDist = A.ColDist();
+    rowDist = A.RowDist();
+    wrap = A.Wrap();
+    blockHeight = A.BlockHeight();
+    blockWidth = A.BlockWidth();
+    colAlign = A.ColAlign();
+    rowAlign = A.RowAlign();
+    colCut = A.ColCut();
+    rowCut = A.RowCut();
+    root = A.Root();
+}
+
+template<typename T>
+bool Layout<T>::Matches( const AbstractDistMatrix<T>& A ) const
+{
+    return grid == &A.Grid() &&
+           height == A.Height() && width == A.Width() &&
+           colDist == A.ColDist() && rowDist == A.RowDist() &&
+           wrap == A.Wrap() &&
+           blockHeight == A.BlockHeight() && blockWidth == A.BlockWidth() &&
+           colAlign == A.ColAlign() && rowAlign == A.RowAlign() &&
+           colCut == A.ColCut() && rowCut == A.RowCut() &&
+           root == A.Root();
+}
+
+} // namespace redist_plan
+
+// A replayable plan for redistributing between two fixed distributed matrix
+// layouts over the same grid.
+//
+// The communication pattern (the per-process send and receive counts and the
+// pack and unpack index maps) is derived once from the layouts of A and B,
+// so that each call to Execute need only pack, exchange, and unpack the
+// entries. No metadata is transmitted, as both sides traverse the entries in
+// column-major order of their global indices. For packed datatypes, the
+// exchange defaults to persistent point-to-point requests bound to buffers
+// owned by the plan.
+//
+// NOTE: Since persistent requests may be held, plans should be destroyed
+//       before Elemental is finalized.
+template<typename T>
+class RedistPlan
+{
+public:
+    RedistPlan();
+    RedistPlan
+    ( const AbstractDistMatrix<T>& A,
+            AbstractDistMatrix<T>& B,
+      bool persistent=true );
+    ~RedistPlan();
+
+    // (Re)build the plan from the current layouts of A and B (after resizing
+    // B to match the size of A)
+    void Setup
+    ( const AbstractDistMatrix<T>& A,
+            AbstractDistMatrix<T>& B,
+      bool persistent=true );
+
+    // Whether the layouts of A and B agree with those the plan was built for
+    bool Matches
+    ( const AbstractDistMatrix<T>& A,
+      const AbstractDistMatrix<T>& B ) const;
+
+    // Transfer the entries of A into B
+    void Execute( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+
+    // Split-phase form of Execute: Start packs A and initiates the exchange,
+    // and Finish completes it and unpacks into B. A may be modified as soon
+    // as Start returns, but B should not be accessed until Finish returns.
+    // Only persistent plans communicate in the background; otherwise the
+    // exchange is performed within Start.
+    void Start( const AbstractDistMatrix<T>& A );
+    void Finish( AbstractDistMatrix<T>& B );
+    bool Started() const EL_NO_EXCEPT { return started_; }
+
+    bool Persistent() const EL_NO_EXCEPT { return persistent_; }
+    Int NumSendEntries() const EL_NO_EXCEPT { return sendRows_.size(); }
+    Int NumRecvEntries() const EL_NO_EXCEPT { return recvRows_.size(); }
+
+private:
+    bool built_=false, persistent_=false, started_=false;
+    redist_plan::Layout<T> layoutA_, layoutB_;
+    mpi::Comm comm_;
+
+    // The local (row,column) indices of A to pack into each slot of the send
+    // buffer, and of B to unpack from each slot of the receive buffer
+    vector<Int> sendRows_, sendCols_;
+    vector<Int> recvRows_, recvCols_;
+    vector<int> sendCounts_, sendOffs_, recvCounts_, recvOffs_;
+
+    Memory<T> sendBuf_, recvBuf_;
+    vector<int> sendPeers_, recvPeers_;
+    vector<mpi::Request<T>> sendRequests_, recvRequests_;
+
+    void FreeRequests();
+    void SetupRequests();
+    void StartExchange();
+    void FinishExchange();
+
+    // Disable copying since persistent requests are bound to our buffers
+    RedistPlan( const RedistPlan<T>& );
+    const RedistPlan<T>& operator=( const RedistPlan<T>& );
+};
+
+
+template<typename T>
+RedistPlan<T>::RedistPlan() { }
+
+template<typename T>
+RedistPlan<T>::RedistPlan
+( const AbstractDistMatrix<T>& A,
+        AbstractDistMatrix<T>& B,
+  bool persistent )
+{ Setup( A, B, persistent ); }
+
+template<typename T>
+RedistPlan<T>::~RedistPlan()
+{
+    if( !mpi::Finalized() )
+    {
+        if( started_ && layoutA_.grid->InGrid() )
+            FinishExchange();
+        FreeRequests();
+    }
+}
+
+template<typename T>
+void RedistPlan<T>::FreeRequests()
+{
+    redist_plan::FreeAll( sendRequests_ );
+    redist_plan::FreeAll( recvRequests_ );
+}
+
+template<typename T>
+void RedistPlan<T>::Setup
+( const AbstractDistMatrix<T>& A,
+        AbstractDistMatrix<T>& B,
+  bool persistent )
+{
+    EL_DEBUG_CSE
+    AssertSameGrids( A.Grid(), B.Grid() );
+    if( started_ )
+        LogicError("Cannot rebuild a RedistPlan with an exchange in flight");
+    FreeRequests();
+
+    const Int height = A.Height();
+    const Int width = A.Width();
+    B.Resize( height, width );
+    layoutA_.Set( A );
+    layoutB_.Set( B );
+    persistent_ = persistent && redist_plan::CanPersist<T>();
+    built_ = true;
+
+    const El::Grid& g = A.Grid();
+    sendRows_.clear(); sendCols_.clear();
+    recvRows_.clear(); recvCols_.clear();
+    sendPeers_.clear(); recvPeers_.clear();
+    if( !g.InGrid() )
+    {
+        sendCounts_.clear(); sendOffs_.clear();
+        recvCounts_.clear(); recvOffs_.clear();
+        return;
+    }
+    comm_ = g.VCComm();
+    const int commSize = g.VCSize();
+
+    // Count and order the entries we are responsible for sending
+    // ==========================================================
+    sendCounts_.assign( commSize, 0 );
+    const Int redundantSizeB = B.RedundantSize();
+    const int colStrideB = B.ColStride();
+    const Int localHeightA = A.LocalHeight();
+    const Int localWidthA = A.LocalWidth();
+    const bool sending = A.Participating() && A.RedundantRank() == 0;
+    vector<int> rowOwnersB, colOwnersB, distToVCB;
+    if( sending )
+    {
+        rowOwnersB.resize( localHeightA );
+        for( Int iLoc=0; iLoc<localHeightA; ++iLoc )
+            rowOwnersB[iLoc] = B.RowOwner( A.GlobalRow(iLoc) );
+        colOwnersB.resize( localWidthA );
+        for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
+            colOwnersB[jLoc] = B.ColOwner( A.GlobalCol(jLoc) );
+
+        const int distSizeB = B.DistSize();
+        distToVCB.resize( distSizeB*redundantSizeB );
+        for( int distRank=0; distRank<distSizeB; ++distRank )
+            for( Int r=0; r<redundantSizeB; ++r )
+                distToVCB[distRank*redundantSizeB+r] =
+                  g.CoordsToVC
+                  ( B.ColDist(), B.RowDist(), distRank, B.Root(), r );
+
+        for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
+        {
+            const int colOwner = colOwnersB[jLoc];
+            for( Int iLoc=0; iLoc<localHeightA; ++iLoc )
+            {
+                const int distRank = rowOwnersB[iLoc] + colStrideB*colOwner;
+                for( Int r=0; r<redundantSizeB; ++r )
+                    ++sendCounts_[distToVCB[distRank*redundantSizeB+r]];
+            }
+        }
+    }
+    const int totalSend = Scan( sendCounts_, sendOffs_ );
+    sendRows_.resize( totalSend );
+    sendCols_.resize( totalSend );
+    if( sending )
+    {
+        auto offs = sendOffs_;
+        for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
+        {
+            const int colOwner = colOwnersB[jLoc];
+            for( Int iLoc=0; iLoc<localHeightA; ++iLoc )
+            {
+                const int distRank = rowOwnersB[iLoc] + colStrideB*colOwner;
+                for( Int r=0; r<redundantSizeB; ++r )
+                {
+                    const int q = distToVCB[distRank*redundantSizeB+r];
+                    const int slot = offs[q]++;
+                    sendRows_[slot] = iLoc;
+                    sendCols_[slot] = jLoc;
+                }
+            }
+        }
+    }
+
+    // Count and order the entries we will receive
+    // ===========================================
+    // Since the sender traverses its entries in column-major order, and the
+    // local indices are monotonic in the global indices, traversing our own
+    // entries in column-major order yields the same ordering from each source
+    recvCounts_.assign( commSize, 0 );
+    const Int localHeightB = B.LocalHeight();
+    const Int localWidthB = B.LocalWidth();
+    const int colStrideA = A.ColStride();
+    vector<int> rowOwnersA, colOwnersA, distToVCA;
+    if( B.Participating() )
+    {
+        rowOwnersA.resize( localHeightB );
+        for( Int iLoc=0; iLoc<localHeightB; ++iLoc )
+            rowOwnersA[iLoc] = A.RowOwner( B.GlobalRow(iLoc) );
+        colOwnersA.resize( localWidthB );
+        for( Int jLoc=0; jLoc<localWidthB; ++jLoc )
+            colOwnersA[jLoc] = A.ColOwner( B.GlobalCol(jLoc) );
+
+        const int distSizeA = A.DistSize();
+        distToVCA.resize( distSizeA );
+        for( int distRank=0; distRank<distSizeA; ++distRank )
+            distToVCA[distRank] =
+              g.CoordsToVC( A.ColDist(), A.RowDist(), distRank, A.Root(), 0 );
+
+        for( Int jLoc=0; jLoc<localWidthB; ++jLoc )
+        {
+            const int colOwner = colOwnersA[jLoc];
+            for( Int iLoc=0; iLoc<localHeightB; ++iLoc )
+                ++recvCounts_[distToVCA[rowOwnersA[iLoc]+colStrideA*colOwner]];
+        }
+    }
+    const int totalRecv = Scan( recvCounts_, recvOffs_ );
+    recvRows_.resize( totalRecv );
+    recvCols_.resize( totalRecv );
+    if( B.Participating() )
+    {
+        auto offs = recvOffs_;
+        for( Int jLoc=0; jLoc<localWidthB; ++jLoc )
+        {
+            const int colOwner = colOwnersA[jLoc];
+            for( Int iLoc=0; iLoc<localHeightB; ++iLoc )
+            {
+                const int q = distToVCA[rowOwnersA[iLoc]+colStrideA*colOwner];
+                const int slot = offs[q]++;
+                recvRows_[slot] = iLoc;
+                recvCols_[slot] = jLoc;
+            }
+        }
+    }
+
+    // Allocate the buffers and (optionally) bind persistent requests
+    // ==============================================================
+    sendBuf_.Require( totalSend );
+    recvBuf_.Require( totalRecv );
+    const int commRank = g.VCRank();
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            continue;
+        if( sendCounts_[q] > 0 )
+            sendPeers_.push_back( q );
+        if( recvCounts_[q] > 0 )
+            recvPeers_.push_back( q );
+    }
+    if( persistent_ )
+        SetupRequests();
+}
+
+template<typename T>
+void RedistPlan<T>::SetupRequests()
+{
+    EL_DEBUG_CSE
+    redist_plan::InitRequests
+    ( sendBuf_.Buffer(), sendPeers_, sendCounts_, sendOffs_, sendRequests_,
+      recvBuf_.Buffer(), recvPeers_, recvCounts_, recvOffs_, recvRequests_,
+      comm_ );
+}
+
+template<typename T>
+bool RedistPlan<T>::Matches
+( const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B ) const
+{ return built_ && layoutA_.Matches(A) && layoutB_.Matches(B); }
+
+template<typename T>
+void RedistPlan<T>::StartExchange()
+{
+    EL_DEBUG_CSE
+    const int commRank = layoutA_.grid->VCRank();
+    T* sendBuf = sendBuf_.Buffer();
+    T* recvBuf = recvBuf_.Buffer();
+    if( persistent_ )
+    {
+        redist_plan::StartAll( recvRequests_ );
+        redist_plan::StartAll( sendRequests_ );
+    }
+    else
+    {
+        // Zero out the self-interaction so that it is not transmitted
+        auto sendCounts = sendCounts_;
+        auto recvCounts = recvCounts_;
+        sendCounts[commRank] = 0;
+        recvCounts[commRank] = 0;
+        mpi::AllToAll
+        ( sendBuf, sendCounts.data(), sendOffs_.data(),
+          recvBuf, recvCounts.data(), recvOffs_.data(), comm_ );
+    }
+
+    // Handle the self-interaction locally
+    EL_DEBUG_ONLY(
+      if( sendCounts_[commRank] != recvCounts_[commRank] )
+          LogicError("Inconsistent self-interaction in RedistPlan");
+    )
+    MemCopy
+    ( &recvBuf[recvOffs_[commRank]], &sendBuf[sendOffs_[commRank]],
+      sendCounts_[commRank] );
+}
+
+template<typename T>
+void RedistPlan<T>::FinishExchange()
+{
+    EL_DEBUG_CSE
+    if( persistent_ )
+    {
+        if( !recvRequests_.empty() )
+            mpi::WaitAll( recvRequests_.size(), recvRequests_.data() );
+        if( !sendRequests_.empty() )
+            mpi::WaitAll( sendRequests_.size(), sendRequests_.data() );
+    }
+}
+
+template<typename T>
+void RedistPlan<T>::Execute
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    Start( A );
+    Finish( B );
+}
+
+template<typename T>
+void RedistPlan<T>::Start( const AbstractDistMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    if( !built_ )
+        LogicError("RedistPlan was not set up");
+    if( started_ )
+        LogicError("RedistPlan was already started");
+    if( !layoutA_.Matches(A) )
+        LogicError("The layout of A does not match the RedistPlan");
+    started_ = true;
+    if( !layoutA_.grid->InGrid() )
+        return;
+
+    // Pack
+    const Int totalSend = sendRows_.size();
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    T* sendBuf = sendBuf_.Buffer();
+    EL_PARALLEL_FOR
+    for( Int k=0; k<totalSend; ++k )
+        sendBuf[k] = ABuf[sendRows_[k]+sendCols_[k]*ALDim];
+
+    StartExchange();
+}
+
+template<typename T>
+void RedistPlan<T>::Finish( AbstractDistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    if( !started_ )
+        LogicError("RedistPlan was not started");
+    B.Resize( layoutB_.height, layoutB_.width );
+    if( !layoutB_.Matches(B) )
+        LogicError("The layout of B does not match the RedistPlan");
+    started_ = false;
+    if( !layoutB_.grid->InGrid() )
+        return;
+
+    FinishExchange();
+
+    // Unpack
+    const Int totalRecv = recvRows_.size();
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    const T* recvBuf = recvBuf_.Buffer();
+    EL_PARALLEL_FOR
+    for( Int k=0; k<totalRecv; ++k )
+        BBuf[recvRows_[k]+recvCols_[k]*BLDim] = recvBuf[k];
+}
+
+// Redistribute A into B using a cached plan, which is (re)built whenever the
+// layouts of A and B no longer match it. Unlike Copy(A,B), the alignments of
+// B are left untouched.
+template<typename T>
+void Copy
+( const AbstractDistMatrix<T>& A,
+        AbstractDistMatrix<T>& B,
+        RedistPlan<T>& plan )
+{
+    EL_DEBUG_CSE
+    B.Resize( A.Height(), A.Width() );
+    if( !plan.Matches( A, B ) )
+        plan.Setup( A, B );
+    plan.Execute( A, B );
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_COPY_REDISTPLAN_HPP
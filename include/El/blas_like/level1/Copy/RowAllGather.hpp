@@ -50,10 +50,10 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int maxLocalWidth = MaxLength(width,rowStride);
 
                 const Int portionSize = mpi::Pad( localHeight*maxLocalWidth );
-                vector<T> buffer;
-                FastResize( buffer, (rowStride+1)*portionSize );
-                T* sendBuf = &buffer[0];
-                T* recvBuf = &buffer[portionSize];
+                Memory<T> buffer;
+                buffer.Require( (rowStride+1)*portionSize );
+                T* sendBuf = buffer.Buffer();
+                T* recvBuf = &buffer.Buffer()[portionSize];
 
                 // Pack
                 util::InterleaveMatrix
@@ -62,8 +62,8 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                   sendBuf,          1, localHeight );
 
                 // Communicate
-                mpi::AllGather
-                ( sendBuf, portionSize, recvBuf, portionSize, A.RowComm() );
+                util::AllGather
+                ( sendBuf, portionSize, recvBuf, portionSize, A.RowComm(), A.Grid() );
 
                 // Unpack
                 util::RowStridedUnpack
@@ -78,6 +78,7 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
             if( A.Grid().Rank() == 0 )
                 Output("Unaligned RowAllGather");
 #endif
+            RecordRealignment( "RowAllGather", A );
             const Int sendColRank = Mod( A.ColRank()+colDiff, A.ColStride() );
             const Int recvColRank = Mod( A.ColRank()-colDiff, A.ColStride() );
 
@@ -103,10 +104,10 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int maxLocalWidth = MaxLength(width,rowStride);
 
                 const Int portionSize = mpi::Pad(maxLocalHeight*maxLocalWidth);
-                vector<T> buffer;
-                FastResize( buffer, (rowStride+1)*portionSize );
-                T* firstBuf = &buffer[0];
-                T* secondBuf = &buffer[portionSize];
+                Memory<T> buffer;
+                buffer.Require( (rowStride+1)*portionSize );
+                T* firstBuf = buffer.Buffer();
+                T* secondBuf = &buffer.Buffer()[portionSize];
 
                 // Pack
                 util::InterleaveMatrix
@@ -120,9 +121,9 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                   firstBuf,  portionSize, recvColRank, A.ColComm() );
 
                 // Perform the row AllGather
-                mpi::AllGather
+                util::AllGather
                 ( firstBuf,  portionSize,
-                  secondBuf, portionSize, A.RowComm() );
+                  secondBuf, portionSize, A.RowComm(), A.Grid() );
 
                 // Unpack
                 util::RowStridedUnpack
@@ -194,10 +195,10 @@ void RowAllGather( const BlockMatrix<T>& A, BlockMatrix<T>& B )
                   MaxBlockedLength(width,blockWidth,rowCut,rowStride);
 
                 const Int portionSize = mpi::Pad( localHeight*maxLocalWidth );
-                vector<T> buffer;
-                FastResize( buffer, (rowStride+1)*portionSize );
-                T* sendBuf = &buffer[0];
-                T* recvBuf = &buffer[portionSize];
+                Memory<T> buffer;
+                buffer.Require( (rowStride+1)*portionSize );
+                T* sendBuf = buffer.Buffer();
+                T* recvBuf = &buffer.Buffer()[portionSize];
 
                 // Pack
                 util::InterleaveMatrix
@@ -206,8 +207,8 @@ void RowAllGather( const BlockMatrix<T>& A, BlockMatrix<T>& B )
                   sendBuf,          1, localHeight );
 
                 // Communicate
-                mpi::AllGather
-                ( sendBuf, portionSize, recvBuf, portionSize, A.RowComm() );
+                util::AllGather
+                ( sendBuf, portionSize, recvBuf, portionSize, A.RowComm(), A.Grid() );
 
                 // Unpack
                 util::BlockedRowStridedUnpack
@@ -223,6 +224,7 @@ void RowAllGather( const BlockMatrix<T>& A, BlockMatrix<T>& B )
             if( A.Grid().Rank() == 0 )
                 Output("Unaligned RowAllGather");
 #endif
+            RecordRealignment( "RowAllGather", A );
             const Int sendColRank = Mod( A.ColRank()+colDiff, A.ColStride() );
             const Int recvColRank = Mod( A.ColRank()-colDiff, A.ColStride() );
 
@@ -246,10 +248,10 @@ void RowAllGather( const BlockMatrix<T>& A, BlockMatrix<T>& B )
                   MaxBlockedLength(width,blockWidth,rowCut,rowStride);
 
                 const Int portionSize = mpi::Pad(maxLocalHeight*maxLocalWidth);
-                vector<T> buffer;
-                FastResize( buffer, (rowStride+1)*portionSize );
-                T* firstBuf = &buffer[0];
-                T* secondBuf = &buffer[portionSize];
+                Memory<T> buffer;
+                buffer.Require( (rowStride+1)*portionSize );
+                T* firstBuf = buffer.Buffer();
+                T* secondBuf = &buffer.Buffer()[portionSize];
 
                 // Pack
                 util::InterleaveMatrix
@@ -263,9 +265,9 @@ void RowAllGather( const BlockMatrix<T>& A, BlockMatrix<T>& B )
                   firstBuf,  portionSize, recvColRank, A.ColComm() );
 
                 // Perform the row AllGather
-                mpi::AllGather
+                util::AllGather
                 ( firstBuf,  portionSize,
-                  secondBuf, portionSize, A.RowComm() );
+                  secondBuf, portionSize, A.RowComm(), A.Grid() );
 
                 // Unpack
                 util::BlockedRowStridedUnpack
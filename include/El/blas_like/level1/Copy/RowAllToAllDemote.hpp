@@ -46,10 +46,10 @@ void RowAllToAllDemote
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, 2*rowStrideUnion*portionSize );
-            T* firstBuf  = &buffer[0];
-            T* secondBuf = &buffer[rowStrideUnion*portionSize];
+            Memory<T> buffer;
+            buffer.Require( 2*rowStrideUnion*portionSize );
+            T* firstBuf  = buffer.Buffer();
+            T* secondBuf = &buffer.Buffer()[rowStrideUnion*portionSize];
 
             // Pack
             util::PartialRowStridedPack
@@ -79,13 +79,14 @@ void RowAllToAllDemote
         if( B.Grid().Rank() == 0 )
             cerr << "Unaligned RowAllToAllDemote" << endl;
 #endif
+        RecordRealignment( "RowAllToAllDemote", A );
         const Int sendRowRankPart = Mod( rowRankPart+rowDiff, rowStridePart );
         const Int recvRowRankPart = Mod( rowRankPart-rowDiff, rowStridePart );
 
-        vector<T> buffer;
-        FastResize( buffer, 2*rowStrideUnion*portionSize );
-        T* firstBuf  = &buffer[0];
-        T* secondBuf = &buffer[rowStrideUnion*portionSize];
+        Memory<T> buffer;
+        buffer.Require( 2*rowStrideUnion*portionSize );
+        T* firstBuf  = buffer.Buffer();
+        T* secondBuf = &buffer.Buffer()[rowStrideUnion*portionSize];
 
         // Pack
         util::PartialRowStridedPack
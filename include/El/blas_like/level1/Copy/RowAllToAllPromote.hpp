@@ -47,10 +47,10 @@ void RowAllToAllPromote
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, 2*rowStrideUnion*portionSize );
-            T* firstBuf  = &buffer[0];
-            T* secondBuf = &buffer[rowStrideUnion*portionSize];
+            Memory<T> buffer;
+            buffer.Require( 2*rowStrideUnion*portionSize );
+            T* firstBuf  = buffer.Buffer();
+            T* secondBuf = &buffer.Buffer()[rowStrideUnion*portionSize];
 
             // Pack
             util::ColStridedPack
@@ -80,13 +80,14 @@ void RowAllToAllPromote
         if( A.Grid().Rank() == 0 )
             cerr << "Unaligned RowAllToAllPromote" << endl;
 #endif
+        RecordRealignment( "RowAllToAllPromote", A );
         const Int sendRowRankPart = Mod( rowRankPart+rowDiff, rowStridePart );
         const Int recvRowRankPart = Mod( rowRankPart-rowDiff, rowStridePart );
 
-        vector<T> buffer;
-        FastResize( buffer, 2*rowStrideUnion*portionSize );
-        T* firstBuf  = &buffer[0];
-        T* secondBuf = &buffer[rowStrideUnion*portionSize];
+        Memory<T> buffer;
+        buffer.Require( 2*rowStrideUnion*portionSize );
+        T* firstBuf  = buffer.Buffer();
+        T* secondBuf = &buffer.Buffer()[rowStrideUnion*portionSize];
 
         // Pack
         util::ColStridedPack
@@ -50,6 +50,7 @@ void RowFilter
         if( B.Grid().Rank() == 0 )
             Output("Unaligned RowFilter");
 #endif
+        RecordRealignment( "RowFilter", A );
         const Int colStride = B.ColStride();
         const Int sendColRank = Mod( B.ColRank()+colDiff, colStride );
         const Int recvColRank = Mod( B.ColRank()-colDiff, colStride );
@@ -57,10 +58,10 @@ void RowFilter
         const Int sendSize = localHeightA*localWidth;
         const Int recvSize = localHeight *localWidth;
 
-        vector<T> buffer;
-        FastResize( buffer, sendSize+recvSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[sendSize];
+        Memory<T> buffer;
+        buffer.Require( sendSize+recvSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = &buffer.Buffer()[sendSize];
 
         // Pack
         util::InterleaveMatrix
@@ -135,6 +136,7 @@ void RowFilter
         if( B.Grid().Rank() == 0 )
             Output("Unaligned RowFilter");
 #endif
+        RecordRealignment( "RowFilter", A );
         const Int colStride = B.ColStride();
         const Int sendColRank = Mod( B.ColRank()+colDiff, colStride );
         const Int recvColRank = Mod( B.ColRank()-colDiff, colStride );
@@ -142,10 +144,10 @@ void RowFilter
         const Int sendSize = localHeightA*localWidth;
         const Int recvSize = localHeight *localWidth;
 
-        vector<T> buffer;
-        FastResize( buffer, sendSize+recvSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[sendSize];
+        Memory<T> buffer;
+        buffer.Require( sendSize+recvSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = &buffer.Buffer()[sendSize];
 
         // Pack
         util::BlockedRowFilter
@@ -50,13 +50,13 @@ void Scatter
         return;
     }
 
-    vector<T> buffer;
+    Memory<T> buffer;
     T* recvBuf=0; // some compilers (falsely) warn otherwise
     if( A.CrossRank() == root )
     {
-        FastResize( buffer, sendSize+recvSize );
-        T* sendBuf = &buffer[0];
-        recvBuf    = &buffer[sendSize];
+        buffer.Require( sendSize+recvSize );
+        T* sendBuf = buffer.Buffer();
+        recvBuf    = &buffer.Buffer()[sendSize];
 
         // Pack the send buffer
         copy::util::StridedPack
@@ -72,8 +72,8 @@ void Scatter
     }
     else
     {
-        FastResize( buffer, recvSize );
-        recvBuf = &buffer[0];
+        buffer.Require( recvSize );
+        recvBuf = buffer.Buffer();
 
         // Perform the receiving portion of the scatter from the non-root
         mpi::Scatter
@@ -21,7 +21,14 @@ void TranslateBetweenGrids
     GeneralPurpose( A, B );
 }
 
-// TODO(poulson): Compare against copy::GeneralPurpose
+// Each process of A's grid owns exactly one (possibly empty) block of the
+// intersection with the local data of each process of B's grid: within a
+// single dimension, the rows assigned to both process row a of A and process
+// row b of B form an arithmetic progression with stride
+// lcm(colStrideA,colStrideB). Rather than routing data through a redundant
+// intermediate, we directly exchange these owner-to-owner blocks with
+// pairwise nonblocking messages. When the two grids share a process, its
+// block is copied in place rather than sent to itself.
 template<typename T>
 void TranslateBetweenGrids
 ( const DistMatrix<T,MC,MR>& A,
@@ -30,8 +37,6 @@ void TranslateBetweenGrids
     EL_DEBUG_CSE
     const Int m = A.Height();
     const Int n = A.Width();
-    const Int mLocA = A.LocalHeight();
-    const Int nLocA = A.LocalWidth();
     B.Resize( m, n );
     mpi::Comm viewingCommB = B.Grid().ViewingComm();
     mpi::Group owningGroupA = A.Grid().OwningGroup();
@@ -39,37 +44,28 @@ void TranslateBetweenGrids
     // Just need to ensure that each viewing comm contains the other team's
     // owning comm. Congruence is too strong.
 
-    // Compute the number of process rows and columns that each process
-    // needs to send to.
-    const Int colStride = B.ColStride();
-    const Int rowStride = B.RowStride();
-    const Int colShiftB = B.ColShift();
-    const Int rowShiftB = B.RowShift();
-    const Int colRank = B.ColRank();
-    const Int rowRank = B.RowRank();
-    const Int colRankA = A.ColRank();
-    const Int rowRankA = A.RowRank();
+    const bool inBGrid = B.Participating();
+    const bool inAGrid = A.Participating();
+    if( !inBGrid && !inAGrid )
+        return;
+
     const Int colStrideA = A.ColStride();
     const Int rowStrideA = A.RowStride();
-    const Int colGCD = GCD( colStride, colStrideA );
-    const Int rowGCD = GCD( rowStride, rowStrideA );
-    const Int colLCM = colStride*colStrideA / colGCD;
-    const Int rowLCM = rowStride*rowStrideA / rowGCD;
-    const Int numColSends = colStride / colGCD;
-    const Int numRowSends = rowStride / rowGCD;
-
+    const Int colStrideB = B.ColStride();
+    const Int rowStrideB = B.RowStride();
     const Int colAlignA = A.ColAlign();
     const Int rowAlignA = A.RowAlign();
     const Int colAlignB = B.ColAlign();
     const Int rowAlignB = B.RowAlign();
+    const Int colLCM = colStrideA*colStrideB / GCD( colStrideA, colStrideB );
+    const Int rowLCM = rowStrideA*rowStrideB / GCD( rowStrideA, rowStrideB );
 
-    const bool inBGrid = B.Participating();
-    const bool inAGrid = A.Participating();
-    if( !inBGrid && !inAGrid )
-        return;
-
-    const Int maxSendSize =
-      (m/(colStrideA*numColSends)+1) * (n/(rowStrideA*numRowSends)+1);
+    // Process row k/numColSends of A's local data (and similarly for the
+    // columns) is sent to a single process row of B
+    const Int numColSends = colLCM / colStrideA;
+    const Int numRowSends = rowLCM / rowStrideA;
+    const Int colUnpackStride = colLCM / colStrideB;
+    const Int rowUnpackStride = rowLCM / rowStrideB;
 
     // Translate the ranks from A's VC communicator to B's viewing so that
     // we can match send/recv communicators. Since A's VC communicator is not
@@ -98,123 +94,160 @@ void TranslateBetweenGrids
     }
     mpi::Translate
     ( owningGroupA, sizeA, ranks.data(), viewingCommB, rankMap.data() );
+    const int myViewingRank = mpi::Rank( viewingCommB );
 
-    // Have each member of A's grid individually send to all numRow x numCol
-    // processes in order, while the members of this grid receive from all
-    // necessary processes at each step.
-    Int requiredMemory = 0;
-    if( inAGrid )
-        requiredMemory += maxSendSize;
+    // Determine the sizes of the blocks to be received, indexed by the rank
+    // of the source process in A's grid, and the first entry of each
+    // intersection (in B's local coordinates). In each case, the first
+    // global index owned by both processes is the unique member of
+    // {shiftA + k*strideA}_{k<numSends} congruent to shiftB mod strideB.
+    vector<Int> recvColOffsets, recvRowOffsets;
+    vector<Int> recvHeights, recvWidths;
     if( inBGrid )
-        requiredMemory += maxSendSize;
-    vector<T> auxBuf;
-    FastResize( auxBuf, requiredMemory );
-    Int offset = 0;
-    T* sendBuf = &auxBuf[offset];
+    {
+        const Int colShiftB = B.ColShift();
+        const Int rowShiftB = B.RowShift();
+        recvColOffsets.resize( colStrideA, 0 );
+        recvRowOffsets.resize( rowStrideA, 0 );
+        recvHeights.resize( colStrideA, 0 );
+        recvWidths.resize( rowStrideA, 0 );
+        for( Int colRankA=0; colRankA<colStrideA; ++colRankA )
+        {
+            const Int colShiftA = Shift( colRankA, colAlignA, colStrideA );
+            for( Int k=0; k<numColSends; ++k )
+            {
+                const Int firstRow = colShiftA + k*colStrideA;
+                if( Mod(firstRow,colStrideB) == colShiftB )
+                {
+                    recvColOffsets[colRankA] =
+                      (firstRow-colShiftB) / colStrideB;
+                    recvHeights[colRankA] = Length( m, firstRow, colLCM );
+                    break;
+                }
+            }
+        }
+        for( Int rowRankA=0; rowRankA<rowStrideA; ++rowRankA )
+        {
+            const Int rowShiftA = Shift( rowRankA, rowAlignA, rowStrideA );
+            for( Int k=0; k<numRowSends; ++k )
+            {
+                const Int firstCol = rowShiftA + k*rowStrideA;
+                if( Mod(firstCol,rowStrideB) == rowShiftB )
+                {
+                    recvRowOffsets[rowRankA] =
+                      (firstCol-rowShiftB) / rowStrideB;
+                    recvWidths[rowRankA] = Length( n, firstCol, rowLCM );
+                    break;
+                }
+            }
+        }
+    }
+
+    // Allocate a single buffer large enough to hold the packed (non-local)
+    // portions of A and B
+    Int totalSend = 0, totalRecv = 0;
     if( inAGrid )
-        offset += maxSendSize;
-    T* recvBuf = &auxBuf[offset];
+        totalSend = A.LocalHeight()*A.LocalWidth();
+    if( inBGrid )
+        totalRecv = B.LocalHeight()*B.LocalWidth();
+    Memory<T> auxBuf;
+    auxBuf.Require( totalSend+totalRecv );
+    T* sendBuf = auxBuf.Buffer();
+    T* recvBuf = &sendBuf[totalSend];
+
+    vector<mpi::Request<T>> requests;
+    requests.reserve
+    ( (inAGrid ? numColSends*numRowSends : 0) +
+      (inBGrid ? colStrideA*rowStrideA : 0) );
 
-    Int recvRow = 0; // avoid compiler warnings...
+    // Post all of the receives
+    struct RecvBlock { Int colRankA, rowRankA, offset; };
+    vector<RecvBlock> recvBlocks;
+    if( inBGrid )
+    {
+        Int offset = 0;
+        for( Int rowRankA=0; rowRankA<rowStrideA; ++rowRankA )
+        {
+            const Int width = recvWidths[rowRankA];
+            for( Int colRankA=0; colRankA<colStrideA; ++colRankA )
+            {
+                const Int height = recvHeights[colRankA];
+                const int source = rankMap[colRankA+rowRankA*colStrideA];
+                if( height*width == 0 || source == myViewingRank )
+                    continue;
+                requests.emplace_back();
+                mpi::IRecv
+                ( &recvBuf[offset], height*width, source, viewingCommB,
+                  requests.back() );
+                recvBlocks.push_back( RecvBlock{colRankA,rowRankA,offset} );
+                offset += height*width;
+            }
+        }
+    }
+
+    // Pack and send each owner-to-owner block, copying the block for the
+    // local process (if any) directly into B
     if( inAGrid )
-        recvRow = Mod(Mod(colRankA-colAlignA,colStrideA)+colAlignB,colStride);
-    for( Int colSend=0; colSend<numColSends; ++colSend )
     {
-        Int recvCol = 0; // avoid compiler warnings...
-        if( inAGrid )
-            recvCol=Mod(Mod(rowRankA-rowAlignA,rowStrideA)+rowAlignB,rowStride);
+        const Int mLocA = A.LocalHeight();
+        const Int nLocA = A.LocalWidth();
+        const Int colShiftA = A.ColShift();
+        const Int rowShiftA = A.RowShift();
+        const Int colRankA = A.ColRank();
+        const Int rowRankA = A.RowRank();
+        Int offset = 0;
         for( Int rowSend=0; rowSend<numRowSends; ++rowSend )
         {
-            mpi::Request<T> sendRequest;
-            // Fire off this round of non-blocking sends
-            if( inAGrid )
+            const Int width = Length( nLocA, rowSend, numRowSends );
+            const Int rowRankB =
+              Mod( rowShiftA+rowSend*rowStrideA+rowAlignB, rowStrideB );
+            for( Int colSend=0; colSend<numColSends; ++colSend )
             {
-                // Pack the data
-                Int sendHeight = Length(mLocA,colSend,numColSends);
-                Int sendWidth = Length(nLocA,rowSend,numRowSends);
+                const Int height = Length( mLocA, colSend, numColSends );
+                if( height*width == 0 )
+                    continue;
+                const Int colRankB =
+                  Mod( colShiftA+colSend*colStrideA+colAlignB, colStrideB );
+                const Int dest =
+                  B.Grid().VCToViewing( colRankB+rowRankB*colStrideB );
+                if( dest == myViewingRank )
+                {
+                    copy::util::InterleaveMatrix
+                    ( height, width,
+                      A.LockedBuffer(colSend,rowSend),
+                      numColSends, numRowSends*A.LDim(),
+                      B.Buffer
+                      (recvColOffsets[colRankA],recvRowOffsets[rowRankA]),
+                      colUnpackStride, rowUnpackStride*B.LDim() );
+                    continue;
+                }
                 copy::util::InterleaveMatrix
-                ( sendHeight, sendWidth,
+                ( height, width,
                   A.LockedBuffer(colSend,rowSend),
                   numColSends, numRowSends*A.LDim(),
-                  sendBuf, 1, sendHeight );
-                // Send data
-                const Int recvVCRank = recvRow + recvCol*colStride;
-                const Int recvViewingRank = B.Grid().VCToViewing( recvVCRank );
+                  &sendBuf[offset], 1, height );
+                requests.emplace_back();
                 mpi::ISend
-                ( sendBuf, sendHeight*sendWidth, recvViewingRank,
-                  viewingCommB, sendRequest );
+                ( &sendBuf[offset], height*width, dest, viewingCommB,
+                  requests.back() );
+                offset += height*width;
             }
-            // Perform this round of recv's
-            if( inBGrid )
-            {
-                const Int sendColOffset = colAlignA;
-                const Int recvColOffset =
-                  Mod(colSend*colStrideA+colAlignB,colStride);
-                const Int sendRowOffset = rowAlignA;
-                const Int recvRowOffset =
-                  Mod(rowSend*rowStrideA+rowAlignB,rowStride);
-
-                const Int colShift = Mod( colRank-recvColOffset, colStride );
-                const Int rowShift = Mod( rowRank-recvRowOffset, rowStride );
-
-                const Int firstSendRow = Mod(colShift+sendColOffset,colStrideA);
-                const Int firstSendCol = Mod(rowShift+sendRowOffset,rowStrideA);
-
-                const Int numColRecvs = Length(colStrideA,colShift,colStride);
-                const Int numRowRecvs = Length(rowStrideA,rowShift,rowStride);
-
-                // Recv data
-                // For now, simply receive sequentially. Until we switch to
-                // nonblocking recv's, we won't be using much of the
-                // recvBuf
-                Int sendRow = firstSendRow;
-                for( Int colRecv=0; colRecv<numColRecvs; ++colRecv )
-                {
-                    const Int sendColShift =
-                      Shift( sendRow, colAlignA, colStrideA ) +
-                      colSend*colStrideA;
-                    const Int sendHeight = Length( m, sendColShift, colLCM );
-                    const Int localColOffset =
-                      (sendColShift-colShiftB) / colStride;
-
-                    Int sendCol = firstSendCol;
-                    for( Int rowRecv=0; rowRecv<numRowRecvs; ++rowRecv )
-                    {
-                        const Int sendRowShift =
-                          Shift( sendCol, rowAlignA, rowStrideA ) +
-                          rowSend*rowStrideA;
-                        const Int sendWidth = Length( n, sendRowShift, rowLCM );
-                        const Int localRowOffset =
-                          (sendRowShift-rowShiftB) / rowStride;
-
-                        const Int sendVCRank = sendRow+sendCol*colStrideA;
-                        mpi::Recv
-                        ( recvBuf, sendHeight*sendWidth, rankMap[sendVCRank],
-                          viewingCommB );
+        }
+    }
 
-                        // Unpack the data
-                        copy::util::InterleaveMatrix
-                        ( sendHeight, sendWidth,
-                          recvBuf, 1, sendHeight,
-                          B.Buffer(localColOffset,localRowOffset),
-                          colLCM/colStride, (rowLCM/rowStride)*B.LDim() );
+    mpi::WaitAll( int(requests.size()), requests.data() );
 
-                        // Set up the next send col
-                        sendCol = Mod(sendCol+rowStride,rowStrideA);
-                    }
-                    // Set up the next send row
-                    sendRow = Mod(sendRow+colStride,colStrideA);
-                }
-            }
-            // Ensure that this round of non-blocking sends completes
-            if( inAGrid )
-            {
-                mpi::Wait( sendRequest );
-                recvCol = Mod(recvCol+rowStrideA,rowStride);
-            }
-        }
-        if( inAGrid )
-            recvRow = Mod(recvRow+colStrideA,colStride);
+    // Unpack the received blocks
+    for( const auto& block : recvBlocks )
+    {
+        const Int height = recvHeights[block.colRankA];
+        const Int width = recvWidths[block.rowRankA];
+        copy::util::InterleaveMatrix
+        ( height, width,
+          &recvBuf[block.offset], 1, height,
+          B.Buffer
+          (recvColOffsets[block.colRankA],recvRowOffsets[block.rowRankA]),
+          colUnpackStride, rowUnpackStride*B.LDim() );
     }
 }
 
@@ -290,13 +323,13 @@ void TranslateBetweenGrids
         requiredMemory += height*width;
     if( B.Participating() )
         requiredMemory += height*width;
-    vector<T> buffer;
-    FastResize( buffer, requiredMemory );
+    Memory<T> buffer;
+    buffer.Require( requiredMemory );
     Int offset = 0;
-    T* sendBuf = &buffer[offset];
+    T* sendBuf = &buffer.Buffer()[offset];
     if( rankA == 0 )
         offset += height*width;
-    T* bcastBuffer = &buffer[offset];
+    T* bcastBuffer = &buffer.Buffer()[offset];
 
     // Send from the root of A to the root of B's matrix's grid
     mpi::Request<T> sendRequest;
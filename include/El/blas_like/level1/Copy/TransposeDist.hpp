@@ -45,10 +45,10 @@ void TransposeDist( const DistMatrix<T,U,V>& A, DistMatrix<T,V,U>& B )
         const Int recvRankB =
             (recvRankA/colStrideA)+rowStrideA*(recvRankA%colStrideA);
 
-        vector<T> buffer;
-        FastResize( buffer, (colStrideA+rowStrideA)*portionSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[colStrideA*portionSize];
+        Memory<T> buffer;
+        buffer.Require( (colStrideA+rowStrideA)*portionSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = &buffer.Buffer()[colStrideA*portionSize];
 
         if( A.RowRank() == A.RowAlign() )
         {
@@ -119,10 +119,10 @@ void TransposeDist( const DistMatrix<T,U,V>& A, DistMatrix<T,V,U>& B )
         const Int recvRankA =
             (recvRankB/rowStrideA)+colStrideA*(recvRankB%rowStrideA);
 
-        vector<T> buffer;
-        FastResize( buffer, (colStrideA+rowStrideA)*portionSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[rowStrideA*portionSize];
+        Memory<T> buffer;
+        buffer.Require( (colStrideA+rowStrideA)*portionSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = &buffer.Buffer()[rowStrideA*portionSize];
 
         if( A.ColRank() == A.ColAlign() )
         {
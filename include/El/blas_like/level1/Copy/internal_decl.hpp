@@ -13,6 +13,38 @@ namespace El {
 
 namespace copy {
 
+// The number of (distributed) redistributions which have fallen through to
+// the general-purpose (entry-by-entry) routine, which is primarily useful for
+// flagging the distribution pairs that lack a specialized kernel
+Int NumGeneralPurposeCopies();
+void CountGeneralPurposeCopy();
+
+// Record (see EnableRedistDiagnostics) that the redistribution 'routine' of A
+// required an extra exchange due to mismatched alignments
+template<typename T>
+inline void RecordRealignment
+( const char* routine, const AbstractDistMatrix<T>& A )
+{
+    if( RedistDiagnosticsEnabled() )
+        RecordRedistEvent
+        ( "realign", routine, double(sizeof(T))*A.Height()*A.Width() );
+}
+
+// Record that the redistribution of A into B fell back to GeneralPurpose
+template<typename S,typename T>
+inline void RecordGeneralPurposeCopy
+( const AbstractDistMatrix<S>& A, const AbstractDistMatrix<T>& B )
+{
+    if( RedistDiagnosticsEnabled() )
+        RecordRedistEvent
+        ( "general-purpose",
+          BuildString
+          ("[",DistToString(A.ColDist()),",",DistToString(A.RowDist()),
+           "] -> [",DistToString(B.ColDist()),",",DistToString(B.RowDist()),
+           "]"),
+          double(sizeof(T))*A.Height()*A.Width() );
+}
+
 template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
 void GeneralPurpose
 ( const AbstractDistMatrix<S>& A,
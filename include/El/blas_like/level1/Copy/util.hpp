@@ -13,29 +13,133 @@ namespace El {
 namespace copy {
 namespace util {
 
+// An AllGather over a communicator of the grid 'g' which, for packed
+// datatypes and if node-aware collectives are enabled, exchanges the
+// on-node portion through shared memory when multiple processes of the
+// communicator share a node
+template<typename T,typename=EnableIf<IsPacked<T>>>
+void AllGather
+( const T* sendBuf, int sendCount,
+        T* recvBuf, int recvCount, mpi::Comm comm, const Grid& g )
+{
+    EL_DEBUG_CSE
+    NodeAwareComm* nodeAware =
+      ( NodeAwareCollectivesEnabled() ? g.NodeAware( comm ) : nullptr );
+    if( nodeAware != nullptr && nodeAware->SharedCollectives() )
+        nodeAware->AllGather( sendBuf, sendCount*sizeof(T), recvBuf );
+    else
+        mpi::AllGather( sendBuf, sendCount, recvBuf, recvCount, comm );
+}
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void AllGather
+( const T* sendBuf, int sendCount,
+        T* recvBuf, int recvCount, mpi::Comm comm, const Grid& g )
+{
+    EL_DEBUG_CSE
+    mpi::AllGather( sendBuf, sendCount, recvBuf, recvCount, comm );
+}
+
+// Packing engine
+// ==============
+// The (un)packing routines below all funnel into InterleaveMatrix, which
+// copies a strided height x width matrix. Copies of at least
+// PackingThreshold() entries are split over PackingThreads() OpenMP threads
+// (by columns and, if there are fewer columns than threads, by row blocks),
+// and strided columns are copied with SIMD loops, which, for complex
+// datatypes, run over the underlying real and imaginary parts.
+
 template<typename T>
-void InterleaveMatrix
-( Int height, Int width,
-  const T* A, Int colStrideA, Int rowStrideA,
-        T* B, Int colStrideB, Int rowStrideB )
+void InterleaveColumn
+( Int height, const T* A, Int colStrideA, T* B, Int colStrideB )
 {
     if( colStrideA == 1 && colStrideB == 1 )
     {
-        lapack::Copy( 'F', height, width, A, rowStrideA, B, rowStrideB );
+        MemCopy( B, A, height );
+    }
+    else if( IsPacked<T>::value )
+    {
+        EL_SIMD
+        for( Int i=0; i<height; ++i )
+            B[i*colStrideB] = A[i*colStrideA];
     }
     else
     {
+        for( Int i=0; i<height; ++i )
+            B[i*colStrideB] = A[i*colStrideA];
+    }
+}
+
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void InterleaveColumn
+( Int height,
+  const Complex<Real>* A, Int colStrideA,
+        Complex<Real>* B, Int colStrideB )
+{
+    if( colStrideA == 1 && colStrideB == 1 )
+    {
+        MemCopy( B, A, height );
+        return;
+    }
+    const Real* ARealImag = reinterpret_cast<const Real*>(A);
+          Real* BRealImag = reinterpret_cast<Real*>(B);
+    const Int ARealStride = 2*colStrideA;
+    const Int BRealStride = 2*colStrideB;
+    EL_SIMD
+    for( Int i=0; i<height; ++i )
+    {
+        BRealImag[i*BRealStride  ] = ARealImag[i*ARealStride  ];
+        BRealImag[i*BRealStride+1] = ARealImag[i*ARealStride+1];
+    }
+}
+
+template<typename T>
+void InterleaveMatrix
+( Int height, Int width,
+  const T* A, Int colStrideA, Int rowStrideA,
+        T* B, Int colStrideB, Int rowStrideB )
+{
 #ifdef EL_HAVE_MKL
+    if( colStrideA != 1 || colStrideB != 1 )
+    {
         mkl::omatcopy
         ( NORMAL, height, width, T(1),
           A, rowStrideA, colStrideA,
           B, rowStrideB, colStrideB );
-#else
+        return;
+    }
+#endif
+    const Int numEntries = height*width;
+    const int numThreads =
+      ( IsPacked<T>::value && numEntries >= PackingThreshold() ?
+        PackingThreads() : 1 );
+    if( numThreads <= 1 )
+    {
         for( Int j=0; j<width; ++j )
-            StridedMemCopy
-            ( &B[j*rowStrideB], colStrideB,
-              &A[j*rowStrideA], colStrideA, height );
+            InterleaveColumn
+            ( height,
+              &A[j*rowStrideA], colStrideA,
+              &B[j*rowStrideB], colStrideB );
+        return;
+    }
+
+    // Split each column into enough row blocks to occupy every thread
+    const Int numRowBlocks =
+      ( width >= numThreads ? 1 : (numThreads+width-1)/width );
+    const Int rowBlockSize = (height+numRowBlocks-1) / numRowBlocks;
+    const Int numTasks = width*numRowBlocks;
+#ifdef EL_HAVE_THREADED_PACKING
+    _Pragma("omp parallel for num_threads(numThreads)")
 #endif
+    for( Int task=0; task<numTasks; ++task )
+    {
+        const Int j = task / numRowBlocks;
+        const Int iBeg = (task % numRowBlocks)*rowBlockSize;
+        const Int blockHeight = Min( rowBlockSize, height-iBeg );
+        if( blockHeight > 0 )
+            InterleaveColumn
+            ( blockHeight,
+              &A[iBeg*colStrideA+j*rowStrideA], colStrideA,
+              &B[iBeg*colStrideB+j*rowStrideB], colStrideB );
     }
 }
 
@@ -69,9 +173,10 @@ void ColStridedColumnPack
     {
         const Int colShift = Shift_( k, colAlign, colStride );
         const Int localHeight = Length_( height, colShift, colStride );
-        StridedMemCopy
-        ( &BPortions[k*portionSize], 1,
-          &A[colShift],              colStride, localHeight );
+        InterleaveColumn
+        ( localHeight,
+          &A[colShift],              colStride,
+          &BPortions[k*portionSize], 1 );
     }
 }
 
@@ -101,7 +206,7 @@ void BlockedColStridedUnpack
   const T* APortions, Int portionSize,
         T* B,         Int BLDim )
 {
-    const Int firstBlockHeight = blockHeight - colCut;
+    const Int firstBlockHeight = Min( blockHeight-colCut, height );
     for( Int portion=0; portion<colStride; ++portion )
     {
         const T* APortion = &APortions[portion*portionSize];
@@ -121,10 +226,10 @@ void BlockedColStridedUnpack
                 firstBlockHeight :
                 Min(blockHeight,height-rowIndex) );
 
-            lapack::Copy
-            ( 'F', thisBlockHeight, width,
-              &APortion[packedRowIndex], localHeight,
-              &B[rowIndex],              BLDim );
+            InterleaveMatrix
+            ( thisBlockHeight, width,
+              &APortion[packedRowIndex], 1, localHeight,
+              &B[rowIndex],              1, BLDim );
 
             blockRow += colStride;
             rowIndex += thisBlockHeight + (colStride-1)*blockHeight;
@@ -170,9 +275,10 @@ void PartialColStridedColumnPack
             Shift_( colRankPart+k*colStridePart, colAlign, colStride );
         const Int colOffset = (colShift-colShiftA) / colStridePart;
         const Int localHeight = Length_( height, colShift, colStride );
-        StridedMemCopy
-        ( &BPortions[k*portionSize], 1,
-          &A[colOffset],             colStrideUnion, localHeight );
+        InterleaveColumn
+        ( localHeight,
+          &A[colOffset],             colStrideUnion,
+          &BPortions[k*portionSize], 1 );
     }
 }
 
@@ -213,9 +319,10 @@ void PartialColStridedColumnUnpack
             Shift_( colRankPart+k*colStridePart, colAlign, colStride );
         const Int colOffset = (colShift-colShiftB) / colStridePart;
         const Int localHeight = Length_( height, colShift, colStride );
-        StridedMemCopy
-        ( &B[colOffset],             colStrideUnion,
-          &APortions[k*portionSize], 1,              localHeight );
+        InterleaveColumn
+        ( localHeight,
+          &APortions[k*portionSize], 1,
+          &B[colOffset],             colStrideUnion );
     }
 }
 
@@ -230,10 +337,10 @@ void RowStridedPack
     {
         const Int rowShift = Shift_( k, rowAlign, rowStride );
         const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth,
-          &A[rowShift*ALDim],        rowStride*ALDim,
-          &BPortions[k*portionSize], height );
+        InterleaveMatrix
+        ( height, localWidth,
+          &A[rowShift*ALDim],        1, rowStride*ALDim,
+          &BPortions[k*portionSize], 1, height );
     }
 }
 
@@ -248,10 +355,10 @@ void RowStridedUnpack
     {
         const Int rowShift = Shift_( k, rowAlign, rowStride );
         const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth,
-          &APortions[k*portionSize], height,
-          &B[rowShift*BLDim],        rowStride*BLDim );
+        InterleaveMatrix
+        ( height, localWidth,
+          &APortions[k*portionSize], 1, height,
+          &B[rowShift*BLDim],        1, rowStride*BLDim );
     }
 }
 
@@ -263,7 +370,7 @@ void BlockedRowStridedUnpack
   const T* APortions, Int portionSize,
         T* B,         Int BLDim )
 {
-    const Int firstBlockWidth = blockWidth - rowCut;
+    const Int firstBlockWidth = Min( blockWidth-rowCut, width );
     for( Int portion=0; portion<rowStride; ++portion )
     {
         const T* APortion = &APortions[portion*portionSize];
@@ -281,10 +388,10 @@ void BlockedRowStridedUnpack
                 firstBlockWidth :
                 Min(blockWidth,width-colIndex) );
 
-            lapack::Copy
-            ( 'F', height, thisBlockWidth,
-              &APortion[packedColIndex*height], height,
-              &B[colIndex*BLDim],               BLDim );
+            InterleaveMatrix
+            ( height, thisBlockWidth,
+              &APortion[packedColIndex*height], 1, height,
+              &B[colIndex*BLDim],               1, BLDim );
 
             blockCol += rowStride;
             colIndex += thisBlockWidth + (rowStride-1)*blockWidth;
@@ -302,7 +409,7 @@ void BlockedRowFilter
         T* B, Int BLDim )
 {
     EL_DEBUG_CSE
-    const Int firstBlockWidth = blockWidth - rowCut;
+    const Int firstBlockWidth = Min( blockWidth-rowCut, width );
 
     // Loop over the block columns from this portion
     Int blockCol = rowShift;
@@ -317,10 +424,10 @@ void BlockedRowFilter
             firstBlockWidth :
             Min(blockWidth,width-colIndex) );
 
-        lapack::Copy
-        ( 'F', height, thisBlockWidth,
-          &A[colIndex      *ALDim], ALDim,
-          &B[packedColIndex*BLDim], BLDim );
+        InterleaveMatrix
+        ( height, thisBlockWidth,
+          &A[colIndex      *ALDim], 1, ALDim,
+          &B[packedColIndex*BLDim], 1, BLDim );
 
         blockCol += rowStride;
         colIndex += thisBlockWidth + (rowStride-1)*blockWidth;
@@ -337,7 +444,7 @@ void BlockedColFilter
         T* B, Int BLDim )
 {
     EL_DEBUG_CSE
-    const Int firstBlockHeight = blockHeight - colCut;
+    const Int firstBlockHeight = Min( blockHeight-colCut, height );
 
     // Loop over the block rows from this portion
     Int blockRow = colShift;
@@ -352,10 +459,10 @@ void BlockedColFilter
             firstBlockHeight :
             Min(blockHeight,height-rowIndex) );
 
-        lapack::Copy
-        ( 'F', thisBlockHeight, width,
-          &A[rowIndex],       ALDim,
-          &B[packedRowIndex], BLDim );
+        InterleaveMatrix
+        ( thisBlockHeight, width,
+          &A[rowIndex],       1, ALDim,
+          &B[packedRowIndex], 1, BLDim );
 
         blockRow += colStride;
         rowIndex += thisBlockHeight + (colStride-1)*blockHeight;
@@ -363,6 +470,43 @@ void BlockedColFilter
     }
 }
 
+// Extract the locally owned block rows and block columns of A
+template<typename T>
+void BlockedFilter
+( Int height, Int width,
+  Int colShift, Int colStride, Int blockHeight, Int colCut,
+  Int rowShift, Int rowStride, Int blockWidth, Int rowCut,
+  const T* A, Int ALDim,
+        T* B, Int BLDim )
+{
+    EL_DEBUG_CSE
+    const Int firstBlockWidth = Min( blockWidth-rowCut, width );
+
+    // Loop over the owned block columns and filter each of them
+    Int blockCol = rowShift;
+    Int colIndex =
+      ( rowShift==0 ? 0 : firstBlockWidth + (rowShift-1)*blockWidth );
+    Int packedColIndex = 0;
+
+    while( colIndex < width )
+    {
+        const Int thisBlockWidth =
+          ( blockCol == 0 ?
+            firstBlockWidth :
+            Min(blockWidth,width-colIndex) );
+
+        BlockedColFilter
+        ( height, thisBlockWidth,
+          colShift, colStride, blockHeight, colCut,
+          &A[colIndex      *ALDim], ALDim,
+          &B[packedColIndex*BLDim], BLDim );
+
+        blockCol += rowStride;
+        colIndex += thisBlockWidth + (rowStride-1)*blockWidth;
+        packedColIndex += thisBlockWidth;
+    }
+}
+
 template<typename T>
 void PartialRowStridedPack
 ( Int height, Int width,
@@ -378,10 +522,10 @@ void PartialRowStridedPack
             Shift_( rowRankPart+k*rowStridePart, rowAlign, rowStride );
         const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
         const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth,
-          &A[rowOffset*ALDim],       rowStrideUnion*ALDim,
-          &BPortions[k*portionSize], height );
+        InterleaveMatrix
+        ( height, localWidth,
+          &A[rowOffset*ALDim],       1, rowStrideUnion*ALDim,
+          &BPortions[k*portionSize], 1, height );
     }
 }
 template<typename T>
@@ -399,10 +543,10 @@ void PartialRowStridedUnpack
             Shift_( rowRankPart+k*rowStridePart, rowAlign, rowStride );
         const Int rowOffset = (rowShift-rowShiftB) / rowStridePart;
         const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth,
-          &APortions[k*portionSize], height,
-          &B[rowOffset*BLDim],       rowStrideUnion*BLDim );
+        InterleaveMatrix
+        ( height, localWidth,
+          &APortions[k*portionSize], 1, height,
+          &B[rowOffset*BLDim],       1, rowStrideUnion*BLDim );
     }
 }
 
@@ -456,6 +600,71 @@ void StridedUnpack
     }
 }
 
+// The block-cyclic analogue of StridedUnpack, where portion k+l*colStride
+// holds the packed local data of the process with column and row shifts
+// determined by k and l
+template<typename T>
+void BlockedStridedUnpack
+( Int height, Int width,
+  Int colAlign, Int colStride, Int blockHeight, Int colCut,
+  Int rowAlign, Int rowStride, Int blockWidth, Int rowCut,
+  const T* APortions, Int portionSize,
+        T* B,         Int BLDim )
+{
+    const Int firstBlockHeight = Min( blockHeight-colCut, height );
+    const Int firstBlockWidth = Min( blockWidth-rowCut, width );
+    for( Int l=0; l<rowStride; ++l )
+    {
+        const Int rowShift = Shift_( l, rowAlign, rowStride );
+        const Int firstCol =
+          ( rowShift==0 ? 0 : firstBlockWidth + (rowShift-1)*blockWidth );
+        for( Int k=0; k<colStride; ++k )
+        {
+            const Int colShift = Shift_( k, colAlign, colStride );
+            const Int localHeight =
+              BlockedLength_
+              ( height, colShift, blockHeight, colCut, colStride );
+            const T* APortion = &APortions[(k+l*colStride)*portionSize];
+            const Int firstRow =
+              ( colShift==0 ? 0 : firstBlockHeight + (colShift-1)*blockHeight );
+
+            Int blockCol = rowShift;
+            Int packedColIndex = 0;
+            for( Int colIndex=firstCol; colIndex<width; )
+            {
+                const Int thisBlockWidth =
+                  ( blockCol == 0 ?
+                    firstBlockWidth :
+                    Min(blockWidth,width-colIndex) );
+
+                Int blockRow = colShift;
+                Int packedRowIndex = 0;
+                for( Int rowIndex=firstRow; rowIndex<height; )
+                {
+                    const Int thisBlockHeight =
+                      ( blockRow == 0 ?
+                        firstBlockHeight :
+                        Min(blockHeight,height-rowIndex) );
+
+                    InterleaveMatrix
+                    ( thisBlockHeight, thisBlockWidth,
+                      &APortion[packedRowIndex+packedColIndex*localHeight],
+                      1, localHeight,
+                      &B[rowIndex+colIndex*BLDim], 1, BLDim );
+
+                    blockRow += colStride;
+                    rowIndex += thisBlockHeight + (colStride-1)*blockHeight;
+                    packedRowIndex += thisBlockHeight;
+                }
+
+                blockCol += rowStride;
+                colIndex += thisBlockWidth + (rowStride-1)*blockWidth;
+                packedColIndex += thisBlockWidth;
+            }
+        }
+    }
+}
+
 } // namespace util
 } // namespace copy
 } // namespace El
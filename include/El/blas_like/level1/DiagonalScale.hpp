@@ -244,7 +244,7 @@ void DiagonalScale
 
         // Loop over the entries of A and rescale
         for( Int k=0; k<numEntries; ++k )
-            vBuf[k] *= recvVals[meta.colOffs[k]];
+            vBuf[k] *= recvVals[meta.ColOff(k)];
     }
 }
 
@@ -327,7 +327,7 @@ void DiagonalSolve
 
         // Loop over the entries of A and rescale
         for( Int k=0; k<numEntries; ++k )
-            vBuf[k] /= recvVals[meta.colOffs[k]];
+            vBuf[k] /= recvVals[meta.ColOff(k)];
     }
 }
 
@@ -378,7 +378,7 @@ void SymmetricDiagonalSolve
     {
         const Int i = rBuf[k];
         const Int iLoc = i - firstLocalRow;
-        vBuf[k] /= recvVals[meta.colOffs[k]]*dBuf[iLoc];
+        vBuf[k] /= recvVals[meta.ColOff(k)]*dBuf[iLoc];
     }
 }
 
@@ -11,8 +11,12 @@
 
 namespace El {
 
-template<typename T>
-void EntrywiseMap( Matrix<T>& A, function<T(const T&)> func )
+// The overloads accepting an arbitrary callable can inline the function into
+// the traversal of the local data, whereas the std::function overloads are
+// explicitly instantiated (and forward to the former).
+
+template<typename T,typename Function>
+void EntrywiseMap( Matrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -22,10 +26,11 @@ void EntrywiseMap( Matrix<T>& A, function<T(const T&)> func )
 
     // Iterate over single loop if memory is contiguous. Otherwise
     // iterate over double loop.
-    if( ALDim == m )
+    if( ALDim == m || n == 1 )
     {
+        const Int size = m*n;
         EL_PARALLEL_FOR
-        for( Int i=0; i<m*n; ++i )
+        for( Int i=0; i<size; ++i )
         {
             ABuf[i] = func(ABuf[i]);
         }
@@ -35,17 +40,18 @@ void EntrywiseMap( Matrix<T>& A, function<T(const T&)> func )
         EL_PARALLEL_FOR
         for( Int j=0; j<n; ++j )
         {
+            T* EL_RESTRICT col = &ABuf[j*ALDim];
             EL_SIMD
             for( Int i=0; i<m; ++i )
             {
-                ABuf[i+j*ALDim] = func(ABuf[i+j*ALDim]);
+                col[i] = func(col[i]);
             }
         }
     }
 }
 
-template<typename T>
-void EntrywiseMap( SparseMatrix<T>& A, function<T(const T&)> func )
+template<typename T,typename Function>
+void EntrywiseMap( SparseMatrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     T* vBuf = A.ValueBuffer();
@@ -55,12 +61,12 @@ void EntrywiseMap( SparseMatrix<T>& A, function<T(const T&)> func )
         vBuf[k] = func(vBuf[k]);
 }
 
-template<typename T>
-void EntrywiseMap( AbstractDistMatrix<T>& A, function<T(const T&)> func )
+template<typename T,typename Function>
+void EntrywiseMap( AbstractDistMatrix<T>& A, Function func )
 { EntrywiseMap( A.Matrix(), func ); }
 
-template<typename T>
-void EntrywiseMap( DistSparseMatrix<T>& A, function<T(const T&)> func )
+template<typename T,typename Function>
+void EntrywiseMap( DistSparseMatrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     T* vBuf = A.ValueBuffer();
@@ -70,13 +76,12 @@ void EntrywiseMap( DistSparseMatrix<T>& A, function<T(const T&)> func )
         vBuf[k] = func(vBuf[k]);
 }
 
-template<typename T>
-void EntrywiseMap( DistMultiVec<T>& A, function<T(const T&)> func )
+template<typename T,typename Function>
+void EntrywiseMap( DistMultiVec<T>& A, Function func )
 { EntrywiseMap( A.Matrix(), func ); }
 
-template<typename S,typename T>
-void EntrywiseMap
-( const Matrix<S>& A, Matrix<T>& B, function<T(const S&)> func )
+template<typename S,typename T,typename Function>
+void EntrywiseMap( const Matrix<S>& A, Matrix<T>& B, Function func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -86,22 +91,36 @@ void EntrywiseMap
     T* BBuf = B.Buffer();
     const Int ALDim = A.LDim();
     const Int BLDim = B.LDim();
-    EL_PARALLEL_FOR
-    for( Int j=0; j<n; ++j )
+    if( (ALDim == m && BLDim == m) || n == 1 )
     {
-        EL_SIMD
-        for( Int i=0; i<m; ++i )
+        const Int size = m*n;
+        EL_PARALLEL_FOR
+        for( Int i=0; i<size; ++i )
         {
-            BBuf[i+j*BLDim] = func(ABuf[i+j*ALDim]);
+            BBuf[i] = func(ABuf[i]);
+        }
+    }
+    else
+    {
+        EL_PARALLEL_FOR
+        for( Int j=0; j<n; ++j )
+        {
+            const S* EL_RESTRICT ACol = &ABuf[j*ALDim];
+                  T* EL_RESTRICT BCol = &BBuf[j*BLDim];
+            EL_SIMD
+            for( Int i=0; i<m; ++i )
+            {
+                BCol[i] = func(ACol[i]);
+            }
         }
     }
 }
 
-template<typename S,typename T>
+template<typename S,typename T,typename Function>
 void EntrywiseMap
 ( const SparseMatrix<S>& A,
         SparseMatrix<T>& B,
-        function<T(const S&)> func )
+        Function func )
 {
     EL_DEBUG_CSE
     const Int numEntries = A.NumEntries();
@@ -114,11 +133,11 @@ void EntrywiseMap
         BValBuf[k] = func(AValBuf[k]);
 }
 
-template<typename S,typename T>
+template<typename S,typename T,typename Function>
 void EntrywiseMap
 ( const AbstractDistMatrix<S>& A,
         AbstractDistMatrix<T>& B,
-        function<T(const S&)> func )
+        Function func )
 {
     if( A.DistData().colDist == B.DistData().colDist &&
         A.DistData().rowDist == B.DistData().rowDist &&
@@ -145,11 +164,11 @@ void EntrywiseMap
     }
 }
 
-template<typename S,typename T>
+template<typename S,typename T,typename Function>
 void EntrywiseMap
 ( const DistSparseMatrix<S>& A,
         DistSparseMatrix<T>& B,
-        function<T(const S&)> func )
+        Function func )
 {
     EL_DEBUG_CSE
     const Int numLocalEntries = A.NumLocalEntries();
@@ -163,11 +182,11 @@ void EntrywiseMap
         BValBuf[k] = func(AValBuf[k]);
 }
 
-template<typename S,typename T>
+template<typename S,typename T,typename Function>
 void EntrywiseMap
 ( const DistMultiVec<S>& A,
         DistMultiVec<T>& B,
-        function<T(const S&)> func )
+        Function func )
 {
     EL_DEBUG_CSE
     B.SetGrid( A.Grid() );
@@ -175,6 +194,59 @@ void EntrywiseMap
     EntrywiseMap( A.LockedMatrix(), B.Matrix(), func );
 }
 
+template<typename T>
+void EntrywiseMap( Matrix<T>& A, function<T(const T&)> func )
+{ EntrywiseMap<T,function<T(const T&)>>( A, func ); }
+
+template<typename T>
+void EntrywiseMap( SparseMatrix<T>& A, function<T(const T&)> func )
+{ EntrywiseMap<T,function<T(const T&)>>( A, func ); }
+
+template<typename T>
+void EntrywiseMap( AbstractDistMatrix<T>& A, function<T(const T&)> func )
+{ EntrywiseMap<T,function<T(const T&)>>( A, func ); }
+
+template<typename T>
+void EntrywiseMap( DistSparseMatrix<T>& A, function<T(const T&)> func )
+{ EntrywiseMap<T,function<T(const T&)>>( A, func ); }
+
+template<typename T>
+void EntrywiseMap( DistMultiVec<T>& A, function<T(const T&)> func )
+{ EntrywiseMap<T,function<T(const T&)>>( A, func ); }
+
+template<typename S,typename T>
+void EntrywiseMap
+( const Matrix<S>& A, Matrix<T>& B, function<T(const S&)> func )
+{ EntrywiseMap<S,T,function<T(const S&)>>( A, B, func ); }
+
+template<typename S,typename T>
+void EntrywiseMap
+( const SparseMatrix<S>& A,
+        SparseMatrix<T>& B,
+        function<T(const S&)> func )
+{ EntrywiseMap<S,T,function<T(const S&)>>( A, B, func ); }
+
+template<typename S,typename T>
+void EntrywiseMap
+( const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B,
+        function<T(const S&)> func )
+{ EntrywiseMap<S,T,function<T(const S&)>>( A, B, func ); }
+
+template<typename S,typename T>
+void EntrywiseMap
+( const DistSparseMatrix<S>& A,
+        DistSparseMatrix<T>& B,
+        function<T(const S&)> func )
+{ EntrywiseMap<S,T,function<T(const S&)>>( A, B, func ); }
+
+template<typename S,typename T>
+void EntrywiseMap
+( const DistMultiVec<S>& A,
+        DistMultiVec<T>& B,
+        function<T(const S&)> func )
+{ EntrywiseMap<S,T,function<T(const S&)>>( A, B, func ); }
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -0,0 +1,190 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_FIXEDSIZE_HPP
+#define EL_BLAS_FIXEDSIZE_HPP
+
+namespace El {
+
+// Kernels for FixedMatrix
+// =======================
+// These are defined inline so that they may be fully unrolled into their
+// callers, which typically invoke them once per tiny block.
+
+template<typename T,Int M,Int N>
+void Zero( FixedMatrix<T,M,N>& A ) EL_NO_EXCEPT
+{
+    T* ABuf = A.Buffer();
+    for( Int k=0; k<M*N; ++k )
+        ABuf[k] = T(0);
+}
+
+template<typename T,Int M,Int N>
+void Scale( T alpha, FixedMatrix<T,M,N>& A ) EL_NO_EXCEPT
+{
+    T* ABuf = A.Buffer();
+    for( Int k=0; k<M*N; ++k )
+        ABuf[k] *= alpha;
+}
+
+// Y := alpha X + Y
+template<typename T,Int M,Int N>
+void Axpy
+( T alpha, const FixedMatrix<T,M,N>& X, FixedMatrix<T,M,N>& Y ) EL_NO_EXCEPT
+{
+    const T* XBuf = X.LockedBuffer();
+    T* YBuf = Y.Buffer();
+    for( Int k=0; k<M*N; ++k )
+        YBuf[k] += alpha*XBuf[k];
+}
+
+// B := A^T (or A^H)
+template<typename T,Int M,Int N>
+void Transpose
+( const FixedMatrix<T,M,N>& A, FixedMatrix<T,N,M>& B, bool conjugate=false )
+EL_NO_EXCEPT
+{
+    for( Int j=0; j<N; ++j )
+        for( Int i=0; i<M; ++i )
+            B(j,i) = ( conjugate ? Conj(A(i,j)) : A(i,j) );
+}
+
+template<typename T,Int M,Int N>
+void Adjoint( const FixedMatrix<T,M,N>& A, FixedMatrix<T,N,M>& B )
+EL_NO_EXCEPT
+{ Transpose( A, B, true ); }
+
+// C := alpha A B + beta C
+template<typename T,Int M,Int K,Int N>
+void Gemm
+( T alpha, const FixedMatrix<T,M,K>& A, const FixedMatrix<T,K,N>& B,
+  T beta,        FixedMatrix<T,M,N>& C ) EL_NO_EXCEPT
+{
+    for( Int j=0; j<N; ++j )
+    {
+        for( Int i=0; i<M; ++i )
+        {
+            T gamma = T(0);
+            for( Int k=0; k<K; ++k )
+                gamma += A(i,k)*B(k,j);
+            C(i,j) = alpha*gamma + beta*C(i,j);
+        }
+    }
+}
+
+// y := alpha A x + beta y
+template<typename T,Int M,Int N>
+void Gemv
+( T alpha, const FixedMatrix<T,M,N>& A, const FixedMatrix<T,N,1>& x,
+  T beta,        FixedMatrix<T,M,1>& y ) EL_NO_EXCEPT
+{ Gemm( alpha, A, x, beta, y ); }
+
+template<typename T,Int N>
+void MakeSymmetric
+( UpperOrLower uplo, FixedMatrix<T,N,N>& A, bool conjugate=false )
+EL_NO_EXCEPT
+{
+    for( Int j=0; j<N; ++j )
+    {
+        if( conjugate )
+            A(j,j) = RealPart(A(j,j));
+        for( Int i=j+1; i<N; ++i )
+        {
+            if( uplo == LOWER )
+                A(j,i) = ( conjugate ? Conj(A(i,j)) : A(i,j) );
+            else
+                A(i,j) = ( conjugate ? Conj(A(j,i)) : A(j,i) );
+        }
+    }
+}
+
+// Overwrite the lower triangle of the symmetric (or Hermitian) 2x2 matrix D
+// with that of its inverse. A 2x2 is only explicitly inverted when it is a
+// pivot of a Bunch-Kaufman-like factorization, in which case its
+// off-diagonal entry dominates and the following formulae are stable.
+template<typename Field>
+void Symmetric2x2Inv
+( UpperOrLower uplo, FixedMatrix<Field,2,2>& D, bool conjugate=false )
+{
+    typedef Base<Field> Real;
+    if( uplo != LOWER )
+        LogicError("This option not yet supported");
+    if( conjugate )
+    {
+        const Real delta11 = RealPart(D(0,0));
+        const Field delta21 = D(1,0);
+        const Real delta22 = RealPart(D(1,1));
+        const Real delta21Abs = SafeAbs( delta21 );
+        const Real phi21To11 = delta22 / delta21Abs;
+        const Real phi21To22 = delta11 / delta21Abs;
+        const Field phi21 = delta21 / delta21Abs;
+        const Real xi = (Real(1)/(phi21To11*phi21To22-Real(1)))/delta21Abs;
+
+        D(0,0) = xi*phi21To11;
+        D(1,0) = -xi*phi21;
+        D(1,1) = xi*phi21To22;
+    }
+    else
+    {
+        const Field delta11 = D(0,0);
+        const Field delta21 = D(1,0);
+        const Field delta22 = D(1,1);
+        const Field chi21To11 = -delta22 / delta21;
+        const Field chi21To22 = -delta11 / delta21;
+        const Field chi21 = (Field(1)/(Field(1)-chi21To11*chi21To22))/delta21;
+
+        D(0,0) = chi21*chi21To11;
+        D(1,0) = chi21;
+        D(1,1) = chi21*chi21To22;
+    }
+}
+
+// A([i1,i2],:) := G A([i1,i2],:)
+template<typename T>
+void Transform2x2Rows
+( const FixedMatrix<T,2,2>& G, Matrix<T>& A, Int i1, Int i2 )
+EL_NO_RELEASE_EXCEPT
+{
+    const T gamma11 = G(0,0), gamma12 = G(0,1);
+    const T gamma21 = G(1,0), gamma22 = G(1,1);
+    const Int n = A.Width();
+    const Int ALDim = A.LDim();
+    T* a1 = A.Buffer( i1, 0 );
+    T* a2 = A.Buffer( i2, 0 );
+    for( Int j=0; j<n; ++j )
+    {
+        const T alpha1 = a1[j*ALDim];
+        const T alpha2 = a2[j*ALDim];
+        a1[j*ALDim] = gamma11*alpha1 + gamma12*alpha2;
+        a2[j*ALDim] = gamma21*alpha1 + gamma22*alpha2;
+    }
+}
+
+// A(:,[j1,j2]) := A(:,[j1,j2]) G
+template<typename T>
+void Transform2x2Cols
+( const FixedMatrix<T,2,2>& G, Matrix<T>& A, Int j1, Int j2 )
+EL_NO_RELEASE_EXCEPT
+{
+    const T gamma11 = G(0,0), gamma12 = G(0,1);
+    const T gamma21 = G(1,0), gamma22 = G(1,1);
+    const Int m = A.Height();
+    T* a1 = A.Buffer( 0, j1 );
+    T* a2 = A.Buffer( 0, j2 );
+    for( Int i=0; i<m; ++i )
+    {
+        const T alpha1 = a1[i];
+        const T alpha2 = a2[i];
+        a1[i] = alpha1*gamma11 + alpha2*gamma21;
+        a2[i] = alpha1*gamma12 + alpha2*gamma22;
+    }
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_FIXEDSIZE_HPP
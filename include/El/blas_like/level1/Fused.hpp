@@ -0,0 +1,376 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_FUSED_HPP
+#define EL_BLAS_FUSED_HPP
+
+// Lazily-evaluated entrywise expressions
+// ======================================
+// A chain of entrywise operations, such as
+//
+//   Hadamard( x, y, z ); z *= alpha; Axpy( beta, w, z );
+//
+// makes a separate pass over memory for each call. Wrapping the operands
+// with 'Lazy' instead builds an expression which is evaluated in a single
+// pass, e.g.,
+//
+//   Evaluate( alpha*Lazy(x)*Lazy(y) + beta*Lazy(w), z );
+//
+// where the product of two expressions is entrywise and 'Map' applies an
+// arbitrary (inlinable) function to each entry. Distributed operands must
+// share a distribution (including alignments and grid) so that the
+// expression can be evaluated on the local data. The result may alias any of
+// the operands.
+
+namespace El {
+namespace lazy {
+
+template<typename Derived>
+class Expression
+{
+public:
+    const Derived& Get() const EL_NO_EXCEPT
+    { return static_cast<const Derived&>(*this); }
+};
+
+template<typename T>
+class Leaf : public Expression<Leaf<T>>
+{
+public:
+    typedef T Scalar;
+
+    Leaf( const Matrix<T>& A )
+    : buffer_(A.LockedBuffer()), ldim_(A.LDim()),
+      height_(A.Height()), width_(A.Width()),
+      localHeight_(A.Height()), localWidth_(A.Width())
+    { }
+    Leaf( const AbstractDistMatrix<T>& A )
+    : buffer_(A.LockedBuffer()), ldim_(A.LDim()),
+      height_(A.Height()), width_(A.Width()),
+      localHeight_(A.LocalHeight()), localWidth_(A.LocalWidth()),
+      distMatrix_(&A)
+    { }
+    Leaf( const DistMultiVec<T>& A )
+    : buffer_(A.LockedMatrix().LockedBuffer()), ldim_(A.LockedMatrix().LDim()),
+      height_(A.Height()), width_(A.Width()),
+      localHeight_(A.LocalHeight()), localWidth_(A.Width()),
+      multiVec_(&A)
+    { }
+
+    Int Height() const EL_NO_EXCEPT { return height_; }
+    Int Width() const EL_NO_EXCEPT { return width_; }
+    Int LocalHeight() const EL_NO_EXCEPT { return localHeight_; }
+    Int LocalWidth() const EL_NO_EXCEPT { return localWidth_; }
+    bool Contiguous() const EL_NO_EXCEPT
+    { return ldim_ == localHeight_ || localWidth_ <= 1; }
+
+    // The operand this leaf was formed from (at most one is non-null)
+    const AbstractDistMatrix<T>* DistOperand() const EL_NO_EXCEPT
+    { return distMatrix_; }
+    const El::DistMultiVec<T>* MultiVecOperand() const EL_NO_EXCEPT
+    { return multiVec_; }
+
+    template<typename Visitor>
+    void VisitLeaves( Visitor& visitor ) const { visitor( *this ); }
+
+    // Access to the local data
+    const T& operator()( Int iLoc, Int jLoc ) const EL_NO_EXCEPT
+    { return buffer_[iLoc+jLoc*ldim_]; }
+    const T& operator[]( Int index ) const EL_NO_EXCEPT
+    { return buffer_[index]; }
+
+private:
+    const T* buffer_;
+    Int ldim_;
+    Int height_, width_;
+    Int localHeight_, localWidth_;
+    const AbstractDistMatrix<T>* distMatrix_=nullptr;
+    const El::DistMultiVec<T>* multiVec_=nullptr;
+};
+
+// alpha op(A)
+template<typename Arg>
+class Scaled : public Expression<Scaled<Arg>>
+{
+public:
+    typedef typename Arg::Scalar Scalar;
+
+    Scaled( const Scalar& alpha, const Arg& arg )
+    : alpha_(alpha), arg_(arg) { }
+
+    Int Height() const EL_NO_EXCEPT { return arg_.Height(); }
+    Int Width() const EL_NO_EXCEPT { return arg_.Width(); }
+    Int LocalHeight() const EL_NO_EXCEPT { return arg_.LocalHeight(); }
+    Int LocalWidth() const EL_NO_EXCEPT { return arg_.LocalWidth(); }
+    bool Contiguous() const EL_NO_EXCEPT { return arg_.Contiguous(); }
+
+    template<typename Visitor>
+    void VisitLeaves( Visitor& visitor ) const { arg_.VisitLeaves( visitor ); }
+
+    Scalar operator()( Int iLoc, Int jLoc ) const
+    { return alpha_*arg_(iLoc,jLoc); }
+    Scalar operator[]( Int index ) const
+    { return alpha_*arg_[index]; }
+
+private:
+    Scalar alpha_;
+    Arg arg_;
+};
+
+// func(A(i,j))
+template<typename Arg,typename Function>
+class Mapped : public Expression<Mapped<Arg,Function>>
+{
+public:
+    typedef typename std::decay<
+      decltype(std::declval<Function>()
+                 (std::declval<typename Arg::Scalar>()))>::type Scalar;
+
+    Mapped( const Arg& arg, const Function& func )
+    : arg_(arg), func_(func) { }
+
+    Int Height() const EL_NO_EXCEPT { return arg_.Height(); }
+    Int Width() const EL_NO_EXCEPT { return arg_.Width(); }
+    Int LocalHeight() const EL_NO_EXCEPT { return arg_.LocalHeight(); }
+    Int LocalWidth() const EL_NO_EXCEPT { return arg_.LocalWidth(); }
+    bool Contiguous() const EL_NO_EXCEPT { return arg_.Contiguous(); }
+
+    template<typename Visitor>
+    void VisitLeaves( Visitor& visitor ) const { arg_.VisitLeaves( visitor ); }
+
+    Scalar operator()( Int iLoc, Int jLoc ) const
+    { return func_(arg_(iLoc,jLoc)); }
+    Scalar operator[]( Int index ) const
+    { return func_(arg_[index]); }
+
+private:
+    Arg arg_;
+    Function func_;
+};
+
+// op(A(i,j),B(i,j))
+template<typename Left,typename Right,typename Op>
+class Binary : public Expression<Binary<Left,Right,Op>>
+{
+public:
+    typedef typename Left::Scalar Scalar;
+    static_assert
+    ( std::is_same<Scalar,typename Right::Scalar>::value,
+      "Operands of an entrywise expression must share a scalar type" );
+
+    Binary( const Left& left, const Right& right )
+    : left_(left), right_(right)
+    {
+        if( left.Height() != right.Height() || left.Width() != right.Width() )
+            LogicError
+            ("Nonconformal ",left.Height()," x ",left.Width()," and ",
+             right.Height()," x ",right.Width()," entrywise operands");
+    }
+
+    Int Height() const EL_NO_EXCEPT { return left_.Height(); }
+    Int Width() const EL_NO_EXCEPT { return left_.Width(); }
+    Int LocalHeight() const EL_NO_EXCEPT { return left_.LocalHeight(); }
+    Int LocalWidth() const EL_NO_EXCEPT { return left_.LocalWidth(); }
+    bool Contiguous() const EL_NO_EXCEPT
+    { return left_.Contiguous() && right_.Contiguous(); }
+
+    template<typename Visitor>
+    void VisitLeaves( Visitor& visitor ) const
+    {
+        left_.VisitLeaves( visitor );
+        right_.VisitLeaves( visitor );
+    }
+
+    Scalar operator()( Int iLoc, Int jLoc ) const
+    { return Op::Apply( left_(iLoc,jLoc), right_(iLoc,jLoc) ); }
+    Scalar operator[]( Int index ) const
+    { return Op::Apply( left_[index], right_[index] ); }
+
+private:
+    Left left_;
+    Right right_;
+};
+
+struct Add
+{
+    template<typename T>
+    static T Apply( const T& alpha, const T& beta ) { return alpha + beta; }
+};
+struct Subtract
+{
+    template<typename T>
+    static T Apply( const T& alpha, const T& beta ) { return alpha - beta; }
+};
+struct Multiply
+{
+    template<typename T>
+    static T Apply( const T& alpha, const T& beta ) { return alpha * beta; }
+};
+struct Divide
+{
+    template<typename T>
+    static T Apply( const T& alpha, const T& beta ) { return alpha / beta; }
+};
+
+template<typename Left,typename Right>
+Binary<Left,Right,Add>
+operator+( const Expression<Left>& left, const Expression<Right>& right )
+{ return Binary<Left,Right,Add>( left.Get(), right.Get() ); }
+
+template<typename Left,typename Right>
+Binary<Left,Right,Subtract>
+operator-( const Expression<Left>& left, const Expression<Right>& right )
+{ return Binary<Left,Right,Subtract>( left.Get(), right.Get() ); }
+
+// NOTE: The product of two expressions is the Hadamard product
+template<typename Left,typename Right>
+Binary<Left,Right,Multiply>
+operator*( const Expression<Left>& left, const Expression<Right>& right )
+{ return Binary<Left,Right,Multiply>( left.Get(), right.Get() ); }
+
+template<typename Left,typename Right>
+Binary<Left,Right,Divide>
+operator/( const Expression<Left>& left, const Expression<Right>& right )
+{ return Binary<Left,Right,Divide>( left.Get(), right.Get() ); }
+
+template<typename Arg>
+Scaled<Arg>
+operator*( const typename Arg::Scalar& alpha, const Expression<Arg>& arg )
+{ return Scaled<Arg>( alpha, arg.Get() ); }
+
+template<typename Arg>
+Scaled<Arg>
+operator*( const Expression<Arg>& arg, const typename Arg::Scalar& alpha )
+{ return Scaled<Arg>( alpha, arg.Get() ); }
+
+template<typename Arg>
+Scaled<Arg>
+operator/( const Expression<Arg>& arg, const typename Arg::Scalar& alpha )
+{ return Scaled<Arg>( typename Arg::Scalar(1)/alpha, arg.Get() ); }
+
+template<typename Arg>
+Scaled<Arg> operator-( const Expression<Arg>& arg )
+{ return Scaled<Arg>( typename Arg::Scalar(-1), arg.Get() ); }
+
+template<typename Arg,typename Function>
+Mapped<Arg,Function> Map( const Expression<Arg>& arg, Function func )
+{ return Mapped<Arg,Function>( arg.Get(), func ); }
+
+// Overwrite the local matrix Z with the local entries of the expression
+template<typename T,typename Arg>
+void EvaluateLocal( const Arg& expr, Matrix<T>& Z )
+{
+    EL_DEBUG_CSE
+    const Int localHeight = expr.LocalHeight();
+    const Int localWidth = expr.LocalWidth();
+    EL_DEBUG_ONLY(
+      if( Z.Height() != localHeight || Z.Width() != localWidth )
+          LogicError("Local result was not conformal with the expression");
+    )
+    T* ZBuf = Z.Buffer();
+    const Int ZLDim = Z.LDim();
+    if( expr.Contiguous() && (ZLDim == localHeight || localWidth <= 1) )
+    {
+        const Int size = localHeight*localWidth;
+        EL_PARALLEL_FOR
+        for( Int index=0; index<size; ++index )
+            ZBuf[index] = expr[index];
+    }
+    else
+    {
+        EL_PARALLEL_FOR
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            EL_SIMD
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                ZBuf[iLoc+jLoc*ZLDim] = expr(iLoc,jLoc);
+        }
+    }
+}
+
+} // namespace lazy
+
+template<typename T>
+lazy::Leaf<T> Lazy( const Matrix<T>& A ) { return lazy::Leaf<T>(A); }
+template<typename T>
+lazy::Leaf<T> Lazy( const AbstractDistMatrix<T>& A )
+{ return lazy::Leaf<T>(A); }
+template<typename T>
+lazy::Leaf<T> Lazy( const DistMultiVec<T>& A ) { return lazy::Leaf<T>(A); }
+
+template<typename T,typename Arg>
+void Evaluate( const lazy::Expression<Arg>& exprPre, Matrix<T>& Z )
+{
+    EL_DEBUG_CSE
+    const Arg& expr = exprPre.Get();
+    EL_DEBUG_ONLY(
+      auto checkLeaf = []( const lazy::Leaf<T>& leaf )
+      {
+          if( leaf.DistOperand() != nullptr ||
+              leaf.MultiVecOperand() != nullptr )
+              LogicError("Cannot evaluate distributed operands into a Matrix");
+      };
+      expr.VisitLeaves( checkLeaf );
+    )
+    Z.Resize( expr.Height(), expr.Width() );
+    lazy::EvaluateLocal( expr, Z );
+}
+
+template<typename T,typename Arg>
+void Evaluate( const lazy::Expression<Arg>& exprPre, AbstractDistMatrix<T>& Z )
+{
+    EL_DEBUG_CSE
+    const Arg& expr = exprPre.Get();
+    const AbstractDistMatrix<T>* first = nullptr;
+    auto checkLeaf = [&]( const lazy::Leaf<T>& leaf )
+    {
+        auto A = leaf.DistOperand();
+        if( A == nullptr )
+            LogicError("Expected every operand to be an AbstractDistMatrix");
+        if( first == nullptr )
+            first = A;
+        else if( A->DistData() != first->DistData() )
+            LogicError("Entrywise operands must share the same distribution");
+    };
+    expr.VisitLeaves( checkLeaf );
+
+    const DistData distData = first->DistData();
+    Z.AlignWith( distData );
+    Z.Resize( expr.Height(), expr.Width() );
+    if( Z.DistData() != distData )
+        LogicError("The result must share the distribution of the operands");
+    lazy::EvaluateLocal( expr, Z.Matrix() );
+}
+
+template<typename T,typename Arg>
+void Evaluate( const lazy::Expression<Arg>& exprPre, DistMultiVec<T>& Z )
+{
+    EL_DEBUG_CSE
+    const Arg& expr = exprPre.Get();
+    const DistMultiVec<T>* first = nullptr;
+    auto checkLeaf = [&]( const lazy::Leaf<T>& leaf )
+    {
+        auto A = leaf.MultiVecOperand();
+        if( A == nullptr )
+            LogicError("Expected every operand to be a DistMultiVec");
+        if( first == nullptr )
+            first = A;
+        else if( A->Grid() != first->Grid() ||
+                 A->Blocksize() != first->Blocksize() )
+            LogicError("Entrywise operands must share the same distribution");
+    };
+    expr.VisitLeaves( checkLeaf );
+
+    Z.SetGrid( first->Grid() );
+    Z.Resize( expr.Height(), expr.Width() );
+    lazy::EvaluateLocal( expr, Z.Matrix() );
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_FUSED_HPP
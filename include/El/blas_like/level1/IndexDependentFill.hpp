@@ -11,8 +11,8 @@
 
 namespace El {
 
-template<typename T>
-void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func )
+template<typename T,typename Function>
+void IndexDependentFill( Matrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -35,36 +35,38 @@ void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func )
         EL_PARALLEL_FOR
         for( Int j=0; j<n; ++j )
         {
+            T* EL_RESTRICT col = &ABuf[j*ALDim];
             EL_SIMD
             for( Int i=0; i<m; ++i )
             {
-                ABuf[i+j*ALDim] = func(i,j);
+                col[i] = func(i,j);
             }
         }
     }
-
 }
 
-template<typename T>
-void IndexDependentFill
-( AbstractDistMatrix<T>& A, function<T(Int,Int)> func )
+template<typename T,typename Function>
+void IndexDependentFill( AbstractDistMatrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     const Int mLoc = A.LocalHeight();
     const Int nLoc = A.LocalWidth();
     T* ALocBuf = A.Buffer();
     const Int ALocLDim = A.LDim();
+    vector<Int> globalRows( mLoc );
+    for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        globalRows[iLoc] = A.GlobalRow(iLoc);
+    const Int* rowBuf = globalRows.data();
 
     // Use entry-wise parallelization for column vectors. Otherwise
     // use column-wise parallelization.
     if( nLoc == 1 )
     {
+        const Int j = A.GlobalCol(0);
         EL_PARALLEL_FOR
         for( Int iLoc=0; iLoc<mLoc; ++iLoc )
         {
-            const Int i = A.GlobalRow(iLoc);
-            const Int j = A.GlobalCol(0);
-            ALocBuf[iLoc] = func(i,j);
+            ALocBuf[iLoc] = func(rowBuf[iLoc],j);
         }
     }
     else
@@ -72,18 +74,47 @@ void IndexDependentFill
         EL_PARALLEL_FOR
         for( Int jLoc=0; jLoc<nLoc; ++jLoc )
         {
+            const Int j = A.GlobalCol(jLoc);
+            T* EL_RESTRICT col = &ALocBuf[jLoc*ALocLDim];
             EL_SIMD
             for( Int iLoc=0; iLoc<mLoc; ++iLoc )
             {
-                const Int i = A.GlobalRow(iLoc);
-                const Int j = A.GlobalCol(jLoc);
-                ALocBuf[iLoc+jLoc*ALocLDim] = func(i,j);
+                col[iLoc] = func(rowBuf[iLoc],j);
             }
         }
     }
+}
 
+template<typename T,typename Function>
+void IndexDependentFill( DistMultiVec<T>& A, Function func )
+{
+    EL_DEBUG_CSE
+    const Int localHeight = A.LocalHeight();
+    const Int width = A.Width();
+    const Int firstLocalRow = A.FirstLocalRow();
+    T* ALocBuf = A.Matrix().Buffer();
+    const Int ALocLDim = A.Matrix().LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<width; ++j )
+    {
+        T* EL_RESTRICT col = &ALocBuf[j*ALocLDim];
+        EL_SIMD
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            col[iLoc] = func(firstLocalRow+iLoc,j);
+        }
+    }
 }
 
+template<typename T>
+void IndexDependentFill( Matrix<T>& A, function<T(Int,Int)> func )
+{ IndexDependentFill<T,function<T(Int,Int)>>( A, func ); }
+
+template<typename T>
+void IndexDependentFill
+( AbstractDistMatrix<T>& A, function<T(Int,Int)> func )
+{ IndexDependentFill<T,function<T(Int,Int)>>( A, func ); }
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
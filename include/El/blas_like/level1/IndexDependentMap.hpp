@@ -11,8 +11,13 @@
 
 namespace El {
 
-template<typename T>
-void IndexDependentMap( Matrix<T>& A, function<T(Int,Int,const T&)> func )
+// As with EntrywiseMap, the overloads accepting an arbitrary callable allow
+// the function to be inlined, while the std::function overloads forward to
+// them. The global row indices of the local rows are computed once up front
+// rather than once per entry.
+
+template<typename T,typename Function>
+void IndexDependentMap( Matrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
@@ -35,36 +40,38 @@ void IndexDependentMap( Matrix<T>& A, function<T(Int,Int,const T&)> func )
         EL_PARALLEL_FOR
         for( Int j=0; j<n; ++j )
         {
+            T* EL_RESTRICT col = &ABuf[j*ALDim];
             EL_SIMD
             for( Int i=0; i<m; ++i )
             {
-                ABuf[i+j*ALDim] = func(i,j,ABuf[i+j*ALDim]);
+                col[i] = func(i,j,col[i]);
             }
         }
     }
-
 }
 
-template<typename T>
-void IndexDependentMap
-( AbstractDistMatrix<T>& A, function<T(Int,Int,const T&)> func )
+template<typename T,typename Function>
+void IndexDependentMap( AbstractDistMatrix<T>& A, Function func )
 {
     EL_DEBUG_CSE
     const Int mLoc = A.LocalHeight();
     const Int nLoc = A.LocalWidth();
     T* ALocBuf = A.Buffer();
     const Int ALocLDim = A.LDim();
+    vector<Int> globalRows( mLoc );
+    for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        globalRows[iLoc] = A.GlobalRow(iLoc);
+    const Int* rowBuf = globalRows.data();
 
     // Use entry-wise parallelization for column vectors. Otherwise
     // use column-wise parallelization.
     if( nLoc == 1 )
     {
+        const Int j = A.GlobalCol(0);
         EL_PARALLEL_FOR
         for( Int iLoc=0; iLoc<mLoc; ++iLoc )
         {
-            const Int i = A.GlobalRow(iLoc);
-            const Int j = A.GlobalCol(0);
-            ALocBuf[iLoc] = func(i,j,ALocBuf[iLoc]);
+            ALocBuf[iLoc] = func(rowBuf[iLoc],j,ALocBuf[iLoc]);
         }
     }
     else
@@ -72,27 +79,25 @@ void IndexDependentMap
         EL_PARALLEL_FOR
         for( Int jLoc=0; jLoc<nLoc; ++jLoc )
         {
+            const Int j = A.GlobalCol(jLoc);
+            T* EL_RESTRICT col = &ALocBuf[jLoc*ALocLDim];
             EL_SIMD
             for( Int iLoc=0; iLoc<mLoc; ++iLoc )
             {
-                const Int i = A.GlobalRow(iLoc);
-                const Int j = A.GlobalCol(jLoc);
-                ALocBuf[iLoc+jLoc*ALocLDim] = func(i,j,ALocBuf[iLoc+jLoc*ALocLDim]);
+                col[iLoc] = func(rowBuf[iLoc],j,col[iLoc]);
             }
         }
     }
-
 }
 
-template<typename S,typename T>
-void IndexDependentMap
-( const Matrix<S>& A, Matrix<T>& B, function<T(Int,Int,const S&)> func )
+template<typename S,typename T,typename Function>
+void IndexDependentMap( const Matrix<S>& A, Matrix<T>& B, Function func )
 {
     EL_DEBUG_CSE
     const Int m = A.Height();
     const Int n = A.Width();
     B.Resize( m, n );
-    const T* ABuf = A.LockedBuffer();
+    const S* ABuf = A.LockedBuffer();
     T* BBuf = B.Buffer();
     const Int ALDim = A.LDim();
     const Int BLDim = B.LDim();
@@ -112,42 +117,46 @@ void IndexDependentMap
         EL_PARALLEL_FOR
         for( Int j=0; j<n; ++j )
         {
+            const S* EL_RESTRICT ACol = &ABuf[j*ALDim];
+                  T* EL_RESTRICT BCol = &BBuf[j*BLDim];
             EL_SIMD
             for( Int i=0; i<m; ++i )
             {
-                BBuf[i+j*BLDim] = func(i,j,ABuf[i+j*ALDim]);
+                BCol[i] = func(i,j,ACol[i]);
             }
         }
     }
-
 }
 
-template<typename S,typename T,Dist U,Dist V,DistWrap wrap>
+template<typename S,typename T,Dist U,Dist V,DistWrap wrap,typename Function>
 void IndexDependentMap
 ( const DistMatrix<S,U,V,wrap>& A,
         DistMatrix<T,U,V,wrap>& B,
-  function<T(Int,Int,const S&)> func )
+  Function func )
 {
     EL_DEBUG_CSE
     const Int mLoc = A.LocalHeight();
     const Int nLoc = A.LocalWidth();
     B.AlignWith( A.DistData() );
     B.Resize( A.Height(), A.Width() );
-    const T* ALocBuf = A.LockedBuffer();
+    const S* ALocBuf = A.LockedBuffer();
     T* BLocBuf = B.Buffer();
     const Int ALocLDim = A.LDim();
     const Int BLocLDim = B.LDim();
+    vector<Int> globalRows( mLoc );
+    for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        globalRows[iLoc] = A.GlobalRow(iLoc);
+    const Int* rowBuf = globalRows.data();
 
     // Use entry-wise parallelization for column vectors. Otherwise
     // use column-wise parallelization.
     if( nLoc == 1 )
     {
+        const Int j = A.GlobalCol(0);
         EL_PARALLEL_FOR
         for( Int iLoc=0; iLoc<mLoc; ++iLoc )
         {
-            const Int i = A.GlobalRow(iLoc);
-            const Int j = A.GlobalCol(0);
-            BLocBuf[iLoc] = func(i,j,ALocBuf[iLoc]);
+            BLocBuf[iLoc] = func(rowBuf[iLoc],j,ALocBuf[iLoc]);
         }
     }
     else
@@ -155,28 +164,28 @@ void IndexDependentMap
         EL_PARALLEL_FOR
         for( Int jLoc=0; jLoc<nLoc; ++jLoc )
         {
+            const Int j = A.GlobalCol(jLoc);
+            const S* EL_RESTRICT ACol = &ALocBuf[jLoc*ALocLDim];
+                  T* EL_RESTRICT BCol = &BLocBuf[jLoc*BLocLDim];
             EL_SIMD
             for( Int iLoc=0; iLoc<mLoc; ++iLoc )
             {
-                const Int i = A.GlobalRow(iLoc);
-                const Int j = A.GlobalCol(jLoc);
-                BLocBuf[iLoc+jLoc*BLocLDim] = func(i,j,ALocBuf[iLoc+jLoc*ALocLDim]);
+                BCol[iLoc] = func(rowBuf[iLoc],j,ACol[iLoc]);
             }
         }
     }
-
 }
 
-template<typename S,typename T,Dist U,Dist V>
+template<typename S,typename T,Dist U,Dist V,typename Function>
 void IndexDependentMap
 ( const AbstractDistMatrix<S>& A,
         DistMatrix<T,U,V>& B,
-  function<T(Int,Int,const S&)> func )
+  Function func )
 {
     EL_DEBUG_CSE
     if( A.Wrap() == ELEMENT && A.DistData() == B.DistData() )
     {
-        auto& ACast = static_cast<const DistMatrix<T,U,V>&>(A);
+        auto& ACast = static_cast<const DistMatrix<S,U,V>&>(A);
         IndexDependentMap( ACast, B, func );
     }
     else
@@ -195,16 +204,16 @@ void IndexDependentMap
     }
 }
 
-template<typename S,typename T,Dist U,Dist V>
+template<typename S,typename T,Dist U,Dist V,typename Function>
 void IndexDependentMap
 ( const AbstractDistMatrix<S>& A,
         DistMatrix<T,U,V,BLOCK>& B,
-  function<T(Int,Int,const S&)> func )
+  Function func )
 {
     EL_DEBUG_CSE
     if( A.Wrap() == BLOCK && A.DistData() == B.DistData() )
     {
-        auto& ACast = static_cast<const DistMatrix<T,U,V,BLOCK>&>(A);
+        auto& ACast = static_cast<const DistMatrix<S,U,V,BLOCK>&>(A);
         IndexDependentMap( ACast, B, func );
     }
     else
@@ -227,6 +236,44 @@ void IndexDependentMap
     }
 }
 
+template<typename T>
+void IndexDependentMap( Matrix<T>& A, function<T(Int,Int,const T&)> func )
+{ IndexDependentMap<T,function<T(Int,Int,const T&)>>( A, func ); }
+
+template<typename T>
+void IndexDependentMap
+( AbstractDistMatrix<T>& A, function<T(Int,Int,const T&)> func )
+{ IndexDependentMap<T,function<T(Int,Int,const T&)>>( A, func ); }
+
+template<typename S,typename T>
+void IndexDependentMap
+( const Matrix<S>& A, Matrix<T>& B, function<T(Int,Int,const S&)> func )
+{ IndexDependentMap<S,T,function<T(Int,Int,const S&)>>( A, B, func ); }
+
+template<typename S,typename T,Dist U,Dist V,DistWrap wrap>
+void IndexDependentMap
+( const DistMatrix<S,U,V,wrap>& A,
+        DistMatrix<T,U,V,wrap>& B,
+  function<T(Int,Int,const S&)> func )
+{
+    IndexDependentMap<S,T,U,V,wrap,function<T(Int,Int,const S&)>>
+    ( A, B, func );
+}
+
+template<typename S,typename T,Dist U,Dist V>
+void IndexDependentMap
+( const AbstractDistMatrix<S>& A,
+        DistMatrix<T,U,V>& B,
+  function<T(Int,Int,const S&)> func )
+{ IndexDependentMap<S,T,U,V,function<T(Int,Int,const S&)>>( A, B, func ); }
+
+template<typename S,typename T,Dist U,Dist V>
+void IndexDependentMap
+( const AbstractDistMatrix<S>& A,
+        DistMatrix<T,U,V,BLOCK>& B,
+  function<T(Int,Int,const S&)> func )
+{ IndexDependentMap<S,T,U,V,function<T(Int,Int,const S&)>>( A, B, func ); }
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -26,7 +26,7 @@ QuasiDiagonalSolve
     const Int m = X.Height();
     const Int n = X.Width();
 
-    Matrix<Field> D( 2, 2 );
+    FixedMatrix<Field,2,2> D;
     if( side == LEFT && uplo == LOWER )
     {
         if( m == 0 )
@@ -165,7 +165,7 @@ LeftQuasiDiagonalSolve
         return;
     }
 
-    Matrix<Field> D11( 2, 2 );
+    FixedMatrix<Field,2,2> D11;
     for( Int iLoc=0; iLoc<mLocal; ++iLoc )
     {
         const Int i = X.GlobalRow(iLoc);
@@ -177,28 +177,28 @@ LeftQuasiDiagonalSolve
         if( i<m-1 && dSub.GetLocal(iLoc,0) != Field(0) )
         {
             // Handle 2x2 starting at i
-            D11.Set( 0, 0, d.GetLocal(iLoc,0) );
-            D11.Set( 1, 1, dNext.GetLocal(iLocNext,0) );
-            D11.Set( 1, 0, dSub.GetLocal(iLoc,0) );
+            D11(0,0) = d.GetLocal(iLoc,0);
+            D11(1,1) = dNext.GetLocal(iLocNext,0);
+            D11(1,0) = dSub.GetLocal(iLoc,0);
             Symmetric2x2Inv( LOWER, D11, conjugated );
             MakeSymmetric( LOWER, D11, conjugated );
 
             auto x1NextLoc = XNext.LockedMatrix()( IR(iLocNext), ALL );
-            Scale( D11.Get(0,0), x1Loc );
-            Axpy( D11.Get(0,1), x1NextLoc, x1Loc );
+            Scale( D11(0,0), x1Loc );
+            Axpy( D11(0,1), x1NextLoc, x1Loc );
         }
         else if( i>0 && dSubPrev.GetLocal(iLocPrev,0) != Field(0) )
         {
             // Handle 2x2 starting at i-1
-            D11.Set( 0, 0, dPrev.GetLocal(iLocPrev,0) );
-            D11.Set( 1, 1, d.GetLocal(iLoc,0) );
-            D11.Set( 1, 0, dSubPrev.GetLocal(iLocPrev,0) );
+            D11(0,0) = dPrev.GetLocal(iLocPrev,0);
+            D11(1,1) = d.GetLocal(iLoc,0);
+            D11(1,0) = dSubPrev.GetLocal(iLocPrev,0);
             Symmetric2x2Inv( LOWER, D11, conjugated );
             MakeSymmetric( LOWER, D11, conjugated );
 
             auto x1PrevLoc = XPrev.LockedMatrix()( IR(iLocPrev), ALL );
-            Scale( D11.Get(1,1), x1Loc );
-            Axpy( D11.Get(1,0), x1PrevLoc, x1Loc );
+            Scale( D11(1,1), x1Loc );
+            Axpy( D11(1,0), x1PrevLoc, x1Loc );
         }
         else
         {
@@ -257,7 +257,7 @@ RightQuasiDiagonalSolve
         return;
     }
 
-    Matrix<Field> D11( 2, 2 );
+    FixedMatrix<Field,2,2> D11;
     for( Int jLoc=0; jLoc<nLocal; ++jLoc )
     {
         const Int j = X.GlobalCol(jLoc);
@@ -269,28 +269,28 @@ RightQuasiDiagonalSolve
         if( j<n-1 && dSub.GetLocal(jLoc,0) != Field(0) )
         {
             // Handle 2x2 starting at j
-            D11.Set( 0, 0, d.GetLocal(jLoc,0) );
-            D11.Set( 1, 1, dNext.GetLocal(jLocNext,0) );
-            D11.Set( 1, 0, dSub.GetLocal(jLoc,0) );
+            D11(0,0) = d.GetLocal(jLoc,0);
+            D11(1,1) = dNext.GetLocal(jLocNext,0);
+            D11(1,0) = dSub.GetLocal(jLoc,0);
             Symmetric2x2Inv( LOWER, D11, conjugated );
             MakeSymmetric( LOWER, D11, conjugated );
 
             auto x1NextLoc = XNext.LockedMatrix()( ALL, IR(jLocNext) );
-            Scale( D11.Get(0,0), x1Loc );
-            Axpy( D11.Get(1,0), x1NextLoc, x1Loc );
+            Scale( D11(0,0), x1Loc );
+            Axpy( D11(1,0), x1NextLoc, x1Loc );
         }
         else if( j>0 && dSubPrev.GetLocal(jLocPrev,0) != Field(0) )
         {
             // Handle 2x2 starting at j-1
-            D11.Set( 0, 0, dPrev.GetLocal(jLocPrev,0) );
-            D11.Set( 1, 1, d.GetLocal(jLoc,0) );
-            D11.Set( 1, 0, dSubPrev.GetLocal(jLocPrev,0) );
+            D11(0,0) = dPrev.GetLocal(jLocPrev,0);
+            D11(1,1) = d.GetLocal(jLoc,0);
+            D11(1,0) = dSubPrev.GetLocal(jLocPrev,0);
             Symmetric2x2Inv( LOWER, D11, conjugated );
             MakeSymmetric( LOWER, D11, conjugated );
 
             auto x1PrevLoc = XPrev.LockedMatrix()( ALL, IR(jLocPrev) );
-            Scale( D11.Get(1,1), x1Loc );
-            Axpy( D11.Get(0,1), x1PrevLoc, x1Loc );
+            Scale( D11(1,1), x1Loc );
+            Axpy( D11(0,1), x1PrevLoc, x1Loc );
         }
         else
         {
@@ -27,14 +27,24 @@ void Reshape
          " did not preserve the total number of entries");
 
     B.Resize( mNew, nNew );
-    Zero( B );
+    if( A.LDim() == m || n <= 1 )
+    {
+        // Both A and B are stored contiguously in column-major order
+        MemCopy( B.Buffer(), A.LockedBuffer(), m*n );
+        return;
+    }
+    // Copy each column of A into its (possibly wrapped) location in B
+    const T* ABuf = A.LockedBuffer();
+          T* BBuf = B.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
     for( Int j=0; j<n; ++j )
     {
         for( Int i=0; i<m; ++i )
         {
             const Int iNew = (i+j*m) % mNew;
             const Int jNew = (i+j*m) / mNew;
-            B.Set( iNew, jNew, A.Get(i,j) );
+            BBuf[iNew+jNew*BLDim] = ABuf[i+j*ALDim];
         }
     }
 }
@@ -48,6 +58,71 @@ Matrix<T> Reshape( Int mNew, Int nNew, const Matrix<T>& A )
     return B;
 }
 
+// Since a column-major reshape does not move any entries, a matrix whose
+// columns are stored contiguously can be reshaped by attaching to its buffer
+template<typename T>
+void ReshapeView
+( Int mNew,
+  Int nNew,
+  Matrix<T>& A,
+  Matrix<T>& B )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m*n != mNew*nNew )
+        LogicError
+        ("Reshape from ",m," x ",n," to ",mNew," x ",nNew,
+         " did not preserve the total number of entries");
+    if( A.LDim() != m && n > 1 && m > 0 )
+        LogicError
+        ("Cannot view a reshape of a matrix with leading dimension ",
+         A.LDim()," and height ",m);
+    if( A.Locked() )
+        B.LockedAttach( mNew, nNew, A.LockedBuffer(), Max(mNew,Int(1)) );
+    else
+        B.Attach( mNew, nNew, A.Buffer(), Max(mNew,Int(1)) );
+}
+
+template<typename T>
+void LockedReshapeView
+(       Int mNew,
+        Int nNew,
+  const Matrix<T>& A,
+        Matrix<T>& B )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    if( m*n != mNew*nNew )
+        LogicError
+        ("Reshape from ",m," x ",n," to ",mNew," x ",nNew,
+         " did not preserve the total number of entries");
+    if( A.LDim() != m && n > 1 && m > 0 )
+        LogicError
+        ("Cannot view a reshape of a matrix with leading dimension ",
+         A.LDim()," and height ",m);
+    B.LockedAttach( mNew, nNew, A.LockedBuffer(), Max(mNew,Int(1)) );
+}
+
+template<typename T>
+Matrix<T> ReshapeView( Int mNew, Int nNew, Matrix<T>& A )
+{
+    EL_DEBUG_CSE
+    Matrix<T> B;
+    ReshapeView( mNew, nNew, A, B );
+    return B;
+}
+
+template<typename T>
+Matrix<T> LockedReshapeView( Int mNew, Int nNew, const Matrix<T>& A )
+{
+    EL_DEBUG_CSE
+    Matrix<T> B;
+    LockedReshapeView( mNew, nNew, A, B );
+    return B;
+}
+
 // TODO(poulson): Merge with implementation of GetSubmatrix via a function
 // which maps the coordinates in A to the coordinates in B
 template<typename T>
@@ -189,6 +264,20 @@ DistSparseMatrix<T> Reshape( Int mNew, Int nNew, const DistSparseMatrix<T>& A )
           Matrix<T>& B ); \
   EL_EXTERN template Matrix<T> Reshape \
   ( Int mNew, Int nNew, const Matrix<T>& A ); \
+  EL_EXTERN template void ReshapeView \
+  ( Int mNew, \
+    Int nNew, \
+    Matrix<T>& A, \
+    Matrix<T>& B ); \
+  EL_EXTERN template void LockedReshapeView \
+  (       Int mNew, \
+          Int nNew, \
+    const Matrix<T>& A, \
+          Matrix<T>& B ); \
+  EL_EXTERN template Matrix<T> ReshapeView \
+  ( Int mNew, Int nNew, Matrix<T>& A ); \
+  EL_EXTERN template Matrix<T> LockedReshapeView \
+  ( Int mNew, Int nNew, const Matrix<T>& A ); \
   EL_EXTERN template void Reshape \
   (       Int mNew, \
           Int nNew, \
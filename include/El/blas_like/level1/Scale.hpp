@@ -68,13 +68,26 @@ void Scale( S alphaS, Matrix<Real>& AReal, Matrix<Real>& AImag )
         }
         else
         {
+            // Update both parts in a single pass rather than through a copy
+            // of the real part and four separate sweeps
             const Real alphaReal=alpha.real(), alphaImag=alpha.imag();
-            Matrix<Real> ARealCopy;
-            Copy( AReal, ARealCopy );
-            Scale( alphaReal, AReal );
-            Axpy( -alphaImag, AImag, AReal );
-            Scale( alphaReal, AImag );
-            Axpy( alphaImag, ARealCopy, AImag );
+            Real* ARealBuf = AReal.Buffer();
+            Real* AImagBuf = AImag.Buffer();
+            const Int ARealLDim = AReal.LDim();
+            const Int AImagLDim = AImag.LDim();
+            EL_PARALLEL_FOR
+            for( Int j=0; j<n; ++j )
+            {
+                Real* EL_RESTRICT aReal = &ARealBuf[j*ARealLDim];
+                Real* EL_RESTRICT aImag = &AImagBuf[j*AImagLDim];
+                EL_SIMD
+                for( Int i=0; i<m; ++i )
+                {
+                    const Real real = alphaReal*aReal[i] - alphaImag*aImag[i];
+                    aImag[i] = alphaReal*aImag[i] + alphaImag*aReal[i];
+                    aReal[i] = real;
+                }
+            }
         }
     }
 }
@@ -0,0 +1,241 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_SPLITCOMPLEX_HPP
+#define EL_BLAS_SPLITCOMPLEX_HPP
+
+// Kernels over complex matrices stored as separate real and imaginary parts.
+// Each is a SIMD loop over the real arrays with the complex arithmetic
+// written out in real terms, which avoids both the strided accesses of the
+// interleaved format and the special-value handling of std::complex's
+// multiplication.
+
+namespace El {
+
+template<typename Real,typename>
+void SplitComplex
+( const Matrix<Complex<Real>>& A, Matrix<Real>& AReal, Matrix<Real>& AImag )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    AReal.Resize( m, n );
+    AImag.Resize( m, n );
+    const Complex<Real>* ABuf = A.LockedBuffer();
+    Real* ARealBuf = AReal.Buffer();
+    Real* AImagBuf = AImag.Buffer();
+    const Int ALDim = A.LDim();
+    const Int ARealLDim = AReal.LDim();
+    const Int AImagLDim = AImag.LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+    {
+        const Complex<Real>* EL_RESTRICT a = &ABuf[j*ALDim];
+        Real* EL_RESTRICT aReal = &ARealBuf[j*ARealLDim];
+        Real* EL_RESTRICT aImag = &AImagBuf[j*AImagLDim];
+        EL_SIMD
+        for( Int i=0; i<m; ++i )
+        {
+            aReal[i] = a[i].real();
+            aImag[i] = a[i].imag();
+        }
+    }
+}
+
+template<typename Real,typename>
+void MergeComplex
+( const Matrix<Real>& AReal, const Matrix<Real>& AImag,
+        Matrix<Complex<Real>>& A )
+{
+    EL_DEBUG_CSE
+    const Int m = AReal.Height();
+    const Int n = AReal.Width();
+    if( AImag.Height() != m || AImag.Width() != n )
+        LogicError("Real and imaginary parts must be the same size");
+    A.Resize( m, n );
+    const Real* ARealBuf = AReal.LockedBuffer();
+    const Real* AImagBuf = AImag.LockedBuffer();
+    Complex<Real>* ABuf = A.Buffer();
+    const Int ARealLDim = AReal.LDim();
+    const Int AImagLDim = AImag.LDim();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+    {
+        const Real* EL_RESTRICT aReal = &ARealBuf[j*ARealLDim];
+        const Real* EL_RESTRICT aImag = &AImagBuf[j*AImagLDim];
+        Complex<Real>* EL_RESTRICT a = &ABuf[j*ALDim];
+        EL_SIMD
+        for( Int i=0; i<m; ++i )
+            a[i] = Complex<Real>( aReal[i], aImag[i] );
+    }
+}
+
+// C(i,j) := A(i,j) B(i,j); C may be the same as A or B
+template<typename Real,typename>
+void Hadamard
+( const Matrix<Real>& AReal, const Matrix<Real>& AImag,
+  const Matrix<Real>& BReal, const Matrix<Real>& BImag,
+        Matrix<Real>& CReal,       Matrix<Real>& CImag )
+{
+    EL_DEBUG_CSE
+    const Int m = AReal.Height();
+    const Int n = AReal.Width();
+    if( AImag.Height() != m || AImag.Width() != n ||
+        BReal.Height() != m || BReal.Width() != n ||
+        BImag.Height() != m || BImag.Width() != n )
+        LogicError("Hadamard product requires equal dimensions");
+    CReal.Resize( m, n );
+    CImag.Resize( m, n );
+    const Real* ARealBuf = AReal.LockedBuffer();
+    const Real* AImagBuf = AImag.LockedBuffer();
+    const Real* BRealBuf = BReal.LockedBuffer();
+    const Real* BImagBuf = BImag.LockedBuffer();
+    Real* CRealBuf = CReal.Buffer();
+    Real* CImagBuf = CImag.Buffer();
+    const Int ARealLDim = AReal.LDim();
+    const Int AImagLDim = AImag.LDim();
+    const Int BRealLDim = BReal.LDim();
+    const Int BImagLDim = BImag.LDim();
+    const Int CRealLDim = CReal.LDim();
+    const Int CImagLDim = CImag.LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+    {
+        const Real* aReal = &ARealBuf[j*ARealLDim];
+        const Real* aImag = &AImagBuf[j*AImagLDim];
+        const Real* bReal = &BRealBuf[j*BRealLDim];
+        const Real* bImag = &BImagBuf[j*BImagLDim];
+        Real* cReal = &CRealBuf[j*CRealLDim];
+        Real* cImag = &CImagBuf[j*CImagLDim];
+        // The products are formed before either output is written so that
+        // C may alias A or B
+        EL_SIMD
+        for( Int i=0; i<m; ++i )
+        {
+            const Real real = aReal[i]*bReal[i] - aImag[i]*bImag[i];
+            const Real imag = aReal[i]*bImag[i] + aImag[i]*bReal[i];
+            cReal[i] = real;
+            cImag[i] = imag;
+        }
+    }
+}
+
+// Y := alpha X + Y
+template<typename Real,typename>
+void Axpy
+( const Complex<Real>& alpha,
+  const Matrix<Real>& XReal, const Matrix<Real>& XImag,
+        Matrix<Real>& YReal,       Matrix<Real>& YImag )
+{
+    EL_DEBUG_CSE
+    const Int m = XReal.Height();
+    const Int n = XReal.Width();
+    if( XImag.Height() != m || XImag.Width() != n ||
+        YReal.Height() != m || YReal.Width() != n ||
+        YImag.Height() != m || YImag.Width() != n )
+        LogicError("Nonconformal Axpy");
+    const Real alphaReal = alpha.real();
+    const Real alphaImag = alpha.imag();
+    const Real* XRealBuf = XReal.LockedBuffer();
+    const Real* XImagBuf = XImag.LockedBuffer();
+    Real* YRealBuf = YReal.Buffer();
+    Real* YImagBuf = YImag.Buffer();
+    const Int XRealLDim = XReal.LDim();
+    const Int XImagLDim = XImag.LDim();
+    const Int YRealLDim = YReal.LDim();
+    const Int YImagLDim = YImag.LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+    {
+        const Real* EL_RESTRICT xReal = &XRealBuf[j*XRealLDim];
+        const Real* EL_RESTRICT xImag = &XImagBuf[j*XImagLDim];
+        Real* EL_RESTRICT yReal = &YRealBuf[j*YRealLDim];
+        Real* EL_RESTRICT yImag = &YImagBuf[j*YImagLDim];
+        EL_SIMD
+        for( Int i=0; i<m; ++i )
+        {
+            yReal[i] += alphaReal*xReal[i] - alphaImag*xImag[i];
+            yImag[i] += alphaReal*xImag[i] + alphaImag*xReal[i];
+        }
+    }
+}
+
+// Return the inner product X^H Y
+template<typename Real,typename>
+Complex<Real> Dot
+( const Matrix<Real>& XReal, const Matrix<Real>& XImag,
+  const Matrix<Real>& YReal, const Matrix<Real>& YImag )
+{
+    EL_DEBUG_CSE
+    const Int m = XReal.Height();
+    const Int n = XReal.Width();
+    if( XImag.Height() != m || XImag.Width() != n ||
+        YReal.Height() != m || YReal.Width() != n ||
+        YImag.Height() != m || YImag.Width() != n )
+        LogicError("Nonconformal Dot");
+    const Real* XRealBuf = XReal.LockedBuffer();
+    const Real* XImagBuf = XImag.LockedBuffer();
+    const Real* YRealBuf = YReal.LockedBuffer();
+    const Real* YImagBuf = YImag.LockedBuffer();
+    Real real=0, imag=0;
+    for( Int j=0; j<n; ++j )
+    {
+        const Real* EL_RESTRICT xReal = &XRealBuf[j*XReal.LDim()];
+        const Real* EL_RESTRICT xImag = &XImagBuf[j*XImag.LDim()];
+        const Real* EL_RESTRICT yReal = &YRealBuf[j*YReal.LDim()];
+        const Real* EL_RESTRICT yImag = &YImagBuf[j*YImag.LDim()];
+        Real colReal=0, colImag=0;
+        EL_SIMD_REDUCTION(+:colReal,colImag)
+        for( Int i=0; i<m; ++i )
+        {
+            colReal += xReal[i]*yReal[i] + xImag[i]*yImag[i];
+            colImag += xReal[i]*yImag[i] - xImag[i]*yReal[i];
+        }
+        real += colReal;
+        imag += colImag;
+    }
+    return Complex<Real>( real, imag );
+}
+
+#ifdef EL_INSTANTIATE_BLAS_LEVEL1
+# define EL_EXTERN
+#else
+# define EL_EXTERN extern
+#endif
+
+#define PROTO(Real) \
+  EL_EXTERN template void SplitComplex \
+  ( const Matrix<Complex<Real>>& A, \
+          Matrix<Real>& AReal, \
+          Matrix<Real>& AImag ); \
+  EL_EXTERN template void MergeComplex \
+  ( const Matrix<Real>& AReal, \
+    const Matrix<Real>& AImag, \
+          Matrix<Complex<Real>>& A ); \
+  EL_EXTERN template void Hadamard \
+  ( const Matrix<Real>& AReal, const Matrix<Real>& AImag, \
+    const Matrix<Real>& BReal, const Matrix<Real>& BImag, \
+          Matrix<Real>& CReal,       Matrix<Real>& CImag ); \
+  EL_EXTERN template void Axpy \
+  ( const Complex<Real>& alpha, \
+    const Matrix<Real>& XReal, const Matrix<Real>& XImag, \
+          Matrix<Real>& YReal,       Matrix<Real>& YImag ); \
+  EL_EXTERN template Complex<Real> Dot \
+  ( const Matrix<Real>& XReal, const Matrix<Real>& XImag, \
+    const Matrix<Real>& YReal, const Matrix<Real>& YImag );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#include <El/macros/Instantiate.h>
+
+#undef EL_EXTERN
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_SPLITCOMPLEX_HPP
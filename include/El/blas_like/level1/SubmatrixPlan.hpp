@@ -0,0 +1,504 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_SUBMATRIXPLAN_HPP
+#define EL_BLAS_SUBMATRIXPLAN_HPP
+
+namespace El {
+
+// A replayable plan for transferring the submatrix A(I,J) of a distributed
+// matrix, for arbitrary row and column index sets I and J, into or out of a
+// distributed matrix ASub over the same grid.
+//
+// Rather than queueing one pull or update per entry, the plan derives (once
+// for each direction) the per-process send and receive counts from the index
+// sets and the layouts of A and ASub, and compresses the pack and unpack
+// maps into runs of locally-contiguous entries. Each transfer is then a
+// sequence of run copies around a single AllToAll. As in RedistPlan, no
+// metadata is transmitted, since both sides traverse the entries in
+// column-major order of their submatrix indices.
+//
+// If I or J contain duplicates, the value which Set stores into the repeated
+// entries of A is unspecified, whereas Update accumulates all of them.
+template<typename T>
+class SubmatrixPlan
+{
+public:
+    SubmatrixPlan();
+    SubmatrixPlan
+    ( const AbstractDistMatrix<T>& A,
+      const vector<Int>& I,
+      const vector<Int>& J,
+      const AbstractDistMatrix<T>& ASub );
+
+    // (Re)build the plan from the index sets and the current layouts of A and
+    // ASub, which must be of size |I| x |J|
+    void Setup
+    ( const AbstractDistMatrix<T>& A,
+      const vector<Int>& I,
+      const vector<Int>& J,
+      const AbstractDistMatrix<T>& ASub );
+
+    // Whether the index sets and the layouts of A and ASub agree with those
+    // the plan was built for
+    bool Matches
+    ( const AbstractDistMatrix<T>& A,
+      const vector<Int>& I,
+      const vector<Int>& J,
+      const AbstractDistMatrix<T>& ASub ) const;
+
+    // ASub := A(I,J)
+    void Get( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& ASub );
+    // A(I,J) := ASub
+    void Set( AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& ASub );
+    // A(I,J) := A(I,J) + alpha ASub
+    void Update
+    ( AbstractDistMatrix<T>& A, T alpha, const AbstractDistMatrix<T>& ASub );
+
+private:
+    // A run of 'length' entries stored contiguously in local column 'col'
+    // starting from local row 'row'
+    struct Run
+    {
+        Int row, col, length;
+    };
+
+    struct Pattern
+    {
+        bool built=false;
+        vector<Run> sendRuns, recvRuns;
+        // The counts exclude the self-interaction, which is copied locally
+        vector<int> sendCounts, sendOffs, recvCounts, recvOffs;
+        int selfCount=0, selfSendOff=0, selfRecvOff=0;
+        Int totalSend=0, totalRecv=0;
+    };
+
+    bool built_=false;
+    redist_plan::Layout<T> layoutA_, layoutSub_;
+    vector<Int> I_, J_;
+    Pattern getPattern_, setPattern_;
+    Memory<T> sendBuf_, recvBuf_;
+
+    void CheckLayouts
+    ( const AbstractDistMatrix<T>& A,
+      const AbstractDistMatrix<T>& ASub ) const;
+
+    // Build the pattern which sends the entries S(rowMapS[iSub],colMapS[jSub])
+    // to D(rowMapD[iSub],colMapD[jSub]), where a null map is the identity
+    void Build
+    ( const AbstractDistMatrix<T>& S,
+      const vector<Int>* rowMapS,
+      const vector<Int>* colMapS,
+      const AbstractDistMatrix<T>& D,
+      const vector<Int>* rowMapD,
+      const vector<Int>* colMapD,
+      Pattern& pattern ) const;
+
+    void Exchange( const Pattern& pattern, const AbstractDistMatrix<T>& S );
+    void Unpack
+    ( const Pattern& pattern, AbstractDistMatrix<T>& D,
+      bool update, T alpha ) const;
+};
+
+namespace submatrix_plan {
+
+inline Int Map( const vector<Int>* map, Int k ) EL_NO_EXCEPT
+{ return map == nullptr ? k : (*map)[k]; }
+
+} // namespace submatrix_plan
+
+template<typename T>
+SubmatrixPlan<T>::SubmatrixPlan() { }
+
+template<typename T>
+SubmatrixPlan<T>::SubmatrixPlan
+( const AbstractDistMatrix<T>& A,
+  const vector<Int>& I,
+  const vector<Int>& J,
+  const AbstractDistMatrix<T>& ASub )
+{ Setup( A, I, J, ASub ); }
+
+template<typename T>
+void SubmatrixPlan<T>::Setup
+( const AbstractDistMatrix<T>& A,
+  const vector<Int>& I,
+  const vector<Int>& J,
+  const AbstractDistMatrix<T>& ASub )
+{
+    EL_DEBUG_CSE
+    AssertSameGrids( A.Grid(), ASub.Grid() );
+    if( ASub.Height() != Int(I.size()) || ASub.Width() != Int(J.size()) )
+        LogicError
+        ("ASub was ",ASub.Height()," x ",ASub.Width()," rather than ",
+         I.size()," x ",J.size());
+    EL_DEBUG_ONLY(
+      for( const Int& i : I )
+          if( i < 0 || i >= A.Height() )
+              LogicError("Row index ",i," was out of bounds");
+      for( const Int& j : J )
+          if( j < 0 || j >= A.Width() )
+              LogicError("Column index ",j," was out of bounds");
+    )
+    layoutA_.Set( A );
+    layoutSub_.Set( ASub );
+    I_ = I;
+    J_ = J;
+    // The patterns for each direction are built upon their first use
+    getPattern_ = Pattern();
+    setPattern_ = Pattern();
+    built_ = true;
+}
+
+template<typename T>
+bool SubmatrixPlan<T>::Matches
+( const AbstractDistMatrix<T>& A,
+  const vector<Int>& I,
+  const vector<Int>& J,
+  const AbstractDistMatrix<T>& ASub ) const
+{
+    return built_ && layoutA_.Matches(A) && layoutSub_.Matches(ASub) &&
+           I_ == I && J_ == J;
+}
+
+template<typename T>
+void SubmatrixPlan<T>::CheckLayouts
+( const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& ASub ) const
+{
+    if( !built_ )
+        LogicError("SubmatrixPlan was not set up");
+    if( !layoutA_.Matches(A) )
+        LogicError("The layout of A does not match the SubmatrixPlan");
+    if( !layoutSub_.Matches(ASub) )
+        LogicError("The layout of ASub does not match the SubmatrixPlan");
+}
+
+template<typename T>
+void SubmatrixPlan<T>::Build
+( const AbstractDistMatrix<T>& S,
+  const vector<Int>* rowMapS,
+  const vector<Int>* colMapS,
+  const AbstractDistMatrix<T>& D,
+  const vector<Int>* rowMapD,
+  const vector<Int>* colMapD,
+        Pattern& pattern ) const
+{
+    EL_DEBUG_CSE
+    using submatrix_plan::Map;
+    const El::Grid& g = S.Grid();
+    pattern.built = true;
+    if( !g.InGrid() )
+        return;
+    const int commSize = g.VCSize();
+    const int commRank = g.VCRank();
+    const Int mSub = I_.size();
+    const Int nSub = J_.size();
+
+    // Traverse the submatrix entries we are responsible for sending
+    // =============================================================
+    // Each entry is sent from the zero redundant rank of S to every copy of
+    // its destination in D
+    vector<int> sendCounts( commSize, 0 );
+    vector<Int> rowsS, colsS;
+    vector<int> rowOwnersD, colOwnersD, distToVCD;
+    const Int redundantSizeD = D.RedundantSize();
+    const int colStrideD = D.ColStride();
+    if( S.Participating() && S.RedundantRank() == 0 )
+    {
+        for( Int iSub=0; iSub<mSub; ++iSub )
+        {
+            const Int i = Map( rowMapS, iSub );
+            if( S.IsLocalRow(i) )
+            {
+                rowsS.push_back( S.LocalRow(i) );
+                rowOwnersD.push_back( D.RowOwner(Map(rowMapD,iSub)) );
+            }
+        }
+        for( Int jSub=0; jSub<nSub; ++jSub )
+        {
+            const Int j = Map( colMapS, jSub );
+            if( S.IsLocalCol(j) )
+            {
+                colsS.push_back( S.LocalCol(j) );
+                colOwnersD.push_back( D.ColOwner(Map(colMapD,jSub)) );
+            }
+        }
+
+        const int distSizeD = D.DistSize();
+        distToVCD.resize( distSizeD*redundantSizeD );
+        for( int distRank=0; distRank<distSizeD; ++distRank )
+            for( Int r=0; r<redundantSizeD; ++r )
+                distToVCD[distRank*redundantSizeD+r] =
+                  g.CoordsToVC
+                  ( D.ColDist(), D.RowDist(), distRank, D.Root(), r );
+
+        for( const int& colOwner : colOwnersD )
+            for( const int& rowOwner : rowOwnersD )
+            {
+                const int distRank = rowOwner + colStrideD*colOwner;
+                for( Int r=0; r<redundantSizeD; ++r )
+                    ++sendCounts[distToVCD[distRank*redundantSizeD+r]];
+            }
+    }
+    pattern.totalSend = Scan( sendCounts, pattern.sendOffs );
+    vector<Int> sendRows( pattern.totalSend ), sendCols( pattern.totalSend );
+    {
+        auto offs = pattern.sendOffs;
+        const Int numLocalColsS = colsS.size();
+        const Int numLocalRowsS = rowsS.size();
+        for( Int jj=0; jj<numLocalColsS; ++jj )
+            for( Int ii=0; ii<numLocalRowsS; ++ii )
+            {
+                const int distRank = rowOwnersD[ii] + colStrideD*colOwnersD[jj];
+                for( Int r=0; r<redundantSizeD; ++r )
+                {
+                    const int q = distToVCD[distRank*redundantSizeD+r];
+                    const int slot = offs[q]++;
+                    sendRows[slot] = rowsS[ii];
+                    sendCols[slot] = colsS[jj];
+                }
+            }
+    }
+
+    // Traverse the submatrix entries we will receive
+    // ==============================================
+    vector<int> recvCounts( commSize, 0 );
+    vector<Int> rowsD, colsD;
+    vector<int> rowOwnersS, colOwnersS, distToVCS;
+    const int colStrideS = S.ColStride();
+    if( D.Participating() )
+    {
+        for( Int iSub=0; iSub<mSub; ++iSub )
+        {
+            const Int i = Map( rowMapD, iSub );
+            if( D.IsLocalRow(i) )
+            {
+                rowsD.push_back( D.LocalRow(i) );
+                rowOwnersS.push_back( S.RowOwner(Map(rowMapS,iSub)) );
+            }
+        }
+        for( Int jSub=0; jSub<nSub; ++jSub )
+        {
+            const Int j = Map( colMapD, jSub );
+            if( D.IsLocalCol(j) )
+            {
+                colsD.push_back( D.LocalCol(j) );
+                colOwnersS.push_back( S.ColOwner(Map(colMapS,jSub)) );
+            }
+        }
+
+        const int distSizeS = S.DistSize();
+        distToVCS.resize( distSizeS );
+        for( int distRank=0; distRank<distSizeS; ++distRank )
+            distToVCS[distRank] =
+              g.CoordsToVC( S.ColDist(), S.RowDist(), distRank, S.Root(), 0 );
+
+        for( const int& colOwner : colOwnersS )
+            for( const int& rowOwner : rowOwnersS )
+                ++recvCounts[distToVCS[rowOwner+colStrideS*colOwner]];
+    }
+    pattern.totalRecv = Scan( recvCounts, pattern.recvOffs );
+    vector<Int> recvRows( pattern.totalRecv ), recvCols( pattern.totalRecv );
+    {
+        auto offs = pattern.recvOffs;
+        const Int numLocalColsD = colsD.size();
+        const Int numLocalRowsD = rowsD.size();
+        for( Int jj=0; jj<numLocalColsD; ++jj )
+            for( Int ii=0; ii<numLocalRowsD; ++ii )
+            {
+                const int q =
+                  distToVCS[rowOwnersS[ii]+colStrideS*colOwnersS[jj]];
+                const int slot = offs[q]++;
+                recvRows[slot] = rowsD[ii];
+                recvCols[slot] = colsD[jj];
+            }
+    }
+
+    // Compress the pack and unpack maps into contiguous runs
+    // ======================================================
+    // Runs may span the boundaries between processes since the buffers are
+    // traversed sequentially
+    auto compress = []
+      ( const vector<Int>& rows, const vector<Int>& cols, vector<Run>& runs )
+    {
+        runs.clear();
+        const Int numEntries = rows.size();
+        for( Int k=0; k<numEntries; ++k )
+        {
+            if( !runs.empty() )
+            {
+                Run& run = runs.back();
+                if( cols[k] == run.col && rows[k] == run.row+run.length )
+                {
+                    ++run.length;
+                    continue;
+                }
+            }
+            runs.push_back( Run{rows[k],cols[k],1} );
+        }
+    };
+    compress( sendRows, sendCols, pattern.sendRuns );
+    compress( recvRows, recvCols, pattern.recvRuns );
+
+    EL_DEBUG_ONLY(
+      if( sendCounts[commRank] != recvCounts[commRank] )
+          LogicError("Inconsistent self-interaction in SubmatrixPlan");
+    )
+    pattern.selfCount = sendCounts[commRank];
+    pattern.selfSendOff = pattern.sendOffs[commRank];
+    pattern.selfRecvOff = pattern.recvOffs[commRank];
+    sendCounts[commRank] = 0;
+    recvCounts[commRank] = 0;
+    pattern.sendCounts = sendCounts;
+    pattern.recvCounts = recvCounts;
+}
+
+template<typename T>
+void SubmatrixPlan<T>::Exchange
+( const Pattern& pattern, const AbstractDistMatrix<T>& S )
+{
+    EL_DEBUG_CSE
+    sendBuf_.Require( pattern.totalSend );
+    recvBuf_.Require( pattern.totalRecv );
+    T* sendBuf = sendBuf_.Buffer();
+    T* recvBuf = recvBuf_.Buffer();
+
+    // Pack
+    const T* SBuf = S.LockedBuffer();
+    const Int SLDim = S.LDim();
+    Int off = 0;
+    for( const Run& run : pattern.sendRuns )
+    {
+        MemCopy( &sendBuf[off], &SBuf[run.row+run.col*SLDim], run.length );
+        off += run.length;
+    }
+
+    mpi::AllToAll
+    ( sendBuf, pattern.sendCounts.data(), pattern.sendOffs.data(),
+      recvBuf, pattern.recvCounts.data(), pattern.recvOffs.data(),
+      S.Grid().VCComm() );
+    MemCopy
+    ( &recvBuf[pattern.selfRecvOff], &sendBuf[pattern.selfSendOff],
+      pattern.selfCount );
+}
+
+template<typename T>
+void SubmatrixPlan<T>::Unpack
+( const Pattern& pattern, AbstractDistMatrix<T>& D,
+  bool update, T alpha ) const
+{
+    EL_DEBUG_CSE
+    T* DBuf = D.Buffer();
+    const Int DLDim = D.LDim();
+    const T* recvBuf = recvBuf_.Buffer();
+    Int off = 0;
+    for( const Run& run : pattern.recvRuns )
+    {
+        T* DCol = &DBuf[run.row+run.col*DLDim];
+        if( update )
+            for( Int k=0; k<run.length; ++k )
+                DCol[k] += alpha*recvBuf[off+k];
+        else
+            MemCopy( DCol, &recvBuf[off], run.length );
+        off += run.length;
+    }
+}
+
+template<typename T>
+void SubmatrixPlan<T>::Get
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& ASub )
+{
+    EL_DEBUG_CSE
+    CheckLayouts( A, ASub );
+    if( !A.Grid().InGrid() )
+        return;
+    if( !getPattern_.built )
+        Build( A, &I_, &J_, ASub, nullptr, nullptr, getPattern_ );
+    Exchange( getPattern_, A );
+    Unpack( getPattern_, ASub, false, T(1) );
+}
+
+template<typename T>
+void SubmatrixPlan<T>::Set
+( AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& ASub )
+{
+    EL_DEBUG_CSE
+    CheckLayouts( A, ASub );
+    if( !A.Grid().InGrid() )
+        return;
+    if( !setPattern_.built )
+        Build( ASub, nullptr, nullptr, A, &I_, &J_, setPattern_ );
+    Exchange( setPattern_, ASub );
+    Unpack( setPattern_, A, false, T(1) );
+}
+
+template<typename T>
+void SubmatrixPlan<T>::Update
+( AbstractDistMatrix<T>& A, T alpha, const AbstractDistMatrix<T>& ASub )
+{
+    EL_DEBUG_CSE
+    CheckLayouts( A, ASub );
+    if( !A.Grid().InGrid() )
+        return;
+    if( !setPattern_.built )
+        Build( ASub, nullptr, nullptr, A, &I_, &J_, setPattern_ );
+    Exchange( setPattern_, ASub );
+    Unpack( setPattern_, A, true, alpha );
+}
+
+// Versions of the non-contiguous distributed submatrix routines which replay
+// a cached plan, which is (re)built whenever the index sets or the layouts
+// no longer match it
+template<typename T>
+void GetSubmatrix
+( const AbstractDistMatrix<T>& A,
+  const vector<Int>& I,
+  const vector<Int>& J,
+        AbstractDistMatrix<T>& ASub,
+        SubmatrixPlan<T>& plan )
+{
+    EL_DEBUG_CSE
+    ASub.SetGrid( A.Grid() );
+    ASub.Resize( I.size(), J.size() );
+    if( !plan.Matches( A, I, J, ASub ) )
+        plan.Setup( A, I, J, ASub );
+    plan.Get( A, ASub );
+}
+
+template<typename T>
+void SetSubmatrix
+(       AbstractDistMatrix<T>& A,
+  const vector<Int>& I,
+  const vector<Int>& J,
+  const AbstractDistMatrix<T>& ASub,
+        SubmatrixPlan<T>& plan )
+{
+    EL_DEBUG_CSE
+    if( !plan.Matches( A, I, J, ASub ) )
+        plan.Setup( A, I, J, ASub );
+    plan.Set( A, ASub );
+}
+
+template<typename T>
+void UpdateSubmatrix
+(       AbstractDistMatrix<T>& A,
+  const vector<Int>& I,
+  const vector<Int>& J,
+        T alpha,
+  const AbstractDistMatrix<T>& ASub,
+        SubmatrixPlan<T>& plan )
+{
+    EL_DEBUG_CSE
+    if( !plan.Matches( A, I, J, ASub ) )
+        plan.Setup( A, I, J, ASub );
+    plan.Update( A, alpha, ASub );
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_SUBMATRIXPLAN_HPP
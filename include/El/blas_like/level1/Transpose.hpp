@@ -67,6 +67,11 @@ void PartialColAllGather
 ( const BlockMatrix<T>& A,
         BlockMatrix<T>& B, bool conjugate );
 
+template<typename T,Dist U,Dist V>
+void VectorTransposeDist
+( const DistMatrix<T,U,V>& A,
+        DistMatrix<T,U,V>& B, bool conjugate );
+
 } // namespace transpose
 
 template<typename T>
@@ -180,6 +185,24 @@ void Transpose
     {
         transpose::ColAllGather( A, B, conjugate );
     }
+    else if( (A.Height() == 1 || A.Width() == 1) &&
+             AData.colDist == BData.colDist &&
+             AData.rowDist == BData.rowDist &&
+             AData.colDist == MC && AData.rowDist == MR )
+    {
+        transpose::VectorTransposeDist
+        ( static_cast<const DistMatrix<T,MC,MR>&>(A),
+          static_cast<      DistMatrix<T,MC,MR>&>(B), conjugate );
+    }
+    else if( (A.Height() == 1 || A.Width() == 1) &&
+             AData.colDist == BData.colDist &&
+             AData.rowDist == BData.rowDist &&
+             AData.colDist == MR && AData.rowDist == MC )
+    {
+        transpose::VectorTransposeDist
+        ( static_cast<const DistMatrix<T,MR,MC>&>(A),
+          static_cast<      DistMatrix<T,MR,MC>&>(B), conjugate );
+    }
     else
     {
         unique_ptr<ElementalMatrix<T>>
@@ -413,5 +436,6 @@ void Adjoint( const DistSparseMatrix<T>& A, DistSparseMatrix<T>& B )
 #include <El/blas_like/level1/Transpose/PartialColFilter.hpp>
 #include <El/blas_like/level1/Transpose/PartialRowFilter.hpp>
 #include <El/blas_like/level1/Transpose/RowFilter.hpp>
+#include <El/blas_like/level1/Transpose/VectorTransposeDist.hpp>
 
 #endif // ifndef EL_BLAS_TRANSPOSE_HPP
@@ -0,0 +1,60 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_TRANSPOSE_VECTORTRANSPOSEDIST_HPP
+#define EL_BLAS_TRANSPOSE_VECTORTRANSPOSEDIST_HPP
+
+namespace El {
+namespace transpose {
+
+// (U,V) |-> (U,V) for vectors
+//
+// The local data of the transpose of a vector A[U,V] is a reshape of the
+// local data of A, so it can be viewed as A^T[V,U] without any data movement
+// and then redistributed directly into B via copy::TransposeDist (rather than
+// through an intermediate [V,U] copy followed by a local transpose).
+template<typename T,Dist U,Dist V>
+void VectorTransposeDist
+( const DistMatrix<T,U,V>& A,
+        DistMatrix<T,U,V>& B, bool conjugate )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, B );
+      if( A.Height() != 1 && A.Width() != 1 )
+          LogicError("Expected a vector");
+    )
+    const Grid& g = A.Grid();
+    const Matrix<T>& ALoc = A.LockedMatrix();
+    const Int localHeight = ALoc.Height();
+    const Int localWidth = ALoc.Width();
+
+    // A row vector viewed from a larger matrix has a non-unit leading
+    // dimension, in which case its (small) local data is first packed
+    const bool contiguous =
+      ALoc.LDim() == localHeight || localWidth <= 1 || localHeight == 0;
+    Matrix<T> AContig;
+    if( !contiguous )
+        Copy( ALoc, AContig );
+    const Matrix<T>& AContigLoc = ( contiguous ? ALoc : AContig );
+
+    Matrix<T> ATLoc;
+    LockedReshapeView( localWidth, localHeight, AContigLoc, ATLoc );
+    DistMatrix<T,V,U> AT(g);
+    AT.LockedAttach
+    ( A.Width(), A.Height(), g, A.RowAlign(), A.ColAlign(), ATLoc, A.Root() );
+
+    copy::TransposeDist( AT, B );
+    if( conjugate )
+        Conjugate( B.Matrix() );
+}
+
+} // namespace transpose
+} // namespace El
+
+#endif // ifndef EL_BLAS_TRANSPOSE_VECTORTRANSPOSEDIST_HPP
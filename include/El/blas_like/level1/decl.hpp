@@ -103,6 +103,13 @@ void Axpy
 template<typename Ring1,typename Ring2>
 void Axpy
 ( Ring2 alpha, const DistSparseMatrix<Ring1>& X, DistSparseMatrix<Ring1>& Y );
+template<typename Ring1,typename Ring2>
+void Axpy
+( Ring2 alpha, const OrientedView<Matrix<Ring1>>& X, Matrix<Ring1>& Y );
+template<typename Ring1,typename Ring2>
+void Axpy
+( Ring2 alpha, const OrientedView<ElementalMatrix<Ring1>>& X,
+                     ElementalMatrix<Ring1>& Y );
 
 namespace axpy {
 namespace util {
@@ -824,6 +831,15 @@ void EntrywiseFill( AbstractDistMatrix<T>& A, function<T(void)> func );
 template<typename T>
 void EntrywiseFill( DistMultiVec<T>& A, function<T(void)> func );
 
+// The following overloads accept arbitrary callables so that they may be
+// inlined
+template<typename T,typename Function>
+void EntrywiseFill( Matrix<T>& A, Function func );
+template<typename T,typename Function>
+void EntrywiseFill( AbstractDistMatrix<T>& A, Function func );
+template<typename T,typename Function>
+void EntrywiseFill( DistMultiVec<T>& A, Function func );
+
 // EntrywiseMap
 // ============
 template<typename T>
@@ -856,6 +872,55 @@ void EntrywiseMap
 ( const DistMultiVec<S>& A, DistMultiVec<T>& B,
   function<T(const S&)> func );
 
+// The following overloads accept arbitrary callables so that they may be
+// inlined
+template<typename T,typename Function>
+void EntrywiseMap( Matrix<T>& A, Function func );
+template<typename T,typename Function>
+void EntrywiseMap( SparseMatrix<T>& A, Function func );
+template<typename T,typename Function>
+void EntrywiseMap( AbstractDistMatrix<T>& A, Function func );
+template<typename T,typename Function>
+void EntrywiseMap( DistSparseMatrix<T>& A, Function func );
+template<typename T,typename Function>
+void EntrywiseMap( DistMultiVec<T>& A, Function func );
+
+template<typename S,typename T,typename Function>
+void EntrywiseMap( const Matrix<S>& A, Matrix<T>& B, Function func );
+template<typename S,typename T,typename Function>
+void EntrywiseMap
+( const SparseMatrix<S>& A, SparseMatrix<T>& B, Function func );
+template<typename S,typename T,typename Function>
+void EntrywiseMap
+( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B, Function func );
+template<typename S,typename T,typename Function>
+void EntrywiseMap
+( const DistSparseMatrix<S>& A, DistSparseMatrix<T>& B, Function func );
+template<typename S,typename T,typename Function>
+void EntrywiseMap
+( const DistMultiVec<S>& A, DistMultiVec<T>& B, Function func );
+
+// FFT
+// ===
+// Overwrite each column of X with its unitary discrete Fourier transform,
+//
+//   x(k) := sum_j x(j) exp(-2 pi i j k / n) / sqrt(n),
+//
+// i.e., X := F X (or X := F^H X) for the matrix F formed by 'Fourier'.
+// Lengths which are powers of two use an iterative radix-2 algorithm and
+// other lengths use Bluestein's algorithm, so that each column requires
+// O(n log n) work.
+//
+// The DistMultiVec version factors n = n1 n2 with n1 <= n2 as balanced as
+// possible and uses the "four-step" algorithm: the length-n2 transforms and
+// the length-n1 transforms are each local after an all-to-all exchange, and
+// so three exchanges are required. When n is prime, the transform is
+// performed by the owner of the first row.
+template<typename Real>
+void FFT( Matrix<Complex<Real>>& X, bool adjoint=false );
+template<typename Real>
+void FFT( DistMultiVec<Complex<Real>>& X, bool adjoint=false );
+
 // Fill
 // ====
 template<typename T>
@@ -1192,6 +1257,15 @@ template<typename T>
 void IndexDependentFill
 ( AbstractDistMatrix<T>& A, function<T(Int,Int)> func );
 
+// The following overloads accept arbitrary callables so that they may be
+// inlined
+template<typename T,typename Function>
+void IndexDependentFill( Matrix<T>& A, Function func );
+template<typename T,typename Function>
+void IndexDependentFill( AbstractDistMatrix<T>& A, Function func );
+template<typename T,typename Function>
+void IndexDependentFill( DistMultiVec<T>& A, Function func );
+
 // IndexDependentMap
 // =================
 template<typename T>
@@ -1221,6 +1295,31 @@ void IndexDependentMap
         DistMatrix<T,U,V,BLOCK>& B,
         function<T(Int,Int,const S&)> func );
 
+// The following overloads accept arbitrary callables so that they may be
+// inlined
+template<typename T,typename Function>
+void IndexDependentMap( Matrix<T>& A, Function func );
+template<typename T,typename Function>
+void IndexDependentMap( AbstractDistMatrix<T>& A, Function func );
+
+template<typename S,typename T,typename Function>
+void IndexDependentMap( const Matrix<S>& A, Matrix<T>& B, Function func );
+template<typename S,typename T,Dist U,Dist V,DistWrap wrap,typename Function>
+void IndexDependentMap
+( const DistMatrix<S,U,V,wrap>& A,
+        DistMatrix<T,U,V,wrap>& B,
+        Function func );
+template<typename S,typename T,Dist U,Dist V,typename Function>
+void IndexDependentMap
+( const AbstractDistMatrix<S>& A,
+        DistMatrix<T,U,V>& B,
+        Function func );
+template<typename S,typename T,Dist U,Dist V,typename Function>
+void IndexDependentMap
+( const AbstractDistMatrix<S>& A,
+        DistMatrix<T,U,V,BLOCK>& B,
+        Function func );
+
 // Kronecker product
 // =================
 template<typename T>
@@ -1605,6 +1704,54 @@ void RealPart
 ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<Base<T>>& AReal );
 /* TODO(poulson): Sparse versions */
 
+// ReductionBatch
+// ==============
+// Queue several inner products and two-norms so that they may be formed in a
+// single pass over the local data and combined with a single AllReduce. The
+// DistMatrix operands of a batch must share a size and distribution, whereas
+// the DistMultiVec operands need only share a grid (e.g., the primal and
+// dual residuals of an interior point method), though the two operands of
+// each inner product must conform. Each Queue routine returns the index of
+// its result, which may be retrieved after Execute() has been called
+// (collectively).
+template<typename Field>
+class ReductionBatch
+{
+public:
+    Int QueueDot
+    ( const AbstractDistMatrix<Field>& A, const AbstractDistMatrix<Field>& B );
+    Int QueueDot( const DistMultiVec<Field>& A, const DistMultiVec<Field>& B );
+    Int QueueNrm2( const AbstractDistMatrix<Field>& A );
+    Int QueueNrm2( const DistMultiVec<Field>& A );
+
+    void Execute();
+
+    Field Dot( Int index ) const;
+    Base<Field> Nrm2( Int index ) const;
+
+    void Clear();
+
+private:
+    const AbstractDistMatrix<Field>* distModel_=nullptr;
+    const DistMultiVec<Field>* multiVecModel_=nullptr;
+    vector<const Matrix<Field>*> dotLefts_, dotRights_, nrm2Operands_;
+    vector<Field> dots_;
+    vector<Base<Field>> norms_;
+    bool executed_=false;
+
+    void CheckConformal( const AbstractDistMatrix<Field>& A );
+    void CheckConformal( const DistMultiVec<Field>& A );
+    void LocalReductions
+    ( Field* localDots,
+      Base<Field>* localScales,
+      Base<Field>* localScaledSquares ) const;
+    void CombineReductions
+    ( const vector<Field>& localDots,
+      const Matrix<Base<Field>>& localScales,
+            Matrix<Base<Field>>& localScaledSquares,
+      mpi::Comm comm );
+};
+
 // Reshape
 // =======
 template<typename T>
@@ -1612,6 +1759,16 @@ void Reshape( Int m, Int n, const Matrix<T>& A, Matrix<T>& B );
 template<typename T>
 Matrix<T> Reshape( Int m, Int n, const Matrix<T>& A );
 
+// Reshape without moving any data; the columns of A must be contiguous
+template<typename T>
+void ReshapeView( Int m, Int n, Matrix<T>& A, Matrix<T>& B );
+template<typename T>
+void LockedReshapeView( Int m, Int n, const Matrix<T>& A, Matrix<T>& B );
+template<typename T>
+Matrix<T> ReshapeView( Int m, Int n, Matrix<T>& A );
+template<typename T>
+Matrix<T> LockedReshapeView( Int m, Int n, const Matrix<T>& A );
+
 template<typename T>
 void Reshape
 ( Int m, Int n, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
@@ -1948,6 +2105,40 @@ template<typename T,typename S>
 void ShiftDiagonal
 ( DistSparseMatrix<T>& A, S alpha, Int offset=0, bool existingDiag=false );
 
+// Split complex data
+// ==================
+// A complex matrix may be stored as a pair of real matrices holding its real
+// and imaginary parts, for which entrywise kernels vectorize far better than
+// for interleaved storage; SplitComplex and MergeComplex convert between the
+// two (e.g., at BLAS boundaries)
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void SplitComplex
+( const Matrix<Complex<Real>>& A, Matrix<Real>& AReal, Matrix<Real>& AImag );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void MergeComplex
+( const Matrix<Real>& AReal, const Matrix<Real>& AImag,
+        Matrix<Complex<Real>>& A );
+
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Hadamard
+( const Matrix<Real>& AReal, const Matrix<Real>& AImag,
+  const Matrix<Real>& BReal, const Matrix<Real>& BImag,
+        Matrix<Real>& CReal,       Matrix<Real>& CImag );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void Axpy
+( const Complex<Real>& alpha,
+  const Matrix<Real>& XReal, const Matrix<Real>& XImag,
+        Matrix<Real>& YReal,       Matrix<Real>& YImag );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Complex<Real> Dot
+( const Matrix<Real>& XReal, const Matrix<Real>& XImag,
+  const Matrix<Real>& YReal, const Matrix<Real>& YImag );
+
 // Transpose
 // =========
 template<typename T>
@@ -2108,6 +2299,17 @@ void UpdateSubmatrix
   const vector<Int>& I, const vector<Int>& J,
   T alpha, const AbstractDistMatrix<T>& ASub );
 
+// WalshHadamard
+// =============
+// Overwrite each column of X with its (unnormalized) Walsh-Hadamard
+// transform, i.e., X := H X for the 2^k x 2^k matrix H formed by 'Walsh',
+// using O(n log n) work per column. The DistMultiVec version uses the same
+// three exchanges as the distributed FFT.
+template<typename T>
+void WalshHadamard( Matrix<T>& X );
+template<typename T>
+void WalshHadamard( DistMultiVec<T>& X );
+
 // Zero
 // ====
 template<typename T>
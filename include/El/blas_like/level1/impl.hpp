@@ -28,7 +28,9 @@
 #include <El/blas_like/level1/EntrywiseMap.hpp>
 #include <El/blas_like/level1/Fill.hpp>
 #include <El/blas_like/level1/FillDiagonal.hpp>
+#include <El/blas_like/level1/FixedSize.hpp>
 #include <El/blas_like/level1/Full.hpp>
+#include <El/blas_like/level1/Fused.hpp>
 #include <El/blas_like/level1/GetDiagonal.hpp>
 #include <El/blas_like/level1/GetMappedDiagonal.hpp>
 #include <El/blas_like/level1/GetSubmatrix.hpp>
@@ -60,6 +62,8 @@
 #include <El/blas_like/level1/SetSubmatrix.hpp>
 #include <El/blas_like/level1/Shift.hpp>
 #include <El/blas_like/level1/ShiftDiagonal.hpp>
+#include <El/blas_like/level1/SplitComplex.hpp>
+#include <El/blas_like/level1/SubmatrixPlan.hpp>
 #include <El/blas_like/level1/Transpose.hpp>
 #include <El/blas_like/level1/TransposeAxpy.hpp>
 #include <El/blas_like/level1/TransposeAxpyContract.hpp>
@@ -188,6 +188,7 @@ EL_EXPORT ElError ElQuasiTrsvDist_z
 typedef struct {
   ElInt bsize;
   bool avoidTrmvBasedLocalSymv;
+  bool fuseLocalSymv;
 } ElSymvCtrl;
 EL_EXPORT ElError ElSymvCtrlDefault_s( ElSymvCtrl* ctrl );
 EL_EXPORT ElError ElSymvCtrlDefault_d( ElSymvCtrl* ctrl );
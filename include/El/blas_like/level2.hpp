@@ -19,6 +19,8 @@ struct SymvCtrl
 {
     Int bsize=LocalSymvBlocksize<T>();
     bool avoidTrmvBasedLocalSymv=true;
+    // Read each local entry of the lower triangle only once (with threads)
+    bool fuseLocalSymv=true;
 };
 
 // Gemv
@@ -278,6 +280,56 @@ void ApplyGivensSequence
   const Matrix<Base<F>>& sList,
   Matrix<F>& A );
 
+// Apply the variable Givens sequences stored in the columns of cLists and
+// sLists, one after another, with the same result as applying each with
+// ApplyGivensSequence. Rather than making a pass over A for each rotation, the
+// rotations are applied as a wavefront over cache-sized blocks of A, in the
+// style of
+//
+//   Field G. Van Zee, Robert A. van de Geijn, and Gregorio Quintana-Orti,
+//   "Restructuring the tridiagonal and bidiagonal QR algorithms for
+//    performance", ACM TOMS, 40(3), 2014 [CITATION].
+//
+template<typename F,typename=DisableIf<IsReal<F>>>
+void ApplyGivensSequences
+( LeftOrRight side, ForwardOrBackward direction,
+  const Matrix<Base<F>>& cLists,
+  const Matrix<F>& sLists,
+  Matrix<F>& A );
+template<typename F>
+void ApplyGivensSequences
+( LeftOrRight side, ForwardOrBackward direction,
+  const Matrix<Base<F>>& cLists,
+  const Matrix<Base<F>>& sLists,
+  Matrix<F>& A );
+
+// Defer the application of variable Givens sequences from the right to A
+// (e.g., to accumulate eigenvectors within a QR algorithm) so that up to
+// 'maxSequences' successive sequences over nested windows of columns may be
+// applied together with ApplyGivensSequences. The buffer must be flushed
+// before A is otherwise accessed.
+template<typename F>
+class GivensSequenceBuffer
+{
+public:
+    GivensSequenceBuffer( Matrix<F>& A, Int maxSequences=16 );
+
+    // Queue a sequence to be applied to the columns [winBeg,winBeg+n) of A,
+    // where n-1 is the length of cList and sList
+    void Push
+    ( ForwardOrBackward direction, Int winBeg,
+      const Matrix<Base<F>>& cList,
+      const Matrix<Base<F>>& sList );
+    void Flush();
+
+private:
+    Matrix<F>& A_;
+    Int maxSequences_, numSequences_=0;
+    Int winBeg_=0, winEnd_=0;
+    ForwardOrBackward direction_=FORWARD;
+    Matrix<Base<F>> cLists_, sLists_;
+};
+
 } // namespace El
 
 #endif // ifndef EL_BLAS2_HPP
@@ -26,11 +26,67 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  GEMM_25D
 };
 }
 using namespace GemmAlgorithmNS;
 
+// When GEMM_DEFAULT is requested, the distributed Gemm chooses between the
+// stationary-A, B, and C variants and the dot-product variant by minimizing
+// a latency-bandwidth (alpha-beta) estimate of their communication costs.
+// GEMM_CANNON is only ever used when explicitly requested, and GEMM_25D is
+// only considered when more than one Gemm layer has been requested.
+struct GemmCostModel
+{
+    // The estimated time, in seconds, to send a single message
+    double latency;
+    // The estimated time, in seconds, to send a single byte
+    double inverseBandwidth;
+
+    GemmCostModel() : latency(1e-5), inverseBandwidth(1e-9) { }
+};
+
+void SetGemmCostModel( const GemmCostModel& model );
+const GemmCostModel& GetGemmCostModel();
+
+// Measure the latency and inverse bandwidth of collectives over the given
+// communicator and install them as the Gemm cost model (this is performed
+// within Initialize if EL_GEMM_CALIBRATE is defined)
+void CalibrateGemmCostModel( mpi::Comm comm=mpi::COMM_WORLD );
+
+// GEMM_25D trades memory for bandwidth by splitting the grid into
+// 'numLayers' layers (see Grid::LayerGrid), giving each layer a copy of its
+// slice of the summation dimension of A and B, forming each layer's partial
+// product with a two-dimensional variant, and summing the partial products
+// over the layers. Each layer then stores an entire copy of the m x n result
+// on 1/numLayers of the processes. The number of layers must evenly divide
+// the grid size; a single layer (the default) reduces to the usual variants.
+void SetGemmNumLayers( int numLayers );
+int GemmNumLayers();
+
+// If enabled, the SUMMA_NN{A,B,C} variants double-buffer their panels,
+// prefetching the next panel through a point-to-point redistribution plan
+// (see CopyAsync) while the current one is applied. Since the plans replace
+// the tuned collectives, this has only been observed to help on networks
+// where the overlap outweighs the loss of the collectives, and so the
+// collective redistributions are used by default (the environment variable
+// EL_GEMM_PREFETCH enables the prefetching within Initialize).
+void SetGemmPrefetchPanels( bool prefetch );
+bool GemmPrefetchPanels();
+
+// The estimated communication time of one of the distributed Gemm variants
+// for forming an m x n update with a summation dimension of k
+template<typename T>
+double GemmCommunicationCost
+( GemmAlgorithm alg, Int m, Int n, Int k, const Grid& grid );
+
+// The variant used for GEMM_DEFAULT (GEMM_25D is only a candidate if
+// 'allowLayers' is true)
+template<typename T>
+GemmAlgorithm SelectGemmAlgorithm
+( Int m, Int n, Int k, const Grid& grid, bool allowLayers=true );
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -53,6 +109,18 @@ void Gemm
   T alpha, const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
 
+// Orientation-tagged operands, e.g., Gemm( alpha, TransposeView(A),
+// NormalView(B), beta, C )
+template<typename T>
+void Gemm
+( T alpha, const OrientedView<Matrix<T>>& A, const OrientedView<Matrix<T>>& B,
+  T beta,        Matrix<T>& C );
+template<typename T>
+void Gemm
+( T alpha, const OrientedView<ElementalMatrix<T>>& A,
+           const OrientedView<ElementalMatrix<T>>& B,
+  T beta,        ElementalMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
+
 template<typename T>
 void LocalGemm
 ( Orientation orientA, Orientation orientB,
@@ -66,6 +134,26 @@ void LocalGemm
            const AbstractDistMatrix<T>& B,
                  AbstractDistMatrix<T>& C );
 
+// Batched Gemm
+// ------------
+// Form C[b] := alpha op(A[b]) op(B[b]) + beta C[b] for each member of a batch
+// of (typically small) independent problems. The members are processed in
+// parallel, or by MKL's batched Gemm if it is available.
+template<typename T>
+void GemmBatched
+( Orientation orientA, Orientation orientB,
+  T alpha, const vector<Matrix<T>>& A,
+           const vector<Matrix<T>>& B,
+  T beta,        vector<Matrix<T>>& C );
+// Each of A, B, and C instead stores its batch side-by-side, with the b'th
+// member occupying the b'th of 'batchSize' equally-sized blocks of columns
+template<typename T>
+void GemmBatched
+( Orientation orientA, Orientation orientB, Int batchSize,
+  T alpha, const Matrix<T>& A,
+           const Matrix<T>& B,
+  T beta,        Matrix<T>& C );
+
 // Hemm
 // ====
 template<typename T>
@@ -122,6 +210,13 @@ void Herk
   Base<T> alpha, const DistSparseMatrix<T>& A,
                        DistSparseMatrix<T>& C );
 
+// Update the lower triangle of a packed Hermitian matrix
+template<typename T>
+void Herk
+( Orientation orientation,
+  Base<T> alpha, const AbstractDistMatrix<T>& A,
+  Base<T> beta,        DistPackedMatrix<T>& C );
+
 // Her2k
 // =====
 template<typename T>
@@ -182,6 +277,45 @@ void Multiply
   T beta,
         AbstractDistMatrix<T>& Y );
 
+// Form the sparse product C := A B. The symbolic phase overwrites C with the
+// (frozen) sparsity pattern of A B and zero values, and the numeric phase
+// overwrites the values of an existing pattern of C which contains that of
+// A B, so that products with a fixed pattern, e.g., A D^2 A^T within an
+// Interior Point Method, need only form their pattern once.
+template<typename T>
+void Multiply
+( const SparseMatrix<T>& A,
+  const SparseMatrix<T>& B,
+        SparseMatrix<T>& C );
+template<typename T>
+void MultiplySymbolic
+( const SparseMatrix<T>& A,
+  const SparseMatrix<T>& B,
+        SparseMatrix<T>& C );
+template<typename T>
+void MultiplyNumeric
+( const SparseMatrix<T>& A,
+  const SparseMatrix<T>& B,
+        SparseMatrix<T>& C );
+
+// The locally-required rows of B are gathered from their owners, and C
+// inherits the row distribution of A
+template<typename T>
+void Multiply
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C );
+template<typename T>
+void MultiplySymbolic
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C );
+template<typename T>
+void MultiplyNumeric
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C );
+
 // MultiShiftQuasiTrsm
 // ===================
 template<typename F>
@@ -366,6 +500,13 @@ void Syrk
   T alpha, const DistSparseMatrix<T>& A,
                  DistSparseMatrix<T>& C, bool conjugate=false );
 
+// Update the lower triangle of a packed symmetric (or Hermitian) matrix
+template<typename T>
+void Syrk
+( Orientation orientation,
+  T alpha, const AbstractDistMatrix<T>& A,
+  T beta,        DistPackedMatrix<T>& C, bool conjugate=false );
+
 // Syr2k
 // =====
 template<typename T>
@@ -447,11 +588,19 @@ enum TrsmAlgorithm {
   TRSM_DEFAULT,
   TRSM_LARGE,
   TRSM_MEDIUM,
-  TRSM_SMALL
+  TRSM_SMALL,
+  TRSM_INVERSE
 };
 }
 using namespace TrsmAlgorithmNS;
 
+// TRSM_INVERSE splits the triangular matrix into roughly sqrt(p) diagonal
+// blocks, explicitly inverts each of them, and applies both their inverses
+// and the off-diagonal blocks with distributed Gemm's, which trades a small
+// number of extra flops (and some stability when the diagonal blocks are
+// ill-conditioned) for far fewer communication phases when there are many
+// right-hand sides. Its Gemm's follow SetGemmNumLayers, and so can be 2.5D.
+
 template<typename F>
 void Trsm
 ( LeftOrRight side, UpperOrLower uplo,
@@ -466,6 +615,45 @@ void Trsm
   const AbstractDistMatrix<F>& A,
         AbstractDistMatrix<F>& B,
   bool checkIfSingular=false, TrsmAlgorithm alg=TRSM_DEFAULT );
+// Orientation-tagged triangular matrix, e.g.,
+// Trsm( LEFT, LOWER, NON_UNIT, alpha, AdjointView(L), B )
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo, UnitOrNonUnit diag,
+  F alpha, const OrientedView<Matrix<F>>& A, Matrix<F>& B,
+  bool checkIfSingular=false );
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo, UnitOrNonUnit diag,
+  F alpha,
+  const OrientedView<ElementalMatrix<F>>& A,
+        ElementalMatrix<F>& B,
+  bool checkIfSingular=false, TrsmAlgorithm alg=TRSM_DEFAULT );
+
+// Overwrite B with alpha inv(A) B, where the given triangle of the sparse
+// matrix A is used. The rows of each level of the (cached) level schedule of
+// A are solved in parallel.
+template<typename F>
+void Trsm
+( UpperOrLower uplo, UnitOrNonUnit diag,
+  F alpha, const SparseMatrix<F>& A, Matrix<F>& B,
+  bool checkIfSingular=false );
+
+// Batched Trsm
+// ------------
+// Overwrite B[b] with alpha op(A[b])^{-1} B[b] (or alpha B[b] op(A[b])^{-1})
+// for each member of a batch, with the members processed in parallel
+template<typename F>
+void TrsmBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const vector<Matrix<F>>& A, vector<Matrix<F>>& B );
+// Each of A and B instead stores its batch side-by-side (see GemmBatched)
+template<typename F>
+void TrsmBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag, Int batchSize,
+  F alpha, const Matrix<F>& A, Matrix<F>& B );
 
 template<typename F>
 void LocalTrsm
@@ -533,10 +721,14 @@ template<typename F>
 void TwoSidedTrsm
 ( UpperOrLower uplo, UnitOrNonUnit diag,
   Matrix<F>& A, const Matrix<F>& B );
+// A positive lookahead overlaps the redistributions of each panel with the
+// trailing update of the previous one (only a depth of one is currently
+// exploited)
 template<typename F>
 void TwoSidedTrsm
 ( UpperOrLower uplo, UnitOrNonUnit diag,
-  AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& B );
+  AbstractDistMatrix<F>& A, const AbstractDistMatrix<F>& B,
+  Int lookahead=0 );
 template<typename F>
 void TwoSidedTrsm
 ( UpperOrLower uplo, UnitOrNonUnit diag,
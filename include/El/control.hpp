@@ -10,9 +10,41 @@
 #define EL_CONTROL_HPP
 
 #include <El/lapack_like/funcs.hpp>
+#include <El/lapack_like/spectral.hpp>
 
 namespace El {
 
+// The dense Sylvester and Lyapunov equations may either be solved through the
+// matrix sign function, which requires an inversion of an (m+n) x (m+n)
+// matrix per Newton iteration, or with the Bartels-Stewart algorithm, which
+// reduces A and B to (complex) Schur form and then recursively solves the
+// triangular Sylvester equation in the manner of Jonsson and Kagstrom's
+// RECSY. By default, the approach with the smaller estimated cost is chosen.
+namespace SylvesterApproachNS {
+enum SylvesterApproach {
+  SYLVESTER_AUTO,
+  SYLVESTER_SIGN,
+  SYLVESTER_BARTELS_STEWART
+};
+} // namespace SylvesterApproachNS
+using namespace SylvesterApproachNS;
+
+template<typename Real>
+struct SylvesterCtrl
+{
+    SylvesterApproach approach=SYLVESTER_AUTO;
+    SignCtrl<Real> signCtrl;
+    SchurCtrl<Real> schurCtrl;
+
+    // The recursion of the triangular solve stops once both dimensions are
+    // at most this size
+    Int cutoff=64;
+
+    // The number of Newton iterations assumed for the sign function when
+    // estimating its cost
+    Int expectedSignIts=10;
+};
+
 // Lyapunov
 // ========
 template<typename F>
@@ -20,13 +52,26 @@ void Lyapunov
 ( const Matrix<F>& A,
   const Matrix<F>& C,
         Matrix<F>& X,
-  SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
+  SignCtrl<Base<F>> ctrl );
 template<typename F>
 void Lyapunov
 ( const ElementalMatrix<F>& A,
   const ElementalMatrix<F>& C, 
         ElementalMatrix<F>& X,
-  SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
+  SignCtrl<Base<F>> ctrl );
+
+template<typename F>
+void Lyapunov
+( const Matrix<F>& A,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl=SylvesterCtrl<Base<F>>() );
+template<typename F>
+void Lyapunov
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl=SylvesterCtrl<Base<F>>() );
 
 // Riccati
 // =======
@@ -73,14 +118,108 @@ void Sylvester
   const Matrix<F>& B,
   const Matrix<F>& C,
         Matrix<F>& X,
-  SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
+  SignCtrl<Base<F>> ctrl );
 template<typename F>
 void Sylvester
 ( const ElementalMatrix<F>& A,
   const ElementalMatrix<F>& B, 
   const ElementalMatrix<F>& C,
         ElementalMatrix<F>& X, 
-  SignCtrl<Base<F>> ctrl=SignCtrl<Base<F>>() );
+  SignCtrl<Base<F>> ctrl );
+
+// Unlike the sign function approach, Bartels-Stewart only requires that
+// A and -B have no common eigenvalues
+template<typename F>
+void Sylvester
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl=SylvesterCtrl<Base<F>>() );
+template<typename F>
+void Sylvester
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl=SylvesterCtrl<Base<F>>() );
+
+// Low-rank solvers for large sparse problems
+// ==========================================
+// The following only require sparse LDL factorizations of shifted copies of
+// a sparse Hermitian matrix, which are combined with the Sherman-Morrison-
+// Woodbury formula when it is perturbed by a low-rank matrix, and return a
+// factor Z such that the solution is approximately X = Z Z^H.
+
+template<typename Real>
+struct LowRankADICtrl
+{
+    Int maxIter=100;
+    // Stop once || W^H W ||_2 <= tol || G^H G ||_2, where the residual of the
+    // current iterate is W W^H
+    Real tol=Real(1e-10);
+
+    // The (positive) shifts are cycled through and, if none are given, are
+    // logarithmically distributed between estimates of the extremal
+    // eigenvalues of the Hermitian part of the operator
+    vector<Real> shifts;
+    Int numShifts=8;
+    Int numPowerIts=20;
+
+    // Whether to keep the factorization of each shift (rather than
+    // refactoring a single one as the shifts are cycled through)
+    bool cacheFactorizations=true;
+
+    // Drop the directions of Z whose contribution to Z Z^H is below
+    // compressTol times the largest (unless compressTol is zero)
+    Real compressTol=Real(1e-14);
+
+    bool progress=false;
+};
+
+// Solve A X + X A^H = G G^H with A = H + U V^H via the Low-Rank
+// Alternating Directions Implicit method of Li and White. H must be Hermitian
+// positive-definite and A must have all of its eigenvalues in the open
+// right-half plane. The number of ADI iterations is returned.
+template<typename Field>
+Int LowRankLyapunov
+( const DistSparseMatrix<Field>& H,
+  const DistMultiVec<Field>& G,
+        DistMultiVec<Field>& Z,
+  const LowRankADICtrl<Base<Field>>& ctrl=LowRankADICtrl<Base<Field>>() );
+template<typename Field>
+Int LowRankLyapunov
+( const DistSparseMatrix<Field>& H,
+  const DistMultiVec<Field>& U,
+  const DistMultiVec<Field>& V,
+  const DistMultiVec<Field>& G,
+        DistMultiVec<Field>& Z,
+  const LowRankADICtrl<Base<Field>>& ctrl=LowRankADICtrl<Base<Field>>() );
+
+template<typename Real>
+struct NewtonKleinmanCtrl
+{
+    Int maxIter=30;
+    // Stop once the relative change in the feedback B^H X is below tol
+    Real tol=Real(1e-8);
+    LowRankADICtrl<Real> adiCtrl;
+    bool progress=false;
+};
+
+// Solve X B B^H X - A^H X - X A = C^H C, i.e., the Riccati equation above with
+// K = B B^H and L = C^H C, via Newton-Kleinman iterations which each solve a
+// Lyapunov equation with the LR-ADI. A must be Hermitian negative-definite
+// (and the Newton iterates then remain stable). The adjoint of C is passed
+// so that it may be distributed like B. The number of Newton iterations is
+// returned.
+template<typename Field>
+Int LowRankRiccati
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Field>& B,
+  const DistMultiVec<Field>& CAdj,
+        DistMultiVec<Field>& Z,
+  const NewtonKleinmanCtrl<Base<Field>>& ctrl=
+        NewtonKleinmanCtrl<Base<Field>>() );
 
 } // namespace El
 
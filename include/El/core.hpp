@@ -14,9 +14,11 @@
 #include <mpi.h>
 
 #include <array>
+#include <atomic>
 #include <cmath>
 #include <complex>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
@@ -25,6 +27,7 @@
 #include <iostream>
 #include <memory>
 #include <sstream>
+#include <stack>
 #include <stdexcept>
 #include <string>
 #include <random>
@@ -263,6 +266,7 @@ template<typename T> struct IsStdField<Complex<T>>
 #include <El/core/imports/openblas.hpp>
 #include <El/core/imports/pmrrr.hpp>
 #include <El/core/imports/scalapack.hpp>
+#include <El/core/imports/cuda.hpp>
 
 #include <El/core/limits.hpp>
 
@@ -286,6 +290,9 @@ class DistMatrix;
 #include <El/core/Graph/decl.hpp>
 #include <El/core/DistMap/decl.hpp>
 #include <El/core/DistGraph/decl.hpp>
+#include <El/core/SlicedEllpack.hpp>
+#include <El/core/LevelSchedule.hpp>
+#include <El/core/SparseAssembly.hpp>
 #include <El/core/SparseMatrix/decl.hpp>
 #include <El/core/DistSparseMatrix/decl.hpp>
 #include <El/core/DistMultiVec/decl.hpp>
@@ -293,6 +300,7 @@ class DistMatrix;
 #include <El/blas_like/level1/decl.hpp>
 
 #include <El/core/Matrix/impl.hpp>
+#include <El/core/FixedMatrix.hpp>
 #include <El/core/Grid.hpp>
 #include <El/core/DistMatrix.hpp>
 #include <El/core/Proxy.hpp>
@@ -316,6 +324,10 @@ class DistMatrix;
 #include <El/core/DistMap.hpp>
 #include <El/core/DistMultiVec/impl.hpp>
 #include <El/core/DistSparseMatrix/impl.hpp>
+#include <El/core/LinearOperator.hpp>
+#include <El/core/DistPackedMatrix.hpp>
+#include <El/core/SubgridScheduler.hpp>
+#include <El/core/DeviceMatrix.hpp>
 
 #include <El/core/Permutation.hpp>
 #include <El/core/DistPermutation.hpp>
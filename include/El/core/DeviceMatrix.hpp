@@ -0,0 +1,95 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_DEVICEMATRIX_HPP
+#define EL_CORE_DEVICEMATRIX_HPP
+
+#ifdef EL_HAVE_CUDA
+
+namespace El {
+
+// Device-resident matrices
+// ========================
+// A column-major matrix whose buffer lives in the memory of the current CUDA
+// device (or, if 'managed', in unified memory). Data moves between a host
+// Matrix and a DeviceMatrix only through the explicit CopyToDevice and
+// CopyToHost routines, and the dense kernels below dispatch to cuBLAS and
+// cuSOLVER. Only float, double, and their complex counterparts are
+// supported.
+template<typename Field>
+class DeviceMatrix
+{
+public:
+    explicit DeviceMatrix( bool managed=false );
+    DeviceMatrix( Int height, Int width, bool managed=false );
+    DeviceMatrix( DeviceMatrix<Field>&& A ) EL_NO_EXCEPT;
+    ~DeviceMatrix();
+
+    DeviceMatrix<Field>& operator=( DeviceMatrix<Field>&& A );
+
+    // The contents are not preserved unless the buffer was large enough
+    void Resize( Int height, Int width );
+    void Resize( Int height, Int width, Int leadingDimension );
+    void Empty();
+
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int LDim() const EL_NO_EXCEPT;
+    bool Managed() const EL_NO_EXCEPT;
+    // Device pointers, which may be passed to CUDA libraries (or to a
+    // CUDA-aware MPI)
+    Field* Buffer() EL_NO_EXCEPT;
+    const Field* LockedBuffer() const EL_NO_EXCEPT;
+
+private:
+    Int height_=0, width_=0, leadingDimension_=1, capacity_=0;
+    bool managed_;
+    Field* buffer_=nullptr;
+
+    DeviceMatrix( const DeviceMatrix<Field>& A );
+    const DeviceMatrix<Field>& operator=( const DeviceMatrix<Field>& A );
+};
+
+// B := A, with B resized to match A
+template<typename Field>
+void CopyToDevice( const Matrix<Field>& A, DeviceMatrix<Field>& B );
+template<typename Field>
+void CopyToHost( const DeviceMatrix<Field>& A, Matrix<Field>& B );
+template<typename Field>
+void Copy( const DeviceMatrix<Field>& A, DeviceMatrix<Field>& B );
+
+// C := alpha op(A) op(B) + beta C
+template<typename Field>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  Field alpha, const DeviceMatrix<Field>& A, const DeviceMatrix<Field>& B,
+  Field beta,        DeviceMatrix<Field>& C );
+
+// B := alpha op(A)^{-1} B (LEFT) or alpha B op(A)^{-1} (RIGHT)
+template<typename Field>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Field alpha, const DeviceMatrix<Field>& A, DeviceMatrix<Field>& B );
+
+// C := alpha A A^H + beta C (NORMAL) or alpha A^H A + beta C (ADJOINT)
+template<typename Field>
+void Herk
+( UpperOrLower uplo, Orientation orientation,
+  Base<Field> alpha, const DeviceMatrix<Field>& A,
+  Base<Field> beta,        DeviceMatrix<Field>& C );
+
+// Overwrite the given triangle of the HPD matrix A with its Cholesky factor
+template<typename Field>
+void Cholesky( UpperOrLower uplo, DeviceMatrix<Field>& A );
+
+} // namespace El
+
+#endif // ifdef EL_HAVE_CUDA
+
+#endif // ifndef EL_CORE_DEVICEMATRIX_HPP
@@ -30,9 +30,40 @@ struct DistGraphMultMeta
     Int numRecvInds;
     vector<int> sendSizes, sendOffs,
                 recvSizes, recvOffs;
+    // The offset of the target of each local edge within the received
+    // indices. When Int is 64-bit and the number of unique local targets fits
+    // into an int, they are instead stored in 'compactColOffs' (and
+    // 'colOffs' is left empty), which halves both their footprint and the
+    // index traffic of the multiplication kernels; use ColOff to access them
+    // regardless of their storage.
     vector<Int> sendInds, colOffs;
-
-    DistGraphMultMeta() : ready(false), numRecvInds(0) { }
+    vector<int> compactColOffs;
+    // The local sources whose edges only involve locally-owned targets
+    // ("interior") and the remaining ("boundary") sources, so that the
+    // interior of a normal multiply may overlap the exchange of remote entries
+    vector<Int> interiorSources, boundarySources;
+    // The other processes which we send entries to or receive entries from
+    // (the relationship is symmetric) and a lazily-formed communicator whose
+    // topology connects us to them
+    vector<int> neighbors;
+    mutable mpi::Comm neighborComm;
+
+    DistGraphMultMeta()
+    : ready(false), numRecvInds(0), neighborComm(mpi::COMM_NULL) { }
+    DistGraphMultMeta( const DistGraphMultMeta& meta )
+    : neighborComm(mpi::COMM_NULL)
+    { *this = meta; }
+    ~DistGraphMultMeta() { FreeNeighborhood(); }
+
+    Int ColOff( Int e ) const EL_NO_EXCEPT
+    { return compactColOffs.empty() ? colOffs[e] : Int(compactColOffs[e]); }
+
+    void FreeNeighborhood() const
+    {
+        if( neighborComm != mpi::COMM_NULL && !mpi::Finalized() )
+            mpi::Free( neighborComm );
+        neighborComm = mpi::COMM_NULL;
+    }
 
     void Clear()
     {
@@ -44,8 +75,15 @@ struct DistGraphMultMeta
         SwapClear( recvOffs );
         SwapClear( sendInds );
         SwapClear( colOffs );
+        SwapClear( compactColOffs );
+        SwapClear( interiorSources );
+        SwapClear( boundarySources );
+        SwapClear( neighbors );
+        FreeNeighborhood();
     }
 
+    // The neighborhood communicator is not shared, as it would otherwise be
+    // freed more than once
     const DistGraphMultMeta& operator=( const DistGraphMultMeta& meta )
     {
         ready = meta.ready;
@@ -56,8 +94,23 @@ struct DistGraphMultMeta
         recvOffs = meta.recvOffs;
         sendInds = meta.sendInds;
         colOffs = meta.colOffs;
+        compactColOffs = meta.compactColOffs;
+        interiorSources = meta.interiorSources;
+        boundarySources = meta.boundarySources;
+        neighbors = meta.neighbors;
+        FreeNeighborhood();
         return *this;
     }
+
+    // Send the 'width' entries associated with each member of 'sendInds'
+    // (ordered by 'sendOffs') from 'sendBuf' and receive the 'width' entries
+    // associated with each unique local target into 'recvBuf'. The roles of
+    // the buffers are reversed for the adjoint exchange. This is collective
+    // over 'comm', the communicator of the owning graph.
+    template<typename T>
+    void NeighborExchange
+    ( const T* sendBuf, T* recvBuf, Int width, bool adjoint,
+      mpi::Comm comm ) const;
 };
 
 
@@ -138,6 +191,13 @@ public:
     void ProcessQueues();
     void ProcessLocalQueues();
 
+    // Resize to numSources x numTargets and adopt the validated compressed
+    // rows (see Graph::AdoptCompressedRows) of the sources assigned to this
+    // process by the standard distribution
+    void AdoptLocalCompressedRows
+    ( Int numSources, Int numTargets,
+      vector<Int>&& localOffsets, vector<Int>&& targets );
+
     // For manually modifying/accessing buffers
     void ForceNumLocalEdges( Int numLocalEdges );
     void ForceConsistency( bool consistent=true ) EL_NO_EXCEPT;
@@ -21,6 +21,27 @@
 
 namespace El {
 
+// The communication pattern for translating a fixed set of local indices
+// through a DistMap (or any other DistMap over the same number of sources
+// and the same grid). Each process requests every distinct index only once,
+// and a replay requires a single exchange rather than three.
+struct DistMapPlan
+{
+    Int numSources=0;
+    Int blocksize=0;
+
+    // The position of each local index within the responses, or -1 if the
+    // index is out of bounds (and should be left unmodified)
+    vector<Int> responseSlots;
+    Int numResponses=0;
+
+    vector<int> requestSizes, requestOffs;
+    vector<int> fulfillSizes, fulfillOffs;
+
+    // The local sources whose images are requested by each process
+    vector<Int> fulfillSources;
+};
+
 // Use a simple 1d distribution where each process owns a fixed number of
 // indices,
 //     if last process,  height - (commSize-1)*floor(height/commSize)
@@ -40,6 +61,15 @@ public:
     void Translate
     ( vector<Int>& localInds, const vector<int>& origOwners ) const;
 
+    // Collectively record the pattern for translating the local indices and
+    // then (repeatedly) translate those indices with a single exchange
+    void FormTranslationPlan
+    ( const vector<Int>& localInds, DistMapPlan& plan ) const;
+    void FormTranslationPlan
+    ( const vector<Int>& localInds, const vector<int>& origOwners,
+      DistMapPlan& plan ) const;
+    void Translate( vector<Int>& localInds, const DistMapPlan& plan ) const;
+
     // composite(i) := second(first(i))
     void Extend( DistMap& firstMap ) const;
     void Extend( const DistMap& firstMap, DistMap& compositeMap ) const;
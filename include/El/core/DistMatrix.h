@@ -1243,6 +1243,25 @@ EL_EXPORT ElError ElDistMatrixQueueUpdate_c
 EL_EXPORT ElError ElDistMatrixQueueUpdate_z
 ( ElDistMatrix_z A, ElInt i, ElInt j, complex_double value );
 
+/* Queue a batch of (i,j,value) triplets, as with
+   void AbstractDistMatrix<T>::QueueUpdate( Int i, Int j, T value )
+   ---------------------------------------------------------------- */
+EL_EXPORT ElError ElDistMatrixQueueUpdates_i
+( ElDistMatrix_i A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const ElInt* values );
+EL_EXPORT ElError ElDistMatrixQueueUpdates_s
+( ElDistMatrix_s A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const float* values );
+EL_EXPORT ElError ElDistMatrixQueueUpdates_d
+( ElDistMatrix_d A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const double* values );
+EL_EXPORT ElError ElDistMatrixQueueUpdates_c
+( ElDistMatrix_c A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const complex_float* values );
+EL_EXPORT ElError ElDistMatrixQueueUpdates_z
+( ElDistMatrix_z A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const complex_double* values );
+
 /* void AbstractDistMatrix<T>::ProcessQueues()
    ------------------------------------------- */
 EL_EXPORT ElError ElDistMatrixProcessQueues_i( ElDistMatrix_i A );
@@ -1251,6 +1270,30 @@ EL_EXPORT ElError ElDistMatrixProcessQueues_d( ElDistMatrix_d A );
 EL_EXPORT ElError ElDistMatrixProcessQueues_c( ElDistMatrix_c A );
 EL_EXPORT ElError ElDistMatrixProcessQueues_z( ElDistMatrix_z A );
 
+/* Copy the entire local matrix into (or out of) a column-major buffer with
+   leading dimension 'ldim'
+   ------------------------------------------------------------------------ */
+EL_EXPORT ElError ElDistMatrixGetLocalBuffer_i
+( ElConstDistMatrix_i A, ElInt* buffer, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixSetLocalBuffer_i
+( ElDistMatrix_i A, const ElInt* buffer, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixGetLocalBuffer_s
+( ElConstDistMatrix_s A, float* buffer, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixSetLocalBuffer_s
+( ElDistMatrix_s A, const float* buffer, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixGetLocalBuffer_d
+( ElConstDistMatrix_d A, double* buffer, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixSetLocalBuffer_d
+( ElDistMatrix_d A, const double* buffer, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixGetLocalBuffer_c
+( ElConstDistMatrix_c A, complex_float* buffer, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixSetLocalBuffer_c
+( ElDistMatrix_c A, const complex_float* buffer, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixGetLocalBuffer_z
+( ElConstDistMatrix_z A, complex_double* buffer, ElInt ldim );
+EL_EXPORT ElError ElDistMatrixSetLocalBuffer_z
+( ElDistMatrix_z A, const complex_double* buffer, ElInt ldim );
+
 /* void AbstractDistMatrix<T>::ReservePulls( Int numPulls ) const
    -------------------------------------------------------------- */
 EL_EXPORT ElError ElDistMatrixReservePulls_i
@@ -41,6 +41,9 @@ public:
     // ==============================
     virtual void Empty( bool freeMemory=true );
     void EmptyData( bool freeMemory=true );
+    // Ensure that the local matrix can hold 'numLocalEntries' entries so that
+    // subsequent resizes (and Empty(false)) within AllocatedMemory() reuse it
+    void ReserveLocal( Int numLocalEntries );
     void SetGrid( const El::Grid& grid );
 
     virtual void AlignWith
@@ -228,7 +231,19 @@ public:
     void Reserve( Int numRemoteEntries );
     void QueueUpdate( const Entry<Ring>& entry ) EL_NO_RELEASE_EXCEPT;
     void QueueUpdate( Int i, Int j, Ring value ) EL_NO_RELEASE_EXCEPT;
-    void ProcessQueues( bool includeViewers=true );
+    // Lock-free queueing from within a parallel region: once
+    // ReserveThreadQueues has been called (outside of the region), thread t
+    // may concurrently queue updates with QueueThreadUpdate(t,...), and the
+    // per-thread queues are merged by ProcessQueues
+    void ReserveThreadQueues( int numThreads, Int numEntriesPerThread=0 );
+    void QueueThreadUpdate
+    ( int thread, const Entry<Ring>& entry ) EL_NO_RELEASE_EXCEPT;
+    void QueueThreadUpdate
+    ( int thread, Int i, Int j, Ring value ) EL_NO_RELEASE_EXCEPT;
+    // If 'compressIndices' is true (and the matrix has at most
+    // limits::Max<Int>() entries), each (i,j) is sent as the single index
+    // i+j*Height(), with the indices and values exchanged separately
+    void ProcessQueues( bool includeViewers=true, bool compressIndices=false );
 
     // Batch extraction of remote entries
     // ----------------------------------
@@ -332,6 +347,7 @@ protected:
     //       have a pair of integers as its own data structure that does not
     //       require separate MPI wrappers from ValueInt<Int>
     mutable vector<ValueInt<Int>> remotePulls_;
+    vector<vector<Entry<Ring>>> threadUpdates_;
 
     // Protected constructors
     // ======================
@@ -349,6 +365,9 @@ private:
     // =====================================
     void ShallowSwap( type& A );
 
+    // Empty the update queues, keeping their capacity unless 'freeMemory'
+    void ClearQueues( bool freeMemory );
+
     template<typename S> friend class AbstractDistMatrix;
     template<typename S> friend class ElementalMatrix;
     template<typename S> friend class BlockMatrix;
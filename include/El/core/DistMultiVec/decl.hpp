@@ -44,6 +44,11 @@ public:
     void Empty( bool freeMemory=true );
     void Resize( Int height, Int width );
 
+    // Ensure that the local matrix can hold 'numLocalEntries' entries so that
+    // an iterate which is repeatedly resized (or emptied with
+    // freeMemory=false) keeps a single buffer
+    void ReserveLocal( Int numLocalEntries );
+
     // Change the distribution
     // -----------------------
     void SetGrid( const El::Grid& grid );
@@ -85,6 +90,7 @@ public:
     Int Width() const EL_NO_EXCEPT;
     Int FirstLocalRow() const EL_NO_EXCEPT;
     Int LocalHeight() const EL_NO_EXCEPT;
+    size_t AllocatedMemory() const EL_NO_EXCEPT;
           El::Matrix<Ring>& Matrix() EL_NO_EXCEPT;
     const El::Matrix<Ring>& LockedMatrix() const EL_NO_EXCEPT;
 
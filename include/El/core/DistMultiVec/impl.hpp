@@ -70,7 +70,10 @@ void DistMultiVec<Ring>::Empty( bool freeMemory )
 
     multiVec_.Empty( freeMemory );
 
-    SwapClear( remoteUpdates_ );
+    if( freeMemory )
+        SwapClear( remoteUpdates_ );
+    else
+        remoteUpdates_.clear();
 }
 
 template<typename Ring>
@@ -97,7 +100,15 @@ void DistMultiVec<Ring>::Resize( Int height, Int width )
     width_ = width;
     InitializeLocalData();
 
-    SwapClear( remoteUpdates_ );
+    // Keep the capacity of the queue for the next round of updates
+    remoteUpdates_.clear();
+}
+
+template<typename Ring>
+void DistMultiVec<Ring>::ReserveLocal( Int numLocalEntries )
+{
+    EL_DEBUG_CSE
+    multiVec_.Reserve( numLocalEntries );
 }
 
 // Change the distribution
@@ -226,6 +237,9 @@ template<typename Ring>
 Int DistMultiVec<Ring>::LocalHeight() const EL_NO_EXCEPT
 { return multiVec_.Height(); }
 template<typename Ring>
+size_t DistMultiVec<Ring>::AllocatedMemory() const EL_NO_EXCEPT
+{ return multiVec_.MemorySize(); }
+template<typename Ring>
 El::Matrix<Ring>& DistMultiVec<Ring>::Matrix() EL_NO_EXCEPT
 { return multiVec_; }
 template<typename Ring>
@@ -393,7 +407,7 @@ void DistMultiVec<Ring>::ProcessQueues()
     vector<Entry<Ring>> sendEntries(totalSend);
     for( const auto& entry : remoteUpdates_ )
         sendEntries[offs[Owner(entry.i,entry.j)]++] = entry;
-    SwapClear( remoteUpdates_ );
+    remoteUpdates_.clear();
     // Exchange and unpack
     // -------------------
     auto recvEntries =
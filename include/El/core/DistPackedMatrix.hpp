@@ -0,0 +1,73 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_DISTPACKEDMATRIX_HPP
+#define EL_CORE_DISTPACKEDMATRIX_HPP
+
+namespace El {
+
+// Packed distributed Hermitian/symmetric matrices
+// ===============================================
+// The lower triangle of an n x n [MC,MR] matrix (with zero alignments),
+// stored as the sequence of its block columns: block column b holds the
+// rows [b*nb,n) of the columns [b*nb,Min((b+1)*nb,n)), and so only the
+// strictly upper triangles of the nb x nb diagonal blocks are stored in
+// addition to the lower triangle. Relative to a full DistMatrix, this
+// roughly halves the memory of a Hermitian (or symmetric) matrix once
+// n is much larger than nb. The entries above the diagonal of the diagonal
+// blocks are never referenced.
+//
+// Each block column is viewable as an ordinary [MC,MR] DistMatrix so that
+// the packed algorithms (Herk, Cholesky, and unpivoted LDL, along with
+// their solves) can be built from the standard distributed kernels.
+template<typename Field>
+class DistPackedMatrix
+{
+public:
+    explicit DistPackedMatrix( const El::Grid& grid=El::Grid::Default() );
+    DistPackedMatrix
+    ( Int n, const El::Grid& grid=El::Grid::Default(),
+      Int blocksize=El::Blocksize() );
+
+    void SetGrid( const El::Grid& grid );
+    // Resize and zero the lower triangle
+    void Resize( Int n, Int blocksize=El::Blocksize() );
+
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    const El::Grid& Grid() const EL_NO_EXCEPT;
+    Int Blocksize() const EL_NO_EXCEPT;
+    Int NumBlocks() const EL_NO_EXCEPT;
+    Int BlockOffset( Int b ) const EL_NO_EXCEPT;
+    Int BlockWidth( Int b ) const EL_NO_EXCEPT;
+    // The number of locally stored entries
+    Int LocalSize() const EL_NO_EXCEPT;
+
+    // A view of the (n-BlockOffset(b)) x BlockWidth(b) block column b
+    DistMatrix<Field> BlockColumn( Int b );
+    const DistMatrix<Field> LockedBlockColumn( Int b ) const;
+
+private:
+    Int height_=0, blocksize_=1;
+    const El::Grid* grid_;
+    vector<Matrix<Field>> blocks_;
+};
+
+// Copy the lower triangle of A into APacked (which keeps its blocksize)
+template<typename Field>
+void Pack
+( const AbstractDistMatrix<Field>& A, DistPackedMatrix<Field>& APacked );
+
+// Form the lower triangle of A, with a zero strictly upper triangle
+template<typename Field>
+void Unpack
+( const DistPackedMatrix<Field>& APacked, AbstractDistMatrix<Field>& A );
+
+} // namespace El
+
+#endif // ifndef EL_CORE_DISTPACKEDMATRIX_HPP
@@ -10,6 +10,7 @@
 #define EL_PERM_DISTPERMUTATION_HPP
 
 #include <map>
+#include <tuple>
 
 namespace El {
 
@@ -189,6 +190,13 @@ private:
     typedef std::pair<Int,mpi::Comm> keyType_;
     mutable std::map<keyType_,PermutationMeta> rowMeta_, colMeta_;
     mutable bool staleMeta_=false;
+
+    // The composition of a swap sequence is applied with a single exchange
+    // whose metadata is cached with the offset as an additional key
+    typedef std::tuple<Int,mpi::Comm,Int> swapKeyType_;
+    mutable std::map<swapKeyType_,PermutationMeta> swapMeta_;
+    const PermutationMeta&
+    SwapMeta( Int align, mpi::Comm comm, Int offset ) const;
 };
 
 } // namespace El
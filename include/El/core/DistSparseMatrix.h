@@ -102,6 +102,28 @@ EL_EXPORT ElError ElDistSparseMatrixReserve_c
 EL_EXPORT ElError ElDistSparseMatrixReserve_z
 ( ElDistSparseMatrix_z A, ElInt numLocalEntries, ElInt numRemoteEntries );
 
+/* Copy the given compressed local rows (whose column indices must be sorted
+   and unique within each row) and adopt them, as with
+   void DistSparseMatrix<T>::AdoptLocalCompressedRows
+   ( Int height, Int width,
+     vector<Int>&& localOffsets, vector<Int>&& cols, vector<T>&& values )
+   ------------------------------------------------------------------------ */
+EL_EXPORT ElError ElDistSparseMatrixSetLocalCompressedRows_i
+( ElDistSparseMatrix_i A, ElInt height, ElInt width,
+  const ElInt* localOffsets, const ElInt* cols, const ElInt* values );
+EL_EXPORT ElError ElDistSparseMatrixSetLocalCompressedRows_s
+( ElDistSparseMatrix_s A, ElInt height, ElInt width,
+  const ElInt* localOffsets, const ElInt* cols, const float* values );
+EL_EXPORT ElError ElDistSparseMatrixSetLocalCompressedRows_d
+( ElDistSparseMatrix_d A, ElInt height, ElInt width,
+  const ElInt* localOffsets, const ElInt* cols, const double* values );
+EL_EXPORT ElError ElDistSparseMatrixSetLocalCompressedRows_c
+( ElDistSparseMatrix_c A, ElInt height, ElInt width,
+  const ElInt* localOffsets, const ElInt* cols, const complex_float* values );
+EL_EXPORT ElError ElDistSparseMatrixSetLocalCompressedRows_z
+( ElDistSparseMatrix_z A, ElInt height, ElInt width,
+  const ElInt* localOffsets, const ElInt* cols, const complex_double* values );
+
 /* void DistSparseMatrix<T>::Update( Int row, Int col, T value )
    -------------------------------------------------------------*/
 EL_EXPORT ElError ElDistSparseMatrixUpdate_i
@@ -187,6 +209,48 @@ EL_EXPORT ElError ElDistSparseMatrixQueueLocalUpdate_c
 EL_EXPORT ElError ElDistSparseMatrixQueueLocalUpdate_z
 ( ElDistSparseMatrix_z A, ElInt localRow, ElInt col, complex_double value );
 
+/* Queue a batch of (row,col,value) triplets, as with
+   void DistSparseMatrix<T>::QueueUpdate
+   ( Int row, Int col, T value, bool passive )
+   ------------------------------------------- */
+EL_EXPORT ElError ElDistSparseMatrixQueueUpdates_i
+( ElDistSparseMatrix_i A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const ElInt* values, bool passive );
+EL_EXPORT ElError ElDistSparseMatrixQueueUpdates_s
+( ElDistSparseMatrix_s A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const float* values, bool passive );
+EL_EXPORT ElError ElDistSparseMatrixQueueUpdates_d
+( ElDistSparseMatrix_d A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const double* values, bool passive );
+EL_EXPORT ElError ElDistSparseMatrixQueueUpdates_c
+( ElDistSparseMatrix_c A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const complex_float* values,
+  bool passive );
+EL_EXPORT ElError ElDistSparseMatrixQueueUpdates_z
+( ElDistSparseMatrix_z A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const complex_double* values,
+  bool passive );
+
+/* Queue a batch of (localRow,col,value) triplets, as with
+   void DistSparseMatrix<T>::QueueLocalUpdate
+   ( Int localRow, Int col, T value )
+   ------------------------------------------ */
+EL_EXPORT ElError ElDistSparseMatrixQueueLocalUpdates_i
+( ElDistSparseMatrix_i A, ElInt numUpdates,
+  const ElInt* localRows, const ElInt* cols, const ElInt* values );
+EL_EXPORT ElError ElDistSparseMatrixQueueLocalUpdates_s
+( ElDistSparseMatrix_s A, ElInt numUpdates,
+  const ElInt* localRows, const ElInt* cols, const float* values );
+EL_EXPORT ElError ElDistSparseMatrixQueueLocalUpdates_d
+( ElDistSparseMatrix_d A, ElInt numUpdates,
+  const ElInt* localRows, const ElInt* cols, const double* values );
+EL_EXPORT ElError ElDistSparseMatrixQueueLocalUpdates_c
+( ElDistSparseMatrix_c A, ElInt numUpdates,
+  const ElInt* localRows, const ElInt* cols, const complex_float* values );
+EL_EXPORT ElError ElDistSparseMatrixQueueLocalUpdates_z
+( ElDistSparseMatrix_z A, ElInt numUpdates,
+  const ElInt* localRows, const ElInt* cols, const complex_double* values );
+
 /* void DistSparseMatrix<T>::QueueZero( Int row, Int col, bool passive )
    --------------------------------------------------------------------- */
 EL_EXPORT ElError ElDistSparseMatrixQueueZero_i
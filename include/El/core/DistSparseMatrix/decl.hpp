@@ -21,6 +21,33 @@
 
 namespace El  {
 
+// A precomputed map from a sequence of (possibly remotely-owned) entry
+// locations to the value slots of a DistSparseMatrix with frozen sparsity
+// (see DistSparseMatrix::FormRefillMap)
+struct DistSparseRefillMap
+{
+    bool ready=false;
+    // Whether any process maps an entry owned by another process
+    bool communicates=false;
+    // The position of each mapped entry within the send buffer
+    vector<Int> sendPerm;
+    vector<int> sendCounts, sendOffs,
+                recvCounts, recvOffs;
+    // The offset into the value buffer of each received entry
+    vector<Int> recvSlots;
+
+    void Clear()
+    {
+        ready = false;
+        communicates = false;
+        SwapClear( sendPerm );
+        SwapClear( sendCounts );
+        SwapClear( sendOffs );
+        SwapClear( recvCounts );
+        SwapClear( recvOffs );
+        SwapClear( recvSlots );
+    }
+};
 
 // Use a simple 1d distribution where each process owns a fixed number of rows,
 //     if last process,  height - (commSize-1)*floor(height/commSize)
@@ -35,6 +62,11 @@ public:
     ( const El::Grid& grid=El::Grid::Default() );
     DistSparseMatrix
     ( Int height, Int width, const El::Grid& grid=El::Grid::Default() );
+    // Adopt existing compressed local rows (see AdoptLocalCompressedRows)
+    DistSparseMatrix
+    ( Int height, Int width,
+      vector<Int>&& localOffsets, vector<Int>&& cols, vector<Ring>&& values,
+      const El::Grid& grid=El::Grid::Default() );
     DistSparseMatrix( const DistSparseMatrix<Ring>& A );
     // TODO(poulson): Move constructor
     ~DistSparseMatrix();
@@ -55,10 +87,29 @@ public:
     // --------
     void Reserve( Int numLocalEntries, Int numRemoteEntries=0 );
 
+    // Become a height x width matrix by taking ownership of the existing
+    // compressed rows of the rows assigned to this process (beginning with
+    // FirstLocalRow()). The column indices of each row must be sorted and
+    // unique; they are validated (in linear time) but neither copied nor
+    // sorted.
+    void AdoptLocalCompressedRows
+    ( Int height, Int width,
+      vector<Int>&& localOffsets, vector<Int>&& cols, vector<Ring>&& values );
+
     void FreezeSparsity() EL_NO_EXCEPT;
     void UnfreezeSparsity() EL_NO_EXCEPT;
     bool FrozenSparsity() const EL_NO_EXCEPT;
 
+    // Once the sparsity is frozen, (non-transposed) products with a matrix
+    // that has the sliced ELLPACK format enabled use a lazily-formed
+    // SELL-C-sigma copy of the local rows (with their columns mapped into the
+    // communicated portion of the input), which is discarded when the matrix
+    // is modified
+    void EnableSlicedEllpack( Int chunkHeight=8, Int sortWindow=256 );
+    void DisableSlicedEllpack();
+    bool SlicedEllpackEnabled() const EL_NO_EXCEPT;
+    const El::SlicedEllpack<Ring>& LockedSlicedEllpack() const;
+
     // Expensive independent updates and explicit zeroing
     // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
     void Update( const Entry<Ring>& entry );
@@ -88,6 +139,20 @@ public:
     void ProcessQueues();
     void ProcessLocalQueues();
 
+    // Refilling the values of a frozen sparsity pattern
+    // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+    // Collectively map the given (global) locations of existing entries, which
+    // may be owned by any process, to their value slots. The map remains valid
+    // for as long as the sparsity pattern is not modified.
+    void FormRefillMap
+    ( const vector<Int>& rows,
+      const vector<Int>& cols,
+            DistSparseRefillMap& map ) const;
+    // Collectively overwrite the mapped entries with the corresponding values
+    // without queueing, sorting, or invalidating the multiplication metadata
+    // (only the values of remotely-owned entries are communicated)
+    void Refill( const DistSparseRefillMap& map, const vector<Ring>& values );
+
     // Operator overloading
     // ====================
 
@@ -183,6 +248,7 @@ private:
     El::DistGraph distGraph_;
     vector<Ring> vals_;
     vector<Ring> remoteVals_;
+    mutable El::SlicedEllpack<Ring> sell_;
 
     void InitializeLocalData();
 
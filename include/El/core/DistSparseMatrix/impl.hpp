@@ -38,6 +38,19 @@ DistSparseMatrix<Ring>::DistSparseMatrix
 : distGraph_(height,width,grid)
 { }
 
+template<typename Ring>
+DistSparseMatrix<Ring>::DistSparseMatrix
+( Int height, Int width,
+  vector<Int>&& localOffsets, vector<Int>&& cols, vector<Ring>&& values,
+  const El::Grid& grid )
+: distGraph_(grid)
+{
+    EL_DEBUG_CSE
+    AdoptLocalCompressedRows
+    ( height, width,
+      std::move(localOffsets), std::move(cols), std::move(values) );
+}
+
 template<typename Ring>
 DistSparseMatrix<Ring>::DistSparseMatrix( const DistSparseMatrix<Ring>& A )
 {
@@ -72,6 +85,7 @@ void DistSparseMatrix<Ring>::Empty( bool freeMemory )
     else
         vals_.resize( 0 );
     distGraph_.multMeta.Clear();
+    sell_.Clear();
 
     SwapClear( remoteVals_ );
 }
@@ -83,6 +97,7 @@ void DistSparseMatrix<Ring>::Resize( Int height, Int width )
     distGraph_.Resize( height, width );
     vals_.resize( 0 );
     SwapClear( remoteVals_ );
+    sell_.Clear();
 }
 
 // Change the distribution
@@ -96,6 +111,7 @@ void DistSparseMatrix<Ring>::SetGrid( const El::Grid& grid )
     distGraph_.SetGrid( grid );
     vals_.resize( 0 );
     SwapClear( remoteVals_ );
+    sell_.Clear();
 }
 
 // Assembly
@@ -111,16 +127,93 @@ void DistSparseMatrix<Ring>::Reserve( Int numLocalEntries, Int numRemoteEntries
     remoteVals_.reserve( currRemoteSize+numRemoteEntries );
 }
 
+template<typename Ring>
+void DistSparseMatrix<Ring>::AdoptLocalCompressedRows
+( Int height, Int width,
+  vector<Int>&& localOffsets, vector<Int>&& cols, vector<Ring>&& values )
+{
+    EL_DEBUG_CSE
+    if( values.size() != cols.size() )
+        LogicError
+        ("There were ",cols.size()," column indices but ",values.size(),
+         " values");
+    distGraph_.AdoptLocalCompressedRows
+    ( height, width, std::move(localOffsets), std::move(cols) );
+    vals_ = std::move( values );
+    SwapClear( remoteVals_ );
+    sell_.Clear();
+}
+
 template<typename Ring>
 void DistSparseMatrix<Ring>::FreezeSparsity() EL_NO_EXCEPT
 { distGraph_.frozenSparsity_ = true; }
 template<typename Ring>
 void DistSparseMatrix<Ring>::UnfreezeSparsity() EL_NO_EXCEPT
-{ distGraph_.frozenSparsity_ = false; }
+{
+    distGraph_.frozenSparsity_ = false;
+    sell_.ready = false;
+}
 template<typename Ring>
 bool DistSparseMatrix<Ring>::FrozenSparsity() const EL_NO_EXCEPT
 { return distGraph_.frozenSparsity_; }
 
+template<typename Ring>
+void DistSparseMatrix<Ring>::EnableSlicedEllpack
+( Int chunkHeight, Int sortWindow )
+{
+    EL_DEBUG_CSE
+    if( chunkHeight < 1 || chunkHeight > maxSlicedEllpackChunkHeight )
+        LogicError
+        ("Chunk heights must be in [1,",maxSlicedEllpackChunkHeight,"]");
+    if( sortWindow < 1 )
+        LogicError("The sorting window must be positive");
+    if( sell_.chunkHeight != chunkHeight || sell_.sortWindow != sortWindow )
+        sell_.Clear();
+    sell_.enabled = true;
+    sell_.chunkHeight = chunkHeight;
+    sell_.sortWindow = sortWindow;
+}
+
+template<typename Ring>
+void DistSparseMatrix<Ring>::DisableSlicedEllpack()
+{
+    EL_DEBUG_CSE
+    sell_.Clear();
+    sell_.enabled = false;
+}
+
+template<typename Ring>
+bool DistSparseMatrix<Ring>::SlicedEllpackEnabled() const EL_NO_EXCEPT
+{ return sell_.enabled; }
+
+template<typename Ring>
+const El::SlicedEllpack<Ring>&
+DistSparseMatrix<Ring>::LockedSlicedEllpack() const
+{
+    EL_DEBUG_CSE
+    if( !FrozenSparsity() )
+        LogicError("The sliced ELLPACK format requires a frozen sparsity");
+    AssertLocallyConsistent();
+    // The local copy is formed in terms of the communication metadata, which
+    // is recomputed if the sparsity pattern was modified
+    if( !distGraph_.multMeta.ready )
+        sell_.ready = false;
+    distGraph_.InitializeMultMeta();
+    const auto& meta = distGraph_.multMeta;
+    if( !sell_.ready )
+    {
+        if( meta.compactColOffs.empty() )
+            sell_.Build
+            ( LocalHeight(), LockedOffsetBuffer(), meta.colOffs.data(),
+              LockedValueBuffer() );
+        else
+            sell_.Build
+            ( LocalHeight(), LockedOffsetBuffer(),
+              meta.compactColOffs.data(), LockedValueBuffer() );
+    }
+    return sell_;
+}
+
 template<typename Ring>
 void DistSparseMatrix<Ring>::Update( Int row, Int col, const Ring& value )
 {
@@ -194,6 +287,7 @@ void DistSparseMatrix<Ring>::QueueLocalUpdate
 ( Int localRow, Int col, const Ring& value ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    sell_.ready = false;
     if( FrozenSparsity() )
     {
         const Int offset = distGraph_.Offset( localRow, col );
@@ -230,6 +324,7 @@ void DistSparseMatrix<Ring>::QueueLocalZero( Int localRow, Int col )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    sell_.ready = false;
     if( FrozenSparsity() )
     {
         const Int offset = distGraph_.Offset( localRow, col );
@@ -332,12 +427,12 @@ void DistSparseMatrix<Ring>::ProcessLocalQueues()
     EL_DEBUG_CSE
     if( distGraph_.locallyConsistent_ )
         return;
+    sell_.ready = false;
 
-    Int numRemoved = 0;
-    const Int numLocalEntries = vals_.size();
-    vector<Entry<Ring>> entries( numLocalEntries );
     if( distGraph_.markedForRemoval_.size() != 0 )
     {
+        const Int numLocalEntries = vals_.size();
+        Int numKept = 0;
         for( Int s=0; s<numLocalEntries; ++s )
         {
             pair<Int,Int> candidate(distGraph_.sources_[s],
@@ -345,52 +440,134 @@ void DistSparseMatrix<Ring>::ProcessLocalQueues()
             if( distGraph_.markedForRemoval_.find(candidate) ==
                 distGraph_.markedForRemoval_.end() )
             {
-                entries[s-numRemoved].i = distGraph_.sources_[s];
-                entries[s-numRemoved].j = distGraph_.targets_[s];
-                entries[s-numRemoved].value = vals_[s];
-            }
-            else
-            {
-                ++numRemoved;
+                distGraph_.sources_[numKept] = distGraph_.sources_[s];
+                distGraph_.targets_[numKept] = distGraph_.targets_[s];
+                vals_[numKept] = vals_[s];
+                ++numKept;
             }
         }
         SwapClear( distGraph_.markedForRemoval_ );
-        entries.resize( numLocalEntries-numRemoved );
+        distGraph_.sources_.resize( numKept );
+        distGraph_.targets_.resize( numKept );
+        vals_.resize( numKept );
+    }
+    AssembleTriplets
+    ( FirstLocalRow(), LocalHeight(),
+      distGraph_.sources_, distGraph_.targets_, vals_ );
+
+    distGraph_.ComputeSourceOffsets();
+    distGraph_.locallyConsistent_ = true;
+}
+
+template<typename Ring>
+void DistSparseMatrix<Ring>::FormRefillMap
+( const vector<Int>& rows,
+  const vector<Int>& cols,
+        DistSparseRefillMap& map ) const
+{
+    EL_DEBUG_CSE
+    if( !FrozenSparsity() )
+        LogicError("Refill maps require a frozen sparsity pattern");
+    if( rows.size() != cols.size() )
+        LogicError("Inconsistent numbers of refill rows and columns");
+    mpi::Comm comm = distGraph_.grid_->Comm();
+    const int commSize = distGraph_.grid_->Size();
+    const int commRank = distGraph_.grid_->Rank();
+    const Int numEntries = rows.size();
+    map.Clear();
+
+    // Pack the locations by owner
+    // ===========================
+    map.sendCounts.resize( commSize, 0 );
+    for( Int k=0; k<numEntries; ++k )
+        ++map.sendCounts[RowOwner(rows[k])];
+    const int totalSend = Scan( map.sendCounts, map.sendOffs );
+    auto offs = map.sendOffs;
+    map.sendPerm.resize( numEntries );
+    vector<Int> sendRows(totalSend), sendCols(totalSend);
+    for( Int k=0; k<numEntries; ++k )
+    {
+        const int owner = RowOwner(rows[k]);
+        map.sendPerm[k] = offs[owner];
+        sendRows[offs[owner]] = rows[k];
+        sendCols[offs[owner]] = cols[k];
+        ++offs[owner];
+    }
+    const bool locallyLocal = ( map.sendCounts[commRank] == numEntries );
+    map.communicates =
+      !mpi::AllReduce( Int(locallyLocal), mpi::BINARY_AND, comm );
+
+    // Exchange the locations and look up their slots
+    // ==============================================
+    map.recvCounts.resize( commSize );
+    mpi::AllToAll( map.sendCounts.data(), 1, map.recvCounts.data(), 1, comm );
+    const int totalRecv = Scan( map.recvCounts, map.recvOffs );
+    vector<Int> recvRows(totalRecv), recvCols(totalRecv);
+    if( map.communicates )
+    {
+        mpi::AllToAll
+        ( sendRows.data(), map.sendCounts.data(), map.sendOffs.data(),
+          recvRows.data(), map.recvCounts.data(), map.recvOffs.data(), comm );
+        mpi::AllToAll
+        ( sendCols.data(), map.sendCounts.data(), map.sendOffs.data(),
+          recvCols.data(), map.recvCounts.data(), map.recvOffs.data(), comm );
     }
     else
     {
-        for( Int s=0; s<numLocalEntries; ++s )
-            entries[s] = Entry<Ring>{distGraph_.sources_[s],
-                                  distGraph_.targets_[s],vals_[s]};
+        recvRows = sendRows;
+        recvCols = sendCols;
     }
-    std::sort( entries.begin(), entries.end(), CompareEntries );
-    const Int numSorted = entries.size();
-
-    // Combine duplicates
-    // ------------------
-    Int lastUnique=0;
-    for( Int s=1; s<numSorted; ++s )
+    const Int firstLocalRow = FirstLocalRow();
+    const Int numLocalEntries = NumLocalEntries();
+    map.recvSlots.resize( totalRecv );
+    for( Int s=0; s<totalRecv; ++s )
     {
-        if( entries[s].i != entries[lastUnique].i ||
-            entries[s].j != entries[lastUnique].j )
-            entries[++lastUnique] = entries[s];
-        else
-            entries[lastUnique].value += entries[s].value;
+        const Int slot = Offset( recvRows[s]-firstLocalRow, recvCols[s] );
+        if( slot >= numLocalEntries || Col(slot) != recvCols[s] ||
+            Row(slot) != recvRows[s] )
+            LogicError
+            ("Entry (",recvRows[s],",",recvCols[s],") does not exist");
+        map.recvSlots[s] = slot;
     }
-    const Int numUnique = lastUnique+1;
+    map.ready = true;
+}
 
-    entries.resize( numUnique );
-    distGraph_.sources_.resize( numUnique );
-    distGraph_.targets_.resize( numUnique );
-    vals_.resize( numUnique );
-    for( Int s=0; s<numUnique; ++s )
+template<typename Ring>
+void DistSparseMatrix<Ring>::Refill
+( const DistSparseRefillMap& map, const vector<Ring>& values )
+{
+    EL_DEBUG_CSE
+    if( !map.ready )
+        LogicError("The refill map was not formed");
+    if( !FrozenSparsity() )
+        LogicError("Refilling requires a frozen sparsity pattern");
+    if( values.size() != map.sendPerm.size() )
+        LogicError
+        ("Expected ",map.sendPerm.size()," refill values but received ",
+         values.size());
+    sell_.ready = false;
+    const Int numEntries = values.size();
+    if( !map.communicates )
     {
-        distGraph_.sources_[s] = entries[s].i;
-        distGraph_.targets_[s] = entries[s].j;
-        vals_[s] = entries[s].value;
+        // Every send offset is zero, so the send buffer is the receive buffer
+        for( Int k=0; k<numEntries; ++k )
+            vals_[map.recvSlots[map.sendPerm[k]]] = values[k];
+        return;
     }
-    distGraph_.ComputeSourceOffsets();
-    distGraph_.locallyConsistent_ = true;
+
+    vector<Ring> sendVals;
+    FastResize( sendVals, numEntries );
+    for( Int k=0; k<numEntries; ++k )
+        sendVals[map.sendPerm[k]] = values[k];
+    const Int totalRecv = map.recvSlots.size();
+    vector<Ring> recvVals;
+    FastResize( recvVals, totalRecv );
+    mpi::AllToAll
+    ( sendVals.data(), map.sendCounts.data(), map.sendOffs.data(),
+      recvVals.data(), map.recvCounts.data(), map.recvOffs.data(),
+      distGraph_.grid_->Comm() );
+    for( Int s=0; s<totalRecv; ++s )
+        vals_[map.recvSlots[s]] = recvVals[s];
 }
 
 // Operator overloading
@@ -406,6 +583,7 @@ DistSparseMatrix<Ring>::operator=( const DistSparseMatrix<Ring>& A )
     distGraph_ = A.distGraph_;
     vals_ = A.vals_;
     remoteVals_ = A.remoteVals_;
+    sell_ = A.sell_;
     return *this;
 }
 
@@ -503,7 +681,10 @@ Int DistSparseMatrix<Ring>::NumEntries() const EL_NO_EXCEPT
 
 template<typename Ring>
 El::DistGraph& DistSparseMatrix<Ring>::DistGraph() EL_NO_EXCEPT
-{ return distGraph_; }
+{
+    sell_.ready = false;
+    return distGraph_;
+}
 template<typename Ring>
 const El::DistGraph& DistSparseMatrix<Ring>::LockedDistGraph()
 const EL_NO_EXCEPT
@@ -649,6 +830,7 @@ void DistSparseMatrix<Ring>::Set
     {
         const Int localRow = row - firstLocalRow;
         Int index = Offset( localRow, col );
+        sell_.ready = false;
         if( Row(index) == row && Col(index) == col )
         {
             vals_[index] = val;
@@ -662,18 +844,31 @@ void DistSparseMatrix<Ring>::Set
     }
 }
 
+// NOTE: Mutable access to the buffers discards the sliced ELLPACK copy
 template<typename Ring>
 Int* DistSparseMatrix<Ring>::SourceBuffer() EL_NO_EXCEPT
-{ return distGraph_.SourceBuffer(); }
+{
+    sell_.ready = false;
+    return distGraph_.SourceBuffer();
+}
 template<typename Ring>
 Int* DistSparseMatrix<Ring>::TargetBuffer() EL_NO_EXCEPT
-{ return distGraph_.TargetBuffer(); }
+{
+    sell_.ready = false;
+    return distGraph_.TargetBuffer();
+}
 template<typename Ring>
 Int* DistSparseMatrix<Ring>::OffsetBuffer() EL_NO_EXCEPT
-{ return distGraph_.OffsetBuffer(); }
+{
+    sell_.ready = false;
+    return distGraph_.OffsetBuffer();
+}
 template<typename Ring>
 Ring* DistSparseMatrix<Ring>::ValueBuffer() EL_NO_EXCEPT
-{ return vals_.data(); }
+{
+    sell_.ready = false;
+    return vals_.data();
+}
 
 template<typename Ring>
 const Int* DistSparseMatrix<Ring>::LockedSourceBuffer() const EL_NO_EXCEPT
@@ -697,6 +892,7 @@ void DistSparseMatrix<Ring>::ForceNumLocalEntries( Int numLocalEntries )
     EL_DEBUG_CSE
     distGraph_.ForceNumLocalEdges( numLocalEntries );
     vals_.resize( numLocalEntries );
+    sell_.ready = false;
 }
 
 template<typename Ring>
@@ -704,6 +900,7 @@ void DistSparseMatrix<Ring>::ForceConsistency( bool consistent ) EL_NO_EXCEPT
 {
     EL_DEBUG_CSE
     distGraph_.ForceConsistency(consistent);
+    sell_.ready = false;
 }
 
 // Auxiliary routines
@@ -0,0 +1,94 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_FIXEDMATRIX_HPP
+#define EL_CORE_FIXEDMATRIX_HPP
+
+namespace El {
+
+// A column-major M x N matrix whose dimensions are fixed at compile time and
+// whose entries are stored inline (e.g., on the stack). It is meant for the
+// tiny blocks (such as the 2x2 pivots of LDL^H factorizations and the 2x2
+// diagonal blocks of real Schur forms) which are manipulated far too often
+// for the heap allocation and run-time size checks of Matrix<T> to be
+// negligible. Since every loop over its entries has compile-time bounds,
+// the kernels in blas_like/level1/FixedSize.hpp are fully unrolled by the
+// compiler.
+template<typename T,Int M,Int N=M>
+class FixedMatrix
+{
+public:
+    static_assert( M > 0 && N > 0, "FixedMatrix dimensions must be positive" );
+
+    // The entries are left uninitialized
+    FixedMatrix() { }
+
+    static constexpr Int Height() EL_NO_EXCEPT { return M; }
+    static constexpr Int Width() EL_NO_EXCEPT { return N; }
+    static constexpr Int LDim() EL_NO_EXCEPT { return M; }
+
+    T* Buffer() EL_NO_EXCEPT { return data_; }
+    const T* LockedBuffer() const EL_NO_EXCEPT { return data_; }
+
+    T& operator()( Int i, Int j ) EL_NO_RELEASE_EXCEPT
+    {
+        EL_DEBUG_ONLY(AssertValidEntry( i, j ))
+        return data_[i+j*M];
+    }
+    const T& operator()( Int i, Int j ) const EL_NO_RELEASE_EXCEPT
+    {
+        EL_DEBUG_ONLY(AssertValidEntry( i, j ))
+        return data_[i+j*M];
+    }
+
+    // Copy the M x N block of A with top-left entry (i,j) into this matrix
+    void Load( const Matrix<T>& A, Int i=0, Int j=0 ) EL_NO_RELEASE_EXCEPT
+    {
+        EL_DEBUG_ONLY(
+          if( i < 0 || j < 0 || i+M > A.Height() || j+N > A.Width() )
+              LogicError
+              ("Cannot load a ",M," x ",N," block from (",i,",",j,") of a ",
+               A.Height()," x ",A.Width()," matrix");
+        )
+        const T* ABuf = A.LockedBuffer( i, j );
+        const Int ALDim = A.LDim();
+        for( Int jj=0; jj<N; ++jj )
+            for( Int ii=0; ii<M; ++ii )
+                data_[ii+jj*M] = ABuf[ii+jj*ALDim];
+    }
+
+    // Copy this matrix into the M x N block of A with top-left entry (i,j)
+    void Store( Matrix<T>& A, Int i=0, Int j=0 ) const EL_NO_RELEASE_EXCEPT
+    {
+        EL_DEBUG_ONLY(
+          if( i < 0 || j < 0 || i+M > A.Height() || j+N > A.Width() )
+              LogicError
+              ("Cannot store a ",M," x ",N," block into (",i,",",j,") of a ",
+               A.Height()," x ",A.Width()," matrix");
+        )
+        T* ABuf = A.Buffer( i, j );
+        const Int ALDim = A.LDim();
+        for( Int jj=0; jj<N; ++jj )
+            for( Int ii=0; ii<M; ++ii )
+                ABuf[ii+jj*ALDim] = data_[ii+jj*M];
+    }
+
+private:
+    T data_[M*N];
+
+    void AssertValidEntry( Int i, Int j ) const
+    {
+        if( i < 0 || i >= M || j < 0 || j >= N )
+            LogicError
+            ("Entry (",i,",",j,") is not in a ",M," x ",N," matrix");
+    }
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_FIXEDMATRIX_HPP
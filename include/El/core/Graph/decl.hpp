@@ -32,6 +32,13 @@ class SparseMatrix;
 template<typename T>
 class DistSparseMatrix;
 
+// Throw a LogicError unless 'offsets' (of length numSources+1) and 'targets'
+// form compressed rows with targets in [0,numTargets) that are strictly
+// increasing within each row
+void AssertCompressedRows
+( Int numSources, Int numTargets,
+  const vector<Int>& offsets, const vector<Int>& targets );
+
 class Graph
 {
 public:
@@ -87,6 +94,12 @@ public:
     void QueueDisconnection( Int source, Int target );
     void ProcessQueues();
 
+    // Adopt the validated compressed rows of an existing graph (the edges must
+    // be sorted and unique within each row) without copying or sorting them
+    void AdoptCompressedRows
+    ( Int numSources, Int numTargets,
+      vector<Int>&& offsets, vector<Int>&& targets );
+
     // For manually modifying/accessing the buffers
     void ForceNumEdges( Int numEdges );
     void ForceConsistency( bool consistent=true ) EL_NO_EXCEPT;
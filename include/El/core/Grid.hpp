@@ -10,6 +10,8 @@
 #ifndef EL_GRID_HPP
 #define EL_GRID_HPP
 
+#include <El/core/NodeAwareComm.hpp>
+
 namespace El {
 
 class Grid
@@ -91,7 +93,52 @@ public:
     int BlacsMCMRContext() const;
 #endif
 
+    // Node topology
+    // =============
+    // The node-aware views of the communicators are built upon their first
+    // use, which is collective over the VC communicator for the queries
+    // below (and over the MC or MR communicator for MCOnNode and MROnNode)
+
+    // The processes of the grid on our node, ordered by their VC rank
+    mpi::Comm NodeComm() const;
+    int NodeRank() const;
+    int NodeSize() const;
+    int NumNodes() const;
+    // The index of the node holding the given VC rank
+    int Node( int vcRank ) const;
+    // Whether our column (row) communicator lies entirely within one node
+    bool MCOnNode() const;
+    bool MROnNode() const;
+    // The node-aware view of the MC, MR, VC, or VR communicator of this grid
+    // (nullptr for any other communicator or if we are not in the grid),
+    // which is collective over 'comm' upon its first use
+    NodeAwareComm* NodeAware( mpi::Comm comm ) const;
+
+    // Layered (2.5D) decompositions
+    // =============================
+    // The VC ranks of the grid are split into 'numLayers' contiguous layers,
+    // each of which forms a grid that is viewed by the entire viewing
+    // communicator (so that matrices may be copied between the grid and its
+    // layers). When numLayers divides the grid width, each layer is a set of
+    // consecutive process columns of the same height. The layers are built
+    // upon the first request for a particular number of layers, which is
+    // collective over the viewing communicator, and are cached until the
+    // grid is destroyed.
+    const El::Grid& LayerGrid( int numLayers, int layer ) const;
+    // The layer containing our process (mpi::UNDEFINED if not in the grid)
+    int Layer( int numLayers ) const;
+    // The processes occupying the same position within each layer, ordered
+    // by layer (mpi::COMM_NULL if not in the grid)
+    mpi::Comm DepthComm( int numLayers ) const;
+    // The height of each layer when splitting into the given number of layers
+    int LayerHeight( int numLayers ) const;
+
     static int DefaultHeight( int gridSize ) EL_NO_EXCEPT;
+    // A grid height which divides the number of processes per node (if the
+    // nodes are uniformly populated), so that, when consecutive ranks of
+    // 'comm' share a node, each column communicator of a COLUMN_MAJOR grid
+    // lies within a single node. Collective over 'comm'.
+    static int NodeAwareHeight( mpi::Comm comm );
 
     // To be used internally by Elemental
     static void InitializeDefault();
@@ -129,6 +176,20 @@ private:
         mdRank_, mdPerpRank_,
         vcRank_, vrRank_;
 
+    mutable unique_ptr<NodeAwareComm> mcNodeAware_, mrNodeAware_,
+                                      vcNodeAware_, vrNodeAware_;
+    NodeAwareComm& LazyNodeAware
+    ( unique_ptr<NodeAwareComm>& nodeAware, mpi::Comm comm ) const;
+
+    struct Layers
+    {
+        int numLayers;
+        vector<unique_ptr<El::Grid>> grids;
+        mpi::Comm depthComm;
+    };
+    mutable vector<unique_ptr<Layers>> layers_;
+    const Layers& GetLayers( int numLayers ) const;
+
 #ifdef EL_HAVE_SCALAPACK
     int blacsVCHandle_, blacsVRHandle_;
     int blacsMCMRContext_;
@@ -184,6 +245,11 @@ inline bool GridCompare
     return true;
 }
 
+// The tuned blocksize of a routine for the shape of the given grid
+template<typename T>
+inline Int TunedBlocksize( const string& routine, const Grid& grid )
+{ return TunedBlocksize<T>( routine, grid.Height(), grid.Width() ); }
+
 } // namespace El
 
 #endif // ifndef EL_GRID_HPP
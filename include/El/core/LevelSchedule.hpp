@@ -0,0 +1,93 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_LEVELSCHEDULE_HPP
+#define EL_CORE_LEVELSCHEDULE_HPP
+
+namespace El {
+
+// A partition of the rows of the lower (or upper) triangle of the pattern of a
+// square CSR matrix into levels such that each row only depends upon rows from
+// previous levels, so that the rows of each level of a triangular solve may be
+// processed independently. Since the schedule only depends upon the pattern,
+// it remains valid when the values of its owner are modified.
+struct LevelSchedule
+{
+    // Whether the schedule is consistent with the pattern of its owner
+    bool ready;
+    UpperOrLower uplo;
+
+    Int height;
+    // The offsets of each level into 'rows'
+    vector<Int> levelOffsets;
+    // The rows of each level (in increasing order within each level)
+    vector<Int> rows;
+    // The offset of the diagonal entry of each row, or -1 if it is missing
+    vector<Int> diagOffsets;
+
+    LevelSchedule() : ready(false), uplo(LOWER), height(0) { }
+
+    Int NumLevels() const { return Int(levelOffsets.size())-1; }
+
+    void Clear()
+    {
+        ready = false;
+        height = 0;
+        SwapClear( levelOffsets );
+        SwapClear( rows );
+        SwapClear( diagOffsets );
+    }
+
+    void Build
+    ( UpperOrLower triangle,
+      Int numRows,
+      const Int* rowOffsets,
+      const Int* colIndices )
+    {
+        EL_DEBUG_CSE
+        uplo = triangle;
+        height = numRows;
+
+        // The level of each row is one more than that of its latest dependency
+        vector<Int> rowLevels( numRows );
+        diagOffsets.resize( numRows );
+        Int numLevels = 0;
+        for( Int step=0; step<numRows; ++step )
+        {
+            const Int i = ( uplo == LOWER ? step : numRows-1-step );
+            Int level = 0;
+            diagOffsets[i] = -1;
+            for( Int e=rowOffsets[i]; e<rowOffsets[i+1]; ++e )
+            {
+                const Int j = colIndices[e];
+                if( j == i )
+                    diagOffsets[i] = e;
+                else if( (uplo == LOWER && j < i) || (uplo == UPPER && j > i) )
+                    level = Max( level, rowLevels[j]+1 );
+            }
+            rowLevels[i] = level;
+            numLevels = Max( numLevels, level+1 );
+        }
+
+        // Bucket the rows by level
+        levelOffsets.assign( numLevels+1, 0 );
+        for( Int i=0; i<numRows; ++i )
+            ++levelOffsets[rowLevels[i]+1];
+        for( Int level=0; level<numLevels; ++level )
+            levelOffsets[level+1] += levelOffsets[level];
+        vector<Int> levelEnds( levelOffsets.begin(), levelOffsets.end()-1 );
+        rows.resize( numRows );
+        for( Int i=0; i<numRows; ++i )
+            rows[levelEnds[rowLevels[i]]++] = i;
+        ready = true;
+    }
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_LEVELSCHEDULE_HPP
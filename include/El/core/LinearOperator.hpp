@@ -0,0 +1,200 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_LINEAROPERATOR_HPP
+#define EL_CORE_LINEAROPERATOR_HPP
+
+namespace El {
+
+// Matrix-free linear operators
+// ============================
+// A height x width linear operator which is only accessed through its action
+//
+//   Y := alpha op(A) X + beta Y,
+//
+// where X and Y may have any number of columns and op(A) is A unless the
+// operator was declared to also support its transpose and adjoint. The
+// iterative routines which accept a LinearOperator (or DistLinearOperator)
+// therefore allow stencils, FFT-based operators, and compressed
+// representations to be used without first forming a sparse matrix.
+//
+// Both classes also model the 'applyA' conventions of FGMRES and LGMRES,
+// i.e., 'applyA( alpha, X, beta, Y )', and of the templated Lanczos
+// routines, i.e., 'applyA( X, Y )', which overwrites Y with A X.
+//
+// An operator which wraps a matrix only stores a reference to it, and so the
+// matrix must outlive the operator.
+
+template<typename Field>
+class LinearOperator
+{
+public:
+    typedef function<void(Orientation,Field,const Matrix<Field>&,
+                          Field,Matrix<Field>&)> ApplyType;
+
+    LinearOperator() { }
+
+    LinearOperator
+    ( Int height, Int width, ApplyType apply, bool supportsAdjoint=false )
+    : height_(height), width_(width), supportsAdjoint_(supportsAdjoint),
+      apply_(apply)
+    { }
+
+    explicit LinearOperator( const Matrix<Field>& A )
+    : height_(A.Height()), width_(A.Width()), supportsAdjoint_(true),
+      apply_(
+        [&A]( Orientation orientation, Field alpha, const Matrix<Field>& X,
+              Field beta, Matrix<Field>& Y )
+        { Gemm( orientation, NORMAL, alpha, A, X, beta, Y ); })
+    { }
+
+    explicit LinearOperator( const SparseMatrix<Field>& A )
+    : height_(A.Height()), width_(A.Width()), supportsAdjoint_(true),
+      apply_(
+        [&A]( Orientation orientation, Field alpha, const Matrix<Field>& X,
+              Field beta, Matrix<Field>& Y )
+        { Multiply( orientation, alpha, A, X, beta, Y ); })
+    { }
+
+    Int Height() const EL_NO_EXCEPT { return height_; }
+    Int Width() const EL_NO_EXCEPT { return width_; }
+    bool SupportsAdjoint() const EL_NO_EXCEPT { return supportsAdjoint_; }
+
+    void Apply
+    ( Orientation orientation,
+      Field alpha, const Matrix<Field>& X,
+      Field beta,        Matrix<Field>& Y ) const
+    {
+        EL_DEBUG_CSE
+        if( orientation != NORMAL && !supportsAdjoint_ )
+            LogicError("The operator does not support its adjoint");
+        const Int inHeight = ( orientation == NORMAL ? width_ : height_ );
+        const Int outHeight = ( orientation == NORMAL ? height_ : width_ );
+        if( X.Height() != inHeight || Y.Height() != outHeight ||
+            X.Width() != Y.Width() )
+            LogicError
+            ("Cannot apply a ",height_," x ",width_," operator (",
+             OrientationToChar(orientation),") to a ",X.Height()," x ",
+             X.Width()," matrix to produce a ",Y.Height()," x ",Y.Width(),
+             " matrix");
+        apply_( orientation, alpha, X, beta, Y );
+    }
+
+    void operator()
+    ( Field alpha, const Matrix<Field>& X,
+      Field beta,        Matrix<Field>& Y ) const
+    { Apply( NORMAL, alpha, X, beta, Y ); }
+
+    void operator()( const Matrix<Field>& X, Matrix<Field>& Y ) const
+    {
+        Zeros( Y, height_, X.Width() );
+        Apply( NORMAL, Field(1), X, Field(0), Y );
+    }
+
+private:
+    Int height_=0, width_=0;
+    bool supportsAdjoint_=false;
+    ApplyType apply_;
+};
+
+// The input and output DistMultiVec's are distributed over Grid()
+template<typename Field>
+class DistLinearOperator
+{
+public:
+    typedef function<void(Orientation,Field,const DistMultiVec<Field>&,
+                          Field,DistMultiVec<Field>&)> ApplyType;
+
+    explicit DistLinearOperator( const El::Grid& grid=El::Grid::Default() )
+    : grid_(&grid)
+    { }
+
+    DistLinearOperator
+    ( Int height, Int width, const El::Grid& grid, ApplyType apply,
+      bool supportsAdjoint=false )
+    : height_(height), width_(width), supportsAdjoint_(supportsAdjoint),
+      grid_(&grid), apply_(apply)
+    { }
+
+    explicit DistLinearOperator( const DistSparseMatrix<Field>& A )
+    : height_(A.Height()), width_(A.Width()), supportsAdjoint_(true),
+      grid_(&A.Grid()),
+      apply_(
+        [&A]( Orientation orientation,
+              Field alpha, const DistMultiVec<Field>& X,
+              Field beta,        DistMultiVec<Field>& Y )
+        { Multiply( orientation, alpha, A, X, beta, Y ); })
+    { }
+
+    Int Height() const EL_NO_EXCEPT { return height_; }
+    Int Width() const EL_NO_EXCEPT { return width_; }
+    bool SupportsAdjoint() const EL_NO_EXCEPT { return supportsAdjoint_; }
+    const El::Grid& Grid() const EL_NO_EXCEPT { return *grid_; }
+
+    void Apply
+    ( Orientation orientation,
+      Field alpha, const DistMultiVec<Field>& X,
+      Field beta,        DistMultiVec<Field>& Y ) const
+    {
+        EL_DEBUG_CSE
+        if( orientation != NORMAL && !supportsAdjoint_ )
+            LogicError("The operator does not support its adjoint");
+        const Int inHeight = ( orientation == NORMAL ? width_ : height_ );
+        const Int outHeight = ( orientation == NORMAL ? height_ : width_ );
+        if( X.Height() != inHeight || Y.Height() != outHeight ||
+            X.Width() != Y.Width() )
+            LogicError
+            ("Cannot apply a ",height_," x ",width_," operator (",
+             OrientationToChar(orientation),") to a ",X.Height()," x ",
+             X.Width()," DistMultiVec to produce a ",Y.Height()," x ",
+             Y.Width()," DistMultiVec");
+        EL_DEBUG_ONLY(
+          if( X.Grid() != *grid_ || Y.Grid() != *grid_ )
+              LogicError("The DistMultiVec's were not over the operator grid");
+        )
+        apply_( orientation, alpha, X, beta, Y );
+    }
+
+    void operator()
+    ( Field alpha, const DistMultiVec<Field>& X,
+      Field beta,        DistMultiVec<Field>& Y ) const
+    { Apply( NORMAL, alpha, X, beta, Y ); }
+
+    void operator()
+    ( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y ) const
+    {
+        Zeros( Y, height_, X.Width() );
+        Apply( NORMAL, Field(1), X, Field(0), Y );
+    }
+
+private:
+    Int height_=0, width_=0;
+    bool supportsAdjoint_=false;
+    const El::Grid* grid_;
+    ApplyType apply_;
+};
+
+template<typename Field>
+void Multiply
+( Orientation orientation,
+  Field alpha, const LinearOperator<Field>& A,
+               const Matrix<Field>& X,
+  Field beta,        Matrix<Field>& Y )
+{ A.Apply( orientation, alpha, X, beta, Y ); }
+
+template<typename Field>
+void Multiply
+( Orientation orientation,
+  Field alpha, const DistLinearOperator<Field>& A,
+               const DistMultiVec<Field>& X,
+  Field beta,        DistMultiVec<Field>& Y )
+{ A.Apply( orientation, alpha, X, beta, Y ); }
+
+} // namespace El
+
+#endif // ifndef EL_CORE_LINEAROPERATOR_HPP
@@ -58,6 +58,11 @@ public:
     void Resize( Int height, Int width );
     void Resize( Int height, Int width, Int leadingDimension );
 
+    // Ensure that the buffer can hold 'numEntries' entries while preserving
+    // the current ones; Resize and Empty(false) never release the buffer, so
+    // subsequent reconfigurations within MemorySize() will not reallocate
+    void Reserve( Int numEntries );
+
     // Reconfigure around the given buffer, but do not assume ownership
     void Attach
     ( Int height, Int width, Ring* buffer, Int leadingDimension );
@@ -126,6 +131,11 @@ public:
     void SetViewType( El::ViewType viewType ) EL_NO_EXCEPT;
     El::ViewType ViewType() const EL_NO_EXCEPT;
 
+    // Place subsequent (re)allocations of the buffer according to 'policy'
+    // rather than the default memory policy
+    void SetMemoryPolicy( const El::MemoryPolicy& policy );
+    const El::MemoryPolicy& MemoryPolicy() const EL_NO_EXCEPT;
+
     // Single-entry manipulation
     // =========================
     Ring Get( Int i, Int j=0 ) const EL_NO_RELEASE_EXCEPT;
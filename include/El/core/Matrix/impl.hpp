@@ -137,6 +137,27 @@ void Matrix<Ring>::Resize( Int height, Int width, Int leadingDimension )
     Resize_( height, width, leadingDimension );
 }
 
+template<typename Ring>
+void Matrix<Ring>::Reserve( Int numEntries )
+{
+    EL_DEBUG_CSE
+    if( Viewing() )
+        LogicError("Cannot reserve memory for a view");
+    if( numEntries <= Int(memory_.Size()) )
+        return;
+    // Stage the current entries so that the buffer can be regrown in place
+    // under this matrix's memory policy
+    const Int numOld = leadingDimension_*width_;
+    Memory<Ring> staging( numOld );
+    Ring* stagingBuf = staging.Buffer();
+    for( Int k=0; k<numOld; ++k )
+        stagingBuf[k] = data_[k];
+    memory_.Require( numEntries );
+    data_ = memory_.Buffer();
+    for( Int k=0; k<numOld; ++k )
+        data_[k] = stagingBuf[k];
+}
+
 template<typename Ring>
 void Matrix<Ring>::Attach
 ( Int height, Int width, Ring* buffer, Int leadingDimension )
@@ -374,6 +395,14 @@ template<typename Ring>
 El::ViewType Matrix<Ring>::ViewType() const EL_NO_EXCEPT
 { return viewType_; }
 
+template<typename Ring>
+void Matrix<Ring>::SetMemoryPolicy( const El::MemoryPolicy& policy )
+{ memory_.SetPolicy( policy ); }
+
+template<typename Ring>
+const El::MemoryPolicy& Matrix<Ring>::MemoryPolicy() const EL_NO_EXCEPT
+{ return memory_.Policy(); }
+
 // Single-entry manipulation
 // =========================
 
@@ -11,12 +11,67 @@
 
 namespace El {
 
+// Placement policies for large buffers
+// ====================================
+// By default, the pages of a buffer are placed on the NUMA domain of the
+// thread which first touches them, which, for a buffer zeroed by a single
+// thread, concentrates a large matrix on one socket. Buffers of at least
+// memory_policy::MIN_POLICY_BYTES may instead be freshly mapped and either
+// interleaved across all NUMA domains or first touched by the OpenMP threads
+// under a static partition of the buffer, which, for column-major storage, is
+// the static partition of the columns used by the threaded kernels. They may
+// also be backed by transparent or explicitly-reserved huge pages.
+//
+// Each policy is honored on a best-effort basis: if explicit huge pages are
+// not available, ordinary pages are used, and policies which the platform
+// does not support are ignored. Non-packed datatypes always use the default.
+namespace NumaPolicyNS {
+enum NumaPolicy
+{
+    NUMA_DEFAULT,
+    NUMA_INTERLEAVED,
+    NUMA_FIRST_TOUCH
+};
+}
+using namespace NumaPolicyNS;
+
+namespace HugePagePolicyNS {
+enum HugePagePolicy
+{
+    HUGE_PAGES_NONE,
+    HUGE_PAGES_TRANSPARENT,
+    HUGE_PAGES_2MB,
+    HUGE_PAGES_1GB
+};
+}
+using namespace HugePagePolicyNS;
+
+struct MemoryPolicy
+{
+    NumaPolicy numa=NUMA_DEFAULT;
+    HugePagePolicy hugePages=HUGE_PAGES_NONE;
+
+    bool IsDefault() const EL_NO_EXCEPT
+    { return numa == NUMA_DEFAULT && hugePages == HUGE_PAGES_NONE; }
+};
+
+// The policy used by every Memory instance which has not been given its own
+void SetDefaultMemoryPolicy( const MemoryPolicy& policy );
+const MemoryPolicy& DefaultMemoryPolicy() EL_NO_EXCEPT;
+
 template<typename G>
 class Memory
 {
     size_t size_;
     G* rawBuffer_;
     G* buffer_;
+    // The number of bytes mapped for rawBuffer_ if it follows a non-default
+    // policy (and zero otherwise)
+    size_t mappedBytes_=0;
+    // Whether rawBuffer_ was drawn from (and must be returned to) the pool
+    bool pooled_=false;
+    bool customPolicy_=false;
+    MemoryPolicy policy_;
 public:
     Memory();
     Memory( size_t size );
@@ -34,8 +89,71 @@ public:
     G* Require( size_t size );
     void Release();
     void Empty();
+
+    // Subsequent allocations follow 'policy' rather than the default policy
+    void SetPolicy( const MemoryPolicy& policy );
+    const MemoryPolicy& Policy() const EL_NO_EXCEPT;
 };
 
+// An optional process-wide pool of raw buffers, bucketed into power-of-two
+// size classes, which Memory<G> draws from for packed datatypes. Buffers
+// which are released are cached (up to the pool's capacity) rather than
+// returned to the system so that the temporaries of repeated operations,
+// such as the send and receive buffers of redistributions, are reused.
+//
+// Since every pooled buffer is rounded up to its size class and idle buffers
+// remain cached until they are trimmed, the pool is disabled by default
+// (the environment variable EL_MEMORY_POOL enables it within Initialize),
+// and buffers are then allocated with their exact sizes.
+struct MemoryPoolStatistics
+{
+    size_t numHits=0;
+    size_t numMisses=0;
+    size_t numReturns=0;
+    size_t numDiscards=0;
+    size_t numCachedBytes=0;
+    size_t peakCachedBytes=0;
+};
+
+void EnableMemoryPool( bool enable=true );
+bool MemoryPoolEnabled();
+
+// The maximum number of idle bytes the pool will cache
+void SetMemoryPoolCapacity( size_t numBytes );
+size_t MemoryPoolCapacity();
+
+// Return idle buffers to the system until at most 'numBytes' remain cached
+void TrimMemoryPool( size_t numBytes=0 );
+
+MemoryPoolStatistics MemoryPoolStats();
+void ResetMemoryPoolStats();
+
+namespace memory_pool {
+
+// Allocations below this size bypass the pool
+const size_t MIN_POOLED_BYTES = 4096;
+
+// 'pooled' is set to whether the buffer was drawn from the pool, in which
+// case it must be released with the same value
+void* Allocate( size_t numBytes, bool& pooled );
+void Free( void* ptr, size_t numBytes, bool pooled ) EL_NO_EXCEPT;
+
+} // namespace memory_pool
+
+namespace memory_policy {
+
+// Smaller allocations always follow the default policy
+const size_t MIN_POLICY_BYTES = size_t(1) << 21;
+
+// Map fresh pages for 'numBytes' bytes placed according to 'policy', setting
+// 'mappedBytes' to the length of the mapping. A null pointer is returned
+// (with 'mappedBytes' equal to zero) if pages cannot be mapped.
+void* Allocate
+( size_t numBytes, const MemoryPolicy& policy, size_t& mappedBytes );
+void Free( void* ptr, size_t mappedBytes ) EL_NO_EXCEPT;
+
+} // namespace memory_policy
+
 } // namespace El
 
 #endif // ifndef EL_MEMORY_DECL_HPP
@@ -11,19 +11,75 @@ namespace El {
 
 namespace {
 
-template<typename G>
-static G* New( size_t size )
+// Non-packed datatypes ignore the memory policy
+template<typename G,typename=DisableIf<IsPacked<G>>>
+static G* New
+( size_t size, const MemoryPolicy& policy, size_t& mappedBytes, bool& pooled )
 {
+    mappedBytes = 0;
+    pooled = false;
     return new G[size];
 }
 
-template<typename G>
-static void Delete( G*& ptr )
+template<typename G,typename=EnableIf<IsPacked<G>>,typename=void>
+static G* New
+( size_t size, const MemoryPolicy& policy, size_t& mappedBytes, bool& pooled )
+{
+    const size_t numBytes = size*sizeof(G);
+    G* ptr = nullptr;
+    mappedBytes = 0;
+    pooled = false;
+    if( !policy.IsDefault() && numBytes >= memory_policy::MIN_POLICY_BYTES )
+        ptr = static_cast<G*>
+          ( memory_policy::Allocate( numBytes, policy, mappedBytes ) );
+    if( ptr == nullptr )
+        ptr = static_cast<G*>( memory_pool::Allocate( numBytes, pooled ) );
+    if( !std::is_trivially_default_constructible<G>::value )
+        for( size_t i=0; i<size; ++i )
+            new (&ptr[i]) G;
+    return ptr;
+}
+
+template<typename G,typename=DisableIf<IsPacked<G>>>
+static void Delete( G*& ptr, size_t size, size_t mappedBytes, bool pooled )
 {
     delete[] ptr;
     ptr = nullptr;
 }
 
+// Packed datatypes are trivially destructible, so their buffers may be
+// directly returned to the pool (or unmapped)
+template<typename G,typename=EnableIf<IsPacked<G>>,typename=void>
+static void Delete( G*& ptr, size_t size, size_t mappedBytes, bool pooled )
+{
+    if( mappedBytes > 0 )
+        memory_policy::Free( ptr, mappedBytes );
+    else
+        memory_pool::Free( ptr, size*sizeof(G), pooled );
+    ptr = nullptr;
+}
+
+#ifdef EL_HAVE_MPC
+// Arrays of BigFloat are allocated in one piece so that their entries may
+// share a contiguous arena of limbs
+template<>
+BigFloat* New<BigFloat>
+( size_t size, const MemoryPolicy& policy, size_t& mappedBytes, bool& pooled )
+{
+    mappedBytes = 0;
+    pooled = false;
+    return mpfr::NewArray( size );
+}
+
+template<>
+void Delete<BigFloat>
+( BigFloat*& ptr, size_t size, size_t mappedBytes, bool pooled )
+{
+    mpfr::DeleteArray( ptr, size );
+    ptr = nullptr;
+}
+#endif // ifdef EL_HAVE_MPC
+
 } // anonymous namespace
 
 template<typename G>
@@ -51,12 +107,16 @@ void Memory<G>::ShallowSwap( Memory<G>& mem )
     std::swap(size_,mem.size_);
     std::swap(rawBuffer_,mem.rawBuffer_);
     std::swap(buffer_,mem.buffer_);
+    std::swap(mappedBytes_,mem.mappedBytes_);
+    std::swap(pooled_,mem.pooled_);
+    std::swap(customPolicy_,mem.customPolicy_);
+    std::swap(policy_,mem.policy_);
 }
 
 template<typename G>
 Memory<G>::~Memory() 
 { 
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_, mappedBytes_, pooled_ );
 }
 
 template<typename G>
@@ -70,14 +130,18 @@ G* Memory<G>::Require( size_t size )
 {
     if( size > size_ )
     {
-        Delete( rawBuffer_ );
+        Delete( rawBuffer_, size_, mappedBytes_, pooled_ );
+        mappedBytes_ = 0;
+        pooled_ = false;
 
 #ifndef EL_RELEASE
         try {
 #endif
 
             // TODO: Optionally overallocate to force alignment of buffer_
-            rawBuffer_ = New<G>( size );
+            const MemoryPolicy& policy =
+              customPolicy_ ? policy_ : DefaultMemoryPolicy();
+            rawBuffer_ = New<G>( size, policy, mappedBytes_, pooled_ );
             buffer_ = rawBuffer_;
 
             size_ = size;
@@ -110,11 +174,24 @@ void Memory<G>::Release()
 template<typename G>
 void Memory<G>::Empty()
 {
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_, mappedBytes_, pooled_ );
     buffer_ = nullptr;
     size_ = 0;
+    mappedBytes_ = 0;
+    pooled_ = false;
 }
 
+template<typename G>
+void Memory<G>::SetPolicy( const MemoryPolicy& policy )
+{
+    customPolicy_ = true;
+    policy_ = policy;
+}
+
+template<typename G>
+const MemoryPolicy& Memory<G>::Policy() const EL_NO_EXCEPT
+{ return customPolicy_ ? policy_ : DefaultMemoryPolicy(); }
+
 #ifdef EL_INSTANTIATE_CORE
 # define EL_EXTERN
 #else
@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_NODEAWARECOMM_HPP
+#define EL_NODEAWARECOMM_HPP
+
+namespace El {
+
+// Enable or disable the shared-memory implementations of NodeAwareComm's
+// collectives (the setting must agree over all processes). They have not
+// been shown to outperform the MPI implementation's own on-node collectives,
+// so they are disabled by default (the environment variable
+// EL_NODE_AWARE_COLLECTIVES enables them within Initialize).
+void EnableNodeAwareCollectives( bool enable=true );
+bool NodeAwareCollectivesEnabled();
+
+// A two-level view of a communicator: the processes on the same node
+// (which can communicate through shared memory) and one leader per node.
+//
+// The collectives stage the on-node portion of their data in a shared-memory
+// segment on each node, so that only the leaders exchange data over the
+// network, and then only once per node rather than once per process.
+class NodeAwareComm
+{
+public:
+    explicit NodeAwareComm( mpi::Comm comm );
+    ~NodeAwareComm();
+
+    mpi::Comm Comm() const EL_NO_EXCEPT { return comm_; }
+    // The processes of Comm() on our node, ordered by their rank in Comm()
+    mpi::Comm LocalComm() const EL_NO_EXCEPT { return localComm_; }
+    // The node leaders (i.e., local rank zero); mpi::COMM_NULL elsewhere
+    mpi::Comm LeaderComm() const EL_NO_EXCEPT { return leaderComm_; }
+
+    int Size() const EL_NO_EXCEPT { return size_; }
+    int LocalRank() const EL_NO_EXCEPT { return localRank_; }
+    int LocalSize() const EL_NO_EXCEPT { return localSize_; }
+    int NumNodes() const EL_NO_EXCEPT { return numNodes_; }
+    // The node index (ordered by the rank of the leader) of each process
+    int Node( int rank ) const EL_NO_EXCEPT { return nodeOfRank_[rank]; }
+    bool OnOneNode() const EL_NO_EXCEPT { return numNodes_ == 1; }
+
+    // Whether the shared-memory collectives are available and worthwhile,
+    // which requires at least one node to hold several processes
+    bool SharedCollectives() const EL_NO_EXCEPT;
+
+    // Equivalent to mpi::AllGather over Comm() with 'numBytes' bytes from
+    // each process
+    void AllGather( const void* sendBuf, size_t numBytes, void* recvBuf );
+
+private:
+    mpi::Comm comm_, localComm_, leaderComm_;
+    int size_, localRank_, localSize_, numNodes_, maxLocalSize_;
+
+    vector<int> nodeOfRank_;
+    // The position of each process within the node-major ordering
+    vector<int> slotOfRank_;
+    // The number of processes on each node, and the resulting offsets
+    vector<int> nodeSizes_, nodeOffs_;
+
+    mpi::Window window_;
+    byte* segment_=nullptr;
+    size_t segmentBytes_=0;
+    int parity_=0;
+
+    byte* Reserve( size_t numBytes );
+
+    NodeAwareComm( const NodeAwareComm& );
+    const NodeAwareComm& operator=( const NodeAwareComm& );
+};
+
+} // namespace El
+
+#endif // ifndef EL_NODEAWARECOMM_HPP
@@ -157,6 +157,57 @@ struct ProxyCtrl
     { }
 };
 
+// The constraints for handing A to ScaLAPACK: a ([MC,MR],BLOCK) matrix with
+// zero cuts (and square blocks, if requested) keeps its blocking and
+// alignments so that its buffer is used in place, while any other matrix is
+// redistributed with the given blocking and zero alignments
+template<typename T>
+inline ProxyCtrl ScaLAPACKProxyCtrl
+( const AbstractDistMatrix<T>& A,
+  Int blockHeight=DefaultBlockHeight(),
+  Int blockWidth=DefaultBlockWidth(),
+  bool squareBlocks=false )
+{
+    ProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.rowConstrain = true;
+    ctrl.colCut = 0;
+    ctrl.rowCut = 0;
+    if( A.ColDist() == MC && A.RowDist() == MR && A.Wrap() == BLOCK &&
+        A.ColCut() == 0 && A.RowCut() == 0 &&
+        (!squareBlocks || A.BlockHeight() == A.BlockWidth()) )
+    {
+        ctrl.blockHeight = A.BlockHeight();
+        ctrl.blockWidth = A.BlockWidth();
+        ctrl.colAlign = A.ColAlign();
+        ctrl.rowAlign = A.RowAlign();
+    }
+    else
+    {
+        ctrl.blockHeight = blockHeight;
+        ctrl.blockWidth = ( squareBlocks ? blockHeight : blockWidth );
+        ctrl.colAlign = 0;
+        ctrl.rowAlign = 0;
+    }
+    return ctrl;
+}
+
+// The constraints which reproduce the blocking and alignments of A
+template<typename T>
+inline ProxyCtrl AlignedProxyCtrl( const AbstractDistMatrix<T>& A )
+{
+    ProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.rowConstrain = true;
+    ctrl.blockHeight = A.BlockHeight();
+    ctrl.blockWidth = A.BlockWidth();
+    ctrl.colAlign = A.ColAlign();
+    ctrl.rowAlign = A.RowAlign();
+    ctrl.colCut = A.ColCut();
+    ctrl.rowCut = A.RowCut();
+    return ctrl;
+}
+
 struct ElementalProxyCtrl
 {
     bool colConstrain, rowConstrain, rootConstrain;
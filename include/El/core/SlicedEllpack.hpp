@@ -0,0 +1,160 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_SLICEDELLPACK_HPP
+#define EL_CORE_SLICEDELLPACK_HPP
+
+namespace El {
+
+// The largest supported number of rows per chunk of a SlicedEllpack matrix
+const Int maxSlicedEllpackChunkHeight = 32;
+
+// A sliced ELLPACK (SELL-C-sigma) copy of a CSR matrix for use in sparse
+// matrix-vector products. The rows are sorted by decreasing length within
+// windows of 'sortWindow' rows and then grouped into chunks of 'chunkHeight'
+// (C) rows. Each chunk is stored column-major and padded to the length of its
+// longest row so that the rows of a chunk may be processed in SIMD lanes.
+template<typename Ring>
+struct SlicedEllpack
+{
+    // Whether the owning matrix should form and use this representation
+    bool enabled;
+    // Whether the representation is consistent with its owner
+    bool ready;
+    Int chunkHeight, sortWindow;
+
+    Int height;
+    // The original index of each of the sorted rows
+    vector<Int> rowPerm;
+    // The number of nonzeros in each of the sorted rows (padded with zeros to
+    // a multiple of the chunk height)
+    vector<Int> rowLengths;
+    // The offsets of each chunk into 'targets' and 'values'
+    vector<Int> chunkOffsets;
+    // The padding entries have a target of zero and a value of zero
+    vector<Int> targets;
+    vector<Ring> values;
+
+    SlicedEllpack()
+    : enabled(false), ready(false), chunkHeight(8), sortWindow(256), height(0)
+    { }
+
+    Int NumChunks() const { return Int(chunkOffsets.size())-1; }
+    Int ChunkWidth( Int chunk ) const
+    { return (chunkOffsets[chunk+1]-chunkOffsets[chunk])/chunkHeight; }
+
+    // Only the settings are copied, as the owner of the copy must rebuild the
+    // representation from its own data
+    const SlicedEllpack<Ring>& operator=( const SlicedEllpack<Ring>& sell )
+    {
+        Clear();
+        enabled = sell.enabled;
+        chunkHeight = sell.chunkHeight;
+        sortWindow = sell.sortWindow;
+        return *this;
+    }
+
+    void Clear()
+    {
+        ready = false;
+        height = 0;
+        SwapClear( rowPerm );
+        SwapClear( rowLengths );
+        SwapClear( chunkOffsets );
+        SwapClear( targets );
+        SwapClear( values );
+    }
+
+    // The column indices may be stored as either Int or (compactly) int
+    template<typename Index>
+    void Build
+    ( Int numRows,
+      const Int* rowOffsets,
+      const Index* colIndices,
+      const Ring* vals )
+    {
+        EL_DEBUG_CSE
+        if( chunkHeight < 1 || chunkHeight > maxSlicedEllpackChunkHeight )
+            LogicError
+            ("Chunk heights must be in [1,",maxSlicedEllpackChunkHeight,"]");
+        if( sortWindow < 1 )
+            LogicError("The sorting window must be positive");
+        height = numRows;
+
+        // Sort the rows by decreasing length within each window
+        rowPerm.resize( numRows );
+        for( Int i=0; i<numRows; ++i )
+            rowPerm[i] = i;
+        auto longer = [&]( const Int& i0, const Int& i1 )
+          { return rowOffsets[i0+1]-rowOffsets[i0] >
+                   rowOffsets[i1+1]-rowOffsets[i1]; };
+        for( Int iStart=0; iStart<numRows; iStart+=sortWindow )
+        {
+            const Int iEnd = Min( iStart+sortWindow, numRows );
+            std::stable_sort
+            ( rowPerm.begin()+iStart, rowPerm.begin()+iEnd, longer );
+        }
+
+        // The trailing rows of the last chunk are padded with empty rows
+        const Int numChunks = (numRows+chunkHeight-1)/chunkHeight;
+        rowLengths.resize( numChunks*chunkHeight );
+        for( Int i=0; i<numRows; ++i )
+            rowLengths[i] = rowOffsets[rowPerm[i]+1] - rowOffsets[rowPerm[i]];
+        for( Int i=numRows; i<numChunks*chunkHeight; ++i )
+            rowLengths[i] = 0;
+
+        // Count the padded size of each chunk
+        chunkOffsets.resize( numChunks+1 );
+        Int offset = 0;
+        for( Int chunk=0; chunk<numChunks; ++chunk )
+        {
+            chunkOffsets[chunk] = offset;
+            const Int iStart = chunk*chunkHeight;
+            Int chunkWidth = 0;
+            for( Int i=iStart; i<iStart+chunkHeight; ++i )
+                chunkWidth = Max( chunkWidth, rowLengths[i] );
+            offset += chunkWidth*chunkHeight;
+        }
+        chunkOffsets[numChunks] = offset;
+
+        // Fill each chunk in column-major order
+        targets.resize( offset );
+        values.resize( offset );
+        for( Int chunk=0; chunk<numChunks; ++chunk )
+        {
+            const Int chunkOffset = chunkOffsets[chunk];
+            const Int chunkWidth = ChunkWidth( chunk );
+            for( Int r=0; r<chunkHeight; ++r )
+            {
+                const Int i = chunk*chunkHeight + r;
+                const Int rowLength = rowLengths[i];
+                const Int rowOffset =
+                  ( i < numRows ? rowOffsets[rowPerm[i]] : 0 );
+                for( Int k=0; k<chunkWidth; ++k )
+                {
+                    const Int slot = chunkOffset + k*chunkHeight + r;
+                    if( k < rowLength )
+                    {
+                        targets[slot] = colIndices[rowOffset+k];
+                        values[slot] = vals[rowOffset+k];
+                    }
+                    else
+                    {
+                        targets[slot] = 0;
+                        values[slot] = 0;
+                    }
+                }
+            }
+        }
+        ready = true;
+    }
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_SLICEDELLPACK_HPP
@@ -0,0 +1,196 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_SPARSEASSEMBLY_HPP
+#define EL_CORE_SPARSEASSEMBLY_HPP
+
+namespace El {
+
+// Rows with at most this many queued entries are sorted by insertion
+const Int sparseAssemblyInsertionLength = 16;
+
+// Sort the (source,target,value) triplets, whose sources must lie in
+// [firstSource,firstSource+numSources), by source and then by target, and sum
+// the values of any duplicates. Rather than comparison sorting all of the
+// triplets at once, they are bucketed by source with a stable counting sort
+// and each (typically short) row is then sorted and compressed independently.
+// Both phases are split over blas::FallbackThreads() threads when there are at
+// least blas::FallbackThreshold() triplets.
+template<typename Ring>
+void AssembleTriplets
+( Int firstSource,
+  Int numSources,
+  vector<Int>& sources,
+  vector<Int>& targets,
+  vector<Ring>& values )
+{
+    EL_DEBUG_CSE
+    const Int numEntries = sources.size();
+    EL_DEBUG_ONLY(
+      if( Int(targets.size()) != numEntries ||
+          Int(values.size()) != numEntries )
+          LogicError("Inconsistent triplet buffer sizes");
+      for( Int e=0; e<numEntries; ++e )
+          if( sources[e] < firstSource ||
+              sources[e] >= firstSource+numSources )
+              LogicError
+              ("Source ",sources[e]," was not in [",firstSource,",",
+               firstSource+numSources,")");
+    )
+    if( numEntries == 0 )
+        return;
+    int numThreads = 1;
+#ifdef EL_HYBRID
+    if( double(numEntries) >= blas::FallbackThreshold() && !omp_in_parallel() )
+    {
+        // Keep the per-thread histograms no larger than the triplets
+        numThreads = blas::FallbackThreads();
+        numThreads = Max( Min( Int(numThreads), numEntries/numSources ), 1 );
+    }
+#endif
+
+    // Count the entries of each source within each thread's contiguous
+    // portion of the triplets
+    // ==================================================================
+    vector<Int> entrySplits( numThreads+1 );
+    for( int t=0; t<=numThreads; ++t )
+        entrySplits[t] = (numEntries*t) / numThreads;
+    vector<Int> counts( Int(numThreads)*numSources, 0 );
+#ifdef EL_HYBRID
+    _Pragma("omp parallel for num_threads(numThreads)")
+#endif
+    for( int t=0; t<numThreads; ++t )
+    {
+        Int* threadCounts = &counts[Int(t)*numSources];
+        for( Int e=entrySplits[t]; e<entrySplits[t+1]; ++e )
+            ++threadCounts[sources[e]-firstSource];
+    }
+
+    // Turn the counts into the (stable) destinations of each thread
+    // =============================================================
+    vector<Int> rowOffsets( numSources+1 );
+    Int offset = 0;
+    for( Int i=0; i<numSources; ++i )
+    {
+        rowOffsets[i] = offset;
+        for( int t=0; t<numThreads; ++t )
+        {
+            const Int count = counts[Int(t)*numSources+i];
+            counts[Int(t)*numSources+i] = offset;
+            offset += count;
+        }
+    }
+    rowOffsets[numSources] = offset;
+
+    // Bucket the targets and values by source
+    // =======================================
+    vector<Int> bucketTargets;
+    vector<Ring> bucketValues;
+    FastResize( bucketTargets, numEntries );
+    FastResize( bucketValues, numEntries );
+#ifdef EL_HYBRID
+    _Pragma("omp parallel for num_threads(numThreads)")
+#endif
+    for( int t=0; t<numThreads; ++t )
+    {
+        Int* threadOffsets = &counts[Int(t)*numSources];
+        for( Int e=entrySplits[t]; e<entrySplits[t+1]; ++e )
+        {
+            const Int dest = threadOffsets[sources[e]-firstSource]++;
+            bucketTargets[dest] = targets[e];
+            bucketValues[dest] = values[e];
+        }
+    }
+
+    // Sort each row by target and sum its duplicates in place
+    // =======================================================
+    vector<Int> uniqueCounts( numSources );
+#ifdef EL_HYBRID
+    _Pragma("omp parallel for schedule(dynamic,64) num_threads(numThreads)")
+#endif
+    for( Int i=0; i<numSources; ++i )
+    {
+        const Int rowStart = rowOffsets[i];
+        const Int rowLength = rowOffsets[i+1] - rowStart;
+        Int* rowTargets = &bucketTargets[rowStart];
+        Ring* rowValues = &bucketValues[rowStart];
+        if( rowLength <= sparseAssemblyInsertionLength )
+        {
+            for( Int k=1; k<rowLength; ++k )
+            {
+                const Int target = rowTargets[k];
+                const Ring value = rowValues[k];
+                Int l = k;
+                for( ; l>0 && rowTargets[l-1]>target; --l )
+                {
+                    rowTargets[l] = rowTargets[l-1];
+                    rowValues[l] = rowValues[l-1];
+                }
+                rowTargets[l] = target;
+                rowValues[l] = value;
+            }
+        }
+        else
+        {
+            vector<ValueInt<Int>> order( rowLength );
+            for( Int k=0; k<rowLength; ++k )
+                order[k] = ValueInt<Int>{rowTargets[k],k};
+            std::stable_sort
+            ( order.begin(), order.end(), ValueInt<Int>::Lesser );
+            vector<Ring> sortedValues( rowLength );
+            for( Int k=0; k<rowLength; ++k )
+            {
+                rowTargets[k] = order[k].value;
+                sortedValues[k] = rowValues[order[k].index];
+            }
+            std::copy( sortedValues.begin(), sortedValues.end(), rowValues );
+        }
+
+        Int numUnique = 0;
+        for( Int k=0; k<rowLength; ++k )
+        {
+            if( numUnique > 0 && rowTargets[k] == rowTargets[numUnique-1] )
+            {
+                rowValues[numUnique-1] += rowValues[k];
+            }
+            else
+            {
+                rowTargets[numUnique] = rowTargets[k];
+                rowValues[numUnique] = rowValues[k];
+                ++numUnique;
+            }
+        }
+        uniqueCounts[i] = numUnique;
+    }
+
+    // Gather the compressed rows back into the triplet buffers
+    // ========================================================
+    vector<Int> uniqueOffsets;
+    const Int totalUnique = Scan( uniqueCounts, uniqueOffsets );
+    sources.resize( totalUnique );
+    targets.resize( totalUnique );
+    values.resize( totalUnique );
+#ifdef EL_HYBRID
+    _Pragma("omp parallel for schedule(dynamic,64) num_threads(numThreads)")
+#endif
+    for( Int i=0; i<numSources; ++i )
+    {
+        const Int rowStart = rowOffsets[i];
+        const Int uniqueOffset = uniqueOffsets[i];
+        for( Int k=0; k<uniqueCounts[i]; ++k )
+        {
+            sources[uniqueOffset+k] = firstSource + i;
+            targets[uniqueOffset+k] = bucketTargets[rowStart+k];
+            values[uniqueOffset+k] = bucketValues[rowStart+k];
+        }
+    }
+}
+
+} // namespace El
+
+#endif // ifndef EL_CORE_SPARSEASSEMBLY_HPP
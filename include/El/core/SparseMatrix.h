@@ -83,6 +83,28 @@ EL_EXPORT ElError ElSparseMatrixReserve_c
 EL_EXPORT ElError ElSparseMatrixReserve_z
 ( ElSparseMatrix_z A, ElInt numEntries );
 
+/* Copy the given compressed rows (whose column indices must be sorted and
+   unique within each row) and adopt them, as with
+   void SparseMatrix<T>::AdoptCompressedRows
+   ( Int height, Int width,
+     vector<Int>&& offsets, vector<Int>&& cols, vector<T>&& values )
+   --------------------------------------------------------------------- */
+EL_EXPORT ElError ElSparseMatrixSetCompressedRows_i
+( ElSparseMatrix_i A, ElInt height, ElInt width,
+  const ElInt* offsets, const ElInt* cols, const ElInt* values );
+EL_EXPORT ElError ElSparseMatrixSetCompressedRows_s
+( ElSparseMatrix_s A, ElInt height, ElInt width,
+  const ElInt* offsets, const ElInt* cols, const float* values );
+EL_EXPORT ElError ElSparseMatrixSetCompressedRows_d
+( ElSparseMatrix_d A, ElInt height, ElInt width,
+  const ElInt* offsets, const ElInt* cols, const double* values );
+EL_EXPORT ElError ElSparseMatrixSetCompressedRows_c
+( ElSparseMatrix_c A, ElInt height, ElInt width,
+  const ElInt* offsets, const ElInt* cols, const complex_float* values );
+EL_EXPORT ElError ElSparseMatrixSetCompressedRows_z
+( ElSparseMatrix_z A, ElInt height, ElInt width,
+  const ElInt* offsets, const ElInt* cols, const complex_double* values );
+
 /* void SparseMatrix<T>::Update( Int row, Int col, T value )
    --------------------------------------------------------- */
 EL_EXPORT ElError ElSparseMatrixUpdate_i
@@ -122,6 +144,25 @@ EL_EXPORT ElError ElSparseMatrixQueueUpdate_c
 EL_EXPORT ElError ElSparseMatrixQueueUpdate_z
 ( ElSparseMatrix_z A, ElInt row, ElInt col, complex_double value );
 
+/* Queue a batch of (row,col,value) triplets, as with
+   void SparseMatrix<T>::QueueUpdate( Int row, Int col, T value )
+   -------------------------------------------------------------- */
+EL_EXPORT ElError ElSparseMatrixQueueUpdates_i
+( ElSparseMatrix_i A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const ElInt* values );
+EL_EXPORT ElError ElSparseMatrixQueueUpdates_s
+( ElSparseMatrix_s A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const float* values );
+EL_EXPORT ElError ElSparseMatrixQueueUpdates_d
+( ElSparseMatrix_d A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const double* values );
+EL_EXPORT ElError ElSparseMatrixQueueUpdates_c
+( ElSparseMatrix_c A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const complex_float* values );
+EL_EXPORT ElError ElSparseMatrixQueueUpdates_z
+( ElSparseMatrix_z A, ElInt numUpdates,
+  const ElInt* rows, const ElInt* cols, const complex_double* values );
+
 /* void SparseMatrix<T>::QueueZero( Int row, Int col )
    --------------------------------------------------- */
 EL_EXPORT ElError ElSparseMatrixQueueZero_i
@@ -388,6 +429,32 @@ EL_EXPORT ElError ElSparseMatrixLockedValueBuffer_c
 EL_EXPORT ElError ElSparseMatrixLockedValueBuffer_z
 ( ElConstSparseMatrix_z A, const complex_double** valueBuffer );
 
+/* Int* SparseMatrix<T>::OffsetBuffer()
+   ------------------------------------ */
+EL_EXPORT ElError ElSparseMatrixOffsetBuffer_i
+( ElSparseMatrix_i A, ElInt** offsetBuffer );
+EL_EXPORT ElError ElSparseMatrixOffsetBuffer_s
+( ElSparseMatrix_s A, ElInt** offsetBuffer );
+EL_EXPORT ElError ElSparseMatrixOffsetBuffer_d
+( ElSparseMatrix_d A, ElInt** offsetBuffer );
+EL_EXPORT ElError ElSparseMatrixOffsetBuffer_c
+( ElSparseMatrix_c A, ElInt** offsetBuffer );
+EL_EXPORT ElError ElSparseMatrixOffsetBuffer_z
+( ElSparseMatrix_z A, ElInt** offsetBuffer );
+
+/* const Int* SparseMatrix<T>::LockedOffsetBuffer() const
+   ------------------------------------------------------ */
+EL_EXPORT ElError ElSparseMatrixLockedOffsetBuffer_i
+( ElConstSparseMatrix_i A, const ElInt** offsetBuffer );
+EL_EXPORT ElError ElSparseMatrixLockedOffsetBuffer_s
+( ElConstSparseMatrix_s A, const ElInt** offsetBuffer );
+EL_EXPORT ElError ElSparseMatrixLockedOffsetBuffer_d
+( ElConstSparseMatrix_d A, const ElInt** offsetBuffer );
+EL_EXPORT ElError ElSparseMatrixLockedOffsetBuffer_c
+( ElConstSparseMatrix_c A, const ElInt** offsetBuffer );
+EL_EXPORT ElError ElSparseMatrixLockedOffsetBuffer_z
+( ElConstSparseMatrix_z A, const ElInt** offsetBuffer );
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -32,6 +32,10 @@ public:
     // ============================
     SparseMatrix();
     SparseMatrix( Int height, Int width );
+    // Adopt existing compressed rows (see AdoptCompressedRows)
+    SparseMatrix
+    ( Int height, Int width,
+      vector<Int>&& offsets, vector<Int>&& cols, vector<Ring>&& values );
     SparseMatrix( const SparseMatrix<Ring>& A );
     // NOTE: This requires A to be distributed over a single process
     SparseMatrix( const DistSparseMatrix<Ring>& A );
@@ -50,10 +54,30 @@ public:
     // --------
     void Reserve( Int numEntries );
 
+    // Become a height x width matrix by taking ownership of existing compressed
+    // rows. The column indices of each row must be sorted and unique; they are
+    // validated (in linear time) but neither copied nor sorted.
+    void AdoptCompressedRows
+    ( Int height, Int width,
+      vector<Int>&& offsets, vector<Int>&& cols, vector<Ring>&& values );
+
     void FreezeSparsity() EL_NO_EXCEPT;
     void UnfreezeSparsity() EL_NO_EXCEPT;
     bool FrozenSparsity() const EL_NO_EXCEPT;
 
+    // Once the sparsity is frozen, (non-transposed) products with a matrix
+    // that has the sliced ELLPACK format enabled use a lazily-formed
+    // SELL-C-sigma copy, which is discarded when the matrix is modified
+    void EnableSlicedEllpack( Int chunkHeight=8, Int sortWindow=256 );
+    void DisableSlicedEllpack();
+    bool SlicedEllpackEnabled() const EL_NO_EXCEPT;
+    const El::SlicedEllpack<Ring>& LockedSlicedEllpack() const;
+
+    // The level schedule of the given triangle of a consistent, square matrix
+    // for use in sparse triangular solves. It is lazily formed and only
+    // discarded when the sparsity pattern may have changed.
+    const El::LevelSchedule& LockedLevelSchedule( UpperOrLower uplo ) const;
+
     // Expensive independent updates and explicit zeroing
     // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
     void Update( const Entry<Ring>& entry );
@@ -140,6 +164,8 @@ public:
 private:
     El::Graph graph_;
     vector<Ring> vals_;
+    mutable El::SlicedEllpack<Ring> sell_;
+    mutable El::LevelSchedule levels_;
 
     struct CompareEntriesFunctor
     {
@@ -35,6 +35,16 @@ SparseMatrix<Ring>::SparseMatrix( Int height, Int width )
 : graph_(height,width)
 { }
 
+template<typename Ring>
+SparseMatrix<Ring>::SparseMatrix
+( Int height, Int width,
+  vector<Int>&& offsets, vector<Int>&& cols, vector<Ring>&& values )
+{
+    EL_DEBUG_CSE
+    AdoptCompressedRows
+    ( height, width, std::move(offsets), std::move(cols), std::move(values) );
+}
+
 template<typename Ring>
 SparseMatrix<Ring>::SparseMatrix( const SparseMatrix<Ring>& A )
 {
@@ -68,6 +78,8 @@ void SparseMatrix<Ring>::Empty( bool clearMemory )
         SwapClear( vals_ );
     else
         vals_.resize( 0 );
+    sell_.Clear();
+    levels_.Clear();
 }
 
 template<typename Ring>
@@ -78,6 +90,8 @@ void SparseMatrix<Ring>::Resize( Int height, Int width )
         return;
     graph_.Resize( height, width );
     vals_.resize( 0 );
+    sell_.Clear();
+    levels_.Clear();
 }
 
 // Assembly
@@ -90,16 +104,94 @@ void SparseMatrix<Ring>::Reserve( Int numEntries )
     vals_.reserve( currSize+numEntries );
 }
 
+template<typename Ring>
+void SparseMatrix<Ring>::AdoptCompressedRows
+( Int height, Int width,
+  vector<Int>&& offsets, vector<Int>&& cols, vector<Ring>&& values )
+{
+    EL_DEBUG_CSE
+    if( values.size() != cols.size() )
+        LogicError
+        ("There were ",cols.size()," column indices but ",values.size(),
+         " values");
+    graph_.AdoptCompressedRows
+    ( height, width, std::move(offsets), std::move(cols) );
+    vals_ = std::move( values );
+    sell_.Clear();
+    levels_.Clear();
+}
+
 template<typename Ring>
 void SparseMatrix<Ring>::FreezeSparsity() EL_NO_EXCEPT
 { graph_.frozenSparsity_ = true; }
 template<typename Ring>
 void SparseMatrix<Ring>::UnfreezeSparsity() EL_NO_EXCEPT
-{ graph_.frozenSparsity_ = false; }
+{
+    graph_.frozenSparsity_ = false;
+    sell_.ready = false;
+}
 template<typename Ring>
 bool SparseMatrix<Ring>::FrozenSparsity() const EL_NO_EXCEPT
 { return graph_.frozenSparsity_; }
 
+template<typename Ring>
+void SparseMatrix<Ring>::EnableSlicedEllpack( Int chunkHeight, Int sortWindow )
+{
+    EL_DEBUG_CSE
+    if( chunkHeight < 1 || chunkHeight > maxSlicedEllpackChunkHeight )
+        LogicError
+        ("Chunk heights must be in [1,",maxSlicedEllpackChunkHeight,"]");
+    if( sortWindow < 1 )
+        LogicError("The sorting window must be positive");
+    if( sell_.chunkHeight != chunkHeight || sell_.sortWindow != sortWindow )
+        sell_.Clear();
+    sell_.enabled = true;
+    sell_.chunkHeight = chunkHeight;
+    sell_.sortWindow = sortWindow;
+}
+
+template<typename Ring>
+void SparseMatrix<Ring>::DisableSlicedEllpack()
+{
+    EL_DEBUG_CSE
+    sell_.Clear();
+    sell_.enabled = false;
+}
+
+template<typename Ring>
+bool SparseMatrix<Ring>::SlicedEllpackEnabled() const EL_NO_EXCEPT
+{ return sell_.enabled; }
+
+template<typename Ring>
+const El::SlicedEllpack<Ring>& SparseMatrix<Ring>::LockedSlicedEllpack() const
+{
+    EL_DEBUG_CSE
+    if( !FrozenSparsity() )
+        LogicError("The sliced ELLPACK format requires a frozen sparsity");
+    if( !Consistent() )
+        LogicError("Sparse matrix must be consistent");
+    if( !sell_.ready )
+        sell_.Build
+        ( Height(), LockedOffsetBuffer(), LockedTargetBuffer(),
+          LockedValueBuffer() );
+    return sell_;
+}
+
+template<typename Ring>
+const El::LevelSchedule&
+SparseMatrix<Ring>::LockedLevelSchedule( UpperOrLower uplo ) const
+{
+    EL_DEBUG_CSE
+    if( Height() != Width() )
+        LogicError("Level schedules require a square matrix");
+    if( !Consistent() )
+        LogicError("Sparse matrix must be consistent");
+    if( !levels_.ready || levels_.uplo != uplo )
+        levels_.Build
+        ( uplo, Height(), LockedOffsetBuffer(), LockedTargetBuffer() );
+    return levels_;
+}
+
 template<typename Ring>
 void SparseMatrix<Ring>::Update( Int row, Int col, const Ring& value )
 {
@@ -125,6 +217,7 @@ void SparseMatrix<Ring>::QueueUpdate( Int row, Int col, const Ring& value )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    sell_.ready = false;
     if( FrozenSparsity() )
     {
         const Int offset = Offset( row, col );
@@ -147,6 +240,7 @@ void SparseMatrix<Ring>::QueueZero( Int row, Int col )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    sell_.ready = false;
     if( FrozenSparsity() )
     {
         const Int offset = Offset( row, col );
@@ -169,6 +263,8 @@ const SparseMatrix<Ring>& SparseMatrix<Ring>::operator=( const SparseMatrix<Ring
     EL_DEBUG_CSE
     graph_ = A.graph_;
     vals_ = A.vals_;
+    sell_ = A.sell_;
+    levels_ = A.levels_;
     return *this;
 }
 
@@ -182,6 +278,8 @@ SparseMatrix<Ring>::operator=( const DistSparseMatrix<Ring>& A )
 
     graph_ = A.distGraph_;
     vals_ = A.vals_;
+    sell_.Clear();
+    levels_.Clear();
     return *this;
 }
 
@@ -289,7 +387,11 @@ bool SparseMatrix<Ring>::Consistent() const EL_NO_EXCEPT
 
 template<typename Ring>
 El::Graph& SparseMatrix<Ring>::Graph() EL_NO_EXCEPT
-{ return graph_; }
+{
+    sell_.ready = false;
+    levels_.ready = false;
+    return graph_;
+}
 template<typename Ring>
 const El::Graph& SparseMatrix<Ring>::LockedGraph() const EL_NO_EXCEPT
 { return graph_; }
@@ -361,6 +463,7 @@ void SparseMatrix<Ring>::Set
     if( row == END ) row = graph_.numSources_ - 1;
     if( col == END ) col = graph_.numTargets_ - 1;
     Int index = Offset( row, col );
+    sell_.ready = false;
     if( Row(index) == row && Col(index) == col )
     {
         vals_[index] = val;
@@ -372,18 +475,35 @@ void SparseMatrix<Ring>::Set
     }
 }
 
+// NOTE: Mutable access to the buffers discards the sliced ELLPACK copy, and
+//       mutable access to the pattern also discards the level schedule
 template<typename Ring>
 Int* SparseMatrix<Ring>::SourceBuffer() EL_NO_EXCEPT
-{ return graph_.SourceBuffer(); }
+{
+    sell_.ready = false;
+    levels_.ready = false;
+    return graph_.SourceBuffer();
+}
 template<typename Ring>
 Int* SparseMatrix<Ring>::TargetBuffer() EL_NO_EXCEPT
-{ return graph_.TargetBuffer(); }
+{
+    sell_.ready = false;
+    levels_.ready = false;
+    return graph_.TargetBuffer();
+}
 template<typename Ring>
 Int* SparseMatrix<Ring>::OffsetBuffer() EL_NO_EXCEPT
-{ return graph_.OffsetBuffer(); }
+{
+    sell_.ready = false;
+    levels_.ready = false;
+    return graph_.OffsetBuffer();
+}
 template<typename Ring>
 Ring* SparseMatrix<Ring>::ValueBuffer() EL_NO_EXCEPT
-{ return vals_.data(); }
+{
+    sell_.ready = false;
+    return vals_.data();
+}
 
 template<typename Ring>
 const Int* SparseMatrix<Ring>::LockedSourceBuffer() const EL_NO_EXCEPT
@@ -404,11 +524,17 @@ void SparseMatrix<Ring>::ForceNumEntries( Int numEntries )
     EL_DEBUG_CSE
     graph_.ForceNumEdges( numEntries );
     vals_.resize( numEntries );
+    sell_.ready = false;
+    levels_.ready = false;
 }
 
 template<typename Ring>
 void SparseMatrix<Ring>::ForceConsistency( bool consistent ) EL_NO_EXCEPT
-{ graph_.ForceConsistency( consistent ); }
+{
+    graph_.ForceConsistency( consistent );
+    sell_.ready = false;
+    levels_.ready = false;
+}
 
 // Auxiliary routines
 // ==================
@@ -424,62 +550,32 @@ void SparseMatrix<Ring>::ProcessQueues()
     )
     if( graph_.consistent_ )
         return;
+    sell_.ready = false;
+    levels_.ready = false;
 
-    Int numRemoved = 0;
-    const Int numEntries = vals_.size();
-    vector<Entry<Ring>> entries( numEntries );
     if( graph_.markedForRemoval_.size() != 0 )
     {
+        const Int numEntries = vals_.size();
+        Int numKept = 0;
         for( Int s=0; s<numEntries; ++s )
         {
             pair<Int,Int> candidate(graph_.sources_[s],graph_.targets_[s]);
             if( graph_.markedForRemoval_.find(candidate) ==
                 graph_.markedForRemoval_.end() )
             {
-                entries[s-numRemoved].i = graph_.sources_[s];
-                entries[s-numRemoved].j = graph_.targets_[s];
-                entries[s-numRemoved].value = vals_[s];
-            }
-            else
-            {
-                ++numRemoved;
+                graph_.sources_[numKept] = graph_.sources_[s];
+                graph_.targets_[numKept] = graph_.targets_[s];
+                vals_[numKept] = vals_[s];
+                ++numKept;
             }
         }
         graph_.markedForRemoval_.clear();
-        entries.resize( numEntries-numRemoved );
-    }
-    else
-    {
-        for( Int s=0; s<numEntries; ++s )
-            entries[s] =
-              Entry<Ring>{graph_.sources_[s],graph_.targets_[s],vals_[s]};
-    }
-    CompareEntriesFunctor comparer;
-    std::sort( entries.begin(), entries.end(), comparer );
-    const Int numSorted = entries.size();
-
-    // Compress out duplicates
-    Int lastUnique=0;
-    for( Int s=1; s<numSorted; ++s )
-    {
-        if( entries[s].i != entries[lastUnique].i ||
-            entries[s].j != entries[lastUnique].j )
-            entries[++lastUnique] = entries[s];
-        else
-            entries[lastUnique].value += entries[s].value;
-    }
-    const Int numUnique = lastUnique+1;
-    entries.resize( numUnique );
-
-    graph_.sources_.resize( numUnique );
-    graph_.targets_.resize( numUnique );
-    vals_.resize( numUnique );
-    for( Int s=0; s<numUnique; ++s )
-    {
-        graph_.sources_[s] = entries[s].i;
-        graph_.targets_[s] = entries[s].j;
-        vals_[s] = entries[s].value;
+        graph_.sources_.resize( numKept );
+        graph_.targets_.resize( numKept );
+        vals_.resize( numKept );
     }
+    AssembleTriplets
+    ( Int(0), graph_.numSources_, graph_.sources_, graph_.targets_, vals_ );
 
     graph_.ComputeSourceOffsets();
     graph_.consistent_ = true;
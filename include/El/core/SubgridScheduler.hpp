@@ -0,0 +1,134 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_SUBGRIDSCHEDULER_HPP
+#define EL_CORE_SUBGRIDSCHEDULER_HPP
+
+namespace El {
+
+// Concurrent execution of tasks over disjoint subgrids
+// ====================================================
+// The VC ranks of a grid are split into 'numSubgrids' contiguous (and
+// nearly equally-sized) subgrids, each of which is viewed by the viewing
+// communicator of the parent grid, so that matrices may be copied between
+// the parent and any subgrid, or between any two subgrids, with Copy (which
+// falls back to TranslateBetweenGrids).
+//
+// Tasks form a DAG, as each task may only depend upon previously added
+// tasks. Run() executes the DAG one level at a time, where the level of a
+// task is one more than the maximum level of its dependencies; the tasks of
+// each level are greedily assigned to the least-loaded subgrid (as measured
+// by the sum of their costs) and run concurrently. A task is only executed
+// by the processes of its subgrid, and so it should only communicate over
+// the subgrid that it is passed.
+//
+// Data is moved onto and off of the subgrids with the inputs and outputs of
+// each task: the inputs of a level are redistributed onto the assigned
+// subgrids before its tasks are run, and the outputs afterwards, with both
+// being collective over the viewing communicator of the parent grid. Every
+// process must therefore add the same tasks, with the same dependencies,
+// costs, inputs, and outputs, in the same order.
+class SubgridScheduler
+{
+public:
+    typedef std::function<void(const El::Grid&)> Task;
+
+    // Collective over the viewing communicator of 'grid'
+    SubgridScheduler( const El::Grid& grid, int numSubgrids );
+
+    const El::Grid& Grid() const EL_NO_EXCEPT;
+    int NumSubgrids() const EL_NO_EXCEPT;
+    const El::Grid& Subgrid( int subgrid ) const;
+    // The subgrid containing our process (mpi::UNDEFINED if not in the grid)
+    int MySubgrid() const EL_NO_EXCEPT;
+
+    // Add a task which may only begin after the given tasks have completed
+    // and return its index
+    Int AddTask
+    ( Task task, const vector<Int>& dependencies=vector<Int>(),
+      double cost=1 );
+
+    // Before running the task, reset ASub onto its subgrid and copy A into it
+    template<typename T>
+    void AddInput
+    ( Int task, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& ASub );
+    // After running the task, copy ASub (which was resized over the subgrid
+    // of the task) into A, which may live over any grid viewed by the
+    // viewing communicator of the parent grid
+    template<typename T>
+    void AddOutput
+    ( Int task, const AbstractDistMatrix<T>& ASub, AbstractDistMatrix<T>& A );
+
+    Int NumTasks() const EL_NO_EXCEPT;
+    // The subgrid that the given task is (or was) to be run on; the
+    // assignment is only final once the task has been added
+    int Assignment( Int task ) const;
+
+    // Run every task which has not yet been run
+    void Run();
+
+private:
+    typedef std::function<void(const El::Grid&)> Transfer;
+
+    struct TaskInfo
+    {
+        Task task;
+        Int level;
+        int subgrid;
+        bool ran;
+        vector<Transfer> inputs, outputs;
+    };
+
+    const El::Grid* grid_;
+    vector<unique_ptr<El::Grid>> subgrids_;
+    int mySubgrid_;
+    vector<TaskInfo> tasks_;
+    // The accumulated cost of each subgrid within each level
+    vector<vector<double>> levelLoads_;
+
+    void AddTransfer( Int task, Transfer transfer, bool input );
+};
+
+template<typename T>
+void SubgridScheduler::AddInput
+( Int task, const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& ASub )
+{
+    EL_DEBUG_CSE
+    const AbstractDistMatrix<T>* APtr = &A;
+    AbstractDistMatrix<T>* ASubPtr = &ASub;
+    AddTransfer
+    ( task,
+      [=]( const El::Grid& subgrid )
+      {
+          ASubPtr->SetGrid( subgrid );
+          Copy( *APtr, *ASubPtr );
+      },
+      true );
+}
+
+template<typename T>
+void SubgridScheduler::AddOutput
+( Int task, const AbstractDistMatrix<T>& ASub, AbstractDistMatrix<T>& A )
+{
+    EL_DEBUG_CSE
+    const AbstractDistMatrix<T>* ASubPtr = &ASub;
+    AbstractDistMatrix<T>* APtr = &A;
+    AddTransfer
+    ( task,
+      [=]( const El::Grid& subgrid )
+      {
+          if( ASubPtr->Grid() != subgrid )
+              LogicError("Task output was not over the subgrid of its task");
+          Copy( *ASubPtr, *APtr );
+      },
+      false );
+}
+
+} // namespace El
+
+#endif // ifndef EL_CORE_SUBGRIDSCHEDULER_HPP
@@ -42,6 +42,158 @@ private:
     Clock::time_point lastTime_;
 };
 
+// Hierarchical region timers
+// ==========================
+// Nested, named regions (typically opened with EL_REGION) aggregate the
+// number of calls and the inclusive and exclusive time spent within each
+// distinct path of the region tree. When tracing is also enabled, each
+// completed region is additionally recorded as a Chrome trace event so that
+// a timeline can be viewed in chrome://tracing or Perfetto.
+//
+// Both are disabled by default and cost a single branch per region when
+// disabled. Setting the environment variable EL_REGION_TRACE=<prefix>
+// enables both within El::Initialize and writes each process's trace to
+// <prefix>.<rank>.json during El::Finalize.
+
+struct RegionProfile
+{
+    string path; // the names of the enclosing regions, separated by '/'
+    Int depth;
+    Int numCalls;
+    double inclusive;
+    double exclusive;
+};
+
+void EnableRegionTimers( bool enable=true );
+bool RegionTimersEnabled() EL_NO_EXCEPT;
+void EnableRegionTrace( bool enable=true );
+bool RegionTraceEnabled() EL_NO_EXCEPT;
+
+void PushRegion( const char* name );
+void PopRegion();
+
+// The path of the innermost open region of the master thread (empty if there
+// is none or if called from another thread)
+string CurrentRegionPath();
+
+// Discard the aggregated timings and trace events (the regions which are
+// currently open are unaffected)
+void ResetRegions();
+
+// The aggregated statistics in depth-first order
+vector<RegionProfile> RegionProfiles();
+void PrintRegionProfiles( ostream& os=cout );
+void WriteRegionTrace( const string& filename );
+
+// A region which is closed when it goes out of scope
+class Region
+{
+public:
+    explicit Region( const char* name )
+    : active_(RegionTimersEnabled())
+    { if( active_ ) PushRegion( name ); }
+    ~Region() { if( active_ ) PopRegion(); }
+private:
+    bool active_;
+
+    Region( const Region& );
+    const Region& operator=( const Region& );
+};
+
+#define EL_REGION(name) El::Region EL_CONCAT(elRegion,__LINE__)(name)
+
+// Flop and memory-traffic counters
+// ================================
+// When enabled, the Level 2 and 3 BLAS wrappers (and the custom Level 3
+// kernels for the remaining datatypes), the LAPACK Hessenberg reductions,
+// and the local sparse matrix products add their nominal number of
+// floating-point operations (two per real multiply-add, eight per complex
+// multiply-add) and the number of bytes of operands which they read and
+// write to counters owned by the calling thread. Work which is spread over
+// OpenMP threads by a single call is attributed to the calling thread.
+//
+// The counters are disabled by default and then cost a single branch per
+// kernel. Combined with the collective profile (see mpi::Profile), they
+// give the achieved rates and arithmetic intensities of each phase of an
+// application, e.g., for roofline-style reports.
+
+struct KernelCounts
+{
+    double flops=0;
+    double bytes=0;
+
+    KernelCounts& operator+=( const KernelCounts& counts )
+    { flops += counts.flops; bytes += counts.bytes; return *this; }
+    KernelCounts& operator-=( const KernelCounts& counts )
+    { flops -= counts.flops; bytes -= counts.bytes; return *this; }
+};
+
+void EnableKernelCounters( bool enable=true );
+bool KernelCountersEnabled() EL_NO_EXCEPT;
+
+// The totals of the calling thread since it started (or since its last
+// call to ResetKernelCounts)
+KernelCounts ThreadKernelCounts() EL_NO_EXCEPT;
+void ResetKernelCounts() EL_NO_EXCEPT;
+void AddKernelCounts( double flops, double bytes ) EL_NO_EXCEPT;
+
+// Count 'numMultiplyAdds' multiply-adds over T which read or write
+// 'numEntries' entries of T (and 'extraBytes' other bytes, e.g., indices)
+template<typename T>
+inline void CountKernel
+( double numMultiplyAdds, double numEntries, double extraBytes=0 )
+EL_NO_EXCEPT
+{
+    if( KernelCountersEnabled() )
+        AddKernelCounts
+        ( (IsComplex<T>::value ? 8 : 2)*numMultiplyAdds,
+          sizeof(T)*numEntries + extraBytes );
+}
+
+// The counts and time of the calling thread since the construction of the
+// scope (or its last restart)
+class KernelCountScope
+{
+public:
+    KernelCountScope() { Restart(); }
+
+    void Restart()
+    {
+        start_ = ThreadKernelCounts();
+        timer_.Reset();
+        timer_.Start();
+    }
+
+    KernelCounts Counts() const
+    {
+        KernelCounts counts = ThreadKernelCounts();
+        counts -= start_;
+        return counts;
+    }
+    double Seconds() const { return timer_.Partial(); }
+
+    double GFlops() const
+    {
+        const double seconds = Seconds();
+        return ( seconds > 0 ? Counts().flops/(1.e9*seconds) : 0. );
+    }
+    double GBytesPerSecond() const
+    {
+        const double seconds = Seconds();
+        return ( seconds > 0 ? Counts().bytes/(1.e9*seconds) : 0. );
+    }
+    // The number of flops per byte of memory traffic
+    double ArithmeticIntensity() const
+    {
+        const KernelCounts counts = Counts();
+        return ( counts.bytes > 0 ? counts.flops/counts.bytes : 0. );
+    }
+
+private:
+    KernelCounts start_;
+    Timer timer_;
+};
+
 } // namespace El
 
 #endif // ifndef EL_TIMER_HPP
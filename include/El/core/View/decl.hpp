@@ -217,6 +217,41 @@ void LockedView
   const AbstractDistMatrix<T>& B, 
   Range<Int> I, Range<Int> J );
 
+// View a batch stored side-by-side
+// ================================
+// Return views of the 'batchSize' equally-sized blocks of columns of B
+template<typename T>
+vector<Matrix<T>> BatchView( Int batchSize, Matrix<T>& B );
+template<typename T>
+vector<Matrix<T>> LockedBatchView( Int batchSize, const Matrix<T>& B );
+
+// Orientation-tagged views
+// ========================
+// A lightweight pairing of a matrix with the orientation in which it is to be
+// applied, e.g., Gemm( alpha, TransposeView(A), NormalView(B), beta, C ), so
+// that op(A) is resolved by the BLAS-like routines rather than formed
+// explicitly
+template<typename MatrixType>
+struct OrientedView
+{
+    Orientation orientation;
+    const MatrixType& matrix;
+};
+
+template<typename T>
+OrientedView<Matrix<T>> NormalView( const Matrix<T>& A );
+template<typename T>
+OrientedView<Matrix<T>> TransposeView( const Matrix<T>& A );
+template<typename T>
+OrientedView<Matrix<T>> AdjointView( const Matrix<T>& A );
+
+template<typename T>
+OrientedView<ElementalMatrix<T>> NormalView( const ElementalMatrix<T>& A );
+template<typename T>
+OrientedView<ElementalMatrix<T>> TransposeView( const ElementalMatrix<T>& A );
+template<typename T>
+OrientedView<ElementalMatrix<T>> AdjointView( const ElementalMatrix<T>& A );
+
 } // namespace El
 
 #endif // ifndef EL_VIEW_DECL_HPP
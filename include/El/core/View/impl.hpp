@@ -706,6 +706,66 @@ void LockedView
     LockedView( A, B, I.beg, J.beg, I.end-I.beg, J.end-J.beg ); 
 }
 
+// View a batch stored side-by-side
+// ================================
+
+template<typename T>
+vector<Matrix<T>> BatchView( Int batchSize, Matrix<T>& B )
+{
+    EL_DEBUG_CSE
+    if( batchSize < 0 || (batchSize == 0 && B.Width() != 0) ||
+        (batchSize > 0 && B.Width() % batchSize != 0) )
+        LogicError
+        ("A width of ",B.Width()," cannot hold a batch of size ",batchSize);
+    const Int width = ( batchSize == 0 ? 0 : B.Width()/batchSize );
+    vector<Matrix<T>> views( batchSize );
+    for( Int b=0; b<batchSize; ++b )
+        View( views[b], B, 0, b*width, B.Height(), width );
+    return views;
+}
+
+template<typename T>
+vector<Matrix<T>> LockedBatchView( Int batchSize, const Matrix<T>& B )
+{
+    EL_DEBUG_CSE
+    if( batchSize < 0 || (batchSize == 0 && B.Width() != 0) ||
+        (batchSize > 0 && B.Width() % batchSize != 0) )
+        LogicError
+        ("A width of ",B.Width()," cannot hold a batch of size ",batchSize);
+    const Int width = ( batchSize == 0 ? 0 : B.Width()/batchSize );
+    vector<Matrix<T>> views( batchSize );
+    for( Int b=0; b<batchSize; ++b )
+        LockedView( views[b], B, 0, b*width, B.Height(), width );
+    return views;
+}
+
+// Orientation-tagged views
+// ========================
+
+template<typename T>
+OrientedView<Matrix<T>> NormalView( const Matrix<T>& A )
+{ return OrientedView<Matrix<T>>{ NORMAL, A }; }
+
+template<typename T>
+OrientedView<Matrix<T>> TransposeView( const Matrix<T>& A )
+{ return OrientedView<Matrix<T>>{ TRANSPOSE, A }; }
+
+template<typename T>
+OrientedView<Matrix<T>> AdjointView( const Matrix<T>& A )
+{ return OrientedView<Matrix<T>>{ ADJOINT, A }; }
+
+template<typename T>
+OrientedView<ElementalMatrix<T>> NormalView( const ElementalMatrix<T>& A )
+{ return OrientedView<ElementalMatrix<T>>{ NORMAL, A }; }
+
+template<typename T>
+OrientedView<ElementalMatrix<T>> TransposeView( const ElementalMatrix<T>& A )
+{ return OrientedView<ElementalMatrix<T>>{ TRANSPOSE, A }; }
+
+template<typename T>
+OrientedView<ElementalMatrix<T>> AdjointView( const ElementalMatrix<T>& A )
+{ return OrientedView<ElementalMatrix<T>>{ ADJOINT, A }; }
+
 #ifdef EL_INSTANTIATE_CORE
 # define EL_EXTERN
 #else
@@ -833,7 +893,13 @@ void LockedView
   EL_EXTERN template void LockedView \
   (       AbstractDistMatrix<T>& A, \
     const AbstractDistMatrix<T>& B, \
-    Range<Int> I, Range<Int> J );
+    Range<Int> I, Range<Int> J ); \
+  /* View a batch stored side-by-side
+     ================================ */ \
+  EL_EXTERN template vector<Matrix<T>> BatchView \
+  ( Int batchSize, Matrix<T>& B ); \
+  EL_EXTERN template vector<Matrix<T>> LockedBatchView \
+  ( Int batchSize, const Matrix<T>& B );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
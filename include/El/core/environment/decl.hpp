@@ -51,6 +51,12 @@ void Initialize( int& argc, char**& argv );
 void Finalize();
 bool Initialized();
 
+// The wall-clock time, in seconds, of the most recent outermost call to
+// El::Initialize (including MPI_Init when Elemental initialized MPI). If the
+// environment variable EL_INIT_TIME is set, El::Initialize also prints the
+// maximum of this time over the processes from the root of COMM_WORLD.
+double InitializationTime();
+
 // For initializing/finalizing Elemental using RAII
 class Environment
 {
@@ -93,6 +99,157 @@ void PushBlocksizeStack( Int blocksize );
 void PopBlocksizeStack();
 void EmptyBlocksizeStack();
 
+// For pushing a blocksize onto the stack for the lifetime of a scope, so that
+// it is popped even if an exception is thrown
+class BlocksizeGuard
+{
+public:
+    explicit BlocksizeGuard( Int blocksize );
+    ~BlocksizeGuard();
+    BlocksizeGuard( const BlocksizeGuard& ) = delete;
+    BlocksizeGuard& operator=( const BlocksizeGuard& ) = delete;
+};
+
+// For per-routine blocksizes tuned for a particular datatype and process grid
+// shape (see TuneBlocksizes). A tuned blocksize is only used while the global
+// blocksize has been neither set nor pushed, so that explicitly requested
+// blocksizes always take precedence; otherwise, or if no blocksize has been
+// tuned for the given routine, datatype, and grid shape, Blocksize() is used.
+//
+// If the environment variable EL_BLOCKSIZE_FILE is set, El::Initialize loads
+// the database from the file that it names.
+bool TunedBlocksizesActive();
+template<typename T>
+Int TunedBlocksize
+( const string& routine, int gridHeight=1, int gridWidth=1 );
+template<typename T>
+void SetTunedBlocksize
+( const string& routine, int gridHeight, int gridWidth, Int blocksize );
+void ClearTunedBlocksizes();
+// Each line of the file is of the form
+//   <routine> <datatype> <grid height> <grid width> <blocksize>
+// and only the root process of the communicator reads/writes the file
+void LoadTunedBlocksizes
+( const string& filename, mpi::Comm comm=mpi::COMM_WORLD );
+void SaveTunedBlocksizes
+( const string& filename, mpi::Comm comm=mpi::COMM_WORLD );
+
+// For controlling the threads used to (un)pack messages within the
+// redistribution routines (zero selects the OpenMP default); packing is only
+// threaded for messages with at least PackingThreshold() entries
+void SetPackingThreads( int numThreads );
+int PackingThreads();
+void SetPackingThreshold( Int numEntries );
+Int PackingThreshold();
+
+// Redistribution diagnostics
+// ==========================
+// When enabled, the redistributions record each "realignment", i.e., each
+// exchange which was only required because the alignments of the source and
+// target differed (as well as each Align call which discarded the data of a
+// matrix), and each redistribution which fell back to the general-purpose
+// (entry-by-entry) routine. Every event is attributed to the innermost open
+// region (see EL_REGION), so the region timers should also be enabled.
+// Initialize enables both if EL_REDIST_DIAGNOSTICS is defined, and Finalize
+// then writes the report to <EL_REDIST_DIAGNOSTICS>.<rank>.txt.
+struct RedistEvent
+{
+    string kind;     // either "realign" or "general-purpose"
+    string routine;  // e.g., "ColFilter" or "[MC,MR] -> [VC,STAR]"
+    string callSite; // the enclosing region path
+    Int numCalls=0;
+    double numBytes=0; // the total size of the redistributed matrices
+};
+
+void EnableRedistDiagnostics( bool enable=true );
+bool RedistDiagnosticsEnabled() EL_NO_EXCEPT;
+void RecordRedistEvent
+( const char* kind, const string& routine, double numBytes );
+void ResetRedistDiagnostics();
+vector<RedistEvent> RedistEvents();
+// The events sorted by their predicted cost (under the Gemm cost model, with
+// one message per call and the entire matrix passing through one link),
+// which is a pessimistic estimate of the time that avoiding them would save
+void PrintRedistDiagnostics( ostream& os=cout );
+
+// When set, the algorithms which redistribute the panels of an input into
+// workspaces aligned with another matrix within a loop (currently the Gemm
+// variant which keeps C stationary) instead realign the entire input once
+// beforehand, which replaces an extra exchange per panel with a single one at
+// the cost of a temporary copy of the input
+void SetPreAlignInputs( bool preAlign );
+bool PreAlignInputs();
+
+// Per-thread library state
+// ========================
+// The blocksize stack, the generator returned by Generator(), the output
+// indentation level, and (in debug builds) the call stack are members of a
+// Context. Each thread lazily constructs its own Context upon first use, so
+// that several threads may simultaneously run routines upon distinct objects
+// (e.g., many sequential factorizations); a thread may instead activate an
+// explicitly constructed Context via SetContext or a ContextGuard. A Context
+// must not be active on more than one thread at a time.
+//
+// The first Context, in practice that of the thread which calls
+// El::Initialize, is the main Context. Every other Context inherits the
+// blocksize stack of the main Context, so that worker threads follow the
+// SetBlocksize and PushBlocksizeStack calls of the main thread, until it
+// first modifies its own stack, at which point it takes a private copy of
+// the main stack.
+//
+// The generator of each Context is seeded by combining the seed of
+// InitializeRandom with a thread id, which is zero for the main Context (so
+// that it is seeded with exactly the former), the OpenMP thread number for
+// Contexts constructed within a parallel region, and otherwise either the
+// explicitly provided id or a unique negative number. Random samples drawn
+// by OpenMP threads are therefore reproducible regardless of the order in
+// which the threads first touch the library. The default and trivial grids
+// are immutable between El::Initialize and El::Finalize, and the tuned
+// blocksize database may be modified concurrently.
+struct Context
+{
+    std::stack<Int> blocksizeStack;
+    bool explicitBlocksize;
+    // Whether the blocksize stack is (still) that of the main Context
+    bool inheritsBlocksizes;
+    bool mainContext;
+    Int threadId;
+    std::mt19937 generator;
+    Int indentLevel;
+    EL_DEBUG_ONLY(std::stack<string> callStack;)
+
+    Context();
+    explicit Context( Int threadId );
+
+    // The top of the (possibly inherited) blocksize stack and whether the
+    // tuned blocksizes apply to it
+    Int Blocksize() const;
+    bool TunedBlocksizesActive() const;
+    // Return the blocksize stack for modification (taking a private copy of
+    // an inherited one) and, after modifying it, publish it to the Contexts
+    // which inherit it (if this is the main Context)
+    std::stack<Int>& ModifyBlocksizes();
+    void PublishBlocksizes() const;
+};
+
+Context& CurrentContext();
+// A null pointer reactivates the calling thread's own Context
+void SetContext( Context* context );
+
+// For activating a Context using RAII
+class ContextGuard
+{
+public:
+    explicit ContextGuard( Context& context );
+    ~ContextGuard();
+private:
+    Context* previous_;
+};
+
+// The blocksize at the bottom of the stack of each new Context
+void SetDefaultBlocksize( Int blocksize );
+Int DefaultBlocksize();
+
 template<typename T,
          typename=EnableIf<IsScalar<T>>>
 const T& Max( const T& m, const T& n ) EL_NO_EXCEPT;
@@ -176,6 +333,12 @@ template<typename T,
          typename=void>
 void FastResize( vector<T>& v, Int numEntries );
 
+// Call body(i) for each i in [0,n), in parallel if OpenMP threading is
+// enabled. The first exception thrown by any iteration is rethrown after all
+// of the iterations have completed.
+template<typename Body>
+void ParallelFor( Int n, Body body );
+
 inline void BuildStream( ostringstream& ) { }
 
 template<typename T,typename... ArgPack>
@@ -386,6 +549,10 @@ void RelativeIndices
 ( vector<Int>& relInds, const vector<Int>& sub, const vector<Int>& full );
 vector<Int> RelativeIndices( const vector<Int>& sub, const vector<Int>& full );
 
+// Returns the starting positions of the maximal runs of consecutive values
+// within the (sorted) list of indices, followed by the length of the list
+vector<Int> IndexRuns( const vector<Int>& inds );
+
 // Insists that the index can be found
 Int Find( const vector<Int>& sortedInds, Int index );
 
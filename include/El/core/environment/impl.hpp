@@ -161,6 +161,27 @@ template<typename T,
 void FastResize( vector<T>& v, Int numEntries )
 { v.resize( numEntries ); }
 
+template<typename Body>
+void ParallelFor( Int n, Body body )
+{
+    std::exception_ptr exception;
+    EL_PARALLEL_FOR
+    for( Int i=0; i<n; ++i )
+    {
+        try { body( i ); }
+        catch( ... )
+        {
+#ifdef EL_HYBRID
+            _Pragma("omp critical(ElParallelFor)")
+#endif
+            if( !exception )
+                exception = std::current_exception();
+        }
+    }
+    if( exception )
+        std::rethrow_exception( exception );
+}
+
 template<typename T,typename... ArgPack>
 void BuildStream( ostringstream& os, const T& item, const ArgPack& ... args )
 {
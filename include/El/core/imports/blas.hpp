@@ -52,6 +52,16 @@ namespace blas {
 
 // NOTE: templated routines are custom and not wrappers
 
+// The custom (templated) Gemm and Trsm, which handle the datatypes not
+// supported by the vendor BLAS, split their output over
+// FallbackThreads() OpenMP threads (zero selects the OpenMP default) when
+// they perform at least FallbackThreshold() multiply-adds. The local sparse
+// matrix-vector kernels follow the same policy.
+void SetFallbackThreads( int numThreads );
+int FallbackThreads();
+void SetFallbackThreshold( double numMultiplyAdds );
+double FallbackThreshold();
+
 // Level 1 BLAS 
 // ============
 template<typename T>
@@ -253,6 +263,16 @@ void Gemv
   const dcomplex* x, BlasInt incx,
   const dcomplex& beta,
         dcomplex* y, BlasInt incy );
+#ifdef EL_HAVE_QD
+// Native (packed and vectorized) double-double kernel
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble& beta,
+        DoubleDouble* y, BlasInt incy );
+#endif
 
 template<typename T>
 void Ger
@@ -603,6 +623,16 @@ void Gemm
   const dcomplex* B, BlasInt BLDim,
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim );
+#ifdef EL_HAVE_QD
+// Native (packed and vectorized) double-double kernel
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* B, BlasInt BLDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim );
+#endif
 
 template<typename T>
 void Hemm
@@ -846,6 +876,16 @@ void Syrk
   const dcomplex* A, BlasInt ALDim,
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim );
+#ifdef EL_HAVE_QD
+// Native double-double kernel built on top of the double-double Gemm
+void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim );
+#endif
 
 template<typename T>
 void Trmm
@@ -912,6 +952,15 @@ void Trsm
   const dcomplex& alpha,
   const dcomplex* A, BlasInt ALDim,
         dcomplex* B, BlasInt BLDim );
+#ifdef EL_HAVE_QD
+// Native double-double kernel built on top of the double-double Gemm
+void Trsm
+( char side,  char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+        DoubleDouble* B, BlasInt BLDim );
+#endif
 
 } // namespace blas
 } // namespace El
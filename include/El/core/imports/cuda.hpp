@@ -0,0 +1,129 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IMPORTS_CUDA_HPP
+#define EL_IMPORTS_CUDA_HPP
+
+#ifdef EL_HAVE_CUDA
+
+namespace El {
+namespace cuda {
+
+// Device management
+// =================
+int NumDevices();
+int Device();
+void SetDevice( int device );
+// Wait for all work queued on the current device (each of the routines
+// below is queued on the default stream)
+void Synchronize();
+// Destroy the cuBLAS and cuSOLVER handles (called by El::Finalize)
+void Finalize();
+
+// Memory
+// ======
+// Managed (unified) memory may also be dereferenced on the host once the
+// device has been synchronized
+void* Allocate( size_t numBytes, bool managed=false );
+void Free( void* ptr );
+
+// Copy a column-major height x width matrix whose entries are each
+// 'entrySize' bytes
+void CopyHostToDevice
+( size_t height, size_t width, size_t entrySize,
+  const void* A, size_t ALDim, void* B, size_t BLDim );
+void CopyDeviceToHost
+( size_t height, size_t width, size_t entrySize,
+  const void* A, size_t ALDim, void* B, size_t BLDim );
+void CopyDeviceToDevice
+( size_t height, size_t width, size_t entrySize,
+  const void* A, size_t ALDim, void* B, size_t BLDim );
+
+// cuBLAS
+// ======
+// The arguments follow those of the corresponding BLAS routines, but all of
+// the matrices must reside in device memory
+
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const float& alpha,
+  const float* A, BlasInt ALDim,
+  const float* B, BlasInt BLDim,
+  const float& beta,
+        float* C, BlasInt CLDim );
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const double& alpha,
+  const double* A, BlasInt ALDim,
+  const double* B, BlasInt BLDim,
+  const double& beta,
+        double* C, BlasInt CLDim );
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const scomplex& alpha,
+  const scomplex* A, BlasInt ALDim,
+  const scomplex* B, BlasInt BLDim,
+  const scomplex& beta,
+        scomplex* C, BlasInt CLDim );
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const dcomplex& alpha,
+  const dcomplex* A, BlasInt ALDim,
+  const dcomplex* B, BlasInt BLDim,
+  const dcomplex& beta,
+        dcomplex* C, BlasInt CLDim );
+
+void Trsm
+( char side, char uplo, char trans, char diag, BlasInt m, BlasInt n,
+  const float& alpha, const float* A, BlasInt ALDim,
+                            float* B, BlasInt BLDim );
+void Trsm
+( char side, char uplo, char trans, char diag, BlasInt m, BlasInt n,
+  const double& alpha, const double* A, BlasInt ALDim,
+                             double* B, BlasInt BLDim );
+void Trsm
+( char side, char uplo, char trans, char diag, BlasInt m, BlasInt n,
+  const scomplex& alpha, const scomplex* A, BlasInt ALDim,
+                               scomplex* B, BlasInt BLDim );
+void Trsm
+( char side, char uplo, char trans, char diag, BlasInt m, BlasInt n,
+  const dcomplex& alpha, const dcomplex* A, BlasInt ALDim,
+                               dcomplex* B, BlasInt BLDim );
+
+// Syrk for real data and Herk for complex data
+void Herk
+( char uplo, char trans, BlasInt n, BlasInt k,
+  const float& alpha, const float* A, BlasInt ALDim,
+  const float& beta,        float* C, BlasInt CLDim );
+void Herk
+( char uplo, char trans, BlasInt n, BlasInt k,
+  const double& alpha, const double* A, BlasInt ALDim,
+  const double& beta,        double* C, BlasInt CLDim );
+void Herk
+( char uplo, char trans, BlasInt n, BlasInt k,
+  const float& alpha, const scomplex* A, BlasInt ALDim,
+  const float& beta,        scomplex* C, BlasInt CLDim );
+void Herk
+( char uplo, char trans, BlasInt n, BlasInt k,
+  const double& alpha, const dcomplex* A, BlasInt ALDim,
+  const double& beta,        dcomplex* C, BlasInt CLDim );
+
+// cuSOLVER
+// ========
+// Throws a NonHPDMatrixException if the matrix was not numerically HPD
+void Cholesky( char uplo, BlasInt n, float* A, BlasInt ALDim );
+void Cholesky( char uplo, BlasInt n, double* A, BlasInt ALDim );
+void Cholesky( char uplo, BlasInt n, scomplex* A, BlasInt ALDim );
+void Cholesky( char uplo, BlasInt n, dcomplex* A, BlasInt ALDim );
+
+} // namespace cuda
+} // namespace El
+
+#endif // ifdef EL_HAVE_CUDA
+
+#endif // ifndef EL_IMPORTS_CUDA_HPP
@@ -321,6 +321,8 @@ class BigFloat {
 private:
     mpfr_t mpfrFloat_;
     size_t numLimbs_;
+    // Whether the limbs were allocated by MPFR (rather than by an arena)
+    bool ownsLimbs_;
 
     void SetNumLimbs( mpfr_prec_t prec );
     void Init( mpfr_prec_t prec=mpfr::Precision() );
@@ -333,6 +335,7 @@ public:
     mpfr_prec_t Precision() const;
     void        SetPrecision( mpfr_prec_t );
     size_t      NumLimbs() const;
+    bool        OwnsLimbs() const;
 
     // NOTE: The default constructor does not take an mpfr_prec_t as input
     //       due to the ambiguity is would cause with respect to the
@@ -360,6 +363,11 @@ public:
     BigFloat
     ( const std::string& str, int base, mpfr_prec_t prec=mpfr::Precision() );
     BigFloat( BigFloat&& a );
+    // Initialize to zero using the given limbs (with room for the given
+    // precision), which are borrowed rather than freed on destruction.
+    // Until the precision is changed, moves into and out of such a BigFloat
+    // copy values so that its limbs remain in place.
+    BigFloat( mp_limb_t* limbs, mpfr_prec_t prec );
     ~BigFloat();
 
     void Zero();
@@ -649,6 +657,20 @@ bool operator!=( const BigFloat& a, const BigFloat& b );
 std::ostream& operator<<( std::ostream& os, const BigFloat& alpha );
 std::istream& operator>>( std::istream& is,       BigFloat& alpha );
 
+namespace mpfr {
+
+// Whether the entries of each newly-allocated array of BigFloat (e.g., the
+// buffer of a Matrix<BigFloat>) share a single contiguous arena of limbs at
+// the default precision rather than each separately allocating their limbs
+void SetContiguousStorage( bool contiguous );
+bool ContiguousStorage();
+
+// NOTE: These should only be called internally (by Memory<BigFloat>)
+BigFloat* NewArray( size_t size );
+void DeleteArray( BigFloat* ptr, size_t size ) EL_NO_EXCEPT;
+
+} // namespace mpfr
+
 } // namespace El
 #endif // ifdef EL_HAVE_MPC
 
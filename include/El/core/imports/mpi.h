@@ -34,6 +34,9 @@ EL_EXPORT ElError ElMPIWorldSize( int* size );
 
 EL_EXPORT ElError ElMPITime( double* time );
 
+/* Whether MPI was initialized with MPI_THREAD_MULTIPLE support */
+EL_EXPORT ElError ElMPIThreadMultiple( bool* multiple );
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
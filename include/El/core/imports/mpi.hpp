@@ -15,6 +15,8 @@
 namespace El {
 
 using std::function;
+using std::ostream;
+using std::string;
 using std::vector;
 
 namespace mpi {
@@ -26,7 +28,7 @@ namespace mpi {
 #define EL_HAVE_NONBLOCKING 0
 #endif
 
-#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#if EL_HAVE_NONBLOCKING
 #ifdef EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES
 #define EL_NONBLOCKING_COLL(name) MPI_ ## name
 #else
@@ -76,6 +78,18 @@ inline bool operator==( const Op& a, const Op& b ) EL_NO_EXCEPT
 inline bool operator!=( const Op& a, const Op& b ) EL_NO_EXCEPT
 { return a.op != b.op; }
 
+// A window into memory shared between the processes of a node
+struct Window
+{
+#ifdef EL_HAVE_MPI3_SHARED_MEMORY
+    MPI_Win win;
+    Window( MPI_Win mpiWin=MPI_WIN_NULL ) EL_NO_EXCEPT : win(mpiWin) { }
+#else
+    void* win;
+    Window() EL_NO_EXCEPT : win(nullptr) { }
+#endif
+};
+
 // Datatype definitions
 // TODO(poulson): Convert these to structs/classes
 typedef MPI_Aint Aint;
@@ -180,32 +194,81 @@ struct MPIBaseHelper<Entry<T>> { typedef T value; };
 template<typename T>
 using MPIBase = typename MPIBaseHelper<T>::value;
 
+// The custom datatypes and operations are registered upon first use, one
+// family at a time, rather than within El::Initialize. The family of a real
+// type F consists of F, Complex<F>, and their ValueInt and Entry pairings
+// (the family of Int consists of Int and its pairings). The BigInt and
+// BigFloat datatypes depend upon the precision and are instead created by
+// mpfr::SetMinIntBits and mpfr::SetPrecision.
+template<typename F>
+struct HasCustomFamily { static const bool value=false; };
+template<> struct HasCustomFamily<Int> { static const bool value=true; };
+template<> struct HasCustomFamily<float> { static const bool value=true; };
+template<> struct HasCustomFamily<double> { static const bool value=true; };
+#ifdef EL_HAVE_QD
+template<> struct HasCustomFamily<DoubleDouble>
+{ static const bool value=true; };
+template<> struct HasCustomFamily<QuadDouble>
+{ static const bool value=true; };
+#endif
+#ifdef EL_HAVE_QUAD
+template<> struct HasCustomFamily<Quad> { static const bool value=true; };
+#endif
+#ifdef EL_HAVE_MPC
+template<> struct HasCustomFamily<BigInt> { static const bool value=true; };
+template<> struct HasCustomFamily<BigFloat> { static const bool value=true; };
+#endif
+
+template<typename F>
+struct CustomFamily
+{
+    static std::atomic<bool> created;
+
+    // Thread-safe and idempotent
+    static void Create() EL_NO_RELEASE_EXCEPT;
+};
+
+template<typename T>
+using CustomFamilyOf = Base<MPIBase<T>>;
+
+template<typename T,typename=EnableIf<HasCustomFamily<CustomFamilyOf<T>>>>
+inline void EnsureCustom() EL_NO_EXCEPT
+{
+    typedef CustomFamily<CustomFamilyOf<T>> Family;
+    if( !Family::created.load(std::memory_order_acquire) )
+        Family::Create();
+}
+template<typename T,
+         typename=DisableIf<HasCustomFamily<CustomFamilyOf<T>>>,
+         typename=void>
+inline void EnsureCustom() EL_NO_EXCEPT { }
+
 template<typename T>
 Datatype& TypeMap() EL_NO_EXCEPT
-{ return Types<T>::type; }
+{ EnsureCustom<T>(); return Types<T>::type; }
 
 template<typename T>
-Op& UserOp() { return Types<T>::userOp; }
+Op& UserOp() { EnsureCustom<T>(); return Types<T>::userOp; }
 template<typename T>
-Op& UserCommOp() { return Types<T>::userCommOp; }
+Op& UserCommOp() { EnsureCustom<T>(); return Types<T>::userCommOp; }
 template<typename T>
-Op& SumOp() { return Types<T>::sumOp; }
+Op& SumOp() { EnsureCustom<T>(); return Types<T>::sumOp; }
 template<typename T>
-Op& ProdOp() { return Types<T>::prodOp; }
+Op& ProdOp() { EnsureCustom<T>(); return Types<T>::prodOp; }
 // The following are currently only defined for real datatypes but could
 // potentially use lexicographic ordering for complex numbers
 template<typename T>
-Op& MaxOp() { return Types<T>::maxOp; }
+Op& MaxOp() { EnsureCustom<T>(); return Types<T>::maxOp; }
 template<typename T>
-Op& MinOp() { return Types<T>::minOp; }
+Op& MinOp() { EnsureCustom<T>(); return Types<T>::minOp; }
 template<typename T>
-Op& MaxLocOp() { return Types<ValueInt<T>>::maxOp; }
+Op& MaxLocOp() { EnsureCustom<T>(); return Types<ValueInt<T>>::maxOp; }
 template<typename T>
-Op& MinLocOp() { return Types<ValueInt<T>>::minOp; }
+Op& MinLocOp() { EnsureCustom<T>(); return Types<ValueInt<T>>::minOp; }
 template<typename T>
-Op& MaxLocPairOp() { return Types<Entry<T>>::maxOp; }
+Op& MaxLocPairOp() { EnsureCustom<T>(); return Types<Entry<T>>::maxOp; }
 template<typename T>
-Op& MinLocPairOp() { return Types<Entry<T>>::minOp; }
+Op& MinLocPairOp() { EnsureCustom<T>(); return Types<Entry<T>>::minOp; }
 
 // Added constant(s)
 const int MIN_COLL_MSG = 1; // minimum message size for collectives
@@ -239,6 +302,93 @@ void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT;
 bool Congruent( Comm comm1, Comm comm2 ) EL_NO_RELEASE_EXCEPT;
 void ErrorHandlerSet
 ( Comm comm, ErrorHandler errorHandler ) EL_NO_RELEASE_EXCEPT;
+// Attach a human-readable name to a communicator (used by the profiler)
+void SetName( Comm comm, const string& name ) EL_NO_RELEASE_EXCEPT;
+string GetName( Comm comm ) EL_NO_RELEASE_EXCEPT;
+
+// Collective profiling
+// --------------------
+// When enabled, each collective issued through this interface accumulates
+// its number of calls, the number of bytes sent and received by this
+// process, and the elapsed wall time, keyed by the collective and by the
+// name (see SetName) and size of the communicator. Collectives issued from
+// within other collectives (e.g., by the serialization fallbacks) are only
+// attributed to the outermost call.
+//
+// Setting the environment variable EL_MPI_PROFILE=<prefix> enables
+// profiling within El::Initialize and writes each process's profile to
+// <prefix>.<rank>.json during El::Finalize.
+struct CollectiveProfile
+{
+    string collective;
+    string commName;
+    int commSize;
+    Int numCalls;
+    double bytesSent;
+    double bytesRecv;
+    double seconds;
+};
+
+void EnableProfiling( bool enable=true ) EL_NO_EXCEPT;
+bool ProfilingEnabled() EL_NO_EXCEPT;
+void ResetProfile();
+vector<CollectiveProfile> Profile();
+// Print this process's profile as a JSON object
+void PrintProfileJSON( ostream& os );
+void WriteProfileJSON( const string& filename );
+
+namespace profile {
+
+// Accumulates the cost of a collective into the profile upon destruction.
+// This is an implementation detail of the collective wrappers.
+class Scope
+{
+public:
+    Scope( const char* collective, Comm comm ) EL_NO_EXCEPT;
+    ~Scope();
+    bool Active() const EL_NO_EXCEPT { return active_; }
+    void SetBytes( double bytesSent, double bytesRecv ) EL_NO_EXCEPT
+    { bytesSent_ = bytesSent; bytesRecv_ = bytesRecv; }
+private:
+    bool entered_, active_;
+    const char* collective_;
+    Comm comm_;
+    double bytesSent_=0, bytesRecv_=0;
+    double startTime_=0;
+};
+
+} // namespace profile
+
+// Split a communicator into the subsets of processes which can share memory
+// (i.e., which reside on the same node), ordered by 'key'. Without MPI-3
+// support, each process is treated as residing on its own node.
+void SplitShared( Comm comm, int key, Comm& nodeComm ) EL_NO_RELEASE_EXCEPT;
+
+// Form a communicator over the same processes as 'comm' whose (symmetric)
+// topology connects each process to the given sorted list of neighbors, which
+// must not include the calling process. Without MPI-3 support, 'comm' is
+// simply duplicated and the neighbor exchanges fall back to point-to-point
+// messages.
+void CreateNeighborhood
+( Comm comm, const vector<int>& neighbors, Comm& neighborComm )
+EL_NO_RELEASE_EXCEPT;
+
+// Shared-memory windows
+// ---------------------
+// Whether shared-memory windows are supported by the MPI implementation
+bool HaveSharedMemory() EL_NO_EXCEPT;
+// Collectively allocate a shared window over a node communicator (see
+// SplitShared), with each process contributing 'numBytes' bytes, and return
+// the local portion. A passive-target epoch is opened on the window so that
+// it may be synchronized with WindowSync and Barrier.
+void* AllocateShared
+( size_t numBytes, Comm nodeComm, Window& window ) EL_NO_RELEASE_EXCEPT;
+// Return the base address of the portion of a shared window contributed by
+// the process with the given rank in the node communicator
+void* SharedQuery( Window window, int rank ) EL_NO_RELEASE_EXCEPT;
+// Make local stores to the window visible (combine with a Barrier)
+void WindowSync( Window window ) EL_NO_RELEASE_EXCEPT;
+void Free( Window& window ) EL_NO_RELEASE_EXCEPT;
 
 // Cartesian communicator routines
 void CartCreate
@@ -531,6 +681,47 @@ EL_NO_RELEASE_EXCEPT;
 template<typename T>
 T IRecv( int from, Comm comm, Request<T>& request ) EL_NO_RELEASE_EXCEPT;
 
+// Persistent point-to-point communication
+// ---------------------------------------
+// NOTE: Persistent requests are only supported for packed datatypes, as the
+//       buffers bound to the request are reused by each call to Start
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void TaggedSendInit
+( const Real* buf, int count, int to, int tag, Comm comm,
+  Request<Real>& request ) EL_NO_RELEASE_EXCEPT;
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void TaggedSendInit
+( const Complex<Real>* buf, int count, int to, int tag, Comm comm,
+  Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void SendInit
+( const T* buf, int count, int to, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT;
+
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void TaggedRecvInit
+( Real* buf, int count, int from, int tag, Comm comm,
+  Request<Real>& request ) EL_NO_RELEASE_EXCEPT;
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void TaggedRecvInit
+( Complex<Real>* buf, int count, int from, int tag, Comm comm,
+  Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void RecvInit
+( T* buf, int count, int from, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT;
+
+template<typename T>
+void Start( Request<T>& request ) EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void StartAll( int numRequests, Request<T>* requests ) EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void Free( Request<T>& request ) EL_NO_RELEASE_EXCEPT;
+
 // SendRecv
 // --------
 template<typename Real,
@@ -841,6 +1032,15 @@ vector<T> AllToAll
   const vector<int>& sendDispls,
   Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// AllToAll restricted to the neighbors of a CreateNeighborhood communicator
+// -------------------------------------------------------------------------
+// The k'th send/recv counts and displacements correspond to neighbors[k]
+template<typename T>
+void NeighborAllToAll
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds,
+  const vector<int>& neighbors, Comm neighborComm ) EL_NO_RELEASE_EXCEPT;
+
 // Reduce
 // ------
 template<typename Real,
@@ -1022,6 +1222,30 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void AllReduce( T* buf, int count, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking single-buffer AllReduce
+// ------------------------------------
+// The buffer must not be accessed until the request has been passed to Wait.
+// If Elemental was not configured with non-blocking collectives, the
+// reduction is performed immediately and the request is already complete.
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Real* buf, int count, Op op, Comm comm, Request<Real>& request );
+template<typename Real,
+         typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,
+         typename=DisableIf<IsPacked<T>>,
+         typename=void>
+void IAllReduce
+( T* buf, int count, Op op, Comm comm, Request<T>& request );
+
+// Default to SUM
+template<typename T>
+void IAllReduce( T* buf, int count, Comm comm, Request<T>& request );
+
 // ReduceScatter
 // -------------
 template<typename Real,
@@ -1217,6 +1441,26 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void Scan( T* buf, int count, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// SparseAllToAll
+// --------------
+// The adaptive schedule (the default when EL_USE_CUSTOM_ALLTOALLV is
+// defined) first agrees upon the largest number of nonempty messages sent
+// or received by any process and the largest message size. Dense patterns
+// of tiny messages then use Bruck's algorithm, other dense patterns use
+// MPI_Alltoallv, and sparse patterns use a pairwise exchange with at most
+// SparseAllToAllMaxRequests() outstanding requests per process.
+enum SparseAllToAllSchedule
+{
+    ADAPTIVE_SPARSE_ALLTOALL,
+    VENDOR_SPARSE_ALLTOALL,
+    PAIRWISE_SPARSE_ALLTOALL,
+    BRUCK_SPARSE_ALLTOALL
+};
+void SetSparseAllToAllSchedule( SparseAllToAllSchedule schedule ) EL_NO_EXCEPT;
+SparseAllToAllSchedule GetSparseAllToAllSchedule() EL_NO_EXCEPT;
+void SetSparseAllToAllMaxRequests( int maxRequests ) EL_NO_EXCEPT;
+int SparseAllToAllMaxRequests() EL_NO_EXCEPT;
+
 template<typename T>
 void SparseAllToAll
 ( const vector<T>& sendBuffer,
@@ -1231,6 +1475,8 @@ void VerifySendsAndRecvs
 ( const vector<int>& sendCounts,
   const vector<int>& recvCounts, Comm comm );
 
+// Eagerly create (or destroy) the custom datatypes and operations of every
+// family; El::Finalize calls DestroyCustom
 void CreateCustom() EL_NO_RELEASE_EXCEPT;
 void DestroyCustom() EL_NO_RELEASE_EXCEPT;
 
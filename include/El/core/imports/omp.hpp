@@ -9,23 +9,32 @@
 #ifndef EL_IMPORTS_OMP_HPP
 #define EL_IMPORTS_OMP_HPP
 
-#ifdef EL_HYBRID
+#if defined(EL_HYBRID) || defined(EL_HAVE_THREADED_PACKING)
 # include <omp.h>
+#endif
+
+#ifdef EL_HYBRID
 # define EL_PARALLEL_FOR _Pragma("omp parallel for")
 # ifdef EL_HAVE_OMP_COLLAPSE
 #  define EL_PARALLEL_FOR_COLLAPSE2 _Pragma("omp parallel for collapse(2)")
 # else
 #  define EL_PARALLEL_FOR_COLLAPSE2 EL_PARALLEL_FOR
 # endif
-# ifdef EL_HAVE_OMP_SIMD
-#  define EL_SIMD _Pragma("omp simd")
-# else
-#  define EL_SIMD
-# endif
 #else
 # define EL_PARALLEL_FOR 
 # define EL_PARALLEL_FOR_COLLAPSE2
+#endif
+
+// The packing engine makes use of SIMD loops even without EL_HYBRID
+#if (defined(EL_HYBRID) || defined(EL_HAVE_THREADED_PACKING)) && \
+    defined(EL_HAVE_OMP_SIMD)
+# define EL_SIMD _Pragma("omp simd")
+# define EL_PRAGMA(x) _Pragma(#x)
+// e.g., EL_SIMD_REDUCTION(+:alpha,beta)
+# define EL_SIMD_REDUCTION(...) EL_PRAGMA(omp simd reduction(__VA_ARGS__))
+#else
 # define EL_SIMD
+# define EL_SIMD_REDUCTION(...)
 #endif
 
 #ifdef EL_AVOID_OMP_FMA
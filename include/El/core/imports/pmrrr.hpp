@@ -12,6 +12,10 @@
 namespace El {
 namespace herm_tridiag_eig {
 
+// Set the number of threads used by each process within subsequent calls
+// (zero keeps the PMRRR default, which is set by PMR_NUM_THREADS)
+void SetMRRRThreads( int numThreads );
+
 struct Estimate {
     int numLocalEigenvalues;
     int numGlobalEigenvalues;
@@ -99,9 +99,82 @@ F SampleBall( const F& center=F(0), const Base<F>& radius=Base<F>(1) );
 template<typename Real,typename=EnableIf<IsReal<Real>>> 
 Real SampleBall( const Real& center=Real(0), const Real& radius=Real(1) );
 
+// Counter-based random number generation
+// ======================================
+// The Philox4x32-10 generator of Salmon et al. maps a 128-bit counter and a
+// 64-bit key to 128 random bits. Keying on a seed and a stream index and
+// counting with the global indices (i,j) makes each entry of a random matrix
+// a pure function of (seed,stream,i,j), so that, when enabled via
+// SetCounterBasedRandom, the independent random matrix generators (Uniform,
+// Gaussian, Bernoulli, ThreeValued, and Rademacher) produce identical results
+// for any process grid and number of threads without a broadcast over the
+// redundant copies.
+class CounterRNG
+{
+public:
+    CounterRNG( std::uint64_t seed, std::uint32_t stream ) EL_NO_EXCEPT;
+
+    // The 128 random bits associated with entry (i,j)
+    std::array<std::uint32_t,4> Bits( Int i, Int j ) const EL_NO_EXCEPT;
+
+    // Two independent samples from U[0,1) with 53 random bits each
+    void Uniform( Int i, Int j, double& u0, double& u1 ) const EL_NO_EXCEPT;
+
+private:
+    std::uint32_t key_[2];
+    std::uint32_t stream_;
+};
+
+void SetCounterBasedRandom( bool counterBased );
+bool CounterBasedRandom();
+void SetCounterBasedSeed( std::uint64_t seed );
+std::uint64_t CounterBasedSeed();
+
+// Return a generator for a fresh stream. Collective streams are used for
+// distributed matrices and must be requested in the same order by each
+// process, whereas sequential matrices draw from a separate sequence of
+// process-local streams.
+CounterRNG NewCounterRNG( bool collective );
+
+// Samples for entry (i,j) of the stream of 'rng'
+// NOTE: Precisions beyond double only receive 53 random bits
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>,
+         typename=DisableIf<IsIntegral<Real>>>
+Real SampleUniform
+( const CounterRNG& rng, Int i, Int j, const Real& a, const Real& b );
+template<typename T,
+         typename=EnableIf<IsIntegral<T>>,
+         typename=void,
+         typename=void>
+T SampleUniform( const CounterRNG& rng, Int i, Int j, const T& a, const T& b );
+template<typename F,
+         typename=EnableIf<IsComplex<F>>,
+         typename=void,
+         typename=void,
+         typename=void>
+F SampleUniform( const CounterRNG& rng, Int i, Int j, const F& a, const F& b );
+
+template<typename T>
+T SampleNormal
+( const CounterRNG& rng, Int i, Int j,
+  const T& mean=T(0), const Base<T>& stddev=Base<T>(1) );
+
+template<typename F>
+F SampleBall
+( const CounterRNG& rng, Int i, Int j,
+  const F& center=F(0), const Base<F>& radius=Base<F>(1) );
+template<typename Real,typename=EnableIf<IsReal<Real>>>
+Real SampleBall
+( const CounterRNG& rng, Int i, Int j,
+  const Real& center=Real(0), const Real& radius=Real(1) );
+
 // To be used internally by Elemental
 void InitializeRandom( bool deterministic=true );
 void FinalizeRandom();
+// Seed the generator of a Context from the InitializeRandom seed and the
+// thread id of the Context (zero yields exactly the former)
+void SeedGenerator( std::mt19937& generator, Int threadId );
 
 } // namespace El
 
@@ -223,6 +223,118 @@ template<typename Real,typename>
 Real SampleBall( const Real& center, const Real& radius )
 { return SampleUniform(center-radius,center+radius); }
 
+inline CounterRNG::CounterRNG
+( std::uint64_t seed, std::uint32_t stream ) EL_NO_EXCEPT
+: key_{std::uint32_t(seed),std::uint32_t(seed>>32)}, stream_(stream)
+{ }
+
+inline std::array<std::uint32_t,4>
+CounterRNG::Bits( Int i, Int j ) const EL_NO_EXCEPT
+{
+    const std::uint32_t M0 = 0xD2511F53u, M1 = 0xCD9E8D57u;
+    const std::uint32_t W0 = 0x9E3779B9u, W1 = 0xBB67AE85u;
+
+    // The counter holds the lower 48 bits of each index and the stream
+    const std::uint64_t iWord = std::uint64_t(i), jWord = std::uint64_t(j);
+    std::uint32_t ctr[4] =
+      { std::uint32_t(iWord), std::uint32_t(jWord),
+        std::uint32_t(((iWord>>32) & 0xFFFFu) | (((jWord>>32) & 0xFFFFu)<<16)),
+        stream_ };
+    std::uint32_t key0 = key_[0], key1 = key_[1];
+    for( Int round=0; round<10; ++round )
+    {
+        const std::uint64_t prod0 = std::uint64_t(M0)*ctr[0];
+        const std::uint64_t prod1 = std::uint64_t(M1)*ctr[2];
+        const std::uint32_t hi0 = std::uint32_t(prod0>>32);
+        const std::uint32_t hi1 = std::uint32_t(prod1>>32);
+        ctr[0] = hi1 ^ ctr[1] ^ key0;
+        ctr[1] = std::uint32_t(prod1);
+        ctr[2] = hi0 ^ ctr[3] ^ key1;
+        ctr[3] = std::uint32_t(prod0);
+        key0 += W0;
+        key1 += W1;
+    }
+    return std::array<std::uint32_t,4>{{ctr[0],ctr[1],ctr[2],ctr[3]}};
+}
+
+inline void
+CounterRNG::Uniform( Int i, Int j, double& u0, double& u1 ) const EL_NO_EXCEPT
+{
+    const auto bits = Bits( i, j );
+    const double scale = 1./9007199254740992.; // 2^-53
+    u0 = ((std::uint64_t(bits[0])<<21) ^ (bits[1]>>11))*scale;
+    u1 = ((std::uint64_t(bits[2])<<21) ^ (bits[3]>>11))*scale;
+}
+
+template<typename Real,typename,typename>
+Real SampleUniform
+( const CounterRNG& rng, Int i, Int j, const Real& a, const Real& b )
+{
+    double u0, u1;
+    rng.Uniform( i, j, u0, u1 );
+    return a + Real(u0)*(b-a);
+}
+
+template<typename T,typename,typename,typename>
+T SampleUniform( const CounterRNG& rng, Int i, Int j, const T& a, const T& b )
+{
+    double u0, u1;
+    rng.Uniform( i, j, u0, u1 );
+    return a + T(Int(u0*double(b-a)));
+}
+
+template<typename F,typename,typename,typename,typename>
+F SampleUniform( const CounterRNG& rng, Int i, Int j, const F& a, const F& b )
+{
+    typedef Base<F> Real;
+    double u0, u1;
+    rng.Uniform( i, j, u0, u1 );
+    F sample;
+    sample.real( a.real() + Real(u0)*(b.real()-a.real()) );
+    sample.imag( a.imag() + Real(u1)*(b.imag()-a.imag()) );
+    return sample;
+}
+
+// Use the Box-Muller transform of the two uniform samples
+template<typename F>
+F SampleNormal
+( const CounterRNG& rng, Int i, Int j, const F& mean, const Base<F>& stddev )
+{
+    typedef Base<F> Real;
+    double u0, u1;
+    rng.Uniform( i, j, u0, u1 );
+    const double radius = std::sqrt(-2*std::log(1-u0));
+    const double angle = 2*M_PI*u1;
+
+    Real stddevAdj = stddev;
+    if( IsComplex<F>::value )
+        stddevAdj /= Sqrt(Real(2));
+    F sample;
+    SetRealPart
+    ( sample, RealPart(mean) + stddevAdj*Real(radius*std::cos(angle)) );
+    if( IsComplex<F>::value )
+        SetImagPart
+        ( sample, ImagPart(mean) + stddevAdj*Real(radius*std::sin(angle)) );
+    return sample;
+}
+
+template<typename F>
+F SampleBall
+( const CounterRNG& rng, Int i, Int j, const F& center, const Base<F>& radius )
+{
+    typedef Base<F> Real;
+    double u0, u1;
+    rng.Uniform( i, j, u0, u1 );
+    const Real r = Real(u0)*radius;
+    const Real angle = Real(u1)*(2*Pi<Real>());
+    return center + F(r*Cos(angle),r*Sin(angle));
+}
+
+template<typename Real,typename>
+Real SampleBall
+( const CounterRNG& rng, Int i, Int j, const Real& center, const Real& radius )
+{ return SampleUniform( rng, i, j, center-radius, center+radius ); }
+
 } // namespace El
 
 #endif // ifndef EL_RANDOM_IMPL_HPP
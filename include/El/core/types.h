@@ -247,6 +247,8 @@ typedef enum {
   EL_PPM,
   EL_XBM,
   EL_XPM,
+  EL_HDF5,
+  EL_BINARY_COMPRESSED,
   EL_FileFormat_MAX
 } ElFileFormat;
 
@@ -77,6 +77,15 @@ struct ValueInt
     { return a.value < b.value; }
     static bool Greater( const ValueInt<Real>& a, const ValueInt<Real>& b )
     { return a.value > b.value; }
+
+    // Ties are broken in favor of the smaller index, which yields the same
+    // order as a stable sort with Lesser (Greater)
+    static bool
+    StableLesser( const ValueInt<Real>& a, const ValueInt<Real>& b )
+    { return a.value < b.value || (a.value == b.value && a.index < b.index); }
+    static bool
+    StableGreater( const ValueInt<Real>& a, const ValueInt<Real>& b )
+    { return a.value > b.value || (a.value == b.value && a.index < b.index); }
 };
 
 template<typename Real>
@@ -506,6 +515,8 @@ enum FileFormat
     PPM,
     XBM,
     XPM,
+    HDF5,
+    BINARY_COMPRESSED,
     FileFormat_MAX // For detecting number of entries in enum
 };
 }
@@ -36,6 +36,10 @@ void SetColorMap( ColorMap colorMap );
 ColorMap GetColorMap();
 void SetNumDiscreteColors( Int numColors );
 Int NumDiscreteColors();
+// Map a value in [minVal,maxVal] to an RGB color without requiring Qt
+void SampleColorMap
+( double value, double minVal, double maxVal,
+  byte& red, byte& green, byte& blue );
 
 // Display
 // =======
@@ -111,10 +115,124 @@ void PrintLocal
 template<typename T>
 void Print( const vector<T>& x, string title="vector", ostream& os=cout );
 
+// HDF5
+// ====
+// Dense matrices (and DistMultiVec's) are stored as width x height
+// datasets, as HDF5 is row-major, so that each column is a contiguous row of
+// the dataset, and complex entries use the compound type {r,i}. Sparse
+// matrices are stored as a group with "height" and "width" attributes and
+// "row", "col", and "value" coordinate datasets.
+//
+// Distributed matrices are read and written with collective I/O over
+// hyperslabs which match their element distributions if HDF5 was built with
+// parallel support and, otherwise, by each process in turn.
+struct HDF5Ctrl
+{
+    // The name of the dataset (or, for sparse matrices, the group)
+    string dataset="matrix";
+
+    // If positive, the number of rows and columns of each chunk of a dense
+    // dataset (chunkHeight also sets the length of the chunks of the sparse
+    // coordinate datasets); unspecified dimensions use a default when
+    // chunking is enabled by either of them or by compression
+    Int chunkHeight=0;
+    Int chunkWidth=0;
+
+    // If positive, each chunk is compressed with this deflate level (which is
+    // at most 9); parallel writes of compressed datasets require HDF5 1.10.2
+    int compressionLevel=0;
+
+    // Whether the parallel transfers are collective rather than independent
+    bool collective=true;
+};
+
+template<typename T>
+void WriteHDF5
+( const Matrix<T>& A, string basename="Matrix",
+  const HDF5Ctrl& ctrl=HDF5Ctrl() );
+template<typename T>
+void WriteHDF5
+( const AbstractDistMatrix<T>& A, string basename="DistMatrix",
+  const HDF5Ctrl& ctrl=HDF5Ctrl() );
+template<typename T>
+void WriteHDF5
+( const SparseMatrix<T>& A, string basename="SparseMatrix",
+  const HDF5Ctrl& ctrl=HDF5Ctrl() );
+template<typename T>
+void WriteHDF5
+( const DistSparseMatrix<T>& A, string basename="DistSparseMatrix",
+  const HDF5Ctrl& ctrl=HDF5Ctrl() );
+template<typename T>
+void WriteHDF5
+( const DistMultiVec<T>& X, string basename="DistMultiVec",
+  const HDF5Ctrl& ctrl=HDF5Ctrl() );
+
+template<typename T>
+void ReadHDF5
+( Matrix<T>& A, const string filename, const HDF5Ctrl& ctrl=HDF5Ctrl() );
+template<typename T>
+void ReadHDF5
+( AbstractDistMatrix<T>& A, const string filename,
+  const HDF5Ctrl& ctrl=HDF5Ctrl() );
+template<typename T>
+void ReadHDF5
+( SparseMatrix<T>& A, const string filename,
+  const HDF5Ctrl& ctrl=HDF5Ctrl() );
+template<typename T>
+void ReadHDF5
+( DistSparseMatrix<T>& A, const string filename,
+  const HDF5Ctrl& ctrl=HDF5Ctrl() );
+template<typename T>
+void ReadHDF5
+( DistMultiVec<T>& X, const string filename,
+  const HDF5Ctrl& ctrl=HDF5Ctrl() );
+
+// BINARY_COMPRESSED
+// =================
+// The matrix is split into blocks of 'chunkWidth' full columns which are each
+// compressed with zlib (after an optional byte shuffle, which groups the
+// slowly-varying sign and exponent bytes of neighboring floating-point
+// entries) and stored after the height, width, entry size, chunk width, and
+// shuffle flag, followed by the offsets of the compressed chunks.
+//
+// Distributed matrices deal the chunks out to the processes in a round robin
+// (as DistMatrix<T,STAR,VR,BLOCK> would), which compress them in parallel
+// over their threads and then write them with independent MPI-IO. The file
+// can be read back over any grid. Only packed datatypes are supported.
+struct CompressionCtrl
+{
+    // The number of columns of each chunk. If zero, the chunks are chosen to
+    // hold roughly a megabyte each.
+    Int chunkWidth=0;
+
+    // The zlib compression level, between 1 (fastest) and 9 (smallest)
+    int level=1;
+
+    // Whether to shuffle the bytes of the entries before compression
+    bool shuffle=true;
+};
+
+template<typename T>
+void WriteCompressed
+( const Matrix<T>& A, string basename="Matrix",
+  const CompressionCtrl& ctrl=CompressionCtrl() );
+template<typename T>
+void WriteCompressed
+( const AbstractDistMatrix<T>& A, string basename="DistMatrix",
+  const CompressionCtrl& ctrl=CompressionCtrl() );
+
+template<typename T>
+void ReadCompressed( Matrix<T>& A, const string filename );
+template<typename T>
+void ReadCompressed( AbstractDistMatrix<T>& A, const string filename );
+
 // Read
 // ====
 template<typename T>
 void Read( Matrix<T>& A, const string filename, FileFormat format=AUTO );
+// Unless 'sequential' is true, BINARY and BINARY_FLAT files of packed
+// datatypes are read into element-wrapped distributions collectively with
+// MPI-IO, with each process reading its own entries directly.
 template<typename T>
 void Read
 ( AbstractDistMatrix<T>& A, 
@@ -127,6 +245,62 @@ template<typename T>
 void Read
 ( DistSparseMatrix<T>& A, const string filename, FileFormat format=AUTO );
 
+// Memory-mapped reads
+// ===================
+// Attach a read-only view to the entries of a BINARY or BINARY_FLAT file
+// which is mapped into memory, so that the entries are paged in on demand
+// (or prefetched) rather than copied into a freshly allocated buffer, and so
+// that every process on a node which maps the file shares its page cache.
+// The view is detached and the file unmapped upon destruction.
+namespace AccessPatternNS {
+enum AccessPattern
+{
+    NORMAL_ACCESS,
+    SEQUENTIAL_ACCESS,
+    RANDOM_ACCESS
+};
+}
+using namespace AccessPatternNS;
+
+struct MappedCtrl
+{
+    // The expected access pattern, which is passed along to madvise
+    AccessPattern pattern=NORMAL_ACCESS;
+
+    // Whether to fault in the entire mapping before returning
+    bool populate=false;
+
+    // Whether to ask for the file to be read ahead asynchronously
+    bool prefetch=false;
+};
+
+template<typename T>
+class MappedMatrix
+{
+public:
+    // Map a BINARY_FLAT file with the given dimensions
+    MappedMatrix
+    ( const string filename, Int height, Int width,
+      const MappedCtrl& ctrl=MappedCtrl() );
+    // Map a BINARY file, whose dimensions are stored in its header
+    MappedMatrix( const string filename, const MappedCtrl& ctrl=MappedCtrl() );
+    ~MappedMatrix();
+
+    MappedMatrix( const MappedMatrix<T>& A ) = delete;
+    const MappedMatrix<T>& operator=( const MappedMatrix<T>& A ) = delete;
+
+    const El::Matrix<T>& LockedMatrix() const EL_NO_EXCEPT;
+
+private:
+    void* address_=nullptr;
+    size_t numBytes_=0;
+    El::Matrix<T> matrix_;
+
+    void Map
+    ( const string& filename, Int height, Int width, bool header,
+      const MappedCtrl& ctrl );
+};
+
 // Spy
 // ===
 template<typename T>
@@ -135,12 +309,99 @@ template<typename T>
 void Spy
 ( const AbstractDistMatrix<T>& A, string title="DistMatrix", Base<T> tol=0 );
 
+// Downsampled spy plots
+// ---------------------
+// Rather than gathering the matrix onto one process, each process bins its
+// own entries into a fixed-resolution histogram, and only the histogram is
+// reduced. Each pixel holds either the number of entries above the
+// tolerance which fall within it or the largest such magnitude.
+namespace SpyModeNS {
+enum SpyMode
+{
+    SPY_DENSITY,
+    SPY_MAGNITUDE
+};
+}
+using namespace SpyModeNS;
+
+struct SpyCtrl
+{
+    // The maximum resolution of the histogram; a matrix with fewer rows
+    // (columns) than this receives one pixel per row (column)
+    Int height=2048;
+    Int width=2048;
+    SpyMode mode=SPY_DENSITY;
+    // Whether the colors are sampled logarithmically between the smallest
+    // and largest nonzero pixels
+    bool logScale=true;
+};
+
+// The histogram is formed on every process which owns part of the matrix
+template<typename T>
+void SpyHistogram
+( const Matrix<T>& A, Matrix<double>& H, Base<T> tol=0,
+  const SpyCtrl& ctrl=SpyCtrl() );
+template<typename T>
+void SpyHistogram
+( const AbstractDistMatrix<T>& A, Matrix<double>& H, Base<T> tol=0,
+  const SpyCtrl& ctrl=SpyCtrl() );
+template<typename T>
+void SpyHistogram
+( const SparseMatrix<T>& A, Matrix<double>& H, Base<T> tol=0,
+  const SpyCtrl& ctrl=SpyCtrl() );
+template<typename T>
+void SpyHistogram
+( const DistSparseMatrix<T>& A, Matrix<double>& H, Base<T> tol=0,
+  const SpyCtrl& ctrl=SpyCtrl() );
+
+// Display the histogram of a matrix (on the root process of distributed
+// matrices)
+template<typename T>
+void Spy
+( const AbstractDistMatrix<T>& A, string title, Base<T> tol,
+  const SpyCtrl& ctrl );
+template<typename T>
+void Spy
+( const SparseMatrix<T>& A, string title="SparseMatrix", Base<T> tol=0,
+  const SpyCtrl& ctrl=SpyCtrl() );
+template<typename T>
+void Spy
+( const DistSparseMatrix<T>& A, string title="DistSparseMatrix",
+  Base<T> tol=0, const SpyCtrl& ctrl=SpyCtrl() );
+
+// Render a histogram to a PNG or PPM file without requiring Qt, so that
+// structure plots can be produced on headless nodes
+void WriteSpyHistogram
+( const Matrix<double>& H, string basename="Spy", FileFormat format=PNG,
+  const SpyCtrl& ctrl=SpyCtrl() );
+
+// Only the root process writes the plot of a distributed matrix
+template<typename T>
+void WriteSpy
+( const Matrix<T>& A, string basename="Spy", FileFormat format=PNG,
+  Base<T> tol=0, const SpyCtrl& ctrl=SpyCtrl() );
+template<typename T>
+void WriteSpy
+( const AbstractDistMatrix<T>& A, string basename="Spy",
+  FileFormat format=PNG, Base<T> tol=0, const SpyCtrl& ctrl=SpyCtrl() );
+template<typename T>
+void WriteSpy
+( const SparseMatrix<T>& A, string basename="Spy", FileFormat format=PNG,
+  Base<T> tol=0, const SpyCtrl& ctrl=SpyCtrl() );
+template<typename T>
+void WriteSpy
+( const DistSparseMatrix<T>& A, string basename="Spy",
+  FileFormat format=PNG, Base<T> tol=0, const SpyCtrl& ctrl=SpyCtrl() );
+
 // Write
 // =====
 template<typename T>
 void Write
 ( const Matrix<T>& A, string basename="Matrix", FileFormat format=BINARY,
   string title="" );
+// BINARY and BINARY_FLAT files of packed datatypes are written from
+// element-wrapped distributions collectively with MPI-IO, with each process
+// writing its own entries directly.
 template<typename T>
 void Write
 ( const AbstractDistMatrix<T>& A, string basename="DistMatrix",
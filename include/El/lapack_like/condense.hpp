@@ -13,6 +13,22 @@
 
 namespace El {
 
+// Bulge-chasing reflectors
+// ========================
+// The reflectors generated while chasing a band down to a condensed form in
+// the second stage of the two-stage reductions. The k'th reflector,
+// I - scalars[k] u u^H, acts on the 'lengths[k]' rows beginning at
+// 'offsets[k]', and the vectors u are stored consecutively.
+template<typename Field>
+struct BulgeReflectors
+{
+    Int bandwidth=0;
+    vector<Int> offsets;
+    vector<Int> lengths;
+    vector<Field> scalars;
+    vector<Field> vectors;
+};
+
 // Bidiag
 // ======
 
@@ -86,6 +102,85 @@ void ApplyP
   const AbstractDistMatrix<Field>& householderScalars,
         AbstractDistMatrix<Field>& B );
 
+// Two-stage bidiagonalization
+// ---------------------------
+// A, which must satisfy m >= n, is first reduced to an upper band of the given
+// width, A = Q1 B P1^H, using alternating blocked QR and LQ factorizations
+// (with Q1 stored below the diagonal and P1 to the right of the band), and the
+// band is then chased down to upper bidiagonal form, B = Q2 T P2^H. The
+// bidiagonal is real and is returned as its main and super-diagonals.
+// A bandwidth of zero selects the tuned blocksize for "BidiagTwoStage".
+
+template<typename Field>
+void TwoStage
+( Matrix<Field>& A,
+  Matrix<Base<Field>>& mainDiag,
+  Matrix<Base<Field>>& superDiag,
+  Int bandwidth=0 );
+template<typename Field>
+void TwoStage
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Base<Field>>& mainDiag,
+  AbstractDistMatrix<Base<Field>>& superDiag,
+  Int bandwidth=0 );
+
+template<typename Field>
+void TwoStage
+( Matrix<Field>& A,
+  Matrix<Field>& householderScalarsQ,
+  Matrix<Base<Field>>& signatureQ,
+  Matrix<Field>& householderScalarsP,
+  Matrix<Base<Field>>& signatureP,
+  Matrix<Base<Field>>& mainDiag,
+  Matrix<Base<Field>>& superDiag,
+  BulgeReflectors<Field>& reflectorsQ,
+  BulgeReflectors<Field>& reflectorsP,
+  Int bandwidth=0 );
+template<typename Field>
+void TwoStage
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalarsQ,
+  AbstractDistMatrix<Base<Field>>& signatureQ,
+  AbstractDistMatrix<Field>& householderScalarsP,
+  AbstractDistMatrix<Base<Field>>& signatureP,
+  AbstractDistMatrix<Base<Field>>& mainDiag,
+  AbstractDistMatrix<Base<Field>>& superDiag,
+  BulgeReflectors<Field>& reflectorsQ,
+  BulgeReflectors<Field>& reflectorsP,
+  Int bandwidth=0 );
+
+// B := Q B, where A = Q T P^H with Q = Q1 Q2
+template<typename Field>
+void ApplyTwoStageQ
+( const Matrix<Field>& A,
+  const Matrix<Field>& householderScalarsQ,
+  const Matrix<Base<Field>>& signatureQ,
+  const BulgeReflectors<Field>& reflectorsQ,
+        Matrix<Field>& B );
+template<typename Field>
+void ApplyTwoStageQ
+( const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalarsQ,
+  const AbstractDistMatrix<Base<Field>>& signatureQ,
+  const BulgeReflectors<Field>& reflectorsQ,
+        AbstractDistMatrix<Field>& B );
+
+// B := P B, where A = Q T P^H with P = P1 P2
+template<typename Field>
+void ApplyTwoStageP
+( const Matrix<Field>& A,
+  const Matrix<Field>& householderScalarsP,
+  const Matrix<Base<Field>>& signatureP,
+  const BulgeReflectors<Field>& reflectorsP,
+        Matrix<Field>& B );
+template<typename Field>
+void ApplyTwoStageP
+( const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalarsP,
+  const AbstractDistMatrix<Base<Field>>& signatureP,
+  const BulgeReflectors<Field>& reflectorsP,
+        AbstractDistMatrix<Field>& B );
+
 } // namespace bidiag
 
 // HermitianTridiag
@@ -141,6 +236,66 @@ void ApplyQ
   const AbstractDistMatrix<Field>& householderScalars,
         AbstractDistMatrix<Field>& B );
 
+// Two-stage tridiagonalization
+// ----------------------------
+// A is first reduced to a band of the given width, A = Q1 B Q1^H, using
+// blocked QR factorizations and BLAS-3 updates (with Q1 stored below the band
+// of A), and the band is then chased down to tridiagonal form, B = Q2 T Q2^H.
+// The bulge-chasing reflectors which form Q2 are only stored when requested.
+// A bandwidth of zero selects the tuned blocksize for "HermitianTwoStage".
+
+template<typename Field>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<Field>& A,
+  Matrix<Base<Field>>& d,
+  Matrix<Field>& dSub,
+  Int bandwidth=0 );
+template<typename Field>
+void TwoStage
+( UpperOrLower uplo,
+  AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Base<Field>>& d,
+  AbstractDistMatrix<Field>& dSub,
+  Int bandwidth=0 );
+
+template<typename Field>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<Field>& A,
+  Matrix<Field>& householderScalars,
+  Matrix<Base<Field>>& signature,
+  Matrix<Base<Field>>& d,
+  Matrix<Field>& dSub,
+  BulgeReflectors<Field>& reflectors,
+  Int bandwidth=0 );
+template<typename Field>
+void TwoStage
+( UpperOrLower uplo,
+  AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalars,
+  AbstractDistMatrix<Base<Field>>& signature,
+  AbstractDistMatrix<Base<Field>>& d,
+  AbstractDistMatrix<Field>& dSub,
+  BulgeReflectors<Field>& reflectors,
+  Int bandwidth=0 );
+
+// B := Q B, where A = Q T Q^H with Q = Q1 Q2
+template<typename Field>
+void ApplyTwoStageQ
+( const Matrix<Field>& A,
+  const Matrix<Field>& householderScalars,
+  const Matrix<Base<Field>>& signature,
+  const BulgeReflectors<Field>& reflectors,
+        Matrix<Field>& B );
+template<typename Field>
+void ApplyTwoStageQ
+( const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& householderScalars,
+  const AbstractDistMatrix<Base<Field>>& signature,
+  const BulgeReflectors<Field>& reflectors,
+        AbstractDistMatrix<Field>& B );
+
 } // namespace herm_tridiag
 
 // Hessenberg
@@ -186,6 +341,36 @@ void FormQ
   const AbstractDistMatrix<Field>& householderScalars,
         AbstractDistMatrix<Field>& Q );
 
+// Two-stage reduction to upper Hessenberg form
+// --------------------------------------------
+// A is first reduced to upper block-Hessenberg form, A = Q1 B Q1^H, using
+// blocked QR factorizations and BLAS-3 updates (with Q1 stored below the band
+// of A), and the band is then chased down to upper Hessenberg form,
+// B = Q2 H Q2^H. A bandwidth of zero selects the tuned blocksize for
+// "HessenbergTwoStage". Only sequential matrices are supported.
+
+// Only return the condensed upper Hessenberg matrix
+template<typename Field>
+void TwoStage( Matrix<Field>& A, Int bandwidth=0 );
+
+// On exit, H is stored in the upper Hessenberg part of A
+template<typename Field>
+void TwoStage
+( Matrix<Field>& A,
+  Matrix<Field>& householderScalars,
+  Matrix<Base<Field>>& signature,
+  BulgeReflectors<Field>& reflectors,
+  Int bandwidth=0 );
+
+// B := Q B, where A = Q H Q^H with Q = Q1 Q2
+template<typename Field>
+void ApplyTwoStageQ
+( const Matrix<Field>& A,
+  const Matrix<Field>& householderScalars,
+  const Matrix<Base<Field>>& signature,
+  const BulgeReflectors<Field>& reflectors,
+        Matrix<Field>& B );
+
 } // namespace hessenberg
 
 } // namespace El
@@ -109,6 +109,12 @@ typedef struct {
 } ElSQSDCtrl_d;
 EL_EXPORT ElError ElSQSDCtrlDefault_d( ElSQSDCtrl_d* ctrl );
 
+typedef enum {
+  EL_LS_DIRECT,
+  EL_LS_SKETCH_AND_PRECONDITION,
+  EL_LS_MULTIFRONTAL_QR
+} ElLeastSquaresAlg;
+
 typedef struct {
   bool scaleTwoNorm;
   ElInt basisSize;
@@ -117,6 +123,11 @@ typedef struct {
   bool equilibrate;
   bool progress;
   bool time;
+  ElLeastSquaresAlg alg;
+  double sketchRatio;
+  ElInt sketchSparsity;
+  float lsqrTol;
+  ElInt maxLSQRIts;
 } ElLeastSquaresCtrl_s;
 EL_EXPORT ElError ElLeastSquaresCtrlDefault_s( ElLeastSquaresCtrl_s* ctrl );
 
@@ -128,6 +139,11 @@ typedef struct {
   bool equilibrate;
   bool progress;
   bool time;
+  ElLeastSquaresAlg alg;
+  double sketchRatio;
+  ElInt sketchSparsity;
+  double lsqrTol;
+  ElInt maxLSQRIts;
 } ElLeastSquaresCtrl_d;
 EL_EXPORT ElError ElLeastSquaresCtrlDefault_d( ElLeastSquaresCtrl_d* ctrl );
 
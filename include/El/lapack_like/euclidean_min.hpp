@@ -62,9 +62,43 @@ struct SQSDCtrl
     bool time=false;
 };
 
+namespace LeastSquaresAlgNS {
+enum LeastSquaresAlg {
+    // QR (or LQ) factorizations for dense matrices and the regularized
+    // augmented system for sparse matrices
+    LS_DIRECT,
+
+    // Compute the R from a QR factorization of a sparse sign embedding, S A,
+    // of A and use it as a right preconditioner for LSQR (only used when
+    // height(op(A)) >= width(op(A)))
+    LS_SKETCH_AND_PRECONDITION,
+
+    // A Q-less multifrontal QR factorization of op(A) (or its adjoint, for
+    // minimum-length problems) followed by the corrected seminormal equations
+    // (only used for sparse matrices)
+    LS_MULTIFRONTAL_QR
+};
+}
+using namespace LeastSquaresAlgNS;
+
 template<typename Real>
 struct LeastSquaresCtrl
 {
+    LeastSquaresAlg alg=LS_DIRECT;
+
+    // Sketch-and-precondition
+    // -----------------------
+    // The sketch S A has ceil(sketchRatio*n) rows and each row of A is
+    // added, with a random sign, into 'sketchSparsity' of them
+    double sketchRatio=4.;
+    Int sketchSparsity=4;
+
+    // The preconditioned LSQR iteration stops once every column satisfies
+    // || (A R^{-1})^H r ||_2 <= lsqrTol || A R^{-1} ||_F || r ||_2 or
+    // || r ||_2 <= lsqrTol || b ||_2
+    Real lsqrTol=Pow(limits::Epsilon<Real>(),Real(0.9));
+    Int maxLSQRIts=500;
+
     bool scaleTwoNorm=true;
     Int basisSize=15; // only used if 'scaleTwoNorm' is true
 
@@ -78,18 +112,43 @@ struct LeastSquaresCtrl
 
     SQSDCtrl<Real> sqsdCtrl;
 
+    // Multifrontal QR
+    // ---------------
+    // The nested dissection of the graph of the columns of op(A) (or of its
+    // adjoint). Since each leaf is factored as a dense front, the default
+    // cutoff is much smaller than for sparse LDL.
+    BisectCtrl qrBisectCtrl;
+
     bool equilibrate=true;
     bool progress=false;
     bool time=false;
 
     LeastSquaresCtrl()
     {
+        qrBisectCtrl.cutoff = 128;
         sqsdCtrl.scaleTwoNorm = false;
         sqsdCtrl.canOverwrite = true;
         sqsdCtrl.equilibrate = false;
     }
 };
 
+// Dense versions which only make use of the 'alg' member and, for
+// LS_SKETCH_AND_PRECONDITION, the sketch and LSQR parameters
+template<typename Field>
+void LeastSquares
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const LeastSquaresCtrl<Base<Field>>& ctrl );
+template<typename Field>
+void LeastSquares
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+        AbstractDistMatrix<Field>& X,
+  const LeastSquaresCtrl<Base<Field>>& ctrl );
+
 template<typename Field>
 void LeastSquares
 ( Orientation orientation,
@@ -172,6 +231,50 @@ void Ridge
         DistMultiVec<Field>& X,
   const LeastSquaresCtrl<Base<Field>>& ctrl=LeastSquaresCtrl<Base<Field>>() );
 
+// Ridge regularization paths
+// --------------------------
+// Solve the Ridge regression problem for each of the regularization
+// parameters in the column vector 'gammas' from a single thin SVD,
+// op(A) = U Sigma V^H, so that each additional parameter only requires
+// rescaling the coefficients U^H B. The solution for the l'th parameter
+// occupies the l'th of 'gammas.Height()' equally-sized blocks of columns of
+// X, and the residual norm || B - op(A) X_l ||_2 of the j'th right-hand side
+// is returned in entry (j,l) of 'residNorms'. The parameters and residual
+// norms are redundantly stored on every process in the distributed case.
+
+template<typename Field>
+void RidgePath
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        Matrix<Field>& X,
+        Matrix<Base<Field>>& residNorms );
+template<typename Field>
+void RidgePath
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        AbstractDistMatrix<Field>& X,
+        Matrix<Base<Field>>& residNorms );
+
+// Only compute the residual norms (e.g., for cross-validation sweeps)
+template<typename Field>
+void RidgePath
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        Matrix<Base<Field>>& residNorms );
+template<typename Field>
+void RidgePath
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        Matrix<Base<Field>>& residNorms );
+
 // Tikhonov regularization
 // =======================
 
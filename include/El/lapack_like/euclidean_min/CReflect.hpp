@@ -79,6 +79,11 @@ inline SQSDCtrl<double> CReflect( const ElSQSDCtrl_d& ctrlC )
     return ctrl;
 }
 
+inline ElLeastSquaresAlg CReflect( LeastSquaresAlg alg )
+{ return static_cast<ElLeastSquaresAlg>(alg); }
+inline LeastSquaresAlg CReflect( ElLeastSquaresAlg alg )
+{ return static_cast<LeastSquaresAlg>(alg); }
+
 inline ElLeastSquaresCtrl_s CReflect( const LeastSquaresCtrl<float>& ctrl )
 {
     ElLeastSquaresCtrl_s ctrlC;
@@ -89,6 +94,11 @@ inline ElLeastSquaresCtrl_s CReflect( const LeastSquaresCtrl<float>& ctrl )
     ctrlC.equilibrate  = ctrl.equilibrate;
     ctrlC.progress     = ctrl.progress;
     ctrlC.time         = ctrl.time;
+    ctrlC.alg          = CReflect(ctrl.alg);
+    ctrlC.sketchRatio  = ctrl.sketchRatio;
+    ctrlC.sketchSparsity = ctrl.sketchSparsity;
+    ctrlC.lsqrTol      = ctrl.lsqrTol;
+    ctrlC.maxLSQRIts   = ctrl.maxLSQRIts;
     return ctrlC;
 }
 
@@ -102,6 +112,11 @@ inline ElLeastSquaresCtrl_d CReflect( const LeastSquaresCtrl<double>& ctrl )
     ctrlC.equilibrate  = ctrl.equilibrate;
     ctrlC.progress     = ctrl.progress;
     ctrlC.time         = ctrl.time;
+    ctrlC.alg          = CReflect(ctrl.alg);
+    ctrlC.sketchRatio  = ctrl.sketchRatio;
+    ctrlC.sketchSparsity = ctrl.sketchSparsity;
+    ctrlC.lsqrTol      = ctrl.lsqrTol;
+    ctrlC.maxLSQRIts   = ctrl.maxLSQRIts;
     return ctrlC;
 }
 
@@ -115,6 +130,11 @@ inline LeastSquaresCtrl<float> CReflect( const ElLeastSquaresCtrl_s& ctrlC )
     ctrl.equilibrate  = ctrlC.equilibrate;
     ctrl.progress     = ctrlC.progress;
     ctrl.time         = ctrlC.time;
+    ctrl.alg          = CReflect(ctrlC.alg);
+    ctrl.sketchRatio  = ctrlC.sketchRatio;
+    ctrl.sketchSparsity = ctrlC.sketchSparsity;
+    ctrl.lsqrTol      = ctrlC.lsqrTol;
+    ctrl.maxLSQRIts   = ctrlC.maxLSQRIts;
     return ctrl;
 }
 
@@ -128,6 +148,11 @@ inline LeastSquaresCtrl<double> CReflect( const ElLeastSquaresCtrl_d& ctrlC )
     ctrl.equilibrate  = ctrlC.equilibrate;
     ctrl.progress     = ctrlC.progress;
     ctrl.time         = ctrlC.time;
+    ctrl.alg          = CReflect(ctrlC.alg);
+    ctrl.sketchRatio  = ctrlC.sketchRatio;
+    ctrl.sketchSparsity = ctrlC.sketchSparsity;
+    ctrl.lsqrTol      = ctrlC.lsqrTol;
+    ctrl.maxLSQRIts   = ctrlC.maxLSQRIts;
     return ctrl;
 }
 
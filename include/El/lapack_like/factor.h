@@ -420,7 +420,9 @@ EL_EXPORT ElError ElMultiplyAfterLDLPivDist_z
 typedef enum
 {
   EL_REG_SOLVE_FGMRES,
-  EL_REG_SOLVE_LGMRES
+  EL_REG_SOLVE_LGMRES,
+  EL_REG_SOLVE_PIPELINED_CG,
+  EL_REG_SOLVE_PIPELINED_GMRES
 } ElRegSolveAlg;
 
 typedef struct
@@ -459,7 +461,8 @@ typedef enum
   EL_LU_PARTIAL,
   EL_LU_FULL,
   EL_LU_ROOK,
-  EL_LU_WITHOUT_PIVOTING
+  EL_LU_WITHOUT_PIVOTING,
+  EL_LU_TOURNAMENT
 } ElLUPivotType;
 
 /* LU factorization with no pivoting
@@ -20,12 +20,35 @@ namespace El {
 // ========
 template<typename Field>
 void Cholesky( UpperOrLower uplo, Matrix<Field>& A );
+// A positive lookahead overlaps the redistributions of each panel with the
+// trailing update of the previous one (only a depth of one is currently
+// exploited)
 template<typename Field>
 void Cholesky
-( UpperOrLower uplo, AbstractDistMatrix<Field>& A, bool scalapack=false );
+( UpperOrLower uplo, AbstractDistMatrix<Field>& A, bool scalapack=false,
+  Int lookahead=0 );
 template<typename Field>
 void Cholesky( UpperOrLower uplo, DistMatrix<Field,STAR,STAR>& A );
 
+// Batched Cholesky
+// ----------------
+// Factor each member of a batch of (typically small) independent matrices,
+// with the members processed in parallel
+template<typename Field>
+void CholeskyBatched( UpperOrLower uplo, vector<Matrix<Field>>& A );
+// The batch is instead stored side-by-side, with the b'th member occupying
+// the b'th of 'batchSize' equally-sized blocks of columns
+template<typename Field>
+void CholeskyBatched( UpperOrLower uplo, Int batchSize, Matrix<Field>& A );
+
+// Tiled Cholesky
+// --------------
+// Factor a single large matrix as a dependency graph of tasks over its
+// tiles (see also LUTiled and QRTiled); a tile size of zero selects the
+// tuned blocksize for "CholeskyTiled"
+template<typename Field>
+void CholeskyTiled( UpperOrLower uplo, Matrix<Field>& A, Int tileSize=0 );
+
 template<typename Field>
 void ReverseCholesky( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
@@ -57,6 +80,11 @@ void HPSDCholesky( UpperOrLower uplo, Matrix<Field>& A );
 template<typename Field>
 void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<Field>& A );
 
+// Overwrite the packed lower triangle of an HPD matrix with its Cholesky
+// factor
+template<typename Field>
+void Cholesky( DistPackedMatrix<Field>& A );
+
 namespace cholesky {
 
 template<typename Field>
@@ -87,6 +115,12 @@ void SolveAfter
   const DistPermutation& P,
         AbstractDistMatrix<Field>& B );
 
+// Solve A X = B given the packed Cholesky factor L of A
+template<typename Field>
+void SolveAfter
+( const DistPackedMatrix<Field>& L,
+        AbstractDistMatrix<Field>& B );
+
 } // namespace cholesky
 
 // LDL
@@ -112,6 +146,7 @@ Real LDLPivotConstant( LDLPivotType pivType )
     switch( pivType )
     {
     case BUNCH_KAUFMAN_A:
+    case BUNCH_KAUFMAN_BOUNDED:
     case BUNCH_PARLETT:   return (1+Sqrt(Real(17)))/8;
     case BUNCH_KAUFMAN_D: return Real(0.525);
     default:
@@ -143,6 +178,8 @@ template<typename Field>
 void LDL( AbstractDistMatrix<Field>& A, bool conjugate );
 template<typename Field>
 void LDL( DistMatrix<Field,STAR,STAR>& A, bool conjugate );
+template<typename Field>
+void LDL( DistPackedMatrix<Field>& A, bool conjugate );
 
 // Return an implicit representation of a pivoted LDL factorization of A
 // ---------------------------------------------------------------------
@@ -216,6 +253,11 @@ void SolveAfter
 ( const AbstractDistMatrix<Field>& A,
         AbstractDistMatrix<Field>& B,
   bool conjugated );
+template<typename Field>
+void SolveAfter
+( const DistPackedMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  bool conjugated );
 
 // Solve linear system with the implicit representations of L, D, and P
 // --------------------------------------------------------------------
@@ -238,10 +280,17 @@ void SolveAfter
 
 // Solve a linear system with a regularized factorization
 // ======================================================
+// The pipelined variants perform a single non-blocking reduction per
+// iteration and overlap it with the preconditioner and the matrix-vector
+// product. Pipelined CG requires a Hermitian positive-definite system (e.g.,
+// the normal-equation formulations) and so pipelined GMRES should be used
+// for quasi-semidefinite KKT systems.
 enum RegSolveAlg
 {
   REG_SOLVE_FGMRES,
-  REG_SOLVE_LGMRES
+  REG_SOLVE_LGMRES,
+  REG_SOLVE_PIPELINED_CG,
+  REG_SOLVE_PIPELINED_GMRES
 };
 
 template<typename Real>
@@ -342,6 +391,71 @@ Int SolveAfter
         DistMultiVec<Field>& B,
   const RegSolveCtrl<Base<Field>>& ctrl );
 
+// Variants for a matrix-free operator A, where the sparse factorization is of
+// an approximation of A + diag(reg) (e.g., of a regularized sparse
+// approximation of the operator) and is used to precondition FGMRES or LGMRES
+template<typename Field>
+Int SolveAfter
+( const LinearOperator<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const SparseLDLFactorization<Field>& sparseLDLFact,
+        Matrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl );
+template<typename Field>
+Int SolveAfter
+( const DistLinearOperator<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistSparseLDLFactorization<Field>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl );
+
+// Mixed-precision variants of the above which solve against a factorization
+// stored in a lower precision (e.g., a single-precision factorization of a
+// double-precision matrix) while the regularized matrix, the residuals, and
+// the Krylov iterates are all kept in the higher precision. Since the
+// refinement is already used to remove the effects of the (temporary)
+// regularization, it also removes the effects of the lower-precision
+// factorization so long as the latter is not too ill-conditioned.
+template<typename FieldLow,typename Field>
+Int RegularizedSolveAfter
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const Matrix<Base<Field>>& d,
+  const SparseLDLFactorization<FieldLow>& sparseLDLFact,
+        Matrix<Field>& B,
+        Base<Field> relTolRefine,
+        Int maxRefineIts,
+        bool progress=false,
+        bool time=false );
+template<typename FieldLow,typename Field>
+Int RegularizedSolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistMultiVec<Base<Field>>& d,
+  const DistSparseLDLFactorization<FieldLow>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+        Base<Field> relTolRefine,
+        Int maxRefineIts,
+        bool progress=false,
+        bool time=false );
+
+template<typename FieldLow,typename Field>
+Int SolveAfter
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const Matrix<Base<Field>>& d,
+  const SparseLDLFactorization<FieldLow>& sparseLDLFact,
+        Matrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl );
+template<typename FieldLow,typename Field>
+Int SolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistMultiVec<Base<Field>>& d,
+  const DistSparseLDLFactorization<FieldLow>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl );
+
 } // namespace reg_ldl
 
 // LU
@@ -356,7 +470,8 @@ enum LUPivotType
     LU_PARTIAL,
     LU_FULL,
     LU_ROOK, /* not yet supported */
-    LU_WITHOUT_PIVOTING
+    LU_WITHOUT_PIVOTING,
+    LU_TOURNAMENT /* communication-avoiding pivoting, as in CALU */
 };
 }
 using namespace LUPivotTypeNS;
@@ -376,6 +491,28 @@ template<typename Field>
 void LU( Matrix<Field>& A, Permutation& P );
 template<typename Field>
 void LU( AbstractDistMatrix<Field>& A, DistPermutation& P );
+// The pivot type may be either LU_PARTIAL or LU_TOURNAMENT; the latter
+// selects the pivots of each panel with a single exchange of candidate rows
+// rather than a reduction per column
+template<typename Field>
+void LU
+( AbstractDistMatrix<Field>& A, DistPermutation& P, LUPivotType pivotType );
+
+// Batched LU with partial pivoting
+// --------------------------------
+template<typename Field>
+void LUBatched( vector<Matrix<Field>>& A, vector<Permutation>& P );
+// The batch is instead stored side-by-side (see CholeskyBatched)
+template<typename Field>
+void LUBatched
+( Int batchSize, Matrix<Field>& A, vector<Permutation>& P );
+
+// Tiled LU with partial pivoting
+// ------------------------------
+// The tasks operate on columns of tiles, as the pivoting of each panel
+// couples all of the rows of the trailing matrix
+template<typename Field>
+void LUTiled( Matrix<Field>& A, Permutation& P, Int tileSize=0 );
 
 // LU with full pivoting
 // ---------------------
@@ -577,6 +714,15 @@ void QR
   AbstractDistMatrix<Field>& householderScalars,
   AbstractDistMatrix<Base<Field>>& signature );
 
+// The same representation computed by a graph of tasks over columns of tiles
+// (see CholeskyTiled)
+template<typename Field>
+void QRTiled
+( Matrix<Field>& A,
+  Matrix<Field>& householderScalars,
+  Matrix<Base<Field>>& signature,
+  Int tileSize=0 );
+
 // Return an implicit representation of (Q,R,Omega) such that A Omega^T ~= Q R
 // ---------------------------------------------------------------------------
 template<typename Field>
@@ -642,6 +788,22 @@ void Cholesky( Matrix<Field>& A, Matrix<Field>& R );
 template<typename Field>
 void Cholesky( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R );
 
+// CholeskyQR2 repeats CholeskyQR to restore the orthogonality of Q and is
+// accurate when cond(A) is sufficiently below eps^{-1/2}, whereas shifted
+// CholeskyQR3 first performs a CholeskyQR with a shifted Gram matrix so that
+// cond(A) may approach eps^{-1}. Both fall back to TSQR (or Householder QR)
+// if a Cholesky factorization breaks down or a cheap estimate of the
+// condition number is too large.
+template<typename Field>
+void CholeskyQR2( Matrix<Field>& A, Matrix<Field>& R );
+template<typename Field>
+void CholeskyQR2( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R );
+template<typename Field>
+void ShiftedCholeskyQR3( Matrix<Field>& A, Matrix<Field>& R );
+template<typename Field>
+void ShiftedCholeskyQR3
+( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R );
+
 // Return R (with non-negative diagonal) such that A = Q R or A Omega^T = Q R
 // --------------------------------------------------------------------------
 template<typename Field>
@@ -759,6 +921,15 @@ TreeData<Field> TS( const AbstractDistMatrix<Field>& A );
 template<typename Field>
 void ExplicitTS( AbstractDistMatrix<Field>& A, AbstractDistMatrix<Field>& R );
 
+// Compute the same implicit representation as QR(A,householderScalars,
+// signature) using communication-avoiding QR (CAQR): each panel is factored
+// with TSQR and its Householder vectors are reconstructed from the result
+template<typename Field>
+void CommunicationAvoiding
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Field>& householderScalars,
+  AbstractDistMatrix<Base<Field>>& signature );
+
 namespace ts {
 
 template<typename Field>
@@ -947,8 +1118,107 @@ void Skeleton
         AbstractDistMatrix<Field>& Z,
   const QRCtrl<Base<Field>>& ctrl=QRCtrl<Base<Field>>() );
 
+// Randomized range finder
+// =======================
+enum SketchType {
+  GAUSSIAN_SKETCH,
+  // Each row of the sketch has a single nonzero, which is a random sign in a
+  // random column, so that applying it requires a single pass over A
+  SPARSE_SIGN_SKETCH
+};
+
+struct RandomizedRangeCtrl
+{
+    // The number of columns sampled beyond the requested rank
+    Int oversampling=10;
+
+    // The number of applications of op(A) op(A)^H to the initial sample, each
+    // of which is preceded by an orthonormalization
+    Int numPowerIts=1;
+
+    SketchType sketch=GAUSSIAN_SKETCH;
+};
+
+// Form Q, with Min(rank+oversampling,m,n) orthonormal columns, whose range
+// approximates the dominant rank-'rank' subspace of the range of op(A), which
+// is either A or A^H, from op(A) Omega for a random sketch Omega. Each sample
+// is orthonormalized with CholeskyQR2, which falls back to TSQR.
+template<typename Field>
+void RandomizedRange
+( Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& Q,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl=RandomizedRangeCtrl() );
+template<typename Field>
+void RandomizedRange
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& Q,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl=RandomizedRangeCtrl() );
+template<typename Field>
+void RandomizedRange
+( Orientation orientation,
+  const SparseMatrix<Field>& A,
+        Matrix<Field>& Q,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl=RandomizedRangeCtrl() );
+template<typename Field>
+void RandomizedRange
+( Orientation orientation,
+  const DistSparseMatrix<Field>& A,
+        DistMultiVec<Field>& Q,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl=RandomizedRangeCtrl() );
+
+// Randomized Interpolative Decomposition
+// ======================================
+// Compute an ID, A Omega^T ~= A(:,J) [I, Z], of rank at most 'rank' from the
+// ID of the (rank+oversampling) x n matrix Q^H A, where Q is the result of
+// RandomizedRange.
+template<typename Field>
+void RandomizedID
+( const Matrix<Field>& A,
+        Permutation& Omega,
+        Matrix<Field>& Z,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl=RandomizedRangeCtrl() );
+template<typename Field>
+void RandomizedID
+( const AbstractDistMatrix<Field>& A,
+        DistPermutation& Omega,
+        AbstractDistMatrix<Field>& Z,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl=RandomizedRangeCtrl() );
+
+// Randomized Skeleton
+// ===================
+// Select the rows and columns of a skeleton decomposition, A ~= AC Z AR, from
+// randomized IDs of A^H and A, and then form Z = pinv(AC) A pinv(AR) using
+// the QR decompositions of AC and AR^H.
+template<typename Field>
+void RandomizedSkeleton
+( const Matrix<Field>& A,
+        Permutation& PR,
+        Permutation& PC,
+        Matrix<Field>& Z,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl=RandomizedRangeCtrl() );
+template<typename Field>
+void RandomizedSkeleton
+( const AbstractDistMatrix<Field>& A,
+        DistPermutation& PR,
+        DistPermutation& PC,
+        AbstractDistMatrix<Field>& Z,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl=RandomizedRangeCtrl() );
+
 } // namespace El
 
 #include <El/lapack_like/factor/qr/ProxyHouseholder.hpp>
+#include <El/lapack_like/factor/hodlr.hpp>
+#include <El/lapack_like/factor/band.hpp>
+#include <El/lapack_like/factor/dense.hpp>
 
 #endif // ifndef EL_FACTOR_HPP
@@ -0,0 +1,188 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FACTOR_BAND_HPP
+#define EL_FACTOR_BAND_HPP
+
+namespace El {
+
+// Band matrices
+// =============
+// An n x n matrix with lower bandwidth kl and upper bandwidth ku, i.e., with
+// A(i,j) = 0 unless -ku <= i-j <= kl, is stored as in LAPACK: entry
+// (ku+i-j,j) of the (kl+ku+1) x n matrix returned by Band() holds A(i,j).
+// The storage, and the work and memory of the factorizations below, are
+// O(n (kl+ku)) rather than the O(n^2) of a mostly-zero dense matrix.
+template<typename Field>
+class BandMatrix
+{
+public:
+    BandMatrix();
+    BandMatrix( Int n, Int lowerBandwidth, Int upperBandwidth );
+
+    // Resize and zero the band
+    void Resize( Int n, Int lowerBandwidth, Int upperBandwidth );
+
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int LowerBandwidth() const EL_NO_EXCEPT;
+    Int UpperBandwidth() const EL_NO_EXCEPT;
+    bool InBand( Int i, Int j ) const EL_NO_EXCEPT;
+
+    // Entries outside of the band are zero and may not be modified
+    Field Get( Int i, Int j ) const;
+    void Set( Int i, Int j, const Field& value );
+    void Update( Int i, Int j, const Field& value );
+
+    Matrix<Field>& Band() EL_NO_EXCEPT;
+    const Matrix<Field>& LockedBand() const EL_NO_EXCEPT;
+
+    // Y := alpha op(A) X + beta Y
+    void Multiply
+    ( Orientation orientation,
+      Field alpha, const Matrix<Field>& X,
+      Field beta,        Matrix<Field>& Y ) const;
+
+private:
+    Int height_=0, lower_=0, upper_=0;
+    Matrix<Field> band_;
+};
+
+// The columns of a distributed band matrix are distributed over the grid in
+// the same contiguous blocks as the rows of a DistMultiVec, and each process
+// stores the band of its columns (including the entries of rows owned by
+// its neighbors).
+template<typename Field>
+class DistBandMatrix
+{
+public:
+    explicit DistBandMatrix( const El::Grid& grid=El::Grid::Default() );
+    DistBandMatrix
+    ( Int n, Int lowerBandwidth, Int upperBandwidth,
+      const El::Grid& grid=El::Grid::Default() );
+
+    void SetGrid( const El::Grid& grid );
+    // Resize and zero the band
+    void Resize( Int n, Int lowerBandwidth, Int upperBandwidth );
+
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int LowerBandwidth() const EL_NO_EXCEPT;
+    Int UpperBandwidth() const EL_NO_EXCEPT;
+    bool InBand( Int i, Int j ) const EL_NO_EXCEPT;
+    const El::Grid& Grid() const EL_NO_EXCEPT;
+
+    Int Blocksize() const EL_NO_EXCEPT;
+    Int FirstLocalCol() const EL_NO_EXCEPT;
+    Int LocalWidth() const EL_NO_EXCEPT;
+    int ColOwner( Int j ) const EL_NO_EXCEPT;
+    bool IsLocalCol( Int j ) const EL_NO_EXCEPT;
+    Int GlobalCol( Int jLoc ) const EL_NO_EXCEPT;
+    Int LocalCol( Int j ) const EL_NO_EXCEPT;
+
+    // Entry (i,GlobalCol(jLoc))
+    Field GetLocal( Int i, Int jLoc ) const;
+    void SetLocal( Int i, Int jLoc, const Field& value );
+    void UpdateLocal( Int i, Int jLoc, const Field& value );
+
+    // Batch updates of entries of any column
+    void Reserve( Int numRemoteEntries );
+    void QueueUpdate( Int i, Int j, const Field& value );
+    void ProcessQueues();
+
+    // The (kl+ku+1) x LocalWidth() band of the local columns
+    Matrix<Field>& Band() EL_NO_EXCEPT;
+    const Matrix<Field>& LockedBand() const EL_NO_EXCEPT;
+
+    // Y := alpha A X + beta Y
+    void Multiply
+    ( Field alpha, const DistMultiVec<Field>& X,
+      Field beta,        DistMultiVec<Field>& Y ) const;
+
+private:
+    Int height_=0, lower_=0, upper_=0, blocksize_=1;
+    const El::Grid* grid_;
+    Matrix<Field> band_;
+    vector<Entry<Field>> remoteUpdates_;
+};
+
+// Band factorizations
+// ===================
+// LU factorization with partial pivoting (with the upper bandwidth of U
+// growing to kl+ku, as in LAPACK's ?gbtrf) or, if 'hermitian' is true, a
+// Cholesky factorization of the lower triangle of the band (as in ?pbtrf).
+template<typename Field>
+class BandFactorization
+{
+public:
+    BandFactorization();
+
+    void Factor( const BandMatrix<Field>& A, bool hermitian=false );
+    bool Factored() const EL_NO_EXCEPT;
+    Int Height() const EL_NO_EXCEPT;
+
+    // B := inv(A) B
+    void Solve( Matrix<Field>& B ) const;
+
+private:
+    Int height_=0, lower_=0, upper_=0;
+    bool hermitian_=false, factored_=false;
+    Matrix<Field> factors_;
+    vector<Int> pivots_;
+};
+
+// A partitioned ("SPIKE") factorization,
+//
+//   Eric Polizzi and Ahmed Sameh,
+//   "A parallel hybrid banded system solver: the SPIKE algorithm",
+//   Parallel Computing, Vol. 32, No. 2, pp. 177--194, 2006.
+//
+// Each process factors its diagonal block, D_q, with the sequential band
+// factorization (and so pivoting never crosses process boundaries, as in
+// ScaLAPACK's P?GBSV, which requires the diagonal blocks to be nonsingular),
+// and computes the spikes inv(D_q) [0; B_q] and inv(D_q) [C_q; 0] of its
+// couplings to its neighbors. The O(p (kl+ku)) x O(p (kl+ku)) reduced
+// system for the unknowns at the partition boundaries is gathered and
+// factored redundantly. The factorization requires O(n (kl+ku)^2/p +
+// p (kl+ku)^3) work per process and a single AllGather, and each solve
+// requires O(n (kl+ku)/p + p (kl+ku)^2) work per right-hand side and a
+// single AllGather. Each nonempty block must have at least kl+ku rows.
+//
+// If 'hermitian' is true, only the lower triangle of the band is accessed,
+// the diagonal blocks are factored with Cholesky, and ku is taken to be kl.
+template<typename Field>
+class DistBandFactorization
+{
+public:
+    DistBandFactorization();
+
+    void Factor( const DistBandMatrix<Field>& A, bool hermitian=false );
+    bool Factored() const EL_NO_EXCEPT;
+    Int Height() const EL_NO_EXCEPT;
+
+    // B := inv(A) B, where B must be distributed over the same grid as A
+    void Solve( DistMultiVec<Field>& B ) const;
+
+private:
+    Int height_=0, lower_=0, upper_=0, blocksize_=1;
+    int numParts_=0;
+    bool factored_=false;
+    const El::Grid* grid_=nullptr;
+
+    // The factored diagonal block and the (localHeight x ku) and
+    // (localHeight x kl) spikes
+    BandFactorization<Field> local_;
+    Matrix<Field> V_, W_;
+
+    // The factored reduced system
+    BandFactorization<Field> reduced_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_FACTOR_BAND_HPP
@@ -0,0 +1,200 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FACTOR_DENSE_HPP
+#define EL_FACTOR_DENSE_HPP
+
+namespace El {
+
+// Dense factorizations
+// ====================
+// Factorizations which retain their factors and pivots so that repeated
+// solves against the same matrix (e.g., with right-hand sides which arrive
+// one at a time) do not refactor it. The distributed factorizations also keep
+// a right-hand side workspace whose column alignment matches that of the
+// factors and replay planned redistributions (see RedistPlan) into and out
+// of it as long as the layout of the right-hand sides does not change;
+// right-hand sides which are already suitably aligned [MC,MR] matrices are
+// solved in place. The plans do not bind persistent requests, so the
+// factorizations hold no MPI state beyond that of their DistMatrix members.
+
+template<typename T> class RedistPlan;
+
+namespace dense_factor {
+
+template<typename Field>
+class SolveWorkspace
+{
+public:
+    SolveWorkspace();
+    ~SolveWorkspace();
+
+    // Return B itself if it is an [MC,MR] matrix with the column alignment of
+    // the factors, and otherwise the workspace holding a copy of B
+    DistMatrix<Field>& Load
+    ( const DistMatrix<Field>& factors, AbstractDistMatrix<Field>& B );
+    // Copy the workspace back into B (if Load did not return B itself)
+    void Store( AbstractDistMatrix<Field>& B );
+
+private:
+    bool inPlace_=true;
+    DistMatrix<Field> X_;
+    unique_ptr<RedistPlan<Field>> toPlan_, fromPlan_;
+};
+
+} // namespace dense_factor
+
+// LU factorization with partial pivoting, P A = L U
+template<typename Field>
+class LUFactorization
+{
+public:
+    void Factor( const Matrix<Field>& A );
+    bool Factored() const EL_NO_EXCEPT;
+    Int Height() const EL_NO_EXCEPT;
+
+    // B := inv(A) B, inv(A)^T B, or inv(A)^H B
+    void Solve( Matrix<Field>& B, Orientation orientation=NORMAL ) const;
+
+    // Update the factorization to that of A + U V^H (or A + U V^T if
+    // 'conjugate' is false) using LUMod
+    void Update
+    ( const Matrix<Field>& U, const Matrix<Field>& V, bool conjugate=true );
+
+    const Matrix<Field>& Factors() const EL_NO_EXCEPT;
+    const Permutation& RowPermutation() const EL_NO_EXCEPT;
+
+private:
+    bool factored_=false;
+    Matrix<Field> factors_;
+    Permutation P_;
+};
+
+template<typename Field>
+class DistLUFactorization
+{
+public:
+    void Factor( const AbstractDistMatrix<Field>& A );
+    bool Factored() const EL_NO_EXCEPT;
+    Int Height() const EL_NO_EXCEPT;
+
+    // B := inv(A) B, inv(A)^T B, or inv(A)^H B, where B must be distributed
+    // over the same grid as A
+    void Solve
+    ( AbstractDistMatrix<Field>& B, Orientation orientation=NORMAL ) const;
+
+    void Update
+    ( const AbstractDistMatrix<Field>& U,
+      const AbstractDistMatrix<Field>& V,
+      bool conjugate=true );
+
+    const DistMatrix<Field>& Factors() const EL_NO_EXCEPT;
+    const DistPermutation& RowPermutation() const EL_NO_EXCEPT;
+
+private:
+    bool factored_=false;
+    DistMatrix<Field> factors_;
+    DistPermutation P_;
+    mutable dense_factor::SolveWorkspace<Field> workspace_;
+};
+
+// Cholesky factorization of the 'uplo' triangle of a Hermitian positive-
+// definite matrix
+template<typename Field>
+class CholeskyFactorization
+{
+public:
+    void Factor( UpperOrLower uplo, const Matrix<Field>& A );
+    bool Factored() const EL_NO_EXCEPT;
+    Int Height() const EL_NO_EXCEPT;
+
+    // B := inv(A) B (or inv(A)^T B)
+    void Solve( Matrix<Field>& B, Orientation orientation=NORMAL ) const;
+
+    // Update the factorization to that of A + alpha V V^H using CholeskyMod
+    void Update( Base<Field> alpha, const Matrix<Field>& V );
+
+    UpperOrLower Uplo() const EL_NO_EXCEPT;
+    const Matrix<Field>& Factors() const EL_NO_EXCEPT;
+
+private:
+    bool factored_=false;
+    UpperOrLower uplo_=LOWER;
+    Matrix<Field> factor_;
+};
+
+template<typename Field>
+class DistCholeskyFactorization
+{
+public:
+    void Factor( UpperOrLower uplo, const AbstractDistMatrix<Field>& A );
+    bool Factored() const EL_NO_EXCEPT;
+    Int Height() const EL_NO_EXCEPT;
+
+    void Solve
+    ( AbstractDistMatrix<Field>& B, Orientation orientation=NORMAL ) const;
+
+    void Update( Base<Field> alpha, const AbstractDistMatrix<Field>& V );
+
+    UpperOrLower Uplo() const EL_NO_EXCEPT;
+    const DistMatrix<Field>& Factors() const EL_NO_EXCEPT;
+
+private:
+    bool factored_=false;
+    UpperOrLower uplo_=LOWER;
+    DistMatrix<Field> factor_;
+    mutable dense_factor::SolveWorkspace<Field> workspace_;
+};
+
+// Pivoted LDL^T (or, if 'conjugate' is true, LDL^H) factorization of the lower
+// triangle of a symmetric (or Hermitian) matrix. As no modification routine
+// exists for such factorizations, an updated matrix must be refactored.
+template<typename Field>
+class LDLFactorization
+{
+public:
+    void Factor
+    ( const Matrix<Field>& A,
+      bool conjugate=false,
+      const LDLPivotCtrl<Base<Field>>& ctrl=LDLPivotCtrl<Base<Field>>() );
+    bool Factored() const EL_NO_EXCEPT;
+    Int Height() const EL_NO_EXCEPT;
+
+    void Solve( Matrix<Field>& B, Orientation orientation=NORMAL ) const;
+
+private:
+    bool factored_=false, conjugate_=false;
+    Matrix<Field> factors_, dSub_;
+    Permutation P_;
+};
+
+template<typename Field>
+class DistLDLFactorization
+{
+public:
+    void Factor
+    ( const AbstractDistMatrix<Field>& A,
+      bool conjugate=false,
+      const LDLPivotCtrl<Base<Field>>& ctrl=LDLPivotCtrl<Base<Field>>() );
+    bool Factored() const EL_NO_EXCEPT;
+    Int Height() const EL_NO_EXCEPT;
+
+    void Solve
+    ( AbstractDistMatrix<Field>& B, Orientation orientation=NORMAL ) const;
+
+private:
+    bool factored_=false, conjugate_=false;
+    DistMatrix<Field> factors_;
+    DistMatrix<Field,MD,STAR> dSub_;
+    DistPermutation P_;
+    mutable dense_factor::SolveWorkspace<Field> workspace_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_FACTOR_DENSE_HPP
@@ -0,0 +1,235 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FACTOR_HODLR_HPP
+#define EL_FACTOR_HODLR_HPP
+
+namespace El {
+
+// Hierarchically Off-Diagonal Low-Rank (HODLR) matrices
+// =====================================================
+// An n x n matrix is recursively bisected until the diagonal blocks are no
+// larger than HODLRCtrl::leafSize, and each off-diagonal block of each
+// bisection, A(s,1-s), is stored as U[s] V[1-s]^H. The factors are computed
+// by adaptive cross approximation (ACA) with partial pivoting, which only
+// evaluates O(rank (m+n)) entries of each m x n block, and so a matrix which
+// is only available through a generator of its entries, generator(i,j),
+// never needs to be formed. Kernel matrices from integral equations (e.g.,
+// Cauchy, Hilbert, or smooth Green's functions over a one-dimensional
+// ordering of the points) have numerically low-rank off-diagonal blocks and
+// are therefore stored in O(rank n log n) memory.
+//
+// The factorization is the recursive Sherman-Morrison-Woodbury
+// factorization of
+//
+//   Sivaram Ambikasaran and Eric Darve,
+//   "An O(N log N) Fast Direct Solver for Partial Hierarchically
+//    Semi-Separable Matrices",
+//   J. Sci. Comput., Vol. 57, No. 3, pp. 477--501, 2013,
+//
+// which requires O(rank^2 n log^2 n) work and provides O(rank n log n)
+// solves. The diagonal leaves are factored with partial pivoting, or with
+// Cholesky when HODLRCtrl::hermitian is set. The result is an approximate
+// inverse whose accuracy is governed by HODLRCtrl::relTol, and it can
+// therefore also be used as a preconditioner for FGMRES or LGMRES.
+
+template<typename Real>
+struct HODLRCtrl
+{
+    // The largest diagonal block which is stored densely
+    Int leafSize=64;
+
+    // The relative (Frobenius-norm) tolerance of the cross approximation of
+    // each off-diagonal block and an upper bound on its rank
+    Real relTol;
+    Int maxRank=256;
+
+    // If the matrix is Hermitian, only the bottom-left block of each
+    // bisection is compressed, and the leaves are factored with Cholesky
+    // (which additionally requires the matrix to be positive-definite)
+    bool hermitian=false;
+
+    HODLRCtrl() : relTol(Pow(limits::Epsilon<Real>(),Real(0.5))) { }
+};
+
+template<typename Field>
+class HODLR
+{
+public:
+    typedef function<Field(Int,Int)> GeneratorType;
+
+    HODLR();
+    HODLR
+    ( Int n,
+      const GeneratorType& generator,
+      const HODLRCtrl<Base<Field>>& ctrl=HODLRCtrl<Base<Field>>() );
+
+    // Compress the n x n diagonal block of the generated matrix which begins
+    // at entry (offset,offset)
+    void Build
+    ( Int n,
+      const GeneratorType& generator,
+      const HODLRCtrl<Base<Field>>& ctrl=HODLRCtrl<Base<Field>>(),
+      Int offset=0 );
+
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    // The largest rank of any compressed block
+    Int MaxRank() const EL_NO_EXCEPT;
+    // The number of stored entries (excluding the factorization)
+    Int NumEntries() const EL_NO_EXCEPT;
+
+    // Y := alpha A X + beta Y
+    void Multiply
+    ( Field alpha, const Matrix<Field>& X,
+      Field beta,        Matrix<Field>& Y ) const;
+
+    void Factor();
+    bool Factored() const EL_NO_EXCEPT;
+
+    // Overwrite B with an approximation of inv(A) B
+    void Solve( Matrix<Field>& B ) const;
+
+private:
+    struct Node
+    {
+        Int offset=0, size=0;
+        // Internal nodes have two children, which split the indices at 'split'
+        Int split=0;
+        Int children[2]={-1,-1};
+
+        // Leaves store their (factored) diagonal block
+        Matrix<Field> D, DFact;
+        Permutation P;
+
+        // A(s,1-s) ~= U[s] V[1-s]^H, W[s] = inv(A(s,s)) U[s], and K is the
+        // factored capacitance matrix of the Woodbury formula
+        Matrix<Field> U[2], V[2], W[2];
+        Matrix<Field> K;
+        Permutation PK;
+
+        Node() { }
+        // Permutation has no copy or move constructor, so the matrices are
+        // moved and the permutations explicitly assigned
+        Node( Node&& node )
+        : offset(node.offset), size(node.size), split(node.split),
+          children{node.children[0],node.children[1]},
+          D(std::move(node.D)), DFact(std::move(node.DFact)),
+          U{std::move(node.U[0]),std::move(node.U[1])},
+          V{std::move(node.V[0]),std::move(node.V[1])},
+          W{std::move(node.W[0]),std::move(node.W[1])},
+          K(std::move(node.K))
+        {
+            P = node.P;
+            PK = node.PK;
+        }
+    };
+
+    Int height_=0;
+    bool hermitian_=false, factored_=false;
+    vector<Node> nodes_;
+
+    Int BuildNode
+    ( const GeneratorType& generator, Int offset, Int size,
+      const HODLRCtrl<Base<Field>>& ctrl );
+    void MultiplyNode
+    ( Int index, Field alpha, const Matrix<Field>& X, Matrix<Field>& Y ) const;
+    void FactorNode( Int index );
+    void SolveNode( Int index, Matrix<Field>& B ) const;
+};
+
+// The rows are distributed over the grid as for DistMultiVec, and the
+// bisections are aligned with the row ownership so that the bisections
+// of each process's rows are stored (and applied) sequentially. Each
+// distributed bisection requires one reduction over its team of processes
+// per multiplication or solve.
+template<typename Field>
+class DistHODLR
+{
+public:
+    typedef function<Field(Int,Int)> GeneratorType;
+
+    explicit DistHODLR( const El::Grid& grid=El::Grid::Default() );
+    DistHODLR
+    ( Int n,
+      const GeneratorType& generator,
+      const El::Grid& grid,
+      const HODLRCtrl<Base<Field>>& ctrl=HODLRCtrl<Base<Field>>() );
+    ~DistHODLR();
+
+    void SetGrid( const El::Grid& grid );
+
+    // The generator must be callable on every process for any entry
+    void Build
+    ( Int n,
+      const GeneratorType& generator,
+      const HODLRCtrl<Base<Field>>& ctrl=HODLRCtrl<Base<Field>>() );
+
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    const El::Grid& Grid() const EL_NO_EXCEPT;
+    Int MaxRank() const EL_NO_EXCEPT;
+    Int NumEntries() const EL_NO_EXCEPT;
+
+    // The HODLR representation of the diagonal block of the local rows
+    const HODLR<Field>& LocalHODLR() const EL_NO_EXCEPT;
+
+    // Y := alpha A X + beta Y
+    void Multiply
+    ( Field alpha, const DistMultiVec<Field>& X,
+      Field beta,        DistMultiVec<Field>& Y ) const;
+
+    void Factor();
+    bool Factored() const EL_NO_EXCEPT;
+
+    // Overwrite B with an approximation of inv(A) B
+    void Solve( DistMultiVec<Field>& B ) const;
+
+private:
+    // One bisection of the team of processes which owns the calling
+    // process's rows. The local rows of U[side], V[side], and W[side] are
+    // stored.
+    struct Level
+    {
+        mpi::Comm comm;
+        int side=0;
+        Int ranks[2]={0,0};
+        Matrix<Field> U, V, W;
+        Matrix<Field> K;
+        Permutation PK;
+
+        Level() { }
+        // As for HODLR::Node, move the matrices and assign the permutation
+        Level( Level&& level )
+        : comm(level.comm), side(level.side),
+          ranks{level.ranks[0],level.ranks[1]},
+          U(std::move(level.U)), V(std::move(level.V)), W(std::move(level.W)),
+          K(std::move(level.K))
+        { PK = level.PK; }
+    };
+
+    Int height_=0, maxRank_=0, numEntries_=0;
+    bool factored_=false;
+    const El::Grid* grid_;
+    vector<Level> levels_;
+    HODLR<Field> local_;
+
+    void FreeLevels();
+    void ApplyLevel
+    ( const Level& level, Field alpha,
+      const Matrix<Field>& XLoc, Matrix<Field>& YLoc ) const;
+    void CorrectLevel( const Level& level, Matrix<Field>& BLoc ) const;
+    void SolveBelow( Int firstLevel, Matrix<Field>& BLoc ) const;
+
+    DistHODLR( const DistHODLR& );
+    const DistHODLR& operator=( const DistHODLR& );
+};
+
+} // namespace El
+
+#endif // ifndef EL_FACTOR_HODLR_HPP
@@ -34,7 +34,8 @@ enum LDLFrontType
   LDL_INTRAPIV_1D,        LDL_INTRAPIV_2D,
   LDL_INTRAPIV_SELINV_1D, LDL_INTRAPIV_SELINV_2D,
   BLOCK_LDL_1D,           BLOCK_LDL_2D,
-  BLOCK_LDL_INTRAPIV_1D,  BLOCK_LDL_INTRAPIV_2D
+  BLOCK_LDL_INTRAPIV_1D,  BLOCK_LDL_INTRAPIV_2D,
+  BLR_LDL_1D,             BLR_LDL_2D
 };
 
 bool Unfactored( LDLFrontType type );
@@ -42,10 +43,12 @@ bool FrontIs1D( LDLFrontType type );
 bool BlockFactorization( LDLFrontType type );
 bool SelInvFactorization( LDLFrontType type );
 bool PivotedFactorization( LDLFrontType type );
+bool BLRFactorization( LDLFrontType type );
 LDLFrontType ConvertTo2D( LDLFrontType type );
 LDLFrontType ConvertTo1D( LDLFrontType type );
 LDLFrontType AppendSelInv( LDLFrontType type );
 LDLFrontType RemoveSelInv( LDLFrontType type );
+LDLFrontType RemoveBLR( LDLFrontType type );
 LDLFrontType InitialFactorType( LDLFrontType type );
 
 namespace ldl {
@@ -250,6 +253,93 @@ struct DistMatrixNode
 template<typename Field>
 struct DistFront;
 
+// Block low-rank (BLR) fronts compress the row tiles of the bottom-left block
+// of their factors (which are partially factored in compressed form) using
+// rank-revealing QR. The top-level fronts of each sequential tree are kept
+// dense, as are the distributed fronts.
+template<typename Real>
+struct BLRCtrl
+{
+    // The number of rows of each tile
+    Int tileSize=256;
+    // The relative tolerance of the compression of each tile
+    Real tol;
+
+    BLRCtrl() : tol(Sqrt(limits::Epsilon<Real>())) { }
+};
+
+// An optional replacement for the dense kernel of the unpivoted LDL
+// factorization of the sequential fronts which are at least 'minSize' wide,
+// e.g., one which offloads them onto an accelerator. Given the m x n panel
+// 'AL' of a front and its (m-n) x (m-n) Schur complement 'ABR', the kernel
+// must overwrite the lower trapezoid of 'AL' with the unit-diagonal factor L
+// (with the diagonal of D stored in place of its unit diagonal) and add
+// -L_B D L_B^T (or its adjoint analogue if 'conjugate' is true) into the lower
+// triangle of 'ABR'.
+//
+// When threads factor independent subtrees, the kernel may be called
+// concurrently from several of them while the remaining threads continue
+// with the (typically smaller) fronts of their own subtrees.
+template<typename Field>
+struct DenseFrontKernel
+{
+    Int minSize=1024;
+    function<void(Matrix<Field>& AL,Matrix<Field>& ABR,bool conjugate)> factor;
+};
+
+// A matrix whose row tiles are each approximated as U[t] V[t], or stored
+// densely within V[t] if U[t] is empty (as their ranks were too large for
+// compression to be worthwhile).
+template<typename Field>
+struct BLRMatrix
+{
+    Int width=0;
+    // The first row of each tile, followed by the height of the matrix
+    vector<Int> tileOffsets;
+    vector<Matrix<Field>> U, V;
+
+    Int Height() const { return tileOffsets.empty() ? 0 : tileOffsets.back(); }
+    Int Width() const { return width; }
+    Int NumTiles() const { return Int(U.size()); }
+    Int NumEntries() const;
+
+    void Empty();
+    void Compress( const Matrix<Field>& A, Int tileSize, Base<Field> tol );
+    void Decompress( Matrix<Field>& A ) const;
+
+    // Y := Y + alpha op(A) X
+    void Multiply
+    ( Orientation orientation, Field alpha,
+      const Matrix<Field>& X, Matrix<Field>& Y ) const;
+};
+
+// Out-of-core storage for the dense factors of sequential fronts, which are
+// appended to a scratch file as they are factored and read back by each
+// solve. The file is created within the given directory (ideally on
+// node-local storage) and removed when the store is destroyed.
+template<typename Field>
+class FrontStore
+{
+public:
+    FrontStore( const string& directory );
+    ~FrontStore();
+
+    // Append the matrix to the store, free it, and return its offset
+    Int Write( Matrix<Field>& A );
+    void Read( Int offset, Int height, Int width, Matrix<Field>& A ) const;
+
+    // Discard all of the stored matrices
+    void Clear();
+
+    Int NumEntries() const { return numEntries_; }
+    const string& Filename() const { return filename_; }
+
+private:
+    string filename_;
+    mutable std::fstream file_;
+    Int numEntries_=0;
+};
+
 template<typename Field>
 struct Front
 {
@@ -259,6 +349,9 @@ struct Front
 
     Matrix<Field> LDense;
     SparseMatrix<Field> LSparse;
+    // The compressed bottom-left block of a BLR front (in which case only the
+    // top-left block is stored within LDense)
+    BLRMatrix<Field> LBLR;
 
     Matrix<Field> diag;
     Matrix<Field> subdiag;
@@ -277,6 +370,12 @@ struct Front
     // Unique pointers to the child fronts (should they exist).
     vector<unique_ptr<Front<Field>>> children;
 
+    // An observing pointer for the out-of-core store of the factors (should
+    // it exist). If LDense was offloaded, it is empty and its offset within
+    // the store and its dimensions are recorded.
+    FrontStore<Field>* store=nullptr;
+    Int storeOffset=-1, storeHeight=0, storeWidth=0;
+
     Front( Front<Field>* parentNode=nullptr );
 
     Front( DistFront<Field>* dupNode );
@@ -308,6 +407,13 @@ struct Front
 
     const Front<Field>& operator=( const Front<Field>& front );
 
+    // Move LDense into the out-of-core store
+    void Offload();
+    // Return LDense, reading it into 'buffer' if it was offloaded
+    const Matrix<Field>& DenseFactor( Matrix<Field>& buffer ) const;
+    Int DenseHeight() const;
+    Int DenseWidth() const;
+
     Int Height() const;
     Int NumEntries() const;
     Int NumTopLeftEntries() const;
@@ -316,6 +422,10 @@ struct Front
     double SolveGFlops( Int numRHS=1 ) const;
 };
 
+// Set the out-of-core store of each front within the tree
+template<typename Field>
+void AttachStore( Front<Field>& front, FrontStore<Field>* store );
+
 struct FactorCommMeta
 {
     vector<int> numChildSendInds;
@@ -431,6 +541,49 @@ struct DistFront
     ( const DistNodeInfo& info, bool computeRecvInds ) const;
 };
 
+// The costs of the numeric factorization of an analyzed elimination tree
+// which are predicted by the symbolic analysis. For a distributed tree, all
+// quantities are local to the calling process.
+struct FactorPrediction
+{
+    // The number of entries, and bytes, of the factors
+    double factorEntries=0;
+    double factorBytes=0;
+    // An upper bound on the number of bytes simultaneously held by the fronts,
+    // the update matrices, and the extend-add buffers during the factorization
+    double peakBytes=0;
+    // The number of GFlops of the factorization and of a solve against a
+    // single right-hand side
+    double factorGFlops=0;
+    double solveGFlops=0;
+};
+
+// Compressed fronts are predicted as though they were stored densely
+template<typename Field>
+FactorPrediction PredictFactorization
+( const NodeInfo& info, LDLFrontType frontType=LDL_2D );
+template<typename Field>
+FactorPrediction PredictFactorization
+( const DistNodeInfo& info, LDLFrontType frontType=LDL_2D );
+
+// Append the entries of inv(A) within the lower triangle of the sparsity
+// pattern of the (unpivoted) factorization, or only its diagonal, in terms of
+// the reordered indices. The fronts are inverted from the root to the leaves
+// at roughly the cost of the factorization. For a distributed tree, each
+// process appends the entries of its local portions of the fronts.
+template<typename Field>
+void SelectedInverse
+( const NodeInfo& info,
+  const Front<Field>& front,
+        vector<Entry<Field>>& entries,
+  bool diagonalOnly=false );
+template<typename Field>
+void SelectedInverse
+( const DistNodeInfo& info,
+  const DistFront<Field>& front,
+        vector<Entry<Field>>& entries,
+  bool diagonalOnly=false );
+
 } // namespace ldl
 
 template<typename Field>
@@ -470,12 +623,27 @@ public:
     void ChangeNonzeroValues( const SparseMatrix<Field>& ANew );
 
     // Factor the initialized multifrontal tree.
-    void Factor( LDLFrontType frontType=LDL_2D );
+    void Factor
+    ( LDLFrontType frontType=LDL_2D,
+      const ldl::BLRCtrl<Base<Field>>& blrCtrl=ldl::BLRCtrl<Base<Field>>() );
+
+    // Refill the factored multifrontal tree with a new sparse matrix which has
+    // the same nonzero pattern and refactor it with the same front type. The
+    // frontal storage and the extend-add communication metadata are reused.
+    void Refactor( const SparseMatrix<Field>& ANew );
 
     // Change the storage format of the multifrontal tree. This can be called
     // either before or after factorization.
     void ChangeFrontType( LDLFrontType frontType );
 
+    // Offload the dense factors of the sequential fronts into a scratch file
+    // within the given directory during subsequent factorizations.
+    void EnableOutOfCore( const string& directory );
+
+    // Factor the large sequential fronts of subsequent factorizations using
+    // the given kernel.
+    void SetDenseFrontKernel( const ldl::DenseFrontKernel<Field>& kernel );
+
     // Overwrite 'B' with the solution to 'A X = B'.
     void Solve( Matrix<Field>& B ) const;
     void Solve( ldl::MatrixNode<Field>& B ) const;
@@ -487,6 +655,17 @@ public:
       const Base<Field>& relTolRefine,
       Int maxRefineIts ) const;
 
+    // Overwrite 'B' with the solution to 'A X = B' using Iterative Refinement,
+    // where 'A' and 'B' are stored in a higher precision than the factors
+    // (e.g., a single-precision factorization of a double-precision matrix).
+    // The residuals and solution are accumulated in the higher precision.
+    template<typename FieldHigh>
+    void SolveWithIterativeRefinement
+    ( const SparseMatrix<FieldHigh>& A,
+            Matrix<FieldHigh>& B,
+      const Base<FieldHigh>& relTolRefine,
+      Int maxRefineIts ) const;
+
     // Overwrite 'B' with 'inv(L) B', 'inv(L)^T B', or 'inv(L)^H B'.
     void SolveAgainstL
     ( Orientation orientation, Matrix<Field>& B ) const;
@@ -511,6 +690,13 @@ public:
     void MultiplyWithD
     ( Orientation orientation, ldl::MatrixNode<Field>& B ) const;
 
+    // Return the entries of inv(A) within the (symmetric) sparsity pattern of
+    // the unpivoted factorization via a selected inversion.
+    void SelectedInverse( SparseMatrix<Field>& AInv ) const;
+
+    // Return the diagonal of inv(A) via a selected inversion.
+    void InverseDiagonal( Matrix<Field>& d ) const;
+
     // TODO(poulson): Apply permutation?
 
     bool Factored() const;
@@ -544,6 +730,13 @@ private:
     unique_ptr<ldl::Separator> separator_;
 
     vector<Int> map_, inverseMap_;
+
+    // The arguments of the last call to 'Factor'
+    LDLFrontType factorType_=LDL_2D;
+    ldl::BLRCtrl<Base<Field>> blrCtrl_;
+
+    unique_ptr<ldl::FrontStore<Field>> store_;
+    ldl::DenseFrontKernel<Field> kernel_;
 };
 
 template<typename Field>
@@ -583,12 +776,42 @@ public:
     void ChangeNonzeroValues( const DistSparseMatrix<Field>& ANew );
 
     // Factor the initialized multifrontal tree.
-    void Factor( LDLFrontType frontType=LDL_2D );
+    void Factor
+    ( LDLFrontType frontType=LDL_2D,
+      const ldl::BLRCtrl<Base<Field>>& blrCtrl=ldl::BLRCtrl<Base<Field>>() );
+
+    // Refill the factored multifrontal tree with a new sparse matrix which has
+    // the same nonzero pattern and refactor it with the same front type. The
+    // frontal storage and the extend-add communication metadata are reused.
+    void Refactor( const DistSparseMatrix<Field>& ANew );
 
     // Change the storage format of the multifrontal tree. This can be called
     // either before or after factorization.
     void ChangeFrontType( LDLFrontType frontType );
 
+    // Offload the dense factors of the sequential fronts into a scratch file
+    // within the given directory during subsequent factorizations.
+    void EnableOutOfCore( const string& directory );
+
+    // Factor the large sequential fronts of subsequent factorizations using
+    // the given kernel.
+    void SetDenseFrontKernel( const ldl::DenseFrontKernel<Field>& kernel );
+
+    // Collectively write the reordering, the separator and elimination trees,
+    // and (if factored and 'numeric' is true) the fronts to a checkpoint file
+    // using MPI-IO. The checkpoint can only be loaded over the same number of
+    // processes.
+    void Save( const string& filename, bool numeric=true ) const;
+
+    // Restore a checkpoint written by 'Save' in place of 'Initialize' (and
+    // of 'Factor' if the checkpoint was factored). 'A' must have the sparsity
+    // pattern of the checkpointed matrix; its values are only pulled into
+    // the fronts of an unfactored checkpoint.
+    void Load
+    ( const DistSparseMatrix<Field>& A,
+      const string& filename,
+      const BisectCtrl& bisectCtrl=BisectCtrl() );
+
     // Overwrite 'B' with the solution to 'A X = B'.
     void Solve( DistMultiVec<Field>& B ) const;
     void Solve( ldl::DistMultiVecNode<Field>& B ) const;
@@ -601,6 +824,17 @@ public:
       const Base<Field>& relTolRefine,
       Int maxRefineIts ) const;
 
+    // Overwrite 'B' with the solution to 'A X = B' using Iterative Refinement,
+    // where 'A' and 'B' are stored in a higher precision than the factors
+    // (e.g., a single-precision factorization of a double-precision matrix).
+    // The residuals and solution are accumulated in the higher precision.
+    template<typename FieldHigh>
+    void SolveWithIterativeRefinement
+    ( const DistSparseMatrix<FieldHigh>& A,
+            DistMultiVec<FieldHigh>& B,
+      const Base<FieldHigh>& relTolRefine,
+      Int maxRefineIts ) const;
+
     // Overwrite 'B' with 'inv(L) B', 'inv(L)^T B', or 'inv(L)^H B'.
     void SolveAgainstL
     ( Orientation orientation, DistMultiVec<Field>& B ) const;
@@ -633,6 +867,13 @@ public:
     void MultiplyWithD
     ( Orientation orientation, ldl::DistMatrixNode<Field>& B ) const;
 
+    // Return the entries of inv(A) within the (symmetric) sparsity pattern of
+    // the unpivoted factorization via a selected inversion.
+    void SelectedInverse( DistSparseMatrix<Field>& AInv ) const;
+
+    // Return the diagonal of inv(A) via a selected inversion.
+    void InverseDiagonal( DistMultiVec<Field>& d ) const;
+
     // TODO(poulson): Apply permutation?
 
     bool Factored() const;
@@ -669,6 +910,13 @@ private:
 
     DistMap map_, inverseMap_;
 
+    // The arguments of the last call to 'Factor'
+    LDLFrontType factorType_=LDL_2D;
+    ldl::BLRCtrl<Base<Field>> blrCtrl_;
+
+    unique_ptr<ldl::FrontStore<Field>> store_;
+    ldl::DenseFrontKernel<Field> kernel_;
+
     // Metadata for repeated calls to DistFront<Field>::Pull
     mutable bool formedPullMetadata_=false;
     mutable vector<Int> mappedSources_, mappedTargets_, columnOffsets_;
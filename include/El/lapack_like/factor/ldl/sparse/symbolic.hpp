@@ -30,6 +30,12 @@ namespace ldl {
 Int Analysis( NodeInfo& rootInfo, Int myOff=0 );
 void Analysis( DistNodeInfo& rootInfo, bool storeFactRecvInds=true );
 
+// Merge fronts of the (analyzed) sequential elimination tree according to the
+// relaxed amalgamation parameters of 'ctrl' and renumber the tree in postorder.
+// The analysis and the reordering map must subsequently be recomputed.
+void Amalgamate
+( Separator& rootSep, NodeInfo& rootInfo, const BisectCtrl& ctrl );
+
 void AMDOrder
 ( const vector<Int>& subOffsets,
   const vector<Int>& subTargets,
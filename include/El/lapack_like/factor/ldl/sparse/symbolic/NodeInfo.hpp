@@ -49,6 +49,9 @@ struct NodeInfo
     vector<Int> origLowerRelInds;
     // (maps from the child update indices to our frontal indices).
     vector<vector<Int>> childRelInds;
+    // (the child update indices which begin each run of consecutive relative
+    //  indices, followed by the size of the child update).
+    vector<vector<Int>> childRelIndRuns;
 
     // Symbolic analysis for modification of SuiteSparse LDL
     // -----------------------------------------------------
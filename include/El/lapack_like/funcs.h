@@ -28,6 +28,8 @@ typedef struct {
   float power;
   ElSignScaling scaling;
   bool progress;
+  bool newtonSchulz;
+  float newtonSchulzTol;
 } ElSignCtrl_s;
 EL_EXPORT ElError ElSignCtrlDefault_s( ElSignCtrl_s* ctrl );
 
@@ -37,6 +39,8 @@ typedef struct {
   double power;
   ElSignScaling scaling;
   bool progress;
+  bool newtonSchulz;
+  double newtonSchulzTol;
 } ElSignCtrl_d;
 EL_EXPORT ElError ElSignCtrlDefault_d( ElSignCtrl_d* ctrl );
 
@@ -45,6 +49,8 @@ typedef struct {
   float tol;
   float power;
   bool progress;
+  bool newtonSchulz;
+  float newtonSchulzTol;
 } ElSquareRootCtrl_s;
 EL_EXPORT ElError ElSquareRootCtrlDefault_s( ElSquareRootCtrl_s* ctrl );
 
@@ -53,6 +59,8 @@ typedef struct {
   double tol;
   double power;
   bool progress;
+  bool newtonSchulz;
+  double newtonSchulzTol;
 } ElSquareRootCtrl_d;
 EL_EXPORT ElError ElSquareRootCtrlDefault_d( ElSquareRootCtrl_d* ctrl );
 
@@ -31,6 +31,14 @@ struct SignCtrl
     Real power=Real(1);
     SignScaling scaling=SIGN_SCALE_FROB;
     bool progress=false;
+
+    // Replace the Newton iteration, which requires an inversion per step,
+    // with the Newton-Schulz iteration, which only requires two Gemms, once
+    // || I - X^2 ||_2 is certified to be at most newtonSchulzTol (< 1). The
+    // certificate costs a Gemm and is only attempted once the relative change
+    // in the iterates is also below newtonSchulzTol.
+    bool newtonSchulz=false;
+    Real newtonSchulzTol=Real(1)/Real(2);
 };
 
 template<typename Real>
@@ -40,6 +48,13 @@ struct SquareRootCtrl
     Real tol=Real(0);
     Real power=Real(1);
     bool progress=false;
+
+    // As in SignCtrl, but the switch is to the coupled Newton-Schulz
+    // iteration for A^{1/2} and A^{-1/2}, which requires three Gemms per
+    // step, once || I - inv(X) A inv(X) ||_2 is certified to be at most
+    // newtonSchulzTol. Each certificate costs an inversion and two Gemms.
+    bool newtonSchulz=false;
+    Real newtonSchulzTol=Real(1)/Real(2);
 };
 
 // Hermitian function
@@ -79,6 +94,20 @@ template<typename Field>
 void AfterLUPartialPiv
 (       AbstractDistMatrix<Field>& A,
   const DistPermutation& P );
+
+// Invert via an LU factorization with partial pivoting followed by the
+// inversion of its triangular factors
+template<typename Field>
+void LUPartialPiv( Matrix<Field>& A );
+template<typename Field>
+void LUPartialPiv( AbstractDistMatrix<Field>& A );
+
+// Invert in place via blocked Gauss-Jordan elimination with partial pivoting
+// (the default for distributed matrices)
+template<typename Field>
+void GaussJordan( Matrix<Field>& A );
+template<typename Field>
+void GaussJordan( AbstractDistMatrix<Field>& A );
 } // namespace inverse
 
 template<typename Field>
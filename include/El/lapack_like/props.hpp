@@ -43,6 +43,29 @@ Base<F> TwoCondition( const Matrix<F>& A );
 template<typename F>
 Base<F> TwoCondition( const AbstractDistMatrix<F>& A );
 
+// Estimate the one-norm condition number of A from its factorization in
+// O(n^2) work, given the one-norm of A (which must be computed before the
+// factorization overwrites A), using the Hager-Higham estimator of
+// || inv(A) ||_1. Infinity is returned if the factorization was singular.
+namespace lu {
+template<typename F>
+Base<F> OneConditionEstimate
+( const Matrix<F>& A, const Permutation& P, Base<F> oneNormA );
+template<typename F>
+Base<F> OneConditionEstimate
+( const AbstractDistMatrix<F>& A, const DistPermutation& P,
+  Base<F> oneNormA );
+} // namespace lu
+
+namespace cholesky {
+template<typename F>
+Base<F> OneConditionEstimate
+( UpperOrLower uplo, const Matrix<F>& A, Base<F> oneNormA );
+template<typename F>
+Base<F> OneConditionEstimate
+( UpperOrLower uplo, const AbstractDistMatrix<F>& A, Base<F> oneNormA );
+} // namespace cholesky
+
 // Determinant
 // ===========
 template<typename F>
@@ -89,6 +112,16 @@ template<typename F>
 Base<F> HPDDeterminant
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool canOverwrite=false );
 
+// The determinant of a sparse matrix from the (quasi-)diagonal of its
+// multifrontal LDL factorization, whose log-magnitude is kappa n. Block LDL
+// front types, which do not retain D, are not supported.
+template<typename F>
+SafeProduct<F> SafeDeterminant
+( const SparseLDLFactorization<F>& sparseLDLFact );
+template<typename F>
+SafeProduct<F> SafeDeterminant
+( const DistSparseLDLFactorization<F>& sparseLDLFact );
+
 namespace hpd_det {
 
 template<typename F>
@@ -407,6 +440,73 @@ Base<F> SymmetricTwoNorm( UpperOrLower uplo, const Matrix<F>& A );
 template<typename F>
 Base<F> SymmetricTwoNorm( UpperOrLower uplo, const AbstractDistMatrix<F>& A );
 
+// Partial-spectrum norms
+// ----------------------
+// Variants of the above which avoid a full SVD of large matrices. The
+// Ky-Fan(-Schatten) and two norms only involve the leading k singular values,
+// which are computed with a randomized SVD whose number of power iterations
+// is increased until the norm changes by at most a relative 'tol'. The
+// Schatten (and nuclear) norms are estimated by stochastic Lanczos quadrature
+// of tr((A^H A)^{p/2}), with blocks of probes added until the relative
+// standard error of the estimate is at most 'tol' or 'maxProbes' is reached.
+// The exact routines are used whenever the matrix is too small for either
+// approach to be cheaper.
+template<typename Real>
+struct PartialSpectrumCtrl
+{
+    Real tol=Real(1)/Real(100);
+
+    // The leading singular values
+    Int oversampling=10;
+    Int maxPowerIts=8;
+
+    // Stochastic Lanczos quadrature
+    Int lanczosSteps=30;
+    Int blockSize=10;
+    Int maxProbes=100;
+
+    bool progress=false;
+};
+
+template<typename F>
+Base<F> KyFanSchattenNorm
+( const Matrix<F>& A, Int k, Base<F> p,
+  const PartialSpectrumCtrl<Base<F>>& ctrl );
+template<typename F>
+Base<F> KyFanSchattenNorm
+( const AbstractDistMatrix<F>& A, Int k, Base<F> p,
+  const PartialSpectrumCtrl<Base<F>>& ctrl );
+
+template<typename F>
+Base<F> KyFanNorm
+( const Matrix<F>& A, Int k, const PartialSpectrumCtrl<Base<F>>& ctrl );
+template<typename F>
+Base<F> KyFanNorm
+( const AbstractDistMatrix<F>& A, Int k,
+  const PartialSpectrumCtrl<Base<F>>& ctrl );
+
+template<typename F>
+Base<F> TwoNorm
+( const Matrix<F>& A, const PartialSpectrumCtrl<Base<F>>& ctrl );
+template<typename F>
+Base<F> TwoNorm
+( const AbstractDistMatrix<F>& A, const PartialSpectrumCtrl<Base<F>>& ctrl );
+
+template<typename F>
+Base<F> SchattenNorm
+( const Matrix<F>& A, Base<F> p, const PartialSpectrumCtrl<Base<F>>& ctrl );
+template<typename F>
+Base<F> SchattenNorm
+( const AbstractDistMatrix<F>& A, Base<F> p,
+  const PartialSpectrumCtrl<Base<F>>& ctrl );
+
+template<typename F>
+Base<F> NuclearNorm
+( const Matrix<F>& A, const PartialSpectrumCtrl<Base<F>>& ctrl );
+template<typename F>
+Base<F> NuclearNorm
+( const AbstractDistMatrix<F>& A, const PartialSpectrumCtrl<Base<F>>& ctrl );
+
 // Zero "norm"
 // -----------
 template<typename T>
@@ -462,6 +562,59 @@ T Trace( const Matrix<T>& A );
 template<typename T>
 T Trace( const AbstractDistMatrix<T>& A );
 
+// Stochastic trace and diagonal estimation
+// ----------------------------------------
+// Estimate the trace (or diagonal) of a square operator M (e.g., inv(A) dA,
+// applied through a sparse factorization of A) from its action on blocks of
+// Rademacher probe vectors. Unless deflation is disabled (which yields
+// Hutchinson's estimator), the trace estimator is Hutch++: a third of the
+// probes sketch the dominant range of M, a third are spent on the exact trace
+// of M over the sketched range, and the rest estimate the trace of M over its
+// complement. The diagonal estimator averages z .* (M z) over all probes.
+template<typename Real>
+struct TraceEstimateCtrl
+{
+    // The total number of applications of M to probe vectors
+    Int numProbes=30;
+    // The maximum number of probes applied to M at once
+    Int blockSize=10;
+    bool deflate=true;
+    bool progress=false;
+};
+
+template<typename F>
+F EstimateTrace
+( const LinearOperator<F>& M,
+  const TraceEstimateCtrl<Base<F>>& ctrl=TraceEstimateCtrl<Base<F>>() );
+template<typename F>
+F EstimateTrace
+( const DistLinearOperator<F>& M,
+  const TraceEstimateCtrl<Base<F>>& ctrl=TraceEstimateCtrl<Base<F>>() );
+
+template<typename F>
+void EstimateDiagonal
+( const LinearOperator<F>& M,
+        Matrix<F>& d,
+  const TraceEstimateCtrl<Base<F>>& ctrl=TraceEstimateCtrl<Base<F>>() );
+template<typename F>
+void EstimateDiagonal
+( const DistLinearOperator<F>& M,
+        DistMultiVec<F>& d,
+  const TraceEstimateCtrl<Base<F>>& ctrl=TraceEstimateCtrl<Base<F>>() );
+
+// Estimate tr(inv(A) dA) using the factorization of A, where the probes of
+// each block are solved against it at once
+template<typename F>
+F EstimateTrace
+( const SparseLDLFactorization<F>& sparseLDLFact,
+  const SparseMatrix<F>& dA,
+  const TraceEstimateCtrl<Base<F>>& ctrl=TraceEstimateCtrl<Base<F>>() );
+template<typename F>
+F EstimateTrace
+( const DistSparseLDLFactorization<F>& sparseLDLFact,
+  const DistSparseMatrix<F>& dA,
+  const TraceEstimateCtrl<Base<F>>& ctrl=TraceEstimateCtrl<Base<F>>() );
+
 } // namespace El
 
 #endif // ifndef EL_PROPS_HPP
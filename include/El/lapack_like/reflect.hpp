@@ -31,6 +31,21 @@ void ApplyPackedReflectors
   const AbstractDistMatrix<F>& householderScalars, 
         AbstractDistMatrix<F>& A );
 
+// The blocked algorithms apply the reflectors via a sequence of compact-WY
+// (UT) transforms, each of which, by default, aggregates Blocksize()
+// reflectors. Aggregating several such panels into each transform leads to
+// fewer, larger Gemm's (and fewer broadcasts of the reflectors) at the cost
+// of forming larger triangular factors.
+void SetApplyPackedReflectorsAggregation( Int numPanels );
+Int ApplyPackedReflectorsAggregation();
+
+// Whether the distributed, left-sided application of vertical reflectors
+// (e.g., the back-transformation of QR, Hessenberg, and Hermitian
+// tridiagonal reductions) should begin broadcasting the next set of
+// reflectors before applying the current set. This is disabled by default.
+void SetApplyPackedReflectorsPipelining( bool pipeline );
+bool ApplyPackedReflectorsPipelining();
+
 // ExpandPackedReflectors
 // ======================
 template<typename F>
@@ -26,6 +26,43 @@ void LinearSolve
         AbstractDistMatrix<Field>& B,
   bool scalapack=false );
 
+template<typename Real>
+struct LinearSolveCtrl
+{
+    // If enabled, A is factored in the precision Demote<Real> (e.g., single
+    // precision when Real is double) and GMRES-based iterative refinement,
+    // preconditioned by the low-precision LU factors, recovers the accuracy
+    // of the working precision. A working-precision LU factorization is used
+    // instead if Demote<Real> is Real, if the low-precision factorization
+    // breaks down, or if refinement does not converge within 'maxRefineIts'
+    // steps.
+    bool mixedPrecision=false;
+
+    // Refinement stops once every column satisfies
+    //   || b - A x ||_2 <= relTol ( || A ||_F || x ||_2 + || b ||_2 ).
+    Real relTol=Pow(limits::Epsilon<Real>(),Real(0.9));
+    Int maxRefineIts=10;
+
+    // Each correction is computed with (unrestarted) GMRES on the
+    // left-preconditioned correction equation.
+    Real gmresRelTol=Pow(limits::Epsilon<Real>(),Real(0.25));
+    Int maxGMRESIts=30;
+
+    bool progress=false;
+    bool time=false;
+};
+
+template<typename Field>
+void LinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const LinearSolveCtrl<Base<Field>>& ctrl );
+template<typename Field>
+void LinearSolve
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+  const LinearSolveCtrl<Base<Field>>& ctrl );
+
 template<typename Field>
 void LinearSolve
 ( const SparseMatrix<Field>& A,
@@ -37,6 +74,13 @@ void LinearSolve
         DistMultiVec<Field>& B,
   const LeastSquaresCtrl<Base<Field>>& ctrl=LeastSquaresCtrl<Base<Field>>() );
 
+// Banded LU with partial pivoting (restricted to each process's diagonal
+// block in the distributed case)
+template<typename Field>
+void LinearSolve( const BandMatrix<Field>& A, Matrix<Field>& B );
+template<typename Field>
+void LinearSolve( const DistBandMatrix<Field>& A, DistMultiVec<Field>& B );
+
 namespace lin_solve {
 
 template<typename Field>
@@ -210,6 +254,12 @@ void HPDSolve
         DistMultiVec<Field>& B,
   const BisectCtrl& ctrl=BisectCtrl() );
 
+// Banded Cholesky of the lower triangle of the band
+template<typename Field>
+void HPDSolve( const BandMatrix<Field>& A, Matrix<Field>& B );
+template<typename Field>
+void HPDSolve( const DistBandMatrix<Field>& A, DistMultiVec<Field>& B );
+
 namespace hpd_solve {
 
 template<typename Field>
@@ -246,10 +296,46 @@ void MultiShiftHessSolve
   const AbstractDistMatrix<Field>& shifts,
         AbstractDistMatrix<Field>& X );
 
+struct MultiShiftHessCtrl
+{
+    // Split the processes into (up to) this many teams, each of which caches
+    // its own copy of H with the columns spread over its members, so that
+    // each column of H need only be broadcast within a team. With one team
+    // per process, H is replicated and the solves require no communication.
+    Int numSubgrids=1;
+
+    // The maximum number of local shifts to solve simultaneously (zero for
+    // all of them); the workspace is proportional to this number, but each
+    // batch of a team with multiple members rebroadcasts the columns of H.
+    Int batchSize=0;
+
+    // If nonempty, each process instead writes the solutions for its shifts
+    // to the binary file "<streamBasename>-<rank>.bin", batch by batch, and
+    // X is left unmodified. The file begins with the height of H and the
+    // number of local shifts, followed by the global index of each shift and
+    // its solution. X may then be a single column, which is used as the
+    // right-hand side for every shift.
+    string streamBasename="";
+};
+
+// Solve the shifted systems over teams of processes which each cache a copy
+// of H (see MultiShiftHessCtrl)
+template<typename Field>
+void MultiShiftHessSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  Field alpha,
+  const AbstractDistMatrix<Field>& H,
+  const AbstractDistMatrix<Field>& shifts,
+        AbstractDistMatrix<Field>& X,
+  const MultiShiftHessCtrl& ctrl );
+
 } // namespace El
 
 #include <El/lapack_like/solve/FGMRES.hpp>
 #include <El/lapack_like/solve/LGMRES.hpp>
+#include <El/lapack_like/solve/PipelinedCG.hpp>
+#include <El/lapack_like/solve/PipelinedGMRES.hpp>
 #include <El/lapack_like/solve/Refined.hpp>
 
 #endif // ifndef EL_SOLVE_HPP
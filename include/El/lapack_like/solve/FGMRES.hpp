@@ -30,7 +30,8 @@ namespace fgmres {
 //
 //   void precond( Matrix<Field>& b )
 //
-// and overwrite b with an approximation of inv(A) b.
+// and overwrite b with an approximation of inv(A) b. A LinearOperator (or,
+// for DistMultiVec's, a DistLinearOperator) may be passed as 'applyA'.
 //
 
 // TODO(poulson): Add support for an initial guess
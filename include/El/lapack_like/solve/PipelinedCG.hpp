@@ -0,0 +1,262 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_PIPELINEDCG_HPP
+#define EL_SOLVE_PIPELINEDCG_HPP
+
+// The pseudocode for preconditioned pipelined CG can be found in
+// "Algorithm 3" of
+//   Pieter Ghysels and Wim Vanroose,
+//   "Hiding global synchronization latency in the preconditioned Conjugate
+//    Gradient algorithm",
+//   Parallel Computing, Vol. 40, No. 7, pp. 224--238, 2014.
+//
+// Each iteration performs a single (non-blocking) reduction of the three
+// inner products it needs, and the reduction is overlapped with the
+// application of the preconditioner and of A. The extra recurrences cost
+// some attainable accuracy relative to standard CG, and so the convergence
+// criterion should not be much smaller than the square-root of the
+// precision.
+
+namespace El {
+
+namespace pipelined {
+
+// The routines below are written once in terms of the local portions of the
+// vectors, so that the same code supports Matrix and DistMultiVec.
+
+template<typename Field>
+Matrix<Field>& Local( Matrix<Field>& x ) { return x; }
+template<typename Field>
+Matrix<Field>& Local( DistMultiVec<Field>& x ) { return x.Matrix(); }
+
+// Start summing the local contributions in 'dots' over the processes which
+// share 'x' (there is nothing to sum for a Matrix). The entries of 'dots'
+// may not be accessed until the matching call to FinishSum.
+template<typename Field>
+void StartSum
+( const Matrix<Field>& x, Matrix<Field>& dots, mpi::Request<Field>& request )
+{ }
+template<typename Field>
+void StartSum
+( const DistMultiVec<Field>& x, Matrix<Field>& dots,
+  mpi::Request<Field>& request )
+{ mpi::IAllReduce( dots.Buffer(), dots.Height(), x.Grid().Comm(), request ); }
+
+template<typename Field>
+void FinishSum( const Matrix<Field>& x, mpi::Request<Field>& request ) { }
+template<typename Field>
+void FinishSum( const DistMultiVec<Field>& x, mpi::Request<Field>& request )
+{ mpi::Wait( request ); }
+
+template<typename Field>
+bool Reports( const Matrix<Field>& x ) { return true; }
+template<typename Field>
+bool Reports( const DistMultiVec<Field>& x ) { return x.Grid().Rank() == 0; }
+
+} // namespace pipelined
+
+namespace pipelined_cg {
+
+// In what follows, 'applyA' should be a function of the form
+//
+//   void applyA
+//   ( Field alpha, const VectorType& x, Field beta, VectorType& y )
+//
+// and overwrite y := alpha A x + beta y, where A is Hermitian
+// positive-definite. 'precond' should have the form
+//
+//   void precond( VectorType& b )
+//
+// and overwrite b with inv(M) b, where M is a fixed Hermitian
+// positive-definite approximation of A. A LinearOperator (or, for
+// DistMultiVec's, a DistLinearOperator) may be passed as 'applyA'.
+//
+// Each right-hand side is overwritten with its solution, which is computed
+// from a zero initial guess.
+//
+
+template<typename Field,class ApplyAType,class PrecondType,
+         template<typename> class VectorType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        VectorType<Field>& b,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<Field> Real;
+    const bool reports = progress && pipelined::Reports( b );
+
+    // x := 0, r := b (= b - A x), u := inv(M) r, and w := A u
+    // =======================================================
+    VectorType<Field> x(b), r(b), u(b), w(b);
+    Zero( x );
+    precond( u );
+    applyA( Field(1), u, Field(0), w );
+
+    VectorType<Field> m(x), n(x), z(x), q(x), s(x), p(x);
+    auto& xLoc = pipelined::Local( x );
+    auto& rLoc = pipelined::Local( r );
+    auto& uLoc = pipelined::Local( u );
+    auto& wLoc = pipelined::Local( w );
+    auto& mLoc = pipelined::Local( m );
+    auto& nLoc = pipelined::Local( n );
+    auto& zLoc = pipelined::Local( z );
+    auto& qLoc = pipelined::Local( q );
+    auto& sLoc = pipelined::Local( s );
+    auto& pLoc = pipelined::Local( p );
+
+    Int iter=0;
+    Real origResidNorm=0, gammaOld=1, alphaOld=1;
+    Matrix<Field> dots;
+    mpi::Request<Field> request;
+    while( true )
+    {
+        // Start the sum of gamma := r' u, delta := w' u, and r' r
+        // =======================================================
+        Zeros( dots, 3, 1 );
+        dots(0) = Dot( rLoc, uLoc );
+        dots(1) = Dot( wLoc, uLoc );
+        dots(2) = Dot( rLoc, rLoc );
+        pipelined::StartSum( b, dots, request );
+
+        // Overlap the sum with m := inv(M) w and n := A m
+        // ===============================================
+        m = w;
+        precond( m );
+        applyA( Field(1), m, Field(0), n );
+        pipelined::FinishSum( b, request );
+
+        const Real gamma = RealPart(dots(0));
+        const Real delta = RealPart(dots(1));
+        const Real residNorm = Sqrt(RealPart(dots(2)));
+        if( !limits::IsFinite(residNorm) )
+            RuntimeError("Residual norm was not finite");
+        if( iter == 0 )
+        {
+            origResidNorm = residNorm;
+            if( reports )
+                Output("origResidNorm: ",origResidNorm);
+            if( origResidNorm == Real(0) )
+                return 0;
+        }
+        const Real relResidNorm = residNorm/origResidNorm;
+        if( relResidNorm < relTol )
+        {
+            if( reports )
+                Output("converged with relative tolerance: ",relResidNorm);
+            break;
+        }
+        if( iter == maxIts )
+            RuntimeError("Pipelined CG did not converge");
+        if( reports )
+            Output
+            ("starting iteration ",iter," with relResidNorm=",relResidNorm);
+
+        Real alpha, beta;
+        if( iter == 0 )
+        {
+            beta = 0;
+            alpha = gamma / delta;
+        }
+        else
+        {
+            beta = gamma / gammaOld;
+            alpha = gamma / (delta - beta*gamma/alphaOld);
+        }
+        if( !limits::IsFinite(alpha) || alpha <= Real(0) )
+            RuntimeError
+            ("Pipelined CG broke down (the operator or preconditioner may "
+             "not be Hermitian positive-definite)");
+
+        // z := n + beta z, q := m + beta q, s := w + beta s, p := u + beta p
+        // ==================================================================
+        zLoc *= beta; zLoc += nLoc;
+        qLoc *= beta; qLoc += mLoc;
+        sLoc *= beta; sLoc += wLoc;
+        pLoc *= beta; pLoc += uLoc;
+
+        // x += alpha p, r -= alpha s, u -= alpha q, w -= alpha z
+        // ======================================================
+        Axpy( Field( alpha), pLoc, xLoc );
+        Axpy( Field(-alpha), sLoc, rLoc );
+        Axpy( Field(-alpha), qLoc, uLoc );
+        Axpy( Field(-alpha), zLoc, wLoc );
+
+        gammaOld = gamma;
+        alphaOld = alpha;
+        ++iter;
+    }
+    b = x;
+    return iter;
+}
+
+} // namespace pipelined_cg
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int PipelinedCG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    Int mostIts = 0;
+    const Int width = B.Width();
+    for( Int j=0; j<width; ++j )
+    {
+        auto b = B( ALL, IR(j) );
+        const Int its =
+          pipelined_cg::Single( applyA, precond, b, relTol, maxIts, progress );
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int PipelinedCG
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    const Int height = B.Height();
+    const Int width = B.Width();
+
+    Int mostIts = 0;
+    DistMultiVec<Field> u(B.Grid());
+    Zeros( u, height, 1 );
+    auto& BLoc = B.Matrix();
+    auto& uLoc = u.Matrix();
+    for( Int j=0; j<width; ++j )
+    {
+        auto bLoc = BLoc( ALL, IR(j) );
+        uLoc = bLoc;
+        const Int its =
+          pipelined_cg::Single( applyA, precond, u, relTol, maxIts, progress );
+        bLoc = uLoc;
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_PIPELINEDCG_HPP
@@ -0,0 +1,345 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SOLVE_PIPELINEDGMRES_HPP
+#define EL_SOLVE_PIPELINEDGMRES_HPP
+
+// A right-preconditioned, restarted GMRES in the spirit of the p1-GMRES
+// algorithm of
+//   Pieter Ghysels, Thomas J. Ashby, Karl Meerbergen, and Wim Vanroose,
+//   "Hiding global communication latency in the GMRES algorithm on massively
+//    parallel machines",
+//   SIAM J. Sci. Comput., Vol. 35, No. 1, pp. C48--C71, 2013.
+//
+// Each Arnoldi step orthogonalizes w_j = A inv(M) v_j against the basis with
+// classical Gram-Schmidt and a single (non-blocking) reduction of both the
+// projections and of w_j' w_j, so that || w_j - V_j h_j ||_2 follows from
+// the Pythagorean theorem. The reduction is overlapped with the application
+// of the preconditioner and of A to the unorthogonalized w_j, and linearity
+// is then used to recover inv(M) v_{j+1} and A inv(M) v_{j+1}, i.e.,
+//
+//   z_{j+1} = (inv(M) w_j - Z_j h_j) / h_{j+1,j},
+//   A z_{j+1} = (A inv(M) w_j - A Z_j h_j) / h_{j+1,j}.
+//
+// Unlike FGMRES, the preconditioner must therefore be (essentially) fixed.
+// An explicit residual is formed at the end of each restart cycle so that
+// the drift of the recurrences cannot lead to a false convergence, and the
+// norm is explicitly recomputed whenever the Pythagorean update suffers from
+// severe cancellation.
+
+namespace El {
+
+namespace pipelined_gmres {
+
+// In what follows, 'applyA' should be a function of the form
+//
+//   void applyA
+//   ( Field alpha, const VectorType& x, Field beta, VectorType& y )
+//
+// and overwrite y := alpha A x + beta y. However, 'precond' should have the
+// form
+//
+//   void precond( VectorType& b )
+//
+// and overwrite b with inv(M) b for a fixed approximation M of A. A
+// LinearOperator (or, for DistMultiVec's, a DistLinearOperator) may be
+// passed as 'applyA'.
+//
+// Each right-hand side is overwritten with its solution, which is computed
+// from a zero initial guess.
+//
+
+template<typename Field,class ApplyAType,class PrecondType,
+         template<typename> class VectorType>
+Int Single
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        VectorType<Field>& b,
+        Base<Field> relTol,
+        Int restart,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b.Width() != 1 )
+          LogicError("Expected a single right-hand side");
+    )
+    typedef Base<Field> Real;
+    const bool reports = progress && pipelined::Reports( b );
+    const Real cancelTol = Sqrt(limits::Epsilon<Real>());
+
+    // x := 0 and r := b (= b - A x)
+    // =============================
+    VectorType<Field> x(b), r(b), z(b), w(b), u(b);
+    Zero( x );
+    Real residNorm = Nrm2( r );
+    const Real origResidNorm = residNorm;
+    if( reports )
+        Output("origResidNorm: ",origResidNorm);
+    if( origResidNorm == Real(0) )
+        return 0;
+
+    auto& xLoc = pipelined::Local( x );
+    auto& rLoc = pipelined::Local( r );
+    auto& zLoc = pipelined::Local( z );
+    auto& wLoc = pipelined::Local( w );
+    auto& uLoc = pipelined::Local( u );
+    const Int localHeight = xLoc.Height();
+
+    Int iter=0;
+    Matrix<Real> cs;
+    Matrix<Field> sn, H, t, dots, V, Z, W;
+    mpi::Request<Field> request;
+    while( true )
+    {
+        if( reports )
+            Output("Starting pipelined GMRES iteration ",iter);
+        const Int indent = PushIndent();
+
+        Zeros( cs, restart, 1 );
+        Zeros( sn, restart, 1 );
+        Zeros( H,  restart, restart );
+        Zeros( V, localHeight, restart );
+        Zeros( Z, localHeight, restart );
+        Zeros( W, localHeight, restart );
+
+        // v0 := r / || r ||_2, z0 := inv(M) v0, and w := A z0
+        // ===================================================
+        auto v0 = V( ALL, IR(0) );
+        v0 = rLoc;
+        v0 *= 1/residNorm;
+        zLoc = v0;
+        precond( z );
+        applyA( Field(1), z, Field(0), w );
+        auto z0 = Z( ALL, IR(0) );
+        auto w0 = W( ALL, IR(0) );
+        z0 = zLoc;
+        w0 = wLoc;
+
+        // t := || r ||_2 e_0
+        // ==================
+        Zeros( t, restart+1, 1 );
+        t(0) = residNorm;
+
+        // Run one round of GMRES(restart)
+        // ===============================
+        Int numBasis = restart;
+        for( Int j=0; j<restart; ++j )
+        {
+            const bool lastStep = ( j+1 == restart );
+
+            // Start the sum of [V_j' w; w' w]
+            // -------------------------------
+            auto Vj = V( ALL, IR(0,j+1) );
+            Zeros( dots, j+2, 1 );
+            auto h = dots( IR(0,j+1), ALL );
+            Gemv( ADJOINT, Field(1), Vj, wLoc, Field(0), h );
+            dots(j+1) = Dot( wLoc, wLoc );
+            pipelined::StartSum( b, dots, request );
+
+            // Overlap the sum with z := inv(M) w and u := A z
+            // -----------------------------------------------
+            if( !lastStep )
+            {
+                z = w;
+                precond( z );
+                applyA( Field(1), z, Field(0), u );
+            }
+            pipelined::FinishSum( b, request );
+
+            // w := w - V_j h and delta := || w ||_2
+            // -------------------------------------
+            const Real wNormSquared = RealPart(dots(j+1));
+            const Real hNorm = Nrm2( h );
+            Gemv( NORMAL, Field(-1), Vj, h, Field(1), wLoc );
+            const Real deltaSquared = wNormSquared - hNorm*hNorm;
+            Real delta;
+            if( deltaSquared > cancelTol*wNormSquared )
+                delta = Sqrt(deltaSquared);
+            else
+                delta = Nrm2( w );
+            if( !limits::IsFinite(delta) )
+                RuntimeError("Arnoldi step produced a non-finite number");
+            auto Hj = H( IR(0,j+1), IR(j) );
+            Hj = h;
+            if( delta == Real(0) )
+                numBasis = j+1;
+            else if( !lastStep )
+            {
+                // v_{j+1} := w / delta
+                // ^^^^^^^^^^^^^^^^^^^^
+                auto vjp1 = V( ALL, IR(j+1) );
+                vjp1 = wLoc;
+                vjp1 *= 1/delta;
+
+                // z_{j+1} := (z - Z_j h) / delta
+                // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+                auto Zj = Z( ALL, IR(0,j+1) );
+                Gemv( NORMAL, Field(-1), Zj, h, Field(1), zLoc );
+                zLoc *= 1/delta;
+                auto zjp1 = Z( ALL, IR(j+1) );
+                zjp1 = zLoc;
+
+                // w := A z_{j+1} = (u - W_j h) / delta
+                // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+                auto Wj = W( ALL, IR(0,j+1) );
+                wLoc = uLoc;
+                Gemv( NORMAL, Field(-1), Wj, h, Field(1), wLoc );
+                wLoc *= 1/delta;
+                auto wjp1 = W( ALL, IR(j+1) );
+                wjp1 = wLoc;
+            }
+
+            // Apply existing rotations to the new column of H
+            // -----------------------------------------------
+            for( Int i=0; i<j; ++i )
+            {
+                const Real& c = cs(i);
+                const Field& s = sn(i);
+                const Field sConj = Conj(s);
+                const Field eta_i_j = H(i,j);
+                const Field eta_ip1_j = H(i+1,j);
+                H(i,  j) =  c    *eta_i_j + s*eta_ip1_j;
+                H(i+1,j) = -sConj*eta_i_j + c*eta_ip1_j;
+            }
+
+            // Generate and apply a new rotation to both H and the rotated
+            // beta*e_0 vector, t
+            // -----------------------------------------------------------
+            const Field eta_j_j = H(j,j);
+            const Field eta_jp1_j = delta;
+            if( !limits::IsFinite(RealPart(eta_j_j))   ||
+                !limits::IsFinite(ImagPart(eta_j_j)) )
+                RuntimeError("H(j,j) was not finite");
+            Real c;
+            Field s;
+            Field rho = Givens( eta_j_j, eta_jp1_j, c, s );
+            if( !limits::IsFinite(c) ||
+                !limits::IsFinite(RealPart(s)) ||
+                !limits::IsFinite(ImagPart(s)) ||
+                !limits::IsFinite(RealPart(rho)) ||
+                !limits::IsFinite(ImagPart(rho)) )
+                RuntimeError("Givens rotation produced a non-finite number");
+            H(j,j) = rho;
+            cs(j) = c;
+            sn(j) = s;
+            const Field sConj = Conj(s);
+            const Field tau_j = t(j);
+            const Field tau_jp1 = t(j+1);
+            t(j)   =  c    *tau_j + s*tau_jp1;
+            t(j+1) = -sConj*tau_j + c*tau_jp1;
+            ++iter;
+
+            // |t(j+1)| estimates the residual norm without a reduction
+            // --------------------------------------------------------
+            const Real relResidEst = Abs(t(j+1))/origResidNorm;
+            if( reports )
+                Output
+                ("finished iteration ",iter-1," with relResidEst=",
+                 relResidEst);
+            if( relResidEst < relTol || delta == Real(0) || iter == maxIts )
+            {
+                numBasis = j+1;
+                break;
+            }
+        }
+        SetIndent( indent );
+
+        // x := x + Z y, where y minimizes the projected residual
+        // ======================================================
+        auto y = t( IR(0,numBasis), ALL );
+        auto HTL = H( IR(0,numBasis), IR(0,numBasis) );
+        Trsv( UPPER, NORMAL, NON_UNIT, HTL, y );
+        auto ZL = Z( ALL, IR(0,numBasis) );
+        Gemv( NORMAL, Field(1), ZL, y, Field(1), xLoc );
+
+        // r := b - A x
+        // ============
+        r = b;
+        applyA( Field(-1), x, Field(1), r );
+        residNorm = Nrm2( r );
+        if( !limits::IsFinite(residNorm) )
+            RuntimeError("Residual norm was not finite");
+        const Real relResidNorm = residNorm/origResidNorm;
+        if( relResidNorm < relTol )
+        {
+            if( reports )
+                Output("converged with relative tolerance: ",relResidNorm);
+            break;
+        }
+        if( iter >= maxIts )
+            RuntimeError("Pipelined GMRES did not converge");
+        if( reports )
+            Output("restarting with relResidNorm=",relResidNorm);
+    }
+    b = x;
+    return iter;
+}
+
+} // namespace pipelined_gmres
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int PipelinedGMRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        Matrix<Field>& B,
+        Base<Field> relTol,
+        Int restart,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    Int mostIts = 0;
+    const Int width = B.Width();
+    for( Int j=0; j<width; ++j )
+    {
+        auto b = B( ALL, IR(j) );
+        const Int its =
+          pipelined_gmres::Single
+          ( applyA, precond, b, relTol, restart, maxIts, progress );
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+template<typename Field,class ApplyAType,class PrecondType>
+Int PipelinedGMRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int restart,
+        Int maxIts,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    const Int height = B.Height();
+    const Int width = B.Width();
+
+    Int mostIts = 0;
+    DistMultiVec<Field> u(B.Grid());
+    Zeros( u, height, 1 );
+    auto& BLoc = B.Matrix();
+    auto& uLoc = u.Matrix();
+    for( Int j=0; j<width; ++j )
+    {
+        auto bLoc = BLoc( ALL, IR(j) );
+        uLoc = bLoc;
+        const Int its =
+          pipelined_gmres::Single
+          ( applyA, precond, u, relTol, restart, maxIts, progress );
+        bLoc = uLoc;
+        mostIts = Max(mostIts,its);
+    }
+    return mostIts;
+}
+
+} // namespace El
+
+#endif // ifndef EL_SOLVE_PIPELINEDGMRES_HPP
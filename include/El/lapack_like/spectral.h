@@ -504,6 +504,8 @@ EL_EXPORT ElError ElHermitianSVDDist_z
 typedef struct {
   bool colPiv;
   ElInt maxIts;
+  bool cholQR;
+  bool mixedPrecision;
 } ElQDWHCtrl;
 EL_EXPORT ElError ElQDWHCtrlDefault( ElQDWHCtrl* ctrl );
 
@@ -612,6 +614,7 @@ typedef struct {
 
   ElInt minMultiBulgeSize;
   ElInt minDistMultiBulgeSize;
+  ElInt minSubgridAEDSize;
 
   ElInt (*numShifts)(ElInt,ElInt);
   ElInt (*deflationSize)(ElInt,ElInt,ElInt);
@@ -811,6 +814,9 @@ typedef struct {
   double valChanRatio;
   double fullChanRatio;
 
+  bool useTSQR;
+  double tsqrRatio;
+
   ElBidiagSVDCtrl_s bidiagSVDCtrl;
 } ElSVDCtrl_s;
 EL_EXPORT ElError ElSVDCtrlDefault_s( ElSVDCtrl_s* ctrl );
@@ -825,6 +831,9 @@ typedef struct {
   double valChanRatio;
   double fullChanRatio;
 
+  bool useTSQR;
+  double tsqrRatio;
+
   ElBidiagSVDCtrl_d bidiagSVDCtrl;
 } ElSVDCtrl_d;
 EL_EXPORT ElError ElSVDCtrlDefault_d( ElSVDCtrl_d* ctrl );
@@ -1044,6 +1053,7 @@ typedef struct {
   bool arnoldi;
   ElInt basisSize;
   bool reorthog;
+  ElInt numSubgrids;
 
   bool progress;
 
@@ -1069,6 +1079,7 @@ typedef struct {
   bool arnoldi;
   ElInt basisSize;
   bool reorthog;
+  ElInt numSubgrids;
 
   bool progress;
 
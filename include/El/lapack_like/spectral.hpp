@@ -325,6 +325,16 @@ enum DCCombinedColumnType {
 };
 const Int NUM_DC_COMBINED_COLUMN_TYPES = 4;
 
+struct MRRRCtrl
+{
+    // The number of threads used by each process within PMRRR, where zero
+    // keeps the PMRRR default (the PMR_NUM_THREADS environment variable if
+    // it is set and otherwise one). Since processes are typically already
+    // placed one per core, threading is opt-in. PMRRR falls back to a single
+    // thread if MPI does not support multithreading.
+    int numThreads=0;
+};
+
 } // namespace herm_tridiag_eig
 
 struct HermitianTridiagEigInfo
@@ -350,10 +360,15 @@ struct HermitianTridiagEigCtrl
     HermitianEigSubset<Real> subset;
     bool progress=false;
 
+    // Split an index or value subset of the spectrum into (at most) this
+    // many slices of nearly equal size and solve for each on its own team of
+    // processes (distributed eigenpairs only)
+    Int numSlices=1;
+
     HermitianTridiagEigAlg alg=HERM_TRIDIAG_EIG_MRRR;
     herm_tridiag_eig::QRCtrl qrCtrl;
     herm_tridiag_eig::DCCtrl<Real> dcCtrl;
-    // TODO(poulson): MRRR ctrl
+    herm_tridiag_eig::MRRRCtrl mrrrCtrl;
 };
 
 // Compute eigenvalues
@@ -416,6 +431,12 @@ struct HermitianEigCtrl
     bool useScaLAPACK=false;
     bool useSDC=false;
     bool timeStages=false;
+
+    // Tridiagonalize by way of a band of the given width, so that most of
+    // the work is in BLAS-3 rather than Hemv (see herm_tridiag::TwoStage);
+    // a bandwidth of zero selects the tuned default
+    bool twoStage=false;
+    Int twoStageBandwidth=0;
 };
 
 struct HermitianEigInfo
@@ -460,6 +481,45 @@ HermitianEig
         AbstractDistMatrix<Field>& Q,
   const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
 
+// Batched Hermitian eigensolvers
+// ------------------------------
+// Compute the eigenvalues (and eigenvectors) of each member of a batch of
+// (typically small) independent Hermitian matrices, which are overwritten,
+// with the members processed in parallel. The outputs are resized to match
+// the batch.
+template<typename Field>
+void HermitianEigBatched
+( UpperOrLower uplo,
+  vector<Matrix<Field>>& A,
+  vector<Matrix<Base<Field>>>& w,
+  const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
+template<typename Field>
+void HermitianEigBatched
+( UpperOrLower uplo,
+  vector<Matrix<Field>>& A,
+  vector<Matrix<Base<Field>>>& w,
+  vector<Matrix<Field>>& Q,
+  const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
+// The batch is instead stored side-by-side (see SVDBatched), and the
+// eigenvalues (eigenvectors) of the b'th member are returned in the b'th
+// column (block of columns) of w (Q). Since each member must then have the
+// same number of eigenpairs, value-range subsets are not supported.
+template<typename Field>
+void HermitianEigBatched
+( UpperOrLower uplo,
+  Int batchSize,
+  Matrix<Field>& A,
+  Matrix<Base<Field>>& w,
+  const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
+template<typename Field>
+void HermitianEigBatched
+( UpperOrLower uplo,
+  Int batchSize,
+  Matrix<Field>& A,
+  Matrix<Base<Field>>& w,
+  Matrix<Field>& Q,
+  const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
+
 namespace herm_eig {
 
 template<typename Real,
@@ -581,12 +641,69 @@ HermitianGenDefEig
         AbstractDistMatrix<Field>& X,
   const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
 
+namespace herm_gen_def_eig {
+
+// Reuse the Cholesky factor of B (as overwritten onto the 'uplo' triangle of
+// B by Cholesky) so that a fixed B can be paired with a sequence of A's
+// ---------------------------------------------------------------------------
+template<typename Field>
+HermitianEigInfo
+AfterCholesky
+(       Pencil pencil,
+        UpperOrLower uplo,
+        Matrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Base<Field>>& w,
+  const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
+template<typename Field>
+HermitianEigInfo
+AfterCholesky
+(       Pencil pencil,
+        UpperOrLower uplo,
+        AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+        AbstractDistMatrix<Base<Field>>& w,
+  const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
+template<typename Field>
+HermitianEigInfo
+AfterCholesky
+(       Pencil pencil,
+        UpperOrLower uplo,
+        Matrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+  const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
+template<typename Field>
+HermitianEigInfo
+AfterCholesky
+(       Pencil pencil,
+        UpperOrLower uplo,
+        AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+        AbstractDistMatrix<Base<Field>>& w,
+        AbstractDistMatrix<Field>& X,
+  const HermitianEigCtrl<Field>& ctrl=HermitianEigCtrl<Field>() );
+
+} // namespace herm_gen_def_eig
+
 // Polar decomposition
 // ===================
 struct QDWHCtrl
 {
     bool colPiv=false;
     Int maxIts=20;
+
+    // Orthonormalize within the QR-based iterations using CholeskyQR2 (which
+    // falls back to Householder QR when it would be inaccurate) rather than
+    // Householder QR; this is ignored if colPiv is true
+    bool cholQR=false;
+
+    // Run the early, QR-based iterations in single precision when the
+    // working precision is double, leaving the final Cholesky-based
+    // iterations (and the formation of the Hermitian factor) in double.
+    // The polar factor is then only backward stable at single precision.
+    bool mixedPrecision=false;
 };
 
 struct PolarCtrl
@@ -745,6 +862,9 @@ struct HessenbergSchurCtrl
     // note that LAPACK's hard minimum of 12 does not apply to us
     Int minMultiBulgeSize = 75;
     Int minDistMultiBulgeSize = 400;
+    // Distributed AED deflation windows of at least this size have their
+    // Schur decompositions computed over a subgrid rather than on one process
+    Int minSubgridAEDSize = 1000;
 
     function<Int(Int,Int)> numShifts =
       function<Int(Int,Int)>(hess_schur::aed::NumShifts);
@@ -833,6 +953,13 @@ template<typename Real>
 struct SchurCtrl
 {
     bool useSDC=false;
+
+    // Reduce to Hessenberg form through an intermediate block-Hessenberg
+    // matrix? This is currently only supported for sequential matrices, and
+    // a bandwidth of zero selects the tuned blocksize for "HessenbergTwoStage".
+    bool twoStageHessenberg=false;
+    Int hessenbergBandwidth=0;
+
     HessenbergSchurCtrl hessSchurCtrl;
     SDCCtrl<Real> sdcCtrl;
     bool time=false;
@@ -862,6 +989,39 @@ void Schur
   AbstractDistMatrix<Field>& Q,
   const SchurCtrl<Base<Field>>& ctrl=SchurCtrl<Base<Field>>() );
 
+// Batched Schur decompositions
+// ----------------------------
+// Overwrite each member of a batch of (typically small) independent square
+// matrices with its (quasi-)triangular Schur factor, with the members
+// processed in parallel. The outputs are resized to match the batch.
+template<typename Field>
+void SchurBatched
+( vector<Matrix<Field>>& A,
+  vector<Matrix<Complex<Base<Field>>>>& w,
+  const SchurCtrl<Base<Field>>& ctrl=SchurCtrl<Base<Field>>() );
+template<typename Field>
+void SchurBatched
+( vector<Matrix<Field>>& A,
+  vector<Matrix<Complex<Base<Field>>>>& w,
+  vector<Matrix<Field>>& Q,
+  const SchurCtrl<Base<Field>>& ctrl=SchurCtrl<Base<Field>>() );
+// The batch is instead stored side-by-side (see SVDBatched), and the
+// eigenvalues (Schur vectors) of the b'th member are returned in the b'th
+// column (block of columns) of w (Q)
+template<typename Field>
+void SchurBatched
+( Int batchSize,
+  Matrix<Field>& A,
+  Matrix<Complex<Base<Field>>>& w,
+  const SchurCtrl<Base<Field>>& ctrl=SchurCtrl<Base<Field>>() );
+template<typename Field>
+void SchurBatched
+( Int batchSize,
+  Matrix<Field>& A,
+  Matrix<Complex<Base<Field>>>& w,
+  Matrix<Field>& Q,
+  const SchurCtrl<Base<Field>>& ctrl=SchurCtrl<Base<Field>>() );
+
 namespace schur {
 
 template<typename Real>
@@ -958,6 +1118,17 @@ void TriangEig
 
 // Compute the eigendecomposition of a square matrix
 // =================================================
+// Only the eigenvalues are computed (and A is overwritten by a matrix which
+// is only guaranteed to be quasi-triangular within its deflated blocks)
+template<typename Field>
+void Eig
+( Matrix<Field>& A,
+  Matrix<Complex<Base<Field>>>& w );
+template<typename Field>
+void Eig
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Complex<Base<Field>>>& w );
+
 template<typename Field>
 void Eig
 ( Matrix<Field>& A,
@@ -1237,6 +1408,28 @@ struct SVDCtrl
     // decomposition when computing a full SVD
     double fullChanRatio=1.5;
 
+    // Reduce to bidiagonal form through an intermediate band (when m >= n)?
+    // A bandwidth of zero selects the tuned blocksize for "BidiagTwoStage".
+    bool twoStageBidiag=false;
+    Int bidiagBandwidth=0;
+
+    // TSQR
+    // ----
+    // Distributed thin SVDs (and singular value computations) of very tall
+    // (or wide) matrices can instead be computed by redistributing A (or A^H)
+    // to a [VC,STAR] distribution, computing the SVD of the R factor from a
+    // TSQR factorization on the root process, and then applying the implicit
+    // Q to its left singular vectors (see svd::TSQR).
+
+    // Always use svd::TSQR for distributed matrices?
+    bool useTSQR=false;
+
+    // The minimum ratio of max(m,n) to p min(m,n), with p the number of
+    // processes, before svd::TSQR is automatically used. Each process then
+    // owns at least 'tsqrRatio' times as many rows of A (or A^H) as it has
+    // columns. A non-positive ratio disables the automatic selection.
+    double tsqrRatio=2.;
+
     BidiagSVDCtrl<Real> bidiagSVDCtrl;
 };
 
@@ -1270,11 +1463,13 @@ template<typename Field>
 SVDInfo TSQR
 (       AbstractDistMatrix<Field>& A,
         AbstractDistMatrix<Base<Field>>& s,
-  bool overwrite=false );
+  bool overwrite=false,
+  const SVDCtrl<Base<Field>>& ctrl=SVDCtrl<Base<Field>>() );
 template<typename Field>
 SVDInfo TSQR
 ( const AbstractDistMatrix<Field>& A,
-        AbstractDistMatrix<Base<Field>>& s );
+        AbstractDistMatrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl=SVDCtrl<Base<Field>>() );
 
 template<typename Real,
          typename=EnableIf<IsReal<Real>>>
@@ -1353,10 +1548,76 @@ SVDInfo TSQR
 ( const AbstractDistMatrix<Field>& A,
         AbstractDistMatrix<Field>& U,
         AbstractDistMatrix<Base<Field>>& s,
-        AbstractDistMatrix<Field>& V );
+        AbstractDistMatrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl=SVDCtrl<Base<Field>>() );
 
 } // namespace svd
 
+// Batched SVD
+// -----------
+// Compute the SVDs of each member of a batch of (typically small) independent
+// matrices, with the members processed in parallel. The outputs are resized
+// to match the batch.
+template<typename Field>
+void SVDBatched
+( const vector<Matrix<Field>>& A,
+        vector<Matrix<Base<Field>>>& s,
+  const SVDCtrl<Base<Field>>& ctrl=SVDCtrl<Base<Field>>() );
+template<typename Field>
+void SVDBatched
+( const vector<Matrix<Field>>& A,
+        vector<Matrix<Field>>& U,
+        vector<Matrix<Base<Field>>>& s,
+        vector<Matrix<Field>>& V,
+  const SVDCtrl<Base<Field>>& ctrl=SVDCtrl<Base<Field>>() );
+// The batch is instead stored side-by-side, with the b'th member occupying
+// the b'th of 'batchSize' equally-sized blocks of columns, and the singular
+// values of the b'th member are returned in the b'th column of s
+template<typename Field>
+void SVDBatched
+( Int batchSize,
+  const Matrix<Field>& A,
+        Matrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl=SVDCtrl<Base<Field>>() );
+
+// Randomized SVD
+// --------------
+// Approximate the leading 'rank' singular triplets of A from the SVD of the
+// projection of A onto the basis Q returned by RandomizedRange (see factor.hpp)
+// so that A is only accessed through products with Q and the sample.
+template<typename Field>
+void RandomizedSVD
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl=RandomizedRangeCtrl() );
+template<typename Field>
+void RandomizedSVD
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl=RandomizedRangeCtrl() );
+template<typename Field>
+void RandomizedSVD
+( const SparseMatrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl=RandomizedRangeCtrl() );
+template<typename Field>
+void RandomizedSVD
+( const DistSparseMatrix<Field>& A,
+        DistMultiVec<Field>& U,
+        Matrix<Base<Field>>& s,
+        DistMultiVec<Field>& V,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl=RandomizedRangeCtrl() );
+
 // Hermitian SVD
 // =============
 
@@ -1460,7 +1721,7 @@ void Kernel
 //
 //    A V = V T + v (beta e_{k-1})^H,
 //
-// where A is an (explicitly) Hermitian matrix.
+// where A is an (explicitly) Hermitian matrix or linear operator.
 
 template<typename Field>
 void Lanczos
@@ -1469,9 +1730,19 @@ void Lanczos
         Int basisSize=20 );
 template<typename Field>
 void Lanczos
+( const LinearOperator<Field>& A,
+        Matrix<Base<Field>>& T,
+        Int basisSize=20 );
+template<typename Field>
+void Lanczos
 ( const DistSparseMatrix<Field>& A,
         AbstractDistMatrix<Base<Field>>& T,
         Int basisSize=20 );
+template<typename Field>
+void Lanczos
+( const DistLinearOperator<Field>& A,
+        AbstractDistMatrix<Base<Field>>& T,
+        Int basisSize=20 );
 
 template<typename Field>
 Base<Field> LanczosDecomp
@@ -1482,11 +1753,86 @@ Base<Field> LanczosDecomp
         Int basisSize=15 );
 template<typename Field>
 Base<Field> LanczosDecomp
+( const LinearOperator<Field>& A,
+        Matrix<Field>& V,
+        Matrix<Base<Field>>& T,
+        Matrix<Field>& v,
+        Int basisSize=15 );
+template<typename Field>
+Base<Field> LanczosDecomp
 ( const DistSparseMatrix<Field>& A,
         DistMultiVec<Field>& V,
         AbstractDistMatrix<Base<Field>>& T,
         DistMultiVec<Field>& v,
         Int basisSize=15 );
+template<typename Field>
+Base<Field> LanczosDecomp
+( const DistLinearOperator<Field>& A,
+        DistMultiVec<Field>& V,
+        AbstractDistMatrix<Base<Field>>& T,
+        DistMultiVec<Field>& v,
+        Int basisSize=15 );
+
+// Block Lanczos
+// =============
+// Compute extremal eigenpairs of an (explicitly) Hermitian sparse matrix with
+// a thick-restart block Lanczos method. Each step multiplies A against a block
+// of 'blockSize' vectors, and the basis is reorthogonalized with a second
+// Gram-Schmidt pass only when the first pass suffered from cancellation.
+
+template<typename Real>
+struct BlockLanczosCtrl
+{
+    // The number of vectors in each block
+    Int blockSize=4;
+
+    // The maximum number of blocks in the Krylov basis before restarting;
+    // the basis is enlarged if it could not hold the requested eigenvectors
+    // along with an additional block
+    Int maxBlocks=10;
+
+    Int maxRestarts=100;
+
+    // Whether the largest (rather than smallest) eigenvalues are sought
+    bool largest=true;
+
+    // A Ritz pair (theta,x) is considered converged once || A x - theta x ||_2
+    // is at most 'tol' times the largest Ritz value magnitude seen so far
+    Real tol=Pow(limits::Epsilon<Real>(),Real(0.5));
+
+    bool progress=false;
+};
+
+// Returns the number of restarts. The eigenvalues are sorted in ascending
+// order, and the eigenvectors are stored in the columns of X.
+template<typename Field>
+Int BlockLanczosEig
+( const SparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+        Int numEigs,
+  const BlockLanczosCtrl<Base<Field>>& ctrl=BlockLanczosCtrl<Base<Field>>() );
+template<typename Field>
+Int BlockLanczosEig
+( const LinearOperator<Field>& A,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+        Int numEigs,
+  const BlockLanczosCtrl<Base<Field>>& ctrl=BlockLanczosCtrl<Base<Field>>() );
+template<typename Field>
+Int BlockLanczosEig
+( const DistSparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        DistMultiVec<Field>& X,
+        Int numEigs,
+  const BlockLanczosCtrl<Base<Field>>& ctrl=BlockLanczosCtrl<Base<Field>>() );
+template<typename Field>
+Int BlockLanczosEig
+( const DistLinearOperator<Field>& A,
+        Matrix<Base<Field>>& w,
+        DistMultiVec<Field>& X,
+        Int numEigs,
+  const BlockLanczosCtrl<Base<Field>>& ctrl=BlockLanczosCtrl<Base<Field>>() );
 
 // Product Lanczos
 // ===============
@@ -1494,7 +1840,8 @@ Base<Field> LanczosDecomp
 //
 //    B V = V T + v (beta e_{k-1})^H,
 //
-// where B is either A^H A or A A^H, depending upon which is larger.
+// where B is either A^H A or A A^H, depending upon which is smaller. A linear
+// operator must support the application of its adjoint.
 
 template<typename Field>
 void ProductLanczos
@@ -1503,9 +1850,19 @@ void ProductLanczos
         Int basisSize=20 );
 template<typename Field>
 void ProductLanczos
+( const LinearOperator<Field>& A,
+        Matrix<Base<Field>>& T,
+        Int basisSize=20 );
+template<typename Field>
+void ProductLanczos
 ( const DistSparseMatrix<Field>& A,
         AbstractDistMatrix<Base<Field>>& T,
         Int basisSize=20 );
+template<typename Field>
+void ProductLanczos
+( const DistLinearOperator<Field>& A,
+        AbstractDistMatrix<Base<Field>>& T,
+        Int basisSize=20 );
 
 template<typename Field>
 Base<Field> ProductLanczosDecomp
@@ -1516,11 +1873,25 @@ Base<Field> ProductLanczosDecomp
         Int basisSize=15 );
 template<typename Field>
 Base<Field> ProductLanczosDecomp
+( const LinearOperator<Field>& A,
+        Matrix<Field>& V,
+        Matrix<Base<Field>>& T,
+        Matrix<Field>& v,
+        Int basisSize=15 );
+template<typename Field>
+Base<Field> ProductLanczosDecomp
 ( const DistSparseMatrix<Field>& A,
         DistMultiVec<Field>& V,
         AbstractDistMatrix<Base<Field>>& T,
         DistMultiVec<Field>& v,
         Int basisSize=15 );
+template<typename Field>
+Base<Field> ProductLanczosDecomp
+( const DistLinearOperator<Field>& A,
+        DistMultiVec<Field>& V,
+        AbstractDistMatrix<Base<Field>>& T,
+        DistMultiVec<Field>& v,
+        Int basisSize=15 );
 
 // Extremal singular value estimates
 // =================================
@@ -1538,7 +1909,15 @@ ExtremalSingValEst
 template<typename Field>
 pair<Base<Field>,Base<Field>>
 ExtremalSingValEst
+( const LinearOperator<Field>& A, Int basisSize=20 );
+template<typename Field>
+pair<Base<Field>,Base<Field>>
+ExtremalSingValEst
 ( const DistSparseMatrix<Field>& A, Int basisSize=20 );
+template<typename Field>
+pair<Base<Field>,Base<Field>>
+ExtremalSingValEst
+( const DistLinearOperator<Field>& A, Int basisSize=20 );
 
 template<typename Field>
 pair<Base<Field>,Base<Field>>
@@ -1547,7 +1926,15 @@ HermitianExtremalSingValEst
 template<typename Field>
 pair<Base<Field>,Base<Field>>
 HermitianExtremalSingValEst
+( const LinearOperator<Field>& A, Int basisSize=20 );
+template<typename Field>
+pair<Base<Field>,Base<Field>>
+HermitianExtremalSingValEst
 ( const DistSparseMatrix<Field>& A, Int basisSize=20 );
+template<typename Field>
+pair<Base<Field>,Base<Field>>
+HermitianExtremalSingValEst
+( const DistLinearOperator<Field>& A, Int basisSize=20 );
 
 // Pseudospectra
 // =============
@@ -1606,6 +1993,11 @@ struct PseudospecCtrl
     Int basisSize=10;
     bool reorthog=true; // only matters for IRL, which isn't currently used
 
+    // Partition the shifts of the distributed routines across (up to) this
+    // many teams of processes, each of which holds its own copy of the
+    // Schur (or Hessenberg) form; only the final snapshot is then saved
+    Int numSubgrids=1;
+
     // Whether or not to print progress information at each iteration
     bool progress=false;
 
@@ -1908,6 +2300,39 @@ DistMatrix<Int> HessenbergSpectralWindow
         Int imagSize,
         PseudospecCtrl<Base<Field>> psCtrl=PseudospecCtrl<Base<Field>>() );
 
+// (Pseudo-)Spectral contour
+// -------------------------
+// Begin with the cell centers of the window (as in SpectralWindow) and, for
+// each of 'numRefinements' levels, split each cell which the epsilon-contour
+// of the pseudospectrum could cross into four. All of the shifts which were
+// visited are returned, along with their inverse norms.
+template<typename Field>
+Matrix<Int> SpectralContourCloud
+( const Matrix<Field>& A,
+        Matrix<Complex<Base<Field>>>& shifts,
+        Matrix<Base<Field>>& invNorms,
+        Complex<Base<Field>> center,
+        Base<Field> realWidth,
+        Base<Field> imagWidth,
+        Int realSize,
+        Int imagSize,
+        Base<Field> epsilon,
+        Int numRefinements,
+        PseudospecCtrl<Base<Field>> psCtrl=PseudospecCtrl<Base<Field>>() );
+template<typename Field>
+DistMatrix<Int,VR,STAR> SpectralContourCloud
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Complex<Base<Field>>>& shifts,
+        AbstractDistMatrix<Base<Field>>& invNorms,
+        Complex<Base<Field>> center,
+        Base<Field> realWidth,
+        Base<Field> imagWidth,
+        Int realSize,
+        Int imagSize,
+        Base<Field> epsilon,
+        Int numRefinements,
+        PseudospecCtrl<Base<Field>> psCtrl=PseudospecCtrl<Base<Field>>() );
+
 // (Pseudo-)Spectral cloud
 // -----------------------
 template<typename Field>
@@ -468,6 +468,8 @@ inline ElQDWHCtrl CReflect( const QDWHCtrl& ctrl )
     ElQDWHCtrl ctrlC;
     ctrlC.colPiv = ctrl.colPiv;
     ctrlC.maxIts = ctrl.maxIts;
+    ctrlC.cholQR = ctrl.cholQR;
+    ctrlC.mixedPrecision = ctrl.mixedPrecision;
     return ctrlC;
 }
 
@@ -476,6 +478,8 @@ inline QDWHCtrl CReflect( const ElQDWHCtrl& ctrlC )
     QDWHCtrl ctrl;
     ctrl.colPiv = ctrlC.colPiv;
     ctrl.maxIts = ctrlC.maxIts;
+    ctrl.cholQR = ctrlC.cholQR;
+    ctrl.mixedPrecision = ctrlC.mixedPrecision;
     return ctrl;
 }
 
@@ -685,6 +689,8 @@ inline SVDCtrl<float> CReflect( const ElSVDCtrl_s& ctrlC )
     ctrl.useScaLAPACK = ctrlC.useScaLAPACK;
     ctrl.valChanRatio = ctrlC.valChanRatio;
     ctrl.fullChanRatio = ctrlC.fullChanRatio;
+    ctrl.useTSQR = ctrlC.useTSQR;
+    ctrl.tsqrRatio = ctrlC.tsqrRatio;
     ctrl.bidiagSVDCtrl = CReflect(ctrlC.bidiagSVDCtrl);
     return ctrl;
 }
@@ -698,6 +704,8 @@ inline SVDCtrl<double> CReflect( const ElSVDCtrl_d& ctrlC )
     ctrl.useScaLAPACK = ctrlC.useScaLAPACK;
     ctrl.valChanRatio = ctrlC.valChanRatio;
     ctrl.fullChanRatio = ctrlC.fullChanRatio;
+    ctrl.useTSQR = ctrlC.useTSQR;
+    ctrl.tsqrRatio = ctrlC.tsqrRatio;
     ctrl.bidiagSVDCtrl = CReflect(ctrlC.bidiagSVDCtrl);
     return ctrl;
 }
@@ -711,6 +719,8 @@ inline ElSVDCtrl_s CReflect( const SVDCtrl<float>& ctrl )
     ctrlC.useScaLAPACK = ctrl.useScaLAPACK;
     ctrlC.valChanRatio = ctrl.valChanRatio;
     ctrlC.fullChanRatio = ctrl.fullChanRatio;
+    ctrlC.useTSQR = ctrl.useTSQR;
+    ctrlC.tsqrRatio = ctrl.tsqrRatio;
     ctrlC.bidiagSVDCtrl = CReflect(ctrl.bidiagSVDCtrl);
     return ctrlC;
 }
@@ -724,6 +734,8 @@ inline ElSVDCtrl_d CReflect( const SVDCtrl<double>& ctrl )
     ctrlC.useScaLAPACK = ctrl.useScaLAPACK;
     ctrlC.valChanRatio = ctrl.valChanRatio;
     ctrlC.fullChanRatio = ctrl.fullChanRatio;
+    ctrlC.useTSQR = ctrl.useTSQR;
+    ctrlC.tsqrRatio = ctrl.tsqrRatio;
     ctrlC.bidiagSVDCtrl = CReflect(ctrl.bidiagSVDCtrl);
     return ctrlC;
 }
@@ -753,6 +765,7 @@ inline ElHessenbergSchurCtrl CReflect( const HessenbergSchurCtrl& ctrl )
 
     ctrlC.minMultiBulgeSize = ctrl.minMultiBulgeSize;
     ctrlC.minDistMultiBulgeSize = ctrl.minDistMultiBulgeSize;
+    ctrlC.minSubgridAEDSize = ctrl.minSubgridAEDSize;
     auto numShiftsRes = ctrl.numShifts.target<ElInt(*)(ElInt,ElInt)>();
     if( numShiftsRes )
         ctrlC.numShifts = *numShiftsRes;
@@ -806,6 +819,7 @@ inline HessenbergSchurCtrl CReflect( const ElHessenbergSchurCtrl& ctrlC )
 
     ctrl.minMultiBulgeSize = ctrlC.minMultiBulgeSize;
     ctrl.minDistMultiBulgeSize = ctrlC.minDistMultiBulgeSize;
+    ctrl.minSubgridAEDSize = ctrlC.minSubgridAEDSize;
     ctrl.numShifts = ctrlC.numShifts;
     ctrl.deflationSize = ctrlC.deflationSize;
     ctrl.sufficientDeflation = ctrlC.sufficientDeflation;
@@ -964,6 +978,7 @@ inline ElPseudospecCtrl_s CReflect( const PseudospecCtrl<float>& ctrl )
     ctrlC.arnoldi = ctrl.arnoldi;
     ctrlC.basisSize = ctrl.basisSize;
     ctrlC.reorthog = ctrl.reorthog;
+    ctrlC.numSubgrids = ctrl.numSubgrids;
     ctrlC.progress = ctrl.progress;
     ctrlC.snapCtrl = CReflect(ctrl.snapCtrl);
     return ctrlC;
@@ -983,6 +998,7 @@ inline ElPseudospecCtrl_d CReflect( const PseudospecCtrl<double>& ctrl )
     ctrlC.arnoldi = ctrl.arnoldi;
     ctrlC.basisSize = ctrl.basisSize;
     ctrlC.reorthog = ctrl.reorthog;
+    ctrlC.numSubgrids = ctrl.numSubgrids;
     ctrlC.progress = ctrl.progress;
     ctrlC.snapCtrl = CReflect(ctrl.snapCtrl);
     return ctrlC;
@@ -1003,6 +1019,7 @@ inline PseudospecCtrl<float> CReflect( const ElPseudospecCtrl_s& ctrlC )
     ctrl.arnoldi = ctrlC.arnoldi;
     ctrl.basisSize = ctrlC.basisSize;
     ctrl.reorthog = ctrlC.reorthog;
+    ctrl.numSubgrids = ctrlC.numSubgrids;
     ctrl.progress = ctrlC.progress;
     ctrl.snapCtrl = CReflect(ctrlC.snapCtrl);
     return ctrl;
@@ -1022,6 +1039,7 @@ inline PseudospecCtrl<double> CReflect( const ElPseudospecCtrl_d& ctrlC )
     ctrl.arnoldi = ctrlC.arnoldi;
     ctrl.basisSize = ctrlC.basisSize;
     ctrl.reorthog = ctrlC.reorthog;
+    ctrl.numSubgrids = ctrlC.numSubgrids;
     ctrl.progress = ctrlC.progress;
     ctrl.snapCtrl = CReflect(ctrlC.snapCtrl);
     return ctrl;
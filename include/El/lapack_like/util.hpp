@@ -21,9 +21,18 @@ struct BisectCtrl
     Int cutoff;
     bool storeFactRecvInds;
 
+    // Relaxed amalgamation of the fronts of the sequential subtrees: a child
+    // is merged into its parent if the merged front would have at most
+    // 'minFrontSize' columns, or if at most 'maxZeroFraction' of its entries
+    // would be explicit zeros. The sparse leaves are never merged.
+    bool amalgamate;
+    Int minFrontSize;
+    double maxZeroFraction;
+
     BisectCtrl()
     : sequential(true), numDistSeps(1), numSeqSeps(1), cutoff(1024),
-      storeFactRecvInds(false)
+      storeFactRecvInds(false),
+      amalgamate(false), minFrontSize(32), maxZeroFraction(0.1)
     { }
 };
 
@@ -86,6 +95,17 @@ void BuildChildFromPerm
 
 // Median
 // ======
+// The pair (x(i),i) of the entry which would be in position k (counting from
+// zero) were x sorted in ascending order, with ties broken by the index.
+// The distributed variant uses a parallel selection rather than a sort.
+template<typename Real,
+         typename=DisableIf<IsComplex<Real>>>
+ValueInt<Real> OrderStatistic( const Matrix<Real>& x, Int k );
+template<typename Real,
+         typename=DisableIf<IsComplex<Real>>>
+ValueInt<Real> OrderStatistic( const AbstractDistMatrix<Real>& x, Int k );
+
+// The order statistic of position length/2
 template<typename Real,
          typename=DisableIf<IsComplex<Real>>>
 ValueInt<Real> Median( const Matrix<Real>& x );
@@ -146,6 +166,109 @@ void MergeSortingPermutation
 ( Int n0, Int n1, const Matrix<Real>& x, Permutation& sortPerm,
   SortType sort=ASCENDING );
 
+// Redundant-versus-distributed switching
+// ======================================
+// Subproblems which are too small to amortize the latency of a distributed
+// algorithm may instead be moved onto a square subgrid or solved redundantly
+// by every process. ChoosePlacement minimizes an alpha-beta-gamma estimate of
+// the time of each option using a model of the machine which is measured by
+// CalibratePlacementModel (this is performed within Initialize if
+// EL_PLACEMENT_CALIBRATE is defined). Until a model has been calibrated or
+// set, the heuristic decision of the caller is returned unchanged.
+namespace SubproblemPlacementNS {
+enum SubproblemPlacement
+{
+  STAY_DISTRIBUTED,
+  SHRINK_TO_SUBGRID,
+  GO_REDUNDANT
+};
+}
+using namespace SubproblemPlacementNS;
+
+struct PlacementModel
+{
+    // The estimated time, in seconds, to send a single message
+    double latency;
+    // The estimated time, in seconds, to send a single byte
+    double inverseBandwidth;
+    // The estimated time, in seconds, of a single flop of a local Gemm
+    double flopTime;
+
+    PlacementModel() : latency(1e-5), inverseBandwidth(1e-9), flopTime(1e-10)
+    { }
+};
+
+void SetPlacementModel( const PlacementModel& model );
+const PlacementModel& GetPlacementModel();
+bool PlacementModelActive();
+
+// Measure the latency and inverse bandwidth of collectives (through
+// CalibrateGemmCostModel) and the local Gemm flop rate over the given
+// communicator and install them as the placement model
+void CalibratePlacementModel( mpi::Comm comm=mpi::COMM_WORLD );
+
+// A subproblem is described by its total number of flops, the number of
+// entries which must be gathered onto (and afterwards sent back from) a
+// smaller team, the number of synchronizations (each a tree-based collective
+// over the team) of its distributed algorithm, and the number of entries
+// communicated by each process of the distributed algorithm, which is assumed
+// to be numCommEntries/sqrt(q) over a team of q processes.
+struct SubproblemCost
+{
+    double flops=0;
+    double numInputEntries=0;
+    double numOutputEntries=0;
+    double numSyncs=0;
+    double numCommEntries=0;
+    Int entrySize=sizeof(double);
+};
+
+struct SubproblemDecision
+{
+    SubproblemPlacement placement=STAY_DISTRIBUTED;
+    // The number of processes which compute the subproblem: the square of the
+    // subgrid height for SHRINK_TO_SUBGRID and one for GO_REDUNDANT
+    int teamSize=1;
+};
+
+// The estimated time for a subproblem distributed over 'commSize' processes
+// to be computed over 'teamSize' of them (where a team size of one implies a
+// redundant computation)
+double SubproblemTime
+( const SubproblemCost& cost, int commSize, int teamSize );
+
+SubproblemDecision ChoosePlacement
+( const SubproblemCost& cost, int commSize,
+  const SubproblemDecision& heuristic, bool allowSubgrid=true );
+
+// A convenience wrapper for the common case of a heuristic which either runs
+// the subproblem redundantly or keeps it distributed
+bool RunRedundantly
+( const SubproblemCost& cost, int commSize, bool heuristicRedundant );
+
+// Blocksize tuning
+// ================
+// Time each candidate blocksize for Cholesky, LU (with partial pivoting),
+// HermitianTridiag, and Trsm on random matrices of the given size over the
+// given grid, and register the fastest via SetTunedBlocksize (the results can
+// then be persisted with SaveTunedBlocksizes)
+struct BlocksizeTuningCtrl
+{
+    Int size;
+    vector<Int> candidates;
+    Int numReps;
+    bool progress;
+
+    BlocksizeTuningCtrl()
+    : size(2000), candidates({32,64,96,128,192,256}), numReps(2),
+      progress(false)
+    { }
+};
+
+template<typename Field>
+void TuneBlocksizes
+( const Grid& grid, const BlocksizeTuningCtrl& ctrl=BlocksizeTuningCtrl() );
+
 } // namespace El
 
 #endif // ifndef EL_UTIL_HPP
@@ -180,6 +180,70 @@ void Zeros( DistSparseMatrix<T>& A, Int m, Int n );
 template<typename T>
 void Zeros( DistMultiVec<T>& A, Int m, Int n );
 
+// Fast structured operators
+// -------------------------
+// Matrix-free versions of the Circulant, Fourier, Hankel, Toeplitz, and
+// Walsh matrices with the same arguments as above. Each application costs
+// O(N log N) work per column (with N the order of the matrix, or, for
+// Toeplitz and Hankel matrices, the power of two which is at least m+n-1
+// that they are embedded into as the leading block of a circulant matrix)
+// through FFTs or fast Walsh-Hadamard transforms, and all operators support
+// their transposes and adjoints. The eigenvalues of the circulant matrices
+// are computed once, when the operator is formed.
+template<typename Field>
+LinearOperator<Field> CirculantOperator( const vector<Field>& a );
+template<typename Field>
+DistLinearOperator<Field>
+CirculantOperator( const vector<Field>& a, const El::Grid& grid );
+
+template<typename Real>
+LinearOperator<Complex<Real>> FourierOperator( Int n );
+template<typename Real>
+DistLinearOperator<Complex<Real>>
+FourierOperator( Int n, const El::Grid& grid );
+
+template<typename Field>
+LinearOperator<Field> HankelOperator( Int m, Int n, const vector<Field>& a );
+template<typename Field>
+DistLinearOperator<Field>
+HankelOperator( Int m, Int n, const vector<Field>& a, const El::Grid& grid );
+
+template<typename Field>
+LinearOperator<Field> ToeplitzOperator( Int m, Int n, const vector<Field>& a );
+template<typename Field>
+DistLinearOperator<Field>
+ToeplitzOperator( Int m, Int n, const vector<Field>& a, const El::Grid& grid );
+
+template<typename Field>
+LinearOperator<Field> WalshOperator( Int k, bool binary=false );
+template<typename Field>
+DistLinearOperator<Field>
+WalshOperator( Int k, const El::Grid& grid, bool binary=false );
+
+// Kronecker and Khatri-Rao product operators
+// ------------------------------------------
+// Matrix-free versions of Kronecker(A,B) and of the column-wise Kronecker
+// (Khatri-Rao) product of A and B, whose j'th column is the Kronecker
+// product of the j'th columns of A and B. Each column of the input is
+// reshaped so that the operators are applied with Gemm's against the
+// factors, which are copied into the operator (and, for the distributed
+// versions, redistributed over the grid of A).
+template<typename Field>
+LinearOperator<Field>
+KroneckerOperator( const Matrix<Field>& A, const Matrix<Field>& B );
+template<typename Field>
+DistLinearOperator<Field>
+KroneckerOperator
+( const AbstractDistMatrix<Field>& A, const AbstractDistMatrix<Field>& B );
+
+template<typename Field>
+LinearOperator<Field>
+KhatriRaoOperator( const Matrix<Field>& A, const Matrix<Field>& B );
+template<typename Field>
+DistLinearOperator<Field>
+KhatriRaoOperator
+( const AbstractDistMatrix<Field>& A, const AbstractDistMatrix<Field>& B );
+
 // Integral equations
 // ==================
 
@@ -741,25 +805,45 @@ void ImplicitHaar
   ElementalMatrix<Field>& householderScalars,
   ElementalMatrix<Base<Field>>& signature, Int n );
 
+// The product of the first 'numReflectors' reflectors of an implicit Haar
+// matrix, which is only Haar-distributed when numReflectors=n but is
+// cheaper to generate and apply otherwise
+template<typename Field>
+void ImplicitRandomReflectors
+( Matrix<Field>& A,
+  Matrix<Field>& householderScalars,
+  Matrix<Base<Field>>& signature, Int n, Int numReflectors );
+template<typename Field>
+void ImplicitRandomReflectors
+( ElementalMatrix<Field>& A,
+  ElementalMatrix<Field>& householderScalars,
+  ElementalMatrix<Base<Field>>& signature, Int n, Int numReflectors );
+
 // Hermitian uniform spectrum
 // --------------------------
+// If numReflectors is nonnegative, the eigenvectors are rotated by the
+// corresponding number of random reflectors rather than a Haar matrix
 template<typename Field>
 void HermitianUniformSpectrum
-( Matrix<Field>& A, Int n, Base<Field> lower=0, Base<Field> upper=1 );
+( Matrix<Field>& A, Int n, Base<Field> lower=0, Base<Field> upper=1,
+  Int numReflectors=-1 );
 template<typename Field>
 void HermitianUniformSpectrum
-( ElementalMatrix<Field>& A, Int n, Base<Field> lower=0, Base<Field> upper=1 );
+( ElementalMatrix<Field>& A, Int n, Base<Field> lower=0, Base<Field> upper=1,
+  Int numReflectors=-1 );
 
 // Normal uniform spectrum
 // -----------------------
+// If numReflectors is nonnegative, the eigenvectors are rotated by the
+// corresponding number of random reflectors rather than a Haar matrix
 template<typename Real>
 void NormalUniformSpectrum
 ( Matrix<Complex<Real>>& A, Int n,
-  Complex<Real> center=0, Real radius=1 );
+  Complex<Real> center=0, Real radius=1, Int numReflectors=-1 );
 template<typename Real>
 void NormalUniformSpectrum
 ( ElementalMatrix<Complex<Real>>& A, Int n,
-  Complex<Real> center=0, Real radius=1 );
+  Complex<Real> center=0, Real radius=1, Int numReflectors=-1 );
 
 // Uniform Helmholtz Green's
 // -------------------------
@@ -27,6 +27,20 @@ public:
 
     T NextPrime();
 
+    // Stream each prime in [lowerBound,upperBound], in increasing order,
+    // through 'visit' without storing them. Only the odd primes up to
+    // sqrt(upperBound) are added to 'oddPrimes'; the range itself is sieved
+    // in bit-packed segments of odd numbers which occupy segmentSize bytes
+    // (so that the default of 32768 fits within a typical L1 cache). If
+    // 'parallel' is true, each batch of segments is sieved by separate
+    // OpenMP threads, while 'visit' is still called sequentially.
+    template<typename Function>
+    void ForEachPrime
+    ( T lowerBound, T upperBound, Function visit, bool parallel=false );
+
+    // Count the primes in [lowerBound,upperBound] using ForEachPrime
+    T CountPrimes( T lowerBound, T upperBound, bool parallel=false );
+
     // We could use TSmall if keepAll was false
     vector<T> oddPrimes;
 
@@ -54,6 +68,14 @@ private:
 
     void SieveSegment();
     void FormNewSegment();
+
+    // Sieve the bit-packed table of the 'numCandidates' odd numbers beginning
+    // at 'offset' with the first 'numSievingPrimes' stored odd primes
+    void SieveBitSegment
+    ( T offset,
+      T numCandidates,
+      TSmall numSievingPrimes,
+      vector<std::uint64_t>& table ) const;
 };
 
 // For retrieving a global-scope sieve for trial division
@@ -101,10 +123,75 @@ Primality MillerRabinSequence( const BigInt& n, Int numReps=30 );
 // (with numReps representatives) to test for primality.
 Primality PrimalityTest( const BigInt& n, Int numReps=30 );
 
+struct ProbablePrimeCtrl
+{
+    // The number of consecutive integers in each window of candidates
+    Int windowSize=4096;
+
+    // Candidates with an odd prime factor no larger than sieveLimit are
+    // discarded (using the trial-division sieve) before any Miller-Rabin
+    // tests, and survivors less than sieveLimit^2 are known to be prime
+    unsigned long long sieveLimit=65536ULL;
+
+    // The number of Miller-Rabin representatives; the first is always two
+    Int numReps=30;
+
+    // Run the Miller-Rabin tests of the surviving candidates on separate
+    // OpenMP threads
+    bool parallel=true;
+};
+
+// Return the probable primes in [lowerBound,lowerBound+ctrl.windowSize)
+vector<BigInt> ProbablePrimes
+( const BigInt& lowerBound,
+  const ProbablePrimeCtrl& ctrl=ProbablePrimeCtrl() );
+
+// Return the first probable prime in [lowerBound,lowerBound+ctrl.windowSize)
+// (or zero if there is none)
+BigInt FirstProbablePrime
+( const BigInt& lowerBound,
+  const ProbablePrimeCtrl& ctrl=ProbablePrimeCtrl() );
+
 // Return the first prime greater than n (with high likelihood)
 BigInt NextProbablePrime( const BigInt& n, Int numReps=30 );
 void NextProbablePrime( const BigInt& n, BigInt& nextPrime, Int numReps=30 );
 
+// Montgomery arithmetic modulo an odd integer n > 1: each residue x is
+// represented by x R (mod n), where R is the smallest power of 2^GMP_NUMB_BITS
+// exceeding n, so that products are reduced with multiplications and shifts
+// rather than divisions by n. Since the temporaries are members, each thread
+// should use its own instance.
+class Montgomery
+{
+public:
+    Montgomery( const BigInt& n );
+
+    const BigInt& Modulus() const;
+    // The representation of one, R (mod n)
+    const BigInt& One() const;
+
+    // xMont := x R (mod n)
+    void ToMontgomery( const BigInt& x, BigInt& xMont ) const;
+    // x := xMont / R (mod n)
+    void FromMontgomery( const BigInt& xMont, BigInt& x );
+
+    // z := x y / R (mod n) for x and y in [0,n); z may alias x or y
+    void Multiply( const BigInt& x, const BigInt& y, BigInt& z );
+    // z := x^e / R^(e-1) (mod n) for x in [0,n); z may alias x
+    void Power( const BigInt& x, unsigned long e, BigInt& z );
+
+private:
+    BigInt n_, one_;
+    // -n^{-1} (mod R)
+    BigInt nInvNeg_;
+    unsigned numBits_;
+
+    BigInt product_, reduction_, base_;
+
+    // z := t / R (mod n) for t in [0,n R)
+    void Reduce( const BigInt& t, BigInt& z );
+};
+
 namespace factor {
 
 struct PollardRhoCtrl
@@ -122,6 +209,16 @@ struct PollardRhoCtrl
     // For Miller-Rabin primality testing
     Int numReps=30;
 
+    // Interleave 'numWalks' walks per process, with the shifts a0, a0+1, ...
+    // (skipping 0 and -2), and take a single GCD of the product of all of
+    // their differences every gcdDelay steps (backtracking if it was n).
+    // The walks are divided between the OpenMP threads and the processes of
+    // 'comm', and are advanced with Montgomery arithmetic if requested.
+    bool batched=false;
+    Int numWalks=16;
+    bool montgomery=false;
+    mpi::Comm comm=mpi::COMM_SELF;
+
     bool progress=false;
     bool time=false;
 };
@@ -245,6 +342,18 @@ struct PollardRhoCtrl
     bool assumePrime=false;
     factor::PollardRhoCtrl factorCtrl;
 
+    // Run 'numWalks' random walks per process and detect the collisions
+    // between them (across the OpenMP threads and the processes of 'comm')
+    // through distinguished points, those whose (Montgomery) representation
+    // is divisible by 2^distinguishedBits, in the manner of van Oorschot and
+    // Wiener. A negative number of bits selects a default based upon the
+    // order of the subgroup.
+    bool batched=false;
+    Int numWalks=16;
+    Int distinguishedBits=-1;
+    bool montgomery=false;
+    mpi::Comm comm=mpi::COMM_SELF;
+
     bool progress=false;
     bool time=false;
 };
@@ -271,7 +380,9 @@ BigInt PollardRho
 #include <El/number_theory/JacobiSymbol.hpp>
 #include <El/number_theory/MillerRabin.hpp>
 #include <El/number_theory/PrimalityTest.hpp>
+#include <El/number_theory/ProbablePrimes.hpp>
 #include <El/number_theory/NextProbablePrime.hpp>
+#include <El/number_theory/Montgomery.hpp>
 #include <El/number_theory/factor/PollardRho.hpp>
 #include <El/number_theory/factor/PollardPMinusOne.hpp>
 #include <El/number_theory/PrimitiveRoot.hpp>
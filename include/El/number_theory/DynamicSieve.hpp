@@ -353,6 +353,153 @@ T DynamicSieve<T,TSmall>::NextPrime()
     return currentPrime;
 }
 
+namespace dynamic_sieve {
+
+inline unsigned TrailingZeros( std::uint64_t word )
+{
+#ifdef __GNUC__
+    return __builtin_ctzll( word );
+#else
+    unsigned numZeros = 0;
+    for( ; (word & 1) == 0; word >>= 1 )
+        ++numZeros;
+    return numZeros;
+#endif
+}
+
+} // namespace dynamic_sieve
+
+template<typename T,typename TSmall>
+void DynamicSieve<T,TSmall>::SieveBitSegment
+( T offset,
+  T numCandidates,
+  TSmall numSievingPrimes,
+  vector<std::uint64_t>& table ) const
+{
+    // Bit k of the table corresponds to offset + 2*k, and the padding bits
+    // of the last word are left unset
+    const T numWords = (numCandidates+63) / 64;
+    table.assign( numWords, ~std::uint64_t(0) );
+    if( numCandidates % 64 != 0 )
+        table[numWords-1] = (std::uint64_t(1) << (numCandidates%64)) - 1;
+
+    const T largestCandidate = offset + 2*(numCandidates-1);
+    for( TSmall j=0; j<numSievingPrimes; ++j )
+    {
+        const T p = oddPrimes[j];
+        if( p*p > largestCandidate )
+            break;
+
+        // Find the first odd multiple of p that is at least
+        // Max(offset,p^2), as in ComputeSegmentStart
+        T k;
+        if( p*p >= offset )
+        {
+            k = (p*p - offset) / 2;
+        }
+        else
+        {
+            const T complement = (p - (offset % p)) % p;
+            k = ( complement % 2 == 0 ? complement/2 : (complement+p)/2 );
+        }
+        for( ; k<numCandidates; k+=p )
+            table[k/64] &= ~(std::uint64_t(1) << (k%64));
+    }
+}
+
+template<typename T,typename TSmall>
+template<typename Function>
+void DynamicSieve<T,TSmall>::ForEachPrime
+( T lowerBound, T upperBound, Function visit, bool parallel )
+{
+    if( lowerBound <= 2 && upperBound >= 2 )
+        visit( T(2) );
+    lowerBound = std::max( lowerBound, T(3) );
+    if( lowerBound % 2 == 0 )
+        ++lowerBound;
+    if( lowerBound > upperBound )
+        return;
+
+    // Store the odd primes up to the square root of the upper bound
+    T sqrtBound = T(std::sqrt(double(upperBound)));
+    while( sqrtBound*sqrtBound > upperBound )
+        --sqrtBound;
+    while( (sqrtBound+1)*(sqrtBound+1) <= upperBound )
+        ++sqrtBound;
+    if( oddPrimes.back() < sqrtBound )
+        Generate( sqrtBound );
+    const TSmall numSievingPrimes =
+      TSmall(std::upper_bound(oddPrimes.begin(),oddPrimes.end(),sqrtBound) -
+             oddPrimes.begin());
+
+    // Each bit-packed table occupies segmentSize_ bytes
+    const T segmentCandidates = 8*T(segmentSize_);
+    const T numCandidates = (upperBound-lowerBound)/2 + 1;
+    const T numSegments =
+      (numCandidates+segmentCandidates-1) / segmentCandidates;
+
+    Int batchSize = 1;
+#ifdef EL_HYBRID
+    const int numThreads = blas::FallbackThreads();
+    if( parallel && numThreads > 1 && !omp_in_parallel() )
+        batchSize = numThreads;
+#endif
+    vector<vector<std::uint64_t>> tables( batchSize );
+
+    for( T batchBeg=0; batchBeg<numSegments; batchBeg+=batchSize )
+    {
+        const Int numBatchSegments =
+          Int(std::min(T(batchSize),numSegments-batchBeg));
+        auto sieveSegment = [&]( Int s )
+          {
+              const T segment = batchBeg + s;
+              const T segmentBeg = segment*segmentCandidates;
+              const T segmentSize =
+                std::min( segmentCandidates, numCandidates-segmentBeg );
+              SieveBitSegment
+              ( lowerBound+2*segmentBeg, segmentSize, numSievingPrimes,
+                tables[s] );
+          };
+#ifdef EL_HYBRID
+        if( numBatchSegments > 1 )
+        {
+            _Pragma("omp parallel for num_threads(numThreads)")
+            for( Int s=0; s<numBatchSegments; ++s )
+                sieveSegment( s );
+        }
+        else
+            sieveSegment( 0 );
+#else
+        sieveSegment( 0 );
+#endif
+
+        for( Int s=0; s<numBatchSegments; ++s )
+        {
+            const T offset = lowerBound + 2*(batchBeg+s)*segmentCandidates;
+            const auto& table = tables[s];
+            const T numWords = table.size();
+            for( T w=0; w<numWords; ++w )
+            {
+                for( std::uint64_t word=table[w]; word; word &= word-1 )
+                {
+                    const T k = 64*w + dynamic_sieve::TrailingZeros(word);
+                    visit( offset + 2*k );
+                }
+            }
+        }
+    }
+}
+
+template<typename T,typename TSmall>
+T DynamicSieve<T,TSmall>::CountPrimes
+( T lowerBound, T upperBound, bool parallel )
+{
+    T numPrimes = 0;
+    ForEachPrime
+    ( lowerBound, upperBound, [&]( const T& ) { ++numPrimes; }, parallel );
+    return numPrimes;
+}
+
 } // namespace El
 
 #endif // ifndef EL_NUMBER_THEORY_DYNAMIC_SIEVE_HPP
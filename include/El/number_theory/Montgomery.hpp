@@ -0,0 +1,102 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_NUMBER_THEORY_MONTGOMERY_HPP
+#define EL_NUMBER_THEORY_MONTGOMERY_HPP
+
+namespace El {
+
+#ifdef EL_HAVE_MPC
+
+// See Peter L. Montgomery, "Modular multiplication without trial division",
+// Mathematics of Computation, Vol. 44, No. 170, pp. 519--521, 1985.
+
+inline Montgomery::Montgomery( const BigInt& n )
+: n_(n)
+{
+    if( n <= BigInt(1) || Mod(n,2u) == BigInt(0) )
+        LogicError("Montgomery arithmetic requires an odd modulus > 1");
+
+    // BigInt::NumBits is a multiple of the number of bits per limb
+    numBits_ = unsigned(n.NumBits());
+    BigInt R(1);
+    R <<= numBits_;
+
+    one_ = R;
+    one_ %= n_;
+
+    nInvNeg_ = R;
+    nInvNeg_ -= InvertMod( n_, R );
+}
+
+inline const BigInt& Montgomery::Modulus() const
+{ return n_; }
+
+inline const BigInt& Montgomery::One() const
+{ return one_; }
+
+inline void Montgomery::ToMontgomery( const BigInt& x, BigInt& xMont ) const
+{
+    xMont = x;
+    xMont <<= numBits_;
+    xMont %= n_;
+}
+
+inline void Montgomery::FromMontgomery( const BigInt& xMont, BigInt& x )
+{ Reduce( xMont, x ); }
+
+inline void Montgomery::Reduce( const BigInt& t, BigInt& z )
+{
+    // m := (t mod R) (-n^{-1}) mod R, so that t + m n is divisible by R
+    mpz_tdiv_r_2exp( reduction_.Pointer(), t.LockedPointer(), numBits_ );
+    reduction_ *= nInvNeg_;
+    mpz_tdiv_r_2exp
+    ( reduction_.Pointer(), reduction_.LockedPointer(), numBits_ );
+
+    // z := (t + m n) / R, which lies in [0,2n)
+    reduction_ *= n_;
+    reduction_ += t;
+    mpz_tdiv_q_2exp( z.Pointer(), reduction_.LockedPointer(), numBits_ );
+    if( z >= n_ )
+        z -= n_;
+}
+
+inline void Montgomery::Multiply( const BigInt& x, const BigInt& y, BigInt& z )
+{
+    product_ = x;
+    product_ *= y;
+    Reduce( product_, z );
+}
+
+inline void Montgomery::Power( const BigInt& x, unsigned long e, BigInt& z )
+{
+    if( e == 0 )
+    {
+        z = one_;
+        return;
+    }
+
+    // Left-to-right binary exponentiation
+    base_ = x;
+    int bit = 8*sizeof(unsigned long) - 1;
+    while( !((e >> bit) & 1ul) )
+        --bit;
+    z = base_;
+    for( --bit; bit>=0; --bit )
+    {
+        Multiply( z, z, z );
+        if( (e >> bit) & 1ul )
+            Multiply( z, base_, z );
+    }
+}
+
+#endif // ifdef EL_HAVE_MPC
+
+} // namespace El
+
+#endif // ifndef EL_NUMBER_THEORY_MONTGOMERY_HPP
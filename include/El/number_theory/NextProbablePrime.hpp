@@ -13,11 +13,30 @@ namespace El {
 
 #ifdef EL_HAVE_MPC
 
-// TODO: Use a custom implementation that incorporates 'numReps'
 // TODO: Incorporate a manual BPSW implementation
-inline void NextProbablePrime( const BigInt& n, BigInt& nextPrime, Int /*numReps*/ )
+inline void NextProbablePrime
+( const BigInt& n, BigInt& nextPrime, Int numReps )
 {
-    mpz_nextprime( nextPrime.Pointer(), n.LockedPointer() );
+    // The candidates of large integers are sieved a window at a time and
+    // then screened concurrently, while GMP is faster for smaller searches
+    const int minWindowBits = 256;
+    if( mpz_sizeinbase( n.LockedPointer(), 2 ) < size_t(minWindowBits) )
+    {
+        mpz_nextprime( nextPrime.Pointer(), n.LockedPointer() );
+        return;
+    }
+
+    ProbablePrimeCtrl ctrl;
+    ctrl.numReps = numReps;
+    BigInt lowerBound( n );
+    lowerBound += 1;
+    while( true )
+    {
+        nextPrime = FirstProbablePrime( lowerBound, ctrl );
+        if( nextPrime != BigIntZero() )
+            return;
+        lowerBound += ctrl.windowSize;
+    }
 }
 
 inline BigInt NextProbablePrime( const BigInt& n, Int numReps )
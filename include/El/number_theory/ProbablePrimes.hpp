@@ -0,0 +1,244 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_NUMBER_THEORY_PROBABLE_PRIMES_HPP
+#define EL_NUMBER_THEORY_PROBABLE_PRIMES_HPP
+
+namespace El {
+
+#ifdef EL_HAVE_MPC
+
+namespace probable_primes {
+
+// Return the indices i of the window [lowerBound,lowerBound+windowSize) such
+// that lowerBound+i has no prime factor less than or equal to sieveLimit
+// (other than itself)
+inline vector<Int> SieveWindow
+( const BigInt& lowerBound,
+  const ProbablePrimeCtrl& ctrl )
+{
+    const Int windowSize = ctrl.windowSize;
+    vector<char> table( windowSize, 1 );
+
+    // Remove the candidates below two
+    Int firstIndex = 0;
+    if( lowerBound < BigInt(2) )
+    {
+        BigInt numSmall( 2 );
+        numSmall -= lowerBound;
+        firstIndex =
+          ( numSmall >= BigInt(windowSize) ? windowSize : Int(numSmall) );
+    }
+
+    // If the window begins below the sieve limit, we must restore the
+    // sieving primes themselves
+    const bool smallWindow = ( lowerBound <= BigInt(ctrl.sieveLimit) );
+    const Int lowerSmall = ( smallWindow ? Int(lowerBound) : 0 );
+    auto restorePrime =
+      [&]( Int p )
+      {
+          if( smallWindow && p >= lowerSmall && p-lowerSmall < windowSize )
+              table[p-lowerSmall] = 1;
+      };
+
+    // Remove the even numbers other than two
+    const Int start = ( mpz_even_p(lowerBound.LockedPointer()) ? 0 : 1 );
+    for( Int i=start; i<windowSize; i+=2 )
+        table[i] = 0;
+    restorePrime( 2 );
+
+    auto& sieve = TrialDivisionSieve();
+    sieve.Generate( ctrl.sieveLimit );
+    auto primeEnd =
+      std::upper_bound
+      ( sieve.oddPrimes.begin(), sieve.oddPrimes.end(), ctrl.sieveLimit );
+    for( auto iter=sieve.oddPrimes.begin(); iter<primeEnd; ++iter )
+    {
+        const unsigned long p = *iter;
+        const unsigned long remainder =
+          mpz_fdiv_ui( lowerBound.LockedPointer(), p );
+        for( Int i=Int((p-remainder)%p); i<windowSize; i+=p )
+            table[i] = 0;
+        restorePrime( Int(p) );
+    }
+
+    vector<Int> survivors;
+    for( Int i=firstIndex; i<windowSize; ++i )
+        if( table[i] )
+            survivors.push_back( i );
+    return survivors;
+}
+
+// Screen each of the given candidates with a Miller-Rabin test to base two
+// (in parallel if requested) and return whether each survived
+inline vector<char> ScreenCandidates
+( const vector<BigInt>& candidates,
+  const ProbablePrimeCtrl& ctrl )
+{
+    const Int numCandidates = candidates.size();
+    vector<char> survived( numCandidates, 0 );
+
+    // Survivors of the sieve which are below sieveLimit^2 must be prime
+    BigInt provenBound( ctrl.sieveLimit );
+    provenBound *= provenBound;
+
+    const BigInt& two = BigIntTwo();
+    auto screen =
+      [&]( Int k )
+      {
+          survived[k] =
+            ( candidates[k] < provenBound ||
+              MillerRabin( candidates[k], two ) != COMPOSITE );
+      };
+
+    bool concurrent = false;
+#ifdef EL_HYBRID
+    const int numThreads = blas::FallbackThreads();
+    concurrent = ctrl.parallel && numThreads > 1 && numCandidates > 1 &&
+                 !omp_in_parallel();
+    if( concurrent )
+    {
+        _Pragma("omp parallel for schedule(dynamic,1) num_threads(numThreads)")
+        for( Int k=0; k<numCandidates; ++k )
+            screen( k );
+    }
+#endif
+    if( !concurrent )
+        for( Int k=0; k<numCandidates; ++k )
+            screen( k );
+    return survived;
+}
+
+} // namespace probable_primes
+
+inline vector<BigInt> ProbablePrimes
+( const BigInt& lowerBound,
+  const ProbablePrimeCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.windowSize < 1 )
+        LogicError("The window must contain at least one candidate");
+    const auto survivors = probable_primes::SieveWindow( lowerBound, ctrl );
+    const Int numSurvivors = survivors.size();
+    vector<BigInt> candidates( numSurvivors );
+    for( Int k=0; k<numSurvivors; ++k )
+    {
+        candidates[k] = lowerBound;
+        candidates[k] += survivors[k];
+    }
+    const auto survived =
+      probable_primes::ScreenCandidates( candidates, ctrl );
+
+    // Sample the remaining representatives sequentially, since the random
+    // number generator is not shared between threads, and then test the
+    // strong probable primes to base two concurrently
+    BigInt provenBound( ctrl.sieveLimit );
+    provenBound *= provenBound;
+    const Int numExtraReps = Max( ctrl.numReps-1, Int(0) );
+    vector<Int> sprps;
+    vector<BigInt> reps;
+    const BigInt& two = BigIntTwo();
+    for( Int k=0; k<numSurvivors; ++k )
+    {
+        if( !survived[k] || candidates[k] < provenBound )
+            continue;
+        sprps.push_back( k );
+        BigInt nm1( candidates[k] );
+        nm1 -= 1;
+        for( Int c=0; c<numExtraReps; ++c )
+            reps.push_back( SampleUniform( two, nm1 ) );
+    }
+    const Int numSPRPs = sprps.size();
+    vector<char> confirmed( numSurvivors, 1 );
+    auto confirm =
+      [&]( Int j )
+      {
+          const BigInt& n = candidates[sprps[j]];
+          for( Int c=0; c<numExtraReps; ++c )
+          {
+              if( MillerRabin( n, reps[j*numExtraReps+c] ) == COMPOSITE )
+              {
+                  confirmed[sprps[j]] = 0;
+                  return;
+              }
+          }
+      };
+
+    bool concurrent = false;
+#ifdef EL_HYBRID
+    const int numThreads = blas::FallbackThreads();
+    concurrent = ctrl.parallel && numThreads > 1 && numSPRPs > 1 &&
+                 !omp_in_parallel();
+    if( concurrent )
+    {
+        _Pragma("omp parallel for schedule(dynamic,1) num_threads(numThreads)")
+        for( Int j=0; j<numSPRPs; ++j )
+            confirm( j );
+    }
+#endif
+    if( !concurrent )
+        for( Int j=0; j<numSPRPs; ++j )
+            confirm( j );
+
+    vector<BigInt> primes;
+    for( Int k=0; k<numSurvivors; ++k )
+        if( survived[k] && confirmed[k] )
+            primes.push_back( candidates[k] );
+    return primes;
+}
+
+inline BigInt FirstProbablePrime
+( const BigInt& lowerBound,
+  const ProbablePrimeCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.windowSize < 1 )
+        LogicError("The window must contain at least one candidate");
+    const auto survivors = probable_primes::SieveWindow( lowerBound, ctrl );
+    const Int numSurvivors = survivors.size();
+
+    // Screen the survivors in increasing order in batches of a few
+    // candidates per thread so that little work is wasted beyond the first
+    // probable prime
+    Int batchSize = 1;
+#ifdef EL_HYBRID
+    if( ctrl.parallel && !omp_in_parallel() )
+        batchSize = 4*Max( blas::FallbackThreads(), 1 );
+#endif
+    BigInt provenBound( ctrl.sieveLimit );
+    provenBound *= provenBound;
+    vector<BigInt> candidates;
+    for( Int batchBeg=0; batchBeg<numSurvivors; batchBeg+=batchSize )
+    {
+        const Int batchEnd = Min( batchBeg+batchSize, numSurvivors );
+        candidates.resize( batchEnd-batchBeg );
+        for( Int k=batchBeg; k<batchEnd; ++k )
+        {
+            candidates[k-batchBeg] = lowerBound;
+            candidates[k-batchBeg] += survivors[k];
+        }
+        const auto survived =
+          probable_primes::ScreenCandidates( candidates, ctrl );
+        for( Int k=0; k<batchEnd-batchBeg; ++k )
+        {
+            if( !survived[k] )
+                continue;
+            const BigInt& n = candidates[k];
+            if( n < provenBound ||
+                MillerRabinSequence( n, ctrl.numReps-1 ) != COMPOSITE )
+                return n;
+        }
+    }
+    return BigIntZero();
+}
+
+#endif // ifdef EL_HAVE_MPC
+
+} // namespace El
+
+#endif // ifndef EL_NUMBER_THEORY_PROBABLE_PRIMES_HPP
@@ -17,6 +17,335 @@ namespace dlog {
 
 namespace pollard_rho {
 
+// Given a relation q^aDiff = r^bDiff (mod n) within the subgroup of the
+// given order, return the discrete logarithm of q with respect to r
+inline BigInt SolveRelation
+( const BigInt& q,
+  const BigInt& r,
+  const BigInt& n,
+  const BigInt& subgroupOrder,
+  const BigInt& aDiff,
+  const BigInt& bDiff,
+  const PollardRhoCtrl& ctrl )
+{
+    const BigInt& one = BigIntOne();
+
+    // NOTE:
+    // We should not necessarily throw an exception if bDiff=0;
+    // consider the problem 1 = (n-1)^x (mod n), which will converge
+    // at iteration 1 since (n-1)^2 = 1 (mod n) for any n. We will
+    // instead attempt to detect degeneracy below.
+
+    BigInt d, lambda, mu;
+    ExtendedGCD( aDiff, subgroupOrder, d, lambda, mu );
+    if( ctrl.progress )
+        Output("GCD(",aDiff,",",subgroupOrder,")=",d);
+
+    // Solve for k in lambda*bDiff = d*k.
+    // Note that such a relationship of r^(lambda*bDiff) = r^(d*k)
+    // need not exist if r does not generate q.
+    BigInt k = (lambda*bDiff) / d;
+    k %= subgroupOrder;
+
+    // Q := q r^{-k}
+    BigInt Q = PowMod( r, -k, n );
+    Q *= q;
+    Q %= n;
+
+    // theta := pow( r, subgroupOrder/d ) 
+    BigInt exponent(subgroupOrder);
+    exponent /= d;
+    BigInt theta = PowMod( r, exponent, n );
+
+    // Test theta^i = Q for each i
+    // (Also test theta^i = -Q, which implies theta^{i+d/2} = Q
+    //  if r was a primitive root)
+    BigInt thetaPow(one);
+    BigInt negQ(Q);
+    negQ *= -1;
+    negQ %= n;
+    for( BigInt thetaExp=0; thetaExp<d; ++thetaExp )
+    {
+        if( thetaPow == Q )
+        {
+            BigInt discLog = k + thetaExp*exponent;
+            if( ctrl.progress )
+                Output("Returning ",discLog," at thetaExp=",thetaExp);
+            return discLog;
+        }
+        else if( thetaPow == negQ )
+        {
+            BigInt dHalf(d);
+            dHalf /= 2;
+            BigInt theta_dHalf = PowMod( theta, dHalf, n );
+            if( Mod(thetaPow*theta_dHalf,n) == Q )
+            {
+                BigInt discLog = k + (thetaExp+dHalf)*exponent;
+                if( ctrl.progress )
+                    Output
+                    ("Took -Q shortcut at thetaExp=",thetaExp,
+                     " and found discLog=",discLog);
+                return discLog; 
+            }
+            else if( ctrl.progress )
+                Output("-Q shortcut failed at thetaExp=",thetaExp);
+        } 
+        thetaPow *= theta;
+        thetaPow %= n;
+        if( thetaPow == one && thetaExp+1 < d )
+        {
+            LogicError
+            ("theta=r^(",subgroupOrder,"/",d,")=",theta,
+             " was a degenerate ",d,"'th root, as theta^",
+             thetaExp+1,"=1, and r does not generate q");
+        }
+    }
+
+    LogicError("This should not be possible");
+    return BigInt(-1);
+}
+
+// Parallel collision search for the relation needed by SolveRelation, in
+// the manner of
+//
+//   Paul C. van Oorschot and Michael J. Wiener, "Parallel Collision Search
+//   with Cryptanalytic Applications", Journal of Cryptology, Vol. 12,
+//   pp. 1--28, 1999.
+//
+// Each walk begins at q^a r^b for random exponents (a,b) and follows the
+// same iteration as Subproblem, but only the distinguished points (those
+// whose representation is divisible by 2^distinguishedBits) are recorded.
+// Two walks which reach the same point with different exponents then
+// collide at the next distinguished point, regardless of which thread or
+// process owns them. Every process merges the points in the same order,
+// so that they all solve the same relation.
+inline BigInt BatchedSubproblem
+( const BigInt& q,
+  const BigInt& r,
+  const BigInt& n,
+  const BigInt& subgroupOrder,
+  const PollardRhoCtrl& ctrl )
+{
+    if( ctrl.numWalks < 1 )
+        LogicError("Batched Pollard rho requires at least one walk");
+    const int commRank = mpi::Rank( ctrl.comm );
+    const int commSize = mpi::Size( ctrl.comm );
+    const Int totalWalks = commSize*ctrl.numWalks;
+
+    Int numGroups = 1;
+#ifdef EL_HYBRID
+    const int numThreads = blas::FallbackThreads();
+    if( numThreads > 1 && !omp_in_parallel() )
+        numGroups = Min( Int(numThreads), ctrl.numWalks );
+#endif
+
+    // Aim for trails whose length is a small fraction of the expected
+    // sqrt(subgroupOrder)/totalWalks steps per walk
+    Int distinguishedBits = ctrl.distinguishedBits;
+    if( distinguishedBits < 0 )
+    {
+        const Int orderBits =
+          Int(mpz_sizeinbase( subgroupOrder.LockedPointer(), 2 ));
+        Int walkBits = 0;
+        while( (Int(1) << walkBits) < totalWalks )
+            ++walkBits;
+        distinguishedBits = Max( orderBits/2 - walkBits - 4, Int(0) );
+    }
+    const Int stepsPerRound = Int(4) << distinguishedBits;
+    const Int trailBound = Int(20) << distinguishedBits;
+    if( ctrl.progress && commRank == 0 )
+        Output
+        ("Running ",totalWalks," walks with ",distinguishedBits,
+         " distinguished bits");
+
+    // Montgomery arithmetic requires an odd modulus
+    const bool montgomery = ctrl.montgomery && Mod(n,2u) != BigInt(0);
+    Montgomery mont( montgomery ? n : BigInt(3) );
+    BigInt qInt(q), rInt(r);
+    if( montgomery )
+    {
+        mont.ToMontgomery( q, qInt );
+        mont.ToMontgomery( r, rInt );
+    }
+
+    BigInt nOneThird(n);
+    nOneThird /= 3;
+    BigInt nTwoThirds(n);
+    nTwoThirds *= 2;
+    nTwoThirds /= 3;
+
+    vector<BigInt> x(ctrl.numWalks), a(ctrl.numWalks), b(ctrl.numWalks);
+    vector<Int> trailLengths(ctrl.numWalks,0);
+    const BigInt& zero = BigIntZero();
+    auto restart =
+      [&]( Int walk )
+      {
+          a[walk] = SampleUniform( zero, subgroupOrder );
+          b[walk] = SampleUniform( zero, subgroupOrder );
+          BigInt tmp;
+          PowMod( q, a[walk], n, x[walk] );
+          PowMod( r, b[walk], n, tmp );
+          x[walk] *= tmp;
+          x[walk] %= n;
+          if( montgomery )
+              mont.ToMontgomery( x[walk], x[walk] );
+          trailLengths[walk] = 0;
+      };
+    for( Int walk=0; walk<ctrl.numWalks; ++walk )
+        restart( walk );
+
+    vector<Montgomery> monts( numGroups, mont );
+    vector<vector<BigInt>> groupPoints( numGroups );
+    vector<vector<Int>> groupRestarts( numGroups );
+    auto runRound =
+      [&]( Int g )
+      {
+          auto& points = groupPoints[g];
+          auto& restarts = groupRestarts[g];
+          auto& groupMont = monts[g];
+          points.clear();
+          restarts.clear();
+          auto multiply =
+            [&]( BigInt& y, const BigInt& z )
+            {
+              if( montgomery )
+                  groupMont.Multiply( y, z, y );
+              else
+              {
+                  y *= z;
+                  y %= n;
+              }
+            };
+          // The distinguished points are stored as (x,a,b) triples
+          for( Int walk=g; walk<ctrl.numWalks; walk+=numGroups )
+          {
+              BigInt& xw = x[walk];
+              BigInt& aw = a[walk];
+              BigInt& bw = b[walk];
+              for( Int step=0; step<stepsPerRound; ++step )
+              {
+                  if( xw <= nOneThird )
+                  {
+                      multiply( xw, qInt );
+                      ++aw;
+                      if( aw == subgroupOrder )
+                          aw = 0;
+                  }
+                  else if( xw <= nTwoThirds )
+                  {
+                      multiply( xw, xw );
+                      aw *= 2;
+                      aw %= subgroupOrder;
+                      bw *= 2;
+                      bw %= subgroupOrder;
+                  }
+                  else
+                  {
+                      multiply( xw, rInt );
+                      ++bw;
+                      if( bw == subgroupOrder )
+                          bw = 0;
+                  }
+
+                  if( Int(mpz_scan1( xw.LockedPointer(), 0 )) >=
+                      distinguishedBits )
+                  {
+                      points.push_back( xw );
+                      points.push_back( aw );
+                      points.push_back( bw );
+                      trailLengths[walk] = 0;
+                  }
+                  else if( ++trailLengths[walk] > trailBound )
+                  {
+                      // The walk is presumably trapped in a cycle without
+                      // any distinguished points
+                      restarts.push_back( walk );
+                      break;
+                  }
+              }
+          }
+      };
+
+    std::map<BigInt,std::pair<BigInt,BigInt>> table;
+    vector<BigInt> localPoints, points;
+    vector<int> counts(commSize), displs(commSize);
+    for( Int round=1; ; ++round )
+    {
+#ifdef EL_HYBRID
+        if( numGroups > 1 )
+        {
+            _Pragma("omp parallel for num_threads(numGroups)")
+            for( Int g=0; g<numGroups; ++g )
+                runRound( g );
+        }
+        else
+            runRound( 0 );
+#else
+        runRound( 0 );
+#endif
+
+        // The random number generator is not shared between threads
+        localPoints.clear();
+        for( Int g=0; g<numGroups; ++g )
+        {
+            for( const Int& walk : groupRestarts[g] )
+                restart( walk );
+            localPoints.insert
+            ( localPoints.end(), groupPoints[g].begin(),
+              groupPoints[g].end() );
+        }
+        if( commSize > 1 )
+        {
+            const int numLocal = localPoints.size();
+            mpi::AllGather( &numLocal, 1, counts.data(), 1, ctrl.comm );
+            int numPoints = 0;
+            for( int rank=0; rank<commSize; ++rank )
+            {
+                displs[rank] = numPoints;
+                numPoints += counts[rank];
+            }
+            points.resize( numPoints );
+            mpi::AllGather
+            ( localPoints.data(), numLocal,
+              points.data(), counts.data(), displs.data(), ctrl.comm );
+        }
+        else
+            points.swap( localPoints );
+
+        const Int numPoints = points.size() / 3;
+        for( Int k=0; k<numPoints; ++k )
+        {
+            const BigInt& xk = points[3*k];
+            const BigInt& ak = points[3*k+1];
+            const BigInt& bk = points[3*k+2];
+            auto search = table.find( xk );
+            if( search == table.end() )
+            {
+                table.insert
+                ( std::make_pair(xk,std::make_pair(ak,bk)) );
+                continue;
+            }
+
+            // q^ak r^bk = q^aj r^bj implies q^(ak-aj) = r^(bj-bk)
+            const BigInt& aj = search->second.first;
+            const BigInt& bj = search->second.second;
+            BigInt aDiff = (ak - aj) % subgroupOrder;
+            BigInt bDiff = (bj - bk) % subgroupOrder;
+            if( aDiff == zero )
+            {
+                // Either the walks coincided or the relation only involves
+                // r, and neither helps
+                continue;
+            }
+            if( ctrl.progress && commRank == 0 )
+                Output
+                ("Detected a collision in round ",round," among ",
+                 table.size()," distinguished points");
+            return SolveRelation( q, r, n, subgroupOrder, aDiff, bDiff, ctrl );
+        }
+    }
+}
+
 // For use within a Pohlig-Hellman decomposition
 // NOTE: This implementation is meant to support subgroups of (Z/nZ)*, such
 //       as the n=5 case with r=4 implies the subgroup {4,4^2=16=1} of order 2.
@@ -52,6 +381,9 @@ inline BigInt Subproblem
             LogicError("One does not generate ",q);
     }
 
+    if( ctrl.batched )
+        return BatchedSubproblem( q, r, n, subgroupOrder, ctrl );
+
     BigInt nOneThird(n);
     nOneThird /= 3;
 
@@ -115,78 +447,7 @@ inline BigInt Subproblem
 
             BigInt aDiff = (ai - a2i) % subgroupOrder;
             BigInt bDiff = (b2i - bi) % subgroupOrder;
-            // NOTE:
-            // We should not necessarily throw an exception if bDiff=0;
-            // consider the problem 1 = (n-1)^x (mod n), which will converge
-            // at iteration 1 since (n-1)^2 = 1 (mod n) for any n. We will
-            // instead attempt to detect degeneracy below.
-
-            BigInt d, lambda, mu;
-            ExtendedGCD( aDiff, subgroupOrder, d, lambda, mu );
-            if( ctrl.progress )
-                Output("GCD(",aDiff,",",subgroupOrder,")=",d);
-
-            // Solve for k in lambda*bDiff = d*k.
-            // Note that such a relationship of r^(lambda*bDiff) = r^(d*k)
-            // need not exist if r does not generate q.
-            BigInt k = (lambda*bDiff) / d;
-            k %= subgroupOrder;
-
-            // Q := q r^{-k}
-            BigInt Q = PowMod( r, -k, n );
-            Q *= q;
-            Q %= n;
-
-            // theta := pow( r, subgroupOrder/d ) 
-            BigInt exponent(subgroupOrder);
-            exponent /= d;
-            BigInt theta = PowMod( r, exponent, n );
-
-            // Test theta^i = Q for each i
-            // (Also test theta^i = -Q, which implies theta^{i+d/2} = Q
-            //  if r was a primitive root)
-            BigInt thetaPow(theta);
-            BigInt negQ(Q);
-            negQ *= -1;
-            negQ %= n;
-            for( BigInt thetaExp=0; thetaExp<d; ++thetaExp )
-            {
-                if( thetaPow == Q )
-                {
-                    BigInt discLog = k + thetaExp*exponent;
-                    if( ctrl.progress )
-                        Output("Returning ",discLog," at thetaExp=",thetaExp);
-                    return discLog;
-                }
-                else if( thetaPow == negQ )
-                {
-                    BigInt dHalf(d);
-                    dHalf /= 2;
-                    BigInt theta_dHalf = PowMod( theta, dHalf, n );
-                    if( Mod(thetaPow*theta_dHalf,n) == Q )
-                    {
-                        BigInt discLog = k + (thetaExp+dHalf)*exponent;
-                        if( ctrl.progress )
-                            Output
-                            ("Took -Q shortcut at thetaExp=",thetaExp,
-                             " and found discLog=",discLog);
-                        return discLog; 
-                    }
-                    else if( ctrl.progress )
-                        Output("-Q shortcut failed at thetaExp=",thetaExp);
-                } 
-                if( thetaPow == one )
-                {
-                    LogicError
-                    ("theta=r^(",subgroupOrder,"/",d,")=",theta,
-                     " was a degenerate ",d,"'th root, as theta^",
-                     thetaExp,"=1, and r does not generate q");
-                }
-                thetaPow *= theta;
-                thetaPow %= n;
-            }
-
-            LogicError("This should not be possible");
+            return SolveRelation( q, r, n, subgroupOrder, aDiff, bDiff, ctrl );
         }
         ++i;
     }
@@ -47,31 +47,6 @@ void RepeatedPowMod
         PowMod( a, p, n, a );
 }
 
-template<typename Iterator>
-void RepeatedPowModRange
-( BigInt& a,
-  Iterator pBeg,
-  Iterator pEnd,
-  const BigInt& n,
-  const double& nLog,
-  bool checkpoint=false,
-  Int checkpointFreq=1000000 )
-{
-    Int checkpointCounter = 0;
-    for( auto pPtr=pBeg; pPtr<pEnd; ++pPtr )
-    {
-        auto p = *pPtr;
-        RepeatedPowMod( a, p, n, nLog );
-
-        ++checkpointCounter;
-        if( checkpoint && checkpointCounter >= checkpointFreq )
-        {
-            Output("After p=",p,", exponential was a=",a);
-            checkpointCounter = 0;
-        }
-    }
-}
-
 // NOTE: Returns the GCD of stage 1 and overwrites a with a power of a
 template<typename TSieve,typename TSieveSmall>
 BigInt StageOne
@@ -84,39 +59,29 @@ BigInt StageOne
 {
     const BigInt& one = BigIntOne();
 
-    // Ensure that we have sieved at least up until primeBound
-    bool neededStage1Sieving = ( sieve.oddPrimes.back() < primeBound );
-    if( ctrl.progress )
-    {
-        if( neededStage1Sieving )
-            Output
-            ("Updating sieve from ",sieve.oddPrimes.back()," to ",primeBound);
-        else
-            Output("Stage 1 sieve was already sufficient");
-    }
-    sieve.Generate( primeBound );
-    if( ctrl.progress && neededStage1Sieving )
-        Output("Done sieving for stage 1");
-
     double nLog = double(Log(BigFloat(n)));
     if( !separateOdd && !ctrl.jumpstart1 )
     {
         RepeatedSquareMod( a, n, nLog );
     }
-    auto oddPrimeBeg = sieve.oddPrimes.begin();
-    if( ctrl.jumpstart1 )
-    {
-        // Start at the first odd prime >= ctrl.start1
-        oddPrimeBeg =
-          std::lower_bound
-          ( oddPrimeBeg, sieve.oddPrimes.end(), ctrl.start1 );
-    }
-    // We stop just before the last prime *greater* than primeBound
-    auto oddPrimeEnd =
-      std::upper_bound( oddPrimeBeg, sieve.oddPrimes.end(), primeBound );
-    RepeatedPowModRange
-    ( a, oddPrimeBeg, oddPrimeEnd, n, nLog,
-      ctrl.checkpoint, ctrl.checkpointFreq );
+
+    // Stream the odd primes in [start,primeBound] from the segmented sieve
+    // rather than storing all of them
+    const TSieve start = ( ctrl.jumpstart1 ? Max(ctrl.start1,TSieve(3)) : 3 );
+    Int checkpointCounter = 0;
+    sieve.ForEachPrime
+    ( start, primeBound,
+      [&]( const TSieve& p )
+      {
+          RepeatedPowMod( a, p, n, nLog );
+
+          ++checkpointCounter;
+          if( ctrl.checkpoint && checkpointCounter >= ctrl.checkpointFreq )
+          {
+              Output("After p=",p,", exponential was a=",a);
+              checkpointCounter = 0;
+          }
+      } );
     if( ctrl.progress )
         Output("Done with stage-1 exponentiation");
 
@@ -112,6 +112,222 @@ inline BigInt FindFactor
     }
 }
 
+// A set of interleaved walks which share a single accumulated product of
+// the differences x_{2i} - x_i (in Montgomery form if requested)
+struct WalkGroup
+{
+    vector<BigInt> shifts, x, x2, xSave, x2Save;
+    BigInt Q;
+};
+
+// Run numWalks walks per process (divided between the OpenMP threads) with
+// a single GCD per group of walks every gcdDelay steps
+inline BigInt BatchedFindFactor
+( const BigInt& n,
+  const PollardRhoCtrl& ctrl )
+{
+    const BigInt& one = BigIntOne();
+    if( Mod(n,2u) == BigInt(0) )
+        return BigIntTwo();
+    if( ctrl.numWalks < 1 )
+        LogicError("Batched Pollard rho requires at least one walk");
+
+    const int commRank = mpi::Rank( ctrl.comm );
+    const int commSize = mpi::Size( ctrl.comm );
+    const Int totalWalks = commSize*ctrl.numWalks;
+
+    Int numGroups = 1;
+#ifdef EL_HYBRID
+    const int numThreads = blas::FallbackThreads();
+    if( numThreads > 1 && !omp_in_parallel() )
+        numGroups = Min( Int(numThreads), ctrl.numWalks );
+#endif
+
+    // The shifts are distinct over all of the walks of every process
+    auto nextShift =
+      [&]( Int shift ) -> Int
+      {
+          do { shift += totalWalks; } while( shift == 0 || shift == -2 );
+          return shift;
+      };
+    Montgomery mont( n );
+    auto toInternal =
+      [&]( const BigInt& x, BigInt& xInt )
+      {
+          if( ctrl.montgomery )
+              mont.ToMontgomery( Mod(x,n), xInt );
+          else
+              xInt = Mod( x, n );
+      };
+
+    vector<WalkGroup> groups( numGroups );
+    vector<vector<Int>> groupShifts( numGroups );
+    BigInt x0Int;
+    toInternal( ctrl.x0, x0Int );
+    for( Int walk=0; walk<ctrl.numWalks; ++walk )
+    {
+        Int shift = ctrl.a0 + commRank*ctrl.numWalks + walk;
+        if( shift == 0 || shift == -2 )
+            shift = nextShift( shift );
+        auto& group = groups[walk % numGroups];
+        groupShifts[walk % numGroups].push_back( shift );
+        BigInt shiftInt;
+        toInternal( BigInt(shift), shiftInt );
+        group.shifts.push_back( shiftInt );
+        group.x.push_back( x0Int );
+        group.x2.push_back( x0Int );
+    }
+    vector<Montgomery> monts( numGroups, mont );
+
+    // Advance one round of gcdDelay steps of the walks in a group and return
+    // a nontrivial factor if one was found (and zero otherwise)
+    auto runRound =
+      [&]( Int g ) -> BigInt
+      {
+          auto& group = groups[g];
+          auto& groupMont = monts[g];
+          const Int numGroupWalks = group.x.size();
+          BigInt diff, gcd;
+          auto advance =
+            [&]( BigInt& x, const BigInt& shift )
+            {
+              if( ctrl.montgomery )
+              {
+                  if( ctrl.numSteps == 1 )
+                      groupMont.Multiply( x, x, x );
+                  else
+                      groupMont.Power( x, 2*ctrl.numSteps, x );
+              }
+              else
+              {
+                  if( ctrl.numSteps == 1 )
+                  {
+                      x *= x;
+                      x %= n;
+                  }
+                  else
+                      PowMod( x, 2*ctrl.numSteps, n, x );
+              }
+              x += shift;
+              if( x >= n )
+                  x -= n;
+            };
+          auto step =
+            [&]( Int w )
+            {
+              advance( group.x[w], group.shifts[w] );
+              advance( group.x2[w], group.shifts[w] );
+              advance( group.x2[w], group.shifts[w] );
+              diff = group.x2[w];
+              diff -= group.x[w];
+              if( diff < BigInt(0) )
+                  diff += n;
+            };
+
+          group.xSave = group.x;
+          group.x2Save = group.x2;
+          group.Q = ( ctrl.montgomery ? groupMont.One() : one );
+          for( Int i=0; i<ctrl.gcdDelay; ++i )
+          {
+              for( Int w=0; w<numGroupWalks; ++w )
+              {
+                  step( w );
+                  if( ctrl.montgomery )
+                      groupMont.Multiply( group.Q, diff, group.Q );
+                  else
+                  {
+                      group.Q *= diff;
+                      group.Q %= n;
+                  }
+              }
+          }
+          GCD( group.Q, n, gcd );
+          if( gcd == one )
+              return BigInt(0);
+          if( gcd != n )
+              return gcd;
+
+          // Backtrack and take the GCD of each difference individually, and
+          // restart each walk whose sequence converged modulo n
+          group.x = group.xSave;
+          group.x2 = group.x2Save;
+          vector<bool> converged( numGroupWalks, false );
+          for( Int i=0; i<ctrl.gcdDelay; ++i )
+          {
+              for( Int w=0; w<numGroupWalks; ++w )
+              {
+                  if( converged[w] )
+                      continue;
+                  step( w );
+                  GCD( diff, n, gcd );
+                  if( gcd == n )
+                      converged[w] = true;
+                  else if( gcd != one )
+                      return gcd;
+              }
+          }
+          for( Int w=0; w<numGroupWalks; ++w )
+          {
+              if( !converged[w] )
+                  continue;
+              Int& shift = groupShifts[g][w];
+              shift = nextShift( shift );
+              BigInt shiftInt( shift );
+              shiftInt %= n;
+              if( ctrl.montgomery )
+                  groupMont.ToMontgomery( shiftInt, group.shifts[w] );
+              else
+                  group.shifts[w] = shiftInt;
+              group.x[w] = x0Int;
+              group.x2[w] = x0Int;
+          }
+          return BigInt(0);
+      };
+
+    vector<BigInt> factors( numGroups );
+    for( Int round=1; ; ++round )
+    {
+#ifdef EL_HYBRID
+        if( numGroups > 1 )
+        {
+            _Pragma("omp parallel for num_threads(numGroups)")
+            for( Int g=0; g<numGroups; ++g )
+                factors[g] = runRound( g );
+        }
+        else
+            factors[0] = runRound( 0 );
+#else
+        factors[0] = runRound( 0 );
+#endif
+
+        BigInt factor(0);
+        for( Int g=0; g<numGroups; ++g )
+        {
+            if( factors[g] != BigInt(0) )
+            {
+                factor = factors[g];
+                break;
+            }
+        }
+        if( commSize > 1 )
+        {
+            // Adopt the factor of the first process which found one
+            int owner = ( factor != BigInt(0) ? commRank : commSize );
+            owner = mpi::AllReduce( owner, mpi::MIN, ctrl.comm );
+            if( owner < commSize )
+                mpi::Broadcast( factor, owner, ctrl.comm );
+        }
+        if( factor != BigInt(0) )
+        {
+            if( ctrl.progress )
+                Output
+                ("Found factor ",factor," after ",round*ctrl.gcdDelay,
+                 " steps of ",totalWalks," walks");
+            return factor;
+        }
+    }
+}
+
 } // namespace pollard_rho
 
 inline vector<BigInt> PollardRho
@@ -176,16 +392,24 @@ inline vector<BigInt> PollardRho
             timer.Start();
         PushIndent();
         BigInt factor;
-        try
+        if( ctrl.batched )
         {
-            factor = pollard_rho::FindFactor( nRem, ctrl.a0, ctrl );
+            // Converged walks are restarted with new shifts internally
+            factor = pollard_rho::BatchedFindFactor( nRem, ctrl );
         }
-        catch( const exception& e ) // TODO: Introduce factor exception?
+        else
         {
-            // Try again with a=ctrl.a1
-            if( ctrl.progress )
-                Output("Attempting to factor ",nRem," with a=",ctrl.a1);
-            factor = pollard_rho::FindFactor( nRem, ctrl.a1, ctrl );
+            try
+            {
+                factor = pollard_rho::FindFactor( nRem, ctrl.a0, ctrl );
+            }
+            catch( const exception& e ) // TODO: Introduce factor exception?
+            {
+                // Try again with a=ctrl.a1
+                if( ctrl.progress )
+                    Output("Attempting to factor ",nRem," with a=",ctrl.a1);
+                factor = pollard_rho::FindFactor( nRem, ctrl.a1, ctrl );
+            }
         }
         if( ctrl.time )
             Output("Pollard-rho: ",timer.Stop()," seconds");
@@ -68,6 +68,10 @@ typedef struct
     bool time;
     bool jumpstart;
     ElInt startCol;
+    ElInt deepInsertionDepth;
+    bool segmented;
+    ElInt segmentSize;
+    ElInt maxSegmentSweeps;
 } ElLLLCtrl_s;
 EL_EXPORT ElError ElLLLCtrlDefault_s( ElLLLCtrl_s* ctrl );
 
@@ -91,6 +95,10 @@ typedef struct
     bool time;
     bool jumpstart;
     ElInt startCol;
+    ElInt deepInsertionDepth;
+    bool segmented;
+    ElInt segmentSize;
+    ElInt maxSegmentSweeps;
 } ElLLLCtrl_d;
 EL_EXPORT ElError ElLLLCtrlDefault_d( ElLLLCtrl_d* ctrl );
 
@@ -90,6 +90,21 @@ Int ZDependenceSearch
         Matrix<F>& U, 
   const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
 
+// Perform an independent Z-dependence search for each column of Z, with the
+// searches dynamically distributed over the processes of 'comm' and each
+// reduced with adaptive-precision LLL. On exit, every process holds the
+// number of (nearly) exact dependences detected for each query and, in the
+// corresponding column of 'relations', the coefficients of the shortest
+// reduced basis vector.
+template<typename F>
+void ZDependenceSearchBatch
+( const Matrix<F>& Z,
+        Base<F> NSqrt,
+        Matrix<Int>& numExact,
+        Matrix<F>& relations,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>(),
+        mpi::Comm comm=mpi::COMM_WORLD );
+
 // Search for an algebraic relation
 // ================================
 // Search for the (Gaussian) integer coefficients of a polynomial of alpha
@@ -103,6 +118,18 @@ Int AlgebraicRelationSearch
   Matrix<F>& U, 
   const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
 
+// Perform an independent algebraic relation search of degree less than n for
+// each entry of the column vector 'alphas' (see ZDependenceSearchBatch)
+template<typename F>
+void AlgebraicRelationSearchBatch
+( const Matrix<F>& alphas,
+        Int n,
+        Base<F> NSqrt,
+        Matrix<Int>& numExact,
+        Matrix<F>& relations,
+  const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>(),
+        mpi::Comm comm=mpi::COMM_WORLD );
+
 } // namespace El
 
 #include <El/number_theory/lattice/Enumerate.hpp>
@@ -81,6 +81,32 @@ struct BKZCtrl
     bool subEarlyAbort = true;
     Int subNumEnumsBeforeAbort = 100;
 
+    // BKZ 2.0
+    // -------
+    // See Yuanmi Chen and Phong Q. Nguyen, "BKZ 2.0: Better Lattice Security
+    // Estimates", ASIACRYPT 2011.
+    //
+    // A progressive schedule successively reduces with the blocksizes
+    // progressiveStart, progressiveStart+progressiveStep, ..., blocksize.
+    bool progressive=false;
+    Int progressiveStart=10;
+    Int progressiveStep=10;
+
+    // Blocks of dimension at least 'pruningMinBlocksize' are searched with
+    // GNR extreme pruning using coefficients which are optimized (and cached)
+    // for each (dimension,blocksize) pair. Enough rerandomized trials are
+    // performed to succeed with probability 'pruningTargetSuccess' (subject
+    // to enumCtrl.numTrials), and each trial is preprocessed by BKZ 2.0 with
+    // blocksize preprocessBlocksizeFunc(blocksize) whose cost is modeled as
+    // 'pruningPreprocessCost' enumeration nodes. Smaller blocks are fully
+    // enumerated.
+    bool extremePruning=false;
+    Int pruningMinBlocksize=30;
+    double pruningTargetSuccess=0.9;
+    double pruningPreprocessCost=1e5;
+    function<Int(Int)> preprocessBlocksizeFunc =
+      function<Int(Int)>( []( Int bsize ) { return Max(bsize/2,Int(10)); } );
+
     // This seems to be *more* expensive but lead to higher quality (perhaps).
     // Note that this is different from GNR recursion and uses a tree method
     // with shuffling at each merge.
@@ -138,6 +164,15 @@ struct BKZCtrl
         subEarlyAbort = ctrl.subEarlyAbort;
         subNumEnumsBeforeAbort = ctrl.subNumEnumsBeforeAbort;
 
+        progressive = ctrl.progressive;
+        progressiveStart = ctrl.progressiveStart;
+        progressiveStep = ctrl.progressiveStep;
+        extremePruning = ctrl.extremePruning;
+        pruningMinBlocksize = ctrl.pruningMinBlocksize;
+        pruningTargetSuccess = ctrl.pruningTargetSuccess;
+        pruningPreprocessCost = ctrl.pruningPreprocessCost;
+        preprocessBlocksizeFunc = ctrl.preprocessBlocksizeFunc;
+
         recursive = ctrl.recursive;
 
         logFailedEnums = ctrl.logFailedEnums;
@@ -415,6 +450,91 @@ bool TryLowerPrecisionBigFloat
 }
 #endif
 
+// Run BKZ with each blocksize of the progressive schedule
+template<typename F>
+BKZInfo<Base<F>> ProgressiveHelper
+( Matrix<F>& B,
+  Matrix<F>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  bool maintainU,
+  const BKZCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    if( ctrl.progressiveStart < 2 || ctrl.progressiveStep < 1 )
+        LogicError("Invalid progressive BKZ schedule");
+
+    auto ctrlMod( ctrl );
+    ctrlMod.progressive = false;
+    BKZInfo<Real> info;
+    Int numSwaps=0, numEnums=0, numEnumFailures=0;
+    for( Int bsize=ctrl.progressiveStart; true; bsize+=ctrl.progressiveStep )
+    {
+        ctrlMod.blocksize = Min(bsize,ctrl.blocksize);
+        if( ctrl.progress )
+            Output("Progressive BKZ with blocksize ",ctrlMod.blocksize);
+        if( maintainU )
+            info = BKZWithQ( B, U, QR, t, d, ctrlMod );
+        else
+            info = BKZWithQ( B, QR, t, d, ctrlMod );
+        numSwaps += info.numSwaps;
+        numEnums += info.numEnums;
+        numEnumFailures += info.numEnumFailures;
+        if( ctrlMod.blocksize == ctrl.blocksize )
+            break;
+
+        // Subsequent tours continue from the accumulated transformation
+        ctrlMod.jumpstart = true;
+        ctrlMod.startCol = 0;
+    }
+    info.numSwaps = numSwaps;
+    info.numEnums = numEnums;
+    info.numEnumFailures = numEnumFailures;
+    return info;
+}
+
+// Configure the extremely-pruned enumeration of a block of the given dimension
+template<typename Real>
+void ConfigurePruning
+( Int blockDim,
+  Int bsize,
+  const BKZCtrl<Real>& ctrl,
+        EnumCtrl<Real>& enumCtrl )
+{
+    EL_DEBUG_CSE
+    if( blockDim < ctrl.pruningMinBlocksize )
+    {
+        if( !ctrl.variableEnumType )
+            enumCtrl.enumType = FULL_ENUM;
+        enumCtrl.customPruning = false;
+        return;
+    }
+    if( !ctrl.variableEnumType )
+        enumCtrl.enumType = GNR_ENUM;
+
+    const auto pruning =
+      svp::OptimizedPruning( blockDim, bsize, ctrl.pruningPreprocessCost );
+    enumCtrl.customPruning = true;
+    enumCtrl.pruningCoefficients = pruning.coefficients;
+
+    // Each trial independently succeeds with probability p, so that
+    // 1-(1-p)^numTrials trials meet the target
+    const double p = pruning.successProb;
+    Int numTrials = ctrl.enumCtrl.numTrials;
+    if( p >= 1 )
+        numTrials = 1;
+    else if( p > 0 )
+        numTrials = Int(std::ceil
+          (std::log(1-ctrl.pruningTargetSuccess)/std::log(1-p)));
+    enumCtrl.numTrials = Max( Min(numTrials,ctrl.enumCtrl.numTrials), Int(1) );
+
+    enumCtrl.preprocessBlocksize =
+      Max( Min(ctrl.preprocessBlocksizeFunc(bsize),blockDim), Int(2) );
+    enumCtrl.recursivePreprocess = true;
+}
+
 } // namespace bkz
 
 template<typename F>
@@ -465,6 +585,10 @@ BKZInfo<Base<F>> BKZWithQ
     }
     // TODO: Allow for dropping with non-integer vectors?
 
+    if( ctrl.progressive && !ctrl.variableBlocksize &&
+        ctrl.progressiveStart < ctrl.blocksize )
+        return bkz::ProgressiveHelper( B, U, QR, t, d, true, ctrl );
+
     if( ctrl.recursive &&
         Max(ctrl.blocksize,ctrl.lllCtrl.cutoff) < n &&
         !ctrl.jumpstart )
@@ -597,6 +721,8 @@ BKZInfo<Base<F>> BKZWithQ
             bkz::enumTimer.Start();
         if( ctrl.variableEnumType )
             enumCtrl.enumType = ctrl.enumTypeFunc(j);
+        if( ctrl.extremePruning )
+            bkz::ConfigurePruning( k+1-j, bsize, ctrl, enumCtrl );
         const Range<Int> windowInd = IR(j,Min(j+ctrl.multiEnumWindow,k+1));
         auto normUpperBounds = GetRealPartOfDiagonal(QR(windowInd,windowInd));
         Scale( Min(Sqrt(ctrl.lllCtrl.delta),Real(1)), normUpperBounds );
@@ -831,6 +957,13 @@ BKZInfo<Base<F>> BKZWithQ
     }
     // TODO: Allow for dropping with non-integer vectors?
 
+    if( ctrl.progressive && !ctrl.variableBlocksize &&
+        ctrl.progressiveStart < ctrl.blocksize )
+    {
+        Matrix<F> U;
+        return bkz::ProgressiveHelper( B, U, QR, t, d, false, ctrl );
+    }
+
     if( ctrl.recursive &&
         Max(ctrl.blocksize,ctrl.lllCtrl.cutoff) < n &&
         !ctrl.jumpstart )
@@ -958,6 +1091,8 @@ BKZInfo<Base<F>> BKZWithQ
             bkz::enumTimer.Start();
         if( ctrl.variableEnumType )
             enumCtrl.enumType = ctrl.enumTypeFunc(j);
+        if( ctrl.extremePruning )
+            bkz::ConfigurePruning( k+1-j, bsize, ctrl, enumCtrl );
         const Range<Int> windowInd = IR(j,Min(j+ctrl.multiEnumWindow,k+1));
         auto normUpperBounds = GetRealPartOfDiagonal(QR(windowInd,windowInd));
         Scale( Min(Sqrt(ctrl.lllCtrl.delta),Real(1)), normUpperBounds );
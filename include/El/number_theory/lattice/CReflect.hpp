@@ -88,6 +88,10 @@ inline LLLCtrl<float> CReflect( const ElLLLCtrl_s& ctrlC )
     ctrl.time = ctrlC.time;
     ctrl.jumpstart = ctrlC.jumpstart;
     ctrl.startCol = ctrlC.startCol;
+    ctrl.deepInsertionDepth = ctrlC.deepInsertionDepth;
+    ctrl.segmented = ctrlC.segmented;
+    ctrl.segmentSize = ctrlC.segmentSize;
+    ctrl.maxSegmentSweeps = ctrlC.maxSegmentSweeps;
     return ctrl;
 }
 
@@ -109,6 +113,10 @@ inline LLLCtrl<double> CReflect( const ElLLLCtrl_d& ctrlC )
     ctrl.time = ctrlC.time;
     ctrl.jumpstart = ctrlC.jumpstart;
     ctrl.startCol = ctrlC.startCol;
+    ctrl.deepInsertionDepth = ctrlC.deepInsertionDepth;
+    ctrl.segmented = ctrlC.segmented;
+    ctrl.segmentSize = ctrlC.segmentSize;
+    ctrl.maxSegmentSweeps = ctrlC.maxSegmentSweeps;
     return ctrl;
 }
 
@@ -130,6 +138,10 @@ inline ElLLLCtrl_s CReflect( const LLLCtrl<float>& ctrl )
     ctrlC.time = ctrl.time;
     ctrlC.jumpstart = ctrl.jumpstart;
     ctrlC.startCol = ctrl.startCol;
+    ctrlC.deepInsertionDepth = ctrl.deepInsertionDepth;
+    ctrlC.segmented = ctrl.segmented;
+    ctrlC.segmentSize = ctrl.segmentSize;
+    ctrlC.maxSegmentSweeps = ctrl.maxSegmentSweeps;
     return ctrlC;
 }
 
@@ -151,6 +163,10 @@ inline ElLLLCtrl_d CReflect( const LLLCtrl<double>& ctrl )
     ctrlC.time = ctrl.time;
     ctrlC.jumpstart = ctrl.jumpstart;
     ctrlC.startCol = ctrl.startCol;
+    ctrlC.deepInsertionDepth = ctrl.deepInsertionDepth;
+    ctrlC.segmented = ctrl.segmented;
+    ctrlC.segmentSize = ctrl.segmentSize;
+    ctrlC.maxSegmentSweeps = ctrl.maxSegmentSweeps;
     return ctrlC;
 }
 
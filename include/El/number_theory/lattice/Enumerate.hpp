@@ -34,12 +34,39 @@ struct EnumCtrl
     // Explicitly transpose 'N' to encourage unit-stride access
     bool explicitTranspose=true;
 
+    // Parallel FULL_ENUM and GNR_ENUM
+    // -------------------------------
+    // The top 'splitDepth' levels of the enumeration tree are traversed to
+    // generate subtrees which are dealt out over the processes of 'comm' (each
+    // of which must pass in identical data) and dynamically scheduled over the
+    // threads of each process. The search radius is reduced to the norm of
+    // the shortest vector found thus far, which is immediately shared between
+    // the threads of a process and is shared between processes after each of
+    // them has searched 'subtreesPerSync' more subtrees.
+    bool parallel=false;
+    Int splitDepth=10;
+    Int subtreesPerSync=256;
+    mpi::Comm comm=mpi::COMM_SELF;
+
     // GNR_ENUM
     // --------
     // TODO: Add ability to further tune the bounding function
     bool linearBounding=false;
     Int numTrials=1000;
 
+    // If 'customPruning' is true, the squared ratios of the pruned upper
+    // bounds to the radius are interpolated from 'pruningCoefficients' (which
+    // are used directly if there is one per level) rather than from Aono's
+    // coefficients
+    bool customPruning=false;
+    vector<double> pruningCoefficients;
+
+    // Each rerandomized trial is preprocessed with BKZ of the given
+    // blocksize, which is itself progressive with extreme pruning if
+    // 'recursivePreprocess' is true
+    Int preprocessBlocksize=10;
+    bool recursivePreprocess=false;
+
     // YSPARSE_ENUM
     // ------------
     Int phaseLength=10;
@@ -73,10 +100,19 @@ struct EnumCtrl
         innerProgress = ctrl.innerProgress;
         explicitTranspose = ctrl.explicitTranspose;
 
+        parallel = ctrl.parallel;
+        splitDepth = ctrl.splitDepth;
+        subtreesPerSync = ctrl.subtreesPerSync;
+        comm = ctrl.comm;
+
         // GNR_ENUM
         // --------
         linearBounding = ctrl.linearBounding;
         numTrials = ctrl.numTrials;
+        customPruning = ctrl.customPruning;
+        pruningCoefficients = ctrl.pruningCoefficients;
+        preprocessBlocksize = ctrl.preprocessBlocksize;
+        recursivePreprocess = ctrl.recursivePreprocess;
 
         // YSPARSE_ENUM
         // ------------
@@ -376,6 +412,11 @@ public:
 // If not successful, the return value is a value greater than u(n-1) and 
 // the contents of 'v' should be ignored.
 //
+// If 'ctrl.parallel' is true (and the datatype has a fixed precision), the
+// entire (pruned) tree is searched with a radius that shrinks to the norm of
+// the shortest member found thus far, and so the result is the shortest of
+// the members which satisfy the norm profile rather than the first found.
+//
 // NOTE: There is not currently a complex implementation, though algorithms
 //       exist.
 template<typename F>
@@ -452,6 +493,21 @@ PhaseEnumeration
         Matrix<F>& v,
         Int progressLevel=0 );
 
+// Extreme pruning coefficients for the GNR enumeration of an n-dimensional
+// block of a BKZ basis with the given blocksize, under the Gaussian heuristic
+// and the Geometric Series Assumption. The coefficients are the squared
+// ratios of the bounds to the radius and are chosen to (approximately)
+// minimize the expected number of nodes, plus the given preprocessing cost
+// (measured in nodes), per success. The results are cached.
+struct PruningInfo
+{
+    vector<double> coefficients;
+    double successProb;
+    double logNodes; // natural logarithm of the expected nodes per trial
+};
+
+PruningInfo OptimizedPruning( Int n, Int blocksize, double preprocessCost );
+
 } // namespace svp
 
 // Given a reduced lattice B and its Gaussian Normal Form, R, either find a
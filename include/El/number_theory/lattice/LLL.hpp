@@ -206,6 +206,22 @@ struct LLLCtrl
     bool jumpstart=false;
     Int startCol=0;
 
+    // If positive, the deep insertion variants only attempt to insert b_k
+    // into one of the first 'deepInsertionDepth' positions or one of the
+    // 'deepInsertionDepth' positions preceding k, as in the depth-limited
+    // variant of Schnorr and Euchner, which bounds the cost of each scan
+    Int deepInsertionDepth=0;
+
+    // If 'segmented' is true, the projected blocks R(I_s,I_s) of contiguous
+    // segments of (at most) 'segmentSize' columns are reduced independently
+    // (and concurrently if OpenMP is available), alternating between aligned
+    // and half-shifted segments in order to repair the boundaries, for at
+    // most 'maxSegmentSweeps' sweeps before a final pass of LLL over the
+    // full (nearly reduced) basis. Presorting and jumpstarts are ignored.
+    bool segmented=false;
+    Int segmentSize=32;
+    Int maxSegmentSweeps=8;
+
     // In case of conversion from BigFloat to BigFloat with different precision
     LLLCtrl<Real>& operator=( const LLLCtrl<Real>& ctrl )
     {
@@ -239,6 +255,10 @@ struct LLLCtrl
         time = ctrl.time;
         jumpstart = ctrl.jumpstart;
         startCol = ctrl.startCol;
+        deepInsertionDepth = ctrl.deepInsertionDepth;
+        segmented = ctrl.segmented;
+        segmentSize = ctrl.segmentSize;
+        maxSegmentSweeps = ctrl.maxSegmentSweeps;
         return *this;
     }
 
@@ -268,6 +288,10 @@ struct LLLCtrl
         time = ctrl.time;
         jumpstart = ctrl.jumpstart;
         startCol = ctrl.startCol;
+        deepInsertionDepth = ctrl.deepInsertionDepth;
+        segmented = ctrl.segmented;
+        segmentSize = ctrl.segmentSize;
+        maxSegmentSweeps = ctrl.maxSegmentSweeps;
         return *this;
     }
 
@@ -314,6 +338,25 @@ LLLInfo<Base<F>> LLLWithQ
   Matrix<Base<F>>& d,
   const LLLCtrl<Base<F>>& ctrl=LLLCtrl<Base<F>>() );
 
+// Adaptive-precision LLL
+// ----------------------
+// Keep B (and U) in their original datatype while running the Gram-Schmidt
+// process in the lowest available precision (starting from double) which
+// passes the stability checks; R is returned in the datatype of B.
+// Please see LLL/Adaptive.hpp for more details.
+template<typename Z>
+LLLInfo<Base<Z>> AdaptiveLLL
+( Matrix<Z>& B,
+  Matrix<Z>& R,
+  const LLLCtrl<Base<Z>>& ctrl=LLLCtrl<Base<Z>>() );
+
+template<typename Z>
+LLLInfo<Base<Z>> AdaptiveLLL
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<Z>& R,
+  const LLLCtrl<Base<Z>>& ctrl=LLLCtrl<Base<Z>>() );
+
 namespace lll {
 
 static Timer stepTimer, houseStepTimer,
@@ -418,6 +461,14 @@ Base<F> LogVolume( const Matrix<F>& R )
     return logVol;
 }
 
+// Whether the deep insertion of b_k into position i should be attempted
+template<typename Real>
+bool DeepInsertionAllowed( Int i, Int k, const LLLCtrl<Real>& ctrl )
+{
+    const Int depth = ctrl.deepInsertionDepth;
+    return depth <= 0 || i < depth || k-i <= depth;
+}
+
 } // namespace lll
 
 } // namespace El
@@ -438,6 +489,8 @@ LLLInfo<Base<F>> LLLWithQ
     EL_DEBUG_CSE
     typedef Base<F> Real;
     const Int n = B.Width();
+    if( ctrl.segmented && ctrl.segmentSize < n )
+        return SegmentedLLLWithQ( B, U, QR, t, d, ctrl );
     if( ctrl.recursive && ctrl.cutoff < n )
         return RecursiveLLLWithQ( B, U, QR, t, d, ctrl );
 
@@ -522,6 +575,8 @@ LLLWithQ
     EL_DEBUG_CSE
     typedef Base<F> Real;
     const Int n = B.Width();
+    if( ctrl.segmented && ctrl.segmentSize < n )
+        return SegmentedLLLWithQ( B, QR, t, d, ctrl );
     if( ctrl.recursive && ctrl.cutoff < n )
         return RecursiveLLLWithQ( B, QR, t, d, ctrl );
 
@@ -1131,4 +1186,7 @@ void DeepRowSwap( Matrix<Z>& B, Int i, Int k )
 
 } // namespace El
 
+#include <El/number_theory/lattice/LLL/Segmented.hpp>
+#include <El/number_theory/lattice/LLL/Adaptive.hpp>
+
 #endif // ifndef EL_LATTICE_LLL_HPP
@@ -0,0 +1,198 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LATTICE_LLL_ADAPTIVE_HPP
+#define EL_LATTICE_LLL_ADAPTIVE_HPP
+
+// Adaptive-precision LLL
+// ======================
+// The basis (and unimodular transformation) are kept in their original
+// datatype while the Householder-based Gram-Schmidt process of each attempt
+// is performed in the lowest precision of double, DoubleDouble, QuadDouble
+// (or Quad), and BigFloat (with repeatedly doubled precision) that has not
+// yet failed. An attempt fails if either
+//
+//   1. a column norm was unbounded or exceeded 1/eps,
+//   2. the size reduction of a column did not stabilize, or
+//   3. the resulting R factor does not (nearly) satisfy the requested delta
+//      and eta reduction properties,
+//
+// and, since every update of the basis is unimodular, the next attempt
+// simply resumes from the (partially reduced) basis left by its predecessor,
+// much as in the L^2 algorithm of Nguyen and Stehle. Most of the reduction is
+// therefore performed in the lowest precision which is stable for it.
+//
+
+namespace El {
+
+namespace lll {
+
+template<typename Z,typename Real>
+bool TryAdaptivePrecision
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<Z>& R,
+  bool maintainU,
+  const LLLCtrl<Base<Z>>& ctrl,
+  Int& numSwaps,
+  LLLInfo<Base<Z>>& info )
+{
+    EL_DEBUG_CSE
+    typedef ConvertBase<Z,Real> F;
+    if( ctrl.progress || ctrl.time )
+        Output("Adaptive LLL with ",TypeName<Real>()," Gram-Schmidt");
+
+    LLLCtrl<Real> ctrlF( ctrl );
+    ctrlF.unsafeSizeReduct = false;
+    // Resume with the unimodular transformation accumulated thus far
+    ctrlF.jumpstart = maintainU;
+    ctrlF.startCol = 0;
+
+    Matrix<F> QR, t;
+    Matrix<Real> d;
+    LLLInfo<Real> infoF;
+    try
+    {
+        if( maintainU )
+            infoF = LLLWithQ( B, U, QR, t, d, ctrlF );
+        else
+            infoF = LLLWithQ( B, QR, t, d, ctrlF );
+    }
+    catch( std::exception& e )
+    {
+        if( ctrl.progress || ctrl.time )
+            Output("  Failed: ",e.what());
+        return false;
+    }
+
+    MakeTrapezoidal( UPPER, QR );
+    const auto achieved = lll::Achieved( QR, ctrlF );
+    const Real slack = Sqrt(limits::Epsilon<Real>());
+    if( achieved.first < ctrlF.delta-slack ||
+        achieved.second > ctrlF.eta+slack )
+    {
+        if( ctrl.progress || ctrl.time )
+            Output
+            ("  Failed: achieved delta=",achieved.first," and eta=",
+             achieved.second);
+        numSwaps += infoF.numSwaps;
+        return false;
+    }
+
+    info = infoF;
+    info.numSwaps += numSwaps;
+    Copy( QR, R );
+    return true;
+}
+
+#ifdef EL_HAVE_MPC
+template<typename Z>
+bool TryAdaptiveBigFloat
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<Z>& R,
+  bool maintainU,
+  const LLLCtrl<Base<Z>>& ctrl,
+  Int& numSwaps,
+  LLLInfo<Base<Z>>& info )
+{
+    EL_DEBUG_CSE
+    // Begin beyond QuadDouble precision, or at the precision suggested by the
+    // magnitude of the basis, and then repeatedly double it
+    const mpfr_prec_t inputPrec = mpfr::Precision();
+    const double BOneNorm = double(OneNorm(B));
+    const double fudge = double(ctrl.precisionFudge);
+    mpfr_prec_t prec =
+      Max( mpfr_prec_t(256), mpfr_prec_t(Ceil(Log2(BOneNorm)*fudge)) );
+    const Int maxDoublings = 8;
+    bool succeeded = false;
+    for( Int doubling=0; doubling<=maxDoublings; ++doubling, prec *= 2 )
+    {
+        mpfr::SetPrecision( prec );
+        succeeded = TryAdaptivePrecision<Z,BigFloat>
+          ( B, U, R, maintainU, ctrl, numSwaps, info );
+        mpfr::SetPrecision( inputPrec );
+        if( succeeded )
+            break;
+    }
+    return succeeded;
+}
+#endif // ifdef EL_HAVE_MPC
+
+template<typename Z>
+LLLInfo<Base<Z>>
+AdaptiveHelper
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<Z>& R,
+  bool maintainU,
+  const LLLCtrl<Base<Z>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.jumpstart && ctrl.startCol > 0 )
+        LogicError("Cannot jumpstart adaptive-precision LLL");
+    if( maintainU )
+        Identity( U, B.Width(), B.Width() );
+
+    Int numSwaps = 0;
+    LLLInfo<Base<Z>> info;
+    bool succeeded = TryAdaptivePrecision<Z,double>
+      ( B, U, R, maintainU, ctrl, numSwaps, info );
+#ifdef EL_HAVE_QD
+    if( !succeeded )
+        succeeded = TryAdaptivePrecision<Z,DoubleDouble>
+          ( B, U, R, maintainU, ctrl, numSwaps, info );
+    if( !succeeded )
+        succeeded = TryAdaptivePrecision<Z,QuadDouble>
+          ( B, U, R, maintainU, ctrl, numSwaps, info );
+#elif defined(EL_HAVE_QUAD)
+    if( !succeeded )
+        succeeded = TryAdaptivePrecision<Z,Quad>
+          ( B, U, R, maintainU, ctrl, numSwaps, info );
+#endif
+#ifdef EL_HAVE_MPC
+    if( !succeeded )
+        succeeded = TryAdaptiveBigFloat<Z>
+          ( B, U, R, maintainU, ctrl, numSwaps, info );
+#endif
+    if( !succeeded )
+        RuntimeError("Adaptive LLL failed in every available precision");
+    return info;
+}
+
+} // namespace lll
+
+template<typename Z>
+LLLInfo<Base<Z>>
+AdaptiveLLL
+( Matrix<Z>& B,
+  Matrix<Z>& R,
+  const LLLCtrl<Base<Z>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Z> U;
+    const bool maintainU = false;
+    return lll::AdaptiveHelper( B, U, R, maintainU, ctrl );
+}
+
+template<typename Z>
+LLLInfo<Base<Z>>
+AdaptiveLLL
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<Z>& R,
+  const LLLCtrl<Base<Z>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const bool maintainU = true;
+    return lll::AdaptiveHelper( B, U, R, maintainU, ctrl );
+}
+
+} // namespace El
+
+#endif // ifndef EL_LATTICE_LLL_ADAPTIVE_HPP
@@ -147,6 +147,12 @@ bool Step
     Real oldNorm = lll::Norm2<Z,F>(B, k);      
     bool colUpdated = false;
 
+    // Bound the number of times that the size reduction is repeated due to a
+    // mismatch between || b_k ||_2 and || r_k ||_2, which is a sign that the
+    // working precision is insufficient
+    const Int maxRepeats = 128;
+    Int numRepeats = 0;
+
     while( true ) 
     {
         if( !ctrl.unsafeSizeReduct && !limits::IsFinite(oldNorm) )
@@ -293,6 +299,10 @@ bool Step
 
         if( Abs(newNorm - rNorm)/newNorm >= thresh )
         {
+            if( ++numRepeats > maxRepeats )
+                RuntimeError
+                ("Size reduction of column ",k," did not stabilize; "
+                 "increase precision");
             if( ctrl.progress )
                 Output("Repeating size reduction with k=", k, 
                        " because ||bk||=", newNorm, ", ||rk||=", rNorm);
@@ -629,7 +639,8 @@ LLLInfo<Base<F>> LeftDeepAlg
         {
             const Real rho_i_i = RealPart(QR(i,i));
             const Real leftTerm = Sqrt(ctrl.delta)*rho_i_i;
-            if( leftTerm > partialNorm )
+            if( lll::DeepInsertionAllowed( i, k, ctrl ) &&
+                leftTerm > partialNorm )
             {
                 ++numSwaps;
                 firstSwap = Min(firstSwap,i);
@@ -826,6 +837,9 @@ LLLInfo<Base<F>> LeftDeepReduceAlg
         const Int rColHeight = Min(k+1,minDim);
         for( Int i=0; i<Min(k,minDim); ++i )
         {
+            if( !lll::DeepInsertionAllowed( i, k, ctrl ) )
+                continue;
+
             // Perform additional reduction before attempting deep insertion
             // and reverse them if the candidate was not chosen 
             // (otherwise |R(i,j)|/R(i,i) can be greater than 1/2 for 
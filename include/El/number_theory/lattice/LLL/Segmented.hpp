@@ -0,0 +1,247 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LATTICE_LLL_SEGMENTED_HPP
+#define EL_LATTICE_LLL_SEGMENTED_HPP
+
+// Segment LLL
+// ===========
+// Given the QR factorization of the basis, B = Q R, the columns within a
+// contiguous segment I = [beg,end) may be reduced independently of the rest
+// of the basis by applying LLL to the R(beg:end,I) block, which generates
+// the projection of the segment onto the orthogonal complement of the span of
+// the preceding columns: if R(beg:end,I) U_I is reduced, then so are the
+// projections of B(:,I) U_I, and the lattice is unchanged since U_I is
+// unimodular. Distinct segments can therefore be reduced concurrently.
+//
+// Alternating between aligned and half-shifted segments propagates short
+// vectors across the segment boundaries, in the spirit of
+//
+//   Henrik Koy and Claus Peter Schnorr, "Segment LLL-Reduction of Lattice
+//   Bases", Cryptography and Lattices, LNCS 2146, pp. 67--80, 2001,
+//
+// and
+//
+//   Werner Backes and Susanne Wetzel, "Parallel Lattice Basis Reduction
+//   Using a Multi-threaded Schnorr-Euchner LLL Algorithm", Euro-Par 2009.
+//
+// A final (typically inexpensive) pass of the requested LLL variant over the
+// full basis then enforces the size reduction and Lovasz conditions across
+// the boundaries.
+//
+
+namespace El {
+
+namespace lll {
+
+// Reduce each of the (disjoint) projected segments of B, where the first
+// segment is [0,offset) if offset is positive, and return the total number of
+// swaps.
+template<typename Z,typename F>
+Int SegmentSweep
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  bool maintainU,
+  Int offset,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = B.Height();
+    const Int n = B.Width();
+    const Int minDim = Min(m,n);
+
+    Matrix<F> QR, t;
+    Matrix<Base<F>> d;
+    Copy( B, QR );
+    El::QR( QR, t, d );
+
+    // Columns beyond the rank of the QR factorization are left to the
+    // final pass
+    vector<Range<Int>> segments;
+    Int beg = 0;
+    if( offset > 0 )
+    {
+        segments.push_back( IR(0,Min(offset,minDim)) );
+        beg = offset;
+    }
+    for( ; beg<minDim; beg+=ctrl.segmentSize )
+        segments.push_back( IR(beg,Min(beg+ctrl.segmentSize,minDim)) );
+    const Int numSegments = segments.size();
+
+    auto segmentCtrl( ctrl );
+    segmentCtrl.segmented = false;
+    segmentCtrl.jumpstart = false;
+    segmentCtrl.startCol = 0;
+    segmentCtrl.progress = false;
+    segmentCtrl.time = false;
+
+    vector<Int> numSwaps( numSegments, 0 );
+    auto reduceSegment = [&]( Int s )
+      {
+          const Range<Int> ind = segments[s];
+          if( ind.end-ind.beg < 2 )
+              return;
+          Matrix<F> RSeg( QR( ind, ind ) );
+          MakeTrapezoidal( UPPER, RSeg );
+
+          Matrix<F> USeg, QRSeg, tSeg;
+          Matrix<Base<F>> dSeg;
+          auto info = LLLWithQ( RSeg, USeg, QRSeg, tSeg, dSeg, segmentCtrl );
+          numSwaps[s] = info.numSwaps;
+          if( info.numSwaps == 0 )
+              return;
+
+          Matrix<Z> USegZ;
+          Copy( USeg, USegZ );
+          auto BSeg = B( ALL, ind );
+          auto BSegCopy( BSeg );
+          Gemm( NORMAL, NORMAL, Z(1), BSegCopy, USegZ, Z(0), BSeg );
+          if( maintainU )
+          {
+              auto UIndSeg = U( ALL, ind );
+              auto UIndSegCopy( UIndSeg );
+              Gemm( NORMAL, NORMAL, Z(1), UIndSegCopy, USegZ, Z(0), UIndSeg );
+          }
+      };
+
+    // The default precision of BigFloat is not shared with other threads
+    bool concurrent = IsFixedPrecision<Base<F>>::value &&
+                      IsFixedPrecision<Base<Z>>::value;
+#ifdef EL_HYBRID
+    const int numThreads = blas::FallbackThreads();
+    concurrent = concurrent && numThreads > 1 && numSegments > 1 &&
+                 !omp_in_parallel();
+    if( concurrent )
+    {
+        std::exception_ptr error;
+        _Pragma("omp parallel for schedule(dynamic,1) num_threads(numThreads)")
+        for( Int s=0; s<numSegments; ++s )
+        {
+            try { reduceSegment( s ); }
+            catch( ... )
+            {
+                _Pragma("omp critical")
+                {
+                    if( !error )
+                        error = std::current_exception();
+                }
+            }
+        }
+        if( error )
+            std::rethrow_exception( error );
+    }
+#else
+    concurrent = false;
+#endif
+    if( !concurrent )
+        for( Int s=0; s<numSegments; ++s )
+            reduceSegment( s );
+
+    Int totalSwaps = 0;
+    for( Int s=0; s<numSegments; ++s )
+        totalSwaps += numSwaps[s];
+    return totalSwaps;
+}
+
+template<typename Z,typename F>
+LLLInfo<Base<F>>
+SegmentedHelper
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  bool maintainU,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = B.Width();
+    if( ctrl.segmentSize < 2 )
+        LogicError("Segments must contain at least two columns");
+    if( ctrl.jumpstart && ctrl.startCol > 0 )
+        Output("Warning: Segmented LLL ignores the starting column");
+    if( maintainU )
+    {
+        if( ctrl.jumpstart )
+        {
+            if( U.Height() != n || U.Width() != n )
+                LogicError("U should have been n x n on input");
+        }
+        else
+            Identity( U, n, n );
+    }
+
+    Int numSegmentSwaps = 0;
+    Int numQuietSweeps = 0;
+    for( Int sweep=0; sweep<ctrl.maxSegmentSweeps; ++sweep )
+    {
+        const Int offset = ( sweep % 2 == 0 ? 0 : ctrl.segmentSize/2 );
+        const Int numSwaps =
+          SegmentSweep<Z,F>( B, U, maintainU, offset, ctrl );
+        numSegmentSwaps += numSwaps;
+        if( ctrl.progress )
+            Output("Segment sweep ",sweep,": ",numSwaps," swaps");
+
+        // Stop once neither the aligned nor the shifted segments changed
+        numQuietSweeps = ( numSwaps == 0 ? numQuietSweeps+1 : 0 );
+        if( numQuietSweeps == 2 )
+            break;
+    }
+
+    auto ctrlMod( ctrl );
+    ctrlMod.segmented = false;
+    ctrlMod.recursive = false;
+    ctrlMod.presort = false;
+    ctrlMod.jumpstart = true;
+    ctrlMod.startCol = 0;
+    LLLInfo<Base<F>> info;
+    if( maintainU )
+        info = LLLWithQ( B, U, QR, t, d, ctrlMod );
+    else
+        info = LLLWithQ( B, QR, t, d, ctrlMod );
+    info.numSwaps += numSegmentSwaps;
+    if( numSegmentSwaps > 0 )
+        info.firstSwap = 0;
+    return info;
+}
+
+} // namespace lll
+
+template<typename Z,typename F>
+LLLInfo<Base<F>>
+SegmentedLLLWithQ
+( Matrix<Z>& B,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Z> U;
+    const bool maintainU = false;
+    return lll::SegmentedHelper( B, U, QR, t, d, maintainU, ctrl );
+}
+
+template<typename Z,typename F>
+LLLInfo<Base<F>>
+SegmentedLLLWithQ
+( Matrix<Z>& B,
+  Matrix<Z>& U,
+  Matrix<F>& QR,
+  Matrix<F>& t,
+  Matrix<Base<F>>& d,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const bool maintainU = true;
+    return lll::SegmentedHelper( B, U, QR, t, d, maintainU, ctrl );
+}
+
+} // namespace El
+
+#endif // ifndef EL_LATTICE_LLL_SEGMENTED_HPP
@@ -11,7 +11,58 @@
 
 namespace El {
 
-// TODO: Add correctness tests for this routine
+namespace nearest_plane {
+
+// C := C + alpha A X, exploiting the sparsity of the (integer) coordinates X
+// unless at least ctrl.blockingThresh of them are nonzero
+template<typename F>
+void UpdateWithCoordinates
+( F alpha,
+  const Matrix<F>& A,
+  const Matrix<F>& X,
+        Matrix<F>& C,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int k = A.Width();
+    const Int numRHS = X.Width();
+    if( m == 0 || k == 0 || numRHS == 0 )
+        return;
+
+    Int numNonzero = 0;
+    for( Int j=0; j<numRHS; ++j )
+        for( Int i=0; i<k; ++i )
+            if( X(i,j) != F(0) )
+                ++numNonzero;
+    const float nonzeroRatio = float(numNonzero)/float(k*numRHS);
+    if( nonzeroRatio >= ctrl.blockingThresh )
+    {
+        Gemm( NORMAL, NORMAL, alpha, A, X, F(1), C );
+        return;
+    }
+
+    const F* ABuf = A.LockedBuffer();
+    const F* XBuf = X.LockedBuffer();
+          F* CBuf = C.Buffer();
+    const Int ALDim = A.LDim();
+    const Int XLDim = X.LDim();
+    const Int CLDim = C.LDim();
+    for( Int j=0; j<numRHS; ++j )
+    {
+        for( Int i=0; i<k; ++i )
+        {
+            const F chi = XBuf[i+j*XLDim];
+            if( chi == F(0) )
+                continue;
+            blas::Axpy
+            ( m, alpha*chi, &ABuf[i*ALDim], 1, &CBuf[j*CLDim], 1 );
+        }
+    }
+}
+
+} // namespace nearest_plane
+
 template<typename F>
 void NearestPlane
 ( const Matrix<F>& B,
@@ -23,70 +74,76 @@ void NearestPlane
   const LLLCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
-    const Int m = B.Height();
     const Int n = B.Width();
     const Int numRHS = T.Width();
 
     // Compute the components of T in the directions of the columns of Q
-    Y = T;
-    Matrix<F> RY( Y );
+    Matrix<F> RY( T );
     qr::ApplyQ( LEFT, ADJOINT, QR, t, d, RY );
 
-    // Run Babai's nearest plane algorithm on each column of Y.
-    // The result is an approximation of the difference between each column
-    // of Y and the nearest lattice point.
+    // Run Babai's nearest plane algorithm on all of the targets at once,
+    // sweeping upwards over blocks of rows of R. The rounding recurrence
+    // within each diagonal block is independent for each target (and is
+    // thus threaded over them), whereas the contributions of the resulting
+    // coordinates to the remaining rows are applied with a single Gemm (or,
+    // if fewer than ctrl.blockingThresh of them are nonzero, with Axpy's).
     // TODO(poulson): Extract this into a separate routine shared with LLL
-    vector<F> xBuf(n);
-    for( Int j=0; j<numRHS; ++j )
+    Matrix<F> X;
+    Zeros( X, n, numRHS );
+    F* RYBuf = RY.Buffer();
+    F* XBuf = X.Buffer();
+    const F* QRBuf = QR.LockedBuffer();
+    const Int RYLDim = RY.LDim();
+    const Int XLDim = X.LDim();
+    const Int QRLDim = QR.LDim();
+    const Int bsize = Blocksize();
+    for( Int iEnd=n; iEnd>0; iEnd-=bsize )
     {
-        F* yBuf = &Y(0,j);
-        F* rYBuf = &RY(0,j);
-
-        Int numNonzero=0;
-        for( Int i=n-1; i>=0; --i )
-        {
-            F chi = rYBuf[i] / QR(i,i);
-            if( Abs(RealPart(chi)) > ctrl.eta ||
-                Abs(ImagPart(chi)) > ctrl.eta )
+        const Int iBeg = Max(iEnd-bsize,0);
+        auto roundBlock = [&]( Int j )
+          {
+            F* rYBuf = &RYBuf[j*RYLDim];
+            F* xBuf = &XBuf[j*XLDim];
+            for( Int i=iEnd-1; i>=iBeg; --i )
             {
-                chi = Round(chi);
-                blas::Axpy
-                ( i+1, -chi,
-                  &QR(0,i), 1,
-                  rYBuf,    1 );
-                ++numNonzero;
+                F chi = rYBuf[i] / QRBuf[i+i*QRLDim];
+                if( Abs(RealPart(chi)) > ctrl.eta ||
+                    Abs(ImagPart(chi)) > ctrl.eta )
+                {
+                    chi = Round(chi);
+                    blas::Axpy
+                    ( i-iBeg+1, -chi,
+                      &QRBuf[iBeg+i*QRLDim], 1,
+                      &rYBuf[iBeg],          1 );
+                    xBuf[i] = chi;
+                }
             }
-            else
-                chi = 0;
-            xBuf[i] = chi;
-        }
-        const float nonzeroRatio = float(numNonzero)/float(n);
-        if( nonzeroRatio >= ctrl.blockingThresh )
+          };
+        // Multiprecision arithmetic is not assumed to be thread-safe
+        if( IsBlasScalar<F>::value )
         {
-            blas::Gemv
-            ( 'N', m, n,
-              F(-1), B.Buffer(), B.LDim(),
-                     &xBuf[0],   1,
-              F(+1), yBuf,       1 );
+            EL_PARALLEL_FOR
+            for( Int j=0; j<numRHS; ++j )
+                roundBlock( j );
         }
         else
         {
-            for( Int i=n-1; i>=0; --i )
-            {
-                const F chi = xBuf[i];
-                if( chi == F(0) )
-                    continue;
-                blas::Axpy
-                ( m, -chi,
-                  &B(0,i), 1,
-                  yBuf,    1 );
-            }
+            for( Int j=0; j<numRHS; ++j )
+                roundBlock( j );
+        }
+
+        if( iBeg > 0 )
+        {
+            auto RY0 = RY( IR(0,iBeg), ALL );
+            auto R01 = QR( IR(0,iBeg), IR(iBeg,iEnd) );
+            auto X1 = X( IR(iBeg,iEnd), ALL );
+            nearest_plane::UpdateWithCoordinates( F(-1), R01, X1, RY0, ctrl );
         }
     }
 
-    // Y := T - Y
-    Y *= -1;
-    Y += T;
+    // Y := B X, the nearest lattice points
+    Zeros( Y, B.Height(), numRHS );
+    nearest_plane::UpdateWithCoordinates( F(1), B, X, Y, ctrl );
 }
 
 template<typename F>
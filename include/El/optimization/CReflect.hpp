@@ -25,12 +25,16 @@ inline ElMehrotraCtrl_s CReflect( const MehrotraCtrl<float>& ctrl )
     ElMehrotraCtrl_s ctrlC;
     ctrlC.primalInit    = ctrl.primalInit;
     ctrlC.dualInit      = ctrl.dualInit;
+    ctrlC.warmStartShift = ctrl.warmStartShift;
+    ctrlC.warmStartMinMu = ctrl.warmStartMinMu;
     ctrlC.minTol        = ctrl.minTol;
     ctrlC.targetTol     = ctrl.targetTol;
     ctrlC.maxIts        = ctrl.maxIts;
     ctrlC.maxStepRatio  = ctrl.maxStepRatio;
     ctrlC.system        = CReflect(ctrl.system);
     ctrlC.mehrotra      = ctrl.mehrotra;
+    ctrlC.maxGondzioCorrs = ctrl.maxGondzioCorrs;
+    ctrlC.adaptiveGondzio = ctrl.adaptiveGondzio;
    
     auto centralityRuleRes =
       ctrl.centralityRule.target<float(*)(float,float,float,float)>();
@@ -44,10 +48,14 @@ inline ElMehrotraCtrl_s CReflect( const MehrotraCtrl<float>& ctrl )
     ctrlC.forceSameStep     = ctrl.forceSameStep;
     ctrlC.solveCtrl         = CReflect(ctrl.solveCtrl);
     ctrlC.resolveReg        = ctrl.resolveReg;
+    ctrlC.lowerPrecisionFactor = ctrl.lowerPrecisionFactor;
     ctrlC.outerEquil        = ctrl.outerEquil;
     ctrlC.basisSize         = ctrl.basisSize;
     ctrlC.print             = ctrl.print;
     ctrlC.time              = ctrl.time;
+    ctrlC.checkpointFile    = ctrl.checkpointFile.c_str();
+    ctrlC.checkpointFreq    = ctrl.checkpointFreq;
+    ctrlC.restart           = ctrl.restart;
     ctrlC.wSafeMaxNorm      = ctrl.wSafeMaxNorm;
     ctrlC.wMaxLimit         = ctrl.wMaxLimit;
     ctrlC.ruizEquilTol      = ctrl.ruizEquilTol;
@@ -69,12 +77,16 @@ inline ElMehrotraCtrl_d CReflect( const MehrotraCtrl<double>& ctrl )
     ElMehrotraCtrl_d ctrlC;
     ctrlC.primalInit    = ctrl.primalInit;
     ctrlC.dualInit      = ctrl.dualInit;
+    ctrlC.warmStartShift = ctrl.warmStartShift;
+    ctrlC.warmStartMinMu = ctrl.warmStartMinMu;
     ctrlC.minTol        = ctrl.minTol;
     ctrlC.targetTol     = ctrl.targetTol;
     ctrlC.maxIts        = ctrl.maxIts;
     ctrlC.maxStepRatio  = ctrl.maxStepRatio;
     ctrlC.system        = CReflect(ctrl.system);
     ctrlC.mehrotra      = ctrl.mehrotra;
+    ctrlC.maxGondzioCorrs = ctrl.maxGondzioCorrs;
+    ctrlC.adaptiveGondzio = ctrl.adaptiveGondzio;
 
     auto centralityRuleRes =
       ctrl.centralityRule.target<double(*)(double,double,double,double)>();
@@ -88,10 +100,14 @@ inline ElMehrotraCtrl_d CReflect( const MehrotraCtrl<double>& ctrl )
     ctrlC.forceSameStep     = ctrl.forceSameStep;
     ctrlC.solveCtrl         = CReflect(ctrl.solveCtrl);
     ctrlC.resolveReg        = ctrl.resolveReg;
+    ctrlC.lowerPrecisionFactor = ctrl.lowerPrecisionFactor;
     ctrlC.outerEquil        = ctrl.outerEquil;
     ctrlC.basisSize         = ctrl.basisSize;
     ctrlC.print             = ctrl.print;
     ctrlC.time              = ctrl.time;
+    ctrlC.checkpointFile    = ctrl.checkpointFile.c_str();
+    ctrlC.checkpointFreq    = ctrl.checkpointFreq;
+    ctrlC.restart           = ctrl.restart;
     ctrlC.wSafeMaxNorm      = ctrl.wSafeMaxNorm;
     ctrlC.wMaxLimit         = ctrl.wMaxLimit;
     ctrlC.ruizEquilTol      = ctrl.ruizEquilTol;
@@ -113,22 +129,31 @@ inline MehrotraCtrl<float> CReflect( const ElMehrotraCtrl_s& ctrlC )
     MehrotraCtrl<float> ctrl;
     ctrl.primalInit        = ctrlC.primalInit;
     ctrl.dualInit          = ctrlC.dualInit;
+    ctrl.warmStartShift    = ctrlC.warmStartShift;
+    ctrl.warmStartMinMu    = ctrlC.warmStartMinMu;
     ctrl.minTol            = ctrlC.minTol;
     ctrl.targetTol         = ctrlC.targetTol;
     ctrl.maxIts            = ctrlC.maxIts;
     ctrl.maxStepRatio      = ctrlC.maxStepRatio;
     ctrl.system            = CReflect(ctrlC.system);
     ctrl.mehrotra          = ctrlC.mehrotra;
+    ctrl.maxGondzioCorrs   = ctrlC.maxGondzioCorrs;
+    ctrl.adaptiveGondzio   = ctrlC.adaptiveGondzio;
     ctrl.centralityRule    = ctrlC.centralityRule;
     ctrl.standardInitShift = ctrlC.standardInitShift;
     ctrl.balanceTol        = ctrlC.balanceTol;
     ctrl.forceSameStep     = ctrlC.forceSameStep;
     ctrl.solveCtrl         = CReflect(ctrlC.solveCtrl);
     ctrl.resolveReg        = ctrlC.resolveReg;
+    ctrl.lowerPrecisionFactor = ctrlC.lowerPrecisionFactor;
     ctrl.outerEquil        = ctrlC.outerEquil;
     ctrl.basisSize         = ctrlC.basisSize;
     ctrl.print             = ctrlC.print;
     ctrl.time              = ctrlC.time;
+    if( ctrlC.checkpointFile != nullptr )
+        ctrl.checkpointFile = ctrlC.checkpointFile;
+    ctrl.checkpointFreq    = ctrlC.checkpointFreq;
+    ctrl.restart           = ctrlC.restart;
     ctrl.wSafeMaxNorm      = ctrlC.wSafeMaxNorm;
     ctrl.wMaxLimit         = ctrlC.wMaxLimit;
     ctrl.ruizEquilTol      = ctrlC.ruizEquilTol;
@@ -150,22 +175,31 @@ inline MehrotraCtrl<double> CReflect( const ElMehrotraCtrl_d& ctrlC )
     MehrotraCtrl<double> ctrl;
     ctrl.primalInit        = ctrlC.primalInit;
     ctrl.dualInit          = ctrlC.dualInit;
+    ctrl.warmStartShift    = ctrlC.warmStartShift;
+    ctrl.warmStartMinMu    = ctrlC.warmStartMinMu;
     ctrl.minTol            = ctrlC.minTol;
     ctrl.targetTol         = ctrlC.targetTol;
     ctrl.maxIts            = ctrlC.maxIts;
     ctrl.maxStepRatio      = ctrlC.maxStepRatio;
     ctrl.system            = CReflect(ctrlC.system);
     ctrl.mehrotra          = ctrlC.mehrotra;
+    ctrl.maxGondzioCorrs   = ctrlC.maxGondzioCorrs;
+    ctrl.adaptiveGondzio   = ctrlC.adaptiveGondzio;
     ctrl.centralityRule    = ctrlC.centralityRule;
     ctrl.standardInitShift = ctrlC.standardInitShift;
     ctrl.balanceTol        = ctrlC.balanceTol;
     ctrl.forceSameStep     = ctrlC.forceSameStep;
     ctrl.solveCtrl         = CReflect(ctrlC.solveCtrl);
     ctrl.resolveReg        = ctrlC.resolveReg;
+    ctrl.lowerPrecisionFactor = ctrlC.lowerPrecisionFactor;
     ctrl.outerEquil        = ctrlC.outerEquil;
     ctrl.basisSize         = ctrlC.basisSize;
     ctrl.print             = ctrlC.print;
     ctrl.time              = ctrlC.time;
+    if( ctrlC.checkpointFile != nullptr )
+        ctrl.checkpointFile = ctrlC.checkpointFile;
+    ctrl.checkpointFreq    = ctrlC.checkpointFreq;
+    ctrl.restart           = ctrlC.restart;
     ctrl.wSafeMaxNorm      = ctrlC.wSafeMaxNorm;
     ctrl.wMaxLimit         = ctrlC.wMaxLimit;
     ctrl.ruizEquilTol      = ctrlC.ruizEquilTol;
@@ -195,6 +229,10 @@ inline ElADMMCtrl_s CReflect( const ADMMCtrl<float>& ctrl )
     ctrlC.relTol  = ctrl.relTol;
     ctrlC.inv     = ctrl.inv;
     ctrlC.print   = ctrl.print;
+    ctrlC.adaptiveRho    = ctrl.adaptiveRho;
+    ctrlC.rhoBalance     = ctrl.rhoBalance;
+    ctrlC.rhoScale       = ctrl.rhoScale;
+    ctrlC.checkFrequency = ctrl.checkFrequency;
     return ctrlC;
 }
 inline ElADMMCtrl_d CReflect( const ADMMCtrl<double>& ctrl )
@@ -207,6 +245,10 @@ inline ElADMMCtrl_d CReflect( const ADMMCtrl<double>& ctrl )
     ctrlC.relTol  = ctrl.relTol;
     ctrlC.inv     = ctrl.inv;
     ctrlC.print   = ctrl.print;
+    ctrlC.adaptiveRho    = ctrl.adaptiveRho;
+    ctrlC.rhoBalance     = ctrl.rhoBalance;
+    ctrlC.rhoScale       = ctrl.rhoScale;
+    ctrlC.checkFrequency = ctrl.checkFrequency;
     return ctrlC;
 }
 inline ADMMCtrl<float> CReflect( const ElADMMCtrl_s& ctrlC )
@@ -219,6 +261,10 @@ inline ADMMCtrl<float> CReflect( const ElADMMCtrl_s& ctrlC )
     ctrl.relTol  = ctrlC.relTol;
     ctrl.inv     = ctrlC.inv;
     ctrl.print   = ctrlC.print;
+    ctrl.adaptiveRho    = ctrlC.adaptiveRho;
+    ctrl.rhoBalance     = ctrlC.rhoBalance;
+    ctrl.rhoScale       = ctrlC.rhoScale;
+    ctrl.checkFrequency = ctrlC.checkFrequency;
     return ctrl;
 }
 inline ADMMCtrl<double> CReflect( const ElADMMCtrl_d& ctrlC )
@@ -231,6 +277,10 @@ inline ADMMCtrl<double> CReflect( const ElADMMCtrl_d& ctrlC )
     ctrl.relTol  = ctrlC.relTol;
     ctrl.inv     = ctrlC.inv;
     ctrl.print   = ctrlC.print;
+    ctrl.adaptiveRho    = ctrlC.adaptiveRho;
+    ctrl.rhoBalance     = ctrlC.rhoBalance;
+    ctrl.rhoScale       = ctrlC.rhoScale;
+    ctrl.checkFrequency = ctrlC.checkFrequency;
     return ctrl;
 }
 
@@ -283,6 +333,7 @@ inline ElLPAffineCtrl_s CReflect( const lp::affine::Ctrl<float>& ctrl )
     ElLPAffineCtrl_s ctrlC;
     ctrlC.approach     = CReflect(ctrl.approach);
     ctrlC.mehrotraCtrl = CReflect(ctrl.mehrotraCtrl);
+    ctrlC.presolve     = ctrl.presolve;
     return ctrlC;
 }
 inline ElLPAffineCtrl_d CReflect( const lp::affine::Ctrl<double>& ctrl )
@@ -290,6 +341,7 @@ inline ElLPAffineCtrl_d CReflect( const lp::affine::Ctrl<double>& ctrl )
     ElLPAffineCtrl_d ctrlC;
     ctrlC.approach     = CReflect(ctrl.approach);
     ctrlC.mehrotraCtrl = CReflect(ctrl.mehrotraCtrl);
+    ctrlC.presolve     = ctrl.presolve;
     return ctrlC;
 }
 inline lp::affine::Ctrl<float> CReflect( const ElLPAffineCtrl_s& ctrlC )
@@ -297,6 +349,7 @@ inline lp::affine::Ctrl<float> CReflect( const ElLPAffineCtrl_s& ctrlC )
     lp::affine::Ctrl<float> ctrl;
     ctrl.approach     = CReflect(ctrlC.approach);
     ctrl.mehrotraCtrl = CReflect(ctrlC.mehrotraCtrl);
+    ctrl.presolve     = ctrlC.presolve;
     return ctrl;
 }
 inline lp::affine::Ctrl<double> CReflect( const ElLPAffineCtrl_d& ctrlC )
@@ -304,6 +357,7 @@ inline lp::affine::Ctrl<double> CReflect( const ElLPAffineCtrl_d& ctrlC )
     lp::affine::Ctrl<double> ctrl;
     ctrl.approach     = CReflect(ctrlC.approach);
     ctrl.mehrotraCtrl = CReflect(ctrlC.mehrotraCtrl);
+    ctrl.presolve     = ctrlC.presolve;
     return ctrl;
 }
 
@@ -592,6 +646,10 @@ inline ElBPDNADMMCtrl_s CReflect( const bpdn::ADMMCtrl<float>& ctrl )
     ctrlC.relTol   = ctrl.relTol;
     ctrlC.inv      = ctrl.inv;
     ctrlC.progress = ctrl.progress;
+    ctrlC.adaptiveRho    = ctrl.adaptiveRho;
+    ctrlC.rhoBalance     = ctrl.rhoBalance;
+    ctrlC.rhoScale       = ctrl.rhoScale;
+    ctrlC.checkFrequency = ctrl.checkFrequency;
     return ctrlC;
 }
 
@@ -605,6 +663,10 @@ inline ElBPDNADMMCtrl_d CReflect( const bpdn::ADMMCtrl<double>& ctrl )
     ctrlC.relTol   = ctrl.relTol;
     ctrlC.inv      = ctrl.inv;
     ctrlC.progress = ctrl.progress;
+    ctrlC.adaptiveRho    = ctrl.adaptiveRho;
+    ctrlC.rhoBalance     = ctrl.rhoBalance;
+    ctrlC.rhoScale       = ctrl.rhoScale;
+    ctrlC.checkFrequency = ctrl.checkFrequency;
     return ctrlC;
 }
 
@@ -618,6 +680,10 @@ inline bpdn::ADMMCtrl<float> CReflect( const ElBPDNADMMCtrl_s& ctrlC )
     ctrl.relTol   = ctrlC.relTol;
     ctrl.inv      = ctrlC.inv;
     ctrl.progress = ctrlC.progress;
+    ctrl.adaptiveRho    = ctrlC.adaptiveRho;
+    ctrl.rhoBalance     = ctrlC.rhoBalance;
+    ctrl.rhoScale       = ctrlC.rhoScale;
+    ctrl.checkFrequency = ctrlC.checkFrequency;
     return ctrl;
 }
 
@@ -631,6 +697,10 @@ inline bpdn::ADMMCtrl<double> CReflect( const ElBPDNADMMCtrl_d& ctrlC )
     ctrl.relTol   = ctrlC.relTol;
     ctrl.inv      = ctrlC.inv;
     ctrl.progress = ctrlC.progress;
+    ctrl.adaptiveRho    = ctrlC.adaptiveRho;
+    ctrl.rhoBalance     = ctrlC.rhoBalance;
+    ctrl.rhoScale       = ctrlC.rhoScale;
+    ctrl.checkFrequency = ctrlC.checkFrequency;
     return ctrl;
 }
 
@@ -720,11 +790,18 @@ inline NNLSCtrl<double> CReflect( const ElNNLSCtrl_d& ctrlC )
 
 // Non-negative Matrix Factorization
 // ^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^^
+inline NMFApproach CReflect( ElNMFApproach approach )
+{ return static_cast<NMFApproach>(approach); }
+inline ElNMFApproach CReflect( NMFApproach approach )
+{ return static_cast<ElNMFApproach>(approach); }
+
 inline ElNMFCtrl_s CReflect( const NMFCtrl<float>& ctrl )
 {
     ElNMFCtrl_s ctrlC;
     ctrlC.nnlsCtrl = CReflect(ctrl.nnlsCtrl);
     ctrlC.maxIter = ctrl.maxIter;
+    ctrlC.approach = CReflect(ctrl.approach);
+    ctrlC.numInnerIts = ctrl.numInnerIts;
     return ctrlC;
 }
 
@@ -733,6 +810,8 @@ inline ElNMFCtrl_d CReflect( const NMFCtrl<double>& ctrl )
     ElNMFCtrl_d ctrlC;
     ctrlC.nnlsCtrl = CReflect(ctrl.nnlsCtrl);
     ctrlC.maxIter = ctrl.maxIter;
+    ctrlC.approach = CReflect(ctrl.approach);
+    ctrlC.numInnerIts = ctrl.numInnerIts;
     return ctrlC;
 }
 
@@ -741,6 +820,8 @@ inline NMFCtrl<float> CReflect( const ElNMFCtrl_s& ctrlC )
     NMFCtrl<float> ctrl;
     ctrl.nnlsCtrl = CReflect(ctrlC.nnlsCtrl);
     ctrl.maxIter = ctrlC.maxIter;
+    ctrl.approach = CReflect(ctrlC.approach);
+    ctrl.numInnerIts = ctrlC.numInnerIts;
     return ctrl;
 }
 
@@ -749,6 +830,8 @@ inline NMFCtrl<double> CReflect( const ElNMFCtrl_d& ctrlC )
     NMFCtrl<double> ctrl;
     ctrl.nnlsCtrl = CReflect(ctrlC.nnlsCtrl);
     ctrl.maxIter = ctrlC.maxIter;
+    ctrl.approach = CReflect(ctrlC.approach);
+    ctrl.numInnerIts = ctrlC.numInnerIts;
     return ctrl;
 }
 
@@ -767,6 +850,9 @@ inline ElRPCACtrl_s CReflect( const RPCACtrl<float>& ctrl )
     ctrlC.beta        = ctrl.beta;
     ctrlC.rho         = ctrl.rho;
     ctrlC.tol         = ctrl.tol;
+    ctrlC.randomizedSVT   = ctrl.randomizedSVT;
+    ctrlC.svtRankPad      = ctrl.svtRankPad;
+    ctrlC.svtMaxRankRatio = ctrl.svtMaxRankRatio;
     return ctrlC;
 }
 
@@ -782,6 +868,9 @@ inline ElRPCACtrl_d CReflect( const RPCACtrl<double>& ctrl )
     ctrlC.beta        = ctrl.beta;
     ctrlC.rho         = ctrl.rho;
     ctrlC.tol         = ctrl.tol;
+    ctrlC.randomizedSVT   = ctrl.randomizedSVT;
+    ctrlC.svtRankPad      = ctrl.svtRankPad;
+    ctrlC.svtMaxRankRatio = ctrl.svtMaxRankRatio;
     return ctrlC;
 }
 
@@ -797,6 +886,9 @@ inline RPCACtrl<float> CReflect( const ElRPCACtrl_s& ctrlC )
     ctrl.beta        = ctrlC.beta;
     ctrl.rho         = ctrlC.rho;
     ctrl.tol         = ctrlC.tol;
+    ctrl.randomizedSVT   = ctrlC.randomizedSVT;
+    ctrl.svtRankPad      = ctrlC.svtRankPad;
+    ctrl.svtMaxRankRatio = ctrlC.svtMaxRankRatio;
     return ctrl;
 }
 
@@ -812,6 +904,9 @@ inline RPCACtrl<double> CReflect( const ElRPCACtrl_d& ctrlC )
     ctrl.beta        = ctrlC.beta;
     ctrl.rho         = ctrlC.rho;
     ctrl.tol         = ctrlC.tol;
+    ctrl.randomizedSVT   = ctrlC.randomizedSVT;
+    ctrl.svtRankPad      = ctrlC.svtRankPad;
+    ctrl.svtMaxRankRatio = ctrlC.svtMaxRankRatio;
     return ctrl;
 }
 
@@ -645,14 +645,24 @@ EL_EXPORT ElError ElNMFDist_d
   ElDistMatrix_d Y );
 
 /* Expert versions */
+typedef enum {
+  EL_NMF_NNLS,
+  EL_NMF_HALS,
+  EL_NMF_BPP
+} ElNMFApproach;
+
 typedef struct {
   ElNNLSCtrl_s nnlsCtrl;
   ElInt maxIter;
+  ElNMFApproach approach;
+  ElInt numInnerIts;
 } ElNMFCtrl_s;
 
 typedef struct {
   ElNNLSCtrl_d nnlsCtrl;
   ElInt maxIter;
+  ElNMFApproach approach;
+  ElInt numInnerIts;
 } ElNMFCtrl_d;
 
 EL_EXPORT ElError ElNMFCtrlDefault_s( ElNMFCtrl_s* ctrl );
@@ -736,6 +746,10 @@ typedef struct {
   float relTol;
   bool inv;
   bool progress;
+  bool adaptiveRho;
+  float rhoBalance;
+  float rhoScale;
+  ElInt checkFrequency;
 } ElBPDNADMMCtrl_s;
 
 typedef struct {
@@ -746,6 +760,10 @@ typedef struct {
   double relTol;
   bool inv;
   bool progress;
+  bool adaptiveRho;
+  double rhoBalance;
+  double rhoScale;
+  ElInt checkFrequency;
 } ElBPDNADMMCtrl_d;
 
 EL_EXPORT ElError ElBPDNADMMCtrlDefault_s( ElBPDNADMMCtrl_s* ctrl );
@@ -923,6 +941,9 @@ typedef struct {
   float beta;
   float rho;
   float tol;
+  bool randomizedSVT;
+  ElInt svtRankPad;
+  float svtMaxRankRatio;
 } ElRPCACtrl_s;
 
 typedef struct {
@@ -935,6 +956,9 @@ typedef struct {
   double beta;
   double rho;
   double tol;
+  bool randomizedSVT;
+  ElInt svtRankPad;
+  double svtMaxRankRatio;
 } ElRPCACtrl_d;
 
 EL_EXPORT ElError ElRPCACtrlDefault_s( ElRPCACtrl_s* ctrl );
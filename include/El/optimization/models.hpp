@@ -350,10 +350,34 @@ void RNNLS
 
 // Non-negative matrix factorization
 // =================================
+// Each iteration alternates between the two nonnegative least squares problems
+// for Y and X in A ~= X Y^T. Both fast approaches only require the Gram matrix
+// of the fixed factor and its product with A (or A^T), which are formed once
+// per half-iteration with Herk and Gemm:
+//
+//  * NMF_HALS: Hierarchical Alternating Least Squares, i.e., (block)
+//    coordinate descent over the columns of the updated factor, which is
+//    repeated 'numInnerIts' times with the cached products.
+//
+//  * NMF_BPP: Alternating Nonnegative Least Squares via the Block Principal
+//    Pivoting of Kim and Park, where the columns sharing a passive set are
+//    solved together with a single Cholesky factorization.
+//
+namespace NMFApproachNS {
+enum NMFApproach {
+    NMF_NNLS,
+    NMF_HALS,
+    NMF_BPP
+};
+} // namespace NMFApproachNS
+using namespace NMFApproachNS;
+
 template<typename Real>
 struct NMFCtrl {
   NNLSCtrl<Real> nnlsCtrl;
   Int maxIter=20;
+  NMFApproach approach=NMF_NNLS;
+  Int numInnerIts=1;
 };
 
 template<typename Real>
@@ -387,6 +411,11 @@ struct ADMMCtrl {
   Real relTol=Real(1e-4);
   bool inv=true;
   bool progress=true;
+  // See the analogous members of ADMMCtrl
+  bool adaptiveRho=false;
+  Real rhoBalance=Real(10);
+  Real rhoScale=Real(2);
+  Int checkFrequency=1;
 };
 
 } // namespace bpdn
@@ -479,6 +508,15 @@ struct RPCACtrl
     Int numPivSteps=75;
     Int maxIts=1000;
 
+    // Unless 'usePivQR' is set, threshold the singular values of the
+    // low-rank iterate using a randomized partial SVD, whose rank is
+    // predicted to be that of the previous iterate plus 'svtRankPad',
+    // whenever the prediction is at most 'svtMaxRankRatio' times the smaller
+    // dimension. Otherwise, a full SVD is used.
+    bool randomizedSVT=true;
+    Int svtRankPad=10;
+    Real svtMaxRankRatio=Real(0.1);
+
     Real tau=Real(0);
     Real beta=Real(1);
     Real rho=Real(6);
@@ -525,6 +563,35 @@ Int SparseInvCov
         AbstractDistMatrix<Field>& Z,
   const SparseInvCovCtrl<Base<Field>>& ctrl=SparseInvCovCtrl<Base<Field>>() );
 
+// The above ADMM requires a dense Hermitian eigensolver in every iteration.
+// The following instead applies the second-order QUIC method of Hsieh et al.,
+// which only modifies the entries of the (sparse) iterate X within a free set
+// and only requires sparse Cholesky factorizations of X, i.e.,
+//
+//   min -log det X + Tr(S X) + lambda || X ||_1.
+//
+// Each Newton direction is found by coordinate descent over the free set
+// and is followed by an Armijo backtracking line search over positive-
+// definite iterates.
+template<typename Real>
+struct SparseInvCovQUICCtrl
+{
+    Int maxIter=100;
+    // Stop once the minimum-norm subgradient is at most tol || X ||_1
+    Real tol=Real(1e-6);
+    Real sufficientDecrease=Real(1e-3);
+    Real backtrackRatio=Real(0.5);
+    Int maxBacktracks=30;
+    bool progress=false;
+};
+
+template<typename Real>
+Int SparseInvCov
+( const Matrix<Real>& D,
+        Real lambda,
+        SparseMatrix<Real>& X,
+  const SparseInvCovQUICCtrl<Real>& ctrl=SparseInvCovQUICCtrl<Real>() );
+
 // Support Vector Machine (soft-margin)
 // ====================================
 // TODO(poulson): Use the formulation described in
@@ -576,6 +643,65 @@ void SVM
         DistMultiVec<Real>& x,
   const SVMCtrl<Real>& ctrl=SVMCtrl<Real>() );
 
+// Streaming (out-of-core) SVM
+// ---------------------------
+// The training examples are split into 'numBlocks' blocks of rows of A (and
+// the corresponding labels, d), which are read in order, once per pass, by
+// 'loadBlock'. Consensus ADMM is applied over the blocks so that only two
+// blocks need to be held in memory at a time, and the proximal subproblem of
+// each block is solved with the (sparse) QP Interior Point Method.
+//
+// The blocks are distributed round-robin over the processes of 'comm', and,
+// when OpenMP is available, the next block is read while the current one is
+// solved. The output, x, is set to the consensus value of [w; beta].
+
+template<typename Real>
+using SVMBlockLoader =
+  function<void(Int block,SparseMatrix<Real>& A,Matrix<Real>& d)>;
+
+// Read block b of the features from BuildString(featurePrefix,b,extension)
+// and of the labels from BuildString(labelPrefix,b,extension)
+template<typename Real>
+SVMBlockLoader<Real> SVMBlockFiles
+( const string& featurePrefix,
+  const string& labelPrefix,
+  const string& extension=".mtx" );
+
+template<typename Real>
+struct StreamingSVMCtrl
+{
+    // The penalty parameter and the stopping criteria of the consensus ADMM
+    Real rho=Real(1);
+    Int maxPasses=100;
+    Real absTol=Real(1e-6);
+    Real relTol=Real(1e-4);
+
+    // Read the next block while solving the current one (requires OpenMP)
+    bool prefetch=true;
+
+    // If nonempty, the consensus iterate and the scaled dual variables of the
+    // blocks of each process are written to the file
+    // BuildString(checkpoint,"_",rank,".bin") after every pass, and, if such
+    // a file exists on entry, the iteration resumes from it.
+    string checkpoint;
+
+    bool progress=false;
+
+    // The controls for the Interior Point Method applied to each block
+    qp::affine::Ctrl<Real> ipmCtrl;
+};
+
+// Returns the number of passes over the data
+template<typename Real>
+Int StreamingSVM
+( Int numFeatures,
+  Int numBlocks,
+  const SVMBlockLoader<Real>& loadBlock,
+        Real lambda,
+        Matrix<Real>& x,
+  const StreamingSVMCtrl<Real>& ctrl=StreamingSVMCtrl<Real>(),
+        mpi::Comm comm=mpi::COMM_SELF );
+
 // 1D total variation denoising (TV):
 //
 //   min (1/2) || b - x ||_2^2 + lambda || D x ||_1,
@@ -158,6 +158,24 @@ Int TSQR
   const Base<Field>& rho,
   bool relative=false );
 
+// Threshold using a randomized partial SVD whose initial rank, 'rank', is
+// typically predicted from a previous threshold of a nearby matrix; the rank
+// is doubled until every surviving singular value has been found.
+template<typename Field>
+Int Randomized
+( Matrix<Field>& A,
+  const Base<Field>& rho,
+  Int rank,
+  bool relative=false,
+  const RandomizedRangeCtrl& ctrl=RandomizedRangeCtrl() );
+template<typename Field>
+Int Randomized
+( AbstractDistMatrix<Field>& A,
+  const Base<Field>& rho,
+  Int rank,
+  bool relative=false,
+  const RandomizedRangeCtrl& ctrl=RandomizedRangeCtrl() );
+
 } // namespace svt
 
 // Soft-thresholding
@@ -24,22 +24,30 @@ typedef enum {
 /* See the C++ structure for documentation of the members */
 typedef struct {
   bool primalInit, dualInit;
+  bool warmStartShift;
+  float warmStartMinMu;
   float minTol;
   float targetTol;
   ElInt maxIts;
   float maxStepRatio;
   ElKKTSystem system;
   bool mehrotra;
+  ElInt maxGondzioCorrs;
+  bool adaptiveGondzio;
   float (*centralityRule)(float,float,float,float);
   bool standardInitShift;
   float balanceTol;
   bool forceSameStep;
   ElRegSolveCtrl_s solveCtrl;
   bool resolveReg;
+  bool lowerPrecisionFactor;
   bool outerEquil;
   ElInt basisSize;
   bool print;
   bool time;
+  const char* checkpointFile;
+  ElInt checkpointFreq;
+  bool restart;
   float wSafeMaxNorm;
   float wMaxLimit;
   float ruizEquilTol;
@@ -57,22 +65,30 @@ typedef struct {
 
 typedef struct {
   bool primalInit, dualInit;
+  bool warmStartShift;
+  double warmStartMinMu;
   double minTol;
   double targetTol;
   ElInt maxIts;
   double maxStepRatio;
   ElKKTSystem system;
   bool mehrotra;
+  ElInt maxGondzioCorrs;
+  bool adaptiveGondzio;
   double (*centralityRule)(double,double,double,double);
   bool standardInitShift;
   double balanceTol;
   bool forceSameStep;
   ElRegSolveCtrl_d solveCtrl;
   bool resolveReg;
+  bool lowerPrecisionFactor;
   bool outerEquil;
   ElInt basisSize;
   bool print;
   bool time;
+  const char* checkpointFile;
+  ElInt checkpointFreq;
+  bool restart;
   double wSafeMaxNorm;
   double wMaxLimit;
   double ruizEquilTol;
@@ -101,6 +117,10 @@ typedef struct {
   float relTol;
   bool inv;
   bool print;
+  bool adaptiveRho;
+  float rhoBalance;
+  float rhoScale;
+  ElInt checkFrequency;
 } ElADMMCtrl_s;
 
 typedef struct {
@@ -111,6 +131,10 @@ typedef struct {
   double relTol;
   bool inv;
   bool print;
+  bool adaptiveRho;
+  double rhoBalance;
+  double rhoScale;
+  ElInt checkFrequency;
 } ElADMMCtrl_d;
 
 EL_EXPORT ElError ElADMMCtrlDefault_s( ElADMMCtrl_s* ctrl );
@@ -362,10 +386,12 @@ EL_EXPORT ElError ElLPAffineDistSparse_d
 typedef struct {
   ElLPApproach approach; 
   ElMehrotraCtrl_s mehrotraCtrl;
+  bool presolve;
 } ElLPAffineCtrl_s;
 typedef struct {
   ElLPApproach approach; 
   ElMehrotraCtrl_d mehrotraCtrl;
+  bool presolve;
 } ElLPAffineCtrl_d;
 
 EL_EXPORT ElError ElLPAffineCtrlDefault_s( ElLPAffineCtrl_s* ctrl );
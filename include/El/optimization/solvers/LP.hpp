@@ -67,6 +67,10 @@ struct Ctrl
 {
     LPApproach approach=LP_MEHROTRA;
     MehrotraCtrl<Real> mehrotraCtrl;
+
+    // Whether the sparse solvers should first apply lp::affine::Presolve and
+    // recover the solution of the original problem via lp::affine::Postsolve
+    bool presolve=false;
 };
 
 } // namespace affine
@@ -578,11 +582,110 @@ void LP
         DistMultiVec<Real>& s,
   const lp::affine::Ctrl<Real>& ctrl=lp::affine::Ctrl<Real>() );
 
+// Batches of independent affine LPs
+// ---------------------------------
+// The models are stored redundantly on every process of 'comm' and are each
+// solved by a single process using the shared control structure. They are
+// balanced over the processes by their estimated costs (and dynamically
+// assigned by a dispatching process when there are at least four processes),
+// and every solution is returned on every process.
+template<typename Real>
+void LP
+( const vector<AffineLPProblem<Matrix<Real>,Matrix<Real>>>& problems,
+        vector<AffineLPSolution<Matrix<Real>>>& solutions,
+  const lp::affine::Ctrl<Real>& ctrl=lp::affine::Ctrl<Real>(),
+  mpi::Comm comm=mpi::COMM_WORLD );
+template<typename Real>
+void LP
+( const vector<AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>>& problems,
+        vector<AffineLPSolution<Matrix<Real>>>& solutions,
+  const lp::affine::Ctrl<Real>& ctrl=lp::affine::Ctrl<Real>(),
+  mpi::Comm comm=mpi::COMM_WORLD );
+
+namespace lp {
+namespace affine {
+
+// Presolve
+// --------
+
+// A variable which was fixed during the presolve, along with the constraints
+// which were removed with it (and their coefficients for said variable)
+template<typename Real>
+struct PresolveFixing
+{
+    Int variable;
+    Real value;
+
+    // The singleton equality which determined the variable (if any)
+    Int equality=-1;
+    Real equalityCoef=Real(0);
+
+    // The coinciding lower and upper bounds which determined the variable
+    // (if any)
+    Int lowerInequality=-1, upperInequality=-1;
+    Real lowerCoef=Real(0), upperCoef=Real(0);
+};
+
+// The information needed to recover the solution of the original problem from
+// that of the presolved problem
+template<typename Real>
+struct PresolveInfo
+{
+    // The original indices of the members of the reduced problem
+    vector<Int> keptVariables;
+    vector<Int> keptEqualities;
+    vector<Int> keptInequalities;
+
+    // The fixed variables, in the order in which they were fixed
+    vector<PresolveFixing<Real>> fixings;
+
+    // A copy of the original problem (only stored on the root process in the
+    // distributed case)
+    AffineLPProblem<SparseMatrix<Real>,Matrix<Real>> original;
+};
+
+// Remove empty constraints, fix the variables determined by singleton
+// equalities or coinciding bounds, drop dominated bounds and parallel
+// constraints, and eliminate variables which no longer appear in any
+// constraint. A RuntimeError is thrown if the problem is detected to be
+// infeasible (or unbounded).
+template<typename Real>
+void Presolve
+( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& reducedProblem,
+        PresolveInfo<Real>& info,
+  bool progress=false );
+template<typename Real>
+void Presolve
+( const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>&
+          reducedProblem,
+        PresolveInfo<Real>& info,
+  bool progress=false );
+
+// Expand a (primal-dual) solution of the presolved problem into one of the
+// original problem
+template<typename Real>
+void Postsolve
+( const PresolveInfo<Real>& info,
+  const AffineLPSolution<Matrix<Real>>& reducedSolution,
+        AffineLPSolution<Matrix<Real>>& solution );
+template<typename Real>
+void Postsolve
+( const PresolveInfo<Real>& info,
+  const AffineLPSolution<DistMultiVec<Real>>& reducedSolution,
+        AffineLPSolution<DistMultiVec<Real>>& solution );
+
+} // namespace affine
+} // namespace lp
+
 // Mathematical Programming System
 // -------------------------------
 
 // Load an affine conic form LP stored in the Mathematical Programming System
-// (MPS) format.
+// (MPS) format. The file is only read from disk by the root process of a
+// distributed problem, and, in the sparse case, the parsing of its COLUMNS
+// section is split over the processes.
 template<class MatrixType,class VectorType>
 void ReadMPS
 ( AffineLPProblem<MatrixType,VectorType>& problem,
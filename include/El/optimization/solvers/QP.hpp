@@ -96,6 +96,31 @@ Int ADMM
         AbstractDistMatrix<Real>& X,
   const ADMMCtrl<Real>& ctrl=ADMMCtrl<Real>() );
 
+// The same, but with the factorization of Q + rho I kept by 'solver' so that
+// it may be reused by subsequent calls with the same Q (e.g., for different
+// C or bounds). The solver is initialized from Q and 'ctrl.rho' if it has not
+// yet been; otherwise, its current (possibly adapted) value of rho is used.
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Int ADMM
+( const Matrix<Real>& Q,
+        ShiftedHermitianSolver<Real>& solver,
+  const Matrix<Real>& C,
+        Real lb,
+        Real ub,
+        Matrix<Real>& X,
+  const ADMMCtrl<Real>& ctrl=ADMMCtrl<Real>() );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Int ADMM
+( const AbstractDistMatrix<Real>& Q,
+        DistShiftedHermitianSolver<Real>& solver,
+  const AbstractDistMatrix<Real>& C,
+        Real lb,
+        Real ub,
+        AbstractDistMatrix<Real>& X,
+  const ADMMCtrl<Real>& ctrl=ADMMCtrl<Real>() );
+
 } // namespace box
 
 } // namespace qp
@@ -198,6 +223,41 @@ void QP
         DistMultiVec<Real>& s,
   const qp::affine::Ctrl<Real>& ctrl=qp::affine::Ctrl<Real>() );
 
+// Batches of independent affine QPs
+// ---------------------------------
+template<typename MatrixType,typename VectorType>
+struct AffineQPProblem
+{
+    // The objective is '(1/2) x^T Q x + c^T x'.
+    MatrixType Q;
+    VectorType c;
+
+    // The primal equality constraint is 'A x = b'.
+    MatrixType A;
+    VectorType b;
+
+    // The primal cone constraint is 'G x + s = h, s >= 0'.
+    MatrixType G;
+    VectorType h;
+};
+
+// The solutions have the same form as those of affine LPs. As with batches of
+// LPs, the models are stored redundantly on every process of 'comm' and are
+// each solved by a single process using the shared control structure, and
+// every solution is returned on every process.
+template<typename Real>
+void QP
+( const vector<AffineQPProblem<Matrix<Real>,Matrix<Real>>>& problems,
+        vector<AffineLPSolution<Matrix<Real>>>& solutions,
+  const qp::affine::Ctrl<Real>& ctrl=qp::affine::Ctrl<Real>(),
+  mpi::Comm comm=mpi::COMM_WORLD );
+template<typename Real>
+void QP
+( const vector<AffineQPProblem<SparseMatrix<Real>,Matrix<Real>>>& problems,
+        vector<AffineLPSolution<Matrix<Real>>>& solutions,
+  const qp::affine::Ctrl<Real>& ctrl=qp::affine::Ctrl<Real>(),
+  mpi::Comm comm=mpi::COMM_WORLD );
+
 } // namespace El
 
 #endif // ifndef EL_OPTIMIZATION_SOLVERS_QP_HPP
@@ -32,6 +32,62 @@ inline Real MehrotraCentrality
 ( Real mu, Real muAff, Real alphaAffPri, Real alphaAffDual )
 { return Min(Pow(muAff/mu,Real(3)),Real(1)); }
 
+// A record of a single iteration of one of the sparse Interior Point Methods,
+// which is handed to 'MehrotraCtrl::iterationCallback' (on every process)
+// at the end of each iteration, including the final (converged) one, for
+// which only the convergence measures and the iteration time are set.
+template<typename Real>
+struct MehrotraIterationInfo
+{
+    Int numIts=0;
+
+    // The barrier parameter and the maximum of the relative residuals and
+    // the relative duality gap
+    Real mu=0;
+    Real relError=0;
+
+    // The max norm of the Nesterov-Todd scaling point, which determines
+    // whether the KKT system is Ruiz, diagonally, or not equilibrated
+    Real wMaxNorm=0;
+
+    // The (global) size of the KKT system, the number of nonzeros of its
+    // (unregularized) sparse form, and the number of nonzeros in its sparse
+    // LDL factorization
+    Int kktHeight=0;
+    Int kktNumEntries=0;
+    Int factorNumEntries=0;
+
+    // The largest temporary regularization added to the diagonal of the KKT
+    // system before its factorization
+    Real maxRegTmp=0;
+
+    // The number of solves against the factorization and the total number of
+    // iterations of the iterative solvers which removed the regularization
+    Int numSolves=0;
+    Int numRefineIts=0;
+
+    // The step lengths of the affine (predictor) direction, the centrality
+    // parameter, and the step lengths of the combined direction
+    Real alphaAffPri=0, alphaAffDual=0;
+    Real sigma=0;
+    Real alphaPri=0, alphaDual=0;
+
+    // The number of centrality correctors which were accepted
+    Int numCorrectors=0;
+
+    // The time (in seconds, as measured on this process) spent forming the
+    // KKT system, in its factorization, in all of the solves, and in the
+    // entire iteration
+    double kktTime=0, factorTime=0, solveTime=0, iterationTime=0;
+};
+
+// Return an iteration callback which writes each record as a line of
+// comma-separated values (after a header line) to the file 'filename' from
+// the root process of 'comm'.
+template<typename Real>
+function<void(const MehrotraIterationInfo<Real>&)>
+MehrotraIterationLog( const string& filename, mpi::Comm comm=mpi::COMM_SELF );
+
 template<typename Real>
 struct MehrotraCtrl
 {
@@ -43,10 +99,19 @@ struct MehrotraCtrl
     // 'affine' cone constraints, i.e., (h - G x) in K, the primal variables are
     // 'x' and 's', while the dual variables are again 'y' and 'z'.
     //
-    // NOTE: User initialization has not yet been tested, so there might be a
-    //       trivial bug.
+    // If both are user-initialized (e.g., from the solution of a nearby
+    // problem), see 'warmStartShift'.
     bool primalInit=false, dualInit=false;
 
+    // When both the primal and dual variables were user-initialized, shift
+    // the cone variables into a neighborhood of the central path before the
+    // first iteration. The solution of a previous problem lies on the
+    // boundary of the cone and would otherwise force the IPM to take a long
+    // sequence of tiny steps. The barrier parameter of the shifted point is
+    // at least 'warmStartMinMu' (relative to the equilibrated problem).
+    bool warmStartShift=true;
+    Real warmStartMinMu=Pow(limits::Epsilon<Real>(),Real(0.25));
+
     // Throw an exception if this tolerance could not be achieved.
     Real minTol=Pow(limits::Epsilon<Real>(),Real(0.3));
 
@@ -73,9 +138,20 @@ struct MehrotraCtrl
     KKTSystem system=FULL_KKT;
 
     // Use Mehrotra's second-order corrector?
-    // TODO(poulson): Add support for Gondzio's correctors
     bool mehrotra=true;
 
+    // The maximum number of Gondzio's multiple centrality correctors to
+    // apply after each predictor-corrector step (zero disables them). Each
+    // corrector costs a single solve against the existing factorization and
+    // is only kept if it lengthens the step sufficiently.
+    Int maxGondzioCorrs=0;
+
+    // Whether the number of centrality correctors should instead be chosen
+    // (up to 'maxGondzioCorrs') from the measured ratio of the factorization
+    // time to the time of a single solve, so that more correctors are only
+    // attempted when the factorization is comparatively expensive.
+    bool adaptiveGondzio=true;
+
     // For determining the ratio of the amount to balance the affine and 
     // correction updates. The other common option is 'MehrotraCentrality'.
     function<Real(Real,Real,Real,Real)>
@@ -101,6 +177,16 @@ struct MehrotraCtrl
     // both the cost and number of iterations.
     bool resolveReg=true;
 
+    // Factor the KKT systems of the sparse IPMs in the next lower precision
+    // (e.g., single-precision for a double-precision problem) and rely upon
+    // the iterative solver, which runs in the working precision, to remove
+    // the resulting error in addition to that of the regularization. This
+    // roughly halves the memory and time of the factorizations, but may
+    // increase the number of refinement iterations near convergence. It is
+    // ignored by types without a lower precision and is currently only
+    // supported by the sparse affine LP IPMs.
+    bool lowerPrecisionFactor=false;
+
     // Wrap the Interior Point Method with an equilibration.
     // This should almost always be set to true.
     bool outerEquil=true;
@@ -115,6 +201,24 @@ struct MehrotraCtrl
     // Time the components of the Interior Point Method?
     bool time=false;
 
+    // If set, the sparse Interior Point Methods pass a record of each
+    // iteration (see 'MehrotraIterationInfo' and 'MehrotraIterationLog') to
+    // this function on every process. Gathering the statistics of the
+    // distributed factorizations requires a few additional reductions.
+    function<void(const MehrotraIterationInfo<Real>&)> iterationCallback;
+
+    // If 'checkpointFreq' is positive, the distributed sparse direct LP IPM
+    // collectively writes its (equilibrated) iterate to the file
+    // 'checkpointFile' after every 'checkpointFreq' iterations, and the
+    // reordering of its KKT system to 'checkpointFile' + ".ldl". If 'restart'
+    // is true, the IPM instead resumes from such a checkpoint of the same
+    // problem (and equilibration). The iterate may be restored over any
+    // number of processes, but the reordering is only reused over the same
+    // number of processes and is otherwise recomputed.
+    string checkpointFile;
+    Int checkpointFreq=0;
+    bool restart=false;
+
     // A lower bound on the maximum entry in the Nesterov-Todd scaling point
     // before ad-hoc procedures to enforce the cone constraints should be
     // employed.
@@ -174,6 +278,86 @@ struct ADMMCtrl
     Real relTol=Real(1e-4);
     bool inv=true;
     bool print=true;
+
+    // Adaptively balance the primal and dual residual norms by multiplying
+    // (dividing) rho by 'rhoScale' whenever the primal (dual) residual norm
+    // exceeds 'rhoBalance' times the dual (primal) residual norm. Since each
+    // change of rho would otherwise require a refactorization, the solvers
+    // then cache an eigendecomposition rather than a Cholesky factorization.
+    bool adaptiveRho=false;
+    Real rhoBalance=Real(10);
+    Real rhoScale=Real(2);
+
+    // Only evaluate the residual norms (and test for convergence) once every
+    // 'checkFrequency' iterations.
+    Int checkFrequency=1;
+};
+
+// A persistent solver for the linear systems (Q + rho I) X = B which arise in
+// the updates of the primal variables of ADMM, where Q is Hermitian positive
+// semi-definite. The factorization (or inverse) of Q + rho I is kept across
+// calls and is only recomputed when rho changes, unless 'spectral' was
+// requested, in which case an eigendecomposition of Q is cached so that
+// changes of rho only shift the eigenvalues.
+template<typename Field>
+class ShiftedHermitianSolver
+{
+public:
+    ShiftedHermitianSolver() { }
+    ShiftedHermitianSolver
+    ( const Matrix<Field>& Q, Base<Field> rho,
+      bool spectral=false, bool inv=true );
+
+    void Initialize
+    ( const Matrix<Field>& Q, Base<Field> rho,
+      bool spectral=false, bool inv=true );
+    bool Initialized() const { return initialized_; }
+
+    Base<Field> Shift() const { return rho_; }
+    void SetShift( Base<Field> rho );
+
+    // B := inv(Q + rho I) B
+    void Solve( Matrix<Field>& B ) const;
+
+private:
+    bool initialized_=false, spectral_=false, inv_=true;
+    Base<Field> rho_=0;
+    Matrix<Field> Q_;
+
+    // Either the Cholesky factor (or inverse) of Q + rho I or the
+    // eigenvectors of Q along with the (shifted) eigenvalues
+    Matrix<Field> F_;
+    Matrix<Base<Field>> eigs_, shiftedEigs_;
+
+    void Factor();
+};
+
+template<typename Field>
+class DistShiftedHermitianSolver
+{
+public:
+    DistShiftedHermitianSolver() { }
+    DistShiftedHermitianSolver
+    ( const AbstractDistMatrix<Field>& Q, Base<Field> rho,
+      bool spectral=false, bool inv=true );
+
+    void Initialize
+    ( const AbstractDistMatrix<Field>& Q, Base<Field> rho,
+      bool spectral=false, bool inv=true );
+    bool Initialized() const { return initialized_; }
+
+    Base<Field> Shift() const { return rho_; }
+    void SetShift( Base<Field> rho );
+
+    void Solve( DistMatrix<Field>& B ) const;
+
+private:
+    bool initialized_=false, spectral_=false, inv_=true;
+    Base<Field> rho_=0;
+    DistMatrix<Field> Q_, F_;
+    DistMatrix<Base<Field>,VR,STAR> eigs_, shiftedEigs_;
+
+    void Factor();
 };
 
 } // namespace El
@@ -12,6 +12,35 @@
 namespace El {
 namespace pos_orth {
 
+// Compute the complementarity statistics
+// ======================================
+// The sum, maximum, and minimum of the entries of s o z, which determine both
+// the barrier parameter and the complementarity ratio, from a single pass
+// over s and z (and, in the distributed cases, a summation and a single
+// combined maximum/minimum reduction)
+template<typename Real>
+struct ComplementarityInfo
+{
+    Real sum=0, maxProd=0, minProd=0;
+    Real Ratio() const { return maxProd/minProd; }
+};
+
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+ComplementarityInfo<Real> Complementarity
+( const Matrix<Real>& s,
+  const Matrix<Real>& z );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+ComplementarityInfo<Real> Complementarity
+( const AbstractDistMatrix<Real>& s,
+  const AbstractDistMatrix<Real>& z );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+ComplementarityInfo<Real> Complementarity
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& z );
+
 // Compute the complementarity ratio
 // =================================
 template<typename Real,
@@ -51,6 +80,106 @@ Real MaxStep
   const DistMultiVec<Real>& ds,
   Real upperBound=limits::Max<Real>() );
 
+// The primal and dual maximum steps, MaxStep(s,ds,upperBound) and
+// MaxStep(z,dz,upperBound), with a single AllReduce
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void MaxSteps
+( const Matrix<Real>& s,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& z,
+  const Matrix<Real>& dz,
+        Real upperBound,
+        Real& alphaPri,
+        Real& alphaDual );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void MaxSteps
+( const AbstractDistMatrix<Real>& s,
+  const AbstractDistMatrix<Real>& ds,
+  const AbstractDistMatrix<Real>& z,
+  const AbstractDistMatrix<Real>& dz,
+        Real upperBound,
+        Real& alphaPri,
+        Real& alphaDual );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void MaxSteps
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& dz,
+        Real upperBound,
+        Real& alphaPri,
+        Real& alphaDual );
+
+// Weighted inner product
+// ======================
+// The sum of w(i) s(i) z(i) from a single pass and AllReduce
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Real WeightedDot
+( const Matrix<Real>& w,
+  const Matrix<Real>& s,
+  const Matrix<Real>& z );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Real WeightedDot
+( const AbstractDistMatrix<Real>& w,
+  const AbstractDistMatrix<Real>& s,
+  const AbstractDistMatrix<Real>& z );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+Real WeightedDot
+( const DistMultiVec<Real>& w,
+  const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& z );
+
+// Gondzio centrality correction
+// =============================
+// Form the modification of the complementarity residual which targets the
+// products of the trial point (s + alphaPri ds, z + alphaDual dz) toward the
+// interval [betaMin mu, betaMax mu].
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void CentralityCorrection
+( const Matrix<Real>& s,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& z,
+  const Matrix<Real>& dz,
+        Real alphaPri,
+        Real alphaDual,
+        Real mu,
+        Matrix<Real>& correction,
+        Real betaMin=Real(0.1),
+        Real betaMax=Real(10) );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void CentralityCorrection
+( const AbstractDistMatrix<Real>& s,
+  const AbstractDistMatrix<Real>& ds,
+  const AbstractDistMatrix<Real>& z,
+  const AbstractDistMatrix<Real>& dz,
+        Real alphaPri,
+        Real alphaDual,
+        Real mu,
+        AbstractDistMatrix<Real>& correction,
+        Real betaMin=Real(0.1),
+        Real betaMax=Real(10) );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void CentralityCorrection
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& dz,
+        Real alphaPri,
+        Real alphaDual,
+        Real mu,
+        DistMultiVec<Real>& correction,
+        Real betaMin=Real(0.1),
+        Real betaMax=Real(10) );
+
 // Number of members outside of cone
 // =================================
 template<typename Real,
@@ -116,6 +245,30 @@ void PushPairInto
   const DistMultiVec<Real>& w,
   Real wMaxNormLimit );
 
+// Shift a pair into the neighborhood of the central path for a warm start
+// =======================================================================
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void WarmStartShift
+( Matrix<Real>& s,
+  Matrix<Real>& z,
+  Real minMu,
+  Real beta=Real(0.1) );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void WarmStartShift
+( AbstractDistMatrix<Real>& s,
+  AbstractDistMatrix<Real>& z,
+  Real minMu,
+  Real beta=Real(0.1) );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void WarmStartShift
+( DistMultiVec<Real>& s,
+  DistMultiVec<Real>& z,
+  Real minMu,
+  Real beta=Real(0.1) );
+
 } // namespace pos_orth
 } // namespace El
 
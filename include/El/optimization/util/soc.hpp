@@ -185,6 +185,45 @@ void Dots
   const DistMultiVec<Int>& firstInds,
   Int cutoff=1000 );
 
+// Fused determinants and dot products
+// ===================================
+// Compute det(x_j), det(y_j), and x_j^T y_j for each cone j in a single pass
+// and store each result over every member of its cone (as if followed by
+// cone::Broadcast). The DistMultiVec variant communicates only the partial
+// sums of the (at most two) cones of each process which straddle process
+// boundaries.
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void DetsAndDots
+( const Matrix<Real>& x,
+  const Matrix<Real>& y,
+        Matrix<Real>& xDets,
+        Matrix<Real>& yDets,
+        Matrix<Real>& dots,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void DetsAndDots
+( const AbstractDistMatrix<Real>& x,
+  const AbstractDistMatrix<Real>& y,
+        AbstractDistMatrix<Real>& xDets,
+        AbstractDistMatrix<Real>& yDets,
+        AbstractDistMatrix<Real>& dots,
+  const AbstractDistMatrix<Int>& orders,
+  const AbstractDistMatrix<Int>& firstInds,
+  Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void DetsAndDots
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+        DistMultiVec<Real>& xDets,
+        DistMultiVec<Real>& yDets,
+        DistMultiVec<Real>& dots,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds );
+
 // Embedding maps
 // ==============
 void EmbeddingMaps
@@ -485,6 +524,38 @@ void PushInto
   Real minDist=0,
   Int cutoff=1000 );
 
+// Shift a pair into the interior of the SOC for a warm start
+// ==========================================================
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void WarmStartShift
+(       Matrix<Real>& s,
+        Matrix<Real>& z,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  Real minMu,
+  Real beta=Real(0.1) );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void WarmStartShift
+(       AbstractDistMatrix<Real>& s,
+        AbstractDistMatrix<Real>& z,
+  const AbstractDistMatrix<Int>& orders,
+  const AbstractDistMatrix<Int>& firstInds,
+  Real minMu,
+  Real beta=Real(0.1),
+  Int cutoff=1000 );
+template<typename Real,
+         typename=EnableIf<IsReal<Real>>>
+void WarmStartShift
+(       DistMultiVec<Real>& s,
+        DistMultiVec<Real>& z,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Real minMu,
+  Real beta=Real(0.1),
+  Int cutoff=1000 );
+
 // Push pair into SOC
 // ==================
 template<typename Real,
@@ -0,0 +1,141 @@
+#
+#  Copyright (c) 2009-2016, Jack Poulson
+#  All rights reserved.
+#
+#  This file is part of Elemental and is under the BSD 2-Clause License,
+#  which can be found in the LICENSE file in the root directory, or at
+#  http://opensource.org/licenses/BSD-2-Clause
+#
+from environment import *
+from imports     import mpi
+import sys, threading, Queue
+
+# Asynchronous calls
+# ==================
+# libEl is loaded through ctypes.CDLL, which releases the GIL for the
+# duration of each foreign call, so routines submitted to an Executor run
+# on its worker threads while the calling thread continues with Python-side
+# work.
+#
+# Since the workers issue MPI calls from threads other than the one which
+# initialized MPI, MPI_THREAD_MULTIPLE support is required. Calls which
+# share objects (or communicators) must still be ordered by the caller,
+# e.g., by waiting upon the Future of the first before issuing the second,
+# and every process of a communicator must submit its collective calls in
+# the same order. Each worker thread has its own random number generator
+# and (in debug builds) call stack, and follows the blocksize stack of the
+# main thread until it modifies its own.
+
+class Future(object):
+  def __init__(self):
+    self.event = threading.Event()
+    self.value = None
+    self.error = None
+    self.callbacks = []
+    self.lock = threading.Lock()
+
+  def Done(self):
+    return self.event.is_set()
+
+  def Wait(self,timeout=None):
+    self.event.wait(timeout)
+    return self.event.is_set()
+
+  # Return the result of the call, re-raising any exception it raised
+  def Result(self,timeout=None):
+    if not self.Wait(timeout):
+      raise Exception('Asynchronous call did not finish in time')
+    if self.error is not None:
+      raise self.error
+    return self.value
+
+  # Return the exception raised by the call (if any)
+  def Error(self,timeout=None):
+    if not self.Wait(timeout):
+      raise Exception('Asynchronous call did not finish in time')
+    return self.error
+
+  # Run 'callback(future)' once the call finishes (immediately if it has)
+  def AddDoneCallback(self,callback):
+    with self.lock:
+      if not self.event.is_set():
+        self.callbacks.append(callback)
+        return
+    callback(self)
+
+  def Finish(self,value,error):
+    with self.lock:
+      self.value = value
+      self.error = error
+      self.event.set()
+      callbacks = self.callbacks
+      self.callbacks = []
+    for callback in callbacks:
+      callback(self)
+
+class Executor(object):
+  def __init__(self,numThreads=1):
+    if numThreads < 1:
+      raise Exception('An Executor requires at least one thread')
+    if not mpi.ThreadMultiple():
+      raise Exception('Asynchronous calls require MPI_THREAD_MULTIPLE')
+    self.tasks = Queue.Queue()
+    self.threads = []
+    for t in xrange(numThreads):
+      thread = threading.Thread(target=self.Work)
+      thread.daemon = True
+      thread.start()
+      self.threads.append(thread)
+
+  def Work(self):
+    while True:
+      task = self.tasks.get()
+      if task is None:
+        break
+      future, func, args, kwargs = task
+      try:
+        value = func(*args,**kwargs)
+        future.Finish(value,None)
+      except BaseException as error:
+        future.Finish(None,error)
+
+  # Queue 'func(*args,**kwargs)' and return a Future for its result
+  def Submit(self,func,*args,**kwargs):
+    if not self.threads:
+      raise Exception('The Executor was shut down')
+    future = Future()
+    self.tasks.put((future,func,args,kwargs))
+    return future
+
+  # Finish the queued calls and then stop the workers
+  def Shutdown(self,wait=True):
+    for thread in self.threads:
+      self.tasks.put(None)
+    if wait:
+      for thread in self.threads:
+        thread.join()
+    self.threads = []
+
+defaultExecutor = [None]
+defaultExecutorLock = threading.Lock()
+def DefaultExecutor():
+  with defaultExecutorLock:
+    if defaultExecutor[0] is None:
+      defaultExecutor[0] = Executor()
+    return defaultExecutor[0]
+
+# Run 'func(*args,**kwargs)' on the default (single-threaded) Executor, or
+# on the one passed as the 'executor' keyword argument
+def Async(func,*args,**kwargs):
+  executor = kwargs.pop('executor',None)
+  if executor is None:
+    executor = DefaultExecutor()
+  return executor.Submit(func,*args,**kwargs)
+
+# Form a Future-returning variant of a routine
+def MakeAsync(func):
+  def AsyncFunc(*args,**kwargs):
+    return Async(func,*args,**kwargs)
+  AsyncFunc.__name__ = func.__name__+'Async'
+  AsyncFunc.__doc__ = func.__doc__
+  return AsyncFunc
@@ -401,6 +401,16 @@ class DistMatrix(object):
       elif self.tag == zTag: lib.ElDistMatrixAttach_z(*args)
       else: DataExcept()
 
+  # Attach a NumPy array with contiguous columns as the local matrix without
+  # copying; a reference to the array is held so that it outlives the view
+  def AttachNumPy(self,m,n,grid,colAlign,rowAlign,array,root=0,locked=False):
+    mLoc, nLoc, ldim, buf = ColumnMajorLayout(array,self.tag)
+    locked = locked or not array.flags.writeable
+    self.Attach(m,n,grid,colAlign,rowAlign,buf,ldim,root,locked)
+    if self.LocalHeight() != mLoc or self.LocalWidth() != nLoc:
+      raise Exception('Array did not match the local matrix dimensions')
+    self.attachedArray = array
+
   # Return the height of the matrix
   # -------------------------------
   lib.ElDistMatrixHeight_i.argtypes = \
@@ -585,6 +595,11 @@ class DistMatrix(object):
       else: DataExcept()
     return A
 
+  # np.asarray(A) is a view of the local matrix (which must outlive it)
+  @property
+  def __array_interface__(self):
+    return self.Matrix(self.Locked()).__array_interface__
+
   # Return the amount of locally allocated memory
   # ---------------------------------------------
   lib.ElDistMatrixAllocatedMemory_i.argtypes = \
@@ -639,6 +654,48 @@ class DistMatrix(object):
       else: DataExcept()
     return buf
 
+  lib.ElDistMatrixGetLocalBuffer_i.argtypes = \
+  lib.ElDistMatrixSetLocalBuffer_i.argtypes = \
+    [c_void_p,POINTER(iType),iType]
+  lib.ElDistMatrixGetLocalBuffer_s.argtypes = \
+  lib.ElDistMatrixSetLocalBuffer_s.argtypes = \
+    [c_void_p,POINTER(sType),iType]
+  lib.ElDistMatrixGetLocalBuffer_d.argtypes = \
+  lib.ElDistMatrixSetLocalBuffer_d.argtypes = \
+    [c_void_p,POINTER(dType),iType]
+  lib.ElDistMatrixGetLocalBuffer_c.argtypes = \
+  lib.ElDistMatrixSetLocalBuffer_c.argtypes = \
+    [c_void_p,POINTER(cType),iType]
+  lib.ElDistMatrixGetLocalBuffer_z.argtypes = \
+  lib.ElDistMatrixSetLocalBuffer_z.argtypes = \
+    [c_void_p,POINTER(zType),iType]
+  def GetLocal(self):
+    localHeight = self.LocalHeight()
+    arr = np.empty((localHeight,self.LocalWidth()),
+                   dtype=TagToNumpyType(self.tag),order='F')
+    args = [self.obj,arr.ctypes.data_as(POINTER(TagToType(self.tag))),
+            max(localHeight,1)]
+    if   self.tag == iTag: lib.ElDistMatrixGetLocalBuffer_i(*args)
+    elif self.tag == sTag: lib.ElDistMatrixGetLocalBuffer_s(*args)
+    elif self.tag == dTag: lib.ElDistMatrixGetLocalBuffer_d(*args)
+    elif self.tag == cTag: lib.ElDistMatrixGetLocalBuffer_c(*args)
+    elif self.tag == zTag: lib.ElDistMatrixGetLocalBuffer_z(*args)
+    else: DataExcept()
+    return arr
+
+  def SetLocal(self,values):
+    localHeight = self.LocalHeight()
+    arr, ptr = ContiguousArray(values,self.tag,'F')
+    if arr.shape != (localHeight,self.LocalWidth()):
+      raise Exception('Array did not match the local matrix dimensions')
+    args = [self.obj,ptr,max(localHeight,1)]
+    if   self.tag == iTag: lib.ElDistMatrixSetLocalBuffer_i(*args)
+    elif self.tag == sTag: lib.ElDistMatrixSetLocalBuffer_s(*args)
+    elif self.tag == dTag: lib.ElDistMatrixSetLocalBuffer_d(*args)
+    elif self.tag == cTag: lib.ElDistMatrixSetLocalBuffer_c(*args)
+    elif self.tag == zTag: lib.ElDistMatrixSetLocalBuffer_z(*args)
+    else: DataExcept()
+
   # Return the process grid
   # -----------------------
   lib.ElDistMatrixGrid_i.argtypes = \
@@ -1686,6 +1743,31 @@ class DistMatrix(object):
     elif self.tag == zTag: lib.ElDistMatrixQueueUpdate_z(*args)
     else: DataExcept()
 
+  lib.ElDistMatrixQueueUpdates_i.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(iType)]
+  lib.ElDistMatrixQueueUpdates_s.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(sType)]
+  lib.ElDistMatrixQueueUpdates_d.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(dType)]
+  lib.ElDistMatrixQueueUpdates_c.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(cType)]
+  lib.ElDistMatrixQueueUpdates_z.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(zType)]
+  def QueueUpdates(self,rows,cols,values):
+    rowArr, rowPtr = ContiguousArray(rows,iTag)
+    colArr, colPtr = ContiguousArray(cols,iTag)
+    valArr, valPtr = ContiguousArray(values,self.tag)
+    numUpdates = rowArr.size
+    if colArr.size != numUpdates or valArr.size != numUpdates:
+      raise Exception('Triplet arrays must be of the same length')
+    args = [self.obj,numUpdates,rowPtr,colPtr,valPtr]
+    if   self.tag == iTag: lib.ElDistMatrixQueueUpdates_i(*args)
+    elif self.tag == sTag: lib.ElDistMatrixQueueUpdates_s(*args)
+    elif self.tag == dTag: lib.ElDistMatrixQueueUpdates_d(*args)
+    elif self.tag == cTag: lib.ElDistMatrixQueueUpdates_c(*args)
+    elif self.tag == zTag: lib.ElDistMatrixQueueUpdates_z(*args)
+    else: DataExcept()
+
   lib.ElDistMatrixProcessQueues_i.argtypes = \
   lib.ElDistMatrixProcessQueues_s.argtypes = \
   lib.ElDistMatrixProcessQueues_d.argtypes = \
@@ -179,7 +179,7 @@ class DistMultiVec(object):
   lib.ElDistMultiVecLockedMatrix_z.argtypes = \
     [c_void_p,POINTER(c_void_p)]
   def Matrix(self,locked=False):
-    A = M.Matrix(dTag,False)
+    A = M.Matrix(self.tag,False)
     args = [self.obj,pointer(A.obj)]
     if locked:
       if   self.tag == iTag: lib.ElDistMultiVecLockedMatrix_i(*args)
@@ -197,6 +197,11 @@ class DistMultiVec(object):
       else: DataExcept()
     return A
 
+  # np.asarray(X) is a view of the local rows (which must outlive it)
+  @property
+  def __array_interface__(self):
+    return self.Matrix().__array_interface__
+
   lib.ElDistMultiVecGrid_i.argtypes = \
   lib.ElDistMultiVecGrid_s.argtypes = \
   lib.ElDistMultiVecGrid_d.argtypes = \
@@ -112,6 +112,40 @@ class DistSparseMatrix(object):
     elif self.tag == zTag: lib.ElDistSparseMatrixReserve_z(*args)
     else: DataExcept()
 
+  lib.ElDistSparseMatrixSetLocalCompressedRows_i.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(iType)]
+  lib.ElDistSparseMatrixSetLocalCompressedRows_s.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(sType)]
+  lib.ElDistSparseMatrixSetLocalCompressedRows_d.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(dType)]
+  lib.ElDistSparseMatrixSetLocalCompressedRows_c.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(cType)]
+  lib.ElDistSparseMatrixSetLocalCompressedRows_z.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(zType)]
+  def SetLocalCompressedRows(self,height,width,localOffsets,cols,values):
+    offArr, offPtr = ContiguousArray(localOffsets,iTag)
+    colArr, colPtr = ContiguousArray(cols,iTag)
+    valArr, valPtr = ContiguousArray(values,self.tag)
+    self.Resize(height,width)
+    if offArr.size != self.LocalHeight()+1 or colArr.size != valArr.size or \
+       offArr[-1] > colArr.size:
+      raise Exception('Inconsistent compressed row arrays')
+    args = [self.obj,height,width,offPtr,colPtr,valPtr]
+    if   self.tag == iTag: lib.ElDistSparseMatrixSetLocalCompressedRows_i(*args)
+    elif self.tag == sTag: lib.ElDistSparseMatrixSetLocalCompressedRows_s(*args)
+    elif self.tag == dTag: lib.ElDistSparseMatrixSetLocalCompressedRows_d(*args)
+    elif self.tag == cTag: lib.ElDistSparseMatrixSetLocalCompressedRows_c(*args)
+    elif self.tag == zTag: lib.ElDistSparseMatrixSetLocalCompressedRows_z(*args)
+    else: DataExcept()
+
+  # Adopt a SciPy sparse matrix holding our local rows (beginning with
+  # FirstLocalRow()) of a height x width matrix with a single copy
+  def FromLocalSciPy(self,height,width,ALocSciPy):
+    ACSR = ALocSciPy.tocsr()
+    ACSR.sum_duplicates()
+    ACSR.sort_indices()
+    self.SetLocalCompressedRows(height,width,ACSR.indptr,ACSR.indices,ACSR.data)
+
   lib.ElDistSparseMatrixUpdate_i.argtypes = [c_void_p,iType,iType,iType]
   lib.ElDistSparseMatrixUpdate_s.argtypes = [c_void_p,iType,iType,sType]
   lib.ElDistSparseMatrixUpdate_d.argtypes = [c_void_p,iType,iType,dType]
@@ -208,6 +242,56 @@ class DistSparseMatrix(object):
     elif self.tag == zTag: lib.ElDistSparseMatrixQueueLocalUpdate_z(*args)
     else: DataExcept()
 
+  lib.ElDistSparseMatrixQueueUpdates_i.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(iType),bType]
+  lib.ElDistSparseMatrixQueueUpdates_s.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(sType),bType]
+  lib.ElDistSparseMatrixQueueUpdates_d.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(dType),bType]
+  lib.ElDistSparseMatrixQueueUpdates_c.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(cType),bType]
+  lib.ElDistSparseMatrixQueueUpdates_z.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(zType),bType]
+  def QueueUpdates(self,rows,cols,values,passive=False):
+    rowArr, rowPtr = ContiguousArray(rows,iTag)
+    colArr, colPtr = ContiguousArray(cols,iTag)
+    valArr, valPtr = ContiguousArray(values,self.tag)
+    numUpdates = rowArr.size
+    if colArr.size != numUpdates or valArr.size != numUpdates:
+      raise Exception('Triplet arrays must be of the same length')
+    args = [self.obj,numUpdates,rowPtr,colPtr,valPtr,passive]
+    if   self.tag == iTag: lib.ElDistSparseMatrixQueueUpdates_i(*args)
+    elif self.tag == sTag: lib.ElDistSparseMatrixQueueUpdates_s(*args)
+    elif self.tag == dTag: lib.ElDistSparseMatrixQueueUpdates_d(*args)
+    elif self.tag == cTag: lib.ElDistSparseMatrixQueueUpdates_c(*args)
+    elif self.tag == zTag: lib.ElDistSparseMatrixQueueUpdates_z(*args)
+    else: DataExcept()
+
+  lib.ElDistSparseMatrixQueueLocalUpdates_i.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(iType)]
+  lib.ElDistSparseMatrixQueueLocalUpdates_s.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(sType)]
+  lib.ElDistSparseMatrixQueueLocalUpdates_d.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(dType)]
+  lib.ElDistSparseMatrixQueueLocalUpdates_c.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(cType)]
+  lib.ElDistSparseMatrixQueueLocalUpdates_z.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(zType)]
+  def QueueLocalUpdates(self,localRows,cols,values):
+    rowArr, rowPtr = ContiguousArray(localRows,iTag)
+    colArr, colPtr = ContiguousArray(cols,iTag)
+    valArr, valPtr = ContiguousArray(values,self.tag)
+    numUpdates = rowArr.size
+    if colArr.size != numUpdates or valArr.size != numUpdates:
+      raise Exception('Triplet arrays must be of the same length')
+    args = [self.obj,numUpdates,rowPtr,colPtr,valPtr]
+    if   self.tag == iTag: lib.ElDistSparseMatrixQueueLocalUpdates_i(*args)
+    elif self.tag == sTag: lib.ElDistSparseMatrixQueueLocalUpdates_s(*args)
+    elif self.tag == dTag: lib.ElDistSparseMatrixQueueLocalUpdates_d(*args)
+    elif self.tag == cTag: lib.ElDistSparseMatrixQueueLocalUpdates_c(*args)
+    elif self.tag == zTag: lib.ElDistSparseMatrixQueueLocalUpdates_z(*args)
+    else: DataExcept()
+
   lib.ElDistSparseMatrixQueueZero_i.argtypes = \
   lib.ElDistSparseMatrixQueueZero_s.argtypes = \
   lib.ElDistSparseMatrixQueueZero_d.argtypes = \
@@ -429,18 +429,25 @@ class Matrix(object):
     if   self.tag == cTag: lib.ElMatrixConjugate_c(self.obj,i,j)
     elif self.tag == zTag: lib.ElMatrixConjugate_z(self.obj,i,j)
 
-  def ToNumPy(self):
-    m = self.Height()
-    n = self.Width()
-    ldim = self.LDim()
+  # NumPy interoperability
+  # ----------------------
+  # np.asarray(A) is a view of the matrix (which must outlive it)
+  @property
+  def __array_interface__(self):
     locked = self.Locked()
-    entrySize = TagToSize(self.tag)
-    npType = TagToNumpyType(self.tag)
-    bufSize = entrySize*ldim*n
-    if locked: buf = buffer_from_memory(self.LockedBuffer(),bufSize)
-    else:      buf = buffer_from_memory_RW(self.Buffer(),bufSize)
-    return np.ndarray(shape=(m,n),strides=(entrySize,ldim*entrySize),
-                        buffer=buf,dtype=npType)
+    return ArrayInterface(self.Buffer(locked),self.tag,
+                          self.Height(),self.Width(),self.LDim(),locked)
+
+  def ToNumPy(self):
+    return np.asarray(self)
+
+  # View a NumPy array with contiguous columns without copying; a reference
+  # to the array is held so that it outlives the view
+  def AttachNumPy(self,array,locked=False):
+    m, n, ldim, buf = ColumnMajorLayout(array,self.tag)
+    locked = locked or not array.flags.writeable
+    self.Attach(m,n,buf,ldim,locked)
+    self.attachedArray = array
 
   lib.ElView_i.argtypes = \
   lib.ElView_s.argtypes = \
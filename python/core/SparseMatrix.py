@@ -93,6 +93,40 @@ class SparseMatrix(object):
     elif self.tag == zTag: lib.ElSparseMatrixReserve_z(*args)
     else: DataExcept()
 
+  lib.ElSparseMatrixSetCompressedRows_i.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(iType)]
+  lib.ElSparseMatrixSetCompressedRows_s.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(sType)]
+  lib.ElSparseMatrixSetCompressedRows_d.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(dType)]
+  lib.ElSparseMatrixSetCompressedRows_c.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(cType)]
+  lib.ElSparseMatrixSetCompressedRows_z.argtypes = \
+    [c_void_p,iType,iType,POINTER(iType),POINTER(iType),POINTER(zType)]
+  def SetCompressedRows(self,height,width,offsets,cols,values):
+    offArr, offPtr = ContiguousArray(offsets,iTag)
+    colArr, colPtr = ContiguousArray(cols,iTag)
+    valArr, valPtr = ContiguousArray(values,self.tag)
+    if offArr.size != height+1 or colArr.size != valArr.size or \
+       offArr[height] > colArr.size:
+      raise Exception('Inconsistent compressed row arrays')
+    args = [self.obj,height,width,offPtr,colPtr,valPtr]
+    if   self.tag == iTag: lib.ElSparseMatrixSetCompressedRows_i(*args)
+    elif self.tag == sTag: lib.ElSparseMatrixSetCompressedRows_s(*args)
+    elif self.tag == dTag: lib.ElSparseMatrixSetCompressedRows_d(*args)
+    elif self.tag == cTag: lib.ElSparseMatrixSetCompressedRows_c(*args)
+    elif self.tag == zTag: lib.ElSparseMatrixSetCompressedRows_z(*args)
+    else: DataExcept()
+
+  # Become a copy of a SciPy sparse matrix with a single copy of its
+  # compressed row arrays (which are sorted in place if necessary)
+  def FromSciPy(self,ASciPy):
+    ACSR = ASciPy.tocsr()
+    ACSR.sum_duplicates()
+    ACSR.sort_indices()
+    height, width = ACSR.shape
+    self.SetCompressedRows(height,width,ACSR.indptr,ACSR.indices,ACSR.data)
+
   lib.ElSparseMatrixUpdate_i.argtypes = [c_void_p,iType,iType,iType]
   lib.ElSparseMatrixUpdate_s.argtypes = [c_void_p,iType,iType,sType]
   lib.ElSparseMatrixUpdate_d.argtypes = [c_void_p,iType,iType,dType]
@@ -136,6 +170,31 @@ class SparseMatrix(object):
     elif self.tag == zTag: lib.ElSparseMatrixQueueUpdate_z(*args)
     else: DataExcept()
 
+  lib.ElSparseMatrixQueueUpdates_i.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(iType)]
+  lib.ElSparseMatrixQueueUpdates_s.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(sType)]
+  lib.ElSparseMatrixQueueUpdates_d.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(dType)]
+  lib.ElSparseMatrixQueueUpdates_c.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(cType)]
+  lib.ElSparseMatrixQueueUpdates_z.argtypes = \
+    [c_void_p,iType,POINTER(iType),POINTER(iType),POINTER(zType)]
+  def QueueUpdates(self,rows,cols,values):
+    rowArr, rowPtr = ContiguousArray(rows,iTag)
+    colArr, colPtr = ContiguousArray(cols,iTag)
+    valArr, valPtr = ContiguousArray(values,self.tag)
+    numUpdates = rowArr.size
+    if colArr.size != numUpdates or valArr.size != numUpdates:
+      raise Exception('Triplet arrays must be of the same length')
+    args = [self.obj,numUpdates,rowPtr,colPtr,valPtr]
+    if   self.tag == iTag: lib.ElSparseMatrixQueueUpdates_i(*args)
+    elif self.tag == sTag: lib.ElSparseMatrixQueueUpdates_s(*args)
+    elif self.tag == dTag: lib.ElSparseMatrixQueueUpdates_d(*args)
+    elif self.tag == cTag: lib.ElSparseMatrixQueueUpdates_c(*args)
+    elif self.tag == zTag: lib.ElSparseMatrixQueueUpdates_z(*args)
+    else: DataExcept()
+
   lib.ElSparseMatrixQueueZero_i.argtypes = \
   lib.ElSparseMatrixQueueZero_s.argtypes = \
   lib.ElSparseMatrixQueueZero_d.argtypes = \
@@ -478,6 +537,51 @@ class SparseMatrix(object):
       else: DataExcept()
     return valueBuf
 
+  lib.ElSparseMatrixOffsetBuffer_i.argtypes = \
+  lib.ElSparseMatrixOffsetBuffer_s.argtypes = \
+  lib.ElSparseMatrixOffsetBuffer_d.argtypes = \
+  lib.ElSparseMatrixOffsetBuffer_c.argtypes = \
+  lib.ElSparseMatrixOffsetBuffer_z.argtypes = \
+  lib.ElSparseMatrixLockedOffsetBuffer_i.argtypes = \
+  lib.ElSparseMatrixLockedOffsetBuffer_s.argtypes = \
+  lib.ElSparseMatrixLockedOffsetBuffer_d.argtypes = \
+  lib.ElSparseMatrixLockedOffsetBuffer_c.argtypes = \
+  lib.ElSparseMatrixLockedOffsetBuffer_z.argtypes = \
+    [c_void_p,POINTER(POINTER(iType))]
+  def OffsetBuffer(self,locked=False):
+    offsetBuf = POINTER(iType)()
+    args = [self.obj,pointer(offsetBuf)]
+    if locked:
+      if   self.tag == iTag: lib.ElSparseMatrixLockedOffsetBuffer_i(*args)
+      elif self.tag == sTag: lib.ElSparseMatrixLockedOffsetBuffer_s(*args)
+      elif self.tag == dTag: lib.ElSparseMatrixLockedOffsetBuffer_d(*args)
+      elif self.tag == cTag: lib.ElSparseMatrixLockedOffsetBuffer_c(*args)
+      elif self.tag == zTag: lib.ElSparseMatrixLockedOffsetBuffer_z(*args)
+      else: DataExcept()
+    else:
+      if   self.tag == iTag: lib.ElSparseMatrixOffsetBuffer_i(*args)
+      elif self.tag == sTag: lib.ElSparseMatrixOffsetBuffer_s(*args)
+      elif self.tag == dTag: lib.ElSparseMatrixOffsetBuffer_d(*args)
+      elif self.tag == cTag: lib.ElSparseMatrixOffsetBuffer_c(*args)
+      elif self.tag == zTag: lib.ElSparseMatrixOffsetBuffer_z(*args)
+      else: DataExcept()
+    return offsetBuf
+
+  # Return a SciPy CSR matrix which views (rather than copies) the compressed
+  # rows of this (consistent) matrix, which must outlive it
+  def ToSciPy(self):
+    import scipy.sparse
+    if not self.Consistent():
+      raise Exception('Queues must be processed before viewing the matrix')
+    height = self.Height()
+    numEntries = self.NumEntries()
+    offsets = NumPyView(self.OffsetBuffer(True),iTag,height+1)
+    cols = NumPyView(self.TargetBuffer(True),iTag,numEntries)
+    values = NumPyView(self.ValueBuffer(),self.tag,numEntries)
+    if offsets.size == 0: offsets = np.zeros(height+1,dtype=iNpType)
+    return scipy.sparse.csr_matrix((values,cols,offsets),
+                                   shape=(height,self.Width()),copy=False)
+
   lib.ElGetContigSubmatrixSparse_i.argtypes = \
   lib.ElGetContigSubmatrixSparse_s.argtypes = \
   lib.ElGetContigSubmatrixSparse_d.argtypes = \
@@ -19,3 +19,4 @@ from SparseMatrix     import *
 from DistSparseMatrix import *
 from DistMultiVec     import *
 from Permutation      import *
+from Asynchronous     import *
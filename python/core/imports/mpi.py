@@ -93,3 +93,10 @@ def Time():
   walltime = c_double()
   lib.ElMPITime(pointer(walltime))
   return walltime.value
+
+lib.ElMPIThreadMultiple.argtypes = [POINTER(bType)]
+lib.ElMPIThreadMultiple.restype = c_uint
+def ThreadMultiple():
+  multiple = bType()
+  lib.ElMPIThreadMultiple(pointer(multiple))
+  return multiple.value
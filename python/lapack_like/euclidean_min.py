@@ -31,16 +31,22 @@ class SQSDCtrl_d(ctypes.Structure):
   def __init__(self):
     lib.ElSQSDCtrlDefault_d(pointer(self))
 
+(LS_DIRECT,LS_SKETCH_AND_PRECONDITION,LS_MULTIFRONTAL_QR)=(0,1,2)
+
 class LeastSquaresCtrl_s(ctypes.Structure):
   _fields_ = [("scaleTwoNorm",bType),("basisSize",iType),("alpha",sType),
               ("sqsdCtrl",SQSDCtrl_s),
-              ("equilibrate",bType),("progress",bType),("time",bType)]
+              ("equilibrate",bType),("progress",bType),("time",bType),
+              ("alg",c_uint),("sketchRatio",dType),("sketchSparsity",iType),
+              ("lsqrTol",sType),("maxLSQRIts",iType)]
   def __init__(self):
     lib.ElLeastSquaresCtrlDefault_s(pointer(self))
 class LeastSquaresCtrl_d(ctypes.Structure):
   _fields_ = [("scaleTwoNorm",bType),("basisSize",iType),("alpha",dType),
               ("sqsdCtrl",SQSDCtrl_d),
-              ("equilibrate",bType),("progress",bType),("time",bType)]
+              ("equilibrate",bType),("progress",bType),("time",bType),
+              ("alg",c_uint),("sketchRatio",dType),("sketchSparsity",iType),
+              ("lsqrTol",dType),("maxLSQRIts",iType)]
   def __init__(self):
     lib.ElLeastSquaresCtrlDefault_d(pointer(self))
 
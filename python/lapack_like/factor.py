@@ -466,7 +466,8 @@ def MultiplyAfterLDLPiv(A,dSub,p,B,conjugate=True):
 # ==================================================
 
 # Emulate an enum for the Regularized LDL solve/refinement
-(REG_SOLVE_FGMRES,REG_SOLVE_LGMRES)=(0,1)
+(REG_SOLVE_FGMRES,REG_SOLVE_LGMRES,
+ REG_SOLVE_PIPELINED_CG,REG_SOLVE_PIPELINED_GMRES)=(0,1,2,3)
 
 lib.ElRegSolveCtrlDefault_s.argtypes = \
 lib.ElRegSolveCtrlDefault_d.argtypes = \
@@ -1610,3 +1611,11 @@ def Skeleton(A,ctrl):
     else: DataExcept()
     return PR, PC, Z
   else: TypeExcept()
+
+# Future-returning variants (see El.core.Asynchronous)
+# ----------------------------------------------------
+CholeskyAsync               = MakeAsync(Cholesky)
+SolveAfterCholeskyAsync     = MakeAsync(SolveAfterCholesky)
+LUAsync                     = MakeAsync(LU)
+SolveAfterLUAsync           = MakeAsync(SolveAfterLU)
+SolveAfterLUPartialPivAsync = MakeAsync(SolveAfterLUPartialPiv)
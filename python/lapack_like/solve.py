@@ -289,3 +289,8 @@ def MultiShiftHessSolve(H,shifts,X,alphaPre=1,uplo=LOWER,orient=NORMAL):
     else: DataExcept()
     return X
   else: TypeExcept()
+
+# Future-returning variants (see El.core.Asynchronous)
+# ----------------------------------------------------
+LinearSolveAsync = MakeAsync(LinearSolve)
+HPDSolveAsync    = MakeAsync(HPDSolve)
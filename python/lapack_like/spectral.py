@@ -548,7 +548,10 @@ class SignCtrl_s(ctypes.Structure):
   _fields_ = [("maxIts",iType),
               ("tol",sType),
               ("power",sType),
-              ("scaling",c_uint)]
+              ("scaling",c_uint),
+              ("progress",bType),
+              ("newtonSchulz",bType),
+              ("newtonSchulzTol",sType)]
   def __init__(self):
     lib.ElSignCtrlDefault_s(pointer(self))
 
@@ -557,7 +560,10 @@ class SignCtrl_d(ctypes.Structure):
   _fields_ = [("maxIts",iType),
               ("tol",dType),
               ("power",dType),
-              ("scaling",c_uint)]
+              ("scaling",c_uint),
+              ("progress",bType),
+              ("newtonSchulz",bType),
+              ("newtonSchulzTol",dType)]
   def __init__(self):
     lib.ElSignCtrlDefault_d(pointer(self))
 
@@ -579,6 +585,7 @@ class HessenbergSchurCtrl(ctypes.Structure):
               ("progress",bType),
               ("minMultiBulgeSize",iType),
               ("minDistMultiBulgeSize",iType),
+              ("minSubgridAEDSize",iType),
               ("numShifts",CFUNCTYPE(iType,iType,iType)),
               ("deflationSize",CFUNCTYPE(iType,iType,iType,iType)),
               ("sufficientDeflation",CFUNCTYPE(iType,iType)),
@@ -836,6 +843,8 @@ class SVDCtrl_s(ctypes.Structure):
               ("useScaLAPACK",bType),
               ("valChanRatio",dType),
               ("fullChanRatio",dType),
+              ("useTSQR",bType),
+              ("tsqrRatio",dType),
               ("bidiagSVDCtrl",BidiagSVDCtrl_s)]
   def __init__(self):
     lib.ElSVDCtrlDefault_s(pointer(self))
@@ -847,6 +856,8 @@ class SVDCtrl_d(ctypes.Structure):
               ("useScaLAPACK",bType),
               ("valChanRatio",dType),
               ("fullChanRatio",dType),
+              ("useTSQR",bType),
+              ("tsqrRatio",dType),
               ("bidiagSVDCtrl",BidiagSVDCtrl_d)]
   def __init__(self):
     lib.ElSVDCtrlDefault_d(pointer(self))
@@ -1137,6 +1148,7 @@ class PseudospecCtrl_s(ctypes.Structure):
               ("arnoldi",bType),
               ("basisSize",iType),
               ("reorthog",bType),
+              ("numSubgrids",iType),
               ("progress",bType),
               ("snapCtrl",SnapshotCtrl),
               ("center",cType),
@@ -1163,6 +1175,7 @@ class PseudospecCtrl_d(ctypes.Structure):
               ("arnoldi",bType),
               ("basisSize",iType),
               ("reorthog",bType),
+              ("numSubgrids",iType),
               ("progress",bType),
               ("snapCtrl",SnapshotCtrl),
               ("center",zType),
@@ -1537,3 +1550,8 @@ def SpectralCloud(A,shifts,ctrl=None):
     else: DataExcept()
     return invNorms
   else: TypeExcept()
+
+# Future-returning variants (see El.core.Asynchronous)
+# ----------------------------------------------------
+HermitianEigAsync = MakeAsync(HermitianEig)
+SVDAsync          = MakeAsync(SVD)
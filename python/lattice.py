@@ -52,7 +52,11 @@ class LLLCtrl_s(ctypes.Structure):
               ("progress",bType),
               ("time",bType),
               ("jumpstart",bType),
-              ("startCol",iType)]
+              ("startCol",iType),
+              ("deepInsertionDepth",iType),
+              ("segmented",bType),
+              ("segmentSize",iType),
+              ("maxSegmentSweeps",iType)]
   def __init__(self):
     lib.ElLLLCtrlDefault_s(pointer(self))
 class LLLCtrl_d(ctypes.Structure):
@@ -73,7 +77,11 @@ class LLLCtrl_d(ctypes.Structure):
               ("progress",bType),
               ("time",bType),
               ("jumpstart",bType),
-              ("startCol",iType)]
+              ("startCol",iType),
+              ("deepInsertionDepth",iType),
+              ("segmented",bType),
+              ("segmentSize",iType),
+              ("maxSegmentSweeps",iType)]
   def __init__(self):
     lib.ElLLLCtrlDefault_d(pointer(self))
 
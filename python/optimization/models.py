@@ -724,12 +724,15 @@ def NNLS(A,b,ctrl=None):
 lib.ElNMFCtrlDefault_s.argtypes = \
 lib.ElNMFCtrlDefault_d.argtypes = \
   [c_void_p]
+(NMF_NNLS,NMF_HALS,NMF_BPP)=(0,1,2)
 class NMFCtrl_s(ctypes.Structure):
-  _fields_ = [("nnlsCtrl",NNLSCtrl_s),("maxIter",iType)]
+  _fields_ = [("nnlsCtrl",NNLSCtrl_s),("maxIter",iType),
+              ("approach",c_uint),("numInnerIts",iType)]
   def __init__(self):
     lib.ElNMFCtrlDefault_s(pointer(self))
 class NMFCtrl_d(ctypes.Structure):
-  _fields_ = [("nnlsCtrl",NNLSCtrl_d),("maxIter",iType)]
+  _fields_ = [("nnlsCtrl",NNLSCtrl_d),("maxIter",iType),
+              ("approach",c_uint),("numInnerIts",iType)]
   def __init__(self):
     lib.ElNMFCtrlDefault_d(pointer(self))
 
@@ -774,13 +777,17 @@ lib.ElBPDNADMMCtrlDefault_d.argtypes = \
 class BPDNADMMCtrl_s(ctypes.Structure):
   _fields_ = [("rho",sType),("alpha",sType),("maxIter",iType),
               ("absTol",sType),("relTol",sType),
-              ("inv",bType),("progress",bType)]
+              ("inv",bType),("progress",bType),
+              ("adaptiveRho",bType),("rhoBalance",sType),("rhoScale",sType),
+              ("checkFrequency",iType)]
   def __init__(self):
     lib.ElBPDNADMMCtrlDefault_s(pointer(self))
 class BPDNADMMCtrl_d(ctypes.Structure):
   _fields_ = [("rho",dType),("alpha",dType),("maxIter",iType),
               ("absTol",dType),("relTol",dType),
-              ("inv",bType),("progress",bType)]
+              ("inv",bType),("progress",bType),
+              ("adaptiveRho",bType),("rhoBalance",dType),("rhoScale",dType),
+              ("checkFrequency",iType)]
   def __init__(self):
     lib.ElBPDNADMMCtrlDefault_d(pointer(self))
 
@@ -980,13 +987,17 @@ lib.ElRPCACtrlDefault_d.argtypes = \
 class RPCACtrl_s(ctypes.Structure):
   _fields_ = [("useALM",bType),("usePivQR",bType),("progress",bType),
               ("numPivSteps",iType),("maxIts",iType),
-              ("tau",sType),("beta",sType),("rho",sType),("tol",sType)]
+              ("tau",sType),("beta",sType),("rho",sType),("tol",sType),
+              ("randomizedSVT",bType),("svtRankPad",iType),
+              ("svtMaxRankRatio",sType)]
   def __init__(self):
     lib.ElRPCACtrlDefault_s(pointer(self))
 class RPCACtrl_d(ctypes.Structure):
   _fields_ = [("useALM",bType),("usePivQR",bType),("progress",bType),
               ("numPivSteps",iType),("maxIts",iType),
-              ("tau",dType),("beta",dType),("rho",dType),("tol",dType)]
+              ("tau",dType),("beta",dType),("rho",dType),("tol",dType),
+              ("randomizedSVT",bType),("svtRankPad",iType),
+              ("svtMaxRankRatio",dType)]
   def __init__(self):
     lib.ElRPCACtrlDefault_d(pointer(self))
 
@@ -21,17 +21,21 @@ lib.ElMehrotraCtrlDefault_d.argtypes = \
   [c_void_p,bType]
 class MehrotraCtrl_s(ctypes.Structure):
   _fields_ = [("primalInit",bType),("dualInit",bType),
+              ("warmStartShift",bType),("warmStartMinMu",sType),
               ("minTol",sType),("targetTol",sType),
               ("maxIts",iType),
               ("maxStepRatio",sType),
               ("system",c_uint),
               ("mehrotra",bType),
+              ("maxGondzioCorrs",iType),
+              ("adaptiveGondzio",bType),
               ("centralityRule",CFUNCTYPE(sType,sType,sType,sType,sType)),
               ("standardInitShift",bType),
               ("balanceTol",sType),
               ("forceSameStep",bType),
               ("solveCtrl",RegSolveCtrl_s),
               ("resolveReg",bType),
+              ("lowerPrecisionFactor",bType),
               ("outerEquil",bType),
               ("basisSize",iType),
               ("progress",bType),
@@ -48,17 +52,21 @@ class MehrotraCtrl_s(ctypes.Structure):
     lib.ElMehrotraCtrlDefault_s(pointer(self))
 class MehrotraCtrl_d(ctypes.Structure):
   _fields_ = [("primalInit",bType),("dualInit",bType),
+              ("warmStartShift",bType),("warmStartMinMu",dType),
               ("minTol",dType),("targetTol",dType),
               ("maxIts",iType),
               ("maxStepRatio",dType),
               ("system",c_uint),
               ("mehrotra",bType),
+              ("maxGondzioCorrs",iType),
+              ("adaptiveGondzio",bType),
               ("centralityRule",CFUNCTYPE(dType,dType,dType,dType,dType)),
               ("standardInitShift",bType),
               ("balanceTol",dType),
               ("forceSameStep",bType),
               ("solveCtrl",RegSolveCtrl_d),
               ("resolveReg",bType),
+              ("lowerPrecisionFactor",bType),
               ("outerEquil",bType),
               ("basisSize",iType),
               ("progress",bType),
@@ -83,14 +91,18 @@ class ADMMCtrl_s(ctypes.Structure):
   _fields_ = [("rho",sType),("alpha",sType),
               ("maxIter",iType),
               ("absTol",sType),("relTol",sType),
-              ("inv",bType),("progress",bType)]
+              ("inv",bType),("progress",bType),
+              ("adaptiveRho",bType),("rhoBalance",sType),("rhoScale",sType),
+              ("checkFrequency",iType)]
   def __init__(self):
-    lib.ElLPDirectADMMCtrlDefault_s(pointer(self))
+    lib.ElADMMCtrlDefault_s(pointer(self))
 class ADMMCtrl_d(ctypes.Structure):
   _fields_ = [("rho",dType),("alpha",dType),
               ("maxIter",iType),
               ("absTol",dType),("relTol",dType),
-              ("inv",bType),("progress",bType)]
+              ("inv",bType),("progress",bType),
+              ("adaptiveRho",bType),("rhoBalance",dType),("rhoScale",dType),
+              ("checkFrequency",iType)]
   def __init__(self):
     lib.ElADMMCtrlDefault_d(pointer(self))
 
@@ -198,12 +210,14 @@ lib.ElLPAffineCtrlDefault_d.argtypes = \
   [c_void_p]
 class LPAffineCtrl_s(ctypes.Structure):
   _fields_ = [("approach",c_uint),
-              ("mehrotraCtrl",MehrotraCtrl_s)]
+              ("mehrotraCtrl",MehrotraCtrl_s),
+              ("presolve",bType)]
   def __init__(self):
     lib.ElLPAffineCtrlDefault_s(pointer(self))
 class LPAffineCtrl_d(ctypes.Structure):
   _fields_ = [("approach",c_uint),
-              ("mehrotraCtrl",MehrotraCtrl_d)]
+              ("mehrotraCtrl",MehrotraCtrl_d),
+              ("presolve",bType)]
   def __init__(self):
     lib.ElLPAffineCtrlDefault_d(pointer(self))
 
@@ -734,3 +748,12 @@ def SOCPAffine(A,G,b,c,h,orders,firstInds,x,y,z,s,ctrl=None):
       else:            lib.ElSOCPAffineXDistSparse_d(*argsCtrl)
     else: DataExcept()
   else: TypeExcept()
+
+# Future-returning variants (see El.core.Asynchronous)
+# ----------------------------------------------------
+LPDirectAsync   = MakeAsync(LPDirect)
+LPAffineAsync   = MakeAsync(LPAffine)
+QPDirectAsync   = MakeAsync(QPDirect)
+QPAffineAsync   = MakeAsync(QPAffine)
+SOCPDirectAsync = MakeAsync(SOCPDirect)
+SOCPAffineAsync = MakeAsync(SOCPAffine)
@@ -8,12 +8,21 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like.hpp>
-#include <stack>
+#include <fstream>
+#include <map>
+#include <mutex>
 
 namespace {
 using namespace El;
 
-std::stack<Int> blocksizeStack;
+// The tuned blocksizes, keyed by "<routine> <datatype> <height> <width>"
+std::map<string,Int> tunedBlocksizes;
+std::mutex tunedBlocksizesMutex;
+
+string TunedKey
+( const string& routine, const string& typeName,
+  int gridHeight, int gridWidth )
+{ return BuildString(routine," ",typeName," ",gridHeight," ",gridWidth); }
 
 template<typename T>
 struct LocalSymvBlocksizeHelper { static Int value; };
@@ -34,40 +43,146 @@ Int LocalTrr2kBlocksizeHelper<T>::value = 64;
 
 namespace El {
 
-Int Blocksize()
-{
-    EL_DEBUG_ONLY(
-      if( ::blocksizeStack.empty() )
-          LogicError("Attempted to extract blocksize from empty stack");
-    )
-    return ::blocksizeStack.top();
-}
+Int Blocksize() { return CurrentContext().Blocksize(); }
 
 void SetBlocksize( Int blocksize )
 {
+    Context& context = CurrentContext();
+    auto& blocksizeStack = context.ModifyBlocksizes();
     EL_DEBUG_ONLY(
-      if( ::blocksizeStack.empty() )
+      if( blocksizeStack.empty() )
           LogicError("Attempted to set blocksize at top of empty stack");
     )
-    ::blocksizeStack.top() = blocksize;
+    blocksizeStack.top() = blocksize;
+    if( blocksizeStack.size() == 1 )
+        context.explicitBlocksize = true;
+    context.PublishBlocksizes();
 }
 
 void PushBlocksizeStack( Int blocksize )
-{ ::blocksizeStack.push( blocksize ); }
+{
+    Context& context = CurrentContext();
+    context.ModifyBlocksizes().push( blocksize );
+    context.PublishBlocksizes();
+}
 
 void PopBlocksizeStack()
 {
+    Context& context = CurrentContext();
+    auto& blocksizeStack = context.ModifyBlocksizes();
     EL_DEBUG_ONLY(
-      if( ::blocksizeStack.empty() )
+      if( blocksizeStack.empty() )
           LogicError("Attempted to pop an empty blocksize stack");
     )
-    ::blocksizeStack.pop();
+    blocksizeStack.pop();
+    context.PublishBlocksizes();
 }
 
+BlocksizeGuard::BlocksizeGuard( Int blocksize )
+{ PushBlocksizeStack( blocksize ); }
+
+BlocksizeGuard::~BlocksizeGuard()
+{ PopBlocksizeStack(); }
+
 void EmptyBlocksizeStack()
 {
-    while( ! ::blocksizeStack.empty() )
-        ::blocksizeStack.pop();
+    Context& context = CurrentContext();
+    auto& blocksizeStack = context.ModifyBlocksizes();
+    while( ! blocksizeStack.empty() )
+        blocksizeStack.pop();
+    context.explicitBlocksize = false;
+    context.PublishBlocksizes();
+}
+
+bool TunedBlocksizesActive()
+{ return CurrentContext().TunedBlocksizesActive(); }
+
+template<typename T>
+Int TunedBlocksize( const string& routine, int gridHeight, int gridWidth )
+{
+    if( TunedBlocksizesActive() )
+    {
+        std::lock_guard<std::mutex> guard( ::tunedBlocksizesMutex );
+        auto it = ::tunedBlocksizes.find
+          ( TunedKey(routine,TypeName<T>(),gridHeight,gridWidth) );
+        if( it != ::tunedBlocksizes.end() )
+            return it->second;
+    }
+    return Blocksize();
+}
+
+template<typename T>
+void SetTunedBlocksize
+( const string& routine, int gridHeight, int gridWidth, Int blocksize )
+{
+    if( blocksize < 1 )
+        LogicError("Tuned blocksizes must be positive");
+    std::lock_guard<std::mutex> guard( ::tunedBlocksizesMutex );
+    ::tunedBlocksizes[TunedKey(routine,TypeName<T>(),gridHeight,gridWidth)] =
+      blocksize;
+}
+
+void ClearTunedBlocksizes()
+{
+    std::lock_guard<std::mutex> guard( ::tunedBlocksizesMutex );
+    ::tunedBlocksizes.clear();
+}
+
+void LoadTunedBlocksizes( const string& filename, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    // Read the file on the root and broadcast its contents
+    string contents;
+    int fileSize = -1;
+    if( mpi::Rank(comm) == 0 )
+    {
+        std::ifstream file( filename.c_str() );
+        if( file.is_open() )
+        {
+            std::stringstream buffer;
+            buffer << file.rdbuf();
+            contents = buffer.str();
+            fileSize = contents.size();
+        }
+    }
+    mpi::Broadcast( fileSize, 0, comm );
+    if( fileSize < 0 )
+        RuntimeError("Could not open ",filename);
+    contents.resize( fileSize );
+    mpi::Broadcast
+    ( reinterpret_cast<byte*>(&contents[0]), fileSize, 0, comm );
+
+    std::stringstream stream( contents );
+    string line;
+    while( std::getline( stream, line ) )
+    {
+        if( line.empty() || line[0] == '#' )
+            continue;
+        std::stringstream lineStream( line );
+        string routine, typeName;
+        int gridHeight, gridWidth;
+        Int blocksize;
+        if( !(lineStream >> routine >> typeName >> gridHeight >> gridWidth
+                         >> blocksize) || blocksize < 1 )
+            RuntimeError("Invalid line in ",filename,": ",line);
+        std::lock_guard<std::mutex> guard( ::tunedBlocksizesMutex );
+        ::tunedBlocksizes[TunedKey(routine,typeName,gridHeight,gridWidth)] =
+          blocksize;
+    }
+}
+
+void SaveTunedBlocksizes( const string& filename, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    if( mpi::Rank(comm) != 0 )
+        return;
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file << "# routine datatype gridHeight gridWidth blocksize\n";
+    std::lock_guard<std::mutex> guard( ::tunedBlocksizesMutex );
+    for( const auto& entry : ::tunedBlocksizes )
+        file << entry.first << " " << entry.second << "\n";
 }
 
 template<typename T>
@@ -95,6 +210,10 @@ Int LocalTrr2kBlocksize()
 { return LocalTrr2kBlocksizeHelper<T>::value; }
 
 #define PROTO(T) \
+  template Int TunedBlocksize<T> \
+  ( const string& routine, int gridHeight, int gridWidth ); \
+  template void SetTunedBlocksize<T> \
+  ( const string& routine, int gridHeight, int gridWidth, Int blocksize ); \
   template void SetLocalSymvBlocksize<T>( Int blocksize ); \
   template Int LocalSymvBlocksize<T>(); \
   template void SetLocalTrrkBlocksize<T>( Int blocksize ); \
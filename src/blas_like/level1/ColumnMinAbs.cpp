@@ -198,18 +198,16 @@ void ColumnMinAbs
         const Ring* values = A.LockedValueBuffer();
         for( Int i=0; i<ALocalHeight; ++i )
             for( Int e=offsetBuf[i]; e<offsetBuf[i+1]; ++e )
-                sendVals[meta.colOffs[e]] =
-                  Min(sendVals[meta.colOffs[e]],Abs(values[e]));
+                sendVals[meta.ColOff(e)] =
+                  Min(sendVals[meta.ColOff(e)],Abs(values[e]));
     }
 
     // Inject the updates into the network
     // -----------------------------------
     const Int numRecvInds = meta.sendInds.size();
     vector<RealRing> recvVals( numRecvInds );
-    mpi::AllToAll
-    ( sendVals.data(), meta.recvSizes.data(), meta.recvOffs.data(),
-      recvVals.data(), meta.sendSizes.data(), meta.sendOffs.data(),
-      A.Grid().Comm() );
+    meta.NeighborExchange
+    ( sendVals.data(), recvVals.data(), 1, true, A.Grid().Comm() );
 
     // Form the maxima over all the values received
     // --------------------------------------------
@@ -258,8 +256,8 @@ void ColumnMinAbsNonzero
             {
                 const RealRing absVal = Abs(values[e]);
                 if( absVal > RealRing(0) )
-                    sendVals[meta.colOffs[e]] =
-                      Min(sendVals[meta.colOffs[e]],absVal);
+                    sendVals[meta.ColOff(e)] =
+                      Min(sendVals[meta.ColOff(e)],absVal);
             }
         }
     }
@@ -268,10 +266,8 @@ void ColumnMinAbsNonzero
     // -----------------------------------
     const Int numRecvInds = meta.sendInds.size();
     vector<RealRing> recvVals( numRecvInds );
-    mpi::AllToAll
-    ( sendVals.data(), meta.recvSizes.data(), meta.recvOffs.data(),
-      recvVals.data(), meta.sendSizes.data(), meta.sendOffs.data(),
-      A.Grid().Comm() );
+    meta.NeighborExchange
+    ( sendVals.data(), recvVals.data(), 1, true, A.Grid().Comm() );
 
     // Form the maxima over all the values received
     // --------------------------------------------
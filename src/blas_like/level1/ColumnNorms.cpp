@@ -192,42 +192,40 @@ void ColumnTwoNorms
     Zero( norms );
     A.InitializeMultMeta();
     const auto& meta = A.LockedDistGraph().multMeta;
-    // Pack the send values
-    // --------------------
-    vector<Real> sendScales( meta.numRecvInds, 0 ),
-                 sendScaledSquares( meta.numRecvInds, 1 );
+    // Pack the (scale,scaledSquare) pairs
+    // -----------------------------------
+    vector<Real> sendPairs( 2*meta.numRecvInds );
+    for( Int jOff=0; jOff<meta.numRecvInds; ++jOff )
+    {
+        sendPairs[2*jOff] = 0;
+        sendPairs[2*jOff+1] = 1;
+    }
     const Int numEntries = A.NumLocalEntries();
     const Field* values = A.LockedValueBuffer();
     for( Int e=0; e<numEntries; ++e )
     {
-        const Int jOff = meta.colOffs[e];
+        const Int jOff = meta.ColOff(e);
         UpdateScaledSquare
-        ( values[e], sendScales[jOff], sendScaledSquares[jOff] );
+        ( values[e], sendPairs[2*jOff], sendPairs[2*jOff+1] );
     }
 
-    // Transmit the scales
-    // -------------------
+    // Transmit the scales and scaled squares together
+    // -----------------------------------------------
     const Int numRecvInds = meta.sendInds.size();
-    vector<Real> recvScales( numRecvInds ), recvScaledSquares( numRecvInds );
-    mpi::AllToAll
-    ( sendScales.data(), meta.recvSizes.data(), meta.recvOffs.data(),
-      recvScales.data(), meta.sendSizes.data(), meta.sendOffs.data(),
-      A.Grid().Comm() );
-    mpi::AllToAll
-    ( sendScaledSquares.data(), meta.recvSizes.data(), meta.recvOffs.data(),
-      recvScaledSquares.data(), meta.sendSizes.data(), meta.sendOffs.data(),
-      A.Grid().Comm() );
+    vector<Real> recvPairs( 2*numRecvInds );
+    meta.NeighborExchange
+    ( sendPairs.data(), recvPairs.data(), 2, true, A.Grid().Comm() );
 
     // Equilibrate the scales
     // ----------------------
     const Int firstLocalRow = norms.FirstLocalRow();
     const Int localHeight = norms.LocalHeight();
-    vector<Real> scales(localHeight,0), squaredScales(localHeight,1);
+    vector<Real> scales(localHeight,0);
     for( Int s=0; s<numRecvInds; ++s )
     {
         const Int i = meta.sendInds[s];
         const Int iLoc = i - firstLocalRow;
-        scales[iLoc] = Max( scales[iLoc], recvScales[s] );
+        scales[iLoc] = Max( scales[iLoc], recvPairs[2*s] );
     }
 
     // Combine the equilibrated scaled squares into norms
@@ -239,9 +237,8 @@ void ColumnTwoNorms
         const Int iLoc = i - firstLocalRow;
         if( scales[iLoc] != Real(0) )
         {
-            Real relScale = recvScales[s] / scales[iLoc];
-            recvScaledSquares[s] *= relScale*relScale;
-            normsLoc(iLoc) += recvScaledSquares[s];
+            const Real relScale = recvPairs[2*s] / scales[iLoc];
+            normsLoc(iLoc) += recvPairs[2*s+1]*relScale*relScale;
         }
     }
 
@@ -270,17 +267,15 @@ void ColumnMaxNorms
     const Int numEntries = A.NumLocalEntries();
     const Field* values = A.LockedValueBuffer();
     for( Int e=0; e<numEntries; ++e )
-        sendVals[meta.colOffs[e]] =
-          Max(sendVals[meta.colOffs[e]],Abs(values[e]));
+        sendVals[meta.ColOff(e)] =
+          Max(sendVals[meta.ColOff(e)],Abs(values[e]));
 
     // Inject the updates into the network
     // -----------------------------------
     const Int numRecvInds = meta.sendInds.size();
     vector<Real> recvVals( numRecvInds );
-    mpi::AllToAll
-    ( sendVals.data(), meta.recvSizes.data(), meta.recvOffs.data(),
-      recvVals.data(), meta.sendSizes.data(), meta.sendOffs.data(),
-      A.Grid().Comm() );
+    meta.NeighborExchange
+    ( sendVals.data(), recvVals.data(), 1, true, A.Grid().Comm() );
 
     // Form the maxima over all the values received
     // --------------------------------------------
@@ -8,9 +8,94 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+#include <atomic>
+#include <mutex>
+
+namespace {
+
+std::atomic<El::Int> numGeneralPurposeCopies(0);
+
+bool redistDiagnosticsEnabled = false;
+bool preAlignInputs = false;
+
+// The events keyed by their kind, routine, and call site
+typedef std::tuple<El::string,El::string,El::string> RedistKey;
+std::map<RedistKey,El::RedistEvent> redistEvents;
+std::mutex redistEventsMutex;
+
+}
 
 namespace El {
 
+namespace copy {
+
+Int NumGeneralPurposeCopies() { return ::numGeneralPurposeCopies; }
+void CountGeneralPurposeCopy() { ++::numGeneralPurposeCopies; }
+
+} // namespace copy
+
+void EnableRedistDiagnostics( bool enable )
+{ ::redistDiagnosticsEnabled = enable; }
+
+bool RedistDiagnosticsEnabled() EL_NO_EXCEPT
+{ return ::redistDiagnosticsEnabled; }
+
+void RecordRedistEvent
+( const char* kind, const string& routine, double numBytes )
+{
+    const string callSite = CurrentRegionPath();
+    std::lock_guard<std::mutex> guard( ::redistEventsMutex );
+    RedistEvent& event =
+      ::redistEvents[std::make_tuple(string(kind),routine,callSite)];
+    if( event.numCalls == 0 )
+    {
+        event.kind = kind;
+        event.routine = routine;
+        event.callSite = callSite;
+    }
+    ++event.numCalls;
+    event.numBytes += numBytes;
+}
+
+void ResetRedistDiagnostics()
+{
+    std::lock_guard<std::mutex> guard( ::redistEventsMutex );
+    ::redistEvents.clear();
+}
+
+vector<RedistEvent> RedistEvents()
+{
+    std::lock_guard<std::mutex> guard( ::redistEventsMutex );
+    vector<RedistEvent> events;
+    for( const auto& entry : ::redistEvents )
+        events.push_back( entry.second );
+    return events;
+}
+
+void PrintRedistDiagnostics( ostream& os )
+{
+    const GemmCostModel& model = GetGemmCostModel();
+    auto predictedTime = [&]( const RedistEvent& event )
+      { return event.numCalls*model.latency +
+               event.numBytes*model.inverseBandwidth; };
+    auto events = RedistEvents();
+    std::sort
+    ( events.begin(), events.end(),
+      [&]( const RedistEvent& a, const RedistEvent& b )
+      { return predictedTime(a) > predictedTime(b); } );
+    os << "kind, routine, call site: calls, bytes, predicted [s]\n";
+    for( const auto& event : events )
+        os << event.kind << ", " << event.routine << ", "
+           << ( event.callSite.empty() ? "<no region>" : event.callSite )
+           << ": " << event.numCalls << ", " << event.numBytes << ", "
+           << predictedTime(event) << "\n";
+    os.flush();
+}
+
+void SetPreAlignInputs( bool preAlign ) { ::preAlignInputs = preAlign; }
+bool PreAlignInputs() { return ::preAlignInputs; }
+
 void Copy( const Graph& A, Graph& B )
 {
     EL_DEBUG_CSE
@@ -0,0 +1,210 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/matrices.hpp>
+#include "./FourStep.hpp"
+
+namespace El {
+
+namespace fft {
+
+// The unnormalized forward transform, x(k) := sum_j x(j) exp(-2 pi i j k/n),
+// of a fixed length. Powers of two are handled by an iterative radix-2
+// algorithm, and other lengths are handled by Bluestein's algorithm, i.e.,
+// by writing j k = (j^2 + k^2 - (k-j)^2)/2 so that the transform is a
+// (chirp-modulated) convolution which can be padded to a power of two.
+template<typename Real>
+class Plan
+{
+public:
+    explicit Plan( Int n )
+    : n_(n)
+    {
+        EL_DEBUG_CSE
+        radix2Length_ = n_;
+        if( n_ <= 1 )
+            return;
+        const Real pi = 4*Atan( Real(1) );
+        radix2Length_ = 1;
+        if( (n_ & (n_-1)) == 0 )
+            radix2Length_ = n_;
+        else
+            while( radix2Length_ < 2*n_-1 )
+                radix2Length_ *= 2;
+
+        const Int L = radix2Length_;
+        twiddles_.resize( L/2 );
+        for( Int l=0; l<L/2; ++l )
+        {
+            const Real theta = -2*pi*l/L;
+            twiddles_[l] = Complex<Real>(Cos(theta),Sin(theta));
+        }
+
+        if( L != n_ )
+        {
+            // chirp(j) = exp(-pi i j^2/n), where j^2 is reduced modulo 2n
+            // to preserve the accuracy of the angles
+            chirp_.resize( n_ );
+            Int jSquaredMod = 0;
+            for( Int j=0; j<n_; ++j )
+            {
+                const Real theta = -pi*jSquaredMod/n_;
+                chirp_[j] = Complex<Real>(Cos(theta),Sin(theta));
+                jSquaredMod = (jSquaredMod + 2*j+1) % (2*n_);
+            }
+            // The transform of the (cyclically-padded) conjugated chirp
+            filter_.assign( L, Complex<Real>(0) );
+            filter_[0] = Conj(chirp_[0]);
+            for( Int j=1; j<n_; ++j )
+                filter_[j] = filter_[L-j] = Conj(chirp_[j]);
+            Radix2( filter_.data() );
+        }
+    }
+
+    // Overwrite the contiguous sequence x with its transform, where 'work' is
+    // (re)sized as needed
+    void Apply( Complex<Real>* x, vector<Complex<Real>>& work ) const
+    {
+        if( n_ <= 1 )
+            return;
+        const Int L = radix2Length_;
+        if( L == n_ )
+        {
+            Radix2( x );
+            return;
+        }
+        work.assign( L, Complex<Real>(0) );
+        for( Int j=0; j<n_; ++j )
+            work[j] = x[j]*chirp_[j];
+        Radix2( work.data() );
+        for( Int l=0; l<L; ++l )
+            work[l] *= filter_[l];
+        // Invert the padded transform via conjugation
+        for( Int l=0; l<L; ++l )
+            work[l] = Conj(work[l]);
+        Radix2( work.data() );
+        const Real scale = Real(1) / Real(L);
+        for( Int k=0; k<n_; ++k )
+            x[k] = chirp_[k]*Conj(work[k])*scale;
+    }
+
+private:
+    Int n_, radix2Length_;
+    vector<Complex<Real>> twiddles_, chirp_, filter_;
+
+    void Radix2( Complex<Real>* x ) const
+    {
+        const Int L = radix2Length_;
+        for( Int i=1, j=0; i<L; ++i )
+        {
+            Int bit = L >> 1;
+            for( ; j & bit; bit >>= 1 )
+                j ^= bit;
+            j ^= bit;
+            if( i < j )
+                std::swap( x[i], x[j] );
+        }
+        for( Int len=2; len<=L; len*=2 )
+        {
+            const Int half = len/2;
+            const Int stride = L/len;
+            for( Int i=0; i<L; i+=len )
+            {
+                for( Int j=0; j<half; ++j )
+                {
+                    const Complex<Real> u = x[i+j];
+                    const Complex<Real> v = x[i+j+half]*twiddles_[j*stride];
+                    x[i+j] = u + v;
+                    x[i+j+half] = u - v;
+                }
+            }
+        }
+    }
+};
+
+// Apply the unnormalized forward transform to each column of X
+template<typename Real>
+void Unnormalized( Matrix<Complex<Real>>& X )
+{
+    EL_DEBUG_CSE
+    const Int n = X.Height();
+    const Int width = X.Width();
+    if( n <= 1 || width == 0 )
+        return;
+    const Plan<Real> plan( n );
+    vector<Complex<Real>> work;
+    for( Int j=0; j<width; ++j )
+        plan.Apply( X.Buffer(0,j), work );
+}
+
+} // namespace fft
+
+template<typename Real>
+void FFT( Matrix<Complex<Real>>& X, bool adjoint )
+{
+    EL_DEBUG_CSE
+    const Int n = X.Height();
+    if( n == 0 )
+        return;
+    // The inverse transform is conj(F conj(x))
+    if( adjoint )
+        Conjugate( X );
+    fft::Unnormalized( X );
+    if( adjoint )
+        Conjugate( X );
+    X *= Complex<Real>(Real(1)/Sqrt(Real(n)));
+}
+
+template<typename Real>
+void FFT( DistMultiVec<Complex<Real>>& X, bool adjoint )
+{
+    EL_DEBUG_CSE
+    const Int n = X.Height();
+    if( n == 0 )
+        return;
+    if( X.Grid().Size() == 1 )
+    {
+        FFT( X.Matrix(), adjoint );
+        return;
+    }
+    auto& XLoc = X.Matrix();
+    if( adjoint )
+        Conjugate( XLoc );
+
+    const Int n1 = four_step::BalancedDivisor( n );
+    const Real pi = 4*Atan( Real(1) );
+    auto transform =
+      []( Matrix<Complex<Real>>& G ) { fft::Unnormalized( G ); };
+    // Multiply by exp(-2 pi i j1 k2/n), where j1 k2 < n
+    auto twiddle =
+      [&]( Int j1, Int k2, Complex<Real>& value )
+      {
+          const Real theta = -2*pi*(j1*k2)/n;
+          value *= Complex<Real>(Cos(theta),Sin(theta));
+      };
+    four_step::Apply( X, n1, transform, transform, twiddle, true );
+
+    if( adjoint )
+        Conjugate( XLoc );
+    XLoc *= Complex<Real>(Real(1)/Sqrt(Real(n)));
+}
+
+#define PROTO(Real) \
+  template void FFT( Matrix<Complex<Real>>& X, bool adjoint ); \
+  template void FFT( DistMultiVec<Complex<Real>>& X, bool adjoint );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace El
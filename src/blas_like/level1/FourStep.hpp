@@ -0,0 +1,147 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_FOURSTEP_HPP
+#define EL_BLAS_FOURSTEP_HPP
+
+namespace El {
+namespace four_step {
+
+// The largest divisor of n which is at most sqrt(n)
+inline Int BalancedDivisor( Int n )
+{
+    Int n1 = 1;
+    for( Int d=1; d*d<=n; ++d )
+        if( n % d == 0 )
+            n1 = d;
+    return n1;
+}
+
+// Apply a transform of length n = n1 n2 to each column of X, where each
+// column, x, is viewed as the n1 x n2 column-major matrix X(j1,j2) =
+// x(j1+n1*j2):
+//
+//  1. 'transform2' is applied to every row of X (i.e., to each column of its
+//     argument, which has height n2),
+//  2. 'twiddle( j1, k2, value )' is applied to each resulting entry,
+//  3. 'transform1' is applied to every column (of height n1), and
+//  4. entry (k1,k2) becomes entry k2+n2*k1 of the result if 'transposed' and
+//     entry k1+n1*k2 otherwise.
+//
+// Each of the first three phases is preceded by an all-to-all exchange of
+// the entries so that the transforms are always local.
+template<typename T,class Transform1,class Transform2,class Twiddle>
+void Apply
+( DistMultiVec<T>& X,
+  Int n1,
+  const Transform1& transform1,
+  const Transform2& transform2,
+  const Twiddle& twiddle,
+  bool transposed )
+{
+    EL_DEBUG_CSE
+    const Int n = X.Height();
+    const Int width = X.Width();
+    if( n == 0 || width == 0 )
+        return;
+    const Int n2 = n / n1;
+    const El::Grid& grid = X.Grid();
+
+    // R(j1,j2+n2*l) := X(j1+n1*j2,l)
+    // ------------------------------
+    DistMultiVec<T> R(grid);
+    Zeros( R, n1, n2*width );
+    {
+        const auto& XLoc = X.LockedMatrix();
+        const Int localHeight = XLoc.Height();
+        R.Reserve( localHeight*width );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = X.GlobalRow(iLoc);
+            const Int j1 = i % n1;
+            const Int j2 = i / n1;
+            for( Int l=0; l<width; ++l )
+                R.QueueUpdate( j1, j2+n2*l, XLoc(iLoc,l) );
+        }
+        R.ProcessQueues();
+    }
+
+    // G(j2,iLoc+rLoc*l) := R(iLoc,j2+n2*l), transform, and twiddle
+    // ------------------------------------------------------------
+    Matrix<T> G;
+    const Int rLoc = R.LocalHeight();
+    {
+        const auto& RLoc = R.LockedMatrix();
+        Zeros( G, n2, rLoc*width );
+        for( Int l=0; l<width; ++l )
+            for( Int j2=0; j2<n2; ++j2 )
+                for( Int iLoc=0; iLoc<rLoc; ++iLoc )
+                    G(j2,iLoc+rLoc*l) = RLoc(iLoc,j2+n2*l);
+    }
+    transform2( G );
+    for( Int iLoc=0; iLoc<rLoc; ++iLoc )
+    {
+        const Int j1 = R.GlobalRow(iLoc);
+        for( Int l=0; l<width; ++l )
+            for( Int k2=0; k2<n2; ++k2 )
+                twiddle( j1, k2, G(k2,iLoc+rLoc*l) );
+    }
+
+    // C(k2,j1+n1*l) := G(k2,iLoc+rLoc*l)
+    // ----------------------------------
+    DistMultiVec<T> C(grid);
+    Zeros( C, n2, n1*width );
+    C.Reserve( n2*rLoc*width );
+    for( Int iLoc=0; iLoc<rLoc; ++iLoc )
+    {
+        const Int j1 = R.GlobalRow(iLoc);
+        for( Int l=0; l<width; ++l )
+            for( Int k2=0; k2<n2; ++k2 )
+                C.QueueUpdate( k2, j1+n1*l, G(k2,iLoc+rLoc*l) );
+    }
+    R.Empty();
+    G.Empty();
+    C.ProcessQueues();
+
+    // H(j1,kLoc+cLoc*l) := C(kLoc,j1+n1*l) and transform
+    // --------------------------------------------------
+    Matrix<T> H;
+    const Int cLoc = C.LocalHeight();
+    {
+        const auto& CLoc = C.LockedMatrix();
+        Zeros( H, n1, cLoc*width );
+        for( Int l=0; l<width; ++l )
+            for( Int j1=0; j1<n1; ++j1 )
+                for( Int kLoc=0; kLoc<cLoc; ++kLoc )
+                    H(j1,kLoc+cLoc*l) = CLoc(kLoc,j1+n1*l);
+    }
+    transform1( H );
+
+    // Return entry (k1,k2) to X
+    // -------------------------
+    Zero( X );
+    X.Reserve( n1*cLoc*width );
+    for( Int kLoc=0; kLoc<cLoc; ++kLoc )
+    {
+        const Int k2 = C.GlobalRow(kLoc);
+        for( Int l=0; l<width; ++l )
+        {
+            for( Int k1=0; k1<n1; ++k1 )
+            {
+                const Int k = ( transposed ? k2+n2*k1 : k1+n1*k2 );
+                X.QueueUpdate( k, l, H(k1,kLoc+cLoc*l) );
+            }
+        }
+    }
+    X.ProcessQueues();
+}
+
+} // namespace four_step
+} // namespace El
+
+#endif // ifndef EL_BLAS_FOURSTEP_HPP
@@ -11,8 +11,64 @@
 
 namespace El {
 
+// Returns true if scale^2 scaledSquare can be formed without overflow or a
+// loss of relative accuracy from underflow
 template<typename Real>
-void NormsFromScaledSquares
+bool SafeToSquare( const Real& scale, const Real& scaledSquare )
+{
+    if( scale == Real(0) )
+        return true;
+    const Real square = scale*scale*scaledSquare;
+    return limits::IsFinite( square ) &&
+           square >= limits::SafeMin<Real>()/limits::Epsilon<Real>();
+}
+
+// Attempt to sum the squares of the local norms with a single AllReduce,
+// which succeeds unless a local or global squared norm is out of range; the
+// number of unsafe local squares is reduced alongside them so that every
+// process makes the same decision.
+template<typename Real>
+bool TrySumSquares
+( const Matrix<Real>& localScales,
+  const Matrix<Real>& localScaledSquares,
+        Matrix<Real>& normsLoc,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int nLocal = localScales.Height();
+    vector<Real> squares( nLocal+1 );
+    Real numUnsafe = 0;
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+    {
+        const Real scale = localScales(jLoc);
+        const Real scaledSquare = localScaledSquares(jLoc);
+        if( SafeToSquare( scale, scaledSquare ) )
+            squares[jLoc] = scale*scale*scaledSquare;
+        else
+        {
+            squares[jLoc] = 0;
+            numUnsafe += 1;
+        }
+    }
+    squares[nLocal] = numUnsafe;
+    mpi::AllReduce( squares.data(), nLocal+1, mpi::SUM, comm );
+    if( squares[nLocal] != Real(0) )
+        return false;
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+    {
+        const Real square = squares[jLoc];
+        if( square != Real(0) && !SafeToSquare( Real(1), square ) )
+            return false;
+    }
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+        normsLoc(jLoc) = Sqrt(squares[jLoc]);
+    return true;
+}
+
+// Combine the local scaled squares by equilibrating them against the maximum
+// local scale of each entry, which requires a MAX and a SUM reduction
+template<typename Real>
+void EquilibratedNormsFromScaledSquares
 ( const Matrix<Real>& localScales,
         Matrix<Real>& localScaledSquares,
         Matrix<Real>& normsLoc,
@@ -49,4 +105,18 @@ void NormsFromScaledSquares
         normsLoc(jLoc) = scales(jLoc)*Sqrt(scaledSquares(jLoc));
 }
 
+template<typename Real>
+void NormsFromScaledSquares
+( const Matrix<Real>& localScales,
+        Matrix<Real>& localScaledSquares,
+        Matrix<Real>& normsLoc,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    if( TrySumSquares( localScales, localScaledSquares, normsLoc, comm ) )
+        return;
+    EquilibratedNormsFromScaledSquares
+    ( localScales, localScaledSquares, normsLoc, comm );
+}
+
 } // namespace El
@@ -0,0 +1,319 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include "./NormsFromScaledSquares.hpp"
+
+namespace El {
+
+namespace {
+
+// The number of rows of each column traversed for every queued request before
+// moving on to the next block so that shared operands remain in cache
+const Int reductionBlockSize = 512;
+
+} // anonymous namespace
+
+template<typename Field>
+void ReductionBatch<Field>::CheckConformal
+( const AbstractDistMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    if( multiVecModel_ != nullptr )
+        LogicError("Cannot mix DistMatrix and DistMultiVec reductions");
+    if( distModel_ == nullptr )
+    {
+        distModel_ = &A;
+        return;
+    }
+    if( A.Height() != distModel_->Height() ||
+        A.Width() != distModel_->Width() )
+        LogicError
+        ("Queued a ",A.Height()," x ",A.Width()," matrix into a batch of ",
+         distModel_->Height()," x ",distModel_->Width()," matrices");
+    if( A.DistData() != distModel_->DistData() )
+        LogicError("Batched matrices must share a distribution and alignment");
+}
+
+template<typename Field>
+void ReductionBatch<Field>::CheckConformal( const DistMultiVec<Field>& A )
+{
+    EL_DEBUG_CSE
+    if( distModel_ != nullptr )
+        LogicError("Cannot mix DistMatrix and DistMultiVec reductions");
+    if( multiVecModel_ == nullptr )
+    {
+        multiVecModel_ = &A;
+        return;
+    }
+    // Each row of a DistMultiVec is owned by a single process, so the local
+    // contributions of multivectors of any size may be summed over the grid
+    if( !mpi::Congruent( A.Grid().Comm(), multiVecModel_->Grid().Comm() ) )
+        LogicError("Batched multivectors must have congruent grids");
+}
+
+template<typename Field>
+Int ReductionBatch<Field>::QueueDot
+( const AbstractDistMatrix<Field>& A, const AbstractDistMatrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    CheckConformal( A );
+    CheckConformal( B );
+    executed_ = false;
+    dotLefts_.push_back( &A.LockedMatrix() );
+    dotRights_.push_back( &B.LockedMatrix() );
+    return dotLefts_.size()-1;
+}
+
+template<typename Field>
+Int ReductionBatch<Field>::QueueDot
+( const DistMultiVec<Field>& A, const DistMultiVec<Field>& B )
+{
+    EL_DEBUG_CSE
+    CheckConformal( A );
+    CheckConformal( B );
+    if( A.Height() != B.Height() || A.Width() != B.Width() ||
+        A.FirstLocalRow() != B.FirstLocalRow() ||
+        A.LocalHeight() != B.LocalHeight() )
+        LogicError
+        ("Cannot form the inner product of a ",A.Height()," x ",A.Width(),
+         " and a ",B.Height()," x ",B.Width()," multivector with different "
+         "row ownership");
+    executed_ = false;
+    dotLefts_.push_back( &A.LockedMatrix() );
+    dotRights_.push_back( &B.LockedMatrix() );
+    return dotLefts_.size()-1;
+}
+
+template<typename Field>
+Int ReductionBatch<Field>::QueueNrm2( const AbstractDistMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    CheckConformal( A );
+    executed_ = false;
+    nrm2Operands_.push_back( &A.LockedMatrix() );
+    return nrm2Operands_.size()-1;
+}
+
+template<typename Field>
+Int ReductionBatch<Field>::QueueNrm2( const DistMultiVec<Field>& A )
+{
+    EL_DEBUG_CSE
+    CheckConformal( A );
+    executed_ = false;
+    nrm2Operands_.push_back( &A.LockedMatrix() );
+    return nrm2Operands_.size()-1;
+}
+
+template<typename Field>
+void ReductionBatch<Field>::LocalReductions
+( Field* localDots,
+  Base<Field>* localScales,
+  Base<Field>* localScaledSquares ) const
+{
+    EL_DEBUG_CSE
+    const Int numDots = dotLefts_.size();
+    const Int numNorms = nrm2Operands_.size();
+    for( Int k=0; k<numDots; ++k )
+        localDots[k] = 0;
+    for( Int k=0; k<numNorms; ++k )
+    {
+        localScales[k] = 0;
+        localScaledSquares[k] = 1;
+    }
+
+    // Multivectors need not share a shape, so each operand is clipped to its
+    // own local extent while the row blocks are traversed
+    Int maxLocalHeight=0, maxLocalWidth=0;
+    for( Int k=0; k<numDots; ++k )
+    {
+        maxLocalHeight = Max( maxLocalHeight, dotLefts_[k]->Height() );
+        maxLocalWidth = Max( maxLocalWidth, dotLefts_[k]->Width() );
+    }
+    for( Int k=0; k<numNorms; ++k )
+    {
+        maxLocalHeight = Max( maxLocalHeight, nrm2Operands_[k]->Height() );
+        maxLocalWidth = Max( maxLocalWidth, nrm2Operands_[k]->Width() );
+    }
+    for( Int jLoc=0; jLoc<maxLocalWidth; ++jLoc )
+    {
+        for( Int iStart=0; iStart<maxLocalHeight; iStart+=reductionBlockSize )
+        {
+            for( Int k=0; k<numDots; ++k )
+            {
+                const Matrix<Field>& A = *dotLefts_[k];
+                const Int iEnd = Min( iStart+reductionBlockSize, A.Height() );
+                if( jLoc >= A.Width() || iStart >= iEnd )
+                    continue;
+                const Field* EL_RESTRICT aCol = A.LockedBuffer(0,jLoc);
+                const Field* EL_RESTRICT bCol =
+                  dotRights_[k]->LockedBuffer(0,jLoc);
+                Field partial = 0;
+                for( Int iLoc=iStart; iLoc<iEnd; ++iLoc )
+                    partial += Conj(aCol[iLoc])*bCol[iLoc];
+                localDots[k] += partial;
+            }
+            for( Int k=0; k<numNorms; ++k )
+            {
+                const Matrix<Field>& A = *nrm2Operands_[k];
+                const Int iEnd = Min( iStart+reductionBlockSize, A.Height() );
+                if( jLoc >= A.Width() || iStart >= iEnd )
+                    continue;
+                const Field* EL_RESTRICT aCol = A.LockedBuffer(0,jLoc);
+                for( Int iLoc=iStart; iLoc<iEnd; ++iLoc )
+                    UpdateScaledSquare
+                    ( aCol[iLoc], localScales[k], localScaledSquares[k] );
+            }
+        }
+    }
+}
+
+template<typename Field>
+void ReductionBatch<Field>::CombineReductions
+( const vector<Field>& localDots,
+  const Matrix<Base<Field>>& localScales,
+        Matrix<Base<Field>>& localScaledSquares,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int numDots = localDots.size();
+    const Int numNorms = localScales.Height();
+
+    // Pack the inner products, the squared norms (when they may be safely
+    // formed), and the number of unsafe squares into a single buffer
+    vector<Field> buffer( numDots+numNorms+1 );
+    for( Int k=0; k<numDots; ++k )
+        buffer[k] = localDots[k];
+    Real numUnsafe = 0;
+    for( Int k=0; k<numNorms; ++k )
+    {
+        const Real scale = localScales(k);
+        const Real scaledSquare = localScaledSquares(k);
+        if( SafeToSquare( scale, scaledSquare ) )
+            buffer[numDots+k] = scale*scale*scaledSquare;
+        else
+        {
+            buffer[numDots+k] = 0;
+            numUnsafe += 1;
+        }
+    }
+    buffer[numDots+numNorms] = numUnsafe;
+    mpi::AllReduce( buffer.data(), numDots+numNorms+1, mpi::SUM, comm );
+
+    for( Int k=0; k<numDots; ++k )
+        dots_[k] = buffer[k];
+
+    bool safe = ( RealPart(buffer[numDots+numNorms]) == Real(0) );
+    for( Int k=0; k<numNorms; ++k )
+    {
+        const Real square = RealPart(buffer[numDots+k]);
+        if( square != Real(0) && !SafeToSquare( Real(1), square ) )
+            safe = false;
+    }
+    if( safe )
+    {
+        for( Int k=0; k<numNorms; ++k )
+            norms_[k] = Sqrt(RealPart(buffer[numDots+k]));
+    }
+    else
+    {
+        Matrix<Real> normsMat( numNorms, 1 );
+        EquilibratedNormsFromScaledSquares
+        ( localScales, localScaledSquares, normsMat, comm );
+        for( Int k=0; k<numNorms; ++k )
+            norms_[k] = normsMat(k);
+    }
+}
+
+template<typename Field>
+void ReductionBatch<Field>::Execute()
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int numDots = dotLefts_.size();
+    const Int numNorms = nrm2Operands_.size();
+    dots_.resize( numDots );
+    norms_.resize( numNorms );
+    executed_ = true;
+    if( numDots == 0 && numNorms == 0 )
+        return;
+
+    const bool participating =
+      ( distModel_ == nullptr || distModel_->Participating() );
+    if( participating )
+    {
+        vector<Field> localDots( numDots );
+        Matrix<Real> localScales( numNorms, 1 ),
+                     localScaledSquares( numNorms, 1 );
+        LocalReductions
+        ( localDots.data(), localScales.Buffer(), localScaledSquares.Buffer() );
+        mpi::Comm comm =
+          ( distModel_ != nullptr ? distModel_->DistComm()
+                                  : multiVecModel_->Grid().Comm() );
+        CombineReductions( localDots, localScales, localScaledSquares, comm );
+    }
+    if( distModel_ != nullptr )
+    {
+        const int root = distModel_->Root();
+        mpi::Comm crossComm = distModel_->CrossComm();
+        if( numDots > 0 )
+            mpi::Broadcast( dots_.data(), numDots, root, crossComm );
+        if( numNorms > 0 )
+            mpi::Broadcast( norms_.data(), numNorms, root, crossComm );
+    }
+}
+
+template<typename Field>
+Field ReductionBatch<Field>::Dot( Int index ) const
+{
+    EL_DEBUG_CSE
+    if( !executed_ )
+        LogicError("The reduction batch has not been executed");
+    if( index < 0 || index >= Int(dots_.size()) )
+        LogicError("Invalid inner product index ",index);
+    return dots_[index];
+}
+
+template<typename Field>
+Base<Field> ReductionBatch<Field>::Nrm2( Int index ) const
+{
+    EL_DEBUG_CSE
+    if( !executed_ )
+        LogicError("The reduction batch has not been executed");
+    if( index < 0 || index >= Int(norms_.size()) )
+        LogicError("Invalid norm index ",index);
+    return norms_[index];
+}
+
+template<typename Field>
+void ReductionBatch<Field>::Clear()
+{
+    EL_DEBUG_CSE
+    distModel_ = nullptr;
+    multiVecModel_ = nullptr;
+    dotLefts_.clear();
+    dotRights_.clear();
+    nrm2Operands_.clear();
+    dots_.clear();
+    norms_.clear();
+    executed_ = false;
+}
+
+#define PROTO(Field) \
+  template class ReductionBatch<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
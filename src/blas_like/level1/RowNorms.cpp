@@ -21,18 +21,25 @@ void RowTwoNormsHelper
     const Int mLocal = ALoc.Height();
     const Int nLocal = ALoc.Width();
 
+    // Traverse the columns of the (column-major) local matrix so that each
+    // row's running scaled square is updated with unit-stride accesses
     // TODO(poulson): Ensure that NaN's propagate
     Matrix<Real> localScales(mLocal,1 ), localScaledSquares(mLocal,1);
+    Real* EL_RESTRICT scaleBuf = localScales.Buffer();
+    Real* EL_RESTRICT scaledSquareBuf = localScaledSquares.Buffer();
     for( Int iLoc=0; iLoc<mLocal; ++iLoc )
     {
-        Real localScale = 0;
-        Real localScaledSquare = 1;
-        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+        scaleBuf[iLoc] = 0;
+        scaledSquareBuf[iLoc] = 1;
+    }
+    const Field* ABuf = ALoc.LockedBuffer();
+    const Int ALDim = ALoc.LDim();
+    for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+    {
+        const Field* EL_RESTRICT aCol = &ABuf[jLoc*ALDim];
+        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
             UpdateScaledSquare
-            ( ALoc(iLoc,jLoc), localScale, localScaledSquare );
-
-        localScales(iLoc) = localScale;
-        localScaledSquares(iLoc) = localScaledSquare;
+            ( aCol[iLoc], scaleBuf[iLoc], scaledSquareBuf[iLoc] );
     }
 
     NormsFromScaledSquares( localScales, localScaledSquares, normsLoc, comm );
@@ -129,28 +129,27 @@ void RowSwap( AbstractDistMatrix<T>& A, Int to, Int from )
         return;
     if( !A.Participating() )
         return;
+    // The owners are queried through the distribution so that both
+    // element-wise and block-cyclic matrices are supported
     const Int nLocal = A.LocalWidth();
-    const Int colAlign = A.ColAlign();
-    const Int colShift = A.ColShift();
-    const Int colStride = A.ColStride();
-    const Int toMod = Mod(to,colStride);
-    const Int fromMod = Mod(from,colStride);
+    const int colRank = A.ColRank();
+    const int toOwner = A.RowOwner(to);
+    const int fromOwner = A.RowOwner(from);
     T* ABuf = A.Buffer();
     const Int ALDim = A.LDim();
 
-    if( toMod == fromMod )
+    if( toOwner == fromOwner )
     {
-        if( toMod == colShift )
+        if( toOwner == colRank )
         {
-            const Int iLocTo = (to-colShift) / colStride;
-            const Int iLocFrom = (from-colShift) / colStride;
+            const Int iLocTo = A.LocalRow(to);
+            const Int iLocFrom = A.LocalRow(from);
             blas::Swap( nLocal, &ABuf[iLocTo], ALDim, &ABuf[iLocFrom], ALDim );
         }
     }
-    else if( toMod == colShift )
+    else if( toOwner == colRank )
     {
-        const Int iLocTo = (to-colShift) / colStride;
-        const int fromOwner = Mod(from+colAlign,colStride);
+        const Int iLocTo = A.LocalRow(to);
         vector<T> buf;
         FastResize( buf, nLocal );
         for( Int jLoc=0; jLoc<nLocal; ++jLoc )
@@ -159,10 +158,9 @@ void RowSwap( AbstractDistMatrix<T>& A, Int to, Int from )
         for( Int jLoc=0; jLoc<nLocal; ++jLoc )
             ABuf[iLocTo+jLoc*ALDim] = buf[jLoc];
     }
-    else if( fromMod == colShift )
+    else if( fromOwner == colRank )
     {
-        const Int iLocFrom = (from-colShift) / colStride;
-        const int toOwner = Mod(to+colAlign,colStride);
+        const Int iLocFrom = A.LocalRow(from);
         vector<T> buf;
         FastResize( buf, nLocal );
         for( Int jLoc=0; jLoc<nLocal; ++jLoc )
@@ -207,33 +205,31 @@ void ColSwap( AbstractDistMatrix<T>& A, Int to, Int from )
     if( !A.Participating() )
         return;
     const Int mLocal = A.LocalHeight();
-    const Int rowAlign = A.RowAlign();
-    const Int rowShift = A.RowShift();
-    const Int rowStride = A.RowStride();
-    const Int toMod = Mod(to,rowStride);
-    const Int fromMod = Mod(from,rowStride);
+    const int rowRank = A.RowRank();
+    const int toOwner = A.ColOwner(to);
+    const int fromOwner = A.ColOwner(from);
     T* ABuf = A.Buffer();
     const Int ALDim = A.LDim();
 
-    if( toMod == fromMod )
+    if( toOwner == fromOwner )
     {
-        const Int jLocTo = (to-rowShift) / rowStride;
-        const Int jLocFrom = (from-rowShift) / rowStride;
-        if( toMod == rowShift )
+        if( toOwner == rowRank )
+        {
+            const Int jLocTo = A.LocalCol(to);
+            const Int jLocFrom = A.LocalCol(from);
             blas::Swap
             ( mLocal, &ABuf[jLocTo*ALDim], 1, &ABuf[jLocFrom*ALDim], 1 );
+        }
     }
-    else if( toMod == rowShift )
+    else if( toOwner == rowRank )
     {
-        const Int jLocTo = (to-rowShift) / rowStride;
-        const int fromOwner = Mod(from+rowAlign,rowStride);
+        const Int jLocTo = A.LocalCol(to);
         mpi::SendRecv
         ( &ABuf[jLocTo*ALDim], mLocal, fromOwner, fromOwner, A.RowComm() );
     }
-    else if( fromMod == rowShift )
+    else if( fromOwner == rowRank )
     {
-        const Int jLocFrom = (from-rowShift) / rowStride;
-        const int toOwner = Mod(to+rowAlign,rowStride);
+        const Int jLocFrom = A.LocalCol(from);
         mpi::SendRecv
         ( &ABuf[jLocFrom*ALDim], mLocal, toOwner, toOwner, A.RowComm() );
     }
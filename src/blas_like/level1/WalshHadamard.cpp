@@ -0,0 +1,86 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/matrices.hpp>
+#include "./FourStep.hpp"
+
+namespace El {
+
+namespace {
+
+void CheckWalshHadamardHeight( Int n )
+{
+    if( n < 1 || (n & (n-1)) != 0 )
+        LogicError
+        ("The Walsh-Hadamard transform requires a power-of-two height, not ",
+         n);
+}
+
+} // anonymous namespace
+
+template<typename T>
+void WalshHadamard( Matrix<T>& X )
+{
+    EL_DEBUG_CSE
+    const Int n = X.Height();
+    const Int width = X.Width();
+    CheckWalshHadamardHeight( n );
+    // Since H_{2m} = [H_m, H_m; H_m, -H_m], each sweep applies the 2 x 2
+    // butterflies which pair the indices which differ in a single bit
+    for( Int j=0; j<width; ++j )
+    {
+        T* x = X.Buffer(0,j);
+        for( Int half=1; half<n; half*=2 )
+        {
+            for( Int i=0; i<n; i+=2*half )
+            {
+                for( Int k=i; k<i+half; ++k )
+                {
+                    const T u = x[k];
+                    const T v = x[k+half];
+                    x[k] = u + v;
+                    x[k+half] = u - v;
+                }
+            }
+        }
+    }
+}
+
+template<typename T>
+void WalshHadamard( DistMultiVec<T>& X )
+{
+    EL_DEBUG_CSE
+    const Int n = X.Height();
+    CheckWalshHadamardHeight( n );
+    if( X.Grid().Size() == 1 )
+    {
+        WalshHadamard( X.Matrix() );
+        return;
+    }
+    // H_{n1 n2} = H_{n2} (x) H_{n1}, so that H x = vec(H_{n1} X H_{n2}^T)
+    // for the n1 x n2 matrix X with x = vec(X)
+    Int n1 = 1;
+    while( n1*n1*4 <= n )
+        n1 *= 2;
+    auto transform = []( Matrix<T>& G ) { WalshHadamard( G ); };
+    auto twiddle = []( Int j1, Int k2, T& value ) { };
+    four_step::Apply( X, n1, transform, transform, twiddle, false );
+}
+
+#define PROTO(T) \
+  template void WalshHadamard( Matrix<T>& X ); \
+  template void WalshHadamard( DistMultiVec<T>& X );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace El
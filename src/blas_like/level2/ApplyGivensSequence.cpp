@@ -557,12 +557,186 @@ void ApplyGivensSequence
     }
 }
 
+namespace {
+
+// Sequence p applies its r'th rotation during step r+2p so that the rotations
+// applied within any step act upon disjoint pairs of vectors and each block of
+// A is swept by all of the sequences while it remains in cache.
+template<typename F,typename SType>
+void VariableWavefront
+( LeftOrRight side, ForwardOrBackward direction,
+  const Matrix<Base<F>>& cLists,
+  const Matrix<SType>& sLists,
+        Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      const Int numRotsExpected = ( side==LEFT ? A.Height() : A.Width() ) - 1;
+      if( cLists.Height() != Max(numRotsExpected,Int(0)) ||
+          sLists.Height() != cLists.Height() ||
+          sLists.Width() != cLists.Width() )
+          LogicError
+          ("Expected ",numRotsExpected," x ",cLists.Width(),
+           " lists of rotations but were given ",cLists.Height()," x ",
+           cLists.Width()," and ",sLists.Height()," x ",sLists.Width());
+    )
+    typedef Base<F> Real;
+    const Real one(1);
+    const SType zero(0);
+    const Int numRots = ( side==LEFT ? A.Height() : A.Width() ) - 1;
+    const Int length = ( side==LEFT ? A.Width() : A.Height() );
+    const Int numSeqs = cLists.Width();
+    if( numRots <= 0 || length == 0 || numSeqs == 0 )
+        return;
+
+    // For rotations from the left, the rotated vectors are rows of A and the
+    // blocks are sets of columns; from the right, the vectors are columns and
+    // the blocks are sets of rows
+    const Int ALDim = A.LDim();
+    const Int entryStride = ( side==LEFT ? ALDim : 1 );
+    const Int vectorStride = ( side==LEFT ? 1 : ALDim );
+    const Int numSteps = numRots + 2*(numSeqs-1);
+    const Int bsize = Blocksize();
+    F* ABuf = A.Buffer();
+    for( Int blockBeg=0; blockBeg<length; blockBeg+=bsize )
+    {
+        const Int blockLength = Min( bsize, length-blockBeg );
+        F* blockBuf = &ABuf[blockBeg*entryStride];
+        for( Int step=0; step<numSteps; ++step )
+        {
+            for( Int p=0; p<numSeqs && 2*p<=step; ++p )
+            {
+                const Int r = step - 2*p;
+                if( r >= numRots )
+                    continue;
+                const Int k = ( direction==FORWARD ? r : numRots-1-r );
+                const Real& c = cLists(k,p);
+                const SType& s = sLists(k,p);
+                if( c == one && s == zero )
+                    continue;
+                const SType sConj = Conj(s);
+                F* x = &blockBuf[k*vectorStride];
+                F* y = &blockBuf[(k+1)*vectorStride];
+                for( Int e=0; e<blockLength; ++e )
+                {
+                    const F tmp = y[e*entryStride];
+                    y[e*entryStride] = c*tmp - sConj*x[e*entryStride];
+                    x[e*entryStride] = s*tmp +     c*x[e*entryStride];
+                }
+            }
+        }
+    }
+}
+
+} // anonymous namespace
+
+template<typename F,typename>
+void ApplyGivensSequences
+( LeftOrRight side, ForwardOrBackward direction,
+  const Matrix<Base<F>>& cLists,
+  const Matrix<F>& sLists,
+  Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    VariableWavefront( side, direction, cLists, sLists, A );
+}
+
+template<typename F>
+void ApplyGivensSequences
+( LeftOrRight side, ForwardOrBackward direction,
+  const Matrix<Base<F>>& cLists,
+  const Matrix<Base<F>>& sLists,
+  Matrix<F>& A )
+{
+    EL_DEBUG_CSE
+    VariableWavefront( side, direction, cLists, sLists, A );
+}
+
+template<typename F>
+GivensSequenceBuffer<F>::GivensSequenceBuffer( Matrix<F>& A, Int maxSequences )
+: A_(A), maxSequences_(Max(maxSequences,Int(1)))
+{ }
+
+template<typename F>
+void GivensSequenceBuffer<F>::Push
+( ForwardOrBackward direction, Int winBeg,
+  const Matrix<Base<F>>& cList,
+  const Matrix<Base<F>>& sList )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int numRots = cList.Height();
+    const Int winEnd = winBeg + numRots + 1;
+    EL_DEBUG_ONLY(
+      if( sList.Height() != numRots )
+          LogicError("cList and sList must be the same length");
+      if( winBeg < 0 || winEnd > A_.Width() )
+          LogicError
+          ("Window [",winBeg,",",winEnd,") is out of bounds for a matrix of "
+           "width ",A_.Width());
+    )
+    if( numRots == 0 )
+        return;
+
+    // A sequence over a window nested within the current one can be padded
+    // with identity rotations
+    if( numSequences_ > 0 &&
+        (direction != direction_ || winBeg < winBeg_ || winEnd > winEnd_) )
+        Flush();
+    if( numSequences_ == 0 )
+    {
+        direction_ = direction;
+        winBeg_ = winBeg;
+        winEnd_ = winEnd;
+        cLists_.Resize( winEnd-winBeg-1, maxSequences_ );
+        sLists_.Resize( winEnd-winBeg-1, maxSequences_ );
+    }
+
+    const Int offset = winBeg - winBeg_;
+    const Int p = numSequences_;
+    for( Int k=0; k<winEnd_-winBeg_-1; ++k )
+    {
+        if( k >= offset && k < offset+numRots )
+        {
+            cLists_(k,p) = cList(k-offset);
+            sLists_(k,p) = sList(k-offset);
+        }
+        else
+        {
+            cLists_(k,p) = Real(1);
+            sLists_(k,p) = Real(0);
+        }
+    }
+    if( ++numSequences_ == maxSequences_ )
+        Flush();
+}
+
+template<typename F>
+void GivensSequenceBuffer<F>::Flush()
+{
+    EL_DEBUG_CSE
+    if( numSequences_ == 0 )
+        return;
+    auto seqInd = IR(0,numSequences_);
+    auto cLists = cLists_( ALL, seqInd );
+    auto sLists = sLists_( ALL, seqInd );
+    auto AWin = A_( ALL, IR(winBeg_,winEnd_) );
+    ApplyGivensSequences( RIGHT, direction_, cLists, sLists, AWin );
+    numSequences_ = 0;
+}
+
 #define PROTO_REAL(F) \
   template void ApplyGivensSequence \
   ( LeftOrRight side, GivensSequenceType seqType, ForwardOrBackward direction, \
     const Matrix<Base<F>>& cList, \
     const Matrix<Base<F>>& sList, \
-    Matrix<F>& A );
+    Matrix<F>& A ); \
+  template void ApplyGivensSequences \
+  ( LeftOrRight side, ForwardOrBackward direction, \
+    const Matrix<Base<F>>& cLists, \
+    const Matrix<Base<F>>& sLists, \
+    Matrix<F>& A ); \
+  template class GivensSequenceBuffer<F>;
 
 #define PROTO(F) \
   PROTO_REAL(F) \
@@ -570,6 +744,11 @@ void ApplyGivensSequence
   ( LeftOrRight side, GivensSequenceType seqType, ForwardOrBackward direction, \
     const Matrix<Base<F>>& cList, \
     const Matrix<F>& sList, \
+    Matrix<F>& A ); \
+  template void ApplyGivensSequences \
+  ( LeftOrRight side, ForwardOrBackward direction, \
+    const Matrix<Base<F>>& cLists, \
+    const Matrix<F>& sLists, \
     Matrix<F>& A );
 
 #define EL_NO_INT_PROTO
@@ -117,6 +117,123 @@ void LocalColAccumulateLGeneral
     }
 }
 
+// z[MC] += alpha tril(A)[MC,MR] x[MR], z[MR] += alpha tril(A,-1)'[MR,MC] x[MC]
+// in a single pass over the local lower triangle of A: each local column
+// is simultaneously used for an axpy into z[MC] and a dot product with x[MC].
+// The local columns are cyclically dealt (in chunks) to the threads, each of
+// which accumulates into its own copy of z[MC].
+template<typename T>
+void LocalColAccumulateLFused
+( T alpha,
+  const DistMatrix<T>& A,
+  const DistMatrix<T,MC,STAR>& x_MC_STAR,
+  const DistMatrix<T,MR,STAR>& x_MR_STAR,
+        DistMatrix<T,MC,STAR>& z_MC_STAR,
+        DistMatrix<T,MR,STAR>& z_MR_STAR,
+  bool conjugate, const SymvCtrl<T>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, x_MC_STAR, x_MR_STAR, z_MC_STAR, z_MR_STAR );
+      if( x_MC_STAR.Width() != 1 || x_MR_STAR.Width() != 1 ||
+          z_MC_STAR.Width() != 1 || z_MR_STAR.Width() != 1 )
+          LogicError("Expected x and z to be column vectors");
+      if( A.Height() != A.Width() ||
+          A.Height() != x_MC_STAR.Height() ||
+          A.Height() != x_MR_STAR.Height() ||
+          A.Height() != z_MC_STAR.Height() ||
+          A.Height() != z_MR_STAR.Height() )
+          LogicError("Nonconformal");
+      if( x_MC_STAR.ColAlign() != A.ColAlign() ||
+          x_MR_STAR.ColAlign() != A.RowAlign() ||
+          z_MC_STAR.ColAlign() != A.ColAlign() ||
+          z_MR_STAR.ColAlign() != A.RowAlign() )
+          LogicError("Partial matrix distributions are misaligned");
+    )
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const Int colShift = A.ColShift();
+    const Int rowShift = A.RowShift();
+    const Int colStride = A.ColStride();
+    const Int rowStride = A.RowStride();
+    const T* ABuf = A.LockedBuffer();
+    const T* xMCBuf = x_MC_STAR.LockedBuffer();
+    const T* xMRBuf = x_MR_STAR.LockedBuffer();
+          T* zMCBuf = z_MC_STAR.Buffer();
+          T* zMRBuf = z_MR_STAR.Buffer();
+    const Int ALDim = A.LDim();
+    const Int chunkSize = Max(ctrl.bsize/4,Int(1));
+
+#ifdef EL_HYBRID
+    const Int maxThreads = omp_get_max_threads();
+#else
+    const Int maxThreads = 1;
+#endif
+    // Thread 0 accumulates directly into z[MC]
+    vector<T> zMCThreads( (maxThreads-1)*localHeight, T(0) );
+
+#ifdef EL_HYBRID
+    #pragma omp parallel
+#endif
+    {
+#ifdef EL_HYBRID
+        const Int numThreads = omp_get_num_threads();
+        const Int thread = omp_get_thread_num();
+#else
+        const Int numThreads = 1;
+        const Int thread = 0;
+#endif
+        T* zMC =
+          ( thread == 0 ? zMCBuf : &zMCThreads[(thread-1)*localHeight] );
+        for( Int jBeg=thread*chunkSize; jBeg<localWidth;
+             jBeg+=numThreads*chunkSize )
+        {
+            const Int jEnd = Min(jBeg+chunkSize,localWidth);
+            for( Int jLoc=jBeg; jLoc<jEnd; ++jLoc )
+            {
+                const Int j = rowShift + jLoc*rowStride;
+                const T* aCol = &ABuf[jLoc*ALDim];
+                const T chi = alpha*xMRBuf[jLoc];
+
+                // Skip past the local rows above the diagonal
+                Int iLoc = Length( j, colShift, colStride );
+                if( iLoc < localHeight && colShift+iLoc*colStride == j )
+                {
+                    zMC[iLoc] += aCol[iLoc]*chi;
+                    ++iLoc;
+                }
+
+                T dot = 0;
+                if( conjugate )
+                {
+                    for( ; iLoc<localHeight; ++iLoc )
+                    {
+                        zMC[iLoc] += aCol[iLoc]*chi;
+                        dot += Conj(aCol[iLoc])*xMCBuf[iLoc];
+                    }
+                }
+                else
+                {
+                    for( ; iLoc<localHeight; ++iLoc )
+                    {
+                        zMC[iLoc] += aCol[iLoc]*chi;
+                        dot += aCol[iLoc]*xMCBuf[iLoc];
+                    }
+                }
+                zMRBuf[jLoc] += alpha*dot;
+            }
+        }
+    }
+
+    if( maxThreads > 1 )
+    {
+        EL_PARALLEL_FOR
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            for( Int t=1; t<maxThreads; ++t )
+                zMCBuf[iLoc] += zMCThreads[(t-1)*localHeight+iLoc];
+    }
+}
+
 template<typename T>
 void LocalColAccumulateLSquareTwoTrmv
 ( T alpha, 
@@ -252,7 +369,12 @@ void LocalColAccumulateL
   bool conjugate, const SymvCtrl<T>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.avoidTrmvBasedLocalSymv || A.Grid().Height() != A.Grid().Width() )
+    if( ctrl.fuseLocalSymv )
+        LocalColAccumulateLFused
+        ( alpha, A, x_MC_STAR, x_MR_STAR, z_MC_STAR, z_MR_STAR, conjugate,
+          ctrl );
+    else if( ctrl.avoidTrmvBasedLocalSymv ||
+             A.Grid().Height() != A.Grid().Width() )
         LocalColAccumulateLGeneral
         ( alpha, A, x_MC_STAR, x_MR_STAR, z_MC_STAR, z_MR_STAR, conjugate,
           ctrl );
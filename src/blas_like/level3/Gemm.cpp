@@ -8,14 +8,233 @@
 */
 #include <El-lite.hpp>
 #include <El/blas_like/level3.hpp>
+#include <El/blas_like/level1/Copy/RedistPlan.hpp>
+#include <El/blas_like/level1/Copy/CopyAsync.hpp>
+
+namespace {
+
+El::GemmCostModel gemmCostModel;
+int gemmNumLayers = 1;
+bool gemmPrefetchPanels = false;
+
+// The blocksize used by the SUMMA_*Dot variants when called from GEMM_DEFAULT
+const El::Int dotBlocksize = 2000;
+
+}
 
 #include "./Gemm/NN.hpp"
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/Cannon.hpp"
+#include "./Gemm/Layered.hpp"
+#include "./Gemm/Block.hpp"
 
 namespace El {
 
+void SetGemmCostModel( const GemmCostModel& model )
+{
+    EL_DEBUG_CSE
+    if( model.latency < 0 || model.inverseBandwidth < 0 )
+        LogicError("Gemm cost model parameters must be non-negative");
+    ::gemmCostModel = model;
+}
+
+const GemmCostModel& GetGemmCostModel() { return ::gemmCostModel; }
+
+void CalibrateGemmCostModel( mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    if( commSize == 1 )
+        return;
+    const double logSize = std::log2( double(commSize) );
+    const Int numReps = 20;
+
+    // An AllReduce of a single entry costs roughly 2 log2(p) latencies
+    mpi::Barrier( comm );
+    double startTime = mpi::Time();
+    for( Int rep=0; rep<numReps; ++rep )
+        mpi::AllReduce( 1, mpi::SUM, comm );
+    double localTime = (mpi::Time()-startTime) / numReps;
+    const double latency =
+      mpi::AllReduce( localTime, mpi::MAX, comm ) / (2*logSize);
+
+    // An AllGather resulting in N bytes costs roughly log2(p) latencies plus
+    // the time to receive (p-1)/p N bytes
+    const int count = Max( (1<<18)/commSize, 1 );
+    vector<double> sendBuf( count, 1. ), recvBuf( count*commSize );
+    mpi::Barrier( comm );
+    startTime = mpi::Time();
+    for( Int rep=0; rep<numReps; ++rep )
+        mpi::AllGather( sendBuf.data(), count, recvBuf.data(), count, comm );
+    localTime = (mpi::Time()-startTime) / numReps;
+    const double time = mpi::AllReduce( localTime, mpi::MAX, comm );
+    const double numBytes = double(commSize-1)*count*sizeof(double);
+
+    GemmCostModel model;
+    model.latency = latency;
+    model.inverseBandwidth = Max( time-logSize*latency, 0. ) / numBytes;
+    SetGemmCostModel( model );
+}
+
+void SetGemmNumLayers( int numLayers )
+{
+    EL_DEBUG_CSE
+    if( numLayers < 1 )
+        LogicError("The number of Gemm layers must be positive");
+    ::gemmNumLayers = numLayers;
+}
+
+int GemmNumLayers() { return ::gemmNumLayers; }
+
+void SetGemmPrefetchPanels( bool prefetch )
+{ ::gemmPrefetchPanels = prefetch; }
+
+bool GemmPrefetchPanels() { return ::gemmPrefetchPanels; }
+
+namespace {
+
+// The number of messages and entries communicated by a two-dimensional
+// variant over an r x c grid
+void PlanarCommunication
+( GemmAlgorithm alg, Int m, Int n, Int k, double r, double c,
+  double& numMessages, double& numEntries )
+{
+    const double p = r*c;
+    const Int bsize = Blocksize();
+    auto numPanels = [&]( Int dim ) { return double((dim+bsize-1)/bsize); };
+
+    // The number of messages sent during a tree-based collective, and the
+    // fraction of the result received during an AllGather (or contributed
+    // during a ReduceScatter), within a process column, row, or the grid
+    const double logR = std::log2( r );
+    const double logC = std::log2( c );
+    const double logP = std::log2( p );
+    const double fracR = (r-1) / r;
+    const double fracC = (c-1) / c;
+    const double fracP = (p-1) / p;
+
+    // Redistributing between [MC,MR] and [MR,*] (or [*,MC]) also involves
+    // two permutations, each of which moves the local data once
+    const double numPerms = ( p > 1 ? 2 : 0 );
+
+    switch( alg )
+    {
+    case GEMM_SUMMA_A:
+        // Each panel of B is gathered into [MR,*] and the [MC,*] update is
+        // summed and scattered within process rows
+        numMessages = numPanels(n)*(numPerms+logR+logC);
+        numEntries = n*(numPerms*k/p + fracR*k/c + fracC*m/r);
+        break;
+    case GEMM_SUMMA_B:
+        // Each panel of A is gathered into [*,MC] and the [MR,*] update is
+        // summed and scattered within process columns
+        numMessages = numPanels(m)*(numPerms+logR+logC);
+        numEntries = m*(numPerms*k/p + fracC*k/r + fracR*n/c);
+        break;
+    case GEMM_SUMMA_C:
+        // Each panel of A is gathered into [MC,*] and each panel of B
+        // into [*,MR]
+        numMessages = numPanels(k)*(logR+logC);
+        numEntries = k*(fracC*m/r + fracR*n/c);
+        break;
+    case GEMM_SUMMA_DOT:
+    {
+        // A and B are redistributed once into [*,VC] and [VC,*], and then
+        // each block of C is summed and scattered over the entire grid
+        const double numBlocks =
+          double((m+dotBlocksize-1)/dotBlocksize)*
+          double((n+dotBlocksize-1)/dotBlocksize);
+        numMessages = 2*numPerms + numBlocks*logP;
+        numEntries = numPerms*(m*k+k*n)/p + fracP*m*n;
+        break;
+    }
+    case GEMM_CANNON:
+    {
+        // Including the initial skew, each local piece of A and B is
+        // circularly shifted lcm(r,c) times
+        const double lcm = p / GCD( Int(r), Int(c) );
+        numMessages = 2*lcm;
+        numEntries = lcm*(m*k+k*n)/p;
+        break;
+    }
+    default:
+        LogicError("Unsupported Gemm option");
+    }
+}
+
+} // anonymous namespace
+
+template<typename T>
+double GemmCommunicationCost
+( GemmAlgorithm alg, Int m, Int n, Int k, const Grid& grid )
+{
+    EL_DEBUG_CSE
+    const double r = grid.Height();
+    const double c = grid.Width();
+    const double p = r*c;
+    const GemmCostModel& model = ::gemmCostModel;
+    auto cost = [&]( double numMessages, double numEntries )
+      { return model.latency*numMessages +
+               model.inverseBandwidth*sizeof(T)*numEntries; };
+
+    double numMessages, numEntries;
+    if( alg == GEMM_25D )
+    {
+        // Each layer forms the product of a slice of the summation dimension
+        // with the cheapest two-dimensional variant. The slices of A and B
+        // are each sent once to a layer, and the layer contributions, each
+        // of which is distributed over p/numLayers processes, are reduced
+        // onto the first layer and then redistributed back to the grid.
+        const int numLayers = ::gemmNumLayers;
+        const double layerHeight = grid.LayerHeight( numLayers );
+        const double layerWidth = (p/numLayers) / layerHeight;
+        const Int kLayer = (k+numLayers-1) / numLayers;
+        const GemmAlgorithm planarAlgs[] =
+          { GEMM_SUMMA_C, GEMM_SUMMA_A, GEMM_SUMMA_B, GEMM_SUMMA_DOT };
+        double planarCost = std::numeric_limits<double>::max();
+        for( const GemmAlgorithm planarAlg : planarAlgs )
+        {
+            PlanarCommunication
+            ( planarAlg, m, n, kLayer, layerHeight, layerWidth,
+              numMessages, numEntries );
+            planarCost = Min( planarCost, cost(numMessages,numEntries) );
+        }
+        const double logLayers = std::log2( double(numLayers) );
+        numMessages = 3 + logLayers;
+        numEntries = (m*k+k*n)/p + numLayers*(1+logLayers)*m*n/p;
+        return planarCost + cost(numMessages,numEntries);
+    }
+    PlanarCommunication( alg, m, n, k, r, c, numMessages, numEntries );
+    return cost(numMessages,numEntries);
+}
+
+template<typename T>
+GemmAlgorithm SelectGemmAlgorithm
+( Int m, Int n, Int k, const Grid& grid, bool allowLayers )
+{
+    EL_DEBUG_CSE
+    // Ties are broken in favor of the earlier (simpler) variants
+    vector<GemmAlgorithm> candidates =
+      { GEMM_SUMMA_C, GEMM_SUMMA_A, GEMM_SUMMA_B, GEMM_SUMMA_DOT };
+    if( allowLayers && ::gemmNumLayers > 1 &&
+        grid.Size() % ::gemmNumLayers == 0 )
+        candidates.push_back( GEMM_25D );
+    GemmAlgorithm bestAlg = GEMM_SUMMA_C;
+    double bestCost = std::numeric_limits<double>::max();
+    for( const GemmAlgorithm alg : candidates )
+    {
+        const double cost = GemmCommunicationCost<T>( alg, m, n, k, grid );
+        if( cost < bestCost )
+        {
+            bestCost = cost;
+            bestAlg = alg;
+        }
+    }
+    return bestAlg;
+}
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -96,12 +315,37 @@ void Gemm
 {
     EL_DEBUG_CSE
     C *= beta;
+    if( A.Wrap() == BLOCK && B.Wrap() == BLOCK && C.Wrap() == BLOCK )
+    {
+        gemm::SUMMA_Block( orientA, orientB, alpha, A, B, C );
+        return;
+    }
+    if( alg == GEMM_DEFAULT )
+    {
+        const Int m = C.Height();
+        const Int n = C.Width();
+        const Int k = ( orientA == NORMAL ? A.Width() : A.Height() );
+        alg = SelectGemmAlgorithm<T>( m, n, k, A.Grid() );
+    }
+    if( alg == GEMM_25D )
+    {
+        if( ::gemmNumLayers > 1 )
+        {
+            gemm::Layered( orientA, orientB, alpha, A, B, C, ::gemmNumLayers );
+            return;
+        }
+        alg = GEMM_DEFAULT;
+    }
+
+    if( alg == GEMM_CANNON )
+    {
+        gemm::Cannon( orientA, orientB, alpha, A, B, C );
+        return;
+    }
+
     if( orientA == NORMAL && orientB == NORMAL )
     {
-        if( alg == GEMM_CANNON )
-            gemm::Cannon_NN( alpha, A, B, C );
-        else 
-            gemm::SUMMA_NN( alpha, A, B, C, alg );
+        gemm::SUMMA_NN( alpha, A, B, C, alg );
     }
     else if( orientA == NORMAL )
     {
@@ -132,6 +376,27 @@ void Gemm
     Gemm( orientA, orientB, alpha, A, B, T(0), C, alg );
 }
 
+template<typename T>
+void Gemm
+( T alpha, const OrientedView<Matrix<T>>& A, const OrientedView<Matrix<T>>& B,
+  T beta,        Matrix<T>& C )
+{
+    EL_DEBUG_CSE
+    Gemm
+    ( A.orientation, B.orientation, alpha, A.matrix, B.matrix, beta, C );
+}
+
+template<typename T>
+void Gemm
+( T alpha, const OrientedView<ElementalMatrix<T>>& A,
+           const OrientedView<ElementalMatrix<T>>& B,
+  T beta,        ElementalMatrix<T>& C, GemmAlgorithm alg )
+{
+    EL_DEBUG_CSE
+    Gemm
+    ( A.orientation, B.orientation, alpha, A.matrix, B.matrix, beta, C, alg );
+}
+
 template<typename T>
 void LocalGemm
 ( Orientation orientA, Orientation orientB,
@@ -259,6 +524,10 @@ void LocalGemm
 }
 
 #define PROTO(T) \
+  template double GemmCommunicationCost<T> \
+  ( GemmAlgorithm alg, Int m, Int n, Int k, const Grid& grid ); \
+  template GemmAlgorithm SelectGemmAlgorithm<T> \
+  ( Int m, Int n, Int k, const Grid& grid, bool allowLayers ); \
   template void Gemm \
   ( Orientation orientA, Orientation orientB, \
     T alpha, const Matrix<T>& A, \
@@ -279,6 +548,14 @@ void LocalGemm
     T alpha, const AbstractDistMatrix<T>& A, \
              const AbstractDistMatrix<T>& B, \
                    AbstractDistMatrix<T>& C, GemmAlgorithm alg ); \
+  template void Gemm \
+  ( T alpha, const OrientedView<Matrix<T>>& A, \
+             const OrientedView<Matrix<T>>& B, \
+    T beta,        Matrix<T>& C ); \
+  template void Gemm \
+  ( T alpha, const OrientedView<ElementalMatrix<T>>& A, \
+             const OrientedView<ElementalMatrix<T>>& B, \
+    T beta,        ElementalMatrix<T>& C, GemmAlgorithm alg ); \
   template void LocalGemm \
   ( Orientation orientA, Orientation orientB, \
     T alpha, const AbstractDistMatrix<T>& A, \
@@ -0,0 +1,89 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// SUMMA over block-cyclic matrices which never forms element-wise copies of
+// A, B, or C: the panels of the summation dimension follow the distribution
+// blocks of A, and each panel of op(A) (op(B)) is redistributed into a
+// block-cyclic [MC,* ] ([* ,MR]) matrix with the blocking of C's columns
+// (rows) so that the update of C is purely local
+template<typename T>
+void SUMMA_Block
+( Orientation orientA, Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre )
+{
+    EL_DEBUG_CSE
+    EL_REGION("gemm::SUMMA_Block");
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadProxy<T,T,MC,MR,BLOCK> AProx( APre );
+    DistMatrixReadProxy<T,T,MC,MR,BLOCK> BProx( BPre );
+    DistMatrixReadWriteProxy<T,T,MC,MR,BLOCK> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    const bool normalA = ( orientA == NORMAL );
+    const bool normalB = ( orientB == NORMAL );
+    const Int sumDim = ( normalA ? A.Width() : A.Height() );
+    const Int bsize = ( normalA ? A.BlockWidth() : A.BlockHeight() );
+    const Int cut = ( normalA ? A.RowCut() : A.ColCut() );
+
+    // Temporary distributions
+    DistMatrix<T,MC,  STAR,BLOCK> A1_MC_STAR(g);
+    DistMatrix<T,STAR,MC,  BLOCK> A1_STAR_MC(g);
+    DistMatrix<T,STAR,MR,  BLOCK> B1_STAR_MR(g);
+    DistMatrix<T,MR,  STAR,BLOCK> B1_MR_STAR(g);
+
+    A1_MC_STAR.AlignColsWith( C );
+    A1_STAR_MC.AlignRowsWith( C );
+    B1_STAR_MR.AlignRowsWith( C );
+    B1_MR_STAR.AlignColsWith( C );
+
+    for( Int k=0; k<sumDim; )
+    {
+        const Int nb = Min( k==0 ? bsize-cut : bsize, sumDim-k );
+        const Range<Int> ind1( k, k+nb );
+
+        const AbstractDistMatrix<T>* A1Dist;
+        if( normalA )
+        {
+            A1_MC_STAR = A( ALL, ind1 );
+            A1Dist = &A1_MC_STAR;
+        }
+        else
+        {
+            A1_STAR_MC = A( ind1, ALL );
+            A1Dist = &A1_STAR_MC;
+        }
+
+        const AbstractDistMatrix<T>* B1Dist;
+        if( normalB )
+        {
+            B1_STAR_MR = B( ind1, ALL );
+            B1Dist = &B1_STAR_MR;
+        }
+        else
+        {
+            B1_MR_STAR = B( ALL, ind1 );
+            B1Dist = &B1_MR_STAR;
+        }
+
+        LocalGemm( orientA, orientB, alpha, *A1Dist, *B1Dist, T(1), C );
+        k += nb;
+    }
+}
+
+} // namespace gemm
+} // namespace El
@@ -0,0 +1,184 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// Cannon's algorithm, generalized to r x c process grids
+//
+// The local pieces of op(A) circulate around each process row, and those of
+// op(B) around each process column, for lcm(r,c) steps. After the initial
+// skew, during step s, process (i,j) holds the pieces of A and B which
+// originated in process column a = (i+j+s) mod c and process row
+// b = (i+j+s) mod r. These pieces share the summation indices congruent to
+// the unique t in [0,lcm(r,c)) with t = a (mod c) and t = b (mod r), which
+// exists since a = b (mod gcd(r,c)), and, by the Chinese Remainder Theorem,
+// every such t is visited exactly once. On square grids this reduces to the
+// classical algorithm.
+//
+// In order for the shared indices to be contiguous, the columns of each
+// local piece of A (and the rows of each local piece of B) are packed by
+// their residue modulo lcm(r,c).
+template<typename T>
+void Cannon
+( Orientation orientA,
+  Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre )
+{
+    EL_DEBUG_CSE
+    EL_REGION("gemm::Cannon");
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    // Force op(A) and op(B) into [MC,MR] distributions with their summation
+    // dimensions unaligned and their other dimensions aligned with C
+    ElementalProxyCtrl ctrlA, ctrlB;
+    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
+    ctrlA.rowConstrain = true; ctrlA.rowAlign = 0;
+    ctrlB.colConstrain = true; ctrlB.colAlign = 0;
+    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
+
+    DistMatrix<T> ATrans(g), BTrans(g);
+    if( orientA != NORMAL )
+    {
+        ATrans.Align( ctrlA.colAlign, ctrlA.rowAlign );
+        Transpose( APre, ATrans, orientA==ADJOINT );
+    }
+    if( orientB != NORMAL )
+    {
+        BTrans.Align( ctrlB.colAlign, ctrlB.rowAlign );
+        Transpose( BPre, BTrans, orientB==ADJOINT );
+    }
+    DistMatrixReadProxy<T,T,MC,MR>
+      AProx( orientA==NORMAL ? APre : ATrans, ctrlA );
+    DistMatrixReadProxy<T,T,MC,MR>
+      BProx( orientB==NORMAL ? BPre : BTrans, ctrlB );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    if( !g.InGrid() )
+        return;
+
+    const Int sumDim = A.Width();
+    const int r = g.Height();
+    const int c = g.Width();
+    const int row = g.Row();
+    const int col = g.Col();
+    const int lcm = g.LCM();
+    const Int numGroupsA = lcm / c;
+    const Int numGroupsB = lcm / r;
+    mpi::Comm rowComm = g.RowComm();
+    mpi::Comm colComm = g.ColComm();
+    const Int localHeight = C.LocalHeight();
+    const Int localWidth = C.LocalWidth();
+
+    // The local width of the piece of A originating in process column a and
+    // the local height of the piece of B originating in process row b
+    auto widthA = [&]( int a ) { return Length( sumDim, a, c ); };
+    auto heightB = [&]( int b ) { return Length( sumDim, b, r ); };
+
+    // The number of packed entries preceding residue group 'group' of a
+    // local dimension of length 'length'
+    auto groupOffset = []( Int length, Int numGroups, Int group )
+    {
+        Int offset = 0;
+        for( Int u=0; u<group; ++u )
+            offset += Length( length, u, numGroups );
+        return offset;
+    };
+
+    // Pack our local pieces of A and B by residue group
+    vector<T> pkgA( localHeight*widthA(col) ),
+              pkgB( heightB(row)*localWidth );
+    {
+        const Int localWidthA = widthA( col );
+        const Int localHeightB = heightB( row );
+        const Int BLDim = B.LDim();
+        const T* ABuf = A.LockedBuffer();
+        const T* BBuf = B.LockedBuffer();
+        const Int ALDim = A.LDim();
+        Int jPacked = 0;
+        for( Int u=0; u<numGroupsA; ++u )
+            for( Int jLoc=u; jLoc<localWidthA; jLoc+=numGroupsA, ++jPacked )
+                MemCopy
+                ( &pkgA[jPacked*localHeight], &ABuf[jLoc*ALDim], localHeight );
+        Int iPacked = 0;
+        for( Int v=0; v<numGroupsB; ++v )
+            for( Int iLoc=v; iLoc<localHeightB; iLoc+=numGroupsB, ++iPacked )
+                for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                    pkgB[iPacked+jLoc*localHeightB] = BBuf[iLoc+jLoc*BLDim];
+    }
+
+    // Perform the initial skews so that we hold the pieces of A and B from
+    // process column (row+col) mod c and process row (row+col) mod r
+    vector<T> recvBuf;
+    auto shift =
+      [&]( vector<T>& pkg, Int recvSize, int to, int from, mpi::Comm comm )
+      {
+          recvBuf.resize( recvSize );
+          mpi::SendRecv
+          ( pkg.data(), int(pkg.size()), to,
+            recvBuf.data(), int(recvSize), from, comm );
+          pkg.swap( recvBuf );
+      };
+    int a = Mod( row+col, c );
+    int b = Mod( row+col, r );
+    shift
+    ( pkgA, localHeight*widthA(a), Mod(col-row,c), a, rowComm );
+    shift
+    ( pkgB, heightB(b)*localWidth, Mod(row-col,r), b, colComm );
+
+    Matrix<T> A1, B1;
+    for( int step=0; step<lcm; ++step )
+    {
+        // Find the residue shared by the current pieces of A and B
+        Int u = 0;
+        while( (a+u*c) % r != b )
+            ++u;
+        const Int v = (a+u*c-b) / r;
+
+        const Int localWidthA = widthA( a );
+        const Int localHeightB = heightB( b );
+        const Int groupSize = Length( localWidthA, u, numGroupsA );
+        EL_DEBUG_ONLY(
+          if( groupSize != Length( localHeightB, v, numGroupsB ) )
+              LogicError("Residue groups of A and B did not match");
+        )
+        if( groupSize > 0 )
+        {
+            const Int offsetA = groupOffset( localWidthA, numGroupsA, u );
+            const Int offsetB = groupOffset( localHeightB, numGroupsB, v );
+            A1.LockedAttach
+            ( localHeight, groupSize, pkgA.data()+offsetA*localHeight,
+              Max(localHeight,1) );
+            B1.LockedAttach
+            ( groupSize, localWidth, pkgB.data()+offsetB, localHeightB );
+            Gemm( NORMAL, NORMAL, alpha, A1, B1, T(1), C.Matrix() );
+        }
+
+        if( step != lcm-1 )
+        {
+            a = Mod( a+1, c );
+            b = Mod( b+1, r );
+            shift
+            ( pkgA, localHeight*widthA(a), Mod(col-1,c), Mod(col+1,c),
+              rowComm );
+            shift
+            ( pkgB, heightB(b)*localWidth, Mod(row-1,r), Mod(row+1,r),
+              colComm );
+        }
+    }
+}
+
+} // namespace gemm
+} // namespace El
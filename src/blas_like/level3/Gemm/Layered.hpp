@@ -0,0 +1,105 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// A 2.5D Gemm which splits the grid into layers, each of which forms the
+// contribution of a contiguous slice of the summation dimension using a
+// two-dimensional algorithm before the contributions are summed over the
+// layers (see the experimental G3D driver for the original prototype)
+template<typename T>
+void Layered
+( Orientation orientA,
+  Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre,
+  int numLayers )
+{
+    EL_DEBUG_CSE
+    EL_REGION("gemm::Layered");
+    const Grid& g = APre.Grid();
+    const Int m = CPre.Height();
+    const Int n = CPre.Width();
+    const Int k = ( orientA == NORMAL ? APre.Width() : APre.Height() );
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    // Every process (including those outside of the grid) takes part in
+    // redistributing to each layer, but only the members of a layer compute
+    const bool inGrid = g.InGrid();
+    const int myLayer = ( inGrid ? g.Layer(numLayers) : 0 );
+    const Grid& myLayerGrid = g.LayerGrid( numLayers, myLayer );
+    DistMatrix<T> ALayer(myLayerGrid), BLayer(myLayerGrid),
+                  CLayer(m,n,myLayerGrid);
+    for( int layer=0; layer<numLayers; ++layer )
+    {
+        const Range<Int> ind( (k*layer)/numLayers, (k*(layer+1))/numLayers );
+        auto ASlice = ( orientA == NORMAL ? A( ALL, ind ) : A( ind, ALL ) );
+        auto BSlice = ( orientB == NORMAL ? B( ind, ALL ) : B( ALL, ind ) );
+        if( layer == myLayer )
+        {
+            Copy( ASlice, ALayer );
+            Copy( BSlice, BLayer );
+        }
+        else
+        {
+            const Grid& layerGrid = g.LayerGrid( numLayers, layer );
+            DistMatrix<T> AOther(layerGrid), BOther(layerGrid);
+            Copy( ASlice, AOther );
+            Copy( BSlice, BOther );
+        }
+    }
+
+    // Form our layer's contribution and sum the contributions onto the first
+    // layer. Since the layers have identical shapes, each local matrix is
+    // conformal with those at the same position of the other layers.
+    if( inGrid )
+    {
+        const Int kLayer =
+          ( orientA == NORMAL ? ALayer.Width() : ALayer.Height() );
+        const GemmAlgorithm alg =
+          SelectGemmAlgorithm<T>( m, n, kLayer, myLayerGrid, false );
+        Gemm( orientA, orientB, alpha, ALayer, BLayer, CLayer, alg );
+        ALayer.Empty();
+        BLayer.Empty();
+
+        auto& CLoc = CLayer.Matrix();
+        EL_DEBUG_ONLY(
+          if( CLoc.Width() > 1 && CLoc.LDim() != CLoc.Height() )
+              LogicError("Expected a contiguous local layer contribution");
+        )
+        mpi::Reduce
+        ( CLoc.Buffer(), CLoc.Height()*CLoc.Width(), mpi::SUM, 0,
+          g.DepthComm(numLayers) );
+    }
+
+    DistMatrix<T> CSum(g);
+    CSum.AlignWith( C );
+    if( myLayer == 0 )
+    {
+        Copy( CLayer, CSum );
+    }
+    else
+    {
+        DistMatrix<T> CFirst( m, n, g.LayerGrid(numLayers,0) );
+        Copy( CFirst, CSum );
+    }
+    Axpy( T(1), CSum, C );
+}
+
+} // namespace gemm
+} // namespace El
@@ -10,81 +10,59 @@
 namespace El {
 namespace gemm {
 
-// Cannon's algorithm
+// Normal Normal Gemm that avoids communicating the matrix A
+// (prefetching the panels of B; see SetGemmPrefetchPanels)
 template<typename T>
-void Cannon_NN
+void SUMMA_NNAPrefetch
 ( T alpha,
-  const AbstractDistMatrix<T>& APre,
-  const AbstractDistMatrix<T>& BPre,
-        AbstractDistMatrix<T>& CPre )
+  const DistMatrix<T>& A,
+  const DistMatrix<T>& B,
+        DistMatrix<T>& C )
 {
     EL_DEBUG_CSE
-    const Grid& g = APre.Grid();
-    if( g.Height() != g.Width() )
-        LogicError("Process grid must be square for Cannon's");
+    const Int n = C.Width();
+    const Int bsize = Blocksize();
+    const Grid& g = A.Grid();
 
-    // Force A, B, and C to be in [MC,MR] distributions aligned with C
-    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
-    auto& C = CProx.Get();
+    // Temporary distributions
+    //
+    // The panels of B are double-buffered so that the redistribution of the
+    // next panel overlaps with the local update for the current one
+    DistMatrix<T,MR,STAR> B1_MR_STAR0(g), B1_MR_STAR1(g);
+    DistMatrix<T,MR,STAR>* B1_MR_STAR[2] = { &B1_MR_STAR0, &B1_MR_STAR1 };
+    DistMatrix<T,STAR,MR> B1Trans_STAR_MR(g);
+    DistMatrix<T,MC,STAR> D1_MC_STAR(g);
+    CopyRequest<T> BRequests[2];
 
-    ElementalProxyCtrl ctrlA, ctrlB;
-    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
-    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
-    
-    DistMatrixReadProxy<T,T,MC,MR> AProx( APre, ctrlA );
-    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre, ctrlB );
-    auto& A = AProx.GetLocked();
-    auto& B = BProx.GetLocked();
+    B1_MR_STAR0.AlignCols( A.RowAlign() );
+    B1_MR_STAR1.AlignCols( A.RowAlign() );
+    B1Trans_STAR_MR.AlignWith( A );
+    D1_MC_STAR.AlignWith( A );
 
-    const Int row = g.Row();
-    const Int col = g.Col();
-    const Int pSqrt = g.Height();
-    mpi::Comm rowComm = g.RowComm();
-    mpi::Comm colComm = g.ColComm(); 
-    if( A.Width() % pSqrt != 0 )
-        LogicError("For now, width(A) must be integer multiple of sqrt(p)");
-
-    // Load the initial A and B packages (may want to transpose B...)
-    const Int localHeightA = A.LocalHeight();
-    const Int localHeightB = B.LocalHeight();
-    const Int localWidthA = A.LocalWidth();
-    const Int localWidthB = B.LocalWidth();
-    Matrix<T> pkgA(localHeightA,localWidthA,localHeightA), 
-              pkgB(localHeightB,localWidthB,localHeightB);
-    for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
-        MemCopy
-        ( pkgA.Buffer(0,jLoc), A.LockedBuffer(0,jLoc), localHeightA );
-    for( Int jLoc=0; jLoc<localWidthB; ++jLoc )
-        MemCopy
-        ( pkgB.Buffer(0,jLoc), B.LockedBuffer(0,jLoc), localHeightB );
-
-    // Perform the initial circular shifts so that our A and B packages align
-    const Int rowShiftA = A.RowShift();
-    const Int colShiftB = B.ColShift();
-    const Int leftInitA  = Mod(col-colShiftB,pSqrt);
-    const Int rightInitA = Mod(col+colShiftB,pSqrt);
-    const Int aboveInitB = Mod(row-rowShiftA,pSqrt);
-    const Int belowInitB = Mod(row+rowShiftA,pSqrt);
-    const Int pkgSizeA = localHeightA*localWidthA;
-    const Int pkgSizeB = localHeightB*localWidthB;
-    mpi::SendRecv( pkgA.Buffer(), pkgSizeA, leftInitA, rightInitA, rowComm );
-    mpi::SendRecv( pkgB.Buffer(), pkgSizeB, aboveInitB, belowInitB, colComm );
-
-    // Now begin the data flow
-    const Int aboveRow = Mod(row-1,pSqrt);
-    const Int belowRow = Mod(row+1,pSqrt);
-    const Int leftCol  = Mod(col-1,pSqrt);
-    const Int rightCol = Mod(col+1,pSqrt);
-    for( Int q=0; q<pSqrt; ++q )
+    if( n > 0 )
+        CopyAsync( B( ALL, IR(0,Min(bsize,n)) ), B1_MR_STAR0, BRequests[0] );
+    for( Int k=0, p=0; k<n; k+=bsize, p=1-p )
     {
-        Gemm( NORMAL, NORMAL, alpha, pkgA, pkgB, T(1), C.Matrix() );
-        if( q != pSqrt-1 )
+        const Int nb = Min(bsize,n-k);
+        auto C1 = C( ALL, IR(k,k+nb) );
+
+        // Prefetch the next panel of B
+        const Int kNext = k+nb;
+        if( kNext < n )
         {
-            mpi::SendRecv
-            ( pkgA.Buffer(), pkgSizeA, leftCol, rightCol, rowComm );
-            mpi::SendRecv
-            ( pkgB.Buffer(), pkgSizeB, aboveRow, belowRow, colComm );
+            const Int nbNext = Min(bsize,n-kNext);
+            CopyAsync
+            ( B( ALL, IR(kNext,kNext+nbNext) ), *B1_MR_STAR[1-p],
+              BRequests[1-p] );
         }
+
+        // D1[MC,*] := alpha A[MC,MR] B1[MR,*]
+        BRequests[p].Wait();
+        Transpose( *B1_MR_STAR[p], B1Trans_STAR_MR );
+        LocalGemm( NORMAL, TRANSPOSE, alpha, A, B1Trans_STAR_MR, D1_MC_STAR );
+
+        // C1[MC,MR] += scattered result of D1[MC,*] summed over grid rows
+        AxpyContract( T(1), D1_MC_STAR, C1 );
     }
 }
 
@@ -97,6 +75,7 @@ void SUMMA_NNA
         AbstractDistMatrix<T>& CPre )
 {
     EL_DEBUG_CSE
+    EL_REGION("gemm::SUMMA_NNA");
     const Int n = CPre.Width();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -107,6 +86,11 @@ void SUMMA_NNA
     auto& A = AProx.GetLocked();
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
+    if( GemmPrefetchPanels() )
+    {
+        SUMMA_NNAPrefetch( alpha, A, B, C );
+        return;
+    }
 
     // Temporary distributions
     DistMatrix<T,VR,STAR> B1_VR_STAR(g);
@@ -133,6 +117,59 @@ void SUMMA_NNA
     }
 }
 
+// Normal Normal Gemm that avoids communicating the matrix B
+// (prefetching the panels of A; see SetGemmPrefetchPanels)
+template<typename T>
+void SUMMA_NNBPrefetch
+( T alpha,
+  const DistMatrix<T>& A,
+  const DistMatrix<T>& B,
+        DistMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const Int m = C.Height();
+    const Int bsize = Blocksize();
+    const Grid& g = A.Grid();
+
+    // Temporary distributions
+    //
+    // The panels of A are double-buffered so that the redistribution of the
+    // next panel overlaps with the local update for the current one
+    DistMatrix<T,STAR,MC> A1_STAR_MC0(g), A1_STAR_MC1(g);
+    DistMatrix<T,STAR,MC>* A1_STAR_MC[2] = { &A1_STAR_MC0, &A1_STAR_MC1 };
+    DistMatrix<T,MR,STAR> D1Trans_MR_STAR(g);
+    CopyRequest<T> ARequests[2];
+
+    A1_STAR_MC0.AlignWith( B );
+    A1_STAR_MC1.AlignWith( B );
+    D1Trans_MR_STAR.AlignWith( B );
+
+    if( m > 0 )
+        CopyAsync( A( IR(0,Min(bsize,m)), ALL ), A1_STAR_MC0, ARequests[0] );
+    for( Int k=0, p=0; k<m; k+=bsize, p=1-p )
+    {
+        const Int nb = Min(bsize,m-k);
+        auto C1 = C( IR(k,k+nb), ALL );
+
+        // Prefetch the next panel of A
+        const Int kNext = k+nb;
+        if( kNext < m )
+        {
+            const Int nbNext = Min(bsize,m-kNext);
+            CopyAsync
+            ( A( IR(kNext,kNext+nbNext), ALL ), *A1_STAR_MC[1-p],
+              ARequests[1-p] );
+        }
+
+        // D1^T[MR,* ] := alpha B^T[MR,MC] A1^T[MC,* ]
+        ARequests[p].Wait();
+        LocalGemm
+        ( TRANSPOSE, TRANSPOSE, alpha, B, *A1_STAR_MC[p], D1Trans_MR_STAR );
+
+        TransposeAxpyContract( T(1), D1Trans_MR_STAR, C1 );
+    }
+}
+
 // Normal Normal Gemm that avoids communicating the matrix B
 template<typename T>
 void SUMMA_NNB
@@ -142,6 +179,7 @@ void SUMMA_NNB
         AbstractDistMatrix<T>& CPre )
 {
     EL_DEBUG_CSE
+    EL_REGION("gemm::SUMMA_NNB");
     const Int m = CPre.Height();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -152,6 +190,11 @@ void SUMMA_NNB
     auto& A = AProx.GetLocked();
     auto& B = BProx.GetLocked();
     auto& C = CProx.Get();
+    if( GemmPrefetchPanels() )
+    {
+        SUMMA_NNBPrefetch( alpha, A, B, C );
+        return;
+    }
 
     // Temporary distributions
     DistMatrix<T,STAR,MC> A1_STAR_MC(g);
@@ -175,6 +218,66 @@ void SUMMA_NNB
     }
 }
 
+// Normal Normal Gemm that avoids communicating the matrix C
+// (prefetching the panels of A and B; see SetGemmPrefetchPanels)
+template<typename T>
+void SUMMA_NNCPrefetch
+( T alpha,
+  const DistMatrix<T>& A,
+  const DistMatrix<T>& B,
+        DistMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    const Int sumDim = A.Width();
+    const Int bsize = Blocksize();
+    const Grid& g = A.Grid();
+
+    // Temporary distributions
+    //
+    // The panels of A and B are double-buffered so that the redistributions
+    // of the next panels overlap with the local update for the current ones
+    DistMatrix<T,MC,STAR> A1_MC_STAR0(g), A1_MC_STAR1(g);
+    DistMatrix<T,STAR,MR> B1_STAR_MR0(g), B1_STAR_MR1(g);
+    DistMatrix<T,MC,STAR>* A1_MC_STAR[2] = { &A1_MC_STAR0, &A1_MC_STAR1 };
+    DistMatrix<T,STAR,MR>* B1_STAR_MR[2] = { &B1_STAR_MR0, &B1_STAR_MR1 };
+    CopyRequest<T> ARequests[2], BRequests[2];
+
+    A1_MC_STAR0.AlignWith( C );
+    A1_MC_STAR1.AlignWith( C );
+    B1_STAR_MR0.AlignWith( C );
+    B1_STAR_MR1.AlignWith( C );
+
+    if( sumDim > 0 )
+    {
+        const Int nb = Min(bsize,sumDim);
+        CopyAsync( A( ALL, IR(0,nb) ), A1_MC_STAR0, ARequests[0] );
+        CopyAsync( B( IR(0,nb), ALL ), B1_STAR_MR0, BRequests[0] );
+    }
+    for( Int k=0, p=0; k<sumDim; k+=bsize, p=1-p )
+    {
+        const Int nb = Min(bsize,sumDim-k);
+
+        // Prefetch the next panels of A and B
+        const Int kNext = k+nb;
+        if( kNext < sumDim )
+        {
+            const Int nbNext = Min(bsize,sumDim-kNext);
+            CopyAsync
+            ( A( ALL, IR(kNext,kNext+nbNext) ), *A1_MC_STAR[1-p],
+              ARequests[1-p] );
+            CopyAsync
+            ( B( IR(kNext,kNext+nbNext), ALL ), *B1_STAR_MR[1-p],
+              BRequests[1-p] );
+        }
+
+        // C[MC,MR] += alpha A1[MC,*] B1[*,MR]
+        ARequests[p].Wait();
+        BRequests[p].Wait();
+        LocalGemm
+        ( NORMAL, NORMAL, alpha, *A1_MC_STAR[p], *B1_STAR_MR[p], T(1), C );
+    }
+}
+
 // Normal Normal Gemm that avoids communicating the matrix C
 template<typename T>
 void SUMMA_NNC
@@ -184,20 +287,38 @@ void SUMMA_NNC
         AbstractDistMatrix<T>& CPre )
 {
     EL_DEBUG_CSE
+    EL_REGION("gemm::SUMMA_NNC");
     const Int sumDim = APre.Width();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
 
-    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
-    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
     DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    // Each panel of A (B) is redistributed into a workspace whose column
+    // (row) alignment is that of C, which requires an extra exchange per
+    // panel unless A (B) is realigned beforehand
+    ElementalProxyCtrl ACtrl, BCtrl;
+    if( PreAlignInputs() )
+    {
+        ACtrl.colConstrain = true;
+        ACtrl.colAlign = C.ColAlign();
+        BCtrl.rowConstrain = true;
+        BCtrl.rowAlign = C.RowAlign();
+    }
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre, ACtrl );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre, BCtrl );
     auto& A = AProx.GetLocked();
     auto& B = BProx.GetLocked();
-    auto& C = CProx.Get();
+    if( GemmPrefetchPanels() )
+    {
+        SUMMA_NNCPrefetch( alpha, A, B, C );
+        return;
+    }
 
     // Temporary distributions
     DistMatrix<T,MC,STAR> A1_MC_STAR(g);
-    DistMatrix<T,MR,STAR> B1Trans_MR_STAR(g); 
+    DistMatrix<T,MR,STAR> B1Trans_MR_STAR(g);
 
     A1_MC_STAR.AlignWith( C );
     B1Trans_MR_STAR.AlignWith( C );
@@ -210,7 +331,7 @@ void SUMMA_NNC
 
         // C[MC,MR] += alpha A1[MC,*] (B1^T[MR,*])^T
         //           = alpha A1[MC,*] B1[*,MR]
-        A1_MC_STAR = A1; 
+        A1_MC_STAR = A1;
         Transpose( B1, B1Trans_MR_STAR );
         LocalGemm
         ( NORMAL, TRANSPOSE, alpha, A1_MC_STAR, B1Trans_MR_STAR, T(1), C );
@@ -231,6 +352,7 @@ void SUMMA_NNDot
   Int blockSize=2000 )
 {
     EL_DEBUG_CSE
+    EL_REGION("gemm::SUMMA_NNDot");
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Grid& g = APre.Grid();
@@ -293,28 +415,14 @@ void SUMMA_NN
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Width();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
-
+    if( alg == GEMM_DEFAULT )
+        alg = SelectGemmAlgorithm<T>( m, n, sumDim, A.Grid(), false );
     switch( alg )
     {
-    case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
-            SUMMA_NNDot( alpha, A, B, C, blockSizeDot );
-        else if( m <= n && weightTowardsC*m <= sumDim )
-            SUMMA_NNB( alpha, A, B, C );    
-        else if( n <= m && weightTowardsC*n <= sumDim )
-            SUMMA_NNA( alpha, A, B, C );
-        else
-            SUMMA_NNC( alpha, A, B, C );
-        break;
     case GEMM_SUMMA_A:   SUMMA_NNA( alpha, A, B, C ); break;
     case GEMM_SUMMA_B:   SUMMA_NNB( alpha, A, B, C ); break;
     case GEMM_SUMMA_C:   SUMMA_NNC( alpha, A, B, C ); break;
-    case GEMM_SUMMA_DOT: SUMMA_NNDot( alpha, A, B, C, blockSizeDot ); break;
+    case GEMM_SUMMA_DOT: SUMMA_NNDot( alpha, A, B, C, dotBlocksize ); break;
     default: LogicError("Unsupported Gemm option");
     }
 }
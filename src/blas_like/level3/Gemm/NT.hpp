@@ -20,6 +20,7 @@ void SUMMA_NTA
         AbstractDistMatrix<T>& CPre )
 {
     EL_DEBUG_CSE
+    EL_REGION("gemm::SUMMA_NTA");
     const Int n = CPre.Width();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -64,6 +65,7 @@ void SUMMA_NTB
         AbstractDistMatrix<T>& CPre )
 {
     EL_DEBUG_CSE
+    EL_REGION("gemm::SUMMA_NTB");
     const Int m = CPre.Height();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -110,6 +112,7 @@ void SUMMA_NTC
         AbstractDistMatrix<T>& CPre )
 {
     EL_DEBUG_CSE
+    EL_REGION("gemm::SUMMA_NTC");
     const Int sumDim = APre.Width();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -162,6 +165,7 @@ void SUMMA_NTDot
   Int blockSize=2000 )
 {
     EL_DEBUG_CSE
+    EL_REGION("gemm::SUMMA_NTDot");
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Grid& g = APre.Grid();
@@ -227,28 +231,16 @@ void SUMMA_NT
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Width();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
-
+    if( alg == GEMM_DEFAULT )
+        alg = SelectGemmAlgorithm<T>( m, n, sumDim, A.Grid(), false );
     switch( alg )
     {
-    case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
-            SUMMA_NTDot( orientB, alpha, A, B, C, blockSizeDot );
-        else if( m <= n && weightTowardsC*m <= sumDim )
-            SUMMA_NTB( orientB, alpha, A, B, C );
-        else if( n <= m && weightTowardsC*n <= sumDim )
-            SUMMA_NTA( orientB, alpha, A, B, C );
-        else
-            SUMMA_NTC( orientB, alpha, A, B, C );
-        break;
     case GEMM_SUMMA_A: SUMMA_NTA( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_B: SUMMA_NTB( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_NTC( orientB, alpha, A, B, C ); break;
-    case GEMM_SUMMA_DOT: SUMMA_NTDot( orientB, alpha, A, B, C ); break;
+    case GEMM_SUMMA_DOT:
+        SUMMA_NTDot( orientB, alpha, A, B, C, dotBlocksize );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
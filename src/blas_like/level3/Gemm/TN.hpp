@@ -20,6 +20,7 @@ void SUMMA_TNA
         AbstractDistMatrix<T>& CPre )
 {
     EL_DEBUG_CSE
+    EL_REGION("gemm::SUMMA_TNA");
     const Int n = CPre.Width();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -66,6 +67,7 @@ void SUMMA_TNB
         AbstractDistMatrix<T>& CPre )
 {
     EL_DEBUG_CSE
+    EL_REGION("gemm::SUMMA_TNB");
     const Int m = CPre.Height();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -109,6 +111,7 @@ void SUMMA_TNC
         AbstractDistMatrix<T>& CPre )
 {
     EL_DEBUG_CSE
+    EL_REGION("gemm::SUMMA_TNC");
     const Int sumDim = BPre.Height();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -157,6 +160,7 @@ void SUMMA_TNDot
   Int blockSize=2000 )
 {
     EL_DEBUG_CSE 
+    EL_REGION("gemm::SUMMA_TNDot");
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Grid& g = APre.Grid();
@@ -222,28 +226,16 @@ void SUMMA_TN
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Height();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
-
+    if( alg == GEMM_DEFAULT )
+        alg = SelectGemmAlgorithm<T>( m, n, sumDim, A.Grid(), false );
     switch( alg )
     {
-    case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
-            SUMMA_TNDot( orientA, alpha, A, B, C, blockSizeDot );
-        else if( m <= n && weightTowardsC*m <= sumDim )
-            SUMMA_TNB( orientA, alpha, A, B, C );
-        else if( n <= m && weightTowardsC*n <= sumDim )
-            SUMMA_TNA( orientA, alpha, A, B, C );
-        else
-            SUMMA_TNC( orientA, alpha, A, B, C );
-        break;
     case GEMM_SUMMA_A: SUMMA_TNA( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_B: SUMMA_TNB( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_TNC( orientA, alpha, A, B, C ); break;
-    case GEMM_SUMMA_DOT: SUMMA_TNDot( orientA, alpha, A, B, C ); break;
+    case GEMM_SUMMA_DOT:
+        SUMMA_TNDot( orientA, alpha, A, B, C, dotBlocksize );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
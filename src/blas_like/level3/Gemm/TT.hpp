@@ -21,6 +21,7 @@ void SUMMA_TTA
         AbstractDistMatrix<T>& CPre )
 {
     EL_DEBUG_CSE
+    EL_REGION("gemm::SUMMA_TTA");
     const Int n = CPre.Width();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -69,6 +70,7 @@ void SUMMA_TTB
         AbstractDistMatrix<T>& CPre )
 {
     EL_DEBUG_CSE
+    EL_REGION("gemm::SUMMA_TTB");
     const Int m = CPre.Height();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -120,6 +122,7 @@ void SUMMA_TTC
         AbstractDistMatrix<T>& CPre )
 {
     EL_DEBUG_CSE
+    EL_REGION("gemm::SUMMA_TTC");
     const Int sumDim = APre.Height();
     const Int bsize = Blocksize();
     const Grid& g = APre.Grid();
@@ -174,6 +177,7 @@ void SUMMA_TTDot
   Int blockSize=2000 )
 {
     EL_DEBUG_CSE 
+    EL_REGION("gemm::SUMMA_TTDot");
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Grid& g = APre.Grid();
@@ -239,24 +243,10 @@ void SUMMA_TT
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Height();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
-
-    // TODO(poulson): Make this tunable
-    const Int blockSizeDot = 2000;
-
+    if( alg == GEMM_DEFAULT )
+        alg = SelectGemmAlgorithm<T>( m, n, sumDim, A.Grid(), false );
     switch( alg )
     {
-    case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
-            SUMMA_TTDot( orientA, orientB, alpha, A, B, C, blockSizeDot );
-        else if( m <= n && weightTowardsC*m <= sumDim )
-            SUMMA_TTB( orientA, orientB, alpha, A, B, C );
-        else if( n <= m && weightTowardsC*n <= sumDim )
-            SUMMA_TTA( orientA, orientB, alpha, A, B, C );
-        else
-            SUMMA_TTC( orientA, orientB, alpha, A, B, C );
-        break;
     case GEMM_SUMMA_A:
         SUMMA_TTA( orientA, orientB, alpha, A, B, C );
         break;
@@ -267,7 +257,7 @@ void SUMMA_TT
         SUMMA_TTC( orientA, orientB, alpha, A, B, C );
         break;
     case GEMM_SUMMA_DOT:
-        SUMMA_TTDot( orientA, orientB, alpha, A, B, C );
+        SUMMA_TTDot( orientA, orientB, alpha, A, B, C, dotBlocksize );
         break;
     default: LogicError("Unsupported Gemm option");
     }
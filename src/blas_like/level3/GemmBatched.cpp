@@ -0,0 +1,130 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+namespace {
+
+#ifdef EL_HAVE_MKL_BATCH
+template<typename T,typename=DisableIf<IsBlasScalar<T>>,typename=void>
+#else
+template<typename T>
+#endif
+bool GemmBatchedMKL
+( Orientation orientA, Orientation orientB,
+  T alpha, const vector<Matrix<T>>& A,
+           const vector<Matrix<T>>& B,
+  T beta,        vector<Matrix<T>>& C )
+{ return false; }
+
+#ifdef EL_HAVE_MKL_BATCH
+template<typename T,typename=EnableIf<IsBlasScalar<T>>>
+bool GemmBatchedMKL
+( Orientation orientA, Orientation orientB,
+  T alpha, const vector<Matrix<T>>& A,
+           const vector<Matrix<T>>& B,
+  T beta,        vector<Matrix<T>>& C )
+{
+    EL_DEBUG_CSE
+    const Int batchSize = C.size();
+    vector<char> transA( batchSize, OrientationToChar(orientA) ),
+                 transB( batchSize, OrientationToChar(orientB) );
+    vector<BlasInt> m(batchSize), n(batchSize), k(batchSize),
+                    ALDim(batchSize), BLDim(batchSize), CLDim(batchSize);
+    vector<T> alphas( batchSize, alpha ), betas( batchSize, beta );
+    vector<const T*> ABufs(batchSize), BBufs(batchSize);
+    vector<T*> CBufs(batchSize);
+    for( Int b=0; b<batchSize; ++b )
+    {
+        m[b] = C[b].Height();
+        n[b] = C[b].Width();
+        k[b] = ( orientA == NORMAL ? A[b].Width() : A[b].Height() );
+        ABufs[b] = A[b].LockedBuffer();
+        BBufs[b] = B[b].LockedBuffer();
+        CBufs[b] = C[b].Buffer();
+        ALDim[b] = A[b].LDim();
+        BLDim[b] = B[b].LDim();
+        CLDim[b] = C[b].LDim();
+    }
+    mkl::GemmBatch
+    ( transA.data(), transB.data(), m.data(), n.data(), k.data(),
+      alphas.data(), ABufs.data(), ALDim.data(), BBufs.data(), BLDim.data(),
+      betas.data(), CBufs.data(), CLDim.data(), batchSize );
+    return true;
+}
+#endif // ifdef EL_HAVE_MKL_BATCH
+
+} // anonymous namespace
+
+template<typename T>
+void GemmBatched
+( Orientation orientA, Orientation orientB,
+  T alpha, const vector<Matrix<T>>& A,
+           const vector<Matrix<T>>& B,
+  T beta,        vector<Matrix<T>>& C )
+{
+    EL_DEBUG_CSE
+    EL_REGION("GemmBatched");
+    const Int batchSize = C.size();
+    if( Int(A.size()) != batchSize || Int(B.size()) != batchSize )
+        LogicError
+        ("Batches of sizes ",A.size(),", ",B.size(),", and ",batchSize,
+         " were not conformal");
+    for( Int b=0; b<batchSize; ++b )
+    {
+        const Int m = ( orientA == NORMAL ? A[b].Height() : A[b].Width() );
+        const Int k = ( orientA == NORMAL ? A[b].Width() : A[b].Height() );
+        const Int kB = ( orientB == NORMAL ? B[b].Height() : B[b].Width() );
+        const Int n = ( orientB == NORMAL ? B[b].Width() : B[b].Height() );
+        if( m != C[b].Height() || n != C[b].Width() || k != kB )
+            LogicError("Member ",b," of the Gemm batch was nonconformal");
+    }
+
+    if( GemmBatchedMKL( orientA, orientB, alpha, A, B, beta, C ) )
+        return;
+    ParallelFor( batchSize, [&]( Int b )
+    { Gemm( orientA, orientB, alpha, A[b], B[b], beta, C[b] ); } );
+}
+
+template<typename T>
+void GemmBatched
+( Orientation orientA, Orientation orientB, Int batchSize,
+  T alpha, const Matrix<T>& A,
+           const Matrix<T>& B,
+  T beta,        Matrix<T>& C )
+{
+    EL_DEBUG_CSE
+    auto ABatch = LockedBatchView( batchSize, A );
+    auto BBatch = LockedBatchView( batchSize, B );
+    auto CBatch = BatchView( batchSize, C );
+    GemmBatched( orientA, orientB, alpha, ABatch, BBatch, beta, CBatch );
+}
+
+#define PROTO(T) \
+  template void GemmBatched \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const vector<Matrix<T>>& A, \
+             const vector<Matrix<T>>& B, \
+    T beta,        vector<Matrix<T>>& C ); \
+  template void GemmBatched \
+  ( Orientation orientA, Orientation orientB, Int batchSize, \
+    T alpha, const Matrix<T>& A, \
+             const Matrix<T>& B, \
+    T beta,        Matrix<T>& C );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -94,6 +94,16 @@ void Herk
     Syrk( uplo, orientation, T(alpha), A, C, true );
 }
 
+template<typename T>
+void Herk
+( Orientation orientation,
+  Base<T> alpha, const AbstractDistMatrix<T>& A,
+  Base<T> beta,        DistPackedMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    Syrk( orientation, T(alpha), A, T(beta), C, true );
+}
+
 #define PROTO(T) \
   template void Herk \
   ( UpperOrLower uplo, Orientation orientation, \
@@ -124,7 +134,11 @@ void Herk
   template void Herk \
   ( UpperOrLower uplo, Orientation orientation, \
     Base<T> alpha, const DistSparseMatrix<T>& A, \
-                         DistSparseMatrix<T>& C );
+                         DistSparseMatrix<T>& C ); \
+  template void Herk \
+  ( Orientation orientation, \
+    Base<T> alpha, const AbstractDistMatrix<T>& A, \
+    Base<T> beta,        DistPackedMatrix<T>& C );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -14,6 +14,198 @@
 namespace El {
 
 namespace {
+
+// The number of right-hand sides accumulated at once by the row-major
+// multi-vector kernels; each row of the matrix is read once per tile
+const Int multiplyTileWidth = 16;
+
+// The minimum number of (column-major) right-hand sides for which the
+// sequential product first transposes them into row-major order
+const Int multiplyRowMajorMinRHS = 4;
+
+// Y(i,:) := alpha A(i,:) X + beta Y(i,:), where X(j,k) is stored at
+// X[j*ldX+k] (i.e., X is row-major) and Y(i,k) is stored at
+// Y[i*yRowStride+k*yColStride]. Each tile of right-hand sides is accumulated
+// over a single pass through the row so that the nonzeros of the matrix are
+// reused across the columns of X. The column indices may be of any integral
+// type so that compact (32-bit) local indices may be used.
+template<typename T,typename Index>
+void MultiplyRowMajorTiles
+( Int i, Int numRHS,
+  T alpha,
+  const Int* rowOffsets,
+  const Index* colIndices,
+  const T*   values,
+  const T*   X, Int ldX,
+  T beta,
+        T*   Y, Int yRowStride, Int yColStride )
+{
+    const Int eStart = rowOffsets[i];
+    const Int eStop = rowOffsets[i+1];
+    for( Int kStart=0; kStart<numRHS; kStart+=multiplyTileWidth )
+    {
+        const Int width = Min( multiplyTileWidth, numRHS-kStart );
+        T sums[multiplyTileWidth];
+        for( Int k=0; k<width; ++k )
+            sums[k] = 0;
+        for( Int e=eStart; e<eStop; ++e )
+        {
+            const T eta = values[e];
+            const T* EL_RESTRICT x = &X[colIndices[e]*ldX+kStart];
+            EL_SIMD
+            for( Int k=0; k<width; ++k )
+                sums[k] += eta*x[k];
+        }
+        T* y = &Y[i*yRowStride+kStart*yColStride];
+        for( Int k=0; k<width; ++k )
+            y[k*yColStride] = alpha*sums[k] + beta*y[k*yColStride];
+    }
+}
+
+// The complex version accumulates the real and imaginary parts of each tile
+// in separate (real) arrays with the arithmetic written out in real terms so
+// that the tile loop vectorizes rather than calling the special-value-aware
+// complex multiplication for every product
+template<typename Real,typename Index>
+void MultiplyRowMajorTiles
+( Int i, Int numRHS,
+  Complex<Real> alpha,
+  const Int* rowOffsets,
+  const Index* colIndices,
+  const Complex<Real>* values,
+  const Complex<Real>* X, Int ldX,
+  Complex<Real> beta,
+        Complex<Real>* Y, Int yRowStride, Int yColStride )
+{
+    typedef Complex<Real> C;
+    const Int eStart = rowOffsets[i];
+    const Int eStop = rowOffsets[i+1];
+    for( Int kStart=0; kStart<numRHS; kStart+=multiplyTileWidth )
+    {
+        const Int width = Min( multiplyTileWidth, numRHS-kStart );
+        Real sumsReal[multiplyTileWidth], sumsImag[multiplyTileWidth];
+        for( Int k=0; k<width; ++k )
+        {
+            sumsReal[k] = 0;
+            sumsImag[k] = 0;
+        }
+        for( Int e=eStart; e<eStop; ++e )
+        {
+            const Real etaReal = values[e].real();
+            const Real etaImag = values[e].imag();
+            const C* EL_RESTRICT x = &X[colIndices[e]*ldX+kStart];
+            EL_SIMD
+            for( Int k=0; k<width; ++k )
+            {
+                const Real xReal = x[k].real();
+                const Real xImag = x[k].imag();
+                sumsReal[k] += etaReal*xReal - etaImag*xImag;
+                sumsImag[k] += etaReal*xImag + etaImag*xReal;
+            }
+        }
+        C* y = &Y[i*yRowStride+kStart*yColStride];
+        for( Int k=0; k<width; ++k )
+            y[k*yColStride] =
+              alpha*C(sumsReal[k],sumsImag[k]) + beta*y[k*yColStride];
+    }
+}
+
+// Split the rows of a CSR matrix into contiguous blocks with roughly equal
+// numbers of nonzeros and call body(iBeg,iEnd) on each block, in parallel
+// when the product involves at least blas::FallbackThreshold() multiply-adds
+template<typename Body>
+void ForEachRowBlock( Int m, const Int* rowOffsets, Int numRHS, Body body )
+{
+    if( m == 0 )
+        return;
+#ifdef EL_HYBRID
+    const Int numEntries = rowOffsets[m];
+    int numThreads = 1;
+    if( double(numEntries)*numRHS >= blas::FallbackThreshold() &&
+        !omp_in_parallel() )
+        numThreads = Min( Int(blas::FallbackThreads()), m );
+    if( numThreads > 1 )
+    {
+        vector<Int> rowSplits( numThreads+1 );
+        for( Int t=0; t<numThreads; ++t )
+        {
+            const Int target = (numEntries*t) / numThreads;
+            rowSplits[t] =
+              std::lower_bound( rowOffsets, rowOffsets+m, target ) - rowOffsets;
+        }
+        rowSplits[numThreads] = m;
+        _Pragma("omp parallel for num_threads(numThreads)")
+        for( Int t=0; t<numThreads; ++t )
+            body( rowSplits[t], rowSplits[t+1] );
+        return;
+    }
+#endif
+    body( 0, m );
+}
+
+// Y := alpha A X + beta Y, where A is in the sliced ELLPACK format and
+// X(j,k) is stored at X[j*colStride+k*rhsStride]. The rows of each chunk are
+// independent and are therefore updated in SIMD lanes.
+template<typename T>
+void MultiplySlicedEllpack
+( Int numRHS,
+  T alpha,
+  const SlicedEllpack<T>& A,
+  const T* X, Int colStride, Int rhsStride,
+  T beta,
+        T* Y, Int ldY )
+{
+    EL_DEBUG_CSE
+    const Int chunkHeight = A.chunkHeight;
+    const Int numChunks = A.NumChunks();
+    const Int* rowPerm = A.rowPerm.data();
+    const Int* rowLengths = A.rowLengths.data();
+    const Int* targets = A.targets.data();
+    const T* values = A.values.data();
+#ifdef EL_HYBRID
+    const Int numEntries = A.chunkOffsets.back();
+    int numThreads = 1;
+    if( double(numEntries)*numRHS >= blas::FallbackThreshold() &&
+        !omp_in_parallel() )
+        numThreads = blas::FallbackThreads();
+    _Pragma("omp parallel for schedule(dynamic,16) num_threads(numThreads)")
+#endif
+    for( Int chunk=0; chunk<numChunks; ++chunk )
+    {
+        const Int chunkOffset = A.chunkOffsets[chunk];
+        const Int chunkWidth = A.ChunkWidth( chunk );
+        const Int iStart = chunk*chunkHeight;
+        const Int iEnd = Min( iStart+chunkHeight, A.height );
+        for( Int k=0; k<numRHS; ++k )
+        {
+            const T* EL_RESTRICT x = &X[k*rhsStride];
+            T sums[maxSlicedEllpackChunkHeight];
+            for( Int r=0; r<chunkHeight; ++r )
+                sums[r] = 0;
+            for( Int l=0; l<chunkWidth; ++l )
+            {
+                const Int* EL_RESTRICT slotTargets =
+                  &targets[chunkOffset+l*chunkHeight];
+                const T* EL_RESTRICT slotValues =
+                  &values[chunkOffset+l*chunkHeight];
+                // The padding is masked out rather than multiplied by zero so
+                // that non-finite entries of X do not leak into shorter rows
+                EL_SIMD
+                for( Int r=0; r<chunkHeight; ++r )
+                {
+                    const T prod = slotValues[r]*x[slotTargets[r]*colStride];
+                    sums[r] += ( l < rowLengths[iStart+r] ? prod : T(0) );
+                }
+            }
+            for( Int i=iStart; i<iEnd; ++i )
+            {
+                T& eta = Y[rowPerm[i]+k*ldY];
+                eta = alpha*sums[i-iStart] + beta*eta;
+            }
+        }
+    }
+}
+
 /**
  * MultiplyCSR specialization where the CSR matrix happens to have all nonzeros = 1.
  */
@@ -31,29 +223,32 @@ void MultiplyCSR
     EL_DEBUG_CSE
     if( orientation == NORMAL )
     {
+        ForEachRowBlock
+        ( m, rowOffsets, 1, [&]( Int iBeg, Int iEnd )
+          {
+              for( Int i=iBeg; i<iEnd; ++i )
+              {
+                  T sum = 0;
+                  const Int eStart = rowOffsets[i];
+                  const Int eStop = rowOffsets[i+1];
+                  for( Int e=eStart; e<eStop; ++e )
+                      sum += x[colIndices[e]];
+                  y[i] = alpha*sum + beta*y[i];
+              }
+          } );
+    }
+    else
+    {
+        for( Int j=0; j<n; ++j )
+            y[j] *= beta;
         for( Int i=0; i<m; ++i )
         {
-            T sum = 0;
             const Int eStart = rowOffsets[i];
             const Int eStop = rowOffsets[i+1];
             for( Int e=eStart; e<eStop; ++e )
-                sum += x[colIndices[e]];
-            y[i] = alpha*sum + beta*y[i];
+                y[colIndices[e]] += alpha*x[i];
         }
     }
-    else
-    {
-        for( Int j=0; j<n; ++j ){
-            y[j] *= beta;
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    y[colIndices[e]] += alpha*x[i];
-            }
-	}
-    }
 }
 
 template<typename T,typename=DisableIf<IsBlasScalar<T>>>
@@ -71,15 +266,19 @@ void MultiplyCSR
     EL_DEBUG_CSE
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];
-            y[i] = alpha*sum + beta*y[i];
-        }
+        ForEachRowBlock
+        ( m, rowOffsets, 1, [&]( Int iBeg, Int iEnd )
+          {
+              for( Int i=iBeg; i<iEnd; ++i )
+              {
+                  T sum = 0;
+                  const Int eStart = rowOffsets[i];
+                  const Int eStop = rowOffsets[i+1];
+                  for( Int e=eStart; e<eStop; ++e )
+                      sum += values[e]*x[colIndices[e]];
+                  y[i] = alpha*sum + beta*y[i];
+              }
+          } );
     }
     else
     {
@@ -132,15 +331,19 @@ void MultiplyCSR
 #else
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            T sum = 0;
-            const Int eStart = rowOffsets[i];
-            const Int eStop = rowOffsets[i+1];
-            for( Int e=eStart; e<eStop; ++e )
-                sum += values[e]*x[colIndices[e]];
-            y[i] = alpha*sum + beta*y[i];
-        }
+        ForEachRowBlock
+        ( m, rowOffsets, 1, [&]( Int iBeg, Int iEnd )
+          {
+              for( Int i=iBeg; i<iEnd; ++i )
+              {
+                  T sum = 0;
+                  const Int eStart = rowOffsets[i];
+                  const Int eStop = rowOffsets[i+1];
+                  for( Int e=eStart; e<eStop; ++e )
+                      sum += values[e]*x[colIndices[e]];
+                  y[i] = alpha*sum + beta*y[i];
+              }
+          } );
     }
     else
     {
@@ -192,20 +395,41 @@ void MultiplyCSR
         return;
     }
 
-    if( orientation == NORMAL )
+    if( orientation == NORMAL && numRHS >= multiplyRowMajorMinRHS )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
+        // Transpose X so that each row of A is applied to entire rows of X
+        vector<T> XRowMajor;
+        FastResize( XRowMajor, n*numRHS );
+        for( Int k=0; k<numRHS; ++k )
+            for( Int j=0; j<n; ++j )
+                XRowMajor[j*numRHS+k] = X[j+k*ldX];
+        ForEachRowBlock
+        ( m, rowOffsets, numRHS, [&]( Int iBeg, Int iEnd )
+          {
+              for( Int i=iBeg; i<iEnd; ++i )
+                  MultiplyRowMajorTiles
+                  ( i, numRHS, alpha, rowOffsets, colIndices, values,
+                    XRowMajor.data(), numRHS, beta, Y, 1, ldY );
+          } );
+    }
+    else if( orientation == NORMAL )
+    {
+        ForEachRowBlock
+        ( m, rowOffsets, numRHS, [&]( Int iBeg, Int iEnd )
+          {
+              for( Int i=iBeg; i<iEnd; ++i )
+              {
+                  for( Int k=0; k<numRHS; ++k )
+                  {
+                      T sum = 0;
+                      const Int eStart = rowOffsets[i];
+                      const Int eStop = rowOffsets[i+1];
+                      for( Int e=eStart; e<eStop; ++e )
+                          sum += values[e]*X[colIndices[e]+k*ldX];
+                      Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
+                  }
+              }
+          } );
     }
     else
     {
@@ -266,110 +490,71 @@ void MultiplyCSR
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += X[colIndices[e]+k*ldX];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
+        ForEachRowBlock
+        ( m, rowOffsets, numRHS, [&]( Int iBeg, Int iEnd )
+          {
+              for( Int i=iBeg; i<iEnd; ++i )
+              {
+                  for( Int k=0; k<numRHS; ++k )
+                  {
+                      T sum = 0;
+                      const Int eStart = rowOffsets[i];
+                      const Int eStop = rowOffsets[i+1];
+                      for( Int e=eStart; e<eStop; ++e )
+                          sum += X[colIndices[e]+k*ldX];
+                      Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
+                  }
+              }
+          } );
     }
     else
     {
         for( Int k=0; k<numRHS; ++k )
-	{
             for( Int j=0; j<n; ++j )
-	    {
                 Y[j+k*ldY] *= beta;
-            	for( Int i=0; i<m; ++i )
-            	{
-            	    const Int eStart = rowOffsets[i];
-            	    const Int eStop = rowOffsets[i+1];
-            	    for( Int e=eStart; e<eStop; ++e )
-            	        for( Int k=0; k<numRHS; ++k )
-            	            Y[colIndices[e]+k*ldY] += alpha*X[i+k*ldX];
-            	}
-            }
+        for( Int i=0; i<m; ++i )
+        {
+            const Int eStart = rowOffsets[i];
+            const Int eStop = rowOffsets[i+1];
+            for( Int e=eStart; e<eStop; ++e )
+                for( Int k=0; k<numRHS; ++k )
+                    Y[colIndices[e]+k*ldY] += alpha*X[i+k*ldX];
         }
     }
 }
 
-template<typename T>
-void MultiplyCSRInterX
-( Orientation orientation,
-  Int m, Int n, Int numRHS,
+// Y(i,:) += alpha A(i,:) X for each of the given rows i, where X is stored
+// with its columns interleaved, i.e., X(j,k) is stored at X[j*numRHS+k]
+template<typename T,typename Index>
+void MultiplyCSRRowsInterX
+( const vector<Int>& rows,
+  Int numRHS,
   T alpha,
   const Int* rowOffsets,
-  const Int* colIndices,
+  const Index* colIndices,
   const T*   values,
   const T*   X,
-  T beta,
         T*   Y, Int ldY )
 {
     EL_DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha,
-          rowOffsets, colIndices, values, X, beta, Y );
+    const Int numRows = rows.size();
+    if( numRows == 0 )
         return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
-    {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-        else
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];
-                }
-            }
-        }
-    }
+#ifdef EL_HYBRID
+    // Estimate the work from the average number of nonzeros per row
+    const Int firstRow = rows.front();
+    const Int lastRow = rows.back();
+    const double numMultiplyAdds = double(numRHS)*numRows*
+      (rowOffsets[lastRow+1]-rowOffsets[firstRow])/(lastRow-firstRow+1);
+    int numThreads = 1;
+    if( numMultiplyAdds >= blas::FallbackThreshold() && !omp_in_parallel() )
+        numThreads = blas::FallbackThreads();
+    _Pragma("omp parallel for schedule(dynamic,64) num_threads(numThreads)")
+#endif
+    for( Int s=0; s<numRows; ++s )
+        MultiplyRowMajorTiles
+        ( rows[s], numRHS, alpha, rowOffsets, colIndices, values,
+          X, numRHS, T(1), Y, 1, ldY );
 }
 
 template<typename T>
@@ -395,18 +580,22 @@ void MultiplyCSRInterY
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
-        }
+        ForEachRowBlock
+        ( m, rowOffsets, numRHS, [&]( Int iBeg, Int iEnd )
+          {
+              for( Int i=iBeg; i<iEnd; ++i )
+              {
+                  for( Int k=0; k<numRHS; ++k )
+                  {
+                      T sum = 0;
+                      const Int eStart = rowOffsets[i];
+                      const Int eStop = rowOffsets[i+1];
+                      for( Int e=eStart; e<eStop; ++e )
+                          sum += values[e]*X[colIndices[e]+k*ldX];
+                      Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
+                  }
+              }
+          } );
     }
     else
     {
@@ -468,18 +657,14 @@ void MultiplyCSRInter
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
-            }
-        }
+        ForEachRowBlock
+        ( m, rowOffsets, numRHS, [&]( Int iBeg, Int iEnd )
+          {
+              for( Int i=iBeg; i<iEnd; ++i )
+                  MultiplyRowMajorTiles
+                  ( i, numRHS, alpha, rowOffsets, colIndices, values,
+                    X, numRHS, beta, Y, numRHS, 1 );
+          } );
     }
     else
     {
@@ -531,6 +716,20 @@ void Multiply
       if( X.Width() != Y.Width() )
           LogicError("X and Y must have the same width");
     )
+    CountKernel<T>
+    ( double(A.NumEntries())*X.Width(),
+      A.NumEntries() + double(X.Height())*X.Width() +
+      2.*Y.Height()*Y.Width(),
+      sizeof(Int)*(A.NumEntries()+A.Height()+1.) );
+    if( orientation == NORMAL && A.SlicedEllpackEnabled() &&
+        A.FrozenSparsity() )
+    {
+        MultiplySlicedEllpack
+        ( X.Width(),
+          alpha, A.LockedSlicedEllpack(), X.LockedBuffer(), 1, X.LDim(),
+          beta,  Y.Buffer(), Y.LDim() );
+        return;
+    }
     MultiplyCSR
     ( orientation, A.Height(), A.Width(), X.Width(),
       alpha, A.LockedOffsetBuffer(),
@@ -594,19 +793,12 @@ void Multiply
 
     A.InitializeMultMeta();
     const auto& meta = A.LockedDistGraph().multMeta;
-    // Convert the sizes and offsets to be compatible with the current width
     const Int b = X.Width();
-    vector<int> recvSizes=meta.recvSizes,
-                recvOffs=meta.recvOffs,
-                sendSizes=meta.sendSizes,
-                sendOffs=meta.sendOffs;
-    for( int q=0; q<commSize; ++q )
-    {
-        recvSizes[q] *= b;
-        recvOffs[q] *= b;
-        sendSizes[q] *= b;
-        sendOffs[q] *= b;
-    }
+    CountKernel<T>
+    ( double(A.NumLocalEntries())*b,
+      A.NumLocalEntries() + double(X.LocalHeight())*b +
+      2.*Y.LocalHeight()*b,
+      sizeof(Int)*(A.NumLocalEntries()+A.LocalHeight()+1.) );
 
     if( orientation == NORMAL )
     {
@@ -615,6 +807,20 @@ void Multiply
         if( A.Width() != X.Height() )
             LogicError("The width of A must match the height of X");
 
+        // Convert the sizes and offsets to be compatible with the current
+        // width
+        vector<int> recvSizes=meta.recvSizes,
+                    recvOffs=meta.recvOffs,
+                    sendSizes=meta.sendSizes,
+                    sendOffs=meta.sendOffs;
+        for( int q=0; q<commSize; ++q )
+        {
+            recvSizes[q] *= b;
+            recvOffs[q] *= b;
+            sendSizes[q] *= b;
+            sendOffs[q] *= b;
+        }
+
         // Pack the send values
         const Int numSendInds = meta.sendInds.size();
         const Int firstLocalRow = X.FirstLocalRow();
@@ -630,24 +836,83 @@ void Multiply
                 sendVals[s*b+t] = XBuffer[iLoc+t*ldX];
         }
 
-        // Now send them
         vector<T> recvVals( meta.numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), sendSizes.data(), sendOffs.data(),
-          recvVals.data(), recvSizes.data(), recvOffs.data(), grid.Comm() );
-
-        // Perform the local multiply-accumulate, y := alpha A x + y
-        if( time && commRank == 0 )
-            timer.Start();
-        MultiplyCSRInterX
-        ( NORMAL, A.LocalHeight(), meta.numRecvInds, b,
-          alpha, A.LockedOffsetBuffer(),
-                 meta.colOffs.data(),
-                 A.LockedValueBuffer(),
-                 recvVals.data(),
-          T(1),  Y.Matrix().Buffer(), Y.Matrix().LDim() );
-        if( time && commRank == 0 )
-            Output("  MultiplyCSRInterX time: ",timer.Stop());
+        const T* values = A.LockedValueBuffer();
+        const Int* offsets = A.LockedOffsetBuffer();
+        T* YBuffer = Y.Matrix().Buffer();
+        const Int ldY = Y.Matrix().LDim();
+        if( A.SlicedEllpackEnabled() && A.FrozenSparsity() )
+        {
+            // The sliced ELLPACK rows are reordered, so there is no overlap
+            mpi::AllToAll
+            ( sendVals.data(), sendSizes.data(), sendOffs.data(),
+              recvVals.data(), recvSizes.data(), recvOffs.data(),
+              grid.Comm() );
+            if( time && commRank == 0 )
+                timer.Start();
+            MultiplySlicedEllpack
+            ( b, alpha, A.LockedSlicedEllpack(), recvVals.data(), b, 1,
+              T(1), YBuffer, ldY );
+            if( time && commRank == 0 )
+                Output("  MultiplySlicedEllpack time: ",timer.Stop());
+        }
+        else
+        {
+            // Post the exchange with the neighboring processes and directly
+            // copy our own contribution
+            int numRecvs=0, numSends=0;
+            for( const int q : meta.neighbors )
+            {
+                if( recvSizes[q] > 0 )
+                    ++numRecvs;
+                if( sendSizes[q] > 0 )
+                    ++numSends;
+            }
+            vector<mpi::Request<T>> recvRequests(numRecvs),
+                                    sendRequests(numSends);
+            numRecvs = numSends = 0;
+            for( const int q : meta.neighbors )
+            {
+                if( recvSizes[q] > 0 )
+                    mpi::IRecv
+                    ( &recvVals[recvOffs[q]], recvSizes[q], q, grid.Comm(),
+                      recvRequests[numRecvs++] );
+            }
+            for( const int q : meta.neighbors )
+            {
+                if( sendSizes[q] > 0 )
+                    mpi::ISend
+                    ( &sendVals[sendOffs[q]], sendSizes[q], q, grid.Comm(),
+                      sendRequests[numSends++] );
+            }
+            std::copy
+            ( sendVals.begin()+sendOffs[commRank],
+              sendVals.begin()+sendOffs[commRank]+sendSizes[commRank],
+              recvVals.begin()+recvOffs[commRank] );
+
+            // Perform the local multiply-accumulate, y := alpha A x + y, over
+            // the interior rows while the remote entries are in flight and
+            // then over the boundary rows
+            if( time && commRank == 0 )
+                timer.Start();
+            auto localMultiply = [&]( const vector<Int>& rows )
+              {
+                  if( meta.compactColOffs.empty() )
+                      MultiplyCSRRowsInterX
+                      ( rows, b, alpha, offsets, meta.colOffs.data(), values,
+                        recvVals.data(), YBuffer, ldY );
+                  else
+                      MultiplyCSRRowsInterX
+                      ( rows, b, alpha, offsets, meta.compactColOffs.data(),
+                        values, recvVals.data(), YBuffer, ldY );
+              };
+            localMultiply( meta.interiorSources );
+            mpi::WaitAll( numRecvs, recvRequests.data() );
+            localMultiply( meta.boundarySources );
+            mpi::WaitAll( numSends, sendRequests.data() );
+            if( time && commRank == 0 )
+                Output("  MultiplyCSRRowsInterX time: ",timer.Stop());
+        }
     }
     else
     {
@@ -660,10 +925,15 @@ void Multiply
         if( time && commRank == 0 )
             timer.Start();
         vector<T> sendVals( meta.numRecvInds*b, 0 );
+        // The adjoint kernels index with Int, so expand compact offsets
+        vector<Int> colOffs;
+        if( !meta.compactColOffs.empty() )
+            colOffs.assign
+            ( meta.compactColOffs.begin(), meta.compactColOffs.end() );
         MultiplyCSRInterY
         ( orientation, A.LocalHeight(), meta.numRecvInds, b,
           alpha, A.LockedOffsetBuffer(),
-                 meta.colOffs.data(),
+                 ( colOffs.empty() ? meta.colOffs.data() : colOffs.data() ),
                  A.LockedValueBuffer(),
                  X.LockedMatrix().LockedBuffer(), X.LockedMatrix().LDim(),
           T(1),  sendVals.data() );
@@ -674,9 +944,8 @@ void Multiply
         const Int numRecvInds = meta.sendInds.size();
         vector<T> recvVals;
         FastResize( recvVals, numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), recvSizes.data(), recvOffs.data(),
-          recvVals.data(), sendSizes.data(), sendOffs.data(), grid.Comm() );
+        meta.NeighborExchange
+        ( sendVals.data(), recvVals.data(), b, true, grid.Comm() );
 
         // Accumulate the received indices onto Y
         const Int firstLocalRow = Y.FirstLocalRow();
@@ -18,10 +18,55 @@ Base<T> MaxNorm( const Matrix<T>& A );
 
 namespace safemstrsm {
 
+// Solve (U - shift_j I) x_j = b_j for shifts whose estimated growth is safe.
+// The diagonal block is recursively halved so that all but O(n leafSize)
+// of the work is performed by Gemm, and the leaves perform a row-oriented
+// back-substitution which is vectorized over the shifts.
+template<typename F>
+void LUNBatch
+( const Matrix<F>& U,
+  const Matrix<F>& shifts,
+        Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    const Int n = U.Height();
+    const Int numShifts = X.Width();
+    const Int leafSize = 32;
+    if( n <= leafSize )
+    {
+        const Int XLDim = X.LDim();
+        for( Int i=n-1; i>=0; --i )
+        {
+            const F Uii = U(i,i);
+            F* XRow = X.Buffer(i,0);
+            const F* shiftBuf = shifts.LockedBuffer();
+            for( Int j=0; j<numShifts; ++j )
+                XRow[j*XLDim] /= Uii - shiftBuf[j];
+            if( i > 0 )
+                blas::Geru
+                ( i, numShifts, F(-1), U.LockedBuffer(0,i), 1,
+                  XRow, XLDim, X.Buffer(), XLDim );
+        }
+        return;
+    }
+
+    const Int nHalf = n/2;
+    const Range<Int> ind0( 0, nHalf ), ind1( nHalf, n );
+    auto X0 = X( ind0, ALL );
+    auto X1 = X( ind1, ALL );
+    LUNBatch( U(ind1,ind1), shifts, X1 );
+    Gemm( NORMAL, NORMAL, F(-1), U(ind0,ind1), X1, F(1), X0 );
+    LUNBatch( U(ind0,ind0), shifts, X0 );
+}
+
 /*   Note: See "Robust Triangular Solves for Use in Condition
  *   Estimation" by Edward Anderson for notation and bounds.
  *   Entries in U are assumed to be less (in magnitude) than 
  *   bigNum.
+ *
+ *   The shifts whose growth estimates are safe are solved together by
+ *   LUNBatch, and only the remainder fall back to a scalar
+ *   back-substitution with per-entry scaling.
  */
 template<typename F>
 void LUNBlock
@@ -66,14 +111,13 @@ void LUNBlock
             cNorm(j) = Max( cNorm(j), Abs(U(i,j)) );
     }
 
-    // Iterate through RHS's
+    // Classify the RHS's by their estimated growth
+    vector<Int> safeInds, riskyInds;
+    Matrix<Real> XMax( numShifts, 1 );
     for( Int j=0; j<numShifts; ++j )
     {
-        // Initialize triangular system
-        SetDiagonal( U, diag );
-        ShiftDiagonal( U, -shifts.Get(j,0) );
         auto xj = X( ALL, IR(j) );
-        Real scales_j = Real(1);
+        const F shift = shifts(j);
 
         // Determine largest entry of RHS
         Real xjMax = MaxNorm( xj );
@@ -82,8 +126,9 @@ void LUNBlock
             const Real s = oneHalf*bigNum/xjMax;
             xj *= s;
             xjMax *= s;
-            scales_j *= s;
+            scales(j) = s;
         }
+        XMax(j) = xjMax;
         if( xjMax <= smallNum )
         {
             continue;
@@ -96,7 +141,7 @@ void LUNBlock
         Real invMi = invGi;
         for( Int i=n-1; i>=0; --i )
         {
-            const Real absUii = SafeAbs( U(i,i) );
+            const Real absUii = SafeAbs( diag(i)-shift );
             if( invGi<=smallNum || invMi<=smallNum || absUii<=smallNum )
             {
                 invGi = 0;
@@ -111,92 +156,120 @@ void LUNBlock
         invGi = Min( invGi, invMi );
 
         if( invGi > smallNum )
+            safeInds.push_back( j );
+        else
+            riskyInds.push_back( j );
+    }
+
+    // Solve the systems with safe growth estimates together
+    const Int numSafe = safeInds.size();
+    if( numSafe == numShifts )
+    {
+        LUNBatch( U, shifts, X );
+    }
+    else if( numSafe > 0 )
+    {
+        Matrix<F> safeShifts( numSafe, 1 ), XSafe( n, numSafe );
+        for( Int jSafe=0; jSafe<numSafe; ++jSafe )
         {
-            // Call TRSV since estimated growth is not too large
-            blas::Trsv( 'U', 'N', 'N', n, &U(0,0), U.LDim(), &xj(0), 1 );
+            const Int j = safeInds[jSafe];
+            safeShifts(jSafe) = shifts(j);
+            MemCopy( XSafe.Buffer(0,jSafe), X.LockedBuffer(0,j), n );
         }
-        else
+        LUNBatch( U, safeShifts, XSafe );
+        for( Int jSafe=0; jSafe<numSafe; ++jSafe )
+            MemCopy
+            ( X.Buffer(0,safeInds[jSafe]), XSafe.LockedBuffer(0,jSafe), n );
+    }
+
+    // Perform backward substitution where the estimated growth is large
+    for( const Int j : riskyInds )
+    {
+        // Initialize triangular system
+        SetDiagonal( U, diag );
+        ShiftDiagonal( U, -shifts.Get(j,0) );
+        auto xj = X( ALL, IR(j) );
+        Real scales_j = RealPart(scales(j));
+        Real xjMax = XMax(j);
+
+        for( Int i=n-1; i>=0; --i )
         {
-            // Perform backward substitution since estimated growth is large
-            for( Int i=n-1; i>=0; --i )
+            // Perform division and check for overflow
+            const F Uii = U(i,i);
+            const Real absUii = SafeAbs( Uii );
+            F Xij = xj(i);
+            Real absXij = SafeAbs( Xij );
+            if( absUii > smallNum )
             {
-                // Perform division and check for overflow
-                const F Uii = U(i,i);
-                const Real absUii = SafeAbs( Uii );
-                F Xij = xj(i);
-                Real absXij = SafeAbs( Xij );
-                if( absUii > smallNum )
+                if( absUii<=1 && absXij>=absUii*bigNum )
                 {
-                    if( absUii<=1 && absXij>=absUii*bigNum )
-                    {
-                        // Set overflowing entry to 0.5/U[i,i]
-                        const Real s = oneHalf/absXij;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        scales_j *= s;
-                    }
-                    Xij /= Uii;
+                    // Set overflowing entry to 0.5/U[i,i]
+                    const Real s = oneHalf/absXij;
+                    Xij *= s;
+                    xj *= s;
+                    xjMax *= s;
+                    scales_j *= s;
                 }
-                else if( absUii > 0 )
+                Xij /= Uii;
+            }
+            else if( absUii > 0 )
+            {
+                if( absXij >= absUii*bigNum )
                 {
-                    if( absXij >= absUii*bigNum )
-                    {
-                        // Set overflowing entry to bigNum/2
-                        const Real s = oneHalf*absUii*bigNum/absXij;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        scales_j *= s;
-                    }
-                    Xij /= Uii;
+                    // Set overflowing entry to bigNum/2
+                    const Real s = oneHalf*absUii*bigNum/absXij;
+                    Xij *= s;
+                    xj *= s;
+                    xjMax *= s;
+                    scales_j *= s;
                 }
-                else
+                Xij /= Uii;
+            }
+            else
+            {
+                // TODO: maybe this tolerance should be loosened to
+                //   | Xij | >= || A || * eps
+                if( absXij >= smallNum )
                 {
-                    // TODO: maybe this tolerance should be loosened to
-                    //   | Xij | >= || A || * eps
-                    if( absXij >= smallNum )
-                    {
-                        Xij = F(1);
-                        Zero( xj );
-                        xjMax = Real(0);
-                        scales_j = Real(0);
-                    }
+                    Xij = F(1);
+                    Zero( xj );
+                    xjMax = Real(0);
+                    scales_j = Real(0);
                 }
-                xj(i) = Xij;
-                
-                if( i > 0 )
-                {
+            }
+            xj(i) = Xij;
+            
+            if( i > 0 )
+            {
 
-                    // Check for possible overflows in AXPY
-                    // Note: G(i+1) <= G(i) + | Xij | * cNorm(i)
-                    absXij = SafeAbs( Xij );
-                    const Real cNorm_i = cNorm(i);
-                    if( absXij >= Real(1) &&
-                        cNorm_i >= (bigNum-xjMax)/absXij )
-                    {
-                        const Real s = oneQuarter/absXij;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        absXij *= s;
-                        scales_j *= s;
-                    }
-                    else if( absXij < Real(1) &&
-                             absXij*cNorm_i >= bigNum-xjMax )
-                    {
-                        const Real s = oneQuarter;
-                        Xij *= s;
-                        xj *= s;
-                        xjMax *= s;
-                        absXij *= s;
-                        scales_j *= s;
-                    }
-                    xjMax += absXij*cNorm_i;
-
-                    // AXPY X(0:i,j) -= Xij*U(0:i,i)
-                    blas::Axpy( i, -Xij, &U(0,i), 1, &xj(0), 1 );
+                // Check for possible overflows in AXPY
+                // Note: G(i+1) <= G(i) + | Xij | * cNorm(i)
+                absXij = SafeAbs( Xij );
+                const Real cNorm_i = cNorm(i);
+                if( absXij >= Real(1) &&
+                    cNorm_i >= (bigNum-xjMax)/absXij )
+                {
+                    const Real s = oneQuarter/absXij;
+                    Xij *= s;
+                    xj *= s;
+                    xjMax *= s;
+                    absXij *= s;
+                    scales_j *= s;
                 }
+                else if( absXij < Real(1) &&
+                         absXij*cNorm_i >= bigNum-xjMax )
+                {
+                    const Real s = oneQuarter;
+                    Xij *= s;
+                    xj *= s;
+                    xjMax *= s;
+                    absXij *= s;
+                    scales_j *= s;
+                }
+                xjMax += absXij*cNorm_i;
+
+                // AXPY X(0:i,j) -= Xij*U(0:i,i)
+                blas::Axpy( i, -Xij, &U(0,i), 1, &xj(0), 1 );
             }
         }
         scales(j) = scales_j;
@@ -394,7 +467,41 @@ void LUN
     scalesUpdate_VR_STAR.Resize( n, 1 );
 
     const Int XLocalWidth = X.LocalWidth();
-    
+    const Int XLocalHeight = X.LocalHeight();
+
+    const Real oneHalf = Real(1)/Real(2);
+
+    auto overflowPair = OverflowParameters<Real>();
+    const Real smallNum = overflowPair.first;
+    const Real bigNum = overflowPair.second;
+
+    // The scalings needed to protect the GEMM updates are accumulated
+    // redundantly over each process column, since every process in it owns
+    // the same columns of X and makes the same decisions
+    DistMatrix<F,MR,STAR> gemmScales_MR_STAR( X.Grid() );
+    gemmScales_MR_STAR.AlignWith( X );
+    gemmScales_MR_STAR.Resize( n, 1 );
+    Fill( gemmScales_MR_STAR, F(1) );
+
+    // Determine largest entry of each (local) RHS
+    vector<Real> XMax( XLocalWidth, 0 );
+    for( Int jLoc=0; jLoc<XLocalWidth; ++jLoc )
+        for( Int iLoc=0; iLoc<XLocalHeight; ++iLoc )
+            XMax[jLoc] = Max( XMax[jLoc], Abs(X.GetLocal(iLoc,jLoc)) );
+    mpi::AllReduce( XMax.data(), XLocalWidth, mpi::MAX, X.ColComm() );
+    for( Int jLoc=0; jLoc<XLocalWidth; ++jLoc )
+    {
+        if( XMax[jLoc] >= bigNum )
+        {
+            const Real s = oneHalf*bigNum/XMax[jLoc];
+            blas::Scal( XLocalHeight, s, X.Buffer(0,jLoc), 1 );
+            XMax[jLoc] *= s;
+            gemmScales_MR_STAR.Matrix()(jLoc) *= s;
+        }
+        XMax[jLoc] = Max( XMax[jLoc], 2*smallNum );
+    }
+
+    vector<Real> U01ColMax;
     for( Int k=kLast; k>=0; k-=bsize )
     {
         const Int nb = Min(bsize,m-k);
@@ -436,20 +543,62 @@ void LUN
                 // TODO: Delay rescaling of X2 until the end since it is no
                 //       longer used within this loop?
                 blas::Scal( X2.LocalHeight(), sigma, X2.Buffer(0,jLoc), 1 );
+                XMax[jLoc] *= sigma;
             }
         }
         DiagonalScale( LEFT,  NORMAL, scalesUpdate_VR_STAR, scales );
         
         if( k > 0 )
         {
-            // Update RHS with GEMM
-            // X0[MC,MR] -= U01[MC,* ] X1[* ,MR]
             U01_MC_STAR.AlignWith( X0 );
             U01_MC_STAR = U01; // U01[MC,* ] <- U01[MC,MR]
+
+            // Compute infinity norms of columns in U01
+            // Note: nb*cNorm is the sum of infinity norms
+            const Int U01LocalHeight = U01_MC_STAR.LocalHeight();
+            U01ColMax.assign( nb, 0 );
+            for( Int j=0; j<nb; ++j )
+                for( Int iLoc=0; iLoc<U01LocalHeight; ++iLoc )
+                    U01ColMax[j] =
+                      Max( U01ColMax[j], Abs(U01_MC_STAR.GetLocal(iLoc,j)) );
+            mpi::AllReduce
+            ( U01ColMax.data(), nb, mpi::MAX, U01_MC_STAR.ColComm() );
+            Real cNorm = 0;
+            for( Int j=0; j<nb; ++j )
+                cNorm += U01ColMax[j] / nb;
+
+            // Check for possible overflows in GEMM
+            // Note: G(i+1) <= G(i) + nb*cNorm*|| X1[:,j] ||_infty
+            for( Int jLoc=0; jLoc<XLocalWidth; ++jLoc )
+            {
+                Real X1Max = 0;
+                for( Int i=0; i<nb; ++i )
+                    X1Max = Max( X1Max, Abs(X1_STAR_MR.GetLocal(i,jLoc)) );
+                Real s = 1;
+                if( X1Max >= 1 && cNorm >= (bigNum-XMax[jLoc])/X1Max/nb )
+                    s = oneHalf/(X1Max*nb);
+                else if( X1Max < 1 && cNorm*X1Max >= (bigNum-XMax[jLoc])/nb )
+                    s = oneHalf/nb;
+                if( s < Real(1) )
+                {
+                    blas::Scal( XLocalHeight, s, X.Buffer(0,jLoc), 1 );
+                    blas::Scal( nb, s, X1_STAR_MR.Buffer(0,jLoc), 1 );
+                    gemmScales_MR_STAR.Matrix()(jLoc) *= s;
+                    XMax[jLoc] *= s;
+                    X1Max *= s;
+                }
+                XMax[jLoc] += nb*cNorm*X1Max;
+            }
+
+            // Update RHS with GEMM
+            // X0[MC,MR] -= U01[MC,* ] X1[* ,MR]
             LocalGemm
             ( NORMAL, NORMAL, F(-1), U01_MC_STAR, X1_STAR_MR, F(1), X0 );
         }
     }
+
+    scalesUpdate_VR_STAR = gemmScales_MR_STAR;
+    DiagonalScale( LEFT, NORMAL, scalesUpdate_VR_STAR, scales );
 }
   
 } // namespace safemstrsm
@@ -0,0 +1,581 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+namespace {
+
+// An open-addressing hash table from the column indices of a row of a sparse
+// product to their slots within the row. Its storage is reused between rows.
+class ColumnHashTable
+{
+public:
+    // Prepare the table for at most 'maxKeys' distinct columns
+    void Reset( Int maxKeys )
+    {
+        Int size = 16;
+        while( size < 2*maxKeys )
+            size *= 2;
+        mask_ = size-1;
+        if( Int(keys_.size()) < size )
+        {
+            keys_.resize( size );
+            slots_.resize( size );
+        }
+        std::fill( keys_.begin(), keys_.begin()+size, Int(-1) );
+    }
+
+    // Return the slot of 'key', first assigning it 'slot' if it is new
+    Int Insert( Int key, Int slot )
+    {
+        Int h = Hash( key );
+        while( true )
+        {
+            if( keys_[h] == key )
+                return slots_[h];
+            if( keys_[h] == -1 )
+            {
+                keys_[h] = key;
+                slots_[h] = slot;
+                return slot;
+            }
+            h = (h+1) & mask_;
+        }
+    }
+
+    // Return the slot of 'key', or -1 if it is not in the table
+    Int Find( Int key ) const
+    {
+        Int h = Hash( key );
+        while( true )
+        {
+            if( keys_[h] == key )
+                return slots_[h];
+            if( keys_[h] == -1 )
+                return -1;
+            h = (h+1) & mask_;
+        }
+    }
+
+private:
+    Int mask_=0;
+    vector<Int> keys_, slots_;
+
+    Int Hash( Int key ) const
+    {
+        const unsigned long long scrambled =
+          static_cast<unsigned long long>(key)*0x9E3779B97F4A7C15ULL;
+        return Int(scrambled >> 32) & mask_;
+    }
+};
+
+// A compressed-row view of the left operand of C := A B, where the columns of
+// A have been mapped to rows of the (compressed-row) right operand
+template<typename T>
+struct ProductOperands
+{
+    Int numRows;
+    Int numCols;
+    const Int* aOffsets;
+    const Int* aRows;
+    const T* aValues;
+    const Int* bOffsets;
+    const Int* bCols;
+    const T* bValues;
+};
+
+template<typename T>
+int ProductThreads( const ProductOperands<T>& ops )
+{
+    int numThreads = 1;
+#ifdef EL_HYBRID
+    if( double(ops.aOffsets[ops.numRows]) >= blas::FallbackThreshold() &&
+        !omp_in_parallel() )
+        numThreads = blas::FallbackThreads();
+#endif
+    return numThreads;
+}
+
+// An upper bound on the number of nonzeros in row i of the product
+template<typename T>
+Int ProductRowBound( const ProductOperands<T>& ops, Int i )
+{
+    Int bound = 0;
+    for( Int e=ops.aOffsets[i]; e<ops.aOffsets[i+1]; ++e )
+    {
+        const Int k = ops.aRows[e];
+        bound += ops.bOffsets[k+1] - ops.bOffsets[k];
+    }
+    return Min( bound, ops.numCols );
+}
+
+// Count the nonzeros in each row of the product and then write the sorted
+// column indices of each row into 'cCols' (of length cOffsets[numRows])
+template<typename T>
+void ProductPattern
+( const ProductOperands<T>& ops, vector<Int>& cOffsets, vector<Int>& cCols )
+{
+    EL_DEBUG_CSE
+    const Int numRows = ops.numRows;
+    const int numThreads = ProductThreads( ops );
+    EL_UNUSED(numThreads);
+
+    vector<Int> rowCounts( numRows );
+#ifdef EL_HYBRID
+    _Pragma("omp parallel num_threads(numThreads)")
+#endif
+    {
+        ColumnHashTable table;
+#ifdef EL_HYBRID
+        _Pragma("omp for schedule(dynamic,64)")
+#endif
+        for( Int i=0; i<numRows; ++i )
+        {
+            table.Reset( ProductRowBound( ops, i ) );
+            Int numUnique = 0;
+            for( Int e=ops.aOffsets[i]; e<ops.aOffsets[i+1]; ++e )
+            {
+                const Int k = ops.aRows[e];
+                for( Int f=ops.bOffsets[k]; f<ops.bOffsets[k+1]; ++f )
+                    if( table.Insert( ops.bCols[f], numUnique ) == numUnique )
+                        ++numUnique;
+            }
+            rowCounts[i] = numUnique;
+        }
+    }
+
+    cOffsets.resize( numRows+1 );
+    Int offset = 0;
+    for( Int i=0; i<numRows; ++i )
+    {
+        cOffsets[i] = offset;
+        offset += rowCounts[i];
+    }
+    cOffsets[numRows] = offset;
+    cCols.resize( offset );
+
+#ifdef EL_HYBRID
+    _Pragma("omp parallel num_threads(numThreads)")
+#endif
+    {
+        ColumnHashTable table;
+#ifdef EL_HYBRID
+        _Pragma("omp for schedule(dynamic,64)")
+#endif
+        for( Int i=0; i<numRows; ++i )
+        {
+            table.Reset( rowCounts[i] );
+            Int* rowCols = &cCols[cOffsets[i]];
+            Int numUnique = 0;
+            for( Int e=ops.aOffsets[i]; e<ops.aOffsets[i+1]; ++e )
+            {
+                const Int k = ops.aRows[e];
+                for( Int f=ops.bOffsets[k]; f<ops.bOffsets[k+1]; ++f )
+                {
+                    const Int j = ops.bCols[f];
+                    if( table.Insert( j, numUnique ) == numUnique )
+                        rowCols[numUnique++] = j;
+                }
+            }
+            std::sort( rowCols, rowCols+numUnique );
+        }
+    }
+}
+
+// Overwrite the values of the (previously formed) pattern of the product.
+// Returns false if a nonzero of the product was missing from the pattern.
+template<typename T>
+bool ProductValues
+( const ProductOperands<T>& ops,
+  const Int* cOffsets,
+  const Int* cCols,
+        T* cValues )
+{
+    EL_DEBUG_CSE
+    const Int numRows = ops.numRows;
+    const int numThreads = ProductThreads( ops );
+    EL_UNUSED(numThreads);
+
+    bool missing = false;
+#ifdef EL_HYBRID
+    _Pragma("omp parallel num_threads(numThreads)")
+#endif
+    {
+        ColumnHashTable table;
+#ifdef EL_HYBRID
+        _Pragma("omp for schedule(dynamic,64) reduction(||:missing)")
+#endif
+        for( Int i=0; i<numRows; ++i )
+        {
+            const Int rowOffset = cOffsets[i];
+            const Int rowLength = cOffsets[i+1] - rowOffset;
+            table.Reset( rowLength );
+            for( Int s=0; s<rowLength; ++s )
+            {
+                table.Insert( cCols[rowOffset+s], s );
+                cValues[rowOffset+s] = 0;
+            }
+            for( Int e=ops.aOffsets[i]; e<ops.aOffsets[i+1]; ++e )
+            {
+                const Int k = ops.aRows[e];
+                const T alpha = ops.aValues[e];
+                for( Int f=ops.bOffsets[k]; f<ops.bOffsets[k+1]; ++f )
+                {
+                    const Int s = table.Find( ops.bCols[f] );
+                    if( s < 0 )
+                        missing = true;
+                    else
+                        cValues[rowOffset+s] += alpha*ops.bValues[f];
+                }
+            }
+        }
+    }
+    return !missing;
+}
+
+// The rows of the right operand of a distributed product which are needed
+// for the local rows of the left operand, in the order of the unique columns
+// of the left operand's multiplication metadata
+template<typename T>
+struct FetchedRows
+{
+    vector<Int> offsets;
+    vector<Int> cols;
+    vector<T> values;
+    // The offsets of the targets of the local entries of A within the
+    // fetched rows (only formed when the multiplication metadata of A stores
+    // them compactly)
+    vector<Int> aRows;
+};
+
+template<typename T>
+void FetchRows
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        FetchedRows<T>& fetched,
+  bool fetchValues )
+{
+    EL_DEBUG_CSE
+    if( A.Width() != B.Height() )
+        LogicError("The width of A must match the height of B");
+    if( !mpi::Congruent( A.Grid().Comm(), B.Grid().Comm() ) )
+        LogicError("A and B must have congruent grids");
+    mpi::Comm comm = A.Grid().Comm();
+    const int commSize = mpi::Size( comm );
+
+    // Since the number of targets of A equals the number of sources of B, the
+    // owner of each requested row of B is the process it is requested from
+    A.InitializeMultMeta();
+    const auto& meta = A.LockedDistGraph().multMeta;
+    const Int numSendInds = meta.sendInds.size();
+    const Int firstLocalRow = B.FirstLocalRow();
+    if( meta.compactColOffs.empty() )
+        SwapClear( fetched.aRows );
+    else
+        fetched.aRows.assign
+        ( meta.compactColOffs.begin(), meta.compactColOffs.end() );
+
+    // Exchange the lengths of the requested rows
+    vector<Int> sendLengths( numSendInds ), recvLengths( meta.numRecvInds );
+    for( Int s=0; s<numSendInds; ++s )
+        sendLengths[s] = B.NumConnections( meta.sendInds[s]-firstLocalRow );
+    meta.NeighborExchange
+    ( sendLengths.data(), recvLengths.data(), 1, false, comm );
+
+    // Convert the row counts into entry counts
+    vector<int> sendCounts( commSize, 0 ), recvCounts( commSize, 0 );
+    for( int q=0; q<commSize; ++q )
+    {
+        for( Int s=meta.sendOffs[q]; s<meta.sendOffs[q]+meta.sendSizes[q]; ++s )
+            sendCounts[q] += sendLengths[s];
+        for( Int u=meta.recvOffs[q]; u<meta.recvOffs[q]+meta.recvSizes[q]; ++u )
+            recvCounts[q] += recvLengths[u];
+    }
+    vector<int> sendOffs, recvOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    const int totalRecv = Scan( recvCounts, recvOffs );
+    fetched.offsets.resize( meta.numRecvInds+1 );
+    Int offset = 0;
+    for( Int u=0; u<meta.numRecvInds; ++u )
+    {
+        fetched.offsets[u] = offset;
+        offset += recvLengths[u];
+    }
+    fetched.offsets[meta.numRecvInds] = offset;
+
+    // Pack and exchange the requested rows (in the order of 'sendInds', which
+    // is consistent with 'sendOffs')
+    vector<Int> sendCols;
+    vector<T> sendValues;
+    FastResize( sendCols, totalSend );
+    if( fetchValues )
+        FastResize( sendValues, totalSend );
+    const Int* bCols = B.LockedTargetBuffer();
+    const T* bValues = B.LockedValueBuffer();
+    Int sendOffset = 0;
+    for( Int s=0; s<numSendInds; ++s )
+    {
+        const Int rowOffset = B.RowOffset( meta.sendInds[s]-firstLocalRow );
+        for( Int f=0; f<sendLengths[s]; ++f )
+        {
+            sendCols[sendOffset+f] = bCols[rowOffset+f];
+            if( fetchValues )
+                sendValues[sendOffset+f] = bValues[rowOffset+f];
+        }
+        sendOffset += sendLengths[s];
+    }
+    FastResize( fetched.cols, totalRecv );
+    mpi::AllToAll
+    ( sendCols.data(), sendCounts.data(), sendOffs.data(),
+      fetched.cols.data(), recvCounts.data(), recvOffs.data(), comm );
+    if( fetchValues )
+    {
+        FastResize( fetched.values, totalRecv );
+        mpi::AllToAll
+        ( sendValues.data(), sendCounts.data(), sendOffs.data(),
+          fetched.values.data(), recvCounts.data(), recvOffs.data(), comm );
+    }
+    else
+        SwapClear( fetched.values );
+}
+
+template<typename T>
+ProductOperands<T> LocalOperands
+( const SparseMatrix<T>& A, const SparseMatrix<T>& B )
+{
+    ProductOperands<T> ops;
+    ops.numRows = A.Height();
+    ops.numCols = B.Width();
+    ops.aOffsets = A.LockedOffsetBuffer();
+    ops.aRows = A.LockedTargetBuffer();
+    ops.aValues = A.LockedValueBuffer();
+    ops.bOffsets = B.LockedOffsetBuffer();
+    ops.bCols = B.LockedTargetBuffer();
+    ops.bValues = B.LockedValueBuffer();
+    return ops;
+}
+
+template<typename T>
+ProductOperands<T> LocalOperands
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+  const FetchedRows<T>& fetched )
+{
+    const auto& meta = A.LockedDistGraph().multMeta;
+    ProductOperands<T> ops;
+    ops.numRows = A.LocalHeight();
+    ops.numCols = B.Width();
+    ops.aOffsets = A.LockedOffsetBuffer();
+    ops.aRows =
+      ( meta.compactColOffs.empty() ? meta.colOffs.data() :
+                                      fetched.aRows.data() );
+    ops.aValues = A.LockedValueBuffer();
+    ops.bOffsets = fetched.offsets.data();
+    ops.bCols = fetched.cols.data();
+    ops.bValues = fetched.values.data();
+    return ops;
+}
+
+template<typename T>
+void DistSymbolic
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+  const FetchedRows<T>& fetched,
+        DistSparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    vector<Int> cOffsets, cCols;
+    ProductPattern( LocalOperands( A, B, fetched ), cOffsets, cCols );
+
+    C.SetGrid( A.Grid() );
+    C.Resize( A.Height(), B.Width() );
+    const Int localHeight = C.LocalHeight();
+    const Int numLocalEntries = cCols.size();
+    C.ForceNumLocalEntries( numLocalEntries );
+    Int* sourceBuf = C.SourceBuffer();
+    Int* targetBuf = C.TargetBuffer();
+    Int* offsetBuf = C.OffsetBuffer();
+    T* valueBuf = C.ValueBuffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = C.GlobalRow( iLoc );
+        offsetBuf[iLoc] = cOffsets[iLoc];
+        for( Int e=cOffsets[iLoc]; e<cOffsets[iLoc+1]; ++e )
+            sourceBuf[e] = i;
+    }
+    offsetBuf[localHeight] = numLocalEntries;
+    std::copy( cCols.begin(), cCols.end(), targetBuf );
+    std::fill( valueBuf, valueBuf+numLocalEntries, T(0) );
+    C.ForceConsistency();
+    C.FreezeSparsity();
+}
+
+template<typename T>
+void DistNumeric
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+  const FetchedRows<T>& fetched,
+        DistSparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    if( C.Height() != A.Height() || C.Width() != B.Width() )
+        LogicError
+        ("C was ",C.Height()," x ",C.Width()," rather than ",
+         A.Height()," x ",B.Width());
+    if( !mpi::Congruent( A.Grid().Comm(), C.Grid().Comm() ) )
+        LogicError("A and C must have congruent grids");
+    const bool complete =
+      ProductValues
+      ( LocalOperands( A, B, fetched ),
+        C.LockedOffsetBuffer(), C.LockedTargetBuffer(), C.ValueBuffer() );
+    if( !complete )
+        RuntimeError("The sparsity pattern of C did not contain A B");
+}
+
+} // anonymous namespace
+
+template<typename T>
+void MultiplySymbolic
+( const SparseMatrix<T>& A,
+  const SparseMatrix<T>& B,
+        SparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    if( A.Width() != B.Height() )
+        LogicError("The width of A must match the height of B");
+    vector<Int> cOffsets, cCols;
+    ProductPattern( LocalOperands( A, B ), cOffsets, cCols );
+
+    const Int m = A.Height();
+    const Int numEntries = cCols.size();
+    C.Resize( m, B.Width() );
+    C.ForceNumEntries( numEntries );
+    Int* sourceBuf = C.SourceBuffer();
+    Int* targetBuf = C.TargetBuffer();
+    Int* offsetBuf = C.OffsetBuffer();
+    T* valueBuf = C.ValueBuffer();
+    for( Int i=0; i<m; ++i )
+    {
+        offsetBuf[i] = cOffsets[i];
+        for( Int e=cOffsets[i]; e<cOffsets[i+1]; ++e )
+            sourceBuf[e] = i;
+    }
+    offsetBuf[m] = numEntries;
+    std::copy( cCols.begin(), cCols.end(), targetBuf );
+    std::fill( valueBuf, valueBuf+numEntries, T(0) );
+    C.ForceConsistency();
+    C.FreezeSparsity();
+}
+
+template<typename T>
+void MultiplyNumeric
+( const SparseMatrix<T>& A,
+  const SparseMatrix<T>& B,
+        SparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    if( A.Width() != B.Height() )
+        LogicError("The width of A must match the height of B");
+    if( C.Height() != A.Height() || C.Width() != B.Width() )
+        LogicError
+        ("C was ",C.Height()," x ",C.Width()," rather than ",
+         A.Height()," x ",B.Width());
+    const bool complete =
+      ProductValues
+      ( LocalOperands( A, B ),
+        C.LockedOffsetBuffer(), C.LockedTargetBuffer(), C.ValueBuffer() );
+    if( !complete )
+        RuntimeError("The sparsity pattern of C did not contain A B");
+}
+
+template<typename T>
+void Multiply
+( const SparseMatrix<T>& A,
+  const SparseMatrix<T>& B,
+        SparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    MultiplySymbolic( A, B, C );
+    MultiplyNumeric( A, B, C );
+}
+
+template<typename T>
+void MultiplySymbolic
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    FetchedRows<T> fetched;
+    FetchRows( A, B, fetched, false );
+    DistSymbolic( A, B, fetched, C );
+}
+
+template<typename T>
+void MultiplyNumeric
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    FetchedRows<T> fetched;
+    FetchRows( A, B, fetched, true );
+    DistNumeric( A, B, fetched, C );
+}
+
+template<typename T>
+void Multiply
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C )
+{
+    EL_DEBUG_CSE
+    // Only exchange the required rows of B once
+    FetchedRows<T> fetched;
+    FetchRows( A, B, fetched, true );
+    DistSymbolic( A, B, fetched, C );
+    DistNumeric( A, B, fetched, C );
+}
+
+#define PROTO(T) \
+  template void MultiplySymbolic \
+  ( const SparseMatrix<T>& A, \
+    const SparseMatrix<T>& B, \
+          SparseMatrix<T>& C ); \
+  template void MultiplyNumeric \
+  ( const SparseMatrix<T>& A, \
+    const SparseMatrix<T>& B, \
+          SparseMatrix<T>& C ); \
+  template void Multiply \
+  ( const SparseMatrix<T>& A, \
+    const SparseMatrix<T>& B, \
+          SparseMatrix<T>& C ); \
+  template void MultiplySymbolic \
+  ( const DistSparseMatrix<T>& A, \
+    const DistSparseMatrix<T>& B, \
+          DistSparseMatrix<T>& C ); \
+  template void MultiplyNumeric \
+  ( const DistSparseMatrix<T>& A, \
+    const DistSparseMatrix<T>& B, \
+          DistSparseMatrix<T>& C ); \
+  template void Multiply \
+  ( const DistSparseMatrix<T>& A, \
+    const DistSparseMatrix<T>& B, \
+          DistSparseMatrix<T>& C );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
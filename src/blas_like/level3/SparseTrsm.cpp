@@ -0,0 +1,120 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+template<typename F>
+void Trsm
+( UpperOrLower uplo, UnitOrNonUnit diag,
+  F alpha, const SparseMatrix<F>& A, Matrix<F>& B,
+  bool checkIfSingular )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Triangular matrices must be square");
+    if( A.Height() != B.Height() )
+        LogicError("A and B must have the same height");
+    const Int n = A.Height();
+    const Int numRHS = B.Width();
+    if( alpha != F(1) )
+        B *= alpha;
+    if( n == 0 || numRHS == 0 )
+        return;
+
+    const auto& schedule = A.LockedLevelSchedule( uplo );
+    const Int* offsets = A.LockedOffsetBuffer();
+    const Int* cols = A.LockedTargetBuffer();
+    const F* values = A.LockedValueBuffer();
+    const Int* diagOffsets = schedule.diagOffsets.data();
+    if( diag == NON_UNIT )
+    {
+        for( Int i=0; i<n; ++i )
+        {
+            if( diagOffsets[i] < 0 )
+                LogicError("Row ",i," was missing its diagonal entry");
+            if( checkIfSingular && values[diagOffsets[i]] == F(0) )
+                throw SingularMatrixException();
+        }
+    }
+
+    F* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    auto solveRow = [&]( Int i )
+    {
+        for( Int e=offsets[i]; e<offsets[i+1]; ++e )
+        {
+            const Int j = cols[e];
+            if( (uplo == LOWER && j < i) || (uplo == UPPER && j > i) )
+            {
+                const F eta = values[e];
+                for( Int t=0; t<numRHS; ++t )
+                    BBuf[i+t*BLDim] -= eta*BBuf[j+t*BLDim];
+            }
+        }
+        if( diag == NON_UNIT )
+        {
+            const F delta = values[diagOffsets[i]];
+            for( Int t=0; t<numRHS; ++t )
+                BBuf[i+t*BLDim] /= delta;
+        }
+    };
+
+    // The rows of each level may be solved independently, but the threads
+    // must synchronize between levels, so only thread solves whose average
+    // level is reasonably wide
+    const Int numLevels = schedule.NumLevels();
+    const Int* levelOffsets = schedule.levelOffsets.data();
+    const Int* rows = schedule.rows.data();
+    int numThreads = 1;
+#ifdef EL_HYBRID
+    const double work = double(offsets[n])*numRHS;
+    if( work >= blas::FallbackThreshold() && !omp_in_parallel() )
+    {
+        numThreads = blas::FallbackThreads();
+        if( n < 4*Int(numThreads)*numLevels )
+            numThreads = 1;
+    }
+#endif
+    if( numThreads == 1 )
+    {
+        for( Int step=0; step<n; ++step )
+            solveRow( uplo == LOWER ? step : n-1-step );
+        return;
+    }
+#ifdef EL_HYBRID
+    _Pragma("omp parallel num_threads(numThreads)")
+    for( Int level=0; level<numLevels; ++level )
+    {
+        _Pragma("omp for schedule(dynamic,16)")
+        for( Int s=levelOffsets[level]; s<levelOffsets[level+1]; ++s )
+            solveRow( rows[s] );
+    }
+#else
+    EL_UNUSED(numLevels);
+    EL_UNUSED(levelOffsets);
+    EL_UNUSED(rows);
+#endif
+}
+
+#define PROTO(F) \
+  template void Trsm \
+  ( UpperOrLower uplo, UnitOrNonUnit diag, \
+    F alpha, const SparseMatrix<F>& A, Matrix<F>& B, \
+    bool checkIfSingular );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
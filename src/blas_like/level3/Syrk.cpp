@@ -10,10 +10,12 @@
 #include <El/blas_like/level1.hpp>
 #include <El/blas_like/level3.hpp>
 
+#include "./Syrk/Local.hpp"
 #include "./Syrk/LN.hpp"
 #include "./Syrk/LT.hpp"
 #include "./Syrk/UN.hpp"
 #include "./Syrk/UT.hpp"
+#include "./Syrk/Packed.hpp"
 
 namespace El {
 
@@ -35,23 +37,13 @@ void Syrk
               LogicError("Nonconformal Syrk");
       }
     )
-    const char uploChar = UpperOrLowerToChar( uplo );
-    const char transChar = OrientationToChar( orientation );
-    const Int k = ( orientation == NORMAL ? A.Width() : A.Height() );
-    if( conjugate )
-    {
-        blas::Herk
-        ( uploChar, transChar, C.Height(), k,
-          RealPart(alpha), A.LockedBuffer(), A.LDim(),
-          RealPart(beta),  C.Buffer(),       C.LDim() );
-    }
+    // Hand large updates to the recursive algorithm, which spends nearly all
+    // of its time in large Gemm's
+    if( C.Height() < 2*LocalTrrkBlocksize<T>() )
+        syrk::LocalKernel( uplo, orientation, alpha, A, beta, C, conjugate );
     else
-    {
-        blas::Syrk
-        ( uploChar, transChar, C.Height(), k,
-          alpha, A.LockedBuffer(), A.LDim(),
-          beta,  C.Buffer(),       C.LDim() );
-    }
+        syrk::LocalRecursive
+        ( uplo, orientation, alpha, A, beta, C, conjugate );
 }
 
 template<typename T>
@@ -97,6 +89,24 @@ void Syrk
     Syrk( uplo, orientation, alpha, A, T(0), C, conjugate );
 }
 
+template<typename T>
+void Syrk
+( Orientation orientation,
+  T alpha, const AbstractDistMatrix<T>& A,
+  T beta,        DistPackedMatrix<T>& C, bool conjugate )
+{
+    EL_DEBUG_CSE
+    const Int n = ( orientation==NORMAL ? A.Height() : A.Width() );
+    if( C.Height() != n )
+        LogicError("Nonconformal Syrk");
+    for( Int b=0; b<C.NumBlocks(); ++b )
+    {
+        auto CBlock = C.BlockColumn(b);
+        CBlock *= beta;
+    }
+    syrk::Packed( orientation, alpha, A, C, conjugate );
+}
+
 template<typename T>
 void Syrk
 ( UpperOrLower uplo, Orientation orientation,
@@ -298,7 +308,11 @@ void Syrk
   template void Syrk \
   ( UpperOrLower uplo, Orientation orientation, \
     T alpha, const DistSparseMatrix<T>& A, \
-                   DistSparseMatrix<T>& C, bool conjugate );
+                   DistSparseMatrix<T>& C, bool conjugate ); \
+  template void Syrk \
+  ( Orientation orientation, \
+    T alpha, const AbstractDistMatrix<T>& A, \
+    T beta,        DistPackedMatrix<T>& C, bool conjugate );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -0,0 +1,119 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SYRK_LOCAL_HPP
+#define EL_SYRK_LOCAL_HPP
+
+namespace El {
+namespace syrk {
+
+// C := alpha op(A)^{T/H} op(A) + beta C via a direct call to {Sy,He}rk
+template<typename T>
+void LocalKernel
+( UpperOrLower uplo, Orientation orientation,
+  T alpha, const Matrix<T>& A, T beta, Matrix<T>& C, bool conjugate )
+{
+    EL_DEBUG_CSE
+    const char uploChar = UpperOrLowerToChar( uplo );
+    const char transChar = OrientationToChar( orientation );
+    const Int k = ( orientation == NORMAL ? A.Width() : A.Height() );
+    if( conjugate )
+    {
+        blas::Herk
+        ( uploChar, transChar, C.Height(), k,
+          RealPart(alpha), A.LockedBuffer(), A.LDim(),
+          RealPart(beta),  C.Buffer(),       C.LDim() );
+    }
+    else
+    {
+        blas::Syrk
+        ( uploChar, transChar, C.Height(), k,
+          alpha, A.LockedBuffer(), A.LDim(),
+          beta,  C.Buffer(),       C.LDim() );
+    }
+}
+
+// C := alpha op(A)^{T/H} op(A) + beta C by recursively splitting C into
+// quadrants, updating the off-diagonal quadrant with a single (large) Gemm,
+// and recursing on the two diagonal quadrants. All but O(n nb k) of the flops
+// are therefore spent within Gemm's whose sizes adapt to the problem rather
+// than to a fixed blocksize, and the working set of each recursive call
+// shrinks geometrically, which is far friendlier to the cache than the
+// reference three-loop kernel (or even an optimized {Sy,He}rk, whose
+// off-diagonal blocks are typically of a fixed size).
+template<typename T>
+void LocalRecursive
+( UpperOrLower uplo, Orientation orientation,
+  T alpha, const Matrix<T>& A, T beta, Matrix<T>& C, bool conjugate )
+{
+    EL_DEBUG_CSE
+    const Int n = C.Height();
+    if( n < 2*LocalTrrkBlocksize<T>() )
+    {
+        LocalKernel( uplo, orientation, alpha, A, beta, C, conjugate );
+        return;
+    }
+    const Orientation adjOrTrans = ( conjugate ? ADJOINT : TRANSPOSE );
+    // As in Herk, only the real parts of alpha and beta are used
+    if( conjugate )
+    {
+        alpha = RealPart(alpha);
+        beta = RealPart(beta);
+    }
+
+    const Int half = n/2;
+    const auto indTL = IR(0,half);
+    const auto indBR = IR(half,n);
+    auto CTL = C(indTL,indTL);
+    auto CBR = C(indBR,indBR);
+    if( orientation == NORMAL )
+    {
+        // C := alpha A A^{T/H} + beta C
+        auto AT = A(indTL,ALL);
+        auto AB = A(indBR,ALL);
+        if( uplo == LOWER )
+        {
+            auto CBL = C(indBR,indTL);
+            Gemm( NORMAL, adjOrTrans, alpha, AB, AT, beta, CBL );
+        }
+        else
+        {
+            auto CTR = C(indTL,indBR);
+            Gemm( NORMAL, adjOrTrans, alpha, AT, AB, beta, CTR );
+        }
+        LocalRecursive
+        ( uplo, orientation, alpha, AT, beta, CTL, conjugate );
+        LocalRecursive
+        ( uplo, orientation, alpha, AB, beta, CBR, conjugate );
+    }
+    else
+    {
+        // C := alpha A^{T/H} A + beta C
+        auto AL = A(ALL,indTL);
+        auto AR = A(ALL,indBR);
+        if( uplo == LOWER )
+        {
+            auto CBL = C(indBR,indTL);
+            Gemm( adjOrTrans, NORMAL, alpha, AR, AL, beta, CBL );
+        }
+        else
+        {
+            auto CTR = C(indTL,indBR);
+            Gemm( adjOrTrans, NORMAL, alpha, AL, AR, beta, CTR );
+        }
+        LocalRecursive
+        ( uplo, orientation, alpha, AL, beta, CTL, conjugate );
+        LocalRecursive
+        ( uplo, orientation, alpha, AR, beta, CBR, conjugate );
+    }
+}
+
+} // namespace syrk
+} // namespace El
+
+#endif // ifndef EL_SYRK_LOCAL_HPP
@@ -0,0 +1,78 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace syrk {
+
+// For each panel X of op(A) = [X_0, X_1, ...], the block columns of the
+// packed C are each updated with a single local Gemm against the [MC,* ]
+// rows of X beneath the block's offset and the [* ,MR] columns of X^T
+// (or X^H) within the block
+template<typename T>
+void Packed
+( Orientation orientation,
+  T alpha, const AbstractDistMatrix<T>& APre,
+                 DistPackedMatrix<T>& C,
+  bool conjugate=false )
+{
+    EL_DEBUG_CSE
+    const Int n = C.Height();
+    const Int r = ( orientation==NORMAL ? APre.Width() : APre.Height() );
+    const Int bsize = Blocksize();
+    const Grid& g = C.Grid();
+    if( APre.Grid() != g )
+        LogicError("A and C must be distributed over the same grid");
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+
+    // Temporary distributions
+    DistMatrix<T,MC,  STAR> X1_MC_STAR(g);
+    DistMatrix<T,VR,  STAR> X1_VR_STAR(g);
+    DistMatrix<T,STAR,MC  > A1_STAR_MC(g);
+    DistMatrix<T,STAR,MR  > X1Trans_STAR_MR(g);
+
+    // The packed block columns have zero global alignments
+    X1_MC_STAR.AlignCols( 0 );
+    A1_STAR_MC.AlignRows( 0 );
+    X1Trans_STAR_MR.AlignRows( 0 );
+
+    for( Int k=0; k<r; k+=bsize )
+    {
+        const Int nb = Min(bsize,r-k);
+        if( orientation == NORMAL )
+        {
+            auto A1 = A( ALL, IR(k,k+nb) );
+            X1_VR_STAR = X1_MC_STAR = A1;
+            Transpose( X1_VR_STAR, X1Trans_STAR_MR, conjugate );
+        }
+        else
+        {
+            // X1 = A1^T (or A1^H), and so X1^T (or X1^H) = A1
+            auto A1 = A( IR(k,k+nb), ALL );
+            A1_STAR_MC = A1;
+            Transpose( A1_STAR_MC, X1_MC_STAR, conjugate );
+            X1Trans_STAR_MR = A1;
+        }
+
+        for( Int b=0; b<C.NumBlocks(); ++b )
+        {
+            const Int offset = C.BlockOffset(b);
+            auto CBlock = C.BlockColumn(b);
+            LocalGemm
+            ( NORMAL, NORMAL,
+              alpha, X1_MC_STAR( IR(offset,n), ALL ),
+                     X1Trans_STAR_MR( ALL, IR(offset,offset+C.BlockWidth(b)) ),
+              T(1), CBlock );
+        }
+    }
+}
+
+} // namespace syrk
+} // namespace El
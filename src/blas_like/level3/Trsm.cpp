@@ -9,6 +9,8 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level2.hpp>
 #include <El/blas_like/level3.hpp>
+#include <El/lapack_like/factor.hpp>
+#include <El/lapack_like/funcs.hpp>
 
 #include "./Trsm/LLN.hpp"
 #include "./Trsm/LLT.hpp"
@@ -18,6 +20,8 @@
 #include "./Trsm/RLT.hpp"
 #include "./Trsm/RUN.hpp"
 #include "./Trsm/RUT.hpp"
+#include "./Trsm/Inverse.hpp"
+#include "./Trsm/Block.hpp"
 
 namespace El {
 
@@ -93,6 +97,12 @@ void Trsm
     )
     B *= alpha;
 
+    if( A.Wrap() == BLOCK && B.Wrap() == BLOCK )
+    {
+        trsm::Block( side, uplo, orientation, diag, A, B, checkIfSingular );
+        return;
+    }
+
     // Call the single right-hand side algorithm if appropriate
     if( side == LEFT && B.Width() == 1 )
     {
@@ -109,6 +119,12 @@ void Trsm
     }
     */
 
+    if( alg == TRSM_INVERSE )
+    {
+        trsm::Inverse( side, uplo, orientation, diag, A, B, checkIfSingular );
+        return;
+    }
+
     const Int p = B.Grid().Size();
     if( side == LEFT && uplo == LOWER )
     {
@@ -397,6 +413,38 @@ void LocalTrsm
       alpha, A.LockedMatrix(), X.Matrix(), checkIfSingular );
 }
 
+template<typename F>
+void Trsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  UnitOrNonUnit diag,
+  F alpha,
+  const OrientedView<Matrix<F>>& A,
+        Matrix<F>& B,
+  bool checkIfSingular )
+{
+    EL_DEBUG_CSE
+    Trsm
+    ( side, uplo, A.orientation, diag,
+      alpha, A.matrix, B, checkIfSingular );
+}
+
+template<typename F>
+void Trsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  UnitOrNonUnit diag,
+  F alpha,
+  const OrientedView<ElementalMatrix<F>>& A,
+        ElementalMatrix<F>& B,
+  bool checkIfSingular, TrsmAlgorithm alg )
+{
+    EL_DEBUG_CSE
+    Trsm
+    ( side, uplo, A.orientation, diag,
+      alpha, A.matrix, B, checkIfSingular, alg );
+}
+
 #define PROTO(F) \
   template void Trsm \
   ( LeftOrRight side, \
@@ -417,6 +465,23 @@ void LocalTrsm
           AbstractDistMatrix<F>& B, \
     bool checkIfSingular, \
     TrsmAlgorithm alg ); \
+  template void Trsm \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    UnitOrNonUnit diag, \
+    F alpha, \
+    const OrientedView<Matrix<F>>& A, \
+          Matrix<F>& B, \
+    bool checkIfSingular ); \
+  template void Trsm \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    UnitOrNonUnit diag, \
+    F alpha, \
+    const OrientedView<ElementalMatrix<F>>& A, \
+          ElementalMatrix<F>& B, \
+    bool checkIfSingular, \
+    TrsmAlgorithm alg ); \
   template void LocalTrsm \
   ( LeftOrRight side, \
     UpperOrLower uplo, \
@@ -0,0 +1,135 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace trsm {
+
+// Trsm over block-cyclic matrices which never forms element-wise copies of
+// the triangle or the right-hand sides. The diagonal blocks follow the
+// distribution blocks of the triangle; each is replicated with an AllGather,
+// the corresponding panel of X is solved as a block-cyclic [* ,MR] (or
+// [MC,* ]) matrix, and the remainder of X, which is either ahead of or
+// behind the panel depending upon the side and the effective triangle, is
+// updated with a local Gemm.
+template<typename F>
+void Block
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  const AbstractDistMatrix<F>& APre,
+        AbstractDistMatrix<F>& XPre,
+  bool checkIfSingular )
+{
+    EL_DEBUG_CSE
+    EL_REGION("trsm::Block");
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadProxy<F,F,MC,MR,BLOCK> AProx( APre );
+    DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK> XProx( XPre );
+    auto& A = AProx.GetLocked();
+    auto& X = XProx.Get();
+
+    const bool normal = ( orientation == NORMAL );
+    const bool effectivelyLower = ( (uplo == LOWER) == normal );
+    const bool forward = ( (side == LEFT) == effectivelyLower );
+
+    // The boundaries of the diagonal blocks
+    const Int n = A.Height();
+    vector<Int> offsets(1,0);
+    for( Int k=0; k<n; )
+    {
+        k += Min( k==0 ? A.BlockHeight()-A.ColCut() : A.BlockHeight(), n-k );
+        offsets.push_back( k );
+    }
+    const Int numBlocks = offsets.size()-1;
+
+    DistMatrix<F,STAR,STAR,BLOCK> A11_STAR_STAR(g);
+    DistMatrix<F,STAR,MR,  BLOCK> X1_STAR_MR(g);
+    DistMatrix<F,MC,  STAR,BLOCK> X1_MC_STAR(g);
+    DistMatrix<F,MC,  STAR,BLOCK> A1_MC_STAR(g);
+    DistMatrix<F,STAR,MC,  BLOCK> A1_STAR_MC(g);
+    DistMatrix<F,STAR,MR,  BLOCK> A1_STAR_MR(g);
+    DistMatrix<F,MR,  STAR,BLOCK> A1_MR_STAR(g);
+
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const Int i = ( forward ? b : numBlocks-1-b );
+        const Range<Int> ind1( offsets[i], offsets[i+1] );
+        const Range<Int> indRest =
+          ( forward ? Range<Int>(offsets[i+1],n) : Range<Int>(0,offsets[i]) );
+
+        A11_STAR_STAR = A( ind1, ind1 );
+        if( side == LEFT )
+        {
+            auto X1 = X( ind1, ALL );
+            auto XRest = X( indRest, ALL );
+
+            // X1[* ,MR] := op(A11)^-1[* ,* ] X1[* ,MR]
+            X1_STAR_MR.AlignRowsWith( X1 );
+            X1_STAR_MR = X1;
+            Trsm
+            ( LEFT, uplo, orientation, diag, F(1),
+              A11_STAR_STAR.LockedMatrix(), X1_STAR_MR.Matrix(),
+              checkIfSingular );
+            X1 = X1_STAR_MR;
+
+            // XRest[MC,MR] -= op(A)(indRest,ind1) X1[* ,MR]
+            if( normal )
+            {
+                A1_MC_STAR.AlignColsWith( XRest );
+                A1_MC_STAR = A( indRest, ind1 );
+                LocalGemm
+                ( NORMAL, NORMAL,
+                  F(-1), A1_MC_STAR, X1_STAR_MR, F(1), XRest );
+            }
+            else
+            {
+                A1_STAR_MC.AlignRowsWith( XRest );
+                A1_STAR_MC = A( ind1, indRest );
+                LocalGemm
+                ( orientation, NORMAL,
+                  F(-1), A1_STAR_MC, X1_STAR_MR, F(1), XRest );
+            }
+        }
+        else
+        {
+            auto X1 = X( ALL, ind1 );
+            auto XRest = X( ALL, indRest );
+
+            // X1[MC,* ] := X1[MC,* ] op(A11)^-1[* ,* ]
+            X1_MC_STAR.AlignColsWith( X1 );
+            X1_MC_STAR = X1;
+            Trsm
+            ( RIGHT, uplo, orientation, diag, F(1),
+              A11_STAR_STAR.LockedMatrix(), X1_MC_STAR.Matrix(),
+              checkIfSingular );
+            X1 = X1_MC_STAR;
+
+            // XRest[MC,MR] -= X1[MC,* ] op(A)(ind1,indRest)
+            if( normal )
+            {
+                A1_STAR_MR.AlignRowsWith( XRest );
+                A1_STAR_MR = A( ind1, indRest );
+                LocalGemm
+                ( NORMAL, NORMAL,
+                  F(-1), X1_MC_STAR, A1_STAR_MR, F(1), XRest );
+            }
+            else
+            {
+                A1_MR_STAR.AlignColsWith( XRest );
+                A1_MR_STAR = A( indRest, ind1 );
+                LocalGemm
+                ( NORMAL, orientation,
+                  F(-1), X1_MC_STAR, A1_MR_STAR, F(1), XRest );
+            }
+        }
+    }
+}
+
+} // namespace trsm
+} // namespace El
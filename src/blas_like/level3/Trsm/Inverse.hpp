@@ -0,0 +1,124 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_TRSM_INVERSE_HPP
+#define EL_TRSM_INVERSE_HPP
+
+namespace El {
+namespace trsm {
+
+// Solve against a few large diagonal blocks by explicitly inverting each of
+// them, so that both the application of the inverse of each diagonal block
+// and the update of the remaining right-hand sides are distributed Gemm's
+// (which may be communication-avoiding, e.g., GEMM_25D). With q diagonal
+// blocks, the inversions and the extra flops of multiplying by their
+// inverses (rather than solving against them) amount to a fraction of
+// roughly 1/q of the usual cost, while the number of (much larger)
+// communication phases is reduced from n/nb to 2q. By default, q is chosen
+// to be the square-root of the number of processes.
+//
+// Since the diagonal blocks are explicitly inverted, this approach is less
+// numerically stable than the standard algorithms when the diagonal blocks
+// are ill-conditioned.
+
+// Return the view of A which, once op is applied to it, is op(A)(I,J)
+template<typename F>
+const DistMatrix<F> OpBlock
+( Orientation orientation, const DistMatrix<F>& A, Range<Int> I, Range<Int> J )
+{
+    if( orientation == NORMAL )
+        return A( I, J );
+    else
+        return A( J, I );
+}
+
+template<typename F>
+void Inverse
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  const AbstractDistMatrix<F>& APre,
+        AbstractDistMatrix<F>& BPre,
+  bool checkIfSingular,
+  Int numBlocks=0 )
+{
+    EL_DEBUG_CSE
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+
+    const Int n = A.Height();
+    if( numBlocks <= 0 )
+        numBlocks = Max( Int(Sqrt(double(g.Size()))), Int(1) );
+    const Int bsize =
+      Max( (n+numBlocks-1)/numBlocks, TunedBlocksize<F>("Trsm",g) );
+
+    // Whether op(A) is lower-triangular
+    const bool opLower = ( (uplo==LOWER) == (orientation==NORMAL) );
+    // Whether the blocks are visited from first to last
+    const bool forward = ( opLower == (side==LEFT) );
+
+    DistMatrix<F> A11Inv(g), X1(g);
+    DistMatrix<F,STAR,STAR> d1_STAR_STAR(g);
+
+    const Int numSteps = (n+bsize-1) / bsize;
+    for( Int step=0; step<numSteps; ++step )
+    {
+        const Int blockIndex = ( forward ? step : numSteps-1-step );
+        const Int k = blockIndex*bsize;
+        const Int nb = Min(bsize,n-k);
+        const Range<Int> ind1( k, k+nb ),
+                         indPrev( 0, k ), indNext( k+nb, n );
+        // The indices of the unknowns which have yet to be solved for
+        const Range<Int> indRest = ( forward ? indNext : indPrev );
+
+        auto A11 = A( ind1, ind1 );
+        if( checkIfSingular && diag == NON_UNIT )
+        {
+            d1_STAR_STAR = GetDiagonal( A11 );
+            for( Int i=0; i<nb; ++i )
+                if( d1_STAR_STAR.GetLocal(i,0) == F(0) )
+                    throw SingularMatrixException();
+        }
+        A11Inv = A11;
+        TriangularInverse( uplo, diag, A11Inv );
+        MakeTrapezoidal( uplo, A11Inv );
+        if( diag == UNIT )
+            FillDiagonal( A11Inv, F(1) );
+
+        if( side == LEFT )
+        {
+            // B1 := inv(op(A11)) B1 and B_rest -= op(A)(rest,1) B1
+            auto B1 = B( ind1, ALL );
+            auto BRest = B( indRest, ALL );
+            Gemm( orientation, NORMAL, F(1), A11Inv, B1, X1 );
+            B1 = X1;
+            auto ARest1 = OpBlock( orientation, A, indRest, ind1 );
+            Gemm( orientation, NORMAL, F(-1), ARest1, B1, F(1), BRest );
+        }
+        else
+        {
+            // B1 := B1 inv(op(A11)) and B_rest -= B1 op(A)(1,rest)
+            auto B1 = B( ALL, ind1 );
+            auto BRest = B( ALL, indRest );
+            Gemm( NORMAL, orientation, F(1), B1, A11Inv, X1 );
+            B1 = X1;
+            auto A1Rest = OpBlock( orientation, A, ind1, indRest );
+            Gemm( NORMAL, orientation, F(-1), B1, A1Rest, F(1), BRest );
+        }
+    }
+}
+
+} // namespace trsm
+} // namespace El
+
+#endif // ifndef EL_TRSM_INVERSE_HPP
@@ -31,7 +31,7 @@ void LLTLarge
           LogicError("Expected (Conjugate)Transpose option");
     )
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Trsm", LPre.Grid() );
     const Grid& g = LPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
@@ -94,7 +94,7 @@ void LLTMedium
           LogicError("Expected (Conjugate)Transpose option");
     )
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Trsm", LPre.Grid() );
     const Grid& g = LPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
@@ -164,7 +164,7 @@ void LLTSmall
           LogicError("L and X must be aligned");
     )
     const Int m = X.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Trsm", L.Grid() );
     const Grid& g = L.Grid();
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), Z1_STAR_STAR(g);
@@ -217,7 +217,7 @@ void LLTSmall
           LogicError("L and X must be aligned");
     )
     const Int m = X.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Trsm", L.Grid() );
     const Grid& g = L.Grid();
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
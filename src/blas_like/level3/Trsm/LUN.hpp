@@ -23,7 +23,7 @@ void LUNLarge
 {
     EL_DEBUG_CSE
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Trsm", UPre.Grid() );
     const Grid& g = UPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
@@ -78,7 +78,7 @@ void LUNMedium
 {
     EL_DEBUG_CSE
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Trsm", UPre.Grid() );
     const Grid& g = UPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
@@ -141,7 +141,7 @@ void LUNSmall
           LogicError("U and X are assumed to be aligned");
     )
     const Int m = X.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Trsm", U.Grid() );
     const Grid& g = U.Grid();
 
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g);
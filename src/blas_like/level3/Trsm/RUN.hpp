@@ -22,7 +22,7 @@ void RUN
 {
     EL_DEBUG_CSE
     const Int n = XPre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Trsm", UPre.Grid() );
     const Grid& g = UPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
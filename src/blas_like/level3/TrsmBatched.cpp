@@ -0,0 +1,65 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
+
+namespace El {
+
+template<typename F>
+void TrsmBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha, const vector<Matrix<F>>& A, vector<Matrix<F>>& B )
+{
+    EL_DEBUG_CSE
+    EL_REGION("TrsmBatched");
+    const Int batchSize = B.size();
+    if( Int(A.size()) != batchSize )
+        LogicError
+        ("Batches of sizes ",A.size()," and ",batchSize," were not conformal");
+    for( Int b=0; b<batchSize; ++b )
+    {
+        const Int n = ( side == LEFT ? B[b].Height() : B[b].Width() );
+        if( A[b].Height() != A[b].Width() || A[b].Height() != n )
+            LogicError("Member ",b," of the Trsm batch was nonconformal");
+    }
+    ParallelFor( batchSize, [&]( Int b )
+    { Trsm( side, uplo, orientation, diag, alpha, A[b], B[b] ); } );
+}
+
+template<typename F>
+void TrsmBatched
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag, Int batchSize,
+  F alpha, const Matrix<F>& A, Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    auto ABatch = LockedBatchView( batchSize, A );
+    auto BBatch = BatchView( batchSize, B );
+    TrsmBatched( side, uplo, orientation, diag, alpha, ABatch, BBatch );
+}
+
+#define PROTO(F) \
+  template void TrsmBatched \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    F alpha, const vector<Matrix<F>>& A, vector<Matrix<F>>& B ); \
+  template void TrsmBatched \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, Int batchSize, \
+    F alpha, const Matrix<F>& A, Matrix<F>& B );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
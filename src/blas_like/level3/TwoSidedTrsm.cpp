@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
 #include <El/blas_like/level3.hpp>
 
 #include "./TwoSidedTrsm/Unblocked.hpp"
@@ -32,13 +33,24 @@ template<typename F>
 void TwoSidedTrsm
 ( UpperOrLower uplo, UnitOrNonUnit diag, 
         AbstractDistMatrix<F>& A,
-  const AbstractDistMatrix<F>& B )
+  const AbstractDistMatrix<F>& B,
+        Int lookahead )
 {
     EL_DEBUG_CSE
-    if( uplo == LOWER )
-        twotrsm::LVar4( diag, A, B );
+    if( lookahead > 0 )
+    {
+        if( uplo == LOWER )
+            twotrsm::LVar4Pipelined( diag, A, B );
+        else
+            twotrsm::UVar4Pipelined( diag, A, B );
+    }
     else
-        twotrsm::UVar4( diag, A, B );
+    {
+        if( uplo == LOWER )
+            twotrsm::LVar4( diag, A, B );
+        else
+            twotrsm::UVar4( diag, A, B );
+    }
 }
 
 template<typename F>
@@ -101,7 +113,8 @@ void TwoSidedTrsm
   template void TwoSidedTrsm \
   ( UpperOrLower uplo, UnitOrNonUnit diag, \
           AbstractDistMatrix<F>& A, \
-    const AbstractDistMatrix<F>& B ); \
+    const AbstractDistMatrix<F>& B, \
+          Int lookahead ); \
   template void TwoSidedTrsm \
   ( UpperOrLower uplo, UnitOrNonUnit diag, \
           DistMatrix<F,STAR,STAR>& A, \
@@ -189,6 +189,173 @@ void LVar4
     }
 }
 
+// The same algorithm with a lookahead of one panel: the columns of the
+// trailing matrix belonging to the next panel are updated first so that the
+// redistributions of its diagonal block and of the row panel to its left can
+// proceed in the background of the rest of the trailing update.
+template<typename F> 
+void LVar4Pipelined
+( UnitOrNonUnit diag, 
+        AbstractDistMatrix<F>& APre,
+  const AbstractDistMatrix<F>& LPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+      if( LPre.Height() != LPre.Width() )
+          LogicError("Triangular matrices must be square");
+      if( APre.Height() != LPre.Height() )
+          LogicError("A and L must be the same size");
+    )
+    const Int n = APre.Height();
+    const Int bsize = Blocksize();
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
+    auto& A = AProx.Get();
+    auto& L = LProx.GetLocked();
+
+    // Temporary distributions
+    DistMatrix<F,STAR,MR  > A10_STAR_MR(g), 
+                            A21Adj_STAR_MR(g), L21Adj_STAR_MR(g);
+    DistMatrix<F,STAR,MC  > A21Trans_STAR_MC(g);
+    DistMatrix<F,STAR,VR  > A10_STAR_VR(g);
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g), L11_STAR_STAR(g);
+    DistMatrix<F,VC,  STAR> A21_VC_STAR(g), L21_VC_STAR(g), Y21_VC_STAR(g);
+    DistMatrix<F,VR,  STAR> A21_VR_STAR(g), L21_VR_STAR(g);
+    DistMatrix<F,MC,  STAR> L21_MC_STAR(g);
+    CopyRequest<F> A10Request, A11Request, L11Request;
+
+    // Begin gathering the (fully updated) panel starting at index k
+    auto startPanel =
+      [&]( Int k )
+      {
+          const Int nb = Min(bsize,n-k);
+          const Range<Int> ind0( 0,    k    ),
+                           ind1( k,    k+nb ),
+                           ind2( k+nb, n    );
+          A10_STAR_VR.AlignWith( A( ind2, ind0 ) );
+          CopyAsync( A( ind1, ind0 ), A10_STAR_VR, A10Request );
+          CopyAsync( A( ind1, ind1 ), A11_STAR_STAR, A11Request );
+          CopyAsync( L( ind1, ind1 ), L11_STAR_STAR, L11Request );
+      };
+
+    if( n > 0 )
+        startPanel( 0 );
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int nbNext = Min(bsize,n-k-nb);
+
+        const Range<Int> ind0( 0,    k    ),
+                         ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto A10 = A( ind1, ind0 );
+        auto A11 = A( ind1, ind1 );
+        auto A20 = A( ind2, ind0 );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        auto L21 = L( ind2, ind1 );
+
+        // A10 := inv(L11) A10
+        L11Request.Wait();
+        A10Request.Wait();
+        LocalTrsm
+        ( LEFT, LOWER, NORMAL, diag, F(1), L11_STAR_STAR, A10_STAR_VR );
+
+        // A11 := inv(L11) A11 inv(L11)'
+        A11Request.Wait();
+        TwoSidedTrsm( LOWER, diag, A11_STAR_STAR, L11_STAR_STAR );
+        A11 = A11_STAR_STAR;
+
+        // A20 := A20 - L21 A10
+        L21_MC_STAR.AlignWith( A22 );
+        L21_MC_STAR = L21;
+        A10_STAR_MR.AlignWith( A20 );
+        A10_STAR_MR = A10_STAR_VR;
+        LocalGemm( NORMAL, NORMAL, F(-1), L21_MC_STAR, A10_STAR_MR, F(1), A20 );
+        A10 = A10_STAR_MR; // delayed write from  A10 := inv(L11) A10
+
+        // Y21 := L21 A11
+        L21_VC_STAR.AlignWith( A22 );
+        L21_VC_STAR = L21_MC_STAR;
+        Y21_VC_STAR.AlignWith( A22 );
+        Y21_VC_STAR.Resize( A21.Height(), nb );
+        Zero( Y21_VC_STAR );
+        Hemm
+        ( RIGHT, LOWER, 
+          F(1), A11_STAR_STAR.Matrix(), L21_VC_STAR.Matrix(), 
+          F(0), Y21_VC_STAR.Matrix() );
+
+        // A21 := A21 inv(L11)'
+        A21_VC_STAR.AlignWith( A22 );
+        A21_VC_STAR = A21;
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, diag, F(1), L11_STAR_STAR, A21_VC_STAR );
+
+        // A21 := A21 - 1/2 Y21
+        Axpy( F(-1)/F(2), Y21_VC_STAR, A21_VC_STAR );
+
+        // Form the redistributions needed by the trailing update
+        A21Trans_STAR_MC.AlignWith( A22 );
+        Transpose( A21_VC_STAR, A21Trans_STAR_MC );
+        A21_VR_STAR.AlignWith( A22 );
+        A21_VR_STAR = A21_VC_STAR;
+        L21_VR_STAR.AlignWith( A22 );
+        L21_VR_STAR = L21_VC_STAR;
+        A21Adj_STAR_MR.AlignWith( A22 );
+        L21Adj_STAR_MR.AlignWith( A22 );
+        Adjoint( A21_VR_STAR, A21Adj_STAR_MR );
+        Adjoint( L21_VR_STAR, L21Adj_STAR_MR );
+
+        // A21 := A21 - 1/2 Y21
+        // (the trailing update only depends upon the redistributions above)
+        Axpy( F(-1)/F(2), Y21_VC_STAR, A21_VC_STAR );
+        A21 = A21_VC_STAR;
+
+        // A22 := A22 - (L21 A21' + A21 L21')
+        if( nbNext > 0 )
+        {
+            // Update the columns of the next panel and start gathering it
+            const Range<Int> indL( 0, nbNext ), indR( nbNext, END );
+            auto A22TL = A22( indL, indL );
+            auto A22BL = A22( indR, indL );
+            auto A22BR = A22( indR, indR );
+            auto L21_MC_STAR_T = L21_MC_STAR( indL, ALL );
+            auto L21_MC_STAR_B = L21_MC_STAR( indR, ALL );
+            auto A21Trans_STAR_MC_L = A21Trans_STAR_MC( ALL, indL );
+            auto A21Trans_STAR_MC_R = A21Trans_STAR_MC( ALL, indR );
+            auto A21Adj_STAR_MR_L = A21Adj_STAR_MR( ALL, indL );
+            auto A21Adj_STAR_MR_R = A21Adj_STAR_MR( ALL, indR );
+            auto L21Adj_STAR_MR_L = L21Adj_STAR_MR( ALL, indL );
+            auto L21Adj_STAR_MR_R = L21Adj_STAR_MR( ALL, indR );
+
+            LocalTrr2k
+            ( LOWER, NORMAL, NORMAL, TRANSPOSE, NORMAL,
+              F(-1), L21_MC_STAR_T,      A21Adj_STAR_MR_L, 
+              F(-1), A21Trans_STAR_MC_L, L21Adj_STAR_MR_L,
+              F(1),  A22TL );
+            LocalGemm
+            ( NORMAL, NORMAL,
+              F(-1), L21_MC_STAR_B, A21Adj_STAR_MR_L, F(1), A22BL );
+            LocalGemm
+            ( TRANSPOSE, NORMAL,
+              F(-1), A21Trans_STAR_MC_R, L21Adj_STAR_MR_L, F(1), A22BL );
+            startPanel( k+nb );
+
+            LocalTrr2k
+            ( LOWER, NORMAL, NORMAL, TRANSPOSE, NORMAL,
+              F(-1), L21_MC_STAR_B,      A21Adj_STAR_MR_R, 
+              F(-1), A21Trans_STAR_MC_R, L21Adj_STAR_MR_R,
+              F(1),  A22BR );
+        }
+    }
+}
+
 } // namespace twotrsm
 } // namespace El
 
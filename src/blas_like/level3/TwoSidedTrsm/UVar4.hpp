@@ -195,6 +195,179 @@ void UVar4
     }
 }
 
+// The same algorithm with a lookahead of one panel: the rows of the trailing
+// matrix belonging to the next panel are updated first so that the
+// redistributions of its diagonal block and of the column panel above it can
+// proceed in the background of the rest of the trailing update.
+template<typename F> 
+void UVar4Pipelined
+( UnitOrNonUnit diag, 
+        AbstractDistMatrix<F>& APre,
+  const AbstractDistMatrix<F>& UPre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("A must be square");
+      if( UPre.Height() != UPre.Width() )
+          LogicError("Triangular matrices must be square");
+      if( APre.Height() != UPre.Height() )
+          LogicError("A and U must be the same size");
+    )
+    const Int n = APre.Height();
+    const Int bsize = Blocksize();
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
+    auto& A = AProx.Get();
+    auto& U = UProx.GetLocked();
+
+    // Temporary distributions
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g), U11_STAR_STAR(g);
+    DistMatrix<F,STAR,MC  > A01Trans_STAR_MC(g), A12_STAR_MC(g), U12_STAR_MC(g);
+    DistMatrix<F,STAR,MR  > A12_STAR_MR(g);
+    DistMatrix<F,STAR,VC  > A12_STAR_VC(g), U12_STAR_VC(g);
+    DistMatrix<F,STAR,VR  > A12_STAR_VR(g), U12_STAR_VR(g), Y12_STAR_VR(g);
+    DistMatrix<F,MR,  STAR> U12Trans_MR_STAR(g);
+    DistMatrix<F,VC,  STAR> A01_VC_STAR(g);
+    DistMatrix<F,VR,  STAR> U12Trans_VR_STAR(g);
+    CopyRequest<F> A01Request, A11Request, U11Request;
+
+    // Begin gathering the (fully updated) panel starting at index k
+    auto startPanel =
+      [&]( Int k )
+      {
+          const Int nb = Min(bsize,n-k);
+          const Range<Int> ind0( 0,    k    ),
+                           ind1( k,    k+nb ),
+                           ind2( k+nb, n    );
+          A01_VC_STAR.AlignWith( A( ind0, ind2 ) );
+          CopyAsync( A( ind0, ind1 ), A01_VC_STAR, A01Request );
+          CopyAsync( A( ind1, ind1 ), A11_STAR_STAR, A11Request );
+          CopyAsync( U( ind1, ind1 ), U11_STAR_STAR, U11Request );
+      };
+
+    if( n > 0 )
+        startPanel( 0 );
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int nbNext = Min(bsize,n-k-nb);
+
+        const Range<Int> ind0( 0,    k    ),
+                         ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto A01 = A( ind0, ind1 );
+        auto A02 = A( ind0, ind2 );
+        auto A11 = A( ind1, ind1 );
+        auto A12 = A( ind1, ind2 );
+        auto A22 = A( ind2, ind2 );
+
+        auto U12 = U( ind1, ind2 );
+
+        // A01 := A01 inv(U11)
+        U11Request.Wait();
+        A01Request.Wait();
+        LocalTrsm
+        ( RIGHT, UPPER, NORMAL, diag, F(1), U11_STAR_STAR, A01_VC_STAR );
+        A01 = A01_VC_STAR;
+
+        // A11 := inv(U11)' A11 inv(U11)
+        A11Request.Wait();
+        TwoSidedTrsm( UPPER, diag, A11_STAR_STAR, U11_STAR_STAR );
+        A11 = A11_STAR_STAR;
+
+        // A02 := A02 - A01 U12
+        A01Trans_STAR_MC.AlignWith( A02 );
+        Transpose( A01_VC_STAR, A01Trans_STAR_MC );
+        U12Trans_MR_STAR.AlignWith( A02 );
+        Transpose( U12, U12Trans_MR_STAR );
+        LocalGemm
+        ( TRANSPOSE, TRANSPOSE, 
+          F(-1), A01Trans_STAR_MC, U12Trans_MR_STAR, F(1), A02 );
+
+        // Y12 := A11 U12
+        U12Trans_VR_STAR.AlignWith( A02 );
+        U12Trans_VR_STAR = U12Trans_MR_STAR;
+        U12_STAR_VR.AlignWith( A02 );
+        U12_STAR_VR.Resize( nb, A12.Width() );
+        Zero( U12_STAR_VR ); 
+        Transpose( U12Trans_VR_STAR.Matrix(), U12_STAR_VR.Matrix() );
+        Y12_STAR_VR.AlignWith( A12 );
+        Y12_STAR_VR.Resize( nb, A12.Width() );
+        Zero( Y12_STAR_VR );
+        Hemm
+        ( LEFT, UPPER, 
+          F(1), A11_STAR_STAR.Matrix(), U12_STAR_VR.Matrix(), 
+          F(0), Y12_STAR_VR.Matrix() );
+
+        // A12 := inv(U11)' A12
+        A12_STAR_VR.AlignWith( A22 );
+        A12_STAR_VR = A12;
+        LocalTrsm
+        ( LEFT, UPPER, ADJOINT, diag, F(1), U11_STAR_STAR, A12_STAR_VR );
+
+        // A12 := A12 - 1/2 Y12
+        Axpy( F(-1)/F(2), Y12_STAR_VR, A12_STAR_VR );
+
+        // Form the redistributions needed by the trailing update
+        A12_STAR_MR.AlignWith( A22 );
+        A12_STAR_MR = A12_STAR_VR;
+        A12_STAR_VC.AlignWith( A22 );
+        A12_STAR_VC = A12_STAR_VR;
+        U12_STAR_VC.AlignWith( A22 );
+        U12_STAR_VC = U12_STAR_VR;
+        A12_STAR_MC.AlignWith( A22 );
+        A12_STAR_MC = A12_STAR_VC;
+        U12_STAR_MC.AlignWith( A22 );
+        U12_STAR_MC = U12_STAR_VC;
+
+        // A12 := A12 - 1/2 Y12
+        // (the trailing update only depends upon the redistributions above)
+        Axpy( F(-1)/F(2), Y12_STAR_VR, A12_STAR_VR );
+        A12 = A12_STAR_VR;
+
+        // A22 := A22 - (A12' U12 + U12' A12)
+        if( nbNext > 0 )
+        {
+            // Update the rows of the next panel and start gathering it
+            const Range<Int> indT( 0, nbNext ), indB( nbNext, END );
+            auto A22TL = A22( indT, indT );
+            auto A22TR = A22( indT, indB );
+            auto A22BR = A22( indB, indB );
+            auto A12_STAR_MC_L = A12_STAR_MC( ALL, indT );
+            auto A12_STAR_MC_R = A12_STAR_MC( ALL, indB );
+            auto U12_STAR_MC_L = U12_STAR_MC( ALL, indT );
+            auto U12_STAR_MC_R = U12_STAR_MC( ALL, indB );
+            auto U12Trans_MR_STAR_T = U12Trans_MR_STAR( indT, ALL );
+            auto U12Trans_MR_STAR_B = U12Trans_MR_STAR( indB, ALL );
+            auto A12_STAR_MR_L = A12_STAR_MR( ALL, indT );
+            auto A12_STAR_MR_R = A12_STAR_MR( ALL, indB );
+
+            LocalTrr2k
+            ( UPPER, ADJOINT, TRANSPOSE, ADJOINT, NORMAL,
+              F(-1), A12_STAR_MC_L, U12Trans_MR_STAR_T,
+              F(-1), U12_STAR_MC_L, A12_STAR_MR_L,
+              F(1), A22TL );
+            LocalGemm
+            ( ADJOINT, TRANSPOSE,
+              F(-1), A12_STAR_MC_L, U12Trans_MR_STAR_B, F(1), A22TR );
+            LocalGemm
+            ( ADJOINT, NORMAL,
+              F(-1), U12_STAR_MC_L, A12_STAR_MR_R, F(1), A22TR );
+            startPanel( k+nb );
+
+            LocalTrr2k
+            ( UPPER, ADJOINT, TRANSPOSE, ADJOINT, NORMAL,
+              F(-1), A12_STAR_MC_R, U12Trans_MR_STAR_B,
+              F(-1), U12_STAR_MC_R, A12_STAR_MR_R,
+              F(1), A22BR );
+        }
+    }
+}
+
 } // namespace twotrsm
 } // namespace El
 
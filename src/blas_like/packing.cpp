@@ -0,0 +1,41 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace {
+using namespace El;
+
+int packingThreads = 0;
+Int packingThreshold = 1 << 15;
+
+}
+
+namespace El {
+
+void SetPackingThreads( int numThreads )
+{
+    if( numThreads < 0 )
+        LogicError("The number of packing threads must be non-negative");
+    ::packingThreads = numThreads;
+}
+
+int PackingThreads()
+{
+#ifdef EL_HAVE_THREADED_PACKING
+    return ( ::packingThreads == 0 ? omp_get_max_threads() : ::packingThreads );
+#else
+    return 1;
+#endif
+}
+
+void SetPackingThreshold( Int numEntries ) { ::packingThreshold = numEntries; }
+
+Int PackingThreshold() { return ::packingThreshold; }
+
+} // namespace El
@@ -0,0 +1,436 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// The Low-Rank ADI of
+//
+//   Jing-Rebecca Li and Jacob White, "Low rank solution of Lyapunov
+//   equations", SIAM J. Matrix Anal. Appl., 24(1), pp. 260--280, 2002,
+//
+// in the residual-based form of Benner, Kuerschner, and Saak, solves
+// A X + X A^H = G G^H for eigenvalues of A in the open right-half plane via
+//
+//   V_k := inv(A + q_k I) W_{k-1},
+//   W_k := W_{k-1} - 2 q_k V_k,
+//   Z   := [Z, sqrt(2 q_k) V_k],
+//
+// starting from W_0 = G, so that the residual is W_k W_k^H. The Newton-
+// Kleinman method for the Riccati equation then solves a sequence of such
+// Lyapunov equations with the closed-loop operator, which is a low-rank
+// perturbation of -A.
+
+namespace El {
+
+namespace {
+
+// M := X^H Y, which is redundantly stored on each process
+template<typename Field>
+void InnerProducts
+( const DistMultiVec<Field>& X,
+  const DistMultiVec<Field>& Y,
+        Matrix<Field>& M )
+{
+    EL_DEBUG_CSE
+    Zeros( M, X.Width(), Y.Width() );
+    Gemm
+    ( ADJOINT, NORMAL,
+      Field(1), X.LockedMatrix(), Y.LockedMatrix(), Field(0), M );
+    mpi::AllReduce( M.Buffer(), M.Height()*M.Width(), X.Grid().Comm() );
+}
+
+// The shifted matrices H + q I, for each of the shifts, are either each
+// factored once or a single factorization is refactored as needed. Since the
+// sparsity pattern is independent of the shift, the reordering is only
+// computed once in the latter case.
+template<typename Field>
+class ShiftedFactorizations
+{
+public:
+    typedef Base<Field> Real;
+
+    ShiftedFactorizations
+    ( const DistSparseMatrix<Field>& H,
+      const vector<Real>& shifts,
+            bool cache )
+    : shifts_(shifts), cache_(cache), HShifted_(H.Grid())
+    {
+        EL_DEBUG_CSE
+        // Explicitly store the entire diagonal so that the shifts can be
+        // applied in place
+        HBase_ = H;
+        ShiftDiagonal( HBase_, Field(0), 0, false );
+        factorizations_.resize( cache ? shifts.size() : 1 );
+    }
+
+    const vector<Real>& Shifts() const { return shifts_; }
+
+    const DistSparseLDLFactorization<Field>& Get( Int k )
+    {
+        EL_DEBUG_CSE
+        auto& factorization = factorizations_[cache_ ? k : 0];
+        if( factorization && (cache_ || current_ == k) )
+            return *factorization;
+
+        HShifted_ = HBase_;
+        ShiftDiagonal( HShifted_, shifts_[k], 0, true );
+        if( factorization )
+        {
+            factorization->ChangeNonzeroValues( HShifted_ );
+        }
+        else
+        {
+            factorization.reset( new DistSparseLDLFactorization<Field> );
+            factorization->Initialize( HShifted_, true );
+        }
+        factorization->Factor();
+        current_ = k;
+        return *factorization;
+    }
+
+private:
+    vector<Real> shifts_;
+    bool cache_;
+    Int current_=-1;
+    DistSparseMatrix<Field> HBase_, HShifted_;
+    vector<unique_ptr<DistSparseLDLFactorization<Field>>> factorizations_;
+};
+
+// Estimate the extremal eigenvalues of the Hermitian positive-definite H
+// with the power method applied to H and inv(H) and distribute the shifts
+// logarithmically between them.
+template<typename Real,typename Field>
+vector<Real> EstimateShifts
+( const DistSparseMatrix<Field>& H, const LowRankADICtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( !ctrl.shifts.empty() )
+    {
+        for( const Real& shift : ctrl.shifts )
+            if( shift <= Real(0) )
+                LogicError("The ADI shifts must be positive");
+        return ctrl.shifts;
+    }
+    if( ctrl.numShifts < 1 )
+        LogicError("There must be at least one ADI shift");
+    const Int n = H.Height();
+    const Grid& grid = H.Grid();
+
+    DistSparseLDLFactorization<Field> factorization;
+    factorization.Initialize( H, true );
+    factorization.Factor();
+
+    Matrix<Field> rayleigh;
+    DistMultiVec<Field> x(grid), y(grid);
+    Real lambdaMax=0, lambdaMinInv=0;
+    for( Int inverse=0; inverse<2; ++inverse )
+    {
+        Gaussian( x, n, 1 );
+        for( Int it=0; it<ctrl.numPowerIts; ++it )
+        {
+            x *= Real(1)/FrobeniusNorm( x );
+            if( inverse )
+            {
+                y = x;
+                factorization.Solve( y );
+            }
+            else
+            {
+                Zeros( y, n, 1 );
+                Multiply( NORMAL, Field(1), H, x, Field(0), y );
+            }
+            InnerProducts( x, y, rayleigh );
+            x = y;
+        }
+        if( inverse )
+            lambdaMinInv = RealPart(rayleigh(0,0));
+        else
+            lambdaMax = RealPart(rayleigh(0,0));
+    }
+    if( lambdaMax <= Real(0) || lambdaMinInv <= Real(0) )
+        LogicError("H did not appear to be positive-definite");
+    const Real lambdaMin = Min( Real(1)/lambdaMinInv, lambdaMax );
+
+    vector<Real> shifts( ctrl.numShifts );
+    const Real logRatio = Log( lambdaMax/lambdaMin );
+    for( Int k=0; k<ctrl.numShifts; ++k )
+        shifts[k] =
+          lambdaMin*Exp( logRatio*(k+Real(1)/2)/Real(ctrl.numShifts) );
+    return shifts;
+}
+
+// Overwrite Z with Z Q, where the columns of Q are the eigenvectors of Z^H Z
+// whose eigenvalues are at least tol times the largest, so that the columns
+// of Z become orthogonal and Z Z^H only changes by the discarded directions.
+template<typename Field>
+void CompressColumns( DistMultiVec<Field>& Z, Base<Field> tol )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( tol == Real(0) || Z.Width() == 0 )
+        return;
+    Matrix<Field> gram, Q;
+    Matrix<Real> w;
+    InnerProducts( Z, Z, gram );
+    HermitianEig( LOWER, gram, w, Q );
+    const Int r = w.Height();
+    const Real wMax = w(r-1);
+    Int numKept = 0;
+    while( numKept < r && w(r-1-numKept) > tol*wMax )
+        ++numKept;
+    auto QKept = Q( ALL, IR(r-numKept,r) );
+
+    Matrix<Field> ZLoc( Z.LockedMatrix() );
+    Z.Resize( Z.Height(), numKept );
+    Gemm( NORMAL, NORMAL, Field(1), ZLoc, QKept, Field(0), Z.Matrix() );
+}
+
+template<typename Field>
+Int ADI
+( const DistMultiVec<Field>& U,
+  const DistMultiVec<Field>& V,
+  const DistMultiVec<Field>& G,
+        DistMultiVec<Field>& Z,
+        ShiftedFactorizations<Field>& factorizations,
+  const LowRankADICtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = G.Height();
+    const Int r = G.Width();
+    const Int lowRank = U.Width();
+    const Grid& grid = G.Grid();
+    const bool print = ctrl.progress && grid.Rank() == 0;
+    const vector<Real>& shifts = factorizations.Shifts();
+    const Int numShifts = shifts.size();
+
+    Matrix<Field> gram;
+    InnerProducts( G, G, gram );
+    const Real GNorm = TwoNorm( gram );
+
+    // The Sherman-Morrison-Woodbury updates require inv(H + q I) U and the
+    // capacitance matrices I + V^H inv(H + q I) U for each shift
+    vector<DistMultiVec<Field>> MInvUs;
+    vector<Matrix<Field>> capacitances( numShifts );
+    for( Int k=0; k<numShifts; ++k )
+        MInvUs.emplace_back( grid );
+
+    DistMultiVec<Field> W( G ), VBlock(grid);
+    Matrix<Field> T;
+    vector<Matrix<Field>> blocks;
+    Int numIts=0;
+    Real relResid = 1;
+    while( GNorm > Real(0) )
+    {
+        if( numIts == ctrl.maxIter )
+        {
+            if( grid.Rank() == 0 )
+                Output
+                ("WARNING: LR-ADI did not converge after ",numIts,
+                 " iterations (relative residual of ",relResid,")");
+            break;
+        }
+        const Int k = Mod( numIts, numShifts );
+        const Real shift = shifts[k];
+        const auto& factorization = factorizations.Get( k );
+
+        // V_k := inv(H + U V^H + q I) W
+        VBlock = W;
+        factorization.Solve( VBlock );
+        if( lowRank > 0 )
+        {
+            auto& MInvU = MInvUs[k];
+            auto& capacitance = capacitances[k];
+            if( MInvU.Width() != lowRank )
+            {
+                MInvU = U;
+                factorization.Solve( MInvU );
+                InnerProducts( V, MInvU, capacitance );
+                ShiftDiagonal( capacitance, Field(1) );
+            }
+            InnerProducts( V, VBlock, T );
+            LinearSolve( capacitance, T );
+            Gemm
+            ( NORMAL, NORMAL,
+              Field(-1), MInvU.LockedMatrix(), T,
+              Field(1), VBlock.Matrix() );
+        }
+
+        // W := W - 2 q V_k and Z := [Z, sqrt(2 q) V_k]
+        Axpy( Field(-2*shift), VBlock.LockedMatrix(), W.Matrix() );
+        blocks.push_back( VBlock.LockedMatrix() );
+        blocks.back() *= Sqrt(2*shift);
+        ++numIts;
+
+        InnerProducts( W, W, gram );
+        relResid = TwoNorm( gram ) / GNorm;
+        if( print )
+            Output
+            ("LR-ADI iteration ",numIts," with shift ",shift,
+             ": || W^H W ||_2 / || G^H G ||_2 = ",relResid);
+        if( relResid <= ctrl.tol )
+            break;
+    }
+
+    Z.SetGrid( grid );
+    Zeros( Z, n, r*numIts );
+    for( Int j=0; j<numIts; ++j )
+    {
+        auto ZBlock = Z.Matrix()( ALL, IR(j*r,(j+1)*r) );
+        ZBlock = blocks[j];
+    }
+    CompressColumns( Z, ctrl.compressTol );
+    return numIts;
+}
+
+} // anonymous namespace
+
+template<typename Field>
+Int LowRankLyapunov
+( const DistSparseMatrix<Field>& H,
+  const DistMultiVec<Field>& U,
+  const DistMultiVec<Field>& V,
+  const DistMultiVec<Field>& G,
+        DistMultiVec<Field>& Z,
+  const LowRankADICtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = H.Height();
+    if( H.Width() != n )
+        LogicError("H must be square");
+    if( G.Height() != n )
+        LogicError("G must conform with H");
+    if( U.Height() != n || V.Height() != n || U.Width() != V.Width() )
+        LogicError("U and V must be n x k");
+
+    ShiftedFactorizations<Field>
+      factorizations( H, EstimateShifts(H,ctrl), ctrl.cacheFactorizations );
+    return ADI( U, V, G, Z, factorizations, ctrl );
+}
+
+template<typename Field>
+Int LowRankLyapunov
+( const DistSparseMatrix<Field>& H,
+  const DistMultiVec<Field>& G,
+        DistMultiVec<Field>& Z,
+  const LowRankADICtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMultiVec<Field> U(H.Grid()), V(H.Grid());
+    Zeros( U, H.Height(), 0 );
+    Zeros( V, H.Height(), 0 );
+    return LowRankLyapunov( H, U, V, G, Z, ctrl );
+}
+
+// With the feedback K_k = B^H X_k, each Newton step solves
+//
+//   (A - B K_k)^H X + X (A - B K_k) = -(C^H C + K_k^H K_k),
+//
+// which is the Lyapunov equation
+//
+//   (-A + K_k^H B^H) X + X (-A + K_k^H B^H)^H = [C^H, K_k^H] [C^H, K_k^H]^H,
+//
+// for X_{k+1}. Since each operator is a rank-m perturbation of -A, the
+// factorizations of the shifted copies of -A are reused by every step.
+template<typename Field>
+Int LowRankRiccati
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Field>& B,
+  const DistMultiVec<Field>& CAdj,
+        DistMultiVec<Field>& Z,
+  const NewtonKleinmanCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    const Int m = B.Width();
+    const Int p = CAdj.Width();
+    const Grid& grid = A.Grid();
+    if( A.Width() != n )
+        LogicError("A must be square");
+    if( B.Height() != n || CAdj.Height() != n )
+        LogicError("B and C^H must have as many rows as A");
+
+    DistSparseMatrix<Field> H( A );
+    Scale( Real(-1), H );
+    ShiftedFactorizations<Field> factorizations
+    ( H, EstimateShifts(H,ctrl.adiCtrl), ctrl.adiCtrl.cacheFactorizations );
+
+    // The adjoint of the feedback, K^H = X B = Z (Z^H B)
+    DistMultiVec<Field> KAdj(grid), KAdjOld(grid), G(grid), U(grid);
+    Zeros( KAdj, n, 0 );
+    Zeros( U, n, 0 );
+    Zeros( Z, n, 0 );
+    Matrix<Field> ZAdjB;
+    Int numIts=0;
+    while( true )
+    {
+        if( numIts == ctrl.maxIter )
+            RuntimeError
+            ("Newton-Kleinman did not converge in ",numIts," iterations");
+
+        // G := [C^H, K^H]
+        Zeros( G, n, p+KAdj.Width() );
+        auto GC = G.Matrix()( ALL, IR(0,p) );
+        auto GK = G.Matrix()( ALL, IR(p,END) );
+        GC = CAdj.LockedMatrix();
+        GK = KAdj.LockedMatrix();
+
+        const Int numADIIts =
+          ADI( U, B, G, Z, factorizations, ctrl.adiCtrl );
+        ++numIts;
+
+        KAdjOld = KAdj;
+        InnerProducts( Z, B, ZAdjB );
+        Zeros( KAdj, n, m );
+        Gemm
+        ( NORMAL, NORMAL,
+          Field(1), Z.LockedMatrix(), ZAdjB, Field(0), KAdj.Matrix() );
+        U = KAdj;
+
+        const Real KNorm = FrobeniusNorm( KAdj );
+        if( KAdjOld.Width() != m )
+            Zeros( KAdjOld, n, m );
+        KAdjOld -= KAdj;
+        const Real relChange =
+          ( KNorm == Real(0) ? Real(0) : FrobeniusNorm(KAdjOld)/KNorm );
+        if( ctrl.progress && grid.Rank() == 0 )
+            Output
+            ("Newton-Kleinman iteration ",numIts,": ",numADIIts,
+             " LR-ADI iterations, rank(Z)=",Z.Width(),
+             ", || K - KOld ||_F / || K ||_F = ",relChange);
+        if( relChange <= ctrl.tol )
+            break;
+    }
+    return numIts;
+}
+
+#define PROTO(Field) \
+  template Int LowRankLyapunov \
+  ( const DistSparseMatrix<Field>& H, \
+    const DistMultiVec<Field>& G, \
+          DistMultiVec<Field>& Z, \
+    const LowRankADICtrl<Base<Field>>& ctrl ); \
+  template Int LowRankLyapunov \
+  ( const DistSparseMatrix<Field>& H, \
+    const DistMultiVec<Field>& U, \
+    const DistMultiVec<Field>& V, \
+    const DistMultiVec<Field>& G, \
+          DistMultiVec<Field>& Z, \
+    const LowRankADICtrl<Base<Field>>& ctrl ); \
+  template Int LowRankRiccati \
+  ( const DistSparseMatrix<Field>& A, \
+    const DistMultiVec<Field>& B, \
+    const DistMultiVec<Field>& CAdj, \
+          DistMultiVec<Field>& Z, \
+    const NewtonKleinmanCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -7,8 +7,12 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <El/blas_like/level2.hpp>
+#include <El/blas_like/level3.hpp>
 #include <El/control.hpp>
 
+#include "./Sylvester/BartelsStewart.hpp"
+
 namespace El {
 
 // A is assumed to have all of its eigenvalues in the open right-half plane.
@@ -72,6 +76,36 @@ void Lyapunov
     Sylvester( m, W, X, ctrl );
 }
 
+template<typename F>
+void Lyapunov
+( const Matrix<F>& A,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    if( sylvester::UseBartelsStewart<F>( m, m, true, ctrl ) )
+        sylvester::BartelsStewart( A, A, C, X, true, ctrl );
+    else
+        Lyapunov( A, C, X, ctrl.signCtrl );
+}
+
+template<typename F>
+void Lyapunov
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    if( sylvester::UseBartelsStewart<F>( m, m, true, ctrl ) )
+        sylvester::BartelsStewart( A, A, C, X, true, ctrl );
+    else
+        Lyapunov( A, C, X, ctrl.signCtrl );
+}
+
 #define PROTO(F) \
   template void Lyapunov \
   ( const Matrix<F>& A, \
@@ -82,7 +116,17 @@ void Lyapunov
   ( const ElementalMatrix<F>& A, \
     const ElementalMatrix<F>& C, \
           ElementalMatrix<F>& X, \
-    SignCtrl<Base<F>> ctrl );
+    SignCtrl<Base<F>> ctrl ); \
+  template void Lyapunov \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& C, \
+          Matrix<F>& X, \
+    const SylvesterCtrl<Base<F>>& ctrl ); \
+  template void Lyapunov \
+  ( const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& C, \
+          ElementalMatrix<F>& X, \
+    const SylvesterCtrl<Base<F>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
@@ -7,9 +7,13 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <El/blas_like/level2.hpp>
+#include <El/blas_like/level3.hpp>
 #include <El/lapack_like/funcs.hpp>
 #include <El/control.hpp>
 
+#include "./Sylvester/BartelsStewart.hpp"
+
 namespace El {
 
 // W = | A -C |, where A is m x m, B is n x n, and both are assumed to have 
@@ -155,6 +159,40 @@ void Sylvester
     Sylvester( m, W, X, ctrl );
 }
 
+template<typename F>
+void Sylvester
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = C.Height();
+    const Int n = C.Width();
+    if( sylvester::UseBartelsStewart<F>( m, n, false, ctrl ) )
+        sylvester::BartelsStewart( A, B, C, X, false, ctrl );
+    else
+        Sylvester( A, B, C, X, ctrl.signCtrl );
+}
+
+template<typename F>
+void Sylvester
+( const ElementalMatrix<F>& A,
+  const ElementalMatrix<F>& B,
+  const ElementalMatrix<F>& C,
+        ElementalMatrix<F>& X,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = C.Height();
+    const Int n = C.Width();
+    if( sylvester::UseBartelsStewart<F>( m, n, false, ctrl ) )
+        sylvester::BartelsStewart( A, B, C, X, false, ctrl );
+    else
+        Sylvester( A, B, C, X, ctrl.signCtrl );
+}
+
 #define PROTO(F) \
   template void Sylvester \
   ( Int m, \
@@ -177,7 +215,19 @@ void Sylvester
     const ElementalMatrix<F>& B, \
     const ElementalMatrix<F>& C, \
           ElementalMatrix<F>& X, \
-    SignCtrl<Base<F>> ctrl );
+    SignCtrl<Base<F>> ctrl ); \
+  template void Sylvester \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& B, \
+    const Matrix<F>& C, \
+          Matrix<F>& X, \
+    const SylvesterCtrl<Base<F>>& ctrl ); \
+  template void Sylvester \
+  ( const ElementalMatrix<F>& A, \
+    const ElementalMatrix<F>& B, \
+    const ElementalMatrix<F>& C, \
+          ElementalMatrix<F>& X, \
+    const SylvesterCtrl<Base<F>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_QUAD
@@ -0,0 +1,342 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SYLVESTER_BARTELSSTEWART_HPP
+#define EL_SYLVESTER_BARTELSSTEWART_HPP
+
+// With the Schur decompositions A = Q_A T_A Q_A^H and B = Q_B T_B Q_B^H,
+// the Sylvester equation A X + X B = C becomes
+//
+//   T_A Y + Y T_B = Q_A^H C Q_B,   X = Q_A Y Q_B^H,
+//
+// and, for the Lyapunov equation A X + X A^H = C, T_B = T_A^H is lower
+// triangular (and Q_B = Q_A). Real matrices are reduced to real Schur form and
+// then to complex triangular form so that only the triangular case arises.
+//
+// The triangular equation is recursively split along the larger of its two
+// dimensions, as in
+//
+//   Isak Jonsson and Bo Kagstrom, "Recursive Blocked Algorithms for Solving
+//   Triangular Systems -- Part I: One-Sided and Coupled Sylvester-Type Matrix
+//   Equations", ACM Trans. Math. Software, 28(4), pp. 392--415, 2002,
+//
+// so that almost all of the work is performed within Gemm.
+
+namespace El {
+namespace sylvester {
+
+template<typename Real>
+void ComplexSchur
+( const Matrix<Real>& A,
+        Matrix<Complex<Real>>& T,
+        Matrix<Complex<Real>>& Q,
+  const SchurCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> TReal( A ), QReal;
+    Matrix<Complex<Real>> w;
+    Schur( TReal, w, QReal, ctrl );
+    schur::RealToComplex( TReal, QReal, T, Q );
+}
+
+template<typename Real>
+void ComplexSchur
+( const Matrix<Complex<Real>>& A,
+        Matrix<Complex<Real>>& T,
+        Matrix<Complex<Real>>& Q,
+  const SchurCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Complex<Real>> w;
+    T = A;
+    Schur( T, w, Q, ctrl );
+}
+
+template<typename Real>
+void ComplexSchur
+( const DistMatrix<Real>& A,
+        DistMatrix<Complex<Real>>& T,
+        DistMatrix<Complex<Real>>& Q,
+  const SchurCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    DistMatrix<Real> TReal( A ), QReal(g);
+    DistMatrix<Complex<Real>,VR,STAR> w(g);
+    Schur( TReal, w, QReal, ctrl );
+    schur::RealToComplex( TReal, QReal, T, Q );
+}
+
+template<typename Real>
+void ComplexSchur
+( const DistMatrix<Complex<Real>>& A,
+        DistMatrix<Complex<Real>>& T,
+        DistMatrix<Complex<Real>>& Q,
+  const SchurCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrix<Complex<Real>,VR,STAR> w( A.Grid() );
+    T = A;
+    Schur( T, w, Q, ctrl );
+}
+
+// Overwrite C with the solution Y of T Y + Y S = C, where T is upper
+// triangular and S is either upper or lower triangular. Once both dimensions
+// are at most the cutoff, the columns of Y are found in sequence by shifted
+// triangular solves against T.
+template<typename F>
+void Triangular
+( Matrix<F>& T, UpperOrLower uploS, const Matrix<F>& S, Matrix<F>& C,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    const Int m = T.Height();
+    const Int n = S.Height();
+    if( m == 0 || n == 0 )
+        return;
+
+    if( m <= cutoff && n <= cutoff )
+    {
+        Matrix<F> shift( 1, 1 );
+        for( Int jj=0; jj<n; ++jj )
+        {
+            const Int j = ( uploS==UPPER ? jj : n-1-jj );
+            auto cj = C( ALL, IR(j) );
+            const Range<Int> solvedInd =
+              ( uploS==UPPER ? IR(0,j) : IR(j+1,n) );
+            if( solvedInd.end > solvedInd.beg )
+                Gemv
+                ( NORMAL,
+                  F(-1), C( ALL, solvedInd ), S( solvedInd, IR(j) ),
+                  F(1), cj );
+            shift(0) = -S(j,j);
+            MultiShiftTrsm( LEFT, UPPER, NORMAL, F(1), T, shift, cj );
+        }
+        return;
+    }
+
+    if( m >= n )
+    {
+        // | T11 T12 | | Y1 | + | Y1 | S = | C1 |
+        // |   0 T22 | | Y2 |   | Y2 |     | C2 |
+        const Int m1 = m/2;
+        const Range<Int> ind1(0,m1), ind2(m1,m);
+        auto T11 = T( ind1, ind1 );
+        auto T12 = T( ind1, ind2 );
+        auto T22 = T( ind2, ind2 );
+        auto C1 = C( ind1, ALL );
+        auto C2 = C( ind2, ALL );
+        Triangular( T22, uploS, S, C2, cutoff );
+        Gemm( NORMAL, NORMAL, F(-1), T12, C2, F(1), C1 );
+        Triangular( T11, uploS, S, C1, cutoff );
+    }
+    else
+    {
+        const Int n1 = n/2;
+        const Range<Int> ind1(0,n1), ind2(n1,n);
+        auto S11 = S( ind1, ind1 );
+        auto S22 = S( ind2, ind2 );
+        auto C1 = C( ALL, ind1 );
+        auto C2 = C( ALL, ind2 );
+        if( uploS == UPPER )
+        {
+            Triangular( T, uploS, S11, C1, cutoff );
+            Gemm( NORMAL, NORMAL, F(-1), C1, S(ind1,ind2), F(1), C2 );
+            Triangular( T, uploS, S22, C2, cutoff );
+        }
+        else
+        {
+            Triangular( T, uploS, S22, C2, cutoff );
+            Gemm( NORMAL, NORMAL, F(-1), C2, S(ind2,ind1), F(1), C1 );
+            Triangular( T, uploS, S11, C1, cutoff );
+        }
+    }
+}
+
+// The distributed version recursively splits in the same manner, but the
+// base cases are redundantly gathered to each process and solved locally.
+template<typename F>
+void Triangular
+( DistMatrix<F>& T, UpperOrLower uploS, const DistMatrix<F>& S,
+  DistMatrix<F>& C, Int cutoff )
+{
+    EL_DEBUG_CSE
+    const Int m = T.Height();
+    const Int n = S.Height();
+    if( m == 0 || n == 0 )
+        return;
+
+    if( m <= cutoff && n <= cutoff )
+    {
+        DistMatrix<F,STAR,STAR> T_STAR_STAR( T ), S_STAR_STAR( S ),
+          C_STAR_STAR( C );
+        Triangular
+        ( T_STAR_STAR.Matrix(), uploS, S_STAR_STAR.LockedMatrix(),
+          C_STAR_STAR.Matrix(), cutoff );
+        C = C_STAR_STAR;
+        return;
+    }
+
+    if( m >= n )
+    {
+        const Int m1 = m/2;
+        const Range<Int> ind1(0,m1), ind2(m1,m);
+        auto T11 = T( ind1, ind1 );
+        auto T12 = T( ind1, ind2 );
+        auto T22 = T( ind2, ind2 );
+        auto C1 = C( ind1, ALL );
+        auto C2 = C( ind2, ALL );
+        Triangular( T22, uploS, S, C2, cutoff );
+        Gemm( NORMAL, NORMAL, F(-1), T12, C2, F(1), C1 );
+        Triangular( T11, uploS, S, C1, cutoff );
+    }
+    else
+    {
+        const Int n1 = n/2;
+        const Range<Int> ind1(0,n1), ind2(n1,n);
+        auto S11 = S( ind1, ind1 );
+        auto S22 = S( ind2, ind2 );
+        auto C1 = C( ALL, ind1 );
+        auto C2 = C( ALL, ind2 );
+        if( uploS == UPPER )
+        {
+            Triangular( T, uploS, S11, C1, cutoff );
+            Gemm( NORMAL, NORMAL, F(-1), C1, S(ind1,ind2), F(1), C2 );
+            Triangular( T, uploS, S22, C2, cutoff );
+        }
+        else
+        {
+            Triangular( T, uploS, S22, C2, cutoff );
+            Gemm( NORMAL, NORMAL, F(-1), C2, S(ind2,ind1), F(1), C1 );
+            Triangular( T, uploS, S11, C1, cutoff );
+        }
+    }
+}
+
+// The solution of a real equation is the real part of the solution computed
+// in complex arithmetic
+template<typename Real>
+void ExtractSolution( const Matrix<Complex<Real>>& Y, Matrix<Real>& X )
+{ RealPart( Y, X ); }
+template<typename Real>
+void ExtractSolution
+( const Matrix<Complex<Real>>& Y, Matrix<Complex<Real>>& X )
+{ X = Y; }
+template<typename Real>
+void ExtractSolution
+( const DistMatrix<Complex<Real>>& Y, ElementalMatrix<Real>& X )
+{ RealPart( Y, X ); }
+template<typename Real>
+void ExtractSolution
+( const DistMatrix<Complex<Real>>& Y, ElementalMatrix<Complex<Real>>& X )
+{ Copy( Y, X ); }
+
+// Estimate whether Bartels-Stewart is cheaper than the sign function, counting
+// a complex flop as four real flops. Each Newton step of the sign function
+// inverts an (m+n) x (m+n) matrix (roughly 2 (m+n)^3 flops), while each Schur
+// decomposition costs roughly 25 n^3 flops and the two-sided transformations
+// and the triangular solve (which are in complex arithmetic) cost a further
+// 5 (m^2 n + m n^2) complex flops.
+template<typename F>
+bool UseBartelsStewart
+( Int m, Int n, bool lyapunov, const SylvesterCtrl<Base<F>>& ctrl )
+{
+    if( ctrl.approach != SYLVESTER_AUTO )
+        return ctrl.approach == SYLVESTER_BARTELS_STEWART;
+    const double fieldScale = ( IsComplex<F>::value ? 4 : 1 );
+    const double M = m;
+    const double N = n;
+    const double signCost =
+      fieldScale*ctrl.expectedSignIts*2*(M+N)*(M+N)*(M+N);
+    const double schurCost =
+      fieldScale*25*(M*M*M + (lyapunov ? 0 : N*N*N));
+    const double solveCost = 4*5*(M*M*N + M*N*N);
+    return schurCost + solveCost < signCost;
+}
+
+template<typename F>
+void BartelsStewart
+( const Matrix<F>& A,
+  const Matrix<F>& B,
+  const Matrix<F>& C,
+        Matrix<F>& X,
+  bool lyapunov,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Base<F>> CField;
+    Matrix<CField> TA, QA, TB, QB, Y, Z;
+    ComplexSchur( A, TA, QA, ctrl.schurCtrl );
+    if( lyapunov )
+    {
+        Adjoint( TA, TB );
+        QB = QA;
+    }
+    else
+        ComplexSchur( B, TB, QB, ctrl.schurCtrl );
+
+    // Y := Q_A^H C Q_B
+    Matrix<CField> CComplex;
+    Copy( C, CComplex );
+    Gemm( ADJOINT, NORMAL, CField(1), QA, CComplex, Z );
+    Gemm( NORMAL, NORMAL, CField(1), Z, QB, Y );
+
+    Triangular( TA, (lyapunov ? LOWER : UPPER), TB, Y, ctrl.cutoff );
+
+    // X := Q_A Y Q_B^H
+    Gemm( NORMAL, NORMAL, CField(1), QA, Y, Z );
+    Gemm( NORMAL, ADJOINT, CField(1), Z, QB, Y );
+    ExtractSolution( Y, X );
+}
+
+template<typename F>
+void BartelsStewart
+( const ElementalMatrix<F>& APre,
+  const ElementalMatrix<F>& BPre,
+  const ElementalMatrix<F>& CPre,
+        ElementalMatrix<F>& X,
+  bool lyapunov,
+  const SylvesterCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Base<F>> CField;
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+
+    DistMatrix<CField> TA(g), QA(g), TB(g), QB(g), Y(g), Z(g);
+    ComplexSchur( A, TA, QA, ctrl.schurCtrl );
+    if( lyapunov )
+    {
+        Adjoint( TA, TB );
+        QB = QA;
+    }
+    else
+    {
+        DistMatrixReadProxy<F,F,MC,MR> BProx( BPre );
+        ComplexSchur( BProx.GetLocked(), TB, QB, ctrl.schurCtrl );
+    }
+
+    // Y := Q_A^H C Q_B
+    DistMatrix<CField> CComplex(g);
+    Copy( CPre, CComplex );
+    Gemm( ADJOINT, NORMAL, CField(1), QA, CComplex, Z );
+    Gemm( NORMAL, NORMAL, CField(1), Z, QB, Y );
+
+    Triangular( TA, (lyapunov ? LOWER : UPPER), TB, Y, ctrl.cutoff );
+
+    // X := Q_A Y Q_B^H
+    Gemm( NORMAL, NORMAL, CField(1), QA, Y, Z );
+    Gemm( NORMAL, ADJOINT, CField(1), Z, QB, Y );
+    ExtractSolution( Y, X );
+}
+
+} // namespace sylvester
+} // namespace El
+
+#endif // ifndef EL_SYLVESTER_BARTELSSTEWART_HPP
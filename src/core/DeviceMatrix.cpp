@@ -0,0 +1,247 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#ifdef EL_HAVE_CUDA
+
+namespace El {
+
+template<typename Field>
+DeviceMatrix<Field>::DeviceMatrix( bool managed )
+: managed_(managed)
+{ }
+
+template<typename Field>
+DeviceMatrix<Field>::DeviceMatrix( Int height, Int width, bool managed )
+: managed_(managed)
+{
+    EL_DEBUG_CSE
+    Resize( height, width );
+}
+
+template<typename Field>
+DeviceMatrix<Field>::DeviceMatrix( DeviceMatrix<Field>&& A ) EL_NO_EXCEPT
+: height_(A.height_), width_(A.width_),
+  leadingDimension_(A.leadingDimension_), capacity_(A.capacity_),
+  managed_(A.managed_), buffer_(A.buffer_)
+{
+    A.height_ = A.width_ = A.capacity_ = 0;
+    A.leadingDimension_ = 1;
+    A.buffer_ = nullptr;
+}
+
+template<typename Field>
+DeviceMatrix<Field>::~DeviceMatrix()
+{ cuda::Free( buffer_ ); }
+
+template<typename Field>
+DeviceMatrix<Field>&
+DeviceMatrix<Field>::operator=( DeviceMatrix<Field>&& A )
+{
+    if( this != &A )
+    {
+        cuda::Free( buffer_ );
+        height_ = A.height_;
+        width_ = A.width_;
+        leadingDimension_ = A.leadingDimension_;
+        capacity_ = A.capacity_;
+        managed_ = A.managed_;
+        buffer_ = A.buffer_;
+        A.height_ = A.width_ = A.capacity_ = 0;
+        A.leadingDimension_ = 1;
+        A.buffer_ = nullptr;
+    }
+    return *this;
+}
+
+template<typename Field>
+void DeviceMatrix<Field>::Resize( Int height, Int width )
+{
+    EL_DEBUG_CSE
+    Resize( height, width, Max(height,Int(1)) );
+}
+
+template<typename Field>
+void DeviceMatrix<Field>::Resize( Int height, Int width, Int leadingDimension )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( height < 0 || width < 0 )
+          LogicError("Height and width must be non-negative");
+      if( leadingDimension < Max(height,Int(1)) )
+          LogicError("Leading dimension must be at least max(height,1)");
+    )
+    const Int size = leadingDimension*width;
+    if( size > capacity_ )
+    {
+        cuda::Free( buffer_ );
+        buffer_ = static_cast<Field*>
+          ( cuda::Allocate( size*sizeof(Field), managed_ ) );
+        capacity_ = size;
+    }
+    height_ = height;
+    width_ = width;
+    leadingDimension_ = leadingDimension;
+}
+
+template<typename Field>
+void DeviceMatrix<Field>::Empty()
+{
+    cuda::Free( buffer_ );
+    buffer_ = nullptr;
+    height_ = width_ = capacity_ = 0;
+    leadingDimension_ = 1;
+}
+
+template<typename Field>
+Int DeviceMatrix<Field>::Height() const EL_NO_EXCEPT { return height_; }
+template<typename Field>
+Int DeviceMatrix<Field>::Width() const EL_NO_EXCEPT { return width_; }
+template<typename Field>
+Int DeviceMatrix<Field>::LDim() const EL_NO_EXCEPT
+{ return leadingDimension_; }
+template<typename Field>
+bool DeviceMatrix<Field>::Managed() const EL_NO_EXCEPT { return managed_; }
+template<typename Field>
+Field* DeviceMatrix<Field>::Buffer() EL_NO_EXCEPT { return buffer_; }
+template<typename Field>
+const Field* DeviceMatrix<Field>::LockedBuffer() const EL_NO_EXCEPT
+{ return buffer_; }
+
+template<typename Field>
+void CopyToDevice( const Matrix<Field>& A, DeviceMatrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    B.Resize( A.Height(), A.Width() );
+    cuda::CopyHostToDevice
+    ( A.Height(), A.Width(), sizeof(Field),
+      A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
+}
+
+template<typename Field>
+void CopyToHost( const DeviceMatrix<Field>& A, Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    B.Resize( A.Height(), A.Width() );
+    cuda::CopyDeviceToHost
+    ( A.Height(), A.Width(), sizeof(Field),
+      A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
+}
+
+template<typename Field>
+void Copy( const DeviceMatrix<Field>& A, DeviceMatrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    if( &A == &B )
+        return;
+    B.Resize( A.Height(), A.Width() );
+    cuda::CopyDeviceToDevice
+    ( A.Height(), A.Width(), sizeof(Field),
+      A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
+}
+
+template<typename Field>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  Field alpha, const DeviceMatrix<Field>& A, const DeviceMatrix<Field>& B,
+  Field beta,        DeviceMatrix<Field>& C )
+{
+    EL_DEBUG_CSE
+    const Int m = ( orientA==NORMAL ? A.Height() : A.Width() );
+    const Int k = ( orientA==NORMAL ? A.Width() : A.Height() );
+    const Int n = ( orientB==NORMAL ? B.Width() : B.Height() );
+    EL_DEBUG_ONLY(
+      const Int kB = ( orientB==NORMAL ? B.Height() : B.Width() );
+      if( k != kB || C.Height() != m || C.Width() != n )
+          LogicError
+          ("Nonconformal Gemm: ",m," x ",k," times ",kB," x ",n," into ",
+           C.Height()," x ",C.Width());
+    )
+    cuda::Gemm
+    ( OrientationToChar(orientA), OrientationToChar(orientB), m, n, k,
+      alpha, A.LockedBuffer(), A.LDim(), B.LockedBuffer(), B.LDim(),
+      beta, C.Buffer(), C.LDim() );
+}
+
+template<typename Field>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Field alpha, const DeviceMatrix<Field>& A, DeviceMatrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() )
+          LogicError("Triangular matrix must be square");
+      if( (side == LEFT ? B.Height() : B.Width()) != A.Height() )
+          LogicError("Nonconformal Trsm");
+    )
+    cuda::Trsm
+    ( LeftOrRightToChar(side), UpperOrLowerToChar(uplo),
+      OrientationToChar(orientation), UnitOrNonUnitToChar(diag),
+      B.Height(), B.Width(),
+      alpha, A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
+}
+
+template<typename Field>
+void Herk
+( UpperOrLower uplo, Orientation orientation,
+  Base<Field> alpha, const DeviceMatrix<Field>& A,
+  Base<Field> beta,        DeviceMatrix<Field>& C )
+{
+    EL_DEBUG_CSE
+    const Int n = ( orientation==NORMAL ? A.Height() : A.Width() );
+    const Int k = ( orientation==NORMAL ? A.Width() : A.Height() );
+    EL_DEBUG_ONLY(
+      if( C.Height() != n || C.Width() != n )
+          LogicError("Nonconformal Herk");
+    )
+    cuda::Herk
+    ( UpperOrLowerToChar(uplo), OrientationToChar(orientation), n, k,
+      alpha, A.LockedBuffer(), A.LDim(), beta, C.Buffer(), C.LDim() );
+}
+
+template<typename Field>
+void Cholesky( UpperOrLower uplo, DeviceMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Can only compute Cholesky factor of square matrices");
+    cuda::Cholesky
+    ( UpperOrLowerToChar(uplo), A.Height(), A.Buffer(), A.LDim() );
+}
+
+#define PROTO(Field) \
+  template class DeviceMatrix<Field>; \
+  template void CopyToDevice \
+  ( const Matrix<Field>& A, DeviceMatrix<Field>& B ); \
+  template void CopyToHost \
+  ( const DeviceMatrix<Field>& A, Matrix<Field>& B ); \
+  template void Copy \
+  ( const DeviceMatrix<Field>& A, DeviceMatrix<Field>& B ); \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    Field alpha, const DeviceMatrix<Field>& A, const DeviceMatrix<Field>& B, \
+    Field beta,        DeviceMatrix<Field>& C ); \
+  template void Trsm \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    Field alpha, const DeviceMatrix<Field>& A, DeviceMatrix<Field>& B ); \
+  template void Herk \
+  ( UpperOrLower uplo, Orientation orientation, \
+    Base<Field> alpha, const DeviceMatrix<Field>& A, \
+    Base<Field> beta,        DeviceMatrix<Field>& C ); \
+  template void Cholesky( UpperOrLower uplo, DeviceMatrix<Field>& A );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
+
+#endif // ifdef EL_HAVE_CUDA
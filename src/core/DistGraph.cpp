@@ -629,6 +629,33 @@ void DistGraph::ForceNumLocalEdges( Int numLocalEdges )
     sources_.resize( numLocalEdges );
     targets_.resize( numLocalEdges );
     locallyConsistent_ = false;
+    multMeta.Clear();
+}
+
+void DistGraph::AdoptLocalCompressedRows
+( Int numSources, Int numTargets,
+  vector<Int>&& localOffsets, vector<Int>&& targets )
+{
+    EL_DEBUG_CSE
+    Resize( numSources, numTargets );
+    AssertCompressedRows( numLocalSources_, numTargets, localOffsets, targets );
+    frozenSparsity_ = false;
+    markedForRemoval_.clear();
+    SwapClear( remoteSources_ );
+    SwapClear( remoteTargets_ );
+    SwapClear( remoteRemovals_ );
+    multMeta.Clear();
+
+    const Int firstLocalSource = FirstLocalSource();
+    localSourceOffsets_ = std::move( localOffsets );
+    targets_ = std::move( targets );
+    sources_.resize( targets_.size() );
+    EL_PARALLEL_FOR
+    for( Int iLoc=0; iLoc<numLocalSources_; ++iLoc )
+        for( Int e=localSourceOffsets_[iLoc]; e<localSourceOffsets_[iLoc+1];
+             ++e )
+            sources_[e] = firstLocalSource + iLoc;
+    locallyConsistent_ = true;
 }
 
 void DistGraph::ForceConsistency( bool consistent ) EL_NO_EXCEPT
@@ -667,7 +694,23 @@ DistGraphMultMeta DistGraph::InitializeMultMeta() const
     for( Int e=0; e<numLocalEntries; ++e )
         uniqueCols[e] = ValueInt<Int>{colBuffer[e],e};
     std::sort( uniqueCols.begin(), uniqueCols.end(), ValueInt<Int>::Lesser );
-    meta.colOffs.resize(numLocalEntries);
+    // Since there are at most as many unique targets as local edges, the
+    // offsets are stored compactly whenever the latter fits into an int
+#ifdef EL_USE_64BIT_INTS
+    const bool compact = ( numLocalEntries <= Int(limits::Max<int>()) );
+#else
+    const bool compact = false;
+#endif
+    if( compact )
+    {
+        SwapClear( meta.colOffs );
+        meta.compactColOffs.resize( numLocalEntries );
+    }
+    else
+    {
+        SwapClear( meta.compactColOffs );
+        meta.colOffs.resize( numLocalEntries );
+    }
     {
         Int uniqueOff=-1, lastUnique=-1;
         for( Int e=0; e<numLocalEntries; ++e )
@@ -678,7 +721,10 @@ DistGraphMultMeta DistGraph::InitializeMultMeta() const
                 lastUnique = uniqueCols[e].value;
                 uniqueCols[uniqueOff] = uniqueCols[e];
             }
-            meta.colOffs[uniqueCols[e].index] = uniqueOff;
+            if( compact )
+                meta.compactColOffs[uniqueCols[e].index] = int(uniqueOff);
+            else
+                meta.colOffs[uniqueCols[e].index] = uniqueOff;
         }
         uniqueCols.resize( uniqueOff+1 );
     }
@@ -734,12 +780,84 @@ DistGraphMultMeta DistGraph::InitializeMultMeta() const
       meta.sendInds.data(), meta.sendSizes.data(), meta.sendOffs.data(),
       comm );
 
+    // Record the processes that we exchange entries with
+    const int commRank = grid_->Rank();
+    meta.FreeNeighborhood();
+    meta.neighbors.clear();
+    for( int q=0; q<commSize; ++q )
+        if( q != commRank && (meta.sendSizes[q] > 0 || meta.recvSizes[q] > 0) )
+            meta.neighbors.push_back( q );
+
+    // Split the local sources based upon whether all of their targets are
+    // owned by this process
+    const Int firstOwnedTarget = commRank*vecBlocksize;
+    const Int lastOwnedTarget = firstOwnedTarget + vecBlocksize;
+    meta.interiorSources.clear();
+    meta.boundarySources.clear();
+    for( Int iLoc=0; iLoc<numLocalSources_; ++iLoc )
+    {
+        bool interior = true;
+        const Int eStop = localSourceOffsets_[iLoc+1];
+        for( Int e=localSourceOffsets_[iLoc]; e<eStop; ++e )
+        {
+            if( colBuffer[e] < firstOwnedTarget ||
+                colBuffer[e] >= lastOwnedTarget )
+            {
+                interior = false;
+                break;
+            }
+        }
+        if( interior )
+            meta.interiorSources.push_back( iLoc );
+        else
+            meta.boundarySources.push_back( iLoc );
+    }
+
     meta.numRecvInds = numRecvInds;
     meta.ready = true;
 
     return meta;
 }
 
+template<typename T>
+void DistGraphMultMeta::NeighborExchange
+( const T* sendBuf, T* recvBuf, Int width, bool adjoint, mpi::Comm comm ) const
+{
+    EL_DEBUG_CSE
+    if( !ready )
+        LogicError("The multiplication metadata was not initialized");
+    // NOTE: The neighborhood must be formed by every process at once
+    if( neighborComm == mpi::COMM_NULL )
+        mpi::CreateNeighborhood( comm, neighbors, neighborComm );
+
+    const vector<int>& sSizes = ( adjoint ? recvSizes : sendSizes );
+    const vector<int>& sOffs = ( adjoint ? recvOffs : sendOffs );
+    const vector<int>& rSizes = ( adjoint ? sendSizes : recvSizes );
+    const vector<int>& rOffs = ( adjoint ? sendOffs : recvOffs );
+
+    // Directly copy our own contribution
+    const int commRank = mpi::Rank( comm );
+    std::copy
+    ( sendBuf+sOffs[commRank]*width,
+      sendBuf+(sOffs[commRank]+sSizes[commRank])*width,
+      recvBuf+rOffs[commRank]*width );
+
+    const int numNeighbors = neighbors.size();
+    vector<int> scs(numNeighbors), sds(numNeighbors),
+                rcs(numNeighbors), rds(numNeighbors);
+    for( int k=0; k<numNeighbors; ++k )
+    {
+        const int q = neighbors[k];
+        scs[k] = sSizes[q]*width;
+        sds[k] = sOffs[q]*width;
+        rcs[k] = rSizes[q]*width;
+        rds[k] = rOffs[q]*width;
+    }
+    mpi::NeighborAllToAll
+    ( sendBuf, scs.data(), sds.data(), recvBuf, rcs.data(), rds.data(),
+      neighbors, neighborComm );
+}
+
 void DistGraph::ComputeSourceOffsets()
 {
     EL_DEBUG_CSE
@@ -762,4 +880,16 @@ void DistGraph::ComputeSourceOffsets()
         localSourceOffsets_[sourceOffset] = numLocalEdges;
 }
 
+#define PROTO(T) \
+  template void DistGraphMultMeta::NeighborExchange \
+  ( const T* sendBuf, T* recvBuf, Int width, bool adjoint, \
+    mpi::Comm comm ) const;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
 } // namespace El
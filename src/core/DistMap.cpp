@@ -31,94 +31,132 @@ DistMap::~DistMap() { }
 void DistMap::Translate( vector<Int>& localInds ) const
 {
     EL_DEBUG_CSE
-    vector<int> origOwners;
-    if( origOwners.size() != localInds.size() )
-    {
-        const Int numLocalInds = localInds.size();
-        origOwners.resize( numLocalInds );
-        for( Int s=0; s<numLocalInds; ++s )
-        {
-            const Int i = localInds[s];
-            if( i < numSources_ )
-                origOwners[s] = i / blocksize_;
-            else
-                origOwners[s] = -1;
-        }
-    }
-    Translate( localInds, origOwners );
+    DistMapPlan plan;
+    FormTranslationPlan( localInds, plan );
+    Translate( localInds, plan );
 }
 
 void DistMap::Translate
 ( vector<Int>& localInds, const vector<int>& origOwners ) const
 {
     EL_DEBUG_CSE
-    const Int numLocalInds = localInds.size();
-    const int commSize = grid_->Size();
-    const int commRank = grid_->Rank();
+    DistMapPlan plan;
+    FormTranslationPlan( localInds, origOwners, plan );
+    Translate( localInds, plan );
+}
 
-    // Count how many indices we need each process to map
-    // Avoid unncessary branching within the loop by avoiding RowToProcess
-    vector<int> requestSizes( commSize, 0 );
+void DistMap::FormTranslationPlan
+( const vector<Int>& localInds, DistMapPlan& plan ) const
+{
+    EL_DEBUG_CSE
+    const Int numLocalInds = localInds.size();
+    vector<int> origOwners( numLocalInds );
     for( Int s=0; s<numLocalInds; ++s )
     {
         const Int i = localInds[s];
-        if( i < numSources_ )
-            ++requestSizes[origOwners[s]];
+        origOwners[s] = ( i < numSources_ ? i / blocksize_ : -1 );
     }
+    FormTranslationPlan( localInds, origOwners, plan );
+}
 
-    // Send our requests and find out what we need to fulfill
-    vector<int> fulfillSizes( commSize );
-    mpi::AllToAll
-    ( requestSizes.data(), 1, fulfillSizes.data(), 1, grid_->Comm() );
-
-    // Prepare for the AllToAll to exchange request sizes
-    vector<int> requestOffs, fulfillOffs;
-    const int numRequests = Scan( requestSizes, requestOffs );
-    const int numFulfills = Scan( fulfillSizes, fulfillOffs );
-
-    // Pack the requested information
-    vector<int> requests( numRequests );
-    auto offs = requestOffs;
+void DistMap::FormTranslationPlan
+( const vector<Int>& localInds, const vector<int>& origOwners,
+  DistMapPlan& plan ) const
+{
+    EL_DEBUG_CSE
+    const Int numLocalInds = localInds.size();
+    const int commSize = grid_->Size();
+    const Int firstLocalSource = FirstLocalSource();
+    plan.numSources = numSources_;
+    plan.blocksize = blocksize_;
+
+    // Sort the in-bounds indices by their owner so that duplicates can be
+    // requested only once
+    struct Request { int owner; Int index; Int slot; };
+    vector<Request> sortedRequests;
+    sortedRequests.reserve( numLocalInds );
     for( Int s=0; s<numLocalInds; ++s )
+        if( localInds[s] < numSources_ )
+            sortedRequests.push_back( Request{origOwners[s],localInds[s],s} );
+    std::sort
+    ( sortedRequests.begin(), sortedRequests.end(),
+      []( const Request& a, const Request& b )
+      { return a.owner < b.owner ||
+               (a.owner == b.owner && a.index < b.index); } );
+
+    plan.responseSlots.assign( numLocalInds, -1 );
+    plan.requestSizes.assign( commSize, 0 );
+    vector<Int> requests;
+    const Int numSorted = sortedRequests.size();
+    for( Int k=0; k<numSorted; ++k )
     {
-        const Int i = localInds[s];
-        if( i < numSources_ )
-            requests[offs[origOwners[s]]++] = i;
+        const Request& request = sortedRequests[k];
+        if( k == 0 || request.owner != sortedRequests[k-1].owner ||
+                      request.index != sortedRequests[k-1].index )
+        {
+            requests.push_back( request.index );
+            ++plan.requestSizes[request.owner];
+        }
+        plan.responseSlots[request.slot] = requests.size()-1;
     }
+    plan.numResponses = requests.size();
 
-    // Perform the first index exchange
-    vector<int> fulfills( numFulfills );
+    // Send our requests and find out what we need to fulfill
+    plan.fulfillSizes.resize( commSize );
     mpi::AllToAll
-    ( requests.data(), requestSizes.data(), requestOffs.data(),
-      fulfills.data(), fulfillSizes.data(), fulfillOffs.data(), grid_->Comm() );
+    ( plan.requestSizes.data(), 1, plan.fulfillSizes.data(), 1,
+      grid_->Comm() );
+    Scan( plan.requestSizes, plan.requestOffs );
+    const int numFulfills = Scan( plan.fulfillSizes, plan.fulfillOffs );
+    plan.fulfillSources.resize( numFulfills );
+    mpi::AllToAll
+    ( requests.data(),
+      plan.requestSizes.data(), plan.requestOffs.data(),
+      plan.fulfillSources.data(),
+      plan.fulfillSizes.data(), plan.fulfillOffs.data(), grid_->Comm() );
 
-    // Map all of the indices in 'fulfills'
-    for( int s=0; s<numFulfills; ++s )
+    // Store the fulfillments as local sources
+    for( Int& source : plan.fulfillSources )
     {
-        const Int i = fulfills[s];
-        const Int iLocal = i - blocksize_*commRank;
+        source -= firstLocalSource;
         EL_DEBUG_ONLY(
-          if( iLocal < 0 || iLocal >= (Int)map_.size() )
+          if( source < 0 || source >= (Int)map_.size() )
               LogicError
-              ("invalid request: i=",i,", iLocal=",iLocal,
-               ", commRank=",commRank,", blocksize=",blocksize_);
+              ("invalid request: i=",source+firstLocalSource,
+               ", firstLocalSource=",firstLocalSource,
+               ", numLocalSources=",map_.size());
         )
-        fulfills[s] = map_[iLocal];
     }
+}
 
-    // Send everything back
+void DistMap::Translate
+( vector<Int>& localInds, const DistMapPlan& plan ) const
+{
+    EL_DEBUG_CSE
+    const Int numLocalInds = localInds.size();
+    if( plan.numSources != numSources_ || plan.blocksize != blocksize_ ||
+        (Int)plan.responseSlots.size() != numLocalInds )
+        LogicError("Translation plan does not match the map and indices");
+
+    // Map the requested indices and send them back
+    const Int numFulfills = plan.fulfillSources.size();
+    vector<Int> fulfills( numFulfills );
+    EL_PARALLEL_FOR
+    for( Int s=0; s<numFulfills; ++s )
+        fulfills[s] = map_[plan.fulfillSources[s]];
+    vector<Int> responses( plan.numResponses );
     mpi::AllToAll
-    ( fulfills.data(), fulfillSizes.data(), fulfillOffs.data(),
-      requests.data(), requestSizes.data(), requestOffs.data(), grid_->Comm() );
+    ( fulfills.data(),
+      plan.fulfillSizes.data(), plan.fulfillOffs.data(),
+      responses.data(),
+      plan.requestSizes.data(), plan.requestOffs.data(), grid_->Comm() );
 
-    // Unpack in the same way we originally packed
-    // Avoid unncessary branching within the loop by avoiding RowToProcess
-    offs = requestOffs;
+    EL_PARALLEL_FOR
     for( Int s=0; s<numLocalInds; ++s )
     {
-        const Int i = localInds[s];
-        if( i < numSources_ )
-            localInds[s] = requests[offs[origOwners[s]]++];
+        const Int slot = plan.responseSlots[s];
+        if( slot >= 0 )
+            localInds[s] = responses[slot];
     }
 }
 
@@ -34,6 +34,46 @@ ElError ElDistMatrixCreateSpecific
     return EL_SUCCESS;
 }
 
+namespace {
+
+template<typename T>
+void QueueUpdates
+( AbstractDistMatrix<T>& A, Int numUpdates,
+  const Int* rows, const Int* cols, const T* values )
+{
+    A.Reserve( numUpdates );
+    for( Int e=0; e<numUpdates; ++e )
+        A.QueueUpdate( rows[e], cols[e], values[e] );
+}
+
+template<typename T>
+void GetLocalBuffer( const AbstractDistMatrix<T>& A, T* buffer, Int ldim )
+{
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    if( ldim < Max(localHeight,Int(1)) )
+        LogicError("Leading dimension was too small");
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        MemCopy( &buffer[jLoc*ldim], &ABuf[jLoc*ALDim], localHeight );
+}
+
+template<typename T>
+void SetLocalBuffer( AbstractDistMatrix<T>& A, const T* buffer, Int ldim )
+{
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    if( ldim < Max(localHeight,Int(1)) )
+        LogicError("Leading dimension was too small");
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        MemCopy( &ABuf[jLoc*ALDim], &buffer[jLoc*ldim], localHeight );
+}
+
+} // anonymous namespace
+
 extern "C" {
 
 #define DISTMATRIX_CREATE(SIG,SIGBASE,T) \
@@ -211,6 +251,14 @@ extern "C" {
   ElError ElDistMatrixLockedBuffer_ ## SIG \
   ( ElConstDistMatrix_ ## SIG A, const CREFLECT(T)** buffer ) \
   { EL_TRY( *buffer = CReflect(CReflect(A)->LockedBuffer()) ) } \
+  /* Copy the local matrix into a buffer */ \
+  ElError ElDistMatrixGetLocalBuffer_ ## SIG \
+  ( ElConstDistMatrix_ ## SIG A, CREFLECT(T)* buffer, ElInt ldim ) \
+  { EL_TRY( GetLocalBuffer( *CReflect(A), EL_RC(T*,buffer), ldim ) ) } \
+  /* Copy a buffer into the local matrix */ \
+  ElError ElDistMatrixSetLocalBuffer_ ## SIG \
+  ( ElDistMatrix_ ## SIG A, const CREFLECT(T)* buffer, ElInt ldim ) \
+  { EL_TRY( SetLocalBuffer( *CReflect(A), EL_RC(const T*,buffer), ldim ) ) } \
   /* const Grid& Grid() const */ \
   ElError ElDistMatrixGrid_ ## SIG \
   ( ElConstDistMatrix_ ## SIG A, ElConstGrid* grid ) \
@@ -434,6 +482,13 @@ extern "C" {
   ElError ElDistMatrixQueueUpdate_ ## SIG \
   ( ElDistMatrix_ ## SIG A, ElInt i, ElInt j, CREFLECT(T) value ) \
   { EL_TRY( CReflect(A)->QueueUpdate(i,j,CReflect(value)) ) } \
+  /* Queue a batch of (i,j,value) triplets */ \
+  ElError ElDistMatrixQueueUpdates_ ## SIG \
+  ( ElDistMatrix_ ## SIG A, ElInt numUpdates, \
+    const ElInt* rows, const ElInt* cols, const CREFLECT(T)* values ) \
+  { EL_TRY( \
+      QueueUpdates \
+      ( *CReflect(A), numUpdates, rows, cols, EL_RC(const T*,values) ) ) } \
   /* void ProcessQueues() */ \
   ElError ElDistMatrixProcessQueues_ ## SIG( ElDistMatrix_ ## SIG A ) \
   { EL_TRY( CReflect(A)->ProcessQueues() ) } \
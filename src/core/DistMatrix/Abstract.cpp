@@ -60,7 +60,7 @@ AbstractDistMatrix<T>::Empty( bool freeMemory )
     rootConstrained_ = false;
     SetShifts();
 
-    SwapClear( remoteUpdates );
+    ClearQueues( freeMemory );
 }
 
 template<typename T>
@@ -71,7 +71,32 @@ AbstractDistMatrix<T>::EmptyData( bool freeMemory )
     viewType_ = OWNER;
     height_ = 0;
     width_ = 0;
-    SwapClear( remoteUpdates );
+    ClearQueues( freeMemory );
+}
+
+template<typename T>
+void
+AbstractDistMatrix<T>::ReserveLocal( Int numLocalEntries )
+{
+    EL_DEBUG_CSE
+    matrix_.Reserve( numLocalEntries );
+}
+
+template<typename T>
+void
+AbstractDistMatrix<T>::ClearQueues( bool freeMemory )
+{
+    if( freeMemory )
+    {
+        SwapClear( remoteUpdates );
+        SwapClear( threadUpdates_ );
+    }
+    else
+    {
+        remoteUpdates.clear();
+        for( auto& queue : threadUpdates_ )
+            queue.clear();
+    }
 }
 
 template<typename T>
@@ -580,12 +605,55 @@ EL_NO_RELEASE_EXCEPT
 { QueueUpdate( Entry<T>{i,j,value} ); }
 
 template<typename T>
-void AbstractDistMatrix<T>::ProcessQueues( bool includeViewers )
+void AbstractDistMatrix<T>::ReserveThreadQueues
+( int numThreads, Int numEntriesPerThread )
+{
+    EL_DEBUG_CSE
+    if( numThreads < 1 )
+        LogicError("Must reserve at least one thread queue");
+    if( int(threadUpdates_.size()) < numThreads )
+        threadUpdates_.resize( numThreads );
+    for( auto& queue : threadUpdates_ )
+        queue.reserve( queue.size()+numEntriesPerThread );
+}
+
+// NOTE: These are called from within parallel regions and so they do not
+//       push onto the call stack
+template<typename T>
+void AbstractDistMatrix<T>::QueueThreadUpdate
+( int thread, const Entry<T>& entry )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_ONLY(
+      if( thread < 0 || thread >= int(threadUpdates_.size()) )
+          LogicError("Thread queue ",thread," was not reserved");
+    )
+    threadUpdates_[thread].push_back( entry );
+}
+
+template<typename T>
+void AbstractDistMatrix<T>::QueueThreadUpdate
+( int thread, Int i, Int j, T value )
+EL_NO_RELEASE_EXCEPT
+{ QueueThreadUpdate( thread, Entry<T>{i,j,value} ); }
+
+template<typename T>
+void AbstractDistMatrix<T>::ProcessQueues
+( bool includeViewers, bool compressIndices )
 {
     EL_DEBUG_CSE
     const auto& grid = Grid();
     const Dist colDist = ColDist();
     const Dist rowDist = RowDist();
+    if( !includeViewers && !Participating() )
+        return;
+
+    // Merge the per-thread queues (but keep them reserved)
+    for( auto& queue : threadUpdates_ )
+    {
+        remoteUpdates.insert( remoteUpdates.end(), queue.begin(), queue.end() );
+        queue.clear();
+    }
     const Int totalSend = remoteUpdates.size();
 
     // We will first push to redundant rank 0
@@ -593,61 +661,140 @@ void AbstractDistMatrix<T>::ProcessQueues( bool includeViewers )
 
     // Compute the metadata
     // ====================
-    mpi::Comm comm;
-    vector<int> sendCounts, owners(totalSend);
-    if( includeViewers )
+    // The rank (within 'comm') of each distribution owner is tabulated once
+    // so that the owners of the entries can be computed independently
+    mpi::Comm comm = ( includeViewers ? grid.ViewingComm() : grid.VCComm() );
+    const int commSize = mpi::Size( comm );
+    const int distSize = DistSize();
+    vector<int> distToComm( distSize );
+    for( int q=0; q<distSize; ++q )
     {
-        comm = grid.ViewingComm();
-        const int viewingSize = mpi::Size( grid.ViewingComm() );
-        sendCounts.resize(viewingSize,0);
+        const int vcOwner =
+          grid.CoordsToVC(colDist,rowDist,q,redundantRoot);
+        distToComm[q] =
+          ( includeViewers ? grid.VCToViewing(vcOwner) : vcOwner );
+    }
+    vector<int> owners(totalSend);
+    EL_PARALLEL_FOR
+    for( Int k=0; k<totalSend; ++k )
+    {
+        const Entry<T>& entry = remoteUpdates[k];
+        owners[k] = distToComm[Owner(entry.i,entry.j)];
+    }
+    vector<int> sendCounts(commSize,0);
+    for( Int k=0; k<totalSend; ++k )
+        ++sendCounts[owners[k]];
+    vector<int> sendOffs;
+    Scan( sendCounts, sendOffs );
+
+    // Exchange the data, converting each received entry to local coordinates
+    // ======================================================================
+    const bool compress = compressIndices &&
+      ( height_ == 0 || width_ <= limits::Max<Int>() / height_ );
+    vector<Entry<T>> recvBuf;
+    if( compress )
+    {
+        vector<Int> sendKeys(totalSend);
+        vector<T> sendValues(totalSend);
+        auto offs = sendOffs;
         for( Int k=0; k<totalSend; ++k )
         {
             const Entry<T>& entry = remoteUpdates[k];
-            const int distOwner = Owner(entry.i,entry.j);
-            const int vcOwner =
-              grid.CoordsToVC(colDist,rowDist,distOwner,redundantRoot);
-            owners[k] = grid.VCToViewing(vcOwner);
-            ++sendCounts[owners[k]];
+            const Int off = offs[owners[k]]++;
+            sendKeys[off] = entry.i + entry.j*height_;
+            sendValues[off] = entry.value;
+        }
+        remoteUpdates.clear();
+        SwapClear( owners );
+
+        auto recvKeys = mpi::AllToAll( sendKeys, sendCounts, sendOffs, comm );
+        SwapClear( sendKeys );
+        auto recvValues =
+          mpi::AllToAll( sendValues, sendCounts, sendOffs, comm );
+        SwapClear( sendValues );
+        Int recvBufSize = recvKeys.size();
+        mpi::Broadcast( recvBufSize, redundantRoot, RedundantComm() );
+        recvKeys.resize( recvBufSize );
+        recvValues.resize( recvBufSize );
+        mpi::Broadcast
+        ( recvKeys.data(), recvBufSize, redundantRoot, RedundantComm() );
+        mpi::Broadcast
+        ( recvValues.data(), recvBufSize, redundantRoot, RedundantComm() );
+
+        recvBuf.resize( recvBufSize );
+        EL_PARALLEL_FOR
+        for( Int k=0; k<recvBufSize; ++k )
+        {
+            const Int key = recvKeys[k];
+            recvBuf[k].i = LocalRow( key % height_ );
+            recvBuf[k].j = LocalCol( key / height_ );
+            recvBuf[k].value = recvValues[k];
         }
     }
     else
     {
-        if( !Participating() )
-            return;
-        comm = grid.VCComm();
-        const int vcSize = mpi::Size( grid.VCComm() );
-        sendCounts.resize(vcSize,0);
+        vector<Entry<T>> sendBuf(totalSend);
+        auto offs = sendOffs;
         for( Int k=0; k<totalSend; ++k )
+            sendBuf[offs[owners[k]]++] = remoteUpdates[k];
+        remoteUpdates.clear();
+        SwapClear( owners );
+
+        recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
+        SwapClear( sendBuf );
+        Int recvBufSize = recvBuf.size();
+        mpi::Broadcast( recvBufSize, redundantRoot, RedundantComm() );
+        recvBuf.resize( recvBufSize );
+        mpi::Broadcast
+        ( recvBuf.data(), recvBufSize, redundantRoot, RedundantComm() );
+
+        EL_PARALLEL_FOR
+        for( Int k=0; k<recvBufSize; ++k )
         {
-            const Entry<T>& entry = remoteUpdates[k];
-            const int distOwner = Owner(entry.i,entry.j);
-            owners[k] =
-              grid.CoordsToVC(colDist,rowDist,distOwner,redundantRoot);
-            ++sendCounts[owners[k]];
+            recvBuf[k].i = LocalRow( recvBuf[k].i );
+            recvBuf[k].j = LocalCol( recvBuf[k].j );
         }
     }
 
-    // Pack the data
-    // =============
-    vector<int> sendOffs;
-    Scan( sendCounts, sendOffs );
-    vector<Entry<T>> sendBuf(totalSend);
-    auto offs = sendOffs;
-    for( Int k=0; k<totalSend; ++k )
-        sendBuf[offs[owners[k]]++] = remoteUpdates[k];
-    SwapClear( remoteUpdates );
-
-    // Exchange and unpack the data
-    // ============================
-    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
-    Int recvBufSize = recvBuf.size();
-    mpi::Broadcast( recvBufSize, redundantRoot, RedundantComm() );
-    recvBuf.resize( recvBufSize );
-    mpi::Broadcast
-    ( recvBuf.data(), recvBufSize, redundantRoot, RedundantComm() );
-    // TODO: Make this loop faster
+    // Apply the updates
+    // =================
+    // Large batches are applied in parallel over contiguous blocks of local
+    // columns so that no two threads update the same entry
+    const Int numRecv = recvBuf.size();
+    if( numRecv == 0 )
+        return;
+    T* buffer = matrix_.Buffer();
+    const Int ldim = matrix_.LDim();
+#ifdef EL_HYBRID
+    const Int localWidth = LocalWidth();
+    const Int numBlocks = Min( Int(omp_get_max_threads()), localWidth );
+    if( numBlocks > 1 && numRecv >= PackingThreshold() )
+    {
+        const Int blockWidth = (localWidth+numBlocks-1) / numBlocks;
+        vector<Int> blockOffs(numBlocks+1,0);
+        for( const auto& entry : recvBuf )
+            ++blockOffs[entry.j/blockWidth+1];
+        for( Int b=0; b<numBlocks; ++b )
+            blockOffs[b+1] += blockOffs[b];
+        vector<Int> order(numRecv);
+        auto offs = blockOffs;
+        for( Int k=0; k<numRecv; ++k )
+            order[offs[recvBuf[k].j/blockWidth]++] = k;
+
+        EL_PARALLEL_FOR
+        for( Int b=0; b<numBlocks; ++b )
+        {
+            for( Int t=blockOffs[b]; t<blockOffs[b+1]; ++t )
+            {
+                const auto& entry = recvBuf[order[t]];
+                buffer[entry.i+entry.j*ldim] += entry.value;
+            }
+        }
+        return;
+    }
+#endif
     for( const auto& entry : recvBuf )
-        UpdateLocal( LocalRow(entry.i), LocalCol(entry.j), entry.value );
+        buffer[entry.i+entry.j*ldim] += entry.value;
 }
 
 template<typename T>
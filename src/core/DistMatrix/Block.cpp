@@ -198,7 +198,7 @@ void BlockMatrix<T>::Empty( bool freeMemory )
     this->rowConstrained_ = false;
     this->rootConstrained_ = false;
 
-    SwapClear( this->remoteUpdates );
+    this->ClearQueues( freeMemory );
 }
 
 template<typename T>
@@ -145,7 +145,11 @@ ElementalMatrix<T>::Align( int colAlign, int rowAlign, bool constrain )
           LogicError("Tried to realign a view");
     )
     if( requireChange )
+    {
+        if( this->Height() > 0 && this->Width() > 0 )
+            copy::RecordRealignment( "Align", *this );
         this->Empty( false );
+    }
     if( constrain )
     {
         this->colConstrained_ = true;
@@ -166,7 +170,11 @@ ElementalMatrix<T>::AlignCols( int colAlign, bool constrain )
           LogicError("Tried to realign a view");
     )
     if( this->colAlign_ != colAlign )
+    {
+        if( this->Height() > 0 && this->Width() > 0 )
+            copy::RecordRealignment( "AlignCols", *this );
         this->EmptyData( false );
+    }
     if( constrain )
         this->colConstrained_ = true;
     this->colAlign_ = colAlign;
@@ -183,7 +191,11 @@ ElementalMatrix<T>::AlignRows( int rowAlign, bool constrain )
           LogicError("Tried to realign a view");
     )
     if( this->rowAlign_ != rowAlign )
+    {
+        if( this->Height() > 0 && this->Width() > 0 )
+            copy::RecordRealignment( "AlignRows", *this );
         this->EmptyData( false );
+    }
     if( constrain )
         this->rowConstrained_ = true;
     this->rowAlign_ = rowAlign;
@@ -0,0 +1,190 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace El {
+
+template<typename Field>
+DistPackedMatrix<Field>::DistPackedMatrix( const El::Grid& grid )
+: blocksize_(El::Blocksize()), grid_(&grid)
+{ }
+
+template<typename Field>
+DistPackedMatrix<Field>::DistPackedMatrix
+( Int n, const El::Grid& grid, Int blocksize )
+: grid_(&grid)
+{
+    EL_DEBUG_CSE
+    Resize( n, blocksize );
+}
+
+template<typename Field>
+void DistPackedMatrix<Field>::SetGrid( const El::Grid& grid )
+{
+    EL_DEBUG_CSE
+    if( grid_ == &grid )
+        return;
+    grid_ = &grid;
+    Resize( 0, blocksize_ );
+}
+
+template<typename Field>
+void DistPackedMatrix<Field>::Resize( Int n, Int blocksize )
+{
+    EL_DEBUG_CSE
+    if( n < 0 || blocksize < 1 )
+        LogicError
+        ("Invalid packed matrix dimensions: n=",n,", blocksize=",blocksize);
+    height_ = n;
+    blocksize_ = blocksize;
+    const Int numBlocks = NumBlocks();
+    blocks_.resize( numBlocks );
+    const bool inGrid = grid_->InGrid();
+    const int colStride = grid_->Height();
+    const int rowStride = grid_->Width();
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const Int offset = BlockOffset(b);
+        Int localHeight=0, localWidth=0;
+        if( inGrid )
+        {
+            const int colShift =
+              Shift( grid_->MCRank(), offset % colStride, colStride );
+            const int rowShift =
+              Shift( grid_->MRRank(), offset % rowStride, rowStride );
+            localHeight = Length( n-offset, colShift, colStride );
+            localWidth = Length( BlockWidth(b), rowShift, rowStride );
+        }
+        blocks_[b].Resize( localHeight, localWidth );
+        Zero( blocks_[b] );
+    }
+}
+
+template<typename Field>
+Int DistPackedMatrix<Field>::Height() const EL_NO_EXCEPT { return height_; }
+template<typename Field>
+Int DistPackedMatrix<Field>::Width() const EL_NO_EXCEPT { return height_; }
+
+template<typename Field>
+const El::Grid& DistPackedMatrix<Field>::Grid() const EL_NO_EXCEPT
+{ return *grid_; }
+
+template<typename Field>
+Int DistPackedMatrix<Field>::Blocksize() const EL_NO_EXCEPT
+{ return blocksize_; }
+
+template<typename Field>
+Int DistPackedMatrix<Field>::NumBlocks() const EL_NO_EXCEPT
+{ return (height_+blocksize_-1) / blocksize_; }
+
+template<typename Field>
+Int DistPackedMatrix<Field>::BlockOffset( Int b ) const EL_NO_EXCEPT
+{ return b*blocksize_; }
+
+template<typename Field>
+Int DistPackedMatrix<Field>::BlockWidth( Int b ) const EL_NO_EXCEPT
+{ return Min(blocksize_,height_-b*blocksize_); }
+
+template<typename Field>
+Int DistPackedMatrix<Field>::LocalSize() const EL_NO_EXCEPT
+{
+    Int localSize = 0;
+    for( const auto& block : blocks_ )
+        localSize += block.Height()*block.Width();
+    return localSize;
+}
+
+template<typename Field>
+DistMatrix<Field> DistPackedMatrix<Field>::BlockColumn( Int b )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b < 0 || b >= NumBlocks() )
+          LogicError("Block column ",b," is out of bounds");
+    )
+    const Int offset = BlockOffset(b);
+    DistMatrix<Field> ABlock(*grid_);
+    ABlock.Attach
+    ( height_-offset, BlockWidth(b), *grid_,
+      offset % grid_->Height(), offset % grid_->Width(), blocks_[b] );
+    return ABlock;
+}
+
+template<typename Field>
+const DistMatrix<Field>
+DistPackedMatrix<Field>::LockedBlockColumn( Int b ) const
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( b < 0 || b >= NumBlocks() )
+          LogicError("Block column ",b," is out of bounds");
+    )
+    const Int offset = BlockOffset(b);
+    DistMatrix<Field> ABlock(*grid_);
+    ABlock.LockedAttach
+    ( height_-offset, BlockWidth(b), *grid_,
+      offset % grid_->Height(), offset % grid_->Width(), blocks_[b] );
+    return ABlock;
+}
+
+template<typename Field>
+void Pack( const AbstractDistMatrix<Field>& APre, DistPackedMatrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    if( APre.Height() != APre.Width() )
+        LogicError("Only square matrices can be packed");
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+
+    const Int n = A.Height();
+    B.SetGrid( A.Grid() );
+    B.Resize( n, B.Blocksize() );
+    for( Int b=0; b<B.NumBlocks(); ++b )
+    {
+        const Int offset = B.BlockOffset(b);
+        auto BBlock = B.BlockColumn(b);
+        BBlock = A( IR(offset,n), IR(offset,offset+B.BlockWidth(b)) );
+    }
+}
+
+template<typename Field>
+void Unpack( const DistPackedMatrix<Field>& A, AbstractDistMatrix<Field>& BPre )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    BPre.SetGrid( A.Grid() );
+    BPre.Resize( n, n );
+    DistMatrixWriteProxy<Field,Field,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+
+    Zero( B );
+    for( Int b=0; b<A.NumBlocks(); ++b )
+    {
+        const Int offset = A.BlockOffset(b);
+        auto BBlock = B( IR(offset,n), IR(offset,offset+A.BlockWidth(b)) );
+        BBlock = A.LockedBlockColumn(b);
+    }
+    MakeTrapezoidal( LOWER, B );
+}
+
+#define PROTO(Field) \
+  template class DistPackedMatrix<Field>; \
+  template void Pack \
+  ( const AbstractDistMatrix<Field>& A, DistPackedMatrix<Field>& B ); \
+  template void Unpack \
+  ( const DistPackedMatrix<Field>& A, AbstractDistMatrix<Field>& B );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -10,6 +10,55 @@
 #include <El-lite.h>
 using namespace El;
 
+namespace {
+
+template<typename T>
+void QueueUpdates
+( DistSparseMatrix<T>& A, Int numUpdates,
+  const Int* rows, const Int* cols, const T* values, bool passive )
+{
+    // Reserve exactly the local and remote space which will be queued
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    Int numLocalUpdates = 0;
+    for( Int e=0; e<numUpdates; ++e )
+        if( rows[e] >= firstLocalRow && rows[e] < firstLocalRow+localHeight )
+            ++numLocalUpdates;
+    const Int numRemoteUpdates =
+      ( passive ? 0 : numUpdates-numLocalUpdates );
+    A.Reserve( numLocalUpdates, numRemoteUpdates );
+    for( Int e=0; e<numUpdates; ++e )
+        A.QueueUpdate( rows[e], cols[e], values[e], passive );
+}
+
+template<typename T>
+void QueueLocalUpdates
+( DistSparseMatrix<T>& A, Int numUpdates,
+  const Int* localRows, const Int* cols, const T* values )
+{
+    A.Reserve( numUpdates );
+    for( Int e=0; e<numUpdates; ++e )
+        A.QueueLocalUpdate( localRows[e], cols[e], values[e] );
+}
+
+template<typename T>
+void SetLocalCompressedRows
+( DistSparseMatrix<T>& A, Int height, Int width,
+  const Int* localOffsets, const Int* cols, const T* values )
+{
+    // Determine our number of rows from the new dimensions
+    A.Resize( height, width );
+    const Int localHeight = A.LocalHeight();
+    const Int numLocalEntries = localOffsets[localHeight];
+    A.AdoptLocalCompressedRows
+    ( height, width,
+      vector<Int>( localOffsets, localOffsets+localHeight+1 ),
+      vector<Int>( cols, cols+numLocalEntries ),
+      vector<T>( values, values+numLocalEntries ) );
+}
+
+} // anonymous namespace
+
 extern "C" {
 
 #define C_PROTO(SIG,SIGBASE,T) \
@@ -31,6 +80,14 @@ extern "C" {
   ( ElDistSparseMatrix_ ## SIG A, \
     ElInt numLocalEntries, ElInt numRemoteEntries ) \
   { EL_TRY( CReflect(A)->Reserve(numLocalEntries,numRemoteEntries) ) } \
+  ElError ElDistSparseMatrixSetLocalCompressedRows_ ## SIG \
+  ( ElDistSparseMatrix_ ## SIG A, ElInt height, ElInt width, \
+    const ElInt* localOffsets, const ElInt* cols, \
+    const CREFLECT(T)* values ) \
+  { EL_TRY( \
+      SetLocalCompressedRows \
+      ( *CReflect(A), height, width, localOffsets, cols, \
+        EL_RC(const T*,values) ) ) } \
   ElError ElDistSparseMatrixUpdate_ ## SIG \
   ( ElDistSparseMatrix_ ## SIG A, \
     ElInt row, ElInt col, CREFLECT(T) value ) \
@@ -53,6 +110,21 @@ extern "C" {
   ( ElDistSparseMatrix_ ## SIG A, \
     ElInt localRow, ElInt col, CREFLECT(T) value ) \
   { EL_TRY( CReflect(A)->QueueLocalUpdate(localRow,col,CReflect(value)) ) } \
+  ElError ElDistSparseMatrixQueueUpdates_ ## SIG \
+  ( ElDistSparseMatrix_ ## SIG A, ElInt numUpdates, \
+    const ElInt* rows, const ElInt* cols, const CREFLECT(T)* values, \
+    bool passive ) \
+  { EL_TRY( \
+      QueueUpdates \
+      ( *CReflect(A), numUpdates, rows, cols, EL_RC(const T*,values), \
+        passive ) ) } \
+  ElError ElDistSparseMatrixQueueLocalUpdates_ ## SIG \
+  ( ElDistSparseMatrix_ ## SIG A, ElInt numUpdates, \
+    const ElInt* localRows, const ElInt* cols, const CREFLECT(T)* values ) \
+  { EL_TRY( \
+      QueueLocalUpdates \
+      ( *CReflect(A), numUpdates, localRows, cols, \
+        EL_RC(const T*,values) ) ) } \
   ElError ElDistSparseMatrixQueueZero_ ## SIG \
   ( ElDistSparseMatrix_ ## SIG A, ElInt row, ElInt col, bool passive ) \
   { EL_TRY( CReflect(A)->QueueZero(row,col,passive) ) } \
@@ -159,6 +159,57 @@ void Graph::Resize( Int numSources, Int numTargets )
 
 // Assembly
 // --------
+void AssertCompressedRows
+( Int numSources, Int numTargets,
+  const vector<Int>& offsets, const vector<Int>& targets )
+{
+    EL_DEBUG_CSE
+    if( Int(offsets.size()) != numSources+1 )
+        LogicError
+        ("Expected ",numSources+1," row offsets but received ",offsets.size());
+    if( offsets[0] != 0 )
+        LogicError("The first row offset was ",offsets[0]," rather than 0");
+    if( offsets[numSources] != Int(targets.size()) )
+        LogicError
+        ("The last row offset was ",offsets[numSources]," but there were ",
+         targets.size()," column indices");
+    for( Int i=0; i<numSources; ++i )
+    {
+        if( offsets[i+1] < offsets[i] )
+            LogicError("The offsets of row ",i," were decreasing");
+        Int prevTarget = -1;
+        for( Int e=offsets[i]; e<offsets[i+1]; ++e )
+        {
+            const Int target = targets[e];
+            if( target <= prevTarget || target >= numTargets )
+                LogicError
+                ("Column ",target," of row ",i," was out of bounds, "
+                 "unsorted, or repeated");
+            prevTarget = target;
+        }
+    }
+}
+
+void Graph::AdoptCompressedRows
+( Int numSources, Int numTargets,
+  vector<Int>&& offsets, vector<Int>&& targets )
+{
+    EL_DEBUG_CSE
+    AssertCompressedRows( numSources, numTargets, offsets, targets );
+    numSources_ = numSources;
+    numTargets_ = numTargets;
+    frozenSparsity_ = false;
+    markedForRemoval_.clear();
+    sourceOffsets_ = std::move( offsets );
+    targets_ = std::move( targets );
+    sources_.resize( targets_.size() );
+    EL_PARALLEL_FOR
+    for( Int i=0; i<numSources; ++i )
+        for( Int e=sourceOffsets_[i]; e<sourceOffsets_[i+1]; ++e )
+            sources_[e] = i;
+    consistent_ = true;
+}
+
 void Graph::Reserve( Int numEdges )
 {
     const Int currSize = sources_.size();
@@ -72,6 +72,32 @@ int Grid::DefaultHeight( int gridSize ) EL_NO_EXCEPT
     return gridHeight;
 }
 
+int Grid::NodeAwareHeight( mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int gridSize = mpi::Size( comm );
+    mpi::Comm nodeComm;
+    mpi::SplitShared( comm, mpi::Rank(comm), nodeComm );
+    const int nodeSize = mpi::Size( nodeComm );
+    mpi::Free( nodeComm );
+
+    // Fall back to the default shape for non-uniformly populated nodes
+    const int minNodeSize = mpi::AllReduce( nodeSize, mpi::MIN, comm );
+    const int maxNodeSize = mpi::AllReduce( nodeSize, mpi::MAX, comm );
+    if( minNodeSize != maxNodeSize || nodeSize == 1 )
+        return DefaultHeight( gridSize );
+
+    // Choose the divisor of gcd(gridSize,nodeSize) closest to sqrt(gridSize)
+    const int gcd = El::GCD( gridSize, nodeSize );
+    const double sqrtSize = sqrt(double(gridSize));
+    int gridHeight = 1;
+    for( int height=1; height<=gcd; ++height )
+        if( gcd % height == 0 &&
+            Abs(height-sqrtSize) < Abs(gridHeight-sqrtSize) )
+            gridHeight = height;
+    return gridHeight;
+}
+
 Grid::Grid( mpi::Comm comm, GridOrder order )
 : haveViewers_(false), order_(order)
 {
@@ -202,6 +228,14 @@ void Grid::SetUpGrid()
         mpi::Split( cartComm_, mdPerpRank_, mdRank_,     mdComm_     );
         mpi::Split( cartComm_, mdRank_,     mdPerpRank_, mdPerpComm_ );
 
+        // Label the communicators for the collective profiler
+        mpi::SetName( mcComm_,     "MC"     );
+        mpi::SetName( mrComm_,     "MR"     );
+        mpi::SetName( vcComm_,     "VC"     );
+        mpi::SetName( vrComm_,     "VR"     );
+        mpi::SetName( mdComm_,     "MD"     );
+        mpi::SetName( mdPerpComm_, "MDPerp" );
+
         EL_DEBUG_ONLY(
           mpi::ErrorHandlerSet( mcComm_,     mpi::ERRORS_RETURN );
           mpi::ErrorHandlerSet( mrComm_,     mpi::ERRORS_RETURN );
@@ -248,6 +282,10 @@ Grid::~Grid()
 {
     if( !mpi::Finalized() )
     {
+        for( auto& layers : layers_ )
+            if( layers->depthComm != mpi::COMM_NULL )
+                mpi::Free( layers->depthComm );
+        layers_.clear();
 #ifdef EL_HAVE_SCALAPACK
         blacs::FreeGrid( blacsMCMRContext_ );
         blacs::FreeHandle( blacsVRHandle_ );
@@ -255,6 +293,10 @@ Grid::~Grid()
 #endif
         if( InGrid() )
         {
+            mcNodeAware_.reset();
+            mrNodeAware_.reset();
+            vcNodeAware_.reset();
+            vrNodeAware_.reset();
             mpi::Free( mdComm_ );
             mpi::Free( mdPerpComm_ );
             mpi::Free( mcComm_ );
@@ -292,6 +334,67 @@ mpi::Comm Grid::MDPerpComm() const EL_NO_EXCEPT { return mdPerpComm_; }
 mpi::Comm Grid::VCComm()     const EL_NO_EXCEPT { return vcComm_;     }
 mpi::Comm Grid::VRComm()     const EL_NO_EXCEPT { return vrComm_;     }
 
+// Node topology
+// =============
+NodeAwareComm& Grid::LazyNodeAware
+( unique_ptr<NodeAwareComm>& nodeAware, mpi::Comm comm ) const
+{
+    if( !nodeAware )
+        nodeAware.reset( new NodeAwareComm(comm) );
+    return *nodeAware;
+}
+
+mpi::Comm Grid::NodeComm() const
+{
+    return ( InGrid() ? LazyNodeAware(vcNodeAware_,vcComm_).LocalComm()
+                      : mpi::COMM_NULL );
+}
+
+int Grid::NodeRank() const
+{
+    return ( InGrid() ? LazyNodeAware(vcNodeAware_,vcComm_).LocalRank()
+                      : mpi::UNDEFINED );
+}
+
+int Grid::NodeSize() const
+{
+    return ( InGrid() ? LazyNodeAware(vcNodeAware_,vcComm_).LocalSize()
+                      : mpi::UNDEFINED );
+}
+
+int Grid::NumNodes() const
+{
+    return ( InGrid() ? LazyNodeAware(vcNodeAware_,vcComm_).NumNodes()
+                      : mpi::UNDEFINED );
+}
+
+int Grid::Node( int vcRank ) const
+{
+    return ( InGrid() ? LazyNodeAware(vcNodeAware_,vcComm_).Node(vcRank)
+                      : mpi::UNDEFINED );
+}
+
+bool Grid::MCOnNode() const
+{ return InGrid() && LazyNodeAware(mcNodeAware_,mcComm_).OnOneNode(); }
+
+bool Grid::MROnNode() const
+{ return InGrid() && LazyNodeAware(mrNodeAware_,mrComm_).OnOneNode(); }
+
+NodeAwareComm* Grid::NodeAware( mpi::Comm comm ) const
+{
+    if( !InGrid() )
+        return nullptr;
+    if( comm == mcComm_ )
+        return &LazyNodeAware( mcNodeAware_, mcComm_ );
+    if( comm == mrComm_ )
+        return &LazyNodeAware( mrNodeAware_, mrComm_ );
+    if( comm == vcComm_ )
+        return &LazyNodeAware( vcNodeAware_, vcComm_ );
+    if( comm == vrComm_ )
+        return &LazyNodeAware( vrNodeAware_, vrComm_ );
+    return nullptr;
+}
+
 // Provided for simplicity, but redundant
 // ======================================
 int Grid::Height() const EL_NO_EXCEPT { return MCSize(); }
@@ -332,6 +435,85 @@ Grid::Grid( mpi::Comm viewers, mpi::Group owners, int height, GridOrder order )
     SetUpGrid();
 }
 
+int Grid::LayerHeight( int numLayers ) const
+{
+    EL_DEBUG_CSE
+    if( numLayers < 1 || size_ % numLayers != 0 )
+        LogicError
+        ("The number of layers, ",numLayers,", must evenly divide the grid "
+         "size, ",size_);
+    const int width = size_ / height_;
+    if( width % numLayers == 0 )
+        return height_;
+    else
+        return DefaultHeight( size_/numLayers );
+}
+
+auto Grid::GetLayers( int numLayers ) const -> const Layers&
+{
+    EL_DEBUG_CSE
+    for( const auto& layers : layers_ )
+        if( layers->numLayers == numLayers )
+            return *layers;
+
+    const int layerHeight = LayerHeight( numLayers );
+    const int layerSize = size_ / numLayers;
+    unique_ptr<Layers> layers( new Layers );
+    layers->numLayers = numLayers;
+    layers->grids.resize( numLayers );
+    vector<int> viewingRanks( layerSize );
+    for( int layer=0; layer<numLayers; ++layer )
+    {
+        for( int j=0; j<layerSize; ++j )
+            viewingRanks[j] = vcToViewing_[layer*layerSize+j];
+        mpi::Group layerGroup;
+        mpi::Incl( viewingGroup_, layerSize, viewingRanks.data(), layerGroup );
+        layers->grids[layer].reset
+        ( new El::Grid( viewingComm_, layerGroup, layerHeight, order_ ) );
+        mpi::Free( layerGroup );
+    }
+    if( InGrid() )
+    {
+        mpi::Split
+        ( vcComm_, vcRank_ % layerSize, vcRank_ / layerSize,
+          layers->depthComm );
+        mpi::SetName( layers->depthComm, "Depth" );
+    }
+    else
+        layers->depthComm = mpi::COMM_NULL;
+
+    layers_.emplace_back( std::move(layers) );
+    return *layers_.back();
+}
+
+const Grid& Grid::LayerGrid( int numLayers, int layer ) const
+{
+    EL_DEBUG_CSE
+    if( layer < 0 || layer >= numLayers )
+        LogicError("Invalid layer index ",layer," of ",numLayers);
+    return *GetLayers( numLayers ).grids[layer];
+}
+
+int Grid::Layer( int numLayers ) const
+{
+    EL_DEBUG_CSE
+    if( numLayers < 1 || size_ % numLayers != 0 )
+        LogicError
+        ("The number of layers, ",numLayers,", must evenly divide the grid "
+         "size, ",size_);
+    const int layerSize = size_ / numLayers;
+    if( InGrid() )
+        return vcRank_ / layerSize;
+    else
+        return mpi::UNDEFINED;
+}
+
+mpi::Comm Grid::DepthComm( int numLayers ) const
+{
+    EL_DEBUG_CSE
+    return GetLayers( numLayers ).depthComm;
+}
+
 int Grid::GCD() const EL_NO_EXCEPT { return gcd_; }
 int Grid::LCM() const EL_NO_EXCEPT { return size_/gcd_; }
 
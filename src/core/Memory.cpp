@@ -0,0 +1,317 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <mutex>
+
+#ifdef EL_HAVE_MMAP
+# include <sys/mman.h>
+# include <unistd.h>
+# ifdef __linux__
+#  include <sys/syscall.h>
+# endif
+#endif
+
+namespace {
+
+using std::size_t;
+
+// Size class 'k' holds buffers of exactly 2^k bytes
+const size_t NUM_SIZE_CLASSES = 8*sizeof(size_t);
+
+struct Pool
+{
+    std::mutex mutex;
+    // Read without the mutex so that allocations bypass it while disabled
+    std::atomic<bool> enabled{false};
+    size_t capacity=size_t(1) << 30;
+    El::vector<void*> freeLists[NUM_SIZE_CLASSES];
+    El::MemoryPoolStatistics stats;
+};
+
+// The pool is intentionally never destroyed so that Memory instances with
+// static storage duration may safely release their buffers at exit
+Pool& ThePool()
+{
+    static Pool* pool = new Pool;
+    return *pool;
+}
+
+size_t SizeClass( size_t numBytes )
+{
+    size_t sizeClass = 0;
+    while( (size_t(1) << sizeClass) < numBytes )
+        ++sizeClass;
+    return sizeClass;
+}
+
+// Assumes that the pool's mutex is held
+void TrimLocked( Pool& pool, size_t numBytes )
+{
+    for( size_t k=NUM_SIZE_CLASSES; k>0 && pool.stats.numCachedBytes>numBytes;
+         --k )
+    {
+        auto& freeList = pool.freeLists[k-1];
+        const size_t classBytes = size_t(1) << (k-1);
+        while( !freeList.empty() && pool.stats.numCachedBytes > numBytes )
+        {
+            ::operator delete( freeList.back() );
+            freeList.pop_back();
+            pool.stats.numCachedBytes -= classBytes;
+        }
+    }
+}
+
+El::MemoryPolicy& TheDefaultMemoryPolicy()
+{
+    static El::MemoryPolicy policy;
+    return policy;
+}
+
+#ifdef EL_HAVE_MMAP
+size_t RoundUp( size_t numBytes, size_t pageSize )
+{ return ((numBytes+pageSize-1)/pageSize)*pageSize; }
+
+// Bind the pages of [ptr,ptr+numBytes) round-robin across all NUMA domains
+// (which is a no-op on systems with a single domain)
+void Interleave( void* ptr, size_t numBytes )
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    // The largest node index is the last entry of a list such as "0-3"
+    static const size_t numNodes = []() -> size_t
+    {
+        std::ifstream file( "/sys/devices/system/node/possible" );
+        El::string list;
+        if( !(file >> list) )
+            return 1;
+        const size_t pos = list.find_last_of( ",-" );
+        const El::string last =
+          pos == El::string::npos ? list : list.substr( pos+1 );
+        return std::stoul( last ) + 1;
+    }();
+    if( numNodes <= 1 )
+        return;
+    const size_t bitsPerWord = 8*sizeof(unsigned long);
+    El::vector<unsigned long> nodeMask( (numNodes+bitsPerWord-1)/bitsPerWord );
+    for( size_t node=0; node<numNodes; ++node )
+        nodeMask[node/bitsPerWord] |= 1UL << (node % bitsPerWord);
+    const int MPOL_INTERLEAVE_MODE = 3;
+    // The kernel ignores the last bit of the mask ('maxnode' is decremented)
+    syscall
+    ( SYS_mbind, ptr, numBytes, MPOL_INTERLEAVE_MODE, nodeMask.data(),
+      numNodes+1, 0 );
+#endif
+}
+
+// Touch each page from the thread which owns it within a static partition
+void FirstTouch( void* ptr, size_t numBytes, size_t pageSize )
+{
+#ifdef EL_HYBRID
+    char* bytes = static_cast<char*>( ptr );
+    const long long numPages = numBytes / pageSize;
+    #pragma omp parallel for schedule(static)
+    for( long long page=0; page<numPages; ++page )
+        bytes[page*pageSize] = 0;
+#endif
+}
+#endif // ifdef EL_HAVE_MMAP
+
+} // anonymous namespace
+
+namespace El {
+
+void SetDefaultMemoryPolicy( const MemoryPolicy& policy )
+{ TheDefaultMemoryPolicy() = policy; }
+
+const MemoryPolicy& DefaultMemoryPolicy() EL_NO_EXCEPT
+{ return TheDefaultMemoryPolicy(); }
+
+void EnableMemoryPool( bool enable )
+{
+    auto& pool = ThePool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    pool.enabled = enable;
+    if( !enable )
+        TrimLocked( pool, 0 );
+}
+
+bool MemoryPoolEnabled() { return ThePool().enabled; }
+
+void SetMemoryPoolCapacity( size_t numBytes )
+{
+    auto& pool = ThePool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    pool.capacity = numBytes;
+    TrimLocked( pool, numBytes );
+}
+
+size_t MemoryPoolCapacity()
+{
+    auto& pool = ThePool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    return pool.capacity;
+}
+
+void TrimMemoryPool( size_t numBytes )
+{
+    auto& pool = ThePool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    TrimLocked( pool, numBytes );
+}
+
+MemoryPoolStatistics MemoryPoolStats()
+{
+    auto& pool = ThePool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    return pool.stats;
+}
+
+void ResetMemoryPoolStats()
+{
+    auto& pool = ThePool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    const size_t numCachedBytes = pool.stats.numCachedBytes;
+    pool.stats = MemoryPoolStatistics();
+    pool.stats.numCachedBytes = numCachedBytes;
+    pool.stats.peakCachedBytes = numCachedBytes;
+}
+
+namespace memory_pool {
+
+void* Allocate( size_t numBytes, bool& pooled )
+{
+    pooled = false;
+    auto& pool = ThePool();
+    if( numBytes < MIN_POOLED_BYTES || !pool.enabled )
+        return ::operator new( numBytes );
+
+    const size_t sizeClass = SizeClass( numBytes );
+    {
+        std::lock_guard<std::mutex> guard( pool.mutex );
+        auto& freeList = pool.freeLists[sizeClass];
+        if( !freeList.empty() )
+        {
+            void* ptr = freeList.back();
+            freeList.pop_back();
+            pool.stats.numCachedBytes -= size_t(1) << sizeClass;
+            ++pool.stats.numHits;
+            pooled = true;
+            return ptr;
+        }
+        ++pool.stats.numMisses;
+    }
+    // Round up to the size class so that the buffer may be cached upon its
+    // release
+    void* ptr = ::operator new( size_t(1) << sizeClass );
+    pooled = true;
+    return ptr;
+}
+
+void Free( void* ptr, size_t numBytes, bool pooled ) EL_NO_EXCEPT
+{
+    if( ptr == nullptr )
+        return;
+    if( !pooled )
+    {
+        ::operator delete( ptr );
+        return;
+    }
+
+    const size_t sizeClass = SizeClass( numBytes );
+    const size_t classBytes = size_t(1) << sizeClass;
+    auto& pool = ThePool();
+    std::lock_guard<std::mutex> guard( pool.mutex );
+    if( !pool.enabled ||
+        pool.stats.numCachedBytes+classBytes > pool.capacity )
+    {
+        ++pool.stats.numDiscards;
+        ::operator delete( ptr );
+        return;
+    }
+    try
+    {
+        pool.freeLists[sizeClass].push_back( ptr );
+    }
+    catch( std::bad_alloc& )
+    {
+        ++pool.stats.numDiscards;
+        ::operator delete( ptr );
+        return;
+    }
+    ++pool.stats.numReturns;
+    pool.stats.numCachedBytes += classBytes;
+    pool.stats.peakCachedBytes =
+      std::max( pool.stats.peakCachedBytes, pool.stats.numCachedBytes );
+}
+
+} // namespace memory_pool
+
+namespace memory_policy {
+
+void* Allocate
+( size_t numBytes, const MemoryPolicy& policy, size_t& mappedBytes )
+{
+    mappedBytes = 0;
+#ifdef EL_HAVE_MMAP
+    const size_t pageSize = sysconf( _SC_PAGESIZE );
+    const int prot = PROT_READ | PROT_WRITE;
+    const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    void* ptr = MAP_FAILED;
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+    if( policy.hugePages == HUGE_PAGES_2MB ||
+        policy.hugePages == HUGE_PAGES_1GB )
+    {
+        const int logHugeSize = policy.hugePages == HUGE_PAGES_2MB ? 21 : 30;
+        const size_t hugeBytes = RoundUp( numBytes, size_t(1) << logHugeSize );
+        ptr = mmap
+          ( nullptr, hugeBytes, prot,
+            flags | MAP_HUGETLB | (logHugeSize << MAP_HUGE_SHIFT), -1, 0 );
+        if( ptr != MAP_FAILED )
+            mappedBytes = hugeBytes;
+    }
+#endif
+    // Fall back to ordinary pages if no huge pages were reserved
+    if( ptr == MAP_FAILED )
+    {
+        const size_t pageBytes = RoundUp( numBytes, pageSize );
+        ptr = mmap( nullptr, pageBytes, prot, flags, -1, 0 );
+        if( ptr == MAP_FAILED )
+            return nullptr;
+        mappedBytes = pageBytes;
+#ifdef MADV_HUGEPAGE
+        if( policy.hugePages != HUGE_PAGES_NONE )
+            madvise( ptr, mappedBytes, MADV_HUGEPAGE );
+#endif
+    }
+
+    // The placement must be decided before the pages are first touched
+    if( policy.numa == NUMA_INTERLEAVED )
+        Interleave( ptr, mappedBytes );
+    else if( policy.numa == NUMA_FIRST_TOUCH )
+        FirstTouch( ptr, mappedBytes, pageSize );
+    return ptr;
+#else
+    return nullptr;
+#endif
+}
+
+void Free( void* ptr, size_t mappedBytes ) EL_NO_EXCEPT
+{
+#ifdef EL_HAVE_MMAP
+    if( ptr != nullptr )
+        munmap( ptr, mappedBytes );
+#endif
+}
+
+} // namespace memory_policy
+
+} // namespace El
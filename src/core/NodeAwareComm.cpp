@@ -0,0 +1,177 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace {
+
+bool nodeAwareCollectives = false;
+
+} // anonymous namespace
+
+namespace El {
+
+void EnableNodeAwareCollectives( bool enable )
+{ nodeAwareCollectives = enable; }
+
+bool NodeAwareCollectivesEnabled() { return nodeAwareCollectives; }
+
+NodeAwareComm::NodeAwareComm( mpi::Comm comm )
+: comm_(comm)
+{
+    EL_DEBUG_CSE
+    size_ = mpi::Size( comm );
+    const int rank = mpi::Rank( comm );
+
+    // Order the processes on each node by their rank in the original comm
+    mpi::SplitShared( comm, rank, localComm_ );
+    localRank_ = mpi::Rank( localComm_ );
+    localSize_ = mpi::Size( localComm_ );
+    mpi::Split
+    ( comm, (localRank_==0 ? 0 : mpi::UNDEFINED), rank, leaderComm_ );
+    const string name = mpi::GetName( comm );
+    if( !name.empty() )
+    {
+        mpi::SetName( localComm_, name+"-node" );
+        if( localRank_ == 0 )
+            mpi::SetName( leaderComm_, name+"-leaders" );
+    }
+
+    // Index the nodes by the rank of their leader
+    int node=0;
+    numNodes_ = 0;
+    if( localRank_ == 0 )
+    {
+        node = mpi::Rank( leaderComm_ );
+        numNodes_ = mpi::Size( leaderComm_ );
+    }
+    mpi::Broadcast( node, 0, localComm_ );
+    mpi::Broadcast( numNodes_, 0, localComm_ );
+    nodeOfRank_.resize( size_ );
+    mpi::AllGather( &node, 1, nodeOfRank_.data(), 1, comm );
+
+    nodeSizes_.assign( numNodes_, 0 );
+    for( int q=0; q<size_; ++q )
+        ++nodeSizes_[nodeOfRank_[q]];
+    Scan( nodeSizes_, nodeOffs_ );
+    maxLocalSize_ = 0;
+    for( int n=0; n<numNodes_; ++n )
+        maxLocalSize_ = Max( maxLocalSize_, nodeSizes_[n] );
+
+    // Since each node comm is ordered by the original rank, the position of a
+    // process within its node is the number of lower ranks on the same node
+    slotOfRank_.resize( size_ );
+    auto offs = nodeOffs_;
+    for( int q=0; q<size_; ++q )
+        slotOfRank_[q] = offs[nodeOfRank_[q]]++;
+}
+
+NodeAwareComm::~NodeAwareComm()
+{
+    if( !mpi::Finalized() )
+    {
+        if( segment_ != nullptr )
+            mpi::Free( window_ );
+        if( leaderComm_ != mpi::COMM_NULL )
+            mpi::Free( leaderComm_ );
+        mpi::Free( localComm_ );
+    }
+}
+
+bool NodeAwareComm::SharedCollectives() const EL_NO_EXCEPT
+{
+    return mpi::HaveSharedMemory() && nodeAwareCollectives &&
+           maxLocalSize_ > 1;
+}
+
+byte* NodeAwareComm::Reserve( size_t numBytes )
+{
+    EL_DEBUG_CSE
+    // Every process on the node requests the same size, so they agree on
+    // whether the (collective) reallocation is necessary
+    if( numBytes > segmentBytes_ )
+    {
+        if( segment_ != nullptr )
+            mpi::Free( window_ );
+        const size_t newBytes = Max( numBytes, 2*segmentBytes_ );
+        mpi::AllocateShared
+        ( (localRank_==0 ? newBytes : 0), localComm_, window_ );
+        segment_ = static_cast<byte*>( mpi::SharedQuery( window_, 0 ) );
+        segmentBytes_ = newBytes;
+    }
+    return segment_;
+}
+
+void NodeAwareComm::AllGather
+( const void* sendBuf, size_t numBytes, void* recvBuf )
+{
+    EL_DEBUG_CSE
+    const size_t totalBytes = size_*numBytes;
+    if( !SharedCollectives() ||
+        totalBytes > size_t(std::numeric_limits<int>::max()) )
+    {
+        mpi::AllGather
+        ( static_cast<const byte*>(sendBuf), int(numBytes),
+          static_cast<byte*>(recvBuf), int(numBytes), comm_ );
+        return;
+    }
+
+    if( OnOneNode() )
+    {
+        // Alternate between the two halves of the segment so that a process
+        // starting the next gather cannot overwrite data which is still being
+        // read (the halves are fixed, as the gathers may vary in size)
+        byte* segment = Reserve( 2*totalBytes );
+        byte* stage = &segment[parity_*(segmentBytes_/2)];
+        parity_ = 1-parity_;
+        MemCopy
+        ( &stage[localRank_*numBytes], static_cast<const byte*>(sendBuf),
+          numBytes );
+        mpi::WindowSync( window_ );
+        mpi::Barrier( localComm_ );
+        mpi::WindowSync( window_ );
+        MemCopy( static_cast<byte*>(recvBuf), stage, totalBytes );
+        return;
+    }
+
+    // Stage the contributions from our node in the first half of the
+    // segment, and then have the leaders exchange the node-major result over
+    // the network into the second half
+    const size_t localBytes = localSize_*numBytes;
+    byte* stage = Reserve( 2*totalBytes );
+    byte* result = &stage[segmentBytes_/2];
+    MemCopy
+    ( &stage[localRank_*numBytes], static_cast<const byte*>(sendBuf),
+      numBytes );
+    mpi::WindowSync( window_ );
+    mpi::Barrier( localComm_ );
+    mpi::WindowSync( window_ );
+    if( localRank_ == 0 )
+    {
+        vector<int> recvCounts(numNodes_), recvOffs(numNodes_);
+        for( int n=0; n<numNodes_; ++n )
+        {
+            recvCounts[n] = nodeSizes_[n]*numBytes;
+            recvOffs[n] = nodeOffs_[n]*numBytes;
+        }
+        mpi::AllGather
+        ( stage, int(localBytes),
+          result, recvCounts.data(), recvOffs.data(), leaderComm_ );
+    }
+    mpi::WindowSync( window_ );
+    mpi::Barrier( localComm_ );
+    mpi::WindowSync( window_ );
+
+    // Unpack from node-major into rank order
+    byte* recvBytes = static_cast<byte*>(recvBuf);
+    for( int q=0; q<size_; ++q )
+        MemCopy
+        ( &recvBytes[q*numBytes], &result[slotOfRank_[q]*numBytes], numBytes );
+}
+
+} // namespace El
@@ -10,6 +10,33 @@
 #include <El-lite.h>
 using namespace El;
 
+namespace {
+
+template<typename T>
+void QueueUpdates
+( SparseMatrix<T>& A, Int numUpdates,
+  const Int* rows, const Int* cols, const T* values )
+{
+    A.Reserve( numUpdates );
+    for( Int e=0; e<numUpdates; ++e )
+        A.QueueUpdate( rows[e], cols[e], values[e] );
+}
+
+template<typename T>
+void SetCompressedRows
+( SparseMatrix<T>& A, Int height, Int width,
+  const Int* offsets, const Int* cols, const T* values )
+{
+    const Int numEntries = offsets[height];
+    A.AdoptCompressedRows
+    ( height, width,
+      vector<Int>( offsets, offsets+height+1 ),
+      vector<Int>( cols, cols+numEntries ),
+      vector<T>( values, values+numEntries ) );
+}
+
+} // anonymous namespace
+
 extern "C" {
 
 #define C_PROTO(SIG,SIGBASE,T) \
@@ -25,6 +52,13 @@ extern "C" {
   ElError ElSparseMatrixReserve_ ## SIG \
   ( ElSparseMatrix_ ## SIG A, ElInt numEntries ) \
   { EL_TRY( CReflect(A)->Reserve(numEntries) ) } \
+  ElError ElSparseMatrixSetCompressedRows_ ## SIG \
+  ( ElSparseMatrix_ ## SIG A, ElInt height, ElInt width, \
+    const ElInt* offsets, const ElInt* cols, const CREFLECT(T)* values ) \
+  { EL_TRY( \
+      SetCompressedRows \
+      ( *CReflect(A), height, width, offsets, cols, \
+        EL_RC(const T*,values) ) ) } \
   ElError ElSparseMatrixUpdate_ ## SIG \
   ( ElSparseMatrix_ ## SIG A, ElInt row, ElInt col, CREFLECT(T) value ) \
   { EL_TRY( CReflect(A)->Update(row,col,CReflect(value)) ) } \
@@ -34,6 +68,12 @@ extern "C" {
   ElError ElSparseMatrixQueueUpdate_ ## SIG \
   ( ElSparseMatrix_ ## SIG A, ElInt row, ElInt col, CREFLECT(T) value ) \
   { EL_TRY( CReflect(A)->QueueUpdate(row,col,CReflect(value)) ) } \
+  ElError ElSparseMatrixQueueUpdates_ ## SIG \
+  ( ElSparseMatrix_ ## SIG A, ElInt numUpdates, \
+    const ElInt* rows, const ElInt* cols, const CREFLECT(T)* values ) \
+  { EL_TRY( \
+      QueueUpdates \
+      ( *CReflect(A), numUpdates, rows, cols, EL_RC(const T*,values) ) ) } \
   ElError ElSparseMatrixQueueZero_ ## SIG \
   ( ElSparseMatrix_ ## SIG A, ElInt row, ElInt col ) \
   { EL_TRY( CReflect(A)->QueueZero(row,col) ) } \
@@ -95,7 +135,13 @@ extern "C" {
   { EL_TRY( *valueBuffer = CReflect(CReflect(A)->ValueBuffer()) ) } \
   ElError ElSparseMatrixLockedValueBuffer_ ## SIG \
   ( ElConstSparseMatrix_ ## SIG A, const CREFLECT(T)** valueBuffer ) \
-  { EL_TRY( *valueBuffer = CReflect(CReflect(A)->LockedValueBuffer()) ) }
+  { EL_TRY( *valueBuffer = CReflect(CReflect(A)->LockedValueBuffer()) ) } \
+  ElError ElSparseMatrixOffsetBuffer_ ## SIG \
+  ( ElSparseMatrix_ ## SIG A, ElInt** offsetBuffer ) \
+  { EL_TRY( *offsetBuffer = CReflect(A)->OffsetBuffer() ) } \
+  ElError ElSparseMatrixLockedOffsetBuffer_ ## SIG \
+  ( ElConstSparseMatrix_ ## SIG A, const ElInt** offsetBuffer ) \
+  { EL_TRY( *offsetBuffer = CReflect(A)->LockedOffsetBuffer() ) }
 
 #include <El/macros/CInstantiate.h>
 
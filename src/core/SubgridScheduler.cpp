@@ -0,0 +1,156 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace El {
+
+SubgridScheduler::SubgridScheduler( const El::Grid& grid, int numSubgrids )
+: grid_(&grid)
+{
+    EL_DEBUG_CSE
+    const int p = grid.Size();
+    if( numSubgrids < 1 || numSubgrids > p )
+        LogicError
+        ("Cannot split a grid of ",p," processes into ",numSubgrids,
+         " subgrids");
+
+    mpi::Group viewingGroup;
+    mpi::CommGroup( grid.ViewingComm(), viewingGroup );
+    subgrids_.resize( numSubgrids );
+    mySubgrid_ = mpi::UNDEFINED;
+    const int vcRank = ( grid.InGrid() ? grid.VCRank() : -1 );
+    for( int s=0; s<numSubgrids; ++s )
+    {
+        const int firstRank = (s*p) / numSubgrids;
+        const int subgridSize = ((s+1)*p) / numSubgrids - firstRank;
+        if( vcRank >= firstRank && vcRank < firstRank+subgridSize )
+            mySubgrid_ = s;
+
+        vector<int> viewingRanks(subgridSize);
+        for( int j=0; j<subgridSize; ++j )
+            viewingRanks[j] = grid.VCToViewing( firstRank+j );
+        mpi::Group subgridGroup;
+        mpi::Incl
+        ( viewingGroup, subgridSize, viewingRanks.data(), subgridGroup );
+        subgrids_[s].reset
+        ( new El::Grid
+          ( grid.ViewingComm(), subgridGroup,
+            El::Grid::DefaultHeight(subgridSize), grid.Order() ) );
+        mpi::Free( subgridGroup );
+    }
+    mpi::Free( viewingGroup );
+}
+
+const El::Grid& SubgridScheduler::Grid() const EL_NO_EXCEPT
+{ return *grid_; }
+
+int SubgridScheduler::NumSubgrids() const EL_NO_EXCEPT
+{ return subgrids_.size(); }
+
+const El::Grid& SubgridScheduler::Subgrid( int subgrid ) const
+{
+    EL_DEBUG_CSE
+    if( subgrid < 0 || subgrid >= NumSubgrids() )
+        LogicError("Invalid subgrid index ",subgrid," of ",NumSubgrids());
+    return *subgrids_[subgrid];
+}
+
+int SubgridScheduler::MySubgrid() const EL_NO_EXCEPT
+{ return mySubgrid_; }
+
+Int SubgridScheduler::NumTasks() const EL_NO_EXCEPT
+{ return tasks_.size(); }
+
+Int SubgridScheduler::AddTask
+( Task task, const vector<Int>& dependencies, double cost )
+{
+    EL_DEBUG_CSE
+    const Int index = tasks_.size();
+    Int level = 0;
+    for( const Int dep : dependencies )
+    {
+        if( dep < 0 || dep >= index )
+            LogicError
+            ("Task ",index," can only depend upon the ",index,
+             " previously added tasks, not task ",dep);
+        level = Max( level, tasks_[dep].level+1 );
+    }
+    if( Int(levelLoads_.size()) <= level )
+        levelLoads_.resize( level+1, vector<double>(NumSubgrids(),0) );
+    auto& loads = levelLoads_[level];
+    int subgrid = 0;
+    for( int s=1; s<NumSubgrids(); ++s )
+        if( loads[s] < loads[subgrid] )
+            subgrid = s;
+    loads[subgrid] += cost;
+
+    TaskInfo info;
+    info.task = task;
+    info.level = level;
+    info.subgrid = subgrid;
+    info.ran = false;
+    tasks_.push_back( info );
+    return index;
+}
+
+void SubgridScheduler::AddTransfer( Int task, Transfer transfer, bool input )
+{
+    EL_DEBUG_CSE
+    if( task < 0 || task >= NumTasks() )
+        LogicError("Invalid task index ",task," of ",NumTasks());
+    if( tasks_[task].ran )
+        LogicError("Task ",task," was already run");
+    if( input )
+        tasks_[task].inputs.push_back( transfer );
+    else
+        tasks_[task].outputs.push_back( transfer );
+}
+
+int SubgridScheduler::Assignment( Int task ) const
+{
+    EL_DEBUG_CSE
+    if( task < 0 || task >= NumTasks() )
+        LogicError("Invalid task index ",task," of ",NumTasks());
+    return tasks_[task].subgrid;
+}
+
+void SubgridScheduler::Run()
+{
+    EL_DEBUG_CSE
+    const Int numLevels = levelLoads_.size();
+    for( Int level=0; level<numLevels; ++level )
+    {
+        for( auto& info : tasks_ )
+            if( info.level == level && !info.ran )
+                for( auto& input : info.inputs )
+                    input( *subgrids_[info.subgrid] );
+
+        for( auto& info : tasks_ )
+            if( info.level == level && !info.ran &&
+                info.subgrid == mySubgrid_ )
+                info.task( *subgrids_[info.subgrid] );
+
+        for( auto& info : tasks_ )
+        {
+            if( info.level == level && !info.ran )
+            {
+                for( auto& output : info.outputs )
+                    output( *subgrids_[info.subgrid] );
+                info.ran = true;
+            }
+        }
+    }
+    // Tasks added later may depend upon those which have already run, but
+    // they need not wait for them
+    for( auto& info : tasks_ )
+        info.level = -1;
+    levelLoads_.clear();
+}
+
+} // namespace El
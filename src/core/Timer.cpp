@@ -8,6 +8,61 @@
 */
 #include <El-lite.hpp>
 
+#include <fstream>
+
+namespace {
+using namespace El;
+
+bool regionTimersEnabled = false;
+bool regionTraceEnabled = false;
+
+bool kernelCountersEnabled = false;
+thread_local KernelCounts threadKernelCounts;
+
+// The tree of distinct region paths; node 0 is a nameless root
+struct RegionNode
+{
+    string name;
+    Int parent=-1, depth=-1;
+    vector<Int> children;
+    Int numCalls=0;
+    double inclusive=0, childTime=0;
+};
+vector<RegionNode> regionNodes( 1 );
+
+// The currently open regions and the times at which they were opened
+vector<std::pair<Int,Clock::time_point>> openRegions;
+
+struct TraceEvent
+{
+    Int node;
+    double start, duration; // in microseconds since the trace epoch
+};
+vector<TraceEvent> traceEvents;
+Clock::time_point traceEpoch = Clock::now();
+
+double Microseconds( Clock::time_point start, Clock::time_point end )
+{ return duration_cast<duration<double,std::micro>>(end-start).count(); }
+
+void AppendProfiles
+( Int node, const string& prefix, vector<RegionProfile>& profiles )
+{
+    for( const Int child : regionNodes[node].children )
+    {
+        const RegionNode& region = regionNodes[child];
+        RegionProfile profile;
+        profile.path = prefix + region.name;
+        profile.depth = region.depth;
+        profile.numCalls = region.numCalls;
+        profile.inclusive = region.inclusive;
+        profile.exclusive = region.inclusive - region.childTime;
+        profiles.push_back( profile );
+        AppendProfiles( child, profile.path+"/", profiles );
+    }
+}
+
+} // anonymous namespace
+
 namespace El {
 
 Timer::Timer( const string& name )
@@ -62,4 +117,170 @@ double Timer::Total() const
         return totalTime_;
 }
 
+void EnableRegionTimers( bool enable )
+{
+    if( !enable && !::openRegions.empty() )
+        LogicError("Cannot disable the region timers within a region");
+    ::regionTimersEnabled = enable;
+}
+
+bool RegionTimersEnabled() EL_NO_EXCEPT { return ::regionTimersEnabled; }
+
+void EnableRegionTrace( bool enable ) { ::regionTraceEnabled = enable; }
+
+bool RegionTraceEnabled() EL_NO_EXCEPT { return ::regionTraceEnabled; }
+
+void PushRegion( const char* name )
+{
+#ifdef EL_HYBRID
+    // As with the call stack, only the master thread records regions
+    if( omp_get_thread_num() != 0 )
+        return;
+#endif
+    const Int parent =
+      ( ::openRegions.empty() ? 0 : ::openRegions.back().first );
+    Int node = -1;
+    for( const Int child : ::regionNodes[parent].children )
+    {
+        if( ::regionNodes[child].name == name )
+        {
+            node = child;
+            break;
+        }
+    }
+    if( node == -1 )
+    {
+        node = ::regionNodes.size();
+        RegionNode region;
+        region.name = name;
+        region.parent = parent;
+        region.depth = ::regionNodes[parent].depth + 1;
+        ::regionNodes.push_back( region );
+        ::regionNodes[parent].children.push_back( node );
+    }
+    ::openRegions.emplace_back( node, Clock::now() );
+}
+
+void PopRegion()
+{
+#ifdef EL_HYBRID
+    if( omp_get_thread_num() != 0 )
+        return;
+#endif
+    if( ::openRegions.empty() )
+        LogicError("Tried to pop a region when none were open");
+    const auto end = Clock::now();
+    const Int node = ::openRegions.back().first;
+    const auto start = ::openRegions.back().second;
+    ::openRegions.pop_back();
+
+    const double elapsed = duration_cast<duration<double>>(end-start).count();
+    RegionNode& region = ::regionNodes[node];
+    ++region.numCalls;
+    region.inclusive += elapsed;
+    ::regionNodes[region.parent].childTime += elapsed;
+    if( ::regionTraceEnabled )
+    {
+        TraceEvent event;
+        event.node = node;
+        event.start = Microseconds( ::traceEpoch, start );
+        event.duration = Microseconds( start, end );
+        ::traceEvents.push_back( event );
+    }
+}
+
+string CurrentRegionPath()
+{
+#ifdef EL_HYBRID
+    if( omp_get_thread_num() != 0 )
+        return string();
+#endif
+    string path;
+    if( ::openRegions.empty() )
+        return path;
+    for( Int node=::openRegions.back().first; node>0;
+         node=::regionNodes[node].parent )
+        path = ( path.empty() ? ::regionNodes[node].name :
+                 ::regionNodes[node].name+"/"+path );
+    return path;
+}
+
+void ResetRegions()
+{
+    // The nodes of the open regions must persist, so only zero the timings
+    for( auto& region : ::regionNodes )
+    {
+        region.numCalls = 0;
+        region.inclusive = 0;
+        region.childTime = 0;
+    }
+    ::traceEvents.clear();
+    ::traceEpoch = Clock::now();
+}
+
+vector<RegionProfile> RegionProfiles()
+{
+    vector<RegionProfile> profiles;
+    AppendProfiles( 0, "", profiles );
+    return profiles;
+}
+
+void PrintRegionProfiles( ostream& os )
+{
+    auto profiles = RegionProfiles();
+    os << "region: calls, inclusive [s], exclusive [s]\n";
+    for( const auto& profile : profiles )
+    {
+        const auto lastSlash = profile.path.find_last_of('/');
+        const string name =
+          ( lastSlash == string::npos ? profile.path :
+            profile.path.substr(lastSlash+1) );
+        os << string(2*profile.depth,' ') << name << ": "
+           << profile.numCalls << ", " << profile.inclusive << ", "
+           << profile.exclusive << "\n";
+    }
+    os.flush();
+}
+
+void WriteRegionTrace( const string& filename )
+{
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file.precision( 16 );
+    const int rank =
+      ( mpi::Initialized() && !mpi::Finalized() ?
+        mpi::Rank(mpi::COMM_WORLD) : 0 );
+    // Since the regions are properly nested, "complete" events suffice
+    file << "{\"traceEvents\": [";
+    bool first = true;
+    for( const auto& event : ::traceEvents )
+    {
+        file << ( first ? "\n" : ",\n" )
+             << "  {\"name\": \"" << ::regionNodes[event.node].name << "\", "
+             << "\"cat\": \"El\", \"ph\": \"X\", "
+             << "\"ts\": " << event.start << ", "
+             << "\"dur\": " << event.duration << ", "
+             << "\"pid\": " << rank << ", \"tid\": 0}";
+        first = false;
+    }
+    file << "\n],\n\"displayTimeUnit\": \"ms\"}" << endl;
+}
+
+void EnableKernelCounters( bool enable ) { ::kernelCountersEnabled = enable; }
+
+bool KernelCountersEnabled() EL_NO_EXCEPT { return ::kernelCountersEnabled; }
+
+KernelCounts ThreadKernelCounts() EL_NO_EXCEPT
+{ return ::threadKernelCounts; }
+
+void ResetKernelCounts() EL_NO_EXCEPT
+{ ::threadKernelCounts = KernelCounts(); }
+
+void AddKernelCounts( double flops, double bytes ) EL_NO_EXCEPT
+{
+    ::threadKernelCounts.flops += flops;
+    ::threadKernelCounts.bytes += bytes;
+}
+
 } // namespace El
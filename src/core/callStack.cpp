@@ -7,14 +7,13 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
-#include <stack>
+#include <atomic>
 
 namespace {
 
-// Debugging
+// Debugging (the call stack itself is a member of the current Context)
 EL_DEBUG_ONLY(
-  std::stack<std::string> callStack;
-  bool tracingEnabled = false;
+  std::atomic<bool> tracingEnabled(false);
 )
 
 }
@@ -38,20 +37,17 @@ EL_DEBUG_ONLY(
       // verified.
       if( !Initialized() )
           return;
-#ifdef EL_HYBRID
-      if( omp_get_thread_num() != 0 )
-          return;
-#endif
+      std::stack<string>& callStack = CurrentContext().callStack;
       const size_t maxStackSize = 300;
-      if( ::callStack.size() > maxStackSize )
+      if( callStack.size() > maxStackSize )
       {
           DumpCallStack();
           return;
       }
-      ::callStack.push(s); 
+      callStack.push(s); 
       if( ::tracingEnabled )
       {
-          const int stackSize = ::callStack.size();
+          const int stackSize = callStack.size();
           ostringstream os;
           for( int j=0; j<stackSize; ++j )
               os << " "; 
@@ -65,23 +61,21 @@ EL_DEBUG_ONLY(
       // See note [1] above.
       if( !Initialized() )
           return;
-#ifdef EL_HYBRID
-      if( omp_get_thread_num() != 0 )
-          return;
-#endif
-      if( ::callStack.empty() )
+      std::stack<string>& callStack = CurrentContext().callStack;
+      if( callStack.empty() )
           LogicError("Attempted to pop an empty call stack");
-      ::callStack.pop(); 
+      callStack.pop(); 
   }
 
   void DumpCallStack( ostream& os )
   {
+      std::stack<string>& callStack = CurrentContext().callStack;
       ostringstream msg;
-      while( ! ::callStack.empty() )
+      while( ! callStack.empty() )
       {
-          msg << "[" << ::callStack.size() << "]: " << ::callStack.top() 
+          msg << "[" << callStack.size() << "]: " << callStack.top() 
               << "\n";
-          ::callStack.pop();
+          callStack.pop();
       }
       os << msg.str();
       os.flush();
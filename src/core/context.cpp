@@ -0,0 +1,135 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <atomic>
+#include <mutex>
+
+namespace {
+
+std::atomic<El::Int> defaultBlocksize(128);
+std::atomic<std::uint64_t> numContexts(0);
+std::atomic<El::Int> numImplicitContexts(0);
+
+// The most recently published blocksize stack of the main Context, along
+// with its top and whether the tuned blocksizes apply to it (so that they
+// may be queried without locking)
+std::mutex mainBlocksizesMutex;
+std::stack<El::Int> mainBlocksizes;
+bool mainExplicitBlocksize = false;
+std::atomic<El::Int> mainBlocksize(128);
+std::atomic<bool> mainTunedBlocksizesActive(true);
+
+// The Context owned by each thread and the one which it has activated
+thread_local El::Context threadContext;
+thread_local El::Context* activeContext = nullptr;
+
+// The thread id of a Context constructed without an explicit one
+El::Int ImplicitThreadId()
+{
+#if defined(EL_HYBRID) || defined(EL_HAVE_THREADED_PACKING)
+    if( omp_in_parallel() )
+        return omp_get_thread_num();
+#endif
+    // The first such Context (that of the main thread) is given zero
+    return -(::numImplicitContexts++);
+}
+
+}
+
+namespace El {
+
+Context::Context()
+: Context( ImplicitThreadId() )
+{ }
+
+Context::Context( Int id )
+: explicitBlocksize(false), inheritsBlocksizes(true), mainContext(false),
+  threadId(id), indentLevel(0)
+{
+    blocksizeStack.push( ::defaultBlocksize );
+    if( ::numContexts++ == 0 )
+    {
+        mainContext = true;
+        inheritsBlocksizes = false;
+        PublishBlocksizes();
+    }
+    SeedGenerator( generator, mainContext ? 0 : threadId );
+}
+
+Int Context::Blocksize() const
+{
+    if( inheritsBlocksizes )
+        return ::mainBlocksize;
+    EL_DEBUG_ONLY(
+      if( blocksizeStack.empty() )
+          LogicError("Attempted to extract blocksize from empty stack");
+    )
+    return blocksizeStack.top();
+}
+
+bool Context::TunedBlocksizesActive() const
+{
+    if( inheritsBlocksizes )
+        return ::mainTunedBlocksizesActive;
+    return blocksizeStack.size() == 1 && !explicitBlocksize;
+}
+
+std::stack<Int>& Context::ModifyBlocksizes()
+{
+    if( inheritsBlocksizes )
+    {
+        std::lock_guard<std::mutex> guard( ::mainBlocksizesMutex );
+        blocksizeStack = ::mainBlocksizes;
+        explicitBlocksize = ::mainExplicitBlocksize;
+        inheritsBlocksizes = false;
+    }
+    return blocksizeStack;
+}
+
+void Context::PublishBlocksizes() const
+{
+    if( !mainContext )
+        return;
+    std::lock_guard<std::mutex> guard( ::mainBlocksizesMutex );
+    ::mainBlocksizes = blocksizeStack;
+    ::mainExplicitBlocksize = explicitBlocksize;
+    ::mainBlocksize =
+      ( blocksizeStack.empty() ? Int(::defaultBlocksize) :
+                                 blocksizeStack.top() );
+    ::mainTunedBlocksizesActive =
+      ( blocksizeStack.size() == 1 && !explicitBlocksize );
+}
+
+Context& CurrentContext()
+{
+    if( ::activeContext == nullptr )
+        ::activeContext = &::threadContext;
+    return *::activeContext;
+}
+
+void SetContext( Context* context )
+{ ::activeContext = ( context == nullptr ? &::threadContext : context ); }
+
+ContextGuard::ContextGuard( Context& context )
+: previous_(&CurrentContext())
+{ SetContext( &context ); }
+
+ContextGuard::~ContextGuard()
+{ SetContext( previous_ ); }
+
+void SetDefaultBlocksize( Int blocksize )
+{
+    if( blocksize < 1 )
+        LogicError("The default blocksize must be positive");
+    ::defaultBlocksize = blocksize;
+}
+
+Int DefaultBlocksize() { return ::defaultBlocksize; }
+
+} // namespace El
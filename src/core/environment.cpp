@@ -8,8 +8,12 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
+#include <El/lapack_like/util.hpp>
 
 #include <algorithm>
+#include <cstdlib>
+#include <fstream>
 #include <set>
 
 namespace {
@@ -19,6 +23,8 @@ bool elemInitializedMpi = false;
 
 El::Args* args = 0;
 
+double initializationTime = 0;
+
 }
 
 namespace El {
@@ -53,6 +59,11 @@ void PrintConfig( ostream& os )
 #else
       "  Have Qt5:                     NO\n"
 #endif
+#ifdef EL_HAVE_CUDA
+      "  Have CUDA:                    YES\n"
+#else
+      "  Have CUDA:                    NO\n"
+#endif
 #ifdef EL_AVOID_COMPLEX_MPI
       "  Avoiding complex MPI:         YES\n"
 #else
@@ -122,6 +133,9 @@ bool Using64BitBlasInt()
 bool Initialized()
 { return ::numElemInits > 0; }
 
+double InitializationTime()
+{ return ::initializationTime; }
+
 void Initialize()
 {
     int argc=0;
@@ -136,6 +150,8 @@ void Initialize( int& argc, char**& argv )
         ++::numElemInits;
         return;
     }
+    Timer timer;
+    timer.Start();
 
     ::args = new Args( argc, argv );
 
@@ -180,7 +196,14 @@ void Initialize( int& argc, char**& argv )
 
     // Queue a default algorithmic blocksize
     EmptyBlocksizeStack();
-    PushBlocksizeStack( 128 );
+    PushBlocksizeStack( DefaultBlocksize() );
+    ClearTunedBlocksizes();
+    const char* blocksizeFile = std::getenv("EL_BLOCKSIZE_FILE");
+    if( blocksizeFile != nullptr )
+    {
+        try { LoadTunedBlocksizes( blocksizeFile ); }
+        catch( std::exception& e ) { ReportException(e); }
+    }
 
     // Build the default grid
     Grid::InitializeDefault();
@@ -192,9 +215,43 @@ void Initialize( int& argc, char**& argv )
 
     InitializeRandom();
 
-    // Create the types and ops.
-    // mpfr::SetPrecision within InitializeRandom created the BigFloat types
-    mpi::CreateCustom();
+    // The custom MPI datatypes and ops are created upon their first use
+    // (mpfr::SetPrecision within InitializeRandom created the BigFloat types)
+
+    if( std::getenv("EL_GEMM_CALIBRATE") != nullptr )
+        CalibrateGemmCostModel();
+    if( std::getenv("EL_PLACEMENT_CALIBRATE") != nullptr )
+        CalibratePlacementModel();
+
+    if( std::getenv("EL_MPI_PROFILE") != nullptr )
+        mpi::EnableProfiling();
+    if( std::getenv("EL_REGION_TRACE") != nullptr )
+    {
+        EnableRegionTimers();
+        EnableRegionTrace();
+    }
+    if( std::getenv("EL_REDIST_DIAGNOSTICS") != nullptr )
+    {
+        EnableRegionTimers();
+        EnableRedistDiagnostics();
+    }
+    if( std::getenv("EL_MEMORY_POOL") != nullptr )
+        EnableMemoryPool( true );
+    if( std::getenv("EL_NODE_AWARE_COLLECTIVES") != nullptr )
+        EnableNodeAwareCollectives( true );
+    if( std::getenv("EL_PRE_ALIGN") != nullptr )
+        SetPreAlignInputs( true );
+    if( std::getenv("EL_GEMM_PREFETCH") != nullptr )
+        SetGemmPrefetchPanels( true );
+
+    ::initializationTime = timer.Stop();
+    if( std::getenv("EL_INIT_TIME") != nullptr )
+    {
+        const double maxTime =
+          mpi::AllReduce( ::initializationTime, mpi::MAX, mpi::COMM_WORLD );
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+            cout << "El::Initialize took " << maxTime << " seconds" << endl;
+    }
 }
 
 void Finalize()
@@ -214,6 +271,43 @@ void Finalize()
         delete ::args;
         ::args = 0;
 
+        const char* profilePrefix = std::getenv("EL_MPI_PROFILE");
+        if( profilePrefix != nullptr && mpi::ProfilingEnabled() )
+        {
+            try
+            {
+                mpi::WriteProfileJSON
+                ( BuildString
+                  (profilePrefix,".",mpi::Rank(mpi::COMM_WORLD),".json") );
+            }
+            catch( std::exception& e ) { ReportException(e); }
+        }
+
+        const char* tracePrefix = std::getenv("EL_REGION_TRACE");
+        if( tracePrefix != nullptr && RegionTraceEnabled() )
+        {
+            try
+            {
+                WriteRegionTrace
+                ( BuildString
+                  (tracePrefix,".",mpi::Rank(mpi::COMM_WORLD),".json") );
+            }
+            catch( std::exception& e ) { ReportException(e); }
+        }
+
+        const char* redistPrefix = std::getenv("EL_REDIST_DIAGNOSTICS");
+        if( redistPrefix != nullptr && RedistDiagnosticsEnabled() )
+        {
+            const string filename =
+              BuildString
+              (redistPrefix,".",mpi::Rank(mpi::COMM_WORLD),".txt");
+            std::ofstream file( filename.c_str() );
+            if( file.is_open() )
+                PrintRedistDiagnostics( file );
+            else
+                cerr << "Could not open " << filename << endl;
+        }
+
         Grid::FinalizeDefault();
         Grid::FinalizeTrivial();
 
@@ -222,6 +316,9 @@ void Finalize()
 
 #ifdef EL_HAVE_QT5
         FinalizeQt5();
+#endif
+#ifdef EL_HAVE_CUDA
+        cuda::Finalize();
 #endif
         if( ::elemInitializedMpi )
             mpi::Finalize();
@@ -229,6 +326,9 @@ void Finalize()
 
         EmptyBlocksizeStack();
 
+        // Return any cached temporary buffers to the system
+        TrimMemoryPool();
+
 #ifdef EL_HAVE_QD
         FinalizeQD();
 #endif
@@ -393,6 +493,17 @@ vector<Int> RelativeIndices( const vector<Int>& sub, const vector<Int>& full )
     return relInds;
 }
 
+vector<Int> IndexRuns( const vector<Int>& inds )
+{
+    const Int numInds = inds.size();
+    vector<Int> runs;
+    for( Int i=0; i<numInds; ++i )
+        if( i == 0 || inds[i] != inds[i-1]+1 )
+            runs.push_back( i );
+    runs.push_back( numInds );
+    return runs;
+}
+
 Int Find( const vector<Int>& sortedInds, Int index )
 {
     EL_DEBUG_CSE
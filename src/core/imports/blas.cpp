@@ -12,6 +12,110 @@ using El::BlasInt;
 using El::scomplex;
 using El::dcomplex;
 
+namespace {
+
+int fallbackThreads = 0;
+double fallbackThreshold = 1 << 16;
+
+} // anonymous namespace
+
+namespace El {
+namespace blas {
+
+void SetFallbackThreads( int numThreads )
+{
+    if( numThreads < 0 )
+        LogicError("The number of fallback threads must be non-negative");
+    ::fallbackThreads = numThreads;
+}
+
+int FallbackThreads()
+{
+#ifdef EL_HYBRID
+    return ( ::fallbackThreads == 0 ? omp_get_max_threads()
+                                    : ::fallbackThreads );
+#else
+    return 1;
+#endif
+}
+
+void SetFallbackThreshold( double numMultiplyAdds )
+{ ::fallbackThreshold = numMultiplyAdds; }
+
+double FallbackThreshold() { return ::fallbackThreshold; }
+
+// The number of threads a custom kernel should split the given number of
+// multiply-adds over (nested parallelism is avoided)
+inline int FallbackThreads( double numMultiplyAdds )
+{
+#ifdef EL_HYBRID
+    if( numMultiplyAdds < ::fallbackThreshold || omp_in_parallel() )
+        return 1;
+    return FallbackThreads();
+#else
+    return 1;
+#endif
+}
+
+// The nominal numbers of multiply-adds and of operand entries read or
+// written by each kernel (see CountKernel)
+template<typename T>
+inline void CountGemv( char trans, BlasInt m, BlasInt n )
+{
+    const double yLength = ( std::toupper(trans) == 'N' ? m : n );
+    CountKernel<T>( double(m)*n, double(m)*n + double(m) + n + yLength );
+}
+
+template<typename T>
+inline void CountGer( BlasInt m, BlasInt n )
+{ CountKernel<T>( double(m)*n, 2.*m*n + m + n ); }
+
+template<typename T>
+inline void CountSymv( BlasInt m )
+{ CountKernel<T>( double(m)*m, double(m)*m/2 + 3.*m ); }
+
+template<typename T>
+inline void CountSyr( BlasInt m )
+{ CountKernel<T>( double(m)*m/2, double(m)*m + m ); }
+
+template<typename T>
+inline void CountSyr2( BlasInt m )
+{ CountKernel<T>( double(m)*m, double(m)*m + 2.*m ); }
+
+template<typename T>
+inline void CountTrsv( BlasInt m )
+{ CountKernel<T>( double(m)*m/2, double(m)*m/2 + 2.*m ); }
+
+template<typename T>
+inline void CountGemm( BlasInt m, BlasInt n, BlasInt k )
+{ CountKernel<T>( double(m)*n*k, double(m)*k + double(k)*n + 2.*m*n ); }
+
+template<typename T>
+inline void CountSymm( char side, BlasInt m, BlasInt n )
+{
+    const double order = ( std::toupper(side) == 'L' ? m : n );
+    CountKernel<T>( order*m*n, order*order/2 + 3.*m*n );
+}
+
+template<typename T>
+inline void CountSyrk( BlasInt n, BlasInt k )
+{ CountKernel<T>( double(n)*n*k/2, double(n)*k + double(n)*n ); }
+
+template<typename T>
+inline void CountSyr2k( BlasInt n, BlasInt k )
+{ CountKernel<T>( double(n)*n*k, 2.*n*k + double(n)*n ); }
+
+// For both Trmm and Trsm
+template<typename T>
+inline void CountTrxm( char side, BlasInt m, BlasInt n )
+{
+    const double order = ( std::toupper(side) == 'L' ? m : n );
+    CountKernel<T>( order*m*n/2, order*order/2 + 2.*m*n );
+}
+
+} // namespace blas
+} // namespace El
+
 // Level 1
 #include "./blas/Axpy.hpp"
 #include "./blas/Copy.hpp"
@@ -38,3 +142,6 @@ using El::dcomplex;
 #include "./blas/Syr2k.hpp"
 #include "./blas/Trmm.hpp"
 #include "./blas/Trsm.hpp"
+
+// Native double-double kernels
+#include "./blas/DoubleDouble.hpp"
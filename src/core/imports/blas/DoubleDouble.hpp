@@ -0,0 +1,503 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// Native kernels for real double-double arithmetic
+// ================================================
+// Rather than calling the (out-of-line) dd_real operators on each entry, the
+// operands are packed into separate arrays of leading and trailing words so
+// that the error-free transformations below can be applied to a full SIMD
+// register of entries at once. Enabling FMA and AVX2/AVX-512 in the compiler
+// flags allows EL_SIMD loops to map each transformation onto a handful of
+// vector instructions.
+
+#ifdef EL_HAVE_QD
+
+namespace El {
+namespace blas {
+namespace dd {
+
+// Blocking parameters for Gemm (the packed panels of A and B use 16 bytes per
+// entry, so an MC x KC block of A occupies 256 KB)
+const BlasInt MR = 8;
+const BlasInt NR = 4;
+const BlasInt MC = 64;
+const BlasInt KC = 256;
+const BlasInt NC = 512;
+
+// The diagonal block size below which Trsm and Syrk use the reference
+// implementation
+const BlasInt TrsmLeafSize = 32;
+const BlasInt SyrkBlocksize = 64;
+
+// s + e = a + b exactly
+inline void TwoSum( double a, double b, double& s, double& e )
+{
+    s = a + b;
+    const double bVirtual = s - a;
+    e = (a - (s - bVirtual)) + (b - bVirtual);
+}
+
+// s + e = a + b exactly, assuming |a| >= |b|
+inline void FastTwoSum( double a, double b, double& s, double& e )
+{
+    s = a + b;
+    e = b - (s - a);
+}
+
+// p + e = a b exactly
+inline void TwoProd( double a, double b, double& p, double& e )
+{
+    p = a * b;
+#ifdef FP_FAST_FMA
+    e = std::fma( a, b, -p );
+#else
+    // Dekker's splitting
+    const double splitter = 134217729.; // 2^27 + 1
+    double t = splitter*a;
+    const double aHi = t - (t - a);
+    const double aLo = a - aHi;
+    t = splitter*b;
+    const double bHi = t - (t - b);
+    const double bLo = b - bHi;
+    e = ((aHi*bHi - p) + aHi*bLo + aLo*bHi) + aLo*bLo;
+#endif
+}
+
+// (cHi,cLo) := (cHi,cLo) + (aHi,aLo) (bHi,bLo), using the accurate
+// (IEEE-style) double-double addition
+inline void MultiplyAdd
+( double aHi, double aLo, double bHi, double bLo, double& cHi, double& cLo )
+{
+    double p, e;
+    TwoProd( aHi, bHi, p, e );
+    e += aHi*bLo + aLo*bHi;
+    FastTwoSum( p, e, p, e );
+
+    double s1, s2, t1, t2;
+    TwoSum( cHi, p, s1, s2 );
+    TwoSum( cLo, e, t1, t2 );
+    s2 += t1;
+    FastTwoSum( s1, s2, s1, s2 );
+    s2 += t2;
+    FastTwoSum( s1, s2, cHi, cLo );
+}
+
+// Pack the mc x kc block op(A)(i0:i0+mc,l0:l0+kc) into row panels of height
+// MR, with each panel stored column-major and padded with zeros
+inline void PackA
+( char transA, BlasInt mc, BlasInt kc,
+  const DoubleDouble* A, BlasInt ALDim, BlasInt i0, BlasInt l0,
+  double* aHi, double* aLo )
+{
+    const bool normal = ( std::toupper(transA) == 'N' );
+    for( BlasInt ir=0; ir<mc; ir+=MR )
+    {
+        const BlasInt mr = Min( MR, mc-ir );
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            double* panelHi = &aHi[ir*kc+l*MR];
+            double* panelLo = &aLo[ir*kc+l*MR];
+            for( BlasInt i=0; i<mr; ++i )
+            {
+                const DoubleDouble& alpha =
+                  normal ? A[(i0+ir+i)+(l0+l)*ALDim]
+                         : A[(l0+l)+(i0+ir+i)*ALDim];
+                panelHi[i] = alpha.x[0];
+                panelLo[i] = alpha.x[1];
+            }
+            for( BlasInt i=mr; i<MR; ++i )
+                panelHi[i] = panelLo[i] = 0;
+        }
+    }
+}
+
+// Pack the kc x nc block op(B)(l0:l0+kc,j0:j0+nc) into column panels of width
+// NR, with each panel stored row-major and padded with zeros
+inline void PackB
+( char transB, BlasInt kc, BlasInt nc,
+  const DoubleDouble* B, BlasInt BLDim, BlasInt l0, BlasInt j0,
+  double* bHi, double* bLo )
+{
+    const bool normal = ( std::toupper(transB) == 'N' );
+    for( BlasInt jr=0; jr<nc; jr+=NR )
+    {
+        const BlasInt nr = Min( NR, nc-jr );
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            double* panelHi = &bHi[jr*kc+l*NR];
+            double* panelLo = &bLo[jr*kc+l*NR];
+            for( BlasInt j=0; j<nr; ++j )
+            {
+                const DoubleDouble& beta =
+                  normal ? B[(l0+l)+(j0+jr+j)*BLDim]
+                         : B[(j0+jr+j)+(l0+l)*BLDim];
+                panelHi[j] = beta.x[0];
+                panelLo[j] = beta.x[1];
+            }
+            for( BlasInt j=nr; j<NR; ++j )
+                panelHi[j] = panelLo[j] = 0;
+        }
+    }
+}
+
+// Accumulate the product of an MR x kc panel of A and a kc x NR panel of B
+// into an MR x NR register tile
+inline void MicroKernel
+( BlasInt kc,
+  const double* EL_RESTRICT aHi, const double* EL_RESTRICT aLo,
+  const double* EL_RESTRICT bHi, const double* EL_RESTRICT bLo,
+        double* EL_RESTRICT cHi,       double* EL_RESTRICT cLo )
+{
+    for( BlasInt l=0; l<kc; ++l )
+    {
+        const double* aHiCol = &aHi[l*MR];
+        const double* aLoCol = &aLo[l*MR];
+        for( BlasInt j=0; j<NR; ++j )
+        {
+            const double betaHi = bHi[l*NR+j];
+            const double betaLo = bLo[l*NR+j];
+            double* cHiCol = &cHi[j*MR];
+            double* cLoCol = &cLo[j*MR];
+            EL_SIMD
+            for( BlasInt i=0; i<MR; ++i )
+                MultiplyAdd
+                ( aHiCol[i], aLoCol[i], betaHi, betaLo, cHiCol[i], cLoCol[i] );
+        }
+    }
+}
+
+inline void Scale
+( BlasInt m, BlasInt n, const DoubleDouble& beta,
+  DoubleDouble* C, BlasInt CLDim )
+{
+    if( beta == DoubleDouble(0) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] = 0;
+    }
+    else if( beta != DoubleDouble(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                C[i+j*CLDim] *= beta;
+    }
+}
+
+inline void GemmSequential
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* B, BlasInt BLDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim )
+{
+    Scale( m, n, beta, C, CLDim );
+    if( m == 0 || n == 0 || k == 0 || alpha == DoubleDouble(0) )
+        return;
+
+    vector<double> aHi(MC*KC), aLo(MC*KC), bHi(KC*NC), bLo(KC*NC);
+    double cHi[MR*NR], cLo[MR*NR];
+    DoubleDouble gamma;
+    for( BlasInt j0=0; j0<n; j0+=NC )
+    {
+        const BlasInt nc = Min( NC, n-j0 );
+        for( BlasInt l0=0; l0<k; l0+=KC )
+        {
+            const BlasInt kc = Min( KC, k-l0 );
+            PackB( transB, kc, nc, B, BLDim, l0, j0, bHi.data(), bLo.data() );
+            for( BlasInt i0=0; i0<m; i0+=MC )
+            {
+                const BlasInt mc = Min( MC, m-i0 );
+                PackA
+                ( transA, mc, kc, A, ALDim, i0, l0, aHi.data(), aLo.data() );
+                for( BlasInt jr=0; jr<nc; jr+=NR )
+                {
+                    const BlasInt nr = Min( NR, nc-jr );
+                    for( BlasInt ir=0; ir<mc; ir+=MR )
+                    {
+                        const BlasInt mr = Min( MR, mc-ir );
+                        MemZero( cHi, MR*NR );
+                        MemZero( cLo, MR*NR );
+                        MicroKernel
+                        ( kc, &aHi[ir*kc], &aLo[ir*kc],
+                              &bHi[jr*kc], &bLo[jr*kc], cHi, cLo );
+                        for( BlasInt j=0; j<nr; ++j )
+                        {
+                            for( BlasInt i=0; i<mr; ++i )
+                            {
+                                gamma.x[0] = cHi[i+j*MR];
+                                gamma.x[1] = cLo[i+j*MR];
+                                gamma *= alpha;
+                                C[(i0+ir+i)+(j0+jr+j)*CLDim] += gamma;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace dd
+
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* B, BlasInt BLDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    PartitionedGemm
+    ( transA, transB, m, n, k, A, ALDim, B, BLDim, C, CLDim,
+      [&]( BlasInt mLoc, BlasInt nLoc,
+           const DoubleDouble* ALoc, const DoubleDouble* BLoc,
+                 DoubleDouble* CLoc )
+      {
+          dd::GemmSequential
+          ( transA, transB, mLoc, nLoc, k,
+            alpha, ALoc, ALDim, BLoc, BLDim, beta, CLoc, CLDim );
+      } );
+}
+
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble* x, BlasInt incx,
+  const DoubleDouble& beta,
+        DoubleDouble* y, BlasInt incy )
+{
+    EL_DEBUG_CSE
+    using namespace dd;
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const BlasInt yLength = ( normal ? m : n );
+    const BlasInt xLength = ( normal ? n : m );
+    if( beta == DoubleDouble(0) )
+    {
+        for( BlasInt i=0; i<yLength; ++i )
+            y[i*incy] = 0;
+    }
+    else if( beta != DoubleDouble(1) )
+    {
+        for( BlasInt i=0; i<yLength; ++i )
+            y[i*incy] *= beta;
+    }
+    if( yLength == 0 || xLength == 0 || alpha == DoubleDouble(0) )
+        return;
+
+    vector<double> zHi(yLength,0), zLo(yLength,0);
+    if( normal )
+    {
+        // z := A x, vectorized over the rows within each column
+        vector<double> aHi(m), aLo(m);
+        for( BlasInt j=0; j<n; ++j )
+        {
+            const double chiHi = x[j*incx].x[0];
+            const double chiLo = x[j*incx].x[1];
+            const DoubleDouble* aCol = &A[j*ALDim];
+            for( BlasInt i=0; i<m; ++i )
+            {
+                aHi[i] = aCol[i].x[0];
+                aLo[i] = aCol[i].x[1];
+            }
+            EL_SIMD
+            for( BlasInt i=0; i<m; ++i )
+                MultiplyAdd( aHi[i], aLo[i], chiHi, chiLo, zHi[i], zLo[i] );
+        }
+    }
+    else
+    {
+        // z := A^T x, vectorized over groups of NR columns
+        vector<double> xHi(m), xLo(m);
+        for( BlasInt i=0; i<m; ++i )
+        {
+            xHi[i] = x[i*incx].x[0];
+            xLo[i] = x[i*incx].x[1];
+        }
+        for( BlasInt j0=0; j0<n; j0+=NR )
+        {
+            const BlasInt nr = Min( NR, n-j0 );
+            double aHi[NR], aLo[NR], accHi[NR], accLo[NR];
+            for( BlasInt j=0; j<NR; ++j )
+                aHi[j] = aLo[j] = accHi[j] = accLo[j] = 0;
+            for( BlasInt i=0; i<m; ++i )
+            {
+                for( BlasInt j=0; j<nr; ++j )
+                {
+                    aHi[j] = A[i+(j0+j)*ALDim].x[0];
+                    aLo[j] = A[i+(j0+j)*ALDim].x[1];
+                }
+                EL_SIMD
+                for( BlasInt j=0; j<NR; ++j )
+                    MultiplyAdd
+                    ( aHi[j], aLo[j], xHi[i], xLo[i], accHi[j], accLo[j] );
+            }
+            for( BlasInt j=0; j<nr; ++j )
+            {
+                zHi[j0+j] = accHi[j];
+                zLo[j0+j] = accLo[j];
+            }
+        }
+    }
+
+    DoubleDouble zeta;
+    for( BlasInt i=0; i<yLength; ++i )
+    {
+        zeta.x[0] = zHi[i];
+        zeta.x[1] = zLo[i];
+        zeta *= alpha;
+        y[i*incy] += zeta;
+    }
+}
+
+void Syrk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+  const DoubleDouble& beta,
+        DoubleDouble* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    using namespace dd;
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const char transOther = ( normal ? 'T' : 'N' );
+
+    // The diagonal blocks use the reference implementation, while the
+    // off-diagonal blocks of each block column are formed by the Gemm kernel
+    for( BlasInt j0=0; j0<n; j0+=SyrkBlocksize )
+    {
+        const BlasInt nb = Min( SyrkBlocksize, n-j0 );
+        const DoubleDouble* AJ = ( normal ? &A[j0] : &A[j0*ALDim] );
+        Syrk<DoubleDouble>
+        ( uplo, trans, nb, k, alpha, AJ, ALDim, beta,
+          &C[j0+j0*CLDim], CLDim );
+        if( lower )
+        {
+            // C(j0+nb:n,J) := alpha op(A)(j0+nb:n,:) op(A)(J,:)^T + beta C
+            const BlasInt i0 = j0 + nb;
+            if( i0 == n )
+                continue;
+            const DoubleDouble* AI = ( normal ? &A[i0] : &A[i0*ALDim] );
+            Gemm
+            ( trans, transOther, n-i0, nb, k,
+              alpha, AI, ALDim, AJ, ALDim, beta, &C[i0+j0*CLDim], CLDim );
+        }
+        else
+        {
+            // C(0:j0,J) := alpha op(A)(0:j0,:) op(A)(J,:)^T + beta C
+            if( j0 == 0 )
+                continue;
+            Gemm
+            ( trans, transOther, j0, nb, k,
+              alpha, A, ALDim, AJ, ALDim, beta, &C[j0*CLDim], CLDim );
+        }
+    }
+}
+
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const DoubleDouble& alpha,
+  const DoubleDouble* A, BlasInt ALDim,
+        DoubleDouble* B, BlasInt BLDim )
+{
+    EL_DEBUG_CSE
+    using namespace dd;
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const bool normal = ( std::toupper(trans) == 'N' );
+    // Whether op(A) is lower-triangular
+    const bool lower = ( (std::toupper(uplo) == 'L') == normal );
+    const BlasInt order = ( onLeft ? m : n );
+    if( order <= TrsmLeafSize || m == 0 || n == 0 )
+    {
+        Trsm<DoubleDouble>
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+
+    // Split op(A) = [op(A)_11, op(A)_12; op(A)_21, op(A)_22], where op(A)_IJ
+    // is stored in A_IJ if op is the identity and in A_JI^T otherwise
+    const BlasInt s = order / 2;
+    auto opABlock = [&]( BlasInt iBeg, BlasInt jBeg )
+      { return ( normal ? &A[iBeg+jBeg*ALDim] : &A[jBeg+iBeg*ALDim] ); };
+    const DoubleDouble* A11 = opABlock( 0, 0 );
+    const DoubleDouble* A21 = opABlock( s, 0 );
+    const DoubleDouble* A12 = opABlock( 0, s );
+    const DoubleDouble* A22 = opABlock( s, s );
+    if( onLeft )
+    {
+        DoubleDouble* B1 = B;
+        DoubleDouble* B2 = &B[s];
+        if( lower )
+        {
+            // X1 := op(A)_11^{-1} (alpha B1)
+            // X2 := op(A)_22^{-1} (alpha B2 - op(A)_21 X1)
+            Trsm( side, uplo, trans, unit, s, n, alpha, A11, ALDim, B1, BLDim );
+            Gemm
+            ( trans, 'N', m-s, n, s,
+              DoubleDouble(-1), A21, ALDim, B1, BLDim, alpha, B2, BLDim );
+            Trsm
+            ( side, uplo, trans, unit, m-s, n,
+              DoubleDouble(1), A22, ALDim, B2, BLDim );
+        }
+        else
+        {
+            // X2 := op(A)_22^{-1} (alpha B2)
+            // X1 := op(A)_11^{-1} (alpha B1 - op(A)_12 X2)
+            Trsm
+            ( side, uplo, trans, unit, m-s, n, alpha, A22, ALDim, B2, BLDim );
+            Gemm
+            ( trans, 'N', s, n, m-s,
+              DoubleDouble(-1), A12, ALDim, B2, BLDim, alpha, B1, BLDim );
+            Trsm
+            ( side, uplo, trans, unit, s, n,
+              DoubleDouble(1), A11, ALDim, B1, BLDim );
+        }
+    }
+    else
+    {
+        DoubleDouble* B1 = B;
+        DoubleDouble* B2 = &B[s*BLDim];
+        if( lower )
+        {
+            // X2 := (alpha B2) op(A)_22^{-1}
+            // X1 := (alpha B1 - X2 op(A)_21) op(A)_11^{-1}
+            Trsm
+            ( side, uplo, trans, unit, m, n-s, alpha, A22, ALDim, B2, BLDim );
+            Gemm
+            ( 'N', trans, m, s, n-s,
+              DoubleDouble(-1), B2, BLDim, A21, ALDim, alpha, B1, BLDim );
+            Trsm
+            ( side, uplo, trans, unit, m, s,
+              DoubleDouble(1), A11, ALDim, B1, BLDim );
+        }
+        else
+        {
+            // X1 := (alpha B1) op(A)_11^{-1}
+            // X2 := (alpha B2 - X1 op(A)_12) op(A)_22^{-1}
+            Trsm( side, uplo, trans, unit, m, s, alpha, A11, ALDim, B1, BLDim );
+            Gemm
+            ( 'N', trans, m, n-s, s,
+              DoubleDouble(-1), B1, BLDim, A12, ALDim, alpha, B2, BLDim );
+            Trsm
+            ( side, uplo, trans, unit, m, n-s,
+              DoubleDouble(1), A22, ALDim, B2, BLDim );
+        }
+    }
+}
+
+} // namespace blas
+} // namespace El
+
+#endif // ifdef EL_HAVE_QD
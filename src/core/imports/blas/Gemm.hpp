@@ -45,7 +45,7 @@ namespace El {
 namespace blas {
 
 template<typename T>
-void Gemm
+void GemmSequential
 ( char transA, char transB,
   BlasInt m, BlasInt n, BlasInt k,
   const T& alpha,
@@ -260,6 +260,71 @@ void Gemm
         }
     }
 }
+// Split C into blocks of columns (or of rows, if C is short and wide) which
+// are independently updated by calls to kernel(mLoc,nLoc,ALoc,BLoc,CLoc)
+template<typename T,typename Kernel>
+void PartitionedGemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+        T* C, BlasInt CLDim,
+  Kernel kernel )
+{
+    const int numThreads = FallbackThreads( double(m)*n*Max(k,BlasInt(1)) );
+    if( numThreads <= 1 )
+    {
+        kernel( m, n, A, B, C );
+        return;
+    }
+    const bool splitColumns = ( n >= numThreads || n >= m );
+    const BlasInt splitDim = ( splitColumns ? n : m );
+    // Oversubscribe the threads with blocks to balance the load
+    const BlasInt numBlocks = Min( splitDim, BlasInt(4*numThreads) );
+#ifdef EL_HYBRID
+    _Pragma("omp parallel for schedule(dynamic) num_threads(numThreads)")
+#endif
+    for( BlasInt block=0; block<numBlocks; ++block )
+    {
+        const BlasInt beg = (block*splitDim) / numBlocks;
+        const BlasInt end = ((block+1)*splitDim) / numBlocks;
+        if( splitColumns )
+        {
+            const T* BLoc =
+              ( std::toupper(transB) == 'N' ? &B[beg*BLDim] : &B[beg] );
+            kernel( m, end-beg, A, BLoc, &C[beg*CLDim] );
+        }
+        else
+        {
+            const T* ALoc =
+              ( std::toupper(transA) == 'N' ? &A[beg] : &A[beg*ALDim] );
+            kernel( end-beg, n, ALoc, B, &C[beg] );
+        }
+    }
+}
+
+template<typename T>
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    CountGemm<T>( m, n, k );
+    PartitionedGemm
+    ( transA, transB, m, n, k, A, ALDim, B, BLDim, C, CLDim,
+      [&]( BlasInt mLoc, BlasInt nLoc,
+           const T* ALoc, const T* BLoc, T* CLoc )
+      {
+          GemmSequential
+          ( transA, transB, mLoc, nLoc, k,
+            alpha, ALoc, ALDim, BLoc, BLDim, beta, CLoc, CLDim );
+      } );
+}
+
 template void Gemm
 ( char transA, char transB,
   BlasInt m, BlasInt n, BlasInt k, 
@@ -385,6 +450,7 @@ void Gemm
     )
     const char fixedTransA = ( std::toupper(transA) == 'C' ? 'T' : transA );
     const char fixedTransB = ( std::toupper(transB) == 'C' ? 'T' : transB );
+    CountGemm<float>( m, n, k );
     EL_BLAS(sgemm)
     ( &fixedTransA, &fixedTransB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -428,6 +494,7 @@ void Gemm
     )
     const char fixedTransA = ( std::toupper(transA) == 'C' ? 'T' : transA );
     const char fixedTransB = ( std::toupper(transB) == 'C' ? 'T' : transB );
+    CountGemm<double>( m, n, k );
     EL_BLAS(dgemm)
     ( &fixedTransA, &fixedTransB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -468,6 +535,7 @@ void Gemm
       if( CLDim < Max(m,1) )
           LogicError("CLDim was too small: CLDim=",CLDim,",m=",m);
     )
+    CountGemm<scomplex>( m, n, k );
     EL_BLAS(cgemm)
     ( &transA, &transB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -508,6 +576,7 @@ void Gemm
       if( CLDim < Max(m,1) )
           LogicError("CLDim was too small: CLDim=",CLDim,",m=",m);
     )
+    CountGemm<dcomplex>( m, n, k );
     EL_BLAS(zgemm)
     ( &transA, &transB, &m, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
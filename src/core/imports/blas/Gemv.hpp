@@ -220,6 +220,7 @@ void Gemv
         float* y, BlasInt incy )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    CountGemv<float>( trans, m, n );
     EL_BLAS(sgemv)
     ( &fixedTrans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
 }
@@ -233,6 +234,7 @@ void Gemv
         double* y, BlasInt incy )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    CountGemv<double>( trans, m, n );
     EL_BLAS(dgemv)
     ( &fixedTrans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
 }
@@ -244,8 +246,11 @@ void Gemv
   const scomplex* x, BlasInt incx,
   const scomplex& beta,
         scomplex* y, BlasInt incy )
-{ EL_BLAS(cgemv)
-  ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy ); }
+{
+    CountGemv<scomplex>( trans, m, n );
+    EL_BLAS(cgemv)
+    ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
+}
 
 void Gemv
 ( char trans, BlasInt m, BlasInt n,
@@ -254,8 +259,11 @@ void Gemv
   const dcomplex* x, BlasInt incx,
   const dcomplex& beta,
         dcomplex* y, BlasInt incy )
-{ EL_BLAS(zgemv)
-  ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy ); }
+{
+    CountGemv<dcomplex>( trans, m, n );
+    EL_BLAS(zgemv)
+    ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
+}
 
 } // namespace blas
 } // namespace El
@@ -148,7 +148,10 @@ void Ger
   const float* x, BlasInt incx, 
   const float* y, BlasInt incy,
         float* A, BlasInt ALDim )
-{ EL_BLAS(sger)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    CountGer<float>( m, n );
+    EL_BLAS(sger)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 void Ger
 ( BlasInt m, BlasInt n,
@@ -156,7 +159,10 @@ void Ger
   const double* x, BlasInt incx, 
   const double* y, BlasInt incy,
         double* A, BlasInt ALDim  )
-{ EL_BLAS(dger)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    CountGer<double>( m, n );
+    EL_BLAS(dger)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 void Ger
 ( BlasInt m, BlasInt n,
@@ -164,7 +170,10 @@ void Ger
   const scomplex* x, BlasInt incx, 
   const scomplex* y, BlasInt incy,
         scomplex* A, BlasInt ALDim )
-{ EL_BLAS(cgerc)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    CountGer<scomplex>( m, n );
+    EL_BLAS(cgerc)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 void Ger
 ( BlasInt m, BlasInt n,
@@ -172,7 +181,10 @@ void Ger
   const dcomplex* x, BlasInt incx, 
   const dcomplex* y, BlasInt incy,
         dcomplex* A, BlasInt ALDim )
-{ EL_BLAS(zgerc)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    CountGer<dcomplex>( m, n );
+    EL_BLAS(zgerc)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 template<typename T>
 void Geru
@@ -272,7 +284,10 @@ void Geru
   const float* x, BlasInt incx, 
   const float* y, BlasInt incy,
         float* A, BlasInt ALDim )
-{ EL_BLAS(sger)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    CountGer<float>( m, n );
+    EL_BLAS(sger)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 void Geru
 ( BlasInt m, BlasInt n,
@@ -280,7 +295,10 @@ void Geru
   const double* x, BlasInt incx, 
   const double* y, BlasInt incy,
         double* A, BlasInt ALDim )
-{ EL_BLAS(dger)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    CountGer<double>( m, n );
+    EL_BLAS(dger)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 void Geru
 ( BlasInt m, BlasInt n,
@@ -288,7 +306,10 @@ void Geru
   const scomplex* x, BlasInt incx, 
   const scomplex* y, BlasInt incy,
         scomplex* A, BlasInt ALDim )
-{ EL_BLAS(cgeru)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    CountGer<scomplex>( m, n );
+    EL_BLAS(cgeru)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 void Geru
 ( BlasInt m, BlasInt n,
@@ -296,7 +317,10 @@ void Geru
   const dcomplex* x, BlasInt incx, 
   const dcomplex* y, BlasInt incy,
         dcomplex* A, BlasInt ALDim )
-{ EL_BLAS(zgeru)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    CountGer<dcomplex>( m, n );
+    EL_BLAS(zgeru)( &m, &n, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 } // namespace blas
 } // namespace El
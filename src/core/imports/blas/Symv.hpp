@@ -228,7 +228,10 @@ void Hemv
   const float* x, BlasInt incx,
   const float& beta,
         float* y, BlasInt incy )
-{ EL_BLAS(ssymv)( &uplo, &m, &alpha, A, &ALDim, x, &incx, &beta, y, &incy ); }
+{
+    CountSymv<float>( m );
+    EL_BLAS(ssymv)( &uplo, &m, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
+}
 
 void Hemv
 ( char uplo, BlasInt m,
@@ -237,7 +240,10 @@ void Hemv
   const double* x, BlasInt incx,
   const double& beta,
         double* y, BlasInt incy )
-{ EL_BLAS(dsymv)( &uplo, &m, &alpha, A, &ALDim, x, &incx, &beta, y, &incy ); }
+{
+    CountSymv<double>( m );
+    EL_BLAS(dsymv)( &uplo, &m, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
+}
 
 void Hemv
 ( char uplo, BlasInt m,
@@ -246,7 +252,10 @@ void Hemv
   const scomplex* x, BlasInt incx,
   const scomplex& beta,
         scomplex* y, BlasInt incy )
-{ EL_BLAS(chemv)( &uplo, &m, &alpha, A, &ALDim, x, &incx, &beta, y, &incy ); }
+{
+    CountSymv<scomplex>( m );
+    EL_BLAS(chemv)( &uplo, &m, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
+}
 
 void Hemv
 ( char uplo, BlasInt m,
@@ -255,7 +264,10 @@ void Hemv
   const dcomplex* x, BlasInt incx,
   const dcomplex& beta,
         dcomplex* y, BlasInt incy )
-{ EL_BLAS(zhemv)( &uplo, &m, &alpha, A, &ALDim, x, &incx, &beta, y, &incy ); }
+{
+    CountSymv<dcomplex>( m );
+    EL_BLAS(zhemv)( &uplo, &m, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
+}
 
 // TODO: Introduce some sort of blocking
 template<typename T>
@@ -429,7 +441,10 @@ void Symv
   const float* x, BlasInt incx,
   const float& beta,
         float* y, BlasInt incy )
-{ EL_BLAS(ssymv)( &uplo, &m, &alpha, A, &ALDim, x, &incx, &beta, y, &incy ); }
+{
+    CountSymv<float>( m );
+    EL_BLAS(ssymv)( &uplo, &m, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
+}
 
 void Symv
 ( char uplo, BlasInt m,
@@ -438,7 +453,10 @@ void Symv
   const double* x, BlasInt incx,
   const double& beta,
         double* y, BlasInt incy )
-{ EL_BLAS(dsymv)( &uplo, &m, &alpha, A, &ALDim, x, &incx, &beta, y, &incy ); }
+{
+    CountSymv<double>( m );
+    EL_BLAS(dsymv)( &uplo, &m, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
+}
 
 void Symv
 ( char uplo, BlasInt m,
@@ -449,6 +467,7 @@ void Symv
         scomplex* y, BlasInt incy )
 {
     // Recall that 'csymv' is an LAPACK auxiliary routine
+    CountSymv<scomplex>( m );
     EL_LAPACK(csymv)( &uplo, &m, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
 }
 
@@ -461,6 +480,7 @@ void Symv
         dcomplex* y, BlasInt incy )
 {
     // Recall that 'zsymv' is an LAPACK auxiliary routine
+    CountSymv<dcomplex>( m );
     EL_LAPACK(zsymv)( &uplo, &m, &alpha, A, &ALDim, x, &incx, &beta, y, &incy );
 }
 
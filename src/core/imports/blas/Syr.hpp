@@ -149,28 +149,40 @@ void Her
   const float& alpha,
   const float* x, BlasInt incx,
         float* A, BlasInt ALDim )
-{ EL_BLAS(ssyr)( &uplo, &m, &alpha, x, &incx, A, &ALDim ); }
+{
+    CountSyr<float>( m );
+    EL_BLAS(ssyr)( &uplo, &m, &alpha, x, &incx, A, &ALDim );
+}
 
 void Her
 ( char uplo, BlasInt m,
   const double& alpha,
   const double* x, BlasInt incx,
         double* A, BlasInt ALDim )
-{ EL_BLAS(dsyr)( &uplo, &m, &alpha, x, &incx, A, &ALDim ); }
+{
+    CountSyr<double>( m );
+    EL_BLAS(dsyr)( &uplo, &m, &alpha, x, &incx, A, &ALDim );
+}
 
 void Her
 ( char uplo, BlasInt m,
   const float& alpha,
   const scomplex* x, BlasInt incx,
         scomplex* A, BlasInt ALDim )
-{ EL_BLAS(cher)( &uplo, &m, &alpha, x, &incx, A, &ALDim ); }
+{
+    CountSyr<scomplex>( m );
+    EL_BLAS(cher)( &uplo, &m, &alpha, x, &incx, A, &ALDim );
+}
 
 void Her
 ( char uplo, BlasInt m,
   const double& alpha,
   const dcomplex* x, BlasInt incx,
         dcomplex* A, BlasInt ALDim )
-{ EL_BLAS(zher)( &uplo, &m, &alpha, x, &incx, A, &ALDim ); }
+{
+    CountSyr<dcomplex>( m );
+    EL_BLAS(zher)( &uplo, &m, &alpha, x, &incx, A, &ALDim );
+}
 
 template<typename T>
 void Syr
@@ -275,14 +287,20 @@ void Syr
   const float& alpha,
   const float* x, BlasInt incx,
         float* A, BlasInt ALDim  )
-{ EL_BLAS(ssyr)( &uplo, &m, &alpha, x, &incx, A, &ALDim ); }
+{
+    CountSyr<float>( m );
+    EL_BLAS(ssyr)( &uplo, &m, &alpha, x, &incx, A, &ALDim );
+}
 
 void Syr
 ( char uplo, BlasInt m,
   const double& alpha,
   const double* x, BlasInt incx,
         double* A, BlasInt ALDim )
-{ EL_BLAS(dsyr)( &uplo, &m, &alpha, x, &incx, A, &ALDim ); }
+{
+    CountSyr<double>( m );
+    EL_BLAS(dsyr)( &uplo, &m, &alpha, x, &incx, A, &ALDim );
+}
 
 void Syr
 ( char uplo, BlasInt m,
@@ -291,6 +309,7 @@ void Syr
         scomplex* A, BlasInt ALDim )
 {
     // Recall that 'csyr' is an LAPACK auxiliary routine
+    CountSyr<scomplex>( m );
     EL_LAPACK(csyr)( &uplo, &m, &alpha, x, &incx, A, &ALDim ); 
 }
 
@@ -301,6 +320,7 @@ void Syr
         dcomplex* A, BlasInt ALDim )
 {
     // Recall that 'zsyr' is an LAPACK auxiliary routine
+    CountSyr<dcomplex>( m );
     EL_LAPACK(zsyr)( &uplo, &m, &alpha, x, &incx, A, &ALDim ); 
 }
 
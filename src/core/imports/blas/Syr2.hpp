@@ -185,7 +185,10 @@ void Her2
   const float* x, BlasInt incx, 
   const float* y, BlasInt incy,
         float* A, BlasInt ALDim )
-{ EL_BLAS(ssyr2)( &uplo, &m, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    CountSyr2<float>( m );
+    EL_BLAS(ssyr2)( &uplo, &m, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 void Her2
 ( char uplo, BlasInt m,
@@ -193,7 +196,10 @@ void Her2
   const double* x, BlasInt incx, 
   const double* y, BlasInt incy,
         double* A, BlasInt ALDim )
-{ EL_BLAS(dsyr2)( &uplo, &m, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    CountSyr2<double>( m );
+    EL_BLAS(dsyr2)( &uplo, &m, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 void Her2
 ( char uplo, BlasInt m,
@@ -201,7 +207,10 @@ void Her2
   const scomplex* x, BlasInt incx, 
   const scomplex* y, BlasInt incy,
         scomplex* A, BlasInt ALDim )
-{ EL_BLAS(cher2)( &uplo, &m, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    CountSyr2<scomplex>( m );
+    EL_BLAS(cher2)( &uplo, &m, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 void Her2
 ( char uplo, BlasInt m,
@@ -209,7 +218,10 @@ void Her2
   const dcomplex* x, BlasInt incx, 
   const dcomplex* y, BlasInt incy,
         dcomplex* A, BlasInt ALDim )
-{ EL_BLAS(zher2)( &uplo, &m, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    CountSyr2<dcomplex>( m );
+    EL_BLAS(zher2)( &uplo, &m, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 template<typename T>
 void Syr2
@@ -348,7 +360,10 @@ void Syr2
   const float* x, BlasInt incx,
   const float* y, BlasInt incy,
         float* A, BlasInt ALDim )
-{ EL_BLAS(ssyr2)( &uplo, &m, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    CountSyr2<float>( m );
+    EL_BLAS(ssyr2)( &uplo, &m, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 void Syr2
 ( char uplo, BlasInt m,
@@ -356,7 +371,10 @@ void Syr2
   const double* x, BlasInt incx,
   const double* y, BlasInt incy,
         double* A, BlasInt ALDim )
-{ EL_BLAS(dsyr2)( &uplo, &m, &alpha, x, &incx, y, &incy, A, &ALDim ); }
+{
+    CountSyr2<double>( m );
+    EL_BLAS(dsyr2)( &uplo, &m, &alpha, x, &incx, y, &incy, A, &ALDim );
+}
 
 void Syr2
 ( char uplo, BlasInt m,
@@ -372,6 +390,7 @@ void Syr2
     const char trans = 'T';
     const BlasInt k = 1;
     const scomplex beta = 1.f;
+    CountSyr2<scomplex>( m );
     EL_BLAS(csyr2k)
     ( &uplo, &trans, &m, &k, &alpha, x, &incx, y, &incy, &beta, A, &ALDim );
 }
@@ -390,6 +409,7 @@ void Syr2
     const char trans = 'T';
     const BlasInt k = 1;
     const dcomplex beta = 1.;
+    CountSyr2<dcomplex>( m );
     EL_BLAS(zsyr2k)
     ( &uplo, &trans, &m, &k, &alpha, x, &incx, y, &incy, &beta, A, &ALDim );
 }
@@ -70,6 +70,7 @@ void Her2k
   const Base<T>& beta,
         T* C, BlasInt CLDim )
 {
+    CountSyr2k<T>( n, k );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     if( beta == Base<T>(0) )
@@ -296,6 +297,7 @@ void Her2k
         float* C, BlasInt CLDim )
 {
     const char transFixed = ( trans == 'C' ? 'T' : trans );
+    CountSyr2k<float>( n, k );
     EL_BLAS(ssyr2k)
     ( &uplo, &transFixed, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -311,6 +313,7 @@ void Her2k
         double* C, BlasInt CLDim )
 {
     const char transFixed = ( trans == 'C' ? 'T' : trans );
+    CountSyr2k<double>( n, k );
     EL_BLAS(dsyr2k)
     ( &uplo, &transFixed, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -325,6 +328,7 @@ void Her2k
   const float& beta,
         scomplex* C, BlasInt CLDim )
 {
+    CountSyr2k<scomplex>( n, k );
     EL_BLAS(cher2k)
     ( &uplo, &trans, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -339,6 +343,7 @@ void Her2k
   const double& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    CountSyr2k<dcomplex>( n, k );
     EL_BLAS(zher2k)
     ( &uplo, &trans, &n, &k,
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
@@ -354,6 +359,7 @@ void Syr2k
   const T& beta,
         T* C, BlasInt CLDim )
 {
+    CountSyr2k<T>( n, k );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     if( beta == T(0) )
@@ -566,6 +572,7 @@ void Syr2k
   const float& beta,
         float* C, BlasInt CLDim )
 {
+    CountSyr2k<float>( n, k );
     EL_BLAS(ssyr2k)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -579,6 +586,7 @@ void Syr2k
   const double& beta,
         double* C, BlasInt CLDim )
 {
+    CountSyr2k<double>( n, k );
     EL_BLAS(dsyr2k)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -592,6 +600,7 @@ void Syr2k
   const scomplex& beta,
         scomplex* C, BlasInt CLDim )
 {
+    CountSyr2k<scomplex>( n, k );
     EL_BLAS(csyr2k)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -605,6 +614,7 @@ void Syr2k
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    CountSyr2k<dcomplex>( n, k );
     EL_BLAS(zsyr2k)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
@@ -63,6 +63,7 @@ void Herk
   const Base<T>& beta,
         T* C, BlasInt CLDim )
 {
+    CountSyrk<T>( n, k );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     if( beta == Base<T>(0) )
@@ -249,6 +250,7 @@ void Herk
         float* C, BlasInt CLDim )
 {
     const char transFixed = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    CountSyrk<float>( n, k );
     EL_BLAS(ssyrk)
     ( &uplo, &transFixed, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -262,6 +264,7 @@ void Herk
         double* C, BlasInt CLDim )
 {
     const char transFixed = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    CountSyrk<double>( n, k );
     EL_BLAS(dsyrk)
     ( &uplo, &transFixed, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -274,6 +277,7 @@ void Herk
   const float& beta,
         scomplex* C, BlasInt CLDim )
 {
+    CountSyrk<scomplex>( n, k );
     EL_BLAS(cherk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -286,6 +290,7 @@ void Herk
   const double& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    CountSyrk<dcomplex>( n, k );
     EL_BLAS(zherk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -299,6 +304,7 @@ void Syrk
   const T& beta,
         T* C, BlasInt CLDim )
 {
+    CountSyrk<T>( n, k );
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
     if( beta == T(0) )
@@ -483,6 +489,7 @@ void Syrk
   const float& beta,
         float* C, BlasInt CLDim )
 {
+    CountSyrk<float>( n, k );
     EL_BLAS(ssyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -494,6 +501,7 @@ void Syrk
   const double& beta,
         double* C, BlasInt CLDim )
 {
+    CountSyrk<double>( n, k );
     EL_BLAS(dsyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -505,6 +513,7 @@ void Syrk
   const scomplex& beta,
         scomplex* C, BlasInt CLDim )
 {
+    CountSyrk<scomplex>( n, k );
     EL_BLAS(csyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
@@ -516,6 +525,7 @@ void Syrk
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim )
 {
+    CountSyrk<dcomplex>( n, k );
     EL_BLAS(zsyrk)
     ( &uplo, &trans, &n, &k, &alpha, A, &ALDim, &beta, C, &CLDim );
 }
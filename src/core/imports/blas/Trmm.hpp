@@ -45,6 +45,7 @@ void Trmm
   const T* A, BlasInt ALDim,
         T* B, BlasInt BLDim )
 {
+    CountTrxm<T>( side, m, n );
     const bool onLeft = ( std::toupper(side) == 'L' );
     const bool conjugate = ( std::toupper(trans) == 'C' );
 
@@ -152,6 +153,7 @@ void Trmm
         float* B, BlasInt BLDim )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );    
+    CountTrxm<float>( side, m, n );
     EL_BLAS(strmm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 }
@@ -163,6 +165,7 @@ void Trmm
         double* B, BlasInt BLDim )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );    
+    CountTrxm<double>( side, m, n );
     EL_BLAS(dtrmm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 }
@@ -173,6 +176,7 @@ void Trmm
   const scomplex* A, BlasInt ALDim,
         scomplex* B, BlasInt BLDim )
 {
+    CountTrxm<scomplex>( side, m, n );
     EL_BLAS(ctrmm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 }
@@ -183,6 +187,7 @@ void Trmm
   const dcomplex* A, BlasInt ALDim,
         dcomplex* B, BlasInt BLDim )
 {
+    CountTrxm<dcomplex>( side, m, n );
     EL_BLAS(ztrmm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 }
@@ -204,25 +204,37 @@ void Trmv
 ( char uplo, char trans, char diag, BlasInt m,
   const float* A, BlasInt ALDim,
         float* x, BlasInt incx )
-{ EL_BLAS(strmv)( &uplo, &trans, &diag, &m, A, &ALDim, x, &incx ); }
+{
+    CountTrsv<float>( m );
+    EL_BLAS(strmv)( &uplo, &trans, &diag, &m, A, &ALDim, x, &incx );
+}
 
 void Trmv
 ( char uplo, char trans, char diag, BlasInt m,
   const double* A, BlasInt ALDim,
         double* x, BlasInt incx )
-{ EL_BLAS(dtrmv)( &uplo, &trans, &diag, &m, A, &ALDim, x, &incx ); }
+{
+    CountTrsv<double>( m );
+    EL_BLAS(dtrmv)( &uplo, &trans, &diag, &m, A, &ALDim, x, &incx );
+}
 
 void Trmv
 ( char uplo, char trans, char diag, BlasInt m,
   const scomplex* A, BlasInt ALDim,
         scomplex* x, BlasInt incx )
-{ EL_BLAS(ctrmv)( &uplo, &trans, &diag, &m, A, &ALDim, x, &incx ); }
+{
+    CountTrsv<scomplex>( m );
+    EL_BLAS(ctrmv)( &uplo, &trans, &diag, &m, A, &ALDim, x, &incx );
+}
 
 void Trmv
 ( char uplo, char trans, char diag, BlasInt m,
   const dcomplex* A, BlasInt ALDim,
         dcomplex* x, BlasInt incx )
-{ EL_BLAS(ztrmv)( &uplo, &trans, &diag, &m, A, &ALDim, x, &incx ); }
+{
+    CountTrsv<dcomplex>( m );
+    EL_BLAS(ztrmv)( &uplo, &trans, &diag, &m, A, &ALDim, x, &incx );
+}
 
 } // namespace blas
 } // namespace El
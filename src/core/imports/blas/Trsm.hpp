@@ -38,7 +38,7 @@ namespace El {
 namespace blas {
 
 template<typename F>
-void Trsm
+void TrsmSequential
 ( char side, char uplo, char trans, char unit,
   BlasInt m, BlasInt n,
   const F& alpha,
@@ -293,6 +293,47 @@ void Trsm
         }
     }
 }
+
+template<typename F>
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F& alpha,
+  const F* A, BlasInt ALDim,
+        F* B, BlasInt BLDim )
+{
+    CountTrxm<F>( side, m, n );
+    // The columns of B are independent when solving from the left, and its
+    // rows are independent when solving from the right
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const BlasInt order = ( onLeft ? m : n );
+    const BlasInt splitDim = ( onLeft ? n : m );
+    const int numThreads = FallbackThreads( double(order)*order*splitDim/2 );
+    if( numThreads <= 1 )
+    {
+        TrsmSequential
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
+    const BlasInt numBlocks = Min( splitDim, BlasInt(4*numThreads) );
+#ifdef EL_HYBRID
+    _Pragma("omp parallel for schedule(dynamic) num_threads(numThreads)")
+#endif
+    for( BlasInt block=0; block<numBlocks; ++block )
+    {
+        const BlasInt beg = (block*splitDim) / numBlocks;
+        const BlasInt end = ((block+1)*splitDim) / numBlocks;
+        if( onLeft )
+            TrsmSequential
+            ( side, uplo, trans, unit, m, end-beg,
+              alpha, A, ALDim, &B[beg*BLDim], BLDim );
+        else
+            TrsmSequential
+            ( side, uplo, trans, unit, end-beg, n,
+              alpha, A, ALDim, &B[beg], BLDim );
+    }
+}
+
 #ifdef EL_HAVE_QD
 template void Trsm
 ( char side, char uplo, char trans, char unit,
@@ -356,6 +397,7 @@ void Trsm
         float* B, BlasInt BLDim )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    CountTrxm<float>( side, m, n );
     EL_BLAS(strsm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -368,6 +410,7 @@ void Trsm
         double* B, BlasInt BLDim )
 {
     const char fixedTrans = ( std::toupper(trans) == 'C' ? 'T' : trans );
+    CountTrxm<double>( side, m, n );
     EL_BLAS(dtrsm)
     ( &side, &uplo, &fixedTrans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -379,6 +422,7 @@ void Trsm
   const scomplex* A, BlasInt ALDim,
         scomplex* B, BlasInt BLDim )
 {
+    CountTrxm<scomplex>( side, m, n );
     EL_BLAS(ctrsm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
@@ -390,6 +434,7 @@ void Trsm
   const dcomplex* A, BlasInt ALDim,
         dcomplex* B, BlasInt BLDim )
 {
+    CountTrxm<dcomplex>( side, m, n );
     EL_BLAS(ztrsm)
     ( &side, &uplo, &trans, &unit, &m, &n, &alpha, A, &ALDim, B, &BLDim );
 } 
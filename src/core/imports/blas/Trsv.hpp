@@ -188,25 +188,37 @@ void Trsv
 ( char uplo, char trans, char diag, BlasInt m,
   const float* A, BlasInt ALDim,
         float* x, BlasInt incx )
-{ EL_BLAS(strsv)( &uplo, &trans, &diag, &m, A, &ALDim, x, &incx ); }
+{
+    CountTrsv<float>( m );
+    EL_BLAS(strsv)( &uplo, &trans, &diag, &m, A, &ALDim, x, &incx );
+}
 
 void Trsv
 ( char uplo, char trans, char diag, BlasInt m,
   const double* A, BlasInt ALDim,
         double* x, BlasInt incx )
-{ EL_BLAS(dtrsv)( &uplo, &trans, &diag, &m, A, &ALDim, x, &incx ); }
+{
+    CountTrsv<double>( m );
+    EL_BLAS(dtrsv)( &uplo, &trans, &diag, &m, A, &ALDim, x, &incx );
+}
 
 void Trsv
 ( char uplo, char trans, char diag, BlasInt m,
   const scomplex* A, BlasInt ALDim,
         scomplex* x, BlasInt incx )
-{ EL_BLAS(ctrsv)( &uplo, &trans, &diag, &m, A, &ALDim, x, &incx ); }
+{
+    CountTrsv<scomplex>( m );
+    EL_BLAS(ctrsv)( &uplo, &trans, &diag, &m, A, &ALDim, x, &incx );
+}
 
 void Trsv
 ( char uplo, char trans, char diag, BlasInt m,
   const dcomplex* A, BlasInt ALDim,
         dcomplex* x, BlasInt incx )
-{ EL_BLAS(ztrsv)( &uplo, &trans, &diag, &m, A, &ALDim, x, &incx ); }
+{
+    CountTrsv<dcomplex>( m );
+    EL_BLAS(ztrsv)( &uplo, &trans, &diag, &m, A, &ALDim, x, &incx );
+}
 
 } // namespace blas
 } // namespace El
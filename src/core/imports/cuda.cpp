@@ -0,0 +1,418 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#ifdef EL_HAVE_CUDA
+#include <cuda_runtime.h>
+#include <cublas_v2.h>
+#include <cusolverDn.h>
+
+namespace El {
+namespace cuda {
+
+namespace {
+
+cublasHandle_t blasHandle;
+bool haveBlasHandle = false;
+cusolverDnHandle_t solverHandle;
+bool haveSolverHandle = false;
+
+void Check( cudaError_t error )
+{
+    if( error != cudaSuccess )
+        RuntimeError("CUDA error: ",cudaGetErrorString(error));
+}
+
+void Check( cublasStatus_t status )
+{
+    if( status != CUBLAS_STATUS_SUCCESS )
+        RuntimeError("cuBLAS returned with status ",int(status));
+}
+
+void Check( cusolverStatus_t status )
+{
+    if( status != CUSOLVER_STATUS_SUCCESS )
+        RuntimeError("cuSOLVER returned with status ",int(status));
+}
+
+cublasHandle_t BlasHandle()
+{
+    if( !haveBlasHandle )
+    {
+        Check( cublasCreate( &blasHandle ) );
+        haveBlasHandle = true;
+    }
+    return blasHandle;
+}
+
+cusolverDnHandle_t SolverHandle()
+{
+    if( !haveSolverHandle )
+    {
+        Check( cusolverDnCreate( &solverHandle ) );
+        haveSolverHandle = true;
+    }
+    return solverHandle;
+}
+
+cublasOperation_t ToOperation( char trans, bool conjugate )
+{
+    if( trans == 'N' )
+        return CUBLAS_OP_N;
+    else if( trans == 'T' || !conjugate )
+        return CUBLAS_OP_T;
+    else
+        return CUBLAS_OP_C;
+}
+
+cublasFillMode_t ToFillMode( char uplo )
+{ return uplo == 'L' ? CUBLAS_FILL_MODE_LOWER : CUBLAS_FILL_MODE_UPPER; }
+
+cublasSideMode_t ToSideMode( char side )
+{ return side == 'L' ? CUBLAS_SIDE_LEFT : CUBLAS_SIDE_RIGHT; }
+
+cublasDiagType_t ToDiagType( char diag )
+{ return diag == 'U' ? CUBLAS_DIAG_UNIT : CUBLAS_DIAG_NON_UNIT; }
+
+cuComplex* ToCUDA( scomplex* alpha )
+{ return reinterpret_cast<cuComplex*>(alpha); }
+const cuComplex* ToCUDA( const scomplex* alpha )
+{ return reinterpret_cast<const cuComplex*>(alpha); }
+cuDoubleComplex* ToCUDA( dcomplex* alpha )
+{ return reinterpret_cast<cuDoubleComplex*>(alpha); }
+const cuDoubleComplex* ToCUDA( const dcomplex* alpha )
+{ return reinterpret_cast<const cuDoubleComplex*>(alpha); }
+
+void Copy2D
+( size_t height, size_t width, size_t entrySize,
+  const void* A, size_t ALDim, void* B, size_t BLDim, cudaMemcpyKind kind )
+{
+    if( height == 0 || width == 0 )
+        return;
+    Check
+    ( cudaMemcpy2D
+      ( B, BLDim*entrySize, A, ALDim*entrySize,
+        height*entrySize, width, kind ) );
+}
+
+template<typename F,typename BufferSizeFunc,typename PotrfFunc>
+void CholeskyHelper
+( char uplo, BlasInt n, F* A, BlasInt ALDim,
+  BufferSizeFunc bufferSize, PotrfFunc potrf )
+{
+    auto handle = SolverHandle();
+    const cublasFillMode_t fill = ToFillMode( uplo );
+    int workSize;
+    Check( bufferSize( handle, fill, int(n), A, int(ALDim), &workSize ) );
+    F* work = static_cast<F*>( Allocate( (workSize+1)*sizeof(F) ) );
+    int* infoDevice = reinterpret_cast<int*>( work+workSize );
+    cusolverStatus_t status =
+      potrf( handle, fill, int(n), A, int(ALDim), work, workSize, infoDevice );
+    int info;
+    CopyDeviceToHost( 1, 1, sizeof(int), infoDevice, 1, &info, 1 );
+    Free( work );
+    Check( status );
+    if( info > 0 )
+        throw NonHPDMatrixException();
+    else if( info < 0 )
+        RuntimeError("potrf returned with info=",info);
+}
+
+} // anonymous namespace
+
+int NumDevices()
+{
+    int numDevices;
+    Check( cudaGetDeviceCount( &numDevices ) );
+    return numDevices;
+}
+
+int Device()
+{
+    int device;
+    Check( cudaGetDevice( &device ) );
+    return device;
+}
+
+void SetDevice( int device )
+{
+    EL_DEBUG_CSE
+    Finalize();
+    Check( cudaSetDevice( device ) );
+}
+
+void Synchronize() { Check( cudaDeviceSynchronize() ); }
+
+void Finalize()
+{
+    if( haveBlasHandle )
+    {
+        cublasDestroy( blasHandle );
+        haveBlasHandle = false;
+    }
+    if( haveSolverHandle )
+    {
+        cusolverDnDestroy( solverHandle );
+        haveSolverHandle = false;
+    }
+}
+
+void* Allocate( size_t numBytes, bool managed )
+{
+    EL_DEBUG_CSE
+    void* ptr = nullptr;
+    if( numBytes == 0 )
+        return ptr;
+    if( managed )
+        Check( cudaMallocManaged( &ptr, numBytes ) );
+    else
+        Check( cudaMalloc( &ptr, numBytes ) );
+    return ptr;
+}
+
+void Free( void* ptr )
+{
+    if( ptr != nullptr )
+        cudaFree( ptr );
+}
+
+void CopyHostToDevice
+( size_t height, size_t width, size_t entrySize,
+  const void* A, size_t ALDim, void* B, size_t BLDim )
+{
+    EL_DEBUG_CSE
+    Copy2D
+    ( height, width, entrySize, A, ALDim, B, BLDim, cudaMemcpyHostToDevice );
+}
+
+void CopyDeviceToHost
+( size_t height, size_t width, size_t entrySize,
+  const void* A, size_t ALDim, void* B, size_t BLDim )
+{
+    EL_DEBUG_CSE
+    Copy2D
+    ( height, width, entrySize, A, ALDim, B, BLDim, cudaMemcpyDeviceToHost );
+}
+
+void CopyDeviceToDevice
+( size_t height, size_t width, size_t entrySize,
+  const void* A, size_t ALDim, void* B, size_t BLDim )
+{
+    EL_DEBUG_CSE
+    Copy2D
+    ( height, width, entrySize, A, ALDim, B, BLDim,
+      cudaMemcpyDeviceToDevice );
+}
+
+// cuBLAS
+// ======
+
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const float& alpha,
+  const float* A, BlasInt ALDim,
+  const float* B, BlasInt BLDim,
+  const float& beta,
+        float* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    Check
+    ( cublasSgemm
+      ( BlasHandle(), ToOperation(transA,false), ToOperation(transB,false),
+        int(m), int(n), int(k), &alpha, A, int(ALDim), B, int(BLDim),
+        &beta, C, int(CLDim) ) );
+}
+
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const double& alpha,
+  const double* A, BlasInt ALDim,
+  const double* B, BlasInt BLDim,
+  const double& beta,
+        double* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    Check
+    ( cublasDgemm
+      ( BlasHandle(), ToOperation(transA,false), ToOperation(transB,false),
+        int(m), int(n), int(k), &alpha, A, int(ALDim), B, int(BLDim),
+        &beta, C, int(CLDim) ) );
+}
+
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const scomplex& alpha,
+  const scomplex* A, BlasInt ALDim,
+  const scomplex* B, BlasInt BLDim,
+  const scomplex& beta,
+        scomplex* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    Check
+    ( cublasCgemm
+      ( BlasHandle(), ToOperation(transA,true), ToOperation(transB,true),
+        int(m), int(n), int(k), ToCUDA(&alpha), ToCUDA(A), int(ALDim),
+        ToCUDA(B), int(BLDim), ToCUDA(&beta), ToCUDA(C), int(CLDim) ) );
+}
+
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const dcomplex& alpha,
+  const dcomplex* A, BlasInt ALDim,
+  const dcomplex* B, BlasInt BLDim,
+  const dcomplex& beta,
+        dcomplex* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    Check
+    ( cublasZgemm
+      ( BlasHandle(), ToOperation(transA,true), ToOperation(transB,true),
+        int(m), int(n), int(k), ToCUDA(&alpha), ToCUDA(A), int(ALDim),
+        ToCUDA(B), int(BLDim), ToCUDA(&beta), ToCUDA(C), int(CLDim) ) );
+}
+
+void Trsm
+( char side, char uplo, char trans, char diag, BlasInt m, BlasInt n,
+  const float& alpha, const float* A, BlasInt ALDim,
+                            float* B, BlasInt BLDim )
+{
+    EL_DEBUG_CSE
+    Check
+    ( cublasStrsm
+      ( BlasHandle(), ToSideMode(side), ToFillMode(uplo),
+        ToOperation(trans,false), ToDiagType(diag), int(m), int(n),
+        &alpha, A, int(ALDim), B, int(BLDim) ) );
+}
+
+void Trsm
+( char side, char uplo, char trans, char diag, BlasInt m, BlasInt n,
+  const double& alpha, const double* A, BlasInt ALDim,
+                             double* B, BlasInt BLDim )
+{
+    EL_DEBUG_CSE
+    Check
+    ( cublasDtrsm
+      ( BlasHandle(), ToSideMode(side), ToFillMode(uplo),
+        ToOperation(trans,false), ToDiagType(diag), int(m), int(n),
+        &alpha, A, int(ALDim), B, int(BLDim) ) );
+}
+
+void Trsm
+( char side, char uplo, char trans, char diag, BlasInt m, BlasInt n,
+  const scomplex& alpha, const scomplex* A, BlasInt ALDim,
+                               scomplex* B, BlasInt BLDim )
+{
+    EL_DEBUG_CSE
+    Check
+    ( cublasCtrsm
+      ( BlasHandle(), ToSideMode(side), ToFillMode(uplo),
+        ToOperation(trans,true), ToDiagType(diag), int(m), int(n),
+        ToCUDA(&alpha), ToCUDA(A), int(ALDim), ToCUDA(B), int(BLDim) ) );
+}
+
+void Trsm
+( char side, char uplo, char trans, char diag, BlasInt m, BlasInt n,
+  const dcomplex& alpha, const dcomplex* A, BlasInt ALDim,
+                               dcomplex* B, BlasInt BLDim )
+{
+    EL_DEBUG_CSE
+    Check
+    ( cublasZtrsm
+      ( BlasHandle(), ToSideMode(side), ToFillMode(uplo),
+        ToOperation(trans,true), ToDiagType(diag), int(m), int(n),
+        ToCUDA(&alpha), ToCUDA(A), int(ALDim), ToCUDA(B), int(BLDim) ) );
+}
+
+void Herk
+( char uplo, char trans, BlasInt n, BlasInt k,
+  const float& alpha, const float* A, BlasInt ALDim,
+  const float& beta,        float* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    Check
+    ( cublasSsyrk
+      ( BlasHandle(), ToFillMode(uplo), ToOperation(trans,false),
+        int(n), int(k), &alpha, A, int(ALDim), &beta, C, int(CLDim) ) );
+}
+
+void Herk
+( char uplo, char trans, BlasInt n, BlasInt k,
+  const double& alpha, const double* A, BlasInt ALDim,
+  const double& beta,        double* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    Check
+    ( cublasDsyrk
+      ( BlasHandle(), ToFillMode(uplo), ToOperation(trans,false),
+        int(n), int(k), &alpha, A, int(ALDim), &beta, C, int(CLDim) ) );
+}
+
+void Herk
+( char uplo, char trans, BlasInt n, BlasInt k,
+  const float& alpha, const scomplex* A, BlasInt ALDim,
+  const float& beta,        scomplex* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    Check
+    ( cublasCherk
+      ( BlasHandle(), ToFillMode(uplo), ToOperation(trans,true),
+        int(n), int(k), &alpha, ToCUDA(A), int(ALDim),
+        &beta, ToCUDA(C), int(CLDim) ) );
+}
+
+void Herk
+( char uplo, char trans, BlasInt n, BlasInt k,
+  const double& alpha, const dcomplex* A, BlasInt ALDim,
+  const double& beta,        dcomplex* C, BlasInt CLDim )
+{
+    EL_DEBUG_CSE
+    Check
+    ( cublasZherk
+      ( BlasHandle(), ToFillMode(uplo), ToOperation(trans,true),
+        int(n), int(k), &alpha, ToCUDA(A), int(ALDim),
+        &beta, ToCUDA(C), int(CLDim) ) );
+}
+
+// cuSOLVER
+// ========
+
+void Cholesky( char uplo, BlasInt n, float* A, BlasInt ALDim )
+{
+    EL_DEBUG_CSE
+    CholeskyHelper
+    ( uplo, n, A, ALDim, cusolverDnSpotrf_bufferSize, cusolverDnSpotrf );
+}
+
+void Cholesky( char uplo, BlasInt n, double* A, BlasInt ALDim )
+{
+    EL_DEBUG_CSE
+    CholeskyHelper
+    ( uplo, n, A, ALDim, cusolverDnDpotrf_bufferSize, cusolverDnDpotrf );
+}
+
+void Cholesky( char uplo, BlasInt n, scomplex* A, BlasInt ALDim )
+{
+    EL_DEBUG_CSE
+    CholeskyHelper
+    ( uplo, n, ToCUDA(A), ALDim,
+      cusolverDnCpotrf_bufferSize, cusolverDnCpotrf );
+}
+
+void Cholesky( char uplo, BlasInt n, dcomplex* A, BlasInt ALDim )
+{
+    EL_DEBUG_CSE
+    CholeskyHelper
+    ( uplo, n, ToCUDA(A), ALDim,
+      cusolverDnZpotrf_bufferSize, cusolverDnZpotrf );
+}
+
+} // namespace cuda
+} // namespace El
+
+#endif // ifdef EL_HAVE_CUDA
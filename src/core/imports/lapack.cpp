@@ -1917,7 +1917,8 @@ void Hessenberg
       &info );
     workSize = workDummy;
 
-    // Reduce to Hessenberg form
+    // Reduce to Hessenberg form (roughly 5 n^3 / 3 multiply-adds)
+    CountKernel<float>( 5.*n*n*n/3, 2.*n*n );
     vector<float> work( workSize );
     EL_LAPACK(sgehrd)
     ( &n, &ilo, &ihi,
@@ -1945,7 +1946,8 @@ void Hessenberg
       &info );
     workSize = workDummy;
 
-    // Reduce to Hessenberg form
+    // Reduce to Hessenberg form (roughly 5 n^3 / 3 multiply-adds)
+    CountKernel<double>( 5.*n*n*n/3, 2.*n*n );
     vector<double> work( workSize );
     EL_LAPACK(dgehrd)
     ( &n, &ilo, &ihi,
@@ -1973,7 +1975,8 @@ void Hessenberg
       &info );
     workSize = workDummy.real();
 
-    // Reduce to Hessenberg form
+    // Reduce to Hessenberg form (roughly 5 n^3 / 3 multiply-adds)
+    CountKernel<scomplex>( 5.*n*n*n/3, 2.*n*n );
     vector<scomplex> work( workSize );
     EL_LAPACK(cgehrd)
     ( &n, &ilo, &ihi,
@@ -2001,7 +2004,8 @@ void Hessenberg
       &info );
     workSize = workDummy.real();
 
-    // Reduce to Hessenberg form
+    // Reduce to Hessenberg form (roughly 5 n^3 / 3 multiply-adds)
+    CountKernel<dcomplex>( 5.*n*n*n/3, 2.*n*n );
     vector<dcomplex> work( workSize );
     EL_LAPACK(zgehrd)
     ( &n, &ilo, &ihi,
@@ -2032,7 +2036,8 @@ void HessenbergGenerateUnitary
       &info );
     workSize = workDummy;
 
-    // Generate the unitary matrix
+    // Generate the unitary matrix (roughly 2 n^3 / 3 multiply-adds)
+    CountKernel<float>( 2.*n*n*n/3, 2.*n*n );
     vector<float> work( workSize );
     EL_LAPACK(sorghr)
     ( &n, &ilo, &ihi,
@@ -2060,7 +2065,8 @@ void HessenbergGenerateUnitary
       &info );
     workSize = workDummy;
 
-    // Generate the unitary matrix
+    // Generate the unitary matrix (roughly 2 n^3 / 3 multiply-adds)
+    CountKernel<double>( 2.*n*n*n/3, 2.*n*n );
     vector<double> work( workSize );
     EL_LAPACK(dorghr)
     ( &n, &ilo, &ihi,
@@ -2088,7 +2094,8 @@ void HessenbergGenerateUnitary
       &info );
     workSize = workDummy.real();
 
-    // Generate the unitary matrix
+    // Generate the unitary matrix (roughly 2 n^3 / 3 multiply-adds)
+    CountKernel<scomplex>( 2.*n*n*n/3, 2.*n*n );
     vector<scomplex> work( workSize );
     EL_LAPACK(cunghr)
     ( &n, &ilo, &ihi,
@@ -2116,7 +2123,8 @@ void HessenbergGenerateUnitary
       &info );
     workSize = workDummy.real();
 
-    // Generate the unitary matrix
+    // Generate the unitary matrix (roughly 2 n^3 / 3 multiply-adds)
+    CountKernel<dcomplex>( 2.*n*n*n/3, 2.*n*n );
     vector<dcomplex> work( workSize );
     EL_LAPACK(zunghr)
     ( &n, &ilo, &ihi,
@@ -154,6 +154,45 @@ void EL_BLAS(zgemmt)
         dcomplex* C, const BlasInt* CLDim );
 #endif
 
+#ifdef EL_HAVE_MKL_BATCH
+void EL_BLAS(sgemm_batch)
+( const char* transA, const char* transB,
+  const BlasInt* m, const BlasInt* n, const BlasInt* k,
+  const float* alpha,
+  const float** A, const BlasInt* ALDim,
+  const float** B, const BlasInt* BLDim,
+  const float* beta,
+        float** C, const BlasInt* CLDim,
+  const BlasInt* groupCount, const BlasInt* groupSizes );
+void EL_BLAS(dgemm_batch)
+( const char* transA, const char* transB,
+  const BlasInt* m, const BlasInt* n, const BlasInt* k,
+  const double* alpha,
+  const double** A, const BlasInt* ALDim,
+  const double** B, const BlasInt* BLDim,
+  const double* beta,
+        double** C, const BlasInt* CLDim,
+  const BlasInt* groupCount, const BlasInt* groupSizes );
+void EL_BLAS(cgemm_batch)
+( const char* transA, const char* transB,
+  const BlasInt* m, const BlasInt* n, const BlasInt* k,
+  const scomplex* alpha,
+  const scomplex** A, const BlasInt* ALDim,
+  const scomplex** B, const BlasInt* BLDim,
+  const scomplex* beta,
+        scomplex** C, const BlasInt* CLDim,
+  const BlasInt* groupCount, const BlasInt* groupSizes );
+void EL_BLAS(zgemm_batch)
+( const char* transA, const char* transB,
+  const BlasInt* m, const BlasInt* n, const BlasInt* k,
+  const dcomplex* alpha,
+  const dcomplex** A, const BlasInt* ALDim,
+  const dcomplex** B, const BlasInt* BLDim,
+  const dcomplex* beta,
+        dcomplex** C, const BlasInt* CLDim,
+  const BlasInt* groupCount, const BlasInt* groupSizes );
+#endif
+
 } // extern "C"
 
 namespace El {
@@ -458,6 +497,77 @@ void Trrk
 }
 #endif
 
+#ifdef EL_HAVE_MKL_BATCH
+void GemmBatch
+( const char* transA, const char* transB,
+  const BlasInt* m, const BlasInt* n, const BlasInt* k,
+  const float* alpha,
+  const float** A, const BlasInt* ALDim,
+  const float** B, const BlasInt* BLDim,
+  const float* beta,
+        float** C, const BlasInt* CLDim,
+  BlasInt batchSize )
+{
+    vector<BlasInt> groupSizes( batchSize, 1 );
+    EL_BLAS(sgemm_batch)
+    ( transA, transB, m, n, k,
+      alpha, A, ALDim, B, BLDim,
+      beta,  C, CLDim,
+      &batchSize, groupSizes.data() );
+}
+void GemmBatch
+( const char* transA, const char* transB,
+  const BlasInt* m, const BlasInt* n, const BlasInt* k,
+  const double* alpha,
+  const double** A, const BlasInt* ALDim,
+  const double** B, const BlasInt* BLDim,
+  const double* beta,
+        double** C, const BlasInt* CLDim,
+  BlasInt batchSize )
+{
+    vector<BlasInt> groupSizes( batchSize, 1 );
+    EL_BLAS(dgemm_batch)
+    ( transA, transB, m, n, k,
+      alpha, A, ALDim, B, BLDim,
+      beta,  C, CLDim,
+      &batchSize, groupSizes.data() );
+}
+void GemmBatch
+( const char* transA, const char* transB,
+  const BlasInt* m, const BlasInt* n, const BlasInt* k,
+  const scomplex* alpha,
+  const scomplex** A, const BlasInt* ALDim,
+  const scomplex** B, const BlasInt* BLDim,
+  const scomplex* beta,
+        scomplex** C, const BlasInt* CLDim,
+  BlasInt batchSize )
+{
+    vector<BlasInt> groupSizes( batchSize, 1 );
+    EL_BLAS(cgemm_batch)
+    ( transA, transB, m, n, k,
+      alpha, A, ALDim, B, BLDim,
+      beta,  C, CLDim,
+      &batchSize, groupSizes.data() );
+}
+void GemmBatch
+( const char* transA, const char* transB,
+  const BlasInt* m, const BlasInt* n, const BlasInt* k,
+  const dcomplex* alpha,
+  const dcomplex** A, const BlasInt* ALDim,
+  const dcomplex** B, const BlasInt* BLDim,
+  const dcomplex* beta,
+        dcomplex** C, const BlasInt* CLDim,
+  BlasInt batchSize )
+{
+    vector<BlasInt> groupSizes( batchSize, 1 );
+    EL_BLAS(zgemm_batch)
+    ( transA, transB, m, n, k,
+      alpha, A, ALDim, B, BLDim,
+      beta,  C, CLDim,
+      &batchSize, groupSizes.data() );
+}
+#endif // ifdef EL_HAVE_MKL_BATCH
+
 } // namespace mkl
 } // namespace El
 
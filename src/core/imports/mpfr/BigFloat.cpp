@@ -9,6 +9,12 @@
 #include <El-lite.hpp>
 #ifdef EL_HAVE_MPC
 
+namespace {
+
+bool contiguousStorage = true;
+
+} // anonymous namespace
+
 namespace El {
 
 void BigFloat::SetNumLimbs( mpfr_prec_t prec )
@@ -20,6 +26,7 @@ void BigFloat::Init( mpfr_prec_t prec )
 {
     mpfr_init2( mpfrFloat_, prec );
     SetNumLimbs( prec );
+    ownsLimbs_ = true;
 }
 
 mpfr_ptr BigFloat::Pointer()
@@ -39,13 +46,24 @@ mpfr_prec_t BigFloat::Precision() const
 
 void BigFloat::SetPrecision( mpfr_prec_t prec )
 {
-    mpfr_set_prec( mpfrFloat_, prec ); 
-    SetNumLimbs( prec );
+    if( ownsLimbs_ )
+    {
+        mpfr_set_prec( mpfrFloat_, prec ); 
+        SetNumLimbs( prec );
+    }
+    else
+    {
+        // The borrowed limbs cannot be resized, so allocate our own
+        Init( prec );
+    }
 }
 
 size_t BigFloat::NumLimbs() const
 { return numLimbs_; }
 
+bool BigFloat::OwnsLimbs() const
+{ return ownsLimbs_; }
+
 BigFloat::BigFloat()
 {
     EL_DEBUG_CSE
@@ -223,15 +241,33 @@ BigFloat::BigFloat( const std::string& str, int base, mpfr_prec_t prec )
 BigFloat::BigFloat( BigFloat&& a )
 {
     EL_DEBUG_CSE
-    Pointer()->_mpfr_d = 0;
-    mpfr_swap( Pointer(), a.Pointer() );
-    std::swap( numLimbs_, a.numLimbs_ );
+    if( a.ownsLimbs_ )
+    {
+        Pointer()->_mpfr_d = 0;
+        ownsLimbs_ = true;
+        mpfr_swap( Pointer(), a.Pointer() );
+        std::swap( numLimbs_, a.numLimbs_ );
+    }
+    else
+    {
+        Init( a.Precision() );
+        mpfr_set( Pointer(), a.LockedPointer(), mpfr::RoundingMode() );
+    }
+}
+
+BigFloat::BigFloat( mp_limb_t* limbs, mpfr_prec_t prec )
+{
+    EL_DEBUG_CSE
+    mpfr_custom_init( limbs, prec );
+    mpfr_custom_init_set( Pointer(), MPFR_ZERO_KIND, 0, prec, limbs );
+    SetNumLimbs( prec );
+    ownsLimbs_ = false;
 }
 
 BigFloat::~BigFloat()
 {
     EL_DEBUG_CSE
-    if( Pointer()->_mpfr_d != 0 )
+    if( ownsLimbs_ && Pointer()->_mpfr_d != 0 )
         mpfr_clear( Pointer() );
 }
 
@@ -395,8 +431,16 @@ BigFloat& BigFloat::operator=( const Quad& a )
 BigFloat& BigFloat::operator=( BigFloat&& a )
 {
     EL_DEBUG_CSE
-    mpfr_swap( Pointer(), a.Pointer() );
-    std::swap( numLimbs_, a.numLimbs_ );
+    if( ownsLimbs_ && a.ownsLimbs_ )
+    {
+        mpfr_swap( Pointer(), a.Pointer() );
+        std::swap( numLimbs_, a.numLimbs_ );
+    }
+    else
+    {
+        // Exchanging limbs would move entries out of (or into) an arena
+        mpfr_set( Pointer(), a.LockedPointer(), mpfr::RoundingMode() );
+    }
     return *this;
 }
 
@@ -1405,6 +1449,58 @@ std::istream& operator>>( std::istream& is, BigFloat& alpha )
     return is;
 }
 
+namespace mpfr {
+
+void SetContiguousStorage( bool contiguous )
+{ ::contiguousStorage = contiguous; }
+
+bool ContiguousStorage()
+{ return ::contiguousStorage; }
+
+BigFloat* NewArray( size_t size )
+{
+    EL_DEBUG_CSE
+    const mpfr_prec_t prec = Precision();
+    // The arena of limbs (if any) directly follows the entries
+    const size_t numLimbs = ( ::contiguousStorage ? NumLimbs() : 0 );
+    void* raw =
+      ::operator new
+      ( size*sizeof(BigFloat) + size*numLimbs*sizeof(mp_limb_t) );
+    BigFloat* ptr = static_cast<BigFloat*>( raw );
+    mp_limb_t* limbs = reinterpret_cast<mp_limb_t*>( ptr+size );
+    size_t numConstructed = 0;
+    try
+    {
+        for( ; numConstructed<size; ++numConstructed )
+        {
+            if( numLimbs > 0 )
+                new (&ptr[numConstructed])
+                  BigFloat( &limbs[numConstructed*numLimbs], prec );
+            else
+                new (&ptr[numConstructed]) BigFloat;
+        }
+    }
+    catch( ... )
+    {
+        for( size_t i=0; i<numConstructed; ++i )
+            ptr[i].~BigFloat();
+        ::operator delete( raw );
+        throw;
+    }
+    return ptr;
+}
+
+void DeleteArray( BigFloat* ptr, size_t size ) EL_NO_EXCEPT
+{
+    if( ptr == nullptr )
+        return;
+    for( size_t i=0; i<size; ++i )
+        ptr[i].~BigFloat();
+    ::operator delete( ptr );
+}
+
+} // namespace mpfr
+
 } // namespace El
 
 #endif // ifdef EL_HAVE_MPC
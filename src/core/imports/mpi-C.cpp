@@ -51,4 +51,7 @@ ElError ElMPIWorldSize( int* size )
 ElError ElMPITime( double* time )
 { EL_TRY( *time = El::mpi::Time() ) }
 
+ElError ElMPIThreadMultiple( bool* multiple )
+{ EL_TRY( *multiple = El::mpi::QueryThread() == El::mpi::THREAD_MULTIPLE ) }
+
 } // extern "C"
@@ -32,6 +32,34 @@ SafeMpi( int mpiError ) EL_NO_RELEASE_EXCEPT
     )
 }
 
+// The total number of entries described by a communicator-sized array of
+// counts
+inline double TotalCount( const int* counts, El::mpi::Comm comm )
+{
+    const int commSize = El::mpi::Size( comm );
+    double total = 0;
+    for( int q=0; q<commSize; ++q )
+        total += counts[q];
+    return total;
+}
+
+// The total number of entries described by an array of counts for each
+// neighbor of a process
+inline double TotalCount( const int* counts, const std::vector<int>& neighbors )
+{
+    double total = 0;
+    for( std::size_t k=0; k<neighbors.size(); ++k )
+        total += counts[k];
+    return total;
+}
+
+// Attribute the enclosing collective to the profile (the byte counts are
+// only evaluated when profiling is enabled)
+#define EL_MPI_PROFILE(collective,comm,bytesSent,bytesRecv) \
+    profile::Scope profileScope( collective, comm ); \
+    if( profileScope.Active() ) \
+        profileScope.SetBytes( bytesSent, bytesRecv )
+
 template<typename T>
 MPI_Op NativeOp( const El::mpi::Op& op )
 {
@@ -182,6 +210,100 @@ void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT
     SafeMpi( MPI_Comm_free( &comm.comm ) );
 }
 
+void SplitShared( Comm comm, int key, Comm& nodeComm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI3_SHARED_MEMORY
+    SafeMpi
+    ( MPI_Comm_split_type
+      ( comm.comm, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL,
+        &nodeComm.comm ) );
+#else
+    SafeMpi( MPI_Comm_split( comm.comm, Rank(comm), key, &nodeComm.comm ) );
+#endif
+}
+
+void CreateNeighborhood
+( Comm comm, const vector<int>& neighbors, Comm& neighborComm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI3_NEIGHBORHOOD_COLLECTIVES
+    // Preserve the process ordering so that ranks within 'comm' remain valid
+    const int numNeighbors = neighbors.size();
+    SafeMpi
+    ( MPI_Dist_graph_create_adjacent
+      ( comm.comm,
+        numNeighbors, const_cast<int*>(neighbors.data()), MPI_UNWEIGHTED,
+        numNeighbors, const_cast<int*>(neighbors.data()), MPI_UNWEIGHTED,
+        MPI_INFO_NULL, 0, &neighborComm.comm ) );
+#else
+    SafeMpi( MPI_Comm_dup( comm.comm, &neighborComm.comm ) );
+#endif
+}
+
+bool HaveSharedMemory() EL_NO_EXCEPT
+{
+#ifdef EL_HAVE_MPI3_SHARED_MEMORY
+    return true;
+#else
+    return false;
+#endif
+}
+
+void* AllocateShared
+( size_t numBytes, Comm nodeComm, Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI3_SHARED_MEMORY
+    void* base;
+    SafeMpi
+    ( MPI_Win_allocate_shared
+      ( Aint(numBytes), 1, MPI_INFO_NULL, nodeComm.comm, &base,
+        &window.win ) );
+    SafeMpi( MPI_Win_lock_all( MPI_MODE_NOCHECK, window.win ) );
+    return base;
+#else
+    LogicError("Shared-memory windows require MPI-3");
+    return nullptr;
+#endif
+}
+
+void* SharedQuery( Window window, int rank ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI3_SHARED_MEMORY
+    Aint numBytes;
+    int dispUnit;
+    void* base;
+    SafeMpi
+    ( MPI_Win_shared_query( window.win, rank, &numBytes, &dispUnit, &base ) );
+    return base;
+#else
+    LogicError("Shared-memory windows require MPI-3");
+    return nullptr;
+#endif
+}
+
+void WindowSync( Window window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI3_SHARED_MEMORY
+    SafeMpi( MPI_Win_sync( window.win ) );
+#endif
+}
+
+void Free( Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MPI3_SHARED_MEMORY
+    if( window.win == MPI_WIN_NULL )
+        return;
+    SafeMpi( MPI_Win_unlock_all( window.win ) );
+    SafeMpi( MPI_Win_free( &window.win ) );
+#endif
+}
+
 bool Congruent( Comm comm1, Comm comm2 ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
@@ -201,6 +323,22 @@ EL_NO_RELEASE_EXCEPT
 #endif
 }
 
+void SetName( Comm comm, const string& name ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_Comm_set_name( comm.comm, const_cast<char*>(name.c_str()) ) );
+}
+
+string GetName( Comm comm ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    char name[MPI_MAX_OBJECT_NAME];
+    int length;
+    SafeMpi( MPI_Comm_get_name( comm.comm, name, &length ) );
+    return string( name, length );
+}
+
 // Cartesian communicator routines
 // ===============================
 
@@ -398,6 +536,7 @@ void Translate
 void Barrier( Comm comm ) EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Barrier",comm,0,0);
     SafeMpi( MPI_Barrier( comm.comm ) );
 }
 
@@ -915,6 +1054,115 @@ T IRecv( int from, Comm comm, Request<T>& request )
 EL_NO_RELEASE_EXCEPT
 { return TaggedIRecv<T>( from, ANY_TAG, comm, request ); }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void TaggedSendInit
+( const Real* buf, int count, int to, int tag, Comm comm,
+  Request<Real>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_Send_init
+      ( const_cast<Real*>(buf), count, TypeMap<Real>(), to,
+        tag, comm.comm, &request.backend ) );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void TaggedSendInit
+( const Complex<Real>* buf, int count, int to, int tag, Comm comm,
+  Request<Complex<Real>>& request ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( MPI_Send_init
+      ( const_cast<Complex<Real>*>(buf), 2*count,
+        TypeMap<Real>(), to, tag, comm.comm, &request.backend ) );
+#else
+    SafeMpi
+    ( MPI_Send_init
+      ( const_cast<Complex<Real>*>(buf), count,
+        TypeMap<Complex<Real>>(), to, tag, comm.comm, &request.backend ) );
+#endif
+}
+
+template<typename T>
+void SendInit
+( const T* buf, int count, int to, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT
+{ TaggedSendInit( buf, count, to, 0, comm, request ); }
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void TaggedRecvInit
+( Real* buf, int count, int from, int tag, Comm comm, Request<Real>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi
+    ( MPI_Recv_init
+      ( buf, count, TypeMap<Real>(), from, tag, comm.comm, &request.backend ) );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void TaggedRecvInit
+( Complex<Real>* buf, int count, int from, int tag, Comm comm,
+  Request<Complex<Real>>& request )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( MPI_Recv_init
+      ( buf, 2*count, TypeMap<Real>(), from, tag, comm.comm,
+        &request.backend ) );
+#else
+    SafeMpi
+    ( MPI_Recv_init
+      ( buf, count, TypeMap<Complex<Real>>(), from, tag, comm.comm,
+        &request.backend ) );
+#endif
+}
+
+template<typename T>
+void RecvInit( T* buf, int count, int from, Comm comm, Request<T>& request )
+EL_NO_RELEASE_EXCEPT
+{ TaggedRecvInit( buf, count, from, 0, comm, request ); }
+
+template<typename T>
+void Start( Request<T>& request ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Start( &request.backend ) );
+}
+
+template<typename T>
+void StartAll( int numRequests, Request<T>* requests ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+#ifndef EL_MPI_REQUEST_IS_NOT_POINTER
+    vector<MPI_Request> backends( numRequests );
+    for( Int j=0; j<numRequests; ++j )
+        backends[j] = requests[j].backend;
+    SafeMpi( MPI_Startall( numRequests, backends.data() ) );
+    for( Int j=0; j<numRequests; ++j )
+        requests[j].backend = backends[j];
+#else
+    for( Int j=0; j<numRequests; ++j )
+        SafeMpi( MPI_Start( &requests[j].backend ) );
+#endif
+}
+
+template<typename T>
+void Free( Request<T>& request ) EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    SafeMpi( MPI_Request_free( &request.backend ) );
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void TaggedSendRecv
@@ -1063,6 +1311,10 @@ void Broadcast( Real* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Broadcast",comm,
+     ( Rank(comm)==root ? count*sizeof(Real) : 0 ),
+     ( Rank(comm)==root ? 0 : count*sizeof(Real) ));
     if( Size(comm) == 1 || count == 0 )
         return;
     SafeMpi( MPI_Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
@@ -1074,6 +1326,10 @@ void Broadcast( Complex<Real>* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Broadcast",comm,
+     ( Rank(comm)==root ? count*sizeof(Complex<Real>) : 0 ),
+     ( Rank(comm)==root ? 0 : count*sizeof(Complex<Real>) ));
     if( Size(comm) == 1 )
         return;
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -1090,6 +1346,10 @@ void Broadcast( T* buf, int count, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Broadcast",comm,
+     ( Rank(comm)==root ? count*sizeof(T) : 0 ),
+     ( Rank(comm)==root ? 0 : count*sizeof(T) ));
     if( Size(comm) == 1 || count == 0 )
         return;
     std::vector<byte> packedBuf;
@@ -1110,6 +1370,10 @@ void IBroadcast
 ( Real* buf, int count, int root, Comm comm, Request<Real>& request )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("IBroadcast",comm,
+     ( Rank(comm)==root ? count*sizeof(Real) : 0 ),
+     ( Rank(comm)==root ? 0 : count*sizeof(Real) ));
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
     ( MPI_Ibcast
@@ -1126,6 +1390,10 @@ void IBroadcast
   Request<Complex<Real>>& request )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("IBroadcast",comm,
+     ( Rank(comm)==root ? count*sizeof(Complex<Real>) : 0 ),
+     ( Rank(comm)==root ? 0 : count*sizeof(Complex<Real>) ));
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -1149,6 +1417,10 @@ void IBroadcast
 ( T* buf, int count, int root, Comm comm, Request<T>& request )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("IBroadcast",comm,
+     ( Rank(comm)==root ? count*sizeof(T) : 0 ),
+     ( Rank(comm)==root ? 0 : count*sizeof(T) ));
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     request.receivingPacked = true;
     request.recvCount = count;
@@ -1175,6 +1447,10 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Gather",comm,
+     sc*sizeof(Real),
+     ( Rank(comm)==root ? rc*Size(comm)*sizeof(Real) : 0 ));
     SafeMpi
     ( MPI_Gather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1189,6 +1465,10 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Gather",comm,
+     sc*sizeof(Complex<Real>),
+     ( Rank(comm)==root ? rc*Size(comm)*sizeof(Complex<Real>) : 0 ));
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Gather
@@ -1213,6 +1493,10 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Gather",comm,
+     sc*sizeof(T),
+     ( Rank(comm)==root ? rc*Size(comm)*sizeof(T) : 0 ));
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalRecv = rc*commSize;
@@ -1239,6 +1523,10 @@ void IGather
   Request<Real>& request )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("IGather",comm,
+     sc*sizeof(Real),
+     ( Rank(comm)==root ? rc*Size(comm)*sizeof(Real) : 0 ));
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
     ( MPI_Igather
@@ -1259,6 +1547,10 @@ void IGather
   Request<Complex<Real>>& request )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("IGather",comm,
+     sc*sizeof(Complex<Real>),
+     ( Rank(comm)==root ? rc*Size(comm)*sizeof(Complex<Real>) : 0 ));
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -1288,6 +1580,10 @@ void IGather
   Request<T>& request )
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("IGather",comm,
+     sc*sizeof(T),
+     ( Rank(comm)==root ? rc*Size(comm)*sizeof(T) : 0 ));
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     if( mpi::Rank(comm) == root )
     {
@@ -1316,6 +1612,10 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Gatherv",comm,
+     sc*sizeof(Real),
+     ( Rank(comm)==root ? TotalCount(rcs,comm)*sizeof(Real) : 0 ));
     SafeMpi
     ( MPI_Gatherv
       ( const_cast<Real*>(sbuf),
@@ -1338,6 +1638,10 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Gatherv",comm,
+     sc*sizeof(Complex<Real>),
+     ( Rank(comm)==root ? TotalCount(rcs,comm)*sizeof(Complex<Real>) : 0 ));
 #ifdef EL_AVOID_COMPLEX_MPI
     const int commRank = Rank( comm );
     const int commSize = Size( comm );
@@ -1382,6 +1686,10 @@ void Gather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Gatherv",comm,
+     sc*sizeof(T),
+     ( Rank(comm)==root ? TotalCount(rcs,comm)*sizeof(T) : 0 ));
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     int totalRecv=0;
@@ -1416,6 +1724,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllGather",comm,sc*sizeof(Real),rc*Size(comm)*sizeof(Real));
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1440,6 +1749,10 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("AllGather",comm,
+     sc*sizeof(Complex<Real>),
+     rc*Size(comm)*sizeof(Complex<Real>));
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1474,6 +1787,7 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllGather",comm,sc*sizeof(T),rc*Size(comm)*sizeof(T));
     const int commSize = mpi::Size(comm);
     const int totalRecv = rc*commSize;
 
@@ -1496,6 +1810,10 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("AllGatherv",comm,
+     sc*sizeof(Real),
+     TotalCount(rcs,comm)*sizeof(Real));
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1533,6 +1851,10 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("AllGatherv",comm,
+     sc*sizeof(Complex<Real>),
+     TotalCount(rcs,comm)*sizeof(Complex<Real>));
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1585,6 +1907,10 @@ void AllGather
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("AllGatherv",comm,
+     sc*sizeof(T),
+     TotalCount(rcs,comm)*sizeof(T));
     const int commSize = mpi::Size(comm);
     const int totalRecv = rcs[commSize-1]+rds[commSize-1];
 
@@ -1613,6 +1939,10 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Scatter",comm,
+     ( Rank(comm)==root ? sc*Size(comm)*sizeof(Real) : 0 ),
+     rc*sizeof(Real));
     SafeMpi
     ( MPI_Scatter
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1627,6 +1957,10 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Scatter",comm,
+     ( Rank(comm)==root ? sc*Size(comm)*sizeof(Complex<Real>) : 0 ),
+     rc*sizeof(Complex<Real>));
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Scatter
@@ -1651,6 +1985,10 @@ void Scatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Scatter",comm,
+     ( Rank(comm)==root ? sc*Size(comm)*sizeof(T) : 0 ),
+     rc*sizeof(T));
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalSend = sc*commSize;
@@ -1673,6 +2011,10 @@ void Scatter( Real* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Scatter",comm,
+     ( Rank(comm)==root ? sc*Size(comm)*sizeof(Real) : 0 ),
+     rc*sizeof(Real));
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1696,6 +2038,10 @@ void Scatter( Complex<Real>* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Scatter",comm,
+     ( Rank(comm)==root ? sc*Size(comm)*sizeof(Complex<Real>) : 0 ),
+     rc*sizeof(Complex<Real>));
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1734,6 +2080,10 @@ void Scatter( T* buf, int sc, int rc, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Scatter",comm,
+     ( Rank(comm)==root ? sc*Size(comm)*sizeof(T) : 0 ),
+     rc*sizeof(T));
     const int commSize = mpi::Size(comm);
     const int commRank = mpi::Rank(comm);
     const int totalSend = sc*commSize;
@@ -1760,6 +2110,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("AllToAll",comm,
+     sc*Size(comm)*sizeof(Real),
+     rc*Size(comm)*sizeof(Real));
     SafeMpi
     ( MPI_Alltoall
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
@@ -1774,6 +2128,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("AllToAll",comm,
+     sc*Size(comm)*sizeof(Complex<Real>),
+     rc*Size(comm)*sizeof(Complex<Real>));
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Alltoall
@@ -1800,6 +2158,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("AllToAll",comm,
+     sc*Size(comm)*sizeof(T),
+     rc*Size(comm)*sizeof(T));
     const int commSize = mpi::Size( comm );
     const int totalSend = sc*commSize;
     const int totalRecv = rc*commSize;
@@ -1822,6 +2184,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("AllToAllv",comm,
+     TotalCount(scs,comm)*sizeof(Real),
+     TotalCount(rcs,comm)*sizeof(Real));
     SafeMpi
     ( MPI_Alltoallv
       ( const_cast<Real*>(sbuf),
@@ -1843,6 +2209,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("AllToAllv",comm,
+     TotalCount(scs,comm)*sizeof(Complex<Real>),
+     TotalCount(rcs,comm)*sizeof(Complex<Real>));
 #ifdef EL_AVOID_COMPLEX_MPI
     int p;
     MPI_Comm_size( comm.comm, &p );
@@ -1884,6 +2254,10 @@ void AllToAll
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("AllToAllv",comm,
+     TotalCount(scs,comm)*sizeof(T),
+     TotalCount(rcs,comm)*sizeof(T));
     const int commSize = mpi::Size( comm );
     const int totalSend = scs[commSize-1]+sds[commSize-1];
     const int totalRecv = rcs[commSize-1]+rds[commSize-1];
@@ -1921,6 +2295,126 @@ EL_NO_RELEASE_EXCEPT
     return recvBuf;
 }
 
+namespace {
+
+template<typename T>
+void PointToPointNeighborAllToAll
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds,
+  const vector<int>& neighbors, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    const int numNeighbors = neighbors.size();
+    vector<Request<T>> requests;
+    requests.reserve( 2*numNeighbors );
+    for( int k=0; k<numNeighbors; ++k )
+    {
+        if( rcs[k] == 0 )
+            continue;
+        requests.emplace_back();
+        IRecv( &rbuf[rds[k]], rcs[k], neighbors[k], comm, requests.back() );
+    }
+    for( int k=0; k<numNeighbors; ++k )
+    {
+        if( scs[k] == 0 )
+            continue;
+        requests.emplace_back();
+        ISend( &sbuf[sds[k]], scs[k], neighbors[k], comm, requests.back() );
+    }
+    WaitAll( requests.size(), requests.data() );
+}
+
+#ifdef EL_HAVE_MPI3_NEIGHBORHOOD_COLLECTIVES
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void NeighborAllToAllImpl
+( const Real* sbuf, const int* scs, const int* sds,
+        Real* rbuf, const int* rcs, const int* rds,
+  const vector<int>& neighbors, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    SafeMpi
+    ( MPI_Neighbor_alltoallv
+      ( const_cast<Real*>(sbuf),
+        const_cast<int*>(scs), const_cast<int*>(sds), TypeMap<Real>(),
+        rbuf,
+        const_cast<int*>(rcs), const_cast<int*>(rds), TypeMap<Real>(),
+        comm.comm ) );
+}
+
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void NeighborAllToAllImpl
+( const Complex<Real>* sbuf, const int* scs, const int* sds,
+        Complex<Real>* rbuf, const int* rcs, const int* rds,
+  const vector<int>& neighbors, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+#ifdef EL_AVOID_COMPLEX_MPI
+    const int numNeighbors = neighbors.size();
+    vector<int> scsDoubled(numNeighbors), sdsDoubled(numNeighbors),
+                rcsDoubled(numNeighbors), rdsDoubled(numNeighbors);
+    for( int k=0; k<numNeighbors; ++k )
+    {
+        scsDoubled[k] = 2*scs[k];
+        sdsDoubled[k] = 2*sds[k];
+        rcsDoubled[k] = 2*rcs[k];
+        rdsDoubled[k] = 2*rds[k];
+    }
+    SafeMpi
+    ( MPI_Neighbor_alltoallv
+      ( const_cast<Complex<Real>*>(sbuf),
+              scsDoubled.data(), sdsDoubled.data(), TypeMap<Real>(),
+        rbuf, rcsDoubled.data(), rdsDoubled.data(), TypeMap<Real>(),
+        comm.comm ) );
+#else
+    SafeMpi
+    ( MPI_Neighbor_alltoallv
+      ( const_cast<Complex<Real>*>(sbuf),
+        const_cast<int*>(scs), const_cast<int*>(sds),
+        TypeMap<Complex<Real>>(),
+        rbuf,
+        const_cast<int*>(rcs), const_cast<int*>(rds),
+        TypeMap<Complex<Real>>(),
+        comm.comm ) );
+#endif
+}
+
+// Non-packed types are (de)serialized per message by the point-to-point
+// wrappers
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void NeighborAllToAllImpl
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds,
+  const vector<int>& neighbors, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    PointToPointNeighborAllToAll
+    ( sbuf, scs, sds, rbuf, rcs, rds, neighbors, comm );
+}
+#endif // ifdef EL_HAVE_MPI3_NEIGHBORHOOD_COLLECTIVES
+
+} // anonymous namespace
+
+template<typename T>
+void NeighborAllToAll
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds,
+  const vector<int>& neighbors, Comm neighborComm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("NeighborAllToAllv",neighborComm,
+     TotalCount(scs,neighbors)*sizeof(T),
+     TotalCount(rcs,neighbors)*sizeof(T));
+#ifdef EL_HAVE_MPI3_NEIGHBORHOOD_COLLECTIVES
+    NeighborAllToAllImpl
+    ( sbuf, scs, sds, rbuf, rcs, rds, neighbors, neighborComm );
+#else
+    PointToPointNeighborAllToAll
+    ( sbuf, scs, sds, rbuf, rcs, rds, neighbors, neighborComm );
+#endif
+}
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void Reduce
@@ -1928,6 +2422,10 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Reduce",comm,
+     count*sizeof(Real),
+     ( Rank(comm)==root ? count*sizeof(Real) : 0 ));
     if( count == 0 )
         return;
 
@@ -1946,6 +2444,10 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Reduce",comm,
+     count*sizeof(Complex<Real>),
+     ( Rank(comm)==root ? count*sizeof(Complex<Real>) : 0 ));
     if( count == 0 )
         return;
 
@@ -1984,6 +2486,10 @@ void Reduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Reduce",comm,
+     count*sizeof(T),
+     ( Rank(comm)==root ? count*sizeof(T) : 0 ));
     if( count == 0 )
         return;
 
@@ -2032,6 +2538,10 @@ void Reduce( Real* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Reduce",comm,
+     count*sizeof(Real),
+     ( Rank(comm)==root ? count*sizeof(Real) : 0 ));
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2057,6 +2567,10 @@ void Reduce( Complex<Real>* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Reduce",comm,
+     count*sizeof(Complex<Real>),
+     ( Rank(comm)==root ? count*sizeof(Complex<Real>) : 0 ));
     if( Size(comm) == 1 )
         return;
     if( count != 0 )
@@ -2119,6 +2633,10 @@ void Reduce( T* buf, int count, Op op, int root, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Reduce",comm,
+     count*sizeof(T),
+     ( Rank(comm)==root ? count*sizeof(T) : 0 ));
     if( count == 0 )
         return;
 
@@ -2151,6 +2669,7 @@ void AllReduce( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllReduce",comm,count*sizeof(Real),count*sizeof(Real));
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
@@ -2168,6 +2687,10 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("AllReduce",comm,
+     count*sizeof(Complex<Real>),
+     count*sizeof(Complex<Real>));
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2205,6 +2728,7 @@ void AllReduce
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllReduce",comm,count*sizeof(T),count*sizeof(T));
     if( count == 0 )
         return;
 
@@ -2241,6 +2765,7 @@ void AllReduce( Real* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllReduce",comm,count*sizeof(Real),count*sizeof(Real));
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2256,6 +2781,10 @@ void AllReduce( Complex<Real>* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("AllReduce",comm,
+     count*sizeof(Complex<Real>),
+     count*sizeof(Complex<Real>));
     if( count == 0 || Size(comm) == 1 )
         return;
 
@@ -2291,6 +2820,7 @@ void AllReduce( T* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("AllReduce",comm,count*sizeof(T),count*sizeof(T));
     if( count == 0 )
         return;
 
@@ -2311,12 +2841,106 @@ void AllReduce( T* buf, int count, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { AllReduce( buf, count, SUM, comm ); }
 
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( Real* buf, int count, Op op, Comm comm, Request<Real>& request )
+{
+    EL_DEBUG_CSE
+    request.backend = MPI_REQUEST_NULL;
+    if( count == 0 || Size(comm) == 1 )
+        return;
+#if EL_HAVE_NONBLOCKING
+    EL_MPI_PROFILE
+    ("IAllReduce",comm,count*sizeof(Real),count*sizeof(Real));
+    MPI_Op opC = NativeOp<Real>( op );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallreduce)
+      ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm,
+        &request.backend ) );
+#else
+    AllReduce( buf, count, op, comm );
+#endif
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsPacked<Real>>*/>
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    EL_DEBUG_CSE
+    request.backend = MPI_REQUEST_NULL;
+    if( count == 0 || Size(comm) == 1 )
+        return;
+#if EL_HAVE_NONBLOCKING
+    EL_MPI_PROFILE
+    ("IAllReduce",comm,
+     count*sizeof(Complex<Real>),
+     count*sizeof(Complex<Real>));
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        SafeMpi
+        ( EL_NONBLOCKING_COLL(Iallreduce)
+          ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm,
+            &request.backend ) );
+        return;
+    }
+#endif
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallreduce)
+      ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
+        comm.comm, &request.backend ) );
+#else
+    AllReduce( buf, count, op, comm );
+#endif
+}
+
+template<typename T,
+         typename/*=DisableIf<IsPacked<T>>*/,
+         typename/*=void*/>
+void IAllReduce
+( T* buf, int count, Op op, Comm comm, Request<T>& request )
+{
+    EL_DEBUG_CSE
+    request.backend = MPI_REQUEST_NULL;
+    request.receivingPacked = false;
+    if( count == 0 || Size(comm) == 1 )
+        return;
+#if EL_HAVE_NONBLOCKING
+    EL_MPI_PROFILE
+    ("IAllReduce",comm,count*sizeof(T),count*sizeof(T));
+    MPI_Op opC = NativeOp<T>( op );
+    request.receivingPacked = true;
+    request.recvCount = count;
+    request.unpackedRecvBuf = buf;
+    Serialize( count, buf, request.buffer );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallreduce)
+      ( MPI_IN_PLACE, request.buffer.data(), count, TypeMap<T>(), opC,
+        comm.comm, &request.backend ) );
+#else
+    AllReduce( buf, count, op, comm );
+#endif
+}
+
+template<typename T>
+void IAllReduce( T* buf, int count, Comm comm, Request<T>& request )
+{ IAllReduce( buf, count, SUM, comm, request ); }
+
 template<typename Real,
          typename/*=EnableIf<IsPacked<Real>>*/>
 void ReduceScatter( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("ReduceScatter",comm,
+     rc*Size(comm)*sizeof(Real),
+     rc*sizeof(Real));
     if( rc == 0 )
         return;
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
@@ -2343,6 +2967,10 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("ReduceScatter",comm,
+     rc*Size(comm)*sizeof(Complex<Real>),
+     rc*sizeof(Complex<Real>));
     if( rc == 0 )
         return;
 
@@ -2377,6 +3005,7 @@ void ReduceScatter( T* sbuf, T* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("ReduceScatter",comm,rc*Size(comm)*sizeof(T),rc*sizeof(T));
     if( rc == 0 )
         return;
     const int commSize = mpi::Size(comm);
@@ -2424,6 +3053,10 @@ void ReduceScatter( Real* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("ReduceScatter",comm,
+     rc*Size(comm)*sizeof(Real),
+     rc*sizeof(Real));
     if( rc == 0 || Size(comm) == 1 )
         return;
 
@@ -2451,6 +3084,10 @@ void ReduceScatter( Complex<Real>* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("ReduceScatter",comm,
+     rc*Size(comm)*sizeof(Complex<Real>),
+     rc*sizeof(Complex<Real>));
     if( rc == 0 || Size(comm) == 1 )
         return;
 
@@ -2486,6 +3123,7 @@ void ReduceScatter( T* buf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("ReduceScatter",comm,rc*Size(comm)*sizeof(T),rc*sizeof(T));
     if( rc == 0 )
         return;
     const int commSize = mpi::Size(comm);
@@ -2524,6 +3162,10 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("ReduceScatterv",comm,
+     TotalCount(rcs,comm)*sizeof(Real),
+     rcs[Rank(comm)]*sizeof(Real));
     MPI_Op opC = NativeOp<Real>( op );
     SafeMpi
     ( MPI_Reduce_scatter
@@ -2539,6 +3181,10 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("ReduceScatterv",comm,
+     TotalCount(rcs,comm)*sizeof(Complex<Real>),
+     rcs[Rank(comm)]*sizeof(Complex<Real>));
 #ifdef EL_AVOID_COMPLEX_MPI
     if( op == SUM )
     {
@@ -2580,6 +3226,10 @@ void ReduceScatter
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("ReduceScatterv",comm,
+     TotalCount(rcs,comm)*sizeof(T),
+     rcs[Rank(comm)]*sizeof(T));
     const int commRank = mpi::Rank(comm);
     const int commSize = mpi::Size(comm);
     int totalSend=0;
@@ -2626,6 +3276,7 @@ void Scan( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Scan",comm,count*sizeof(Real),count*sizeof(Real));
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
@@ -2644,6 +3295,10 @@ void Scan
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Scan",comm,
+     count*sizeof(Complex<Real>),
+     count*sizeof(Complex<Real>));
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2680,6 +3335,7 @@ void Scan( const T* sbuf, T* rbuf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Scan",comm,count*sizeof(T),count*sizeof(T));
     if( count == 0 )
         return;
 
@@ -2723,6 +3379,7 @@ void Scan( Real* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Scan",comm,count*sizeof(Real),count*sizeof(Real));
     if( count != 0 )
     {
         MPI_Op opC = NativeOp<Real>( op );
@@ -2738,6 +3395,10 @@ void Scan( Complex<Real>* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("Scan",comm,
+     count*sizeof(Complex<Real>),
+     count*sizeof(Complex<Real>));
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2773,6 +3434,7 @@ void Scan( T* buf, int count, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
     EL_DEBUG_CSE
+    EL_MPI_PROFILE("Scan",comm,count*sizeof(T),count*sizeof(T));
     if( count == 0 )
         return;
 
@@ -2792,8 +3454,85 @@ void Scan( T* buf, int count, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { Scan( buf, count, SUM, comm ); }
 
+// SparseAllToAll schedules
+// ========================
+namespace {
+
+#ifdef EL_USE_CUSTOM_ALLTOALLV
+SparseAllToAllSchedule sparseAllToAllSchedule = ADAPTIVE_SPARSE_ALLTOALL;
+#else
+SparseAllToAllSchedule sparseAllToAllSchedule = VENDOR_SPARSE_ALLTOALL;
+#endif
+int sparseAllToAllMaxRequests = 64;
+
+// The adaptive schedule treats a pattern as dense when some process
+// exchanges nonempty messages with at least this fraction of the processes,
+// and uses Bruck's algorithm for dense patterns of messages no larger than
+// the given number of bytes
+const double denseAllToAllFraction = 0.5;
+const size_t bruckMaxMessageBytes = 256;
+
+// Exchange with the processes at distances 1, 2, ..., p-1 in turn, keeping
+// at most 'maxRequests' requests outstanding. Since the process whose
+// window of distances ends first can always complete it, the windows
+// cannot deadlock.
 template<typename T>
-void SparseAllToAll
+void PairwiseSparseAllToAll
+( const vector<T>& sendBuffer,
+  const vector<int>& sendCounts,
+  const vector<int>& sendDispls,
+        vector<T>& recvBuffer,
+  const vector<int>& recvCounts,
+  const vector<int>& recvDispls,
+        Comm comm, int maxRequests )
+EL_NO_RELEASE_EXCEPT
+{
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    const T* sendBuf = sendBuffer.data();
+    T* recvBuf = recvBuffer.data();
+    std::copy
+    ( sendBuf+sendDispls[commRank],
+      sendBuf+sendDispls[commRank]+sendCounts[commRank],
+      recvBuf+recvDispls[commRank] );
+
+    maxRequests = Max(maxRequests,2);
+    vector<Request<T>> requests;
+    requests.reserve( maxRequests );
+    int dist = 1;
+    while( dist < commSize )
+    {
+        requests.clear();
+        for( ; dist<commSize && int(requests.size())+2<=maxRequests; ++dist )
+        {
+            const int from = Mod( commRank-dist, commSize );
+            const int to = Mod( commRank+dist, commSize );
+            if( recvCounts[from] != 0 )
+            {
+                requests.emplace_back();
+                IRecv
+                ( recvBuf+recvDispls[from], recvCounts[from], from, comm,
+                  requests.back() );
+            }
+            if( sendCounts[to] != 0 )
+            {
+                requests.emplace_back();
+                ISend
+                ( sendBuf+sendDispls[to], sendCounts[to], to, comm,
+                  requests.back() );
+            }
+        }
+        WaitAll( requests.size(), requests.data() );
+    }
+}
+
+// Bruck's algorithm with variable block sizes: block k initially holds the
+// data for process rank+k, and, in the round with distance 2^j, every block
+// whose index has bit j set is forwarded to process rank+2^j (along with
+// the block sizes). After ceil(log2(p)) rounds, block k holds the data from
+// process rank-k.
+template<typename T>
+void BruckSparseAllToAll
 ( const vector<T>& sendBuffer,
   const vector<int>& sendCounts,
   const vector<int>& sendDispls,
@@ -2803,46 +3542,153 @@ void SparseAllToAll
         Comm comm )
 EL_NO_RELEASE_EXCEPT
 {
-    EL_DEBUG_CSE
-    EL_DEBUG_ONLY(VerifySendsAndRecvs( sendCounts, recvCounts, comm ))
-#ifdef EL_USE_CUSTOM_ALLTOALLV
     const int commSize = Size( comm );
-    int numSends=0,numRecvs=0;
-    for( int q=0; q<commSize; ++q )
+    const int commRank = Rank( comm );
+    const T* sendBuf = sendBuffer.data();
+    T* recvBuf = recvBuffer.data();
+
+    vector<int> blockSizes(commSize), blockOffs;
+    vector<T> blocks;
+    for( int k=0; k<commSize; ++k )
+        blockSizes[k] = sendCounts[Mod(commRank+k,commSize)];
+    blocks.resize( El::Scan( blockSizes, blockOffs ) );
+    for( int k=0; k<commSize; ++k )
     {
-        if( sendCounts[q] != 0 )
-            ++numSends;
-        if( recvCounts[q] != 0 )
-            ++numRecvs;
+        const T* block = sendBuf + sendDispls[Mod(commRank+k,commSize)];
+        std::copy( block, block+blockSizes[k], blocks.data()+blockOffs[k] );
     }
-    vector<Status> statuses(numSends+numRecvs);
-    vector<Request<T>> requests(numSends+numRecvs);
-    int rCount=0;
-    for( int q=0; q<commSize; ++q )
+
+    vector<int> sendSizes, recvSizes, newBlockSizes(commSize), newBlockOffs;
+    vector<T> sendData, recvData, newBlocks;
+    for( int dist=1; dist<commSize; dist*=2 )
+    {
+        const int to = Mod( commRank+dist, commSize );
+        const int from = Mod( commRank-dist, commSize );
+        sendSizes.clear();
+        sendData.clear();
+        for( int k=0; k<commSize; ++k )
+        {
+            if( k & dist )
+            {
+                const T* block = blocks.data() + blockOffs[k];
+                sendSizes.push_back( blockSizes[k] );
+                sendData.insert( sendData.end(), block, block+blockSizes[k] );
+            }
+        }
+        const int numBlocks = sendSizes.size();
+        recvSizes.resize( numBlocks );
+        SendRecv
+        ( sendSizes.data(), numBlocks, to,
+          recvSizes.data(), numBlocks, from, comm );
+        int totalRecv = 0;
+        for( int b=0; b<numBlocks; ++b )
+            totalRecv += recvSizes[b];
+        recvData.resize( totalRecv );
+        SendRecv
+        ( sendData.data(), int(sendData.size()), to,
+          recvData.data(), totalRecv, from, comm );
+
+        // Replace the forwarded blocks with the received ones
+        for( int k=0, b=0; k<commSize; ++k )
+            newBlockSizes[k] = ( k & dist ? recvSizes[b++] : blockSizes[k] );
+        newBlocks.resize( El::Scan( newBlockSizes, newBlockOffs ) );
+        for( int k=0, recvOff=0; k<commSize; ++k )
+        {
+            const T* block = blocks.data() + blockOffs[k];
+            if( k & dist )
+            {
+                block = recvData.data() + recvOff;
+                recvOff += newBlockSizes[k];
+            }
+            std::copy
+            ( block, block+newBlockSizes[k],
+              newBlocks.data()+newBlockOffs[k] );
+        }
+        blockSizes.swap( newBlockSizes );
+        blockOffs.swap( newBlockOffs );
+        blocks.swap( newBlocks );
+    }
+
+    for( int k=0; k<commSize; ++k )
     {
-        int count = recvCounts[q];
-        int displ = recvDispls[q];
-        if( count != 0 )
-            IRecv( &recvBuffer[displ], count, q, comm, requests[rCount++] );
+        const int q = Mod( commRank-k, commSize );
+        EL_DEBUG_ONLY(
+          if( blockSizes[k] != recvCounts[q] )
+              LogicError
+              ("Expected ",recvCounts[q]," entries from process ",q,
+               " but received ",blockSizes[k]);
+        )
+        const T* block = blocks.data() + blockOffs[k];
+        std::copy( block, block+blockSizes[k], recvBuf+recvDispls[q] );
     }
+}
 
-    // Ensure that recvs are posted before the sends
-    // (Invalid MPI_Irecv's have been observed otherwise)
-    Barrier( comm );
+} // anonymous namespace
 
-    for( int q=0; q<commSize; ++q )
+void SetSparseAllToAllSchedule( SparseAllToAllSchedule schedule ) EL_NO_EXCEPT
+{ sparseAllToAllSchedule = schedule; }
+SparseAllToAllSchedule GetSparseAllToAllSchedule() EL_NO_EXCEPT
+{ return sparseAllToAllSchedule; }
+
+void SetSparseAllToAllMaxRequests( int maxRequests ) EL_NO_EXCEPT
+{ sparseAllToAllMaxRequests = maxRequests; }
+int SparseAllToAllMaxRequests() EL_NO_EXCEPT
+{ return sparseAllToAllMaxRequests; }
+
+template<typename T>
+void SparseAllToAll
+( const vector<T>& sendBuffer,
+  const vector<int>& sendCounts,
+  const vector<int>& sendDispls,
+        vector<T>& recvBuffer,
+  const vector<int>& recvCounts,
+  const vector<int>& recvDispls,
+        Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    EL_MPI_PROFILE
+    ("SparseAllToAll",comm,
+     TotalCount(sendCounts.data(),comm)*sizeof(T),
+     TotalCount(recvCounts.data(),comm)*sizeof(T));
+    EL_DEBUG_ONLY(VerifySendsAndRecvs( sendCounts, recvCounts, comm ))
+    const int commSize = Size( comm );
+
+    SparseAllToAllSchedule schedule = sparseAllToAllSchedule;
+    if( schedule == ADAPTIVE_SPARSE_ALLTOALL )
     {
-        int count = sendCounts[q];
-        int displ = sendDispls[q];
-        if( count != 0 )
-            IRSend( &sendBuffer[displ], count, q, comm, requests[rCount++] );
+        // Agree upon the largest number of messages of any process and the
+        // largest message size
+        int pattern[2] = { 0, 0 };
+        for( int q=0; q<commSize; ++q )
+        {
+            pattern[0] += ( sendCounts[q] != 0 ) + ( recvCounts[q] != 0 );
+            pattern[1] = Max(pattern[1],Max(sendCounts[q],recvCounts[q]));
+        }
+        AllReduce( pattern, 2, MAX, comm );
+        const bool dense =
+          pattern[0] >= 2*denseAllToAllFraction*commSize;
+        if( !dense )
+            schedule = PAIRWISE_SPARSE_ALLTOALL;
+        else if( size_t(pattern[1])*sizeof(T) <= bruckMaxMessageBytes )
+            schedule = BRUCK_SPARSE_ALLTOALL;
+        else
+            schedule = VENDOR_SPARSE_ALLTOALL;
     }
-    WaitAll( numSends+numRecvs, requests.data(), statuses.data() );
-#else
-    AllToAll
-    ( sendBuffer.data(), sendCounts.data(), sendDispls.data(),
-      recvBuffer.data(), recvCounts.data(), recvDispls.data(), comm );
-#endif
+
+    if( schedule == PAIRWISE_SPARSE_ALLTOALL )
+        PairwiseSparseAllToAll
+        ( sendBuffer, sendCounts, sendDispls,
+          recvBuffer, recvCounts, recvDispls,
+          comm, sparseAllToAllMaxRequests );
+    else if( schedule == BRUCK_SPARSE_ALLTOALL )
+        BruckSparseAllToAll
+        ( sendBuffer, sendCounts, sendDispls,
+          recvBuffer, recvCounts, recvDispls, comm );
+    else
+        AllToAll
+        ( sendBuffer.data(), sendCounts.data(), sendDispls.data(),
+          recvBuffer.data(), recvCounts.data(), recvDispls.data(), comm );
 }
 
 #define MPI_PROTO_BASE(T) \
@@ -2926,6 +3772,11 @@ EL_NO_RELEASE_EXCEPT
   ( const T* sbuf, int sc, \
           T* rbuf, int rc, \
     int root, Comm comm, Request<T>& request ); \
+  template void NeighborAllToAll<T> \
+  ( const T* sbuf, const int* scs, const int* sds, \
+          T* rbuf, const int* rcs, const int* rds, \
+    const vector<int>& neighbors, Comm neighborComm ) \
+  EL_NO_RELEASE_EXCEPT; \
   template vector<T> AllToAll<T> \
   ( const vector<T>& sendBuf, \
     const vector<int>& sendCounts, \
@@ -2951,6 +3802,8 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void AllReduce<T>( T* buf, int count, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllReduce<T> \
+  ( T* buf, int count, Comm comm, Request<T>& request ); \
   template void ReduceScatter<T>( T* sbuf, T* rbuf, int rc, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void ReduceScatter<T>( T* sbuf, T* rbuf, int rc, Comm comm ) \
@@ -3022,11 +3875,41 @@ EL_NO_RELEASE_EXCEPT
   ( const T* sbuf, T* rbuf, int count, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void AllReduce<S>( T* buf, int count, Op op, Comm comm ) \
-  EL_NO_RELEASE_EXCEPT;
+  EL_NO_RELEASE_EXCEPT; \
+  template void IAllReduce<S> \
+  ( T* buf, int count, Op op, Comm comm, Request<T>& request );
 
 #define MPI_PROTO_REAL(T) \
   MPI_PROTO_BASE(T) \
   MPI_PROTO_DIFF(T, T)
+
+#define MPI_PROTO_PERSISTENT_BASE(T) \
+  template void SendInit<T> \
+  ( const T* buf, int count, int to, Comm comm, Request<T>& request ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void RecvInit<T> \
+  ( T* buf, int count, int from, Comm comm, Request<T>& request ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void Start<T>( Request<T>& request ) EL_NO_RELEASE_EXCEPT; \
+  template void StartAll<T>( int numRequests, Request<T>* requests ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void Free<T>( Request<T>& request ) EL_NO_RELEASE_EXCEPT;
+
+#define MPI_PROTO_PERSISTENT_DIFF(S,T) \
+  template void TaggedSendInit<S> \
+  ( const T* buf, int count, int to, int tag, Comm comm, Request<T>& request ) \
+  EL_NO_RELEASE_EXCEPT; \
+  template void TaggedRecvInit<S> \
+  ( T* buf, int count, int from, int tag, Comm comm, Request<T>& request ) \
+  EL_NO_RELEASE_EXCEPT;
+
+#define MPI_PROTO_PERSISTENT_REAL(T) \
+  MPI_PROTO_PERSISTENT_BASE(T) \
+  MPI_PROTO_PERSISTENT_DIFF(T, T)
+
+#define MPI_PROTO_PERSISTENT_COMPLEX(T) \
+  MPI_PROTO_PERSISTENT_BASE(Complex<T>) \
+  MPI_PROTO_PERSISTENT_DIFF(T, Complex<T>)
   
 #define MPI_PROTO_COMPLEX(T) \
   MPI_PROTO_BASE(Complex<T>) \
@@ -3077,6 +3960,30 @@ MPI_PROTO_REAL(ValueInt<Complex<Quad>>)
 MPI_PROTO_REAL(Entry<Quad>)
 MPI_PROTO_REAL(Entry<Complex<Quad>>)
 #endif
+MPI_PROTO_PERSISTENT_REAL(byte)
+MPI_PROTO_PERSISTENT_REAL(int)
+MPI_PROTO_PERSISTENT_REAL(unsigned)
+MPI_PROTO_PERSISTENT_REAL(long int)
+MPI_PROTO_PERSISTENT_REAL(unsigned long)
+#ifdef EL_HAVE_MPI_LONG_LONG
+MPI_PROTO_PERSISTENT_REAL(long long int)
+MPI_PROTO_PERSISTENT_REAL(unsigned long long)
+#endif
+MPI_PROTO_PERSISTENT_REAL(float)
+MPI_PROTO_PERSISTENT_COMPLEX(float)
+MPI_PROTO_PERSISTENT_REAL(double)
+MPI_PROTO_PERSISTENT_COMPLEX(double)
+#ifdef EL_HAVE_QD
+MPI_PROTO_PERSISTENT_REAL(DoubleDouble)
+MPI_PROTO_PERSISTENT_REAL(QuadDouble)
+MPI_PROTO_PERSISTENT_COMPLEX(DoubleDouble)
+MPI_PROTO_PERSISTENT_COMPLEX(QuadDouble)
+#endif
+#ifdef EL_HAVE_QUAD
+MPI_PROTO_PERSISTENT_REAL(Quad)
+MPI_PROTO_PERSISTENT_COMPLEX(Quad)
+#endif
+
 #ifdef EL_HAVE_MPC
 MPI_PROTO_REAL(BigInt)
 MPI_PROTO_REAL(BigFloat)
@@ -0,0 +1,144 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <fstream>
+#include <map>
+#include <tuple>
+
+namespace {
+using namespace El;
+
+bool profilingEnabled = false;
+
+// The nesting depth of the active collectives
+int profileDepth = 0;
+
+typedef std::tuple<string,string,int> ProfileKey;
+std::map<ProfileKey,mpi::CollectiveProfile> profileMap;
+
+string EscapeJSON( const string& str )
+{
+    string escaped;
+    for( const char c : str )
+    {
+        if( c == '"' || c == '\\' )
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+} // anonymous namespace
+
+namespace El {
+namespace mpi {
+
+void EnableProfiling( bool enable ) EL_NO_EXCEPT
+{ ::profilingEnabled = enable; }
+
+bool ProfilingEnabled() EL_NO_EXCEPT
+{ return ::profilingEnabled; }
+
+void ResetProfile()
+{ ::profileMap.clear(); }
+
+vector<CollectiveProfile> Profile()
+{
+    vector<CollectiveProfile> profile;
+    profile.reserve( ::profileMap.size() );
+    for( const auto& entry : ::profileMap )
+        profile.push_back( entry.second );
+    return profile;
+}
+
+void PrintProfileJSON( ostream& os )
+{
+    EL_DEBUG_CSE
+    os << "{\n"
+       << "  \"rank\": " << Rank(COMM_WORLD) << ",\n"
+       << "  \"collectives\": [";
+    bool first = true;
+    for( const auto& entry : ::profileMap )
+    {
+        const CollectiveProfile& prof = entry.second;
+        os << ( first ? "\n" : ",\n" )
+           << "    {\"collective\": \"" << prof.collective << "\", "
+           << "\"comm\": \"" << EscapeJSON(prof.commName) << "\", "
+           << "\"commSize\": " << prof.commSize << ", "
+           << "\"numCalls\": " << prof.numCalls << ", "
+           << "\"bytesSent\": " << prof.bytesSent << ", "
+           << "\"bytesRecv\": " << prof.bytesRecv << ", "
+           << "\"seconds\": " << prof.seconds << "}";
+        first = false;
+    }
+    os << "\n  ]\n}" << endl;
+}
+
+void WriteProfileJSON( const string& filename )
+{
+    EL_DEBUG_CSE
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file.precision( 16 );
+    PrintProfileJSON( file );
+}
+
+namespace profile {
+
+Scope::Scope( const char* collective, Comm comm ) EL_NO_EXCEPT
+: entered_(::profilingEnabled), active_(false),
+  collective_(collective), comm_(comm)
+{
+    if( !entered_ )
+        return;
+    active_ = ( ::profileDepth++ == 0 );
+    if( active_ )
+        startTime_ = Time();
+}
+
+Scope::~Scope()
+{
+    if( !entered_ )
+        return;
+    --::profileDepth;
+    if( !active_ )
+        return;
+    const double elapsed = Time() - startTime_;
+
+    string commName = GetName( comm_ );
+    if( commName.empty() )
+        commName = "unnamed";
+    const int commSize = Size( comm_ );
+    const ProfileKey key( collective_, commName, commSize );
+    auto it = ::profileMap.find( key );
+    if( it == ::profileMap.end() )
+    {
+        CollectiveProfile prof;
+        prof.collective = collective_;
+        prof.commName = commName;
+        prof.commSize = commSize;
+        prof.numCalls = 0;
+        prof.bytesSent = 0;
+        prof.bytesRecv = 0;
+        prof.seconds = 0;
+        it = ::profileMap.insert( std::make_pair(key,prof) ).first;
+    }
+    CollectiveProfile& prof = it->second;
+    ++prof.numCalls;
+    prof.bytesSent += bytesSent_;
+    prof.bytesRecv += bytesRecv_;
+    prof.seconds += elapsed;
+}
+
+} // namespace profile
+
+} // namespace mpi
+} // namespace El
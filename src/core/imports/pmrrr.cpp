@@ -30,11 +30,21 @@ int pmrrr
   int* ZSupp      // support of eigenvectors [length 2n]
 );
 
+void PMR_set_num_threads( int nthreads );
+
 } // extern "C"
 
 namespace El {
 namespace herm_tridiag_eig {
 
+void SetMRRRThreads( int numThreads )
+{
+    EL_DEBUG_CSE
+    if( numThreads < 0 )
+        LogicError("The number of MRRR threads must be non-negative");
+    PMR_set_num_threads( numThreads );
+}
+
 // Return upper bounds on the number of (local) eigenvalues in the given range,
 // (lowerBound,upperBound]
 Estimate EigEstimate
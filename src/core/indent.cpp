@@ -10,23 +10,24 @@
 
 namespace {
 
-El::Int indentLevel=0;
+// The indentation level is a member of the current Context
+El::Int& IndentLevelRef() { return El::CurrentContext().indentLevel; }
 El::Int spacesPerIndent=2;
 
 }
 
 namespace El {
 
-Int PushIndent() { return ::indentLevel++; }
-Int PopIndent() { return ::indentLevel--; }
-void SetIndent( Int indent ) { ::indentLevel = indent; }
-void ClearIndent() { ::indentLevel = 0; }
-Int IndentLevel() { return ::indentLevel; }
+Int PushIndent() { return ::IndentLevelRef()++; }
+Int PopIndent() { return ::IndentLevelRef()--; }
+void SetIndent( Int indent ) { ::IndentLevelRef() = indent; }
+void ClearIndent() { ::IndentLevelRef() = 0; }
+Int IndentLevel() { return ::IndentLevelRef(); }
 
 string Indent()
 {
     string ind;
-    for( Int i=0; i < ::spacesPerIndent * ::indentLevel; ++i )
+    for( Int i=0; i < ::spacesPerIndent * IndentLevel(); ++i )
         ind = ind + " ";
     return ind;
 }
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <mutex>
 using std::function;
 
 namespace El {
@@ -696,8 +697,8 @@ static void CreateValueIntType() EL_NO_EXCEPT
     EL_DEBUG_CSE
 
     Datatype typeList[2];
-    typeList[0] = TypeMap<T>();
-    typeList[1] = TypeMap<Int>();
+    typeList[0] = Types<T>::type;
+    typeList[1] = Types<Int>::type;
 
     int blockLengths[2];
     blockLengths[0] = 1;
@@ -725,8 +726,8 @@ void CreateValueIntType() EL_NO_EXCEPT
     EL_DEBUG_CSE
 
     Datatype typeList[2];
-    typeList[0] = TypeMap<T>();
-    typeList[1] = TypeMap<Int>();
+    typeList[0] = Types<T>::type;
+    typeList[1] = Types<Int>::type;
 
     int blockLengths[2];
     blockLengths[0] = 1;
@@ -751,9 +752,9 @@ static void CreateEntryType() EL_NO_EXCEPT
     EL_DEBUG_CSE
 
     Datatype typeList[3];
-    typeList[0] = TypeMap<Int>();
-    typeList[1] = TypeMap<Int>();
-    typeList[2] = TypeMap<T>();
+    typeList[0] = Types<Int>::type;
+    typeList[1] = Types<Int>::type;
+    typeList[2] = Types<T>::type;
 
     int blockLengths[3];
     blockLengths[0] = 1;
@@ -784,9 +785,9 @@ void CreateEntryType() EL_NO_EXCEPT
     EL_DEBUG_CSE
 
     Datatype typeList[3];
-    typeList[0] = TypeMap<Int>();
-    typeList[1] = TypeMap<Int>();
-    typeList[2] = TypeMap<T>();
+    typeList[0] = Types<Int>::type;
+    typeList[1] = Types<Int>::type;
+    typeList[2] = Types<T>::type;
 
     int blockLengths[3];
     blockLengths[0] = 1;
@@ -840,8 +841,8 @@ void DestroyBigFloatFamily()
 template<typename T>
 void CreateUserOps()
 {
-    Create( (UserFunction*)UserReduce<T>, false, UserOp<T>() );
-    Create( (UserFunction*)UserReduceComm<T>, true, UserCommOp<T>() );
+    Create( (UserFunction*)UserReduce<T>, false, Types<T>::userOp );
+    Create( (UserFunction*)UserReduceComm<T>, true, Types<T>::userCommOp );
     Types<T>::createdUserOp = true;
     Types<T>::createdUserCommOp = true;
 }
@@ -849,206 +850,208 @@ void CreateUserOps()
 template<typename T>
 void CreateSumOp()
 {
-    Create( (UserFunction*)SumFunc<T>, true, SumOp<T>() );
+    Create( (UserFunction*)SumFunc<T>, true, Types<T>::sumOp );
     Types<T>::createdSumOp = true;
 }
 template<typename T>
 void CreateProdOp()
 {
-    Create( (UserFunction*)ProdFunc<T>, true, ProdOp<T>() );
+    Create( (UserFunction*)ProdFunc<T>, true, Types<T>::prodOp );
     Types<T>::createdProdOp = true;
 }
 template<typename T>
 void CreateMaxOp()
 {
-    Create( (UserFunction*)MaxFunc<T>, true, MaxOp<T>() );
+    Create( (UserFunction*)MaxFunc<T>, true, Types<T>::maxOp );
     Types<T>::createdMaxOp = true;
 }
 template<typename T>
 void CreateMinOp()
 {
-    Create( (UserFunction*)MinFunc<T>, true, MinOp<T>() );
+    Create( (UserFunction*)MinFunc<T>, true, Types<T>::minOp );
     Types<T>::createdMinOp = true;
 }
 
 template<typename T>
 void CreateMaxLocOp()
 {
-    Create( (UserFunction*)MaxLocFunc<T>, true, MaxLocOp<T>() );
+    Create( (UserFunction*)MaxLocFunc<T>, true, Types<ValueInt<T>>::maxOp );
     Types<ValueInt<T>>::createdMaxOp = true;
 }
 template<typename T>
 void CreateMinLocOp()
 {
-    Create( (UserFunction*)MinLocFunc<T>, true, MinLocOp<T>() );
+    Create( (UserFunction*)MinLocFunc<T>, true, Types<ValueInt<T>>::minOp );
     Types<ValueInt<T>>::createdMinOp = true;
 }
 
 template<typename T>
 void CreateMaxLocPairOp()
 {
-    Create( (UserFunction*)MaxLocPairFunc<T>, true, MaxLocPairOp<T>() );
+    Create( (UserFunction*)MaxLocPairFunc<T>, true, Types<Entry<T>>::maxOp );
     Types<Entry<T>>::createdMaxOp = true;
 }
 template<typename T>
 void CreateMinLocPairOp()
 {
-    Create( (UserFunction*)MinLocPairFunc<T>, true, MinLocPairOp<T>() );
+    Create( (UserFunction*)MinLocPairFunc<T>, true, Types<Entry<T>>::minOp );
     Types<Entry<T>>::createdMinOp = true;
 }
 
-void CreateCustom() EL_NO_RELEASE_EXCEPT
+// The reduction operations shared by every family
+template<typename T>
+void CreateFamilyOps()
 {
-    // Int
-    // ===
-    CreateValueIntType<Int>();
-    CreateEntryType<Int>();
-    CreateUserOps<Int>();
-    CreateMaxLocOp<Int>();
-    CreateMinLocOp<Int>();
-    CreateMaxLocPairOp<Int>();
-    CreateMinLocPairOp<Int>();
-
-    // float
-    // =====
-#ifdef EL_USE_64BIT_INTS
-    CreateValueIntType<float>();
-#else
-    TypeMap<ValueInt<float>>() = MPI_FLOAT_INT;
-#endif
-    CreateValueIntType<Complex<float>>();
-    CreateEntryType<float>();
-    CreateEntryType<Complex<float>>();
-    CreateUserOps<float>();
-    CreateUserOps<Complex<float>>();
-#ifdef EL_USE_64BIT_INTS
-    CreateMaxLocOp<float>();
-    CreateMinLocOp<float>();
-#else
-    MaxLocOp<float>() = MAXLOC;
-    MinLocOp<float>() = MINLOC;
-#endif
-    CreateMaxLocPairOp<float>();
-    CreateMinLocPairOp<float>();
+    CreateUserOps<T>();
+    CreateMaxLocOp<T>();
+    CreateMinLocOp<T>();
+    CreateMaxLocPairOp<T>();
+    CreateMinLocPairOp<T>();
+}
+
+// The families of the real types which are not built into MPI
+template<typename Real>
+void CreateExtendedOps()
+{
+    CreateUserOps<Complex<Real>>();
+    CreateMaxOp<Real>();
+    CreateMinOp<Real>();
+    CreateSumOp<Real>();
+    CreateProdOp<Real>();
+    CreateSumOp<Complex<Real>>();
+    CreateProdOp<Complex<Real>>();
+    CreateFamilyOps<Real>();
+}
 
-    // double
-    // ======
+template<typename Real>
+void CreateExtendedFamily( int numDoubles )
+{
+    CreateContiguous<Real>( numDoubles, MPI_DOUBLE );
+    CreateContiguous<Complex<Real>>( 2, Types<Real>::type );
+    CreateValueIntType<Real>();
+    CreateValueIntType<Complex<Real>>();
+    CreateEntryType<Real>();
+    CreateEntryType<Complex<Real>>();
+    CreateExtendedOps<Real>();
+}
+
+template<typename Real>
+void CreateNativeFamily( Datatype valueIntType )
+{
 #ifdef EL_USE_64BIT_INTS
-    CreateValueIntType<double>();
+    CreateValueIntType<Real>();
 #else
-    TypeMap<ValueInt<double>>() = MPI_DOUBLE_INT;
+    Types<ValueInt<Real>>::type = valueIntType;
 #endif
-    CreateValueIntType<Complex<double>>();
-    CreateEntryType<double>();
-    CreateEntryType<Complex<double>>();
-    CreateUserOps<double>();
-    CreateUserOps<Complex<double>>();
+    CreateValueIntType<Complex<Real>>();
+    CreateEntryType<Real>();
+    CreateEntryType<Complex<Real>>();
+    CreateUserOps<Real>();
+    CreateUserOps<Complex<Real>>();
 #ifdef EL_USE_64BIT_INTS
-    CreateMaxLocOp<double>();
-    CreateMinLocOp<double>();
+    CreateMaxLocOp<Real>();
+    CreateMinLocOp<Real>();
 #else
-    MaxLocOp<double>() = MAXLOC;
-    MinLocOp<double>() = MINLOC;
+    Types<ValueInt<Real>>::maxOp = MAXLOC;
+    Types<ValueInt<Real>>::minOp = MINLOC;
 #endif
-    CreateMaxLocPairOp<double>();
-    CreateMinLocPairOp<double>();
+    CreateMaxLocPairOp<Real>();
+    CreateMinLocPairOp<Real>();
+}
+
+template<typename F>
+void CreateFamily();
+
+template<>
+void CreateFamily<Int>()
+{
+    CreateValueIntType<Int>();
+    CreateEntryType<Int>();
+    CreateFamilyOps<Int>();
+}
+
+template<>
+void CreateFamily<float>() { CreateNativeFamily<float>( MPI_FLOAT_INT ); }
+template<>
+void CreateFamily<double>() { CreateNativeFamily<double>( MPI_DOUBLE_INT ); }
 
 #ifdef EL_HAVE_QD
-    // DoubleDouble
-    // ============
-    CreateContiguous<DoubleDouble>( 2, MPI_DOUBLE );
-    CreateContiguous<Complex<DoubleDouble>>( 2, TypeMap<DoubleDouble>() );
-    CreateValueIntType<DoubleDouble>();
-    CreateValueIntType<Complex<DoubleDouble>>();
-    CreateEntryType<DoubleDouble>();
-    CreateEntryType<Complex<DoubleDouble>>();
-    CreateUserOps<DoubleDouble>();
-    CreateUserOps<Complex<DoubleDouble>>();
-    CreateMaxOp<DoubleDouble>();
-    CreateMinOp<DoubleDouble>();
-    CreateSumOp<DoubleDouble>();
-    CreateProdOp<DoubleDouble>();
-    CreateSumOp<Complex<DoubleDouble>>();
-    CreateProdOp<Complex<DoubleDouble>>();
-    CreateMaxLocOp<DoubleDouble>();
-    CreateMinLocOp<DoubleDouble>();
-    CreateMaxLocPairOp<DoubleDouble>();
-    CreateMinLocPairOp<DoubleDouble>();
-
-    // QuadDouble
-    // ==========
-    CreateContiguous<QuadDouble>( 4, MPI_DOUBLE );
-    CreateContiguous<Complex<QuadDouble>>( 2, TypeMap<QuadDouble>() );
-    CreateValueIntType<QuadDouble>();
-    CreateValueIntType<Complex<QuadDouble>>();
-    CreateEntryType<QuadDouble>();
-    CreateEntryType<Complex<QuadDouble>>();
-    CreateUserOps<QuadDouble>();
-    CreateUserOps<Complex<QuadDouble>>();
-    CreateMaxOp<QuadDouble>();
-    CreateMinOp<QuadDouble>();
-    CreateSumOp<QuadDouble>();
-    CreateProdOp<QuadDouble>();
-    CreateSumOp<Complex<QuadDouble>>();
-    CreateProdOp<Complex<QuadDouble>>();
-    CreateMaxLocOp<QuadDouble>();
-    CreateMinLocOp<QuadDouble>();
-    CreateMaxLocPairOp<QuadDouble>();
-    CreateMinLocPairOp<QuadDouble>();
+template<>
+void CreateFamily<DoubleDouble>()
+{ CreateExtendedFamily<DoubleDouble>( 2 ); }
+template<>
+void CreateFamily<QuadDouble>()
+{ CreateExtendedFamily<QuadDouble>( 4 ); }
 #endif
 
 #ifdef EL_HAVE_QUAD
-    // Quad
-    // ====
-    CreateContiguous<Quad>( 2, MPI_DOUBLE );
-    CreateContiguous<Complex<Quad>>( 2, TypeMap<Quad>() );
-    CreateValueIntType<Quad>();
-    CreateValueIntType<Complex<Quad>>();
-    CreateEntryType<Quad>();
-    CreateEntryType<Complex<Quad>>();
-    CreateUserOps<Quad>();
-    CreateUserOps<Complex<Quad>>();
-    CreateMaxOp<Quad>();
-    CreateMinOp<Quad>();
-    CreateSumOp<Quad>();
-    CreateProdOp<Quad>();
-    CreateSumOp<Complex<Quad>>();
-    CreateProdOp<Complex<Quad>>();
-    CreateMaxLocOp<Quad>();
-    CreateMinLocOp<Quad>();
-    CreateMaxLocPairOp<Quad>();
-    CreateMinLocPairOp<Quad>();
+template<>
+void CreateFamily<Quad>() { CreateExtendedFamily<Quad>( 2 ); }
 #endif
 
 #ifdef EL_HAVE_MPC
-    // BigFloat
-    // ========
-    // NOTE: The BigFloat types are created by mpfr::SetPrecision previously
-    //       within El::Initialize
-    CreateUserOps<BigFloat>();
-    CreateUserOps<Complex<BigFloat>>();
-    CreateMaxOp<BigFloat>();
-    CreateMinOp<BigFloat>();
-    CreateSumOp<BigFloat>();
-    CreateProdOp<BigFloat>();
-    CreateSumOp<Complex<BigFloat>>();
-    CreateProdOp<Complex<BigFloat>>();
-    CreateMaxLocOp<BigFloat>();
-    CreateMinLocOp<BigFloat>();
-    CreateMaxLocPairOp<BigFloat>();
-    CreateMinLocPairOp<BigFloat>();
-
-    // BigInt
-    // ======
+// The BigInt and BigFloat datatypes are created by mpfr::SetMinIntBits and
+// mpfr::SetPrecision within El::Initialize
+template<>
+void CreateFamily<BigInt>()
+{
     CreateUserOps<BigInt>();
     CreateMaxOp<BigInt>();
     CreateMinOp<BigInt>();
     CreateSumOp<BigInt>();
     CreateProdOp<BigInt>();
-    CreateMaxLocOp<BigInt>();
-    CreateMinLocOp<BigInt>();
-    CreateMaxLocPairOp<BigInt>();
-    CreateMinLocPairOp<BigInt>();
+    CreateFamilyOps<BigInt>();
+}
+template<>
+void CreateFamily<BigFloat>() { CreateExtendedOps<BigFloat>(); }
+#endif
+
+std::mutex customFamilyMutex;
+
+template<typename F>
+std::atomic<bool> CustomFamily<F>::created(false);
+
+template<typename F>
+void CustomFamily<F>::Create() EL_NO_RELEASE_EXCEPT
+{
+    EL_DEBUG_CSE
+    std::lock_guard<std::mutex> guard( customFamilyMutex );
+    if( created.load(std::memory_order_relaxed) )
+        return;
+    CreateFamily<F>();
+    created.store( true, std::memory_order_release );
+}
+
+template struct CustomFamily<Int>;
+template struct CustomFamily<float>;
+template struct CustomFamily<double>;
+#ifdef EL_HAVE_QD
+template struct CustomFamily<DoubleDouble>;
+template struct CustomFamily<QuadDouble>;
+#endif
+#ifdef EL_HAVE_QUAD
+template struct CustomFamily<Quad>;
+#endif
+#ifdef EL_HAVE_MPC
+template struct CustomFamily<BigInt>;
+template struct CustomFamily<BigFloat>;
+#endif
+
+void CreateCustom() EL_NO_RELEASE_EXCEPT
+{
+    CustomFamily<Int>::Create();
+    CustomFamily<float>::Create();
+    CustomFamily<double>::Create();
+#ifdef EL_HAVE_QD
+    CustomFamily<DoubleDouble>::Create();
+    CustomFamily<QuadDouble>::Create();
+#endif
+#ifdef EL_HAVE_QUAD
+    CustomFamily<Quad>::Create();
+#endif
+#ifdef EL_HAVE_MPC
+    CustomFamily<BigInt>::Create();
+    CustomFamily<BigFloat>::Create();
 #endif
 }
 
@@ -1067,21 +1070,38 @@ void DestroyScalarFamily()
     DestroyFamily<T>();
 }
 
+// Only the members which were created are freed, and the families are then
+// recreated upon their next use (e.g., after reinitializing Elemental)
+template<typename F>
+void DestroyCustomFamily()
+{
+    DestroyFamily<F>();
+    CustomFamily<F>::created.store( false, std::memory_order_release );
+}
+
+template<typename Real>
+void DestroyCustomScalarFamily()
+{
+    DestroyScalarFamily<Real>();
+    CustomFamily<Real>::created.store( false, std::memory_order_release );
+}
+
 void DestroyCustom() EL_NO_RELEASE_EXCEPT
 {
-    DestroyFamily<Int>();
-    DestroyScalarFamily<float>();
-    DestroyScalarFamily<double>();
+    std::lock_guard<std::mutex> guard( customFamilyMutex );
+    DestroyCustomFamily<Int>();
+    DestroyCustomScalarFamily<float>();
+    DestroyCustomScalarFamily<double>();
 #ifdef EL_HAVE_QD
-    DestroyScalarFamily<DoubleDouble>();
-    DestroyScalarFamily<QuadDouble>();
+    DestroyCustomScalarFamily<DoubleDouble>();
+    DestroyCustomScalarFamily<QuadDouble>();
 #endif
 #ifdef EL_HAVE_QUAD
-    DestroyScalarFamily<Quad>();
+    DestroyCustomScalarFamily<Quad>();
 #endif
 #ifdef EL_HAVE_MPC
-    DestroyScalarFamily<BigFloat>();
-    DestroyFamily<BigInt>();
+    DestroyCustomScalarFamily<BigFloat>();
+    DestroyCustomFamily<BigInt>();
 #endif
 }
 
@@ -7,11 +7,19 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <atomic>
 
 namespace {
 
-// A common Mersenne twister configuration
-std::mt19937 generator;
+// The seed of the Mersenne twister of the main Context; those of the
+// remaining Contexts are derived from it and their thread ids
+std::uint32_t generatorSeed = std::mt19937::default_seed;
+
+// The state of the counter-based generators
+bool counterBasedRandom = false;
+std::uint64_t counterBasedSeed = 21;
+std::atomic<std::uint32_t> numCollectiveStreams(0);
+std::atomic<std::uint32_t> numLocalStreams(0);
 
 #ifdef EL_HAVE_MPC
 gmp_randstate_t gmpRandState;
@@ -27,7 +35,13 @@ void InitializeRandom( bool deterministic )
     const long secs = ( deterministic ? 21 : time(NULL) );
     const long seed = (secs<<16) | (rank & 0xFFFF);
 
-    ::generator.seed( seed );
+    ::generatorSeed = std::uint32_t(seed);
+    Generator().seed( ::generatorSeed );
+
+    // The counter-based streams must agree over all processes
+    Int counterSecs = secs;
+    mpi::Broadcast( counterSecs, 0, mpi::COMM_WORLD );
+    SetCounterBasedSeed( counterSecs );
 
     srand( seed );
 
@@ -47,7 +61,50 @@ void FinalizeRandom()
 }
 
 std::mt19937& Generator()
-{ return ::generator; }
+{ return CurrentContext().generator; }
+
+void SeedGenerator( std::mt19937& generator, Int threadId )
+{
+    if( threadId == 0 )
+    {
+        generator.seed( ::generatorSeed );
+    }
+    else
+    {
+        const std::uint64_t id = threadId;
+        std::seed_seq seq
+        { ::generatorSeed, std::uint32_t(id), std::uint32_t(id>>32) };
+        generator.seed( seq );
+    }
+}
+
+void SetCounterBasedRandom( bool counterBased )
+{ ::counterBasedRandom = counterBased; }
+
+bool CounterBasedRandom()
+{ return ::counterBasedRandom; }
+
+void SetCounterBasedSeed( std::uint64_t seed )
+{
+    ::counterBasedSeed = seed;
+    ::numCollectiveStreams = 0;
+    ::numLocalStreams = 0;
+}
+
+std::uint64_t CounterBasedSeed()
+{ return ::counterBasedSeed; }
+
+CounterRNG NewCounterRNG( bool collective )
+{
+    // The local streams are distinguished by their most significant bit
+    const std::uint32_t localBit = std::uint32_t(1) << 31;
+    if( collective )
+        return CounterRNG
+        ( ::counterBasedSeed, (::numCollectiveStreams++) & ~localBit );
+    else
+        return CounterRNG
+        ( ::counterBasedSeed, (::numLocalStreams++) | localBit );
+}
 
 #ifdef EL_HAVE_MPC
 namespace mpfr {
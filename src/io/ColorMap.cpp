@@ -10,8 +10,9 @@
 
 namespace El {
 
-#ifdef EL_HAVE_QT5
-QRgb SampleColorMap( double value, double minVal, double maxVal )
+void SampleColorMap
+( double value, double minVal, double maxVal,
+  byte& redByte, byte& greenByte, byte& blueByte )
 {
     EL_DEBUG_CSE
     const ColorMap colorMap = GetColorMap();
@@ -20,37 +21,44 @@ QRgb SampleColorMap( double value, double minVal, double maxVal )
     const double portion = (value-minVal) / (maxVal-minVal);
     const double discretePortion = int(portion*numChunks)/(1.*numChunks);
 
-    int red, green, blue, alpha;
+    int red, green, blue;
     switch( colorMap )
     {
     case RED_BLACK_GREEN:
         red = ( portion<=0.5 ? 255*(1.-2*portion) : 0 );
         green = ( portion>=0.5 ? 255*(2*(portion-0.5)) : 0 );
         blue = 0;
-        alpha = 255;
         break;
     case BLUE_RED:
         red = 255*portion;
         green = 0;
         blue = 255*(1.-portion/2);
-        alpha = 255;
         break;
     case GRAYSCALE_DISCRETE:
         red = 255*discretePortion;
         green = 255*discretePortion;
         blue = 255*discretePortion;
-        alpha = 255;
         break;
     case GRAYSCALE:
     default:
         red = 255*portion;
         green = 255*portion;
         blue = 255*portion;
-        alpha = 255;
         break;
     }
 
-    return qRgba( red, green, blue, alpha );
+    redByte = byte(Max(Min(red,255),0));
+    greenByte = byte(Max(Min(green,255),0));
+    blueByte = byte(Max(Min(blue,255),0));
+}
+
+#ifdef EL_HAVE_QT5
+QRgb SampleColorMap( double value, double minVal, double maxVal )
+{
+    EL_DEBUG_CSE
+    byte red, green, blue;
+    SampleColorMap( value, minVal, maxVal, red, green, blue );
+    return qRgba( red, green, blue, 255 );
 }
 #endif // ifdef EL_HAVE_QT5
 
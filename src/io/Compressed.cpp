@@ -0,0 +1,430 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#ifdef EL_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#include "./MPIIO.hpp"
+
+namespace El {
+
+#ifdef EL_HAVE_ZLIB
+namespace compressed {
+
+// The height, width, entry size, chunk width, and shuffle flag
+const Int numMetaInts = 5;
+
+inline Int ChunkWidth
+( Int height, size_t entrySize, const CompressionCtrl& ctrl )
+{
+    if( ctrl.chunkWidth > 0 )
+        return ctrl.chunkWidth;
+    const Int targetBytes = Int(1) << 20;
+    const Int columnBytes = Max(height,Int(1))*Int(entrySize);
+    return Max( targetBytes/columnBytes, Int(1) );
+}
+
+inline Int NumChunks( Int width, Int chunkWidth )
+{ return (width+chunkWidth-1) / chunkWidth; }
+
+// Compress the 'numEntries' contiguous entries of 'buffer' into 'chunk'
+inline void Compress
+( const byte* buffer, Int numEntries, size_t entrySize,
+  const CompressionCtrl& ctrl, vector<byte>& chunk )
+{
+    const size_t numBytes = size_t(numEntries)*entrySize;
+    const byte* source = buffer;
+    vector<byte> shuffled;
+    if( ctrl.shuffle && entrySize > 1 )
+    {
+        // Group the b'th byte of every entry together
+        shuffled.resize( numBytes );
+        for( Int i=0; i<numEntries; ++i )
+            for( size_t b=0; b<entrySize; ++b )
+                shuffled[b*numEntries+i] = buffer[i*entrySize+b];
+        source = shuffled.data();
+    }
+    uLongf compressedSize = compressBound( numBytes );
+    chunk.resize( compressedSize );
+    const int error =
+      compress2( chunk.data(), &compressedSize, source, numBytes, ctrl.level );
+    if( error != Z_OK )
+        RuntimeError("zlib compression failed with error ",error);
+    chunk.resize( compressedSize );
+}
+
+inline void Decompress
+( const vector<byte>& chunk, Int numEntries, size_t entrySize, bool shuffle,
+  byte* buffer )
+{
+    const size_t numBytes = size_t(numEntries)*entrySize;
+    byte* target = buffer;
+    vector<byte> shuffled;
+    if( shuffle && entrySize > 1 )
+    {
+        shuffled.resize( numBytes );
+        target = shuffled.data();
+    }
+    uLongf size = numBytes;
+    const int error = uncompress( target, &size, chunk.data(), chunk.size() );
+    if( error != Z_OK || size != numBytes )
+        RuntimeError("Could not decompress a chunk (zlib error ",error,")");
+    if( shuffle && entrySize > 1 )
+        for( Int i=0; i<numEntries; ++i )
+            for( size_t b=0; b<entrySize; ++b )
+                buffer[i*entrySize+b] = shuffled[b*numEntries+i];
+}
+
+// Compress (or decompress) a block of whole columns, which need not be
+// contiguous
+template<typename T>
+void CompressColumns
+( const T* buffer, Int height, Int width, Int ldim,
+  const CompressionCtrl& ctrl, vector<byte>& chunk )
+{
+    vector<T> contiguous;
+    if( ldim != height && width > 1 )
+    {
+        contiguous.resize( height*width );
+        for( Int j=0; j<width; ++j )
+            MemCopy( &contiguous[j*height], &buffer[j*ldim], height );
+        buffer = contiguous.data();
+    }
+    Compress
+    ( reinterpret_cast<const byte*>(buffer), height*width, sizeof(T), ctrl,
+      chunk );
+}
+
+template<typename T>
+void DecompressColumns
+( const vector<byte>& chunk, bool shuffle, T* buffer, Int height, Int width,
+  Int ldim )
+{
+    if( ldim != height && width > 1 )
+    {
+        vector<T> contiguous( height*width );
+        Decompress
+        ( chunk, height*width, sizeof(T), shuffle,
+          reinterpret_cast<byte*>(contiguous.data()) );
+        for( Int j=0; j<width; ++j )
+            MemCopy( &buffer[j*ldim], &contiguous[j*height], height );
+    }
+    else
+        Decompress
+        ( chunk, height*width, sizeof(T), shuffle,
+          reinterpret_cast<byte*>(buffer) );
+}
+
+// Apply 'body' to each of the chunks, over the threads if possible
+template<typename Function>
+void ForEachChunk( Int numChunks, Function body )
+{
+    bool concurrent = false;
+#ifdef EL_HYBRID
+    const int numThreads = blas::FallbackThreads();
+    concurrent = numThreads > 1 && numChunks > 1 && !omp_in_parallel();
+    if( concurrent )
+    {
+        std::exception_ptr error;
+        _Pragma("omp parallel for schedule(dynamic,1) num_threads(numThreads)")
+        for( Int k=0; k<numChunks; ++k )
+        {
+            try { body( k ); }
+            catch( ... )
+            {
+                _Pragma("omp critical")
+                error = std::current_exception();
+            }
+        }
+        if( error )
+            std::rethrow_exception( error );
+    }
+#endif
+    if( !concurrent )
+        for( Int k=0; k<numChunks; ++k )
+            body( k );
+}
+
+// Return the offsets of the chunks given their sizes
+inline vector<Int> Offsets( const vector<Int>& chunkSizes )
+{
+    const Int numChunks = chunkSizes.size();
+    vector<Int> offsets( numChunks+1 );
+    offsets[0] = 0;
+    for( Int k=0; k<numChunks; ++k )
+        offsets[k+1] = offsets[k] + chunkSizes[k];
+    return offsets;
+}
+
+template<typename T>
+void CheckMeta( const Int* meta, const string& filename )
+{
+    if( meta[2] != Int(sizeof(T)) )
+        RuntimeError
+        (filename," has entries of ",meta[2]," bytes rather than ",
+         sizeof(T));
+    if( meta[0] < 0 || meta[1] < 0 || meta[3] < 1 )
+        RuntimeError(filename," has an invalid header");
+}
+
+} // namespace compressed
+#endif // ifdef EL_HAVE_ZLIB
+
+template<typename T>
+void WriteCompressed
+( const Matrix<T>& A, string basename, const CompressionCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_ZLIB
+    if( !IsPacked<T>::value )
+        LogicError("Only packed datatypes can be compressed");
+    const string filename = basename + "." + FileExtension(BINARY_COMPRESSED);
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Int chunkWidth = compressed::ChunkWidth( height, sizeof(T), ctrl );
+    const Int numChunks = compressed::NumChunks( width, chunkWidth );
+
+    vector<vector<byte>> chunks( numChunks );
+    compressed::ForEachChunk
+    ( numChunks,
+      [&]( Int k )
+      {
+          const Int jBeg = k*chunkWidth;
+          const Int chunkSize = Min( chunkWidth, width-jBeg );
+          compressed::CompressColumns
+          ( A.LockedBuffer(0,jBeg), height, chunkSize, A.LDim(), ctrl,
+            chunks[k] );
+      } );
+    vector<Int> chunkSizes( numChunks );
+    for( Int k=0; k<numChunks; ++k )
+        chunkSizes[k] = chunks[k].size();
+    const vector<Int> offsets = compressed::Offsets( chunkSizes );
+
+    std::ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    const Int meta[compressed::numMetaInts] =
+      { height, width, Int(sizeof(T)), chunkWidth, Int(ctrl.shuffle) };
+    file.write( (const char*)meta, sizeof(meta) );
+    file.write( (const char*)offsets.data(), offsets.size()*sizeof(Int) );
+    for( Int k=0; k<numChunks; ++k )
+        file.write( (const char*)chunks[k].data(), chunks[k].size() );
+    if( !file )
+        RuntimeError("Could not write ",filename);
+#else
+    LogicError("Elemental was not built with zlib support");
+#endif
+}
+
+template<typename T>
+void WriteCompressed
+( const AbstractDistMatrix<T>& A, string basename,
+  const CompressionCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_ZLIB
+    if( !IsPacked<T>::value )
+        LogicError("Only packed datatypes can be compressed");
+    const string filename = basename + "." + FileExtension(BINARY_COMPRESSED);
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const Int chunkWidth = compressed::ChunkWidth( height, sizeof(T), ctrl );
+    const Int numChunks = compressed::NumChunks( width, chunkWidth );
+    mpi::Comm comm = A.Grid().ViewingComm();
+
+    // Deal the chunks out to the processes and compress our own
+    DistMatrix<T,STAR,VR,BLOCK>
+      B( height, width, A.Grid(), Max(height,Int(1)), chunkWidth );
+    Copy( A, B );
+    const Int localWidth = B.LocalWidth();
+    const Int numLocalChunks = compressed::NumChunks( localWidth, chunkWidth );
+    vector<vector<byte>> chunks( numLocalChunks );
+    compressed::ForEachChunk
+    ( numLocalChunks,
+      [&]( Int l )
+      {
+          const Int jLocBeg = l*chunkWidth;
+          const Int chunkSize = Min( chunkWidth, localWidth-jLocBeg );
+          compressed::CompressColumns
+          ( B.LockedBuffer(0,jLocBeg), height, chunkSize, B.LDim(), ctrl,
+            chunks[l] );
+      } );
+    vector<Int> chunkSizes( numChunks, 0 );
+    for( Int l=0; l<numLocalChunks; ++l )
+        chunkSizes[B.GlobalCol(l*chunkWidth)/chunkWidth] = chunks[l].size();
+    mpi::AllReduce( chunkSizes.data(), numChunks, mpi::SUM, comm );
+    const vector<Int> offsets = compressed::Offsets( chunkSizes );
+
+    MPI_File file;
+    const int error =
+      MPI_File_open
+      ( comm.comm, const_cast<char*>(filename.c_str()),
+        MPI_MODE_WRONLY | MPI_MODE_CREATE, MPI_INFO_NULL, &file );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+    const MPI_Offset dataOffset =
+      (compressed::numMetaInts+numChunks+1)*sizeof(Int);
+    mpi_io::Check
+    ( MPI_File_set_size( file, dataOffset+offsets[numChunks] ),
+      "MPI_File_set_size" );
+    if( mpi::Rank(comm) == 0 )
+    {
+        const Int meta[compressed::numMetaInts] =
+          { height, width, Int(sizeof(T)), chunkWidth, Int(ctrl.shuffle) };
+        mpi_io::WriteBytes
+        ( file, 0, reinterpret_cast<const byte*>(meta), sizeof(meta) );
+        mpi_io::WriteBytes
+        ( file, sizeof(meta), reinterpret_cast<const byte*>(offsets.data()),
+          offsets.size()*sizeof(Int) );
+    }
+    for( Int l=0; l<numLocalChunks; ++l )
+    {
+        const Int k = B.GlobalCol(l*chunkWidth) / chunkWidth;
+        mpi_io::WriteBytes
+        ( file, dataOffset+offsets[k], chunks[l].data(), chunks[l].size() );
+    }
+    mpi_io::Check( MPI_File_close( &file ), "MPI_File_close" );
+#else
+    LogicError("Elemental was not built with zlib support");
+#endif
+}
+
+template<typename T>
+void ReadCompressed( Matrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_ZLIB
+    if( !IsPacked<T>::value )
+        LogicError("Only packed datatypes can be compressed");
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    Int meta[compressed::numMetaInts];
+    file.read( (char*)meta, sizeof(meta) );
+    if( !file )
+        RuntimeError("Could not read the header of ",filename);
+    compressed::CheckMeta<T>( meta, filename );
+    const Int height = meta[0];
+    const Int width = meta[1];
+    const Int chunkWidth = meta[3];
+    const bool shuffle = meta[4];
+    const Int numChunks = compressed::NumChunks( width, chunkWidth );
+
+    vector<Int> offsets( numChunks+1 );
+    file.read( (char*)offsets.data(), offsets.size()*sizeof(Int) );
+    vector<vector<byte>> chunks( numChunks );
+    for( Int k=0; k<numChunks; ++k )
+    {
+        chunks[k].resize( offsets[k+1]-offsets[k] );
+        file.read( (char*)chunks[k].data(), chunks[k].size() );
+    }
+    if( !file )
+        RuntimeError(filename," is truncated");
+
+    A.Resize( height, width );
+    compressed::ForEachChunk
+    ( numChunks,
+      [&]( Int k )
+      {
+          const Int jBeg = k*chunkWidth;
+          const Int chunkSize = Min( chunkWidth, width-jBeg );
+          compressed::DecompressColumns
+          ( chunks[k], shuffle, A.Buffer(0,jBeg), height, chunkSize,
+            A.LDim() );
+      } );
+#else
+    LogicError("Elemental was not built with zlib support");
+#endif
+}
+
+template<typename T>
+void ReadCompressed( AbstractDistMatrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_ZLIB
+    if( !IsPacked<T>::value )
+        LogicError("Only packed datatypes can be compressed");
+    mpi::Comm comm = A.Grid().ViewingComm();
+    MPI_File file;
+    const int error =
+      MPI_File_open
+      ( comm.comm, const_cast<char*>(filename.c_str()), MPI_MODE_RDONLY,
+        MPI_INFO_NULL, &file );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+
+    Int meta[compressed::numMetaInts];
+    MPI_Status status;
+    mpi_io::Check
+    ( MPI_File_read_at_all
+      ( file, 0, meta, int(sizeof(meta)), MPI_BYTE, &status ),
+      "MPI_File_read_at_all" );
+    compressed::CheckMeta<T>( meta, filename );
+    const Int height = meta[0];
+    const Int width = meta[1];
+    const Int chunkWidth = meta[3];
+    const bool shuffle = meta[4];
+    const Int numChunks = compressed::NumChunks( width, chunkWidth );
+    vector<Int> offsets( numChunks+1 );
+    mpi_io::Check
+    ( MPI_File_read_at_all
+      ( file, sizeof(meta), offsets.data(), int(offsets.size()*sizeof(Int)),
+        MPI_BYTE, &status ), "MPI_File_read_at_all" );
+    const MPI_Offset dataOffset = sizeof(meta) + offsets.size()*sizeof(Int);
+
+    // Read the chunks which we are dealt (in the same manner as the writer,
+    // but for our grid) and decompress them over our threads
+    DistMatrix<T,STAR,VR,BLOCK>
+      B( height, width, A.Grid(), Max(height,Int(1)), chunkWidth );
+    const Int localWidth = B.LocalWidth();
+    const Int numLocalChunks = compressed::NumChunks( localWidth, chunkWidth );
+    vector<vector<byte>> chunks( numLocalChunks );
+    for( Int l=0; l<numLocalChunks; ++l )
+    {
+        const Int k = B.GlobalCol(l*chunkWidth) / chunkWidth;
+        chunks[l].resize( offsets[k+1]-offsets[k] );
+        mpi_io::ReadBytes
+        ( file, dataOffset+offsets[k], chunks[l].data(), chunks[l].size() );
+    }
+    mpi_io::Check( MPI_File_close( &file ), "MPI_File_close" );
+    compressed::ForEachChunk
+    ( numLocalChunks,
+      [&]( Int l )
+      {
+          const Int jLocBeg = l*chunkWidth;
+          const Int chunkSize = Min( chunkWidth, localWidth-jLocBeg );
+          compressed::DecompressColumns
+          ( chunks[l], shuffle, B.Buffer(0,jLocBeg), height, chunkSize,
+            B.LDim() );
+      } );
+    Copy( B, A );
+#else
+    LogicError("Elemental was not built with zlib support");
+#endif
+}
+
+#define PROTO(T) \
+  template void WriteCompressed \
+  ( const Matrix<T>& A, string basename, const CompressionCtrl& ctrl ); \
+  template void WriteCompressed \
+  ( const AbstractDistMatrix<T>& A, string basename, \
+    const CompressionCtrl& ctrl ); \
+  template void ReadCompressed( Matrix<T>& A, const string filename ); \
+  template void ReadCompressed \
+  ( AbstractDistMatrix<T>& A, const string filename );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -41,6 +41,8 @@ string FileExtension( FileFormat format )
     case PPM:              return "ppm";  break;
     case XBM:              return "xbm";  break;
     case XPM:              return "xpm";  break;
+    case HDF5:             return "h5";   break;
+    case BINARY_COMPRESSED: return "binz"; break;
     default: LogicError("Format not found"); return "N/A"; break;
     }
 }
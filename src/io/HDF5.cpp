@@ -0,0 +1,773 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#ifdef EL_HAVE_HDF5
+#include <hdf5.h>
+#endif
+
+namespace El {
+
+#ifdef EL_HAVE_HDF5
+namespace hdf5 {
+
+template<typename S>
+S Check( S result, const char* routine )
+{
+    if( result < 0 )
+        RuntimeError(routine," failed");
+    return result;
+}
+
+template<typename T>
+struct TypeHelper
+{
+    static hid_t Create()
+    {
+        LogicError("HDF5 I/O is not supported for ",TypeName<T>());
+        return -1;
+    }
+};
+template<>
+struct TypeHelper<int>
+{ static hid_t Create() { return H5Tcopy( H5T_NATIVE_INT ); } };
+template<>
+struct TypeHelper<long int>
+{ static hid_t Create() { return H5Tcopy( H5T_NATIVE_LONG ); } };
+template<>
+struct TypeHelper<long long int>
+{ static hid_t Create() { return H5Tcopy( H5T_NATIVE_LLONG ); } };
+template<>
+struct TypeHelper<float>
+{ static hid_t Create() { return H5Tcopy( H5T_NATIVE_FLOAT ); } };
+template<>
+struct TypeHelper<double>
+{ static hid_t Create() { return H5Tcopy( H5T_NATIVE_DOUBLE ); } };
+template<typename Real>
+struct TypeHelper<Complex<Real>>
+{
+    static hid_t Create()
+    {
+        // Follow the {r,i} convention of h5py and Octave
+        hid_t realType = TypeHelper<Real>::Create();
+        hid_t type = H5Tcreate( H5T_COMPOUND, sizeof(Complex<Real>) );
+        H5Tinsert( type, "r", 0, realType );
+        H5Tinsert( type, "i", sizeof(Real), realType );
+        H5Tclose( realType );
+        return type;
+    }
+};
+
+// The returned datatype must be closed by the caller
+template<typename T>
+hid_t Type()
+{ return Check( TypeHelper<T>::Create(), "Creating an HDF5 datatype" ); }
+
+// Parallel I/O is only used if HDF5 supports it and there is more than one
+// process
+inline bool UseParallel( mpi::Comm comm )
+{
+#ifdef H5_HAVE_PARALLEL
+    return mpi::Size( comm ) > 1;
+#else
+    return false;
+#endif
+}
+
+inline hid_t OpenFile
+( const string& filename, unsigned mode, mpi::Comm comm, bool parallel )
+{
+    EL_DEBUG_CSE
+    hid_t accessList = Check( H5Pcreate( H5P_FILE_ACCESS ), "H5Pcreate" );
+#ifdef H5_HAVE_PARALLEL
+    if( parallel )
+        Check
+        ( H5Pset_fapl_mpio( accessList, comm.comm, MPI_INFO_NULL ),
+          "H5Pset_fapl_mpio" );
+#endif
+    hid_t file =
+      ( mode == H5F_ACC_TRUNC ?
+        H5Fcreate( filename.c_str(), mode, H5P_DEFAULT, accessList ) :
+        H5Fopen( filename.c_str(), mode, accessList ) );
+    H5Pclose( accessList );
+    if( file < 0 )
+        RuntimeError("Could not open ",filename);
+    return file;
+}
+
+inline hid_t TransferList( bool parallel, const HDF5Ctrl& ctrl )
+{
+    hid_t transferList = Check( H5Pcreate( H5P_DATASET_XFER ), "H5Pcreate" );
+#ifdef H5_HAVE_PARALLEL
+    if( parallel )
+        Check
+        ( H5Pset_dxpl_mpio
+          ( transferList,
+            ctrl.collective ? H5FD_MPIO_COLLECTIVE : H5FD_MPIO_INDEPENDENT ),
+          "H5Pset_dxpl_mpio" );
+#endif
+    return transferList;
+}
+
+// Build the creation property list of a dataset with the given dimensions,
+// which are ordered as (width,height) for dense matrices
+inline hid_t CreationList
+( int rank, const hsize_t* dims, const HDF5Ctrl& ctrl )
+{
+    hid_t creationList =
+      Check( H5Pcreate( H5P_DATASET_CREATE ), "H5Pcreate" );
+    const bool chunked = ctrl.chunkHeight > 0 || ctrl.chunkWidth > 0 ||
+                         ctrl.compressionLevel > 0;
+    bool empty = false;
+    for( int r=0; r<rank; ++r )
+        empty = empty || dims[r] == 0;
+    if( !chunked || empty )
+        return creationList;
+
+    const Int defaultChunk = ( rank == 1 ? 65536 : 256 );
+    const Int requested[2] =
+      { ( rank == 1 ? ctrl.chunkHeight : ctrl.chunkWidth ), ctrl.chunkHeight };
+    hsize_t chunk[2];
+    for( int r=0; r<rank; ++r )
+    {
+        const Int size = ( requested[r] > 0 ? requested[r] : defaultChunk );
+        chunk[r] = Min( hsize_t(size), dims[r] );
+    }
+    Check( H5Pset_chunk( creationList, rank, chunk ), "H5Pset_chunk" );
+    if( ctrl.compressionLevel > 0 )
+    {
+        const unsigned level = unsigned(Min(ctrl.compressionLevel,9));
+        Check( H5Pset_deflate( creationList, level ), "H5Pset_deflate" );
+    }
+    return creationList;
+}
+
+template<typename T>
+hid_t Dataset
+( hid_t location, const char* name, bool create, int rank,
+  const hsize_t* dims, const HDF5Ctrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( !create )
+        return Check( H5Dopen2( location, name, H5P_DEFAULT ), "H5Dopen2" );
+    hid_t space = Check( H5Screate_simple( rank, dims, NULL ), "H5Screate" );
+    hid_t type = Type<T>();
+    hid_t creationList = CreationList( rank, dims, ctrl );
+    hid_t dataset =
+      H5Dcreate2
+      ( location, name, type, space, H5P_DEFAULT, creationList, H5P_DEFAULT );
+    H5Pclose( creationList );
+    H5Tclose( type );
+    H5Sclose( space );
+    return Check( dataset, "H5Dcreate2" );
+}
+
+// Read or write the entries (start[0]+k*stride[0],start[1]+l*stride[1]), for
+// 0 <= k < count[0] and 0 <= l < count[1], of a two-dimensional dataset which
+// are stored in the leading count[1] x count[0] block of a column-major
+// buffer with the given leading dimension. Inactive processes still take
+// part in collective transfers with empty selections.
+template<typename T>
+void TransferDense
+( bool write, hid_t dataset, hid_t transferList, T* buffer, Int ldim,
+  const hsize_t* start, const hsize_t* stride, const hsize_t* count,
+  bool active )
+{
+    EL_DEBUG_CSE
+    hid_t fileSpace = Check( H5Dget_space( dataset ), "H5Dget_space" );
+    const hsize_t memDims[2] =
+      { Max(count[0],hsize_t(1)), Max(hsize_t(ldim),hsize_t(1)) };
+    hid_t memSpace =
+      Check( H5Screate_simple( 2, memDims, NULL ), "H5Screate_simple" );
+    if( !active || count[0] == 0 || count[1] == 0 )
+    {
+        H5Sselect_none( fileSpace );
+        H5Sselect_none( memSpace );
+    }
+    else
+    {
+        const hsize_t memStart[2] = { 0, 0 };
+        Check
+        ( H5Sselect_hyperslab
+          ( fileSpace, H5S_SELECT_SET, start, stride, count, NULL ),
+          "H5Sselect_hyperslab" );
+        Check
+        ( H5Sselect_hyperslab
+          ( memSpace, H5S_SELECT_SET, memStart, NULL, count, NULL ),
+          "H5Sselect_hyperslab" );
+    }
+    hid_t type = Type<T>();
+    const herr_t error =
+      ( write ?
+        H5Dwrite( dataset, type, memSpace, fileSpace, transferList, buffer ) :
+        H5Dread( dataset, type, memSpace, fileSpace, transferList, buffer ) );
+    H5Tclose( type );
+    H5Sclose( memSpace );
+    H5Sclose( fileSpace );
+    Check( error, write ? "H5Dwrite" : "H5Dread" );
+}
+
+// Read or write entries [offset,offset+count) of a one-dimensional dataset
+template<typename T>
+void TransferVector
+( bool write, hid_t dataset, hid_t transferList, T* buffer,
+  Int offset, Int count )
+{
+    EL_DEBUG_CSE
+    hid_t fileSpace = Check( H5Dget_space( dataset ), "H5Dget_space" );
+    const hsize_t memDims[1] = { Max(hsize_t(count),hsize_t(1)) };
+    hid_t memSpace =
+      Check( H5Screate_simple( 1, memDims, NULL ), "H5Screate_simple" );
+    if( count == 0 )
+    {
+        H5Sselect_none( fileSpace );
+        H5Sselect_none( memSpace );
+    }
+    else
+    {
+        const hsize_t start[1] = { hsize_t(offset) };
+        const hsize_t counts[1] = { hsize_t(count) };
+        Check
+        ( H5Sselect_hyperslab
+          ( fileSpace, H5S_SELECT_SET, start, NULL, counts, NULL ),
+          "H5Sselect_hyperslab" );
+    }
+    hid_t type = Type<T>();
+    const herr_t error =
+      ( write ?
+        H5Dwrite( dataset, type, memSpace, fileSpace, transferList, buffer ) :
+        H5Dread( dataset, type, memSpace, fileSpace, transferList, buffer ) );
+    H5Tclose( type );
+    H5Sclose( memSpace );
+    H5Sclose( fileSpace );
+    Check( error, write ? "H5Dwrite" : "H5Dread" );
+}
+
+// Call write(file,create,parallel) on each process of 'comm', either
+// collectively on a file opened with the MPI-IO driver or, without parallel
+// HDF5, on one process at a time, where the first process creates the file
+// (and its datasets) and the rest then open them
+template<typename Function>
+void WriteFile( const string& filename, mpi::Comm comm, Function write )
+{
+    EL_DEBUG_CSE
+    if( UseParallel( comm ) )
+    {
+        const bool parallel = true;
+        hid_t file = OpenFile( filename, H5F_ACC_TRUNC, comm, parallel );
+        write( file, true, parallel );
+        Check( H5Fclose( file ), "H5Fclose" );
+        return;
+    }
+
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    const bool parallel = false;
+    for( int turn=0; turn<commSize; ++turn )
+    {
+        if( turn == commRank )
+        {
+            const bool create = ( turn == 0 );
+            hid_t file =
+              OpenFile
+              ( filename, create ? H5F_ACC_TRUNC : H5F_ACC_RDWR,
+                mpi::COMM_SELF, parallel );
+            write( file, create, parallel );
+            Check( H5Fclose( file ), "H5Fclose" );
+        }
+        mpi::Barrier( comm );
+    }
+}
+
+// Read the height and width of a dense dataset
+inline void DenseSize( hid_t dataset, Int& height, Int& width )
+{
+    EL_DEBUG_CSE
+    hid_t space = Check( H5Dget_space( dataset ), "H5Dget_space" );
+    hsize_t dims[2];
+    const int rank = H5Sget_simple_extent_ndims( space );
+    if( rank != 2 )
+    {
+        H5Sclose( space );
+        RuntimeError("Expected a two-dimensional dataset but found ",rank);
+    }
+    H5Sget_simple_extent_dims( space, dims, NULL );
+    H5Sclose( space );
+    width = Int(dims[0]);
+    height = Int(dims[1]);
+}
+
+template<typename T>
+void WriteDense
+( hid_t file, bool create, bool parallel,
+  Int height, Int width, const T* buffer, Int ldim,
+  const hsize_t* start, const hsize_t* stride, const hsize_t* count,
+  bool active, const HDF5Ctrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const hsize_t dims[2] = { hsize_t(width), hsize_t(height) };
+    hid_t dataset =
+      Dataset<T>( file, ctrl.dataset.c_str(), create, 2, dims, ctrl );
+    hid_t transferList = TransferList( parallel, ctrl );
+    TransferDense
+    ( true, dataset, transferList, const_cast<T*>(buffer), ldim,
+      start, stride, count, active );
+    H5Pclose( transferList );
+    Check( H5Dclose( dataset ), "H5Dclose" );
+}
+
+inline void WriteSizeAttribute( hid_t group, const char* name, Int value )
+{
+    EL_DEBUG_CSE
+    hid_t space = Check( H5Screate( H5S_SCALAR ), "H5Screate" );
+    hid_t type = Type<Int>();
+    hid_t attribute =
+      Check
+      ( H5Acreate2( group, name, type, space, H5P_DEFAULT, H5P_DEFAULT ),
+        "H5Acreate2" );
+    const herr_t error = H5Awrite( attribute, type, &value );
+    H5Aclose( attribute );
+    H5Tclose( type );
+    H5Sclose( space );
+    Check( error, "H5Awrite" );
+}
+
+inline Int ReadSizeAttribute( hid_t group, const char* name )
+{
+    EL_DEBUG_CSE
+    hid_t attribute = Check( H5Aopen( group, name, H5P_DEFAULT ), "H5Aopen" );
+    hid_t type = Type<Int>();
+    Int value;
+    const herr_t error = H5Aread( attribute, type, &value );
+    H5Tclose( type );
+    H5Aclose( attribute );
+    Check( error, "H5Aread" );
+    return value;
+}
+
+// Write entries [offset,offset+numLocalEntries) of the coordinate datasets
+// of a sparse matrix with the given total number of entries
+template<typename T>
+void WriteCoordinates
+( hid_t file, bool create, bool parallel,
+  Int height, Int width, Int numEntries,
+  Int offset, Int numLocalEntries,
+  const Int* rows, const Int* cols, const T* values,
+  const HDF5Ctrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const char* name = ctrl.dataset.c_str();
+    hid_t group =
+      ( create ?
+        H5Gcreate2( file, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT ) :
+        H5Gopen2( file, name, H5P_DEFAULT ) );
+    Check( group, "Opening an HDF5 group" );
+    if( create )
+    {
+        WriteSizeAttribute( group, "height", height );
+        WriteSizeAttribute( group, "width", width );
+    }
+
+    const hsize_t dims[1] = { hsize_t(numEntries) };
+    hid_t transferList = TransferList( parallel, ctrl );
+    hid_t rowSet = Dataset<Int>( group, "row", create, 1, dims, ctrl );
+    TransferVector
+    ( true, rowSet, transferList, const_cast<Int*>(rows),
+      offset, numLocalEntries );
+    H5Dclose( rowSet );
+    hid_t colSet = Dataset<Int>( group, "col", create, 1, dims, ctrl );
+    TransferVector
+    ( true, colSet, transferList, const_cast<Int*>(cols),
+      offset, numLocalEntries );
+    H5Dclose( colSet );
+    hid_t valueSet = Dataset<T>( group, "value", create, 1, dims, ctrl );
+    TransferVector
+    ( true, valueSet, transferList, const_cast<T*>(values),
+      offset, numLocalEntries );
+    H5Dclose( valueSet );
+    H5Pclose( transferList );
+    Check( H5Gclose( group ), "H5Gclose" );
+}
+
+// Open the group of a sparse matrix and read its size
+inline hid_t OpenCoordinates
+( hid_t file, const HDF5Ctrl& ctrl, Int& height, Int& width, Int& numEntries )
+{
+    EL_DEBUG_CSE
+    hid_t group =
+      Check( H5Gopen2( file, ctrl.dataset.c_str(), H5P_DEFAULT ), "H5Gopen2" );
+    height = ReadSizeAttribute( group, "height" );
+    width = ReadSizeAttribute( group, "width" );
+
+    hid_t valueSet =
+      Check( H5Dopen2( group, "value", H5P_DEFAULT ), "H5Dopen2" );
+    hid_t space = Check( H5Dget_space( valueSet ), "H5Dget_space" );
+    hsize_t dims[1];
+    H5Sget_simple_extent_dims( space, dims, NULL );
+    numEntries = Int(dims[0]);
+    H5Sclose( space );
+    H5Dclose( valueSet );
+    return group;
+}
+
+template<typename T>
+void ReadCoordinates
+( hid_t group, bool parallel, Int offset, Int numLocalEntries,
+  vector<Int>& rows, vector<Int>& cols, vector<T>& values,
+  const HDF5Ctrl& ctrl )
+{
+    EL_DEBUG_CSE
+    rows.resize( numLocalEntries );
+    cols.resize( numLocalEntries );
+    values.resize( numLocalEntries );
+    hid_t transferList = TransferList( parallel, ctrl );
+    hid_t rowSet = Check( H5Dopen2( group, "row", H5P_DEFAULT ), "H5Dopen2" );
+    TransferVector
+    ( false, rowSet, transferList, rows.data(), offset, numLocalEntries );
+    H5Dclose( rowSet );
+    hid_t colSet = Check( H5Dopen2( group, "col", H5P_DEFAULT ), "H5Dopen2" );
+    TransferVector
+    ( false, colSet, transferList, cols.data(), offset, numLocalEntries );
+    H5Dclose( colSet );
+    hid_t valueSet =
+      Check( H5Dopen2( group, "value", H5P_DEFAULT ), "H5Dopen2" );
+    TransferVector
+    ( false, valueSet, transferList, values.data(), offset, numLocalEntries );
+    H5Dclose( valueSet );
+    H5Pclose( transferList );
+}
+
+} // namespace hdf5
+#endif // ifdef EL_HAVE_HDF5
+
+template<typename T>
+void WriteHDF5
+( const Matrix<T>& A, string basename, const HDF5Ctrl& ctrl )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_HDF5
+    const string filename = basename + "." + FileExtension(HDF5);
+    const hsize_t start[2] = { 0, 0 };
+    const hsize_t count[2] = { hsize_t(A.Width()), hsize_t(A.Height()) };
+    const bool active = true;
+    auto write =
+      [&]( hid_t file, bool create, bool parallel )
+      {
+          hdf5::WriteDense
+          ( file, create, parallel, A.Height(), A.Width(),
+            A.LockedBuffer(), A.LDim(), start, NULL, count, active, ctrl );
+      };
+    hdf5::WriteFile( filename, mpi::COMM_SELF, write );
+#else
+    LogicError("Elemental was not built with HDF5 support");
+#endif
+}
+
+template<typename T>
+void WriteHDF5
+( const AbstractDistMatrix<T>& A, string basename, const HDF5Ctrl& ctrl )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_HDF5
+    const string filename = basename + "." + FileExtension(HDF5);
+    // Local entry (iLoc,jLoc) is global entry
+    // (colShift+iLoc*colStride,rowShift+jLoc*rowStride), which is entry
+    // (rowShift+jLoc*rowStride,colShift+iLoc*colStride) of the dataset
+    const hsize_t start[2] = { hsize_t(A.RowShift()), hsize_t(A.ColShift()) };
+    const hsize_t stride[2] =
+      { hsize_t(A.RowStride()), hsize_t(A.ColStride()) };
+    const hsize_t count[2] =
+      { hsize_t(A.LocalWidth()), hsize_t(A.LocalHeight()) };
+
+    // Only the first member of each team of redundant processes writes
+    const bool active = A.Participating() && A.RedundantRank() == 0;
+    auto write =
+      [&]( hid_t file, bool create, bool parallel )
+      {
+          hdf5::WriteDense
+          ( file, create, parallel, A.Height(), A.Width(),
+            A.LockedBuffer(), A.LDim(), start, stride, count, active, ctrl );
+      };
+    hdf5::WriteFile( filename, A.Grid().ViewingComm(), write );
+#else
+    LogicError("Elemental was not built with HDF5 support");
+#endif
+}
+
+template<typename T>
+void WriteHDF5
+( const SparseMatrix<T>& A, string basename, const HDF5Ctrl& ctrl )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_HDF5
+    A.AssertConsistent();
+    const string filename = basename + "." + FileExtension(HDF5);
+    const Int numEntries = A.NumEntries();
+    auto write =
+      [&]( hid_t file, bool create, bool parallel )
+      {
+          hdf5::WriteCoordinates
+          ( file, create, parallel, A.Height(), A.Width(), numEntries,
+            0, numEntries, A.LockedSourceBuffer(), A.LockedTargetBuffer(),
+            A.LockedValueBuffer(), ctrl );
+      };
+    hdf5::WriteFile( filename, mpi::COMM_SELF, write );
+#else
+    LogicError("Elemental was not built with HDF5 support");
+#endif
+}
+
+template<typename T>
+void WriteHDF5
+( const DistSparseMatrix<T>& A, string basename, const HDF5Ctrl& ctrl )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_HDF5
+    A.AssertLocallyConsistent();
+    const string filename = basename + "." + FileExtension(HDF5);
+    mpi::Comm comm = A.Grid().Comm();
+
+    // The local entries of each process follow those of its predecessors
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int offset =
+      mpi::Scan( numLocalEntries, mpi::SUM, comm ) - numLocalEntries;
+    const Int numEntries = mpi::AllReduce( numLocalEntries, comm );
+    auto write =
+      [&]( hid_t file, bool create, bool parallel )
+      {
+          hdf5::WriteCoordinates
+          ( file, create, parallel, A.Height(), A.Width(), numEntries,
+            offset, numLocalEntries, A.LockedSourceBuffer(),
+            A.LockedTargetBuffer(), A.LockedValueBuffer(), ctrl );
+      };
+    hdf5::WriteFile( filename, comm, write );
+#else
+    LogicError("Elemental was not built with HDF5 support");
+#endif
+}
+
+template<typename T>
+void WriteHDF5
+( const DistMultiVec<T>& X, string basename, const HDF5Ctrl& ctrl )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_HDF5
+    const string filename = basename + "." + FileExtension(HDF5);
+    const hsize_t start[2] = { 0, hsize_t(X.FirstLocalRow()) };
+    const hsize_t count[2] = { hsize_t(X.Width()), hsize_t(X.LocalHeight()) };
+    const bool active = true;
+    const auto& XLoc = X.LockedMatrix();
+    auto write =
+      [&]( hid_t file, bool create, bool parallel )
+      {
+          hdf5::WriteDense
+          ( file, create, parallel, X.Height(), X.Width(),
+            XLoc.LockedBuffer(), XLoc.LDim(), start, NULL, count, active,
+            ctrl );
+      };
+    hdf5::WriteFile( filename, X.Grid().Comm(), write );
+#else
+    LogicError("Elemental was not built with HDF5 support");
+#endif
+}
+
+template<typename T>
+void ReadHDF5( Matrix<T>& A, const string filename, const HDF5Ctrl& ctrl )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_HDF5
+    const bool parallel = false;
+    hid_t file =
+      hdf5::OpenFile( filename, H5F_ACC_RDONLY, mpi::COMM_SELF, parallel );
+    hid_t dataset =
+      hdf5::Check
+      ( H5Dopen2( file, ctrl.dataset.c_str(), H5P_DEFAULT ), "H5Dopen2" );
+    Int height, width;
+    hdf5::DenseSize( dataset, height, width );
+    A.Resize( height, width );
+
+    const hsize_t start[2] = { 0, 0 };
+    const hsize_t count[2] = { hsize_t(width), hsize_t(height) };
+    const bool active = true;
+    hdf5::TransferDense
+    ( false, dataset, H5P_DEFAULT, A.Buffer(), A.LDim(), start, NULL, count,
+      active );
+    H5Dclose( dataset );
+    hdf5::Check( H5Fclose( file ), "H5Fclose" );
+#else
+    LogicError("Elemental was not built with HDF5 support");
+#endif
+}
+
+template<typename T>
+void ReadHDF5
+( AbstractDistMatrix<T>& A, const string filename, const HDF5Ctrl& ctrl )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_HDF5
+    // Without parallel HDF5, each process simply opens the file for reading
+    mpi::Comm comm = A.Grid().ViewingComm();
+    const bool parallel = hdf5::UseParallel( comm );
+    hid_t file = hdf5::OpenFile( filename, H5F_ACC_RDONLY, comm, parallel );
+    hid_t dataset =
+      hdf5::Check
+      ( H5Dopen2( file, ctrl.dataset.c_str(), H5P_DEFAULT ), "H5Dopen2" );
+    Int height, width;
+    hdf5::DenseSize( dataset, height, width );
+    A.Resize( height, width );
+
+    // Every redundant copy is read directly rather than broadcast
+    const hsize_t start[2] = { hsize_t(A.RowShift()), hsize_t(A.ColShift()) };
+    const hsize_t stride[2] =
+      { hsize_t(A.RowStride()), hsize_t(A.ColStride()) };
+    const hsize_t count[2] =
+      { hsize_t(A.LocalWidth()), hsize_t(A.LocalHeight()) };
+    const bool active = A.Participating();
+    hid_t transferList = hdf5::TransferList( parallel, ctrl );
+    hdf5::TransferDense
+    ( false, dataset, transferList, A.Buffer(), A.LDim(), start, stride,
+      count, active );
+    H5Pclose( transferList );
+    H5Dclose( dataset );
+    hdf5::Check( H5Fclose( file ), "H5Fclose" );
+#else
+    LogicError("Elemental was not built with HDF5 support");
+#endif
+}
+
+template<typename T>
+void ReadHDF5
+( SparseMatrix<T>& A, const string filename, const HDF5Ctrl& ctrl )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_HDF5
+    const bool parallel = false;
+    hid_t file =
+      hdf5::OpenFile( filename, H5F_ACC_RDONLY, mpi::COMM_SELF, parallel );
+    Int height, width, numEntries;
+    hid_t group =
+      hdf5::OpenCoordinates( file, ctrl, height, width, numEntries );
+    vector<Int> rows, cols;
+    vector<T> values;
+    hdf5::ReadCoordinates
+    ( group, parallel, 0, numEntries, rows, cols, values, ctrl );
+    H5Gclose( group );
+    hdf5::Check( H5Fclose( file ), "H5Fclose" );
+
+    A.Resize( height, width );
+    A.Reserve( numEntries );
+    for( Int e=0; e<numEntries; ++e )
+        A.QueueUpdate( rows[e], cols[e], values[e] );
+    A.ProcessQueues();
+#else
+    LogicError("Elemental was not built with HDF5 support");
+#endif
+}
+
+template<typename T>
+void ReadHDF5
+( DistSparseMatrix<T>& A, const string filename, const HDF5Ctrl& ctrl )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_HDF5
+    mpi::Comm comm = A.Grid().Comm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    const bool parallel = hdf5::UseParallel( comm );
+    hid_t file = hdf5::OpenFile( filename, H5F_ACC_RDONLY, comm, parallel );
+    Int height, width, numEntries;
+    hid_t group =
+      hdf5::OpenCoordinates( file, ctrl, height, width, numEntries );
+
+    // Each process reads an even share of the entries and then routes them
+    // to the owners of their rows
+    const Int offset = (numEntries*commRank) / commSize;
+    const Int numReadEntries = (numEntries*(commRank+1))/commSize - offset;
+    vector<Int> rows, cols;
+    vector<T> values;
+    hdf5::ReadCoordinates
+    ( group, parallel, offset, numReadEntries, rows, cols, values, ctrl );
+    H5Gclose( group );
+    hdf5::Check( H5Fclose( file ), "H5Fclose" );
+
+    A.Resize( height, width );
+    A.Reserve( numReadEntries, numReadEntries );
+    for( Int e=0; e<numReadEntries; ++e )
+        A.QueueUpdate( rows[e], cols[e], values[e] );
+    A.ProcessQueues();
+#else
+    LogicError("Elemental was not built with HDF5 support");
+#endif
+}
+
+template<typename T>
+void ReadHDF5
+( DistMultiVec<T>& X, const string filename, const HDF5Ctrl& ctrl )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_HDF5
+    mpi::Comm comm = X.Grid().Comm();
+    const bool parallel = hdf5::UseParallel( comm );
+    hid_t file = hdf5::OpenFile( filename, H5F_ACC_RDONLY, comm, parallel );
+    hid_t dataset =
+      hdf5::Check
+      ( H5Dopen2( file, ctrl.dataset.c_str(), H5P_DEFAULT ), "H5Dopen2" );
+    Int height, width;
+    hdf5::DenseSize( dataset, height, width );
+    X.Resize( height, width );
+
+    auto& XLoc = X.Matrix();
+    const hsize_t start[2] = { 0, hsize_t(X.FirstLocalRow()) };
+    const hsize_t count[2] = { hsize_t(width), hsize_t(X.LocalHeight()) };
+    const bool active = true;
+    hid_t transferList = hdf5::TransferList( parallel, ctrl );
+    hdf5::TransferDense
+    ( false, dataset, transferList, XLoc.Buffer(), XLoc.LDim(), start, NULL,
+      count, active );
+    H5Pclose( transferList );
+    H5Dclose( dataset );
+    hdf5::Check( H5Fclose( file ), "H5Fclose" );
+#else
+    LogicError("Elemental was not built with HDF5 support");
+#endif
+}
+
+#define PROTO(T) \
+  template void WriteHDF5 \
+  ( const Matrix<T>& A, string basename, const HDF5Ctrl& ctrl ); \
+  template void WriteHDF5 \
+  ( const AbstractDistMatrix<T>& A, string basename, \
+    const HDF5Ctrl& ctrl ); \
+  template void WriteHDF5 \
+  ( const SparseMatrix<T>& A, string basename, const HDF5Ctrl& ctrl ); \
+  template void WriteHDF5 \
+  ( const DistSparseMatrix<T>& A, string basename, \
+    const HDF5Ctrl& ctrl ); \
+  template void WriteHDF5 \
+  ( const DistMultiVec<T>& X, string basename, const HDF5Ctrl& ctrl ); \
+  template void ReadHDF5 \
+  ( Matrix<T>& A, const string filename, const HDF5Ctrl& ctrl ); \
+  template void ReadHDF5 \
+  ( AbstractDistMatrix<T>& A, const string filename, \
+    const HDF5Ctrl& ctrl ); \
+  template void ReadHDF5 \
+  ( SparseMatrix<T>& A, const string filename, const HDF5Ctrl& ctrl ); \
+  template void ReadHDF5 \
+  ( DistSparseMatrix<T>& A, const string filename, \
+    const HDF5Ctrl& ctrl ); \
+  template void ReadHDF5 \
+  ( DistMultiVec<T>& X, const string filename, const HDF5Ctrl& ctrl );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
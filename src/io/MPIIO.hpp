@@ -0,0 +1,357 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_IO_MPIIO_HPP
+#define EL_IO_MPIIO_HPP
+
+// Collective MPI-IO for the column-major BINARY and BINARY_FLAT formats
+// ======================================================================
+// Entry (iLoc,jLoc) of the local matrix of any distribution is global entry
+// (colShift+iLoc*colStride,rowShift+jLoc*rowStride), so the local entries of
+// each process form a doubly-strided pattern within the file which is
+// described by a (byte-based) vector of vectors. Each process then reads or
+// writes its own entries through its file view at the bandwidth of the file
+// system rather than funneling the matrix through a single process.
+//
+// Only packed datatypes (whose bytes are their values) and element-wrapped
+// distributions are supported, as the local entries of a block-wrapped
+// matrix are instead scattered according to GlobalBlockedIndex.
+//
+
+namespace El {
+namespace mpi_io {
+
+inline void Check( int error, const char* routine )
+{
+    if( error != MPI_SUCCESS )
+    {
+        char errorString[MPI_MAX_ERROR_STRING];
+        int lengthOfErrorString;
+        MPI_Error_string( error, errorString, &lengthOfErrorString );
+        RuntimeError
+        (routine," failed: ",string(errorString,lengthOfErrorString));
+    }
+}
+
+template<typename T>
+bool Supported( const AbstractDistMatrix<T>& A )
+{ return IsPacked<T>::value && A.Wrap() == ELEMENT; }
+
+// Build the datatypes of the local entries in memory and in the file, the
+// latter relative to the file position of the first local entry
+template<typename T>
+void LocalTypes
+( const AbstractDistMatrix<T>& A,
+  MPI_Datatype& entryType,
+  MPI_Datatype& memType,
+  MPI_Datatype& fileType,
+  MPI_Offset& displacement,
+  MPI_Offset metaBytes )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    Check
+    ( MPI_Type_contiguous( int(sizeof(T)), MPI_BYTE, &entryType ),
+      "MPI_Type_contiguous" );
+    Check( MPI_Type_commit( &entryType ), "MPI_Type_commit" );
+
+    Check
+    ( MPI_Type_vector
+      ( int(localWidth), int(localHeight), int(A.LDim()), entryType,
+        &memType ), "MPI_Type_vector" );
+    Check( MPI_Type_commit( &memType ), "MPI_Type_commit" );
+
+    MPI_Datatype colType;
+    Check
+    ( MPI_Type_vector
+      ( int(localHeight), 1, A.ColStride(), entryType, &colType ),
+      "MPI_Type_vector" );
+    const MPI_Aint rowStrideBytes =
+      MPI_Aint(A.RowStride())*MPI_Aint(height)*MPI_Aint(sizeof(T));
+    Check
+    ( MPI_Type_create_hvector
+      ( int(localWidth), 1, rowStrideBytes, colType, &fileType ),
+      "MPI_Type_create_hvector" );
+    Check( MPI_Type_commit( &fileType ), "MPI_Type_commit" );
+    Check( MPI_Type_free( &colType ), "MPI_Type_free" );
+
+    displacement = metaBytes +
+      ( MPI_Offset(A.ColShift()) +
+        MPI_Offset(A.RowShift())*MPI_Offset(height) )*MPI_Offset(sizeof(T));
+}
+
+inline void FreeTypes
+( MPI_Datatype& entryType, MPI_Datatype& memType, MPI_Datatype& fileType )
+{
+    Check( MPI_Type_free( &fileType ), "MPI_Type_free" );
+    Check( MPI_Type_free( &memType ), "MPI_Type_free" );
+    Check( MPI_Type_free( &entryType ), "MPI_Type_free" );
+}
+
+// Collectively write A to the given file, preceded by its height and width
+// if 'header' is true
+template<typename T>
+void Write
+( const AbstractDistMatrix<T>& A, const string& filename, bool header )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = A.Grid().ViewingComm();
+    MPI_File file;
+    const int error =
+      MPI_File_open
+      ( comm.comm, const_cast<char*>(filename.c_str()),
+        MPI_MODE_WRONLY | MPI_MODE_CREATE, MPI_INFO_NULL, &file );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+
+    const MPI_Offset metaBytes = ( header ? 2*sizeof(Int) : 0 );
+    const MPI_Offset numBytes = metaBytes +
+      MPI_Offset(A.Height())*MPI_Offset(A.Width())*MPI_Offset(sizeof(T));
+    Check( MPI_File_set_size( file, numBytes ), "MPI_File_set_size" );
+    if( header && mpi::Rank(comm) == 0 )
+    {
+        const Int dims[2] = { A.Height(), A.Width() };
+        MPI_Status status;
+        Check
+        ( MPI_File_write_at
+          ( file, 0, const_cast<Int*>(dims), int(2*sizeof(Int)), MPI_BYTE,
+            &status ), "MPI_File_write_at" );
+    }
+
+    MPI_Datatype entryType, memType, fileType;
+    MPI_Offset displacement;
+    LocalTypes( A, entryType, memType, fileType, displacement, metaBytes );
+    Check
+    ( MPI_File_set_view
+      ( file, displacement, entryType, fileType, const_cast<char*>("native"),
+        MPI_INFO_NULL ), "MPI_File_set_view" );
+
+    // Only the first member of each team of redundant processes writes
+    const bool writer = A.Participating() && A.RedundantRank() == 0 &&
+                        A.LocalHeight() > 0 && A.LocalWidth() > 0;
+    MPI_Status status;
+    Check
+    ( MPI_File_write_all
+      ( file, const_cast<T*>(A.LockedBuffer()), ( writer ? 1 : 0 ), memType,
+        &status ), "MPI_File_write_all" );
+
+    FreeTypes( entryType, memType, fileType );
+    Check( MPI_File_close( &file ), "MPI_File_close" );
+}
+
+// Collectively read A from the given file, with its height and width taken
+// from the file if 'header' is true
+template<typename T>
+void Read
+( AbstractDistMatrix<T>& A, Int height, Int width, const string& filename,
+  bool header )
+{
+    EL_DEBUG_CSE
+    mpi::Comm comm = A.Grid().ViewingComm();
+    MPI_File file;
+    const int error =
+      MPI_File_open
+      ( comm.comm, const_cast<char*>(filename.c_str()), MPI_MODE_RDONLY,
+        MPI_INFO_NULL, &file );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+
+    const MPI_Offset metaBytes = ( header ? 2*sizeof(Int) : 0 );
+    if( header )
+    {
+        Int dims[2];
+        MPI_Status status;
+        Check
+        ( MPI_File_read_at_all
+          ( file, 0, dims, int(2*sizeof(Int)), MPI_BYTE, &status ),
+          "MPI_File_read_at_all" );
+        height = dims[0];
+        width = dims[1];
+    }
+    MPI_Offset numBytes;
+    Check( MPI_File_get_size( file, &numBytes ), "MPI_File_get_size" );
+    const MPI_Offset numBytesExp = metaBytes +
+      MPI_Offset(height)*MPI_Offset(width)*MPI_Offset(sizeof(T));
+    if( numBytes != numBytesExp )
+    {
+        MPI_File_close( &file );
+        RuntimeError
+        ("Expected file to be ",Int(numBytesExp)," bytes but found ",
+         Int(numBytes));
+    }
+
+    A.Resize( height, width );
+    MPI_Datatype entryType, memType, fileType;
+    MPI_Offset displacement;
+    LocalTypes( A, entryType, memType, fileType, displacement, metaBytes );
+    Check
+    ( MPI_File_set_view
+      ( file, displacement, entryType, fileType, const_cast<char*>("native"),
+        MPI_INFO_NULL ), "MPI_File_set_view" );
+
+    // Every redundant copy is read directly rather than broadcast
+    const bool reader = A.Participating() &&
+                        A.LocalHeight() > 0 && A.LocalWidth() > 0;
+    MPI_Status status;
+    Check
+    ( MPI_File_read_all
+      ( file, A.Buffer(), ( reader ? 1 : 0 ), memType, &status ),
+      "MPI_File_read_all" );
+
+    FreeTypes( entryType, memType, fileType );
+    Check( MPI_File_close( &file ), "MPI_File_close" );
+}
+
+// Independently write (or read) 'numBytes' bytes at the given offset in
+// pieces small enough for the 'int' counts of MPI
+inline void WriteBytes
+( MPI_File file, MPI_Offset offset, const byte* buffer, MPI_Offset numBytes )
+{
+    const MPI_Offset maxPiece = MPI_Offset(1) << 30;
+    for( MPI_Offset done=0; done<numBytes; done+=maxPiece )
+    {
+        const int piece = int(Min(maxPiece,numBytes-done));
+        MPI_Status status;
+        Check
+        ( MPI_File_write_at
+          ( file, offset+done, const_cast<byte*>(buffer+done), piece,
+            MPI_BYTE, &status ), "MPI_File_write_at" );
+    }
+}
+
+inline void ReadBytes
+( MPI_File file, MPI_Offset offset, byte* buffer, MPI_Offset numBytes )
+{
+    const MPI_Offset maxPiece = MPI_Offset(1) << 30;
+    for( MPI_Offset done=0; done<numBytes; done+=maxPiece )
+    {
+        const int piece = int(Min(maxPiece,numBytes-done));
+        MPI_Status status;
+        Check
+        ( MPI_File_read_at
+          ( file, offset+done, buffer+done, piece, MPI_BYTE, &status ),
+          "MPI_File_read_at" );
+    }
+}
+
+// Independently write (or read) the local rows of the single-column 'x' to
+// (or from) the file, whose first row is at the given offset
+template<typename T>
+void WriteVector
+( MPI_File file, MPI_Offset offset, const DistMultiVec<T>& x )
+{
+    EL_DEBUG_CSE
+    if( x.Width() != 1 )
+        LogicError("Expected a single column");
+    WriteBytes
+    ( file, offset+MPI_Offset(x.FirstLocalRow())*MPI_Offset(sizeof(T)),
+      reinterpret_cast<const byte*>(x.LockedMatrix().LockedBuffer()),
+      MPI_Offset(x.LocalHeight())*MPI_Offset(sizeof(T)) );
+}
+
+template<typename T>
+void ReadVector
+( MPI_File file, MPI_Offset offset, Int height, DistMultiVec<T>& x )
+{
+    EL_DEBUG_CSE
+    x.Resize( height, 1 );
+    ReadBytes
+    ( file, offset+MPI_Offset(x.FirstLocalRow())*MPI_Offset(sizeof(T)),
+      reinterpret_cast<byte*>(x.Matrix().Buffer()),
+      MPI_Offset(x.LocalHeight())*MPI_Offset(sizeof(T)) );
+}
+
+// Collectively write one block of bytes per process of 'comm' to the given
+// file. The file begins with the number of processes and the size of each
+// block, which are followed by the blocks in the order of the ranks.
+inline void WriteBlocks
+( const vector<byte>& block, const string& filename, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int blockSize = block.size();
+    vector<Int> blockSizes( commSize );
+    mpi::AllGather( &blockSize, 1, blockSizes.data(), 1, comm );
+    const MPI_Offset metaBytes = (commSize+1)*sizeof(Int);
+    MPI_Offset offset = metaBytes, numBytes = metaBytes;
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q < commRank )
+            offset += blockSizes[q];
+        numBytes += blockSizes[q];
+    }
+
+    MPI_File file;
+    const int error =
+      MPI_File_open
+      ( comm.comm, const_cast<char*>(filename.c_str()),
+        MPI_MODE_WRONLY | MPI_MODE_CREATE, MPI_INFO_NULL, &file );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+    Check( MPI_File_set_size( file, numBytes ), "MPI_File_set_size" );
+    if( commRank == 0 )
+    {
+        vector<Int> meta( commSize+1 );
+        meta[0] = commSize;
+        std::copy( blockSizes.begin(), blockSizes.end(), meta.begin()+1 );
+        WriteBytes
+        ( file, 0, reinterpret_cast<const byte*>(meta.data()), metaBytes );
+    }
+    WriteBytes( file, offset, block.data(), blockSize );
+    Check( MPI_File_close( &file ), "MPI_File_close" );
+}
+
+// Collectively read the block of the calling process from a file written by
+// 'WriteBlocks' over a communicator of the same size
+inline void ReadBlocks
+( vector<byte>& block, const string& filename, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    MPI_File file;
+    const int error =
+      MPI_File_open
+      ( comm.comm, const_cast<char*>(filename.c_str()), MPI_MODE_RDONLY,
+        MPI_INFO_NULL, &file );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+
+    Int numBlocks;
+    MPI_Status status;
+    Check
+    ( MPI_File_read_at_all
+      ( file, 0, &numBlocks, int(sizeof(Int)), MPI_BYTE, &status ),
+      "MPI_File_read_at_all" );
+    if( numBlocks != commSize )
+    {
+        MPI_File_close( &file );
+        RuntimeError
+        (filename," was written by ",numBlocks," processes rather than ",
+         commSize);
+    }
+    vector<Int> blockSizes( commSize );
+    Check
+    ( MPI_File_read_at_all
+      ( file, sizeof(Int), blockSizes.data(), int(commSize*sizeof(Int)),
+        MPI_BYTE, &status ), "MPI_File_read_at_all" );
+    MPI_Offset offset = (commSize+1)*sizeof(Int);
+    for( int q=0; q<commRank; ++q )
+        offset += blockSizes[q];
+    block.resize( blockSizes[commRank] );
+    ReadBytes( file, offset, block.data(), blockSizes[commRank] );
+    Check( MPI_File_close( &file ), "MPI_File_close" );
+}
+
+} // namespace mpi_io
+} // namespace El
+
+#endif // ifndef EL_IO_MPIIO_HPP
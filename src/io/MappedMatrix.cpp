@@ -0,0 +1,155 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#ifdef EL_HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace El {
+
+template<typename T>
+MappedMatrix<T>::MappedMatrix
+( const string filename, Int height, Int width, const MappedCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const bool header = false;
+    Map( filename, height, width, header, ctrl );
+}
+
+template<typename T>
+MappedMatrix<T>::MappedMatrix( const string filename, const MappedCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const bool header = true;
+    Map( filename, 0, 0, header, ctrl );
+}
+
+template<typename T>
+MappedMatrix<T>::~MappedMatrix()
+{
+    matrix_.Empty();
+#ifdef EL_HAVE_MMAP
+    if( address_ != nullptr )
+        munmap( address_, numBytes_ );
+#endif
+}
+
+template<typename T>
+const El::Matrix<T>& MappedMatrix<T>::LockedMatrix() const EL_NO_EXCEPT
+{ return matrix_; }
+
+template<typename T>
+void MappedMatrix<T>::Map
+( const string& filename, Int height, Int width, bool header,
+  const MappedCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HAVE_MMAP
+    if( !IsPacked<T>::value )
+        LogicError("Only packed datatypes can be memory-mapped");
+    const int fd = open( filename.c_str(), O_RDONLY );
+    if( fd < 0 )
+        RuntimeError("Could not open ",filename);
+    struct stat fileInfo;
+    if( fstat( fd, &fileInfo ) != 0 )
+    {
+        close( fd );
+        RuntimeError("Could not stat ",filename);
+    }
+    const size_t numBytes = fileInfo.st_size;
+
+    size_t metaBytes = 0;
+    if( header )
+    {
+        metaBytes = 2*sizeof(Int);
+        Int dims[2];
+        if( numBytes < metaBytes ||
+            pread( fd, dims, metaBytes, 0 ) != ssize_t(metaBytes) )
+        {
+            close( fd );
+            RuntimeError("Could not read the header of ",filename);
+        }
+        height = dims[0];
+        width = dims[1];
+    }
+    const size_t numBytesExp =
+      metaBytes + size_t(height)*size_t(width)*sizeof(T);
+    if( numBytes != numBytesExp )
+    {
+        close( fd );
+        RuntimeError
+        ("Expected file to be ",numBytesExp," bytes but found ",numBytes);
+    }
+    if( metaBytes % alignof(T) != 0 )
+    {
+        close( fd );
+        LogicError
+        ("The entries of ",filename," are not aligned for ",TypeName<T>());
+    }
+    if( height == 0 || width == 0 )
+    {
+        close( fd );
+        matrix_.Resize( height, width );
+        return;
+    }
+
+    // A shared, read-only mapping avoids copy-on-write bookkeeping
+    int flags = MAP_SHARED;
+#ifdef MAP_POPULATE
+    if( ctrl.populate )
+        flags |= MAP_POPULATE;
+#endif
+    void* address = mmap( NULL, numBytes, PROT_READ, flags, fd, 0 );
+    close( fd );
+    if( address == MAP_FAILED )
+        RuntimeError("Could not map ",filename);
+    address_ = address;
+    numBytes_ = numBytes;
+
+    // The advice is only a hint, so failures are ignored
+    int advice = MADV_NORMAL;
+    if( ctrl.pattern == SEQUENTIAL_ACCESS )
+        advice = MADV_SEQUENTIAL;
+    else if( ctrl.pattern == RANDOM_ACCESS )
+        advice = MADV_RANDOM;
+    madvise( address_, numBytes_, advice );
+    if( ctrl.prefetch )
+        madvise( address_, numBytes_, MADV_WILLNEED );
+#ifndef MAP_POPULATE
+    if( ctrl.populate )
+    {
+        // Fault in each page by touching its first byte
+        const size_t pageSize = sysconf( _SC_PAGESIZE );
+        const volatile char* bytes = static_cast<const char*>(address_);
+        char sink = 0;
+        for( size_t offset=0; offset<numBytes_; offset+=pageSize )
+            sink ^= bytes[offset];
+        (void)sink;
+    }
+#endif
+
+    const T* buffer =
+      reinterpret_cast<const T*>(static_cast<const char*>(address_)+metaBytes);
+    matrix_.LockedAttach( height, width, buffer, height );
+#else
+    LogicError("Memory mapping is not supported on this platform");
+#endif
+}
+
+#define PROTO(T) template class MappedMatrix<T>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -8,11 +8,13 @@
 */
 #include <El.hpp>
 
+#include "./MPIIO.hpp"
 #include "./Read/Ascii.hpp"
 #include "./Read/AsciiMatlab.hpp"
 #include "./Read/Binary.hpp"
 #include "./Read/BinaryFlat.hpp"
 #include "./Read/MatrixMarket.hpp"
+#include "./Read/MatrixMarketMapped.hpp"
 
 namespace El {
 
@@ -40,6 +42,12 @@ void Read( Matrix<T>& A, const string filename, FileFormat format )
     case MATRIX_MARKET:
         read::MatrixMarket( A, filename );
         break;
+    case HDF5:
+        ReadHDF5( A, filename );
+        break;
+    case BINARY_COMPRESSED:
+        ReadCompressed( A, filename );
+        break;
     default:
         LogicError("Format unsupported for reading a Matrix");
     }
@@ -54,6 +62,16 @@ void Read
     if( format == AUTO )
         format = DetectFormat( filename );
 
+    if( format == HDF5 )
+    {
+        ReadHDF5( A, filename );
+        return;
+    }
+    if( format == BINARY_COMPRESSED )
+    {
+        ReadCompressed( A, filename );
+        return;
+    }
     if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
@@ -88,10 +106,16 @@ void Read
             read::AsciiMatlab( A, filename );
             break;
         case BINARY:
-            read::Binary( A, filename );
+            if( mpi_io::Supported(A) )
+                mpi_io::Read( A, 0, 0, filename, true );
+            else
+                read::Binary( A, filename );
             break;
         case BINARY_FLAT:
-            read::BinaryFlat( A, A.Height(), A.Width(), filename );
+            if( mpi_io::Supported(A) )
+                mpi_io::Read( A, A.Height(), A.Width(), filename, false );
+            else
+                read::BinaryFlat( A, A.Height(), A.Width(), filename );
             break;
         case MATRIX_MARKET:
             read::MatrixMarket( A, filename );
@@ -114,6 +138,9 @@ void Read( SparseMatrix<T>& A, const string filename, FileFormat format )
     case MATRIX_MARKET:
         read::MatrixMarket( A, filename );
         break;
+    case HDF5:
+        ReadHDF5( A, filename );
+        break;
     default:
         LogicError("Format unsupported for reading a SparseMatrix");
     }
@@ -129,7 +156,15 @@ void Read( DistSparseMatrix<T>& A, const string filename, FileFormat format )
     switch( format )
     {
     case MATRIX_MARKET:
-        read::MatrixMarket( A, filename );
+#ifdef EL_HAVE_MMAP
+        if( read::MatrixMarketMappable<T>::value )
+            read::MatrixMarketMapped( A, filename );
+        else
+#endif
+            read::MatrixMarket( A, filename );
+        break;
+    case HDF5:
+        ReadHDF5( A, filename );
         break;
     default:
         LogicError("Format unsupported for reading a DistSparseMatrix");
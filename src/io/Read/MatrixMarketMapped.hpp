@@ -0,0 +1,381 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_READ_MATRIXMARKETMAPPED_HPP
+#define EL_READ_MATRIXMARKETMAPPED_HPP
+
+#ifdef EL_HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Parallel Matrix Market reader
+// =============================
+// The file is mapped into memory and each process parses the lines which
+// begin within an even share of the bytes of its entries, so that no process
+// touches more than its share. Symmetric, skew-symmetric, and Hermitian
+// entries are expanded by the process which parsed them, and every triplet is
+// then sent to the owner of its row through the (batched) update queues.
+//
+
+namespace El {
+namespace read {
+
+// Whether the entries of T can be parsed exactly through a double
+template<typename T>
+struct MatrixMarketMappable
+{
+    static const bool value =
+      IsBlasScalar<T>::value || std::is_integral<T>::value;
+};
+
+#ifdef EL_HAVE_MMAP
+
+namespace matrix_market {
+
+struct MappedFile
+{
+    const char* data=nullptr;
+    size_t numBytes=0;
+
+    MappedFile( const string& filename )
+    {
+        const int fd = open( filename.c_str(), O_RDONLY );
+        if( fd < 0 )
+            RuntimeError("Could not open ",filename);
+        struct stat fileInfo;
+        if( fstat( fd, &fileInfo ) != 0 )
+        {
+            close( fd );
+            RuntimeError("Could not stat ",filename);
+        }
+        numBytes = fileInfo.st_size;
+        if( numBytes == 0 )
+        {
+            close( fd );
+            RuntimeError(filename," was empty");
+        }
+        void* address = mmap( NULL, numBytes, PROT_READ, MAP_PRIVATE, fd, 0 );
+        close( fd );
+        if( address == MAP_FAILED )
+            RuntimeError("Could not map ",filename);
+        madvise( address, numBytes, MADV_SEQUENTIAL );
+        data = static_cast<const char*>(address);
+    }
+
+    ~MappedFile()
+    { munmap( const_cast<char*>(data), numBytes ); }
+};
+
+inline bool IsDigit( char c ) { return c >= '0' && c <= '9'; }
+
+inline bool IsSpace( char c )
+{ return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+
+inline const char* SkipBlanks( const char* p, const char* end )
+{
+    while( p < end && (*p == ' ' || *p == '\t' || *p == '\r') )
+        ++p;
+    return p;
+}
+
+inline const char* NextLine( const char* p, const char* end )
+{
+    while( p < end && *p != '\n' )
+        ++p;
+    return ( p < end ? p+1 : end );
+}
+
+inline bool ParseInt( const char*& p, const char* end, Int& value )
+{
+    p = SkipBlanks( p, end );
+    bool negative = false;
+    if( p < end && (*p == '-' || *p == '+') )
+    {
+        negative = ( *p == '-' );
+        ++p;
+    }
+    if( p == end || !IsDigit(*p) )
+        return false;
+    Int magnitude = 0;
+    for( ; p < end && IsDigit(*p); ++p )
+        magnitude = 10*magnitude + (*p-'0');
+    value = ( negative ? -magnitude : magnitude );
+    return p == end || IsSpace(*p);
+}
+
+// Parse a decimal floating-point number, which is exactly rounded by
+// Clinger's fast path when its (at most 19 significant digit) mantissa is
+// below 2^53 and its decimal exponent is at most 22 in magnitude, and which
+// otherwise falls back to strtod.
+inline bool ParseReal( const char*& p, const char* end, double& value )
+{
+    static const double powersOfTen[23] =
+      { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10,
+        1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21,
+        1e22 };
+    p = SkipBlanks( p, end );
+    const char* tokenBeg = p;
+
+    bool negative = false;
+    if( p < end && (*p == '-' || *p == '+') )
+    {
+        negative = ( *p == '-' );
+        ++p;
+    }
+    unsigned long long mantissa = 0;
+    int numSignificant = 0;
+    int exponent = 0;
+    bool sawDigit = false, exact = true;
+    for( ; p < end && IsDigit(*p); ++p )
+    {
+        sawDigit = true;
+        if( numSignificant < 19 )
+        {
+            mantissa = 10*mantissa + (*p-'0');
+            if( mantissa != 0 )
+                ++numSignificant;
+        }
+        else
+        {
+            ++exponent;
+            exact = exact && *p == '0';
+        }
+    }
+    if( p < end && *p == '.' )
+    {
+        for( ++p; p < end && IsDigit(*p); ++p )
+        {
+            sawDigit = true;
+            if( numSignificant < 19 )
+            {
+                mantissa = 10*mantissa + (*p-'0');
+                --exponent;
+                if( mantissa != 0 )
+                    ++numSignificant;
+            }
+            else
+                exact = exact && *p == '0';
+        }
+    }
+    if( sawDigit && p < end &&
+        (*p == 'e' || *p == 'E' || *p == 'd' || *p == 'D') )
+    {
+        ++p;
+        bool negativeExponent = false;
+        if( p < end && (*p == '-' || *p == '+') )
+        {
+            negativeExponent = ( *p == '-' );
+            ++p;
+        }
+        int decimalExponent = 0;
+        bool sawExponentDigit = false;
+        for( ; p < end && IsDigit(*p); ++p )
+        {
+            sawExponentDigit = true;
+            if( decimalExponent < 100000 )
+                decimalExponent = 10*decimalExponent + (*p-'0');
+        }
+        exact = exact && sawExponentDigit;
+        exponent += ( negativeExponent ? -decimalExponent : decimalExponent );
+    }
+
+    const bool terminated = ( p == end || IsSpace(*p) );
+    if( sawDigit && terminated && exact &&
+        mantissa < (1ULL<<53) && exponent >= -22 && exponent <= 22 )
+    {
+        double magnitude = double(mantissa);
+        if( exponent >= 0 )
+            magnitude *= powersOfTen[exponent];
+        else
+            magnitude /= powersOfTen[-exponent];
+        value = ( negative ? -magnitude : magnitude );
+        return true;
+    }
+
+    // Fall back to strtod on a null-terminated copy of the token
+    const char* tokenEnd = tokenBeg;
+    while( tokenEnd < end && !IsSpace(*tokenEnd) )
+        ++tokenEnd;
+    p = tokenEnd;
+    if( tokenEnd == tokenBeg )
+        return false;
+    const string token( tokenBeg, tokenEnd );
+    char* parseEnd;
+    value = std::strtod( token.c_str(), &parseEnd );
+    return parseEnd == token.c_str()+token.size();
+}
+
+struct Banner
+{
+    bool isMatrix, isComplex, isPattern;
+    bool isSymmetric, isSkewSymmetric, isHermitian;
+};
+
+inline Banner ParseBanner( const string& line )
+{
+    string stamp, object, format, field, symmetry;
+    std::stringstream lineStream( line );
+    lineStream >> stamp;
+    if( stamp != string("%%MatrixMarket") )
+        RuntimeError("Invalid Matrix Market stamp: ",stamp);
+    if( !(lineStream >> object) )
+        RuntimeError("Missing Matrix Market object");
+    if( !(lineStream >> format) )
+        RuntimeError("Missing Matrix Market format");
+    if( !(lineStream >> field) )
+        RuntimeError("Missing Matrix Market field");
+    if( !(lineStream >> symmetry) )
+        RuntimeError("Missing Matrix Market symmetry");
+
+    Banner banner;
+    banner.isMatrix = ( object == string("matrix") );
+    banner.isComplex = ( field == string("complex") );
+    banner.isPattern = ( field == string("pattern") );
+    banner.isSymmetric = ( symmetry == string("symmetric") );
+    banner.isSkewSymmetric = ( symmetry == string("skew-symmetric") );
+    banner.isHermitian = ( symmetry == string("hermitian") );
+    const bool isGeneral = ( symmetry == string("general") );
+    if( !banner.isMatrix && object != string("vector") )
+        RuntimeError("Invalid Matrix Market object: ",object);
+    if( format == string("array") )
+        LogicError
+        ("Attempted to load dense MatrixMarket format into SparseMatrix");
+    if( format != string("coordinate") )
+        RuntimeError("Invalid Matrix Market format: ",format);
+    if( !banner.isComplex && !banner.isPattern &&
+        field != string("real") &&
+        field != string("double") &&
+        field != string("integer") )
+        RuntimeError("Invalid Matrix Market field: ",field);
+    if( !isGeneral && !banner.isSymmetric && !banner.isSkewSymmetric &&
+        !banner.isHermitian )
+        RuntimeError("Invalid Matrix Market symmetry: ",symmetry);
+    // NOTE: This constraint is only enforced because of the note located at
+    //       http://people.sc.fsu.edu/~jburkardt/data/mm/mm.html
+    if( banner.isSkewSymmetric && banner.isPattern )
+        RuntimeError("Pattern field incompatible with skew-symmetry");
+    if( banner.isHermitian && !banner.isComplex )
+        RuntimeError("Hermitian symmetry requires complex data");
+    return banner;
+}
+
+} // namespace matrix_market
+
+template<typename T>
+void MatrixMarketMapped( DistSparseMatrix<T>& A, const string filename )
+{
+    EL_DEBUG_CSE
+    using namespace matrix_market;
+    typedef Base<T> Real;
+    mpi::Comm comm = A.Grid().Comm();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    MappedFile file( filename );
+    const char* end = file.data + file.numBytes;
+
+    // Every process parses the (small) banner and size line
+    // =====================================================
+    const char* p = NextLine( file.data, end );
+    const Banner banner =
+      ParseBanner( string( file.data, p-file.data ) );
+    while( p < end )
+    {
+        const char* lineBeg = SkipBlanks( p, end );
+        if( lineBeg < end && *lineBeg != '%' && *lineBeg != '\n' )
+            break;
+        p = NextLine( p, end );
+    }
+    Int m, n=1, numNonzero;
+    if( !ParseInt( p, end, m ) )
+        RuntimeError("Missing matrix height");
+    if( banner.isMatrix && !ParseInt( p, end, n ) )
+        RuntimeError("Missing matrix width");
+    if( !ParseInt( p, end, numNonzero ) )
+        RuntimeError("Missing nonzeros entry");
+    const char* dataBeg = NextLine( p, end );
+
+    Zeros( A, m, n );
+
+    // Parse the lines which begin within this process's share of the bytes
+    // =====================================================================
+    const size_t numDataBytes = end - dataBeg;
+    const char* shareBeg = dataBeg + (numDataBytes*commRank) / commSize;
+    const char* shareEnd = dataBeg + (numDataBytes*(commRank+1)) / commSize;
+    if( shareBeg != dataBeg && shareBeg[-1] != '\n' )
+        shareBeg = NextLine( shareBeg, end );
+
+    const bool expand =
+      banner.isSymmetric || banner.isSkewSymmetric || banner.isHermitian;
+    const Int numExpected =
+      ( numNonzero/commSize + 1 )*( expand ? 2 : 1 );
+    A.Reserve( numExpected, numExpected );
+    Int numParsed = 0;
+    T value(1);
+    for( const char* line=shareBeg; line<shareEnd; line=NextLine(line,end) )
+    {
+        p = SkipBlanks( line, end );
+        if( p == end || *p == '\n' || *p == '%' )
+            continue;
+
+        Int i, j=0;
+        if( !ParseInt( p, end, i ) )
+            RuntimeError("Could not extract row coordinate of nonzero");
+        if( banner.isMatrix && !ParseInt( p, end, j ) )
+            RuntimeError("Could not extract col coordinate of nonzero");
+        // Convert from Fortran to C indexing
+        --i;
+        if( banner.isMatrix )
+            --j;
+        if( i < 0 || i >= m || j < 0 || j >= n )
+            RuntimeError("Entry (",i,",",j,") was out of bounds");
+
+        if( !banner.isPattern )
+        {
+            double realPart;
+            if( !ParseReal( p, end, realPart ) )
+                RuntimeError("Could not extract entry (",i,",",j,")");
+            SetRealPart( value, Real(realPart) );
+            if( banner.isComplex )
+            {
+                double imagPart;
+                if( !ParseReal( p, end, imagPart ) )
+                    RuntimeError
+                    ("Could not extract imag part of entry (",i,",",j,")");
+                SetImagPart( value, Real(imagPart) );
+            }
+        }
+        A.QueueUpdate( i, j, value );
+        if( expand && i != j )
+        {
+            if( banner.isSymmetric )
+                A.QueueUpdate( j, i, value );
+            else if( banner.isSkewSymmetric )
+                A.QueueUpdate( j, i, -value );
+            else
+                A.QueueUpdate( j, i, Conj(value) );
+        }
+        ++numParsed;
+    }
+
+    const Int numTotal = mpi::AllReduce( numParsed, comm );
+    if( numTotal != numNonzero )
+        RuntimeError
+        ("Expected ",numNonzero," nonzeros but found ",numTotal);
+    A.ProcessQueues();
+}
+
+#endif // ifdef EL_HAVE_MMAP
+
+} // namespace read
+} // namespace El
+
+#endif // ifndef EL_READ_MATRIXMARKETMAPPED_HPP
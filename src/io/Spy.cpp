@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "El/io/SpyWindow.hpp"
+#include "./Write/Raster.hpp"
 
 #ifdef EL_HAVE_QT5
 # include <QApplication>
@@ -65,10 +66,302 @@ void Spy( const AbstractDistMatrix<T>& A, string title, Base<T> tol )
 #endif // ifdef EL_HAVE_QT5
 }
 
+namespace spy {
+
+// The pixel containing index i of a dimension of size n split into
+// numPixels pieces
+inline Int Pixel( Int i, Int n, Int numPixels )
+{ return Int( (long long)(i)*numPixels / n ); }
+
+inline void InitializeHistogram
+( Int height, Int width, const SpyCtrl& ctrl, Matrix<double>& H )
+{
+    if( ctrl.height < 1 || ctrl.width < 1 )
+        LogicError("The spy resolution must be positive");
+    Zeros( H, Min(height,ctrl.height), Min(width,ctrl.width) );
+}
+
+template<typename T>
+inline void Accumulate
+( Int i, Int j, const T& alpha, Base<T> tol, Int height, Int width,
+  const SpyCtrl& ctrl, Matrix<double>& H )
+{
+    const Base<T> alphaAbs = Abs(alpha);
+    if( alphaAbs <= tol )
+        return;
+    double& pixel =
+      H( Pixel(i,height,H.Height()), Pixel(j,width,H.Width()) );
+    if( ctrl.mode == SPY_MAGNITUDE )
+        pixel = Max( pixel, double(alphaAbs) );
+    else
+        pixel += 1;
+}
+
+inline void ReduceHistogram
+( Matrix<double>& H, const SpyCtrl& ctrl, mpi::Comm comm )
+{
+    const mpi::Op op = ( ctrl.mode == SPY_MAGNITUDE ? mpi::MAX : mpi::SUM );
+    mpi::AllReduce( H.Buffer(), H.Height()*H.Width(), op, comm );
+}
+
+} // namespace spy
+
+template<typename T>
+void SpyHistogram
+( const Matrix<T>& A, Matrix<double>& H, Base<T> tol, const SpyCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    spy::InitializeHistogram( m, n, ctrl, H );
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            spy::Accumulate( i, j, ABuf[i+j*ALDim], tol, m, n, ctrl, H );
+}
+
+template<typename T>
+void SpyHistogram
+( const AbstractDistMatrix<T>& A, Matrix<double>& H, Base<T> tol,
+  const SpyCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    spy::InitializeHistogram( m, n, ctrl, H );
+    // Only one copy of each redundantly-stored entry is counted
+    if( A.Participating() && A.RedundantRank() == 0 )
+    {
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        const T* ABuf = A.LockedBuffer();
+        const Int ALDim = A.LDim();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                spy::Accumulate
+                ( A.GlobalRow(iLoc), j, ABuf[iLoc+jLoc*ALDim], tol, m, n,
+                  ctrl, H );
+        }
+    }
+    spy::ReduceHistogram( H, ctrl, A.Grid().ViewingComm() );
+}
+
+template<typename T>
+void SpyHistogram
+( const SparseMatrix<T>& A, Matrix<double>& H, Base<T> tol,
+  const SpyCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    spy::InitializeHistogram( m, n, ctrl, H );
+    const Int numEntries = A.NumEntries();
+    const Int* sourceBuf = A.LockedSourceBuffer();
+    const Int* targetBuf = A.LockedTargetBuffer();
+    const T* valueBuf = A.LockedValueBuffer();
+    for( Int e=0; e<numEntries; ++e )
+        spy::Accumulate
+        ( sourceBuf[e], targetBuf[e], valueBuf[e], tol, m, n, ctrl, H );
+}
+
+template<typename T>
+void SpyHistogram
+( const DistSparseMatrix<T>& A, Matrix<double>& H, Base<T> tol,
+  const SpyCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    spy::InitializeHistogram( m, n, ctrl, H );
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int* sourceBuf = A.LockedSourceBuffer();
+    const Int* targetBuf = A.LockedTargetBuffer();
+    const T* valueBuf = A.LockedValueBuffer();
+    for( Int e=0; e<numLocalEntries; ++e )
+        spy::Accumulate
+        ( sourceBuf[e], targetBuf[e], valueBuf[e], tol, m, n, ctrl, H );
+    spy::ReduceHistogram( H, ctrl, A.Grid().Comm() );
+}
+
+namespace spy {
+
+// Sample the color map at each pixel, with empty pixels at the bottom of
+// the map
+inline void Render
+( const Matrix<double>& H, const SpyCtrl& ctrl, vector<byte>& rgb )
+{
+    const Int height = H.Height();
+    const Int width = H.Width();
+    double minPositive=0, maxVal=0;
+    for( Int j=0; j<width; ++j )
+    {
+        for( Int i=0; i<height; ++i )
+        {
+            const double value = H(i,j);
+            if( value > 0 )
+            {
+                minPositive =
+                  ( minPositive == 0 ? value : Min(minPositive,value) );
+                maxVal = Max( maxVal, value );
+            }
+        }
+    }
+
+    rgb.resize( 3*height*width );
+    for( Int i=0; i<height; ++i )
+    {
+        for( Int j=0; j<width; ++j )
+        {
+            const double value = H(i,j);
+            double portion = 0;
+            if( value > 0 )
+            {
+                // Keep the smallest nonzero pixel distinguishable from an
+                // empty one
+                if( ctrl.logScale )
+                    portion = (Log(value/minPositive)+1) /
+                              (Log(maxVal/minPositive)+1);
+                else
+                    portion = value / maxVal;
+            }
+            byte* pixel = &rgb[3*(i*width+j)];
+            SampleColorMap( portion, 0., 1., pixel[0], pixel[1], pixel[2] );
+        }
+    }
+}
+
+} // namespace spy
+
+void WriteSpyHistogram
+( const Matrix<double>& H, string basename, FileFormat format,
+  const SpyCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    vector<byte> rgb;
+    spy::Render( H, ctrl, rgb );
+    write::Raster( rgb, H.Width(), H.Height(), basename, format );
+}
+
+template<typename T>
+void Spy
+( const AbstractDistMatrix<T>& A, string title, Base<T> tol,
+  const SpyCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<double> H;
+    SpyHistogram( A, H, tol, ctrl );
+    if( A.Grid().ViewingRank() == 0 )
+        Display( H, title );
+}
+
+template<typename T>
+void Spy
+( const SparseMatrix<T>& A, string title, Base<T> tol, const SpyCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<double> H;
+    SpyHistogram( A, H, tol, ctrl );
+    Display( H, title );
+}
+
+template<typename T>
+void Spy
+( const DistSparseMatrix<T>& A, string title, Base<T> tol,
+  const SpyCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<double> H;
+    SpyHistogram( A, H, tol, ctrl );
+    if( A.Grid().Rank() == 0 )
+        Display( H, title );
+}
+
+template<typename T>
+void WriteSpy
+( const Matrix<T>& A, string basename, FileFormat format, Base<T> tol,
+  const SpyCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<double> H;
+    SpyHistogram( A, H, tol, ctrl );
+    WriteSpyHistogram( H, basename, format, ctrl );
+}
+
+template<typename T>
+void WriteSpy
+( const AbstractDistMatrix<T>& A, string basename, FileFormat format,
+  Base<T> tol, const SpyCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<double> H;
+    SpyHistogram( A, H, tol, ctrl );
+    if( A.Grid().ViewingRank() == 0 )
+        WriteSpyHistogram( H, basename, format, ctrl );
+}
+
+template<typename T>
+void WriteSpy
+( const SparseMatrix<T>& A, string basename, FileFormat format, Base<T> tol,
+  const SpyCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<double> H;
+    SpyHistogram( A, H, tol, ctrl );
+    WriteSpyHistogram( H, basename, format, ctrl );
+}
+
+template<typename T>
+void WriteSpy
+( const DistSparseMatrix<T>& A, string basename, FileFormat format,
+  Base<T> tol, const SpyCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<double> H;
+    SpyHistogram( A, H, tol, ctrl );
+    if( A.Grid().Rank() == 0 )
+        WriteSpyHistogram( H, basename, format, ctrl );
+}
+
 #define PROTO(T) \
   template void Spy ( const Matrix<T>& A, string title, Base<T> tol ); \
   template void Spy \
-  ( const AbstractDistMatrix<T>& A, string title, Base<T> tol );
+  ( const AbstractDistMatrix<T>& A, string title, Base<T> tol ); \
+  template void SpyHistogram \
+  ( const Matrix<T>& A, Matrix<double>& H, Base<T> tol, \
+    const SpyCtrl& ctrl ); \
+  template void SpyHistogram \
+  ( const AbstractDistMatrix<T>& A, Matrix<double>& H, Base<T> tol, \
+    const SpyCtrl& ctrl ); \
+  template void SpyHistogram \
+  ( const SparseMatrix<T>& A, Matrix<double>& H, Base<T> tol, \
+    const SpyCtrl& ctrl ); \
+  template void SpyHistogram \
+  ( const DistSparseMatrix<T>& A, Matrix<double>& H, Base<T> tol, \
+    const SpyCtrl& ctrl ); \
+  template void Spy \
+  ( const AbstractDistMatrix<T>& A, string title, Base<T> tol, \
+    const SpyCtrl& ctrl ); \
+  template void Spy \
+  ( const SparseMatrix<T>& A, string title, Base<T> tol, \
+    const SpyCtrl& ctrl ); \
+  template void Spy \
+  ( const DistSparseMatrix<T>& A, string title, Base<T> tol, \
+    const SpyCtrl& ctrl ); \
+  template void WriteSpy \
+  ( const Matrix<T>& A, string basename, FileFormat format, Base<T> tol, \
+    const SpyCtrl& ctrl ); \
+  template void WriteSpy \
+  ( const AbstractDistMatrix<T>& A, string basename, FileFormat format, \
+    Base<T> tol, const SpyCtrl& ctrl ); \
+  template void WriteSpy \
+  ( const SparseMatrix<T>& A, string basename, FileFormat format, \
+    Base<T> tol, const SpyCtrl& ctrl ); \
+  template void WriteSpy \
+  ( const DistSparseMatrix<T>& A, string basename, FileFormat format, \
+    Base<T> tol, const SpyCtrl& ctrl );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 
+#include "./MPIIO.hpp"
 #include "./Write/Ascii.hpp"
 #include "./Write/AsciiMatlab.hpp"
 #include "./Write/Binary.hpp"
@@ -30,6 +31,8 @@ void Write
     case BINARY:        write::Binary( A, basename );             break;
     case BINARY_FLAT:   write::BinaryFlat( A, basename );         break;
     case MATRIX_MARKET: write::MatrixMarket( A, basename );       break;
+    case HDF5:          WriteHDF5( A, basename );                 break;
+    case BINARY_COMPRESSED: WriteCompressed( A, basename );       break;
     case BMP:
     case JPG:
     case JPEG:
@@ -49,11 +52,21 @@ void Write
   string basename, FileFormat format, string title )
 {
     EL_DEBUG_CSE
-    if( A.ColStride() == 1 && A.RowStride() == 1 )
+    if( format == HDF5 )
+        WriteHDF5( A, basename );
+    else if( format == BINARY_COMPRESSED )
+        WriteCompressed( A, basename );
+    else if( A.ColStride() == 1 && A.RowStride() == 1 )
     {
         if( A.CrossRank() == A.Root() && A.RedundantRank() == 0 )
             Write( A.LockedMatrix(), basename, format, title );
     }
+    else if( mpi_io::Supported(A) &&
+             (format == BINARY || format == BINARY_FLAT) )
+    {
+        const string filename = basename + "." + FileExtension(format);
+        mpi_io::Write( A, filename, format == BINARY );
+    }
     else
     {
         DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC( A );
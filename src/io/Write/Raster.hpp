@@ -0,0 +1,176 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_WRITE_RASTER_HPP
+#define EL_WRITE_RASTER_HPP
+
+#ifdef EL_HAVE_ZLIB
+# include <zlib.h>
+#endif
+
+// Writers for row-major, 8-bit RGB rasters which do not depend upon Qt.
+// PNG's are deflated with zlib when it is available and are otherwise
+// written with uncompressed ("stored") deflate blocks.
+
+namespace El {
+namespace write {
+
+namespace raster {
+
+inline void AppendBigEndian( vector<byte>& buffer, unsigned value )
+{
+    buffer.push_back( byte(value >> 24) );
+    buffer.push_back( byte(value >> 16) );
+    buffer.push_back( byte(value >> 8) );
+    buffer.push_back( byte(value) );
+}
+
+inline unsigned CRC32( const byte* buffer, size_t numBytes )
+{
+    static unsigned table[256];
+    static bool initialized = false;
+    if( !initialized )
+    {
+        for( unsigned n=0; n<256; ++n )
+        {
+            unsigned c = n;
+            for( int k=0; k<8; ++k )
+                c = ( c & 1 ? 0xedb88320u ^ (c >> 1) : c >> 1 );
+            table[n] = c;
+        }
+        initialized = true;
+    }
+    unsigned crc = 0xffffffffu;
+    for( size_t i=0; i<numBytes; ++i )
+        crc = table[(crc ^ buffer[i]) & 0xff] ^ (crc >> 8);
+    return crc ^ 0xffffffffu;
+}
+
+inline void WriteChunk
+( std::ofstream& file, const char* type, const vector<byte>& data )
+{
+    vector<byte> chunk;
+    chunk.reserve( data.size()+12 );
+    AppendBigEndian( chunk, unsigned(data.size()) );
+    chunk.insert( chunk.end(), type, type+4 );
+    chunk.insert( chunk.end(), data.begin(), data.end() );
+    AppendBigEndian( chunk, CRC32( &chunk[4], data.size()+4 ) );
+    file.write( (const char*)chunk.data(), chunk.size() );
+}
+
+// Form a zlib stream for the given bytes
+inline void Deflate( const vector<byte>& raw, vector<byte>& stream )
+{
+#ifdef EL_HAVE_ZLIB
+    uLongf streamSize = compressBound( raw.size() );
+    stream.resize( streamSize );
+    if( compress2
+        ( stream.data(), &streamSize, raw.data(), raw.size(),
+          Z_DEFAULT_COMPRESSION ) != Z_OK )
+        RuntimeError("zlib compression failed");
+    stream.resize( streamSize );
+#else
+    const size_t maxBlock = 65535;
+    const size_t numBytes = raw.size();
+    stream.clear();
+    stream.push_back( 0x78 );
+    stream.push_back( 0x01 );
+    size_t offset = 0;
+    do
+    {
+        const size_t blockSize = Min( maxBlock, numBytes-offset );
+        const bool last = ( offset+blockSize == numBytes );
+        stream.push_back( byte(last) );
+        stream.push_back( byte(blockSize) );
+        stream.push_back( byte(blockSize >> 8) );
+        stream.push_back( byte(~blockSize) );
+        stream.push_back( byte(~blockSize >> 8) );
+        stream.insert
+        ( stream.end(), raw.begin()+offset, raw.begin()+offset+blockSize );
+        offset += blockSize;
+    } while( offset < numBytes );
+
+    // The Adler-32 checksum of the uncompressed bytes
+    unsigned a=1, b=0;
+    for( size_t i=0; i<numBytes; ++i )
+    {
+        a = (a + raw[i]) % 65521u;
+        b = (b + a) % 65521u;
+    }
+    AppendBigEndian( stream, (b << 16) | a );
+#endif
+}
+
+} // namespace raster
+
+inline void RasterPPM
+( const vector<byte>& rgb, Int width, Int height, const string& filename )
+{
+    EL_DEBUG_CSE
+    std::ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file << "P6\n" << width << " " << height << "\n255\n";
+    file.write( (const char*)rgb.data(), rgb.size() );
+    if( !file )
+        RuntimeError("Could not write ",filename);
+}
+
+inline void RasterPNG
+( const vector<byte>& rgb, Int width, Int height, const string& filename )
+{
+    EL_DEBUG_CSE
+    std::ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    const byte signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    file.write( (const char*)signature, 8 );
+
+    // 8-bit truecolor without interlacing
+    vector<byte> header;
+    raster::AppendBigEndian( header, unsigned(width) );
+    raster::AppendBigEndian( header, unsigned(height) );
+    const byte settings[5] = { 8, 2, 0, 0, 0 };
+    header.insert( header.end(), settings, settings+5 );
+    raster::WriteChunk( file, "IHDR", header );
+
+    // Each scanline is preceded by its (trivial) filter type
+    vector<byte> raw;
+    raw.reserve( height*(3*width+1) );
+    for( Int i=0; i<height; ++i )
+    {
+        raw.push_back( 0 );
+        raw.insert
+        ( raw.end(), rgb.begin()+i*3*width, rgb.begin()+(i+1)*3*width );
+    }
+    vector<byte> stream;
+    raster::Deflate( raw, stream );
+    raster::WriteChunk( file, "IDAT", stream );
+    raster::WriteChunk( file, "IEND", vector<byte>() );
+    if( !file )
+        RuntimeError("Could not write ",filename);
+}
+
+inline void Raster
+( const vector<byte>& rgb, Int width, Int height, string basename,
+  FileFormat format )
+{
+    EL_DEBUG_CSE
+    const string filename = basename + "." + FileExtension(format);
+    if( format == PNG )
+        RasterPNG( rgb, width, height, filename );
+    else if( format == PPM )
+        RasterPPM( rgb, width, height, filename );
+    else
+        LogicError("Only PNG and PPM rasters can be written without Qt");
+}
+
+} // namespace write
+} // namespace El
+
+#endif // ifndef EL_WRITE_RASTER_HPP
@@ -11,6 +11,8 @@
 #include "./Bidiag/Apply.hpp"
 #include "./Bidiag/LowerBlocked.hpp"
 #include "./Bidiag/UpperBlocked.hpp"
+#include "./BulgeReflectors.hpp"
+#include "./Bidiag/TwoStage.hpp"
 
 namespace El {
 
@@ -205,6 +207,62 @@ void ExplicitCondensed( AbstractDistMatrix<F>& A )
   ( LeftOrRight side, Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
+          AbstractDistMatrix<F>& B ); \
+  template void bidiag::TwoStage \
+  ( Matrix<F>& A, \
+    Matrix<Base<F>>& mainDiag, \
+    Matrix<Base<F>>& superDiag, \
+    Int bandwidth ); \
+  template void bidiag::TwoStage \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<Base<F>>& mainDiag, \
+    AbstractDistMatrix<Base<F>>& superDiag, \
+    Int bandwidth ); \
+  template void bidiag::TwoStage \
+  ( Matrix<F>& A, \
+    Matrix<F>& householderScalarsQ, \
+    Matrix<Base<F>>& signatureQ, \
+    Matrix<F>& householderScalarsP, \
+    Matrix<Base<F>>& signatureP, \
+    Matrix<Base<F>>& mainDiag, \
+    Matrix<Base<F>>& superDiag, \
+    BulgeReflectors<F>& reflectorsQ, \
+    BulgeReflectors<F>& reflectorsP, \
+    Int bandwidth ); \
+  template void bidiag::TwoStage \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalarsQ, \
+    AbstractDistMatrix<Base<F>>& signatureQ, \
+    AbstractDistMatrix<F>& householderScalarsP, \
+    AbstractDistMatrix<Base<F>>& signatureP, \
+    AbstractDistMatrix<Base<F>>& mainDiag, \
+    AbstractDistMatrix<Base<F>>& superDiag, \
+    BulgeReflectors<F>& reflectorsQ, \
+    BulgeReflectors<F>& reflectorsP, \
+    Int bandwidth ); \
+  template void bidiag::ApplyTwoStageQ \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& householderScalarsQ, \
+    const Matrix<Base<F>>& signatureQ, \
+    const BulgeReflectors<F>& reflectorsQ, \
+          Matrix<F>& B ); \
+  template void bidiag::ApplyTwoStageQ \
+  ( const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalarsQ, \
+    const AbstractDistMatrix<Base<F>>& signatureQ, \
+    const BulgeReflectors<F>& reflectorsQ, \
+          AbstractDistMatrix<F>& B ); \
+  template void bidiag::ApplyTwoStageP \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& householderScalarsP, \
+    const Matrix<Base<F>>& signatureP, \
+    const BulgeReflectors<F>& reflectorsP, \
+          Matrix<F>& B ); \
+  template void bidiag::ApplyTwoStageP \
+  ( const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalarsP, \
+    const AbstractDistMatrix<Base<F>>& signatureP, \
+    const BulgeReflectors<F>& reflectorsP, \
           AbstractDistMatrix<F>& B );
 
 #define EL_NO_INT_PROTO
@@ -0,0 +1,551 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BIDIAG_TWOSTAGE_HPP
+#define EL_BIDIAG_TWOSTAGE_HPP
+
+namespace El {
+namespace bidiag {
+
+namespace two_stage {
+
+// Reduce the m x n matrix A, with m >= n, to an upper band of the given
+// width. The QR factorization of each panel of columns is applied from the
+// left to the columns to its right, and then the LQ factorization of the
+// block to the right of the triangular factor is applied from the right to the
+// trailing matrix. The band is formed from the triangular factors, while the
+// Householder vectors are kept below the diagonal and to the right of the band.
+template<typename F>
+void Band
+( Matrix<F>& A,
+  Matrix<F>& householderScalarsQ,
+  Matrix<Base<F>>& signatureQ,
+  Matrix<F>& householderScalarsP,
+  Matrix<Base<F>>& signatureP,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    Zeros( householderScalarsQ, n, 1 );
+    Zeros( signatureQ, n, 1 );
+    Zeros( householderScalarsP, n, 1 );
+    Zeros( signatureP, n, 1 );
+    for( Int k=0; k<n; k+=bandwidth )
+    {
+        const Int nb = Min(bandwidth,n-k);
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, END ), indB( k, END );
+
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+        auto householderScalarsQ1 = householderScalarsQ( ind1, ALL );
+        auto signatureQ1 = signatureQ( ind1, ALL );
+        QR( AB1, householderScalarsQ1, signatureQ1 );
+        qr::ApplyQ
+        ( LEFT, ADJOINT, AB1, householderScalarsQ1, signatureQ1, AB2 );
+        if( k+nb == n )
+            break;
+
+        auto A12 = A( ind1, ind2 );
+        auto A22 = A( ind2, ind2 );
+        const Int minDim = Min( nb, A12.Width() );
+        auto householderScalarsP1 = householderScalarsP( IR(k,k+minDim), ALL );
+        auto signatureP1 = signatureP( IR(k,k+minDim), ALL );
+        LQ( A12, householderScalarsP1, signatureP1 );
+        lq::ApplyQ
+        ( RIGHT, ADJOINT, A12, householderScalarsP1, signatureP1, A22 );
+    }
+}
+
+template<typename F>
+void Band
+( DistMatrix<F>& A,
+  DistMatrix<F,STAR,STAR>& householderScalarsQ,
+  DistMatrix<Base<F>,STAR,STAR>& signatureQ,
+  DistMatrix<F,STAR,STAR>& householderScalarsP,
+  DistMatrix<Base<F>,STAR,STAR>& signatureP,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    Zeros( householderScalarsQ, n, 1 );
+    Zeros( signatureQ, n, 1 );
+    Zeros( householderScalarsP, n, 1 );
+    Zeros( signatureP, n, 1 );
+    for( Int k=0; k<n; k+=bandwidth )
+    {
+        const Int nb = Min(bandwidth,n-k);
+        const Range<Int> ind1( k, k+nb ), ind2( k+nb, END ), indB( k, END );
+
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+        auto householderScalarsQ1 = householderScalarsQ( ind1, ALL );
+        auto signatureQ1 = signatureQ( ind1, ALL );
+        QR( AB1, householderScalarsQ1, signatureQ1 );
+        qr::ApplyQ
+        ( LEFT, ADJOINT, AB1, householderScalarsQ1, signatureQ1, AB2 );
+        if( k+nb == n )
+            break;
+
+        auto A12 = A( ind1, ind2 );
+        auto A22 = A( ind2, ind2 );
+        const Int minDim = Min( nb, A12.Width() );
+        auto householderScalarsP1 = householderScalarsP( IR(k,k+minDim), ALL );
+        auto signatureP1 = signatureP( IR(k,k+minDim), ALL );
+        LQ( A12, householderScalarsP1, signatureP1 );
+        lq::ApplyQ
+        ( RIGHT, ADJOINT, A12, householderScalarsP1, signatureP1, A22 );
+    }
+}
+
+// Chase the upper band, with B(j-i,i) = A(i,j) for 0 <= j-i <= bandwidth,
+// down to upper bidiagonal form.
+//
+// Each step annihilates a row to the right of its superdiagonal with a
+// reflector applied from the right, which creates a bulge below the diagonal
+// that is then annihilated with a reflector applied from the left, which in
+// turn creates a bulge in the next block row. The intermediate matrices have
+// a lower bandwidth of 'bandwidth-1' and an upper bandwidth of
+// '2*bandwidth-1'.
+template<typename F>
+void ChaseBulges
+( const Matrix<F>& BPre,
+  Int bandwidth,
+  Matrix<Base<F>>& mainDiag,
+  Matrix<Base<F>>& superDiag,
+  BulgeReflectors<F>* reflectorsQ,
+  BulgeReflectors<F>* reflectorsP )
+{
+    EL_DEBUG_CSE
+    const Int n = BPre.Width();
+    const Int lowerBandwidth = bandwidth-1;
+    const Int upperBandwidth = 2*bandwidth-1;
+    Matrix<F> B;
+    Zeros( B, lowerBandwidth+upperBandwidth+1, n );
+    F* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    auto entry =
+      [&]( Int i, Int j ) -> F& { return BBuf[(upperBandwidth+i-j)+j*BLDim]; };
+    for( Int i=0; i<n; ++i )
+        for( Int j=i; j<Min(n,i+BPre.Height()); ++j )
+            entry(i,j) = BPre(j-i,i);
+
+    if( reflectorsQ != nullptr )
+        bulge::Reset( *reflectorsQ, bandwidth );
+    if( reflectorsP != nullptr )
+        bulge::Reset( *reflectorsP, bandwidth );
+
+    vector<F> u, y;
+    for( Int i=0; i<n-1; ++i )
+    {
+        // Annihilate A(source,c+1:c+length) and then A(c+1:c+length,c),
+        // with source=i on the first step
+        Int source = i;
+        Int c = i+1;
+        Int length = Min( bandwidth, n-c );
+        while( true )
+        {
+            u.resize( length );
+            y.resize( length );
+
+            // Compute H such that conj(A(source,c:c+length)) H^H is a
+            // multiple of e_0^T and apply H^H from the right
+            for( Int t=0; t<length; ++t )
+                y[t] = Conj(entry(source,c+t));
+            F tau = lapack::Reflector( length, y[0], &y[1], 1 );
+            u[0] = F(1);
+            entry(source,c) = Conj(y[0]);
+            for( Int t=1; t<length; ++t )
+            {
+                u[t] = y[t];
+                entry(source,c+t) = F(0);
+            }
+            if( reflectorsP != nullptr )
+                bulge::Push( *reflectorsP, c, length, tau, u );
+            for( Int r=source+1; r<Min(n,c+bandwidth); ++r )
+            {
+                F gamma = 0;
+                for( Int t=0; t<length; ++t )
+                    gamma += entry(r,c+t)*u[t];
+                gamma *= Conj(tau);
+                for( Int t=0; t<length; ++t )
+                    entry(r,c+t) -= gamma*Conj(u[t]);
+            }
+
+            // Annihilate the bulge below the diagonal from the left
+            for( Int t=0; t<length; ++t )
+                y[t] = entry(c+t,c);
+            tau = lapack::Reflector( length, y[0], &y[1], 1 );
+            entry(c,c) = y[0];
+            for( Int t=1; t<length; ++t )
+            {
+                u[t] = y[t];
+                entry(c+t,c) = F(0);
+            }
+            if( reflectorsQ != nullptr )
+                bulge::Push( *reflectorsQ, c, length, tau, u );
+            for( Int q=c+1; q<Min(n,c+2*bandwidth); ++q )
+            {
+                F gamma = 0;
+                for( Int t=0; t<length; ++t )
+                    gamma += Conj(u[t])*entry(c+t,q);
+                gamma *= tau;
+                for( Int t=0; t<length; ++t )
+                    entry(c+t,q) -= gamma*u[t];
+            }
+
+            const Int cNext = c + length;
+            const Int lengthNext = Min( bandwidth, n-cNext );
+            if( lengthNext < 2 )
+                break;
+            source = c;
+            c = cNext;
+            length = lengthNext;
+        }
+    }
+
+    // The reflectors produce a real bidiagonal
+    mainDiag.Resize( n, 1 );
+    superDiag.Resize( Max(n-1,Int(0)), 1 );
+    for( Int j=0; j<n; ++j )
+        mainDiag(j) = RealPart(entry(j,j));
+    for( Int j=0; j<n-1; ++j )
+        superDiag(j) = RealPart(entry(j,j+1));
+}
+
+template<typename F>
+Int DefaultBandwidth( Int n, Int bandwidth )
+{
+    if( bandwidth <= 0 )
+        bandwidth = TunedBlocksize<F>("BidiagTwoStage");
+    return Max( Min( bandwidth, n-1 ), Int(1) );
+}
+
+template<typename F>
+void ExtractBand( const Matrix<F>& A, Int bandwidth, Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    Zeros( B, bandwidth+1, n );
+    for( Int i=0; i<n; ++i )
+        for( Int j=i; j<Min(n,i+bandwidth+1); ++j )
+            B(j-i,i) = A(i,j);
+}
+
+template<typename F>
+void ExtractBand( const DistMatrix<F>& A, Int bandwidth, Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    Zeros( B, bandwidth+1, n );
+    for( Int offset=0; offset<=Min(bandwidth,n-1); ++offset )
+    {
+        DistMatrix<F,STAR,STAR> diag( GetDiagonal( A, offset ) );
+        for( Int i=0; i<n-offset; ++i )
+            B(offset,i) = diag.GetLocal(i,0);
+    }
+}
+
+template<typename F>
+void TwoStage
+( Matrix<F>& A,
+  Matrix<F>& householderScalarsQ,
+  Matrix<Base<F>>& signatureQ,
+  Matrix<F>& householderScalarsP,
+  Matrix<Base<F>>& signatureP,
+  Matrix<Base<F>>& mainDiag,
+  Matrix<Base<F>>& superDiag,
+  BulgeReflectors<F>* reflectorsQ,
+  BulgeReflectors<F>* reflectorsP,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    if( A.Height() < A.Width() )
+        LogicError("Two-stage bidiagonalization requires m >= n");
+    const Int n = A.Width();
+    bandwidth = DefaultBandwidth<F>( n, bandwidth );
+
+    Band
+    ( A, householderScalarsQ, signatureQ, householderScalarsP, signatureP,
+      bandwidth );
+    Matrix<F> B;
+    ExtractBand( A, bandwidth, B );
+    ChaseBulges
+    ( B, bandwidth, mainDiag, superDiag, reflectorsQ, reflectorsP );
+}
+
+// Reduce the distributed matrix to a band and then redundantly chase the
+// (gathered) band down to bidiagonal form on every process
+template<typename F>
+void TwoStage
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsQPre,
+  AbstractDistMatrix<Base<F>>& signatureQPre,
+  AbstractDistMatrix<F>& householderScalarsPPre,
+  AbstractDistMatrix<Base<F>>& signaturePPre,
+  AbstractDistMatrix<Base<F>>& mainDiag,
+  AbstractDistMatrix<Base<F>>& superDiag,
+  BulgeReflectors<F>* reflectorsQ,
+  BulgeReflectors<F>* reflectorsP,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    if( APre.Height() < APre.Width() )
+        LogicError("Two-stage bidiagonalization requires m >= n");
+    const Int n = APre.Width();
+    if( bandwidth <= 0 )
+        bandwidth = TunedBlocksize<F>("BidiagTwoStage",APre.Grid());
+    bandwidth = DefaultBandwidth<F>( n, bandwidth );
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR>
+      householderScalarsQProx( householderScalarsQPre ),
+      householderScalarsPProx( householderScalarsPPre );
+    DistMatrixWriteProxy<Base<F>,Base<F>,STAR,STAR>
+      signatureQProx( signatureQPre ),
+      signaturePProx( signaturePPre );
+    auto& A = AProx.Get();
+    auto& householderScalarsQ = householderScalarsQProx.Get();
+    auto& householderScalarsP = householderScalarsPProx.Get();
+    auto& signatureQ = signatureQProx.Get();
+    auto& signatureP = signaturePProx.Get();
+    const Grid& g = A.Grid();
+
+    Band
+    ( A, householderScalarsQ, signatureQ, householderScalarsP, signatureP,
+      bandwidth );
+    Matrix<F> B;
+    ExtractBand( A, bandwidth, B );
+
+    DistMatrix<Base<F>,STAR,STAR> mainDiag_STAR_STAR(g),
+      superDiag_STAR_STAR(g);
+    mainDiag_STAR_STAR.Resize( n, 1 );
+    superDiag_STAR_STAR.Resize( Max(n-1,Int(0)), 1 );
+    ChaseBulges
+    ( B, bandwidth, mainDiag_STAR_STAR.Matrix(), superDiag_STAR_STAR.Matrix(),
+      reflectorsQ, reflectorsP );
+    Copy( mainDiag_STAR_STAR, mainDiag );
+    Copy( superDiag_STAR_STAR, superDiag );
+}
+
+// The number of LQ factorizations performed by Band
+inline Int NumRowPanels( Int n, Int bandwidth )
+{ return ( n > bandwidth ? (n-1)/bandwidth : 0 ); }
+
+} // namespace two_stage
+
+template<typename F>
+void TwoStage
+( Matrix<F>& A,
+  Matrix<Base<F>>& mainDiag,
+  Matrix<Base<F>>& superDiag,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    Matrix<F> householderScalarsQ, householderScalarsP;
+    Matrix<Base<F>> signatureQ, signatureP;
+    two_stage::TwoStage<F>
+    ( A, householderScalarsQ, signatureQ, householderScalarsP, signatureP,
+      mainDiag, superDiag, nullptr, nullptr, bandwidth );
+}
+
+template<typename F>
+void TwoStage
+( AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<Base<F>>& mainDiag,
+  AbstractDistMatrix<Base<F>>& superDiag,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    DistMatrix<F,STAR,STAR> householderScalarsQ(g), householderScalarsP(g);
+    DistMatrix<Base<F>,STAR,STAR> signatureQ(g), signatureP(g);
+    two_stage::TwoStage<F>
+    ( A, householderScalarsQ, signatureQ, householderScalarsP, signatureP,
+      mainDiag, superDiag, nullptr, nullptr, bandwidth );
+}
+
+template<typename F>
+void TwoStage
+( Matrix<F>& A,
+  Matrix<F>& householderScalarsQ,
+  Matrix<Base<F>>& signatureQ,
+  Matrix<F>& householderScalarsP,
+  Matrix<Base<F>>& signatureP,
+  Matrix<Base<F>>& mainDiag,
+  Matrix<Base<F>>& superDiag,
+  BulgeReflectors<F>& reflectorsQ,
+  BulgeReflectors<F>& reflectorsP,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    two_stage::TwoStage
+    ( A, householderScalarsQ, signatureQ, householderScalarsP, signatureP,
+      mainDiag, superDiag, &reflectorsQ, &reflectorsP, bandwidth );
+}
+
+template<typename F>
+void TwoStage
+( AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalarsQ,
+  AbstractDistMatrix<Base<F>>& signatureQ,
+  AbstractDistMatrix<F>& householderScalarsP,
+  AbstractDistMatrix<Base<F>>& signatureP,
+  AbstractDistMatrix<Base<F>>& mainDiag,
+  AbstractDistMatrix<Base<F>>& superDiag,
+  BulgeReflectors<F>& reflectorsQ,
+  BulgeReflectors<F>& reflectorsP,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    two_stage::TwoStage
+    ( A, householderScalarsQ, signatureQ, householderScalarsP, signatureP,
+      mainDiag, superDiag, &reflectorsQ, &reflectorsP, bandwidth );
+}
+
+template<typename F>
+void ApplyTwoStageQ
+( const Matrix<F>& A,
+  const Matrix<F>& householderScalarsQ,
+  const Matrix<Base<F>>& signatureQ,
+  const BulgeReflectors<F>& reflectorsQ,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Int bandwidth = reflectorsQ.bandwidth;
+    bulge::Apply( reflectorsQ, B );
+
+    // Apply the column panel transformations of the band reduction in reverse
+    const Int numPanels = (n+bandwidth-1) / bandwidth;
+    for( Int panel=numPanels-1; panel>=0; --panel )
+    {
+        const Int k = panel*bandwidth;
+        const Int nb = Min(bandwidth,n-k);
+        const Range<Int> ind1( k, k+nb ), indB( k, END );
+        auto AB1 = A( indB, ind1 );
+        auto householderScalarsQ1 = householderScalarsQ( ind1, ALL );
+        auto signatureQ1 = signatureQ( ind1, ALL );
+        auto BB = B( indB, ALL );
+        qr::ApplyQ
+        ( LEFT, NORMAL, AB1, householderScalarsQ1, signatureQ1, BB );
+    }
+}
+
+template<typename F>
+void ApplyTwoStageQ
+( const AbstractDistMatrix<F>& APre,
+  const AbstractDistMatrix<F>& householderScalarsQPre,
+  const AbstractDistMatrix<Base<F>>& signatureQPre,
+  const BulgeReflectors<F>& reflectorsQ,
+        AbstractDistMatrix<F>& BPre )
+{
+    EL_DEBUG_CSE
+    const Int n = APre.Width();
+    const Int bandwidth = reflectorsQ.bandwidth;
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixReadProxy<F,F,STAR,STAR>
+      householderScalarsQProx( householderScalarsQPre );
+    DistMatrixReadProxy<Base<F>,Base<F>,STAR,STAR>
+      signatureQProx( signatureQPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& householderScalarsQ = householderScalarsQProx.GetLocked();
+    auto& signatureQ = signatureQProx.GetLocked();
+    auto& B = BProx.Get();
+
+    bulge::Apply( reflectorsQ, B );
+
+    const Int numPanels = (n+bandwidth-1) / bandwidth;
+    for( Int panel=numPanels-1; panel>=0; --panel )
+    {
+        const Int k = panel*bandwidth;
+        const Int nb = Min(bandwidth,n-k);
+        const Range<Int> ind1( k, k+nb ), indB( k, END );
+        auto AB1 = A( indB, ind1 );
+        auto householderScalarsQ1 = householderScalarsQ( ind1, ALL );
+        auto signatureQ1 = signatureQ( ind1, ALL );
+        auto BB = B( indB, ALL );
+        qr::ApplyQ
+        ( LEFT, NORMAL, AB1, householderScalarsQ1, signatureQ1, BB );
+    }
+}
+
+template<typename F>
+void ApplyTwoStageP
+( const Matrix<F>& A,
+  const Matrix<F>& householderScalarsP,
+  const Matrix<Base<F>>& signatureP,
+  const BulgeReflectors<F>& reflectorsP,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Int bandwidth = reflectorsP.bandwidth;
+    bulge::Apply( reflectorsP, B );
+
+    // Apply the row panel transformations of the band reduction in reverse
+    const Int numPanels = two_stage::NumRowPanels( n, bandwidth );
+    for( Int panel=numPanels-1; panel>=0; --panel )
+    {
+        const Int k = panel*bandwidth;
+        const Range<Int> ind1( k, k+bandwidth ), ind2( k+bandwidth, END );
+        auto A12 = A( ind1, ind2 );
+        const Int minDim = Min( bandwidth, A12.Width() );
+        auto householderScalarsP1 = householderScalarsP( IR(k,k+minDim), ALL );
+        auto signatureP1 = signatureP( IR(k,k+minDim), ALL );
+        auto B2 = B( ind2, ALL );
+        lq::ApplyQ
+        ( LEFT, ADJOINT, A12, householderScalarsP1, signatureP1, B2 );
+    }
+}
+
+template<typename F>
+void ApplyTwoStageP
+( const AbstractDistMatrix<F>& APre,
+  const AbstractDistMatrix<F>& householderScalarsPPre,
+  const AbstractDistMatrix<Base<F>>& signaturePPre,
+  const BulgeReflectors<F>& reflectorsP,
+        AbstractDistMatrix<F>& BPre )
+{
+    EL_DEBUG_CSE
+    const Int n = APre.Width();
+    const Int bandwidth = reflectorsP.bandwidth;
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixReadProxy<F,F,STAR,STAR>
+      householderScalarsPProx( householderScalarsPPre );
+    DistMatrixReadProxy<Base<F>,Base<F>,STAR,STAR>
+      signaturePProx( signaturePPre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& householderScalarsP = householderScalarsPProx.GetLocked();
+    auto& signatureP = signaturePProx.GetLocked();
+    auto& B = BProx.Get();
+
+    bulge::Apply( reflectorsP, B );
+
+    const Int numPanels = two_stage::NumRowPanels( n, bandwidth );
+    for( Int panel=numPanels-1; panel>=0; --panel )
+    {
+        const Int k = panel*bandwidth;
+        const Range<Int> ind1( k, k+bandwidth ), ind2( k+bandwidth, END );
+        auto A12 = A( ind1, ind2 );
+        const Int minDim = Min( bandwidth, A12.Width() );
+        auto householderScalarsP1 = householderScalarsP( IR(k,k+minDim), ALL );
+        auto signatureP1 = signatureP( IR(k,k+minDim), ALL );
+        auto B2 = B( ind2, ALL );
+        lq::ApplyQ
+        ( LEFT, ADJOINT, A12, householderScalarsP1, signatureP1, B2 );
+    }
+}
+
+} // namespace bidiag
+} // namespace El
+
+#endif // ifndef EL_BIDIAG_TWOSTAGE_HPP
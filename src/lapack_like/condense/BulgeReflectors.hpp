@@ -0,0 +1,86 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CONDENSE_BULGEREFLECTORS_HPP
+#define EL_CONDENSE_BULGEREFLECTORS_HPP
+
+namespace El {
+namespace bulge {
+
+template<typename F>
+void Reset( BulgeReflectors<F>& reflectors, Int bandwidth )
+{
+    reflectors.bandwidth = bandwidth;
+    reflectors.offsets.clear();
+    reflectors.lengths.clear();
+    reflectors.scalars.clear();
+    reflectors.vectors.clear();
+}
+
+template<typename F>
+void Push
+( BulgeReflectors<F>& reflectors,
+  Int offset,
+  Int length,
+  const F& tau,
+  const vector<F>& u )
+{
+    reflectors.offsets.push_back( offset );
+    reflectors.lengths.push_back( length );
+    reflectors.scalars.push_back( tau );
+    reflectors.vectors.insert( reflectors.vectors.end(), u.begin(), u.end() );
+}
+
+// B := H_0^H H_1^H ... H_{k-1}^H B, which is the product of the (adjoints of
+// the) bulge-chasing reflectors in the order in which they were generated.
+// As the reflectors act on rows, each block of columns is handled
+// independently.
+template<typename F>
+void Apply( const BulgeReflectors<F>& reflectors, Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int width = B.Width();
+    const Int numReflectors = reflectors.offsets.size();
+    const Int blocksize = Blocksize();
+    const Int numBlocks = (width+blocksize-1) / blocksize;
+    ParallelFor
+    ( numBlocks,
+      [&]( Int block )
+      {
+          auto B1 =
+            B( ALL, IR(block*blocksize,Min((block+1)*blocksize,width)) );
+          Matrix<F> u, z;
+          Int vectorOffset = reflectors.vectors.size();
+          for( Int k=numReflectors-1; k>=0; --k )
+          {
+              const Int offset = reflectors.offsets[k];
+              const Int length = reflectors.lengths[k];
+              vectorOffset -= length;
+              u.LockedAttach
+              ( length, 1, &reflectors.vectors[vectorOffset], length );
+              auto B1R = B1( IR(offset,offset+length), ALL );
+              Gemv( ADJOINT, F(1), B1R, u, z );
+              Ger( -Conj(reflectors.scalars[k]), u, z, B1R );
+          }
+      } );
+}
+
+// Each process redundantly applies the reflectors to its own columns
+template<typename F>
+void Apply( const BulgeReflectors<F>& reflectors, DistMatrix<F>& B )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F,STAR,VR> B_STAR_VR( B );
+    Apply( reflectors, B_STAR_VR.Matrix() );
+    B = B_STAR_VR;
+}
+
+} // namespace bulge
+} // namespace El
+
+#endif // ifndef EL_CONDENSE_BULGEREFLECTORS_HPP
@@ -47,6 +47,8 @@ void Ger2Sub
 #include "./HermitianTridiag/UpperBlockedSquare.hpp"
 
 #include "./HermitianTridiag/ApplyQ.hpp"
+#include "./BulgeReflectors.hpp"
+#include "./HermitianTridiag/TwoStage.hpp"
 
 namespace El {
 
@@ -115,10 +117,13 @@ void HermitianTridiag
         DistMatrix<F> ASquare(squareGrid);
         DistMatrix<F,STAR,STAR> householderScalarsSquare(squareGrid);
 
-        // Perform the fast tridiagonalization on the square grid
+        // Perform the fast tridiagonalization on the square grid (with the
+        // blocksize tuned for the original grid)
         ASquare = A;
         if( ASquare.Participating() )
         {
+            BlocksizeGuard blocksizeGuard
+            ( TunedBlocksize<F>("HermitianTridiag",grid) );
             if( uplo == LOWER )
                 herm_tridiag::LowerBlockedSquare
                 ( ASquare, householderScalarsSquare, ctrl.symvCtrl );
@@ -218,6 +223,48 @@ void ExplicitCondensed
     Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
+          AbstractDistMatrix<F>& B ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, \
+    Matrix<F>& A, \
+    Matrix<Base<F>>& d, \
+    Matrix<F>& dSub, \
+    Int bandwidth ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, \
+    AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<Base<F>>& d, \
+    AbstractDistMatrix<F>& dSub, \
+    Int bandwidth ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, \
+    Matrix<F>& A, \
+    Matrix<F>& householderScalars, \
+    Matrix<Base<F>>& signature, \
+    Matrix<Base<F>>& d, \
+    Matrix<F>& dSub, \
+    BulgeReflectors<F>& reflectors, \
+    Int bandwidth ); \
+  template void herm_tridiag::TwoStage \
+  ( UpperOrLower uplo, \
+    AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    AbstractDistMatrix<Base<F>>& signature, \
+    AbstractDistMatrix<Base<F>>& d, \
+    AbstractDistMatrix<F>& dSub, \
+    BulgeReflectors<F>& reflectors, \
+    Int bandwidth ); \
+  template void herm_tridiag::ApplyTwoStageQ \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& householderScalars, \
+    const Matrix<Base<F>>& signature, \
+    const BulgeReflectors<F>& reflectors, \
+          Matrix<F>& B ); \
+  template void herm_tridiag::ApplyTwoStageQ \
+  ( const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& householderScalars, \
+    const AbstractDistMatrix<Base<F>>& signature, \
+    const BulgeReflectors<F>& reflectors, \
           AbstractDistMatrix<F>& B );
 
 #define EL_NO_INT_PROTO
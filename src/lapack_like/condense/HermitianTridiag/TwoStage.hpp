@@ -0,0 +1,534 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+#define EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
+
+namespace El {
+namespace herm_tridiag {
+
+namespace two_stage {
+
+// Overwrite the lower triangle of the Hermitian matrix A22 with that of
+// Q^H A22 Q, where the QR factorization of A21 implicitly defines
+//
+//   Q = (I - U S^H U^H) D,
+//
+// with U the unit-diagonal Householder vectors, S = inv(SInv) for
+// SInv = tril(U^H U) with diagonal 1/householderScalars, and D the diagonal
+// signature. If Y = A22 U S^H and Z = Y - (1/2) U (S U^H Y), then
+//
+//   (I - U S U^H) A22 (I - U S^H U^H) = A22 - U Z^H - Z U^H,
+//
+// which is a single Her2k rather than a pair of two-sided reflector
+// applications over the full trailing matrix.
+template<typename F>
+void TrailingUpdate
+( const Matrix<F>& A21,
+  const Matrix<F>& householderScalars1,
+  const Matrix<Base<F>>& signature1,
+        Matrix<F>& A22 )
+{
+    EL_DEBUG_CSE
+    const Int m = A22.Height();
+    const Int minDim = householderScalars1.Height();
+
+    Matrix<F> U;
+    Copy( A21( ALL, IR(0,minDim) ), U );
+    MakeTrapezoidal( LOWER, U );
+    FillDiagonal( U, F(1) );
+
+    Matrix<F> SInv;
+    Herk( LOWER, ADJOINT, Base<F>(1), U, SInv );
+    for( Int j=0; j<minDim; ++j )
+        SInv(j,j) = F(1) / householderScalars1(j);
+
+    Matrix<F> Y, X;
+    Zeros( Y, m, minDim );
+    Hemm( LEFT, LOWER, F(1), A22, U, F(0), Y );
+    Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), SInv, Y );
+    Gemm( ADJOINT, NORMAL, F(1), U, Y, X );
+    Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), SInv, X );
+    Gemm( NORMAL, NORMAL, F(-1)/F(2), U, X, F(1), Y );
+    Her2k( LOWER, NORMAL, F(-1), U, Y, Base<F>(1), A22 );
+
+    auto A22T = A22( IR(0,minDim), ALL );
+    auto A22L = A22( ALL, IR(0,minDim) );
+    DiagonalScale( LEFT, ADJOINT, signature1, A22T );
+    DiagonalScale( RIGHT, NORMAL, signature1, A22L );
+}
+
+template<typename F>
+void TrailingUpdate
+( const DistMatrix<F>& A21,
+  const DistMatrix<F,STAR,STAR>& householderScalars1,
+  const DistMatrix<Base<F>,STAR,STAR>& signature1,
+        DistMatrix<F>& A22 )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A22.Grid();
+    const Int m = A22.Height();
+    const Int minDim = householderScalars1.Height();
+
+    DistMatrix<F> U(g);
+    Copy( A21( ALL, IR(0,minDim) ), U );
+    MakeTrapezoidal( LOWER, U );
+    FillDiagonal( U, F(1) );
+
+    DistMatrix<F,STAR,STAR> SInv_STAR_STAR(g);
+    {
+        DistMatrix<F> SInv(g);
+        Herk( LOWER, ADJOINT, Base<F>(1), U, SInv );
+        SInv_STAR_STAR = SInv;
+    }
+    auto& SInvLoc = SInv_STAR_STAR.Matrix();
+    auto& householderScalars1Loc = householderScalars1.LockedMatrix();
+    for( Int j=0; j<minDim; ++j )
+        SInvLoc(j,j) = F(1) / householderScalars1Loc(j);
+
+    DistMatrix<F> Y(g);
+    Zeros( Y, m, minDim );
+    Hemm( LEFT, LOWER, F(1), A22, U, F(0), Y );
+
+    // The small triangular solves and the b x b product are local to the
+    // rows owned in a [VC,STAR] distribution
+    DistMatrix<F,VC,STAR> Y_VC_STAR(g), U_VC_STAR(g);
+    Y_VC_STAR = Y;
+    U_VC_STAR.AlignWith( Y_VC_STAR );
+    U_VC_STAR = U;
+    LocalTrsm
+    ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), SInv_STAR_STAR, Y_VC_STAR );
+    DistMatrix<F,STAR,STAR> X_STAR_STAR(g);
+    Zeros( X_STAR_STAR, minDim, minDim );
+    LocalGemm
+    ( ADJOINT, NORMAL, F(1), U_VC_STAR, Y_VC_STAR, F(0), X_STAR_STAR );
+    El::AllReduce( X_STAR_STAR.Matrix(), g.VCComm() );
+    LocalTrsm
+    ( LEFT, LOWER, NORMAL, NON_UNIT, F(1), SInv_STAR_STAR, X_STAR_STAR );
+    LocalGemm
+    ( NORMAL, NORMAL, F(-1)/F(2), U_VC_STAR, X_STAR_STAR, F(1), Y_VC_STAR );
+    Y = Y_VC_STAR;
+    Her2k( LOWER, NORMAL, F(-1), U, Y, Base<F>(1), A22 );
+
+    auto A22T = A22( IR(0,minDim), ALL );
+    auto A22L = A22( ALL, IR(0,minDim) );
+    DiagonalScale( LEFT, ADJOINT, signature1, A22T );
+    DiagonalScale( RIGHT, NORMAL, signature1, A22L );
+}
+
+// Reduce the Hermitian matrix A, whose lower triangle is referenced, to a
+// lower band of the given width. For each panel of columns, the QR
+// factorization of the portion below the band, A21 = Q R, overwrites A21, and
+// the lower triangle of the trailing matrix is replaced by that of Q^H A22 Q,
+// so that the band is formed from the diagonal blocks and the triangular
+// factors R, while the Householder vectors are kept below the band. The
+// strictly upper triangle of the trailing matrices is not kept up to date.
+template<typename F>
+void Band
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    Zeros( householderScalars, n, 1 );
+    Zeros( signature, n, 1 );
+    for( Int k=0; k+bandwidth+1<n; k+=bandwidth )
+    {
+        const Range<Int> ind1( k, k+bandwidth ), ind2( k+bandwidth, END );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+        const Int minDim = Min( A21.Height(), bandwidth );
+        auto householderScalars1 = householderScalars( IR(k,k+minDim), ALL );
+        auto signature1 = signature( IR(k,k+minDim), ALL );
+
+        QR( A21, householderScalars1, signature1 );
+        TrailingUpdate( A21, householderScalars1, signature1, A22 );
+    }
+}
+
+template<typename F>
+void Band
+( DistMatrix<F>& A,
+  DistMatrix<F,STAR,STAR>& householderScalars,
+  DistMatrix<Base<F>,STAR,STAR>& signature,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    Zeros( householderScalars, n, 1 );
+    Zeros( signature, n, 1 );
+    for( Int k=0; k+bandwidth+1<n; k+=bandwidth )
+    {
+        const Range<Int> ind1( k, k+bandwidth ), ind2( k+bandwidth, END );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+        const Int minDim = Min( A21.Height(), bandwidth );
+        auto householderScalars1 = householderScalars( IR(k,k+minDim), ALL );
+        auto signature1 = signature( IR(k,k+minDim), ALL );
+
+        QR( A21, householderScalars1, signature1 );
+        TrailingUpdate( A21, householderScalars1, signature1, A22 );
+    }
+}
+
+// Chase the band, with B(i-j,j) = A(i,j) for 0 <= i-j <= bandwidth, down to
+// tridiagonal form using reflectors of length at most 'bandwidth'.
+//
+// The j'th sweep annihilates column j below its subdiagonal with a reflector
+// acting on the next 'bandwidth' rows. Its application from the right to the
+// block below creates a bulge, whose first column is annihilated by the next
+// reflector, and so on down the band. The remainder of each bulge lies within
+// the blocks touched by the following sweep, and so twice the bandwidth
+// suffices to store the intermediate matrices.
+template<typename F>
+void ChaseBulges
+( const Matrix<F>& BPre,
+  Int bandwidth,
+  Matrix<Base<F>>& d,
+  Matrix<F>& dSub,
+  BulgeReflectors<F>* reflectors )
+{
+    EL_DEBUG_CSE
+    const Int n = BPre.Width();
+    Matrix<F> B;
+    Zeros( B, 2*bandwidth, n );
+    auto BTop = B( IR(0,BPre.Height()), ALL );
+    BTop = BPre;
+    F* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    auto entry = [&]( Int i, Int j ) -> F& { return BBuf[(i-j)+j*BLDim]; };
+
+    if( reflectors != nullptr )
+        bulge::Reset( *reflectors, bandwidth );
+
+    Matrix<F> D;
+    vector<F> u;
+    for( Int j=0; j<n-1; ++j )
+    {
+        // Annihilate A(r0+1:r0+length,c), with c=j on the first step
+        Int c = j;
+        Int r0 = j+1;
+        Int length = Min( bandwidth, n-r0 );
+        while( true )
+        {
+            F* x = &entry(r0,c);
+            const F tau = lapack::Reflector( length, x[0], &x[1], 1 );
+            u.resize( length );
+            u[0] = F(1);
+            for( Int t=1; t<length; ++t )
+            {
+                u[t] = x[t];
+                x[t] = F(0);
+            }
+            if( reflectors != nullptr )
+                bulge::Push( *reflectors, r0, length, tau, u );
+
+            // Apply H from the left to the rest of the bulge
+            for( Int q=c+1; q<r0; ++q )
+            {
+                F* y = &entry(r0,q);
+                F gamma = 0;
+                for( Int t=0; t<length; ++t )
+                    gamma += Conj(u[t])*y[t];
+                gamma *= tau;
+                for( Int t=0; t<length; ++t )
+                    y[t] -= gamma*u[t];
+            }
+
+            // Form H D H^H for the Hermitian diagonal block D
+            D.Resize( length, length );
+            for( Int t=0; t<length; ++t )
+            {
+                for( Int s=t; s<length; ++s )
+                {
+                    D(s,t) = entry(r0+s,r0+t);
+                    D(t,s) = Conj(D(s,t));
+                }
+            }
+            for( Int s=0; s<length; ++s )
+            {
+                F gamma = 0;
+                for( Int t=0; t<length; ++t )
+                    gamma += D(s,t)*u[t];
+                gamma *= Conj(tau);
+                for( Int t=0; t<length; ++t )
+                    D(s,t) -= gamma*Conj(u[t]);
+            }
+            for( Int t=0; t<length; ++t )
+            {
+                F gamma = 0;
+                for( Int s=0; s<length; ++s )
+                    gamma += Conj(u[s])*D(s,t);
+                gamma *= tau;
+                for( Int s=t; s<length; ++s )
+                    entry(r0+s,r0+t) = D(s,t) - gamma*u[s];
+            }
+
+            // Apply H^H from the right to the block below, creating a bulge
+            const Int rNext = r0 + length;
+            const Int lengthNext = Min( bandwidth, n-rNext );
+            for( Int i=rNext; i<rNext+lengthNext; ++i )
+            {
+                F gamma = 0;
+                for( Int t=0; t<length; ++t )
+                    gamma += entry(i,r0+t)*u[t];
+                gamma *= Conj(tau);
+                for( Int t=0; t<length; ++t )
+                    entry(i,r0+t) -= gamma*Conj(u[t]);
+            }
+            if( lengthNext < 2 )
+                break;
+            c = r0;
+            r0 = rNext;
+            length = lengthNext;
+        }
+    }
+
+    // The reflectors produce a real subdiagonal
+    d.Resize( n, 1 );
+    dSub.Resize( Max(n-1,Int(0)), 1 );
+    for( Int j=0; j<n; ++j )
+        d(j) = RealPart(entry(j,j));
+    for( Int j=0; j<n-1; ++j )
+        dSub(j) = entry(j+1,j);
+}
+
+template<typename F>
+Int DefaultBandwidth( Int n, Int bandwidth )
+{
+    if( bandwidth <= 0 )
+        bandwidth = TunedBlocksize<F>("HermitianTwoStage");
+    return Max( Min( bandwidth, n-1 ), Int(1) );
+}
+
+// The number of panels reduced by Band
+inline Int NumPanels( Int n, Int bandwidth )
+{ return ( n > bandwidth+1 ? (n-2)/bandwidth : 0 ); }
+
+} // namespace two_stage
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature,
+  Matrix<Base<F>>& d,
+  Matrix<F>& dSub,
+  BulgeReflectors<F>& reflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    const Int n = A.Height();
+    bandwidth = two_stage::DefaultBandwidth<F>( n, bandwidth );
+
+    MakeHermitian( uplo, A );
+    two_stage::Band( A, householderScalars, signature, bandwidth );
+
+    Matrix<F> B;
+    Zeros( B, bandwidth+1, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=j; i<Min(n,j+bandwidth+1); ++i )
+            B(i-j,j) = A(i,j);
+    two_stage::ChaseBulges( B, bandwidth, d, dSub, &reflectors );
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  Matrix<F>& A,
+  Matrix<Base<F>>& d,
+  Matrix<F>& dSub,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    const Int n = A.Height();
+    bandwidth = two_stage::DefaultBandwidth<F>( n, bandwidth );
+
+    Matrix<F> householderScalars;
+    Matrix<Base<F>> signature;
+    MakeHermitian( uplo, A );
+    two_stage::Band( A, householderScalars, signature, bandwidth );
+
+    Matrix<F> B;
+    Zeros( B, bandwidth+1, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=j; i<Min(n,j+bandwidth+1); ++i )
+            B(i-j,j) = A(i,j);
+    two_stage::ChaseBulges<F>( B, bandwidth, d, dSub, nullptr );
+}
+
+namespace two_stage {
+
+// Reduce the distributed matrix to a band and then redundantly chase the
+// (gathered) band down to tridiagonal form on every process
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  AbstractDistMatrix<Base<F>>& signaturePre,
+  AbstractDistMatrix<Base<F>>& d,
+  AbstractDistMatrix<F>& dSub,
+  BulgeReflectors<F>* reflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    if( APre.Height() != APre.Width() )
+        LogicError("A must be square");
+    const Int n = APre.Height();
+    if( bandwidth <= 0 )
+        bandwidth = TunedBlocksize<F>("HermitianTwoStage",APre.Grid());
+    bandwidth = DefaultBandwidth<F>( n, bandwidth );
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixWriteProxy<Base<F>,Base<F>,STAR,STAR>
+      signatureProx( signaturePre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+    auto& signature = signatureProx.Get();
+    const Grid& g = A.Grid();
+
+    MakeHermitian( uplo, A );
+    Band( A, householderScalars, signature, bandwidth );
+
+    Matrix<F> B;
+    Zeros( B, bandwidth+1, n );
+    for( Int offset=0; offset<=Min(bandwidth,n-1); ++offset )
+    {
+        DistMatrix<F,STAR,STAR> diag( GetDiagonal( A, -offset ) );
+        for( Int j=0; j<n-offset; ++j )
+            B(offset,j) = diag.GetLocal(j,0);
+    }
+
+    DistMatrix<Base<F>,STAR,STAR> d_STAR_STAR(g);
+    DistMatrix<F,STAR,STAR> dSub_STAR_STAR(g);
+    d_STAR_STAR.Resize( n, 1 );
+    dSub_STAR_STAR.Resize( Max(n-1,Int(0)), 1 );
+    ChaseBulges
+    ( B, bandwidth, d_STAR_STAR.Matrix(), dSub_STAR_STAR.Matrix(),
+      reflectors );
+    Copy( d_STAR_STAR, d );
+    Copy( dSub_STAR_STAR, dSub );
+}
+
+} // namespace two_stage
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  AbstractDistMatrix<Base<F>>& signature,
+  AbstractDistMatrix<Base<F>>& d,
+  AbstractDistMatrix<F>& dSub,
+  BulgeReflectors<F>& reflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    two_stage::TwoStage<F>
+    ( uplo, A, householderScalars, signature, d, dSub, &reflectors,
+      bandwidth );
+}
+
+template<typename F>
+void TwoStage
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<Base<F>>& d,
+  AbstractDistMatrix<F>& dSub,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F,STAR,STAR> householderScalars(A.Grid());
+    DistMatrix<Base<F>,STAR,STAR> signature(A.Grid());
+    two_stage::TwoStage<F>
+    ( uplo, A, householderScalars, signature, d, dSub, nullptr, bandwidth );
+}
+
+template<typename F>
+void ApplyTwoStageQ
+( const Matrix<F>& A,
+  const Matrix<F>& householderScalars,
+  const Matrix<Base<F>>& signature,
+  const BulgeReflectors<F>& reflectors,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int bandwidth = reflectors.bandwidth;
+    bulge::Apply( reflectors, B );
+
+    // Apply the panel transformations of the band reduction in reverse
+    const Int numPanels = two_stage::NumPanels( n, bandwidth );
+    for( Int panel=numPanels-1; panel>=0; --panel )
+    {
+        const Int k = panel*bandwidth;
+        const Range<Int> ind1( k, k+bandwidth ), ind2( k+bandwidth, END );
+        auto A21 = A( ind2, ind1 );
+        const Int minDim = Min( A21.Height(), bandwidth );
+        auto householderScalars1 = householderScalars( IR(k,k+minDim), ALL );
+        auto signature1 = signature( IR(k,k+minDim), ALL );
+        auto B2 = B( ind2, ALL );
+        qr::ApplyQ
+        ( LEFT, NORMAL, A21, householderScalars1, signature1, B2 );
+    }
+}
+
+template<typename F>
+void ApplyTwoStageQ
+( const AbstractDistMatrix<F>& APre,
+  const AbstractDistMatrix<F>& householderScalarsPre,
+  const AbstractDistMatrix<Base<F>>& signaturePre,
+  const BulgeReflectors<F>& reflectors,
+        AbstractDistMatrix<F>& BPre )
+{
+    EL_DEBUG_CSE
+    const Int n = APre.Height();
+    const Int bandwidth = reflectors.bandwidth;
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixReadProxy<F,F,STAR,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixReadProxy<Base<F>,Base<F>,STAR,STAR>
+      signatureProx( signaturePre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& householderScalars = householderScalarsProx.GetLocked();
+    auto& signature = signatureProx.GetLocked();
+    auto& B = BProx.Get();
+
+    bulge::Apply( reflectors, B );
+
+    const Int numPanels = two_stage::NumPanels( n, bandwidth );
+    for( Int panel=numPanels-1; panel>=0; --panel )
+    {
+        const Int k = panel*bandwidth;
+        const Range<Int> ind1( k, k+bandwidth ), ind2( k+bandwidth, END );
+        auto A21 = A( ind2, ind1 );
+        const Int minDim = Min( A21.Height(), bandwidth );
+        auto householderScalars1 = householderScalars( IR(k,k+minDim), ALL );
+        auto signature1 = signature( IR(k,k+minDim), ALL );
+        auto B2 = B( ind2, ALL );
+        qr::ApplyQ
+        ( LEFT, NORMAL, A21, householderScalars1, signature1, B2 );
+    }
+}
+
+} // namespace herm_tridiag
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAG_TWOSTAGE_HPP
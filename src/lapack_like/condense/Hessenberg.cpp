@@ -12,6 +12,8 @@
 #include "./Hessenberg/UpperBlocked.hpp"
 #include "./Hessenberg/ApplyQ.hpp"
 #include "./Hessenberg/FormQ.hpp"
+#include "./BulgeReflectors.hpp"
+#include "./Hessenberg/TwoStage.hpp"
 
 namespace El {
 
@@ -101,7 +103,21 @@ void ExplicitCondensed( UpperOrLower uplo, AbstractDistMatrix<F>& A )
   ( UpperOrLower uplo, \
     const AbstractDistMatrix<F>& A, \
     const AbstractDistMatrix<F>& householderScalars, \
-          AbstractDistMatrix<F>& Q );
+          AbstractDistMatrix<F>& Q ); \
+  template void hessenberg::TwoStage \
+  ( Matrix<F>& A, Int bandwidth ); \
+  template void hessenberg::TwoStage \
+  ( Matrix<F>& A, \
+    Matrix<F>& householderScalars, \
+    Matrix<Base<F>>& signature, \
+    BulgeReflectors<F>& reflectors, \
+    Int bandwidth ); \
+  template void hessenberg::ApplyTwoStageQ \
+  ( const Matrix<F>& A, \
+    const Matrix<F>& householderScalars, \
+    const Matrix<Base<F>>& signature, \
+    const BulgeReflectors<F>& reflectors, \
+          Matrix<F>& B );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,202 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HESSENBERG_TWOSTAGE_HPP
+#define EL_HESSENBERG_TWOSTAGE_HPP
+
+namespace El {
+namespace hessenberg {
+
+namespace two_stage {
+
+// Reduce A to upper block-Hessenberg form, with the given lower bandwidth.
+// For each panel of columns, the QR factorization of the portion below the
+// band, A21 = Q R, overwrites A21, and Q is applied from the left to A22 and
+// from the right to the columns of A to the right of the panel.
+template<typename F>
+void Band
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    Zeros( householderScalars, n, 1 );
+    Zeros( signature, n, 1 );
+    for( Int k=0; k+bandwidth+1<n; k+=bandwidth )
+    {
+        const Range<Int> ind1( k, k+bandwidth ), ind2( k+bandwidth, END );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+        auto A2 = A( ALL, ind2 );
+        const Int minDim = Min( A21.Height(), bandwidth );
+        auto householderScalars1 = householderScalars( IR(k,k+minDim), ALL );
+        auto signature1 = signature( IR(k,k+minDim), ALL );
+
+        QR( A21, householderScalars1, signature1 );
+        qr::ApplyQ
+        ( LEFT, ADJOINT, A21, householderScalars1, signature1, A22 );
+        qr::ApplyQ
+        ( RIGHT, NORMAL, A21, householderScalars1, signature1, A2 );
+    }
+}
+
+// Chase the block-Hessenberg matrix H, which is assumed to be zero below its
+// 'bandwidth' subdiagonal, down to upper Hessenberg form.
+//
+// The j'th sweep annihilates column j below its subdiagonal with a reflector
+// acting on the next 'bandwidth' rows. Its application from the right creates
+// a bulge in the block below, whose first column is annihilated by the next
+// reflector, and so on down the band. Since the upper triangle is full, each
+// reflector is applied with a matrix-vector product and a rank-one update.
+template<typename F>
+void ChaseBulges
+( Matrix<F>& H,
+  Int bandwidth,
+  BulgeReflectors<F>* reflectors )
+{
+    EL_DEBUG_CSE
+    const Int n = H.Height();
+    if( reflectors != nullptr )
+        bulge::Reset( *reflectors, bandwidth );
+
+    vector<F> u;
+    Matrix<F> uMat, z;
+    for( Int j=0; j+2<n; ++j )
+    {
+        // Annihilate H(r0+1:r0+length,c), with c=j on the first step
+        Int c = j;
+        Int r0 = j+1;
+        Int length = Min( bandwidth, n-r0 );
+        while( true )
+        {
+            F* x = &H(r0,c);
+            const F tau = lapack::Reflector( length, x[0], &x[1], 1 );
+            u.resize( length );
+            u[0] = F(1);
+            for( Int t=1; t<length; ++t )
+            {
+                u[t] = x[t];
+                x[t] = F(0);
+            }
+            if( reflectors != nullptr )
+                bulge::Push( *reflectors, r0, length, tau, u );
+            uMat.LockedAttach( length, 1, u.data(), length );
+
+            // H(R,c+1:n) := (I - tau u u^H) H(R,c+1:n)
+            const Range<Int> indR( r0, r0+length );
+            auto HRight = H( indR, IR(c+1,n) );
+            Gemv( ADJOINT, F(1), HRight, uMat, z );
+            Ger( -tau, uMat, z, HRight );
+
+            // H(0:rEnd,R) := H(0:rEnd,R) (I - conj(tau) u u^H), which creates
+            // the bulge in the block below
+            const Int rNext = r0 + length;
+            const Int lengthNext = Min( bandwidth, n-rNext );
+            auto HCols = H( IR(0,rNext+lengthNext), indR );
+            Gemv( NORMAL, F(1), HCols, uMat, z );
+            Ger( -Conj(tau), z, uMat, HCols );
+
+            if( lengthNext < 2 )
+                break;
+            c = r0;
+            r0 = rNext;
+            length = lengthNext;
+        }
+    }
+}
+
+template<typename F>
+Int DefaultBandwidth( Int n, Int bandwidth )
+{
+    if( bandwidth <= 0 )
+        bandwidth = TunedBlocksize<F>("HessenbergTwoStage");
+    return Max( Min( bandwidth, n-1 ), Int(1) );
+}
+
+// The number of panels reduced by Band
+inline Int NumPanels( Int n, Int bandwidth )
+{ return ( n > bandwidth+1 ? (n-2)/bandwidth : 0 ); }
+
+} // namespace two_stage
+
+template<typename F>
+void TwoStage( Matrix<F>& A, Int bandwidth )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    const Int n = A.Height();
+    bandwidth = two_stage::DefaultBandwidth<F>( n, bandwidth );
+
+    Matrix<F> householderScalars;
+    Matrix<Base<F>> signature;
+    two_stage::Band( A, householderScalars, signature, bandwidth );
+    MakeTrapezoidal( UPPER, A, -bandwidth );
+    two_stage::ChaseBulges<F>( A, bandwidth, nullptr );
+}
+
+template<typename F>
+void TwoStage
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature,
+  BulgeReflectors<F>& reflectors,
+  Int bandwidth )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    const Int n = A.Height();
+    bandwidth = two_stage::DefaultBandwidth<F>( n, bandwidth );
+
+    two_stage::Band( A, householderScalars, signature, bandwidth );
+
+    // The bulges extend below the band, so the Householder vectors of the
+    // band reduction are set aside during the chase
+    Matrix<F> V( A );
+    MakeTrapezoidal( LOWER, V, -bandwidth-1 );
+    MakeTrapezoidal( UPPER, A, -bandwidth );
+    two_stage::ChaseBulges( A, bandwidth, &reflectors );
+    A += V;
+}
+
+template<typename F>
+void ApplyTwoStageQ
+( const Matrix<F>& A,
+  const Matrix<F>& householderScalars,
+  const Matrix<Base<F>>& signature,
+  const BulgeReflectors<F>& reflectors,
+        Matrix<F>& B )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int bandwidth = reflectors.bandwidth;
+    bulge::Apply( reflectors, B );
+
+    // Apply the panel transformations of the band reduction in reverse
+    const Int numPanels = two_stage::NumPanels( n, bandwidth );
+    for( Int panel=numPanels-1; panel>=0; --panel )
+    {
+        const Int k = panel*bandwidth;
+        const Range<Int> ind1( k, k+bandwidth ), ind2( k+bandwidth, END );
+        auto A21 = A( ind2, ind1 );
+        const Int minDim = Min( A21.Height(), bandwidth );
+        auto householderScalars1 = householderScalars( IR(k,k+minDim), ALL );
+        auto signature1 = signature( IR(k,k+minDim), ALL );
+        auto B2 = B( ind2, ALL );
+        qr::ApplyQ
+        ( LEFT, NORMAL, A21, householderScalars1, signature1, B2 );
+    }
+}
+
+} // namespace hessenberg
+} // namespace El
+
+#endif // ifndef EL_HESSENBERG_TWOSTAGE_HPP
@@ -0,0 +1,472 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_EQUILIBRATE_FUSEDSWEEPS_HPP
+#define EL_EQUILIBRATE_FUSEDSWEEPS_HPP
+
+namespace El {
+namespace equil {
+
+// Fused equilibration sweeps over (the local rows of) CSR matrices
+// ================================================================
+// Each sweep of Ruiz or geometric equilibration rescales the columns and then
+// the rows. Since the (local) rows of both SparseMatrix and DistSparseMatrix
+// are stored contiguously, a single pass over each row can apply the current
+// column scaling, form the row statistics, apply the row scaling, and
+// accumulate the column statistics needed by the next sweep.
+//
+// Each process only tracks the columns referenced by its local rows (its
+// "ghost" columns), much like DistGraphMultMeta: the ghost column statistics
+// are sent to the owners of the columns, which combine them, form the new
+// column scalings, and return the scalings of the ghost columns. A sweep
+// therefore costs one pass over the nonzeros, two exchanges whose volume is
+// proportional to the number of ghost columns, and a scalar AllReduce for
+// the convergence test.
+//
+// The column statistics are stored as the maximum absolute value of each
+// column followed (for geometric scaling) by the negation of the minimum
+// nonzero absolute value, so that both can be combined with a maximum.
+
+// The local rows of a matrix which shares its columns with the other blocks
+template<typename Field>
+struct CSRBlock
+{
+    Int localHeight;
+    const Int* offsets;
+    const Int* targets;
+    Field* values;
+    Base<Field>* dRow;
+};
+
+template<typename Field>
+CSRBlock<Field> MakeCSRBlock( SparseMatrix<Field>& A, Matrix<Base<Field>>& d )
+{
+    CSRBlock<Field> block;
+    block.localHeight = A.Height();
+    block.offsets = A.LockedOffsetBuffer();
+    block.targets = A.LockedTargetBuffer();
+    block.values = A.ValueBuffer();
+    block.dRow = d.Buffer();
+    return block;
+}
+
+template<typename Field>
+CSRBlock<Field>
+MakeCSRBlock( DistSparseMatrix<Field>& A, DistMultiVec<Base<Field>>& d )
+{
+    CSRBlock<Field> block;
+    block.localHeight = A.LocalHeight();
+    block.offsets = A.LockedOffsetBuffer();
+    block.targets = A.LockedTargetBuffer();
+    block.values = A.ValueBuffer();
+    block.dRow = d.Matrix().Buffer();
+    return block;
+}
+
+template<typename Real>
+Real RuizScaling( const Real& maxAbs )
+{
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.33));
+    if( maxAbs == Real(0) )
+        return 1;
+    else
+        return Max(maxAbs,tol);
+}
+
+template<typename Real>
+Real GeomScaling( const Real& maxAbs, const Real& minAbs, const Real& sqrtDamp )
+{
+    if( maxAbs > Real(0) )
+        return Max(Sqrt(minAbs*maxAbs),sqrtDamp*maxAbs);
+    else
+        return 1;
+}
+
+struct FusedSweepCtrl
+{
+    bool geometric=false;
+    Int minIter=0;
+    Int maxIter=4;
+    // For Ruiz scaling, stop once every nonzero column has a maximum absolute
+    // value within 'ruizTol' of one; for geometric scaling, stop once the
+    // ratio of the largest to smallest nonzero magnitude fails to decrease by
+    // at least a factor of 'relTol' (after 'minIter' sweeps)
+    double ruizTol=1e-4;
+    double relTol=0.9;
+    double damp=1e-3;
+    bool progress=false;
+};
+
+// The ghost columns of a set of blocks and the pattern of the exchanges with
+// the owners of those columns
+struct GhostColumnMeta
+{
+    // The sorted global indices of the columns referenced by the local rows
+    vector<Int> ghostCols;
+    // The index within 'ghostCols' of the column of each local nonzero of
+    // each block
+    vector<vector<Int>> ghostTargets;
+    // The statistics of the ghost columns are sent to their owners, and the
+    // roles of the 'send' and 'recv' buffers reverse when the scalings are
+    // returned
+    vector<int> sendSizes, sendOffs,
+                recvSizes, recvOffs;
+    // The offset (relative to the first locally-owned column) of each
+    // received column
+    vector<Int> recvLocalCols;
+};
+
+template<typename Field>
+GhostColumnMeta FormGhostColumnMeta
+( const vector<CSRBlock<Field>>& blocks,
+  Int firstLocalCol,
+  Int localWidth,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    GhostColumnMeta meta;
+
+    // Gather the sorted, unique columns referenced by the local rows
+    Int numLocalEntries = 0;
+    for( const auto& block : blocks )
+        numLocalEntries += block.offsets[block.localHeight];
+    auto& ghostCols = meta.ghostCols;
+    ghostCols.reserve( numLocalEntries );
+    for( const auto& block : blocks )
+        ghostCols.insert
+        ( ghostCols.end(), block.targets,
+          block.targets+block.offsets[block.localHeight] );
+    std::sort( ghostCols.begin(), ghostCols.end() );
+    ghostCols.erase
+    ( std::unique( ghostCols.begin(), ghostCols.end() ), ghostCols.end() );
+    SwapClear( meta.ghostTargets );
+    meta.ghostTargets.resize( blocks.size() );
+    for( size_t b=0; b<blocks.size(); ++b )
+    {
+        const auto& block = blocks[b];
+        const Int numEntries = block.offsets[block.localHeight];
+        auto& ghostTargets = meta.ghostTargets[b];
+        ghostTargets.resize( numEntries );
+        EL_PARALLEL_FOR
+        for( Int e=0; e<numEntries; ++e )
+            ghostTargets[e] =
+              std::lower_bound
+              ( ghostCols.begin(), ghostCols.end(), block.targets[e] ) -
+              ghostCols.begin();
+    }
+
+    // Determine the owner of each ghost column from the (ascending) first
+    // columns of the processes, skipping processes which own no columns
+    vector<Int> firstCols(commSize), localWidths(commSize);
+    mpi::AllGather( &firstLocalCol, 1, firstCols.data(), 1, comm );
+    mpi::AllGather( &localWidth, 1, localWidths.data(), 1, comm );
+    meta.sendSizes.resize( commSize, 0 );
+    int owner = 0;
+    for( const Int j : ghostCols )
+    {
+        while( j >= firstCols[owner]+localWidths[owner] )
+            ++owner;
+        ++meta.sendSizes[owner];
+    }
+    Scan( meta.sendSizes, meta.sendOffs );
+    meta.recvSizes.resize( commSize );
+    mpi::AllToAll
+    ( meta.sendSizes.data(), 1, meta.recvSizes.data(), 1, comm );
+    const int totalRecv = Scan( meta.recvSizes, meta.recvOffs );
+    meta.recvLocalCols.resize( totalRecv );
+    mpi::AllToAll
+    ( ghostCols.data(), meta.sendSizes.data(), meta.sendOffs.data(),
+      meta.recvLocalCols.data(), meta.recvSizes.data(), meta.recvOffs.data(),
+      comm );
+    for( Int& jLoc : meta.recvLocalCols )
+        jLoc -= firstLocalCol;
+
+    return meta;
+}
+
+// If 'ghostScale' is non-null, divide the columns of each block by it and
+// then rescale the rows; in either case, overwrite 'ghostStats' with the
+// (local contributions to the) column statistics of the result
+template<typename Field>
+void ScaleAndFormColumnStats
+(       vector<CSRBlock<Field>>& blocks,
+  const GhostColumnMeta& meta,
+  const Base<Field>* ghostScale,
+  const FusedSweepCtrl& ctrl,
+        vector<Base<Field>>& ghostStats )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int numGhost = meta.ghostCols.size();
+    const Int numStats = ( ctrl.geometric ? 2 : 1 );
+    const Real sqrtDamp = Sqrt(Real(ctrl.damp));
+#ifdef EL_HYBRID
+    const Int maxThreads = omp_get_max_threads();
+#else
+    const Int maxThreads = 1;
+#endif
+    // Thread zero accumulates directly into 'ghostStats'
+    ghostStats.resize( numStats*numGhost );
+    vector<Real> threadStats( (maxThreads-1)*numStats*numGhost );
+    for( Int t=0; t<maxThreads; ++t )
+    {
+        Real* tStats =
+          ( t == 0 ? ghostStats.data() :
+                     threadStats.data() + (t-1)*numStats*numGhost );
+        for( Int k=0; k<numGhost; ++k )
+            tStats[k] = 0;
+        if( ctrl.geometric )
+            for( Int k=0; k<numGhost; ++k )
+                tStats[numGhost+k] = -limits::Max<Real>();
+    }
+
+#ifdef EL_HYBRID
+    #pragma omp parallel
+#endif
+    {
+#ifdef EL_HYBRID
+        const Int numThreads = omp_get_num_threads();
+        const Int thread = omp_get_thread_num();
+#else
+        const Int numThreads = 1;
+        const Int thread = 0;
+#endif
+        Real* maxAbs =
+          ( thread == 0 ? ghostStats.data() :
+                          threadStats.data() + (thread-1)*numStats*numGhost );
+        Real* negMinAbs = maxAbs + numGhost;
+        for( size_t b=0; b<blocks.size(); ++b )
+        {
+            auto& block = blocks[b];
+            const Int* targets = meta.ghostTargets[b].data();
+            const Int chunk = (block.localHeight+numThreads-1) / numThreads;
+            const Int rowBeg = Min(chunk*thread,block.localHeight);
+            const Int rowEnd = Min(chunk*(thread+1),block.localHeight);
+            for( Int iLoc=rowBeg; iLoc<rowEnd; ++iLoc )
+            {
+                const Int eBeg = block.offsets[iLoc];
+                const Int eEnd = block.offsets[iLoc+1];
+                if( ghostScale != nullptr )
+                {
+                    Real rowMaxAbs = 0;
+                    Real rowMinAbs = limits::Max<Real>();
+                    for( Int e=eBeg; e<eEnd; ++e )
+                    {
+                        block.values[e] /= ghostScale[targets[e]];
+                        const Real absVal = Abs(block.values[e]);
+                        rowMaxAbs = Max(rowMaxAbs,absVal);
+                        if( absVal > Real(0) )
+                            rowMinAbs = Min(rowMinAbs,absVal);
+                    }
+                    const Real rowScale =
+                      ( ctrl.geometric ?
+                        GeomScaling(rowMaxAbs,rowMinAbs,sqrtDamp) :
+                        RuizScaling(rowMaxAbs) );
+                    block.dRow[iLoc] *= rowScale;
+                    for( Int e=eBeg; e<eEnd; ++e )
+                        block.values[e] /= rowScale;
+                }
+                for( Int e=eBeg; e<eEnd; ++e )
+                {
+                    const Int k = targets[e];
+                    const Real absVal = Abs(block.values[e]);
+                    maxAbs[k] = Max(maxAbs[k],absVal);
+                    if( ctrl.geometric && absVal > Real(0) )
+                        negMinAbs[k] = Max(negMinAbs[k],-absVal);
+                }
+            }
+        }
+    }
+
+    if( maxThreads > 1 )
+    {
+        EL_PARALLEL_FOR
+        for( Int k=0; k<numStats*numGhost; ++k )
+        {
+            Real stat = ghostStats[k];
+            for( Int t=1; t<maxThreads; ++t )
+                stat = Max(stat,threadStats[k+(t-1)*numStats*numGhost]);
+            ghostStats[k] = stat;
+        }
+    }
+}
+
+// Equilibrate the blocks, which share their (global) column space of size n,
+// accumulating the row scalings into the blocks and the column scalings into
+// the 'localWidth' entries of 'dCol' starting from column 'firstLocalCol'
+template<typename Field>
+void FusedSweeps
+(       vector<CSRBlock<Field>>& blocks,
+        Int n,
+        Base<Field>* dCol,
+        Int firstLocalCol,
+        Int localWidth,
+        mpi::Comm comm,
+  const FusedSweepCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const bool print = ctrl.progress && mpi::Rank(comm) == 0;
+    const bool distributed = ( mpi::Size(comm) > 1 );
+    const Real sqrtDamp = Sqrt(Real(ctrl.damp));
+    const Int numStats = ( ctrl.geometric ? 2 : 1 );
+
+    const GhostColumnMeta meta =
+      FormGhostColumnMeta( blocks, firstLocalCol, localWidth, comm );
+    const Int numGhost = meta.ghostCols.size();
+    const Int numRecv = meta.recvLocalCols.size();
+
+    // Combine the statistics of the ghost columns into those of the
+    // locally-owned columns
+    vector<Real> ghostStats, recvStats(numStats*numRecv),
+                 stats(numStats*localWidth);
+    vector<Real> ghostScale(numGhost), recvScale(numRecv),
+                 colScale(localWidth);
+    auto reduceStats = [&]( const Real* scales )
+    {
+        ScaleAndFormColumnStats( blocks, meta, scales, ctrl, ghostStats );
+        for( Int s=0; s<numStats; ++s )
+        {
+            if( distributed )
+                mpi::AllToAll
+                ( ghostStats.data()+s*numGhost,
+                  meta.sendSizes.data(), meta.sendOffs.data(),
+                  recvStats.data()+s*numRecv,
+                  meta.recvSizes.data(), meta.recvOffs.data(), comm );
+            else
+                MemCopy
+                ( recvStats.data()+s*numRecv, ghostStats.data()+s*numGhost,
+                  numGhost );
+        }
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            stats[jLoc] = 0;
+        if( ctrl.geometric )
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                stats[localWidth+jLoc] = -limits::Max<Real>();
+        for( Int s=0; s<numStats; ++s )
+            for( Int k=0; k<numRecv; ++k )
+            {
+                Real& stat = stats[s*localWidth+meta.recvLocalCols[k]];
+                stat = Max(stat,recvStats[s*numRecv+k]);
+            }
+    };
+    // The ratio of the largest to the smallest nonzero magnitude
+    auto formRatio = [&]( Real& maxAbsVal, Real& minAbsVal ) -> Real
+    {
+        Real extrema[2] = { 0, -limits::Max<Real>() };
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            extrema[0] = Max(extrema[0],stats[jLoc]);
+            if( stats[jLoc] > Real(0) )
+                extrema[1] = Max(extrema[1],stats[localWidth+jLoc]);
+        }
+        if( distributed )
+            mpi::AllReduce( extrema, 2, mpi::MAX, comm );
+        maxAbsVal = extrema[0];
+        minAbsVal = -extrema[1];
+        return maxAbsVal / minAbsVal;
+    };
+
+    reduceStats( nullptr );
+    Real ratio = 0;
+    if( ctrl.geometric )
+    {
+        Real maxAbsVal, minAbsVal;
+        ratio = formRatio( maxAbsVal, minAbsVal );
+        if( maxAbsVal == Real(0) )
+            return;
+        if( print )
+            Output("Original ratio is ",maxAbsVal,"/",minAbsVal,"=",ratio);
+    }
+
+    const Int indent = PushIndent();
+    for( Int iter=0; iter<ctrl.maxIter; ++iter )
+    {
+        // Form the scalings of the owned columns from their statistics and
+        // return those of the ghost columns
+        EL_PARALLEL_FOR
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            colScale[jLoc] =
+              ( ctrl.geometric ?
+                GeomScaling(stats[jLoc],-stats[localWidth+jLoc],sqrtDamp) :
+                RuizScaling(stats[jLoc]) );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            dCol[jLoc] *= colScale[jLoc];
+        for( Int k=0; k<numRecv; ++k )
+            recvScale[k] = colScale[meta.recvLocalCols[k]];
+        if( distributed )
+            mpi::AllToAll
+            ( recvScale.data(), meta.recvSizes.data(), meta.recvOffs.data(),
+              ghostScale.data(), meta.sendSizes.data(), meta.sendOffs.data(),
+              comm );
+        else
+            ghostScale = recvScale;
+
+        // Apply the column and row scalings in a single pass
+        reduceStats( ghostScale.data() );
+
+        // Determine whether we are done or not
+        if( ctrl.geometric )
+        {
+            Real newMaxAbsVal, newMinAbsVal;
+            const Real newRatio = formRatio( newMaxAbsVal, newMinAbsVal );
+            if( print )
+                Output
+                ("New ratio is ",newMaxAbsVal,"/",newMinAbsVal,"=",newRatio);
+            if( iter >= ctrl.minIter && newRatio >= ratio*Real(ctrl.relTol) )
+                break;
+            ratio = newRatio;
+        }
+        else
+        {
+            Real maxDev = 0;
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                if( stats[jLoc] > Real(0) )
+                    maxDev = Max(maxDev,Abs(Real(1)-stats[jLoc]));
+            if( distributed )
+                maxDev = mpi::AllReduce( maxDev, mpi::MAX, comm );
+            if( print )
+                Output("Maximum column deviation is ",maxDev);
+            if( iter >= ctrl.minIter && maxDev <= Real(ctrl.ruizTol) )
+                break;
+        }
+    }
+    SetIndent( indent );
+}
+
+// Scale each row so that its maximum entry is 1 or 0
+template<typename Field>
+void NormalizeRows( vector<CSRBlock<Field>>& blocks )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    for( auto& block : blocks )
+    {
+        EL_PARALLEL_FOR
+        for( Int iLoc=0; iLoc<block.localHeight; ++iLoc )
+        {
+            const Int eBeg = block.offsets[iLoc];
+            const Int eEnd = block.offsets[iLoc+1];
+            Real maxRowAbs = 0;
+            for( Int e=eBeg; e<eEnd; ++e )
+                maxRowAbs = Max(maxRowAbs,Abs(block.values[e]));
+            if( maxRowAbs > Real(0) )
+            {
+                block.dRow[iLoc] *= maxRowAbs;
+                for( Int e=eBeg; e<eEnd; ++e )
+                    block.values[e] /= maxRowAbs;
+            }
+        }
+    }
+}
+
+} // namespace equil
+} // namespace El
+
+#endif // ifndef EL_EQUILIBRATE_FUSEDSWEEPS_HPP
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./Util.hpp"
+#include "./FusedSweeps.hpp"
 
 // The following routines are adaptations of the approach uses by
 // Saunders et al. (originally recommended by Joseph Fourer) for iteratively
@@ -476,108 +477,22 @@ void GeomEquil
   bool progress )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int m = A.Height();
     const Int n = A.Width();
     Ones( dRow, m, 1 );
     Ones( dCol, n, 1 );
 
     // TODO(poulson): Expose these as control parameters
-    const Int minIter = 3;
-    const Int maxIter = 6;
-    const Real damp = Real(1)/Real(1000);
-    const Real relTol = Real(9)/Real(10);
-
-    // Compute the original ratio of the maximum to minimum nonzero
-    auto maxAbs = MaxAbsLoc( A );
-    const Real maxAbsVal = maxAbs.value;
-    if( maxAbsVal == Real(0) )
-        return;
-    const Real minAbsVal = MinAbsNonzero( A, maxAbsVal );
-    Real ratio = maxAbsVal / minAbsVal;
-    if( progress )
-        Output("Original ratio is ",maxAbsVal,"/",minAbsVal,"=",ratio);
-
-    const Real sqrtDamp = Sqrt(damp);
-    Matrix<Real> rowScale(m,1), colScale(n,1), maxAbsVals, minAbsVals;
-    const Int indent = PushIndent();
-    for( Int iter=0; iter<maxIter; ++iter )
-    {
-        // Geometrically rescale the columns
-        // ---------------------------------
-        ColumnMaxNorms( A, maxAbsVals );
-        ColumnMinAbsNonzero( A, maxAbsVals, minAbsVals );
-        for( Int j=0; j<n; ++j )
-        {
-            const Real maxAbs = maxAbsVals(j);
-            if( maxAbs > Real(0) )
-            {
-                const Real minAbs = minAbsVals(j);
-                const Real propScale = Sqrt(minAbs*maxAbs);
-                const Real scale = Max(propScale,sqrtDamp*maxAbs);
-                colScale(j) = scale;
-            }
-            else
-            {
-                colScale(j) = 1;
-            }
-        }
-        DiagonalScale( LEFT, NORMAL, colScale, dCol );
-        DiagonalSolve( RIGHT, NORMAL, colScale, A );
-
-        // Geometrically rescale the rows
-        // ------------------------------
-        RowMaxNorms( A, maxAbsVals );
-        RowMinAbsNonzero( A, maxAbsVals, minAbsVals );
-        for( Int i=0; i<m; ++i )
-        {
-            const Real maxAbs = maxAbsVals(i);
-            if( maxAbs > Real(0) )
-            {
-                const Real minAbs = minAbsVals(i);
-                const Real propScale = Sqrt(minAbs*maxAbs);
-                const Real scale = Max(propScale,sqrtDamp*maxAbs);
-                rowScale(i) = scale;
-            }
-            else
-                rowScale(i) = Real(1);
-        }
-        DiagonalScale( LEFT, NORMAL, rowScale, dRow );
-        DiagonalSolve( LEFT, NORMAL, rowScale, A );
-
-        // Determine whether we are done or not
-        // ------------------------------------
-        auto newMaxAbs = MaxAbsLoc( A );
-        const Real newMaxAbsVal = newMaxAbs.value;
-        const Real newMinAbsVal = MinAbsNonzero( A, newMaxAbsVal );
-        const Real newRatio = newMaxAbsVal / newMinAbsVal;
-        if( progress )
-            Output("New ratio is ",newMaxAbsVal,"/",newMinAbsVal,"=",newRatio);
-        if( iter >= minIter && newRatio >= ratio*relTol )
-            break;
-        ratio = newRatio;
-    }
-    SetIndent( indent );
-
-    // Scale each row so that its maximum entry is 1 or 0
-    Field* valBuf = A.ValueBuffer();
-    for( Int i=0; i<m; ++i )
-    {
-        const Int offset = A.RowOffset(i);
-        const Int numConnect = A.NumConnections(i);
-
-        // Compute the maximum value in this row
-        Real maxRowAbs = 0;
-        for( Int e=offset; e<offset+numConnect; ++e )
-            maxRowAbs = Max(maxRowAbs,Abs(A.Value(e)));
-
-        if( maxRowAbs > Real(0) )
-        {
-            dRow(i) *= maxRowAbs;
-            for( Int e=offset; e<offset+numConnect; ++e )
-                valBuf[e] /= maxRowAbs;
-        }
-    }
+    equil::FusedSweepCtrl ctrl;
+    ctrl.geometric = true;
+    ctrl.minIter = 3;
+    ctrl.maxIter = 6;
+    ctrl.progress = progress;
+    vector<equil::CSRBlock<Field>> blocks(1);
+    blocks[0] = equil::MakeCSRBlock( A, dRow );
+    equil::FusedSweeps
+    ( blocks, n, dCol.Buffer(), 0, n, mpi::COMM_SELF, ctrl );
+    equil::NormalizeRows( blocks );
 }
 
 template<typename Field>
@@ -590,7 +505,6 @@ void StackedGeomEquil
   bool progress )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int mA = A.Height();
     const Int mB = B.Height();
     const Int n = A.Width();
@@ -599,149 +513,17 @@ void StackedGeomEquil
     Ones( dCol, n, 1 );
 
     // TODO(poulson): Expose these as control parameters
-    const Int minIter = 3;
-    const Int maxIter = 6;
-    const Real damp = Real(1)/Real(1000);
-    const Real relTol = Real(9)/Real(10);
-
-    // Compute the original ratio of the maximum to minimum nonzero
-    auto maxAbsA = MaxAbsLoc( A );
-    auto maxAbsB = MaxAbsLoc( B );
-    const Real maxAbsVal = Max(maxAbsA.value,maxAbsB.value);
-    if( maxAbsVal == Real(0) )
-        return;
-    const Real minAbsValA = MinAbsNonzero( A, maxAbsVal );
-    const Real minAbsValB = MinAbsNonzero( B, maxAbsVal );
-    const Real minAbsVal = Min(minAbsValA,minAbsValB);
-    Real ratio = maxAbsVal / minAbsVal;
-    if( progress )
-        Output("Original ratio is ",maxAbsVal,"/",minAbsVal,"=",ratio);
-
-    const Real sqrtDamp = Sqrt(damp);
-    Matrix<Real> rowScaleA(mA,1), rowScaleB(mB,1), colScale(n,1),
-                 maxAbsValsA, maxAbsValsB, minAbsValsA, minAbsValsB;
-    const Int indent = PushIndent();
-    for( Int iter=0; iter<maxIter; ++iter )
-    {
-        // Geometrically rescale the columns
-        // ---------------------------------
-        ColumnMaxNorms( A, maxAbsValsA );
-        ColumnMaxNorms( B, maxAbsValsB );
-        for( Int j=0; j<n; ++j )
-            maxAbsValsA(j) = Max(maxAbsValsA(j),maxAbsValsB(j));
-        ColumnMinAbsNonzero( A, maxAbsValsA, minAbsValsA );
-        ColumnMinAbsNonzero( B, maxAbsValsA, minAbsValsB );
-        for( Int j=0; j<n; ++j )
-            minAbsValsA(j) = Min(minAbsValsA(j),minAbsValsB(j));
-        for( Int j=0; j<n; ++j )
-        {
-            const Real maxAbs = maxAbsValsA(j);
-            if( maxAbs > Real(0) )
-            {
-                const Real minAbs = minAbsValsA(j);
-                const Real propScale = Sqrt(minAbs*maxAbs);
-                const Real scale = Max(propScale,sqrtDamp*maxAbs);
-                colScale(j) = scale;
-            }
-            else
-                colScale(j) = Real(1);
-        }
-        DiagonalScale( LEFT, NORMAL, colScale, dCol );
-        DiagonalSolve( RIGHT, NORMAL, colScale, A );
-        DiagonalSolve( RIGHT, NORMAL, colScale, B );
-
-        // Geometrically rescale the rows
-        // ------------------------------
-        RowMaxNorms( A, maxAbsValsA );
-        RowMinAbsNonzero( A, maxAbsValsA, minAbsValsA );
-        for( Int i=0; i<mA; ++i )
-        {
-            const Real maxAbs = maxAbsValsA(i);
-            if( maxAbs > Real(0) )
-            {
-                const Real minAbs = minAbsValsA(i);
-                const Real propScale = Sqrt(minAbs*maxAbs);
-                const Real scale = Max(propScale,sqrtDamp*maxAbs);
-                rowScaleA(i) = scale;
-            }
-            else
-                rowScaleA(i) = Real(1);
-        }
-        DiagonalScale( LEFT, NORMAL, rowScaleA, dRowA );
-        DiagonalSolve( LEFT, NORMAL, rowScaleA, A );
-
-        RowMinAbsNonzero( B, maxAbsValsB, minAbsValsB );
-        RowMaxNorms( B, maxAbsValsB );
-        for( Int i=0; i<mB; ++i )
-        {
-            const Real maxAbs = maxAbsValsB(i);
-            if( maxAbs > Real(0) )
-            {
-                const Real minAbs = minAbsValsB(i);
-                const Real propScale = Sqrt(minAbs*maxAbs);
-                const Real scale = Max(propScale,sqrtDamp*maxAbs);
-                rowScaleB(i) = scale;
-            }
-            else
-                rowScaleB(i) = Real(1);
-        }
-        DiagonalScale( LEFT, NORMAL, rowScaleB, dRowB );
-        DiagonalSolve( LEFT, NORMAL, rowScaleB, B );
-
-        // Determine whether we are done or not
-        // ------------------------------------
-        auto newMaxAbsA = MaxAbsLoc( A );
-        auto newMaxAbsB = MaxAbsLoc( B );
-        const Real newMaxAbsVal = Max(newMaxAbsA.value,newMaxAbsB.value);
-        const Real newMinAbsValA = MinAbsNonzero( A, newMaxAbsVal );
-        const Real newMinAbsValB = MinAbsNonzero( B, newMaxAbsVal );
-        const Real newMinAbsVal = Min(newMinAbsValA,newMinAbsValB);
-        const Real newRatio = newMaxAbsVal / newMinAbsVal;
-        if( progress )
-            Output("New ratio is ",newMaxAbsVal,"/",newMinAbsVal,"=",newRatio);
-        if( iter >= minIter && newRatio >= ratio*relTol )
-            break;
-        ratio = newRatio;
-    }
-    SetIndent( indent );
-
-    // Scale each row so that its maximum entry is 1 or 0
-    Field* valBufA = A.ValueBuffer();
-    for( Int i=0; i<mA; ++i )
-    {
-        const Int offset = A.RowOffset(i);
-        const Int numConnect = A.NumConnections(i);
-
-        // Compute the maximum value in this row
-        Real maxRowAbs = 0;
-        for( Int e=offset; e<offset+numConnect; ++e )
-            maxRowAbs = Max(maxRowAbs,Abs(A.Value(e)));
-
-        if( maxRowAbs > Real(0) )
-        {
-            dRowA(i) *= maxRowAbs;
-            for( Int e=offset; e<offset+numConnect; ++e )
-                valBufA[e] /= maxRowAbs;
-        }
-    }
-    Field* valBufB = B.ValueBuffer();
-    for( Int i=0; i<mB; ++i )
-    {
-        const Int offset = B.RowOffset(i);
-        const Int numConnect = B.NumConnections(i);
-
-        // Compute the maximum value in this row
-        Real maxRowAbs = 0;
-        for( Int e=offset; e<offset+numConnect; ++e )
-            maxRowAbs = Max(maxRowAbs,Abs(B.Value(e)));
-
-        if( maxRowAbs > Real(0) )
-        {
-            dRowB(i) *= maxRowAbs;
-            for( Int e=offset; e<offset+numConnect; ++e )
-                valBufB[e] /= maxRowAbs;
-        }
-    }
+    equil::FusedSweepCtrl ctrl;
+    ctrl.geometric = true;
+    ctrl.minIter = 3;
+    ctrl.maxIter = 6;
+    ctrl.progress = progress;
+    vector<equil::CSRBlock<Field>> blocks(2);
+    blocks[0] = equil::MakeCSRBlock( A, dRowA );
+    blocks[1] = equil::MakeCSRBlock( B, dRowB );
+    equil::FusedSweeps
+    ( blocks, n, dCol.Buffer(), 0, n, mpi::COMM_SELF, ctrl );
+    equil::NormalizeRows( blocks );
 }
 
 template<typename Field>
@@ -752,119 +534,26 @@ void GeomEquil
   bool progress )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int m = A.Height();
     const Int n = A.Width();
     const Grid& grid = A.Grid();
-    const int commRank = grid.Rank();
-    dRow.SetGrid(grid);
-    dCol.SetGrid(grid);
+    dRow.SetGrid( grid );
+    dCol.SetGrid( grid );
     Ones( dRow, m, 1 );
     Ones( dCol, n, 1 );
 
     // TODO(poulson): Expose these as control parameters
-    const Int minIter = 3;
-    const Int maxIter = 6;
-    const Real damp = Real(1)/Real(1000);
-    const Real relTol = Real(9)/Real(10);
-
-    // Compute the original ratio of the maximum to minimum nonzero
-    auto maxAbs = MaxAbsLoc( A );
-    const Real maxAbsVal = maxAbs.value;
-    if( maxAbsVal == Real(0) )
-        return;
-    const Real minAbsVal = MinAbsNonzero( A, maxAbsVal );
-    Real ratio = maxAbsVal / minAbsVal;
-    if( progress && commRank == 0 )
-        Output("Original ratio is ",maxAbsVal,"/",minAbsVal,"=",ratio);
-
-    const Real sqrtDamp = Sqrt(damp);
-    DistMultiVec<Real> maxAbsVals(grid), minAbsVals(grid), scales(grid);
-    auto& scalesLoc = scales.Matrix();
-    const Int indent = PushIndent();
-    for( Int iter=0; iter<maxIter; ++iter )
-    {
-        // Geometrically rescale the columns
-        // ---------------------------------
-        ColumnMaxNorms( A, maxAbsVals );
-        ColumnMinAbsNonzero( A, maxAbsVals, minAbsVals );
-        auto& maxAbsValsLoc = maxAbsVals.Matrix();
-        auto& minAbsValsLoc = minAbsVals.Matrix();
-        scales.Resize( n, 1 );
-        const Int localWidth = maxAbsVals.LocalHeight();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Real maxAbs = maxAbsValsLoc(jLoc);
-            if( maxAbs > Real(0) )
-            {
-                const Real minAbs = minAbsValsLoc(jLoc);
-                const Real propScale = Sqrt(minAbs*maxAbs);
-                const Real scale = Max(propScale,sqrtDamp*maxAbs);
-                scalesLoc(jLoc) = scale;
-            }
-            else
-                scalesLoc(jLoc) = 1;
-        }
-        DiagonalScale( LEFT, NORMAL, scales, dCol );
-        DiagonalSolve( RIGHT, NORMAL, scales, A );
-
-        // Geometrically rescale the rows
-        // ------------------------------
-        RowMaxNorms( A, maxAbsVals );
-        RowMinAbsNonzero( A, maxAbsVals, minAbsVals );
-        scales.Resize( m, 1 );
-        const Int localHeight = maxAbsVals.LocalHeight();
-        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-        {
-            const Real maxAbs = maxAbsValsLoc(iLoc);
-            if( maxAbs > Real(0) )
-            {
-                const Real minAbs = minAbsValsLoc(iLoc);
-                const Real propScale = Sqrt(minAbs*maxAbs);
-                const Real scale = Max(propScale,sqrtDamp*maxAbs);
-                scalesLoc(iLoc) = scale;
-            }
-            else
-                scalesLoc(iLoc) = 1;
-        }
-        DiagonalScale( LEFT, NORMAL, scales, dRow );
-        DiagonalSolve( LEFT, NORMAL, scales, A );
-
-        // Determine whether we are done or not
-        // ------------------------------------
-        auto newMaxAbs = MaxAbsLoc( A );
-        const Real newMaxAbsVal = newMaxAbs.value;
-        const Real newMinAbsVal = MinAbsNonzero( A, newMaxAbsVal );
-        const Real newRatio = newMaxAbsVal / newMinAbsVal;
-        if( progress && commRank == 0 )
-            Output("New ratio is ",newMaxAbsVal,"/",newMinAbsVal,"=",newRatio);
-        if( iter >= minIter && newRatio >= ratio*relTol )
-            break;
-        ratio = newRatio;
-    }
-    SetIndent( indent );
-
-    // Scale each row so that its maximum entry is 1 or 0
-    Field* valBuf = A.ValueBuffer();
-    const Int localHeight = A.LocalHeight();
-    auto& dRowLoc = dRow.Matrix();
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-    {
-        const Int offset = A.RowOffset(iLoc);
-        const Int numConnect = A.NumConnections(iLoc);
-
-        // Compute the maximum value in this row
-        Real maxRowAbs = 0;
-        for( Int e=offset; e<offset+numConnect; ++e )
-            maxRowAbs = Max(maxRowAbs,Abs(A.Value(e)));
-
-        if( maxRowAbs > Real(0) )
-        {
-            dRowLoc(iLoc) *= maxRowAbs;
-            for( Int e=offset; e<offset+numConnect; ++e )
-                valBuf[e] /= maxRowAbs;
-        }
-    }
+    equil::FusedSweepCtrl ctrl;
+    ctrl.geometric = true;
+    ctrl.minIter = 3;
+    ctrl.maxIter = 6;
+    ctrl.progress = progress;
+    vector<equil::CSRBlock<Field>> blocks(1);
+    blocks[0] = equil::MakeCSRBlock( A, dRow );
+    equil::FusedSweeps
+    ( blocks, n, dCol.Matrix().Buffer(), dCol.FirstLocalRow(),
+      dCol.LocalHeight(), grid.Comm(), ctrl );
+    equil::NormalizeRows( blocks );
 }
 
 template<typename Field>
@@ -877,12 +566,10 @@ void StackedGeomEquil
   bool progress )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int mA = A.Height();
     const Int mB = B.Height();
     const Int n = A.Width();
     const Grid& grid = A.Grid();
-    const int commRank = grid.Rank();
     dRowA.SetGrid( grid );
     dRowB.SetGrid( grid );
     dCol.SetGrid( grid );
@@ -891,166 +578,18 @@ void StackedGeomEquil
     Ones( dCol, n, 1 );
 
     // TODO(poulson): Expose these as control parameters
-    const Int minIter = 3;
-    const Int maxIter = 6;
-    const Real damp = Real(1)/Real(1000);
-    const Real relTol = Real(9)/Real(10);
-
-    // Compute the original ratio of the maximum to minimum nonzero
-    auto maxAbsA = MaxAbsLoc( A );
-    auto maxAbsB = MaxAbsLoc( B );
-    const Real maxAbsVal = Max(maxAbsA.value,maxAbsB.value);
-    if( maxAbsVal == Real(0) )
-        return;
-    const Real minAbsValA = MinAbsNonzero( A, maxAbsVal );
-    const Real minAbsValB = MinAbsNonzero( B, maxAbsVal );
-    const Real minAbsVal = Min(minAbsValA,minAbsValB);
-    Real ratio = maxAbsVal / minAbsVal;
-    if( progress && commRank == 0 )
-        Output("Original ratio is ",maxAbsVal,"/",minAbsVal,"=",ratio);
-
-    const Real sqrtDamp = Sqrt(damp);
-    DistMultiVec<Real> maxAbsValsA(grid), maxAbsValsB(grid),
-                       minAbsValsA(grid), minAbsValsB(grid), scales(grid);
-    auto& maxAbsValsALoc = maxAbsValsA.Matrix();
-    auto& maxAbsValsBLoc = maxAbsValsB.Matrix();
-    auto& minAbsValsALoc = minAbsValsA.Matrix();
-    auto& minAbsValsBLoc = minAbsValsB.Matrix();
-    auto& scalesLoc = scales.Matrix();
-    const Int indent = PushIndent();
-    for( Int iter=0; iter<maxIter; ++iter )
-    {
-        // Geometrically rescale the columns
-        // ---------------------------------
-        scales.Resize( n, 1 );
-        ColumnMaxNorms( A, maxAbsValsA );
-        ColumnMaxNorms( B, maxAbsValsB );
-        const Int localWidth = maxAbsValsA.LocalHeight();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-            maxAbsValsALoc(jLoc) =
-              Max(maxAbsValsALoc(jLoc),maxAbsValsBLoc(jLoc));
-        ColumnMinAbsNonzero( A, maxAbsValsA, minAbsValsA );
-        ColumnMinAbsNonzero( B, maxAbsValsA, minAbsValsB );
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-            minAbsValsALoc(jLoc) =
-              Min(minAbsValsALoc(jLoc),minAbsValsBLoc(jLoc));
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-        {
-            const Real maxAbs = maxAbsValsALoc(jLoc);
-            if( maxAbs > Real(0) )
-            {
-                const Real minAbs = minAbsValsALoc(jLoc);
-                const Real propScale = Sqrt(minAbs*maxAbs);
-                const Real scale = Max(propScale,sqrtDamp*maxAbs);
-                scalesLoc(jLoc) = scale;
-            }
-            else
-                scalesLoc(jLoc) = 1;
-        }
-        DiagonalScale( LEFT, NORMAL, scales, dCol );
-        DiagonalSolve( RIGHT, NORMAL, scales, A );
-        DiagonalSolve( RIGHT, NORMAL, scales, B );
-
-        // Geometrically rescale the rows
-        // ------------------------------
-        scales.Resize( mA, 1 );
-        RowMaxNorms( A, maxAbsValsA );
-        ColumnMinAbsNonzero( A, maxAbsValsA, minAbsValsA );
-        const Int localHeightA = maxAbsValsA.LocalHeight();
-        for( Int iLoc=0; iLoc<localHeightA; ++iLoc )
-        {
-            const Real maxAbs = maxAbsValsALoc(iLoc);
-            if( maxAbs > Real(0) )
-            {
-                const Real minAbs = minAbsValsALoc(iLoc);
-                const Real propScale = Sqrt(minAbs*maxAbs);
-                const Real scale = Max(propScale,sqrtDamp*maxAbs);
-                scalesLoc(iLoc) = scale;
-            }
-            else
-                scalesLoc(iLoc) = 1;
-        }
-        DiagonalScale( LEFT, NORMAL, scales, dRowA );
-        DiagonalSolve( LEFT, NORMAL, scales, A );
-
-        scales.Resize( mB, 1 );
-        RowMaxNorms( B, maxAbsValsB );
-        ColumnMinAbsNonzero( B, maxAbsValsB, minAbsValsB );
-        const Int localHeightB = maxAbsValsB.LocalHeight();
-        for( Int iLoc=0; iLoc<localHeightB; ++iLoc )
-        {
-            const Real maxAbs = maxAbsValsBLoc(iLoc);
-            if( maxAbs > Real(0) )
-            {
-                const Real minAbs = minAbsValsBLoc(iLoc);
-                const Real propScale = Sqrt(minAbs*maxAbs);
-                const Real scale = Max(propScale,sqrtDamp*maxAbs);
-                scalesLoc(iLoc) = scale;
-            }
-            else
-                scalesLoc(iLoc) = 1;
-        }
-        DiagonalScale( LEFT, NORMAL, scales, dRowB );
-        DiagonalSolve( LEFT, NORMAL, scales, B );
-
-        // Determine whether we are done or not
-        // ------------------------------------
-        auto newMaxAbsA = MaxAbsLoc( A );
-        auto newMaxAbsB = MaxAbsLoc( B );
-        const Real newMaxAbsVal = Max(newMaxAbsA.value,newMaxAbsB.value);
-        const Real newMinAbsValA = MinAbsNonzero( A, newMaxAbsVal );
-        const Real newMinAbsValB = MinAbsNonzero( B, newMaxAbsVal );
-        const Real newMinAbsVal = Min(newMinAbsValA,newMinAbsValB);
-        const Real newRatio = newMaxAbsVal / newMinAbsVal;
-        if( progress && commRank == 0 )
-            Output("New ratio is ",newMaxAbsVal,"/",newMinAbsVal,"=",newRatio);
-        if( iter >= minIter && newRatio >= ratio*relTol )
-            break;
-        ratio = newRatio;
-    }
-    SetIndent( indent );
-
-    // Scale each row so that its maximum entry is 1 or 0
-    Field* valBufA = A.ValueBuffer();
-    const Int localHeightA = A.LocalHeight();
-    auto& dRowALoc = dRowA.Matrix();
-    for( Int iLoc=0; iLoc<localHeightA; ++iLoc )
-    {
-        const Int offset = A.RowOffset(iLoc);
-        const Int numConnect = A.NumConnections(iLoc);
-
-        // Compute the maximum value in this row
-        Real maxRowAbs = 0;
-        for( Int e=offset; e<offset+numConnect; ++e )
-            maxRowAbs = Max(maxRowAbs,Abs(A.Value(e)));
-
-        if( maxRowAbs > Real(0) )
-        {
-            dRowALoc(iLoc) *= maxRowAbs;
-            for( Int e=offset; e<offset+numConnect; ++e )
-                valBufA[e] /= maxRowAbs;
-        }
-    }
-    Field* valBufB = B.ValueBuffer();
-    const Int localHeightB = B.LocalHeight();
-    auto& dRowBLoc = dRowB.Matrix();
-    for( Int iLoc=0; iLoc<localHeightB; ++iLoc )
-    {
-        const Int offset = B.RowOffset(iLoc);
-        const Int numConnect = B.NumConnections(iLoc);
-
-        // Compute the maximum value in this row
-        Real maxRowAbs = 0;
-        for( Int e=offset; e<offset+numConnect; ++e )
-            maxRowAbs = Max(maxRowAbs,Abs(B.Value(e)));
-
-        if( maxRowAbs > Real(0) )
-        {
-            dRowBLoc(iLoc) *= maxRowAbs;
-            for( Int e=offset; e<offset+numConnect; ++e )
-                valBufB[e] /= maxRowAbs;
-        }
-    }
+    equil::FusedSweepCtrl ctrl;
+    ctrl.geometric = true;
+    ctrl.minIter = 3;
+    ctrl.maxIter = 6;
+    ctrl.progress = progress;
+    vector<equil::CSRBlock<Field>> blocks(2);
+    blocks[0] = equil::MakeCSRBlock( A, dRowA );
+    blocks[1] = equil::MakeCSRBlock( B, dRowB );
+    equil::FusedSweeps
+    ( blocks, n, dCol.Matrix().Buffer(), dCol.FirstLocalRow(),
+      dCol.LocalHeight(), grid.Comm(), ctrl );
+    equil::NormalizeRows( blocks );
 }
 
 #define PROTO(Field) \
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./FusedSweeps.hpp"
 
 namespace El {
 
@@ -121,35 +122,18 @@ void RuizEquil
   bool progress )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int m = A.Height();
     const Int n = A.Width();
     Ones( dRow, m, 1 );
     Ones( dCol, n, 1 );
 
     // TODO(poulson): Expose these as control parameters
-    // For now, simply hard-code the number of iterations
-    const Int maxIter = 4;
-
-    Matrix<Real> scales;
-    const Int indent = PushIndent();
-    for( Int iter=0; iter<maxIter; ++iter )
-    {
-        // Rescale the columns
-        // -------------------
-        ColumnMaxNorms( A, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dCol );
-        DiagonalSolve( RIGHT, NORMAL, scales, A );
-
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dRow );
-        DiagonalSolve( LEFT, NORMAL, scales, A );
-    }
-    SetIndent( indent );
+    equil::FusedSweepCtrl ctrl;
+    ctrl.progress = progress;
+    vector<equil::CSRBlock<Field>> blocks(1);
+    blocks[0] = equil::MakeCSRBlock( A, dRow );
+    equil::FusedSweeps
+    ( blocks, n, dCol.Buffer(), 0, n, mpi::COMM_SELF, ctrl );
 }
 
 template<typename Field>
@@ -160,7 +144,6 @@ void RuizEquil
   bool progress )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int m = A.Height();
     const Int n = A.Width();
     const Grid& grid = A.Grid();
@@ -169,29 +152,14 @@ void RuizEquil
     Ones( dRow, m, 1 );
     Ones( dCol, n, 1 );
 
-    // TODO(poulson): Expose to control structure
-    // For, simply hard-code a small number of iterations
-    const Int maxIter = 4;
-
-    DistMultiVec<Real> scales(grid);
-    const Int indent = PushIndent();
-    for( Int iter=0; iter<maxIter; ++iter )
-    {
-        // Rescale the columns
-        // -------------------
-        ColumnMaxNorms( A, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dCol );
-        DiagonalSolve( RIGHT, NORMAL, scales, A );
-
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dRow );
-        DiagonalSolve( LEFT, NORMAL, scales, A );
-    }
-    SetIndent( indent );
+    // TODO(poulson): Expose these as control parameters
+    equil::FusedSweepCtrl ctrl;
+    ctrl.progress = progress;
+    vector<equil::CSRBlock<Field>> blocks(1);
+    blocks[0] = equil::MakeCSRBlock( A, dRow );
+    equil::FusedSweeps
+    ( blocks, n, dCol.Matrix().Buffer(), dCol.FirstLocalRow(),
+      dCol.LocalHeight(), grid.Comm(), ctrl );
 }
 
 template<typename Field>
@@ -331,7 +299,6 @@ void StackedRuizEquil
   bool progress )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int mA = A.Height();
     const Int mB = B.Height();
     const Int n = A.Width();
@@ -340,37 +307,13 @@ void StackedRuizEquil
     Ones( dCol, n, 1 );
 
     // TODO(poulson): Expose these as control parameters
-    // For now, simply hard-code the number of iterations
-    const Int maxIter = 4;
-
-    Matrix<Real> scales, maxAbsValsB;
-    const Int indent = PushIndent();
-    for( Int iter=0; iter<maxIter; ++iter )
-    {
-        // Rescale the columns
-        // -------------------
-        ColumnMaxNorms( A, scales );
-        ColumnMaxNorms( B, maxAbsValsB );
-        for( Int j=0; j<n; ++j )
-            scales(j) = Max(scales(j),maxAbsValsB(j));
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dCol );
-        DiagonalSolve( RIGHT, NORMAL, scales, A );
-        DiagonalSolve( RIGHT, NORMAL, scales, B );
-
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dRowA );
-        DiagonalSolve( LEFT, NORMAL, scales, A );
-
-        RowMaxNorms( B, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dRowB );
-        DiagonalSolve( LEFT, NORMAL, scales, B );
-    }
-    SetIndent( indent );
+    equil::FusedSweepCtrl ctrl;
+    ctrl.progress = progress;
+    vector<equil::CSRBlock<Field>> blocks(2);
+    blocks[0] = equil::MakeCSRBlock( A, dRowA );
+    blocks[1] = equil::MakeCSRBlock( B, dRowB );
+    equil::FusedSweeps
+    ( blocks, n, dCol.Buffer(), 0, n, mpi::COMM_SELF, ctrl );
 }
 
 template<typename Field>
@@ -383,7 +326,6 @@ void StackedRuizEquil
   bool progress )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
     const Int mA = A.Height();
     const Int mB = B.Height();
     const Int n = A.Width();
@@ -395,41 +337,15 @@ void StackedRuizEquil
     Ones( dRowB, mB, 1 );
     Ones( dCol, n, 1 );
 
-    // TODO(poulson): Expose to control structure
-    // For, simply hard-code a small number of iterations
-    const Int maxIter = 4;
-
-    DistMultiVec<Real> scales(grid), maxAbsValsB(grid);
-    auto& scalesLoc = scales.Matrix();
-    auto& maxAbsValsBLoc = maxAbsValsB.Matrix();
-    const Int localHeight = scalesLoc.Height();
-    const Int indent = PushIndent();
-    for( Int iter=0; iter<maxIter; ++iter )
-    {
-        // Rescale the columns
-        // -------------------
-        ColumnMaxNorms( A, scales );
-        ColumnMaxNorms( B, maxAbsValsB );
-        for( Int jLoc=0; jLoc<localHeight; ++jLoc )
-            scalesLoc(jLoc) = Max(scalesLoc(jLoc),maxAbsValsBLoc(jLoc));
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dCol );
-        DiagonalSolve( RIGHT, NORMAL, scales, A );
-        DiagonalSolve( RIGHT, NORMAL, scales, B );
-
-        // Rescale the rows
-        // ----------------
-        RowMaxNorms( A, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dRowA );
-        DiagonalSolve( LEFT, NORMAL, scales, A );
-
-        RowMaxNorms( B, scales );
-        EntrywiseMap( scales, MakeFunction(DampScaling<Real>) );
-        DiagonalScale( LEFT, NORMAL, scales, dRowB );
-        DiagonalSolve( LEFT, NORMAL, scales, B );
-    }
-    SetIndent( indent );
+    // TODO(poulson): Expose these as control parameters
+    equil::FusedSweepCtrl ctrl;
+    ctrl.progress = progress;
+    vector<equil::CSRBlock<Field>> blocks(2);
+    blocks[0] = equil::MakeCSRBlock( A, dRowA );
+    blocks[1] = equil::MakeCSRBlock( B, dRowB );
+    equil::FusedSweeps
+    ( blocks, n, dCol.Matrix().Buffer(), dCol.FirstLocalRow(),
+      dCol.LocalHeight(), grid.Comm(), ctrl );
 }
 
 #define PROTO(Field) \
@@ -55,6 +55,11 @@ ElError ElLeastSquaresCtrlDefault_s( ElLeastSquaresCtrl_s* ctrl )
     ctrl->equilibrate = false;
     ctrl->progress = false;
     ctrl->time = false;
+    ctrl->alg = EL_LS_DIRECT;
+    ctrl->sketchRatio = 4.;
+    ctrl->sketchSparsity = 4;
+    ctrl->lsqrTol = Pow(eps,float(0.9));
+    ctrl->maxLSQRIts = 500;
     return EL_SUCCESS;
 }
 
@@ -68,6 +73,11 @@ ElError ElLeastSquaresCtrlDefault_d( ElLeastSquaresCtrl_d* ctrl )
     ctrl->equilibrate = false;
     ctrl->progress = false;
     ctrl->time = false;
+    ctrl->alg = EL_LS_DIRECT;
+    ctrl->sketchRatio = 4.;
+    ctrl->sketchSparsity = 4;
+    ctrl->lsqrTol = Pow(eps,double(0.9));
+    ctrl->maxLSQRIts = 500;
     return EL_SUCCESS;
 }
 
@@ -8,6 +8,9 @@
 */
 #include <El.hpp>
 
+#include "./LeastSquares/Sketch.hpp"
+#include "./LeastSquares/MultifrontalQR.hpp"
+
 namespace El {
 
 namespace ls {
@@ -93,6 +96,52 @@ void LeastSquares
     ls::Overwrite( orientation, ACopy, B, X );
 }
 
+template<typename F>
+void LeastSquares
+( Orientation orientation,
+  const Matrix<F>& A,
+  const Matrix<F>& B,
+        Matrix<F>& X,
+  const LeastSquaresCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<F> ABar;
+    if( orientation == NORMAL )
+        ABar = A;
+    else if( orientation == TRANSPOSE )
+        Transpose( A, ABar );
+    else
+        Adjoint( A, ABar );
+    if( ctrl.alg == LS_SKETCH_AND_PRECONDITION &&
+        ABar.Height() >= ABar.Width() )
+        ls::SketchAndPrecondition( ABar, B, X, ctrl );
+    else
+        ls::Overwrite( NORMAL, ABar, B, X );
+}
+
+template<typename F>
+void LeastSquares
+( Orientation orientation,
+  const AbstractDistMatrix<F>& A,
+  const AbstractDistMatrix<F>& B,
+        AbstractDistMatrix<F>& X,
+  const LeastSquaresCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F> ABar( A.Grid() );
+    if( orientation == NORMAL )
+        ABar = A;
+    else if( orientation == TRANSPOSE )
+        Transpose( A, ABar );
+    else
+        Adjoint( A, ABar );
+    if( ctrl.alg == LS_SKETCH_AND_PRECONDITION &&
+        ABar.Height() >= ABar.Width() )
+        ls::SketchAndPrecondition( ABar, B, X, ctrl );
+    else
+        ls::Overwrite( NORMAL, ABar, B, X );
+}
+
 // The following routines solve either
 //
 //   Minimum length:
@@ -256,9 +305,19 @@ void LeastSquares
         Transpose( A, ABar );
     else
         Adjoint( A, ABar );
-    auto BBar = B;
     const Int m = ABar.Height();
     const Int n = ABar.Width();
+    if( ctrl.alg == LS_SKETCH_AND_PRECONDITION && m >= n )
+    {
+        ls::SketchAndPrecondition( ABar, B, X, ctrl );
+        return;
+    }
+    if( ctrl.alg == LS_MULTIFRONTAL_QR )
+    {
+        ls::MultifrontalQR( ABar, B, X, ctrl );
+        return;
+    }
+    auto BBar = B;
 
     // Equilibrate the matrix
     // ======================
@@ -434,9 +493,19 @@ void LeastSquares
         Transpose( A, ABar );
     else
         Adjoint( A, ABar );
-    auto BBar = B;
     const Int m = ABar.Height();
     const Int n = ABar.Width();
+    if( ctrl.alg == LS_SKETCH_AND_PRECONDITION && m >= n )
+    {
+        ls::SketchAndPrecondition( ABar, B, X, ctrl );
+        return;
+    }
+    if( ctrl.alg == LS_MULTIFRONTAL_QR )
+    {
+        ls::MultifrontalQR( ABar, B, X, ctrl );
+        return;
+    }
+    auto BBar = B;
 
     // Equilibrate the matrix
     // ======================
@@ -510,6 +579,18 @@ void LeastSquares
     const AbstractDistMatrix<F>& B, \
           AbstractDistMatrix<F>& X ); \
   template void LeastSquares \
+  ( Orientation orientation, \
+    const Matrix<F>& A, \
+    const Matrix<F>& B, \
+          Matrix<F>& X, \
+    const LeastSquaresCtrl<Base<F>>& ctrl ); \
+  template void LeastSquares \
+  ( Orientation orientation, \
+    const AbstractDistMatrix<F>& A, \
+    const AbstractDistMatrix<F>& B, \
+          AbstractDistMatrix<F>& X, \
+    const LeastSquaresCtrl<Base<F>>& ctrl ); \
+  template void LeastSquares \
   ( Orientation orientation, \
     const SparseMatrix<F>& A, \
     const Matrix<F>& B, \
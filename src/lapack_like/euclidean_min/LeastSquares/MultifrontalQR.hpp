@@ -0,0 +1,377 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LEASTSQUARES_MULTIFRONTALQR_HPP
+#define EL_LEASTSQUARES_MULTIFRONTALQR_HPP
+
+// A Q-less multifrontal QR factorization of a sparse m x n matrix W, with
+// m >= n, in the spirit of
+//
+//   Timothy A. Davis,
+//   "Algorithm 915, SuiteSparseQR: Multifrontal multithreaded rank-revealing
+//   sparse QR factorization", ACM Trans. Math. Softw., 38(1), 8:1--8:22 (2011).
+//
+// Since the structure of R is contained within that of the Cholesky factor of
+// W^H W, the columns of W are reordered with the nested dissection used by the
+// sparse LDL factorization, applied to the graph of W^H W, and the resulting
+// elimination tree determines the fronts. Each row of W is assembled into the
+// front containing its first (reordered) column, the trailing rows of the
+// children of a front are stacked beneath them, and the front is then reduced
+// to upper-trapezoidal form with a dense Householder QR factorization.
+//
+// The Householder vectors are discarded, so that least squares problems are
+// solved via the corrected seminormal equations,
+//
+//   R^H R X = W^H B,   X := X + (R^H R)^{-1} W^H (B - W X),
+//
+// (see Ake Bjorck, "Stability analysis of the method of seminormal equations
+// for linear least squares problems", Linear Algebra Appl., 88/89, 31--48
+// (1987)), and minimum-length problems analogously, with W = A^H, via
+//
+//   R^H R Y = B,   X := W Y,   X := X + W (R^H R)^{-1} (B - A X).
+
+namespace El {
+namespace ls {
+namespace mfqr {
+
+template<typename Field>
+struct Factorization
+{
+    // The reordering of the columns of W and its elimination tree
+    vector<Int> map;
+    ldl::Separator sep;
+    ldl::NodeInfo info;
+
+    // The nodes of the elimination tree in postorder and the rows of R owned
+    // by each, over the node's columns followed by its lower structure
+    vector<const ldl::NodeInfo*> nodes;
+    vector<Matrix<Field>> fronts;
+};
+
+inline Int Postorder
+( const ldl::NodeInfo& node,
+  vector<const ldl::NodeInfo*>& nodes,
+  vector<vector<Int>>& childInds )
+{
+    vector<Int> inds;
+    for( const auto& child : node.children )
+        inds.push_back( Postorder( *child, nodes, childInds ) );
+    nodes.push_back( &node );
+    childInds.push_back( inds );
+    return nodes.size()-1;
+}
+
+template<typename Field>
+void Factor
+( const SparseMatrix<Field>& W,
+        Factorization<Field>& fact,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = W.Height();
+    const Int n = W.Width();
+
+    // Form the graph of W^H W, where the columns of each row form a clique
+    Graph graph( n );
+    Int numConnections = 0;
+    for( Int i=0; i<m; ++i )
+    {
+        const Int rowSize = W.RowOffset(i+1) - W.RowOffset(i);
+        numConnections += rowSize*(rowSize-1);
+    }
+    graph.Reserve( numConnections );
+    for( Int i=0; i<m; ++i )
+    {
+        const Int rowOff = W.RowOffset(i);
+        const Int rowEnd = W.RowOffset(i+1);
+        for( Int e=rowOff; e<rowEnd; ++e )
+            for( Int f=rowOff; f<rowEnd; ++f )
+                if( e != f )
+                    graph.QueueConnection( W.Col(e), W.Col(f) );
+    }
+    graph.ProcessQueues();
+    ldl::NestedDissection( graph, fact.map, fact.sep, fact.info, ctrl );
+    graph.Empty();
+
+    vector<vector<Int>> childInds;
+    fact.nodes.clear();
+    Postorder( fact.info, fact.nodes, childInds );
+    const Int numNodes = fact.nodes.size();
+
+    // Assign each row to the node containing its first reordered column
+    vector<Int> nodeOfInd( n );
+    for( Int t=0; t<numNodes; ++t )
+    {
+        const auto& node = *fact.nodes[t];
+        for( Int i=node.off; i<node.off+node.size; ++i )
+            nodeOfInd[i] = t;
+    }
+    vector<vector<Int>> nodeRows( numNodes );
+    for( Int i=0; i<m; ++i )
+    {
+        const Int rowOff = W.RowOffset(i);
+        const Int rowEnd = W.RowOffset(i+1);
+        if( rowOff == rowEnd )
+            continue;
+        Int first = n;
+        for( Int e=rowOff; e<rowEnd; ++e )
+            first = Min( first, fact.map[W.Col(e)] );
+        nodeRows[nodeOfInd[first]].push_back( i );
+    }
+
+    fact.fronts.resize( numNodes );
+    vector<Matrix<Field>> updates( numNodes );
+    for( Int t=0; t<numNodes; ++t )
+    {
+        const auto& node = *fact.nodes[t];
+        const auto& lowerStruct = node.lowerStruct;
+        const Int width = node.size + lowerStruct.size();
+        Int height = nodeRows[t].size();
+        for( const Int c : childInds[t] )
+            height += updates[c].Height();
+        if( height < node.size )
+            RuntimeError("The sparse matrix was structurally rank-deficient");
+
+        // Assemble the original rows followed by the updates of the children
+        Matrix<Field> F;
+        Zeros( F, height, width );
+        Int row = 0;
+        for( const Int i : nodeRows[t] )
+        {
+            const Int rowEnd = W.RowOffset(i+1);
+            for( Int e=W.RowOffset(i); e<rowEnd; ++e )
+            {
+                const Int j = fact.map[W.Col(e)];
+                const Int jRel =
+                  ( j < node.off+node.size ? j-node.off :
+                    node.size +
+                    Int(std::lower_bound
+                        (lowerStruct.begin(),lowerStruct.end(),j) -
+                        lowerStruct.begin()) );
+                F(row,jRel) = W.Value(e);
+            }
+            ++row;
+        }
+        const Int numChildren = childInds[t].size();
+        for( Int c=0; c<numChildren; ++c )
+        {
+            auto& U = updates[childInds[t][c]];
+            const auto& relInds = node.childRelInds[c];
+            for( Int jU=0; jU<U.Width(); ++jU )
+                for( Int iU=0; iU<U.Height(); ++iU )
+                    F(row+iU,relInds[jU]) = U(iU,jU);
+            row += U.Height();
+            U.Empty();
+        }
+
+        qr::ExplicitTriang( F );
+        for( Int j=0; j<node.size; ++j )
+            if( F(j,j) == Field(0) )
+                RuntimeError("The sparse matrix was exactly rank-deficient");
+        fact.fronts[t] = F( IR(0,node.size), ALL );
+        updates[t] = F( IR(node.size,F.Height()), IR(node.size,width) );
+    }
+}
+
+// Overwrite Y := (R^H R)^{-1} Y, where Y is indexed by the reordered columns
+template<typename Field>
+void SolveAfter( const Factorization<Field>& fact, Matrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    const Int numNodes = fact.nodes.size();
+    const Int numRHS = Y.Width();
+    Matrix<Field> YLower;
+
+    // Solve against R^H
+    for( Int t=0; t<numNodes; ++t )
+    {
+        const auto& node = *fact.nodes[t];
+        const auto& R = fact.fronts[t];
+        const Int lowerSize = node.lowerStruct.size();
+        auto RL = LockedView( R, IR(0,node.size), IR(0,node.size) );
+        auto RR = LockedView( R, IR(0,node.size), IR(node.size,R.Width()) );
+        auto YNode = Y( IR(node.off,node.off+node.size), ALL );
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, Field(1), RL, YNode );
+        if( lowerSize == 0 )
+            continue;
+        Zeros( YLower, lowerSize, numRHS );
+        Gemm( ADJOINT, NORMAL, Field(1), RR, YNode, Field(0), YLower );
+        for( Int k=0; k<numRHS; ++k )
+            for( Int i=0; i<lowerSize; ++i )
+                Y(node.lowerStruct[i],k) -= YLower(i,k);
+    }
+
+    // Solve against R
+    for( Int t=numNodes-1; t>=0; --t )
+    {
+        const auto& node = *fact.nodes[t];
+        const auto& R = fact.fronts[t];
+        const Int lowerSize = node.lowerStruct.size();
+        auto RL = LockedView( R, IR(0,node.size), IR(0,node.size) );
+        auto RR = LockedView( R, IR(0,node.size), IR(node.size,R.Width()) );
+        auto YNode = Y( IR(node.off,node.off+node.size), ALL );
+        if( lowerSize > 0 )
+        {
+            YLower.Resize( lowerSize, numRHS );
+            for( Int k=0; k<numRHS; ++k )
+                for( Int i=0; i<lowerSize; ++i )
+                    YLower(i,k) = Y(node.lowerStruct[i],k);
+            Gemm( NORMAL, NORMAL, Field(-1), RR, YLower, Field(1), YNode );
+        }
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), RL, YNode );
+    }
+}
+
+// Overwrite Z := (W^H W)^{-1} Z in the original ordering
+template<typename Field>
+void SeminormalSolve( const Factorization<Field>& fact, Matrix<Field>& Z )
+{
+    EL_DEBUG_CSE
+    const Int n = Z.Height();
+    const Int numRHS = Z.Width();
+    Matrix<Field> Y( n, numRHS );
+    for( Int k=0; k<numRHS; ++k )
+        for( Int j=0; j<n; ++j )
+            Y(fact.map[j],k) = Z(j,k);
+    SolveAfter( fact, Y );
+    for( Int k=0; k<numRHS; ++k )
+        for( Int j=0; j<n; ++j )
+            Z(j,k) = Y(fact.map[j],k);
+}
+
+} // namespace mfqr
+
+template<typename Field>
+void MultifrontalQR
+( const SparseMatrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const LeastSquaresCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numRHS = B.Width();
+    Zeros( X, n, numRHS );
+    if( Min(m,n) == 0 )
+        return;
+
+    Timer timer;
+    if( ctrl.time )
+        timer.Start();
+    mfqr::Factorization<Field> fact;
+    if( m >= n )
+    {
+        mfqr::Factor( A, fact, ctrl.qrBisectCtrl );
+    }
+    else
+    {
+        SparseMatrix<Field> AAdj;
+        Adjoint( A, AAdj );
+        mfqr::Factor( AAdj, fact, ctrl.qrBisectCtrl );
+    }
+    if( ctrl.time )
+        Output("Multifrontal QR: ",timer.Stop()," secs");
+
+    if( ctrl.time )
+        timer.Start();
+    Matrix<Field> R( B );
+    if( m >= n )
+    {
+        Matrix<Field> D;
+        Multiply( ADJOINT, Field(1), A, B, Field(0), X );
+        mfqr::SeminormalSolve( fact, X );
+
+        // A single step of refinement
+        Multiply( NORMAL, Field(-1), A, X, Field(1), R );
+        Zeros( D, n, numRHS );
+        Multiply( ADJOINT, Field(1), A, R, Field(0), D );
+        mfqr::SeminormalSolve( fact, D );
+        X += D;
+    }
+    else
+    {
+        Matrix<Field> Y( B );
+        mfqr::SeminormalSolve( fact, Y );
+        Multiply( ADJOINT, Field(1), A, Y, Field(0), X );
+
+        // A single step of refinement
+        Multiply( NORMAL, Field(-1), A, X, Field(1), R );
+        mfqr::SeminormalSolve( fact, R );
+        Multiply( ADJOINT, Field(1), A, R, Field(1), X );
+    }
+    if( ctrl.time )
+        Output("Seminormal solves: ",timer.Stop()," secs");
+}
+
+// The nonzeros of A and the right-hand sides are gathered onto the root
+// process, which factors and solves sequentially before the solution is
+// redistributed.
+template<typename Field>
+void MultifrontalQR
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  const LeastSquaresCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numRHS = B.Width();
+    const int root = 0;
+    const bool onRoot = ( g.Rank() == root );
+
+    Matrix<Field> BRep, XRep;
+    Zeros( BRep, m, numRHS );
+    const auto& BLoc = B.LockedMatrix();
+    for( Int iLoc=0; iLoc<B.LocalHeight(); ++iLoc )
+    {
+        const Int i = B.GlobalRow(iLoc);
+        for( Int k=0; k<numRHS; ++k )
+            BRep(i,k) = BLoc(iLoc,k);
+    }
+    if( m*numRHS > 0 )
+        mpi::Reduce( BRep.Buffer(), m*numRHS, mpi::SUM, root, g.Comm() );
+
+    // Ensure that every process raises an exception if the root fails
+    int failed = 0;
+    Zeros( XRep, n, numRHS );
+    if( onRoot )
+    {
+        SparseMatrix<Field> ASeq;
+        CopyFromRoot( A, ASeq );
+        try { MultifrontalQR( ASeq, BRep, XRep, ctrl ); }
+        catch( const std::exception& e )
+        {
+            failed = 1;
+            ReportException( e );
+        }
+    }
+    else
+        CopyFromNonRoot( A, root );
+    mpi::Broadcast( failed, root, g.Comm() );
+    if( failed )
+        RuntimeError("The multifrontal QR least squares solve failed");
+    Broadcast( XRep, g.Comm(), root );
+
+    X.SetGrid( g );
+    Zeros( X, n, numRHS );
+    auto& XLoc = X.Matrix();
+    for( Int iLoc=0; iLoc<X.LocalHeight(); ++iLoc )
+    {
+        const Int i = X.GlobalRow(iLoc);
+        for( Int k=0; k<numRHS; ++k )
+            XLoc(iLoc,k) = XRep(i,k);
+    }
+}
+
+} // namespace ls
+} // namespace El
+
+#endif // ifndef EL_LEASTSQUARES_MULTIFRONTALQR_HPP
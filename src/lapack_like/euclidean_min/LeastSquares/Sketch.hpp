@@ -0,0 +1,556 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LEASTSQUARES_SKETCH_HPP
+#define EL_LEASTSQUARES_SKETCH_HPP
+
+// Sketch-and-precondition for overdetermined least squares problems, in the
+// spirit of
+//
+//   Haim Avron, Petar Maymounkov, and Sivan Toledo,
+//   "Blendenpik: Supercharging LAPACK's least-squares solver",
+//   SIAM J. Sci. Comput., 32(3), 1217--1236 (2010),
+//
+// and
+//
+//   Xiangrui Meng, Michael Saunders, and Michael Mahoney,
+//   "LSRN: A parallel iterative solver for strongly over- or
+//   underdetermined systems", SIAM J. Sci. Comput., 36(2), C95--C118 (2014).
+//
+// Given an s x m embedding S, with s a small multiple of n, the R from the QR
+// factorization of S A is such that A R^{-1} is well-conditioned, and LSQR
+// is applied to min_Y || A R^{-1} Y - B ||_F before setting X := R^{-1} Y.
+//
+// Rather than a subsampled randomized Hadamard transform, which would require
+// a (distributed) fast transform, S is a sparse sign embedding in which each
+// column has 'sketchSparsity' nonzero signs (see Nelson and Nguyen's OSNAP).
+// Their locations are computed from a hash of the global row index so that
+// no hashes need to be communicated.
+//
+// The n-vectors, as well as R, are stored redundantly on every process, while
+// the m-vectors are distributed like the rows of A.
+
+namespace El {
+namespace ls {
+namespace sketch {
+
+// SplitMix64 applied to the seed, the row index, and the nonzero index
+inline unsigned long long Hash( Int seed, Int i, Int k )
+{
+    unsigned long long z = static_cast<unsigned long long>(seed);
+    z += 0x9E3779B97F4A7C15ULL*(static_cast<unsigned long long>(i)+1);
+    z += 0xD1B54A32D192ED03ULL*(static_cast<unsigned long long>(k)+1);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+inline Int DrawSeed( mpi::Comm comm )
+{
+    Int seed = 0;
+    if( mpi::Rank(comm) == 0 )
+        seed = SampleUniform<Int>( 0, Int(1) << 30 );
+    mpi::Broadcast( seed, 0, comm );
+    return seed;
+}
+
+// Add the 'sparsity' signed copies of the given row of A into the rows of SA
+template<typename Field>
+void AddRow
+( Int seed,
+  Int i,
+  Int sparsity,
+  const Field* rowBuf,
+  Int rowStride,
+  Int width,
+  const Int* cols,
+        Matrix<Field>& SA )
+{
+    const Int s = SA.Height();
+    for( Int k=0; k<sparsity; ++k )
+    {
+        const unsigned long long h = Hash( seed, i, k );
+        const Int bucket = Int( (h >> 1) % static_cast<unsigned long long>(s) );
+        const Field sign = ( h & 1ULL ? Field(1) : Field(-1) );
+        for( Int j=0; j<width; ++j )
+            SA(bucket,cols[j]) += sign*rowBuf[j*rowStride];
+    }
+}
+
+inline Int SketchHeight( Int m, Int n, double sketchRatio )
+{
+    const Int s = Int(Ceil(sketchRatio*n));
+    return Min( Max(s,n), m );
+}
+
+// Retrieve the (replicated) R from the QR factorization of SA and ensure that
+// it is nonsingular
+template<typename Field>
+void TriangularFactor( DistMatrix<Field>& SA, Matrix<Field>& R )
+{
+    EL_DEBUG_CSE
+    const Int n = SA.Width();
+    qr::ExplicitTriang( SA );
+    DistMatrix<Field,STAR,STAR> R_STAR_STAR( SA );
+    R = R_STAR_STAR.LockedMatrix();
+    for( Int j=0; j<n; ++j )
+        if( R(j,j) == Field(0) )
+            RuntimeError("The sketch of A was exactly rank-deficient");
+}
+
+template<typename Field>
+void TriangularFactor( Matrix<Field>& SA, Matrix<Field>& R )
+{
+    EL_DEBUG_CSE
+    const Int n = SA.Width();
+    qr::ExplicitTriang( SA );
+    R = SA;
+    for( Int j=0; j<n; ++j )
+        if( R(j,j) == Field(0) )
+            RuntimeError("The sketch of A was exactly rank-deficient");
+}
+
+template<typename Field>
+void ColumnNorms
+( const Matrix<Field>& U, mpi::Comm comm, vector<Base<Field>>& norms )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int height = U.Height();
+    const Int width = U.Width();
+    norms.resize( width );
+    for( Int j=0; j<width; ++j )
+    {
+        Real sumSq = 0;
+        for( Int i=0; i<height; ++i )
+        {
+            const Real alpha = Abs(U(i,j));
+            sumSq += alpha*alpha;
+        }
+        norms[j] = sumSq;
+    }
+    mpi::AllReduce( norms.data(), width, comm );
+    for( Int j=0; j<width; ++j )
+        norms[j] = Sqrt(norms[j]);
+}
+
+template<typename Field>
+void NormalizeColumns( Matrix<Field>& U, const vector<Base<Field>>& norms )
+{
+    const Int height = U.Height();
+    const Int width = U.Width();
+    for( Int j=0; j<width; ++j )
+        if( norms[j] > Base<Field>(0) )
+            for( Int i=0; i<height; ++i )
+                U(i,j) /= norms[j];
+}
+
+// Solve min_X || A X - B ||_F given the routines
+//
+//   applyA( V, ULoc ):     ULoc := (A V)_loc,
+//   applyAAdj( ULoc, V ):  V := A^H U,
+//
+// where V and the result X are replicated and ULoc and BLoc are the local
+// portions of m-vectors whose norms are combined over 'comm'.
+template<typename Field,class ApplyFunc,class ApplyAdjFunc>
+Int PreconditionedLSQR
+( ApplyFunc applyA,
+  ApplyAdjFunc applyAAdj,
+  const Matrix<Field>& R,
+  const Matrix<Field>& BLoc,
+        Matrix<Field>& X,
+  mpi::Comm comm,
+  const LeastSquaresCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = R.Height();
+    const Int numRHS = BLoc.Width();
+    const Real tol = ctrl.lsqrTol;
+    const bool root = ( mpi::Rank(comm) == 0 );
+
+    auto applyAHat = [&]( const Matrix<Field>& V, Matrix<Field>& ULoc )
+    {
+        Matrix<Field> W( V );
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), R, W );
+        applyA( W, ULoc );
+    };
+    auto applyAHatAdj = [&]( const Matrix<Field>& ULoc, Matrix<Field>& V )
+    {
+        applyAAdj( ULoc, V );
+        Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, Field(1), R, V );
+    };
+
+    // Initialize the Golub-Kahan bidiagonalization
+    Matrix<Field> ULoc( BLoc ), V, W, Y, AV, AU;
+    vector<Real> alpha, beta, bNorm;
+    ColumnNorms( ULoc, comm, beta );
+    NormalizeColumns( ULoc, beta );
+    applyAHatAdj( ULoc, V );
+    ColumnNorms( V, mpi::COMM_SELF, alpha );
+    NormalizeColumns( V, alpha );
+    W = V;
+    Zeros( Y, n, numRHS );
+    bNorm = beta;
+
+    vector<Real> phiBar( beta ), rhoBar( alpha ), normAHatSq( numRHS, 0 );
+    vector<bool> active( numRHS );
+    Int numActive = 0;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        active[j] = ( beta[j] > Real(0) && alpha[j] > Real(0) );
+        if( active[j] )
+            ++numActive;
+    }
+
+    Int numIts = 0;
+    while( numActive > 0 && numIts < ctrl.maxLSQRIts )
+    {
+        // U := A R^{-1} V - U diag(alpha)
+        applyAHat( V, AV );
+        const Int localHeight = ULoc.Height();
+        for( Int j=0; j<numRHS; ++j )
+            if( active[j] )
+                for( Int i=0; i<localHeight; ++i )
+                    ULoc(i,j) = AV(i,j) - alpha[j]*ULoc(i,j);
+        ColumnNorms( ULoc, comm, beta );
+        NormalizeColumns( ULoc, beta );
+
+        // V := (A R^{-1})^H U - V diag(beta)
+        applyAHatAdj( ULoc, AU );
+        for( Int j=0; j<numRHS; ++j )
+        {
+            if( !active[j] )
+                continue;
+            normAHatSq[j] += alpha[j]*alpha[j] + beta[j]*beta[j];
+            for( Int i=0; i<n; ++i )
+                V(i,j) = AU(i,j) - beta[j]*V(i,j);
+        }
+        ColumnNorms( V, mpi::COMM_SELF, alpha );
+        NormalizeColumns( V, alpha );
+
+        // Apply the next plane rotation and update the (preconditioned)
+        // solution and search direction
+        for( Int j=0; j<numRHS; ++j )
+        {
+            if( !active[j] )
+                continue;
+            const Real rho = SafeNorm( rhoBar[j], beta[j] );
+            const Real c = rhoBar[j] / rho;
+            const Real sn = beta[j] / rho;
+            const Real theta = sn*alpha[j];
+            rhoBar[j] = -c*alpha[j];
+            const Real phi = c*phiBar[j];
+            phiBar[j] = sn*phiBar[j];
+            for( Int i=0; i<n; ++i )
+            {
+                Y(i,j) += (phi/rho)*W(i,j);
+                W(i,j) = V(i,j) - (theta/rho)*W(i,j);
+            }
+
+            // || (A R^{-1})^H r ||_2 = phiBar alpha |c| and || r ||_2 = phiBar
+            const Real adjResidNorm = phiBar[j]*alpha[j]*Abs(c);
+            const Real normAHat = Sqrt(normAHatSq[j]);
+            if( phiBar[j] <= tol*bNorm[j] ||
+                adjResidNorm <= tol*normAHat*phiBar[j] ||
+                alpha[j] == Real(0) )
+            {
+                active[j] = false;
+                --numActive;
+            }
+        }
+        ++numIts;
+        if( ctrl.progress && root )
+            Output
+            ("LSQR iteration ",numIts,": ",numActive," unconverged columns");
+    }
+    if( numActive > 0 && root )
+        Output
+        ("WARNING: LSQR did not converge for ",numActive," columns within ",
+         ctrl.maxLSQRIts," iterations");
+
+    X = Y;
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), R, X );
+    return numIts;
+}
+
+} // namespace sketch
+
+template<typename Field>
+void SketchAndPrecondition
+( const Matrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const LeastSquaresCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int sketchHeight = sketch::SketchHeight( m, n, ctrl.sketchRatio );
+    const Int seed = sketch::DrawSeed( mpi::COMM_SELF );
+
+    Timer timer;
+    if( ctrl.time )
+        timer.Start();
+    vector<Int> cols( n );
+    for( Int j=0; j<n; ++j )
+        cols[j] = j;
+    Matrix<Field> SA, R;
+    Zeros( SA, sketchHeight, n );
+    for( Int i=0; i<m; ++i )
+        sketch::AddRow
+        ( seed, i, ctrl.sketchSparsity, A.LockedBuffer(i,0), A.LDim(), n,
+          cols.data(), SA );
+    sketch::TriangularFactor( SA, R );
+    if( ctrl.time )
+        Output("Sketch and QR: ",timer.Stop()," secs");
+
+    auto applyA = [&]( const Matrix<Field>& V, Matrix<Field>& U )
+    { Gemm( NORMAL, NORMAL, Field(1), A, V, U ); };
+    auto applyAAdj = [&]( const Matrix<Field>& U, Matrix<Field>& V )
+    { Gemm( ADJOINT, NORMAL, Field(1), A, U, V ); };
+    if( ctrl.time )
+        timer.Start();
+    const Int numIts =
+      sketch::PreconditionedLSQR
+      ( applyA, applyAAdj, R, B, X, mpi::COMM_SELF, ctrl );
+    if( ctrl.time )
+        Output(numIts," iterations of LSQR: ",timer.Stop()," secs");
+}
+
+template<typename Field>
+void SketchAndPrecondition
+( const DistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+        AbstractDistMatrix<Field>& X,
+  const LeastSquaresCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numRHS = B.Width();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const auto& ALoc = A.LockedMatrix();
+    const Int sketchHeight = sketch::SketchHeight( m, n, ctrl.sketchRatio );
+    const Int seed = sketch::DrawSeed( g.Comm() );
+    const bool root = ( g.Rank() == 0 );
+
+    // Each process sketches its local rows before the contributions are
+    // summed within each process column
+    Timer timer;
+    if( ctrl.time && root )
+        timer.Start();
+    vector<Int> cols( localWidth );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        cols[jLoc] = jLoc;
+    DistMatrix<Field,STAR,MR> SA_STAR_MR(g);
+    SA_STAR_MR.AlignWith( A );
+    Zeros( SA_STAR_MR, sketchHeight, n );
+    auto& SALoc = SA_STAR_MR.Matrix();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        sketch::AddRow
+        ( seed, A.GlobalRow(iLoc), ctrl.sketchSparsity,
+          ALoc.LockedBuffer(iLoc,0), ALoc.LDim(), localWidth, cols.data(),
+          SALoc );
+    AllReduce( SALoc, A.ColComm() );
+    DistMatrix<Field> SA( SA_STAR_MR );
+    SA_STAR_MR.Empty();
+    Matrix<Field> R;
+    sketch::TriangularFactor( SA, R );
+    if( ctrl.time && root )
+        Output("Sketch and QR: ",timer.Stop()," secs");
+
+    auto applyA = [&]( const Matrix<Field>& V, Matrix<Field>& ULoc )
+    {
+        Matrix<Field> VLoc( localWidth, V.Width() );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            for( Int k=0; k<V.Width(); ++k )
+                VLoc(jLoc,k) = V(j,k);
+        }
+        Zeros( ULoc, localHeight, V.Width() );
+        Gemm( NORMAL, NORMAL, Field(1), ALoc, VLoc, Field(0), ULoc );
+        AllReduce( ULoc, A.RowComm() );
+    };
+    auto applyAAdj = [&]( const Matrix<Field>& ULoc, Matrix<Field>& V )
+    {
+        Matrix<Field> VLoc;
+        Zeros( VLoc, localWidth, ULoc.Width() );
+        Gemm( ADJOINT, NORMAL, Field(1), ALoc, ULoc, Field(0), VLoc );
+        Zeros( V, n, ULoc.Width() );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            for( Int k=0; k<ULoc.Width(); ++k )
+                V(j,k) = VLoc(jLoc,k);
+        }
+        AllReduce( V, g.Comm() );
+    };
+
+    // The right-hand sides are distributed like the rows of A
+    DistMatrix<Field,MC,STAR> B_MC_STAR(g);
+    B_MC_STAR.AlignWith( A );
+    B_MC_STAR = B;
+    DistMatrix<Field,STAR,STAR> X_STAR_STAR( n, numRHS, g );
+    if( ctrl.time && root )
+        timer.Start();
+    const Int numIts =
+      sketch::PreconditionedLSQR
+      ( applyA, applyAAdj, R, B_MC_STAR.LockedMatrix(), X_STAR_STAR.Matrix(),
+        A.ColComm(), ctrl );
+    if( ctrl.time && root )
+        Output(numIts," iterations of LSQR: ",timer.Stop()," secs");
+    Copy( X_STAR_STAR, X );
+}
+
+template<typename Field>
+void SketchAndPrecondition
+( const SparseMatrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Field>& X,
+  const LeastSquaresCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numEntries = A.NumEntries();
+    const Int sketchHeight = sketch::SketchHeight( m, n, ctrl.sketchRatio );
+    const Int seed = sketch::DrawSeed( mpi::COMM_SELF );
+
+    Timer timer;
+    if( ctrl.time )
+        timer.Start();
+    Matrix<Field> SA, R;
+    Zeros( SA, sketchHeight, n );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int col = A.Col(e);
+        const Field value = A.Value(e);
+        sketch::AddRow
+        ( seed, A.Row(e), ctrl.sketchSparsity, &value, 1, 1, &col, SA );
+    }
+    sketch::TriangularFactor( SA, R );
+    if( ctrl.time )
+        Output("Sketch and QR: ",timer.Stop()," secs");
+
+    auto applyA = [&]( const Matrix<Field>& V, Matrix<Field>& U )
+    {
+        Zeros( U, m, V.Width() );
+        Multiply( NORMAL, Field(1), A, V, Field(0), U );
+    };
+    auto applyAAdj = [&]( const Matrix<Field>& U, Matrix<Field>& V )
+    {
+        Zeros( V, n, U.Width() );
+        Multiply( ADJOINT, Field(1), A, U, Field(0), V );
+    };
+    if( ctrl.time )
+        timer.Start();
+    const Int numIts =
+      sketch::PreconditionedLSQR
+      ( applyA, applyAAdj, R, B, X, mpi::COMM_SELF, ctrl );
+    if( ctrl.time )
+        Output(numIts," iterations of LSQR: ",timer.Stop()," secs");
+}
+
+template<typename Field>
+void SketchAndPrecondition
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Field>& B,
+        DistMultiVec<Field>& X,
+  const LeastSquaresCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numRHS = B.Width();
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    const Int numLocalEntries = A.NumLocalEntries();
+    const Int sketchHeight = sketch::SketchHeight( m, n, ctrl.sketchRatio );
+    const Int seed = sketch::DrawSeed( g.Comm() );
+    const bool root = ( g.Rank() == 0 );
+
+    // Sum the sketches of the local rows and factor the result over the grid
+    Timer timer;
+    if( ctrl.time && root )
+        timer.Start();
+    Matrix<Field> SALoc, R;
+    Zeros( SALoc, sketchHeight, n );
+    for( Int e=0; e<numLocalEntries; ++e )
+    {
+        const Int col = A.Col(e);
+        const Field value = A.Value(e);
+        sketch::AddRow
+        ( seed, A.Row(e), ctrl.sketchSparsity, &value, 1, 1, &col, SALoc );
+    }
+    AllReduce( SALoc, g.Comm() );
+    DistMatrix<Field,STAR,STAR> SA_STAR_STAR(g);
+    SA_STAR_STAR.Resize( sketchHeight, n );
+    SA_STAR_STAR.Matrix() = SALoc;
+    SALoc.Empty();
+    DistMatrix<Field> SA( SA_STAR_STAR );
+    SA_STAR_STAR.Empty();
+    sketch::TriangularFactor( SA, R );
+    if( ctrl.time && root )
+        Output("Sketch and QR: ",timer.Stop()," secs");
+
+    auto applyA = [&]( const Matrix<Field>& V, Matrix<Field>& ULoc )
+    {
+        Zeros( ULoc, localHeight, V.Width() );
+        for( Int e=0; e<numLocalEntries; ++e )
+        {
+            const Int iLoc = A.Row(e) - firstLocalRow;
+            const Int j = A.Col(e);
+            const Field value = A.Value(e);
+            for( Int k=0; k<V.Width(); ++k )
+                ULoc(iLoc,k) += value*V(j,k);
+        }
+    };
+    auto applyAAdj = [&]( const Matrix<Field>& ULoc, Matrix<Field>& V )
+    {
+        Zeros( V, n, ULoc.Width() );
+        for( Int e=0; e<numLocalEntries; ++e )
+        {
+            const Int iLoc = A.Row(e) - firstLocalRow;
+            const Int j = A.Col(e);
+            const Field value = Conj(A.Value(e));
+            for( Int k=0; k<ULoc.Width(); ++k )
+                V(j,k) += value*ULoc(iLoc,k);
+        }
+        AllReduce( V, g.Comm() );
+    };
+
+    // The local rows of B are assumed to match those of A
+    Matrix<Field> XRep;
+    if( ctrl.time && root )
+        timer.Start();
+    const Int numIts =
+      sketch::PreconditionedLSQR
+      ( applyA, applyAAdj, R, B.LockedMatrix(), XRep, g.Comm(), ctrl );
+    if( ctrl.time && root )
+        Output(numIts," iterations of LSQR: ",timer.Stop()," secs");
+
+    X.SetGrid( g );
+    Zeros( X, n, numRHS );
+    auto& XLoc = X.Matrix();
+    for( Int iLoc=0; iLoc<X.LocalHeight(); ++iLoc )
+    {
+        const Int i = X.GlobalRow(iLoc);
+        for( Int k=0; k<numRHS; ++k )
+            XLoc(iLoc,k) = XRep(i,k);
+    }
+}
+
+} // namespace ls
+} // namespace El
+
+#endif // ifndef EL_LEASTSQUARES_SKETCH_HPP
@@ -0,0 +1,329 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Given the thin SVD op(A) = U Sigma V^H, the Ridge solution for the
+// regularization parameter gamma is
+//
+//   X(gamma) = V inv(Sigma^2 + gamma^2 I) Sigma (U^H B),
+//
+// and the residual decomposes into the component of B orthogonal to range(U)
+// and the components
+//
+//   (U^H (B - op(A) X(gamma)))_i = gamma^2 / (sigma_i^2 + gamma^2) (U^H B)_i,
+//
+// so that, after the SVD and the products U^H B and (I - U U^H) B have been
+// formed once, each parameter only requires O(k p) work to evaluate the
+// residual norms and the coefficients of its solution, where k = min(m,n)
+// and p is the number of right-hand sides. The solutions for all parameters
+// are then formed with a single matrix-matrix multiplication with V.
+
+namespace El {
+namespace ridge {
+
+// Form the thin SVD of op(A)
+template<typename Field>
+void OpSVD
+( Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V )
+{
+    EL_DEBUG_CSE
+    if( orientation == TRANSPOSE && IsComplex<Field>::value )
+        LogicError("Transpose version of complex Ridge not yet supported");
+    if( orientation == NORMAL )
+    {
+        SVDCtrl<Base<Field>> ctrl;
+        ctrl.overwrite = false;
+        SVD( A, U, s, V, ctrl );
+    }
+    else
+    {
+        Matrix<Field> AAdj;
+        Adjoint( A, AAdj );
+
+        SVDCtrl<Base<Field>> ctrl;
+        ctrl.overwrite = true;
+        SVD( AAdj, U, s, V, ctrl );
+    }
+}
+
+template<typename Field>
+void OpSVD
+( Orientation orientation,
+  const DistMatrix<Field>& A,
+        DistMatrix<Field>& U,
+        DistMatrix<Base<Field>,VR,STAR>& s,
+        DistMatrix<Field>& V )
+{
+    EL_DEBUG_CSE
+    if( orientation == TRANSPOSE && IsComplex<Field>::value )
+        LogicError("Transpose version of complex Ridge not yet supported");
+    if( orientation == NORMAL )
+    {
+        SVDCtrl<Base<Field>> ctrl;
+        ctrl.overwrite = false;
+        SVD( A, U, s, V, ctrl );
+    }
+    else
+    {
+        DistMatrix<Field> AAdj(A.Grid());
+        Adjoint( A, AAdj );
+
+        SVDCtrl<Base<Field>> ctrl;
+        ctrl.overwrite = true;
+        SVD( AAdj, U, s, V, ctrl );
+    }
+}
+
+// Given the singular values s, the coefficients C = U^H B, and the norms of
+// the columns of (I - U U^H) B, compute the residual norms for each of the
+// parameters and, if requested, the coefficients D = [D_0, D_1, ...] such
+// that X = V D.
+template<typename Field>
+void PathCoefficients
+( const Matrix<Base<Field>>& s,
+  const Matrix<Field>& C,
+  const Matrix<Base<Field>>& perpNorms,
+  const Matrix<Base<Field>>& gammas,
+        Matrix<Base<Field>>& residNorms,
+        Matrix<Field>* D=nullptr )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int k = C.Height();
+    const Int numRHS = C.Width();
+    const Int numGammas = gammas.Height();
+    residNorms.Resize( numRHS, numGammas );
+    if( D != nullptr )
+        D->Resize( k, numRHS*numGammas );
+
+    for( Int l=0; l<numGammas; ++l )
+    {
+        const Real gamma = gammas(l);
+        const Real gammaSquared = gamma*gamma;
+        for( Int j=0; j<numRHS; ++j )
+        {
+            Real residNorm = perpNorms(j);
+            for( Int i=0; i<k; ++i )
+            {
+                const Real sigma = s(i);
+                const Real denom = sigma*sigma + gammaSquared;
+                // The pseudoinverse is used when sigma = gamma = 0
+                Real solveScale=0, residScale=1;
+                if( denom > Real(0) )
+                {
+                    solveScale = sigma / denom;
+                    residScale = gammaSquared / denom;
+                }
+                residNorm = SafeNorm( residNorm, residScale*Abs(C(i,j)) );
+                if( D != nullptr )
+                    (*D)(i,j+l*numRHS) = solveScale*C(i,j);
+            }
+            residNorms(j,l) = residNorm;
+        }
+    }
+}
+
+template<typename Field>
+void Path
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        Matrix<Field>* X,
+        Matrix<Base<Field>>& residNorms )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    EL_DEBUG_ONLY(
+      const Int m = ( orientation==NORMAL ? A.Height() : A.Width() );
+      if( m != B.Height() )
+          LogicError("Heights of op(A) and B must match");
+      if( gammas.Width() != 1 )
+          LogicError("gammas must be a column vector");
+    )
+    Matrix<Field> U, V;
+    Matrix<Real> s;
+    ridge::OpSVD( orientation, A, U, s, V );
+
+    Matrix<Field> C, R( B );
+    Gemm( ADJOINT, NORMAL, Field(1), U, B, C );
+    Gemm( NORMAL, NORMAL, Field(-1), U, C, Field(1), R );
+    Matrix<Real> perpNorms;
+    ColumnTwoNorms( R, perpNorms );
+    R.Empty();
+
+    if( X == nullptr )
+    {
+        ridge::PathCoefficients( s, C, perpNorms, gammas, residNorms );
+    }
+    else
+    {
+        Matrix<Field> D;
+        ridge::PathCoefficients( s, C, perpNorms, gammas, residNorms, &D );
+        Gemm( NORMAL, NORMAL, Field(1), V, D, *X );
+    }
+}
+
+template<typename Field>
+void Path
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& APre,
+  const AbstractDistMatrix<Field>& BPre,
+  const Matrix<Base<Field>>& gammas,
+        AbstractDistMatrix<Field>* XPre,
+        Matrix<Base<Field>>& residNorms )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    DistMatrixReadProxy<Field,Field,MC,MR>
+      AProx( APre ),
+      BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    const Grid& g = A.Grid();
+    EL_DEBUG_ONLY(
+      const Int m = ( orientation==NORMAL ? A.Height() : A.Width() );
+      if( m != B.Height() )
+          LogicError("Heights of op(A) and B must match");
+      if( gammas.Width() != 1 )
+          LogicError("gammas must be a column vector");
+    )
+
+    DistMatrix<Field> U(g), V(g);
+    DistMatrix<Real,VR,STAR> s(g);
+    ridge::OpSVD( orientation, A, U, s, V );
+
+    DistMatrix<Field> C(g), R( B );
+    Gemm( ADJOINT, NORMAL, Field(1), U, B, C );
+    Gemm( NORMAL, NORMAL, Field(-1), U, C, Field(1), R );
+    DistMatrix<Real,MR,STAR> perpNorms(g);
+    ColumnTwoNorms( R, perpNorms );
+    R.Empty();
+
+    // Every process redundantly computes the (small) path coefficients
+    DistMatrix<Real,STAR,STAR> s_STAR_STAR( s ),
+      perpNorms_STAR_STAR( perpNorms );
+    DistMatrix<Field,STAR,STAR> C_STAR_STAR( C );
+    if( XPre == nullptr )
+    {
+        ridge::PathCoefficients
+        ( s_STAR_STAR.LockedMatrix(), C_STAR_STAR.LockedMatrix(),
+          perpNorms_STAR_STAR.LockedMatrix(), gammas, residNorms );
+    }
+    else
+    {
+        DistMatrix<Field,STAR,STAR> D_STAR_STAR(g);
+        D_STAR_STAR.Resize( C.Height(), C.Width()*gammas.Height() );
+        ridge::PathCoefficients
+        ( s_STAR_STAR.LockedMatrix(), C_STAR_STAR.LockedMatrix(),
+          perpNorms_STAR_STAR.LockedMatrix(), gammas, residNorms,
+          &D_STAR_STAR.Matrix() );
+        DistMatrix<Field> D( D_STAR_STAR );
+        D_STAR_STAR.Empty();
+
+        DistMatrixWriteProxy<Field,Field,MC,MR> XProx( *XPre );
+        auto& X = XProx.Get();
+        Gemm( NORMAL, NORMAL, Field(1), V, D, X );
+    }
+}
+
+} // namespace ridge
+
+template<typename Field>
+void RidgePath
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        Matrix<Field>& X,
+        Matrix<Base<Field>>& residNorms )
+{
+    EL_DEBUG_CSE
+    ridge::Path( orientation, A, B, gammas, &X, residNorms );
+}
+
+template<typename Field>
+void RidgePath
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        AbstractDistMatrix<Field>& X,
+        Matrix<Base<Field>>& residNorms )
+{
+    EL_DEBUG_CSE
+    ridge::Path( orientation, A, B, gammas, &X, residNorms );
+}
+
+template<typename Field>
+void RidgePath
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        Matrix<Base<Field>>& residNorms )
+{
+    EL_DEBUG_CSE
+    Matrix<Field>* X = nullptr;
+    ridge::Path( orientation, A, B, gammas, X, residNorms );
+}
+
+template<typename Field>
+void RidgePath
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& B,
+  const Matrix<Base<Field>>& gammas,
+        Matrix<Base<Field>>& residNorms )
+{
+    EL_DEBUG_CSE
+    AbstractDistMatrix<Field>* X = nullptr;
+    ridge::Path( orientation, A, B, gammas, X, residNorms );
+}
+
+#define PROTO(Field) \
+  template void RidgePath \
+  ( Orientation orientation, \
+    const Matrix<Field>& A, \
+    const Matrix<Field>& B, \
+    const Matrix<Base<Field>>& gammas, \
+          Matrix<Field>& X, \
+          Matrix<Base<Field>>& residNorms ); \
+  template void RidgePath \
+  ( Orientation orientation, \
+    const AbstractDistMatrix<Field>& A, \
+    const AbstractDistMatrix<Field>& B, \
+    const Matrix<Base<Field>>& gammas, \
+          AbstractDistMatrix<Field>& X, \
+          Matrix<Base<Field>>& residNorms ); \
+  template void RidgePath \
+  ( Orientation orientation, \
+    const Matrix<Field>& A, \
+    const Matrix<Field>& B, \
+    const Matrix<Base<Field>>& gammas, \
+          Matrix<Base<Field>>& residNorms ); \
+  template void RidgePath \
+  ( Orientation orientation, \
+    const AbstractDistMatrix<Field>& A, \
+    const AbstractDistMatrix<Field>& B, \
+    const Matrix<Base<Field>>& gammas, \
+          Matrix<Base<Field>>& residNorms );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
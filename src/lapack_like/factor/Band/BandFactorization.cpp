@@ -0,0 +1,193 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+BandFactorization<Field>::BandFactorization() { }
+
+template<typename Field>
+void BandFactorization<Field>::Factor
+( const BandMatrix<Field>& A, bool hermitian )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+    const Int kl = A.LowerBandwidth();
+    const Int ku = A.UpperBandwidth();
+    const auto& band = A.LockedBand();
+    height_ = n;
+    lower_ = kl;
+    hermitian_ = hermitian;
+    factored_ = false;
+    SwapClear( pivots_ );
+
+    if( hermitian )
+    {
+        // L(i,j) is stored in entry (i-j,j) of the (kl+1) x n factors
+        upper_ = kl;
+        Zeros( factors_, kl+1, n );
+        for( Int j=0; j<n; ++j )
+            for( Int r=0; r<=Min(kl,n-1-j); ++r )
+                factors_(r,j) = band(ku+r,j);
+
+        for( Int j=0; j<n; ++j )
+        {
+            Real alpha = RealPart(factors_(0,j));
+            if( alpha <= Real(0) )
+                throw NonHPDMatrixException();
+            alpha = Sqrt(alpha);
+            factors_(0,j) = alpha;
+            const Int kn = Min(kl,n-1-j);
+            for( Int r=1; r<=kn; ++r )
+                factors_(r,j) /= alpha;
+            for( Int c=1; c<=kn; ++c )
+            {
+                const Field gamma = Conj(factors_(c,j));
+                for( Int r=c; r<=kn; ++r )
+                    factors_(r-c,j+c) -= factors_(r,j)*gamma;
+            }
+        }
+    }
+    else
+    {
+        // The row interchanges increase the upper bandwidth of U to kl+ku,
+        // so that, as in LAPACK's ?gbtrf, entry (i,j) of the factors is
+        // stored in entry (kl+ku+i-j,j) of the (2 kl+ku+1) x n factors
+        upper_ = ku;
+        const Int kv = kl + ku;
+        Zeros( factors_, 2*kl+ku+1, n );
+        for( Int j=0; j<n; ++j )
+            for( Int r=0; r<kl+ku+1; ++r )
+                factors_(kl+r,j) = band(r,j);
+
+        pivots_.resize( n );
+        // The last column affected by the interchanges so far
+        Int ju = 0;
+        for( Int j=0; j<n; ++j )
+        {
+            const Int km = Min(kl,n-1-j);
+            Int jp = 0;
+            Real maxAbs = Abs(factors_(kv,j));
+            for( Int r=1; r<=km; ++r )
+            {
+                const Real absVal = Abs(factors_(kv+r,j));
+                if( absVal > maxAbs )
+                {
+                    maxAbs = absVal;
+                    jp = r;
+                }
+            }
+            pivots_[j] = j + jp;
+            if( maxAbs == Real(0) )
+                throw SingularMatrixException();
+
+            ju = Max(ju,Min(j+ku+jp,n-1));
+            if( jp != 0 )
+                for( Int c=j; c<=ju; ++c )
+                    std::swap( factors_(kv+j-c,c), factors_(kv+j+jp-c,c) );
+
+            const Field pivot = factors_(kv,j);
+            for( Int r=1; r<=km; ++r )
+                factors_(kv+r,j) /= pivot;
+            for( Int c=j+1; c<=ju; ++c )
+            {
+                const Field gamma = factors_(kv+j-c,c);
+                if( gamma == Field(0) )
+                    continue;
+                for( Int r=1; r<=km; ++r )
+                    factors_(kv+j+r-c,c) -= factors_(kv+r,j)*gamma;
+            }
+        }
+    }
+    factored_ = true;
+}
+
+template<typename Field>
+bool BandFactorization<Field>::Factored() const EL_NO_EXCEPT
+{ return factored_; }
+
+template<typename Field>
+Int BandFactorization<Field>::Height() const EL_NO_EXCEPT
+{ return height_; }
+
+template<typename Field>
+void BandFactorization<Field>::Solve( Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The band matrix has not been factored");
+    if( B.Height() != height_ )
+        LogicError
+        ("Height of B, ",B.Height(),", did not match that of A, ",height_);
+    const Int n = height_;
+    const Int kl = lower_;
+    const Int width = B.Width();
+    if( hermitian_ )
+    {
+        for( Int l=0; l<width; ++l )
+        {
+            Field* b = B.Buffer(0,l);
+            // Solve against L
+            for( Int j=0; j<n; ++j )
+            {
+                b[j] /= factors_(0,j);
+                const Field beta = b[j];
+                for( Int r=1; r<=Min(kl,n-1-j); ++r )
+                    b[j+r] -= factors_(r,j)*beta;
+            }
+            // Solve against L^H
+            for( Int j=n-1; j>=0; --j )
+            {
+                Field beta = b[j];
+                for( Int r=1; r<=Min(kl,n-1-j); ++r )
+                    beta -= Conj(factors_(r,j))*b[j+r];
+                b[j] = beta / factors_(0,j);
+            }
+        }
+    }
+    else
+    {
+        const Int kv = kl + upper_;
+        for( Int l=0; l<width; ++l )
+        {
+            Field* b = B.Buffer(0,l);
+            // Apply the interchanges and solve against the unit-diagonal L
+            for( Int j=0; j<n-1; ++j )
+            {
+                const Int p = pivots_[j];
+                if( p != j )
+                    std::swap( b[j], b[p] );
+                const Field beta = b[j];
+                for( Int r=1; r<=Min(kl,n-1-j); ++r )
+                    b[j+r] -= factors_(kv+r,j)*beta;
+            }
+            // Solve against U
+            for( Int j=n-1; j>=0; --j )
+            {
+                b[j] /= factors_(kv,j);
+                const Field beta = b[j];
+                for( Int i=Max(j-kv,Int(0)); i<j; ++i )
+                    b[i] -= factors_(kv+i-j,j)*beta;
+            }
+        }
+    }
+}
+
+#define PROTO(Field) template class BandFactorization<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,394 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+void CheckBandwidths( Int n, Int lowerBandwidth, Int upperBandwidth )
+{
+    if( n < 0 || lowerBandwidth < 0 || upperBandwidth < 0 )
+        LogicError
+        ("Invalid band matrix dimensions: n=",n,", kl=",lowerBandwidth,
+         ", ku=",upperBandwidth);
+}
+
+} // anonymous namespace
+
+// BandMatrix
+// ==========
+
+template<typename Field>
+BandMatrix<Field>::BandMatrix() { }
+
+template<typename Field>
+BandMatrix<Field>::BandMatrix
+( Int n, Int lowerBandwidth, Int upperBandwidth )
+{
+    EL_DEBUG_CSE
+    Resize( n, lowerBandwidth, upperBandwidth );
+}
+
+template<typename Field>
+void BandMatrix<Field>::Resize
+( Int n, Int lowerBandwidth, Int upperBandwidth )
+{
+    EL_DEBUG_CSE
+    CheckBandwidths( n, lowerBandwidth, upperBandwidth );
+    height_ = n;
+    lower_ = lowerBandwidth;
+    upper_ = upperBandwidth;
+    Zeros( band_, lower_+upper_+1, n );
+}
+
+template<typename Field>
+Int BandMatrix<Field>::Height() const EL_NO_EXCEPT { return height_; }
+template<typename Field>
+Int BandMatrix<Field>::Width() const EL_NO_EXCEPT { return height_; }
+template<typename Field>
+Int BandMatrix<Field>::LowerBandwidth() const EL_NO_EXCEPT { return lower_; }
+template<typename Field>
+Int BandMatrix<Field>::UpperBandwidth() const EL_NO_EXCEPT { return upper_; }
+
+template<typename Field>
+bool BandMatrix<Field>::InBand( Int i, Int j ) const EL_NO_EXCEPT
+{
+    return i >= 0 && i < height_ && j >= 0 && j < height_ &&
+           i-j <= lower_ && j-i <= upper_;
+}
+
+template<typename Field>
+Field BandMatrix<Field>::Get( Int i, Int j ) const
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( i < 0 || i >= height_ || j < 0 || j >= height_ )
+          LogicError("Entry (",i,",",j,") is out of bounds");
+    )
+    return ( InBand(i,j) ? band_(upper_+i-j,j) : Field(0) );
+}
+
+template<typename Field>
+void BandMatrix<Field>::Set( Int i, Int j, const Field& value )
+{
+    EL_DEBUG_CSE
+    if( !InBand(i,j) )
+        LogicError("Entry (",i,",",j,") is outside of the band");
+    band_(upper_+i-j,j) = value;
+}
+
+template<typename Field>
+void BandMatrix<Field>::Update( Int i, Int j, const Field& value )
+{
+    EL_DEBUG_CSE
+    if( !InBand(i,j) )
+        LogicError("Entry (",i,",",j,") is outside of the band");
+    band_(upper_+i-j,j) += value;
+}
+
+template<typename Field>
+Matrix<Field>& BandMatrix<Field>::Band() EL_NO_EXCEPT { return band_; }
+template<typename Field>
+const Matrix<Field>& BandMatrix<Field>::LockedBand() const EL_NO_EXCEPT
+{ return band_; }
+
+template<typename Field>
+void BandMatrix<Field>::Multiply
+( Orientation orientation,
+  Field alpha, const Matrix<Field>& X,
+  Field beta,        Matrix<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    const Int width = X.Width();
+    if( X.Height() != height_ || Y.Height() != height_ || Y.Width() != width )
+        LogicError
+        ("Cannot multiply a ",height_," x ",height_," band matrix with a ",
+         X.Height()," x ",X.Width()," matrix to produce a ",Y.Height()," x ",
+         Y.Width()," matrix");
+    if( beta == Field(0) )
+        Zero( Y );
+    else
+        Y *= beta;
+    for( Int l=0; l<width; ++l )
+    {
+        for( Int j=0; j<height_; ++j )
+        {
+            const Int iBeg = Max(j-upper_,Int(0));
+            const Int iEnd = Min(j+lower_+1,height_);
+            if( orientation == NORMAL )
+            {
+                const Field alphaX = alpha*X(j,l);
+                for( Int i=iBeg; i<iEnd; ++i )
+                    Y(i,l) += band_(upper_+i-j,j)*alphaX;
+            }
+            else
+            {
+                const bool conjugate = ( orientation == ADJOINT );
+                Field gamma = 0;
+                for( Int i=iBeg; i<iEnd; ++i )
+                {
+                    const Field value = band_(upper_+i-j,j);
+                    gamma += ( conjugate ? Conj(value) : value )*X(i,l);
+                }
+                Y(j,l) += alpha*gamma;
+            }
+        }
+    }
+}
+
+// DistBandMatrix
+// ==============
+
+template<typename Field>
+DistBandMatrix<Field>::DistBandMatrix( const El::Grid& grid )
+: grid_(&grid)
+{
+    EL_DEBUG_CSE
+    Resize( 0, 0, 0 );
+}
+
+template<typename Field>
+DistBandMatrix<Field>::DistBandMatrix
+( Int n, Int lowerBandwidth, Int upperBandwidth, const El::Grid& grid )
+: grid_(&grid)
+{
+    EL_DEBUG_CSE
+    Resize( n, lowerBandwidth, upperBandwidth );
+}
+
+template<typename Field>
+void DistBandMatrix<Field>::SetGrid( const El::Grid& grid )
+{
+    EL_DEBUG_CSE
+    if( grid_ == &grid )
+        return;
+    grid_ = &grid;
+    Resize( 0, 0, 0 );
+}
+
+template<typename Field>
+void DistBandMatrix<Field>::Resize
+( Int n, Int lowerBandwidth, Int upperBandwidth )
+{
+    EL_DEBUG_CSE
+    CheckBandwidths( n, lowerBandwidth, upperBandwidth );
+    height_ = n;
+    lower_ = lowerBandwidth;
+    upper_ = upperBandwidth;
+
+    // Match the row distribution of DistMultiVec
+    const int commSize = grid_->Size();
+    blocksize_ = height_ / commSize;
+    if( blocksize_*commSize < height_ || height_ == 0 )
+        ++blocksize_;
+    const Int firstLocalCol = FirstLocalCol();
+    const Int localWidth =
+      Max(Min(blocksize_,height_-firstLocalCol),Int(0));
+    Zeros( band_, lower_+upper_+1, localWidth );
+    SwapClear( remoteUpdates_ );
+}
+
+template<typename Field>
+Int DistBandMatrix<Field>::Height() const EL_NO_EXCEPT { return height_; }
+template<typename Field>
+Int DistBandMatrix<Field>::Width() const EL_NO_EXCEPT { return height_; }
+template<typename Field>
+Int DistBandMatrix<Field>::LowerBandwidth() const EL_NO_EXCEPT
+{ return lower_; }
+template<typename Field>
+Int DistBandMatrix<Field>::UpperBandwidth() const EL_NO_EXCEPT
+{ return upper_; }
+
+template<typename Field>
+bool DistBandMatrix<Field>::InBand( Int i, Int j ) const EL_NO_EXCEPT
+{
+    return i >= 0 && i < height_ && j >= 0 && j < height_ &&
+           i-j <= lower_ && j-i <= upper_;
+}
+
+template<typename Field>
+const El::Grid& DistBandMatrix<Field>::Grid() const EL_NO_EXCEPT
+{ return *grid_; }
+
+template<typename Field>
+Int DistBandMatrix<Field>::Blocksize() const EL_NO_EXCEPT
+{ return blocksize_; }
+
+template<typename Field>
+Int DistBandMatrix<Field>::FirstLocalCol() const EL_NO_EXCEPT
+{ return blocksize_*grid_->Rank(); }
+
+template<typename Field>
+Int DistBandMatrix<Field>::LocalWidth() const EL_NO_EXCEPT
+{ return band_.Width(); }
+
+template<typename Field>
+int DistBandMatrix<Field>::ColOwner( Int j ) const EL_NO_EXCEPT
+{ return j / blocksize_; }
+
+template<typename Field>
+bool DistBandMatrix<Field>::IsLocalCol( Int j ) const EL_NO_EXCEPT
+{ return ColOwner(j) == grid_->Rank(); }
+
+template<typename Field>
+Int DistBandMatrix<Field>::GlobalCol( Int jLoc ) const EL_NO_EXCEPT
+{ return jLoc + FirstLocalCol(); }
+
+template<typename Field>
+Int DistBandMatrix<Field>::LocalCol( Int j ) const EL_NO_EXCEPT
+{ return j - FirstLocalCol(); }
+
+template<typename Field>
+Field DistBandMatrix<Field>::GetLocal( Int i, Int jLoc ) const
+{
+    EL_DEBUG_CSE
+    const Int j = GlobalCol( jLoc );
+    return ( InBand(i,j) ? band_(upper_+i-j,jLoc) : Field(0) );
+}
+
+template<typename Field>
+void DistBandMatrix<Field>::SetLocal( Int i, Int jLoc, const Field& value )
+{
+    EL_DEBUG_CSE
+    const Int j = GlobalCol( jLoc );
+    if( !InBand(i,j) )
+        LogicError("Entry (",i,",",j,") is outside of the band");
+    band_(upper_+i-j,jLoc) = value;
+}
+
+template<typename Field>
+void DistBandMatrix<Field>::UpdateLocal
+( Int i, Int jLoc, const Field& value )
+{
+    EL_DEBUG_CSE
+    const Int j = GlobalCol( jLoc );
+    if( !InBand(i,j) )
+        LogicError("Entry (",i,",",j,") is outside of the band");
+    band_(upper_+i-j,jLoc) += value;
+}
+
+template<typename Field>
+void DistBandMatrix<Field>::Reserve( Int numRemoteEntries )
+{
+    EL_DEBUG_CSE
+    const Int currSize = remoteUpdates_.size();
+    remoteUpdates_.reserve( currSize+numRemoteEntries );
+}
+
+template<typename Field>
+void DistBandMatrix<Field>::QueueUpdate( Int i, Int j, const Field& value )
+{
+    EL_DEBUG_CSE
+    if( !InBand(i,j) )
+        LogicError("Entry (",i,",",j,") is outside of the band");
+    remoteUpdates_.push_back( Entry<Field>{i,j,value} );
+}
+
+template<typename Field>
+void DistBandMatrix<Field>::ProcessQueues()
+{
+    EL_DEBUG_CSE
+    vector<int> sendCounts(grid_->Size());
+    for( const auto& entry : remoteUpdates_ )
+        ++sendCounts[ColOwner(entry.j)];
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    auto offs = sendOffs;
+    vector<Entry<Field>> sendEntries(totalSend);
+    for( const auto& entry : remoteUpdates_ )
+        sendEntries[offs[ColOwner(entry.j)]++] = entry;
+    SwapClear( remoteUpdates_ );
+
+    auto recvEntries =
+      mpi::AllToAll( sendEntries, sendCounts, sendOffs, grid_->Comm() );
+    const Int firstLocalCol = FirstLocalCol();
+    for( const auto& entry : recvEntries )
+        band_(upper_+entry.i-entry.j,entry.j-firstLocalCol) += entry.value;
+}
+
+template<typename Field>
+Matrix<Field>& DistBandMatrix<Field>::Band() EL_NO_EXCEPT { return band_; }
+template<typename Field>
+const Matrix<Field>& DistBandMatrix<Field>::LockedBand() const EL_NO_EXCEPT
+{ return band_; }
+
+template<typename Field>
+void DistBandMatrix<Field>::Multiply
+( Field alpha, const DistMultiVec<Field>& X,
+  Field beta,        DistMultiVec<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    const Int width = X.Width();
+    if( X.Height() != height_ || Y.Height() != height_ || Y.Width() != width )
+        LogicError
+        ("Cannot multiply a ",height_," x ",height_," band matrix with a ",
+         X.Height()," x ",X.Width()," matrix to produce a ",Y.Height()," x ",
+         Y.Width()," matrix");
+    if( X.Grid() != *grid_ || Y.Grid() != *grid_ )
+        LogicError("Grids did not match");
+    const auto& XLoc = X.LockedMatrix();
+    auto& YLoc = Y.Matrix();
+    if( beta == Field(0) )
+        Zero( YLoc );
+    else
+        YLoc *= beta;
+
+    // The contributions to the (at most ku) rows above, and the (at most kl)
+    // rows below, the local rows are accumulated before being queued
+    const Int firstLocalCol = FirstLocalCol();
+    const Int localWidth = LocalWidth();
+    const Int rowBeg = Max(firstLocalCol-upper_,Int(0));
+    const Int rowEnd = Min(firstLocalCol+localWidth+lower_,height_);
+    Matrix<Field> above, below;
+    Zeros( above, firstLocalCol-rowBeg, width );
+    Zeros( below, Max(rowEnd-(firstLocalCol+localWidth),Int(0)), width );
+    for( Int l=0; l<width; ++l )
+    {
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = firstLocalCol + jLoc;
+            const Int iBeg = Max(j-upper_,Int(0));
+            const Int iEnd = Min(j+lower_+1,height_);
+            const Field alphaX = alpha*XLoc(jLoc,l);
+            for( Int i=iBeg; i<iEnd; ++i )
+            {
+                const Field update = band_(upper_+i-j,jLoc)*alphaX;
+                if( i < firstLocalCol )
+                    above(i-rowBeg,l) += update;
+                else if( i < firstLocalCol+localWidth )
+                    YLoc(i-firstLocalCol,l) += update;
+                else
+                    below(i-firstLocalCol-localWidth,l) += update;
+            }
+        }
+    }
+    Y.Reserve( (above.Height()+below.Height())*width );
+    for( Int l=0; l<width; ++l )
+    {
+        for( Int i=0; i<above.Height(); ++i )
+            Y.QueueUpdate( rowBeg+i, l, above(i,l) );
+        for( Int i=0; i<below.Height(); ++i )
+            Y.QueueUpdate( firstLocalCol+localWidth+i, l, below(i,l) );
+    }
+    Y.ProcessQueues();
+}
+
+#define PROTO(Field) \
+  template class BandMatrix<Field>; \
+  template class DistBandMatrix<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
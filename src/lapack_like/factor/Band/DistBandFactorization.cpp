@@ -0,0 +1,277 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+// Writing x_q for the rows of x owned by the q'th of the p processes, the
+// block-tridiagonal structure of A implies that
+//
+//   D_q x_q + [0; B_q] x_{q+1}(0:ku) + [C_q; 0] x_{q-1}(end-kl:end) = f_q,
+//
+// so that, with the spikes V_q = inv(D_q) [0; B_q] and W_q = inv(D_q) [C_q; 0]
+// and g_q = inv(D_q) f_q,
+//
+//   x_q = g_q - V_q x_{q+1}(0:ku) - W_q x_{q-1}(end-kl:end).
+//
+// Restricting to the first ku and last kl rows of each x_q yields a reduced
+// system for the unknowns z_q = [x_q(0:ku); x_q(end-kl:end)] which is banded
+// with lower bandwidth 2 kl+ku-1 and upper bandwidth kl+2 ku-1.
+
+template<typename Field>
+DistBandFactorization<Field>::DistBandFactorization() { }
+
+template<typename Field>
+void DistBandFactorization<Field>::Factor
+( const DistBandMatrix<Field>& A, bool hermitian )
+{
+    EL_DEBUG_CSE
+    const El::Grid& grid = A.Grid();
+    const int commSize = grid.Size();
+    const int commRank = grid.Rank();
+    const Int n = A.Height();
+    const Int kl = A.LowerBandwidth();
+    const Int ku = ( hermitian ? kl : A.UpperBandwidth() );
+    const Int kuStored = A.UpperBandwidth();
+    const Int blocksize = A.Blocksize();
+    const Int firstLocalCol = A.FirstLocalCol();
+    const Int localHeight = A.LocalWidth();
+    const int numParts = ( n == 0 ? 0 : int((n+blocksize-1)/blocksize) );
+    if( numParts > 1 )
+    {
+        const Int lastHeight = n - (numParts-1)*blocksize;
+        if( Min(blocksize,lastHeight) < kl+ku )
+            LogicError
+            ("Each nonempty block of the ",n," x ",n," band matrix must have "
+             "at least kl+ku=",kl+ku," rows, but one has ",
+             Min(blocksize,lastHeight));
+    }
+    height_ = n;
+    lower_ = kl;
+    upper_ = ku;
+    blocksize_ = blocksize;
+    numParts_ = numParts;
+    grid_ = &grid;
+    factored_ = false;
+
+    // Factor the diagonal block
+    if( localHeight > 0 )
+    {
+        BandMatrix<Field> D( localHeight, kl, kuStored );
+        auto& DBand = D.Band();
+        const auto& ABand = A.LockedBand();
+        for( Int jLoc=0; jLoc<localHeight; ++jLoc )
+        {
+            const Int j = firstLocalCol + jLoc;
+            const Int iBeg = Max(j-kuStored,firstLocalCol);
+            const Int iEnd = Min(j+kl+1,firstLocalCol+localHeight);
+            for( Int i=iBeg; i<iEnd; ++i )
+                DBand(kuStored+i-j,jLoc) = ABand(kuStored+i-j,jLoc);
+        }
+        local_.Factor( D, hermitian );
+    }
+    if( numParts <= 1 )
+    {
+        factored_ = true;
+        return;
+    }
+
+    // Exchange the couplings with the neighbors: the kl x kl block below our
+    // last kl columns is C_{q+1}, and the ku x ku block above our first ku
+    // columns is B_{q-1} (which, in the Hermitian case, is instead formed by
+    // the neighbor as the adjoint of its copy of C_q)
+    const bool hasPrev = ( commRank > 0 && commRank < numParts );
+    const bool hasNext = ( commRank+1 < numParts );
+    vector<int> sendCounts(commSize,0);
+    if( hasNext )
+        sendCounts[commRank+1] = kl*kl;
+    if( hasPrev && !hermitian )
+        sendCounts[commRank-1] = ku*ku;
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    vector<Field> sendBuf(totalSend);
+    const Int lastLocalCol = firstLocalCol + localHeight;
+    Matrix<Field> C, B;
+    Zeros( C, kl, kl );
+    Zeros( B, ku, ku );
+    if( hasPrev && !hermitian )
+    {
+        Field* buf = &sendBuf[sendOffs[commRank-1]];
+        for( Int s=0; s<ku; ++s )
+            for( Int r=0; r<ku; ++r )
+                buf[r+s*ku] = A.GetLocal( firstLocalCol-ku+r, s );
+    }
+    if( hasNext )
+    {
+        Field* buf = &sendBuf[sendOffs[commRank+1]];
+        for( Int s=0; s<kl; ++s )
+            for( Int r=0; r<kl; ++r )
+                buf[r+s*kl] =
+                  A.GetLocal( lastLocalCol+r, localHeight-kl+s );
+        if( hermitian )
+            for( Int s=0; s<ku; ++s )
+                for( Int r=0; r<ku; ++r )
+                    B(r,s) = Conj(buf[s+r*kl]);
+    }
+    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, grid.Comm() );
+    Int offset = 0;
+    if( hasPrev )
+    {
+        for( Int s=0; s<kl; ++s )
+            for( Int r=0; r<kl; ++r )
+                C(r,s) = recvBuf[offset+r+s*kl];
+        offset += kl*kl;
+    }
+    if( hasNext && !hermitian )
+        for( Int s=0; s<ku; ++s )
+            for( Int r=0; r<ku; ++r )
+                B(r,s) = recvBuf[offset+r+s*ku];
+
+    // Form the spikes
+    Zeros( V_, localHeight, ku );
+    Zeros( W_, localHeight, kl );
+    if( hasNext )
+    {
+        auto VBot = V_( IR(localHeight-ku,localHeight), ALL );
+        VBot = B;
+        local_.Solve( V_ );
+    }
+    if( hasPrev )
+    {
+        auto WTop = W_( IR(0,kl), ALL );
+        WTop = C;
+        local_.Solve( W_ );
+    }
+
+    // Gather the s x s coupling blocks [V_q^t; V_q^b] and [W_q^t; W_q^b]
+    // (with s = kl+ku) and redundantly factor the reduced system
+    const Int s = kl + ku;
+    const Int packSize = s*s;
+    vector<Field> packed(packSize,Field(0)), gathered(packSize*commSize);
+    if( localHeight > 0 )
+    {
+        for( Int c=0; c<ku; ++c )
+        {
+            for( Int r=0; r<ku; ++r )
+                packed[r+c*s] = V_(r,c);
+            for( Int r=0; r<kl; ++r )
+                packed[ku+r+c*s] = V_(localHeight-kl+r,c);
+        }
+        for( Int c=0; c<kl; ++c )
+        {
+            for( Int r=0; r<ku; ++r )
+                packed[r+(ku+c)*s] = W_(r,c);
+            for( Int r=0; r<kl; ++r )
+                packed[ku+r+(ku+c)*s] = W_(localHeight-kl+r,c);
+        }
+    }
+    mpi::AllGather
+    ( packed.data(), packSize, gathered.data(), packSize, grid.Comm() );
+
+    const Int reducedHeight = numParts*s;
+    BandMatrix<Field> S
+    ( reducedHeight, Max(2*kl+ku-1,Int(0)), Max(kl+2*ku-1,Int(0)) );
+    for( int q=0; q<numParts; ++q )
+    {
+        const Field* block = &gathered[q*packSize];
+        for( Int r=0; r<s; ++r )
+            S.Set( q*s+r, q*s+r, Field(1) );
+        if( q+1 < numParts )
+            for( Int c=0; c<ku; ++c )
+                for( Int r=0; r<s; ++r )
+                    S.Update( q*s+r, (q+1)*s+c, block[r+c*s] );
+        if( q > 0 )
+            for( Int c=0; c<kl; ++c )
+                for( Int r=0; r<s; ++r )
+                    S.Update( q*s+r, (q-1)*s+ku+c, block[r+(ku+c)*s] );
+    }
+    reduced_.Factor( S );
+    factored_ = true;
+}
+
+template<typename Field>
+bool DistBandFactorization<Field>::Factored() const EL_NO_EXCEPT
+{ return factored_; }
+
+template<typename Field>
+Int DistBandFactorization<Field>::Height() const EL_NO_EXCEPT
+{ return height_; }
+
+template<typename Field>
+void DistBandFactorization<Field>::Solve( DistMultiVec<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The band matrix has not been factored");
+    if( B.Height() != height_ )
+        LogicError
+        ("Height of B, ",B.Height(),", did not match that of A, ",height_);
+    if( B.Grid() != *grid_ )
+        LogicError("B was not distributed over the grid of A");
+    const int commSize = grid_->Size();
+    const int commRank = grid_->Rank();
+    const Int kl = lower_;
+    const Int ku = upper_;
+    const Int width = B.Width();
+    auto& BLoc = B.Matrix();
+    const Int localHeight = BLoc.Height();
+
+    if( localHeight > 0 )
+        local_.Solve( BLoc );
+    if( numParts_ <= 1 )
+        return;
+
+    // Gather [g_q^t; g_q^b] and solve the reduced system
+    const Int s = kl + ku;
+    const Int packSize = s*width;
+    vector<Field> packed(packSize,Field(0)), gathered(packSize*commSize);
+    if( localHeight > 0 )
+    {
+        for( Int l=0; l<width; ++l )
+        {
+            for( Int r=0; r<ku; ++r )
+                packed[r+l*s] = BLoc(r,l);
+            for( Int r=0; r<kl; ++r )
+                packed[ku+r+l*s] = BLoc(localHeight-kl+r,l);
+        }
+    }
+    mpi::AllGather
+    ( packed.data(), packSize, gathered.data(), packSize, grid_->Comm() );
+    Matrix<Field> Z( numParts_*s, width );
+    for( int q=0; q<numParts_; ++q )
+        for( Int l=0; l<width; ++l )
+            for( Int r=0; r<s; ++r )
+                Z(q*s+r,l) = gathered[q*packSize+r+l*s];
+    reduced_.Solve( Z );
+
+    // x_q := g_q - V_q z_{q+1}^t - W_q z_{q-1}^b
+    if( localHeight == 0 )
+        return;
+    if( commRank+1 < numParts_ )
+    {
+        auto ZNextTop = Z( IR((commRank+1)*s,(commRank+1)*s+ku), ALL );
+        Gemm( NORMAL, NORMAL, Field(-1), V_, ZNextTop, Field(1), BLoc );
+    }
+    if( commRank > 0 )
+    {
+        auto ZPrevBot = Z( IR((commRank-1)*s+ku,commRank*s), ALL );
+        Gemm( NORMAL, NORMAL, Field(-1), W_, ZPrevBot, Field(1), BLoc );
+    }
+}
+
+#define PROTO(Field) template class DistBandFactorization<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
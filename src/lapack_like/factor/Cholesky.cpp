@@ -15,6 +15,8 @@
 #include "./Cholesky/PivotedLowerVariant3.hpp"
 #include "./Cholesky/PivotedUpperVariant3.hpp"
 #include "./Cholesky/SolveAfter.hpp"
+#include "./Cholesky/Packed.hpp"
+#include "./Cholesky/Block.hpp"
 
 #include "./Cholesky/LowerMod.hpp"
 #include "./Cholesky/UpperMod.hpp"
@@ -73,7 +75,9 @@ void ScaLAPACKHelper( UpperOrLower uplo, AbstractDistMatrix<F>& A )
     AssertScaLAPACKSupport();
 #ifdef EL_HAVE_SCALAPACK
     // TODO: Add support for optionally timing the proxy redistribution
-    DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK> ABlockProx( A );
+    const auto proxyCtrl =
+      ScaLAPACKProxyCtrl( A, DefaultBlockHeight(), DefaultBlockHeight(), true );
+    DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK> ABlockProx( A, proxyCtrl );
     auto& ABlock = ABlockProx.Get();
 
     const Int n = ABlock.Height();
@@ -93,13 +97,28 @@ void ScaLAPACKHelper( UpperOrLower uplo, AbstractDistMatrix<F>& A )
 } // anonymous namespace
 
 template<typename F> 
-void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack )
+void Cholesky
+( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack, Int lookahead )
 {
     EL_DEBUG_CSE
     if( scalapack )
     {
         cholesky::ScaLAPACKHelper( uplo, A );
     }
+    else if( A.Wrap() == BLOCK )
+    {
+        if( uplo == LOWER )
+            cholesky::LowerVariant3Block( A );
+        else
+            cholesky::UpperVariant3Block( A );
+    }
+    else if( lookahead > 0 )
+    {
+        if( uplo == LOWER )
+            cholesky::LowerVariant3Pipelined( A );
+        else
+            cholesky::UpperVariant3Pipelined( A );
+    }
     else
     {
         if( uplo == LOWER )
@@ -125,6 +144,13 @@ void Cholesky
 ( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A )
 { Cholesky( uplo, A.Matrix() ); }
 
+template<typename F>
+void Cholesky( DistPackedMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    cholesky::Packed( A );
+}
+
 template<typename F> 
 void ReverseCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A )
 {
@@ -206,7 +232,8 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
 #define PROTO_BASE(F) \
   template void Cholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void Cholesky \
-  ( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack ); \
+  ( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack, \
+    Int lookahead ); \
   template void Cholesky( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A ); \
   template void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void ReverseCholesky \
@@ -242,7 +269,10 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
   ( UpperOrLower uplo, Orientation orientation, \
     const AbstractDistMatrix<F>& A, \
     const DistPermutation& p, \
-          AbstractDistMatrix<F>& B ); 
+          AbstractDistMatrix<F>& B ); \
+  template void Cholesky( DistPackedMatrix<F>& A ); \
+  template void cholesky::SolveAfter \
+  ( const DistPackedMatrix<F>& L, AbstractDistMatrix<F>& B );
 
 #define PROTO(F) \
   PROTO_BASE(F) \
@@ -0,0 +1,187 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_BLOCK_HPP
+#define EL_CHOLESKY_BLOCK_HPP
+
+namespace El {
+namespace cholesky {
+
+// Right-looking Cholesky directly over block-cyclic matrices, where the
+// panels are the distribution blocks so that each diagonal block is owned by
+// a single process. The trailing update is performed one block column (row)
+// at a time, with a local Herk into the owned diagonal block and a local Gemm
+// beneath (to the right of) it, so that the strictly upper (lower) triangle
+// is never touched. Matrices whose row and column blockings differ fall back
+// to the element-wise algorithm.
+
+inline vector<Int> BlockBoundaries( Int n, Int blocksize, Int cut )
+{
+    vector<Int> offsets(1,0);
+    for( Int k=0; k<n; )
+    {
+        k += Min( k==0 ? blocksize-cut : blocksize, n-k );
+        offsets.push_back( k );
+    }
+    return offsets;
+}
+
+template<typename F>
+void LowerVariant3Block( AbstractDistMatrix<F>& APre )
+{
+    EL_DEBUG_CSE
+    EL_REGION("cholesky::LowerVariant3Block");
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    typedef Base<F> Real;
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK> AProx( APre );
+    auto& A = AProx.Get();
+    if( A.BlockHeight() != A.BlockWidth() || A.ColCut() != A.RowCut() )
+    {
+        LowerVariant3Blocked( A );
+        return;
+    }
+
+    DistMatrix<F,STAR,STAR,BLOCK> A11_STAR_STAR(grid);
+    DistMatrix<F,MC,  STAR,BLOCK> A21_MC_STAR(grid);
+    DistMatrix<F,MR,  STAR,BLOCK> A21_MR_STAR(grid);
+
+    const Int n = A.Height();
+    const auto offsets = BlockBoundaries( n, A.BlockHeight(), A.ColCut() );
+    const Int numBlocks = offsets.size()-1;
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const Int k = offsets[b];
+        const Range<Int> ind1( k,            offsets[b+1] ),
+                         ind2( offsets[b+1], n            );
+
+        auto A11 = A( ind1, ind1 );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        A11_STAR_STAR = A11;
+        Cholesky( LOWER, A11_STAR_STAR.Matrix() );
+        A11 = A11_STAR_STAR;
+        if( b+1 == numBlocks )
+            break;
+
+        A21_MC_STAR.AlignColsWith( A22 );
+        A21_MC_STAR = A21;
+        Trsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT,
+          F(1), A11_STAR_STAR.LockedMatrix(), A21_MC_STAR.Matrix() );
+        A21 = A21_MC_STAR;
+        A21_MR_STAR.AlignColsWith( A22 );
+        A21_MR_STAR = A21_MC_STAR;
+
+        // A22 := A22 - A21 A21^H, one block column at a time
+        for( Int c=b+1; c<numBlocks; ++c )
+        {
+            const Int off = offsets[b+1];
+            const Range<Int> indDiag( offsets[c]-off,   offsets[c+1]-off ),
+                             indBelow( offsets[c+1]-off, n-off            );
+            auto ADiag = A22( indDiag, indDiag );
+            auto ABelow = A22( indBelow, indDiag );
+            auto A21Diag_MC_STAR = A21_MC_STAR( indDiag, ALL );
+            if( ADiag.LocalHeight() > 0 && ADiag.LocalWidth() > 0 )
+                Herk
+                ( LOWER, NORMAL,
+                  Real(-1), A21Diag_MC_STAR.LockedMatrix(),
+                  Real(1),  ADiag.Matrix() );
+            LocalGemm
+            ( NORMAL, ADJOINT,
+              F(-1), A21_MC_STAR( indBelow, ALL ),
+                     A21_MR_STAR( indDiag, ALL ),
+              F(1),  ABelow );
+        }
+    }
+}
+
+template<typename F>
+void UpperVariant3Block( AbstractDistMatrix<F>& APre )
+{
+    EL_DEBUG_CSE
+    EL_REGION("cholesky::UpperVariant3Block");
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    typedef Base<F> Real;
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK> AProx( APre );
+    auto& A = AProx.Get();
+    if( A.BlockHeight() != A.BlockWidth() || A.ColCut() != A.RowCut() )
+    {
+        UpperVariant3Blocked( A );
+        return;
+    }
+
+    DistMatrix<F,STAR,STAR,BLOCK> A11_STAR_STAR(grid);
+    DistMatrix<F,STAR,MC,  BLOCK> A12_STAR_MC(grid);
+    DistMatrix<F,STAR,MR,  BLOCK> A12_STAR_MR(grid);
+
+    const Int n = A.Height();
+    const auto offsets = BlockBoundaries( n, A.BlockHeight(), A.ColCut() );
+    const Int numBlocks = offsets.size()-1;
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const Int k = offsets[b];
+        const Range<Int> ind1( k,            offsets[b+1] ),
+                         ind2( offsets[b+1], n            );
+
+        auto A11 = A( ind1, ind1 );
+        auto A12 = A( ind1, ind2 );
+        auto A22 = A( ind2, ind2 );
+
+        A11_STAR_STAR = A11;
+        Cholesky( UPPER, A11_STAR_STAR.Matrix() );
+        A11 = A11_STAR_STAR;
+        if( b+1 == numBlocks )
+            break;
+
+        A12_STAR_MR.AlignRowsWith( A22 );
+        A12_STAR_MR = A12;
+        Trsm
+        ( LEFT, UPPER, ADJOINT, NON_UNIT,
+          F(1), A11_STAR_STAR.LockedMatrix(), A12_STAR_MR.Matrix() );
+        A12 = A12_STAR_MR;
+        A12_STAR_MC.AlignRowsWith( A22 );
+        A12_STAR_MC = A12_STAR_MR;
+
+        // A22 := A22 - A12^H A12, one block row at a time
+        for( Int c=b+1; c<numBlocks; ++c )
+        {
+            const Int off = offsets[b+1];
+            const Range<Int> indDiag( offsets[c]-off,   offsets[c+1]-off ),
+                             indRight( offsets[c+1]-off, n-off            );
+            auto ADiag = A22( indDiag, indDiag );
+            auto ARight = A22( indDiag, indRight );
+            auto A12Diag_STAR_MC = A12_STAR_MC( ALL, indDiag );
+            if( ADiag.LocalHeight() > 0 && ADiag.LocalWidth() > 0 )
+                Herk
+                ( UPPER, ADJOINT,
+                  Real(-1), A12Diag_STAR_MC.LockedMatrix(),
+                  Real(1),  ADiag.Matrix() );
+            LocalGemm
+            ( ADJOINT, NORMAL,
+              F(-1), A12_STAR_MC( ALL, indDiag ),
+                     A12_STAR_MR( ALL, indRight ),
+              F(1),  ARight );
+        }
+    }
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_BLOCK_HPP
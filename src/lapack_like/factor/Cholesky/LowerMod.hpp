@@ -9,7 +9,6 @@
 #ifndef EL_CHOLESKY_LOWER_MOD_HPP
 #define EL_CHOLESKY_LOWER_MOD_HPP
 
-// TODO: Blocked algorithms
 namespace El {
 namespace cholesky {
 
@@ -227,6 +226,215 @@ void LowerDowndate( AbstractDistMatrix<F>& LPre, AbstractDistMatrix<F>& VPre )
     }
 }
 
+// Blocked algorithms
+// ==================
+// The k'th step of the above sweeps right-multiplies | L(k:end,k) V(k:end,:) |
+// by a (hyperbolic) Householder transformation which only involves the k'th
+// column of L and the columns of V. If the transformations are not negated,
+// those of a block of nb steps, say H_0 H_1 ... H_{nb-1}, may therefore be
+// aggregated into the form
+//
+//   I - Sigma Y T Y^H,   Y = | I     |,
+//                            | V1^T  |
+//
+// where V1 is the block of rows of V which holds the reflection vectors, T is
+// upper-triangular, and Sigma = diag(I,-I) for downdates and the identity
+// for updates. The block of columns of L is then negated to restore the
+// positive diagonal. Applying the aggregated transformation to the trailing
+// rows only requires matrix-matrix multiplications.
+
+// Run the unblocked sweep (without negations) over a diagonal block of L and
+// the corresponding rows of V and return the scalars t_k such that
+// H_k = I - t_k Sigma y_k y_k^H.
+template<typename F>
+void LowerPanelMod( Matrix<F>& L11, Matrix<F>& V1, Matrix<F>& t, bool downdate )
+{
+    EL_DEBUG_CSE
+    const Int nb = L11.Height();
+    const F sigma = ( downdate ? F(-1) : F(1) );
+    t.Resize( nb, 1 );
+
+    Matrix<F> z21;
+    for( Int k=0; k<nb; ++k )
+    {
+        const IR ind1( k ), ind2( k+1, END );
+
+        F& lambda11 = L11(k,k);
+        auto l21 = L11( ind2, ind1 );
+
+        auto v1 = V1( ind1, ALL );
+        auto V2 = V1( ind2, ALL );
+
+        if( downdate )
+            t(k) = F(1) / RightHyperbolicReflector( lambda11, v1 );
+        else
+            t(k) = RightReflector( lambda11, v1 );
+
+        // | l21 V2 | := | l21 V2 | - t (l21 + sigma V2 u^T) | 1 conj(u) |
+        z21 = l21;
+        Gemv( NORMAL, sigma, V2, v1, F(1), z21 );
+        Axpy( -t(k), z21, l21 );
+        Ger( -t(k), z21, v1, V2 );
+    }
+}
+
+// Form the upper-triangular T such that H_0 ... H_{nb-1} = I - Sigma Y T Y^H
+template<typename F>
+void LowerModTriangularFactor
+( const Matrix<F>& V1,
+  const Matrix<F>& t,
+        Matrix<F>& T,
+  bool downdate )
+{
+    EL_DEBUG_CSE
+    const Int nb = V1.Height();
+    const F sigma = ( downdate ? F(-1) : F(1) );
+
+    // Since the identity blocks of the columns of Y are orthogonal,
+    // Y^H Sigma Y = I + sigma conj(V1 V1^H)
+    Matrix<F> S;
+    Gemm( NORMAL, ADJOINT, F(1), V1, V1, S );
+    Conjugate( S );
+
+    Zeros( T, nb, nb );
+    for( Int j=0; j<nb; ++j )
+    {
+        T(j,j) = t(j);
+        // T(0:j,j) := -sigma t_j T(0:j,0:j) S(0:j,j)
+        for( Int i=0; i<j; ++i )
+        {
+            F gamma = 0;
+            for( Int l=i; l<j; ++l )
+                gamma += T(i,l)*S(l,j);
+            T(i,j) = -sigma*t(j)*gamma;
+        }
+    }
+}
+
+// | L21 V2 | := | L21 V2 | (I - Sigma Y T Y^H)
+template<typename F>
+void LowerModApply
+( Matrix<F>& L21,
+  Matrix<F>& V2,
+  const Matrix<F>& V1,
+  const Matrix<F>& T,
+  bool downdate )
+{
+    EL_DEBUG_CSE
+    const F sigma = ( downdate ? F(-1) : F(1) );
+    Matrix<F> W( L21 ), V1Conj;
+    Gemm( NORMAL, TRANSPOSE, sigma, V2, V1, F(1), W );
+    Trmm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), T, W );
+    L21 -= W;
+    Conjugate( V1, V1Conj );
+    Gemm( NORMAL, NORMAL, F(-1), W, V1Conj, F(1), V2 );
+}
+
+template<typename F>
+void LowerModApply
+( DistMatrix<F>& L21,
+  DistMatrix<F>& V2,
+  const DistMatrix<F>& V1,
+  const DistMatrix<F,STAR,STAR>& T,
+  bool downdate )
+{
+    EL_DEBUG_CSE
+    const F sigma = ( downdate ? F(-1) : F(1) );
+    DistMatrix<F> W( L21 ), V1Conj( V1.Grid() );
+    Gemm( NORMAL, TRANSPOSE, sigma, V2, V1, F(1), W );
+    Trmm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), T, W );
+    L21 -= W;
+    Conjugate( V1, V1Conj );
+    Gemm( NORMAL, NORMAL, F(-1), W, V1Conj, F(1), V2 );
+}
+
+template<typename F>
+void LowerBlockedMod( Matrix<F>& L, Matrix<F>& V, bool downdate )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( L.Height() != L.Width() )
+          LogicError("Cholesky factors must be square");
+      if( V.Height() != L.Height() )
+          LogicError("V is the wrong height");
+    )
+    const Int m = V.Height();
+    const Int bsize = Blocksize();
+
+    Matrix<F> t, T;
+    for( Int k=0; k<m; k+=bsize )
+    {
+        const Int nb = Min(bsize,m-k);
+        const IR ind1( k, k+nb ), ind2( k+nb, END );
+
+        auto L11 = L( ind1, ind1 );
+        auto L21 = L( ind2, ind1 );
+
+        auto V1 = V( ind1, ALL );
+        auto V2 = V( ind2, ALL );
+
+        LowerPanelMod( L11, V1, t, downdate );
+        LowerModTriangularFactor( V1, t, T, downdate );
+        LowerModApply( L21, V2, V1, T, downdate );
+        ScaleTrapezoid( F(-1), LOWER, L11 );
+        L21 *= -1;
+    }
+}
+
+template<typename F>
+void LowerBlockedMod
+( AbstractDistMatrix<F>& LPre,
+  AbstractDistMatrix<F>& VPre,
+  bool downdate )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( LPre.Height() != LPre.Width() )
+          LogicError("Cholesky factors must be square");
+      if( VPre.Height() != LPre.Height() )
+          LogicError("V is the wrong height");
+      AssertSameGrids( LPre, VPre );
+    )
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> LProx( LPre ), VProx( VPre );
+    auto& L = LProx.Get();
+    auto& V = VProx.Get();
+
+    const Int m = V.Height();
+    const Int bsize = Blocksize();
+    const Grid& grid = L.Grid();
+    DistMatrix<F,STAR,STAR> L11_STAR_STAR(grid), V1_STAR_STAR(grid),
+      T_STAR_STAR(grid);
+
+    Matrix<F> t;
+    for( Int k=0; k<m; k+=bsize )
+    {
+        const Int nb = Min(bsize,m-k);
+        const IR ind1( k, k+nb ), ind2( k+nb, END );
+
+        auto L11 = L( ind1, ind1 );
+        auto L21 = L( ind2, ind1 );
+
+        auto V1 = V( ind1, ALL );
+        auto V2 = V( ind2, ALL );
+
+        // Every process redundantly runs the sweep over the diagonal block
+        L11_STAR_STAR = L11;
+        V1_STAR_STAR = V1;
+        LowerPanelMod
+        ( L11_STAR_STAR.Matrix(), V1_STAR_STAR.Matrix(), t, downdate );
+        T_STAR_STAR.Resize( nb, nb );
+        LowerModTriangularFactor
+        ( V1_STAR_STAR.LockedMatrix(), t, T_STAR_STAR.Matrix(), downdate );
+        L11 = L11_STAR_STAR;
+        V1 = V1_STAR_STAR;
+
+        LowerModApply( L21, V2, V1, T_STAR_STAR, downdate );
+        ScaleTrapezoid( F(-1), LOWER, L11 );
+        L21 *= -1;
+    }
+}
+
 } // namespace mod
 
 template<typename F>
@@ -239,12 +447,18 @@ void LowerMod( Matrix<F>& L, Base<F> alpha, Matrix<F>& V )
     else if( alpha > Real(0) )
     {
         V *= Sqrt(alpha);
-        mod::LowerUpdate( L, V );
+        if( V.Width() > 1 )
+            mod::LowerBlockedMod( L, V, false );
+        else
+            mod::LowerUpdate( L, V );
     }
     else
     {
         V *= Sqrt(-alpha);
-        mod::LowerDowndate( L, V );
+        if( V.Width() > 1 )
+            mod::LowerBlockedMod( L, V, true );
+        else
+            mod::LowerDowndate( L, V );
     }
 }
 
@@ -261,12 +475,18 @@ void LowerMod
     else if( alpha > Real(0) )
     {
         V *= Sqrt(alpha);
-        mod::LowerUpdate( L, V );
+        if( V.Width() > 1 )
+            mod::LowerBlockedMod( L, V, false );
+        else
+            mod::LowerUpdate( L, V );
     }
     else
     {
         V *= Sqrt(-alpha);
-        mod::LowerDowndate( L, V );
+        if( V.Width() > 1 )
+            mod::LowerBlockedMod( L, V, true );
+        else
+            mod::LowerDowndate( L, V );
     }
 }
 
@@ -23,7 +23,7 @@ void LowerVariant2Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky" );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -48,6 +48,7 @@ template<typename F>
 void LowerVariant2Blocked( AbstractDistMatrix<F>& APre )
 {
     EL_DEBUG_CSE
+    EL_REGION("cholesky::LowerVariant2Blocked");
     EL_DEBUG_ONLY(
       if( APre.Height() != APre.Width() )
           LogicError("Can only compute Cholesky factor of square matrices");
@@ -64,7 +65,7 @@ void LowerVariant2Blocked( AbstractDistMatrix<F>& APre )
     DistMatrix<F,MC,  STAR> X21_MC_STAR(grid);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky", APre.Grid() );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -49,7 +49,7 @@ void LowerVariant3Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky" );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -71,6 +71,7 @@ template<typename F>
 void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
 {
     EL_DEBUG_CSE
+    EL_REGION("cholesky::LowerVariant3Blocked");
     EL_DEBUG_ONLY(
       if( APre.Height() != APre.Width() )
           LogicError("Can only compute Cholesky factor of square matrices");
@@ -87,7 +88,7 @@ void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(grid);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky", APre.Grid() );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -125,6 +126,120 @@ void LowerVariant3Blocked( AbstractDistMatrix<F>& APre )
     }
 }
 
+// The same algorithm with a lookahead of one panel: the columns of the next
+// panel are updated first so that the redistributions needed to factor it can
+// proceed in the background of the rest of the trailing update.
+template<typename F>
+void LowerVariant3Pipelined( AbstractDistMatrix<F>& APre )
+{
+    EL_DEBUG_CSE
+    EL_REGION("cholesky::LowerVariant3Pipelined");
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
+    DistMatrix<F,VC,  STAR> A21_VC_STAR(grid);
+    DistMatrix<F,VR,  STAR> A21_VR_STAR(grid);
+    DistMatrix<F,STAR,MC  > A21Trans_STAR_MC(grid);
+    DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(grid);
+    CopyRequest<F> A11Request, A21Request;
+
+    const Int n = A.Height();
+    const Int bsize = TunedBlocksize<F>( "Cholesky", APre.Grid() );
+
+    // Begin gathering the (fully updated) panel starting at index k
+    auto startPanel =
+      [&]( Int k )
+      {
+          const Int nb = Min(bsize,n-k);
+          const Range<Int> ind1( k,    k+nb ),
+                           ind2( k+nb, n    );
+          A21_VC_STAR.AlignWith( A( ind2, ind2 ) );
+          CopyAsync( A( ind1, ind1 ), A11_STAR_STAR, A11Request );
+          CopyAsync( A( ind2, ind1 ), A21_VC_STAR, A21Request );
+      };
+
+    // Factor the panel starting at index k and form the redistributions of
+    // its subdiagonal block needed by the trailing update
+    auto finishPanel =
+      [&]( Int k )
+      {
+          const Int nb = Min(bsize,n-k);
+          const Range<Int> ind1( k,    k+nb ),
+                           ind2( k+nb, n    );
+          auto A11 = A( ind1, ind1 );
+          auto A22 = A( ind2, ind2 );
+
+          A11Request.Wait();
+          Cholesky( LOWER, A11_STAR_STAR );
+          A11 = A11_STAR_STAR;
+
+          A21Request.Wait();
+          LocalTrsm
+          ( RIGHT, LOWER, ADJOINT, NON_UNIT,
+            F(1), A11_STAR_STAR, A21_VC_STAR );
+
+          A21_VR_STAR.AlignWith( A22 );
+          A21_VR_STAR = A21_VC_STAR;
+          A21Trans_STAR_MC.AlignWith( A22 );
+          A21Adj_STAR_MR.AlignWith( A22 );
+          Transpose( A21_VC_STAR, A21Trans_STAR_MC );
+          Adjoint( A21_VR_STAR, A21Adj_STAR_MR );
+      };
+
+    if( n > 0 )
+    {
+        startPanel( 0 );
+        finishPanel( 0 );
+    }
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int nbNext = Min(bsize,n-k-nb);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        if( nbNext > 0 )
+        {
+            // Update the columns of the next panel and start factoring it
+            const Range<Int> indL( 0, nbNext ), indR( nbNext, END );
+            auto A22TL = A22( indL, indL );
+            auto A22BL = A22( indR, indL );
+            auto A22BR = A22( indR, indR );
+            auto A21Trans_STAR_MC_L = A21Trans_STAR_MC( ALL, indL );
+            auto A21Trans_STAR_MC_R = A21Trans_STAR_MC( ALL, indR );
+            auto A21Adj_STAR_MR_L = A21Adj_STAR_MR( ALL, indL );
+            auto A21Adj_STAR_MR_R = A21Adj_STAR_MR( ALL, indR );
+
+            LocalTrrk
+            ( LOWER, TRANSPOSE,
+              F(-1), A21Trans_STAR_MC_L, A21Adj_STAR_MR_L, F(1), A22TL );
+            LocalGemm
+            ( TRANSPOSE, NORMAL,
+              F(-1), A21Trans_STAR_MC_R, A21Adj_STAR_MR_L, F(1), A22BL );
+            startPanel( k+nb );
+
+            LocalTrrk
+            ( LOWER, TRANSPOSE,
+              F(-1), A21Trans_STAR_MC_R, A21Adj_STAR_MR_R, F(1), A22BR );
+        }
+
+        Transpose( A21Trans_STAR_MC, A21 );
+        if( nbNext > 0 )
+            finishPanel( k+nb );
+    }
+}
+
 } // namespace cholesky
 } // namespace El
 
@@ -0,0 +1,120 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_PACKED_HPP
+#define EL_CHOLESKY_PACKED_HPP
+
+namespace El {
+namespace cholesky {
+
+// The right-looking algorithm of LowerVariant3Blocked, with the blocksize of
+// the packed storage, where the Herk of the trailing matrix is performed as
+// a local Gemm into each of the trailing packed block columns
+template<typename F>
+void Packed( DistPackedMatrix<F>& A )
+{
+    EL_DEBUG_CSE
+    EL_REGION("cholesky::Packed");
+    const Grid& grid = A.Grid();
+    const Int n = A.Height();
+    const Int numBlocks = A.NumBlocks();
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
+    DistMatrix<F,VC,  STAR> A21_VC_STAR(grid);
+    DistMatrix<F,VR,  STAR> A21_VR_STAR(grid);
+    DistMatrix<F,STAR,MC  > A21Trans_STAR_MC(grid);
+    DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(grid);
+
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const Int nb = A.BlockWidth(b);
+        auto ABlock = A.BlockColumn(b);
+        auto A11 = ABlock( IR(0,nb), ALL );
+
+        A11_STAR_STAR = A11;
+        Cholesky( LOWER, A11_STAR_STAR );
+        A11 = A11_STAR_STAR;
+        if( b+1 == numBlocks )
+            break;
+
+        auto A21 = ABlock( IR(nb,END), ALL );
+        auto ANext = A.BlockColumn(b+1);
+        const Int offset2 = A.BlockOffset(b+1);
+
+        A21_VC_STAR.AlignWith( ANext );
+        A21_VC_STAR = A21;
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A21_VC_STAR );
+
+        A21_VR_STAR.AlignWith( ANext );
+        A21_VR_STAR = A21_VC_STAR;
+        A21Trans_STAR_MC.AlignWith( ANext );
+        A21Adj_STAR_MR.AlignWith( ANext );
+        Transpose( A21_VC_STAR, A21Trans_STAR_MC );
+        Adjoint( A21_VR_STAR, A21Adj_STAR_MR );
+
+        for( Int c=b+1; c<numBlocks; ++c )
+        {
+            const Int offset = A.BlockOffset(c) - offset2;
+            auto ACol = A.BlockColumn(c);
+            LocalGemm
+            ( TRANSPOSE, NORMAL,
+              F(-1), A21Trans_STAR_MC( ALL, IR(offset,n-offset2) ),
+                     A21Adj_STAR_MR( ALL, IR(offset,offset+A.BlockWidth(c)) ),
+              F(1), ACol );
+        }
+
+        Transpose( A21Trans_STAR_MC, A21 );
+    }
+}
+
+template<typename F>
+void SolveAfter( const DistPackedMatrix<F>& L, AbstractDistMatrix<F>& BPre )
+{
+    EL_DEBUG_CSE
+    if( L.Height() != BPre.Height() )
+        LogicError("L and B must be the same height");
+    if( L.Grid() != BPre.Grid() )
+        LogicError("L and B must be distributed over the same grid");
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+
+    const Int n = L.Height();
+    const Int numBlocks = L.NumBlocks();
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const Int offset = L.BlockOffset(b);
+        const Int nb = L.BlockWidth(b);
+        auto LBlock = L.LockedBlockColumn(b);
+        auto L11 = LBlock( IR(0,nb), ALL );
+        auto L21 = LBlock( IR(nb,END), ALL );
+        auto B1 = B( IR(offset,offset+nb), ALL );
+        auto B2 = B( IR(offset+nb,n), ALL );
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), L11, B1 );
+        if( b+1 < numBlocks )
+            Gemm( NORMAL, NORMAL, F(-1), L21, B1, F(1), B2 );
+    }
+    for( Int b=numBlocks-1; b>=0; --b )
+    {
+        const Int offset = L.BlockOffset(b);
+        const Int nb = L.BlockWidth(b);
+        auto LBlock = L.LockedBlockColumn(b);
+        auto L11 = LBlock( IR(0,nb), ALL );
+        auto L21 = LBlock( IR(nb,END), ALL );
+        auto B1 = B( IR(offset,offset+nb), ALL );
+        auto B2 = B( IR(offset+nb,n), ALL );
+        if( b+1 < numBlocks )
+            Gemm( ADJOINT, NORMAL, F(-1), L21, B2, F(1), B1 );
+        Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, F(1), L11, B1 );
+    }
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_PACKED_HPP
@@ -355,7 +355,7 @@ void PivotedLowerVariant3Blocked( Matrix<F>& A, Permutation& P )
     P.ReserveSwaps( n );
 
     Matrix<F> XB1, YB1;
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky" );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -378,6 +378,7 @@ void PivotedLowerVariant3Blocked
   DistPermutation& P )
 {
     EL_DEBUG_CSE
+    EL_REGION("cholesky::PivotedLowerVariant3Blocked");
     EL_DEBUG_ONLY(
       if( APre.Height() != APre.Width() )
           LogicError("A must be square");
@@ -394,7 +395,7 @@ void PivotedLowerVariant3Blocked
     const Grid& grid = A.Grid();
     DistMatrix<F,MC,STAR> XB1(grid);
     DistMatrix<F,MR,STAR> YB1(grid);
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky", APre.Grid() );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -50,7 +50,7 @@ void ReverseUpperVariant3Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky" );
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
@@ -73,6 +73,7 @@ template<typename F>
 void ReverseUpperVariant3Blocked( AbstractDistMatrix<F>& APre )
 {
     EL_DEBUG_CSE
+    EL_REGION("cholesky::ReverseUpperVariant3Blocked");
     EL_DEBUG_ONLY(
       if( APre.Height() != APre.Width() )
           LogicError("Can only compute Cholesky factor of square matrices");
@@ -89,7 +90,7 @@ void ReverseUpperVariant3Blocked( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MR  > A01Adj_STAR_MR(grid);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky", APre.Grid() );
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
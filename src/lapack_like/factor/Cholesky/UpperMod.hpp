@@ -9,8 +9,6 @@
 #ifndef EL_CHOLESKY_UPPER_MOD_HPP
 #define EL_CHOLESKY_UPPER_MOD_HPP
 
-// TODO: Blocked algorithms
-
 namespace El {
 namespace cholesky {
 
@@ -265,6 +263,31 @@ void UpperDowndate
     }
 }
 
+// Since U^H U = L L^H for L = U^H, the blocked algorithms for lower-triangular
+// factors are reused for modifications of rank greater than one
+template<typename F>
+void UpperBlockedMod( Matrix<F>& U, Matrix<F>& V, bool downdate )
+{
+    EL_DEBUG_CSE
+    Matrix<F> L;
+    Adjoint( U, L );
+    LowerBlockedMod( L, V, downdate );
+    Adjoint( L, U );
+}
+
+template<typename F>
+void UpperBlockedMod
+( AbstractDistMatrix<F>& U,
+  AbstractDistMatrix<F>& V,
+  bool downdate )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F> L(U.Grid());
+    Adjoint( U, L );
+    LowerBlockedMod( L, V, downdate );
+    Adjoint( L, U );
+}
+
 } // namespace mod
 
 template<typename F>
@@ -277,12 +300,18 @@ void UpperMod( Matrix<F>& U, Base<F> alpha, Matrix<F>& V )
     else if( alpha > Real(0) )
     {
         V *= Sqrt(alpha);
-        mod::UpperUpdate( U, V );
+        if( V.Width() > 1 )
+            mod::UpperBlockedMod( U, V, false );
+        else
+            mod::UpperUpdate( U, V );
     }
     else
     {
         V *= Sqrt(-alpha);
-        mod::UpperDowndate( U, V );
+        if( V.Width() > 1 )
+            mod::UpperBlockedMod( U, V, true );
+        else
+            mod::UpperDowndate( U, V );
     }
 }
 
@@ -299,12 +328,18 @@ void UpperMod
     else if( alpha > Real(0) )
     {
         V *= Sqrt(alpha);
-        mod::UpperUpdate( U, V );
+        if( V.Width() > 1 )
+            mod::UpperBlockedMod( U, V, false );
+        else
+            mod::UpperUpdate( U, V );
     }
     else
     {
         V *= Sqrt(-alpha);
-        mod::UpperDowndate( U, V );
+        if( V.Width() > 1 )
+            mod::UpperBlockedMod( U, V, true );
+        else
+            mod::UpperDowndate( U, V );
     }
 }
 
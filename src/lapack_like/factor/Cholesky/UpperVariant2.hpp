@@ -25,7 +25,7 @@ void UpperVariant2Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky" );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -50,6 +50,7 @@ template<typename F>
 void UpperVariant2Blocked( AbstractDistMatrix<F>& APre )
 {
     EL_DEBUG_CSE
+    EL_REGION("cholesky::UpperVariant2Blocked");
     EL_DEBUG_ONLY(
       if( APre.Height() != APre.Width() )
           LogicError("Can only compute Cholesky factor of square matrices");
@@ -69,7 +70,7 @@ void UpperVariant2Blocked( AbstractDistMatrix<F>& APre )
     DistMatrix<F> X11(grid), X12(grid);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky", APre.Grid() );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
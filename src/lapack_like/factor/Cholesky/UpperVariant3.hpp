@@ -54,7 +54,7 @@ void UpperVariant3Blocked( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky" );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -76,6 +76,7 @@ template<typename F>
 void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
 {
     EL_DEBUG_CSE
+    EL_REGION("cholesky::UpperVariant3Blocked");
     EL_DEBUG_ONLY(
       if( APre.Height() != APre.Width() )
           LogicError("Can only compute Cholesky factor of square matrices");
@@ -91,7 +92,7 @@ void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MR  > A12_STAR_MR(grid);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "Cholesky", APre.Grid() );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -122,6 +123,117 @@ void UpperVariant3Blocked( AbstractDistMatrix<F>& APre )
     }
 }
 
+// The same algorithm with a lookahead of one panel: the rows of the next
+// panel are updated first so that the redistributions needed to factor it can
+// proceed in the background of the rest of the trailing update.
+template<typename F>
+void UpperVariant3Pipelined( AbstractDistMatrix<F>& APre )
+{
+    EL_DEBUG_CSE
+    EL_REGION("cholesky::UpperVariant3Pipelined");
+    EL_DEBUG_ONLY(
+      if( APre.Height() != APre.Width() )
+          LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Grid& grid = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(grid);
+    DistMatrix<F,STAR,VR  > A12_STAR_VR(grid);
+    DistMatrix<F,STAR,MC  > A12_STAR_MC(grid);
+    DistMatrix<F,STAR,MR  > A12_STAR_MR(grid);
+    CopyRequest<F> A11Request, A12Request;
+
+    const Int n = A.Height();
+    const Int bsize = TunedBlocksize<F>( "Cholesky", APre.Grid() );
+
+    // Begin gathering the (fully updated) panel starting at index k
+    auto startPanel =
+      [&]( Int k )
+      {
+          const Int nb = Min(bsize,n-k);
+          const Range<Int> ind1( k,    k+nb ),
+                           ind2( k+nb, n    );
+          A12_STAR_VR.AlignWith( A( ind2, ind2 ) );
+          CopyAsync( A( ind1, ind1 ), A11_STAR_STAR, A11Request );
+          CopyAsync( A( ind1, ind2 ), A12_STAR_VR, A12Request );
+      };
+
+    // Factor the panel starting at index k and form the redistributions of
+    // its superdiagonal block needed by the trailing update
+    auto finishPanel =
+      [&]( Int k )
+      {
+          const Int nb = Min(bsize,n-k);
+          const Range<Int> ind1( k,    k+nb ),
+                           ind2( k+nb, n    );
+          auto A11 = A( ind1, ind1 );
+          auto A22 = A( ind2, ind2 );
+
+          A11Request.Wait();
+          Cholesky( UPPER, A11_STAR_STAR );
+          A11 = A11_STAR_STAR;
+
+          A12Request.Wait();
+          LocalTrsm
+          ( LEFT, UPPER, ADJOINT, NON_UNIT,
+            F(1), A11_STAR_STAR, A12_STAR_VR );
+
+          A12_STAR_MC.AlignWith( A22 );
+          A12_STAR_MC = A12_STAR_VR;
+          A12_STAR_MR.AlignWith( A22 );
+          A12_STAR_MR = A12_STAR_VR;
+      };
+
+    if( n > 0 )
+    {
+        startPanel( 0 );
+        finishPanel( 0 );
+    }
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int nbNext = Min(bsize,n-k-nb);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         ind2( k+nb, n    );
+
+        auto A12 = A( ind1, ind2 );
+        auto A22 = A( ind2, ind2 );
+
+        if( nbNext > 0 )
+        {
+            // Update the rows of the next panel and start factoring it
+            const Range<Int> indT( 0, nbNext ), indB( nbNext, END );
+            auto A22TL = A22( indT, indT );
+            auto A22TR = A22( indT, indB );
+            auto A22BR = A22( indB, indB );
+            auto A12_STAR_MC_T = A12_STAR_MC( ALL, indT );
+            auto A12_STAR_MC_B = A12_STAR_MC( ALL, indB );
+            auto A12_STAR_MR_T = A12_STAR_MR( ALL, indT );
+            auto A12_STAR_MR_B = A12_STAR_MR( ALL, indB );
+
+            LocalTrrk
+            ( UPPER, ADJOINT,
+              F(-1), A12_STAR_MC_T, A12_STAR_MR_T, F(1), A22TL );
+            LocalGemm
+            ( ADJOINT, NORMAL,
+              F(-1), A12_STAR_MC_T, A12_STAR_MR_B, F(1), A22TR );
+            startPanel( k+nb );
+
+            LocalTrrk
+            ( UPPER, ADJOINT,
+              F(-1), A12_STAR_MC_B, A12_STAR_MR_B, F(1), A22BR );
+        }
+
+        A12 = A12_STAR_MR;
+        if( nbNext > 0 )
+            finishPanel( k+nb );
+    }
+}
+
 } // namespace cholesky
 } // namespace El
 
@@ -0,0 +1,46 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+void CholeskyBatched( UpperOrLower uplo, vector<Matrix<Field>>& A )
+{
+    EL_DEBUG_CSE
+    EL_REGION("CholeskyBatched");
+    const Int batchSize = A.size();
+    for( Int b=0; b<batchSize; ++b )
+        if( A[b].Height() != A[b].Width() )
+            LogicError("Member ",b," of the Cholesky batch was not square");
+    ParallelFor( batchSize, [&]( Int b ) { Cholesky( uplo, A[b] ); } );
+}
+
+template<typename Field>
+void CholeskyBatched( UpperOrLower uplo, Int batchSize, Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    auto ABatch = BatchView( batchSize, A );
+    CholeskyBatched( uplo, ABatch );
+}
+
+#define PROTO(Field) \
+  template void CholeskyBatched \
+  ( UpperOrLower uplo, vector<Matrix<Field>>& A ); \
+  template void CholeskyBatched \
+  ( UpperOrLower uplo, Int batchSize, Matrix<Field>& A );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
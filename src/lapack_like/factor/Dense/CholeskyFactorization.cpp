@@ -0,0 +1,143 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+void CholeskyFactorization<Field>::Factor
+( UpperOrLower uplo, const Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    factored_ = false;
+    uplo_ = uplo;
+    factor_ = A;
+    Cholesky( uplo, factor_ );
+    factored_ = true;
+}
+
+template<typename Field>
+bool CholeskyFactorization<Field>::Factored() const EL_NO_EXCEPT
+{ return factored_; }
+
+template<typename Field>
+Int CholeskyFactorization<Field>::Height() const EL_NO_EXCEPT
+{ return factor_.Height(); }
+
+template<typename Field>
+void CholeskyFactorization<Field>::Solve
+( Matrix<Field>& B, Orientation orientation ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The matrix has not been factored");
+    if( B.Height() != factor_.Height() )
+        LogicError
+        ("Height of B, ",B.Height(),", did not match that of A, ",
+         factor_.Height());
+    cholesky::SolveAfter( uplo_, orientation, factor_, B );
+}
+
+template<typename Field>
+void CholeskyFactorization<Field>::Update
+( Base<Field> alpha, const Matrix<Field>& V )
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The matrix has not been factored");
+    // CholeskyMod overwrites its vectors
+    auto VCopy( V );
+    CholeskyMod( uplo_, factor_, alpha, VCopy );
+}
+
+template<typename Field>
+UpperOrLower CholeskyFactorization<Field>::Uplo() const EL_NO_EXCEPT
+{ return uplo_; }
+
+template<typename Field>
+const Matrix<Field>&
+CholeskyFactorization<Field>::Factors() const EL_NO_EXCEPT
+{ return factor_; }
+
+template<typename Field>
+void DistCholeskyFactorization<Field>::Factor
+( UpperOrLower uplo, const AbstractDistMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    factored_ = false;
+    uplo_ = uplo;
+    // An [MC,MR] matrix keeps its alignments
+    factor_.Empty();
+    factor_.SetGrid( A.Grid() );
+    Copy( A, factor_ );
+    Cholesky( uplo, factor_ );
+    factored_ = true;
+}
+
+template<typename Field>
+bool DistCholeskyFactorization<Field>::Factored() const EL_NO_EXCEPT
+{ return factored_; }
+
+template<typename Field>
+Int DistCholeskyFactorization<Field>::Height() const EL_NO_EXCEPT
+{ return factor_.Height(); }
+
+template<typename Field>
+void DistCholeskyFactorization<Field>::Solve
+( AbstractDistMatrix<Field>& B, Orientation orientation ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The matrix has not been factored");
+    if( B.Height() != factor_.Height() )
+        LogicError
+        ("Height of B, ",B.Height(),", did not match that of A, ",
+         factor_.Height());
+    auto& X = workspace_.Load( factor_, B );
+    cholesky::SolveAfter( uplo_, orientation, factor_, X );
+    workspace_.Store( B );
+}
+
+template<typename Field>
+void DistCholeskyFactorization<Field>::Update
+( Base<Field> alpha, const AbstractDistMatrix<Field>& V )
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The matrix has not been factored");
+    // CholeskyMod overwrites its vectors
+    DistMatrix<Field> VCopy( V );
+    CholeskyMod( uplo_, factor_, alpha, VCopy );
+}
+
+template<typename Field>
+UpperOrLower DistCholeskyFactorization<Field>::Uplo() const EL_NO_EXCEPT
+{ return uplo_; }
+
+template<typename Field>
+const DistMatrix<Field>&
+DistCholeskyFactorization<Field>::Factors() const EL_NO_EXCEPT
+{ return factor_; }
+
+#define PROTO(Field) \
+  template class CholeskyFactorization<Field>; \
+  template class DistCholeskyFactorization<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,119 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+void LDLFactorization<Field>::Factor
+( const Matrix<Field>& A,
+  bool conjugate,
+  const LDLPivotCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    factored_ = false;
+    conjugate_ = conjugate;
+    factors_ = A;
+    LDL( factors_, dSub_, P_, conjugate, ctrl );
+    factored_ = true;
+}
+
+template<typename Field>
+bool LDLFactorization<Field>::Factored() const EL_NO_EXCEPT
+{ return factored_; }
+
+template<typename Field>
+Int LDLFactorization<Field>::Height() const EL_NO_EXCEPT
+{ return factors_.Height(); }
+
+template<typename Field>
+void LDLFactorization<Field>::Solve
+( Matrix<Field>& B, Orientation orientation ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The matrix has not been factored");
+    if( B.Height() != factors_.Height() )
+        LogicError
+        ("Height of B, ",B.Height(),", did not match that of A, ",
+         factors_.Height());
+    const bool conjFlip = (orientation == ADJOINT && !conjugate_) ||
+                          (orientation == TRANSPOSE && conjugate_);
+    if( conjFlip )
+        Conjugate( B );
+    ldl::SolveAfter( factors_, dSub_, P_, B, conjugate_ );
+    if( conjFlip )
+        Conjugate( B );
+}
+
+template<typename Field>
+void DistLDLFactorization<Field>::Factor
+( const AbstractDistMatrix<Field>& A,
+  bool conjugate,
+  const LDLPivotCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    factored_ = false;
+    conjugate_ = conjugate;
+    // An [MC,MR] matrix keeps its alignments
+    factors_.Empty();
+    factors_.SetGrid( A.Grid() );
+    dSub_.SetGrid( A.Grid() );
+    P_.SetGrid( A.Grid() );
+    Copy( A, factors_ );
+    LDL( factors_, dSub_, P_, conjugate, ctrl );
+    factored_ = true;
+}
+
+template<typename Field>
+bool DistLDLFactorization<Field>::Factored() const EL_NO_EXCEPT
+{ return factored_; }
+
+template<typename Field>
+Int DistLDLFactorization<Field>::Height() const EL_NO_EXCEPT
+{ return factors_.Height(); }
+
+template<typename Field>
+void DistLDLFactorization<Field>::Solve
+( AbstractDistMatrix<Field>& B, Orientation orientation ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The matrix has not been factored");
+    if( B.Height() != factors_.Height() )
+        LogicError
+        ("Height of B, ",B.Height(),", did not match that of A, ",
+         factors_.Height());
+    auto& X = workspace_.Load( factors_, B );
+    const bool conjFlip = (orientation == ADJOINT && !conjugate_) ||
+                          (orientation == TRANSPOSE && conjugate_);
+    if( conjFlip )
+        Conjugate( X );
+    ldl::SolveAfter( factors_, dSub_, P_, X, conjugate_ );
+    if( conjFlip )
+        Conjugate( X );
+    workspace_.Store( B );
+}
+
+#define PROTO(Field) \
+  template class LDLFactorization<Field>; \
+  template class DistLDLFactorization<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,136 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+void LUFactorization<Field>::Factor( const Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    factors_ = A;
+    LU( factors_, P_ );
+    factored_ = true;
+}
+
+template<typename Field>
+bool LUFactorization<Field>::Factored() const EL_NO_EXCEPT
+{ return factored_; }
+
+template<typename Field>
+Int LUFactorization<Field>::Height() const EL_NO_EXCEPT
+{ return factors_.Height(); }
+
+template<typename Field>
+void LUFactorization<Field>::Solve
+( Matrix<Field>& B, Orientation orientation ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The matrix has not been factored");
+    if( B.Height() != factors_.Height() )
+        LogicError
+        ("Height of B, ",B.Height(),", did not match that of A, ",
+         factors_.Height());
+    lu::SolveAfter( orientation, factors_, P_, B );
+}
+
+template<typename Field>
+void LUFactorization<Field>::Update
+( const Matrix<Field>& U, const Matrix<Field>& V, bool conjugate )
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The matrix has not been factored");
+    LUMod( factors_, P_, U, V, conjugate );
+}
+
+template<typename Field>
+const Matrix<Field>& LUFactorization<Field>::Factors() const EL_NO_EXCEPT
+{ return factors_; }
+
+template<typename Field>
+const Permutation& LUFactorization<Field>::RowPermutation() const EL_NO_EXCEPT
+{ return P_; }
+
+template<typename Field>
+void DistLUFactorization<Field>::Factor( const AbstractDistMatrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    // An [MC,MR] matrix keeps its alignments
+    factors_.Empty();
+    factors_.SetGrid( A.Grid() );
+    P_.SetGrid( A.Grid() );
+    Copy( A, factors_ );
+    LU( factors_, P_ );
+    factored_ = true;
+}
+
+template<typename Field>
+bool DistLUFactorization<Field>::Factored() const EL_NO_EXCEPT
+{ return factored_; }
+
+template<typename Field>
+Int DistLUFactorization<Field>::Height() const EL_NO_EXCEPT
+{ return factors_.Height(); }
+
+template<typename Field>
+void DistLUFactorization<Field>::Solve
+( AbstractDistMatrix<Field>& B, Orientation orientation ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The matrix has not been factored");
+    if( B.Height() != factors_.Height() )
+        LogicError
+        ("Height of B, ",B.Height(),", did not match that of A, ",
+         factors_.Height());
+    auto& X = workspace_.Load( factors_, B );
+    lu::SolveAfter( orientation, factors_, P_, X );
+    workspace_.Store( B );
+}
+
+template<typename Field>
+void DistLUFactorization<Field>::Update
+( const AbstractDistMatrix<Field>& U,
+  const AbstractDistMatrix<Field>& V,
+  bool conjugate )
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The matrix has not been factored");
+    LUMod( factors_, P_, U, V, conjugate );
+}
+
+template<typename Field>
+const DistMatrix<Field>&
+DistLUFactorization<Field>::Factors() const EL_NO_EXCEPT
+{ return factors_; }
+
+template<typename Field>
+const DistPermutation&
+DistLUFactorization<Field>::RowPermutation() const EL_NO_EXCEPT
+{ return P_; }
+
+#define PROTO(Field) \
+  template class LUFactorization<Field>; \
+  template class DistLUFactorization<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,80 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace dense_factor {
+
+template<typename Field>
+SolveWorkspace<Field>::SolveWorkspace()
+: toPlan_(new RedistPlan<Field>), fromPlan_(new RedistPlan<Field>)
+{ }
+
+template<typename Field>
+SolveWorkspace<Field>::~SolveWorkspace() { }
+
+// Replay 'plan' to copy A into B, rebuilding it (without persistent requests)
+// only if the layouts have changed
+template<typename Field>
+void PlannedCopy
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& B,
+        RedistPlan<Field>& plan )
+{
+    EL_DEBUG_CSE
+    B.Resize( A.Height(), A.Width() );
+    if( !plan.Matches( A, B ) )
+        plan.Setup( A, B, false );
+    plan.Execute( A, B );
+}
+
+template<typename Field>
+DistMatrix<Field>& SolveWorkspace<Field>::Load
+( const DistMatrix<Field>& factors, AbstractDistMatrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    AssertSameGrids( factors, B );
+    if( B.ColDist() == MC && B.RowDist() == MR && B.Wrap() == ELEMENT &&
+        B.ColAlign() == factors.ColAlign() )
+    {
+        inPlace_ = true;
+        return static_cast<DistMatrix<Field>&>(B);
+    }
+
+    inPlace_ = false;
+    if( X_.Grid() != factors.Grid() || X_.ColAlign() != factors.ColAlign() )
+    {
+        X_.SetGrid( factors.Grid() );
+        X_.Empty();
+        X_.AlignCols( factors.ColAlign() );
+    }
+    // The plans are only rebuilt when the layout of B changes
+    PlannedCopy( B, X_, *toPlan_ );
+    return X_;
+}
+
+template<typename Field>
+void SolveWorkspace<Field>::Store( AbstractDistMatrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    if( !inPlace_ )
+        PlannedCopy( X_, B, *fromPlan_ );
+}
+
+#define PROTO(Field) template class SolveWorkspace<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace dense_factor
+} // namespace El
@@ -0,0 +1,209 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HODLR_ACA_HPP
+#define EL_HODLR_ACA_HPP
+
+namespace El {
+namespace hodlr {
+
+// Adaptive cross approximation with partial pivoting
+// ==================================================
+// Compress the block of the generated matrix with the (global) rows
+// [rowBeg,rowEnd) and columns [colBeg,colEnd) as U V^H. Each step evaluates
+// the residual of one row and one column of the block, and the
+// approximation stops once the Frobenius norm of the latest rank-one update
+// is at most relTol times that of the approximation. See
+//
+//   Mario Bebendorf,
+//   "Approximation of boundary element matrices",
+//   Numer. Math., Vol. 86, No. 4, pp. 565--589, 2000.
+//
+// Every process in 'comm' must call the routine. The calling process
+// evaluates, and returns, the rows of U within the (possibly empty) row range
+// [localRowBeg,localRowEnd) and the rows of V within the column range
+// [localColBeg,localColEnd), and the others are only communicated through a
+// handful of reductions of O(rank) entries per step. The rank is returned.
+
+template<typename Field>
+Int ACA
+( const function<Field(Int,Int)>& generator,
+  Int rowBeg, Int rowEnd,
+  Int colBeg, Int colEnd,
+  Int localRowBeg, Int localRowEnd,
+  Int localColBeg, Int localColEnd,
+  Base<Field> relTol,
+  Int maxRank,
+  Matrix<Field>& U,
+  Matrix<Field>& V,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int m = rowEnd - rowBeg;
+    const Int n = colEnd - colBeg;
+    const Int localHeight = localRowEnd - localRowBeg;
+    const Int localWidth = localColEnd - localColBeg;
+    const Int maxSteps = Min(maxRank,Min(m,n));
+
+    Matrix<Field> UWork, VWork;
+    Zeros( UWork, localHeight, maxSteps );
+    Zeros( VWork, localWidth, maxSteps );
+    vector<bool> usedRow( localHeight, false );
+
+    // The first unused row in the block (or rowEnd if there is none)
+    auto firstUnusedRow =
+      [&]()
+      {
+          Int localFirst = rowEnd;
+          for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+          {
+              if( !usedRow[iLoc] )
+              {
+                  localFirst = localRowBeg + iLoc;
+                  break;
+              }
+          }
+          return mpi::AllReduce( localFirst, mpi::MIN, comm );
+      };
+
+    Int rank = 0;
+    Int pivotRow = rowBeg;
+    Real approxNormSquared = 0;
+    Matrix<Field> buf, r, c;
+    Zeros( r, localWidth, 1 );
+    Zeros( c, localHeight, 1 );
+    while( rank < maxSteps && pivotRow < rowEnd )
+    {
+        const bool ownPivotRow =
+          pivotRow >= localRowBeg && pivotRow < localRowEnd;
+
+        // Share U(pivotRow,:)
+        // -------------------
+        Zeros( buf, rank, 1 );
+        if( ownPivotRow )
+        {
+            const Int iLoc = pivotRow - localRowBeg;
+            usedRow[iLoc] = true;
+            for( Int l=0; l<rank; ++l )
+                buf(l) = UWork(iLoc,l);
+        }
+        mpi::AllReduce( buf.Buffer(), rank, comm );
+
+        // r := the residual of row 'pivotRow' over the local columns
+        // ----------------------------------------------------------
+        ValueInt<Real> pivot;
+        pivot.value = -1;
+        pivot.index = -1;
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            Field rho = generator( pivotRow, localColBeg+jLoc );
+            for( Int l=0; l<rank; ++l )
+                rho -= buf(l)*Conj(VWork(jLoc,l));
+            r(jLoc) = rho;
+            const Real rhoAbs = Abs(rho);
+            if( rhoAbs > pivot.value )
+            {
+                pivot.value = rhoAbs;
+                pivot.index = localColBeg + jLoc;
+            }
+        }
+        pivot = mpi::AllReduce( pivot, mpi::MaxLocOp<Real>(), comm );
+        if( pivot.value <= Real(0) )
+        {
+            // The row is already reproduced, so try the next unused one
+            pivotRow = firstUnusedRow();
+            continue;
+        }
+        const Int pivotCol = pivot.index;
+
+        // Share the pivot and V(pivotCol,:)
+        // ---------------------------------
+        Zeros( buf, rank+1, 1 );
+        if( pivotCol >= localColBeg && pivotCol < localColEnd )
+        {
+            const Int jLoc = pivotCol - localColBeg;
+            buf(0) = r(jLoc);
+            for( Int l=0; l<rank; ++l )
+                buf(l+1) = VWork(jLoc,l);
+        }
+        mpi::AllReduce( buf.Buffer(), rank+1, comm );
+        const Field delta = buf(0);
+
+        // u := (the residual of column 'pivotCol') / delta and v := conj(r)
+        // -----------------------------------------------------------------
+        auto u = UWork( ALL, IR(rank) );
+        auto v = VWork( ALL, IR(rank) );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            Field gamma = generator( localRowBeg+iLoc, pivotCol );
+            for( Int l=0; l<rank; ++l )
+                gamma -= UWork(iLoc,l)*Conj(buf(l+1));
+            u(iLoc) = gamma / delta;
+        }
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            v(jLoc) = Conj(r(jLoc));
+
+        // Update || U V^H ||_F^2 with the new rank-one term
+        // -------------------------------------------------
+        // The inner products of the new columns with all of the columns are
+        // summed at once.
+        Zeros( buf, 2*rank+2, 1 );
+        auto UPrev = UWork( ALL, IR(0,rank) );
+        auto VPrev = VWork( ALL, IR(0,rank) );
+        auto UPrevAdj_u = buf( IR(0,rank), ALL );
+        auto VPrevAdj_v = buf( IR(rank,2*rank), ALL );
+        Gemv( ADJOINT, Field(1), UPrev, u, Field(0), UPrevAdj_u );
+        Gemv( ADJOINT, Field(1), VPrev, v, Field(0), VPrevAdj_v );
+        buf(2*rank) = Dot( u, u );
+        buf(2*rank+1) = Dot( v, v );
+        mpi::AllReduce( buf.Buffer(), 2*rank+2, comm );
+        const Real uNormSquared = RealPart(buf(2*rank));
+        const Real vNormSquared = RealPart(buf(2*rank+1));
+        Field cross = 0;
+        for( Int l=0; l<rank; ++l )
+            cross += buf(l)*Conj(buf(rank+l));
+        approxNormSquared += 2*RealPart(cross) + uNormSquared*vNormSquared;
+        ++rank;
+
+        const Real updateNorm = Sqrt(uNormSquared*vNormSquared);
+        if( !limits::IsFinite(updateNorm) )
+            RuntimeError("Cross approximation produced a non-finite number");
+        if( updateNorm <= relTol*Sqrt(Max(approxNormSquared,Real(0))) )
+            break;
+
+        // The next pivot row maximizes |u| over the unused rows
+        // -----------------------------------------------------
+        pivot.value = -1;
+        pivot.index = -1;
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Real uAbs = Abs(u(iLoc));
+            if( !usedRow[iLoc] && uAbs > pivot.value )
+            {
+                pivot.value = uAbs;
+                pivot.index = localRowBeg + iLoc;
+            }
+        }
+        pivot = mpi::AllReduce( pivot, mpi::MaxLocOp<Real>(), comm );
+        if( pivot.index < 0 )
+            break;
+        pivotRow = ( pivot.value > Real(0) ? pivot.index : firstUnusedRow() );
+    }
+
+    U.Empty();
+    V.Empty();
+    U = UWork( ALL, IR(0,rank) );
+    V = VWork( ALL, IR(0,rank) );
+    return rank;
+}
+
+} // namespace hodlr
+} // namespace El
+
+#endif // ifndef EL_HODLR_ACA_HPP
@@ -0,0 +1,325 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./ACA.hpp"
+
+namespace El {
+
+template<typename Field>
+DistHODLR<Field>::DistHODLR( const El::Grid& grid )
+: grid_(&grid)
+{ }
+
+template<typename Field>
+DistHODLR<Field>::DistHODLR
+( Int n,
+  const GeneratorType& generator,
+  const El::Grid& grid,
+  const HODLRCtrl<Base<Field>>& ctrl )
+: grid_(&grid)
+{
+    EL_DEBUG_CSE
+    Build( n, generator, ctrl );
+}
+
+template<typename Field>
+DistHODLR<Field>::~DistHODLR()
+{
+    if( !mpi::Finalized() )
+        FreeLevels();
+}
+
+template<typename Field>
+void DistHODLR<Field>::FreeLevels()
+{
+    EL_DEBUG_CSE
+    for( auto& level : levels_ )
+        mpi::Free( level.comm );
+    levels_.clear();
+}
+
+template<typename Field>
+void DistHODLR<Field>::SetGrid( const El::Grid& grid )
+{
+    EL_DEBUG_CSE
+    if( grid_ == &grid )
+        return;
+    FreeLevels();
+    grid_ = &grid;
+    height_ = maxRank_ = numEntries_ = 0;
+    factored_ = false;
+    local_ = HODLR<Field>();
+}
+
+template<typename Field>
+void DistHODLR<Field>::Build
+( Int n,
+  const GeneratorType& generator,
+  const HODLRCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    FreeLevels();
+    height_ = n;
+    factored_ = false;
+
+    // Match the row distribution of DistMultiVec
+    const int commSize = grid_->Size();
+    const int commRank = grid_->Rank();
+    Int blocksize = n / commSize;
+    if( blocksize*commSize < n || n == 0 )
+        ++blocksize;
+    auto firstRow = [&]( int q ) { return Min(Int(q)*blocksize,n); };
+    const Int localRowBeg = firstRow(commRank);
+    const Int localRowEnd = firstRow(commRank+1);
+
+    // Recursively bisect the team of processes which owns our rows
+    int teamBeg = 0, teamEnd = commSize;
+    mpi::Comm teamComm;
+    if( commSize > 1 )
+        mpi::Dup( grid_->Comm(), teamComm );
+    while( teamEnd-teamBeg > 1 )
+    {
+        const int teamMid = teamBeg + (teamEnd-teamBeg)/2;
+        const Int rowBeg = firstRow(teamBeg);
+        const Int rowMid = firstRow(teamMid);
+        const Int rowEnd = firstRow(teamEnd);
+
+        Level level;
+        level.comm = teamComm;
+        level.side = ( commRank < teamMid ? 0 : 1 );
+        const bool first = ( level.side == 0 );
+        const Int ownBeg0 = ( first ? localRowBeg : rowMid );
+        const Int ownEnd0 = ( first ? localRowEnd : rowMid );
+        const Int ownBeg1 = ( first ? rowEnd : localRowBeg );
+        const Int ownEnd1 = ( first ? rowEnd : localRowEnd );
+
+        // A(1,0) ~= U[1] V[0]^H
+        Matrix<Field> U, V;
+        level.ranks[1] =
+          hodlr::ACA
+          ( generator,
+            rowMid, rowEnd, rowBeg, rowMid,
+            ownBeg1, ownEnd1, ownBeg0, ownEnd0,
+            ctrl.relTol, ctrl.maxRank, U, V, teamComm );
+        if( first )
+            level.V = V;
+        else
+            level.U = U;
+        if( ctrl.hermitian )
+        {
+            // A(0,1) = A(1,0)^H ~= V[0] U[1]^H
+            level.ranks[0] = level.ranks[1];
+            if( first )
+                level.U = level.V;
+            else
+                level.V = level.U;
+        }
+        else
+        {
+            // A(0,1) ~= U[0] V[1]^H
+            level.ranks[0] =
+              hodlr::ACA
+              ( generator,
+                rowBeg, rowMid, rowMid, rowEnd,
+                ownBeg0, ownEnd0, ownBeg1, ownEnd1,
+                ctrl.relTol, ctrl.maxRank, U, V, teamComm );
+            if( first )
+                level.U = U;
+            else
+                level.V = V;
+        }
+        const int side = level.side;
+        levels_.push_back( std::move(level) );
+
+        if( first )
+            teamEnd = teamMid;
+        else
+            teamBeg = teamMid;
+        if( teamEnd-teamBeg > 1 )
+            mpi::Split( levels_.back().comm, side, commRank, teamComm );
+    }
+
+    local_.Build( localRowEnd-localRowBeg, generator, ctrl, localRowBeg );
+
+    Int localMaxRank = local_.MaxRank();
+    Int localNumEntries = local_.NumEntries();
+    for( const auto& level : levels_ )
+    {
+        localMaxRank = Max(localMaxRank,Max(level.ranks[0],level.ranks[1]));
+        localNumEntries += level.U.Height()*level.U.Width() +
+                           level.V.Height()*level.V.Width();
+    }
+    maxRank_ = mpi::AllReduce( localMaxRank, mpi::MAX, grid_->Comm() );
+    numEntries_ = mpi::AllReduce( localNumEntries, grid_->Comm() );
+}
+
+template<typename Field>
+Int DistHODLR<Field>::Height() const EL_NO_EXCEPT { return height_; }
+template<typename Field>
+Int DistHODLR<Field>::Width() const EL_NO_EXCEPT { return height_; }
+
+template<typename Field>
+const El::Grid& DistHODLR<Field>::Grid() const EL_NO_EXCEPT
+{ return *grid_; }
+
+template<typename Field>
+Int DistHODLR<Field>::MaxRank() const EL_NO_EXCEPT { return maxRank_; }
+template<typename Field>
+Int DistHODLR<Field>::NumEntries() const EL_NO_EXCEPT { return numEntries_; }
+
+template<typename Field>
+const HODLR<Field>& DistHODLR<Field>::LocalHODLR() const EL_NO_EXCEPT
+{ return local_; }
+
+template<typename Field>
+void DistHODLR<Field>::ApplyLevel
+( const Level& level, Field alpha,
+  const Matrix<Field>& XLoc, Matrix<Field>& YLoc ) const
+{
+    EL_DEBUG_CSE
+    // The rows of U[s] are stored by side s and those of V[s] by side s, and
+    // A(s,1-s) X(1-s) ~= U[s] (V[1-s]^H X(1-s)) requires summing the
+    // contributions to V[1-s]^H X(1-s) from side 1-s
+    const Int k0 = level.ranks[0];
+    const Int k = k0 + level.ranks[1];
+    if( k == 0 )
+        return;
+    const Range<Int> ind0(0,k0), ind1(k0,k);
+    const Range<Int> mine = ( level.side == 0 ? ind0 : ind1 );
+    const Range<Int> other = ( level.side == 0 ? ind1 : ind0 );
+    Matrix<Field> T;
+    Zeros( T, k, XLoc.Width() );
+    auto TOther = T( other, ALL );
+    Gemm( ADJOINT, NORMAL, Field(1), level.V, XLoc, Field(0), TOther );
+    mpi::AllReduce( T.Buffer(), k*XLoc.Width(), level.comm );
+    auto TMine = T( mine, ALL );
+    Gemm( NORMAL, NORMAL, alpha, level.U, TMine, Field(1), YLoc );
+}
+
+template<typename Field>
+void DistHODLR<Field>::Multiply
+( Field alpha, const DistMultiVec<Field>& X,
+  Field beta,        DistMultiVec<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    if( X.Height() != height_ || Y.Height() != height_ ||
+        X.Width() != Y.Width() )
+        LogicError
+        ("Cannot multiply a ",height_," x ",height_," DistHODLR matrix with a ",
+         X.Height()," x ",X.Width()," matrix to produce a ",Y.Height()," x ",
+         Y.Width()," matrix");
+    if( X.Grid() != *grid_ || Y.Grid() != *grid_ )
+        LogicError("Grids did not match");
+    auto& YLoc = Y.Matrix();
+    if( beta == Field(0) )
+        Zero( YLoc );
+    else
+        YLoc *= beta;
+    const auto& XLoc = X.LockedMatrix();
+    for( const auto& level : levels_ )
+        ApplyLevel( level, alpha, XLoc, YLoc );
+    local_.Multiply( alpha, XLoc, Field(1), YLoc );
+}
+
+template<typename Field>
+void DistHODLR<Field>::CorrectLevel
+( const Level& level, Matrix<Field>& BLoc ) const
+{
+    EL_DEBUG_CSE
+    // B -= diag(W[0],W[1]) inv(K) [V[1]^H B1; V[0]^H B0]
+    const Int k0 = level.ranks[0];
+    const Int k = k0 + level.ranks[1];
+    if( k == 0 )
+        return;
+    const Range<Int> ind0(0,k0), ind1(k0,k);
+    const Range<Int> mine = ( level.side == 0 ? ind0 : ind1 );
+    const Range<Int> other = ( level.side == 0 ? ind1 : ind0 );
+    Matrix<Field> T;
+    Zeros( T, k, BLoc.Width() );
+    auto TOther = T( other, ALL );
+    Gemm( ADJOINT, NORMAL, Field(1), level.V, BLoc, Field(0), TOther );
+    mpi::AllReduce( T.Buffer(), k*BLoc.Width(), level.comm );
+    lu::SolveAfter( NORMAL, level.K, level.PK, T );
+    auto TMine = T( mine, ALL );
+    Gemm( NORMAL, NORMAL, Field(-1), level.W, TMine, Field(1), BLoc );
+}
+
+template<typename Field>
+void DistHODLR<Field>::SolveBelow
+( Int firstLevel, Matrix<Field>& BLoc ) const
+{
+    EL_DEBUG_CSE
+    local_.Solve( BLoc );
+    const Int numLevels = levels_.size();
+    for( Int l=numLevels-1; l>=firstLevel; --l )
+        CorrectLevel( levels_[l], BLoc );
+}
+
+template<typename Field>
+void DistHODLR<Field>::Factor()
+{
+    EL_DEBUG_CSE
+    local_.Factor();
+    const Int numLevels = levels_.size();
+    for( Int l=numLevels-1; l>=0; --l )
+    {
+        Level& level = levels_[l];
+
+        // W := inv(A(side,side)) U, using the factorization of the levels
+        // below this one
+        level.W = level.U;
+        SolveBelow( l+1, level.W );
+
+        // K := I + [0, V[1]^H W[1]; V[0]^H W[0], 0]
+        const Int k0 = level.ranks[0];
+        const Int k = k0 + level.ranks[1];
+        const Range<Int> ind0(0,k0), ind1(k0,k);
+        const Range<Int> mine = ( level.side == 0 ? ind0 : ind1 );
+        const Range<Int> other = ( level.side == 0 ? ind1 : ind0 );
+        Matrix<Field> C;
+        Zeros( C, k, k );
+        auto COther = C( other, mine );
+        Gemm( ADJOINT, NORMAL, Field(1), level.V, level.W, Field(0), COther );
+        mpi::AllReduce( C.Buffer(), k*k, level.comm );
+        Identity( level.K, k, k );
+        level.K += C;
+        if( k > 0 )
+            LU( level.K, level.PK );
+    }
+    factored_ = true;
+}
+
+template<typename Field>
+bool DistHODLR<Field>::Factored() const EL_NO_EXCEPT { return factored_; }
+
+template<typename Field>
+void DistHODLR<Field>::Solve( DistMultiVec<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The DistHODLR matrix has not been factored");
+    if( B.Height() != height_ )
+        LogicError
+        ("Cannot solve against a ",B.Height()," x ",B.Width(),
+         " matrix with a ",height_," x ",height_," DistHODLR matrix");
+    if( B.Grid() != *grid_ )
+        LogicError("Grids did not match");
+    SolveBelow( 0, B.Matrix() );
+}
+
+#define PROTO(Field) template class DistHODLR<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace El
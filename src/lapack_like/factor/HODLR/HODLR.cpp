@@ -0,0 +1,312 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./ACA.hpp"
+
+namespace El {
+
+template<typename Field>
+HODLR<Field>::HODLR() { }
+
+template<typename Field>
+HODLR<Field>::HODLR
+( Int n,
+  const GeneratorType& generator,
+  const HODLRCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    Build( n, generator, ctrl );
+}
+
+template<typename Field>
+void HODLR<Field>::Build
+( Int n,
+  const GeneratorType& generator,
+  const HODLRCtrl<Base<Field>>& ctrl,
+  Int offset )
+{
+    EL_DEBUG_CSE
+    if( ctrl.leafSize < 1 )
+        LogicError("The HODLR leaf size must be positive");
+    height_ = n;
+    hermitian_ = ctrl.hermitian;
+    factored_ = false;
+    nodes_.clear();
+    if( n > 0 )
+        BuildNode( generator, offset, n, ctrl );
+}
+
+template<typename Field>
+Int HODLR<Field>::BuildNode
+( const GeneratorType& generator,
+  Int offset,
+  Int size,
+  const HODLRCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    // NOTE: 'nodes_' may be reallocated by the recursion, and so references
+    //       to its entries are only formed once the children are built
+    const Int index = nodes_.size();
+    nodes_.emplace_back();
+    nodes_[index].offset = offset;
+    nodes_[index].size = size;
+    if( size <= ctrl.leafSize )
+    {
+        Node& node = nodes_[index];
+        node.D.Resize( size, size );
+        for( Int j=0; j<size; ++j )
+            for( Int i=0; i<size; ++i )
+                node.D(i,j) = generator( offset+i, offset+j );
+        return index;
+    }
+
+    const Int split = size/2;
+    Matrix<Field> U[2], V[2];
+    // A(1,0) ~= U[1] V[0]^H
+    hodlr::ACA
+    ( generator,
+      offset+split, offset+size,
+      offset,       offset+split,
+      offset+split, offset+size,
+      offset,       offset+split,
+      ctrl.relTol, ctrl.maxRank, U[1], V[0], mpi::COMM_SELF );
+    if( ctrl.hermitian )
+    {
+        U[0] = V[0];
+        V[1] = U[1];
+    }
+    else
+    {
+        // A(0,1) ~= U[0] V[1]^H
+        hodlr::ACA
+        ( generator,
+          offset,       offset+split,
+          offset+split, offset+size,
+          offset,       offset+split,
+          offset+split, offset+size,
+          ctrl.relTol, ctrl.maxRank, U[0], V[1], mpi::COMM_SELF );
+    }
+
+    const Int child0 = BuildNode( generator, offset, split, ctrl );
+    const Int child1 = BuildNode( generator, offset+split, size-split, ctrl );
+
+    Node& node = nodes_[index];
+    node.split = split;
+    node.children[0] = child0;
+    node.children[1] = child1;
+    for( Int s=0; s<2; ++s )
+    {
+        node.U[s] = U[s];
+        node.V[s] = V[s];
+    }
+    return index;
+}
+
+template<typename Field>
+Int HODLR<Field>::Height() const EL_NO_EXCEPT { return height_; }
+template<typename Field>
+Int HODLR<Field>::Width() const EL_NO_EXCEPT { return height_; }
+
+template<typename Field>
+Int HODLR<Field>::MaxRank() const EL_NO_EXCEPT
+{
+    Int maxRank = 0;
+    for( const auto& node : nodes_ )
+        maxRank = Max(maxRank,Max(node.U[0].Width(),node.U[1].Width()));
+    return maxRank;
+}
+
+template<typename Field>
+Int HODLR<Field>::NumEntries() const EL_NO_EXCEPT
+{
+    Int numEntries = 0;
+    for( const auto& node : nodes_ )
+    {
+        numEntries += node.D.Height()*node.D.Width();
+        for( Int s=0; s<2; ++s )
+        {
+            numEntries += node.U[s].Height()*node.U[s].Width();
+            numEntries += node.V[s].Height()*node.V[s].Width();
+        }
+    }
+    return numEntries;
+}
+
+template<typename Field>
+void HODLR<Field>::Multiply
+( Field alpha, const Matrix<Field>& X,
+  Field beta,        Matrix<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    if( X.Height() != height_ || Y.Height() != height_ ||
+        X.Width() != Y.Width() )
+        LogicError
+        ("Cannot multiply a ",height_," x ",height_," HODLR matrix with a ",
+         X.Height()," x ",X.Width()," matrix to produce a ",Y.Height()," x ",
+         Y.Width()," matrix");
+    if( beta == Field(0) )
+        Zero( Y );
+    else
+        Y *= beta;
+    if( height_ > 0 )
+        MultiplyNode( 0, alpha, X, Y );
+}
+
+template<typename Field>
+void HODLR<Field>::MultiplyNode
+( Int index, Field alpha, const Matrix<Field>& X, Matrix<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    const Node& node = nodes_[index];
+    if( node.children[0] < 0 )
+    {
+        Gemm( NORMAL, NORMAL, alpha, node.D, X, Field(1), Y );
+        return;
+    }
+    const Range<Int> ind0(0,node.split), ind1(node.split,node.size);
+    auto X0 = X( ind0, ALL );
+    auto X1 = X( ind1, ALL );
+    auto Y0 = Y( ind0, ALL );
+    auto Y1 = Y( ind1, ALL );
+
+    // Y0 += alpha U[0] (V[1]^H X1) and Y1 += alpha U[1] (V[0]^H X0)
+    Matrix<Field> T;
+    if( node.U[0].Width() > 0 )
+    {
+        Gemm( ADJOINT, NORMAL, Field(1), node.V[1], X1, T );
+        Gemm( NORMAL, NORMAL, alpha, node.U[0], T, Field(1), Y0 );
+    }
+    if( node.U[1].Width() > 0 )
+    {
+        Gemm( ADJOINT, NORMAL, Field(1), node.V[0], X0, T );
+        Gemm( NORMAL, NORMAL, alpha, node.U[1], T, Field(1), Y1 );
+    }
+    MultiplyNode( node.children[0], alpha, X0, Y0 );
+    MultiplyNode( node.children[1], alpha, X1, Y1 );
+}
+
+template<typename Field>
+void HODLR<Field>::Factor()
+{
+    EL_DEBUG_CSE
+    if( height_ > 0 )
+        FactorNode( 0 );
+    factored_ = true;
+}
+
+template<typename Field>
+bool HODLR<Field>::Factored() const EL_NO_EXCEPT { return factored_; }
+
+template<typename Field>
+void HODLR<Field>::FactorNode( Int index )
+{
+    EL_DEBUG_CSE
+    Node& node = nodes_[index];
+    if( node.children[0] < 0 )
+    {
+        node.DFact = node.D;
+        if( hermitian_ )
+            Cholesky( LOWER, node.DFact );
+        else
+            LU( node.DFact, node.P );
+        return;
+    }
+    FactorNode( node.children[0] );
+    FactorNode( node.children[1] );
+
+    // W[s] := inv(A(s,s)) U[s]
+    for( Int s=0; s<2; ++s )
+    {
+        node.W[s] = node.U[s];
+        SolveNode( node.children[s], node.W[s] );
+    }
+
+    // K := I + [0, V[1]^H W[1]; V[0]^H W[0], 0]
+    const Int k0 = node.U[0].Width();
+    const Int k1 = node.U[1].Width();
+    const Int k = k0 + k1;
+    Identity( node.K, k, k );
+    if( k0 > 0 && k1 > 0 )
+    {
+        auto K01 = node.K( IR(0,k0), IR(k0,k) );
+        auto K10 = node.K( IR(k0,k), IR(0,k0) );
+        Gemm
+        ( ADJOINT, NORMAL, Field(1), node.V[1], node.W[1], Field(1), K01 );
+        Gemm
+        ( ADJOINT, NORMAL, Field(1), node.V[0], node.W[0], Field(1), K10 );
+    }
+    if( k > 0 )
+        LU( node.K, node.PK );
+}
+
+template<typename Field>
+void HODLR<Field>::Solve( Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("The HODLR matrix has not been factored");
+    if( B.Height() != height_ )
+        LogicError
+        ("Cannot solve against a ",B.Height()," x ",B.Width(),
+         " matrix with a ",height_," x ",height_," HODLR matrix");
+    if( height_ > 0 )
+        SolveNode( 0, B );
+}
+
+template<typename Field>
+void HODLR<Field>::SolveNode( Int index, Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    const Node& node = nodes_[index];
+    if( node.children[0] < 0 )
+    {
+        if( hermitian_ )
+            cholesky::SolveAfter( LOWER, NORMAL, node.DFact, B );
+        else
+            lu::SolveAfter( NORMAL, node.DFact, node.P, B );
+        return;
+    }
+    const Range<Int> ind0(0,node.split), ind1(node.split,node.size);
+    auto B0 = B( ind0, ALL );
+    auto B1 = B( ind1, ALL );
+    SolveNode( node.children[0], B0 );
+    SolveNode( node.children[1], B1 );
+
+    // Apply the Woodbury correction, B -= diag(W[0],W[1]) inv(K) T, where
+    // T = [V[1]^H B1; V[0]^H B0]
+    const Int k0 = node.U[0].Width();
+    const Int k1 = node.U[1].Width();
+    const Int k = k0 + k1;
+    if( k == 0 )
+        return;
+    Matrix<Field> T;
+    Zeros( T, k, B.Width() );
+    auto T0 = T( IR(0,k0), ALL );
+    auto T1 = T( IR(k0,k), ALL );
+    if( k0 > 0 )
+        Gemm( ADJOINT, NORMAL, Field(1), node.V[1], B1, Field(0), T0 );
+    if( k1 > 0 )
+        Gemm( ADJOINT, NORMAL, Field(1), node.V[0], B0, Field(0), T1 );
+    lu::SolveAfter( NORMAL, node.K, node.PK, T );
+    if( k0 > 0 )
+        Gemm( NORMAL, NORMAL, Field(-1), node.W[0], T0, Field(1), B0 );
+    if( k1 > 0 )
+        Gemm( NORMAL, NORMAL, Field(-1), node.W[1], T1, Field(1), B1 );
+}
+
+#define PROTO(Field) template class HODLR<Field>;
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -19,6 +19,7 @@
 #include <El.hpp>
 
 #include "./LDL/dense/Var3.hpp"
+#include "./LDL/dense/Packed.hpp"
 
 #include "./LDL/dense/Pivoted.hpp"
 
@@ -52,6 +53,13 @@ template<typename Field>
 void LDL( DistMatrix<Field,STAR,STAR>& A, bool conjugate )
 { LDL( A.Matrix(), conjugate ); }
 
+template<typename Field>
+void LDL( DistPackedMatrix<Field>& A, bool conjugate )
+{
+    EL_DEBUG_CSE
+    ldl::Packed( A, conjugate );
+}
+
 // Pivoted
 // -------
 template<typename Field>
@@ -82,6 +90,7 @@ void LDL
   template void LDL( Matrix<Field>& A, bool conjugate ); \
   template void LDL( AbstractDistMatrix<Field>& A, bool conjugate ); \
   template void LDL( DistMatrix<Field,STAR,STAR>& A, bool conjugate ); \
+  template void LDL( DistPackedMatrix<Field>& A, bool conjugate ); \
   template void LDL \
   ( Matrix<Field>& A, \
     Matrix<Field>& dSub, \
@@ -129,6 +138,10 @@ void LDL
           AbstractDistMatrix<Field>& B, \
     bool conjugated ); \
   template void ldl::SolveAfter \
+  ( const DistPackedMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& B, \
+    bool conjugated ); \
+  template void ldl::SolveAfter \
   ( const Matrix<Field>& A, \
     const Matrix<Field>& dSub, \
     const Permutation& p, \
@@ -0,0 +1,139 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LDL_PACKED_HPP
+#define EL_LDL_PACKED_HPP
+
+namespace El {
+namespace ldl {
+
+// Var3 with the blocksize of the packed storage, where the symmetric rank-k
+// update of the trailing matrix is performed as a local Gemm into each of
+// the trailing packed block columns
+template<typename F>
+void Packed( DistPackedMatrix<F>& A, bool conjugate=false )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Int numBlocks = A.NumBlocks();
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g), d1_STAR_STAR(g);
+    DistMatrix<F,VC,  STAR> A21_VC_STAR(g);
+    DistMatrix<F,VR,  STAR> A21_VR_STAR(g);
+    DistMatrix<F,STAR,MC  > S21Trans_STAR_MC(g);
+    DistMatrix<F,STAR,MR  > A21Trans_STAR_MR(g);
+
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const Int nb = A.BlockWidth(b);
+        auto ABlock = A.BlockColumn(b);
+        auto A11 = ABlock( IR(0,nb), ALL );
+
+        A11_STAR_STAR = A11;
+        LDL( A11_STAR_STAR, conjugate );
+        GetDiagonal( A11_STAR_STAR, d1_STAR_STAR );
+        A11 = A11_STAR_STAR;
+        if( b+1 == numBlocks )
+            break;
+
+        auto A21 = ABlock( IR(nb,END), ALL );
+        auto ANext = A.BlockColumn(b+1);
+        const Int offset2 = A.BlockOffset(b+1);
+
+        A21_VC_STAR.AlignWith( ANext );
+        A21_VC_STAR = A21;
+        LocalTrsm
+        ( RIGHT, LOWER, orientation, UNIT,
+          F(1), A11_STAR_STAR, A21_VC_STAR );
+
+        S21Trans_STAR_MC.AlignWith( ANext );
+        Transpose( A21_VC_STAR, S21Trans_STAR_MC );
+        DiagonalSolve( RIGHT, NORMAL, d1_STAR_STAR, A21_VC_STAR );
+        A21_VR_STAR.AlignWith( ANext );
+        A21_VR_STAR = A21_VC_STAR;
+        A21Trans_STAR_MR.AlignWith( ANext );
+        Transpose( A21_VR_STAR, A21Trans_STAR_MR, conjugate );
+
+        for( Int c=b+1; c<numBlocks; ++c )
+        {
+            const Int offset = A.BlockOffset(c) - offset2;
+            auto ACol = A.BlockColumn(c);
+            LocalGemm
+            ( TRANSPOSE, NORMAL,
+              F(-1), S21Trans_STAR_MC( ALL, IR(offset,n-offset2) ),
+                     A21Trans_STAR_MR
+                     ( ALL, IR(offset,offset+A.BlockWidth(c)) ),
+              F(1), ACol );
+        }
+
+        A21 = A21_VC_STAR;
+    }
+}
+
+template<typename F>
+void SolveAfter
+( const DistPackedMatrix<F>& A,
+        AbstractDistMatrix<F>& BPre,
+  bool conjugated )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != BPre.Height() )
+        LogicError("A and B must be the same height");
+    if( A.Grid() != BPre.Grid() )
+        LogicError("A and B must be distributed over the same grid");
+    const Orientation orientation = ( conjugated ? ADJOINT : TRANSPOSE );
+    const bool checkIfSingular = false;
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& B = BProx.Get();
+
+    const Int n = A.Height();
+    const Int numBlocks = A.NumBlocks();
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const Int offset = A.BlockOffset(b);
+        const Int nb = A.BlockWidth(b);
+        auto ABlock = A.LockedBlockColumn(b);
+        auto A11 = ABlock( IR(0,nb), ALL );
+        auto A21 = ABlock( IR(nb,END), ALL );
+        auto B1 = B( IR(offset,offset+nb), ALL );
+        auto B2 = B( IR(offset+nb,n), ALL );
+        Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, B1 );
+        if( b+1 < numBlocks )
+            Gemm( NORMAL, NORMAL, F(-1), A21, B1, F(1), B2 );
+    }
+    for( Int b=0; b<numBlocks; ++b )
+    {
+        const Int offset = A.BlockOffset(b);
+        const Int nb = A.BlockWidth(b);
+        auto ABlock = A.LockedBlockColumn(b);
+        auto A11 = ABlock( IR(0,nb), ALL );
+        auto B1 = B( IR(offset,offset+nb), ALL );
+        const auto d1 = GetDiagonal( A11 );
+        DiagonalSolve( LEFT, NORMAL, d1, B1, checkIfSingular );
+    }
+    for( Int b=numBlocks-1; b>=0; --b )
+    {
+        const Int offset = A.BlockOffset(b);
+        const Int nb = A.BlockWidth(b);
+        auto ABlock = A.LockedBlockColumn(b);
+        auto A11 = ABlock( IR(0,nb), ALL );
+        auto A21 = ABlock( IR(nb,END), ALL );
+        auto B1 = B( IR(offset,offset+nb), ALL );
+        auto B2 = B( IR(offset+nb,n), ALL );
+        if( b+1 < numBlocks )
+            Gemm( orientation, NORMAL, F(-1), A21, B2, F(1), B1 );
+        Trsm( LEFT, LOWER, orientation, UNIT, F(1), A11, B1 );
+    }
+}
+
+} // namespace ldl
+} // namespace El
+
+#endif // ifndef EL_LDL_PACKED_HPP
@@ -12,6 +12,7 @@
 #include "./Pivoted/BunchKaufmanA.hpp"
 // TODO: Bunch-Kaufman C
 #include "./Pivoted/BunchKaufmanD.hpp"
+#include "./Pivoted/BunchKaufmanBounded.hpp"
 #include "./Pivoted/BunchParlett.hpp"
 
 #include "./Pivoted/Unblocked.hpp"
@@ -36,6 +37,7 @@ Pivoted
     case BUNCH_KAUFMAN_A:
     case BUNCH_KAUFMAN_C:
     case BUNCH_KAUFMAN_D:
+    case BUNCH_KAUFMAN_BOUNDED:
         pivot::Blocked( A, dSub, P, conjugate, ctrl.pivotType, ctrl.gamma );
         break;
     default:
@@ -58,6 +60,7 @@ Pivoted
     case BUNCH_KAUFMAN_A:
     case BUNCH_KAUFMAN_C:
     case BUNCH_KAUFMAN_D:
+    case BUNCH_KAUFMAN_BOUNDED:
         pivot::Blocked( A, dSub, P, conjugate, ctrl.pivotType, ctrl.gamma );
         break;
     default:
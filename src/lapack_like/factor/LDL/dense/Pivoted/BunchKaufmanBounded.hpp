@@ -0,0 +1,399 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LDL_PIVOTED_BUNCHKAUFMANBOUNDED_HPP
+#define EL_LDL_PIVOTED_BUNCHKAUFMANBOUNDED_HPP
+
+// Bounded Bunch-Kaufman (or "rook") pivoting, as in
+//
+//   C. Ashcraft, R. Grimes, and J. Lewis, "Accurate symmetric indefinite
+//   linear equation solvers", SIAM J. Matrix Anal. Appl., 1998.
+//
+// Rather than accepting a 2x2 pivot that merely satisfies the Bunch-Kaufman
+// test, the search walks from column to column until it finds either an
+// acceptable diagonal entry or an off-diagonal entry which is maximal in
+// both its row and column, which bounds the entries of L by 1/gamma. Since
+// each column is formed from the (lazily updated) panel, the search never
+// requires access to the trailing matrix beyond the candidate columns.
+
+namespace El {
+namespace ldl {
+namespace pivot {
+
+// Return the absolute value of the diagonal entry of column r of the lower
+// triangle of the symmetric matrix A, as well as the maximum off-diagonal
+// entry (exploiting symmetry) and its row index
+template<typename F>
+void BoundedColumnMax
+( const Matrix<F>& A, Int r, Base<F>& diagAbs, ValueInt<Base<F>>& offMax )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Range<Int> indr0( 0,   r   ),
+                     indr1( r,   r+1 ),
+                     indr2( r+1, n   );
+    diagAbs = Abs(A(r,r));
+    const auto leftMax   = VectorMaxAbsLoc( A(indr1,indr0) );
+    const auto bottomMax = VectorMaxAbsLoc( A(indr2,indr1) );
+    if( leftMax.value > bottomMax.value )
+    {
+        offMax = leftMax;
+    }
+    else
+    {
+        offMax.value = bottomMax.value;
+        offMax.index = bottomMax.index + (r+1);
+    }
+}
+
+template<typename F>
+void BoundedColumnMax
+( const DistMatrix<F>& A, Int r, Base<F>& diagAbs, ValueInt<Base<F>>& offMax )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Range<Int> indr0( 0,   r   ),
+                     indr1( r,   r+1 ),
+                     indr2( r+1, n   );
+    diagAbs = Abs(A.Get(r,r));
+    const auto leftMax   = VectorMaxAbsLoc( A(indr1,indr0) );
+    const auto bottomMax = VectorMaxAbsLoc( A(indr2,indr1) );
+    if( leftMax.value > bottomMax.value )
+    {
+        offMax = leftMax;
+    }
+    else
+    {
+        offMax.value = bottomMax.value;
+        offMax.index = bottomMax.index + (r+1);
+    }
+}
+
+template<typename F>
+LDLPivot
+BunchKaufmanBounded( const Matrix<F>& A, Base<F> gamma )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    if( gamma == Real(0) )
+        gamma = LDLPivotConstant<Real>( BUNCH_KAUFMAN_BOUNDED );
+
+    Real diagAbs;
+    ValueInt<Real> colMax;
+    BoundedColumnMax( A, 0, diagAbs, colMax );
+    if( colMax.value == Real(0) && diagAbs == Real(0) )
+        throw SingularMatrixException();
+
+    LDLPivot pivot;
+    if( diagAbs >= gamma*colMax.value )
+    {
+        pivot.nb = 1;
+        pivot.from[0] = 0;
+        return pivot;
+    }
+
+    // Walk from the column i to the column r of the largest entry of column i
+    Int i = 0;
+    Int r = colMax.index;
+    Real irAbs = colMax.value;
+    while( true )
+    {
+        BoundedColumnMax( A, r, diagAbs, colMax );
+        if( diagAbs >= gamma*colMax.value )
+        {
+            pivot.nb = 1;
+            pivot.from[0] = r;
+            return pivot;
+        }
+        if( colMax.index == i || colMax.value <= irAbs )
+        {
+            // Order the pair so that swapping the first candidate into
+            // position 0 does not move the second
+            pivot.nb = 2;
+            pivot.from[0] = Min(i,r);
+            pivot.from[1] = Max(i,r);
+            return pivot;
+        }
+        i = r;
+        r = colMax.index;
+        irAbs = colMax.value;
+    }
+}
+
+template<typename F>
+LDLPivot
+BunchKaufmanBounded( const DistMatrix<F>& A, Base<F> gamma )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    if( gamma == Real(0) )
+        gamma = LDLPivotConstant<Real>( BUNCH_KAUFMAN_BOUNDED );
+
+    Real diagAbs;
+    ValueInt<Real> colMax;
+    BoundedColumnMax( A, 0, diagAbs, colMax );
+    if( colMax.value == Real(0) && diagAbs == Real(0) )
+        throw SingularMatrixException();
+
+    LDLPivot pivot;
+    if( diagAbs >= gamma*colMax.value )
+    {
+        pivot.nb = 1;
+        pivot.from[0] = 0;
+        return pivot;
+    }
+
+    // Walk from the column i to the column r of the largest entry of column i
+    Int i = 0;
+    Int r = colMax.index;
+    Real irAbs = colMax.value;
+    while( true )
+    {
+        BoundedColumnMax( A, r, diagAbs, colMax );
+        if( diagAbs >= gamma*colMax.value )
+        {
+            pivot.nb = 1;
+            pivot.from[0] = r;
+            return pivot;
+        }
+        if( colMax.index == i || colMax.value <= irAbs )
+        {
+            pivot.nb = 2;
+            pivot.from[0] = Min(i,r);
+            pivot.from[1] = Max(i,r);
+            return pivot;
+        }
+        i = r;
+        r = colMax.index;
+        irAbs = colMax.value;
+    }
+}
+
+// Form column r of the active (bottom-right) portion of the lower triangle of
+// A - X Y^T out-of-place and return the same quantities as BoundedColumnMax,
+// where the row index is relative to the full panel
+template<typename F>
+void PanelBoundedColumnMax
+( const Matrix<F>& A,
+  const Matrix<F>& X,
+  const Matrix<F>& Y,
+  Int r,
+  Base<F>& diagAbs,
+  ValueInt<Base<F>>& offMax )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int k = X.Width();
+    const Range<Int> ind0( 0, k ),
+                     indrM( k, r   ),
+                     indr1( r, r+1 ), indr1Off( 0, 1   ),
+                                      indr2Off( 1, n-r ),
+                     indrB( r, n   );
+    auto aLeft   = A( indr1, indrM );
+    auto aBottom = A( indrB, indr1 );
+
+    auto zLeft( aLeft );
+    auto zBottom( aBottom );
+    auto zStrictBottom = zBottom( indr2Off, indr1Off );
+
+    // A(r,k:r-1) -= X(r,0:k-1) Y(k:r-1,0:k-1)^T
+    {
+        auto xr10 = X( indr1, ind0 );
+        auto YrM0 = Y( indrM, ind0 );
+        Gemv( NORMAL, F(-1), YrM0, xr10, F(1), zLeft );
+    }
+
+    // A(r:n-1,r) -= X(r:n-1,0:k-1) Y(r,0:k-1)^T
+    {
+        auto XrB0 = X( indrB, ind0 );
+        auto yr10 = Y( indr1, ind0 );
+        Gemv( NORMAL, F(-1), XrB0, yr10, F(1), zBottom );
+    }
+
+    diagAbs = Abs(zBottom(0));
+    const auto leftMax   = VectorMaxAbsLoc( zLeft );
+    const auto bottomMax = VectorMaxAbsLoc( zStrictBottom );
+    if( leftMax.value > bottomMax.value )
+    {
+        offMax.value = leftMax.value;
+        offMax.index = leftMax.index + k;
+    }
+    else
+    {
+        offMax.value = bottomMax.value;
+        offMax.index = bottomMax.index + (r+1);
+    }
+}
+
+template<typename F>
+void PanelBoundedColumnMax
+( const DistMatrix<F>& A,
+  const DistMatrix<F,MC,STAR>& X,
+  const DistMatrix<F,MR,STAR>& Y,
+  Int r,
+  Base<F>& diagAbs,
+  ValueInt<Base<F>>& offMax )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    const Int k = X.Width();
+    const Range<Int> ind0( 0, k ),
+                     indrM( k, r   ),
+                     indr1( r, r+1 ), indr1Off( 0, 1   ),
+                                      indr2Off( 1, n-r ),
+                     indrB( r, n   );
+    auto aLeft   = A( indr1, indrM );
+    auto aBottom = A( indrB, indr1 );
+
+    auto zLeft( aLeft );
+    auto zBottom( aBottom );
+    auto zStrictBottom = zBottom( indr2Off, indr1Off );
+
+    // A(r,k:r-1) -= X(r,0:k-1) Y(k:r-1,0:k-1)^T
+    if( aLeft.ColAlign() == aLeft.ColRank() )
+    {
+        auto xr10 = X( indr1, ind0 );
+        auto YrM0 = Y( indrM, ind0 );
+        LocalGemv( NORMAL, F(-1), YrM0, xr10, F(1), zLeft );
+    }
+
+    // A(r:n-1,r) -= X(r:n-1,0:k-1) Y(r,0:k-1)^T
+    if( aBottom.RowAlign() == aBottom.RowRank() )
+    {
+        auto XrB0 = X( indrB, ind0 );
+        auto yr10 = Y( indr1, ind0 );
+        LocalGemv( NORMAL, F(-1), XrB0, yr10, F(1), zBottom );
+    }
+
+    diagAbs = Abs(zBottom.Get(0,0));
+    const auto leftMax   = VectorMaxAbsLoc( zLeft );
+    const auto bottomMax = VectorMaxAbsLoc( zStrictBottom );
+    if( leftMax.value > bottomMax.value )
+    {
+        offMax.value = leftMax.value;
+        offMax.index = leftMax.index + k;
+    }
+    else
+    {
+        offMax.value = bottomMax.value;
+        offMax.index = bottomMax.index + (r+1);
+    }
+}
+
+template<typename F>
+LDLPivot
+PanelBunchKaufmanBounded
+( const Matrix<F>& A, const Matrix<F>& X, const Matrix<F>& Y, Base<F> gamma )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int k = X.Width();
+    if( gamma == Real(0) )
+        gamma = LDLPivotConstant<Real>( BUNCH_KAUFMAN_BOUNDED );
+
+    Real diagAbs;
+    ValueInt<Real> colMax;
+    PanelBoundedColumnMax( A, X, Y, k, diagAbs, colMax );
+    if( colMax.value == Real(0) && diagAbs == Real(0) )
+        throw SingularMatrixException();
+
+    LDLPivot pivot;
+    if( diagAbs >= gamma*colMax.value )
+    {
+        pivot.nb = 1;
+        pivot.from[0] = k;
+        return pivot;
+    }
+
+    // Walk from the column i to the column r of the largest entry of column i
+    Int i = k;
+    Int r = colMax.index;
+    Real irAbs = colMax.value;
+    while( true )
+    {
+        PanelBoundedColumnMax( A, X, Y, r, diagAbs, colMax );
+        if( diagAbs >= gamma*colMax.value )
+        {
+            pivot.nb = 1;
+            pivot.from[0] = r;
+            return pivot;
+        }
+        if( colMax.index == i || colMax.value <= irAbs )
+        {
+            pivot.nb = 2;
+            pivot.from[0] = Min(i,r);
+            pivot.from[1] = Max(i,r);
+            return pivot;
+        }
+        i = r;
+        r = colMax.index;
+        irAbs = colMax.value;
+    }
+}
+
+template<typename F>
+LDLPivot
+PanelBunchKaufmanBounded
+( const DistMatrix<F>& A,
+  const DistMatrix<F,MC,STAR>& X,
+  const DistMatrix<F,MR,STAR>& Y,
+  Base<F> gamma )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int k = X.Width();
+    if( A.ColAlign() != X.ColAlign() || A.RowAlign() != Y.ColAlign() )
+        LogicError("X and Y were not properly aligned with A");
+    if( gamma == Real(0) )
+        gamma = LDLPivotConstant<Real>( BUNCH_KAUFMAN_BOUNDED );
+
+    Real diagAbs;
+    ValueInt<Real> colMax;
+    PanelBoundedColumnMax( A, X, Y, k, diagAbs, colMax );
+    if( colMax.value == Real(0) && diagAbs == Real(0) )
+        throw SingularMatrixException();
+
+    LDLPivot pivot;
+    if( diagAbs >= gamma*colMax.value )
+    {
+        pivot.nb = 1;
+        pivot.from[0] = k;
+        return pivot;
+    }
+
+    // Walk from the column i to the column r of the largest entry of column i
+    Int i = k;
+    Int r = colMax.index;
+    Real irAbs = colMax.value;
+    while( true )
+    {
+        PanelBoundedColumnMax( A, X, Y, r, diagAbs, colMax );
+        if( diagAbs >= gamma*colMax.value )
+        {
+            pivot.nb = 1;
+            pivot.from[0] = r;
+            return pivot;
+        }
+        if( colMax.index == i || colMax.value <= irAbs )
+        {
+            pivot.nb = 2;
+            pivot.from[0] = Min(i,r);
+            pivot.from[1] = Max(i,r);
+            return pivot;
+        }
+        i = r;
+        r = colMax.index;
+        irAbs = colMax.value;
+    }
+}
+
+} // namespace pivot
+} // namespace ldl
+} // namespace El
+
+#endif // ifndef EL_LDL_PIVOTED_BUNCHKAUFMANBOUNDED_HPP
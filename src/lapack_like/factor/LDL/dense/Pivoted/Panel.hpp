@@ -29,6 +29,8 @@ SelectFromPanel
     case BUNCH_KAUFMAN_A:
     case BUNCH_KAUFMAN_C: pivot = PanelBunchKaufmanA( A, X, Y, gamma ); break;
     case BUNCH_KAUFMAN_D: pivot = PanelBunchKaufmanD( A, X, Y, gamma ); break;
+    case BUNCH_KAUFMAN_BOUNDED:
+        pivot = PanelBunchKaufmanBounded( A, X, Y, gamma ); break;
     default: LogicError("This pivot type not yet supported");
     }
     return pivot;
@@ -49,6 +51,8 @@ SelectFromPanel
     case BUNCH_KAUFMAN_A:
     case BUNCH_KAUFMAN_C: pivot = PanelBunchKaufmanA( A, X, Y, gamma ); break;
     case BUNCH_KAUFMAN_D: pivot = PanelBunchKaufmanD( A, X, Y, gamma ); break;
+    case BUNCH_KAUFMAN_BOUNDED:
+        pivot = PanelBunchKaufmanBounded( A, X, Y, gamma ); break;
     default: LogicError("This pivot type not yet supported");
     }
     return pivot;
@@ -106,8 +110,6 @@ Panel
             RowSwap( Y0, k, k+diagMax.index );
         }
         const auto pivot = SelectFromPanel( A, X0, Y0, pivotType, gamma );
-        const Int from = pivot.from[pivot.nb-1];
-        const Int to = k + (pivot.nb-1);
         if( k+pivot.nb > bsize )
         {
             X.Resize( n, bsize-1 );
@@ -116,10 +118,17 @@ Panel
         }
 
         // Apply the symmetric pivot
-        SymmetricSwap( LOWER, AFull, off+to, off+from, conjugate );
-        PFull.Swap( off+to, off+from );
-        RowSwap( X0, to, from );
-        RowSwap( Y0, to, from );
+        // NOTE: Bounded Bunch-Kaufman can move both members of a 2x2 pivot,
+        //       whereas the remaining strategies always have from[0]=k
+        for( Int l=0; l<pivot.nb; ++l )
+        {
+            const Int from = pivot.from[l];
+            const Int to = k + l;
+            SymmetricSwap( LOWER, AFull, off+to, off+from, conjugate );
+            PFull.Swap( off+to, off+from );
+            RowSwap( X0, to, from );
+            RowSwap( Y0, to, from );
+        }
 
         // Update the active columns and then store the new update factors
         const IR ind1( k, k+pivot.nb ), ind2( k+pivot.nb, n );
@@ -243,8 +252,6 @@ Panel
             RowSwap( Y0, k, k+diagMax.index );
         }
         const auto pivot = SelectFromPanel( A, X0, Y0, pivotType, gamma );
-        const Int from = pivot.from[pivot.nb-1];
-        const Int to = k + (pivot.nb-1);
         if( k+pivot.nb > bsize )
         {
             X.Resize( n, bsize-1 );
@@ -253,10 +260,17 @@ Panel
         }
 
         // Apply the symmetric pivot
-        SymmetricSwap( LOWER, AFull, off+to, off+from, conjugate );
-        PFull.Swap( off+to, off+from );
-        RowSwap( X0, to, from );
-        RowSwap( Y0, to, from );
+        // NOTE: Bounded Bunch-Kaufman can move both members of a 2x2 pivot,
+        //       whereas the remaining strategies always have from[0]=k
+        for( Int l=0; l<pivot.nb; ++l )
+        {
+            const Int from = pivot.from[l];
+            const Int to = k + l;
+            SymmetricSwap( LOWER, AFull, off+to, off+from, conjugate );
+            PFull.Swap( off+to, off+from );
+            RowSwap( X0, to, from );
+            RowSwap( Y0, to, from );
+        }
 
         // Update the active columns and then store the new update factors
         const IR ind1( k, k+pivot.nb ), ind2( k+pivot.nb, n );
@@ -24,6 +24,8 @@ Select( const Matrix<F>& A, LDLPivotType pivotType, Base<F> gamma )
     case BUNCH_KAUFMAN_A:
     case BUNCH_KAUFMAN_C: pivot = BunchKaufmanA( A, gamma ); break;
     case BUNCH_KAUFMAN_D: pivot = BunchKaufmanD( A, gamma ); break;
+    case BUNCH_KAUFMAN_BOUNDED:
+        pivot = BunchKaufmanBounded( A, gamma ); break;
     case BUNCH_PARLETT:   pivot = BunchParlett( A, gamma ); break;
     default: LogicError("This pivot type not yet supported");
     }
@@ -41,6 +43,8 @@ Select( const DistMatrix<F>& A, LDLPivotType pivotType, Base<F> gamma )
     case BUNCH_KAUFMAN_A:
     case BUNCH_KAUFMAN_C: pivot = BunchKaufmanA( A, gamma ); break;
     case BUNCH_KAUFMAN_D: pivot = BunchKaufmanD( A, gamma ); break;
+    case BUNCH_KAUFMAN_BOUNDED:
+        pivot = BunchKaufmanBounded( A, gamma ); break;
     case BUNCH_PARLETT:   pivot = BunchParlett( A, gamma ); break;
     default: LogicError("This pivot type not yet supported");
     }
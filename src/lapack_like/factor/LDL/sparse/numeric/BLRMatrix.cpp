@@ -0,0 +1,159 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+template<typename Field>
+Int BLRMatrix<Field>::NumEntries() const
+{
+    EL_DEBUG_CSE
+    Int numEntries = 0;
+    const Int numTiles = NumTiles();
+    for( Int t=0; t<numTiles; ++t )
+        numEntries += U[t].Height()*U[t].Width() + V[t].Height()*V[t].Width();
+    return numEntries;
+}
+
+template<typename Field>
+void BLRMatrix<Field>::Empty()
+{
+    EL_DEBUG_CSE
+    width = 0;
+    SwapClear( tileOffsets );
+    SwapClear( U );
+    SwapClear( V );
+}
+
+template<typename Field>
+void BLRMatrix<Field>::Compress
+( const Matrix<Field>& A, Int tileSize, Base<Field> tol )
+{
+    EL_DEBUG_CSE
+    if( tileSize <= 0 )
+        LogicError("The tile size must be positive");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numTiles = (m+tileSize-1) / tileSize;
+    width = n;
+    tileOffsets.resize( numTiles+1 );
+    for( Int t=0; t<=numTiles; ++t )
+        tileOffsets[t] = Min( t*tileSize, m );
+    U.resize( numTiles );
+    V.resize( numTiles );
+
+    QRCtrl<Base<Field>> ctrl;
+    ctrl.adaptive = true;
+    ctrl.tol = tol;
+    Matrix<Field> householderScalars;
+    Matrix<Base<Field>> signature;
+    Permutation Omega;
+    for( Int t=0; t<numTiles; ++t )
+    {
+        const Int tileHeight = tileOffsets[t+1] - tileOffsets[t];
+        auto ATile = A( IR(tileOffsets[t],tileOffsets[t+1]), ALL );
+
+        // A_t Omega^T ~= Q R, so that A_t ~= Q (R Omega)
+        auto QRTile = ATile;
+        QR( QRTile, householderScalars, signature, Omega, ctrl );
+        const Int rank = householderScalars.Height();
+        if( rank*(tileHeight+n) >= tileHeight*n )
+        {
+            U[t].Empty();
+            V[t] = ATile;
+            continue;
+        }
+
+        V[t] = QRTile( IR(0,rank), ALL );
+        MakeTrapezoidal( UPPER, V[t] );
+        Omega.InversePermuteCols( V[t] );
+
+        Identity( U[t], tileHeight, rank );
+        qr::ApplyQ
+        ( LEFT, NORMAL, QRTile, householderScalars, signature, U[t] );
+    }
+}
+
+template<typename Field>
+void BLRMatrix<Field>::Decompress( Matrix<Field>& A ) const
+{
+    EL_DEBUG_CSE
+    Zeros( A, Height(), Width() );
+    const Int numTiles = NumTiles();
+    for( Int t=0; t<numTiles; ++t )
+    {
+        auto ATile = A( IR(tileOffsets[t],tileOffsets[t+1]), ALL );
+        if( U[t].Height() == 0 )
+            ATile = V[t];
+        else
+            Gemm( NORMAL, NORMAL, Field(1), U[t], V[t], Field(0), ATile );
+    }
+}
+
+template<typename Field>
+void BLRMatrix<Field>::Multiply
+( Orientation orientation, Field alpha,
+  const Matrix<Field>& X, Matrix<Field>& Y ) const
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      const Int height = ( orientation == NORMAL ? Height() : Width() );
+      const Int width = ( orientation == NORMAL ? Width() : Height() );
+      if( X.Height() != width || Y.Height() != height ||
+          X.Width() != Y.Width() )
+          LogicError("Nonconformal BLR multiply");
+    )
+    const Int numTiles = NumTiles();
+    Matrix<Field> Z;
+    for( Int t=0; t<numTiles; ++t )
+    {
+        const Range<Int> tileInd( tileOffsets[t], tileOffsets[t+1] );
+        const bool dense = ( U[t].Height() == 0 );
+        if( orientation == NORMAL )
+        {
+            // Y_t += alpha U_t (V_t X)
+            auto YTile = Y( tileInd, ALL );
+            if( dense )
+            {
+                Gemm( NORMAL, NORMAL, alpha, V[t], X, Field(1), YTile );
+            }
+            else
+            {
+                Gemm( NORMAL, NORMAL, Field(1), V[t], X, Z );
+                Gemm( NORMAL, NORMAL, alpha, U[t], Z, Field(1), YTile );
+            }
+        }
+        else
+        {
+            // Y += alpha op(V_t) (op(U_t) X_t)
+            auto XTile = X( tileInd, ALL );
+            if( dense )
+            {
+                Gemm( orientation, NORMAL, alpha, V[t], XTile, Field(1), Y );
+            }
+            else
+            {
+                Gemm( orientation, NORMAL, Field(1), U[t], XTile, Z );
+                Gemm( orientation, NORMAL, alpha, V[t], Z, Field(1), Y );
+            }
+        }
+    }
+}
+
+#define PROTO(Field) template struct BLRMatrix<Field>;
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
@@ -55,6 +55,9 @@ template<typename F>
 void ChangeFrontType( DistFront<F>& front, LDLFrontType type, bool recurse )
 {
     EL_DEBUG_CSE
+    // Distributed fronts are always stored densely
+    if( BLRFactorization(type) )
+        type = RemoveBLR( type );
 
     if( type == SYMM_1D || type == ConvertTo1D(front.type) )
     {
@@ -0,0 +1,403 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_FACTOR_LDL_SPARSE_NUMERIC_CHECKPOINT_HPP
+#define EL_FACTOR_LDL_SPARSE_NUMERIC_CHECKPOINT_HPP
+
+// The checkpoint of a distributed sparse LDL factorization consists of a
+// block of bytes per process which holds the portion of the separator tree,
+// the elimination tree (up to, but not including, the results of the symbolic
+// analysis, which are cheaply recomputed), the reordering, and (optionally)
+// the numeric fronts which are owned by the process. Since the tree is tied
+// to the process layout, a checkpoint can only be restored over a
+// communicator of the same size.
+
+namespace El {
+namespace ldl {
+namespace checkpoint {
+
+// The first entry of each block
+const Int version = 1;
+
+class Packer
+{
+public:
+    template<typename T>
+    void Value( const T& value )
+    { Bytes( &value, sizeof(T) ); }
+
+    template<typename T>
+    void Vector( const vector<T>& values )
+    {
+        Value( Int(values.size()) );
+        Bytes( values.data(), values.size()*sizeof(T) );
+    }
+
+    template<typename T>
+    void Matrix( const El::Matrix<T>& A )
+    {
+        const Int height = A.Height();
+        const Int width = A.Width();
+        Value( height );
+        Value( width );
+        for( Int j=0; j<width; ++j )
+            Bytes( A.LockedBuffer(0,j), height*sizeof(T) );
+    }
+
+    template<typename T>
+    void DistMatrix( const ElementalMatrix<T>& A )
+    {
+        Value( A.Height() );
+        Value( A.Width() );
+        Value( A.ColAlign() );
+        Value( A.RowAlign() );
+        Matrix( A.LockedMatrix() );
+    }
+
+    vector<byte>& Buffer() { return buffer_; }
+
+private:
+    vector<byte> buffer_;
+
+    void Bytes( const void* data, size_t numBytes )
+    {
+        const byte* head = static_cast<const byte*>(data);
+        buffer_.insert( buffer_.end(), head, head+numBytes );
+    }
+};
+
+class Unpacker
+{
+public:
+    Unpacker( const vector<byte>& buffer )
+    : head_(buffer.data()), end_(buffer.data()+buffer.size())
+    { }
+
+    template<typename T>
+    T Value()
+    {
+        T value;
+        Bytes( &value, sizeof(T) );
+        return value;
+    }
+
+    template<typename T>
+    void Vector( vector<T>& values )
+    {
+        values.resize( Value<Int>() );
+        Bytes( values.data(), values.size()*sizeof(T) );
+    }
+
+    template<typename T>
+    void Matrix( El::Matrix<T>& A )
+    {
+        const Int height = Value<Int>();
+        const Int width = Value<Int>();
+        A.Resize( height, width );
+        for( Int j=0; j<width; ++j )
+            Bytes( A.Buffer(0,j), height*sizeof(T) );
+    }
+
+    // The grid of 'A' must already be set
+    template<typename T>
+    void DistMatrix( ElementalMatrix<T>& A )
+    {
+        const Int height = Value<Int>();
+        const Int width = Value<Int>();
+        const int colAlign = Value<int>();
+        const int rowAlign = Value<int>();
+        A.Empty();
+        A.Align( colAlign, rowAlign );
+        A.Resize( height, width );
+        const Int localHeight = Value<Int>();
+        const Int localWidth = Value<Int>();
+        if( localHeight != A.LocalHeight() || localWidth != A.LocalWidth() )
+            RuntimeError
+            ("Checkpointed local matrix was ",localHeight," x ",localWidth,
+             " rather than ",A.LocalHeight()," x ",A.LocalWidth());
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+            Bytes( A.Buffer(0,jLoc), localHeight*sizeof(T) );
+    }
+
+    bool Finished() const { return head_ == end_; }
+
+private:
+    const byte* head_;
+    const byte* end_;
+
+    void Bytes( void* data, size_t numBytes )
+    {
+        if( size_t(end_-head_) < numBytes )
+            RuntimeError("The checkpoint is truncated");
+        MemCopy( static_cast<byte*>(data), head_, numBytes );
+        head_ += numBytes;
+    }
+};
+
+// Sequential separator and elimination trees
+// ==========================================
+inline void PackTree( const Separator& sep, const NodeInfo& info, Packer& p )
+{
+    p.Value( sep.off );
+    p.Vector( sep.inds );
+    p.Value( info.size );
+    p.Value( info.off );
+    p.Vector( info.origLowerStruct );
+    const Int numChildren = info.children.size();
+    if( Int(sep.children.size()) != numChildren )
+        LogicError("Separator and elimination trees do not match");
+    p.Value( numChildren );
+    for( Int c=0; c<numChildren; ++c )
+        PackTree( *sep.children[c], *info.children[c], p );
+}
+
+inline void UnpackTree( Separator& sep, NodeInfo& info, Unpacker& u )
+{
+    sep.off = u.Value<Int>();
+    u.Vector( sep.inds );
+    info.size = u.Value<Int>();
+    info.off = u.Value<Int>();
+    u.Vector( info.origLowerStruct );
+    const Int numChildren = u.Value<Int>();
+    sep.children.resize( numChildren );
+    info.children.resize( numChildren );
+    for( Int c=0; c<numChildren; ++c )
+    {
+        sep.children[c].reset( new Separator(&sep) );
+        info.children[c].reset( new NodeInfo(&info) );
+        UnpackTree( *sep.children[c], *info.children[c], u );
+    }
+}
+
+// Distributed separator and elimination trees
+// ===========================================
+inline void PackTree
+( const DistSeparator& sep, const DistNodeInfo& info, Packer& p )
+{
+    p.Value( sep.off );
+    p.Vector( sep.inds );
+    p.Value( info.size );
+    p.Value( info.off );
+    p.Vector( info.origLowerStruct );
+    const bool haveChild = ( info.child != nullptr );
+    p.Value( haveChild );
+    if( haveChild )
+    {
+        // The child team is recreated by splitting our team with the same
+        // color and key as the bisection
+        p.Value( info.child->onLeft );
+        p.Value( info.child->Grid().Rank() );
+        PackTree( *sep.child, *info.child, p );
+    }
+    else
+        PackTree( *sep.duplicate, *info.duplicate, p );
+}
+
+inline void UnpackTree( DistSeparator& sep, DistNodeInfo& info, Unpacker& u )
+{
+    sep.off = u.Value<Int>();
+    u.Vector( sep.inds );
+    info.size = u.Value<Int>();
+    info.off = u.Value<Int>();
+    u.Vector( info.origLowerStruct );
+    const bool haveChild = u.Value<bool>();
+    if( haveChild )
+    {
+        const bool childIsOnLeft = u.Value<bool>();
+        const int childTeamRank = u.Value<int>();
+        mpi::Comm childComm;
+        mpi::Split
+        ( info.Grid().Comm(), childIsOnLeft, childTeamRank, childComm );
+        unique_ptr<Grid> childGrid( new Grid(childComm) );
+        mpi::Free( childComm );
+
+        sep.child.reset( new DistSeparator(&sep) );
+        info.child.reset( new DistNodeInfo(&info) );
+        info.child->AssignGrid( childGrid );
+        info.child->onLeft = childIsOnLeft;
+        UnpackTree( *sep.child, *info.child, u );
+    }
+    else
+    {
+        sep.duplicate.reset( new Separator(&sep) );
+        info.duplicate.reset( new NodeInfo(&info) );
+        UnpackTree( *sep.duplicate, *info.duplicate, u );
+    }
+}
+
+// Sequential fronts
+// =================
+template<typename Field>
+void PackFront( const Front<Field>& front, Packer& p )
+{
+    if( PivotedFactorization(front.type) )
+        LogicError("Pivoted factorizations cannot yet be checkpointed");
+    p.Value( front.type );
+    p.Value( front.sparseLeaf );
+    if( front.sparseLeaf )
+    {
+        const auto& L = front.LSparse;
+        const Int height = L.Height();
+        const Int numEntries = L.NumEntries();
+        p.Value( height );
+        p.Value( L.Width() );
+        p.Value( numEntries );
+        vector<Int> sources( L.LockedSourceBuffer(),
+                             L.LockedSourceBuffer()+numEntries );
+        vector<Int> targets( L.LockedTargetBuffer(),
+                             L.LockedTargetBuffer()+numEntries );
+        vector<Int> offsets( L.LockedOffsetBuffer(),
+                             L.LockedOffsetBuffer()+height+1 );
+        vector<Field> values( L.LockedValueBuffer(),
+                              L.LockedValueBuffer()+numEntries );
+        p.Vector( sources );
+        p.Vector( targets );
+        p.Vector( offsets );
+        p.Vector( values );
+    }
+    // Any factor which was offloaded out of core is read back in
+    El::Matrix<Field> buffer;
+    p.Matrix( front.DenseFactor(buffer) );
+    p.Value( front.LBLR.width );
+    p.Vector( front.LBLR.tileOffsets );
+    for( Int t=0; t<front.LBLR.NumTiles(); ++t )
+    {
+        p.Matrix( front.LBLR.U[t] );
+        p.Matrix( front.LBLR.V[t] );
+    }
+    p.Matrix( front.diag );
+    p.Matrix( front.subdiag );
+
+    const Int numChildren = front.children.size();
+    p.Value( numChildren );
+    for( Int c=0; c<numChildren; ++c )
+        PackFront( *front.children[c], p );
+}
+
+template<typename Field>
+void UnpackFront( Front<Field>& front, Unpacker& u )
+{
+    front.type = u.Value<LDLFrontType>();
+    front.sparseLeaf = u.Value<bool>();
+    front.workDense.Empty();
+    front.workSparse.Empty();
+    if( front.sparseLeaf )
+    {
+        auto& L = front.LSparse;
+        const Int height = u.Value<Int>();
+        const Int width = u.Value<Int>();
+        const Int numEntries = u.Value<Int>();
+        vector<Int> sources, targets, offsets;
+        vector<Field> values;
+        u.Vector( sources );
+        u.Vector( targets );
+        u.Vector( offsets );
+        u.Vector( values );
+        Zeros( L, height, width );
+        L.ForceNumEntries( numEntries );
+        std::copy( sources.begin(), sources.end(), L.SourceBuffer() );
+        std::copy( targets.begin(), targets.end(), L.TargetBuffer() );
+        std::copy( offsets.begin(), offsets.end(), L.OffsetBuffer() );
+        std::copy( values.begin(), values.end(), L.ValueBuffer() );
+        L.ForceConsistency();
+    }
+    else
+        front.LSparse.Empty();
+    front.store = nullptr;
+    front.storeOffset = -1;
+    u.Matrix( front.LDense );
+    front.LBLR.Empty();
+    front.LBLR.width = u.Value<Int>();
+    u.Vector( front.LBLR.tileOffsets );
+    const Int numTiles = Max( Int(front.LBLR.tileOffsets.size())-1, Int(0) );
+    front.LBLR.U.resize( numTiles );
+    front.LBLR.V.resize( numTiles );
+    for( Int t=0; t<numTiles; ++t )
+    {
+        u.Matrix( front.LBLR.U[t] );
+        u.Matrix( front.LBLR.V[t] );
+    }
+    u.Matrix( front.diag );
+    u.Matrix( front.subdiag );
+
+    const Int numChildren = u.Value<Int>();
+    if( numChildren != Int(front.children.size()) )
+        RuntimeError("The checkpointed fronts do not match the tree");
+    for( Int c=0; c<numChildren; ++c )
+        UnpackFront( *front.children[c], u );
+}
+
+// Distributed fronts
+// ==================
+template<typename Field>
+void PackFront( const DistFront<Field>& front, Packer& p )
+{
+    if( PivotedFactorization(front.type) )
+        LogicError("Pivoted factorizations cannot yet be checkpointed");
+    p.Value( front.type );
+    if( front.child == nullptr )
+    {
+        // The factor is attached to that of the sequential duplicate
+        PackFront( *front.duplicate, p );
+        return;
+    }
+    if( FrontIs1D(front.type) )
+        p.DistMatrix( front.L1D );
+    else
+        p.DistMatrix( front.L2D );
+    p.DistMatrix( front.diag );
+    p.DistMatrix( front.subdiag );
+    PackFront( *front.child, p );
+}
+
+template<typename Field>
+void UnpackFront
+( const DistNodeInfo& info, DistFront<Field>& front, Unpacker& u )
+{
+    const Grid& grid = info.Grid();
+    front.type = u.Value<LDLFrontType>();
+    front.work.Empty();
+    if( front.child == nullptr )
+    {
+        auto& frontDup = *front.duplicate;
+        UnpackFront( frontDup, u );
+        front.L1D.Empty();
+        front.L2D.Empty();
+        if( FrontIs1D(front.type) )
+            front.L1D.Attach( grid, frontDup.LDense );
+        else
+            front.L2D.Attach( grid, frontDup.LDense );
+        front.diag.Empty();
+        if( !BlockFactorization(front.type) )
+            front.diag.LockedAttach( grid, frontDup.diag );
+        return;
+    }
+    front.L1D.Empty();
+    front.L2D.Empty();
+    if( FrontIs1D(front.type) )
+    {
+        front.L1D.SetGrid( grid );
+        u.DistMatrix( front.L1D );
+    }
+    else
+    {
+        front.L2D.SetGrid( grid );
+        u.DistMatrix( front.L2D );
+    }
+    front.diag.SetGrid( grid );
+    u.DistMatrix( front.diag );
+    front.subdiag.SetGrid( grid );
+    u.DistMatrix( front.subdiag );
+    UnpackFront( *info.child, *front.child, u );
+}
+
+} // namespace checkpoint
+} // namespace ldl
+} // namespace El
+
+#endif // ifndef EL_FACTOR_LDL_SPARSE_NUMERIC_CHECKPOINT_HPP
@@ -67,22 +67,29 @@ void UnpackEntriesLocal
 {
     EL_DEBUG_CSE
 
-    // Delete any existing children
-    SwapClear( front.children );
-
+    // Reuse the existing children (and their storage) when refilling a tree
+    // of the same shape
     const Int numChildren = sep.children.size();
-    front.children.resize( numChildren );
+    if( Int(front.children.size()) != numChildren )
+    {
+        SwapClear( front.children );
+        front.children.resize( numChildren );
+        for( Int c=0; c<numChildren; ++c )
+            front.children[c].reset( new Front<Field>(&front) );
+    }
     for( Int c=0; c<numChildren; ++c )
     {
-        front.children[c].reset( new Front<Field>(&front) );
+        front.children[c]->type = front.type;
+        front.children[c]->isHermitian = front.isHermitian;
         UnpackEntriesLocal
         ( *sep.children[c], *node.children[c], *front.children[c],
           A, rRowLengths, rEntries, rTargets, offs, entryOffs );
     }
     // Mark this node as a sparse leaf if it does not have any children
     // and is not a duplicate of a dense distributed node
-    if( numChildren == 0 && !front.duplicate )
-        front.sparseLeaf = true;
+    front.sparseLeaf = ( numChildren == 0 && !front.duplicate );
+    // Any previously offloaded factor is superseded by the new entries
+    front.storeOffset = -1;
 
     const Int size = node.size;
     const Int off = node.off;
@@ -90,6 +97,7 @@ void UnpackEntriesLocal
 
     if( front.sparseLeaf )
     {
+        front.LSparse.Empty();
         front.workSparse.Empty();
         Zeros( front.workSparse, size, size );
         Zeros( front.LDense, lowerSize, size );
@@ -156,6 +164,7 @@ void UnpackEntriesLocal
     else
     {
         Zeros( front.LDense, size+lowerSize, size );
+        front.LBLR.Empty();
         for( Int t=0; t<size; ++t )
         {
             const Int i = sep.inds[t];
@@ -204,10 +213,15 @@ void UnpackEntries
 {
     EL_DEBUG_CSE
     const Grid& grid = node.Grid();
+    // The fronts are refilled in their 2D distribution
+    front.L1D.Empty();
 
     if( sep.child == nullptr )
     {
-        front.duplicate.reset( new Front<Field>(&front) );
+        if( front.duplicate == nullptr )
+            front.duplicate.reset( new Front<Field>(&front) );
+        front.duplicate->type = front.type;
+        front.duplicate->isHermitian = front.isHermitian;
         UnpackEntriesLocal
         ( *sep.duplicate, *node.duplicate, *front.duplicate,
           A, rRowLengths, rEntries, rTargets, offs, entryOffs );
@@ -216,7 +230,10 @@ void UnpackEntries
 
         return;
     }
-    front.child.reset( new DistFront<Field>(&front) );
+    if( front.child == nullptr )
+        front.child.reset( new DistFront<Field>(&front) );
+    front.child->type = front.type;
+    front.child->isHermitian = front.isHermitian;
     UnpackEntries
     ( *sep.child, *node.child, *front.child,
       A, rRowLengths, rEntries, rTargets, offs, entryOffs );
@@ -870,6 +887,8 @@ void DistFront<Field>::Unpack
             ( *sep.children[c], *node.children[c], *front.children[c] );
 
         const Int structSize = node.lowerStruct.size();
+        Matrix<Field> LBuffer;
+        const auto& LDense = front.DenseFactor( LBuffer );
         if( front.sparseLeaf )
         {
             // Queue the diagonal block
@@ -909,7 +928,7 @@ void DistFront<Field>::Unpack
                 const Int i = node.lowerStruct[s];
                 for( Int t=0; t<node.size; ++t )
                 {
-                    const Field value = front.LDense(s,t);
+                    const Field value = LDense(s,t);
                     if( value != Field(0) )
                         A.QueueUpdate( i, t+node.off, value );
                 }
@@ -922,18 +941,24 @@ void DistFront<Field>::Unpack
                 const Int i = node.off + s;
                 for( Int t=0; t<=s; ++t )
                 {
-                    const Field value = front.LDense(s,t);
+                    const Field value = LDense(s,t);
                     if( value != Field(0) )
                         A.QueueUpdate( i, t+node.off, value );
                 }
             }
 
+            // Expand the bottom-left block if it was compressed
+            Matrix<Field> LB;
+            if( front.LBLR.Height() > 0 )
+                front.LBLR.Decompress( LB );
+            else
+                LockedView( LB, LDense, IR(node.size,END), ALL );
             for( Int s=0; s<structSize; ++s )
             {
                 const Int i = node.lowerStruct[s];
                 for( Int t=0; t<node.size; ++t )
                 {
-                    const Field value = front.LDense(node.size+s,t);
+                    const Field value = LB(s,t);
                     if( value != Field(0) )
                         A.QueueUpdate( i, t+node.off, value );
                 }
@@ -13,6 +13,8 @@
 #include "./LowerSolve/Backward.hpp"
 #include "./LowerMultiply/Forward.hpp"
 #include "./LowerMultiply/Backward.hpp"
+#include "./Checkpoint.hpp"
+#include "../../../../../io/MPIIO.hpp"
 
 namespace El {
 
@@ -114,7 +116,8 @@ void DistSparseLDLFactorization<Field>::Initialize3DGridGraph
 }
 
 template<typename Field>
-void DistSparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
+void DistSparseLDLFactorization<Field>::Factor
+( LDLFrontType frontType, const ldl::BLRCtrl<Base<Field>>& blrCtrl )
 {
     EL_DEBUG_CSE
     if( !initialized_ )
@@ -127,14 +130,38 @@ void DistSparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
     // Convert from 1D to 2D if necessary
     ChangeFrontType( SYMM_2D );
 
+    // Discard the factors offloaded by any previous factorization
+    if( store_ )
+    {
+        store_->Clear();
+        ldl::DistFront<Field>* front = front_.get();
+        while( front->duplicate == nullptr )
+            front = front->child.get();
+        ldl::AttachStore( *front->duplicate, store_.get() );
+    }
+
     // Perform the initial factorization
-    ldl::Process( *info_, *front_, InitialFactorType(frontType) );
+    ldl::Process
+    ( *info_, *front_, InitialFactorType(frontType), blrCtrl, kernel_ );
     factored_ = true;
+    factorType_ = frontType;
+    blrCtrl_ = blrCtrl;
 
     // Convert the fronts from the initial factorization to the requested form
     ChangeFrontType( frontType );
 }
 
+template<typename Field>
+void DistSparseLDLFactorization<Field>::Refactor
+( const DistSparseMatrix<Field>& ANew )
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before Refactor()");
+    ChangeNonzeroValues( ANew );
+    Factor( factorType_, blrCtrl_ );
+}
+
 template<typename Field>
 void DistSparseLDLFactorization<Field>::ChangeFrontType
 ( LDLFrontType frontType )
@@ -145,6 +172,109 @@ void DistSparseLDLFactorization<Field>::ChangeFrontType
     ldl::ChangeFrontType( *front_, frontType );
 }
 
+template<typename Field>
+void DistSparseLDLFactorization<Field>::EnableOutOfCore
+( const string& directory )
+{
+    EL_DEBUG_CSE
+    if( factored_ )
+        LogicError("Must enable out-of-core storage before factoring");
+    store_.reset( new ldl::FrontStore<Field>(directory) );
+}
+
+template<typename Field>
+void DistSparseLDLFactorization<Field>::SetDenseFrontKernel
+( const ldl::DenseFrontKernel<Field>& kernel )
+{
+    EL_DEBUG_CSE
+    kernel_ = kernel;
+}
+
+template<typename Field>
+void DistSparseLDLFactorization<Field>::Save
+( const string& filename, bool numeric ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("Must initialize before calling 'Save()'");
+    const bool saveFronts = numeric && factored_;
+    if( saveFronts && !IsPacked<Field>::value )
+        LogicError("Only the fronts of packed datatypes can be checkpointed");
+
+    ldl::checkpoint::Packer p;
+    p.Value( ldl::checkpoint::version );
+    p.Value( Int(sizeof(Field)) );
+    p.Value( front_->isHermitian );
+    p.Value( map_.NumSources() );
+    p.Vector( map_.Map() );
+    p.Vector( inverseMap_.Map() );
+    ldl::checkpoint::PackTree( *separator_, *info_, p );
+    p.Value( saveFronts );
+    if( saveFronts )
+    {
+        p.Value( factorType_ );
+        p.Value( blrCtrl_.tileSize );
+        p.Value( blrCtrl_.tol );
+        ldl::checkpoint::PackFront( *front_, p );
+    }
+    mpi_io::WriteBlocks( p.Buffer(), filename, info_->Grid().Comm() );
+}
+
+template<typename Field>
+void DistSparseLDLFactorization<Field>::Load
+( const DistSparseMatrix<Field>& A,
+  const string& filename,
+  const BisectCtrl& bisectCtrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    vector<byte> block;
+    mpi_io::ReadBlocks( block, filename, grid.Comm() );
+    ldl::checkpoint::Unpacker u( block );
+    if( u.Value<Int>() != ldl::checkpoint::version )
+        RuntimeError("Unsupported checkpoint version in ",filename);
+    if( u.Value<Int>() != Int(sizeof(Field)) )
+        RuntimeError(filename," was written for a different datatype");
+    const bool hermitian = u.Value<bool>();
+    const Int numSources = u.Value<Int>();
+    if( numSources != A.Height() )
+        RuntimeError
+        (filename," is for ",numSources," sources rather than ",A.Height());
+
+    map_.SetGrid( grid );
+    map_.Resize( numSources );
+    u.Vector( map_.Map() );
+    inverseMap_.SetGrid( grid );
+    inverseMap_.Resize( numSources );
+    u.Vector( inverseMap_.Map() );
+    if( Int(map_.Map().size()) != map_.NumLocalSources() ||
+        Int(inverseMap_.Map().size()) != inverseMap_.NumLocalSources() )
+        RuntimeError("The checkpointed reordering has the wrong local size");
+
+    // The symbolic analysis is cheap relative to the reordering
+    info_.reset( new ldl::DistNodeInfo(grid) );
+    separator_.reset( new ldl::DistSeparator );
+    ldl::checkpoint::UnpackTree( *separator_, *info_, u );
+    ldl::Analysis( *info_, bisectCtrl.storeFactRecvInds );
+    front_.reset
+    ( new ldl::DistFront<Field>(A,map_,*separator_,*info_,hermitian) );
+    formedPullMetadata_ = false;
+    initialized_ = true;
+
+    factored_ = u.Value<bool>();
+    if( factored_ )
+    {
+        if( !IsPacked<Field>::value )
+            LogicError("Only the fronts of packed datatypes can be restored");
+        factorType_ = u.Value<LDLFrontType>();
+        blrCtrl_.tileSize = u.Value<Int>();
+        blrCtrl_.tol = u.Value<Base<Field>>();
+        ldl::checkpoint::UnpackFront( *info_, *front_, u );
+    }
+    if( !u.Finished() )
+        RuntimeError(filename," contains unexpected trailing data");
+}
+
 template<typename Field>
 void DistSparseLDLFactorization<Field>::ChangeNonzeroValues
 ( const DistSparseMatrix<Field>& ANew )
@@ -323,6 +453,85 @@ void DistSparseLDLFactorization<Field>::SolveWithIterativeRefinement
     B = X;
 }
 
+template<typename Field>
+template<typename FieldHigh>
+void DistSparseLDLFactorization<Field>::SolveWithIterativeRefinement
+( const DistSparseMatrix<FieldHigh>& A,
+        DistMultiVec<FieldHigh>& B,
+  const Base<FieldHigh>& minReductionFactor,
+        Int maxRefineIts ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before SolveWithIterativeRefinement()");
+    // TODO(poulson): Generalize this implementation
+    if( B.Width() > 1 )
+        LogicError("Iterative Refinement currently only supported for one RHS");
+    const Grid& grid = B.Grid();
+
+    DistMultiVec<FieldHigh> BOrig(grid);
+    BOrig = B;
+
+    // Solve against the factorization in its own precision after normalizing
+    // the right-hand side so that small residuals do not underflow
+    DistMultiVec<Field> YLow(grid);
+    auto lowSolve = [&]( DistMultiVec<FieldHigh>& Y )
+    {
+        const Base<FieldHigh> YNorm = FrobeniusNorm( Y );
+        if( YNorm == Base<FieldHigh>(0) )
+            return;
+        Y *= FieldHigh(1)/YNorm;
+        Copy( Y, YLow );
+        Solve( YLow );
+        Copy( YLow, Y );
+        Y *= FieldHigh(YNorm);
+    };
+
+    // Compute the initial guess
+    // =========================
+    DistMultiVec<FieldHigh> X( B );
+    lowSolve( X );
+
+    Int refineIt = 0;
+    if( maxRefineIts > 0 )
+    {
+        DistMultiVec<FieldHigh> dX(grid), XCand(grid);
+        Multiply( NORMAL, FieldHigh(-1), A, X, FieldHigh(1), B );
+        Base<FieldHigh> errorNorm = FrobeniusNorm( B );
+        for( ; refineIt<maxRefineIts; ++refineIt )
+        {
+            // Compute the proposed update to the solution
+            // -------------------------------------------
+            dX = B;
+            lowSolve( dX );
+            XCand = X;
+            XCand += dX;
+
+            // If the proposed update lowers the residual, accept it
+            // -----------------------------------------------------
+            B = BOrig;
+            Multiply( NORMAL, FieldHigh(-1), A, XCand, FieldHigh(1), B );
+            Base<FieldHigh> newErrorNorm = FrobeniusNorm( B );
+            if( minReductionFactor*newErrorNorm < errorNorm )
+            {
+                X = XCand;
+                errorNorm = newErrorNorm;
+            }
+            else if( newErrorNorm < errorNorm )
+            {
+                X = XCand;
+                errorNorm = newErrorNorm;
+                break;
+            }
+            else
+                break;
+        }
+    }
+    // Store the final result
+    // ======================
+    B = X;
+}
+
 template<typename Field>
 void DistSparseLDLFactorization<Field>::SolveAgainstL
 ( Orientation orientation, DistMultiVec<Field>& B ) const
@@ -527,6 +736,73 @@ void DistSparseLDLFactorization<Field>::MultiplyWithD
     }
 }
 
+template<typename Field>
+void DistSparseLDLFactorization<Field>::SelectedInverse
+( DistSparseMatrix<Field>& AInv ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before SelectedInverse()");
+    vector<Entry<Field>> entries;
+    ldl::SelectedInverse( *info_, *front_, entries );
+
+    // Map the locally computed entries back to the original ordering
+    const Int numEntries = entries.size();
+    vector<Int> inds( 2*numEntries );
+    for( Int k=0; k<numEntries; ++k )
+    {
+        inds[2*k+0] = entries[k].i;
+        inds[2*k+1] = entries[k].j;
+    }
+    inverseMap_.Translate( inds );
+
+    const Int n = inverseMap_.NumSources();
+    AInv.SetGrid( inverseMap_.Grid() );
+    Zeros( AInv, n, n );
+    const Int firstLocalRow = AInv.FirstLocalRow();
+    const Int localHeight = AInv.LocalHeight();
+    Int numLocal = 0;
+    for( Int k=0; k<2*numEntries; ++k )
+        if( inds[k] >= firstLocalRow && inds[k] < firstLocalRow+localHeight )
+            ++numLocal;
+    AInv.Reserve( numLocal, 2*numEntries-numLocal );
+    for( Int k=0; k<numEntries; ++k )
+    {
+        const Int i = inds[2*k+0];
+        const Int j = inds[2*k+1];
+        const Field value = entries[k].value;
+        AInv.QueueUpdate( i, j, value );
+        if( i != j )
+            AInv.QueueUpdate( j, i, front_->isHermitian ? Conj(value) : value );
+    }
+    AInv.ProcessQueues();
+}
+
+template<typename Field>
+void DistSparseLDLFactorization<Field>::InverseDiagonal
+( DistMultiVec<Field>& d ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before InverseDiagonal()");
+    vector<Entry<Field>> entries;
+    const bool diagonalOnly = true;
+    ldl::SelectedInverse( *info_, *front_, entries, diagonalOnly );
+
+    const Int numEntries = entries.size();
+    vector<Int> inds( numEntries );
+    for( Int k=0; k<numEntries; ++k )
+        inds[k] = entries[k].i;
+    inverseMap_.Translate( inds );
+
+    d.SetGrid( inverseMap_.Grid() );
+    Zeros( d, inverseMap_.NumSources(), 1 );
+    d.Reserve( numEntries );
+    for( Int k=0; k<numEntries; ++k )
+        d.QueueUpdate( inds[k], 0, entries[k].value );
+    d.ProcessQueues();
+}
+
 template<typename Field>
 bool DistSparseLDLFactorization<Field>::Factored() const
 { return factored_; }
@@ -665,4 +941,15 @@ DistSparseLDLFactorization<Field>::DistMultiVecNodeMeta() const
 #define EL_ENABLE_BIGFLOAT
 #include <El/macros/Instantiate.h>
 
+#define MIXED_PROTO(Field,FieldHigh) \
+  template void \
+  DistSparseLDLFactorization<Field>::SolveWithIterativeRefinement \
+  ( const DistSparseMatrix<FieldHigh>& A, \
+          DistMultiVec<FieldHigh>& B, \
+    const Base<FieldHigh>& minReductionFactor, \
+          Int maxRefineIts ) const;
+
+MIXED_PROTO(float,double)
+MIXED_PROTO(Complex<float>,Complex<double>)
+
 } // namespace El
@@ -86,19 +86,26 @@ void Front<Field>::Pull
     function<void(const NodeInfo&,Front<Field>&)> pull =
       [&]( const NodeInfo& node, Front<Field>& front )
       {
-        // Delete any existing children
-        SwapClear( front.children );
-
+        // Reuse the existing children (and their storage) when refilling a
+        // tree of the same shape
         const Int numChildren = node.children.size();
-        front.children.resize( numChildren );
+        if( Int(front.children.size()) != numChildren )
+        {
+            SwapClear( front.children );
+            front.children.resize( numChildren );
+            for( Int c=0; c<numChildren; ++c )
+                front.children[c].reset( new Front<Field>(&front) );
+        }
         for( Int c=0; c<numChildren; ++c )
         {
-            front.children[c].reset( new Front<Field>(&front) );
+            front.children[c]->type = type;
+            front.children[c]->isHermitian = isHermitian;
             pull( *node.children[c], *front.children[c] );
         }
         // Mark this node as a sparse leaf if it does not have any children
-        if( numChildren == 0 )
-            front.sparseLeaf = true;
+        front.sparseLeaf = ( numChildren == 0 );
+        // Any previously offloaded factor is superseded by the new entries
+        front.storeOffset = -1;
 
         const Int lowerSize = node.lowerStruct.size();
         const Field* AValBuf = A.LockedValueBuffer();
@@ -106,6 +113,7 @@ void Front<Field>::Pull
         const Int* AOffsetBuf = A.LockedOffsetBuffer();
         if( front.sparseLeaf )
         {
+            front.LSparse.Empty();
             front.workSparse.Empty();
             Zeros( front.workSparse, node.size, node.size );
             Zeros( front.LDense, lowerSize, node.size );
@@ -170,6 +178,7 @@ void Front<Field>::Pull
         else
         {
             Zeros( front.LDense, node.size+lowerSize, node.size );
+            front.LBLR.Empty();
             for( Int t=0; t<node.size; ++t )
             {
                 const Int j = invReorder[node.off+t];
@@ -306,7 +315,7 @@ void Front<Field>::Push
       {
           for( const auto& child : front.children )
               countLower( *child );
-          const Int nodeSize = front.LDense.Width();
+          const Int nodeSize = front.DenseWidth();
           const Int structSize = front.Height() - nodeSize;
           numLower += (nodeSize*(nodeSize+1))/2 + nodeSize*structSize;
       };
@@ -322,6 +331,8 @@ void Front<Field>::Push
             push( *node.children[c], *front.children[c] );
 
         const Int lowerSize = node.lowerStruct.size();
+        Matrix<Field> LBuffer;
+        const auto& LDense = front.DenseFactor( LBuffer );
         if( front.sparseLeaf )
         {
             // Push in the diagonal block
@@ -366,7 +377,7 @@ void Front<Field>::Push
                 for( Int s=0; s<lowerSize; ++s )
                 {
                     const Int i = invReorder[node.lowerStruct[s]];
-                    const Field value = front.LDense(s,t);
+                    const Field value = LDense(s,t);
                     if( value != Field(0) )
                         A.QueueUpdate( i, j, value );
                 }
@@ -374,6 +385,12 @@ void Front<Field>::Push
         }
         else
         {
+            // Expand the bottom-left block if it was compressed
+            Matrix<Field> LB;
+            if( front.LBLR.Height() > 0 )
+                front.LBLR.Decompress( LB );
+            else
+                LockedView( LB, LDense, IR(node.size,END), ALL );
             for( Int t=0; t<node.size; ++t )
             {
                 const Int j = invReorder[node.off+t];
@@ -382,7 +399,7 @@ void Front<Field>::Push
                 for( Int s=t; s<node.size; ++s )
                 {
                     const Int i = invReorder[node.off+s];
-                    const Field value = front.LDense(s,t);
+                    const Field value = LDense(s,t);
                     if( value != Field(0) )
                         A.QueueUpdate( i, j, value );
                 }
@@ -391,7 +408,7 @@ void Front<Field>::Push
                 for( Int s=0; s<lowerSize; ++s )
                 {
                     const Int i = invReorder[node.lowerStruct[s]];
-                    const Field value = front.LDense(s+node.size,t);
+                    const Field value = LB(s,t);
                     if( value != Field(0) )
                         A.QueueUpdate( i, j, value );
                 }
@@ -420,7 +437,7 @@ void Front<Field>::Unpack
       {
           for( const auto& child : front.children )
               countLower( *child );
-          const Int nodeSize = front.LDense.Width();
+          const Int nodeSize = front.DenseWidth();
           const Int structSize = front.Height() - nodeSize;
           numLower += (nodeSize*(nodeSize+1))/2 + nodeSize*structSize;
       };
@@ -439,6 +456,8 @@ void Front<Field>::Unpack
         }
 
         const Int lowerSize = node.lowerStruct.size();
+        Matrix<Field> LBuffer;
+        const auto& LDense = front.DenseFactor( LBuffer );
         if( front.sparseLeaf )
         {
             // Push in the diagonal block
@@ -483,7 +502,7 @@ void Front<Field>::Unpack
                 for( Int s=0; s<lowerSize; ++s )
                 {
                     const Int i = node.lowerStruct[s];
-                    const Field value = front.LDense(s,t);
+                    const Field value = LDense(s,t);
                     if( value != Field(0) )
                         A.QueueUpdate( i, j, value );
                 }
@@ -491,6 +510,12 @@ void Front<Field>::Unpack
         }
         else
         {
+            // Expand the bottom-left block if it was compressed
+            Matrix<Field> LB;
+            if( front.LBLR.Height() > 0 )
+                front.LBLR.Decompress( LB );
+            else
+                LockedView( LB, LDense, IR(node.size,END), ALL );
             for( Int t=0; t<node.size; ++t )
             {
                 const Int j = node.off+t;
@@ -499,7 +524,7 @@ void Front<Field>::Unpack
                 for( Int s=t; s<node.size; ++s )
                 {
                     const Int i = node.off+s;
-                    const Field value = front.LDense(s,t);
+                    const Field value = LDense(s,t);
                     if( value != Field(0) )
                         A.QueueUpdate( i, j, value );
                 }
@@ -508,7 +533,7 @@ void Front<Field>::Unpack
                 for( Int s=0; s<lowerSize; ++s )
                 {
                     const Int i = node.lowerStruct[s];
-                    const Field value = front.LDense(s+node.size,t);
+                    const Field value = LB(s,t);
                     if( value != Field(0) )
                         A.QueueUpdate( i, j, value );
                 }
@@ -527,6 +552,11 @@ const Front<Field>& Front<Field>::operator=( const Front<Field>& front )
     sparseLeaf = front.sparseLeaf;
     type = front.type;
     LDense = front.LDense;
+    LBLR = front.LBLR;
+    store = front.store;
+    storeOffset = front.storeOffset;
+    storeHeight = front.storeHeight;
+    storeWidth = front.storeWidth;
     LSparse = front.LSparse;
     diag = front.diag;
     subdiag = front.subdiag;
@@ -548,9 +578,43 @@ const Front<Field>& Front<Field>::operator=( const Front<Field>& front )
     return *this;
 }
 
+template<typename Field>
+void Front<Field>::Offload()
+{
+    EL_DEBUG_CSE
+    if( store == nullptr )
+        LogicError("There is no out-of-core store to offload into");
+    storeHeight = LDense.Height();
+    storeWidth = LDense.Width();
+    storeOffset = store->Write( LDense );
+}
+
+template<typename Field>
+const Matrix<Field>& Front<Field>::DenseFactor( Matrix<Field>& buffer ) const
+{
+    EL_DEBUG_CSE
+    if( storeOffset < 0 )
+        return LDense;
+    store->Read( storeOffset, storeHeight, storeWidth, buffer );
+    return buffer;
+}
+
+template<typename Field>
+Int Front<Field>::DenseHeight() const
+{ return storeOffset < 0 ? LDense.Height() : storeHeight; }
+
+template<typename Field>
+Int Front<Field>::DenseWidth() const
+{ return storeOffset < 0 ? LDense.Width() : storeWidth; }
+
 template<typename Field>
 Int Front<Field>::Height() const
-{ return sparseLeaf ? LDense.Height()+LDense.Width() : LDense.Height(); }
+{
+    if( sparseLeaf )
+        return DenseHeight()+DenseWidth();
+    else
+        return DenseHeight()+LBLR.Height();
+}
 
 template<typename Field>
 Int Front<Field>::NumEntries() const
@@ -579,12 +643,13 @@ Int Front<Field>::NumEntries() const
             }
 
             // Count the connectivity
-            numEntries += front.LDense.Height() * front.LDense.Width();
+            numEntries += front.DenseHeight() * front.DenseWidth();
         }
         else
         {
             // Add in L
-            numEntries += front.LDense.Height() * front.LDense.Width();
+            numEntries += front.DenseHeight() * front.DenseWidth();
+            numEntries += front.LBLR.NumEntries();
         }
         // Add in the workspace for the Schur complement
         numEntries += front.workDense.Height()*front.workDense.Width();
@@ -620,7 +685,7 @@ Int Front<Field>::NumTopLeftEntries() const
         }
         else
         {
-            const Int n = front.LDense.Width();
+            const Int n = front.DenseWidth();
             numEntries += n*n;
         }
       };
@@ -638,12 +703,16 @@ Int Front<Field>::NumBottomLeftEntries() const
       {
         for( const auto& child : front.children )
             count( *child );
-        const Int m = front.LDense.Height();
-        const Int n = front.LDense.Width();
+        const Int m = front.DenseHeight();
+        const Int n = front.DenseWidth();
         if( front.sparseLeaf )
         {
             numEntries += m*n;
         }
+        else if( front.LBLR.Height() > 0 )
+        {
+            numEntries += front.LBLR.NumEntries();
+        }
         else
         {
             numEntries += (m-n)*n;
@@ -663,8 +732,8 @@ double Front<Field>::FactorGFlops() const
       {
         for( const auto& child : front.children )
             count( *child );
-        const double m = front.LDense.Height();
-        const double n = front.LDense.Width();
+        const double m = front.DenseHeight()+front.LBLR.Height();
+        const double n = front.DenseWidth();
         double realFrontFlops=0;
         if( front.sparseLeaf )
         {
@@ -704,8 +773,8 @@ double Front<Field>::SolveGFlops( Int numRHS ) const
       {
         for( const auto& child : front.children )
             count( *child );
-        const double m = front.LDense.Height();
-        const double n = front.LDense.Width();
+        const double m = front.DenseHeight();
+        const double n = front.DenseWidth();
         double realFrontFlops = 0;
         if( front.sparseLeaf )
         {
@@ -715,6 +784,10 @@ double Front<Field>::SolveGFlops( Int numRHS ) const
             const double numEntries = front.LSparse.NumEntries();
             realFrontFlops = (numEntries+m*n)*numRHS;
         }
+        else if( front.LBLR.Height() > 0 )
+        {
+            realFrontFlops = (n*n+front.LBLR.NumEntries())*numRHS;
+        }
         else
         {
             realFrontFlops = m*n*numRHS;
@@ -0,0 +1,131 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <cstdio>
+#include <type_traits>
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// Each store owns a distinct file, even if several factorizations on the
+// same process share a directory
+Int NewStoreIndex()
+{
+    static Int numStores = 0;
+    return numStores++;
+}
+
+} // anonymous namespace
+
+template<typename Field>
+FrontStore<Field>::FrontStore( const string& directory )
+{
+    EL_DEBUG_CSE
+    if( !std::is_trivially_copyable<Field>::value )
+        LogicError
+        ("Out-of-core fronts require a trivially copyable scalar type");
+    filename_ =
+      BuildString
+      (directory,"/El-fronts-",mpi::Rank(mpi::COMM_WORLD),"-",NewStoreIndex(),
+       ".bin");
+    file_.open
+    ( filename_.c_str(),
+      std::ios::in | std::ios::out | std::ios::trunc | std::ios::binary );
+    if( !file_.is_open() )
+        RuntimeError("Could not open ",filename_);
+}
+
+template<typename Field>
+FrontStore<Field>::~FrontStore()
+{
+    file_.close();
+    std::remove( filename_.c_str() );
+}
+
+template<typename Field>
+Int FrontStore<Field>::Write( Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    const Int height = A.Height();
+    const Int width = A.Width();
+    Int offset;
+    bool failed;
+    // Fronts of independent subtrees may be offloaded by different threads
+#ifdef EL_HYBRID
+    _Pragma("omp critical(ElFrontStore)")
+#endif
+    {
+        offset = numEntries_;
+        file_.seekp( std::streamoff(offset)*sizeof(Field) );
+        if( height == A.LDim() )
+            file_.write
+            ( reinterpret_cast<const char*>(A.LockedBuffer()),
+              std::streamsize(height)*width*sizeof(Field) );
+        else
+            for( Int j=0; j<width; ++j )
+                file_.write
+                ( reinterpret_cast<const char*>(A.LockedBuffer(0,j)),
+                  std::streamsize(height)*sizeof(Field) );
+        failed = !file_.good();
+        numEntries_ += height*width;
+    }
+    if( failed )
+        RuntimeError("Could not write to ",filename_);
+    A.Empty();
+    return offset;
+}
+
+template<typename Field>
+void FrontStore<Field>::Read
+( Int offset, Int height, Int width, Matrix<Field>& A ) const
+{
+    EL_DEBUG_CSE
+    A.Resize( height, width, Max(height,Int(1)) );
+    file_.seekg( std::streamoff(offset)*sizeof(Field) );
+    file_.read
+    ( reinterpret_cast<char*>(A.Buffer()),
+      std::streamsize(height)*width*sizeof(Field) );
+    if( !file_.good() )
+        RuntimeError("Could not read from ",filename_);
+}
+
+template<typename Field>
+void FrontStore<Field>::Clear()
+{
+    EL_DEBUG_CSE
+    // Flush any pending writes before the entries are overwritten
+    file_.flush();
+    numEntries_ = 0;
+}
+
+template<typename Field>
+void AttachStore( Front<Field>& front, FrontStore<Field>* store )
+{
+    EL_DEBUG_CSE
+    front.store = store;
+    for( auto& child : front.children )
+        AttachStore( *child, store );
+}
+
+#define PROTO(Field) \
+  template class FrontStore<Field>; \
+  template void AttachStore \
+  ( Front<Field>& front, FrontStore<Field>* store );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
@@ -60,7 +60,11 @@ void FrontLowerBackwardMultiply
     else
     {
         if( type == LDL_2D )
-            FrontVanillaLowerBackwardMultiply( front.LDense, W, conjugate );
+        {
+            Matrix<F> LBuffer;
+            FrontVanillaLowerBackwardMultiply
+            ( front.DenseFactor(LBuffer), W, conjugate );
+        }
         else
             LogicError("Unsupported front type");
     }
@@ -49,13 +49,16 @@ void FrontLowerForwardMultiply( const Front<F>& front, Matrix<F>& W )
         LogicError("Cannot multiply against an unfactored front");
     if( BlockFactorization(front.type) || PivotedFactorization(front.type) )
         LogicError("Blocked and pivoted factorizations not supported");
+    if( BLRFactorization(front.type) )
+        LogicError("Block low-rank factorizations not supported");
     if( front.sparseLeaf )
     {
         LogicError("Sparse leaves not supported in FrontLowerForwardMultiply");
     }
     else
     {
-        FrontVanillaLowerForwardMultiply( front.LDense, W );
+        Matrix<F> LBuffer;
+        FrontVanillaLowerForwardMultiply( front.DenseFactor(LBuffer), W );
     }
 }
 
@@ -98,14 +98,14 @@ inline void LowerBackwardSolve
 
     const bool haveParent = ( X.parent != nullptr );
     auto& W = ( haveParent ? X.work : X.matrix );
-    FrontLowerBackwardSolve( front, W, conjugate );
-
     const Int numRHS = X.matrix.Width();
-    if( haveParent )
-        X.matrix = W( IR(0,info.size), IR(0,numRHS) );
-
     if( front.child == nullptr )
+    {
+        FrontLowerBackwardSolve( front, W, conjugate );
+        if( haveParent )
+            X.matrix = W( IR(0,info.size), IR(0,numRHS) );
         return;
+    }
 
     // Set up a workspace for our child
     const bool frontIs1D = FrontIs1D( front.type );
@@ -130,58 +130,80 @@ inline void LowerBackwardSolve
     X.ComputeCommMeta( info );
     mpi::Comm comm = W.DistComm();
     const int commSize = mpi::Size( comm );
-    vector<int> sendSizes(commSize), recvSizes(commSize);
-    for( int q=0; q<commSize; ++q )
+
+    // Split the right-hand sides into batches whose updates for the child are
+    // exchanged while the solves against the subsequent batches take place
+    const Int batchSize = SolveBatchSize( numRHS );
+    const Int numBatches = Max( (numRHS+batchSize-1)/batchSize, Int(1) );
+    vector<BatchExchange<F>> exchanges( numBatches );
+    for( Int b=0; b<numBatches; ++b )
     {
-        sendSizes[q] = X.commMeta.childRecvInds[q].size()*numRHS;
-        recvSizes[q] = X.commMeta.numChildSendInds[q]*numRHS;
+        const Int width = Min( batchSize, numRHS-b*batchSize );
+        auto& exchange = exchanges[b];
+        exchange.sendSizes.resize( commSize );
+        exchange.recvSizes.resize( commSize );
+        for( int q=0; q<commSize; ++q )
+        {
+            exchange.sendSizes[q] = X.commMeta.childRecvInds[q].size()*width;
+            exchange.recvSizes[q] = X.commMeta.numChildSendInds[q]*width;
+        }
+        EL_DEBUG_ONLY(
+          VerifySendsAndRecvs( exchange.sendSizes, exchange.recvSizes, comm )
+        )
+        exchange.Initialize();
+        exchange.PostRecvs( b+1, comm );
     }
-    EL_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
-    vector<int> sendOffs, recvOffs;
-    const int sendBufSize = Scan( sendSizes, sendOffs );
-    const int recvBufSize = Scan( recvSizes, recvOffs );
 
-    // Pack the updates for the children
-    vector<F> sendBuf( sendBufSize );
+    // Solve against each batch and then start sending its updates
     Matrix<F>& WLoc = W.Matrix();
-    for( int q=0; q<commSize; ++q )
+    for( Int b=0; b<numBatches; ++b )
     {
-        F* sendVals = &sendBuf[sendOffs[q]];
-        const auto& recvInds = X.commMeta.childRecvInds[q];
-        const Int numRecvInds = recvInds.size();
-        for( Int k=0; k<numRecvInds; ++k )
+        const Int jBeg = b*batchSize;
+        const Int width = Min( batchSize, numRHS-jBeg );
+        auto WBatch = W( ALL, IR(jBeg,jBeg+width) );
+        FrontLowerBackwardSolve( front, WBatch, conjugate );
+
+        auto& exchange = exchanges[b];
+        for( int q=0; q<commSize; ++q )
         {
-            const Int recvInd = recvInds[k];
-            for( Int j=0; j<numRHS; ++j )
-                sendVals[k*numRHS+j] = WLoc(recvInd,j);
+            F* sendVals = &exchange.sendBuf[exchange.sendOffs[q]];
+            const auto& recvInds = X.commMeta.childRecvInds[q];
+            const Int numRecvInds = recvInds.size();
+            for( Int k=0; k<numRecvInds; ++k )
+            {
+                const Int recvInd = recvInds[k];
+                for( Int j=0; j<width; ++j )
+                    sendVals[k*width+j] = WLoc(recvInd,jBeg+j);
+            }
         }
+        exchange.PostSends( b+1, comm );
     }
     if( haveParent )
+    {
+        X.matrix = W( IR(0,info.size), IR(0,numRHS) );
         W.Empty();
-
-    // AllToAll to send and recv parent updates
-    vector<F> recvBuf( recvBufSize );
-    SparseAllToAll
-    ( sendBuf, sendSizes, sendOffs,
-      recvBuf, recvSizes, recvOffs, comm );
-    SwapClear( sendBuf );
-    SwapClear( sendSizes );
-    SwapClear( sendOffs );
+    }
 
     // Unpack the updates using the send approach from the forward solve
     const Int myChild = ( info.child->onLeft ? 0 : 1 );
     const Int localHeight = childWB.LocalHeight();
     Matrix<F>& childWBLoc = childWB.Matrix();
-    for( Int iUpdateLoc=0; iUpdateLoc<localHeight; ++iUpdateLoc )
+    for( Int b=0; b<numBatches; ++b )
     {
-        const Int iUpdate = childWB.GlobalRow(iUpdateLoc);
-        const int q = W.RowOwner(info.childRelInds[myChild][iUpdate]);
-        for( Int j=0; j<numRHS; ++j )
-            childWBLoc(iUpdateLoc,j) = recvBuf[recvOffs[q]++];
+        const Int jBeg = b*batchSize;
+        const Int jEnd = Min( jBeg+batchSize, numRHS );
+        auto& exchange = exchanges[b];
+        exchange.Wait();
+        auto& recvOffs = exchange.recvOffs;
+        for( Int iUpdateLoc=0; iUpdateLoc<localHeight; ++iUpdateLoc )
+        {
+            const Int iUpdate = childWB.GlobalRow(iUpdateLoc);
+            const int q = W.RowOwner(info.childRelInds[myChild][iUpdate]);
+            for( Int j=jBeg; j<jEnd; ++j )
+                childWBLoc(iUpdateLoc,j) = exchange.recvBuf[recvOffs[q]++];
+        }
+        SwapClear( exchange.recvBuf );
     }
-    SwapClear( recvBuf );
-    SwapClear( recvSizes );
-    SwapClear( recvOffs );
 
     LowerBackwardSolve( *info.child, *front.child, *X.child, conjugate );
 }
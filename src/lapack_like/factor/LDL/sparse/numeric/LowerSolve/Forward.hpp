@@ -119,61 +119,81 @@ void LowerForwardSolve
     X.ComputeCommMeta( info );
     auto& childW = X.child->work;
     auto childU = childW( IR(childInfo.size,childW.Height()), IR(0,numRHS) );
-    vector<int> sendSizes(commSize), recvSizes(commSize);
-    for( int q=0; q<commSize; ++q )
+
+    // Split the right-hand sides into batches whose child updates are
+    // exchanged while the solves against the previous batches take place
+    const Int batchSize = SolveBatchSize( numRHS );
+    const Int numBatches = Max( (numRHS+batchSize-1)/batchSize, Int(1) );
+    vector<BatchExchange<F>> exchanges( numBatches );
+    for( Int b=0; b<numBatches; ++b )
     {
-        sendSizes[q] = X.commMeta.numChildSendInds[q]*numRHS;
-        recvSizes[q] = X.commMeta.childRecvInds[q].size()*numRHS;
+        const Int width = Min( batchSize, numRHS-b*batchSize );
+        auto& exchange = exchanges[b];
+        exchange.sendSizes.resize( commSize );
+        exchange.recvSizes.resize( commSize );
+        for( int q=0; q<commSize; ++q )
+        {
+            exchange.sendSizes[q] = X.commMeta.numChildSendInds[q]*width;
+            exchange.recvSizes[q] = X.commMeta.childRecvInds[q].size()*width;
+        }
+        EL_DEBUG_ONLY(
+          VerifySendsAndRecvs( exchange.sendSizes, exchange.recvSizes, comm )
+        )
+        exchange.Initialize();
+        exchange.PostRecvs( b+1, comm );
     }
-    EL_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
-    vector<int> sendOffs, recvOffs;
-    const int sendBufSize = Scan( sendSizes, sendOffs );
-    const int recvBufSize = Scan( recvSizes, recvOffs );
 
-    // Pack our child's update
-    vector<F> sendBuf( sendBufSize );
+    // Pack our child's update and start sending each batch
     const Int myChild = ( childInfo.onLeft ? 0 : 1 );
-    auto packOffs = sendOffs;
     const Int localHeight = childU.LocalHeight();
     const Matrix<F>& childULoc = childU.LockedMatrix();
+    vector<int> owners( localHeight );
     for( Int iChildLoc=0; iChildLoc<localHeight; ++iChildLoc )
     {
         const Int iChild = childU.GlobalRow(iChildLoc);
-        const Int q = W.RowOwner( info.childRelInds[myChild][iChild] );
-        for( Int j=0; j<numRHS; ++j )
-            sendBuf[packOffs[q]++] = childULoc(iChildLoc,j);
+        owners[iChildLoc] = W.RowOwner( info.childRelInds[myChild][iChild] );
     }
-    SwapClear( packOffs );
+    for( Int b=0; b<numBatches; ++b )
+    {
+        const Int jBeg = b*batchSize;
+        const Int jEnd = Min( jBeg+batchSize, numRHS );
+        auto& exchange = exchanges[b];
+        auto packOffs = exchange.sendOffs;
+        for( Int iChildLoc=0; iChildLoc<localHeight; ++iChildLoc )
+        {
+            const int q = owners[iChildLoc];
+            for( Int j=jBeg; j<jEnd; ++j )
+                exchange.sendBuf[packOffs[q]++] = childULoc(iChildLoc,j);
+        }
+        exchange.PostSends( b+1, comm );
+    }
+    SwapClear( owners );
     childW.Empty();
     if( X.child->duplicate != nullptr )
         X.child->duplicate->work.Empty();
 
-    // AllToAll to send and receive the child updates
-    vector<F> recvBuf( recvBufSize );
-    SparseAllToAll
-    ( sendBuf, sendSizes, sendOffs,
-      recvBuf, recvSizes, recvOffs, comm );
-    SwapClear( sendBuf );
-    SwapClear( sendSizes );
-    SwapClear( sendOffs );
-
-    // Unpack the child updates
+    // Unpack the child updates of each batch and then solve against them
     Matrix<F>& WLoc = W.Matrix();
-    for( int q=0; q<commSize; ++q )
+    for( Int b=0; b<numBatches; ++b )
     {
-        const F* recvVals = &recvBuf[recvOffs[q]];
-        const auto& recvInds = X.commMeta.childRecvInds[q];
-        const Int numRecvInds = recvInds.size();
-        for( Int k=0; k<numRecvInds; ++k )
-            for( Int j=0; j<numRHS; ++j )
-                WLoc(recvInds[k],j) += recvVals[k*numRHS+j]; 
-    }
-    SwapClear( recvBuf );
-    SwapClear( recvSizes );
-    SwapClear( recvOffs );
+        const Int jBeg = b*batchSize;
+        const Int width = Min( batchSize, numRHS-jBeg );
+        auto& exchange = exchanges[b];
+        exchange.Wait();
+        for( int q=0; q<commSize; ++q )
+        {
+            const F* recvVals = &exchange.recvBuf[exchange.recvOffs[q]];
+            const auto& recvInds = X.commMeta.childRecvInds[q];
+            const Int numRecvInds = recvInds.size();
+            for( Int k=0; k<numRecvInds; ++k )
+                for( Int j=0; j<width; ++j )
+                    WLoc(recvInds[k],jBeg+j) += recvVals[k*width+j];
+        }
+        SwapClear( exchange.recvBuf );
 
-    // Now that the RHS is set up, perform this node's solve
-    FrontLowerForwardSolve( front, W );
+        auto WBatch = W( ALL, IR(jBeg,jBeg+width) );
+        FrontLowerForwardSolve( front, WBatch );
+    }
 
     // Unpack the workspace
     X.matrix = WT;
@@ -119,6 +119,24 @@ void FrontIntraPivLowerBackwardSolve
     P.InversePermuteRows( XT );
 }
 
+// The bottom-left block of the factor is stored in block low-rank form
+template<typename F>
+void FrontBLRLowerBackwardSolve
+( const Matrix<F>& LT,
+  const BLRMatrix<F>& LB,
+        Matrix<F>& X,
+  bool conjugate )
+{
+    EL_DEBUG_CSE
+    const Int n = LT.Width();
+    auto XT = X( IR(0,n),   ALL );
+    auto XB = X( IR(n,END), ALL );
+
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+    LB.Multiply( orientation, F(-1), XB, XT );
+    Trsm( LEFT, LOWER, orientation, UNIT, F(1), LT, XT, true );
+}
+
 template<typename F>
 void FrontVanillaLowerBackwardSolve
 ( const DistMatrix<F,VC,STAR>& L,
@@ -665,9 +683,13 @@ void FrontLowerBackwardSolve
           LogicError("Cannot solve against an unfactored matrix");
     )
 
+    // The dense factor may need to be read back from out-of-core storage
+    Matrix<F> LBuffer;
+    const auto& LDense = front.DenseFactor( LBuffer );
+
     if( front.sparseLeaf )
     {
-        const Int n = front.LDense.Width();
+        const Int n = LDense.Width();
         const F* LValBuf = front.LSparse.LockedValueBuffer();
         const Int* LColBuf = front.LSparse.LockedTargetBuffer();
         const Int* LOffsetBuf = front.LSparse.LockedOffsetBuffer();
@@ -677,7 +699,7 @@ void FrontLowerBackwardSolve
 
         const Orientation orientation = 
           ( front.isHermitian ? ADJOINT : TRANSPOSE );
-        Gemm( orientation, NORMAL, F(-1), front.LDense, WB, F(1), WT );
+        Gemm( orientation, NORMAL, F(-1), LDense, WB, F(1), WT );
         
         const bool onLeft = true;
         suite_sparse::ldl::LTSolveMulti
@@ -686,13 +708,16 @@ void FrontLowerBackwardSolve
     }
     else
     {
-        if( BlockFactorization(type) )
-            FrontBlockLowerBackwardSolve( front.LDense, W, conjugate );
+        if( BLRFactorization(type) && front.LBLR.Height() > 0 )
+            FrontBLRLowerBackwardSolve
+            ( LDense, front.LBLR, W, conjugate );
+        else if( BlockFactorization(type) )
+            FrontBlockLowerBackwardSolve( LDense, W, conjugate );
         else if( PivotedFactorization(type) )
             FrontIntraPivLowerBackwardSolve
-            ( front.LDense, front.p, W, conjugate );
+            ( LDense, front.p, W, conjugate );
         else
-            FrontVanillaLowerBackwardSolve( front.LDense, W, conjugate );
+            FrontVanillaLowerBackwardSolve( LDense, W, conjugate );
     }
 }
 
@@ -60,6 +60,22 @@ void FrontIntraPivLowerForwardSolve
     FrontVanillaLowerForwardSolve( L, X );
 }
 
+// The bottom-left block of the factor is stored in block low-rank form
+template<typename F>
+void FrontBLRLowerForwardSolve
+( const Matrix<F>& LT,
+  const BLRMatrix<F>& LB,
+        Matrix<F>& X )
+{
+    EL_DEBUG_CSE
+    const Int n = LT.Width();
+    auto XT = X( IR(0,n),   ALL );
+    auto XB = X( IR(n,END), ALL );
+
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), LT, XT );
+    LB.Multiply( NORMAL, F(-1), XT, XB );
+}
+
 template<typename F>
 void FrontBlockLowerForwardSolve
 ( const Matrix<F>& L,
@@ -96,9 +112,13 @@ void FrontLowerForwardSolve( const Front<F>& front, Matrix<F>& W )
           LogicError("Cannot solve against an unfactored front");
     )
 
+    // The dense factor may need to be read back from out-of-core storage
+    Matrix<F> LBuffer;
+    const auto& LDense = front.DenseFactor( LBuffer );
+
     if( front.sparseLeaf )
     {
-        const Int n = front.LDense.Width();
+        const Int n = LDense.Width();
         const F* LValBuf = front.LSparse.LockedValueBuffer();
         const Int* LColBuf = front.LSparse.LockedTargetBuffer();
         const Int* LOffsetBuf = front.LSparse.LockedOffsetBuffer();
@@ -111,16 +131,18 @@ void FrontLowerForwardSolve( const Front<F>& front, Matrix<F>& W )
         ( onLeft, WT.Height(), WT.Width(), WT.Buffer(), WT.LDim(), 
           LOffsetBuf, LColBuf, LValBuf );
 
-        Gemm( NORMAL, NORMAL, F(-1), front.LDense, WT, F(1), WB );
+        Gemm( NORMAL, NORMAL, F(-1), LDense, WT, F(1), WB );
     }
     else
     {
-        if( BlockFactorization(type) )
-            FrontBlockLowerForwardSolve( front.LDense, W );
+        if( BLRFactorization(type) && front.LBLR.Height() > 0 )
+            FrontBLRLowerForwardSolve( LDense, front.LBLR, W );
+        else if( BlockFactorization(type) )
+            FrontBlockLowerForwardSolve( LDense, W );
         else if( PivotedFactorization(type) )
-            FrontIntraPivLowerForwardSolve( front.LDense, front.p, W );
+            FrontIntraPivLowerForwardSolve( LDense, front.p, W );
         else
-            FrontVanillaLowerForwardSolve( front.LDense, W );
+            FrontVanillaLowerForwardSolve( LDense, W );
     }
 }
 
@@ -88,6 +88,80 @@ void AccumulateRHS( const DistMatrix<F,VC,STAR>& X, DistMatrix<F,STAR,STAR>& Z )
     El::AllReduce( Z, X.ColComm() );
 }
 
+// The number of right-hand sides within each of the batches which are
+// pipelined through a distributed front, so that the exchange of the updates
+// of each batch overlaps with the solves against the other batches. Each
+// batch is kept at least as wide as the blocksize so that its solve remains
+// rich in level 3 BLAS.
+inline Int SolveBatchSize( Int numRHS )
+{
+    const Int maxBatches = 4;
+    const Int numBatches =
+      Max( Min( maxBatches, numRHS/Blocksize() ), Int(1) );
+    return Max( (numRHS+numBatches-1)/numBatches, Int(1) );
+}
+
+// A nonblocking exchange of the packed updates of a batch of right-hand
+// sides. The batches are tagged starting from one so that they cannot be
+// matched with the (untagged) messages of the front solves, and all of the
+// receives should be posted before any of the front solves they overlap.
+template<typename F>
+struct BatchExchange
+{
+    vector<int> sendSizes, sendOffs, recvSizes, recvOffs;
+    vector<F> sendBuf, recvBuf;
+    vector<mpi::Request<F>> sendRequests, recvRequests;
+
+    // Allocate the buffers after the sizes have been set
+    void Initialize()
+    {
+        sendBuf.resize( Scan( sendSizes, sendOffs ) );
+        recvBuf.resize( Scan( recvSizes, recvOffs ) );
+    }
+
+    void PostRecvs( int tag, mpi::Comm comm )
+    {
+        const int commSize = recvSizes.size();
+        int numRecvs = 0;
+        for( int q=0; q<commSize; ++q )
+            if( recvSizes[q] != 0 )
+                ++numRecvs;
+        recvRequests.resize( numRecvs );
+        numRecvs = 0;
+        for( int q=0; q<commSize; ++q )
+            if( recvSizes[q] != 0 )
+                mpi::TaggedIRecv
+                ( &recvBuf[recvOffs[q]], recvSizes[q], q, tag, comm,
+                  recvRequests[numRecvs++] );
+    }
+
+    void PostSends( int tag, mpi::Comm comm )
+    {
+        const int commSize = sendSizes.size();
+        int numSends = 0;
+        for( int q=0; q<commSize; ++q )
+            if( sendSizes[q] != 0 )
+                ++numSends;
+        sendRequests.resize( numSends );
+        numSends = 0;
+        for( int q=0; q<commSize; ++q )
+            if( sendSizes[q] != 0 )
+                mpi::TaggedISend
+                ( &sendBuf[sendOffs[q]], sendSizes[q], q, tag, comm,
+                  sendRequests[numSends++] );
+    }
+
+    // Complete the exchange and free the send buffer
+    void Wait()
+    {
+        mpi::WaitAll( int(recvRequests.size()), recvRequests.data() );
+        mpi::WaitAll( int(sendRequests.size()), sendRequests.data() );
+        SwapClear( recvRequests );
+        SwapClear( sendRequests );
+        SwapClear( sendBuf );
+    }
+};
+
 } // namespace ldl
 } // namespace El
 
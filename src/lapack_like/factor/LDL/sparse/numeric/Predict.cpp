@@ -0,0 +1,225 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// The costs of a subtree which are needed to predict those of its ancestors
+struct SubtreeCosts
+{
+    double factorEntries=0, factorBytes=0;
+    // The largest number of transient bytes (beyond the factors) which are
+    // simultaneously held while processing the subtree
+    double transientBytes=0;
+    // The bytes of the (local portion of the) update matrix of the subtree
+    double updateBytes=0;
+    double factorFlops=0, solveFlops=0;
+};
+
+// The number of update entries which are simultaneously held in the
+// workspace arena of the sequential factorization (see ldl::Process)
+Int UpdateArenaEntries( const NodeInfo& info )
+{
+    Int arenaSize = 0;
+    for( const auto& child : info.children )
+    {
+        const Int childUSize = child->lowerStruct.size();
+        arenaSize =
+          Max( arenaSize,
+               childUSize*childUSize + UpdateArenaEntries( *child ) );
+    }
+    return arenaSize;
+}
+
+Int MaxLeafSize( const NodeInfo& info )
+{
+    Int leafSize = Max( Int(info.LOffsets.size())-1, Int(0) );
+    for( const auto& child : info.children )
+        leafSize = Max( leafSize, MaxLeafSize( *child ) );
+    return leafSize;
+}
+
+template<typename Field>
+void AccumulateFronts
+( const NodeInfo& info, LDLFrontType type, SubtreeCosts& costs )
+{
+    for( const auto& child : info.children )
+        AccumulateFronts<Field>( *child, type, costs );
+
+    const double n = info.size;
+    const double lowerSize = info.lowerStruct.size();
+    double numInts = 0;
+    if( info.children.empty() && info.duplicate == nullptr )
+    {
+        // A sparse leaf stores its diagonal block in a SparseMatrix
+        const Int* offsetBuf = info.LOffsets.data();
+        const double numSparse = info.LOffsets.back();
+        costs.factorEntries += lowerSize*n + numSparse + n;
+        numInts += 2*numSparse + n + 1;
+        for( Int j=0; j<info.size; ++j )
+        {
+            const double nnz = offsetBuf[j+1]-offsetBuf[j];
+            costs.factorFlops += nnz*(nnz+2.);
+        }
+        costs.factorFlops += lowerSize*n + lowerSize*lowerSize*n;
+        costs.solveFlops += numSparse + lowerSize*n;
+    }
+    else
+    {
+        const double m = n + lowerSize;
+        costs.factorEntries += m*n;
+        if( !BlockFactorization(type) )
+            costs.factorEntries += n;
+        costs.factorFlops += n*n*n/3 + (m-n)*n + (m-n)*(m-n)*n;
+        costs.solveFlops += m*n;
+    }
+    if( PivotedFactorization(type) )
+    {
+        costs.factorEntries += Max(n-1,0.);
+        numInts += 3*n;
+    }
+    costs.factorBytes += numInts*sizeof(Int);
+}
+
+template<typename Field>
+SubtreeCosts PredictSubtree( const NodeInfo& info, LDLFrontType type )
+{
+    SubtreeCosts costs;
+    AccumulateFronts<Field>( info, type, costs );
+    costs.factorBytes += costs.factorEntries*sizeof(Field);
+
+    // The arena and the sparse-leaf workspace are held throughout the
+    // factorization, and each thread factoring independent subtrees holds
+    // its own (no larger) copy of them
+    double numThreads = 1;
+#ifdef EL_HYBRID
+    numThreads += blas::FallbackThreads();
+#endif
+    const double arenaEntries = UpdateArenaEntries( info );
+    const double leafSize = MaxLeafSize( info );
+    const double lowerSize = info.lowerStruct.size();
+    costs.updateBytes = lowerSize*lowerSize*sizeof(Field);
+    costs.transientBytes =
+      numThreads*((arenaEntries+leafSize)*sizeof(Field) +
+                  3*leafSize*sizeof(Int)) + costs.updateBytes;
+    return costs;
+}
+
+template<typename Field>
+SubtreeCosts PredictSubtree( const DistNodeInfo& info, LDLFrontType type )
+{
+    if( info.duplicate != nullptr )
+        return PredictSubtree<Field>( *info.duplicate, type );
+
+    SubtreeCosts costs = PredictSubtree<Field>( *info.child, type );
+    const Grid& grid = info.Grid();
+    const double p = grid.Size();
+    const double n = info.size;
+    const double lowerSize = info.lowerStruct.size();
+    const double m = n + lowerSize;
+
+    // The local portions of the front in the [MC,MR] distribution used
+    // during the factorization and the [VC,STAR] distribution of 1D fronts
+    const Int mInt = info.size + info.lowerStruct.size();
+    const double localEntries2D =
+      double(Length(mInt,grid.MCRank(),grid.MCSize()))*
+      Length(info.size,grid.MRRank(),grid.MRSize());
+    const double localEntries1D =
+      double(Length(mInt,grid.VCRank(),grid.Size()))*info.size;
+    const bool frontIs1D = FrontIs1D(type);
+    const double localEntries = ( frontIs1D ? localEntries1D : localEntries2D );
+    double frontEntries = localEntries;
+    if( !BlockFactorization(type) )
+        frontEntries += n/p;
+    if( PivotedFactorization(type) )
+    {
+        frontEntries += Max(n-1,0.)/p;
+        costs.factorBytes += 3*n/p*sizeof(Int);
+    }
+    costs.factorEntries += frontEntries;
+    costs.factorBytes += frontEntries*sizeof(Field);
+
+    // The extend-add simultaneously holds the child update, the packed send
+    // and receive buffers, and the new update matrix
+    const double childLowerSize = info.child->lowerStruct.size();
+    const double childP = info.child->Grid().Size();
+    const double childLowerEntries = childLowerSize*(childLowerSize+1)/2;
+    const double updateBytes = lowerSize*lowerSize/p*sizeof(Field);
+    const double extendAddBytes =
+      costs.updateBytes +
+      (childLowerEntries/childP + childLowerEntries/p)*sizeof(Field) +
+      updateBytes;
+    costs.transientBytes = Max( costs.transientBytes, extendAddBytes );
+    if( frontIs1D )
+        costs.transientBytes =
+          Max( costs.transientBytes, localEntries2D*sizeof(Field) );
+    costs.updateBytes = updateBytes;
+
+    const bool invert = SelInvFactorization(type) || BlockFactorization(type);
+    costs.factorFlops +=
+      ( invert ? (2*n*n*n/3) + (m-n)*n + (m-n)*(m-n)*n
+               : (1*n*n*n/3) + (m-n)*n + (m-n)*(m-n)*n ) / p;
+    costs.solveFlops += m*n / p;
+    return costs;
+}
+
+template<typename Field,typename NodeInfoType>
+FactorPrediction MakePrediction
+( const NodeInfoType& info, LDLFrontType frontType )
+{
+    const LDLFrontType type =
+      BLRFactorization(frontType) ? RemoveBLR(frontType) : frontType;
+    const SubtreeCosts costs = PredictSubtree<Field>( info, type );
+    const double flopScale = IsComplex<Field>::value ? 4 : 1;
+
+    FactorPrediction prediction;
+    prediction.factorEntries = costs.factorEntries;
+    prediction.factorBytes = costs.factorBytes;
+    prediction.peakBytes = costs.factorBytes + costs.transientBytes;
+    prediction.factorGFlops = flopScale*costs.factorFlops/1.e9;
+    prediction.solveGFlops = flopScale*costs.solveFlops/1.e9;
+    return prediction;
+}
+
+} // anonymous namespace
+
+template<typename Field>
+FactorPrediction PredictFactorization
+( const NodeInfo& info, LDLFrontType frontType )
+{
+    EL_DEBUG_CSE
+    return MakePrediction<Field>( info, frontType );
+}
+
+template<typename Field>
+FactorPrediction PredictFactorization
+( const DistNodeInfo& info, LDLFrontType frontType )
+{
+    EL_DEBUG_CSE
+    return MakePrediction<Field>( info, frontType );
+}
+
+#define PROTO(Field) \
+  template FactorPrediction PredictFactorization<Field> \
+  ( const NodeInfo& info, LDLFrontType frontType ); \
+  template FactorPrediction PredictFactorization<Field> \
+  ( const DistNodeInfo& info, LDLFrontType frontType );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
@@ -25,18 +25,254 @@
 
 #include "./ProcessFront.hpp"
 
+#include <exception>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace El {
 namespace ldl {
 
+// Each thread is given roughly this many independent subtrees to factor
+const Int ldlSubtreesPerThread = 4;
+
+// The approximate number of flops required to factor each front of the
+// subtree (ignoring the savings of sparse leaves), accumulated over subtrees
+inline double SubtreeFlops
+( const NodeInfo& info, std::unordered_map<const NodeInfo*,double>& flops )
+{
+    const double s = info.size;
+    const double u = info.lowerStruct.size();
+    double subtreeFlops = s*s*s/3 + s*s*u + s*u*u;
+    for( const auto& child : info.children )
+        subtreeFlops += SubtreeFlops( *child, flops );
+    flops[&info] = subtreeFlops;
+    return subtreeFlops;
+}
+
+// The number of entries of the update matrices which are simultaneously held
+// within the arena while processing the subtree (the update of the root of the
+// subtree, and those of the already processed subtrees, are stored separately)
+inline Int UpdateArenaSize
+( const NodeInfo& info,
+  const std::unordered_set<const NodeInfo*>& processedSubtrees )
+{
+    Int arenaSize = 0;
+    for( const auto& child : info.children )
+    {
+        if( processedSubtrees.count( child.get() ) )
+            continue;
+        const Int childUSize = child->lowerStruct.size();
+        arenaSize =
+          Max( arenaSize,
+               childUSize*childUSize +
+               UpdateArenaSize( *child, processedSubtrees ) );
+    }
+    return arenaSize;
+}
+
+// The largest number of sources of a sparse leaf within the subtree
+inline Int MaxLeafSize
+( const NodeInfo& info,
+  const std::unordered_set<const NodeInfo*>& processedSubtrees )
+{
+    Int leafSize = Max( Int(info.LOffsets.size())-1, Int(0) );
+    for( const auto& child : info.children )
+        if( !processedSubtrees.count( child.get() ) )
+            leafSize = Max( leafSize, MaxLeafSize( *child, processedSubtrees ) );
+    return leafSize;
+}
+
+// Since the subtrees are processed in postorder, and each update matrix is
+// added into its parent (and then discarded) as soon as it has been formed,
+// the update matrices can be drawn from a stack whose peak size is known from
+// the symbolic analysis. The sparse leaves similarly share their workspace.
+template<typename Field>
+struct FactorWorkspace
+{
+    vector<Field> updateArena;
+    Int updateTop=0;
+
+    vector<Int> leafInts;
+    vector<Field> leafFields;
+
+    FactorWorkspace( Int updateArenaSize, Int leafSize )
+    : updateArena(updateArenaSize), leafInts(3*leafSize), leafFields(leafSize)
+    { }
+
+    void PushUpdate( Matrix<Field>& U, Int updateSize )
+    {
+        EL_DEBUG_CSE
+        const Int numEntries = updateSize*updateSize;
+        EL_DEBUG_ONLY(
+          if( updateTop+numEntries > Int(updateArena.size()) )
+              LogicError("Update arena was too small");
+        )
+        U.Attach
+        ( updateSize, updateSize, &updateArena[updateTop],
+          Max(updateSize,Int(1)) );
+        updateTop += numEntries;
+        Zero( U );
+    }
+
+    void PopUpdate( Matrix<Field>& U )
+    {
+        EL_DEBUG_CSE
+        updateTop -= U.Height()*U.Width();
+        U.Empty();
+    }
+};
+
+template<typename Field>
+void ProcessNode
+( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType,
+  const BLRCtrl<Base<Field>>& blrCtrl,
+  const DenseFrontKernel<Field>& kernel,
+  const std::unordered_set<const NodeInfo*>& processedSubtrees,
+  FactorWorkspace<Field>& workspace, bool ownUpdate );
+
+// Split the elimination tree into independent subtrees, each with at most
+// 1/(ldlSubtreesPerThread*numThreads) of the total work where possible, by
+// repeatedly splitting the most expensive subtree into its children. The
+// subtrees are then factored in parallel in order of decreasing work, which
+// leaves the (typically large) fronts above them to the threaded BLAS.
+template<typename Field>
+void ProcessSubtreesInParallel
+( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType,
+  const BLRCtrl<Base<Field>>& blrCtrl,
+  const DenseFrontKernel<Field>& kernel,
+  std::unordered_set<const NodeInfo*>& processedSubtrees )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HYBRID
+    const int numThreads = blas::FallbackThreads();
+    if( numThreads == 1 || omp_in_parallel() || info.children.empty() )
+        return;
+
+    std::unordered_map<const NodeInfo*,double> flops;
+    const double totalFlops = SubtreeFlops( info, flops );
+    const double maxSubtreeFlops =
+      totalFlops / (ldlSubtreesPerThread*numThreads);
+
+    vector<pair<const NodeInfo*,Front<Field>*>> subtrees;
+    subtrees.emplace_back( &info, &front );
+    while( true )
+    {
+        Int largest = 0;
+        for( Int t=1; t<Int(subtrees.size()); ++t )
+            if( flops[subtrees[t].first] > flops[subtrees[largest].first] )
+                largest = t;
+        const NodeInfo* largestInfo = subtrees[largest].first;
+        Front<Field>* largestFront = subtrees[largest].second;
+        if( flops[largestInfo] <= maxSubtreeFlops ||
+            largestInfo->children.empty() )
+            break;
+        subtrees.erase( subtrees.begin()+largest );
+        const Int numChildren = largestInfo->children.size();
+        for( Int c=0; c<numChildren; ++c )
+            subtrees.emplace_back
+            ( largestInfo->children[c].get(),
+              largestFront->children[c].get() );
+    }
+    if( subtrees.size() == 1 )
+        return;
+    std::stable_sort
+    ( subtrees.begin(), subtrees.end(),
+      [&]( const pair<const NodeInfo*,Front<Field>*>& a,
+           const pair<const NodeInfo*,Front<Field>*>& b )
+      { return flops[a.first] > flops[b.first]; } );
+
+    const Int numSubtrees = subtrees.size();
+    const std::unordered_set<const NodeInfo*> noProcessedSubtrees;
+    Int updateArenaSize = 0, leafSize = 0;
+    for( const auto& subtree : subtrees )
+    {
+        updateArenaSize =
+          Max( updateArenaSize,
+               UpdateArenaSize( *subtree.first, noProcessedSubtrees ) );
+        leafSize =
+          Max( leafSize, MaxLeafSize( *subtree.first, noProcessedSubtrees ) );
+    }
+    vector<FactorWorkspace<Field>> workspaces;
+    workspaces.reserve( numThreads );
+    for( int thread=0; thread<numThreads; ++thread )
+        workspaces.emplace_back( updateArenaSize, leafSize );
+
+    // The update matrices of the subtree roots must outlive the workspaces
+    std::exception_ptr error;
+    _Pragma("omp parallel for schedule(dynamic,1) num_threads(numThreads)")
+    for( Int t=0; t<numSubtrees; ++t )
+    {
+        try
+        {
+            ProcessNode
+            ( *subtrees[t].first, *subtrees[t].second, factorType, blrCtrl,
+              kernel, noProcessedSubtrees, workspaces[omp_get_thread_num()],
+              true );
+        }
+        catch( ... )
+        {
+            _Pragma("omp critical")
+            {
+                if( !error )
+                    error = std::current_exception();
+            }
+        }
+    }
+    if( error )
+        std::rethrow_exception( error );
+    for( const auto& subtree : subtrees )
+        processedSubtrees.insert( subtree.first );
+#else
+    EL_UNUSED(info);
+    EL_UNUSED(front);
+    EL_UNUSED(factorType);
+    EL_UNUSED(blrCtrl);
+    EL_UNUSED(kernel);
+    EL_UNUSED(processedSubtrees);
+#endif
+}
+
 template<typename Field>
 void Process
-( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType )
+( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType,
+  const BLRCtrl<Base<Field>>& blrCtrl=BLRCtrl<Base<Field>>(),
+  const DenseFrontKernel<Field>& kernel=DenseFrontKernel<Field>() )
 {
     EL_DEBUG_CSE
-    const int updateSize = info.lowerStruct.size();
+    EL_REGION("ldl::Process");
+    std::unordered_set<const NodeInfo*> processedSubtrees;
+    ProcessSubtreesInParallel
+    ( info, front, factorType, blrCtrl, kernel, processedSubtrees );
+    FactorWorkspace<Field> workspace
+    ( UpdateArenaSize( info, processedSubtrees ),
+      MaxLeafSize( info, processedSubtrees ) );
+    ProcessNode
+    ( info, front, factorType, blrCtrl, kernel, processedSubtrees, workspace,
+      true );
+}
+
+// Factor the subtree rooted at the given node, except for the subtrees which
+// were already processed (whose update matrices are in place). Unless
+// 'ownUpdate' is true, the update matrix of the node is drawn from the arena
+// and must be popped after being added into the parent.
+template<typename Field>
+void ProcessNode
+( const NodeInfo& info, Front<Field>& front, LDLFrontType factorType,
+  const BLRCtrl<Base<Field>>& blrCtrl,
+  const DenseFrontKernel<Field>& kernel,
+  const std::unordered_set<const NodeInfo*>& processedSubtrees,
+  FactorWorkspace<Field>& workspace, bool ownUpdate )
+{
+    EL_DEBUG_CSE
+    if( processedSubtrees.count( &info ) )
+        return;
+    const Int updateSize = info.lowerStruct.size();
     auto& FBR = front.workDense;
     FBR.Empty();
-    Zeros( FBR, updateSize, updateSize );
+    if( ownUpdate )
+        Zeros( FBR, updateSize, updateSize );
+    else
+        workspace.PushUpdate( FBR, updateSize );
 
     if( front.sparseLeaf )
     {
@@ -69,9 +305,10 @@ void Process
         front.diag.Resize( numSources, 1 );
 
         // Factor the transpose of L
-        // TODO(poulson): Reuse these workspaces
-        vector<Int> LNnz(numSources), pattern(numSources), flag(numSources);
-        vector<Field> y(numSources);
+        Int* LNnz = workspace.leafInts.data();
+        Int* pattern = LNnz + numSources;
+        Int* flag = pattern + numSources;
+        Field* y = workspace.leafFields.data();
         suite_sparse::ldl::Numeric
         ( numSources,
           front.workSparse.LockedOffsetBuffer(),
@@ -79,13 +316,13 @@ void Process
           front.workSparse.LockedValueBuffer(),
           LOffsetBuf,
           info.LParents.data(),
-          LNnz.data(),
+          LNnz,
           LColBuf,
           LValBuf,
           front.diag.Buffer(),
-          y.data(),
-          pattern.data(),
-          flag.data(),
+          y,
+          pattern,
+          flag,
           static_cast<const Int*>(nullptr),
           static_cast<const Int*>(nullptr),
           front.isHermitian );
@@ -123,34 +360,72 @@ void Process
         const int numChildren = info.children.size();
         for( Int c=0; c<numChildren; ++c )
         {
-            Process( *info.children[c], *front.children[c], factorType );
+            ProcessNode
+            ( *info.children[c], *front.children[c], factorType, blrCtrl,
+              kernel, processedSubtrees, workspace, false );
 
+            // The relative indices of the child update consist of a modest
+            // number of runs of consecutive indices, so each column of the
+            // update is added into the parent as a handful of contiguous axpys
             auto& childU = front.children[c]->workDense;
-            const int childUSize = childU.Height();
-            for( int jChild=0; jChild<childUSize; ++jChild )
+            const Int childUSize = childU.Height();
+            const Int* relInds = info.childRelInds[c].data();
+            const Int* runs = info.childRelIndRuns[c].data();
+            const Int numRuns = Int(info.childRelIndRuns[c].size())-1;
+            const Field* UBuf = childU.LockedBuffer();
+            const Int ULDim = childU.LDim();
+            Int run = 0;
+            for( Int jChild=0; jChild<childUSize; ++jChild )
             {
-                const int j = info.childRelInds[c][jChild];
-                for( int iChild=jChild; iChild<childUSize; ++iChild )
+                const Int j = relInds[jChild];
+                Field* col;
+                Int rowShift;
+                if( j < info.size )
+                {
+                    col = FL.Buffer(0,j);
+                    rowShift = 0;
+                }
+                else
+                {
+                    col = FBR.Buffer(0,j-info.size);
+                    rowShift = info.size;
+                }
+                if( runs[run+1] <= jChild )
+                    ++run;
+                const Field* UCol = &UBuf[jChild*ULDim];
+                for( Int r=run; r<numRuns; ++r )
                 {
-                    const int i = info.childRelInds[c][iChild];
-                    const Field value = childU(iChild,jChild);
-                    if( j < info.size )
-                        FL(i,j) += value;
-                    else
-                        FBR(i-info.size,j-info.size) += value;
+                    const Int iStart = Max( runs[r], jChild );
+                    const Int runSize = runs[r+1]-iStart;
+                    Field* EL_RESTRICT dest = &col[relInds[iStart]-rowShift];
+                    const Field* EL_RESTRICT source = &UCol[iStart];
+                    EL_SIMD
+                    for( Int k=0; k<runSize; ++k )
+                        dest[k] += source[k];
                 }
             }
-            childU.Empty();
+            if( processedSubtrees.count( info.children[c].get() ) )
+                childU.Empty();
+            else
+                workspace.PopUpdate( childU );
         }
-        ProcessFront( front, factorType );
+        ProcessFront( front, factorType, blrCtrl, kernel );
     }
+
+    // The factors of the root are left in memory since they are needed first
+    // by each solve (and may be shared with a distributed front)
+    if( front.store != nullptr && front.parent != nullptr )
+        front.Offload();
 }
 
 template<typename Field>
 void Process
-( const DistNodeInfo& info, DistFront<Field>& front, LDLFrontType factorType )
+( const DistNodeInfo& info, DistFront<Field>& front, LDLFrontType factorType,
+  const BLRCtrl<Base<Field>>& blrCtrl=BLRCtrl<Base<Field>>(),
+  const DenseFrontKernel<Field>& kernel=DenseFrontKernel<Field>() )
 {
     EL_DEBUG_CSE
+    EL_REGION("ldl::DistProcess");
 
     // Switch to a sequential algorithm if possible
     if( front.duplicate.get() != nullptr )
@@ -158,10 +433,13 @@ void Process
         const Grid& grid = info.Grid();
         auto& frontDup = *front.duplicate;
 
-        Process( *info.duplicate, frontDup, factorType );
+        Process( *info.duplicate, frontDup, factorType, blrCtrl, kernel );
 
-        // Pull the relevant information up from the duplicate
-        front.type = frontDup.type;
+        // Pull the relevant information up from the duplicate (whose root is
+        // always stored densely)
+        front.type =
+          BLRFactorization(frontDup.type) ? RemoveBLR(frontDup.type)
+                                          : frontDup.type;
         front.work.LockedAttach( grid, frontDup.workDense );
         if( !BlockFactorization(factorType) )
         {
@@ -179,7 +457,7 @@ void Process
 
     const auto& childInfo = *info.child;
     auto& childFront = *front.child;
-    Process( childInfo, childFront, factorType );
+    Process( childInfo, childFront, factorType, blrCtrl, kernel );
 
     const Int updateSize = info.lowerStruct.size();
     front.work.Empty();
@@ -189,8 +467,10 @@ void Process
           LogicError("Front was not the proper size");
     )
 
-    // Compute the metadata for sharing child updates
-    front.ComputeCommMeta( info, true );
+    // Compute the metadata for sharing child updates unless it was cached by
+    // a previous factorization of a front with the same structure
+    if( front.commMeta.numChildSendInds.empty() )
+        front.ComputeCommMeta( info, true );
     mpi::Comm comm = front.L2D.DistComm();
     const int commSize = mpi::Size( comm );
     const auto& childU = childFront.work;
@@ -272,7 +552,11 @@ void Process
     SwapClear( recvSizes );
     SwapClear( recvOffs );
 
-    ProcessFront( front, factorType );
+    // Distributed fronts are always stored densely
+    if( BLRFactorization(factorType) )
+        ProcessFront( front, RemoveBLR(factorType) );
+    else
+        ProcessFront( front, factorType );
 }
 
 } // namespace ldl
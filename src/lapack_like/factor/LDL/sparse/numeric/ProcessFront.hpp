@@ -153,8 +153,73 @@ void ProcessFrontBlock
     }
 }
 
+// Factor the top-left block, compress the row tiles of L_{BL} D, and then
+// form the Schur complement from the compressed tiles, e.g.,
+//
+//   A_{BR}(I,J) -= U_I (V_I inv(D) V_J^T) U_J^T
+//
+// in the (complex) symmetric case. The tiles are then scaled by inv(D) so
+// that they represent L_{BL}.
 template<typename F>
-void ProcessFront( Front<F>& front, LDLFrontType factorType )
+void ProcessFrontBLR( Front<F>& front, const BLRCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto& AL = front.LDense;
+    auto& ABR = front.workDense;
+    const Int n = AL.Width();
+    const bool conjugate = front.isHermitian;
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    auto ATL = AL( IR(0,n), ALL );
+    auto ABL = AL( IR(n,END), ALL );
+    LDL( ATL, conjugate );
+    GetDiagonal( ATL, front.diag );
+    Trsm( RIGHT, LOWER, orientation, UNIT, F(1), ATL, ABL );
+
+    auto& LBLR = front.LBLR;
+    LBLR.Compress( ABL, ctrl.tileSize, ctrl.tol );
+    const Int numTiles = LBLR.NumTiles();
+    Matrix<F> VScaled, C, UC, T;
+    for( Int I=0; I<numTiles; ++I )
+    {
+        const Range<Int> indI( LBLR.tileOffsets[I], LBLR.tileOffsets[I+1] );
+        VScaled = LBLR.V[I];
+        DiagonalSolve( RIGHT, NORMAL, front.diag, VScaled );
+        const bool denseI = ( LBLR.U[I].Height() == 0 );
+        for( Int J=0; J<=I; ++J )
+        {
+            const Range<Int> indJ( LBLR.tileOffsets[J], LBLR.tileOffsets[J+1] );
+            const bool denseJ = ( LBLR.U[J].Height() == 0 );
+            Gemm( NORMAL, orientation, F(1), VScaled, LBLR.V[J], C );
+            if( denseI )
+                UC = C;
+            else
+                Gemm( NORMAL, NORMAL, F(1), LBLR.U[I], C, UC );
+            if( denseJ )
+                T = UC;
+            else
+                Gemm( NORMAL, orientation, F(1), UC, LBLR.U[J], T );
+
+            auto ABRIJ = ABR( indI, indJ );
+            if( I == J )
+                AxpyTrapezoid( LOWER, F(-1), T, ABRIJ );
+            else
+                Axpy( F(-1), T, ABRIJ );
+        }
+    }
+    for( Int t=0; t<numTiles; ++t )
+        DiagonalSolve( RIGHT, NORMAL, front.diag, LBLR.V[t] );
+
+    // Only keep the top-left block densely
+    Matrix<F> LTL( ATL );
+    front.LDense = std::move( LTL );
+}
+
+template<typename F>
+void ProcessFront
+( Front<F>& front, LDLFrontType factorType,
+  const BLRCtrl<Base<F>>& blrCtrl=BLRCtrl<Base<F>>(),
+  const DenseFrontKernel<F>& kernel=DenseFrontKernel<F>() )
 {
     EL_DEBUG_CSE
     front.type = factorType;
@@ -163,7 +228,14 @@ void ProcessFront( Front<F>& front, LDLFrontType factorType )
           LogicError("This should not be possible");
     )
     const bool pivoted = PivotedFactorization( factorType );
-    if( BlockFactorization(factorType) )
+    front.LBLR.Empty();
+    // The factors of the root of each sequential tree are kept dense, as they
+    // are either shared with a distributed front or have no bottom-left block
+    if( BLRFactorization(factorType) && front.parent != nullptr )
+    {
+        ProcessFrontBLR( front, blrCtrl );
+    }
+    else if( BlockFactorization(factorType) )
     {
         ProcessFrontBlock
         ( front.LDense,
@@ -183,10 +255,13 @@ void ProcessFront( Front<F>& front, LDLFrontType factorType )
     }
     else
     {
-        ProcessFrontVanilla
-        ( front.LDense,
-          front.workDense,
-          front.isHermitian );
+        if( kernel.factor && front.LDense.Width() >= kernel.minSize )
+            kernel.factor( front.LDense, front.workDense, front.isHermitian );
+        else
+            ProcessFrontVanilla
+            ( front.LDense,
+              front.workDense,
+              front.isHermitian );
         GetDiagonal( front.LDense, front.diag );
     }
 }
@@ -270,6 +345,45 @@ void ProcessFrontVanilla
     }
 }
 
+// The distributed vanilla factorization performs several collectives per
+// panel, and so small fronts over large teams are dominated by latency. Unless
+// the (calibrated) redundant-versus-distributed policy says otherwise, fronts
+// remain distributed.
+template<typename F>
+bool RedundantFront( const DistMatrix<F>& AL )
+{
+    EL_DEBUG_CSE
+    const double n = AL.Width();
+    const double m = AL.Height();
+    const double u = m - n;
+    SubproblemCost cost;
+    cost.flops = (IsComplex<F>::value ? 4 : 1)*(n*n*n/3 + n*n*u + n*u*u);
+    cost.numInputEntries = m*n + u*u/2;
+    cost.numSyncs = 8*((AL.Width()+Blocksize()-1)/Blocksize());
+    cost.numCommEntries = 3*m*n;
+    cost.entrySize = sizeof(F);
+    return RunRedundantly( cost, AL.Grid().Size(), false );
+}
+
+// Gather the front onto every process of its team, factor it sequentially,
+// and keep the local portions of the result
+template<typename F>
+void ProcessFrontRedundant
+( DistMatrix<F>& AL,
+  DistMatrix<F>& ABR,
+  bool conjugate=false )
+{
+    EL_DEBUG_CSE
+    const Grid& g = AL.Grid();
+    DistMatrix<F,STAR,STAR> AL_STAR_STAR(g), ABR_STAR_STAR(g);
+    AL_STAR_STAR = AL;
+    ABR_STAR_STAR = ABR;
+    ProcessFrontVanilla
+    ( AL_STAR_STAR.Matrix(), ABR_STAR_STAR.Matrix(), conjugate );
+    AL = AL_STAR_STAR;
+    ABR = ABR_STAR_STAR;
+}
+
 template<typename F>
 void ProcessFrontIntraPiv
 ( DistMatrix<F>& AL,
@@ -388,7 +502,10 @@ void ProcessFront( DistFront<F>& front, LDLFrontType factorType )
     }
     else
     {
-        ProcessFrontVanilla( front.L2D, front.work, front.isHermitian );
+        if( RedundantFront(front.L2D) )
+            ProcessFrontRedundant( front.L2D, front.work, front.isHermitian );
+        else
+            ProcessFrontVanilla( front.L2D, front.work, front.isHermitian );
 
         auto diag = GetDiagonal( front.L2D );
         front.diag.SetGrid( grid );
@@ -0,0 +1,404 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+// Given the factorization A = L D L^T (or L D L^H) and the entries Z_{BR} of
+// Z = inv(A) within the lower structure of a front, the remaining entries
+// of Z within the front follow from
+//
+//   Z_{BL} = -Z_{BR} L_{BL} inv(L_{TL}),
+//   Z_{TL} = inv(L_{TL})^T inv(D) inv(L_{TL}) - (L_{BL} inv(L_{TL}))^T Z_{BL},
+//
+// (with each transpose replaced by an adjoint in the Hermitian case), and the
+// lower structure of each child is contained within the front, so that the
+// fronts can be inverted from the root to the leaves.
+
+namespace {
+
+template<typename NodeInfoType>
+void CheckSelectedInverseType( const NodeInfoType& info, LDLFrontType type )
+{
+    EL_DEBUG_CSE
+    if( Unfactored(type) )
+        LogicError("Cannot invert an unfactored front");
+    if( PivotedFactorization(type) || BlockFactorization(type) )
+        LogicError("Selected inversion requires an unpivoted LDL front type");
+    if( !info.lowerStruct.empty() )
+        LogicError("Selected inversion must begin from the root of the tree");
+}
+
+template<typename NodeInfoType>
+inline Int FrontIndex( const NodeInfoType& info, Int s )
+{ return s < info.size ? info.off+s : info.lowerStruct[s-info.size]; }
+
+template<typename Field>
+void AppendEntries
+( const NodeInfo& info,
+  const Front<Field>& front,
+  const Matrix<Field>& ZL,
+  bool diagonalOnly,
+  vector<Entry<Field>>& entries )
+{
+    EL_DEBUG_CSE
+    const Int n = info.size;
+    const Int m = ZL.Height();
+    if( diagonalOnly )
+    {
+        for( Int t=0; t<n; ++t )
+            entries.push_back( Entry<Field>{info.off+t,info.off+t,ZL(t,t)} );
+    }
+    else if( front.sparseLeaf )
+    {
+        // Only the structure of the sparse factor of the diagonal block is
+        // kept, along with the diagonal and the (dense) bottom-left block
+        for( Int t=0; t<n; ++t )
+            entries.push_back( Entry<Field>{info.off+t,info.off+t,ZL(t,t)} );
+        const Int numSparse = front.LSparse.NumEntries();
+        for( Int e=0; e<numSparse; ++e )
+        {
+            const Int s = front.LSparse.Row(e);
+            const Int t = front.LSparse.Col(e);
+            if( s == t )
+                continue;
+            const Int i = Max(s,t);
+            const Int j = Min(s,t);
+            entries.push_back( Entry<Field>{info.off+i,info.off+j,ZL(i,j)} );
+        }
+        for( Int t=0; t<n; ++t )
+            for( Int s=n; s<m; ++s )
+                entries.push_back
+                ( Entry<Field>{info.lowerStruct[s-n],info.off+t,ZL(s,t)} );
+    }
+    else
+    {
+        for( Int t=0; t<n; ++t )
+            for( Int s=t; s<m; ++s )
+                entries.push_back
+                ( Entry<Field>{FrontIndex(info,s),info.off+t,ZL(s,t)} );
+    }
+}
+
+template<typename Field>
+void AppendEntries
+( const DistNodeInfo& info,
+  const DistMatrix<Field>& ZL,
+  bool diagonalOnly,
+  vector<Entry<Field>>& entries )
+{
+    EL_DEBUG_CSE
+    const Int localHeight = ZL.LocalHeight();
+    const Int localWidth = ZL.LocalWidth();
+    for( Int tLoc=0; tLoc<localWidth; ++tLoc )
+    {
+        const Int t = ZL.GlobalCol(tLoc);
+        for( Int sLoc=ZL.LocalRowOffset(t); sLoc<localHeight; ++sLoc )
+        {
+            const Int s = ZL.GlobalRow(sLoc);
+            if( diagonalOnly && s != t )
+                break;
+            entries.push_back
+            ( Entry<Field>{FrontIndex(info,s),info.off+t,
+                           ZL.GetLocal(sLoc,tLoc)} );
+        }
+    }
+}
+
+// Overwrite the (lower triangle of each) child's Z_{BR} with the entries of
+// the inverse of its parent front, which are drawn from ZL = [Z_{TL};Z_{BL}]
+// and Z_{BR}
+template<typename Field>
+void SelectedInverseRecursion
+( const NodeInfo& info,
+  const Front<Field>& front,
+        Matrix<Field>& ZBR,
+  bool diagonalOnly,
+  vector<Entry<Field>>& entries )
+{
+    EL_DEBUG_CSE
+    const Int n = info.size;
+    const Int updateSize = info.lowerStruct.size();
+    const bool conjugate = front.isHermitian;
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    // The dense factor may need to be read back from out-of-core storage
+    Matrix<Field> LBuffer;
+    const auto& LDense = front.DenseFactor( LBuffer );
+
+    // Form inv(L_{TL}) (with D on its diagonal) within Z_{TL} and
+    // Y := L_{BL} inv(L_{TL})
+    Matrix<Field> ZL, Y;
+    Zeros( ZL, n+updateSize, n );
+    auto ZTL = ZL( IR(0,n), ALL );
+    auto ZBL = ZL( IR(n,END), ALL );
+    if( front.sparseLeaf )
+    {
+        Identity( ZTL, n, n );
+        const bool onLeft = true;
+        suite_sparse::ldl::LSolveMulti
+        ( onLeft, n, n, ZTL.Buffer(), ZTL.LDim(),
+          front.LSparse.LockedOffsetBuffer(),
+          front.LSparse.LockedTargetBuffer(),
+          front.LSparse.LockedValueBuffer() );
+        Y = LDense;
+    }
+    else
+    {
+        ZTL = LDense( IR(0,n), ALL );
+        TriangularInverse( LOWER, UNIT, ZTL );
+        if( front.LBLR.Height() > 0 )
+            front.LBLR.Decompress( Y );
+        else
+            Y = LDense( IR(n,END), ALL );
+    }
+    SetDiagonal( ZTL, front.diag );
+    Trmm( RIGHT, LOWER, NORMAL, UNIT, Field(1), ZTL, Y );
+
+    Trdtrmm( LOWER, ZTL, conjugate );
+    if( updateSize > 0 )
+    {
+        Symm( LEFT, LOWER, Field(-1), ZBR, Y, Field(0), ZBL, conjugate );
+        Trrk( LOWER, orientation, NORMAL, Field(-1), Y, ZBL, Field(1), ZTL );
+    }
+    Y.Empty();
+    AppendEntries( info, front, ZL, diagonalOnly, entries );
+
+    // Extract the inverse over the lower structure of each child before
+    // freeing that of this front
+    const Int numChildren = info.children.size();
+    vector<Matrix<Field>> childZBRs( numChildren );
+    for( Int c=0; c<numChildren; ++c )
+    {
+        const auto& relInds = info.childRelInds[c];
+        const Int childUpdateSize = relInds.size();
+        auto& childZBR = childZBRs[c];
+        Zeros( childZBR, childUpdateSize, childUpdateSize );
+        for( Int jChild=0; jChild<childUpdateSize; ++jChild )
+        {
+            const Int j = relInds[jChild];
+            for( Int iChild=jChild; iChild<childUpdateSize; ++iChild )
+            {
+                const Int i = relInds[iChild];
+                childZBR(iChild,jChild) =
+                  ( j < n ? ZL(i,j) : ZBR(i-n,j-n) );
+            }
+        }
+    }
+    ZL.Empty();
+    ZBR.Empty();
+
+    for( Int c=0; c<numChildren; ++c )
+        SelectedInverseRecursion
+        ( *info.children[c], *front.children[c], childZBRs[c],
+          diagonalOnly, entries );
+}
+
+// Reverse the extend-add of the factorization in order to send the entries
+// of the inverse of the front over the lower structure of our child into the
+// (lower triangle of the) distribution which its update matrix had
+template<typename Field>
+void SendInverseToChild
+( const DistNodeInfo& info,
+  const DistFront<Field>& front,
+  const DistMatrix<Field>& Z,
+        DistMatrix<Field>& childZBR )
+{
+    EL_DEBUG_CSE
+    const auto& commMeta = front.commMeta;
+    if( commMeta.childRecvInds.empty() )
+        LogicError("The extend-add metadata of the front was not available");
+    mpi::Comm comm = Z.DistComm();
+    const int commSize = mpi::Size( comm );
+    vector<int> sendSizes(commSize), recvSizes(commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        sendSizes[q] = commMeta.childRecvInds[q].size()/2;
+        recvSizes[q] = commMeta.numChildSendInds[q];
+    }
+    vector<int> sendOffs, recvOffs;
+    const int sendBufSize = Scan( sendSizes, sendOffs );
+    const int recvBufSize = Scan( recvSizes, recvOffs );
+
+    // The local indices of the received updates are shared by the front
+    // and the bottom-right workspace, which continues its distribution
+    vector<Field> sendBuf( sendBufSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        const Int numSendIndPairs = sendSizes[q];
+        for( Int k=0; k<numSendIndPairs; ++k )
+        {
+            const Int iLoc = commMeta.childRecvInds[q][2*k+0];
+            const Int jLoc = commMeta.childRecvInds[q][2*k+1];
+            sendBuf[sendOffs[q]+k] = Z.GetLocal( iLoc, jLoc );
+        }
+    }
+
+    vector<Field> recvBuf( recvBufSize );
+    EL_DEBUG_ONLY(VerifySendsAndRecvs( sendSizes, recvSizes, comm ))
+    SparseAllToAll
+    ( sendBuf, sendSizes, sendOffs,
+      recvBuf, recvSizes, recvOffs, comm );
+    SwapClear( sendBuf );
+
+    // Unpack in the order in which the child update was packed
+    const Int myChild = ( info.child->onLeft ? 0 : 1 );
+    const auto& relInds = info.childRelInds[myChild];
+    auto offs = recvOffs;
+    const Int localHeight = childZBR.LocalHeight();
+    const Int localWidth = childZBR.LocalWidth();
+    for( Int jChildLoc=0; jChildLoc<localWidth; ++jChildLoc )
+    {
+        const Int jChild = childZBR.GlobalCol(jChildLoc);
+        const Int j = relInds[jChild];
+        const Int iChildOff = childZBR.LocalRowOffset( jChild );
+        for( Int iChildLoc=iChildOff; iChildLoc<localHeight; ++iChildLoc )
+        {
+            const Int iChild = childZBR.GlobalRow(iChildLoc);
+            const Int i = relInds[iChild];
+            const int q = Z.Owner( i, j );
+            childZBR.SetLocal( iChildLoc, jChildLoc, recvBuf[offs[q]++] );
+        }
+    }
+}
+
+// Same as the sequential recursion, but the entire front of the inverse is
+// stored within Z (in the alignment of the factored front) so that the
+// extend-add metadata can be reused
+template<typename Field>
+void SelectedInverseRecursion
+( const DistNodeInfo& info,
+  const DistFront<Field>& front,
+        DistMatrix<Field>& Z,
+  bool diagonalOnly,
+  vector<Entry<Field>>& entries )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = info.Grid();
+    const Int n = info.size;
+    const Int m = Z.Height();
+    const bool conjugate = front.isHermitian;
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+    const Range<Int> ind1( 0, n ), ind2( n, m );
+
+    DistMatrix<Field> LCopy(grid);
+    if( FrontIs1D(front.type) )
+        LCopy = front.L1D;
+    const DistMatrix<Field>& L = ( FrontIs1D(front.type) ? LCopy : front.L2D );
+
+    {
+        auto ZTL = Z( ind1, ind1 );
+        auto ZBL = Z( ind2, ind1 );
+        auto ZBR = Z( ind2, ind2 );
+
+        // The top-left block of the factor was already inverted for
+        // selective-inversion front types
+        ZTL = L( ind1, ALL );
+        if( !SelInvFactorization(front.type) )
+            TriangularInverse( LOWER, UNIT, ZTL );
+        SetDiagonal( ZTL, front.diag );
+        DistMatrix<Field> Y(grid);
+        Y = L( ind2, ALL );
+        LCopy.Empty();
+        Trmm( RIGHT, LOWER, NORMAL, UNIT, Field(1), ZTL, Y );
+
+        Trdtrmm( LOWER, ZTL, conjugate );
+        if( m > n )
+        {
+            Symm( LEFT, LOWER, Field(-1), ZBR, Y, Field(0), ZBL, conjugate );
+            Trrk
+            ( LOWER, orientation, NORMAL, Field(-1), Y, ZBL, Field(1), ZTL );
+        }
+    }
+    AppendEntries( info, Z( ALL, ind1 ), diagonalOnly, entries );
+
+    const auto& childInfo = *info.child;
+    const auto& childFront = *front.child;
+    const Int childSize = childInfo.size;
+    const Int childUpdateSize = childInfo.lowerStruct.size();
+    if( childFront.duplicate != nullptr )
+    {
+        DistMatrix<Field> childZBR( childInfo.Grid() );
+        Zeros( childZBR, childUpdateSize, childUpdateSize );
+        SendInverseToChild( info, front, Z, childZBR );
+        Z.Empty();
+        SelectedInverseRecursion
+        ( *childInfo.duplicate, *childFront.duplicate, childZBR.Matrix(),
+          diagonalOnly, entries );
+    }
+    else
+    {
+        DistMatrix<Field> childZ( childInfo.Grid() );
+        Zeros( childZ, childSize+childUpdateSize, childSize+childUpdateSize );
+        auto childZBR = childZ( IR(childSize,END), IR(childSize,END) );
+        SendInverseToChild( info, front, Z, childZBR );
+        Z.Empty();
+        SelectedInverseRecursion
+        ( childInfo, childFront, childZ, diagonalOnly, entries );
+    }
+}
+
+} // anonymous namespace
+
+template<typename Field>
+void SelectedInverse
+( const NodeInfo& info,
+  const Front<Field>& front,
+        vector<Entry<Field>>& entries,
+  bool diagonalOnly )
+{
+    EL_DEBUG_CSE
+    CheckSelectedInverseType( info, front.type );
+    Matrix<Field> ZBR;
+    SelectedInverseRecursion( info, front, ZBR, diagonalOnly, entries );
+}
+
+template<typename Field>
+void SelectedInverse
+( const DistNodeInfo& info,
+  const DistFront<Field>& front,
+        vector<Entry<Field>>& entries,
+  bool diagonalOnly )
+{
+    EL_DEBUG_CSE
+    CheckSelectedInverseType( info, front.type );
+    if( front.duplicate != nullptr )
+    {
+        Matrix<Field> ZBR;
+        SelectedInverseRecursion
+        ( *info.duplicate, *front.duplicate, ZBR, diagonalOnly, entries );
+        return;
+    }
+    DistMatrix<Field> Z( info.Grid() );
+    Zeros( Z, info.size, info.size );
+    SelectedInverseRecursion( info, front, Z, diagonalOnly, entries );
+}
+
+#define PROTO(Field) \
+  template void SelectedInverse \
+  ( const NodeInfo& info, \
+    const Front<Field>& front, \
+          vector<Entry<Field>>& entries, \
+    bool diagonalOnly ); \
+  template void SelectedInverse \
+  ( const DistNodeInfo& info, \
+    const DistFront<Field>& front, \
+          vector<Entry<Field>>& entries, \
+    bool diagonalOnly );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
@@ -101,7 +101,8 @@ void SparseLDLFactorization<Field>::Initialize3DGridGraph
 }
 
 template<typename Field>
-void SparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
+void SparseLDLFactorization<Field>::Factor
+( LDLFrontType frontType, const ldl::BLRCtrl<Base<Field>>& blrCtrl )
 {
     EL_DEBUG_CSE
     if( !initialized_ )
@@ -113,15 +114,35 @@ void SparseLDLFactorization<Field>::Factor( LDLFrontType frontType )
     
     // Convert from 1D to 2D if necessary
     ChangeFrontType( SYMM_2D );
+
+    // Discard the factors offloaded by any previous factorization
+    if( store_ )
+    {
+        store_->Clear();
+        ldl::AttachStore( *front_, store_.get() );
+    }
     
     // Perform the initial factorization
-    ldl::Process( *info_, *front_, InitialFactorType(frontType) );
+    ldl::Process
+    ( *info_, *front_, InitialFactorType(frontType), blrCtrl, kernel_ );
     factored_ = true;
+    factorType_ = frontType;
+    blrCtrl_ = blrCtrl;
     
     // Convert the fronts from the initial factorization to the requested form
     ChangeFrontType( frontType );
 }
 
+template<typename Field>
+void SparseLDLFactorization<Field>::Refactor( const SparseMatrix<Field>& ANew )
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before Refactor()");
+    ChangeNonzeroValues( ANew );
+    Factor( factorType_, blrCtrl_ );
+}
+
 template<typename Field>
 void SparseLDLFactorization<Field>::ChangeFrontType( LDLFrontType frontType )
 {
@@ -131,6 +152,23 @@ void SparseLDLFactorization<Field>::ChangeFrontType( LDLFrontType frontType )
     ldl::ChangeFrontType( *front_, frontType );
 }
 
+template<typename Field>
+void SparseLDLFactorization<Field>::EnableOutOfCore( const string& directory )
+{
+    EL_DEBUG_CSE
+    if( factored_ )
+        LogicError("Must enable out-of-core storage before factoring");
+    store_.reset( new ldl::FrontStore<Field>(directory) );
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::SetDenseFrontKernel
+( const ldl::DenseFrontKernel<Field>& kernel )
+{
+    EL_DEBUG_CSE
+    kernel_ = kernel;
+}
+
 template<typename Field>
 void SparseLDLFactorization<Field>::ChangeNonzeroValues
 ( const SparseMatrix<Field>& ANew )
@@ -239,6 +277,82 @@ void SparseLDLFactorization<Field>::SolveWithIterativeRefinement
     B = X;
 }
 
+template<typename Field>
+template<typename FieldHigh>
+void SparseLDLFactorization<Field>::SolveWithIterativeRefinement
+( const SparseMatrix<FieldHigh>& A,
+        Matrix<FieldHigh>& B,
+  const Base<FieldHigh>& minReductionFactor,
+        Int maxRefineIts ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before SolveWithIterativeRefinement()");
+    // TODO(poulson): Generalize this implementation
+    if( B.Width() > 1 )
+        LogicError("Iterative Refinement currently only supported for one RHS");
+    auto BOrig = B;
+
+    // Solve against the factorization in its own precision after normalizing
+    // the right-hand side so that small residuals do not underflow
+    Matrix<Field> YLow;
+    auto lowSolve = [&]( Matrix<FieldHigh>& Y )
+    {
+        const Base<FieldHigh> YNorm = FrobeniusNorm( Y );
+        if( YNorm == Base<FieldHigh>(0) )
+            return;
+        Y *= FieldHigh(1)/YNorm;
+        Copy( Y, YLow );
+        Solve( YLow );
+        Copy( YLow, Y );
+        Y *= FieldHigh(YNorm);
+    };
+
+    // Compute the initial guess
+    // =========================
+    Matrix<FieldHigh> X( B );
+    lowSolve( X );
+
+    Int refineIt = 0;
+    if( maxRefineIts > 0 )
+    {
+        Matrix<FieldHigh> dX, XCand;
+        Multiply( NORMAL, FieldHigh(-1), A, X, FieldHigh(1), B );
+        Base<FieldHigh> errorNorm = FrobeniusNorm( B );
+        for( ; refineIt<maxRefineIts; ++refineIt )
+        {
+            // Compute the proposed update to the solution
+            // -------------------------------------------
+            dX = B;
+            lowSolve( dX );
+            XCand = X;
+            XCand += dX;
+
+            // If the proposed update lowers the residual, accept it
+            // -----------------------------------------------------
+            B = BOrig;
+            Multiply( NORMAL, FieldHigh(-1), A, XCand, FieldHigh(1), B );
+            Base<FieldHigh> newErrorNorm = FrobeniusNorm( B );
+            if( minReductionFactor*newErrorNorm < errorNorm )
+            {
+                X = XCand;
+                errorNorm = newErrorNorm;
+            }
+            else if( newErrorNorm < errorNorm )
+            {
+                X = XCand;
+                errorNorm = newErrorNorm;
+                break;
+            }
+            else
+                break;
+        }
+    }
+    // Store the final result
+    // ======================
+    B = X;
+}
+
 template<typename Field>
 void SparseLDLFactorization<Field>::SolveAgainstL
 ( Orientation orientation, Matrix<Field>& B ) const
@@ -347,6 +461,46 @@ void SparseLDLFactorization<Field>::MultiplyWithD
     }
 }
 
+template<typename Field>
+void SparseLDLFactorization<Field>::SelectedInverse
+( SparseMatrix<Field>& AInv ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before SelectedInverse()");
+    vector<Entry<Field>> entries;
+    ldl::SelectedInverse( *info_, *front_, entries );
+
+    const Int n = inverseMap_.size();
+    Zeros( AInv, n, n );
+    AInv.Reserve( 2*entries.size() );
+    for( const auto& entry : entries )
+    {
+        const Int i = inverseMap_[entry.i];
+        const Int j = inverseMap_[entry.j];
+        AInv.QueueUpdate( i, j, entry.value );
+        if( i != j )
+            AInv.QueueUpdate
+            ( j, i, front_->isHermitian ? Conj(entry.value) : entry.value );
+    }
+    AInv.ProcessQueues();
+}
+
+template<typename Field>
+void SparseLDLFactorization<Field>::InverseDiagonal( Matrix<Field>& d ) const
+{
+    EL_DEBUG_CSE
+    if( !factored_ )
+        LogicError("Must call Factor() before InverseDiagonal()");
+    vector<Entry<Field>> entries;
+    const bool diagonalOnly = true;
+    ldl::SelectedInverse( *info_, *front_, entries, diagonalOnly );
+
+    Zeros( d, inverseMap_.size(), 1 );
+    for( const auto& entry : entries )
+        d(inverseMap_[entry.i],0) = entry.value;
+}
+
 template<typename Field>
 bool SparseLDLFactorization<Field>::Factored() const
 { return factored_; }
@@ -475,4 +629,15 @@ const vector<Int>& SparseLDLFactorization<Field>::InverseMap() const
 #define EL_ENABLE_BIGFLOAT
 #include <El/macros/Instantiate.h>
 
+#define MIXED_PROTO(Field,FieldHigh) \
+  template void \
+  SparseLDLFactorization<Field>::SolveWithIterativeRefinement \
+  ( const SparseMatrix<FieldHigh>& A, \
+          Matrix<FieldHigh>& B, \
+    const Base<FieldHigh>& minReductionFactor, \
+          Int maxRefineIts ) const;
+
+MIXED_PROTO(float,double)
+MIXED_PROTO(Complex<float>,Complex<double>)
+
 } // namespace El
@@ -0,0 +1,168 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <unordered_map>
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// The number of entries of the lower trapezoid of a front
+inline double FrontEntries( Int size, Int lowerSize )
+{ return double(size)*(size+1)/2 + double(size)*lowerSize; }
+
+struct AmalgamationState
+{
+    // The original positions of the indices of each (merged) node
+    std::unordered_map<const NodeInfo*,vector<Int>> oldPositions;
+    // The number of entries of each (merged) front which were not introduced
+    // as explicit zeros
+    std::unordered_map<const NodeInfo*,double> trueEntries;
+};
+
+void AmalgamateRecursion
+( Separator& sep, NodeInfo& info,
+  AmalgamationState& state, const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    auto& oldPositions = state.oldPositions[&info];
+    oldPositions.resize( info.size );
+    for( Int t=0; t<info.size; ++t )
+        oldPositions[t] = info.off + t;
+    const Int lowerSize = info.lowerStruct.size();
+    double& trueEntries = state.trueEntries[&info];
+    trueEntries = FrontEntries( info.size, lowerSize );
+
+    for( size_t c=0; c<info.children.size(); ++c )
+        AmalgamateRecursion
+        ( *sep.children[c], *info.children[c], state, ctrl );
+
+    // Since the structure of each child is contained within the structure of
+    // the parent, merging a child leaves the lower structure of the parent
+    // unchanged and only introduces zeros into the columns of the child.
+    // The children of merged children are themselves considered for merging.
+    size_t c = 0;
+    while( c < info.children.size() )
+    {
+        NodeInfo& child = *info.children[c];
+        if( child.children.empty() )
+        {
+            ++c;
+            continue;
+        }
+        const Int mergedSize = child.size + info.size;
+        const double mergedEntries = FrontEntries( mergedSize, lowerSize );
+        const double mergedTrueEntries =
+          trueEntries + state.trueEntries[&child];
+        const double zeroFraction =
+          (mergedEntries-mergedTrueEntries) / mergedEntries;
+        if( mergedSize > ctrl.minFrontSize &&
+            zeroFraction > ctrl.maxZeroFraction )
+        {
+            ++c;
+            continue;
+        }
+
+        // Eliminate the indices of the child before those of the parent
+        unique_ptr<NodeInfo> childInfo = std::move( info.children[c] );
+        unique_ptr<Separator> childSep = std::move( sep.children[c] );
+        info.children.erase( info.children.begin()+c );
+        sep.children.erase( sep.children.begin()+c );
+
+        const auto& childPositions = state.oldPositions[childInfo.get()];
+        oldPositions.insert
+        ( oldPositions.begin(), childPositions.begin(), childPositions.end() );
+        sep.inds.insert
+        ( sep.inds.begin(), childSep->inds.begin(), childSep->inds.end() );
+        info.size = mergedSize;
+        info.origLowerStruct =
+          Union( info.origLowerStruct, childInfo->origLowerStruct );
+        trueEntries = mergedTrueEntries;
+
+        const Int numGrandchildren = childInfo->children.size();
+        for( Int g=0; g<numGrandchildren; ++g )
+        {
+            childInfo->children[g]->parent = &info;
+            childSep->children[g]->parent = &sep;
+        }
+        info.children.insert
+        ( info.children.begin()+c,
+          std::make_move_iterator(childInfo->children.begin()),
+          std::make_move_iterator(childInfo->children.end()) );
+        sep.children.insert
+        ( sep.children.begin()+c,
+          std::make_move_iterator(childSep->children.begin()),
+          std::make_move_iterator(childSep->children.end()) );
+        state.oldPositions.erase( childInfo.get() );
+        state.trueEntries.erase( childInfo.get() );
+    }
+}
+
+} // anonymous namespace
+
+void Amalgamate
+( Separator& rootSep, NodeInfo& rootInfo, const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    // The subtree occupies a contiguous range of indices ending with the root
+    function<Int(const NodeInfo&)> subtreeSize =
+      [&]( const NodeInfo& info )
+      {
+          Int numInds = info.size;
+          for( const auto& child : info.children )
+              numInds += subtreeSize( *child );
+          return numInds;
+      };
+    const Int numInds = subtreeSize( rootInfo );
+    const Int firstInd = rootInfo.off + rootInfo.size - numInds;
+
+    AmalgamationState state;
+    AmalgamateRecursion( rootSep, rootInfo, state, ctrl );
+
+    // Renumber the merged tree in postorder
+    vector<Int> newPositions( numInds );
+    Int newOff = firstInd;
+    function<void(Separator&,NodeInfo&)> renumber =
+      [&]( Separator& sep, NodeInfo& info )
+      {
+          const Int numChildren = info.children.size();
+          for( Int c=0; c<numChildren; ++c )
+              renumber( *sep.children[c], *info.children[c] );
+          const auto& oldPositions = state.oldPositions[&info];
+          sep.off = info.off = newOff;
+          for( Int t=0; t<info.size; ++t )
+              newPositions[oldPositions[t]-firstInd] = newOff++;
+      };
+    renumber( rootSep, rootInfo );
+
+    // Translate the original structures into the new ordering while removing
+    // the indices which were merged into each front
+    function<void(NodeInfo&)> translate =
+      [&]( NodeInfo& info )
+      {
+          for( const auto& child : info.children )
+              translate( *child );
+          vector<Int> origLowerStruct;
+          origLowerStruct.reserve( info.origLowerStruct.size() );
+          for( Int i : info.origLowerStruct )
+          {
+              if( i >= firstInd && i < firstInd+numInds )
+                  i = newPositions[i-firstInd];
+              if( i >= info.off+info.size )
+                  origLowerStruct.push_back( i );
+          }
+          std::sort( origLowerStruct.begin(), origLowerStruct.end() );
+          info.origLowerStruct = std::move( origLowerStruct );
+      };
+    translate( rootInfo );
+}
+
+} // namespace ldl
+} // namespace El
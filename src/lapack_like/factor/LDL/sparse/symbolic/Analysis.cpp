@@ -269,9 +269,13 @@ Int Analysis( NodeInfo& node, Int myOff )
 
         // Construct the relative indices of the children
         node.childRelInds.resize( numChildren );
+        node.childRelIndRuns.resize( numChildren );
         for( Int c=0; c<numChildren; ++c )
+        {
             node.childRelInds[c] =
                 RelativeIndices( node.children[c]->lowerStruct, fullStruct );
+            node.childRelIndRuns[c] = IndexRuns( node.childRelInds[c] );
+        }
 
         // Form lower struct of this node by removing node indices
         // (which take up the first node.size indices of fullStruct)
@@ -9,11 +9,16 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include <exception>
 #include <set>
 
 namespace El {
 namespace ldl {
 
+// Subgraphs with fewer sources than this are dissected by the thread which
+// bisected their parent rather than by a new task
+const Int ndMinTaskSources = 4096;
+
 void AMDOrder
 ( const vector<Int>& subOffsets,
   const vector<Int>& subTargets,
@@ -242,23 +247,74 @@ NestedDissectionRecursion
 
         sep.children.reserve( 2 );
         info.children.reserve( 2 );
+        for( Int c=0; c<2; ++c )
+        {
+            sep.children.emplace_back( new Separator(&sep) );
+            info.children.emplace_back( new NodeInfo(&info) );
+        }
 
-        sep.children.emplace_back( new Separator(&sep) );
-        info.children.emplace_back( new NodeInfo(&info) );
-        NestedDissectionRecursion
-        ( leftChild, leftPerm,
-          *sep.children.back(), *info.children.back(),
-          off, ctrl );
-
-        sep.children.emplace_back( new Separator(&sep) );
-        info.children.emplace_back( new NodeInfo(&info) );
+        // The two halves are independent, so (sufficiently large) left halves
+        // are dissected by a separate task when the recursion is threaded
+        std::exception_ptr leftError;
+#ifdef EL_HYBRID
+        const bool spawnTask = ( leftChildSize >= ndMinTaskSources );
+        _Pragma("omp task default(shared) if(spawnTask)")
+#endif
+        {
+            try
+            {
+                NestedDissectionRecursion
+                ( leftChild, leftPerm, *sep.children[0], *info.children[0],
+                  off, ctrl );
+            }
+            catch( ... ) { leftError = std::current_exception(); }
+        }
         NestedDissectionRecursion
-        ( rightChild, rightPerm,
-          *sep.children.back(), *info.children.back(),
+        ( rightChild, rightPerm, *sep.children[1], *info.children[1],
           off+leftChildSize, ctrl );
+#ifdef EL_HYBRID
+        _Pragma("omp taskwait")
+#endif
+        if( leftError )
+            std::rethrow_exception( leftError );
     }
 }
 
+// Dissect the sequential graph with OpenMP tasks for its independent halves
+// (unless threads are unavailable or we are already within a parallel region)
+inline void
+ThreadedNestedDissection
+( const Graph& graph,
+  const vector<Int>& perm,
+        Separator& sep,
+        NodeInfo& info,
+        Int off,
+  const BisectCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+#ifdef EL_HYBRID
+    const int numThreads = blas::FallbackThreads();
+    if( numThreads > 1 && !omp_in_parallel() &&
+        graph.NumSources() > ctrl.cutoff )
+    {
+        std::exception_ptr error;
+        _Pragma("omp parallel num_threads(numThreads)")
+        _Pragma("omp single")
+        {
+            try
+            {
+                NestedDissectionRecursion( graph, perm, sep, info, off, ctrl );
+            }
+            catch( ... ) { error = std::current_exception(); }
+        }
+        if( error )
+            std::rethrow_exception( error );
+        return;
+    }
+#endif
+    NestedDissectionRecursion( graph, perm, sep, info, off, ctrl );
+}
+
 inline void
 NestedDissectionRecursion
 ( const DistGraph& graph,
@@ -375,8 +431,13 @@ NestedDissectionRecursion
 
         sep.duplicate.reset( new Separator(&sep) );
         info.duplicate.reset( new NodeInfo(&info) );
-        NestedDissectionRecursion
+        ThreadedNestedDissection
         ( seqGraph, perm.Map(), *sep.duplicate, *info.duplicate, off, ctrl );
+        if( ctrl.amalgamate )
+        {
+            Analysis( *info.duplicate );
+            Amalgamate( *sep.duplicate, *info.duplicate, ctrl );
+        }
 
         // Pull information up from the duplicates
         sep.off = sep.duplicate->off;
@@ -401,7 +462,12 @@ void NestedDissection
     for( Int s=0; s<numSources; ++s )
         perm[s] = s;
 
-    NestedDissectionRecursion( graph, perm, sep, info, 0, ctrl );
+    ThreadedNestedDissection( graph, perm, sep, info, 0, ctrl );
+    if( ctrl.amalgamate )
+    {
+        Analysis( info );
+        Amalgamate( sep, info, ctrl );
+    }
 
     // Construct the distributed reordering
     sep.BuildMap( map );
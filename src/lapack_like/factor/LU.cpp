@@ -10,9 +10,11 @@
 
 #include "./LU/Local.hpp"
 #include "./LU/Panel.hpp"
+#include "./LU/Tournament.hpp"
 #include "./LU/Full.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
+#include "./LU/Block.hpp"
 
 namespace El {
 
@@ -25,7 +27,7 @@ void LU( Matrix<F>& A )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "LU" );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -47,6 +49,7 @@ template<typename F>
 void LU( AbstractDistMatrix<F>& APre )
 {
     EL_DEBUG_CSE
+    EL_REGION("LU");
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
@@ -60,7 +63,7 @@ void LU( AbstractDistMatrix<F>& APre )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "LU", APre.Grid() );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -109,7 +112,7 @@ void LU( Matrix<F>& A, Permutation& P )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "LU" );
 
     P.MakeIdentity( m );
     P.ReserveSwaps( minDim );
@@ -155,6 +158,22 @@ template<typename F>
 void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
 {
     EL_DEBUG_CSE
+    LU( APre, P, LU_PARTIAL );
+}
+
+template<typename F>
+void LU
+( AbstractDistMatrix<F>& APre, DistPermutation& P, LUPivotType pivotType )
+{
+    EL_DEBUG_CSE
+    EL_REGION("LU");
+    if( pivotType != LU_PARTIAL && pivotType != LU_TOURNAMENT )
+        LogicError("Only partial and tournament pivoting are supported");
+    if( APre.Wrap() == BLOCK && pivotType == LU_PARTIAL )
+    {
+        lu::Block( APre, P );
+        return;
+    }
 
     DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
     auto& A = AProx.Get();
@@ -176,7 +195,7 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
     DistPermutation PB(g);
 
     vector<F> panelBuf, pivotBuf;
-    const Int bsize = Blocksize();
+    const Int bsize = TunedBlocksize<F>( "LU", APre.Grid() );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -199,7 +218,10 @@ void LU( AbstractDistMatrix<F>& APre, DistPermutation& P )
         ( A21Height, nb, g, A21.ColAlign(), 0, &panelBuf[nb], panelLDim, 0 );
         A11_STAR_STAR = A11;
         A21_MC_STAR = A21;
-        lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+        if( pivotType == LU_TOURNAMENT )
+            lu::TournamentPanel( A11_STAR_STAR, A21_MC_STAR, P, PB, k );
+        else
+            lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
 
         PB.PermuteRows( AB );
 
@@ -241,6 +263,10 @@ void LU
   ( AbstractDistMatrix<F>& A, \
     DistPermutation& P ); \
   template void LU \
+  ( AbstractDistMatrix<F>& A, \
+    DistPermutation& P, \
+    LUPivotType pivotType ); \
+  template void LU \
   ( Matrix<F>& A, \
     Permutation& P, \
     Permutation& Q ); \
@@ -0,0 +1,100 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_BLOCK_HPP
+#define EL_LU_BLOCK_HPP
+
+namespace El {
+namespace lu {
+
+// Right-looking LU with partial pivoting directly over block-cyclic
+// matrices. The panels are the distribution blocks, so that each panel lies
+// within a single process column; the panel is replicated and redundantly
+// factored, its row interchanges are applied to the remaining columns with
+// (block-aware) row swaps, and the trailing update is a local Gemm. Matrices
+// whose row and column blockings differ fall back to the element-wise
+// algorithm.
+template<typename F>
+void Block( AbstractDistMatrix<F>& APre, DistPermutation& P )
+{
+    EL_DEBUG_CSE
+    EL_REGION("lu::Block");
+
+    DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK> AProx( APre );
+    auto& A = AProx.Get();
+    if( A.BlockHeight() != A.BlockWidth() || A.ColCut() != A.RowCut() )
+    {
+        DistMatrixReadWriteProxy<F,F,MC,MR> AElemProx( A );
+        LU( AElemProx.Get(), P, LU_PARTIAL );
+        return;
+    }
+
+    const Grid& g = A.Grid();
+    DistMatrix<F,STAR,STAR,BLOCK> AB1_STAR_STAR(g);
+    DistMatrix<F,MC,  STAR,BLOCK> A21_MC_STAR(g);
+    DistMatrix<F,STAR,MR,  BLOCK> A12_STAR_MR(g);
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    P.SetGrid( g );
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+
+    Permutation PPanel, PBPanel;
+    for( Int k=0; k<minDim; )
+    {
+        const Int nb =
+          Min( k==0 ? A.BlockHeight()-A.ColCut() : A.BlockHeight(),
+               minDim-k );
+        const IR ind0( 0, k ), ind1( k, k+nb ), ind2( k+nb, END ),
+                 indB( k, END );
+
+        auto AB1 = A( indB, ind1 );
+        auto A12 = A( ind1, ind2 );
+        auto A22 = A( ind2, ind2 );
+        auto A0 = A( ALL, ind0 );
+        auto A2 = A( ALL, ind2 );
+
+        // Redundantly factor the replicated panel
+        AB1_STAR_STAR = AB1;
+        PPanel.MakeIdentity( m-k );
+        PPanel.ReserveSwaps( nb );
+        Panel( AB1_STAR_STAR.Matrix(), PPanel, PBPanel, 0 );
+        AB1 = AB1_STAR_STAR;
+
+        // Apply the interchanges to the columns outside of the panel
+        const auto dests = PBPanel.SwapDestinations();
+        for( Int j=0; j<nb; ++j )
+        {
+            const Int dest = dests(j);
+            P.Swap( k+j, k+dest );
+            RowSwap( A0, k+j, k+dest );
+            RowSwap( A2, k+j, k+dest );
+        }
+
+        auto L11_STAR_STAR = AB1_STAR_STAR( IR(0,nb), ALL );
+        A12_STAR_MR.AlignRowsWith( A22 );
+        A12_STAR_MR = A12;
+        Trsm
+        ( LEFT, LOWER, NORMAL, UNIT,
+          F(1), L11_STAR_STAR.LockedMatrix(), A12_STAR_MR.Matrix() );
+        A12 = A12_STAR_MR;
+
+        A21_MC_STAR.AlignColsWith( A22 );
+        A21_MC_STAR = AB1_STAR_STAR( IR(nb,END), ALL );
+        LocalGemm( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12_STAR_MR, F(1), A22 );
+
+        k += nb;
+    }
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_BLOCK_HPP
@@ -0,0 +1,247 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_TOURNAMENT_HPP
+#define EL_LU_TOURNAMENT_HPP
+
+namespace El {
+namespace lu {
+
+namespace tournament {
+
+// Overwrite the candidate rows C (and their panel indices) with the (at most
+// C.Width()) rows chosen as pivots by an LU with partial pivoting of C.
+// The selected rows keep their original values and are stored in pivot order.
+template<typename F>
+void SelectPivots( Matrix<F>& C, vector<Int>& inds )
+{
+    EL_DEBUG_CSE
+    const Int h = C.Height();
+    const Int n = C.Width();
+    const Int numPivots = Min(h,n);
+
+    Matrix<F> W( C );
+    F* WBuf = W.Buffer();
+    const Int WLDim = W.LDim();
+    vector<Int> order( h );
+    for( Int i=0; i<h; ++i )
+        order[i] = i;
+    for( Int k=0; k<numPivots; ++k )
+    {
+        const Int iPiv = k + blas::MaxInd( h-k, &WBuf[k+k*WLDim], 1 );
+        if( iPiv != k )
+        {
+            blas::Swap( n, &WBuf[k], WLDim, &WBuf[iPiv], WLDim );
+            std::swap( order[k], order[iPiv] );
+        }
+
+        // A zero column leaves the remaining candidates unranked
+        const F alpha = WBuf[k+k*WLDim];
+        if( alpha == F(0) )
+            continue;
+        blas::Scal( h-(k+1), F(1)/alpha, &WBuf[(k+1)+k*WLDim], 1 );
+        blas::Geru
+        ( h-(k+1), n-(k+1),
+          F(-1), &WBuf[(k+1)+k*WLDim], 1, &WBuf[k+(k+1)*WLDim], WLDim,
+                 &WBuf[(k+1)+(k+1)*WLDim], WLDim );
+    }
+
+    Matrix<F> S( numPivots, n );
+    vector<Int> selectedInds( numPivots );
+    for( Int t=0; t<numPivots; ++t )
+    {
+        selectedInds[t] = inds[order[t]];
+        for( Int j=0; j<n; ++j )
+            S(t,j) = C(order[t],j);
+    }
+    C = S;
+    inds = selectedInds;
+}
+
+} // namespace tournament
+
+// Factor a panel using tournament pivoting (as in CALU). Rather than a
+// reduction over the process column for each pivot, each process nominates
+// pivot candidates from an LU of its local rows, and the nominees are
+// exchanged once so that the remaining rounds of the tournament can be played
+// redundantly over a binary reduction tree. The panel is then factored
+// without pivoting.
+//
+// The same layout assumptions as lu::Panel are made on A[*,*] and B[MC,*].
+template<typename F>
+void TournamentPanel
+( DistMatrix<F,  STAR,STAR>& A,
+  DistMatrix<F,  MC,  STAR>& B,
+  DistPermutation& P,
+  DistPermutation& PB,
+  Int offset )
+{
+    EL_DEBUG_CSE
+    EL_REGION("lu::TournamentPanel");
+    const Int n = A.Width();
+    const Int BLocHeight = B.LocalHeight();
+    F* ABuf = A.Buffer();
+    F* BBuf = B.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    mpi::Comm colComm = B.ColComm();
+    const int colRank = mpi::Rank( colComm );
+    const int colSize = mpi::Size( colComm );
+    EL_DEBUG_ONLY(
+      AssertSameGrids( A, B );
+      if( n != B.Width() )
+          LogicError("A and B must be the same width");
+      if( A.Buffer()+n != B.Buffer() )
+          LogicError("Buffers of A and B did not properly align");
+    )
+
+    PB.MakeIdentity( A.Height()+B.Height() );
+    PB.ReserveSwaps( n );
+
+    // Nominate candidates from the local rows (the rows of A are replicated,
+    // so only the first process in the column nominates from them)
+    const Int numTopCands = ( colRank == 0 ? n : 0 );
+    Matrix<F> C( numTopCands+BLocHeight, n );
+    vector<Int> inds( numTopCands+BLocHeight );
+    for( Int i=0; i<numTopCands; ++i )
+    {
+        inds[i] = i;
+        for( Int j=0; j<n; ++j )
+            C(i,j) = ABuf[i+j*ALDim];
+    }
+    for( Int iLoc=0; iLoc<BLocHeight; ++iLoc )
+    {
+        inds[numTopCands+iLoc] = B.GlobalRow(iLoc) + n;
+        for( Int j=0; j<n; ++j )
+            C(numTopCands+iLoc,j) = BBuf[iLoc+j*BLDim];
+    }
+    tournament::SelectPivots( C, inds );
+
+    // Exchange the nominees, padded to n rows (with negative indices)
+    vector<F> sendVals( n*n, F(0) ), recvVals( colSize*n*n );
+    vector<Int> sendInds( n, -1 ), recvInds( colSize*n );
+    for( Int t=0; t<C.Height(); ++t )
+    {
+        sendInds[t] = inds[t];
+        for( Int j=0; j<n; ++j )
+            sendVals[t+j*n] = C(t,j);
+    }
+    mpi::AllGather( sendVals.data(), n*n, recvVals.data(), n*n, colComm );
+    mpi::AllGather( sendInds.data(), n, recvInds.data(), n, colComm );
+
+    vector<Matrix<F>> nominees( colSize );
+    vector<vector<Int>> nomineeInds( colSize );
+    for( Int q=0; q<colSize; ++q )
+    {
+        const Int* qInds = &recvInds[q*n];
+        const F* qVals = &recvVals[q*n*n];
+        Int numNominees = 0;
+        while( numNominees < n && qInds[numNominees] >= 0 )
+            ++numNominees;
+        nominees[q].Resize( numNominees, n );
+        nomineeInds[q].assign( qInds, qInds+numNominees );
+        for( Int j=0; j<n; ++j )
+            for( Int t=0; t<numNominees; ++t )
+                nominees[q](t,j) = qVals[t+j*n];
+    }
+    for( Int stride=1; stride<colSize; stride*=2 )
+    {
+        for( Int q=0; q+stride<colSize; q+=2*stride )
+        {
+            const Int h0 = nominees[q].Height();
+            const Int h1 = nominees[q+stride].Height();
+            Matrix<F> S( h0+h1, n );
+            auto S0 = S( IR(0,h0), ALL );
+            auto S1 = S( IR(h0,h0+h1), ALL );
+            S0 = nominees[q];
+            S1 = nominees[q+stride];
+            vector<Int> SInds( nomineeInds[q] );
+            SInds.insert
+            ( SInds.end(),
+              nomineeInds[q+stride].begin(), nomineeInds[q+stride].end() );
+            tournament::SelectPivots( S, SInds );
+            nominees[q] = S;
+            nomineeInds[q] = SInds;
+        }
+    }
+    const Matrix<F>& winners = nominees[0];
+    const vector<Int>& winnerInds = nomineeInds[0];
+    if( winners.Height() != n )
+        LogicError("Tournament selected ",winners.Height()," of ",n," pivots");
+
+    // Record the swaps which bring the winners to the top of the panel while
+    // tracking which original row ends up in each modified position
+    std::map<Int,Int> source, location;
+    for( Int k=0; k<n; ++k )
+    {
+        const Int winner = winnerInds[k];
+        auto locIt = location.find( winner );
+        const Int iPiv = ( locIt == location.end() ? winner : locIt->second );
+        P.Swap( k+offset, iPiv+offset );
+        PB.Swap( k, iPiv );
+        if( iPiv != k )
+        {
+            auto sourceIt = source.find( k );
+            const Int displaced =
+              ( sourceIt == source.end() ? k : sourceIt->second );
+            source[k] = winner;
+            source[iPiv] = displaced;
+            location[winner] = k;
+            location[displaced] = iPiv;
+        }
+    }
+
+    // Since the original values of A and of the winners are known to every
+    // process, the rows can be moved without further communication
+    std::map<Int,Int> winnerRank;
+    for( Int t=0; t<n; ++t )
+        winnerRank[winnerInds[t]] = t;
+    Matrix<F> AOrig( A.Matrix() );
+    for( const auto& entry : source )
+    {
+        const Int i = entry.first;
+        const Int origin = entry.second;
+        F* rowBuf;
+        Int rowStride;
+        if( i < n )
+        {
+            rowBuf = &ABuf[i];
+            rowStride = ALDim;
+        }
+        else if( B.IsLocalRow(i-n) )
+        {
+            rowBuf = &BBuf[B.LocalRow(i-n)];
+            rowStride = BLDim;
+        }
+        else
+            continue;
+
+        if( origin < n )
+        {
+            for( Int j=0; j<n; ++j )
+                rowBuf[j*rowStride] = AOrig(origin,j);
+        }
+        else
+        {
+            const Int t = winnerRank[origin];
+            for( Int j=0; j<n; ++j )
+                rowBuf[j*rowStride] = winners(t,j);
+        }
+    }
+
+    // With the pivots in place, the panel can be factored without pivoting
+    lu::Unb( A.Matrix() );
+    Trsm
+    ( RIGHT, UPPER, NORMAL, NON_UNIT,
+      F(1), A.LockedMatrix(), B.Matrix() );
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_TOURNAMENT_HPP
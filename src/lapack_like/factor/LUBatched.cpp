@@ -0,0 +1,44 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+void LUBatched( vector<Matrix<Field>>& A, vector<Permutation>& P )
+{
+    EL_DEBUG_CSE
+    EL_REGION("LUBatched");
+    const Int batchSize = A.size();
+    P.resize( batchSize );
+    ParallelFor( batchSize, [&]( Int b ) { LU( A[b], P[b] ); } );
+}
+
+template<typename Field>
+void LUBatched( Int batchSize, Matrix<Field>& A, vector<Permutation>& P )
+{
+    EL_DEBUG_CSE
+    auto ABatch = BatchView( batchSize, A );
+    LUBatched( ABatch, P );
+}
+
+#define PROTO(Field) \
+  template void LUBatched \
+  ( vector<Matrix<Field>>& A, vector<Permutation>& P ); \
+  template void LUBatched \
+  ( Int batchSize, Matrix<Field>& A, vector<Permutation>& P );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
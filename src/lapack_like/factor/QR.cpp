@@ -11,6 +11,7 @@
 #include "./QR/ApplyQ.hpp"
 #include "./QR/BusingerGolub.hpp"
 #include "./QR/Cholesky.hpp"
+#include "./QR/CommunicationAvoiding.hpp"
 #include "./QR/Householder.hpp"
 #include "./QR/SolveAfter.hpp"
 #include "./QR/Explicit.hpp"
@@ -123,6 +124,10 @@ void QR
     AbstractDistMatrix<Base<F>>& signature, \
     DistPermutation& Omega, \
     const QRCtrl<Base<F>>& ctrl ); \
+  template void qr::CommunicationAvoiding \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    AbstractDistMatrix<Base<F>>& signature ); \
   template void qr::ExplicitTriang \
   ( Matrix<F>& A, const QRCtrl<Base<F>>& ctrl ); \
   template void qr::ExplicitTriang \
@@ -193,6 +198,18 @@ void QR
   ( Matrix<F>& A, \
     Matrix<F>& R ); \
   template void qr::Cholesky \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& R ); \
+  template void qr::CholeskyQR2 \
+  ( Matrix<F>& A, \
+    Matrix<F>& R ); \
+  template void qr::CholeskyQR2 \
+  ( AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& R ); \
+  template void qr::ShiftedCholeskyQR3 \
+  ( Matrix<F>& A, \
+    Matrix<F>& R ); \
+  template void qr::ShiftedCholeskyQR3 \
   ( AbstractDistMatrix<F>& A, \
     AbstractDistMatrix<F>& R ); \
   template qr::TreeData<F> qr::TS( const AbstractDistMatrix<F>& A ); \
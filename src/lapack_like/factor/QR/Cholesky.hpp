@@ -51,6 +51,189 @@ void Cholesky( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& RPre )
     Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), R.Matrix(), A.Matrix() );
 }
 
+namespace cholesky_qr {
+
+// The upper Cholesky factor of A^H A + shift I (with the shift chosen, as in
+// Fukaya et al.'s shifted CholeskyQR3, from the Frobenius norm of A if
+// 'shifted' is true). False is returned if the factorization breaks down.
+template<typename F>
+bool FactorGram( Matrix<F>& G, bool shifted, Int m )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = G.Height();
+    if( shifted )
+    {
+        Real frobNormSquared = 0;
+        for( Int j=0; j<n; ++j )
+            frobNormSquared += RealPart(G(j,j));
+        const Real eps = limits::Epsilon<Real>();
+        const Real shift =
+          Real(11)*(Real(m)*Real(n)+Real(n)*Real(n+1))*eps*frobNormSquared;
+        ShiftDiagonal( G, F(shift) );
+    }
+    try { El::Cholesky( UPPER, G ); }
+    catch( const NonHPDMatrixException& ) { return false; }
+    return true;
+}
+
+// A cheap lower bound on the condition number of an upper-triangular R
+template<typename F>
+Base<F> DiagonalConditionEstimate( const Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = R.Height();
+    Real maxAbs = 0, minAbs = limits::Max<Real>();
+    for( Int j=0; j<n; ++j )
+    {
+        const Real rho = Abs(R(j,j));
+        maxAbs = Max( maxAbs, rho );
+        minAbs = Min( minAbs, rho );
+    }
+    if( minAbs == Real(0) )
+        return limits::Infinity<Real>();
+    return maxAbs / minAbs;
+}
+
+// Whether the (unshifted) CholeskyQR pass yielding R may be followed by a
+// single additional pass; CholeskyQR2 requires cond(A) to be well below
+// eps^{-1/2}
+template<typename F>
+bool AcceptablyConditioned( const Matrix<F>& R )
+{
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    return DiagonalConditionEstimate( R ) <= Real(1)/(Real(8)*Sqrt(eps));
+}
+
+// Overwrite A with the Q of A = Q RNew, and R with RNew R
+template<typename F>
+void Fallback( Matrix<F>& A, Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    Matrix<F> RNew;
+    qr::Explicit( A, RNew );
+    Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), RNew, R );
+}
+
+template<typename F>
+void Fallback( DistMatrix<F,VC,STAR>& A, DistMatrix<F,STAR,STAR>& R )
+{
+    EL_DEBUG_CSE
+    DistMatrix<F,STAR,STAR> RNew( A.Grid() );
+    const Int p = A.ColStride();
+    if( PowerOfTwo(p) && A.Height() >= p*A.Width() )
+        qr::ExplicitTS( A, RNew );
+    else
+        qr::Explicit( A, RNew );
+    Trmm
+    ( LEFT, UPPER, NORMAL, NON_UNIT, F(1), RNew.LockedMatrix(), R.Matrix() );
+}
+
+template<typename F>
+void Passes( Matrix<F>& A, Matrix<F>& R, bool shifted )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numPasses = ( shifted ? 3 : 2 );
+    Identity( R, n, n );
+    Matrix<F> RPass;
+    for( Int pass=0; pass<numPasses; ++pass )
+    {
+        const bool shiftedPass = ( shifted && pass == 0 );
+        Zeros( RPass, n, n );
+        Herk( UPPER, ADJOINT, Base<F>(1), A, Base<F>(0), RPass );
+        if( !FactorGram( RPass, shiftedPass, m ) ||
+            (pass == numPasses-2 && !AcceptablyConditioned( RPass )) )
+        {
+            Fallback( A, R );
+            return;
+        }
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), RPass, A );
+        Trmm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), RPass, R );
+    }
+}
+
+template<typename F>
+void Passes
+( DistMatrix<F,VC,STAR>& A, DistMatrix<F,STAR,STAR>& R, bool shifted )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numPasses = ( shifted ? 3 : 2 );
+    Identity( R, n, n );
+    DistMatrix<F,STAR,STAR> RPass( A.Grid() );
+    for( Int pass=0; pass<numPasses; ++pass )
+    {
+        // Every process redundantly factors the same Gram matrix, so that
+        // the decision to fall back is made consistently
+        const bool shiftedPass = ( shifted && pass == 0 );
+        Zeros( RPass, n, n );
+        Herk
+        ( UPPER, ADJOINT,
+          Base<F>(1), A.LockedMatrix(), Base<F>(0), RPass.Matrix() );
+        El::AllReduce( RPass, A.ColComm() );
+        if( !FactorGram( RPass.Matrix(), shiftedPass, m ) ||
+            (pass == numPasses-2 && !AcceptablyConditioned( RPass.Matrix() )) )
+        {
+            Fallback( A, R );
+            return;
+        }
+        Trsm
+        ( RIGHT, UPPER, NORMAL, NON_UNIT,
+          F(1), RPass.LockedMatrix(), A.Matrix() );
+        Trmm
+        ( LEFT, UPPER, NORMAL, NON_UNIT,
+          F(1), RPass.LockedMatrix(), R.Matrix() );
+    }
+}
+
+} // namespace cholesky_qr
+
+template<typename F>
+void CholeskyQR2( Matrix<F>& A, Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    if( A.Height() < A.Width() )
+        LogicError("A^H A will be singular");
+    cholesky_qr::Passes( A, R, false );
+}
+
+template<typename F>
+void CholeskyQR2( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& RPre )
+{
+    EL_DEBUG_CSE
+    if( APre.Height() < APre.Width() )
+        LogicError("A^H A will be singular");
+    DistMatrixReadWriteProxy<F,F,VC,STAR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR> RProx( RPre );
+    cholesky_qr::Passes( AProx.Get(), RProx.Get(), false );
+}
+
+template<typename F>
+void ShiftedCholeskyQR3( Matrix<F>& A, Matrix<F>& R )
+{
+    EL_DEBUG_CSE
+    if( A.Height() < A.Width() )
+        LogicError("A^H A will be singular");
+    cholesky_qr::Passes( A, R, true );
+}
+
+template<typename F>
+void ShiftedCholeskyQR3
+( AbstractDistMatrix<F>& APre, AbstractDistMatrix<F>& RPre )
+{
+    EL_DEBUG_CSE
+    if( APre.Height() < APre.Width() )
+        LogicError("A^H A will be singular");
+    DistMatrixReadWriteProxy<F,F,VC,STAR> AProx( APre );
+    DistMatrixWriteProxy<F,F,STAR,STAR> RProx( RPre );
+    cholesky_qr::Passes( AProx.Get(), RProx.Get(), true );
+}
+
 } // namespace qr
 } // namespace El
 
@@ -0,0 +1,147 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_COMMUNICATIONAVOIDING_HPP
+#define EL_QR_COMMUNICATIONAVOIDING_HPP
+
+#include "./ApplyQ.hpp"
+#include "./PanelHouseholder.hpp"
+#include "./TS.hpp"
+
+namespace El {
+namespace qr {
+namespace ca {
+
+// Factor a panel with TSQR and then reconstruct the Householder
+// representation produced by PanelHouseholder from the explicit TSQR factor,
+// following Ballard et al., "Reconstructing Householder vectors from
+// tall-skinny QR".
+//
+// If A = Q R with Q explicit, then an unpivoted LU factorization of
+// Q - [S; 0] = Y U, where S is a diagonal matrix of signs chosen so that each
+// pivot has magnitude at least one, yields the Householder vectors Y. The
+// associated product of reflectors, I - Y T Y^H with T = -U S Y1^{-H}, agrees
+// with Q S on its leading columns, so that A = (I - Y T Y^H) S [R; 0].
+template<typename F>
+void Panel
+( DistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  AbstractDistMatrix<Base<F>>& signature )
+{
+    EL_DEBUG_CSE
+    EL_REGION("qr::ca::Panel");
+    typedef Base<F> Real;
+    const Int n = A.Width();
+    EL_DEBUG_ONLY(
+      if( A.Height() < n )
+          LogicError("Must be a column panel");
+    )
+
+    DistMatrix<F,VC,STAR> A_VC_STAR( A );
+    auto treeData = TS( A_VC_STAR );
+    auto R = ts::FormR( A_VC_STAR, treeData );
+    ts::FormQ( A_VC_STAR, treeData );
+
+    // Redundantly compute the modified LU factorization of the top of Q
+    DistMatrix<F,STAR,STAR> U( A_VC_STAR( IR(0,n), ALL ) );
+    F* UBuf = U.Buffer();
+    const Int ULDim = U.LDim();
+    vector<Real> signs( n );
+    for( Int k=0; k<n; ++k )
+    {
+        const Real sigma =
+          ( RealPart(UBuf[k+k*ULDim]) >= Real(0) ? Real(-1) : Real(1) );
+        signs[k] = sigma;
+        UBuf[k+k*ULDim] -= sigma;
+
+        const F upsilon = UBuf[k+k*ULDim];
+        blas::Scal( n-(k+1), F(1)/upsilon, &UBuf[(k+1)+k*ULDim], 1 );
+        blas::Geru
+        ( n-(k+1), n-(k+1),
+          F(-1), &UBuf[(k+1)+k*ULDim], 1, &UBuf[k+(k+1)*ULDim], ULDim,
+                 &UBuf[(k+1)+(k+1)*ULDim], ULDim );
+    }
+
+    // Y := (Q - [S; 0]) inv(U), then overwrite its top with R
+    for( Int k=0; k<n; ++k )
+        A_VC_STAR.Update( k, k, -signs[k] );
+    LocalTrsm
+    ( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), U, A_VC_STAR );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<=j; ++i )
+            A_VC_STAR.Set( i, j, R.GetLocal(i,j) );
+    A = A_VC_STAR;
+
+    // The reflectors are applied with conjugated scalars (see ApplyQ), so
+    // the scalars are the conjugates of the diagonal of T
+    for( Int k=0; k<n; ++k )
+    {
+        householderScalars.Set( k, 0, -Conj(UBuf[k+k*ULDim])*signs[k] );
+        signature.Set( k, 0, signs[k] );
+    }
+}
+
+} // namespace ca
+
+// The same factorization as Householder, but each panel is factored with
+// TSQR over all of the processes, so that it requires O(log p) messages
+// rather than O(nb log p), after which the trailing update is performed with
+// the compact-WY form of the reconstructed reflectors
+template<typename F>
+void CommunicationAvoiding
+( AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  AbstractDistMatrix<Base<F>>& signaturePre )
+{
+    EL_DEBUG_CSE
+    EL_REGION("qr::CommunicationAvoiding");
+    EL_DEBUG_ONLY(AssertSameGrids( APre, householderScalarsPre, signaturePre ))
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    const Int minDim = Min(m,n);
+    const Int p = APre.Grid().Size();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MD,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixWriteProxy<Base<F>,Base<F>,MD,STAR> signatureProx( signaturePre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+    auto& signature = signatureProx.Get();
+
+    householderScalars.Resize( minDim, 1 );
+    signature.Resize( minDim, 1 );
+
+    const Int bsize = Blocksize();
+    for( Int k=0; k<minDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,minDim-k);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         indB( k,    END  ),
+                         ind2( k+nb, END  );
+
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+        auto householderScalars1 = householderScalars( ind1, ALL );
+        auto sig1 = signature( ind1, ALL );
+
+        // TSQR requires a power-of-two number of processes, each owning at
+        // least nb rows of the panel
+        if( PowerOfTwo(p) && AB1.Height() >= p*nb )
+            ca::Panel( AB1, householderScalars1, sig1 );
+        else
+            PanelHouseholder( AB1, householderScalars1, sig1 );
+        ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, AB2 );
+    }
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_COMMUNICATIONAVOIDING_HPP
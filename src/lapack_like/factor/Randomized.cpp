@@ -0,0 +1,633 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// See Halko, Martinsson, and Tropp's "Finding structure with randomness:
+// Probabilistic algorithms for constructing approximate matrix
+// decompositions" and Clarkson and Woodruff's "Low rank approximation and
+// regression in input sparsity time" for the sparse sign (CountSketch)
+// embedding.
+
+namespace El {
+namespace randomized {
+
+// Draw the column and sign of the nonzero in each of the 'height' rows of a
+// sparse sign sketch with 'width' columns. The root process draws them so that
+// they are consistent over the communicator.
+inline void SparseSignHashes
+( Int height,
+  Int width,
+  vector<Int>& buckets,
+  vector<Int>& signs,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    buckets.resize( height );
+    signs.resize( height );
+    if( mpi::Rank(comm) == 0 )
+    {
+        for( Int i=0; i<height; ++i )
+        {
+            buckets[i] = SampleUniform<Int>( 0, width );
+            signs[i] = ( SampleUniform<Int>(0,2) == 0 ? -1 : 1 );
+        }
+    }
+    mpi::Broadcast( buckets.data(), height, 0, comm );
+    mpi::Broadcast( signs.data(), height, 0, comm );
+}
+
+inline Orientation AdjointOrientation( Orientation orientation )
+{
+    if( orientation == TRANSPOSE )
+        LogicError("Only NORMAL and ADJOINT orientations are supported");
+    return ( orientation == NORMAL ? ADJOINT : NORMAL );
+}
+
+inline Int SampleWidth
+( Int m, Int n, Int rank, const RandomizedRangeCtrl& ctrl )
+{
+    if( rank <= 0 )
+        LogicError("The rank must be positive");
+    return Min( rank+ctrl.oversampling, Min(m,n) );
+}
+
+// Y := op(A) Omega
+// ----------------
+template<typename Field>
+void Sketch
+( Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& Y,
+        Int width,
+        SketchType sketch )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const bool normal = ( orientation == NORMAL );
+    if( sketch == GAUSSIAN_SKETCH )
+    {
+        Matrix<Field> Omega;
+        Gaussian( Omega, normal ? n : m, width );
+        Gemm( orientation, NORMAL, Field(1), A, Omega, Y );
+        return;
+    }
+
+    vector<Int> buckets, signs;
+    SparseSignHashes( normal ? n : m, width, buckets, signs, mpi::COMM_SELF );
+    Zeros( Y, normal ? m : n, width );
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            if( normal )
+                Y(i,buckets[j]) += Field(signs[j])*A(i,j);
+            else
+                Y(j,buckets[i]) += Field(signs[i])*Conj(A(i,j));
+        }
+    }
+}
+
+template<typename Field>
+void Sketch
+( Orientation orientation,
+  const DistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& Y,
+        Int width,
+        SketchType sketch )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const bool normal = ( orientation == NORMAL );
+    if( sketch == GAUSSIAN_SKETCH )
+    {
+        DistMatrix<Field> Omega(g);
+        Gaussian( Omega, normal ? n : m, width );
+        Gemm( orientation, NORMAL, Field(1), A, Omega, Y );
+        return;
+    }
+
+    // Each process sums the contributions of its local columns (rows) of A
+    // before the partial sums are combined over each row (column) team
+    vector<Int> buckets, signs;
+    SparseSignHashes( normal ? n : m, width, buckets, signs, g.Comm() );
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const auto& ALoc = A.LockedMatrix();
+    if( normal )
+    {
+        DistMatrix<Field,MC,STAR> Y_MC_STAR(g);
+        Y_MC_STAR.AlignWith( A );
+        Zeros( Y_MC_STAR, m, width );
+        auto& YLoc = Y_MC_STAR.Matrix();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            const Field sign = Field(signs[j]);
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                YLoc(iLoc,buckets[j]) += sign*ALoc(iLoc,jLoc);
+        }
+        AllReduce( YLoc, g.RowComm() );
+        Copy( Y_MC_STAR, Y );
+    }
+    else
+    {
+        DistMatrix<Field,MR,STAR> Y_MR_STAR(g);
+        Y_MR_STAR.AlignWith( A );
+        Zeros( Y_MR_STAR, n, width );
+        auto& YLoc = Y_MR_STAR.Matrix();
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const Int i = A.GlobalRow(iLoc);
+                YLoc(jLoc,buckets[i]) += Field(signs[i])*Conj(ALoc(iLoc,jLoc));
+            }
+        }
+        AllReduce( YLoc, g.ColComm() );
+        Copy( Y_MR_STAR, Y );
+    }
+}
+
+template<typename Field>
+void Sketch
+( Orientation orientation,
+  const SparseMatrix<Field>& A,
+        Matrix<Field>& Y,
+        Int width,
+        SketchType sketch )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const bool normal = ( orientation == NORMAL );
+    if( sketch == GAUSSIAN_SKETCH )
+    {
+        Matrix<Field> Omega;
+        Gaussian( Omega, normal ? n : m, width );
+        Zeros( Y, normal ? m : n, width );
+        Multiply( orientation, Field(1), A, Omega, Field(0), Y );
+        return;
+    }
+
+    vector<Int> buckets, signs;
+    SparseSignHashes( normal ? n : m, width, buckets, signs, mpi::COMM_SELF );
+    Zeros( Y, normal ? m : n, width );
+    const Int numEntries = A.NumEntries();
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int i = A.Row(e);
+        const Int j = A.Col(e);
+        if( normal )
+            Y(i,buckets[j]) += Field(signs[j])*A.Value(e);
+        else
+            Y(j,buckets[i]) += Field(signs[i])*Conj(A.Value(e));
+    }
+}
+
+template<typename Field>
+void Sketch
+( Orientation orientation,
+  const DistSparseMatrix<Field>& A,
+        DistMultiVec<Field>& Y,
+        Int width,
+        SketchType sketch )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const bool normal = ( orientation == NORMAL );
+    Y.SetGrid( g );
+    if( sketch == GAUSSIAN_SKETCH )
+    {
+        DistMultiVec<Field> Omega(g);
+        Gaussian( Omega, normal ? n : m, width );
+        Zeros( Y, normal ? m : n, width );
+        Multiply( orientation, Field(1), A, Omega, Field(0), Y );
+        return;
+    }
+
+    vector<Int> buckets, signs;
+    SparseSignHashes( normal ? n : m, width, buckets, signs, g.Comm() );
+    if( normal )
+    {
+        // The rows of Y are distributed in the same manner as those of A
+        Zeros( Y, m, width );
+        auto& YLoc = Y.Matrix();
+        const Int firstLocalRow = A.FirstLocalRow();
+        const Int numLocalEntries = A.NumLocalEntries();
+        for( Int e=0; e<numLocalEntries; ++e )
+        {
+            const Int iLoc = A.Row(e) - firstLocalRow;
+            const Int j = A.Col(e);
+            YLoc(iLoc,buckets[j]) += Field(signs[j])*A.Value(e);
+        }
+    }
+    else
+    {
+        // Form the sketch explicitly so that Multiply can handle the
+        // communication required by A^H
+        DistMultiVec<Field> Omega(g);
+        Zeros( Omega, m, width );
+        auto& OmegaLoc = Omega.Matrix();
+        for( Int iLoc=0; iLoc<Omega.LocalHeight(); ++iLoc )
+        {
+            const Int i = Omega.GlobalRow(iLoc);
+            OmegaLoc(iLoc,buckets[i]) = Field(signs[i]);
+        }
+        Zeros( Y, n, width );
+        Multiply( ADJOINT, Field(1), A, Omega, Field(0), Y );
+    }
+}
+
+// Y := op(A) X
+// ------------
+template<typename Field>
+void Apply
+( Orientation orientation,
+  const Matrix<Field>& A,
+  const Matrix<Field>& X,
+        Matrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    Gemm( orientation, NORMAL, Field(1), A, X, Y );
+}
+
+template<typename Field>
+void Apply
+( Orientation orientation,
+  const DistMatrix<Field>& A,
+  const AbstractDistMatrix<Field>& X,
+        AbstractDistMatrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    Gemm( orientation, NORMAL, Field(1), A, X, Y );
+}
+
+template<typename Field>
+void Apply
+( Orientation orientation,
+  const SparseMatrix<Field>& A,
+  const Matrix<Field>& X,
+        Matrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    const Int height = ( orientation == NORMAL ? A.Height() : A.Width() );
+    Zeros( Y, height, X.Width() );
+    Multiply( orientation, Field(1), A, X, Field(0), Y );
+}
+
+template<typename Field>
+void Apply
+( Orientation orientation,
+  const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Field>& X,
+        DistMultiVec<Field>& Y )
+{
+    EL_DEBUG_CSE
+    const Int height = ( orientation == NORMAL ? A.Height() : A.Width() );
+    Y.SetGrid( A.Grid() );
+    Zeros( Y, height, X.Width() );
+    Multiply( orientation, Field(1), A, X, Field(0), Y );
+}
+
+// Y := orth(Y)
+// ------------
+template<typename Field>
+void Orthonormalize( Matrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> R;
+    qr::CholeskyQR2( Y, R );
+}
+
+template<typename Field>
+void Orthonormalize( AbstractDistMatrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    DistMatrix<Field,STAR,STAR> R(Y.Grid());
+    qr::CholeskyQR2( Y, R );
+}
+
+template<typename Field>
+void Orthonormalize( DistMultiVec<Field>& Y )
+{
+    EL_DEBUG_CSE
+    const Grid& g = Y.Grid();
+    DistMatrix<Field,VC,STAR> Y_VC_STAR(g);
+    DistMatrix<Field,STAR,STAR> R(g);
+    Copy( Y, Y_VC_STAR );
+    qr::CholeskyQR2( Y_VC_STAR, R );
+    Copy( Y_VC_STAR, Y );
+}
+
+template<class MatrixType,class BasisType>
+void RangeFinder
+( Orientation orientation,
+  const MatrixType& A,
+        BasisType& Q,
+        BasisType& Z,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Orientation adjOrientation = AdjointOrientation( orientation );
+    const Int width = SampleWidth( A.Height(), A.Width(), rank, ctrl );
+    Sketch( orientation, A, Q, width, ctrl.sketch );
+    Orthonormalize( Q );
+    for( Int it=0; it<ctrl.numPowerIts; ++it )
+    {
+        Apply( adjOrientation, A, Q, Z );
+        Orthonormalize( Z );
+        Apply( orientation, A, Z, Q );
+        Orthonormalize( Q );
+    }
+}
+
+} // namespace randomized
+
+template<typename Field>
+void RandomizedRange
+( Orientation orientation,
+  const Matrix<Field>& A,
+        Matrix<Field>& Q,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> Z;
+    randomized::RangeFinder( orientation, A, Q, Z, rank, ctrl );
+}
+
+template<typename Field>
+void RandomizedRange
+( Orientation orientation,
+  const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& QPre,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<Field,Field,VC,STAR> QProx( QPre );
+    auto& A = AProx.GetLocked();
+    auto& Q = QProx.Get();
+    DistMatrix<Field,VC,STAR> Z(A.Grid());
+    randomized::RangeFinder( orientation, A, Q, Z, rank, ctrl );
+}
+
+template<typename Field>
+void RandomizedRange
+( Orientation orientation,
+  const SparseMatrix<Field>& A,
+        Matrix<Field>& Q,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> Z;
+    randomized::RangeFinder( orientation, A, Q, Z, rank, ctrl );
+}
+
+template<typename Field>
+void RandomizedRange
+( Orientation orientation,
+  const DistSparseMatrix<Field>& A,
+        DistMultiVec<Field>& Q,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMultiVec<Field> Z(A.Grid());
+    randomized::RangeFinder( orientation, A, Q, Z, rank, ctrl );
+}
+
+namespace randomized {
+
+template<typename Real>
+QRCtrl<Real> BoundedRankCtrl( Int rank )
+{
+    QRCtrl<Real> qrCtrl;
+    qrCtrl.boundRank = true;
+    qrCtrl.maxRank = rank;
+    return qrCtrl;
+}
+
+// Return the original indices of the first 'rank' columns of A Omega^T
+inline vector<Int> LeadingPreimages( const Permutation& Omega, Int rank )
+{
+    vector<Int> indices( rank );
+    for( Int j=0; j<rank; ++j )
+        indices[j] = Omega.Preimage(j);
+    return indices;
+}
+
+inline vector<Int> LeadingPreimages( const DistPermutation& Omega, Int rank )
+{
+    vector<Int> indices( rank );
+    for( Int j=0; j<rank; ++j )
+        indices[j] = Omega.Preimage(j);
+    return indices;
+}
+
+} // namespace randomized
+
+template<typename Field>
+void RandomizedID
+( const Matrix<Field>& A,
+        Permutation& Omega,
+        Matrix<Field>& Z,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> Q, S;
+    RandomizedRange( NORMAL, A, Q, rank, ctrl );
+    Gemm( ADJOINT, NORMAL, Field(1), Q, A, S );
+    const bool canOverwrite = true;
+    ID
+    ( S, Omega, Z, randomized::BoundedRankCtrl<Base<Field>>(rank),
+      canOverwrite );
+}
+
+template<typename Field>
+void RandomizedID
+( const AbstractDistMatrix<Field>& A,
+        DistPermutation& Omega,
+        AbstractDistMatrix<Field>& Z,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    DistMatrix<Field,VC,STAR> Q(g);
+    DistMatrix<Field> S(g);
+    RandomizedRange( NORMAL, A, Q, rank, ctrl );
+    Gemm( ADJOINT, NORMAL, Field(1), Q, A, S );
+    const bool canOverwrite = true;
+    ID
+    ( S, Omega, Z, randomized::BoundedRankCtrl<Base<Field>>(rank),
+      canOverwrite );
+}
+
+template<typename Field>
+void RandomizedSkeleton
+( const Matrix<Field>& A,
+        Permutation& PR,
+        Permutation& PC,
+        Matrix<Field>& Z,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    // Select the columns from an ID of Q^H A
+    Matrix<Field> Q, S, ZID;
+    RandomizedRange( NORMAL, A, Q, rank, ctrl );
+    Gemm( ADJOINT, NORMAL, Field(1), Q, A, S );
+    ID( S, PC, ZID, randomized::BoundedRankCtrl<Base<Field>>(rank), true );
+    const Int numSteps = ZID.Height();
+
+    // Select the same number of rows from an ID of Q^H A^H
+    RandomizedRange( ADJOINT, A, Q, numSteps, ctrl );
+    Gemm( ADJOINT, ADJOINT, Field(1), Q, A, S );
+    ID( S, PR, ZID, randomized::BoundedRankCtrl<Base<Field>>(numSteps), true );
+    const Int numRows = ZID.Height();
+
+    // Form K := A pinv(AR) = A QR inv(RR)^H, where AR^H = QR RR
+    Matrix<Field> AC, AR, ARAdj, RR, RC, K;
+    GetSubmatrix
+    ( A, randomized::LeadingPreimages(PR,numRows), IR(0,n), AR );
+    Adjoint( AR, ARAdj );
+    qr::CholeskyQR2( ARAdj, RR );
+    Gemm( NORMAL, NORMAL, Field(1), A, ARAdj, K );
+    Trsm( RIGHT, UPPER, ADJOINT, NON_UNIT, Field(1), RR, K );
+
+    // Form Z := pinv(AC) K = inv(RC) QC^H K, where AC = QC RC
+    GetSubmatrix
+    ( A, IR(0,m), randomized::LeadingPreimages(PC,numSteps), AC );
+    qr::CholeskyQR2( AC, RC );
+    Gemm( ADJOINT, NORMAL, Field(1), AC, K, Z );
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), RC, Z );
+}
+
+template<typename Field>
+void RandomizedSkeleton
+( const AbstractDistMatrix<Field>& APre,
+        DistPermutation& PR,
+        DistPermutation& PC,
+        AbstractDistMatrix<Field>& Z,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+
+    // Select the columns from an ID of Q^H A
+    DistMatrix<Field,VC,STAR> Q(g);
+    DistMatrix<Field> S(g), ZID(g);
+    RandomizedRange( NORMAL, A, Q, rank, ctrl );
+    Gemm( ADJOINT, NORMAL, Field(1), Q, A, S );
+    ID( S, PC, ZID, randomized::BoundedRankCtrl<Base<Field>>(rank), true );
+    const Int numSteps = ZID.Height();
+
+    // Select the same number of rows from an ID of Q^H A^H
+    RandomizedRange( ADJOINT, A, Q, numSteps, ctrl );
+    Gemm( ADJOINT, ADJOINT, Field(1), Q, A, S );
+    ID( S, PR, ZID, randomized::BoundedRankCtrl<Base<Field>>(numSteps), true );
+    const Int numRows = ZID.Height();
+
+    // Form K := A pinv(AR) = A QR inv(RR)^H, where AR^H = QR RR
+    DistMatrix<Field> AR(g), K(g);
+    DistMatrix<Field,VC,STAR> ARAdj(g), AC(g);
+    DistMatrix<Field,STAR,STAR> RR(g), RC(g);
+    GetSubmatrix
+    ( A, randomized::LeadingPreimages(PR,numRows), IR(0,n), AR );
+    Adjoint( AR, ARAdj );
+    qr::CholeskyQR2( ARAdj, RR );
+    Gemm( NORMAL, NORMAL, Field(1), A, ARAdj, K );
+    Trsm( RIGHT, UPPER, ADJOINT, NON_UNIT, Field(1), RR, K );
+
+    // Form Z := pinv(AC) K = inv(RC) QC^H K, where AC = QC RC
+    GetSubmatrix
+    ( A, IR(0,m), randomized::LeadingPreimages(PC,numSteps), AC );
+    qr::CholeskyQR2( AC, RC );
+    Gemm( ADJOINT, NORMAL, Field(1), AC, K, Z );
+    Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), RC, Z );
+}
+
+#define PROTO(Field) \
+  template void RandomizedRange \
+  ( Orientation orientation, \
+    const Matrix<Field>& A, \
+          Matrix<Field>& Q, \
+          Int rank, \
+    const RandomizedRangeCtrl& ctrl ); \
+  template void RandomizedRange \
+  ( Orientation orientation, \
+    const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& Q, \
+          Int rank, \
+    const RandomizedRangeCtrl& ctrl ); \
+  template void RandomizedRange \
+  ( Orientation orientation, \
+    const SparseMatrix<Field>& A, \
+          Matrix<Field>& Q, \
+          Int rank, \
+    const RandomizedRangeCtrl& ctrl ); \
+  template void RandomizedRange \
+  ( Orientation orientation, \
+    const DistSparseMatrix<Field>& A, \
+          DistMultiVec<Field>& Q, \
+          Int rank, \
+    const RandomizedRangeCtrl& ctrl ); \
+  template void RandomizedID \
+  ( const Matrix<Field>& A, \
+          Permutation& Omega, \
+          Matrix<Field>& Z, \
+          Int rank, \
+    const RandomizedRangeCtrl& ctrl ); \
+  template void RandomizedID \
+  ( const AbstractDistMatrix<Field>& A, \
+          DistPermutation& Omega, \
+          AbstractDistMatrix<Field>& Z, \
+          Int rank, \
+    const RandomizedRangeCtrl& ctrl ); \
+  template void RandomizedSkeleton \
+  ( const Matrix<Field>& A, \
+          Permutation& PR, \
+          Permutation& PC, \
+          Matrix<Field>& Z, \
+          Int rank, \
+    const RandomizedRangeCtrl& ctrl ); \
+  template void RandomizedSkeleton \
+  ( const AbstractDistMatrix<Field>& A, \
+          DistPermutation& PR, \
+          DistPermutation& PC, \
+          AbstractDistMatrix<Field>& Z, \
+          Int rank, \
+    const RandomizedRangeCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
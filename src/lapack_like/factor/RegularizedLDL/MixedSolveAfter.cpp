@@ -0,0 +1,248 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace reg_ldl {
+
+namespace {
+
+// Solve against the factorization in its own precision after normalizing
+// the right-hand side so that small residuals do not underflow
+template<typename FieldLow,typename Field>
+void LowerPrecisionSolve
+( const SparseLDLFactorization<FieldLow>& sparseLDLFact,
+        Matrix<Field>& Y,
+        Matrix<FieldLow>& YLow )
+{
+    EL_DEBUG_CSE
+    const Base<Field> YNorm = MaxNorm( Y );
+    if( YNorm == Base<Field>(0) )
+        return;
+    Y *= Field(1)/YNorm;
+    Copy( Y, YLow );
+    sparseLDLFact.Solve( YLow );
+    Copy( YLow, Y );
+    Y *= Field(YNorm);
+}
+
+template<typename FieldLow,typename Field>
+void LowerPrecisionSolve
+( const DistSparseLDLFactorization<FieldLow>& sparseLDLFact,
+        DistMultiVec<Field>& Y,
+        DistMultiVec<FieldLow>& YLow )
+{
+    EL_DEBUG_CSE
+    const Base<Field> YNorm = MaxNorm( Y );
+    if( YNorm == Base<Field>(0) )
+        return;
+    Y *= Field(1)/YNorm;
+    Copy( Y, YLow );
+    sparseLDLFact.Solve( YLow );
+    Copy( YLow, Y );
+    Y *= Field(YNorm);
+}
+
+} // anonymous namespace
+
+template<typename FieldLow,typename Field>
+Int RegularizedSolveAfter
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const Matrix<Base<Field>>& d,
+  const SparseLDLFactorization<FieldLow>& sparseLDLFact,
+        Matrix<Field>& B,
+        Base<Field> relTol,
+        Int maxRefineIts,
+        bool progress,
+        bool time )
+{
+    EL_DEBUG_CSE
+    Matrix<FieldLow> YLow;
+    auto applyA =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        Multiply( NORMAL, Field(1), A, X, Field(1), Y );
+      };
+    auto applyAInv =
+      [&]( Matrix<Field>& Y )
+      {
+        DiagonalSolve( LEFT, NORMAL, d, Y );
+        LowerPrecisionSolve( sparseLDLFact, Y, YLow );
+        DiagonalSolve( LEFT, NORMAL, d, Y );
+      };
+    return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
+}
+
+template<typename FieldLow,typename Field>
+Int RegularizedSolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistMultiVec<Base<Field>>& d,
+  const DistSparseLDLFactorization<FieldLow>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+        Base<Field> relTol,
+        Int maxRefineIts,
+        bool progress,
+        bool time )
+{
+    EL_DEBUG_CSE
+    DistMultiVec<FieldLow> YLow(B.Grid());
+    auto applyA =
+      [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        Multiply( NORMAL, Field(1), A, X, Field(1), Y );
+      };
+    auto applyAInv =
+      [&]( DistMultiVec<Field>& Y )
+      {
+        DiagonalSolve( LEFT, NORMAL, d, Y );
+        LowerPrecisionSolve( sparseLDLFact, Y, YLow );
+        DiagonalSolve( LEFT, NORMAL, d, Y );
+      };
+    return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
+}
+
+template<typename FieldLow,typename Field>
+Int SolveAfter
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const Matrix<Base<Field>>& d,
+  const SparseLDLFactorization<FieldLow>& sparseLDLFact,
+        Matrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( Matrix<Field>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, d, sparseLDLFact, W,
+          ctrl.relTolRefine, ctrl.maxRefineIts, ctrl.progress );
+      };
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRES
+        ( applyA, precond, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+    case REG_SOLVE_LGMRES:
+        return LGMRES
+        ( applyA, precond, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+    case REG_SOLVE_PIPELINED_CG:
+        return PipelinedCG
+        ( applyA, precond, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+    case REG_SOLVE_PIPELINED_GMRES:
+        return PipelinedGMRES
+        ( applyA, precond, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+template<typename FieldLow,typename Field>
+Int SolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistMultiVec<Base<Field>>& d,
+  const DistSparseLDLFactorization<FieldLow>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const DistMultiVec<Field>& X,
+           Field beta, DistMultiVec<Field>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( DistMultiVec<Field>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, d, sparseLDLFact, W,
+          ctrl.relTolRefine, ctrl.maxRefineIts, ctrl.progress );
+      };
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRES
+        ( applyA, precond, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+    case REG_SOLVE_LGMRES:
+        return LGMRES
+        ( applyA, precond, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+    case REG_SOLVE_PIPELINED_CG:
+        return PipelinedCG
+        ( applyA, precond, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+    case REG_SOLVE_PIPELINED_GMRES:
+        return PipelinedGMRES
+        ( applyA, precond, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+#define MIXED_PROTO(FieldLow,Field) \
+  template Int RegularizedSolveAfter \
+  ( const SparseMatrix<Field>& A, \
+    const Matrix<Base<Field>>& reg, \
+    const Matrix<Base<Field>>& d, \
+    const SparseLDLFactorization<FieldLow>& sparseLDLFact, \
+          Matrix<Field>& B, \
+    Base<Field> relTol, Int maxRefineIts, bool progress, bool time ); \
+  template Int RegularizedSolveAfter \
+  ( const DistSparseMatrix<Field>& A, \
+    const DistMultiVec<Base<Field>>& reg, \
+    const DistMultiVec<Base<Field>>& d, \
+    const DistSparseLDLFactorization<FieldLow>& sparseLDLFact, \
+          DistMultiVec<Field>& B, \
+    Base<Field> relTol, Int maxRefineIts, bool progress, bool time ); \
+  template Int SolveAfter \
+  ( const SparseMatrix<Field>& A, \
+    const Matrix<Base<Field>>& reg, \
+    const Matrix<Base<Field>>& d, \
+    const SparseLDLFactorization<FieldLow>& sparseLDLFact, \
+          Matrix<Field>& B, \
+    const RegSolveCtrl<Base<Field>>& ctrl ); \
+  template Int SolveAfter \
+  ( const DistSparseMatrix<Field>& A, \
+    const DistMultiVec<Base<Field>>& reg, \
+    const DistMultiVec<Base<Field>>& d, \
+    const DistSparseLDLFactorization<FieldLow>& sparseLDLFact, \
+          DistMultiVec<Field>& B, \
+    const RegSolveCtrl<Base<Field>>& ctrl );
+
+MIXED_PROTO(float,double)
+MIXED_PROTO(Complex<float>,Complex<double>)
+#ifdef EL_HAVE_QD
+MIXED_PROTO(double,DoubleDouble)
+MIXED_PROTO(DoubleDouble,QuadDouble)
+#endif
+#ifdef EL_HAVE_QUAD
+MIXED_PROTO(double,Quad)
+#endif
+
+} // namespace reg_ldl
+} // namespace El
@@ -689,6 +689,125 @@ Int FGMRESSolveAfter
     return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
 }
 
+// The pipelined solvers require a fixed preconditioner, which is
+// approximated by refining each application to the tolerance relTolRefine
+template<typename Field,class ApplyAType,class PrecondType,class VectorType>
+Int PipelinedSolve
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+        VectorType& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.alg == REG_SOLVE_PIPELINED_CG )
+        return PipelinedCG
+        ( applyA, precond, B, ctrl.relTol, ctrl.maxIts, ctrl.progress );
+    else
+        return PipelinedGMRES
+        ( applyA, precond, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+}
+
+template<typename Field>
+Int PipelinedSolveAfter
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const SparseLDLFactorization<Field>& sparseLDLFact,
+        Matrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( Matrix<Field>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, sparseLDLFact, W,
+          ctrl.relTolRefine, ctrl.maxRefineIts, ctrl.progress );
+      };
+    return PipelinedSolve<Field>( applyA, precond, B, ctrl );
+}
+
+template<typename Field>
+Int PipelinedSolveAfter
+( const SparseMatrix<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const Matrix<Base<Field>>& d,
+  const SparseLDLFactorization<Field>& sparseLDLFact,
+        Matrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const Matrix<Field>& X, Field beta, Matrix<Field>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( Matrix<Field>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, d, sparseLDLFact, W,
+          ctrl.relTolRefine, ctrl.maxRefineIts, ctrl.progress );
+      };
+    return PipelinedSolve<Field>( applyA, precond, B, ctrl );
+}
+
+template<typename Field>
+Int PipelinedSolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistSparseLDLFactorization<Field>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const DistMultiVec<Field>& X,
+           Field beta, DistMultiVec<Field>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( DistMultiVec<Field>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, sparseLDLFact, W,
+          ctrl.relTolRefine, ctrl.maxRefineIts, ctrl.progress );
+      };
+    return PipelinedSolve<Field>( applyA, precond, B, ctrl );
+}
+
+template<typename Field>
+Int PipelinedSolveAfter
+( const DistSparseMatrix<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistMultiVec<Base<Field>>& d,
+  const DistSparseLDLFactorization<Field>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyA =
+      [&]( Field alpha, const DistMultiVec<Field>& X,
+           Field beta, DistMultiVec<Field>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( DistMultiVec<Field>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, d, sparseLDLFact, W,
+          ctrl.relTolRefine, ctrl.maxRefineIts, ctrl.progress );
+      };
+    return PipelinedSolve<Field>( applyA, precond, B, ctrl );
+}
+
 // TODO(poulson): Add RGMRES
 
 template<typename Field>
@@ -721,6 +840,9 @@ Int SolveAfter
           ctrl.relTolRefine,
           ctrl.maxRefineIts, 
           ctrl.progress );
+    case REG_SOLVE_PIPELINED_CG:
+    case REG_SOLVE_PIPELINED_GMRES:
+        return PipelinedSolveAfter( A, reg, sparseLDLFact, B, ctrl );
     default:
         LogicError("Invalid refinement algorithm");
         return -1;
@@ -758,6 +880,9 @@ Int SolveAfter
           ctrl.relTolRefine,
           ctrl.maxRefineIts, 
           ctrl.progress );
+    case REG_SOLVE_PIPELINED_CG:
+    case REG_SOLVE_PIPELINED_GMRES:
+        return PipelinedSolveAfter( A, reg, d, sparseLDLFact, B, ctrl );
     default:
         LogicError("Invalid refinement algorithm");
         return -1;
@@ -794,6 +919,9 @@ Int SolveAfter
           ctrl.relTolRefine,
           ctrl.maxRefineIts, 
           ctrl.progress );
+    case REG_SOLVE_PIPELINED_CG:
+    case REG_SOLVE_PIPELINED_GMRES:
+        return PipelinedSolveAfter( A, reg, sparseLDLFact, B, ctrl );
     default:
         LogicError("Invalid refinement algorithm");
         return -1;
@@ -831,6 +959,105 @@ Int SolveAfter
           ctrl.relTolRefine,
           ctrl.maxRefineIts, 
           ctrl.progress );
+    case REG_SOLVE_PIPELINED_CG:
+    case REG_SOLVE_PIPELINED_GMRES:
+        return PipelinedSolveAfter( A, reg, d, sparseLDLFact, B, ctrl );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+// A matrix-free operator is handled by refining the preconditioner against
+// the regularized operator, A + diag(reg), without promotion
+template<typename Field>
+Int SolveAfter
+( const LinearOperator<Field>& A,
+  const Matrix<Base<Field>>& reg,
+  const SparseLDLFactorization<Field>& sparseLDLFact,
+        Matrix<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyReg =
+      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        A.Apply( NORMAL, Field(1), X, Field(1), Y );
+      };
+    auto applyRegInv =
+      [&]( Matrix<Field>& Y )
+      {
+        sparseLDLFact.Solve( Y );
+      };
+    auto precond =
+      [&]( Matrix<Field>& W )
+      {
+        RefinedSolve
+        ( applyReg, applyRegInv, W,
+          ctrl.relTolRefine, ctrl.maxRefineIts, ctrl.progress );
+      };
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRES
+        ( A, precond, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+    case REG_SOLVE_LGMRES:
+        return LGMRES
+        ( A, precond, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+    case REG_SOLVE_PIPELINED_CG:
+    case REG_SOLVE_PIPELINED_GMRES:
+        return PipelinedSolve<Field>( A, precond, B, ctrl );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+template<typename Field>
+Int SolveAfter
+( const DistLinearOperator<Field>& A,
+  const DistMultiVec<Base<Field>>& reg,
+  const DistSparseLDLFactorization<Field>& sparseLDLFact,
+        DistMultiVec<Field>& B,
+  const RegSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    auto applyReg =
+      [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        A.Apply( NORMAL, Field(1), X, Field(1), Y );
+      };
+    auto applyRegInv =
+      [&]( DistMultiVec<Field>& Y )
+      {
+        sparseLDLFact.Solve( Y );
+      };
+    auto precond =
+      [&]( DistMultiVec<Field>& W )
+      {
+        RefinedSolve
+        ( applyReg, applyRegInv, W,
+          ctrl.relTolRefine, ctrl.maxRefineIts, ctrl.progress );
+      };
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRES
+        ( A, precond, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+    case REG_SOLVE_LGMRES:
+        return LGMRES
+        ( A, precond, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts, ctrl.progress );
+    case REG_SOLVE_PIPELINED_CG:
+    case REG_SOLVE_PIPELINED_GMRES:
+        return PipelinedSolve<Field>( A, precond, B, ctrl );
     default:
         LogicError("Invalid refinement algorithm");
         return -1;
@@ -887,6 +1114,18 @@ Int SolveAfter
   ( const DistSparseMatrix<Field>& A, \
     const DistMultiVec<Base<Field>>& reg, \
     const DistMultiVec<Base<Field>>& d, \
+    const DistSparseLDLFactorization<Field>& sparseLDLFact, \
+          DistMultiVec<Field>& B, \
+    const RegSolveCtrl<Base<Field>>& ctrl ); \
+  template Int SolveAfter \
+  ( const LinearOperator<Field>& A, \
+    const Matrix<Base<Field>>& reg, \
+    const SparseLDLFactorization<Field>& sparseLDLFact, \
+          Matrix<Field>& B, \
+    const RegSolveCtrl<Base<Field>>& ctrl ); \
+  template Int SolveAfter \
+  ( const DistLinearOperator<Field>& A, \
+    const DistMultiVec<Base<Field>>& reg, \
     const DistSparseLDLFactorization<Field>& sparseLDLFact, \
           DistMultiVec<Field>& B, \
     const RegSolveCtrl<Base<Field>>& ctrl );
@@ -0,0 +1,373 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <atomic>
+
+#include "./QR/PanelHouseholder.hpp"
+
+// Each factorization below is expressed as a graph of tasks over the tiles
+// (or tile columns) of the matrix. With EL_HYBRID, the tasks are OpenMP tasks
+// whose dependencies are declared on the leading entries of the tiles they
+// access, so that the OpenMP runtime schedules them dynamically (with work
+// stealing) and the tasks on the critical path of the panel factorizations
+// are given priority. Without EL_HYBRID, the tasks simply run in the order in
+// which they are generated, which is the usual right-looking order.
+//
+// The tile pointers only appear in the dependency clauses, which vanish
+// without EL_HYBRID, and so they are explicitly marked as possibly unused.
+//
+// NOTE: The BLAS calls within each task should be sequential; the custom
+//       kernels detect that they are within a parallel region, but a
+//       multithreaded vendor BLAS should be configured accordingly.
+#ifdef EL_HYBRID
+# define EL_TILED_PRAGMA(x) _Pragma(#x)
+# define EL_TILED_TASK(clauses) EL_TILED_PRAGMA(omp task clauses)
+#else
+# define EL_TILED_TASK(clauses)
+#endif
+
+namespace El {
+
+namespace lu {
+
+template<typename Field>
+void Panel( Matrix<Field>& APan, Permutation& P, Permutation& p1, Int offset );
+
+} // namespace lu
+
+namespace {
+
+// Tasks cannot propagate exceptions, so the first one is recorded (and
+// rethrown once the graph has completed) and the later tasks are skipped
+class TaskErrors
+{
+public:
+    template<typename Body>
+    void Run( Body body )
+    {
+        if( failed_.load() )
+            return;
+        try { body(); }
+        catch( ... )
+        {
+#ifdef EL_HYBRID
+            _Pragma("omp critical(ElTiledErrors)")
+#endif
+            if( !error_ )
+                error_ = std::current_exception();
+            failed_.store( true );
+        }
+    }
+
+    void Rethrow() const
+    {
+        if( error_ )
+            std::rethrow_exception( error_ );
+    }
+
+private:
+    std::atomic<bool> failed_{false};
+    std::exception_ptr error_;
+};
+
+// Partition [0,width) into blocks of (at most) the given size, with a block
+// boundary at splitPoint so that the panels of a factorization with
+// minDim=splitPoint are unions of blocks
+vector<Int> BlockOffsets( Int width, Int splitPoint, Int blocksize )
+{
+    vector<Int> offsets;
+    for( Int off=0; off<splitPoint; off+=blocksize )
+        offsets.push_back( off );
+    for( Int off=splitPoint; off<width; off+=blocksize )
+        offsets.push_back( off );
+    offsets.push_back( width );
+    return offsets;
+}
+
+} // anonymous namespace
+
+template<typename Field>
+void CholeskyTiled( UpperOrLower uplo, Matrix<Field>& A, Int tileSize )
+{
+    EL_DEBUG_CSE
+    EL_REGION("CholeskyTiled");
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    const Int n = A.Height();
+    const Int nb =
+      ( tileSize > 0 ? tileSize : TunedBlocksize<Field>("CholeskyTiled") );
+    const Int numTiles = (n+nb-1) / nb;
+    auto tile = [&]( Int t ) { return IR( t*nb, Min((t+1)*nb,n) ); };
+
+    TaskErrors errors;
+#ifdef EL_HYBRID
+    _Pragma("omp parallel")
+    _Pragma("omp single")
+#endif
+    for( Int k=0; k<numTiles; ++k )
+    {
+        Field* Akk = A.Buffer( k*nb, k*nb );
+        EL_UNUSED(Akk);
+        EL_TILED_TASK(depend(inout:Akk[0]) priority(3))
+        errors.Run( [&,k]() { auto Akk = A( tile(k), tile(k) );
+                              Cholesky( uplo, Akk ); } );
+
+        for( Int i=k+1; i<numTiles; ++i )
+        {
+            // The off-diagonal tile of the k'th tile column (or row)
+            Field* Aik =
+              ( uplo==LOWER ? A.Buffer( i*nb, k*nb ) : A.Buffer( k*nb, i*nb ) );
+            EL_UNUSED(Aik);
+            EL_TILED_TASK(depend(in:Akk[0]) depend(inout:Aik[0]) priority(2))
+            errors.Run
+            ( [&,i,k]()
+              {
+                  auto Akk = A( tile(k), tile(k) );
+                  if( uplo == LOWER )
+                  {
+                      auto Aik = A( tile(i), tile(k) );
+                      Trsm
+                      ( RIGHT, LOWER, ADJOINT, NON_UNIT, Field(1), Akk, Aik );
+                  }
+                  else
+                  {
+                      auto Aki = A( tile(k), tile(i) );
+                      Trsm
+                      ( LEFT, UPPER, ADJOINT, NON_UNIT, Field(1), Akk, Aki );
+                  }
+              } );
+        }
+
+        for( Int i=k+1; i<numTiles; ++i )
+        {
+            Field* Aik =
+              ( uplo==LOWER ? A.Buffer( i*nb, k*nb ) : A.Buffer( k*nb, i*nb ) );
+            Field* Aii = A.Buffer( i*nb, i*nb );
+            EL_UNUSED(Aik);
+            EL_UNUSED(Aii);
+            EL_TILED_TASK
+            (depend(in:Aik[0]) depend(inout:Aii[0]) priority(i==k+1))
+            errors.Run
+            ( [&,i,k]()
+              {
+                  auto Aii = A( tile(i), tile(i) );
+                  if( uplo == LOWER )
+                      Herk
+                      ( LOWER, NORMAL,
+                        Base<Field>(-1), A( tile(i), tile(k) ),
+                        Base<Field>(1), Aii );
+                  else
+                      Herk
+                      ( UPPER, ADJOINT,
+                        Base<Field>(-1), A( tile(k), tile(i) ),
+                        Base<Field>(1), Aii );
+              } );
+
+            // Tile (i,j) of the lower triangle or (j,i) of the upper one
+            for( Int j=k+1; j<i; ++j )
+            {
+                Field* Ajk =
+                  ( uplo==LOWER ? A.Buffer( j*nb, k*nb )
+                                : A.Buffer( k*nb, j*nb ) );
+                Field* Aij =
+                  ( uplo==LOWER ? A.Buffer( i*nb, j*nb )
+                                : A.Buffer( j*nb, i*nb ) );
+                EL_UNUSED(Ajk);
+                EL_UNUSED(Aij);
+                EL_TILED_TASK
+                (depend(in:Aik[0],Ajk[0]) depend(inout:Aij[0])
+                 priority(j==k+1))
+                errors.Run
+                ( [&,i,j,k]()
+                  {
+                      if( uplo == LOWER )
+                      {
+                          auto Aij = A( tile(i), tile(j) );
+                          Gemm
+                          ( NORMAL, ADJOINT,
+                            Field(-1), A( tile(i), tile(k) ),
+                                       A( tile(j), tile(k) ),
+                            Field(1), Aij );
+                      }
+                      else
+                      {
+                          auto Aji = A( tile(j), tile(i) );
+                          Gemm
+                          ( ADJOINT, NORMAL,
+                            Field(-1), A( tile(k), tile(j) ),
+                                       A( tile(k), tile(i) ),
+                            Field(1), Aji );
+                      }
+                  } );
+            }
+        }
+    }
+    errors.Rethrow();
+}
+
+template<typename Field>
+void LUTiled( Matrix<Field>& A, Permutation& P, Int tileSize )
+{
+    EL_DEBUG_CSE
+    EL_REGION("LUTiled");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int nb =
+      ( tileSize > 0 ? tileSize : TunedBlocksize<Field>("LUTiled") );
+    const vector<Int> offsets = BlockOffsets( n, minDim, nb );
+    const Int numBlocks = offsets.size()-1;
+    const Int numPanels = (minDim+nb-1) / nb;
+    auto block = [&]( Int j ) { return IR( offsets[j], offsets[j+1] ); };
+
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+    vector<Permutation> panelPerms( numPanels );
+
+    // The tasks operate on entire tile columns, as the pivoting of each panel
+    // couples all of the rows of its trailing columns
+    TaskErrors errors;
+#ifdef EL_HYBRID
+    _Pragma("omp parallel")
+    _Pragma("omp single")
+#endif
+    for( Int k=0; k<numPanels; ++k )
+    {
+        Field* Ak = A.Buffer( 0, offsets[k] );
+        EL_UNUSED(Ak);
+        EL_TILED_TASK(depend(inout:Ak[0]) priority(2))
+        errors.Run
+        ( [&,k]()
+          {
+              auto AB1 = A( IR(offsets[k],END), block(k) );
+              lu::Panel( AB1, P, panelPerms[k], offsets[k] );
+          } );
+
+        for( Int j=k+1; j<numBlocks; ++j )
+        {
+            Field* Aj = A.Buffer( 0, offsets[j] );
+            EL_UNUSED(Aj);
+            EL_TILED_TASK
+            (depend(in:Ak[0]) depend(inout:Aj[0]) priority(j==k+1))
+            errors.Run
+            ( [&,j,k]()
+              {
+                  const IR ind1( offsets[k], offsets[k+1] ),
+                           ind2( offsets[k+1], END ),
+                           indB( offsets[k], END );
+                  auto ABj = A( indB, block(j) );
+                  panelPerms[k].PermuteRows( ABj );
+
+                  auto A11 = A( ind1, ind1 );
+                  auto A21 = A( ind2, ind1 );
+                  auto A1j = A( ind1, block(j) );
+                  auto A2j = A( ind2, block(j) );
+                  Trsm( LEFT, LOWER, NORMAL, UNIT, Field(1), A11, A1j );
+                  Gemm( NORMAL, NORMAL, Field(-1), A21, A1j, Field(1), A2j );
+              } );
+        }
+    }
+    errors.Rethrow();
+
+    // Apply the pivots of each panel to the columns of L to its left
+    ParallelFor
+    ( numPanels,
+      [&]( Int j )
+      {
+          for( Int k=j+1; k<numPanels; ++k )
+          {
+              auto ABj = A( IR(offsets[k],END), block(j) );
+              panelPerms[k].PermuteRows( ABj );
+          }
+      } );
+}
+
+template<typename Field>
+void QRTiled
+( Matrix<Field>& A,
+  Matrix<Field>& householderScalars,
+  Matrix<Base<Field>>& signature,
+  Int tileSize )
+{
+    EL_DEBUG_CSE
+    EL_REGION("QRTiled");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int nb =
+      ( tileSize > 0 ? tileSize : TunedBlocksize<Field>("QRTiled") );
+    const vector<Int> offsets = BlockOffsets( n, minDim, nb );
+    const Int numBlocks = offsets.size()-1;
+    const Int numPanels = (minDim+nb-1) / nb;
+    auto block = [&]( Int j ) { return IR( offsets[j], offsets[j+1] ); };
+
+    householderScalars.Resize( minDim, 1 );
+    signature.Resize( minDim, 1 );
+
+    TaskErrors errors;
+#ifdef EL_HYBRID
+    _Pragma("omp parallel")
+    _Pragma("omp single")
+#endif
+    for( Int k=0; k<numPanels; ++k )
+    {
+        Field* Ak = A.Buffer( 0, offsets[k] );
+        EL_UNUSED(Ak);
+        EL_TILED_TASK(depend(inout:Ak[0]) priority(2))
+        errors.Run
+        ( [&,k]()
+          {
+              auto AB1 = A( IR(offsets[k],END), block(k) );
+              auto householderScalars1 = householderScalars( block(k), ALL );
+              auto signature1 = signature( block(k), ALL );
+              qr::PanelHouseholder( AB1, householderScalars1, signature1 );
+          } );
+
+        for( Int j=k+1; j<numBlocks; ++j )
+        {
+            Field* Aj = A.Buffer( 0, offsets[j] );
+            EL_UNUSED(Aj);
+            EL_TILED_TASK
+            (depend(in:Ak[0]) depend(inout:Aj[0]) priority(j==k+1))
+            errors.Run
+            ( [&,j,k]()
+              {
+                  const IR indB( offsets[k], END );
+                  auto AB1 = A( indB, block(k) );
+                  auto ABj = A( indB, block(j) );
+                  auto householderScalars1 =
+                    householderScalars( block(k), ALL );
+                  auto signature1 = signature( block(k), ALL );
+                  qr::ApplyQ
+                  ( LEFT, ADJOINT, AB1, householderScalars1, signature1, ABj );
+              } );
+        }
+    }
+    errors.Rethrow();
+}
+
+#define PROTO(Field) \
+  template void CholeskyTiled \
+  ( UpperOrLower uplo, Matrix<Field>& A, Int tileSize ); \
+  template void LUTiled \
+  ( Matrix<Field>& A, Permutation& P, Int tileSize ); \
+  template void QRTiled \
+  ( Matrix<Field>& A, \
+    Matrix<Field>& householderScalars, \
+    Matrix<Base<Field>>& signature, \
+    Int tileSize );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
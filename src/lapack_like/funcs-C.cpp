@@ -21,6 +21,8 @@ ElError ElSignCtrlDefault_s( ElSignCtrl_s* ctrl )
     ctrl->power = 1;
     ctrl->scaling = EL_SIGN_SCALE_FROB;
     ctrl->progress = false;
+    ctrl->newtonSchulz = false;
+    ctrl->newtonSchulzTol = 0.5;
     return EL_SUCCESS;
 }
 ElError ElSignCtrlDefault_d( ElSignCtrl_d* ctrl )
@@ -30,6 +32,8 @@ ElError ElSignCtrlDefault_d( ElSignCtrl_d* ctrl )
     ctrl->power = 1;
     ctrl->scaling = EL_SIGN_SCALE_FROB;
     ctrl->progress = false;
+    ctrl->newtonSchulz = false;
+    ctrl->newtonSchulzTol = 0.5;
     return EL_SUCCESS;
 }
 
@@ -39,6 +43,8 @@ ElError ElSquareRootCtrlDefault_s( ElSquareRootCtrl_s* ctrl )
     ctrl->tol = 0;
     ctrl->power = 1;
     ctrl->progress = false;
+    ctrl->newtonSchulz = false;
+    ctrl->newtonSchulzTol = 0.5;
     return EL_SUCCESS;
 }
 ElError ElSquareRootCtrlDefault_d( ElSquareRootCtrl_d* ctrl )
@@ -47,6 +53,8 @@ ElError ElSquareRootCtrlDefault_d( ElSquareRootCtrl_d* ctrl )
     ctrl->tol = 0;
     ctrl->power = 1;
     ctrl->progress = false;
+    ctrl->newtonSchulz = false;
+    ctrl->newtonSchulzTol = 0.5;
     return EL_SUCCESS;
 }
 
@@ -8,7 +8,9 @@
 */
 #include <El.hpp>
 
+#include "../../factor/LU/Panel.hpp"
 #include "./General/LUPartialPiv.hpp"
+#include "./General/GaussJordan.hpp"
 
 namespace El {
 
@@ -23,7 +25,7 @@ template<typename Field>
 void Inverse( AbstractDistMatrix<Field>& A )
 {
     EL_DEBUG_CSE
-    inverse::LUPartialPiv( A );
+    inverse::GaussJordan( A );
 }
 
 template<typename Field>
@@ -40,7 +42,11 @@ void LocalInverse( DistMatrix<Field,STAR,STAR>& A )
   template void inverse::AfterLUPartialPiv \
   ( Matrix<Field>& A, const Permutation& P ); \
   template void inverse::AfterLUPartialPiv \
-  ( AbstractDistMatrix<Field>& A, const DistPermutation& P );
+  ( AbstractDistMatrix<Field>& A, const DistPermutation& P ); \
+  template void inverse::LUPartialPiv( Matrix<Field>& A ); \
+  template void inverse::LUPartialPiv( AbstractDistMatrix<Field>& A ); \
+  template void inverse::GaussJordan( Matrix<Field>& A ); \
+  template void inverse::GaussJordan( AbstractDistMatrix<Field>& A );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
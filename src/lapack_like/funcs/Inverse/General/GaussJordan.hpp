@@ -0,0 +1,253 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_INVERSE_GAUSSJORDAN_HPP
+#define EL_INVERSE_GAUSSJORDAN_HPP
+
+namespace El {
+namespace inverse {
+
+// Blocked, in-place Gauss-Jordan elimination with partial pivoting, as in
+//
+//   E. S. Quintana-Orti, G. Quintana-Orti, X. Sun, and R. van de Geijn,
+//   "A note on parallel matrix inversion", SIAM J. Sci. Comput., 2001.
+//
+// After pivoting the rows of the panel A(:,k:k+nb-1) so that its diagonal
+// block has the factorization A11 = L11 U11 (and A21 = L21 U11), the
+// current (partially inverted) matrix is updated with the single rank-nb
+// product
+//
+//   | A0 |    | A0 |   | A01 inv(U11) |
+//   | A2 | := | A2 | - |     L21      | inv(L11) | A10, A11, A12 |,
+//
+// its block row is overwritten with inv(A11) | A10, A11, A12 |, and the
+// panel itself is set to
+//
+//   | -A01 inv(A11); inv(A11); -A21 inv(A11) |.
+//
+// The result is inv(P A), where P is the accumulated row permutation, and
+// so inv(A) = inv(P A) P. Unlike forming inv(A) from an LU factorization,
+// a single sweep over the matrix is required, and each step is dominated
+// by one matrix-matrix multiplication over the entire matrix.
+
+template<typename Field>
+void GaussJordan( Matrix<Field>& A )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("Cannot invert non-square matrices");
+    const Int n = A.Height();
+
+    Permutation P, PB;
+    P.MakeIdentity( n );
+    P.ReserveSwaps( n );
+
+    Matrix<Field> R, A01, A21, X11;
+    const Int bsize = Blocksize();
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const IR ind0( 0, k ), ind1( k, k+nb ), ind2( k+nb, END ),
+                 indB( k, END );
+
+        auto A0 = A( ind0, ALL );
+        auto A1 = A( ind1, ALL );
+        auto A2 = A( ind2, ALL );
+        auto A11 = A( ind1, ind1 );
+
+        auto AB0 = A( indB, ind0 );
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+
+        lu::Panel( AB1, P, PB, k );
+        PB.PermuteRows( AB0 );
+        PB.PermuteRows( AB2 );
+
+        // R := inv(L11) A1, A01 := A01 inv(U11), and A21 := L21
+        R = A1;
+        Trsm( LEFT, LOWER, NORMAL, UNIT, Field(1), A11, R );
+        A01 = A( ind0, ind1 );
+        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, Field(1), A11, A01 );
+        A21 = A( ind2, ind1 );
+
+        Gemm( NORMAL, NORMAL, Field(-1), A01, R, Field(1), A0 );
+        Gemm( NORMAL, NORMAL, Field(-1), A21, R, Field(1), A2 );
+
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), A11, R );
+        Trsm( RIGHT, LOWER, NORMAL, UNIT, Field(-1), A11, A01 );
+        Trsm( RIGHT, LOWER, NORMAL, UNIT, Field(-1), A11, A21 );
+        Identity( X11, nb, nb );
+        Trsm( LEFT, LOWER, NORMAL, UNIT, Field(1), A11, X11 );
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), A11, X11 );
+
+        A1 = R;
+        A11 = X11;
+        A( ind0, ind1 ) = A01;
+        A( ind2, ind1 ) = A21;
+    }
+
+    // inv(A) := inv(P A) P
+    P.InversePermuteCols( A );
+}
+
+// The distributed algorithm looks ahead by one panel: the columns of the
+// next panel are updated first so that their redistribution can proceed in
+// the background of the remainder of the rank-nb update.
+template<typename Field>
+void GaussJordan( AbstractDistMatrix<Field>& APre )
+{
+    EL_DEBUG_CSE
+    EL_REGION("inverse::GaussJordan");
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    if( A.Height() != A.Width() )
+        LogicError("Cannot invert non-square matrices");
+    const Int n = A.Height();
+    const Grid& g = A.Grid();
+
+    DistPermutation P(g), PB(g);
+    P.MakeIdentity( n );
+    P.ReserveSwaps( n );
+
+    DistMatrix<Field,STAR,STAR> A11_STAR_STAR(g), A11Next_STAR_STAR(g),
+                                X11_STAR_STAR(g);
+    DistMatrix<Field,MC,  STAR> A21_MC_STAR(g), A21Next_MC_STAR(g),
+                                A01_MC_STAR(g);
+    DistMatrix<Field,VC,  STAR> A01_VC_STAR(g), A21_VC_STAR(g);
+    DistMatrix<Field,STAR,VR  > R_STAR_VR(g);
+    DistMatrix<Field,STAR,MR  > R_STAR_MR(g);
+    CopyRequest<Field> A11Request, A21Request;
+
+    vector<Field> panelBuf, pivotBuf;
+    const Int bsize = Blocksize();
+
+    // Begin gathering the (fully updated) panel starting at index k
+    auto startPanel =
+      [&]( Int k )
+      {
+          const Int nb = Min(bsize,n-k);
+          const IR ind1( k, k+nb ), ind2( k+nb, n );
+          A21Next_MC_STAR.AlignWith( A( ind2, ind1 ) );
+          CopyAsync( A( ind1, ind1 ), A11Next_STAR_STAR, A11Request );
+          CopyAsync( A( ind2, ind1 ), A21Next_MC_STAR, A21Request );
+      };
+
+    // Pack the panel starting at index k into contiguous storage and factor
+    // it with partial pivoting
+    auto finishPanel =
+      [&]( Int k )
+      {
+          const Int nb = Min(bsize,n-k);
+          const IR ind2( k+nb, n );
+          auto A21 = A( ind2, IR(k,k+nb) );
+          const Int A21Height = A21.Height();
+          const Int panelLDim = nb+A21.LocalHeight();
+          FastResize( panelBuf, panelLDim*nb );
+          A11_STAR_STAR.Attach
+          ( nb, nb, g, 0, 0, &panelBuf[0], panelLDim, 0 );
+          A21_MC_STAR.Attach
+          ( A21Height, nb, g, A21.ColAlign(), 0, &panelBuf[nb], panelLDim, 0 );
+          A11Request.Wait();
+          A21Request.Wait();
+          A11_STAR_STAR = A11Next_STAR_STAR;
+          A21_MC_STAR = A21Next_MC_STAR;
+          lu::Panel( A11_STAR_STAR, A21_MC_STAR, P, PB, k, pivotBuf );
+      };
+
+    if( n > 0 )
+    {
+        startPanel( 0 );
+        finishPanel( 0 );
+    }
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int nbNext = Min(bsize,n-k-nb);
+        const IR ind0( 0, k ), ind1( k, k+nb ), ind2( k+nb, END ),
+                 indB( k, END );
+
+        auto A0 = A( ind0, ALL );
+        auto A1 = A( ind1, ALL );
+        auto A2 = A( ind2, ALL );
+        auto AB = A( indB, ALL );
+
+        PB.PermuteRows( AB );
+
+        // R := inv(L11) A1 and A01 := A01 inv(U11)
+        R_STAR_VR.AlignWith( A );
+        R_STAR_VR = A1;
+        LocalTrsm
+        ( LEFT, LOWER, NORMAL, UNIT, Field(1), A11_STAR_STAR, R_STAR_VR );
+        R_STAR_MR.AlignWith( A );
+        R_STAR_MR = R_STAR_VR;
+
+        A01_VC_STAR.AlignWith( A0 );
+        A01_VC_STAR = A( ind0, ind1 );
+        LocalTrsm
+        ( RIGHT, UPPER, NORMAL, NON_UNIT,
+          Field(1), A11_STAR_STAR, A01_VC_STAR );
+        A01_MC_STAR.AlignWith( A0 );
+        A01_MC_STAR = A01_VC_STAR;
+
+        if( nbNext > 0 )
+        {
+            // Update the next panel and begin gathering it
+            const IR indL( 0, k+nb ), indM( k+nb, k+nb+nbNext ),
+                     indR( k+nb+nbNext, END );
+            auto A2M = A2( ALL, indM );
+            auto A2L = A2( ALL, indL );
+            auto A2R = A2( ALL, indR );
+            LocalGemm
+            ( NORMAL, NORMAL,
+              Field(-1), A21_MC_STAR, R_STAR_MR( ALL, indM ), Field(1), A2M );
+            startPanel( k+nb );
+
+            LocalGemm
+            ( NORMAL, NORMAL,
+              Field(-1), A21_MC_STAR, R_STAR_MR( ALL, indL ), Field(1), A2L );
+            LocalGemm
+            ( NORMAL, NORMAL,
+              Field(-1), A21_MC_STAR, R_STAR_MR( ALL, indR ), Field(1), A2R );
+        }
+        LocalGemm
+        ( NORMAL, NORMAL, Field(-1), A01_MC_STAR, R_STAR_MR, Field(1), A0 );
+
+        // Form the new block row and panel
+        LocalTrsm
+        ( LEFT, UPPER, NORMAL, NON_UNIT, Field(1), A11_STAR_STAR, R_STAR_VR );
+        LocalTrsm
+        ( RIGHT, LOWER, NORMAL, UNIT, Field(-1), A11_STAR_STAR, A01_VC_STAR );
+        A21_VC_STAR.AlignWith( A2 );
+        A21_VC_STAR = A21_MC_STAR;
+        LocalTrsm
+        ( RIGHT, LOWER, NORMAL, UNIT, Field(-1), A11_STAR_STAR, A21_VC_STAR );
+        Identity( X11_STAR_STAR, nb, nb );
+        LocalTrsm
+        ( LEFT, LOWER, NORMAL, UNIT,
+          Field(1), A11_STAR_STAR, X11_STAR_STAR );
+        LocalTrsm
+        ( LEFT, UPPER, NORMAL, NON_UNIT,
+          Field(1), A11_STAR_STAR, X11_STAR_STAR );
+
+        A1 = R_STAR_VR;
+        A( ind1, ind1 ) = X11_STAR_STAR;
+        A( ind0, ind1 ) = A01_VC_STAR;
+        A( ind2, ind1 ) = A21_VC_STAR;
+
+        if( nbNext > 0 )
+            finishPanel( k+nb );
+    }
+
+    // inv(A) := inv(P A) P
+    P.InversePermuteCols( A );
+}
+
+} // namespace inverse
+} // namespace El
+
+#endif // ifndef EL_INVERSE_GAUSSJORDAN_HPP
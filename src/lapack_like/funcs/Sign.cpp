@@ -78,6 +78,32 @@ NewtonStep
     Axpy( halfMu, X, XNew );
 }
 
+// XTmp := I - X^2, and return the upper bound
+// sqrt(|| XTmp ||_1 || XTmp ||_oo) on its two-norm. The Newton-Schulz
+// iteration converges (quadratically) from X if the two-norm is below one.
+template<typename Field>
+Base<Field>
+NewtonSchulzResidual( const Matrix<Field>& X, Matrix<Field>& XTmp )
+{
+    EL_DEBUG_CSE
+    const Int n = X.Height();
+    Identity( XTmp, n, n );
+    Gemm( NORMAL, NORMAL, Field(-1), X, X, Field(1), XTmp );
+    return Sqrt( OneNorm(XTmp)*InfinityNorm(XTmp) );
+}
+
+template<typename Field>
+Base<Field>
+NewtonSchulzResidual( const DistMatrix<Field>& X, DistMatrix<Field>& XTmp )
+{
+    EL_DEBUG_CSE
+    const Int n = X.Height();
+    Identity( XTmp, n, n );
+    Gemm( NORMAL, NORMAL, Field(-1), X, X, Field(1), XTmp );
+    return Sqrt( OneNorm(XTmp)*InfinityNorm(XTmp) );
+}
+
+// Given XTmp = I - X^2, overwrite XNew with 1/2 X (3I - X^2)
 template<typename Field>
 void
 NewtonSchulzStep
@@ -86,15 +112,8 @@ NewtonSchulzStep
         Matrix<Field>& XNew )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
-    const Int n = X.Height();
-
-    // XTmp := 3I - X^2
-    Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
-
-    // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    ShiftDiagonal( XTmp, Field(2) );
+    Gemm( NORMAL, NORMAL, Field(1)/Field(2), X, XTmp, XNew );
 }
 
 template<typename Field>
@@ -105,15 +124,8 @@ NewtonSchulzStep
         DistMatrix<Field>& XNew )
 {
     EL_DEBUG_CSE
-    typedef Base<Field> Real;
-    const Int n = X.Height();
-
-    // XTmp := 3I - X^2
-    Identity( XTmp, n, n );
-    Gemm( NORMAL, NORMAL, Real(-1), X, X, Real(3), XTmp );
-
-    // XNew := 1/2 X XTmp
-    Gemm( NORMAL, NORMAL, Real(1)/Real(2), X, XTmp, XNew );
+    ShiftDiagonal( XTmp, Field(2) );
+    Gemm( NORMAL, NORMAL, Field(1)/Field(2), X, XTmp, XNew );
 }
 
 // Please see Chapter 5 of Higham's
@@ -130,27 +142,38 @@ Newton( Matrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
         tol = A.Height()*limits::Epsilon<Real>();
 
     Int numIts=0;
-    Matrix<Field> B;
+    Real relDiff = limits::Infinity<Real>();
+    Matrix<Field> B, XTmp;
     Matrix<Field> *X=&A, *XNew=&B;
     while( numIts < ctrl.maxIts )
     {
-        // Overwrite XNew with the new iterate
-        NewtonStep( *X, *XNew, ctrl.scaling );
+        // Overwrite XNew with the new iterate, using the inverse-free
+        // Newton-Schulz iteration once it is guaranteed to converge
+        bool newtonSchulz = false;
+        if( ctrl.newtonSchulz && relDiff <= ctrl.newtonSchulzTol )
+            newtonSchulz =
+              ( NewtonSchulzResidual( *X, XTmp ) <= ctrl.newtonSchulzTol );
+        if( newtonSchulz )
+            NewtonSchulzStep( *X, XTmp, *XNew );
+        else
+            NewtonStep( *X, *XNew, ctrl.scaling );
 
         // Use the difference in the iterates to test for convergence
         Axpy( Real(-1), *XNew, *X );
         const Real oneDiff = OneNorm( *X );
         const Real oneNew = OneNorm( *XNew );
+        relDiff = oneDiff/oneNew;
 
         // Ensure that X holds the current iterate and break if possible
         ++numIts;
         std::swap( X, XNew );
         if( ctrl.progress )
-            cout << "after " << numIts << " Newton iter's: "
-                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
-                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+            cout << "after " << numIts
+                 << ( newtonSchulz ? " Newton-Schulz" : " Newton" )
+                 << " iter's: oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << relDiff << ", tol="
                  << tol << endl;
-        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+        if( relDiff <= Pow(oneNew,ctrl.power)*tol )
             break;
     }
     if( X != &A )
@@ -169,27 +192,38 @@ Newton( DistMatrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
         tol = A.Height()*limits::Epsilon<Real>();
 
     Int numIts=0;
-    DistMatrix<Field> B( A.Grid() );
+    Real relDiff = limits::Infinity<Real>();
+    DistMatrix<Field> B( A.Grid() ), XTmp( A.Grid() );
     DistMatrix<Field> *X=&A, *XNew=&B;
     while( numIts < ctrl.maxIts )
     {
-        // Overwrite XNew with the new iterate
-        NewtonStep( *X, *XNew, ctrl.scaling );
+        // Overwrite XNew with the new iterate, using the inverse-free
+        // Newton-Schulz iteration once it is guaranteed to converge
+        bool newtonSchulz = false;
+        if( ctrl.newtonSchulz && relDiff <= ctrl.newtonSchulzTol )
+            newtonSchulz =
+              ( NewtonSchulzResidual( *X, XTmp ) <= ctrl.newtonSchulzTol );
+        if( newtonSchulz )
+            NewtonSchulzStep( *X, XTmp, *XNew );
+        else
+            NewtonStep( *X, *XNew, ctrl.scaling );
 
         // Use the difference in the iterates to test for convergence
         Axpy( Real(-1), *XNew, *X );
         const Real oneDiff = OneNorm( *X );
         const Real oneNew = OneNorm( *XNew );
+        relDiff = oneDiff/oneNew;
 
         // Ensure that X holds the current iterate and break if possible
         ++numIts;
         std::swap( X, XNew );
         if( ctrl.progress && A.Grid().Rank() == 0 )
-            cout << "after " << numIts << " Newton iter's: "
-                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
-                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+            cout << "after " << numIts
+                 << ( newtonSchulz ? " Newton-Schulz" : " Newton" )
+                 << " iter's: oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << relDiff << ", tol="
                  << tol << endl;
-        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+        if( relDiff <= Pow(oneNew,ctrl.power)*tol )
             break;
     }
     if( X != &A )
@@ -197,8 +231,6 @@ Newton( DistMatrix<Field>& A, const SignCtrl<Base<Field>>& ctrl )
     return numIts;
 }
 
-// TODO: NewtonSchulzHybrid which estimates when || X^2 - I ||_2 < 1
-
 } // namespace sign
 
 template<typename Field>
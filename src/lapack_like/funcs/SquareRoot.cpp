@@ -61,13 +61,95 @@ NewtonStep
     Axpy( Real(1)/Real(2), X, XNew );
 }
 
+// Z := inv(X), Y := A Z, and T := I - Z Y, and return the upper bound
+// sqrt(|| T ||_1 || T ||_oo) on the two-norm of T. The coupled Newton-Schulz
+// iteration from (Y,Z) converges (quadratically) to (A^{1/2},A^{-1/2}) if the
+// two-norm is below one.
+template<typename Field>
+Base<Field>
+NewtonSchulzStart
+( const Matrix<Field>& A,
+  const Matrix<Field>& X,
+        Matrix<Field>& Y,
+        Matrix<Field>& Z,
+        Matrix<Field>& T )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    Z = X;
+    Inverse( Z );
+    Gemm( NORMAL, NORMAL, Field(1), A, Z, Y );
+    Identity( T, n, n );
+    Gemm( NORMAL, NORMAL, Field(-1), Z, Y, Field(1), T );
+    return Sqrt( OneNorm(T)*InfinityNorm(T) );
+}
+
+template<typename Field>
+Base<Field>
+NewtonSchulzStart
+( const DistMatrix<Field>& A,
+  const DistMatrix<Field>& X,
+        DistMatrix<Field>& Y,
+        DistMatrix<Field>& Z,
+        DistMatrix<Field>& T )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    Z = X;
+    Inverse( Z );
+    Gemm( NORMAL, NORMAL, Field(1), A, Z, Y );
+    Identity( T, n, n );
+    Gemm( NORMAL, NORMAL, Field(-1), Z, Y, Field(1), T );
+    return Sqrt( OneNorm(T)*InfinityNorm(T) );
+}
+
+// Given T = I - Z Y, overwrite YNew with 1/2 Y (3I - Z Y), Z with
+// 1/2 (3I - Z Y) Z, and then T with I - Z YNew
+template<typename Field>
+void
+NewtonSchulzStep
+( const Matrix<Field>& Y,
+        Matrix<Field>& Z,
+        Matrix<Field>& YNew,
+        Matrix<Field>& T,
+        Matrix<Field>& ZTmp )
+{
+    EL_DEBUG_CSE
+    const Int n = Y.Height();
+    ShiftDiagonal( T, Field(2) );
+    Gemm( NORMAL, NORMAL, Field(1)/Field(2), Y, T, YNew );
+    Gemm( NORMAL, NORMAL, Field(1)/Field(2), T, Z, ZTmp );
+    Z = ZTmp;
+    Identity( T, n, n );
+    Gemm( NORMAL, NORMAL, Field(-1), Z, YNew, Field(1), T );
+}
+
+template<typename Field>
+void
+NewtonSchulzStep
+( const DistMatrix<Field>& Y,
+        DistMatrix<Field>& Z,
+        DistMatrix<Field>& YNew,
+        DistMatrix<Field>& T,
+        DistMatrix<Field>& ZTmp )
+{
+    EL_DEBUG_CSE
+    const Int n = Y.Height();
+    ShiftDiagonal( T, Field(2) );
+    Gemm( NORMAL, NORMAL, Field(1)/Field(2), Y, T, YNew );
+    Gemm( NORMAL, NORMAL, Field(1)/Field(2), T, Z, ZTmp );
+    Z = ZTmp;
+    Identity( T, n, n );
+    Gemm( NORMAL, NORMAL, Field(-1), Z, YNew, Field(1), T );
+}
+
 template<typename Field>
 int
 Newton( Matrix<Field>& A, const SquareRootCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
     typedef Base<Field> Real;
-    Matrix<Field> B(A), C, XTmp;
+    Matrix<Field> B(A), C, XTmp, Z, T;
     Matrix<Field> *X=&B, *XNew=&C;
 
     Real tol = ctrl.tol;
@@ -75,25 +157,45 @@ Newton( Matrix<Field>& A, const SquareRootCtrl<Base<Field>>& ctrl )
         tol = A.Height()*limits::Epsilon<Real>();
 
     Int numIts=0;
+    bool newtonSchulz=false;
+    Real relDiff = limits::Infinity<Real>();
     while( numIts < ctrl.maxIts )
     {
+        // Switch to the inverse-free coupled Newton-Schulz iteration, starting
+        // from A inv(X), once it is guaranteed to converge
+        if( ctrl.newtonSchulz && !newtonSchulz &&
+            relDiff <= ctrl.newtonSchulzTol )
+        {
+            const Real bound = NewtonSchulzStart( A, *X, *XNew, Z, T );
+            if( bound <= ctrl.newtonSchulzTol )
+            {
+                newtonSchulz = true;
+                std::swap( X, XNew );
+            }
+        }
+
         // Overwrite XNew with the new iterate
-        NewtonStep( A, *X, *XNew, XTmp );
+        if( newtonSchulz )
+            NewtonSchulzStep( *X, Z, *XNew, T, XTmp );
+        else
+            NewtonStep( A, *X, *XNew, XTmp );
 
         // Use the difference in the iterates to test for convergence
         Axpy( Real(-1), *XNew, *X );
         const Real oneDiff = OneNorm( *X );
         const Real oneNew = OneNorm( *XNew );
+        relDiff = oneDiff/oneNew;
 
         // Ensure that X holds the current iterate and break if possible
         ++numIts;
         std::swap( X, XNew );
         if( ctrl.progress )
-            cout << "after " << numIts << " Newton iter's: "
-                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
-                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+            cout << "after " << numIts
+                 << ( newtonSchulz ? " Newton-Schulz" : " Newton" )
+                 << " iter's: oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << relDiff << ", tol="
                  << tol << endl;
-        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+        if( relDiff <= Pow(oneNew,ctrl.power)*tol )
             break;
     }
     if( X != &A )
@@ -113,7 +215,7 @@ Newton
 
     typedef Base<Field> Real;
     const Grid& g = A.Grid();
-    DistMatrix<Field> B(A), C(g), XTmp(g);
+    DistMatrix<Field> B(A), C(g), XTmp(g), Z(g), T(g);
     DistMatrix<Field> *X=&B, *XNew=&C;
 
     Real tol = ctrl.tol;
@@ -121,25 +223,45 @@ Newton
         tol = A.Height()*limits::Epsilon<Real>();
 
     Int numIts=0;
+    bool newtonSchulz=false;
+    Real relDiff = limits::Infinity<Real>();
     while( numIts < ctrl.maxIts )
     {
+        // Switch to the inverse-free coupled Newton-Schulz iteration, starting
+        // from A inv(X), once it is guaranteed to converge
+        if( ctrl.newtonSchulz && !newtonSchulz &&
+            relDiff <= ctrl.newtonSchulzTol )
+        {
+            const Real bound = NewtonSchulzStart( A, *X, *XNew, Z, T );
+            if( bound <= ctrl.newtonSchulzTol )
+            {
+                newtonSchulz = true;
+                std::swap( X, XNew );
+            }
+        }
+
         // Overwrite XNew with the new iterate
-        NewtonStep( A, *X, *XNew, XTmp );
+        if( newtonSchulz )
+            NewtonSchulzStep( *X, Z, *XNew, T, XTmp );
+        else
+            NewtonStep( A, *X, *XNew, XTmp );
 
         // Use the difference in the iterates to test for convergence
         Axpy( Real(-1), *XNew, *X );
         const Real oneDiff = OneNorm( *X );
         const Real oneNew = OneNorm( *XNew );
+        relDiff = oneDiff/oneNew;
 
         // Ensure that X holds the current iterate and break if possible
         ++numIts;
         std::swap( X, XNew );
         if( ctrl.progress && g.Rank() == 0 )
-            cout << "after " << numIts << " Newton iter's: "
-                 << "oneDiff=" << oneDiff << ", oneNew=" << oneNew
-                 << ", oneDiff/oneNew=" << oneDiff/oneNew << ", tol="
+            cout << "after " << numIts
+                 << ( newtonSchulz ? " Newton-Schulz" : " Newton" )
+                 << " iter's: oneDiff=" << oneDiff << ", oneNew=" << oneNew
+                 << ", oneDiff/oneNew=" << relDiff << ", tol="
                  << tol << endl;
-        if( oneDiff/oneNew <= Pow(oneNew,ctrl.power)*tol )
+        if( relDiff <= Pow(oneNew,ctrl.power)*tol )
             break;
     }
     if( X != &A )
@@ -12,203 +12,224 @@ namespace El {
 
 namespace {
 
+// Scale the (unit-length) counts and displacements of the metadata into a
+// separate buffer so that the cached metadata is never modified
+inline void ScaleCounts
+( const vector<int>& counts, Int length, vector<int>& scaledCounts )
+{
+    const int p = counts.size();
+    scaledCounts.resize( p );
+    for( int q=0; q<p; ++q )
+        scaledCounts[q] = counts[q]*length;
+}
+
+// When the permutation communicator is trivial, the rows (or columns) with
+// indices srcs[k] are moved into indices dests[k] in-place by following the
+// cycles of the permutation with a single row (or column) of workspace
+// rather than packing every moved row into send and recv buffers.
+template<typename T>
+void PermuteLocally
+(       Matrix<T>& A,
+        bool rows,
+  const vector<int>& dests,
+  const vector<int>& srcs )
+{
+    EL_DEBUG_CSE
+    const int numMoves = dests.size();
+    if( numMoves == 0 )
+        return;
+    const Int numLocal = ( rows ? A.Height() : A.Width() );
+    const Int length = ( rows ? A.Width() : A.Height() );
+    const Int entryStride = ( rows ? A.LDim() : 1 );
+    const Int vectorStride = ( rows ? 1 : A.LDim() );
+    T* ABuf = A.Buffer();
+
+    vector<int> movePos( numLocal, -1 );
+    for( int k=0; k<numMoves; ++k )
+        movePos[dests[k]] = k;
+
+    vector<T> work( length );
+    vector<bool> moved( numMoves, false );
+    for( int kStart=0; kStart<numMoves; ++kStart )
+    {
+        if( moved[kStart] )
+            continue;
+        const int dStart = dests[kStart];
+        StridedMemCopy
+        ( work.data(), 1, &ABuf[dStart*vectorStride], entryStride, length );
+        int k = kStart;
+        while( true )
+        {
+            moved[k] = true;
+            const int d = dests[k];
+            const int s = srcs[k];
+            if( s == dStart )
+            {
+                StridedMemCopy
+                ( &ABuf[d*vectorStride], entryStride, work.data(), 1, length );
+                break;
+            }
+            StridedMemCopy
+            ( &ABuf[d*vectorStride], entryStride,
+              &ABuf[s*vectorStride], entryStride, length );
+            k = movePos[s];
+            EL_DEBUG_ONLY(
+              if( k < 0 )
+                  LogicError("Permutation metadata was not a bijection");
+            )
+        }
+    }
+}
+
 template<typename T>
 void PermuteCols
 (       AbstractDistMatrix<T>& A,
-  const PermutationMeta& oldMeta,
+  const PermutationMeta& meta,
   bool inverse=false )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
-      if( A.RowComm() != oldMeta.comm )
+      if( A.RowComm() != meta.comm )
           LogicError("Invalid communicator in metadata");
-      if( A.RowAlign() != oldMeta.align )
+      if( A.RowAlign() != meta.align )
           LogicError("Invalid alignment in metadata");
     )
     if( A.Height() == 0 || A.Width() == 0 || !A.Participating() )
         return;
 
+    // The inverse permutation simply reverses the roles of the sends and
+    // recvs
+    const auto& sendIdx = ( inverse ? meta.recvIdx : meta.sendIdx );
+    const auto& sendRanks = ( inverse ? meta.recvRanks : meta.sendRanks );
+    const auto& recvIdx = ( inverse ? meta.sendIdx : meta.recvIdx );
+    const auto& recvRanks = ( inverse ? meta.sendRanks : meta.recvRanks );
+    if( mpi::Size(meta.comm) == 1 )
+    {
+        PermuteLocally( A.Matrix(), false, recvIdx, sendIdx );
+        return;
+    }
+
     T* ABuf = A.Buffer();
     const Int ALDim = A.LDim();
-
     const Int localHeight = A.LocalHeight();
-    PermutationMeta meta = oldMeta;
-    meta.ScaleUp( localHeight );
-
-    if( inverse )
+    vector<int> sendCounts, sendDispls, recvCounts, recvDispls;
+    ScaleCounts
+    ( inverse ? meta.recvCounts : meta.sendCounts, localHeight, sendCounts );
+    ScaleCounts
+    ( inverse ? meta.recvDispls : meta.sendDispls, localHeight, sendDispls );
+    ScaleCounts
+    ( inverse ? meta.sendCounts : meta.recvCounts, localHeight, recvCounts );
+    ScaleCounts
+    ( inverse ? meta.sendDispls : meta.recvDispls, localHeight, recvDispls );
+
+    // Fill vectors with the send data
+    auto offsets = sendDispls;
+    const int totalSend = sendCounts.back()+sendDispls.back();
+    vector<T> sendData;
+    FastResize( sendData, mpi::Pad(totalSend) );
+    const int numSends = sendIdx.size();
+    for( int send=0; send<numSends; ++send )
     {
-        // Fill vectors with the send data
-        auto offsets = meta.recvDispls;
-        const int totalSend = meta.TotalRecv();
-        vector<T> sendData;
-        FastResize( sendData, mpi::Pad(totalSend) );
-        const int numSends = meta.recvIdx.size();
-        for( int send=0; send<numSends; ++send )
-        {
-            const int jLoc = meta.recvIdx[send];
-            const int rank = meta.recvRanks[send];
-            MemCopy( &sendData[offsets[rank]], &ABuf[jLoc*ALDim], localHeight );
-            offsets[rank] += localHeight;
-        }
-
-        // Communicate all pivot rows
-        const int totalRecv = meta.TotalSend();
-        vector<T> recvData;
-        FastResize( recvData, mpi::Pad(totalRecv) );
-        mpi::AllToAll
-        ( sendData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          recvData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          meta.comm );
-
-        // Unpack the recv data
-        offsets = meta.sendDispls;
-        const int numRecvs = meta.sendIdx.size();
-        for( int recv=0; recv<numRecvs; ++recv )
-        {
-            const int jLoc = meta.sendIdx[recv];
-            const int rank = meta.sendRanks[recv];
-            MemCopy( &ABuf[jLoc*ALDim], &recvData[offsets[rank]], localHeight );
-            offsets[rank] += localHeight;
-        }
+        const int jLoc = sendIdx[send];
+        const int rank = sendRanks[send];
+        MemCopy( &sendData[offsets[rank]], &ABuf[jLoc*ALDim], localHeight );
+        offsets[rank] += localHeight;
     }
-    else
-    {
-        // Fill vectors with the send data
-        auto offsets = meta.sendDispls;
-        const int totalSend = meta.TotalSend();
-        vector<T> sendData;
-        FastResize( sendData, mpi::Pad(totalSend) );
-        const int numSends = meta.sendIdx.size();
-        for( int send=0; send<numSends; ++send )
-        {
-            const int jLoc = meta.sendIdx[send];
-            const int rank = meta.sendRanks[send];
-            MemCopy( &sendData[offsets[rank]], &ABuf[jLoc*ALDim], localHeight );
-            offsets[rank] += localHeight;
-        }
 
-        // Communicate all pivot rows
-        const int totalRecv = meta.TotalRecv();
-        vector<T> recvData;
-        FastResize( recvData, mpi::Pad(totalRecv) );
-        mpi::AllToAll
-        ( sendData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          recvData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          meta.comm );
-
-        // Unpack the recv data
-        offsets = meta.recvDispls;
-        const int numRecvs = meta.recvIdx.size();
-        for( int recv=0; recv<numRecvs; ++recv )
-        {
-            const int jLoc = meta.recvIdx[recv];
-            const int rank = meta.recvRanks[recv];
-            MemCopy( &ABuf[jLoc*ALDim], &recvData[offsets[rank]], localHeight );
-            offsets[rank] += localHeight;
-        }
+    // Communicate all pivot rows
+    const int totalRecv = recvCounts.back()+recvDispls.back();
+    vector<T> recvData;
+    FastResize( recvData, mpi::Pad(totalRecv) );
+    mpi::AllToAll
+    ( sendData.data(), sendCounts.data(), sendDispls.data(),
+      recvData.data(), recvCounts.data(), recvDispls.data(), meta.comm );
+
+    // Unpack the recv data
+    offsets = recvDispls;
+    const int numRecvs = recvIdx.size();
+    for( int recv=0; recv<numRecvs; ++recv )
+    {
+        const int jLoc = recvIdx[recv];
+        const int rank = recvRanks[recv];
+        MemCopy( &ABuf[jLoc*ALDim], &recvData[offsets[rank]], localHeight );
+        offsets[rank] += localHeight;
     }
 }
 
 template<typename T>
 void PermuteRows
 (       AbstractDistMatrix<T>& A,
-  const PermutationMeta& oldMeta,
+  const PermutationMeta& meta,
   bool inverse=false )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
-      if( A.ColComm() != oldMeta.comm )
+      if( A.ColComm() != meta.comm )
           LogicError("Invalid communicator in metadata");
-      if( A.ColAlign() != oldMeta.align )
+      if( A.ColAlign() != meta.align )
           LogicError("Invalid alignment in metadata");
     )
     if( A.Height() == 0 || A.Width() == 0 || !A.Participating() )
         return;
 
+    // The inverse permutation simply reverses the roles of the sends and
+    // recvs
+    const auto& sendIdx = ( inverse ? meta.recvIdx : meta.sendIdx );
+    const auto& sendRanks = ( inverse ? meta.recvRanks : meta.sendRanks );
+    const auto& recvIdx = ( inverse ? meta.sendIdx : meta.recvIdx );
+    const auto& recvRanks = ( inverse ? meta.sendRanks : meta.recvRanks );
+    if( mpi::Size(meta.comm) == 1 )
+    {
+        PermuteLocally( A.Matrix(), true, recvIdx, sendIdx );
+        return;
+    }
+
     T* ABuf = A.Buffer();
     const Int ALDim = A.LDim();
-
     const Int localWidth = A.LocalWidth();
-    PermutationMeta meta = oldMeta;
-    meta.ScaleUp( localWidth );
-
-    if( inverse )
+    vector<int> sendCounts, sendDispls, recvCounts, recvDispls;
+    ScaleCounts
+    ( inverse ? meta.recvCounts : meta.sendCounts, localWidth, sendCounts );
+    ScaleCounts
+    ( inverse ? meta.recvDispls : meta.sendDispls, localWidth, sendDispls );
+    ScaleCounts
+    ( inverse ? meta.sendCounts : meta.recvCounts, localWidth, recvCounts );
+    ScaleCounts
+    ( inverse ? meta.sendDispls : meta.recvDispls, localWidth, recvDispls );
+
+    // Fill vectors with the send data
+    auto offsets = sendDispls;
+    const int totalSend = sendCounts.back()+sendDispls.back();
+    vector<T> sendData;
+    FastResize( sendData, mpi::Pad(totalSend) );
+    const int numSends = sendIdx.size();
+    for( int send=0; send<numSends; ++send )
     {
-        // Fill vectors with the send data
-        auto offsets = meta.recvDispls;
-        const int totalSend = meta.TotalRecv();
-        vector<T> sendData;
-        FastResize( sendData, mpi::Pad(totalSend) );
-        const int numSends = meta.recvIdx.size();
-        for( int send=0; send<numSends; ++send )
-        {
-            const int iLoc = meta.recvIdx[send];
-            const int rank = meta.recvRanks[send];
-
-            StridedMemCopy
-            ( &sendData[offsets[rank]], 1, &ABuf[iLoc], ALDim, localWidth );
-            offsets[rank] += localWidth;
-        }
-
-        // Communicate all pivot rows
-        const int totalRecv = meta.TotalSend();
-        vector<T> recvData;
-        FastResize( recvData, mpi::Pad(totalRecv) );
-        mpi::AllToAll
-        ( sendData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          recvData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          meta.comm );
-
-        // Unpack the recv data
-        offsets = meta.sendDispls;
-        const int numRecvs = meta.sendIdx.size();
-        for( int recv=0; recv<numRecvs; ++recv )
-        {
-            const int iLoc = meta.sendIdx[recv];
-            const int rank = meta.sendRanks[recv];
-            StridedMemCopy
-            ( &ABuf[iLoc], ALDim, &recvData[offsets[rank]], 1,localWidth );
-            offsets[rank] += localWidth;
-        }
+        const int iLoc = sendIdx[send];
+        const int rank = sendRanks[send];
+        StridedMemCopy
+        ( &sendData[offsets[rank]], 1, &ABuf[iLoc], ALDim, localWidth );
+        offsets[rank] += localWidth;
     }
-    else
-    {
-        // Fill vectors with the send data
-        auto offsets = meta.sendDispls;
-        const int totalSend = meta.TotalSend();
-        vector<T> sendData;
-        FastResize( sendData, mpi::Pad(totalSend) );
-        const int numSends = meta.sendIdx.size();
-        for( int send=0; send<numSends; ++send )
-        {
-            const int iLoc = meta.sendIdx[send];
-            const int rank = meta.sendRanks[send];
 
-            StridedMemCopy
-            ( &sendData[offsets[rank]], 1, &ABuf[iLoc], ALDim, localWidth );
-            offsets[rank] += localWidth;
-        }
+    // Communicate all pivot rows
+    const int totalRecv = recvCounts.back()+recvDispls.back();
+    vector<T> recvData;
+    FastResize( recvData, mpi::Pad(totalRecv) );
+    mpi::AllToAll
+    ( sendData.data(), sendCounts.data(), sendDispls.data(),
+      recvData.data(), recvCounts.data(), recvDispls.data(), meta.comm );
 
-        // Communicate all pivot rows
-        const int totalRecv = meta.TotalRecv();
-        vector<T> recvData;
-        FastResize( recvData, mpi::Pad(totalRecv) );
-        mpi::AllToAll
-        ( sendData.data(), meta.sendCounts.data(), meta.sendDispls.data(),
-          recvData.data(), meta.recvCounts.data(), meta.recvDispls.data(),
-          meta.comm );
-
-        // Unpack the recv data
-        offsets = meta.recvDispls;
-        const int numRecvs = meta.recvIdx.size();
-        for( int recv=0; recv<numRecvs; ++recv )
-        {
-            const int iLoc = meta.recvIdx[recv];
-            const int rank = meta.recvRanks[recv];
-            StridedMemCopy
-            ( &ABuf[iLoc], ALDim, &recvData[offsets[rank]], 1,localWidth );
-            offsets[rank] += localWidth;
-        }
+    // Unpack the recv data
+    offsets = recvDispls;
+    const int numRecvs = recvIdx.size();
+    for( int recv=0; recv<numRecvs; ++recv )
+    {
+        const int iLoc = recvIdx[recv];
+        const int rank = recvRanks[recv];
+        StridedMemCopy
+        ( &ABuf[iLoc], ALDim, &recvData[offsets[rank]], 1, localWidth );
+        offsets[rank] += localWidth;
     }
 }
 
@@ -338,6 +359,7 @@ void DistPermutation::Empty()
 
     rowMeta_.clear();
     colMeta_.clear();
+    swapMeta_.clear();
     staleMeta_ = false;
 }
 
@@ -359,6 +381,7 @@ void DistPermutation::MakeIdentity( Int size )
 
     parity_ = false;
     staleParity_ = false;
+    staleMeta_ = true;
 
     numSwaps_ = 0;
     implicitSwapOrigins_ = true;
@@ -391,6 +414,7 @@ void DistPermutation::Swap( Int origin, Int dest )
 
     if( origin != dest )
         parity_ = !parity_;
+    staleMeta_ = true;
     if( swapSequence_ && numSwaps_ == swapDests_.Height() )
         MakeArbitrary();
     if( !swapSequence_ )
@@ -641,6 +665,7 @@ const DistPermutation& DistPermutation::operator=( const DistPermutation& P )
 
     colMeta_ = P.colMeta_;
     rowMeta_ = P.rowMeta_;
+    swapMeta_ = P.swapMeta_;
     staleMeta_ = P.staleMeta_;
 
     return *this;
@@ -720,6 +745,86 @@ const DistMatrix<Int,VC,STAR> DistPermutation::SwapDestinations() const
     return swapDests_(IR(0,numSwaps_),ALL);
 }
 
+const PermutationMeta&
+DistPermutation::SwapMeta( Int align, mpi::Comm comm, Int offset ) const
+{
+    EL_DEBUG_CSE
+    if( staleMeta_ )
+    {
+        rowMeta_.clear();
+        colMeta_.clear();
+        swapMeta_.clear();
+        staleMeta_ = false;
+    }
+    swapKeyType_ key = std::make_tuple(align,comm,offset);
+    auto data = swapMeta_.find( key );
+    if( data != swapMeta_.end() )
+        return data->second;
+
+    auto activeInd = IR(0,numSwaps_);
+    DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
+    DistMatrix<Int,STAR,STAR> origins_STAR_STAR( *grid_ );
+    if( !implicitSwapOrigins_ )
+        origins_STAR_STAR = swapOrigins_(activeInd,ALL);
+    auto& destsLoc = dests_STAR_STAR.Matrix();
+    auto& originsLoc = origins_STAR_STAR.Matrix();
+
+    // Compose the swaps so that index i of the result is drawn from index
+    // source[i] of the input
+    Int range = numSwaps_;
+    for( Int j=0; j<numSwaps_; ++j )
+    {
+        range = Max( range, destsLoc(j)+1 );
+        if( !implicitSwapOrigins_ )
+            range = Max( range, originsLoc(j)+1 );
+    }
+    vector<Int> source( range );
+    for( Int i=0; i<range; ++i )
+        source[i] = i;
+    for( Int j=0; j<numSwaps_; ++j )
+    {
+        const Int origin = ( implicitSwapOrigins_ ? j : originsLoc(j) );
+        std::swap( source[origin], source[destsLoc(j)] );
+    }
+
+    // Only the indices which are actually moved are communicated
+    PermutationMeta meta;
+    meta.align = align;
+    meta.comm = comm;
+    if( comm != mpi::COMM_NULL )
+    {
+        const int stride = mpi::Size( comm );
+        const int rank = mpi::Rank( comm );
+        const int shift = Shift( rank, align, stride );
+        meta.sendCounts.assign( stride, 0 );
+        meta.recvCounts.assign( stride, 0 );
+        for( Int i=0; i<range; ++i )
+        {
+            if( source[i] == i )
+                continue;
+            const Int dest = i + offset;
+            const Int origin = source[i] + offset;
+            const int destOwner = Mod( dest+align, stride );
+            const int originOwner = Mod( origin+align, stride );
+            if( originOwner == rank )
+            {
+                meta.sendIdx.push_back( (origin-shift) / stride );
+                meta.sendRanks.push_back( destOwner );
+                ++meta.sendCounts[destOwner];
+            }
+            if( destOwner == rank )
+            {
+                meta.recvIdx.push_back( (dest-shift) / stride );
+                meta.recvRanks.push_back( originOwner );
+                ++meta.recvCounts[originOwner];
+            }
+        }
+        Scan( meta.sendCounts, meta.sendDispls );
+        Scan( meta.recvCounts, meta.recvDispls );
+    }
+    return swapMeta_.insert( std::make_pair(key,meta) ).first->second;
+}
+
 template<typename T>
 void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
 {
@@ -732,37 +837,10 @@ void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
         if( height == 0 || width == 0 )
             return;
 
-        auto activeInd = IR(0,numSwaps_);
-
-        // TODO(poulson): Introduce an std::map for caching the pivots this
-        // process needs to care about to avoid redundant [STAR,STAR] formations
-        //
-        // TODO(poulson): Decide on the data structure; an std::vector of pivot
-        // origins and destinations?
-
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
+        // Rather than performing each swap as a separate exchange, apply the
+        // (cached) composition of the swaps with a single exchange
+        const auto& meta = SwapMeta( A.RowAlign(), A.RowComm(), offset );
+        El::PermuteCols( A, meta );
     }
     else
     {
@@ -774,6 +852,7 @@ void DistPermutation::PermuteCols( AbstractDistMatrix<T>& A, Int offset ) const
         {
             rowMeta_.clear();
             colMeta_.clear();
+            swapMeta_.clear();
             staleMeta_ = false;
         }
 
@@ -823,31 +902,10 @@ void DistPermutation::InversePermuteCols
         if( height == 0 || width == 0 )
             return;
 
-        auto activeInd = IR(0,numSwaps_);
-
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR( swapDests_(activeInd,ALL) );
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                ColSwap( A, origin, dest );
-            }
-        }
+        // Rather than performing each swap as a separate exchange, apply the
+        // (cached) composition of the swaps with a single exchange
+        const auto& meta = SwapMeta( A.RowAlign(), A.RowComm(), offset );
+        El::PermuteCols( A, meta, true );
     }
     else
     {
@@ -859,6 +917,7 @@ void DistPermutation::InversePermuteCols
         {
             rowMeta_.clear();
             colMeta_.clear();
+            swapMeta_.clear();
             staleMeta_ = false;
         }
 
@@ -907,31 +966,10 @@ void DistPermutation::PermuteRows( AbstractDistMatrix<T>& A, Int offset ) const
         if( height == 0 || width == 0 )
             return;
 
-        auto activeInd = IR(0,numSwaps_);
-
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR = swapDests_(activeInd,ALL);
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=0; j<numSwaps_; ++j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
+        // Rather than performing each swap as a separate exchange, apply the
+        // (cached) composition of the swaps with a single exchange
+        const auto& meta = SwapMeta( A.ColAlign(), A.ColComm(), offset );
+        El::PermuteRows( A, meta );
     }
     else
     {
@@ -943,6 +981,7 @@ void DistPermutation::PermuteRows( AbstractDistMatrix<T>& A, Int offset ) const
         {
             rowMeta_.clear();
             colMeta_.clear();
+            swapMeta_.clear();
             staleMeta_ = false;
         }
 
@@ -992,31 +1031,10 @@ void DistPermutation::InversePermuteRows
         if( height == 0 || width == 0 )
             return;
 
-        auto activeInd = IR(0,numSwaps_);
-
-        DistMatrix<Int,STAR,STAR> dests_STAR_STAR = swapDests_(activeInd,ALL);
-        auto& destsLoc = dests_STAR_STAR.Matrix();
-        if( implicitSwapOrigins_ )
-        {
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = j+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
-        else
-        {
-            DistMatrix<Int,STAR,STAR> origins_STAR_STAR =
-              swapOrigins_(activeInd,ALL);
-            auto& originsLoc = origins_STAR_STAR.Matrix();
-            for( Int j=numSwaps_-1; j>=0; --j )
-            {
-                const Int origin = originsLoc(j)+offset;
-                const Int dest = destsLoc(j)+offset;
-                El::RowSwap( A, origin, dest );
-            }
-        }
+        // Rather than performing each swap as a separate exchange, apply the
+        // (cached) composition of the swaps with a single exchange
+        const auto& meta = SwapMeta( A.ColAlign(), A.ColComm(), offset );
+        El::PermuteRows( A, meta, true );
     }
     else
     {
@@ -1028,6 +1046,7 @@ void DistPermutation::InversePermuteRows
         {
             rowMeta_.clear();
             colMeta_.clear();
+            swapMeta_.clear();
             staleMeta_ = false;
         }
 
@@ -1116,6 +1135,7 @@ void DistPermutation::PermuteSymmetrically
         {
             rowMeta_.clear();
             colMeta_.clear();
+            swapMeta_.clear();
             staleMeta_ = false;
         }
 
@@ -1181,6 +1201,7 @@ void DistPermutation::InversePermuteSymmetrically
         {
             rowMeta_.clear();
             colMeta_.clear();
+            swapMeta_.clear();
             staleMeta_ = false;
         }
 
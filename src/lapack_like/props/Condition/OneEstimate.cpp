@@ -0,0 +1,236 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// Estimate the one-norm of inv(A) from solves against the factors of A using
+// Hager's method, as refined in
+//
+//   N. J. Higham, "FORTRAN codes for estimating the one-norm of a real or
+//   complex matrix, with applications to condition estimation",
+//   ACM Trans. Math. Softw., 1988
+//
+// (which is the basis of LAPACK's {s,d,c,z}lacn2). Each iteration requires a
+// solve with A and a solve with A^H, and at most five iterations are run, so
+// the cost is a small multiple of that of a single solve. The result is a
+// lower bound on || inv(A) ||_1 which is rarely more than a factor of three
+// too small.
+
+namespace El {
+namespace cond_est {
+
+// Overwrite x with the vector with entries (-1)^i (1 + i/(n-1))
+template<typename Field>
+void AlternatingVector( Matrix<Field>& x, Int n )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    x.Resize( n, 1 );
+    for( Int i=0; i<n; ++i )
+    {
+        const Real mag = 1 + Real(i)/Real(n-1);
+        x(i) = ( i % 2 == 0 ? mag : -mag );
+    }
+}
+
+template<typename Field>
+void AlternatingVector( DistMatrix<Field>& x, Int n )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    x.Resize( n, 1 );
+    if( x.LocalWidth() == 0 )
+        return;
+    const Int localHeight = x.LocalHeight();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = x.GlobalRow(iLoc);
+        const Real mag = 1 + Real(i)/Real(n-1);
+        x.SetLocal( iLoc, 0, ( i % 2 == 0 ? mag : -mag ) );
+    }
+}
+
+// 'solve(orientation,X)' should overwrite X with inv(op(A)) X
+template<typename Field,class VectorType,class SolveType>
+Base<Field> InverseOneNormEstimate
+( Int n, VectorType& x, const SolveType& solve )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int maxIts = 5;
+    const Real infinity = limits::Infinity<Real>();
+    if( n == 0 )
+        return Real(0);
+
+    function<Field(const Field&)> sign =
+      []( const Field& alpha ) { return Phase( alpha, false ); };
+
+    Ones( x, n, 1 );
+    x *= Real(1)/Real(n);
+    solve( NORMAL, x );
+    Real estimate = OneNorm( x );
+    if( !limits::IsFinite(estimate) )
+        return infinity;
+    if( n == 1 )
+        return estimate;
+
+    VectorType xi( x ), z( x );
+    EntrywiseMap( xi, sign );
+    z = xi;
+    solve( ADJOINT, z );
+    auto zMax = VectorMaxAbsLoc( z );
+    for( Int it=1; it<maxIts; ++it )
+    {
+        // Apply inv(A) to the unit vector most likely to increase the norm
+        Zeros( x, n, 1 );
+        x.Set( zMax.index, 0, Field(1) );
+        solve( NORMAL, x );
+        const Real lastEstimate = estimate;
+        estimate = OneNorm( x );
+        if( !limits::IsFinite(estimate) )
+            return infinity;
+        if( estimate <= lastEstimate )
+        {
+            estimate = lastEstimate;
+            break;
+        }
+
+        // In the real case, a repeated sign vector implies convergence
+        VectorType xiNew( x );
+        EntrywiseMap( xiNew, sign );
+        if( !IsComplex<Field>::value )
+        {
+            z = xiNew;
+            z -= xi;
+            if( MaxNorm( z ) == Real(0) )
+                break;
+        }
+        xi = xiNew;
+
+        z = xi;
+        solve( ADJOINT, z );
+        const Int lastIndex = zMax.index;
+        zMax = VectorMaxAbsLoc( z );
+        if( Abs(z.Get(lastIndex,0)) == zMax.value )
+            break;
+    }
+
+    // Guard against the (rare) matrices for which the above fails badly
+    AlternatingVector( x, n );
+    solve( NORMAL, x );
+    const Real altEstimate = 2*OneNorm( x ) / (3*n);
+    if( !limits::IsFinite(altEstimate) )
+        return infinity;
+    return Max( estimate, altEstimate );
+}
+
+} // namespace cond_est
+
+namespace lu {
+
+template<typename Field>
+Base<Field> OneConditionEstimate
+( const Matrix<Field>& A,
+  const Permutation& P,
+  Base<Field> oneNormA )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    auto solve =
+      [&]( Orientation orientation, Matrix<Field>& X )
+      { lu::SolveAfter( orientation, A, P, X ); };
+    Matrix<Field> x;
+    return oneNormA*
+      cond_est::InverseOneNormEstimate<Field>( A.Height(), x, solve );
+}
+
+template<typename Field>
+Base<Field> OneConditionEstimate
+( const AbstractDistMatrix<Field>& A,
+  const DistPermutation& P,
+  Base<Field> oneNormA )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    auto solve =
+      [&]( Orientation orientation, DistMatrix<Field>& X )
+      { lu::SolveAfter( orientation, A, P, X ); };
+    DistMatrix<Field> x(A.Grid());
+    return oneNormA*
+      cond_est::InverseOneNormEstimate<Field>( A.Height(), x, solve );
+}
+
+} // namespace lu
+
+namespace cholesky {
+
+// Since inv(A) is Hermitian, solves with A and A^H coincide
+template<typename Field>
+Base<Field> OneConditionEstimate
+( UpperOrLower uplo,
+  const Matrix<Field>& A,
+  Base<Field> oneNormA )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    auto solve =
+      [&]( Orientation, Matrix<Field>& X )
+      { cholesky::SolveAfter( uplo, NORMAL, A, X ); };
+    Matrix<Field> x;
+    return oneNormA*
+      cond_est::InverseOneNormEstimate<Field>( A.Height(), x, solve );
+}
+
+template<typename Field>
+Base<Field> OneConditionEstimate
+( UpperOrLower uplo,
+  const AbstractDistMatrix<Field>& A,
+  Base<Field> oneNormA )
+{
+    EL_DEBUG_CSE
+    if( A.Height() != A.Width() )
+        LogicError("A must be square");
+    auto solve =
+      [&]( Orientation, DistMatrix<Field>& X )
+      { cholesky::SolveAfter( uplo, NORMAL, A, X ); };
+    DistMatrix<Field> x(A.Grid());
+    return oneNormA*
+      cond_est::InverseOneNormEstimate<Field>( A.Height(), x, solve );
+}
+
+} // namespace cholesky
+
+#define PROTO(Field) \
+  template Base<Field> lu::OneConditionEstimate \
+  ( const Matrix<Field>& A, \
+    const Permutation& P, \
+    Base<Field> oneNormA ); \
+  template Base<Field> lu::OneConditionEstimate \
+  ( const AbstractDistMatrix<Field>& A, \
+    const DistPermutation& P, \
+    Base<Field> oneNormA ); \
+  template Base<Field> cholesky::OneConditionEstimate \
+  ( UpperOrLower uplo, \
+    const Matrix<Field>& A, \
+    Base<Field> oneNormA ); \
+  template Base<Field> cholesky::OneConditionEstimate \
+  ( UpperOrLower uplo, \
+    const AbstractDistMatrix<Field>& A, \
+    Base<Field> oneNormA );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
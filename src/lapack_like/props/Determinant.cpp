@@ -10,6 +10,7 @@
 
 #include "./Determinant/Cholesky.hpp"
 #include "./Determinant/LUPartialPiv.hpp"
+#include "./Determinant/SparseLDL.hpp"
 
 namespace El {
 
@@ -29,6 +30,22 @@ SafeProduct<Field> SafeDeterminant( const AbstractDistMatrix<Field>& A )
     return det::LUPartialPiv( B );
 }
 
+template<typename Field>
+SafeProduct<Field> SafeDeterminant
+( const SparseLDLFactorization<Field>& sparseLDLFact )
+{
+    EL_DEBUG_CSE
+    return det::AfterSparseLDL( sparseLDLFact );
+}
+
+template<typename Field>
+SafeProduct<Field> SafeDeterminant
+( const DistSparseLDLFactorization<Field>& sparseLDLFact )
+{
+    EL_DEBUG_CSE
+    return det::AfterSparseLDL( sparseLDLFact );
+}
+
 template<typename Field>
 SafeProduct<Base<Field>> SafeHPDDeterminant
 ( UpperOrLower uplo, const Matrix<Field>& A )
@@ -188,6 +205,10 @@ Base<Field> HPDDeterminant
   ( Matrix<Field>& A, bool canOverwrite ); \
   template SafeProduct<Field> SafeDeterminant \
   ( AbstractDistMatrix<Field>& A, bool canOverwrite ); \
+  template SafeProduct<Field> SafeDeterminant \
+  ( const SparseLDLFactorization<Field>& sparseLDLFact ); \
+  template SafeProduct<Field> SafeDeterminant \
+  ( const DistSparseLDLFactorization<Field>& sparseLDLFact ); \
   template SafeProduct<Base<Field>> SafeHPDDeterminant \
   ( UpperOrLower uplo, const Matrix<Field>& A ); \
   template SafeProduct<Base<Field>> SafeHPDDeterminant \
@@ -0,0 +1,153 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_DETERMINANT_SPARSELDL_HPP
+#define EL_DETERMINANT_SPARSELDL_HPP
+
+namespace El {
+namespace det {
+
+// Accumulate the determinant of the quasi-diagonal D, with diagonal d and
+// (if pivoted) subdiagonal dSub, into rho exp(kappa scale)
+template<typename Field>
+void AccumulateQuasiDiagonal
+( const Matrix<Field>& d,
+  const Matrix<Field>& dSub,
+  bool pivoted,
+  bool conjugate,
+  Base<Field> scale,
+  Field& rho,
+  Base<Field>& kappa )
+{
+    typedef Base<Field> Real;
+    const Int n = d.Height();
+    for( Int i=0; i<n; ++i )
+    {
+        Field delta = d(i);
+        if( pivoted && i+1 < n && i < dSub.Height() && dSub(i) != Field(0) )
+        {
+            // A 2x2 pivot
+            const Field beta = dSub(i);
+            delta = d(i)*d(i+1) - beta*(conjugate ? Conj(beta) : beta);
+            ++i;
+        }
+        const Real alpha = Abs(delta);
+        if( alpha == Real(0) )
+        {
+            rho = 0;
+            continue;
+        }
+        rho *= delta/alpha;
+        kappa += Log(alpha)/scale;
+    }
+}
+
+template<typename Field>
+void AccumulateFronts
+( const ldl::Front<Field>& front,
+  Base<Field> scale,
+  Field& rho,
+  Base<Field>& kappa )
+{
+    EL_DEBUG_CSE
+    for( const auto& child : front.children )
+        AccumulateFronts( *child, scale, rho, kappa );
+    AccumulateQuasiDiagonal
+    ( front.diag, front.subdiag, PivotedFactorization(front.type),
+      front.isHermitian, scale, rho, kappa );
+}
+
+// Each process accumulates its own sequential subtree and its portions of
+// the distributed fronts
+template<typename Field>
+void AccumulateFronts
+( const ldl::DistFront<Field>& front,
+  Base<Field> scale,
+  Field& rho,
+  Base<Field>& kappa )
+{
+    EL_DEBUG_CSE
+    if( front.child == nullptr )
+    {
+        // The diagonal of this front is shared with the duplicate
+        AccumulateFronts( *front.duplicate, scale, rho, kappa );
+        return;
+    }
+    AccumulateFronts( *front.child, scale, rho, kappa );
+
+    if( PivotedFactorization(front.type) )
+    {
+        // The 2x2 pivots may straddle processes
+        DistMatrix<Field,STAR,STAR> d( front.diag ), dSub( front.subdiag );
+        if( front.diag.Grid().Rank() == 0 )
+            AccumulateQuasiDiagonal
+            ( d.LockedMatrix(), dSub.LockedMatrix(), true, front.isHermitian,
+              scale, rho, kappa );
+    }
+    else
+    {
+        Matrix<Field> dSub;
+        AccumulateQuasiDiagonal
+        ( front.diag.LockedMatrix(), dSub, false, front.isHermitian,
+          scale, rho, kappa );
+    }
+}
+
+template<typename Field>
+SafeProduct<Field> AfterSparseLDL
+( const SparseLDLFactorization<Field>& sparseLDLFact )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( !sparseLDLFact.Factored() )
+        LogicError("The sparse matrix has not been factored");
+    const auto& front = sparseLDLFact.Front();
+    if( BlockFactorization(front.type) )
+        LogicError("Block LDL factorizations do not retain D");
+    const auto& info = sparseLDLFact.NodeInfo();
+    const Int n = info.off + info.size;
+
+    SafeProduct<Field> det( n );
+    det.rho = 1;
+    AccumulateFronts( front, Real(n), det.rho, det.kappa );
+    if( det.rho == Field(0) )
+        det.kappa = 0;
+    return det;
+}
+
+template<typename Field>
+SafeProduct<Field> AfterSparseLDL
+( const DistSparseLDLFactorization<Field>& sparseLDLFact )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( !sparseLDLFact.Factored() )
+        LogicError("The sparse matrix has not been factored");
+    const auto& front = sparseLDLFact.Front();
+    if( BlockFactorization(front.type) )
+        LogicError("Block LDL factorizations do not retain D");
+    const auto& info = sparseLDLFact.NodeInfo();
+    const Int n = info.off + info.size;
+
+    Field localRho = 1;
+    Real localKappa = 0;
+    AccumulateFronts( front, Real(n), localRho, localKappa );
+
+    mpi::Comm comm = info.Grid().Comm();
+    SafeProduct<Field> det( n );
+    det.rho = mpi::AllReduce( localRho, mpi::PROD, comm );
+    det.kappa = mpi::AllReduce( localKappa, mpi::SUM, comm );
+    if( det.rho == Field(0) )
+        det.kappa = 0;
+    return det;
+}
+
+} // namespace det
+} // namespace El
+
+#endif // ifndef EL_DETERMINANT_SPARSELDL_HPP
@@ -0,0 +1,421 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace partial_spectrum {
+
+template<typename Field>
+Matrix<Field>& Local( Matrix<Field>& X ) { return X; }
+template<typename Field>
+Matrix<Field>& Local( DistMatrix<Field,VC,STAR>& X ) { return X.Matrix(); }
+
+template<typename Field>
+mpi::Comm Comm( const Matrix<Field>& X ) { return mpi::COMM_SELF; }
+template<typename Field>
+mpi::Comm Comm( const DistMatrix<Field,VC,STAR>& X ) { return X.ColComm(); }
+
+// Return sum_i w_i(0)^2 (theta_i)_+^{p/2} for the eigenpairs (theta_i,w_i) of
+// the symmetric tridiagonal matrix with diagonal d and subdiagonal e
+template<typename Real>
+Real Quadrature( const Matrix<Real>& d, const Matrix<Real>& e, Real p )
+{
+    EL_DEBUG_CSE
+    Matrix<Real> w, Q;
+    HermitianTridiagEig( d, e, w, Q );
+    Real sum = 0;
+    const Int n = w.Height();
+    for( Int i=0; i<n; ++i )
+        sum += Q(0,i)*Q(0,i)*Pow( Max(w(i),Real(0)), p/2 );
+    return sum;
+}
+
+// Estimate tr(B^{p/2}) for a dim x dim Hermitian positive semi-definite B,
+// applied as applyB(V,W), by running an independent Lanczos process from each
+// (normalized) Rademacher probe of a block
+template<typename Field,class VectorType,class ApplyType>
+Base<Field> TracePowerSLQ
+( Int dim,
+  Base<Field> p,
+  const ApplyType& applyB,
+  VectorType& V,
+  VectorType& VPrev,
+  VectorType& W,
+  const PartialSpectrumCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( ctrl.lanczosSteps < 1 || ctrl.blockSize < 1 || ctrl.maxProbes < 1 )
+        LogicError("The Lanczos steps, blocksize, and probes must be positive");
+    mpi::Comm comm = Comm( V );
+    const bool progress = ctrl.progress && mpi::Rank(comm) == 0;
+    const Real eps = limits::Epsilon<Real>();
+    const Int steps = Min( ctrl.lanczosSteps, dim );
+
+    Int numProbes = 0;
+    Real sum=0, sumSquares=0, estimate=0;
+    while( numProbes < ctrl.maxProbes )
+    {
+        const Int b = Min( ctrl.blockSize, ctrl.maxProbes-numProbes );
+        Rademacher( V, dim, b );
+        V *= Real(1)/Sqrt(Real(dim));
+        Zeros( VPrev, dim, b );
+
+        Matrix<Real> alpha, beta;
+        Zeros( alpha, steps, b );
+        Zeros( beta, steps, b );
+        vector<Int> length( b, steps );
+        Matrix<Field> dots;
+        Matrix<Real> norms;
+        for( Int j=0; j<steps; ++j )
+        {
+            applyB( V, W );
+            auto& VLoc = Local( V );
+            auto& VPrevLoc = Local( VPrev );
+            auto& WLoc = Local( W );
+            Zeros( dots, b, 1 );
+            for( Int c=0; c<b; ++c )
+                dots(c) = Dot( VLoc(ALL,IR(c)), WLoc(ALL,IR(c)) );
+            mpi::AllReduce( dots.Buffer(), b, comm );
+
+            Zeros( norms, b, 1 );
+            for( Int c=0; c<b; ++c )
+            {
+                auto v = VLoc( ALL, IR(c) );
+                auto w = WLoc( ALL, IR(c) );
+                alpha(j,c) = RealPart(dots(c));
+                Axpy( Field(-alpha(j,c)), v, w );
+                if( j > 0 )
+                    Axpy( Field(-beta(j-1,c)), VPrevLoc(ALL,IR(c)), w );
+                const Real localNorm = FrobeniusNorm( w );
+                norms(c) = localNorm*localNorm;
+            }
+            mpi::AllReduce( norms.Buffer(), b, comm );
+
+            VPrevLoc = VLoc;
+            for( Int c=0; c<b; ++c )
+            {
+                auto v = VLoc( ALL, IR(c) );
+                auto w = WLoc( ALL, IR(c) );
+                if( length[c] <= j )
+                {
+                    Zero( v );
+                    continue;
+                }
+                beta(j,c) = Sqrt(norms(c));
+                const Real scale =
+                  Max( Abs(alpha(j,c)), j > 0 ? beta(j-1,c) : Real(0) );
+                if( beta(j,c) <= eps*scale || j == steps-1 )
+                {
+                    // The Krylov subspace is (numerically) invariant
+                    length[c] = j+1;
+                    Zero( v );
+                }
+                else
+                {
+                    Copy( w, v );
+                    v *= Real(1)/beta(j,c);
+                }
+            }
+        }
+
+        for( Int c=0; c<b; ++c )
+        {
+            auto d = alpha( IR(0,length[c]), IR(c) );
+            auto e = beta( IR(0,length[c]-1), IR(c) );
+            const Real probeEstimate = dim*Quadrature( d, e, p );
+            sum += probeEstimate;
+            sumSquares += probeEstimate*probeEstimate;
+        }
+        numProbes += b;
+        estimate = sum / numProbes;
+        if( numProbes > 1 )
+        {
+            const Real variance =
+              Max( sumSquares-numProbes*estimate*estimate, Real(0) ) /
+              (numProbes-1);
+            const Real stdError = Sqrt(variance/numProbes);
+            if( progress )
+                Output
+                ("After ",numProbes," probes, the estimate was ",estimate,
+                 " with standard error ",stdError);
+            if( stdError <= ctrl.tol*estimate )
+                break;
+        }
+    }
+    return estimate;
+}
+
+template<typename Field>
+Base<Field> SchattenNormSLQ
+( const Matrix<Field>& A,
+  Base<Field> p,
+  const PartialSpectrumCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const bool tall = ( m >= n );
+    const Int dim = Min(m,n);
+    Matrix<Field> Y;
+    // B is A^H A for tall matrices and A A^H otherwise
+    auto applyB =
+      [&]( const Matrix<Field>& V, Matrix<Field>& W )
+      {
+          const Orientation first = ( tall ? NORMAL : ADJOINT );
+          const Orientation second = ( tall ? ADJOINT : NORMAL );
+          Zeros( Y, ( tall ? m : n ), V.Width() );
+          Gemm( first, NORMAL, Field(1), A, V, Field(0), Y );
+          Zeros( W, dim, V.Width() );
+          Gemm( second, NORMAL, Field(1), A, Y, Field(0), W );
+      };
+    Matrix<Field> V, VPrev, W;
+    const auto tracePower =
+      TracePowerSLQ<Field>( dim, p, applyB, V, VPrev, W, ctrl );
+    return Pow( tracePower, 1/p );
+}
+
+template<typename Field>
+Base<Field> SchattenNormSLQ
+( const AbstractDistMatrix<Field>& APre,
+  Base<Field> p,
+  const PartialSpectrumCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const bool tall = ( m >= n );
+    const Int dim = Min(m,n);
+    DistMatrix<Field,VC,STAR> Y(g);
+    auto applyB =
+      [&]( const DistMatrix<Field,VC,STAR>& V, DistMatrix<Field,VC,STAR>& W )
+      {
+          const Orientation first = ( tall ? NORMAL : ADJOINT );
+          const Orientation second = ( tall ? ADJOINT : NORMAL );
+          Zeros( Y, ( tall ? m : n ), V.Width() );
+          Gemm( first, NORMAL, Field(1), A, V, Field(0), Y );
+          Zeros( W, dim, V.Width() );
+          Gemm( second, NORMAL, Field(1), A, Y, Field(0), W );
+      };
+    DistMatrix<Field,VC,STAR> V(g), VPrev(g), W(g);
+    const auto tracePower =
+      TracePowerSLQ<Field>( dim, p, applyB, V, VPrev, W, ctrl );
+    return Pow( tracePower, 1/p );
+}
+
+// Whether the stochastic Lanczos quadrature would apply A to at least as
+// many vectors as it has columns (or rows)
+template<typename Real>
+bool PreferExactSchatten( Int minDim, const PartialSpectrumCtrl<Real>& ctrl )
+{ return ctrl.lanczosSteps*ctrl.blockSize >= minDim; }
+
+// Whether the randomized SVD would sample at least half of the columns
+template<typename Real>
+bool PreferExactKyFan
+( Int k, Int minDim, const PartialSpectrumCtrl<Real>& ctrl )
+{ return 2*(k+ctrl.oversampling) >= minDim; }
+
+template<typename Real>
+Real SchattenSum( const Matrix<Real>& s, Int k, Real p )
+{
+    Real sum = 0;
+    for( Int j=Min(k,s.Height())-1; j>=0; --j )
+        sum += Pow( s(j), p );
+    return Pow( sum, 1/p );
+}
+
+} // namespace partial_spectrum
+
+template<typename Field>
+Base<Field> KyFanSchattenNorm
+( const Matrix<Field>& A, Int k, Base<Field> p,
+  const PartialSpectrumCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int minDim = Min(A.Height(),A.Width());
+    if( k < 1 || k > minDim )
+        LogicError("Invalid index of KyFanSchatten norm");
+    if( partial_spectrum::PreferExactKyFan( k, minDim, ctrl ) )
+        return KyFanSchattenNorm( A, k, p );
+
+    RandomizedRangeCtrl rangeCtrl;
+    rangeCtrl.oversampling = ctrl.oversampling;
+    Matrix<Field> U, V;
+    Matrix<Real> s;
+    Real norm = 0;
+    for( Int its=0; its<=ctrl.maxPowerIts; ++its )
+    {
+        rangeCtrl.numPowerIts = its;
+        RandomizedSVD( A, U, s, V, k, rangeCtrl );
+        const Real newNorm = partial_spectrum::SchattenSum( s, k, p );
+        if( ctrl.progress )
+            Output(its," power iterations: norm estimate of ",newNorm);
+        const bool converged =
+          its > 0 && Abs(newNorm-norm) <= ctrl.tol*newNorm;
+        norm = newNorm;
+        if( converged )
+            break;
+    }
+    return norm;
+}
+
+template<typename Field>
+Base<Field> KyFanSchattenNorm
+( const AbstractDistMatrix<Field>& A, Int k, Base<Field> p,
+  const PartialSpectrumCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int minDim = Min(A.Height(),A.Width());
+    if( k < 1 || k > minDim )
+        LogicError("Invalid index of KyFanSchatten norm");
+    if( partial_spectrum::PreferExactKyFan( k, minDim, ctrl ) )
+        return KyFanSchattenNorm( A, k, p );
+
+    const Grid& g = A.Grid();
+    const bool progress = ctrl.progress && g.Rank() == 0;
+    RandomizedRangeCtrl rangeCtrl;
+    rangeCtrl.oversampling = ctrl.oversampling;
+    DistMatrix<Field> U(g), V(g);
+    DistMatrix<Real,STAR,STAR> s(g);
+    Real norm = 0;
+    for( Int its=0; its<=ctrl.maxPowerIts; ++its )
+    {
+        rangeCtrl.numPowerIts = its;
+        RandomizedSVD( A, U, s, V, k, rangeCtrl );
+        const Real newNorm =
+          partial_spectrum::SchattenSum( s.LockedMatrix(), k, p );
+        if( progress )
+            Output(its," power iterations: norm estimate of ",newNorm);
+        const bool converged =
+          its > 0 && Abs(newNorm-norm) <= ctrl.tol*newNorm;
+        norm = newNorm;
+        if( converged )
+            break;
+    }
+    return norm;
+}
+
+template<typename Field>
+Base<Field> KyFanNorm
+( const Matrix<Field>& A, Int k,
+  const PartialSpectrumCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return KyFanSchattenNorm( A, k, Base<Field>(1), ctrl );
+}
+
+template<typename Field>
+Base<Field> KyFanNorm
+( const AbstractDistMatrix<Field>& A, Int k,
+  const PartialSpectrumCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return KyFanSchattenNorm( A, k, Base<Field>(1), ctrl );
+}
+
+template<typename Field>
+Base<Field> TwoNorm
+( const Matrix<Field>& A, const PartialSpectrumCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return KyFanSchattenNorm( A, 1, Base<Field>(1), ctrl );
+}
+
+template<typename Field>
+Base<Field> TwoNorm
+( const AbstractDistMatrix<Field>& A,
+  const PartialSpectrumCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return KyFanSchattenNorm( A, 1, Base<Field>(1), ctrl );
+}
+
+template<typename Field>
+Base<Field> SchattenNorm
+( const Matrix<Field>& A, Base<Field> p,
+  const PartialSpectrumCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int minDim = Min(A.Height(),A.Width());
+    if( partial_spectrum::PreferExactSchatten( minDim, ctrl ) )
+        return SchattenNorm( A, p );
+    return partial_spectrum::SchattenNormSLQ( A, p, ctrl );
+}
+
+template<typename Field>
+Base<Field> SchattenNorm
+( const AbstractDistMatrix<Field>& A, Base<Field> p,
+  const PartialSpectrumCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int minDim = Min(A.Height(),A.Width());
+    if( partial_spectrum::PreferExactSchatten( minDim, ctrl ) )
+        return SchattenNorm( A, p );
+    return partial_spectrum::SchattenNormSLQ( A, p, ctrl );
+}
+
+template<typename Field>
+Base<Field> NuclearNorm
+( const Matrix<Field>& A, const PartialSpectrumCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return SchattenNorm( A, Base<Field>(1), ctrl );
+}
+
+template<typename Field>
+Base<Field> NuclearNorm
+( const AbstractDistMatrix<Field>& A,
+  const PartialSpectrumCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return SchattenNorm( A, Base<Field>(1), ctrl );
+}
+
+#define PROTO(Field) \
+  template Base<Field> KyFanSchattenNorm \
+  ( const Matrix<Field>& A, Int k, Base<Field> p, \
+    const PartialSpectrumCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> KyFanSchattenNorm \
+  ( const AbstractDistMatrix<Field>& A, Int k, Base<Field> p, \
+    const PartialSpectrumCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> KyFanNorm \
+  ( const Matrix<Field>& A, Int k, \
+    const PartialSpectrumCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> KyFanNorm \
+  ( const AbstractDistMatrix<Field>& A, Int k, \
+    const PartialSpectrumCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> TwoNorm \
+  ( const Matrix<Field>& A, \
+    const PartialSpectrumCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> TwoNorm \
+  ( const AbstractDistMatrix<Field>& A, \
+    const PartialSpectrumCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> SchattenNorm \
+  ( const Matrix<Field>& A, Base<Field> p, \
+    const PartialSpectrumCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> SchattenNorm \
+  ( const AbstractDistMatrix<Field>& A, Base<Field> p, \
+    const PartialSpectrumCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> NuclearNorm \
+  ( const Matrix<Field>& A, \
+    const PartialSpectrumCtrl<Base<Field>>& ctrl ); \
+  template Base<Field> NuclearNorm \
+  ( const AbstractDistMatrix<Field>& A, \
+    const PartialSpectrumCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,350 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace trace_est {
+
+// Adapters which allow the estimators to be written once for both the
+// sequential and distributed operators, with all of the dense work performed
+// on the local rows of the probes
+
+template<typename Field>
+Matrix<Field>& Local( Matrix<Field>& X ) { return X; }
+template<typename Field>
+const Matrix<Field>& Local( const Matrix<Field>& X ) { return X; }
+template<typename Field>
+Matrix<Field>& Local( DistMultiVec<Field>& X ) { return X.Matrix(); }
+template<typename Field>
+const Matrix<Field>& Local( const DistMultiVec<Field>& X )
+{ return X.LockedMatrix(); }
+
+template<typename Field>
+void Shape( const LinearOperator<Field>& M, Int width, Matrix<Field>& Z )
+{ Zeros( Z, M.Height(), width ); }
+
+template<typename Field>
+void Shape
+( const DistLinearOperator<Field>& M, Int width, DistMultiVec<Field>& Z )
+{
+    Z.SetGrid( M.Grid() );
+    Zeros( Z, M.Height(), width );
+}
+
+template<typename Field,class OperatorType,class VectorType>
+void Probes( const OperatorType& M, Int width, VectorType& Z )
+{
+    Shape( M, width, Z );
+    auto& ZLoc = Local( Z );
+    Rademacher( ZLoc, ZLoc.Height(), width );
+}
+
+// Set the local rows of Z to those of the (row-distributed) X
+template<typename Field,class OperatorType,class VectorType>
+void SetLocal( const OperatorType& M, const Matrix<Field>& X, VectorType& Z )
+{
+    Shape( M, X.Width(), Z );
+    Local( Z ) = X;
+}
+
+template<typename Field>
+void Apply
+( const LinearOperator<Field>& M, const Matrix<Field>& X, Matrix<Field>& Y )
+{ M( X, Y ); }
+
+template<typename Field>
+void Apply
+( const DistLinearOperator<Field>& M,
+  const DistMultiVec<Field>& X,
+        DistMultiVec<Field>& Y )
+{
+    Y.SetGrid( M.Grid() );
+    M( X, Y );
+}
+
+template<typename Field>
+mpi::Comm Comm( const LinearOperator<Field>& M ) { return mpi::COMM_SELF; }
+template<typename Field>
+mpi::Comm Comm( const DistLinearOperator<Field>& M )
+{ return M.Grid().Comm(); }
+
+// Return sum_j X(:,j)^H Y(:,j)
+template<typename Field>
+Field ColumnDotSum
+( const Matrix<Field>& X, const Matrix<Field>& Y, mpi::Comm comm )
+{
+    Field localSum = 0;
+    const Int width = X.Width();
+    for( Int j=0; j<width; ++j )
+        localSum += Dot( X(ALL,IR(j)), Y(ALL,IR(j)) );
+    return mpi::AllReduce( localSum, comm );
+}
+
+// Overwrite the (row-distributed) Q with an orthonormal basis for its range.
+// The Gram matrix is eigendecomposed (rather than Cholesky factored) so that
+// numerically rank-deficient sketches are truncated, and a second pass
+// restores the orthogonality lost to squaring the condition number.
+template<typename Field>
+void Orthonormalize( Matrix<Field>& Q, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    for( Int pass=0; pass<2; ++pass )
+    {
+        const Int k = Q.Width();
+        if( k == 0 )
+            return;
+        Matrix<Field> G;
+        Zeros( G, k, k );
+        Gemm( ADJOINT, NORMAL, Field(1), Q, Q, Field(0), G );
+        mpi::AllReduce( G.Buffer(), k*k, comm );
+
+        Matrix<Real> w;
+        Matrix<Field> V;
+        HermitianEig( LOWER, G, w, V );
+        const Real tol = k*limits::Epsilon<Real>()*Max(w(k-1),Real(0));
+        Int rank = 0;
+        for( Int j=k-1; j>=0 && w(j) > tol; --j )
+            ++rank;
+        if( rank == 0 )
+        {
+            Q.Resize( Q.Height(), 0 );
+            return;
+        }
+        auto VKeep = V( ALL, IR(k-rank,k) );
+        for( Int j=0; j<rank; ++j )
+        {
+            auto v = VKeep( ALL, IR(j) );
+            v *= Real(1)/Sqrt(w(k-rank+j));
+        }
+        Matrix<Field> QNew;
+        Zeros( QNew, Q.Height(), rank );
+        Gemm( NORMAL, NORMAL, Field(1), Q, VKeep, Field(0), QNew );
+        Q = QNew;
+    }
+}
+
+// Overwrite Z with (I - Q Q^H) Z
+template<typename Field>
+void Project( const Matrix<Field>& Q, Matrix<Field>& Z, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int k = Q.Width();
+    const Int width = Z.Width();
+    if( k == 0 || width == 0 )
+        return;
+    Matrix<Field> C;
+    Zeros( C, k, width );
+    Gemm( ADJOINT, NORMAL, Field(1), Q, Z, Field(0), C );
+    mpi::AllReduce( C.Buffer(), k*width, comm );
+    Gemm( NORMAL, NORMAL, Field(-1), Q, C, Field(1), Z );
+}
+
+template<typename Field,class OperatorType,class VectorType>
+Field Trace
+( const OperatorType& M,
+  const TraceEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( M.Height() != M.Width() )
+        LogicError("Cannot estimate the trace of a nonsquare operator");
+    if( ctrl.numProbes <= 0 || ctrl.blockSize <= 0 )
+        LogicError("The number of probes and blocksize must be positive");
+    mpi::Comm comm = Comm( M );
+    const bool progress = ctrl.progress && mpi::Rank(comm) == 0;
+
+    // Deflate the dominant range of M using a third of the probes
+    const Int numSketch = ( ctrl.deflate ? ctrl.numProbes/3 : 0 );
+    const Int numSamples = ctrl.numProbes - 2*numSketch;
+    VectorType S, Y;
+    Field deflatedTrace = 0;
+    Matrix<Field> Q;
+    if( numSketch > 0 )
+    {
+        Probes<Field>( M, numSketch, S );
+        Apply( M, S, Y );
+        Q = Local( Y );
+        Orthonormalize( Q, comm );
+
+        // Reuse S for the basis of the sketch
+        SetLocal<Field>( M, Q, S );
+        Apply( M, S, Y );
+        deflatedTrace = ColumnDotSum( Q, Local(Y), comm );
+        if( progress )
+            Output
+            ("Deflated a rank-",Q.Width()," sketch with trace ",
+             deflatedTrace);
+    }
+
+    Field sampleSum = 0;
+    for( Int offset=0; offset<numSamples; offset+=ctrl.blockSize )
+    {
+        const Int width = Min( ctrl.blockSize, numSamples-offset );
+        Probes<Field>( M, width, S );
+        Project( Q, Local(S), comm );
+        Apply( M, S, Y );
+        sampleSum += ColumnDotSum( Local(S), Local(Y), comm );
+        if( progress )
+            Output
+            ("After ",offset+width," samples, the trace estimate is ",
+             deflatedTrace+sampleSum/Base<Field>(offset+width));
+    }
+    if( numSamples == 0 )
+        return deflatedTrace;
+    return deflatedTrace + sampleSum/Base<Field>(numSamples);
+}
+
+template<typename Field,class OperatorType,class VectorType>
+void Diagonal
+( const OperatorType& M,
+        VectorType& d,
+  const TraceEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( M.Height() != M.Width() )
+        LogicError("Cannot estimate the diagonal of a nonsquare operator");
+    if( ctrl.numProbes <= 0 || ctrl.blockSize <= 0 )
+        LogicError("The number of probes and blocksize must be positive");
+
+    VectorType Z, Y;
+    Shape( M, 1, d );
+    auto& dLoc = Local( d );
+    const Int localHeight = dLoc.Height();
+    for( Int offset=0; offset<ctrl.numProbes; offset+=ctrl.blockSize )
+    {
+        const Int width = Min( ctrl.blockSize, ctrl.numProbes-offset );
+        Probes<Field>( M, width, Z );
+        Apply( M, Z, Y );
+        const auto& ZLoc = Local( Z );
+        const auto& YLoc = Local( Y );
+        for( Int j=0; j<width; ++j )
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                dLoc(iLoc) += ZLoc(iLoc,j)*YLoc(iLoc,j);
+    }
+    dLoc *= Base<Field>(1)/Base<Field>(ctrl.numProbes);
+}
+
+} // namespace trace_est
+
+template<typename Field>
+Field EstimateTrace
+( const LinearOperator<Field>& M,
+  const TraceEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return trace_est::Trace<Field,LinearOperator<Field>,Matrix<Field>>
+    ( M, ctrl );
+}
+
+template<typename Field>
+Field EstimateTrace
+( const DistLinearOperator<Field>& M,
+  const TraceEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return trace_est::Trace<Field,DistLinearOperator<Field>,
+                            DistMultiVec<Field>>( M, ctrl );
+}
+
+template<typename Field>
+void EstimateDiagonal
+( const LinearOperator<Field>& M,
+        Matrix<Field>& d,
+  const TraceEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    trace_est::Diagonal<Field>( M, d, ctrl );
+}
+
+template<typename Field>
+void EstimateDiagonal
+( const DistLinearOperator<Field>& M,
+        DistMultiVec<Field>& d,
+  const TraceEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    trace_est::Diagonal<Field>( M, d, ctrl );
+}
+
+template<typename Field>
+Field EstimateTrace
+( const SparseLDLFactorization<Field>& sparseLDLFact,
+  const SparseMatrix<Field>& dA,
+  const TraceEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    LinearOperator<Field> M
+    ( dA.Height(), dA.Width(),
+      [&]( Orientation,
+           Field alpha, const Matrix<Field>& X,
+           Field beta,        Matrix<Field>& Y )
+      {
+          Matrix<Field> Z;
+          Zeros( Z, dA.Height(), X.Width() );
+          Multiply( NORMAL, alpha, dA, X, Field(0), Z );
+          sparseLDLFact.Solve( Z );
+          Y *= beta;
+          Y += Z;
+      } );
+    return EstimateTrace( M, ctrl );
+}
+
+template<typename Field>
+Field EstimateTrace
+( const DistSparseLDLFactorization<Field>& sparseLDLFact,
+  const DistSparseMatrix<Field>& dA,
+  const TraceEstimateCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = dA.Grid();
+    DistLinearOperator<Field> M
+    ( dA.Height(), dA.Width(), grid,
+      [&]( Orientation,
+           Field alpha, const DistMultiVec<Field>& X,
+           Field beta,        DistMultiVec<Field>& Y )
+      {
+          DistMultiVec<Field> Z(grid);
+          Zeros( Z, dA.Height(), X.Width() );
+          Multiply( NORMAL, alpha, dA, X, Field(0), Z );
+          sparseLDLFact.Solve( Z );
+          Y *= beta;
+          Y += Z;
+      } );
+    return EstimateTrace( M, ctrl );
+}
+
+#define PROTO(Field) \
+  template Field EstimateTrace \
+  ( const LinearOperator<Field>& M, \
+    const TraceEstimateCtrl<Base<Field>>& ctrl ); \
+  template Field EstimateTrace \
+  ( const DistLinearOperator<Field>& M, \
+    const TraceEstimateCtrl<Base<Field>>& ctrl ); \
+  template void EstimateDiagonal \
+  ( const LinearOperator<Field>& M, \
+          Matrix<Field>& d, \
+    const TraceEstimateCtrl<Base<Field>>& ctrl ); \
+  template void EstimateDiagonal \
+  ( const DistLinearOperator<Field>& M, \
+          DistMultiVec<Field>& d, \
+    const TraceEstimateCtrl<Base<Field>>& ctrl ); \
+  template Field EstimateTrace \
+  ( const SparseLDLFactorization<Field>& sparseLDLFact, \
+    const SparseMatrix<Field>& dA, \
+    const TraceEstimateCtrl<Base<Field>>& ctrl ); \
+  template Field EstimateTrace \
+  ( const DistSparseLDLFactorization<Field>& sparseLDLFact, \
+    const DistSparseMatrix<Field>& dA, \
+    const TraceEstimateCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
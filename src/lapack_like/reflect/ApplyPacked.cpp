@@ -25,9 +25,32 @@
 #include "./ApplyPacked/RUHF.hpp"
 #include "./ApplyPacked/RUVB.hpp"
 #include "./ApplyPacked/RUVF.hpp"
+#include "./ApplyPacked/LVPipelined.hpp"
 
 namespace El {
 
+namespace {
+Int packedReflectorsAggregation = 1;
+bool packedReflectorsPipelining = false;
+}
+
+void SetApplyPackedReflectorsAggregation( Int numPanels )
+{
+    EL_DEBUG_CSE
+    if( numPanels < 1 )
+        LogicError("Must aggregate at least one panel");
+    packedReflectorsAggregation = numPanels;
+}
+
+Int ApplyPackedReflectorsAggregation()
+{ return packedReflectorsAggregation; }
+
+void SetApplyPackedReflectorsPipelining( bool pipeline )
+{ packedReflectorsPipelining = pipeline; }
+
+bool ApplyPackedReflectorsPipelining()
+{ return packedReflectorsPipelining; }
+
 template<typename F> 
 void ApplyPackedReflectors
 ( LeftOrRight side, UpperOrLower uplo, 
@@ -118,6 +141,13 @@ void ApplyPackedReflectors
         AbstractDistMatrix<F>& A )
 {
     EL_DEBUG_CSE
+    if( side == LEFT && dir == VERTICAL && ApplyPackedReflectorsPipelining() &&
+        A.Width() >= Blocksize() )
+    {
+        apply_packed_reflectors::LVPipelined
+        ( uplo, order, conjugation, offset, H, householderScalars, A );
+        return;
+    }
     if( side == LEFT )
     {
         if( uplo == LOWER )
@@ -0,0 +1,161 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_APPLYPACKEDREFLECTORS_LVPIPELINED_HPP
+#define EL_APPLYPACKEDREFLECTORS_LVPIPELINED_HPP
+
+namespace El {
+namespace apply_packed_reflectors {
+
+//
+// A pipelined version of the distributed LLVF, LLVB, LUVF, and LUVB
+// algorithms. Since the explicit Householder vectors and the triangular
+// matrix of each UT transform only depend upon H, those of the next panel
+// are formed as soon as the current panel's reflectors have been applied to
+// form Z := HPan' A, and the [MC,* ] broadcast of the next panel's
+// reflectors then proceeds in the background of the remainder of the
+// current panel's application (the reduction of Z, the triangular solve,
+// and the rank-nb update of A).
+//
+
+template<typename F>
+void LVPipelined
+( UpperOrLower uplo,
+  ForwardOrBackward order,
+  Conjugation conjugation,
+  Int offset,
+  const AbstractDistMatrix<F>& H,
+  const AbstractDistMatrix<F>& householderScalarsPre,
+        AbstractDistMatrix<F>& APre )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( H.Height() != APre.Height() )
+          LogicError("H and A must have the same height");
+      AssertSameGrids( H, householderScalarsPre, APre );
+    )
+
+    DistMatrixReadProxy<F,F,MC,STAR>
+      householderScalarsProx( householderScalarsPre );
+    auto& householderScalars = householderScalarsProx.GetLocked();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    const Int m = H.Height();
+    const Int diagLength = H.DiagonalLength(offset);
+    EL_DEBUG_ONLY(
+      if( householderScalars.Height() != diagLength )
+          LogicError
+          ("householderScalars must be the same length as H's offset diag");
+    )
+    const Grid& g = H.Grid();
+    auto HPan = unique_ptr<AbstractDistMatrix<F>>( H.Construct(g,H.Root()) );
+    DistMatrix<F> HPanCopy(g);
+    DistMatrix<F,VC,  STAR> HPan_VC_STAR(g);
+    DistMatrix<F,MC,  STAR> HPan_MC_STAR(g), HPanNext_MC_STAR(g);
+    DistMatrix<F,STAR,STAR> householderScalars1_STAR_STAR(g),
+                            SInv_STAR_STAR(g), SInvNext_STAR_STAR(g);
+    DistMatrix<F,STAR,MR  > Z_STAR_MR(g);
+    DistMatrix<F,STAR,VR  > Z_STAR_VR(g);
+    CopyRequest<F> HPanRequest;
+
+    const Int iOff = ( offset>=0 ? 0      : -offset );
+    const Int jOff = ( offset>=0 ? offset : 0       );
+
+    // Applying the reflectors in forward order leads to a lower-triangular
+    // UT transform matrix, whereas backward order leads to an upper one
+    const UpperOrLower SInvUplo = ( order == FORWARD ? LOWER : UPPER );
+
+    const Int bsize = PackedReflectorsBlocksize();
+    const Int kLast = LastOffset( diagLength, bsize );
+    const Int numPanels = ( diagLength > 0 ? kLast/bsize+1 : 0 );
+    auto panelOffset =
+      [&]( Int step )
+      { return order==FORWARD ? step*bsize : kLast-step*bsize; };
+    // The rows of A which are modified by the panel beginning at index k
+    auto panelRows =
+      [&]( Int k, Int nb )
+      { return uplo==LOWER ? IR(k+iOff,m) : IR(0,k+iOff+nb); };
+
+    // Form the explicit reflectors and UT transform matrix of the panel
+    // beginning at index k and start broadcasting the former
+    auto startPanel =
+      [&]( Int k )
+      {
+          const Int nb = Min(bsize,diagLength-k);
+          const Int kj = k+jOff;
+          const IR rows = panelRows( k, nb );
+
+          LockedView( *HPan, H, rows, IR(kj,kj+nb) );
+          Copy( *HPan, HPanCopy );
+          if( uplo == LOWER )
+          {
+              MakeTrapezoidal( LOWER, HPanCopy );
+              FillDiagonal( HPanCopy, F(1) );
+          }
+          else
+          {
+              const Int diagOff = HPanCopy.Width()-HPanCopy.Height();
+              MakeTrapezoidal( UPPER, HPanCopy, diagOff );
+              FillDiagonal( HPanCopy, F(1), diagOff );
+          }
+
+          HPan_VC_STAR = HPanCopy;
+          Zeros( SInvNext_STAR_STAR, nb, nb );
+          Herk
+          ( SInvUplo, ADJOINT,
+            Base<F>(1), HPan_VC_STAR.LockedMatrix(),
+            Base<F>(0), SInvNext_STAR_STAR.Matrix() );
+          El::AllReduce( SInvNext_STAR_STAR, HPan_VC_STAR.ColComm() );
+          householderScalars1_STAR_STAR = householderScalars( IR(k,k+nb), ALL );
+          FixDiagonal
+          ( conjugation, householderScalars1_STAR_STAR, SInvNext_STAR_STAR );
+
+          HPanNext_MC_STAR.AlignWith( A( rows, ALL ) );
+          CopyAsync( HPanCopy, HPanNext_MC_STAR, HPanRequest );
+      };
+
+    if( numPanels > 0 )
+        startPanel( panelOffset(0) );
+    for( Int step=0; step<numPanels; ++step )
+    {
+        const Int k = panelOffset( step );
+        const Int nb = Min(bsize,diagLength-k);
+        auto ARows = A( panelRows(k,nb), ALL );
+
+        HPanRequest.Wait();
+        HPan_MC_STAR.AlignWith( ARows );
+        HPan_MC_STAR = HPanNext_MC_STAR;
+        SInv_STAR_STAR = SInvNext_STAR_STAR;
+
+        // Z := HPan' ARows
+        Z_STAR_MR.AlignWith( ARows );
+        LocalGemm( ADJOINT, NORMAL, F(1), HPan_MC_STAR, ARows, Z_STAR_MR );
+
+        if( step+1 < numPanels )
+            startPanel( panelOffset(step+1) );
+
+        Z_STAR_VR.AlignWith( ARows );
+        Contract( Z_STAR_MR, Z_STAR_VR );
+
+        // Z := inv(SInv) HPan' ARows
+        LocalTrsm
+        ( LEFT, SInvUplo, NORMAL, NON_UNIT, F(1), SInv_STAR_STAR, Z_STAR_VR );
+
+        // ARows := (I - HPan inv(SInv) HPan') ARows = ARows - HPan Z
+        Z_STAR_MR = Z_STAR_VR;
+        LocalGemm
+        ( NORMAL, NORMAL, F(-1), HPan_MC_STAR, Z_STAR_MR, F(1), ARows );
+    }
+}
+
+} // namespace apply_packed_reflectors
+} // namespace El
+
+#endif // ifndef EL_APPLYPACKEDREFLECTORS_LVPIPELINED_HPP
@@ -11,6 +11,10 @@
 
 namespace El {
 
+// The number of reflectors aggregated into each compact-WY block
+inline Int PackedReflectorsBlocksize()
+{ return Blocksize()*ApplyPackedReflectorsAggregation(); }
+
 template<typename F> 
 void FixDiagonal
 ( Conjugation conjugation,
@@ -106,6 +106,26 @@ void HPDSolve
     sparseLDLFact.Solve( B );
 }
 
+template<typename Field>
+void HPDSolve( const BandMatrix<Field>& A, Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    BandFactorization<Field> factorization;
+    const bool hermitian = true;
+    factorization.Factor( A, hermitian );
+    factorization.Solve( B );
+}
+
+template<typename Field>
+void HPDSolve( const DistBandMatrix<Field>& A, DistMultiVec<Field>& B )
+{
+    EL_DEBUG_CSE
+    DistBandFactorization<Field> factorization;
+    const bool hermitian = true;
+    factorization.Factor( A, hermitian );
+    factorization.Solve( B );
+}
+
 #define PROTO(Field) \
   template void hpd_solve::Overwrite \
   ( UpperOrLower uplo, Orientation orientation, \
@@ -123,7 +143,11 @@ void HPDSolve
   ( const SparseMatrix<Field>& A, Matrix<Field>& B, const BisectCtrl& ctrl ); \
   template void HPDSolve \
   ( const DistSparseMatrix<Field>& A, DistMultiVec<Field>& B, \
-    const BisectCtrl& ctrl );
+    const BisectCtrl& ctrl ); \
+  template void HPDSolve \
+  ( const BandMatrix<Field>& A, Matrix<Field>& B ); \
+  template void HPDSolve \
+  ( const DistBandMatrix<Field>& A, DistMultiVec<Field>& B );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
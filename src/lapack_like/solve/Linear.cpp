@@ -8,6 +8,8 @@
 */
 #include <El.hpp>
 
+#include "./Linear/GMRESIR.hpp"
+
 namespace El {
 
 namespace lu {
@@ -267,17 +269,16 @@ void LinearSolve
     if( scalapack )
     {
 #ifdef EL_HAVE_SCALAPACK
-        ProxyCtrl proxyCtrl;
-        proxyCtrl.colConstrain = true;
-        proxyCtrl.rowConstrain = true;
-        proxyCtrl.blockHeight = DefaultBlockHeight();
-        proxyCtrl.blockWidth = DefaultBlockWidth();
-        proxyCtrl.colAlign = 0;
-        proxyCtrl.rowAlign = 0;
-        proxyCtrl.colCut = 0;
-        proxyCtrl.rowCut = 0;
+        // A and B are used in place when their blockings are compatible
+        const auto proxyCtrl =
+          ScaLAPACKProxyCtrl
+          ( A, DefaultBlockHeight(), DefaultBlockHeight(), true );
+        auto BProxyCtrl = ScaLAPACKProxyCtrl( B, proxyCtrl.blockHeight );
+        BProxyCtrl.blockHeight = proxyCtrl.blockHeight;
+        BProxyCtrl.colAlign = proxyCtrl.colAlign;
         DistMatrixReadProxy<Field,Field,MC,MR,BLOCK> AProx( A, proxyCtrl );
-        DistMatrixReadWriteProxy<Field,Field,MC,MR,BLOCK> BProx( B, proxyCtrl );
+        DistMatrixReadWriteProxy<Field,Field,MC,MR,BLOCK>
+          BProx( B, BProxyCtrl );
         auto& ABlock = AProx.GetLocked();
         auto& BBlock = BProx.Get();
         lin_solve::ScaLAPACKHelper( ABlock, BBlock );
@@ -293,6 +294,57 @@ void LinearSolve
     lin_solve::Overwrite( ACopy, B );
 }
 
+template<typename Field>
+void LinearSolve
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const LinearSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.mixedPrecision && !IsSame<Demote<Field>,Field>::value )
+    {
+        Matrix<Field> X( B );
+        if( lin_solve::MixedPrecisionOverwrite( A, X, ctrl ) )
+        {
+            B = X;
+            return;
+        }
+        if( ctrl.progress )
+            Output("Falling back to a working-precision LU factorization");
+    }
+    LinearSolve( A, B );
+}
+
+template<typename Field>
+void LinearSolve
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& BPre,
+  const LinearSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.mixedPrecision && !IsSame<Demote<Field>,Field>::value )
+    {
+        DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+        DistMatrixReadWriteProxy<Field,Field,MC,MR> BProx( BPre );
+        auto& A = AProx.GetLocked();
+        auto& B = BProx.Get();
+
+        DistMatrix<Field> X( B );
+        if( lin_solve::MixedPrecisionOverwrite( A, X, ctrl ) )
+        {
+            B = X;
+            return;
+        }
+        if( ctrl.progress && A.Grid().Rank() == 0 )
+            Output("Falling back to a working-precision LU factorization");
+        DistMatrix<Field> ACopy( A );
+        lin_solve::Overwrite( ACopy, B );
+        return;
+    }
+    DistMatrix<Field> ACopy( APre );
+    lin_solve::Overwrite( ACopy, BPre );
+}
+
 template<typename Field>
 void LinearSolve
 ( const SparseMatrix<Field>& A,
@@ -317,6 +369,24 @@ void LinearSolve
     B = X;
 }
 
+template<typename Field>
+void LinearSolve( const BandMatrix<Field>& A, Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    BandFactorization<Field> factorization;
+    factorization.Factor( A );
+    factorization.Solve( B );
+}
+
+template<typename Field>
+void LinearSolve( const DistBandMatrix<Field>& A, DistMultiVec<Field>& B )
+{
+    EL_DEBUG_CSE
+    DistBandFactorization<Field> factorization;
+    factorization.Factor( A );
+    factorization.Solve( B );
+}
+
 #define PROTO(Field) \
   template void lin_solve::Overwrite( Matrix<Field>& A, Matrix<Field>& B ); \
   template void lin_solve::Overwrite \
@@ -327,13 +397,25 @@ void LinearSolve
           AbstractDistMatrix<Field>& B, \
     bool scalapack ); \
   template void LinearSolve \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& B, \
+    const LinearSolveCtrl<Base<Field>>& ctrl ); \
+  template void LinearSolve \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& B, \
+    const LinearSolveCtrl<Base<Field>>& ctrl ); \
+  template void LinearSolve \
   ( const SparseMatrix<Field>& A, \
           Matrix<Field>& B, \
     const LeastSquaresCtrl<Base<Field>>& ctrl ); \
   template void LinearSolve \
   ( const DistSparseMatrix<Field>& A, \
           DistMultiVec<Field>& B, \
-    const LeastSquaresCtrl<Base<Field>>& ctrl );
+    const LeastSquaresCtrl<Base<Field>>& ctrl ); \
+  template void LinearSolve \
+  ( const BandMatrix<Field>& A, Matrix<Field>& B ); \
+  template void LinearSolve \
+  ( const DistBandMatrix<Field>& A, DistMultiVec<Field>& B );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
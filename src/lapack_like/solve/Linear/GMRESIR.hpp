@@ -0,0 +1,315 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LINEARSOLVE_GMRESIR_HPP
+#define EL_LINEARSOLVE_GMRESIR_HPP
+
+// Mixed-precision LU with GMRES-based iterative refinement, in the spirit of
+//
+//   Erin Carson and Nicholas J. Higham,
+//   "Accelerating the solution of linear systems by iterative refinement in
+//   three precisions", SIAM J. Sci. Comput., 40(2), A817--A847 (2018).
+//
+// A is factored as P A = L U in the precision Demote<Field>, and each
+// correction d to the current solution x is computed with GMRES, in the
+// working precision, applied to the left-preconditioned correction equation
+//
+//   inv(U) inv(L) P A d = inv(U) inv(L) P (b - A x).
+//
+// Whereas classical refinement with the low-precision factors converges only
+// when the condition number of A is below the inverse of the low-precision
+// unit roundoff, the preconditioned operator remains well-conditioned as long
+// as the factors are moderately accurate. The residuals are formed in the
+// working precision rather than in a third, higher precision.
+
+namespace El {
+namespace lin_solve {
+
+// Solve A d = r, starting from d = 0, via GMRES applied to
+// inv(M) A d = inv(M) r, where 'applyA( x, y )' overwrites y := A x and
+// 'precond( b )' overwrites b := inv(M) b.
+template<typename Field,class MatType,class ApplyAType,class PrecondType>
+Int PreconditionedGMRES
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+  const MatType& r,
+        MatType& d,
+  Base<Field> relTol,
+  Int maxIts )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = r.Height();
+
+    MatType w( r );
+    precond( w );
+    const Real beta = Nrm2( w );
+    Zeros( d, n, 1 );
+    if( beta == Real(0) )
+        return 0;
+    if( !limits::IsFinite(beta) )
+        RuntimeError("The preconditioned residual was not finite");
+
+    MatType V( r );
+    Zeros( V, n, maxIts+1 );
+    auto v0 = V( ALL, IR(0) );
+    v0 = w;
+    v0 *= Field(1)/beta;
+
+    Matrix<Field> H, t, sn;
+    Matrix<Real> cs;
+    Zeros( H, maxIts+1, maxIts );
+    Zeros( t, maxIts+1, 1 );
+    Zeros( sn, maxIts, 1 );
+    Zeros( cs, maxIts, 1 );
+    t(0) = beta;
+
+    Int numIts = 0;
+    for( Int j=0; j<maxIts; ++j )
+    {
+        // w := inv(M) A v_j, orthogonalized against v_0, ..., v_j
+        auto vj = V( ALL, IR(j) );
+        applyA( vj, w );
+        precond( w );
+        for( Int i=0; i<=j; ++i )
+        {
+            auto vi = V( ALL, IR(i) );
+            H(i,j) = Dot( vi, w );
+            Axpy( -H(i,j), vi, w );
+        }
+        const Real delta = Nrm2( w );
+        if( !limits::IsFinite(delta) )
+            RuntimeError("Arnoldi step produced a non-finite number");
+        if( delta != Real(0) )
+        {
+            auto vjp1 = V( ALL, IR(j+1) );
+            vjp1 = w;
+            vjp1 *= Field(1)/delta;
+        }
+
+        // Apply the existing rotations to the new column of H
+        for( Int i=0; i<j; ++i )
+        {
+            const Real& c = cs(i);
+            const Field& s = sn(i);
+            const Field eta_i_j = H(i,j);
+            const Field eta_ip1_j = H(i+1,j);
+            H(i,  j) =  c      *eta_i_j + s*eta_ip1_j;
+            H(i+1,j) = -Conj(s)*eta_i_j + c*eta_ip1_j;
+        }
+
+        // Generate and apply a new rotation to H and to beta*e_0
+        Real c;
+        Field s;
+        H(j,j) = Givens( H(j,j), Field(delta), c, s );
+        cs(j) = c;
+        sn(j) = s;
+        const Field tau_j = t(j);
+        const Field tau_jp1 = t(j+1);
+        t(j)   =  c      *tau_j + s*tau_jp1;
+        t(j+1) = -Conj(s)*tau_j + c*tau_jp1;
+
+        numIts = j+1;
+        if( Abs(t(j+1)) <= relTol*beta || delta == Real(0) )
+            break;
+    }
+
+    // d := V inv(H) t
+    auto HTL = H( IR(0,numIts), IR(0,numIts) );
+    auto y = t( IR(0,numIts), ALL );
+    Trsv( UPPER, NORMAL, NON_UNIT, HTL, y );
+    for( Int i=0; i<numIts; ++i )
+    {
+        auto vi = V( ALL, IR(i) );
+        Axpy( y(i), vi, d );
+    }
+    return numIts;
+}
+
+// Refine the solution x of A x = b until its normwise backward error drops
+// below the tolerance, returning whether or not it did
+template<typename Field,class MatType,class ApplyAType,class PrecondType>
+bool RefineColumn
+( const ApplyAType& applyA,
+  const PrecondType& precond,
+  Base<Field> normA,
+  const MatType& b,
+        MatType& x,
+  const LinearSolveCtrl<Base<Field>>& ctrl,
+        Int& numGMRESIts )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real bNorm = Nrm2( b );
+    MatType r( b ), d( b );
+    for( Int refineIt=0; refineIt<=ctrl.maxRefineIts; ++refineIt )
+    {
+        // r := b - A x
+        applyA( x, r );
+        r *= Field(-1);
+        Axpy( Field(1), b, r );
+        const Real residNorm = Nrm2( r );
+        const Real xNorm = Nrm2( x );
+        if( !limits::IsFinite(residNorm) || !limits::IsFinite(xNorm) )
+            return false;
+        if( residNorm <= ctrl.relTol*(normA*xNorm+bNorm) )
+            return true;
+        if( refineIt == ctrl.maxRefineIts )
+            break;
+
+        numGMRESIts +=
+          PreconditionedGMRES<Field>
+          ( applyA, precond, r, d, ctrl.gmresRelTol, ctrl.maxGMRESIts );
+        Axpy( Field(1), d, x );
+    }
+    return false;
+}
+
+// Overwrite B with inv(A) B and return true if refinement of the solution
+// computed from a low-precision factorization converged
+template<typename Field>
+bool MixedPrecisionOverwrite
+( const Matrix<Field>& A,
+        Matrix<Field>& B,
+  const LinearSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    typedef Demote<Field> LowField;
+    const Int numRHS = B.Width();
+
+    Timer timer;
+    if( ctrl.time )
+        timer.Start();
+    Matrix<LowField> ALow;
+    Permutation P;
+    Copy( A, ALow );
+    try { LU( ALow, P ); }
+    catch( SingularMatrixException& )
+    {
+        if( ctrl.progress )
+            Output("The low-precision LU factorization broke down");
+        return false;
+    }
+    if( ctrl.time )
+        Output("Low-precision LU: ",timer.Stop()," secs");
+
+    auto applyA = [&]( const Matrix<Field>& x, Matrix<Field>& y )
+    { Gemv( NORMAL, Field(1), A, x, Field(0), y ); };
+    auto precond = [&]( Matrix<Field>& b )
+    {
+        Matrix<LowField> bLow;
+        Copy( b, bLow );
+        lu::SolveAfter( NORMAL, ALow, P, bLow );
+        Copy( bLow, b );
+    };
+
+    if( ctrl.time )
+        timer.Start();
+    const Real normA = FrobeniusNorm( A );
+    Matrix<Field> X( B );
+    precond( X );
+    Int numGMRESIts = 0;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        auto bj = B( ALL, IR(j) );
+        auto xj = X( ALL, IR(j) );
+        if( !RefineColumn<Field>
+              ( applyA, precond, normA, bj, xj, ctrl, numGMRESIts ) )
+        {
+            if( ctrl.progress )
+                Output("Refinement of column ",j," did not converge");
+            return false;
+        }
+    }
+    if( ctrl.time )
+        Output
+        ("Refinement with ",numGMRESIts," GMRES iterations: ",timer.Stop(),
+         " secs");
+    B = X;
+    return true;
+}
+
+template<typename Field>
+bool MixedPrecisionOverwrite
+( const DistMatrix<Field>& A,
+        DistMatrix<Field>& B,
+  const LinearSolveCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    typedef Demote<Field> LowField;
+    const Grid& g = A.Grid();
+    const Int numRHS = B.Width();
+    const bool root = ( g.Rank() == 0 );
+
+    Timer timer;
+    if( ctrl.time && root )
+        timer.Start();
+    DistMatrix<LowField> ALow(g);
+    DistPermutation P(g);
+    Copy( A, ALow );
+    try { LU( ALow, P ); }
+    catch( SingularMatrixException& )
+    {
+        if( ctrl.progress && root )
+            Output("The low-precision LU factorization broke down");
+        return false;
+    }
+    if( ctrl.time && root )
+        Output("Low-precision LU: ",timer.Stop()," secs");
+
+    // The Krylov vectors are distributed like the rows of a [VC,STAR] matrix
+    // so that each of their columns is identically aligned
+    auto applyA =
+      [&]( const DistMatrix<Field,VC,STAR>& x, DistMatrix<Field,VC,STAR>& y )
+      { Gemv( NORMAL, Field(1), A, x, Field(0), y ); };
+    auto precond = [&]( DistMatrix<Field,VC,STAR>& b )
+    {
+        DistMatrix<LowField,VC,STAR> bLow(g);
+        Copy( b, bLow );
+        lu::SolveAfter( NORMAL, ALow, P, bLow );
+        Copy( bLow, b );
+    };
+
+    if( ctrl.time && root )
+        timer.Start();
+    const Real normA = FrobeniusNorm( A );
+    DistMatrix<Field,VC,STAR> X( B );
+    {
+        DistMatrix<LowField,VC,STAR> XLow(g);
+        Copy( X, XLow );
+        lu::SolveAfter( NORMAL, ALow, P, XLow );
+        Copy( XLow, X );
+    }
+    DistMatrix<Field,VC,STAR> B_VC_STAR( B );
+    Int numGMRESIts = 0;
+    for( Int j=0; j<numRHS; ++j )
+    {
+        auto bj = B_VC_STAR( ALL, IR(j) );
+        auto xj = X( ALL, IR(j) );
+        if( !RefineColumn<Field>
+              ( applyA, precond, normA, bj, xj, ctrl, numGMRESIts ) )
+        {
+            if( ctrl.progress && root )
+                Output("Refinement of column ",j," did not converge");
+            return false;
+        }
+    }
+    if( ctrl.time && root )
+        Output
+        ("Refinement with ",numGMRESIts," GMRES iterations: ",timer.Stop(),
+         " secs");
+    B = X;
+    return true;
+}
+
+} // namespace lin_solve
+} // namespace El
+
+#endif // ifndef EL_LINEARSOLVE_GMRESIR_HPP
@@ -20,17 +20,18 @@
 namespace El {
 namespace mshs {
 
-template<typename Field>
+// The column solve of LN with the Hessenberg matrix only accessed through
+// 'column', which returns a pointer to the full j'th column of H (which must
+// remain valid until the next call). The columns are requested in the same
+// order regardless of the number of shifts.
+template<typename Field,typename ColumnFunc>
 void
-LN
-( Field alpha,
-  const Matrix<Field>& H,
+LNKernel
+( ColumnFunc column,
   const Matrix<Field>& shifts,
         Matrix<Field>& X )
 {
     EL_DEBUG_CSE
-    X *= alpha;
-
     const Int m = X.Height();
     const Int n = X.Width();
     if( m == 0 )
@@ -43,18 +44,20 @@ LN
 
     // Initialize the workspace for shifted columns of H
     Matrix<Field> W(m,n);
+    const Field* h0 = column(0);
     for( Int j=0; j<n; ++j )
     {
-        MemCopy( W.Buffer(0,j), H.LockedBuffer(), m );
+        MemCopy( W.Buffer(0,j), h0, m );
         W(0,j) -= shifts(j);
     }
 
     // Simultaneously find the LQ factorization and solve against L
     for( Int k=0; k<m-1; ++k )
     {
-        auto hB = H( IR(k+2,m), IR(k+1) );
-        const Field etakkp1 = H(k,k+1);
-        const Field etakp1kp1 = H(k+1,k+1);
+        const Field* h = column(k+1);
+        const Field* hB = &h[k+2];
+        const Field etakkp1 = h[k];
+        const Field etakp1kp1 = h[k+1];
         for( Int j=0; j<n; ++j )
         {
             // Find the Givens rotation needed to zero H(k,k+1),
@@ -83,7 +86,7 @@ LN
             blas::Axpy
             ( m-(k+2), -xc, W.LockedBuffer(k+2,j), 1, X.Buffer(k+2,j), 1 );
             blas::Axpy
-            ( m-(k+2), -xs, hB.LockedBuffer(),     1, X.Buffer(k+2,j), 1 );
+            ( m-(k+2), -xs, hB,                    1, X.Buffer(k+2,j), 1 );
 
             // Change the working vector, wB, from representing a fully-updated
             // portion of the k'th column of H from the end of the last
@@ -92,8 +95,7 @@ LN
             // w(k+1:end) := -conj(s) H(k+1:end,k) + c H(k+1:end,k+1)
             W(k+1,j) = -Conj(s)*W(k+1,j) + c*(etakp1kp1-mu);
             blas::Scal( m-(k+2), -Conj(s), W.Buffer(k+2,j), 1 );
-            blas::Axpy
-            ( m-(k+2), Field(c), hB.LockedBuffer(), 1, W.Buffer(k+2,j), 1 );
+            blas::Axpy( m-(k+2), Field(c), hB, 1, W.Buffer(k+2,j), 1 );
         }
     }
     // Divide x(end) by L(end,end)
@@ -119,7 +121,7 @@ LN
 
 template<typename Field>
 void
-UN
+LN
 ( Field alpha,
   const Matrix<Field>& H,
   const Matrix<Field>& shifts,
@@ -127,7 +129,19 @@ UN
 {
     EL_DEBUG_CSE
     X *= alpha;
+    auto column = [&]( Int j ) { return H.LockedBuffer(0,j); };
+    LNKernel( column, shifts, X );
+}
 
+// The column solve of UN (see LNKernel)
+template<typename Field,typename ColumnFunc>
+void
+UNKernel
+( ColumnFunc column,
+  const Matrix<Field>& shifts,
+        Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
     const Int m = X.Height();
     const Int n = X.Width();
     if( m == 0 )
@@ -140,18 +154,19 @@ UN
 
     // Initialize the workspace for shifted columns of H
     Matrix<Field> W(m,n);
+    const Field* hLast = column(m-1);
     for( Int j=0; j<n; ++j )
     {
-        MemCopy( W.Buffer(0,j), H.LockedBuffer(0,m-1), m );
+        MemCopy( W.Buffer(0,j), hLast, m );
         W(m-1,j) -= shifts(j);
     }
 
     // Simultaneously form the RQ factorization and solve against R
     for( Int k=m-1; k>0; --k )
     {
-        auto hT = H( IR(0,k-1), IR(k-1) );
-        const Field etakkm1 = H(k,k-1);
-        const Field etakm1km1 = H(k-1,k-1);
+        const Field* hT = column(k-1);
+        const Field etakkm1 = hT[k];
+        const Field etakm1km1 = hT[k-1];
         for( Int j=0; j<n; ++j )
         {
             // Find the Givens rotation needed to zero H(k,k-1),
@@ -177,7 +192,7 @@ UN
             const Field xc = X(k,j)*c;
             const Field xs = X(k,j)*s;
             blas::Axpy( k-1, -xc, W.LockedBuffer(0,j), 1, X.Buffer(0,j), 1 );
-            blas::Axpy( k-1, -xs, hT.LockedBuffer(),   1, X.Buffer(0,j), 1 );
+            blas::Axpy( k-1, -xs, hT,                  1, X.Buffer(0,j), 1 );
             X(k-1,j) -= xc*W(k-1,j) + xs*(etakm1km1-mu);
 
             // Change the working vector, wT, from representing a fully-updated
@@ -186,7 +201,7 @@ UN
             //
             // w(0:k-1) := -conj(s) H(0:k-1,k) + c H(0:k-1,k-1)
             blas::Scal( k-1, -Conj(s), W.Buffer(0,j), 1 );
-            blas::Axpy( k-1, Field(c), hT.LockedBuffer(), 1, W.Buffer(0,j), 1 );
+            blas::Axpy( k-1, Field(c), hT, 1, W.Buffer(0,j), 1 );
             W(k-1,j) = -Conj(s)*W(k-1,j) + c*(etakm1km1-mu);
         }
     }
@@ -211,6 +226,20 @@ UN
     }
 }
 
+template<typename Field>
+void
+UN
+( Field alpha,
+  const Matrix<Field>& H,
+  const Matrix<Field>& shifts,
+        Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    X *= alpha;
+    auto column = [&]( Int j ) { return H.LockedBuffer(0,j); };
+    UNKernel( column, shifts, X );
+}
+
 // NOTE: A [VC,* ] distribution might be most appropriate for the
 //       Hessenberg matrices since whole columns will need to be formed
 //       on every process and this distribution will keep the communication
@@ -456,6 +485,179 @@ UN
     }
 }
 
+// Split the processes of the grid into (up to) ctrl.numSubgrids teams of
+// contiguous ranks, cache the columns j of H with j = teamRank (mod teamSize)
+// on each member of a team, and solve against the local shifts in batches,
+// with the columns of H broadcast within each team as they are needed.
+template<typename Field>
+void
+TeamSolve
+( UpperOrLower uplo,
+  Field alpha,
+  const AbstractDistMatrix<Field>& H,
+  const AbstractDistMatrix<Field>& shiftsPre,
+        AbstractDistMatrix<Field>& XPre,
+  const MultiShiftHessCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = H.Grid();
+    const Int m = H.Height();
+    const Int numShifts = shiftsPre.Height();
+    const bool stream = !ctrl.streamBasename.empty();
+    const bool sharedRHS = ( stream && XPre.Width() == 1 && numShifts != 1 );
+    EL_DEBUG_ONLY(
+      if( H.Width() != m )
+          LogicError("H must be square");
+      if( XPre.Height() != m )
+          LogicError("The heights of H and X must match");
+      if( !sharedRHS && XPre.Width() != numShifts )
+          LogicError("X must have a column for each shift");
+    )
+
+    // Form the teams
+    const Int p = g.Size();
+    const Int numTeams = Max( Min(ctrl.numSubgrids,p), Int(1) );
+    const Int rank = g.VCRank();
+    Int team = 0;
+    for( Int t=1; t<numTeams; ++t )
+        if( rank >= (t*p)/numTeams )
+            team = t;
+    mpi::Comm teamComm;
+    mpi::Split( g.VCComm(), team, rank, teamComm );
+    const Int teamRank = mpi::Rank( teamComm );
+    const Int teamSize = mpi::Size( teamComm );
+
+    // Cache this member's columns of H
+    Matrix<Field> HCols, hCol(m,1);
+    {
+        DistMatrix<Field,STAR,STAR> H_STAR_STAR( H );
+        const Int numLocCols = Length( m, teamRank, teamSize );
+        HCols.Resize( m, numLocCols );
+        for( Int jLoc=0; jLoc<numLocCols; ++jLoc )
+            MemCopy
+            ( HCols.Buffer(0,jLoc),
+              H_STAR_STAR.LockedBuffer(0,teamRank+jLoc*teamSize), m );
+    }
+    auto column =
+      [&]( Int j ) -> const Field*
+      {
+          if( teamSize == 1 )
+              return HCols.LockedBuffer(0,j);
+          const Int owner = j % teamSize;
+          if( owner == teamRank )
+              MemCopy( hCol.Buffer(), HCols.LockedBuffer(0,j/teamSize), m );
+          mpi::Broadcast( hCol.Buffer(), m, owner, teamComm );
+          return hCol.LockedBuffer();
+      };
+    auto solve =
+      [&]( const Matrix<Field>& shiftsBatch, Matrix<Field>& XBatch )
+      {
+          if( uplo == LOWER )
+              LNKernel( column, shiftsBatch, XBatch );
+          else
+              UNKernel( column, shiftsBatch, XBatch );
+      };
+
+    // Every member of a team must take part in the same number of batches
+    auto numBatchesOf =
+      [&]( Int nLoc, Int& batchSize )
+      {
+          if( ctrl.batchSize <= 0 )
+          {
+              batchSize = nLoc;
+              return Int(1);
+          }
+          batchSize = ctrl.batchSize;
+          const Int numBatches = (nLoc+batchSize-1) / batchSize;
+          return mpi::AllReduce( numBatches, mpi::MAX, teamComm );
+      };
+
+    if( !stream )
+    {
+        DistMatrixReadWriteProxy<Field,Field,STAR,VR> XProx( XPre );
+        auto& X = XProx.Get();
+
+        ElementalProxyCtrl proxCtrl;
+        proxCtrl.colConstrain = true;
+        proxCtrl.colAlign = X.RowAlign();
+        DistMatrixReadProxy<Field,Field,VR,STAR>
+          shiftsProx( shiftsPre, proxCtrl );
+        auto& shiftsLoc = shiftsProx.GetLocked().LockedMatrix();
+
+        X *= alpha;
+        auto& XLoc = X.Matrix();
+        const Int nLoc = X.LocalWidth();
+        Int batchSize;
+        const Int numBatches = numBatchesOf( nLoc, batchSize );
+        for( Int batch=0; batch<numBatches; ++batch )
+        {
+            const Int jBeg = Min( batch*batchSize, nLoc );
+            const Int jEnd = Min( jBeg+batchSize, nLoc );
+            auto XBatch = XLoc( ALL, IR(jBeg,jEnd) );
+            auto shiftsBatch = shiftsLoc( IR(jBeg,jEnd), ALL );
+            solve( shiftsBatch, XBatch );
+        }
+    }
+    else
+    {
+        // Gather the right-hand sides
+        DistMatrix<Field,STAR,STAR> b_STAR_STAR(g);
+        DistMatrix<Field,STAR,VR> B_STAR_VR(g);
+        ElementalProxyCtrl proxCtrl;
+        if( sharedRHS )
+        {
+            b_STAR_STAR = XPre;
+        }
+        else
+        {
+            B_STAR_VR = XPre;
+            proxCtrl.colConstrain = true;
+            proxCtrl.colAlign = B_STAR_VR.RowAlign();
+        }
+        DistMatrixReadProxy<Field,Field,VR,STAR>
+          shiftsProx( shiftsPre, proxCtrl );
+        auto& shifts = shiftsProx.GetLocked();
+        auto& shiftsLoc = shifts.LockedMatrix();
+
+        const string filename =
+          BuildString(ctrl.streamBasename,"-",g.Rank(),".bin");
+        ofstream file( filename.c_str(), std::ios::binary );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+        const Int nLoc = shifts.LocalHeight();
+        file.write( (char*)&m, sizeof(Int) );
+        file.write( (char*)&nLoc, sizeof(Int) );
+
+        Matrix<Field> XBatch;
+        Int batchSize;
+        const Int numBatches = numBatchesOf( nLoc, batchSize );
+        for( Int batch=0; batch<numBatches; ++batch )
+        {
+            const Int jBeg = Min( batch*batchSize, nLoc );
+            const Int jEnd = Min( jBeg+batchSize, nLoc );
+            XBatch.Resize( m, jEnd-jBeg );
+            for( Int j=jBeg; j<jEnd; ++j )
+                MemCopy
+                ( XBatch.Buffer(0,j-jBeg),
+                  sharedRHS ? b_STAR_STAR.LockedBuffer() :
+                              B_STAR_VR.LockedBuffer(0,j), m );
+            XBatch *= alpha;
+            auto shiftsBatch = shiftsLoc( IR(jBeg,jEnd), ALL );
+            solve( shiftsBatch, XBatch );
+
+            for( Int j=jBeg; j<jEnd; ++j )
+            {
+                const Int jGlobal = shifts.GlobalRow(j);
+                file.write( (char*)&jGlobal, sizeof(Int) );
+                file.write
+                ( (char*)XBatch.LockedBuffer(0,j-jBeg), m*sizeof(Field) );
+            }
+        }
+    }
+
+    mpi::Free( teamComm );
+}
+
 // TODO: UT and LT
 
 } // namespace mshs
@@ -512,6 +714,23 @@ void MultiShiftHessSolve
     }
 }
 
+template<typename Field>
+void MultiShiftHessSolve
+( UpperOrLower uplo,
+  Orientation orientation,
+  Field alpha,
+  const AbstractDistMatrix<Field>& H,
+  const AbstractDistMatrix<Field>& shifts,
+        AbstractDistMatrix<Field>& X,
+  const MultiShiftHessCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( orientation == NORMAL )
+        mshs::TeamSolve( uplo, alpha, H, shifts, X, ctrl );
+    else
+        LogicError("This option is not yet supported");
+}
+
 #define PROTO(Field) \
   template void MultiShiftHessSolve \
   ( UpperOrLower uplo, \
@@ -526,7 +745,15 @@ void MultiShiftHessSolve
     Field alpha, \
     const AbstractDistMatrix<Field>& H, \
     const AbstractDistMatrix<Field>& shifts, \
-          AbstractDistMatrix<Field>& X );
+          AbstractDistMatrix<Field>& X ); \
+  template void MultiShiftHessSolve \
+  ( UpperOrLower uplo, \
+    Orientation orientation, \
+    Field alpha, \
+    const AbstractDistMatrix<Field>& H, \
+    const AbstractDistMatrix<Field>& shifts, \
+          AbstractDistMatrix<Field>& X, \
+    const MultiShiftHessCtrl& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
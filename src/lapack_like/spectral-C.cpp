@@ -210,6 +210,8 @@ ElError ElQDWHCtrlDefault( ElQDWHCtrl* ctrl )
 {
     ctrl->colPiv = false;
     ctrl->maxIts = 20;
+    ctrl->cholQR = false;
+    ctrl->mixedPrecision = false;
     return EL_SUCCESS;
 }
 
@@ -293,6 +295,9 @@ ElError ElSVDCtrlDefault_s( ElSVDCtrl_s* ctrl )
     ctrl->valChanRatio = 1.2;
     ctrl->fullChanRatio = 1.5;
 
+    ctrl->useTSQR = false;
+    ctrl->tsqrRatio = 2.;
+
     ElBidiagSVDCtrlDefault_s( &ctrl->bidiagSVDCtrl );
 
     return EL_SUCCESS;
@@ -308,6 +313,9 @@ ElError ElSVDCtrlDefault_d( ElSVDCtrl_d* ctrl )
     ctrl->valChanRatio = 1.2;
     ctrl->fullChanRatio = 1.5;
 
+    ctrl->useTSQR = false;
+    ctrl->tsqrRatio = 2.;
+
     ElBidiagSVDCtrlDefault_d( &ctrl->bidiagSVDCtrl );
 
     return EL_SUCCESS;
@@ -332,6 +340,7 @@ ElError ElHessenbergSchurCtrlDefault( ElHessenbergSchurCtrl* ctrl )
 
     ctrl->minMultiBulgeSize = 75;
     ctrl->minDistMultiBulgeSize = 400;
+    ctrl->minSubgridAEDSize = 1000;
     ctrl->numShifts = &hess_schur::aed::NumShifts;
     ctrl->deflationSize = &hess_schur::aed::DeflationSize;
     ctrl->sufficientDeflation = &hess_schur::aed::SufficientDeflation;
@@ -426,6 +435,7 @@ ElError ElPseudospecCtrlDefault_s( ElPseudospecCtrl_s* ctrl )
     ctrl->arnoldi = true;
     ctrl->basisSize = 10;
     ctrl->reorthog = true;
+    ctrl->numSubgrids = 1;
     ctrl->progress = false;
     ElSnapshotCtrlDefault( &ctrl->snapCtrl );
     return EL_SUCCESS;
@@ -451,6 +461,7 @@ ElError ElPseudospecCtrlDefault_d( ElPseudospecCtrl_d* ctrl )
     ctrl->arnoldi = true;
     ctrl->basisSize = 10;
     ctrl->reorthog = true;
+    ctrl->numSubgrids = 1;
     ctrl->progress = false;
     ElSnapshotCtrlDefault( &ctrl->snapCtrl );
     return EL_SUCCESS;
@@ -1839,6 +1839,28 @@ DivideAndConquer
     return info;
 }
 
+// Problems of size at most three are always run redundantly, while the cutoff
+// is only the heuristic for the redundant-versus-distributed policy. The
+// merges of the distributed algorithm are dominated by Gemm's over the
+// halving subproblems, each requiring a panel of collectives per block
+// column, while the redundant algorithm needs no input communication unless
+// its result is broadcast from the root.
+template<typename Real>
+bool RunRedundantly
+( Int n, const DCCtrl<Real>& dcCtrl, bool broadcast, const Grid& grid )
+{
+    if( n <= 3 )
+        return true;
+    const double size = n;
+    SubproblemCost cost;
+    cost.flops = 4*size*size*size/3;
+    cost.numInputEntries = ( broadcast ? size*size : 0 );
+    cost.numSyncs = 2*size/Blocksize() + 5*std::log2(size);
+    cost.numCommEntries = 4*size*size;
+    cost.entrySize = sizeof(Real);
+    return El::RunRedundantly( cost, grid.Size(), n <= dcCtrl.cutoff );
+}
+
 // We pass in mainDiag and superDiag in sequential form to avoid potential
 // confusion from avoiding unnecessarily creating separate copies distributed
 // (trivially) over subtrees.
@@ -1860,7 +1882,7 @@ DivideAndConquer
     const auto& dcCtrl = ctrl.dcCtrl;
     DCInfo info;
 
-    if( m <= Max(dcCtrl.cutoff,3) )
+    if( RunRedundantly( m, dcCtrl, ctrl.qrCtrl.broadcast, grid ) )
     {
         // Run the problem locally
         auto ctrlMod( ctrl );
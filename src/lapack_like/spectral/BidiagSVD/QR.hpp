@@ -130,8 +130,9 @@ template<typename Field>
 void Sweep
 (       Matrix<Base<Field>>& mainDiag,
         Matrix<Base<Field>>& superDiag,
-        Matrix<Field>& U,
-        Matrix<Field>& V,
+        GivensSequenceBuffer<Field>& URotations,
+        GivensSequenceBuffer<Field>& VRotations,
+        Int winBeg,
   const Base<Field>& shift,
         ForwardOrBackward direction,
         Matrix<Base<Field>>& cUList,
@@ -260,13 +261,11 @@ void Sweep
         }
         if( ctrl.wantU )
         {
-            ApplyGivensSequence
-            ( RIGHT, VARIABLE_GIVENS_SEQUENCE, FORWARD, cUList, sUList, U );
+            URotations.Push( FORWARD, winBeg, cUList, sUList );
         }
         if( ctrl.wantV )
         {
-            ApplyGivensSequence
-            ( RIGHT, VARIABLE_GIVENS_SEQUENCE, FORWARD, cVList, sVList, V );
+            VRotations.Push( FORWARD, winBeg, cVList, sVList );
         }
     }
     else
@@ -366,13 +365,11 @@ void Sweep
         }
         if( ctrl.wantU )
         {
-            ApplyGivensSequence
-            ( RIGHT, VARIABLE_GIVENS_SEQUENCE, BACKWARD, cUList, sUList, U );
+            URotations.Push( BACKWARD, winBeg, cUList, sUList );
         }
         if( ctrl.wantV )
         {
-            ApplyGivensSequence
-            ( RIGHT, VARIABLE_GIVENS_SEQUENCE, BACKWARD, cVList, sVList, V );
+            VRotations.Push( BACKWARD, winBeg, cVList, sVList );
         }
     }
 }
@@ -465,7 +462,8 @@ Helper
     ForwardOrBackward direction = FORWARD;
     Matrix<Real> cUList(n,1), sUList(n,1), cVList(n,1), sVList(n,1);
     Matrix<Real> mainDiagSub, superDiagSub;
-    Matrix<Field> USub, VSub;
+    // The rotations of successive sweeps are applied to U and V together
+    GivensSequenceBuffer<Field> URotations( U ), VRotations( V );
     while( winEnd > 0 )
     {
         if( info.numInnerLoops > maxInnerLoops )
@@ -535,6 +533,8 @@ Helper
                   sigmaMax, sgnMax, sigmaMin, sgnMin, cU, sU, cV, sV );
                 sigmaMax *= sgnMax; // The signs will be fixed at the end
                 sigmaMin *= sgnMin; // The signs will be fixed at the end
+                URotations.Flush();
+                VRotations.Flush();
                 if( ctrl.wantU )
                 {
                     blas::Rot
@@ -731,17 +731,9 @@ Helper
         // views
         View( mainDiagSub, mainDiag, IR(winBeg,winEnd), ALL );
         View( superDiagSub, superDiag, IR(winBeg,winEnd-1), ALL );
-        if( ctrl.wantU )
-        {
-            View( USub, U, ALL, IR(winBeg,winEnd) );
-        }
-        if( ctrl.wantV )
-        {
-            View( VSub, V, ALL, IR(winBeg,winEnd) );
-        }
         Sweep
-        ( mainDiagSub, superDiagSub, USub, VSub, shift, direction,
-          cUList, sUList, cVList, sVList, ctrl );
+        ( mainDiagSub, superDiagSub, URotations, VRotations, winBeg, shift,
+          direction, cUList, sUList, cVList, sVList, ctrl );
 
         // Test for convergence of the last off-diagonal of the sweep
         if( direction == FORWARD )
@@ -756,6 +748,9 @@ Helper
         }
     }
 
+    URotations.Flush();
+    VRotations.Flush();
+
     // Force the singular values to be positive (absorbing signs into V)
     for( Int j=0; j<info.numUnconverged; ++j )
         mainDiag(j) = Real(-1);
@@ -0,0 +1,433 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// The routines below act upon the local rows of the Krylov basis, and the
+// small matrices of inner products are summed with 'reduce' (which is a no-op
+// in the sequential case). Every block step therefore requires only a handful
+// of reductions, each batched over all of the columns of the basis.
+
+namespace El {
+namespace block_lanczos {
+
+// Form Z = [V, W]^H W with a single reduction
+template<typename Field,class ReduceType>
+void Overlaps
+( const Matrix<Field>& V,
+  const Matrix<Field>& W,
+        Matrix<Field>& Z,
+  const ReduceType& reduce )
+{
+    EL_DEBUG_CSE
+    const Int k = V.Width();
+    const Int b = W.Width();
+    Zeros( Z, k+b, b );
+    auto ZT = Z( IR(0,k), ALL );
+    auto ZB = Z( IR(k,k+b), ALL );
+    if( k > 0 )
+        Gemm( ADJOINT, NORMAL, Field(1), V, W, Field(0), ZT );
+    Gemm( ADJOINT, NORMAL, Field(1), W, W, Field(0), ZB );
+    reduce( Z );
+}
+
+// Project the orthonormal columns of V out of W, W := W - V C, and return the
+// Gram matrix of the result, G = W^H W, which is formed from the Pythagorean
+// identity unless any column of W lost more than half of its (squared) norm,
+// in which case the projection is repeated.
+template<typename Field,class ReduceType>
+Base<Field> Project
+( const Matrix<Field>& V,
+        Matrix<Field>& W,
+        Matrix<Field>& C,
+        Matrix<Field>& G,
+  const ReduceType& reduce )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int k = V.Width();
+    const Int b = W.Width();
+
+    Matrix<Field> Z;
+    Overlaps( V, W, Z, reduce );
+    C = Z( IR(0,k), ALL );
+    G = Z( IR(k,k+b), ALL );
+    Real normW = 0;
+    for( Int j=0; j<b; ++j )
+        normW = Max( normW, RealPart(G(j,j)) );
+    normW = Sqrt( normW );
+    if( k == 0 )
+        return normW;
+
+    Gemm( NORMAL, NORMAL, Field(-1), V, C, Field(1), W );
+    Matrix<Field> GProj( G );
+    Gemm( ADJOINT, NORMAL, Field(-1), C, C, Field(1), GProj );
+    bool cancellation = false;
+    for( Int j=0; j<b; ++j )
+        if( RealPart(GProj(j,j)) < RealPart(G(j,j))/2 )
+            cancellation = true;
+
+    if( cancellation )
+    {
+        Overlaps( V, W, Z, reduce );
+        auto CCorr = Z( IR(0,k), ALL );
+        G = Z( IR(k,k+b), ALL );
+        Gemm( NORMAL, NORMAL, Field(-1), V, CCorr, Field(1), W );
+        Gemm( ADJOINT, NORMAL, Field(-1), CCorr, CCorr, Field(1), G );
+        C += CCorr;
+    }
+    else
+        G = GProj;
+    return normW;
+}
+
+// Overwrite W with Q, where W = Q B and Q has orthonormal columns, using the
+// eigenvalue decomposition of the Gram matrix G = W^H W. The directions whose
+// singular values are at most 'breakdownTol' are replaced with random vectors,
+// and the corresponding rows of B are zero. Returns whether or not Q should be
+// orthonormalized again.
+template<typename Field,class RandomType>
+bool OrthonormalizeGram
+(       Matrix<Field>& W,
+        Matrix<Field>& G,
+        Matrix<Field>& B,
+  const RandomType& random,
+        Base<Field> breakdownTol )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int b = W.Width();
+    const Real eps = limits::Epsilon<Real>();
+
+    Matrix<Real> lambda;
+    Matrix<Field> U;
+    HermitianEig( LOWER, G, lambda, U );
+    const Real lambdaMax = Max( lambda(b-1), Real(0) );
+
+    bool refine = false;
+    vector<Int> brokenDown;
+    Zeros( B, b, b );
+    for( Int i=0; i<b; ++i )
+    {
+        const Real sigma = Sqrt( Max(lambda(i),Real(0)) );
+        auto u = U( ALL, IR(i) );
+        if( sigma > breakdownTol )
+        {
+            for( Int j=0; j<b; ++j )
+                B(i,j) = sigma*Conj(U(j,i));
+            u *= Real(1)/sigma;
+            if( lambda(i) <= Sqrt(eps)*lambdaMax )
+                refine = true;
+        }
+        else
+        {
+            Zero( u );
+            brokenDown.push_back( i );
+            refine = true;
+        }
+    }
+
+    Matrix<Field> Q;
+    Gemm( NORMAL, NORMAL, Field(1), W, U, Q );
+    if( brokenDown.size() > 0 )
+    {
+        Matrix<Field> R;
+        random( brokenDown.size(), R );
+        for( Int t=0; t<Int(brokenDown.size()); ++t )
+        {
+            auto q = Q( ALL, IR(brokenDown[t]) );
+            q = R( ALL, IR(t) );
+        }
+    }
+    W = Q;
+    return refine;
+}
+
+// Given the orthonormal columns of V, overwrite W with Q, where
+//
+//    W = V C + Q B,
+//
+// and [V, Q] has orthonormal columns.
+template<typename Field,class ReduceType,class RandomType>
+void Orthonormalize
+( const Matrix<Field>& V,
+        Matrix<Field>& W,
+        Matrix<Field>& C,
+        Matrix<Field>& B,
+  const ReduceType& reduce,
+  const RandomType& random )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Int b = W.Width();
+
+    Matrix<Field> G;
+    const Real normW = Project( V, W, C, G, reduce );
+    const Real breakdownTol = b*eps*normW;
+    if( !OrthonormalizeGram( W, G, B, random, breakdownTol ) )
+        return;
+
+    // Orthonormalize again, which also accounts for any random directions
+    // (whose rows of B are zero), via
+    //
+    //    W = V C + (V CCorr + Q BCorr) B.
+    //
+    Matrix<Field> CCorr, BCorr;
+    Project( V, W, CCorr, G, reduce );
+    OrthonormalizeGram( W, G, BCorr, random, Real(0) );
+    if( V.Width() > 0 )
+        Gemm( NORMAL, NORMAL, Field(1), CCorr, B, Field(1), C );
+    Matrix<Field> BProd;
+    Gemm( NORMAL, NORMAL, Field(1), BCorr, B, BProd );
+    B = BProd;
+}
+
+// Maintain the block Krylov decomposition
+//
+//   A V(:,0:m) = V(:,0:m) H + V(:,m:m+b) B E^H,
+//
+// where E spans the last b columns of the identity, with VLoc holding the
+// local rows of V. The upper triangle of H is formed from the projection
+// coefficients of each step so that the thick restarts, which replace the
+// leading columns of V with Ritz vectors, do not require any special
+// treatment.
+template<typename Field,class ApplyAType,class ReduceType,class RandomType>
+Int ThickRestart
+( const ApplyAType& applyA,
+  const ReduceType& reduce,
+  const RandomType& random,
+        Int n,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& XLoc,
+        Int numEigs,
+  const BlockLanczosCtrl<Base<Field>>& ctrl,
+        bool progress )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int b = ctrl.blockSize;
+    if( b <= 0 )
+        LogicError("Block size must be positive");
+    if( numEigs <= 0 )
+        LogicError("Must request at least one eigenpair");
+    const Int m = Max( b*ctrl.maxBlocks, b*((numEigs+b-1)/b+1) );
+    if( m+b > n )
+        LogicError
+        ("Krylov basis of size ",m+b," is too large for a matrix of height ",n,
+         "; please use HermitianEig instead");
+    // Keep half of the unwanted Ritz vectors on each restart
+    const Int numKeep = numEigs + (m-b-numEigs)/2;
+
+    Matrix<Field> VLoc, B, C, W;
+    random( b, W );
+    const Int nLoc = W.Height();
+    Zeros( VLoc, nLoc, m+b );
+    {
+        Matrix<Field> V0;
+        Orthonormalize( V0, W, C, B, reduce, random );
+        auto VLoc0 = VLoc( ALL, IR(0,b) );
+        VLoc0 = W;
+    }
+
+    Matrix<Field> H, HCopy, Y, VY, BY;
+    Matrix<Real> theta;
+    Zeros( H, m, m );
+    Int size = b;
+    Real normEst = 0;
+    Int restart = 0;
+    while( true )
+    {
+        // Expand the basis until it holds m+b vectors
+        while( size <= m )
+        {
+            const Int j = size - b;
+            auto VLocPrev = VLoc( ALL, IR(0,size) );
+            auto VLocj = VLoc( ALL, IR(j,size) );
+            applyA( VLocj, W );
+            Orthonormalize( VLocPrev, W, C, B, reduce, random );
+
+            auto Hj = H( IR(0,size), IR(j,size) );
+            Hj = C;
+            auto VLocNext = VLoc( ALL, IR(size,size+b) );
+            VLocNext = W;
+            size += b;
+        }
+
+        // Form the Ritz pairs and the norms of their Lanczos residuals,
+        // || A x - theta x ||_2 = || B Y(m-b:m,i) ||_2
+        HCopy = H;
+        HermitianEig( UPPER, HCopy, theta, Y );
+        for( Int i=0; i<m; ++i )
+            normEst = Max( normEst, Abs(theta(i)) );
+        auto YLast = Y( IR(m-b,m), ALL );
+        Gemm( NORMAL, NORMAL, Field(1), B, YLast, BY );
+        const Int wantedOff = ( ctrl.largest ? m-numEigs : 0 );
+        Int numConverged = 0;
+        for( Int i=wantedOff; i<wantedOff+numEigs; ++i )
+        {
+            auto by = BY( ALL, IR(i) );
+            if( FrobeniusNorm(by) <= ctrl.tol*normEst )
+                ++numConverged;
+        }
+        if( progress )
+            Output
+            ("Restart ",restart,": ",numConverged," of ",numEigs,
+             " Ritz pairs have converged");
+        if( numConverged == numEigs || restart == ctrl.maxRestarts )
+        {
+            if( numConverged < numEigs )
+                RuntimeError
+                ("Block Lanczos did not converge in ",ctrl.maxRestarts,
+                 " restarts");
+            const Range<Int> wantedInd( wantedOff, wantedOff+numEigs );
+            w = theta( wantedInd, ALL );
+            auto VLocBasis = VLoc( ALL, IR(0,m) );
+            auto YWanted = Y( ALL, wantedInd );
+            Gemm( NORMAL, NORMAL, Field(1), VLocBasis, YWanted, XLoc );
+            break;
+        }
+
+        // Restart with the Ritz vectors nearest the wanted end of the spectrum
+        // followed by the last block of the basis
+        const Int keepOff = ( ctrl.largest ? m-numKeep : 0 );
+        const Range<Int> keepInd( keepOff, keepOff+numKeep );
+        auto VLocBasis = VLoc( ALL, IR(0,m) );
+        auto YKeep = Y( ALL, keepInd );
+        Gemm( NORMAL, NORMAL, Field(1), VLocBasis, YKeep, VY );
+        auto VLocKeep = VLoc( ALL, IR(0,numKeep) );
+        auto VLocRes = VLoc( ALL, IR(numKeep,numKeep+b) );
+        VLocKeep = VY;
+        VLocRes = VLoc( ALL, IR(m,m+b) );
+        Zero( H );
+        for( Int i=0; i<numKeep; ++i )
+            H(i,i) = theta(keepOff+i);
+        size = numKeep + b;
+        ++restart;
+    }
+    return restart;
+}
+
+} // namespace block_lanczos
+
+template<typename Field>
+Int BlockLanczosEig
+( const LinearOperator<Field>& A,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+        Int numEigs,
+  const BlockLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+
+    auto reduce = []( Matrix<Field>& ) { };
+    auto random =
+      [&]( Int width, Matrix<Field>& R ) { Uniform( R, n, width ); };
+    return block_lanczos::ThickRestart
+      ( A, reduce, random, n, w, X, numEigs, ctrl, ctrl.progress );
+}
+
+template<typename Field>
+Int BlockLanczosEig
+( const SparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
+        Int numEigs,
+  const BlockLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return BlockLanczosEig( LinearOperator<Field>(A), w, X, numEigs, ctrl );
+}
+
+template<typename Field>
+Int BlockLanczosEig
+( const DistLinearOperator<Field>& A,
+        Matrix<Base<Field>>& w,
+        DistMultiVec<Field>& X,
+        Int numEigs,
+  const BlockLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Height();
+    if( n != A.Width() )
+        LogicError("A was not square");
+    const Grid& grid = A.Grid();
+
+    // A single application of the operator is made to each block
+    DistMultiVec<Field> VBlock(grid), WBlock(grid);
+    auto applyA =
+      [&]( const Matrix<Field>& VLoc, Matrix<Field>& WLoc )
+      {
+          VBlock.Resize( n, VLoc.Width() );
+          VBlock.Matrix() = VLoc;
+          A( VBlock, WBlock );
+          WLoc = WBlock.Matrix();
+      };
+    auto reduce =
+      [&]( Matrix<Field>& Z ) { AllReduce( Z, grid.Comm() ); };
+    auto random =
+      [&]( Int width, Matrix<Field>& RLoc )
+      {
+          DistMultiVec<Field> R(grid);
+          Uniform( R, n, width );
+          RLoc = R.Matrix();
+      };
+
+    X.SetGrid( grid );
+    Matrix<Field> XLoc;
+    const bool progress = ctrl.progress && grid.Rank() == 0;
+    const Int numRestarts =
+      block_lanczos::ThickRestart
+      ( applyA, reduce, random, n, w, XLoc, numEigs, ctrl, progress );
+    X.Resize( n, numEigs );
+    X.Matrix() = XLoc;
+    return numRestarts;
+}
+
+template<typename Field>
+Int BlockLanczosEig
+( const DistSparseMatrix<Field>& A,
+        Matrix<Base<Field>>& w,
+        DistMultiVec<Field>& X,
+        Int numEigs,
+  const BlockLanczosCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    return BlockLanczosEig
+      ( DistLinearOperator<Field>(A), w, X, numEigs, ctrl );
+}
+
+#define PROTO_TYPES(Field,SeqType,DistType) \
+  template Int BlockLanczosEig \
+  ( const SeqType<Field>& A, \
+          Matrix<Base<Field>>& w, \
+          Matrix<Field>& X, \
+          Int numEigs, \
+    const BlockLanczosCtrl<Base<Field>>& ctrl ); \
+  template Int BlockLanczosEig \
+  ( const DistType<Field>& A, \
+          Matrix<Base<Field>>& w, \
+          DistMultiVec<Field>& X, \
+          Int numEigs, \
+    const BlockLanczosCtrl<Base<Field>>& ctrl );
+
+#define PROTO(Field) \
+  PROTO_TYPES(Field,SparseMatrix,DistSparseMatrix) \
+  PROTO_TYPES(Field,LinearOperator,DistLinearOperator)
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -101,6 +101,32 @@ void Helper
 
 } // namespace eig
 
+// Since neither the Schur vectors nor the portion of the Schur form outside of
+// the active windows is needed, the Hessenberg QR iteration can restrict its
+// updates to the active window (and, in the distributed case, move the
+// shrinking window onto a smaller subgrid)
+template<typename Field>
+void Eig
+( Matrix<Field>& A,
+  Matrix<Complex<Base<Field>>>& w )
+{
+    EL_DEBUG_CSE
+    SchurCtrl<Base<Field>> ctrl;
+    ctrl.hessSchurCtrl.fullTriangle = false;
+    Schur( A, w, ctrl );
+}
+
+template<typename Field>
+void Eig
+( AbstractDistMatrix<Field>& A,
+  AbstractDistMatrix<Complex<Base<Field>>>& w )
+{
+    EL_DEBUG_CSE
+    SchurCtrl<Base<Field>> ctrl;
+    ctrl.hessSchurCtrl.fullTriangle = false;
+    Schur( A, w, ctrl );
+}
+
 template<typename Field>
 void Eig
 ( Matrix<Field>& A,
@@ -123,6 +149,12 @@ void Eig
 
 #define PROTO(Field) \
   template void Eig \
+  ( Matrix<Field>& A, \
+    Matrix<Complex<Base<Field>>>& w ); \
+  template void Eig \
+  ( AbstractDistMatrix<Field>& A, \
+    AbstractDistMatrix<Complex<Base<Field>>>& w ); \
+  template void Eig \
   ( Matrix<Field>& A, \
     Matrix<Complex<Base<Field>>>& w, \
     Matrix<Complex<Base<Field>>>& X ); \
@@ -10,9 +10,12 @@
 
 namespace El {
 
-template<typename F>
+// The sparse matrices and linear operators share implementations
+namespace extremal_sing_val {
+
+template<typename F,class OperatorType>
 pair<Base<F>,Base<F>>
-ExtremalSingValEst( const SparseMatrix<F>& A, Int basisSize )
+Sequential( const OperatorType& A, Int basisSize )
 {
     EL_DEBUG_CSE
     typedef Base<F> Real;
@@ -35,9 +38,9 @@ ExtremalSingValEst( const SparseMatrix<F>& A, Int basisSize )
     return extremal;
 }
 
-template<typename F>
+template<typename F,class OperatorType>
 pair<Base<F>,Base<F>>
-ExtremalSingValEst( const DistSparseMatrix<F>& A, Int basisSize )
+Distributed( const OperatorType& A, Int basisSize )
 {
     EL_DEBUG_CSE
     typedef Base<F> Real;
@@ -60,9 +63,9 @@ ExtremalSingValEst( const DistSparseMatrix<F>& A, Int basisSize )
     return extremal;
 }
 
-template<typename F>
+template<typename F,class OperatorType>
 pair<Base<F>,Base<F>>
-HermitianExtremalSingValEst( const SparseMatrix<F>& A, Int basisSize )
+HermitianSequential( const OperatorType& A, Int basisSize )
 {
     EL_DEBUG_CSE
     typedef Base<F> Real;
@@ -87,9 +90,9 @@ HermitianExtremalSingValEst( const SparseMatrix<F>& A, Int basisSize )
     return extremal;
 }
 
-template<typename F>
+template<typename F,class OperatorType>
 pair<Base<F>,Base<F>>
-HermitianExtremalSingValEst( const DistSparseMatrix<F>& A, Int basisSize )
+HermitianDistributed( const OperatorType& A, Int basisSize )
 {
     EL_DEBUG_CSE
     typedef Base<F> Real;
@@ -116,15 +119,61 @@ HermitianExtremalSingValEst( const DistSparseMatrix<F>& A, Int basisSize )
     return extremal;
 }
 
-#define PROTO(F) \
+} // namespace extremal_sing_val
+
+template<typename F>
+pair<Base<F>,Base<F>>
+ExtremalSingValEst( const SparseMatrix<F>& A, Int basisSize )
+{ return extremal_sing_val::Sequential<F>( A, basisSize ); }
+
+template<typename F>
+pair<Base<F>,Base<F>>
+ExtremalSingValEst( const LinearOperator<F>& A, Int basisSize )
+{ return extremal_sing_val::Sequential<F>( A, basisSize ); }
+
+template<typename F>
+pair<Base<F>,Base<F>>
+ExtremalSingValEst( const DistSparseMatrix<F>& A, Int basisSize )
+{ return extremal_sing_val::Distributed<F>( A, basisSize ); }
+
+template<typename F>
+pair<Base<F>,Base<F>>
+ExtremalSingValEst( const DistLinearOperator<F>& A, Int basisSize )
+{ return extremal_sing_val::Distributed<F>( A, basisSize ); }
+
+template<typename F>
+pair<Base<F>,Base<F>>
+HermitianExtremalSingValEst( const SparseMatrix<F>& A, Int basisSize )
+{ return extremal_sing_val::HermitianSequential<F>( A, basisSize ); }
+
+template<typename F>
+pair<Base<F>,Base<F>>
+HermitianExtremalSingValEst( const LinearOperator<F>& A, Int basisSize )
+{ return extremal_sing_val::HermitianSequential<F>( A, basisSize ); }
+
+template<typename F>
+pair<Base<F>,Base<F>>
+HermitianExtremalSingValEst( const DistSparseMatrix<F>& A, Int basisSize )
+{ return extremal_sing_val::HermitianDistributed<F>( A, basisSize ); }
+
+template<typename F>
+pair<Base<F>,Base<F>>
+HermitianExtremalSingValEst( const DistLinearOperator<F>& A, Int basisSize )
+{ return extremal_sing_val::HermitianDistributed<F>( A, basisSize ); }
+
+#define PROTO_TYPES(F,SeqType,DistType) \
   template pair<Base<F>,Base<F>> ExtremalSingValEst \
-  ( const SparseMatrix<F>& A, Int basisSize ); \
+  ( const SeqType<F>& A, Int basisSize ); \
   template pair<Base<F>,Base<F>> ExtremalSingValEst \
-  ( const DistSparseMatrix<F>& A, Int basisSize ); \
+  ( const DistType<F>& A, Int basisSize ); \
   template pair<Base<F>,Base<F>> HermitianExtremalSingValEst \
-  ( const SparseMatrix<F>& A, Int basisSize ); \
+  ( const SeqType<F>& A, Int basisSize ); \
   template pair<Base<F>,Base<F>> HermitianExtremalSingValEst \
-  ( const DistSparseMatrix<F>& A, Int basisSize );
+  ( const DistType<F>& A, Int basisSize );
+
+#define PROTO(F) \
+  PROTO_TYPES(F,SparseMatrix,DistSparseMatrix) \
+  PROTO_TYPES(F,LinearOperator,DistLinearOperator)
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -229,11 +229,20 @@ BlackBox
         SafeScaleTrapezoid( maxNormA, normMin, uplo, A );
     }
 
-    // TODO(poulson): Extend interface to support accepting ctrl.tridiagCtrl
-    herm_tridiag::ExplicitCondensed( uplo, A );
-
-    auto d = GetRealPartOfDiagonal(A);
-    auto dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
+    Matrix<Real> d;
+    Matrix<F> dSub;
+    if( ctrl.twoStage )
+    {
+        herm_tridiag::TwoStage( uplo, A, d, dSub, ctrl.twoStageBandwidth );
+    }
+    else
+    {
+        // TODO(poulson): Extend interface to support accepting
+        // ctrl.tridiagCtrl
+        herm_tridiag::ExplicitCondensed( uplo, A );
+        d = GetRealPartOfDiagonal(A);
+        dSub = GetDiagonal( A, (uplo==LOWER?-1:1) );
+    }
     info.tridiagEigInfo =
       HermitianTridiagEig( d, dSub, w, ctrl.tridiagEigCtrl );
 
@@ -325,7 +334,11 @@ ScaLAPACKHelper
 {
     EL_DEBUG_CSE
 
-    DistMatrixReadProxy<F,F,MC,MR,BLOCK> AProx( APre );
+    // Block-cyclic matrices with square blocks are used in place
+    const auto proxyCtrl =
+      ScaLAPACKProxyCtrl
+      ( APre, DefaultBlockHeight(), DefaultBlockHeight(), true );
+    DistMatrixReadProxy<F,F,MC,MR,BLOCK> AProx( APre, proxyCtrl );
     auto& A = AProx.Get();
 
     DistMatrixWriteProxy<Base<F>,Base<F>,STAR,STAR> wProx( wPre );
@@ -456,7 +469,21 @@ BlackBox
     }
 
     // Tridiagonalize A
-    herm_tridiag::ExplicitCondensed( uplo, A, ctrl.tridiagCtrl );
+    DistMatrix<Real,STAR,STAR> d(A.Grid());
+    DistMatrix<Real,STAR,STAR> e(A.Grid());
+    if( ctrl.twoStage )
+    {
+        DistMatrix<F,STAR,STAR> dSub(A.Grid());
+        herm_tridiag::TwoStage( uplo, A, d, dSub, ctrl.twoStageBandwidth );
+        RealPart( dSub, e );
+    }
+    else
+    {
+        herm_tridiag::ExplicitCondensed( uplo, A, ctrl.tridiagCtrl );
+        const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
+        d = GetRealPartOfDiagonal(A);
+        e = GetRealPartOfDiagonal(A,subdiagonal);
+    }
 
     if( ctrl.timeStages )
     {
@@ -469,9 +496,6 @@ BlackBox
     }
 
     // Solve the symmetric tridiagonal EVP
-    const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
-    auto d = GetRealPartOfDiagonal(A);
-    auto e = GetRealPartOfDiagonal(A,subdiagonal);
     info.tridiagEigInfo = HermitianTridiagEig( d, e, w, ctrl.tridiagEigCtrl );
 
     if( ctrl.timeStages )
@@ -549,6 +573,21 @@ BlackBox
     EL_DEBUG_CSE
     HermitianEigInfo info;
 
+    if( ctrl.twoStage )
+    {
+        Matrix<F> householderScalars, dSub;
+        Matrix<Base<F>> signature, d;
+        BulgeReflectors<F> reflectors;
+        herm_tridiag::TwoStage
+        ( uplo, A, householderScalars, signature, d, dSub, reflectors,
+          ctrl.twoStageBandwidth );
+        info.tridiagEigInfo =
+          HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
+        herm_tridiag::ApplyTwoStageQ
+        ( A, householderScalars, signature, reflectors, Q );
+        return info;
+    }
+
     // TODO(poulson): Extend interface to support ctrl.tridiagCtrl
     Matrix<F> householderScalars;
     HermitianTridiag( uplo, A, householderScalars );
@@ -764,13 +803,17 @@ ScaLAPACKHelper
 {
     EL_DEBUG_CSE
 
-    DistMatrixReadProxy<F,F,MC,MR,BLOCK> AProx( APre );
+    // Block-cyclic matrices with square blocks are used in place
+    const auto proxyCtrl =
+      ScaLAPACKProxyCtrl
+      ( APre, DefaultBlockHeight(), DefaultBlockHeight(), true );
+    DistMatrixReadProxy<F,F,MC,MR,BLOCK> AProx( APre, proxyCtrl );
     auto& A = AProx.Get();
 
     DistMatrixWriteProxy<Base<F>,Base<F>,STAR,STAR> wProx( wPre );
     auto& w = wProx.Get();
 
-    DistMatrixWriteProxy<F,F,MC,MR,BLOCK> QProx( QPre );
+    DistMatrixWriteProxy<F,F,MC,MR,BLOCK> QProx( QPre, AlignedProxyCtrl(A) );
     auto& Q = QProx.Get();
 
     if( A.Height() != A.Width() )
@@ -928,9 +971,13 @@ MRRR
     // NOTE: We should be guaranteeing that Q_STAR_VR does not need to
     //       reallocate a buffer
     if( subset.rangeSubset )
+    {
+        herm_tridiag_eig::SetMRRRThreads
+        ( ctrl.tridiagEigCtrl.mrrrCtrl.numThreads );
         info.tridiagEigInfo = herm_tridiag_eig::MRRRPostEstimate
         ( d_STAR_STAR, e_STAR_STAR, w, Q_STAR_VR, UNSORTED,
           subset.lowerBound, subset.upperBound );
+    }
     else
         info.tridiagEigInfo = HermitianTridiagEig
         ( d_STAR_STAR, e_STAR_STAR, w, Q_STAR_VR, ctrl.tridiagEigCtrl );
@@ -997,6 +1044,81 @@ MRRR
     return info;
 }
 
+template<typename F>
+HermitianEigInfo
+TwoStage
+( UpperOrLower uplo,
+  AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<Base<F>>& w,
+  AbstractDistMatrix<F>& QPre,
+  const HermitianEigCtrl<F>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = APre.Grid();
+    HermitianEigInfo info;
+    Timer timer;
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    if( ctrl.timeStages )
+    {
+        mpi::Barrier( A.DistComm() );
+        if( g.Rank() == 0 )
+            timer.Start();
+    }
+    DistMatrix<F,STAR,STAR> householderScalars(g), dSub(g);
+    DistMatrix<Base<F>,STAR,STAR> signature(g), d(g);
+    BulgeReflectors<F> reflectors;
+    herm_tridiag::TwoStage
+    ( uplo, A, householderScalars, signature, d, dSub, reflectors,
+      ctrl.twoStageBandwidth );
+    if( ctrl.timeStages )
+    {
+        mpi::Barrier( A.DistComm() );
+        if( g.Rank() == 0 )
+        {
+            Output("  Condense time:      ",timer.Stop()," secs");
+            timer.Start();
+        }
+    }
+
+    auto solveAndBacktransform = [&]( DistMatrix<F>& Q )
+      {
+          info.tridiagEigInfo =
+            HermitianTridiagEig( d, dSub, w, Q, ctrl.tridiagEigCtrl );
+          if( ctrl.timeStages )
+          {
+              mpi::Barrier( A.DistComm() );
+              if( g.Rank() == 0 )
+              {
+                  Output("  TridiagEig:    ",timer.Stop()," secs");
+                  timer.Start();
+              }
+          }
+          herm_tridiag::ApplyTwoStageQ
+          ( A, householderScalars, signature, reflectors, Q );
+          if( ctrl.timeStages )
+          {
+              mpi::Barrier( A.DistComm() );
+              if( g.Rank() == 0 )
+                  Output("  Backtransform: ",timer.Stop()," secs");
+          }
+      };
+    if( ctrl.tridiagEigCtrl.accumulateEigVecs )
+    {
+        DistMatrixReadWriteProxy<F,F,MC,MR> QProx( QPre );
+        solveAndBacktransform( QProx.Get() );
+    }
+    else
+    {
+        DistMatrixWriteProxy<F,F,MC,MR> QProx( QPre );
+        solveAndBacktransform( QProx.Get() );
+    }
+
+    return info;
+}
+
 } // namespace herm_eig
 
 template<typename F>
@@ -1084,12 +1206,18 @@ HermitianEig
         herm_eig::SDC( uplo, A, w, Q, ctrl.sdcCtrl );
         herm_eig::SortAndFilter( w, Q, ctrl.tridiagEigCtrl );
     }
-    else if( ctrl.tridiagEigCtrl.alg == HERM_TRIDIAG_EIG_MRRR )
+    else if( ctrl.twoStage )
+    {
+        info = herm_eig::TwoStage( uplo, A, w, Q, ctrl );
+    }
+    else if( ctrl.tridiagEigCtrl.alg == HERM_TRIDIAG_EIG_MRRR &&
+             ctrl.tridiagEigCtrl.numSlices <= 1 )
     {
         info = herm_eig::MRRR( uplo, A, w, Q, ctrl );
     }
     else
     {
+        // Spectrum slicing is handled within HermitianTridiagEig
         info = herm_eig::BlackBox( uplo, A, w, Q, ctrl );
     }
 
@@ -0,0 +1,147 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace herm_eig {
+
+// The number of eigenpairs computed for each member of a side-by-side batch
+template<typename Field>
+Int NumBatchedEigs( Int n, const HermitianEigCtrl<Field>& ctrl )
+{
+    EL_DEBUG_CSE
+    const auto& subset = ctrl.tridiagEigCtrl.subset;
+    if( subset.rangeSubset )
+        LogicError
+        ("Value-range subsets are not supported for side-by-side batches");
+    if( subset.indexSubset )
+        return subset.upperIndex - subset.lowerIndex + 1;
+    return n;
+}
+
+} // namespace herm_eig
+
+template<typename Field>
+void HermitianEigBatched
+( UpperOrLower uplo,
+  vector<Matrix<Field>>& A,
+  vector<Matrix<Base<Field>>>& w,
+  const HermitianEigCtrl<Field>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_REGION("HermitianEigBatched");
+    const Int batchSize = A.size();
+    w.resize( batchSize );
+    ParallelFor( batchSize, [&]( Int b )
+    { HermitianEig( uplo, A[b], w[b], ctrl ); } );
+}
+
+template<typename Field>
+void HermitianEigBatched
+( UpperOrLower uplo,
+  vector<Matrix<Field>>& A,
+  vector<Matrix<Base<Field>>>& w,
+  vector<Matrix<Field>>& Q,
+  const HermitianEigCtrl<Field>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_REGION("HermitianEigBatched");
+    const Int batchSize = A.size();
+    w.resize( batchSize );
+    Q.resize( batchSize );
+    ParallelFor( batchSize, [&]( Int b )
+    { HermitianEig( uplo, A[b], w[b], Q[b], ctrl ); } );
+}
+
+template<typename Field>
+void HermitianEigBatched
+( UpperOrLower uplo,
+  Int batchSize,
+  Matrix<Field>& A,
+  Matrix<Base<Field>>& w,
+  const HermitianEigCtrl<Field>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    auto ABatch = BatchView( batchSize, A );
+    const Int n = A.Height();
+    const Int numEigs = herm_eig::NumBatchedEigs( n, ctrl );
+    w.Resize( numEigs, batchSize );
+    auto wBatch = BatchView( batchSize, w );
+    ParallelFor( batchSize, [&]( Int b )
+    {
+        Matrix<Real> wMember;
+        HermitianEig( uplo, ABatch[b], wMember, ctrl );
+        wBatch[b] = wMember;
+    } );
+}
+
+template<typename Field>
+void HermitianEigBatched
+( UpperOrLower uplo,
+  Int batchSize,
+  Matrix<Field>& A,
+  Matrix<Base<Field>>& w,
+  Matrix<Field>& Q,
+  const HermitianEigCtrl<Field>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    auto ABatch = BatchView( batchSize, A );
+    const Int n = A.Height();
+    const Int numEigs = herm_eig::NumBatchedEigs( n, ctrl );
+    w.Resize( numEigs, batchSize );
+    Q.Resize( n, numEigs*batchSize );
+    auto wBatch = BatchView( batchSize, w );
+    auto QBatch = BatchView( batchSize, Q );
+    ParallelFor( batchSize, [&]( Int b )
+    {
+        Matrix<Real> wMember;
+        Matrix<Field> QMember;
+        HermitianEig( uplo, ABatch[b], wMember, QMember, ctrl );
+        wBatch[b] = wMember;
+        QBatch[b] = QMember;
+    } );
+}
+
+#define PROTO(Field) \
+  template void HermitianEigBatched \
+  ( UpperOrLower uplo, \
+    vector<Matrix<Field>>& A, \
+    vector<Matrix<Base<Field>>>& w, \
+    const HermitianEigCtrl<Field>& ctrl ); \
+  template void HermitianEigBatched \
+  ( UpperOrLower uplo, \
+    vector<Matrix<Field>>& A, \
+    vector<Matrix<Base<Field>>>& w, \
+    vector<Matrix<Field>>& Q, \
+    const HermitianEigCtrl<Field>& ctrl ); \
+  template void HermitianEigBatched \
+  ( UpperOrLower uplo, \
+    Int batchSize, \
+    Matrix<Field>& A, \
+    Matrix<Base<Field>>& w, \
+    const HermitianEigCtrl<Field>& ctrl ); \
+  template void HermitianEigBatched \
+  ( UpperOrLower uplo, \
+    Int batchSize, \
+    Matrix<Field>& A, \
+    Matrix<Base<Field>>& w, \
+    Matrix<Field>& Q, \
+    const HermitianEigCtrl<Field>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -10,26 +10,28 @@
 
 namespace El {
 
+namespace herm_gen_def_eig {
+
 // Compute eigenvalues
 // ===================
 
 template<typename Field>
 HermitianEigInfo
-HermitianGenDefEig
-( Pencil pencil,
-  UpperOrLower uplo,
-  Matrix<Field>& A,
-  Matrix<Field>& B,
-  Matrix<Base<Field>>& w,
+AfterCholesky
+(       Pencil pencil,
+        UpperOrLower uplo,
+        Matrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Base<Field>>& w,
   const HermitianEigCtrl<Field>& ctrl )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
       if( A.Height() != A.Width() || B.Height() != B.Width() )
           LogicError("Hermitian matrices must be square.");
+      if( A.Height() != B.Height() )
+          LogicError("A and B must be the same size");
     )
-
-    Cholesky( uplo, B );
     if( pencil == AXBX )
         TwoSidedTrsm( uplo, NON_UNIT, A, B );
     else
@@ -39,12 +41,12 @@ HermitianGenDefEig
 
 template<typename Field>
 HermitianEigInfo
-HermitianGenDefEig
-( Pencil pencil,
-  UpperOrLower uplo,
-  AbstractDistMatrix<Field>& APre,
-  AbstractDistMatrix<Field>& BPre,
-  AbstractDistMatrix<Base<Field>>& w,
+AfterCholesky
+(       Pencil pencil,
+        UpperOrLower uplo,
+        AbstractDistMatrix<Field>& APre,
+  const AbstractDistMatrix<Field>& BPre,
+        AbstractDistMatrix<Base<Field>>& w,
   const HermitianEigCtrl<Field>& ctrl )
 {
     EL_DEBUG_CSE
@@ -52,15 +54,17 @@ HermitianGenDefEig
       AssertSameGrids( APre, BPre, w );
       if( APre.Height() != APre.Width() || BPre.Height() != BPre.Width() )
           LogicError("Hermitian matrices must be square.");
+      if( APre.Height() != BPre.Height() )
+          LogicError("A and B must be the same size");
     )
 
-    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre ), BProx( BPre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadProxy<Field,Field,MC,MR> BProx( BPre );
     auto& A = AProx.Get();
-    auto& B = BProx.Get();
+    auto& B = BProx.GetLocked();
 
-    Cholesky( uplo, B );
     if( pencil == AXBX )
-        TwoSidedTrsm( uplo, NON_UNIT, A, B );
+        TwoSidedTrsm( uplo, NON_UNIT, A, B, 1 );
     else
         TwoSidedTrmm( uplo, NON_UNIT, A, B );
     return HermitianEig( uplo, A, w, ctrl );
@@ -71,22 +75,22 @@ HermitianGenDefEig
 
 template<typename Field>
 HermitianEigInfo
-HermitianGenDefEig
-( Pencil pencil,
-  UpperOrLower uplo,
-  Matrix<Field>& A,
-  Matrix<Field>& B,
-  Matrix<Base<Field>>& w,
-  Matrix<Field>& X,
+AfterCholesky
+(       Pencil pencil,
+        UpperOrLower uplo,
+        Matrix<Field>& A,
+  const Matrix<Field>& B,
+        Matrix<Base<Field>>& w,
+        Matrix<Field>& X,
   const HermitianEigCtrl<Field>& ctrl )
 {
     EL_DEBUG_CSE
     EL_DEBUG_ONLY(
       if( A.Height() != A.Width() || B.Height() != B.Width() )
           LogicError("Hermitian matrices must be square.");
+      if( A.Height() != B.Height() )
+          LogicError("A and B must be the same size");
     )
-
-    Cholesky( uplo, B );
     if( pencil == AXBX )
         TwoSidedTrsm( uplo, NON_UNIT, A, B );
     else
@@ -107,13 +111,13 @@ HermitianGenDefEig
 
 template<typename Field>
 HermitianEigInfo
-HermitianGenDefEig
-( Pencil pencil,
-  UpperOrLower uplo,
-  AbstractDistMatrix<Field>& APre,
-  AbstractDistMatrix<Field>& BPre,
-  AbstractDistMatrix<Base<Field>>& w,
-  AbstractDistMatrix<Field>& XPre,
+AfterCholesky
+(       Pencil pencil,
+        UpperOrLower uplo,
+        AbstractDistMatrix<Field>& APre,
+  const AbstractDistMatrix<Field>& BPre,
+        AbstractDistMatrix<Base<Field>>& w,
+        AbstractDistMatrix<Field>& XPre,
   const HermitianEigCtrl<Field>& ctrl )
 {
     EL_DEBUG_CSE
@@ -121,17 +125,19 @@ HermitianGenDefEig
       AssertSameGrids( APre, BPre, w, XPre );
       if( APre.Height() != APre.Width() || BPre.Height() != BPre.Width() )
           LogicError("Hermitian matrices must be square.");
+      if( APre.Height() != BPre.Height() )
+          LogicError("A and B must be the same size");
     )
 
-    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre ), BProx( BPre );
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    DistMatrixReadProxy<Field,Field,MC,MR> BProx( BPre );
     DistMatrixWriteProxy<Field,Field,MC,MR> XProx( XPre );
     auto& A = AProx.Get();
-    auto& B = BProx.Get();
+    auto& B = BProx.GetLocked();
     auto& X = XProx.Get();
 
-    Cholesky( uplo, B );
     if( pencil == AXBX )
-        TwoSidedTrsm( uplo, NON_UNIT, A, B );
+        TwoSidedTrsm( uplo, NON_UNIT, A, B, 1 );
     else
         TwoSidedTrmm( uplo, NON_UNIT, A, B );
     auto info = HermitianEig( uplo, A, w, X, ctrl );
@@ -148,7 +154,135 @@ HermitianGenDefEig
     return info;
 }
 
+} // namespace herm_gen_def_eig
+
+// Compute eigenvalues
+// ===================
+
+template<typename Field>
+HermitianEigInfo
+HermitianGenDefEig
+( Pencil pencil,
+  UpperOrLower uplo,
+  Matrix<Field>& A,
+  Matrix<Field>& B,
+  Matrix<Base<Field>>& w,
+  const HermitianEigCtrl<Field>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() || B.Height() != B.Width() )
+          LogicError("Hermitian matrices must be square.");
+    )
+    Cholesky( uplo, B );
+    return herm_gen_def_eig::AfterCholesky( pencil, uplo, A, B, w, ctrl );
+}
+
+template<typename Field>
+HermitianEigInfo
+HermitianGenDefEig
+( Pencil pencil,
+  UpperOrLower uplo,
+  AbstractDistMatrix<Field>& APre,
+  AbstractDistMatrix<Field>& BPre,
+  AbstractDistMatrix<Base<Field>>& w,
+  const HermitianEigCtrl<Field>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, BPre, w );
+      if( APre.Height() != APre.Width() || BPre.Height() != BPre.Width() )
+          LogicError("Hermitian matrices must be square.");
+    )
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre ), BProx( BPre );
+    auto& A = AProx.Get();
+    auto& B = BProx.Get();
+
+    Cholesky( uplo, B );
+    return herm_gen_def_eig::AfterCholesky( pencil, uplo, A, B, w, ctrl );
+}
+
+// Compute eigenpairs
+// ==================
+
+template<typename Field>
+HermitianEigInfo
+HermitianGenDefEig
+( Pencil pencil,
+  UpperOrLower uplo,
+  Matrix<Field>& A,
+  Matrix<Field>& B,
+  Matrix<Base<Field>>& w,
+  Matrix<Field>& X,
+  const HermitianEigCtrl<Field>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      if( A.Height() != A.Width() || B.Height() != B.Width() )
+          LogicError("Hermitian matrices must be square.");
+    )
+    Cholesky( uplo, B );
+    return herm_gen_def_eig::AfterCholesky( pencil, uplo, A, B, w, X, ctrl );
+}
+
+template<typename Field>
+HermitianEigInfo
+HermitianGenDefEig
+( Pencil pencil,
+  UpperOrLower uplo,
+  AbstractDistMatrix<Field>& APre,
+  AbstractDistMatrix<Field>& BPre,
+  AbstractDistMatrix<Base<Field>>& w,
+  AbstractDistMatrix<Field>& XPre,
+  const HermitianEigCtrl<Field>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      AssertSameGrids( APre, BPre, w, XPre );
+      if( APre.Height() != APre.Width() || BPre.Height() != BPre.Width() )
+          LogicError("Hermitian matrices must be square.");
+    )
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre ), BProx( BPre );
+    auto& A = AProx.Get();
+    auto& B = BProx.Get();
+
+    Cholesky( uplo, B );
+    return herm_gen_def_eig::AfterCholesky( pencil, uplo, A, B, w, XPre, ctrl );
+}
+
 #define PROTO(Field) \
+  template HermitianEigInfo herm_gen_def_eig::AfterCholesky \
+  ( Pencil pencil, \
+    UpperOrLower uplo, \
+          Matrix<Field>& A, \
+    const Matrix<Field>& B, \
+          Matrix<Base<Field>>& w, \
+    const HermitianEigCtrl<Field>& ctrl ); \
+  template HermitianEigInfo herm_gen_def_eig::AfterCholesky \
+  ( Pencil pencil, \
+    UpperOrLower uplo, \
+          AbstractDistMatrix<Field>& A, \
+    const AbstractDistMatrix<Field>& B, \
+          AbstractDistMatrix<Base<Field>>& w, \
+    const HermitianEigCtrl<Field>& ctrl ); \
+  template HermitianEigInfo herm_gen_def_eig::AfterCholesky \
+  ( Pencil pencil, \
+    UpperOrLower uplo, \
+          Matrix<Field>& A, \
+    const Matrix<Field>& B, \
+          Matrix<Base<Field>>& w, \
+          Matrix<Field>& X, \
+    const HermitianEigCtrl<Field>& ctrl ); \
+  template HermitianEigInfo herm_gen_def_eig::AfterCholesky \
+  ( Pencil pencil, \
+    UpperOrLower uplo, \
+          AbstractDistMatrix<Field>& A, \
+    const AbstractDistMatrix<Field>& B, \
+          AbstractDistMatrix<Base<Field>>& w, \
+          AbstractDistMatrix<Field>& X, \
+    const HermitianEigCtrl<Field>& ctrl ); \
   template HermitianEigInfo HermitianGenDefEig \
   ( Pencil pencil, \
     UpperOrLower uplo, \
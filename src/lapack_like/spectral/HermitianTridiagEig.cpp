@@ -10,6 +10,7 @@
 
 #include "./HermitianTridiagEig/QR.hpp"
 #include "./HermitianTridiagEig/DivideAndConquer.hpp"
+#include "./HermitianTridiagEig/SpectrumSlicing.hpp"
 
 // NOTE: dSubReal and QReal could be packed into their complex counterparts
 
@@ -559,7 +560,8 @@ DCHelper
     ctrlMod.wantEigVecs = false;
     DistMatrix<Real> Q(w.Grid());
     info.dcInfo =
-      DivideAndConquer( d_STAR_STAR.Matrix(), dSubReal.Matrix(), w, Q, ctrl );
+      DivideAndConquer
+      ( d_STAR_STAR.Matrix(), dSubReal.Matrix(), w, Q, ctrlMod );
     herm_eig::SortAndFilter( w, ctrl );
 
     return info;
@@ -575,6 +577,7 @@ MRRRHelper
   const HermitianTridiagEigCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    herm_tridiag_eig::SetMRRRThreads( ctrl.mrrrCtrl.numThreads );
     HermitianTridiagEigInfo info;
 
     ElementalProxyCtrl wCtrl;
@@ -672,6 +675,7 @@ MRRRHelper
   const HermitianTridiagEigCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    herm_tridiag_eig::SetMRRRThreads( ctrl.mrrrCtrl.numThreads );
     HermitianTridiagEigInfo info;
 
     ElementalProxyCtrl wCtrl;
@@ -1150,6 +1154,79 @@ DCHelper
     return info;
 }
 
+// PMRRR computes a contiguous block of the (nearly sorted) eigenpairs on each
+// process, whereas Q is distributed [STAR,VR]. Rather than sorting the
+// columns of Q by redistributing it to [VC,STAR] and back, the eigenvalues are
+// gathered so that each process can determine the final position of every
+// eigenpair, and each computed eigenvector is sent directly to the owner of
+// its final column of Q.
+template<typename Real>
+void DistributeMRRRPairs
+( const herm_tridiag_eig::Info& rangeInfo,
+  const vector<double>& wVector,
+        DistMatrix<Real,VR,STAR>& w,
+        DistMatrix<double,STAR,VR>& Q,
+        SortType sort )
+{
+    EL_DEBUG_CSE
+    const Int n = Q.Height();
+    const Int k = rangeInfo.numGlobalEigenvalues;
+    mpi::Comm comm = Q.RowComm();
+    const int commSize = mpi::Size( comm );
+
+    // Gather the eigenvalues in the order in which they were computed
+    const int numLocal = rangeInfo.numLocalEigenvalues;
+    const int firstLocal = rangeInfo.firstLocalEigenvalue;
+    vector<int> numLocals(commSize), firstLocals(commSize);
+    mpi::AllGather( &numLocal, 1, numLocals.data(), 1, comm );
+    mpi::AllGather( &firstLocal, 1, firstLocals.data(), 1, comm );
+    Matrix<double> wComputed( k, 1 );
+    mpi::AllGather
+    ( wVector.data(), numLocal,
+      wComputed.Buffer(), numLocals.data(), firstLocals.data(), comm );
+
+    auto sortPairs = TaggedSort( wComputed, sort );
+    vector<Int> finalIndex(k);
+    for( Int j=0; j<k; ++j )
+        finalIndex[sortPairs[j].index] = j;
+    w.Resize( k, 1 );
+    for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
+        w.SetLocal( iLoc, 0, Real(sortPairs[w.GlobalRow(iLoc)].value) );
+
+    // Pack each computed eigenvector for the owner of its final column
+    vector<int> sendCounts(commSize,0);
+    for( Int c=0; c<numLocal; ++c )
+        sendCounts[Q.RowOwner(finalIndex[firstLocal+c])] += n;
+    vector<int> sendOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    vector<double> sendBuf(totalSend);
+    auto offs = sendOffs;
+    for( Int c=0; c<numLocal; ++c )
+    {
+        const int owner = Q.RowOwner(finalIndex[firstLocal+c]);
+        MemCopy( &sendBuf[offs[owner]], Q.LockedBuffer(0,c), n );
+        offs[owner] += n;
+    }
+
+    // Exchange and unpack in the order in which the columns were packed
+    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
+    SwapClear( sendBuf );
+    Q.Resize( n, k );
+    Int recvOff = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        for( Int c=0; c<numLocals[q]; ++c )
+        {
+            const Int j = finalIndex[firstLocals[q]+c];
+            if( Q.IsLocalCol(j) )
+            {
+                MemCopy( Q.Buffer(0,Q.LocalCol(j)), &recvBuf[recvOff], n );
+                recvOff += n;
+            }
+        }
+    }
+}
+
 template<typename Real,
          typename=EnableIf<IsBlasScalar<Real>>>
 HermitianTridiagEigInfo
@@ -1161,6 +1238,7 @@ MRRRHelper
   const HermitianTridiagEigCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    herm_tridiag_eig::SetMRRRThreads( ctrl.mrrrCtrl.numThreads );
     // NOTE: The computation forces double-precision due to PMRRR limitations
     const Int n = d.Height();
     const Grid& g = d.Grid();
@@ -1218,15 +1296,7 @@ MRRRHelper
         rangeInfo = herm_tridiag_eig::Eig
           ( int(n), d_STAR_STAR.Buffer(), dSub_STAR_STAR.Buffer(),
             wVector.data(), Q.Buffer(), Q.LDim(), w.ColComm() );
-    w.Resize( rangeInfo.numGlobalEigenvalues, 1 );
-    Q.Resize( n, rangeInfo.numGlobalEigenvalues );
-    for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
-        w.SetLocal( iLoc, 0, Real(wVector[iLoc]) );
-
-    auto sortPairs = TaggedSort( w, ctrl.sort );
-    for( Int j=0; j<n; ++j )
-        w.Set( j, 0, sortPairs[j].value );
-    ApplyTaggedSortToEachRow( sortPairs, Q );
+    DistributeMRRRPairs( rangeInfo, wVector, w, Q, ctrl.sort );
 
     return info;
 }
@@ -1242,6 +1312,7 @@ MRRRHelper
   const HermitianTridiagEigCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    herm_tridiag_eig::SetMRRRThreads( ctrl.mrrrCtrl.numThreads );
     // NOTE: The computation forces double-precision due to PMRRR limitations
     const Int n = d.Height();
     const Grid& g = d.Grid();
@@ -1306,18 +1377,7 @@ MRRRHelper
         rangeInfo = herm_tridiag_eig::Eig
           ( int(n), d_STAR_STAR.Buffer(), dSubReal.Buffer(),
             wVector.data(), QReal.Buffer(), QReal.LDim(), w.ColComm() );
-
-    w.Resize( rangeInfo.numGlobalEigenvalues, 1 );
-    auto& wLoc = w.Matrix();
-    for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
-        wLoc(iLoc) = wVector[iLoc];
-
-    QReal.Resize( n, rangeInfo.numGlobalEigenvalues );
-
-    auto sortPairs = TaggedSort( w, ctrl.sort );
-    for( Int j=0; j<n; ++j )
-        w.Set( j, 0, sortPairs[j].value );
-    ApplyTaggedSortToEachRow( sortPairs, QReal );
+    DistributeMRRRPairs( rangeInfo, wVector, w, QReal, ctrl.sort );
 
     Copy( QReal, Q );
     DiagonalScale( LEFT, NORMAL, phase, Q );
@@ -1431,6 +1491,9 @@ HermitianTridiagEig
   const HermitianTridiagEigCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.numSlices > 1 && !ctrl.accumulateEigVecs &&
+        (ctrl.subset.indexSubset || ctrl.subset.rangeSubset) )
+        return herm_tridiag_eig::SpectrumSlicing( d, dSub, w, Q, ctrl );
     return herm_tridiag_eig::Helper( d, dSub, w, Q, ctrl );
 }
 
@@ -1514,19 +1577,7 @@ MRRRPostEstimateHelper
     auto rangeInfo = herm_tridiag_eig::Eig
     ( int(n), d_STAR_STAR.Buffer(), dSub_STAR_STAR.Buffer(), wVector.data(),
       Q.Buffer(), Q.LDim(), w.ColComm(), vl, vu );
-    const Int k = rangeInfo.numGlobalEigenvalues;
-
-    w.Resize( k, 1 );
-    for( Int iLoc=0; iLoc<w.LocalHeight(); ++iLoc )
-        w.SetLocal( iLoc, 0, Real(wVector[iLoc]) );
-
-    // Shrink Q
-    Q.Resize( n, k );
-
-    auto sortPairs = TaggedSort( w, sort );
-    for( Int j=0; j<n; ++j )
-        w.Set( j, 0, sortPairs[j].value );
-    ApplyTaggedSortToEachRow( sortPairs, Q );
+    DistributeMRRRPairs( rangeInfo, wVector, w, Q, sort );
 
     return info;
 }
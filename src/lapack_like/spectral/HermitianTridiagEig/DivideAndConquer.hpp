@@ -16,6 +16,73 @@ using El::schur::SplitGrid;
 namespace El {
 namespace herm_tridiag_eig {
 
+// Solve the secular equations with (global) indices firstIndex + jLoc*stride
+// for the columns jLoc of QSecularLoc, storing lambda_j in values(jLoc) and
+// overwriting the column with d - lambda_j, and then multiply the local
+// contributions to the corrected update vector,
+//
+//   rCorrected(k) = prod_j (d(k)-lambda_j) / prod_{j != k} (d(j)-d(k)),
+//
+// into rCorrected. The secular equations are independent, and so the local
+// block is solved in parallel.
+template<typename Real>
+SecularEVDInfo
+SecularBlock
+( const Matrix<Real>& dUndeflated,
+  const Real& rho,
+  const Matrix<Real>& zUndeflated,
+  Int firstIndex,
+  Int stride,
+        Matrix<Real>& values,
+        Matrix<Real>& QSecularLoc,
+        Matrix<Real>& rCorrected,
+  const SecularEVDCtrl<Real>& secularCtrl )
+{
+    EL_DEBUG_CSE
+    const Int numUndeflated = dUndeflated.Height();
+    const Int numLocal = QSecularLoc.Width();
+
+    vector<SecularEVDInfo> valueInfos( numLocal );
+    ParallelFor
+    ( numLocal,
+      [&]( Int jLoc )
+      {
+          const Int j = firstIndex + jLoc*stride;
+          auto minusShift = QSecularLoc( ALL, IR(jLoc) );
+          valueInfos[jLoc] =
+            SecularEigenvalue
+            ( j, dUndeflated, rho, zUndeflated, values(jLoc), minusShift,
+              secularCtrl );
+      } );
+
+    ParallelFor
+    ( numUndeflated,
+      [&]( Int k )
+      {
+          Real product = rCorrected(k);
+          for( Int jLoc=0; jLoc<numLocal; ++jLoc )
+          {
+              const Int j = firstIndex + jLoc*stride;
+              if( j == k )
+                  product *= QSecularLoc(k,jLoc);
+              else
+                  product *=
+                    QSecularLoc(k,jLoc) / (dUndeflated(j)-dUndeflated(k));
+          }
+          rCorrected(k) = product;
+      } );
+
+    SecularEVDInfo info;
+    for( const auto& valueInfo : valueInfos )
+    {
+        info.numIterations += valueInfo.numIterations;
+        info.numAlternations += valueInfo.numAlternations;
+        info.numCubicIterations += valueInfo.numCubicIterations;
+        info.numCubicFailures += valueInfo.numCubicFailures;
+    }
+    return info;
+}
+
 // The following is analogous to LAPACK's {s,d}laed{1,2,3} [CITATION] but does
 // not accept initial sorting permutations for w0 and w1, nor does it enforce
 // any ordering on the resulting eigenvalues.
@@ -431,30 +498,19 @@ Merge
     else
         QSecular.Resize( numUndeflated, numUndeflated );
 
-    for( Int j=0; j<numUndeflated; ++j )
     {
-        auto minusShift = QSecular( ALL, IR(j) );
-
         auto valueInfo =
-          SecularEigenvalue
-          ( j, dUndeflated, rho, zUndeflated, d(j), minusShift,
+          SecularBlock
+          ( dUndeflated, rho, zUndeflated, 0, 1, d, QSecular, rCorrected,
             dcCtrl.secularCtrl );
-        if( ctrl.progress )
-            Output("Secular eigenvalue ",j," is ",d(j));
-
         secularInfo.numIterations += valueInfo.numIterations;
         secularInfo.numAlternations += valueInfo.numAlternations;
         secularInfo.numCubicIterations += valueInfo.numCubicIterations;
         secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
-        {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) / (dUndeflated(j)-dUndeflated(k));
-        }
     }
+    if( ctrl.progress )
+        for( Int j=0; j<numUndeflated; ++j )
+            Output("Secular eigenvalue ",j," is ",d(j));
     for( Int j=0; j<numUndeflated; ++j )
         rCorrected(j) = Sgn(zUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
 
@@ -973,33 +1029,28 @@ Merge
     auto& dSecularLoc = dSecular.Matrix();
     auto& QSecularLoc = QSecular.Matrix();
 
+    // Each process solves the secular equations for its own columns of
+    // QSecular, and the corrected update vector is then the product of the
+    // local contributions.
     const Int numUndeflatedLoc = QSecularLoc.Width();
-    for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
     {
-        const Int j = QSecular.GlobalCol(jLoc);
-        auto minusShift = QSecularLoc( ALL, IR(jLoc) );
-
         auto valueInfo =
-          SecularEigenvalue
-          ( j, dUndeflated, rho, zUndeflated, dSecularLoc(jLoc),
-            minusShift, dcCtrl.secularCtrl );
-        if( ctrl.progress && amRoot )
-            Output("Secular eigenvalue ",j," is ",dSecularLoc(jLoc));
+          SecularBlock
+          ( dUndeflated, rho, zUndeflated, QSecular.RowShift(),
+            QSecular.RowStride(), dSecularLoc, QSecularLoc, rCorrected,
+            dcCtrl.secularCtrl );
 
         // We will sum these across all of the processors at the top-level
         secularInfo.numIterations += valueInfo.numIterations;
         secularInfo.numAlternations += valueInfo.numAlternations;
         secularInfo.numCubicIterations += valueInfo.numCubicIterations;
         secularInfo.numCubicFailures += valueInfo.numCubicFailures;
-
-        rCorrected(j) *= minusShift(j);
-        for( Int k=0; k<numUndeflated; ++k )
-        {
-            if( k == j )
-                continue;
-            rCorrected(k) *= minusShift(k) / (dUndeflated(j)-dUndeflated(k));
-        }
     }
+    if( ctrl.progress && amRoot )
+        for( Int jLoc=0; jLoc<numUndeflatedLoc; ++jLoc )
+            Output
+            ("Secular eigenvalue ",QSecular.GlobalCol(jLoc)," is ",
+             dSecularLoc(jLoc));
     AllReduce( rCorrected, g.VRComm(), mpi::PROD );
     for( Int j=0; j<numUndeflated; ++j )
         rCorrected(j) = Sgn(zUndeflated(j),false) * Sqrt(Abs(rCorrected(j)));
@@ -1219,6 +1270,28 @@ DivideAndConquer
     return info;
 }
 
+// Problems of size at most three are always run redundantly, while the cutoff
+// is only the heuristic for the redundant-versus-distributed policy. The
+// merges of the distributed algorithm are dominated by Gemm's over the
+// halving subproblems, each requiring a panel of collectives per block
+// column, while the redundant algorithm needs no input communication unless
+// its result is broadcast from the root.
+template<typename Real>
+bool RunRedundantly
+( Int n, const DCCtrl<Real>& dcCtrl, bool broadcast, const Grid& grid )
+{
+    if( n <= 3 )
+        return true;
+    const double size = n;
+    SubproblemCost cost;
+    cost.flops = 4*size*size*size/3;
+    cost.numInputEntries = ( broadcast ? size*size : 0 );
+    cost.numSyncs = 2*size/Blocksize() + 5*std::log2(size);
+    cost.numCommEntries = 4*size*size;
+    cost.entrySize = sizeof(Real);
+    return El::RunRedundantly( cost, grid.Size(), n <= dcCtrl.cutoff );
+}
+
 // We pass in mainDiag and superDiag in sequential form to avoid potential
 // confusion from avoiding unnecessarily creating separate copies distributed
 // (trivially) over subtrees.
@@ -1242,7 +1315,7 @@ DivideAndConquer
          "computation");
 
     DCInfo info;
-    if( n <= Max(dcCtrl.cutoff,3) )
+    if( RunRedundantly( n, dcCtrl, ctrl.qrCtrl.broadcast, grid ) )
     {
         // Run the problem redundantly locally
         auto ctrlMod( ctrl );
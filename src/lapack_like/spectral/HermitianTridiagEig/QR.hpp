@@ -94,7 +94,8 @@ void QLSweep
   Matrix<Base<Field>>& e,
   Matrix<Base<Field>>& cList,
   Matrix<Base<Field>>& sList,
-  Matrix<Field>& Q,
+  GivensSequenceBuffer<Field>& QRotations,
+  Int winBeg,
   const Base<Field>& shift,
   bool wantEigVecs )
 {
@@ -136,8 +137,7 @@ void QLSweep
     e(0) = g;
     if( wantEigVecs )
     {
-        ApplyGivensSequence
-        ( RIGHT, VARIABLE_GIVENS_SEQUENCE, BACKWARD, cList, sList, Q );
+        QRotations.Push( BACKWARD, winBeg, cList, sList );
     }
 }
 
@@ -147,7 +147,8 @@ void QRSweep
   Matrix<Base<Field>>& e,
   Matrix<Base<Field>>& cList,
   Matrix<Base<Field>>& sList,
-  Matrix<Field>& Q,
+  GivensSequenceBuffer<Field>& QRotations,
+  Int winBeg,
   const Base<Field>& shift,
   bool wantEigVecs )
 {
@@ -186,8 +187,7 @@ void QRSweep
     e(n-2) = g;
     if( wantEigVecs )
     {
-        ApplyGivensSequence
-        ( RIGHT, VARIABLE_GIVENS_SEQUENCE, FORWARD, cList, sList, Q );
+        QRotations.Push( FORWARD, winBeg, cList, sList );
     }
 }
 
@@ -226,7 +226,8 @@ Helper
 
     Matrix<Real> cList(n-1,1), sList(n-1,1);
     Matrix<Real> dSub, eSub;
-    Matrix<Field> QSub;
+    // The rotations of successive sweeps are applied to Q together
+    GivensSequenceBuffer<Field> QRotations( Q );
 
     const Int maxIter = n*ctrl.qrCtrl.maxIterPerEig;
     Int winBeg = 0;
@@ -343,6 +344,7 @@ Helper
                           lambda0, lambda1, c, s,
                           ctrl.qrCtrl.fullAccuracyTwoByTwo );
                         // Apply the Givens rotation from the right to Q
+                        QRotations.Flush();
                         blas::Rot
                         ( mQ, &Q(0,subWinBeg), 1, &Q(0,subWinBeg+1), 1, c, s );
                     }
@@ -372,14 +374,11 @@ Helper
                 // of these views
                 View( dSub, d, IR(subWinBeg,iterEnd), ALL );
                 View( eSub, e, IR(subWinBeg,Min(iterEnd,n-1)), ALL );
-                if( ctrl.wantEigVecs )
-                {
-                    View( QSub, Q, ALL, IR(subWinBeg,iterEnd) );
-                }
 
                 Real shift = WilkinsonShift( dSub(0), eSub(0), dSub(1) );
                 QLSweep
-                ( dSub, eSub, cList, sList, QSub, shift, ctrl.wantEigVecs );
+                ( dSub, eSub, cList, sList, QRotations, subWinBeg, shift,
+                  ctrl.wantEigVecs );
             }
         }
         else
@@ -437,6 +436,7 @@ Helper
                           lambda0, lambda1, c, s,
                           ctrl.qrCtrl.fullAccuracyTwoByTwo );
                         // Apply the Givens rotation from the right to Q
+                        QRotations.Flush();
                         blas::Rot
                         ( mQ, &Q(0,subWinEnd-2), 1, &Q(0,subWinEnd-1), 1,
                           c, s );
@@ -467,16 +467,13 @@ Helper
                 // of these views
                 View( dSub, d, IR(iterBeg,subWinEnd), ALL );
                 View( eSub, e, IR(iterBeg,Min(subWinEnd,n-1)), ALL );
-                if( ctrl.wantEigVecs )
-                {
-                    View( QSub, Q, ALL, IR(iterBeg,subWinEnd) );
-                }
 
                 Real shift =
                   WilkinsonShift
                   ( d(subWinEnd-1), e(subWinEnd-2), d(subWinEnd-2) );
                 QRSweep
-                ( dSub, eSub, cList, sList, QSub, shift, ctrl.wantEigVecs );
+                ( dSub, eSub, cList, sList, QRotations, iterBeg, shift,
+                  ctrl.wantEigVecs );
             }
         }
 
@@ -490,6 +487,7 @@ Helper
         }
         if( info.numIterations >= maxIter )
         {
+            QRotations.Flush();
             for( Int i=0; i<n-1; ++i )
                 if( e(i) != zero )
                     ++info.numUnconverged;
@@ -499,6 +497,7 @@ Helper
             return info;
         }
     }
+    QRotations.Flush();
 
     return info;
 }
@@ -0,0 +1,237 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HERM_TRIDIAG_EIG_SPECTRUM_SLICING_HPP
+#define EL_HERM_TRIDIAG_EIG_SPECTRUM_SLICING_HPP
+
+namespace El {
+namespace herm_tridiag_eig {
+namespace slicing {
+
+// Return the number of eigenvalues of the tridiagonal matrix T, with main
+// diagonal 'd' and squared off-diagonal magnitudes 'offDiagSquared', which
+// are less than sigma. By Sylvester's law of inertia, this is the number of
+// negative pivots in the LDL^H factorization of T - sigma I. As in LAPACK's
+// {s,d}stebz, pivots smaller in magnitude than 'pivotMin' are replaced with
+// -pivotMin.
+template<typename Real>
+Int NumEigsBelow
+( const Matrix<Real>& d,
+  const Matrix<Real>& offDiagSquared,
+  const Real& sigma,
+  const Real& pivotMin )
+{
+    const Int n = d.Height();
+    Int numNegative = 0;
+    Real pivot = Real(1);
+    for( Int i=0; i<n; ++i )
+    {
+        pivot = d(i) - sigma - ( i > 0 ? offDiagSquared(i-1)/pivot : Real(0) );
+        if( Abs(pivot) < pivotMin )
+            pivot = -pivotMin;
+        if( pivot < Real(0) )
+            ++numNegative;
+    }
+    return numNegative;
+}
+
+// Split the processes of the grid into 'numSlices' contiguous teams and
+// return the index of the team containing this process
+inline Int FormTeams
+( const Grid& grid, Int numSlices, vector<unique_ptr<Grid>>& teamGrids )
+{
+    EL_DEBUG_CSE
+    const Int p = grid.Size();
+    const Int rank = grid.Rank();
+    mpi::Group owningGroup = grid.OwningGroup();
+    teamGrids.resize( numSlices );
+    Int team = 0;
+    for( Int s=0; s<numSlices; ++s )
+    {
+        const Int firstRank = (s*p) / numSlices;
+        const Int teamSize = ((s+1)*p) / numSlices - firstRank;
+        if( rank >= firstRank && rank < firstRank+teamSize )
+            team = s;
+
+        vector<int> teamRanks(teamSize);
+        for( Int j=0; j<teamSize; ++j )
+            teamRanks[j] = firstRank + j;
+        mpi::Group teamGroup;
+        mpi::Incl( owningGroup, teamSize, teamRanks.data(), teamGroup );
+        teamGrids[s].reset
+        ( new Grid
+          ( grid.VCComm(), teamGroup, Grid::DefaultHeight(teamSize) ) );
+        mpi::Free( teamGroup );
+    }
+    return team;
+}
+
+} // namespace slicing
+
+// Split the requested subset of the spectrum into (at most) ctrl.numSlices
+// contiguous index ranges of nearly equal size and solve for each on its own
+// team of processes. A value range is first converted into an index range
+// using the eigenvalue counts of T - lowerBound I and T - upperBound I, so
+// that no eigenvalue can be lost or duplicated between neighbouring slices.
+// The eigenpairs of each slice are then copied into the eigenvalues and
+// eigenvectors over the full grid.
+//
+// This is only worthwhile when the tridiagonal solver computes just the
+// requested eigenvectors (i.e., MRRR), as the QR and Divide and Conquer
+// solvers form all of them before discarding the rest.
+template<typename Field>
+HermitianTridiagEigInfo
+SpectrumSlicing
+( const AbstractDistMatrix<Base<Field>>& d,
+  const AbstractDistMatrix<Field>& dSub,
+        AbstractDistMatrix<Base<Field>>& wPre,
+        AbstractDistMatrix<Field>& QPre,
+  const HermitianTridiagEigCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = d.Height();
+    const Grid& grid = d.Grid();
+
+    HermitianTridiagEigCtrl<Real> sliceCtrl( ctrl );
+    sliceCtrl.numSlices = 1;
+
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR( d );
+    DistMatrix<Field,STAR,STAR> dSub_STAR_STAR( dSub );
+    const auto& dLoc = d_STAR_STAR.LockedMatrix();
+    const auto& dSubLoc = dSub_STAR_STAR.LockedMatrix();
+
+    // Count the eigenvalues in the requested subset
+    Int firstIndex, numEigs;
+    if( ctrl.subset.indexSubset )
+    {
+        firstIndex = ctrl.subset.lowerIndex;
+        numEigs = ctrl.subset.upperIndex - ctrl.subset.lowerIndex + 1;
+    }
+    else
+    {
+        Matrix<Real> offDiagSquared( Max(n-1,Int(0)), 1 );
+        Real maxOffDiagSquared = Real(0);
+        for( Int j=0; j<n-1; ++j )
+        {
+            const Real beta = Abs(dSubLoc(j));
+            offDiagSquared(j) = beta*beta;
+            maxOffDiagSquared = Max( maxOffDiagSquared, beta*beta );
+        }
+        const Real pivotMin =
+          limits::SafeMin<Real>()*Max(Real(1),maxOffDiagSquared);
+        firstIndex = slicing::NumEigsBelow
+          ( dLoc, offDiagSquared, ctrl.subset.lowerBound, pivotMin );
+        numEigs = slicing::NumEigsBelow
+          ( dLoc, offDiagSquared, ctrl.subset.upperBound, pivotMin ) -
+          firstIndex;
+    }
+    const Int numSlices = Min( Min(ctrl.numSlices,Int(grid.Size())), numEigs );
+    if( numSlices <= 1 )
+        return HermitianTridiagEig( d, dSub, wPre, QPre, sliceCtrl );
+
+    // Solve for our team's slice of the spectrum
+    vector<unique_ptr<Grid>> teamGrids;
+    const Int team = slicing::FormTeams( grid, numSlices, teamGrids );
+    const Grid& teamGrid = *teamGrids[team];
+    sliceCtrl.sort = ASCENDING;
+    sliceCtrl.subset.indexSubset = true;
+    sliceCtrl.subset.rangeSubset = false;
+    sliceCtrl.subset.lowerIndex = firstIndex + (team*numEigs)/numSlices;
+    sliceCtrl.subset.upperIndex = firstIndex + ((team+1)*numEigs)/numSlices - 1;
+
+    DistMatrix<Real,STAR,STAR> dTeam(teamGrid), wTeam(teamGrid);
+    DistMatrix<Field,STAR,STAR> dSubTeam(teamGrid);
+    DistMatrix<Field> QTeam(teamGrid);
+    dTeam.Resize( n, 1 );
+    dTeam.Matrix() = dLoc;
+    dSubTeam.Resize( dSubLoc.Height(), 1 );
+    dSubTeam.Matrix() = dSubLoc;
+    auto teamInfo =
+      HermitianTridiagEig( dTeam, dSubTeam, wTeam, QTeam, sliceCtrl );
+
+    // Combine the iteration counts from the root of each team
+    const bool teamRoot = ( teamGrid.Rank() == 0 );
+    Matrix<Int> counts;
+    Zeros( counts, 9, 1 );
+    if( teamRoot )
+    {
+        const auto& secularInfo = teamInfo.dcInfo.secularInfo;
+        counts(0) = teamInfo.qrInfo.numUnconverged;
+        counts(1) = teamInfo.qrInfo.numIterations;
+        counts(2) = secularInfo.numIterations;
+        counts(3) = secularInfo.numAlternations;
+        counts(4) = secularInfo.numCubicIterations;
+        counts(5) = secularInfo.numCubicFailures;
+        counts(6) = secularInfo.numDeflations;
+        counts(7) = secularInfo.numCloseDiagonalDeflations;
+        counts(8) = secularInfo.numSmallUpdateDeflations;
+    }
+    AllReduce( counts, grid.Comm() );
+    HermitianTridiagEigInfo info;
+    auto& secularInfo = info.dcInfo.secularInfo;
+    info.qrInfo.numUnconverged = counts(0);
+    info.qrInfo.numIterations = counts(1);
+    secularInfo.numIterations = counts(2);
+    secularInfo.numAlternations = counts(3);
+    secularInfo.numCubicIterations = counts(4);
+    secularInfo.numCubicFailures = counts(5);
+    secularInfo.numDeflations = counts(6);
+    secularInfo.numCloseDiagonalDeflations = counts(7);
+    secularInfo.numSmallUpdateDeflations = counts(8);
+
+    // Assemble the slices, in order, over the full grid
+    Matrix<Int> sliceSizes;
+    Zeros( sliceSizes, numSlices, 1 );
+    if( teamRoot )
+        sliceSizes(team) = wTeam.Height();
+    AllReduce( sliceSizes, grid.Comm() );
+    Int numFound = 0;
+    for( Int s=0; s<numSlices; ++s )
+        numFound += sliceSizes(s);
+
+    DistMatrixWriteProxy<Real,Real,STAR,STAR> wProx( wPre );
+    DistMatrixWriteProxy<Field,Field,MC,MR> QProx( QPre );
+    auto& w = wProx.Get();
+    auto& Q = QProx.Get();
+    w.Resize( numFound, 1 );
+    Q.Resize( n, numFound );
+    const bool includeViewers = true;
+    Int offset = 0;
+    for( Int s=0; s<numSlices; ++s )
+    {
+        DistMatrix<Real,STAR,STAR> wOther(*teamGrids[s]);
+        DistMatrix<Field> QOther(*teamGrids[s]);
+        auto& wSlice = ( s == team ? wTeam : wOther );
+        auto& QSlice = ( s == team ? QTeam : QOther );
+        wSlice.MakeConsistent( includeViewers );
+        QSlice.MakeConsistent( includeViewers );
+
+        const Range<Int> sliceInd( offset, offset+sliceSizes(s) );
+        auto wS = w( sliceInd, ALL );
+        auto QS = Q( ALL, sliceInd );
+        wS = wSlice;
+        QS = QSlice;
+        offset += sliceSizes(s);
+    }
+
+    if( ctrl.sort == DESCENDING )
+    {
+        auto sortPairs = TaggedSort( w, ctrl.sort );
+        for( Int j=0; j<numFound; ++j )
+            w.Set( j, 0, sortPairs[j].value );
+        ApplyTaggedSortToEachRow( sortPairs, Q );
+    }
+
+    return info;
+}
+
+} // namespace herm_tridiag_eig
+} // namespace El
+
+#endif // ifndef EL_HERM_TRIDIAG_EIG_SPECTRUM_SLICING_HPP
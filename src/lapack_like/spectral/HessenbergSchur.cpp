@@ -64,15 +64,11 @@ ScaLAPACKHelper
     AssertScaLAPACKSupport();
     HessenbergSchurInfo info;
 
-    ProxyCtrl proxyCtrl;
-    proxyCtrl.colConstrain = true;
-    proxyCtrl.rowConstrain = true;
-    proxyCtrl.blockHeight = ctrl.blockHeight;
-    proxyCtrl.blockWidth = ctrl.blockHeight;
+    // Square blocks with zero alignments are used in place
+    auto proxyCtrl =
+      ScaLAPACKProxyCtrl( HPre, ctrl.blockHeight, ctrl.blockHeight, true );
     proxyCtrl.colAlign = 0;
     proxyCtrl.rowAlign = 0;
-    proxyCtrl.colCut = 0;
-    proxyCtrl.rowCut = 0;
 
     DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK> HProx( HPre, proxyCtrl );
     auto& H = HProx.Get();
@@ -131,15 +127,11 @@ ScaLAPACKHelper
     AssertScaLAPACKSupport();
     HessenbergSchurInfo info;
 
-    ProxyCtrl proxyCtrl;
-    proxyCtrl.colConstrain = true;
-    proxyCtrl.rowConstrain = true;
-    proxyCtrl.blockHeight = ctrl.blockHeight;
-    proxyCtrl.blockWidth = ctrl.blockHeight;
+    // Square blocks with zero alignments are used in place
+    auto proxyCtrl =
+      ScaLAPACKProxyCtrl( HPre, ctrl.blockHeight, ctrl.blockHeight, true );
     proxyCtrl.colAlign = 0;
     proxyCtrl.rowAlign = 0;
-    proxyCtrl.colCut = 0;
-    proxyCtrl.rowCut = 0;
 
     DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK> HProx( HPre, proxyCtrl );
     auto& H = HProx.Get();
@@ -10,11 +10,13 @@
 #define EL_HESS_SCHUR_AED_HPP
 
 #include "./Simple.hpp"
+#include "./Placement.hpp"
 #include "./MultiBulge/Sweep.hpp"
 #include "./AED/UpdateDeflationSize.hpp"
 #include "./AED/ModifyShifts.hpp"
 #include "./AED/SpikeDeflation.hpp"
 #include "./AED/Nibble.hpp"
+#include "./AED/ShrinkGrid.hpp"
 
 namespace El {
 namespace hess_schur {
@@ -189,19 +191,25 @@ AED
     Int winEnd = ( ctrl.winEnd==END ? n : ctrl.winEnd );
     const Int winSize = winEnd - winBeg;
 
-    Int minMultiBulgeSize = Max( ctrl.minMultiBulgeSize, 4 );
-    // TODO(poulson): Implement a more reasonable/configurable means of deciding
-    // when to call the sequential implementation
-    minMultiBulgeSize = Max( minMultiBulgeSize, 2*blockSize );
-    // This maximum is meant to account for parallel overheads and needs to be
-    // more principled (and perhaps based upon the number of workers and the
-    // cluster characteristics)
-    minMultiBulgeSize = Max( minMultiBulgeSize, ctrl.minDistMultiBulgeSize );
+    // Windows below this size are always handled redundantly; larger windows
+    // are handled redundantly (or on a subgrid) when WindowPlacement says so
+    const Int minBulgeChaseSize =
+      Max( Max( ctrl.minMultiBulgeSize, Int(4) ), 2*blockSize );
+    auto handleRedundantly = [&]( Int size )
+    {
+        return WindowPlacement<Field>
+          ( size, minBulgeChaseSize, blockSize, grid, ctrl ).placement ==
+          GO_REDUNDANT;
+    };
+    // This maximum is meant to account for parallel overheads when deciding
+    // whether a sweep may be skipped
+    const Int minMultiBulgeSize =
+      Max( minBulgeChaseSize, ctrl.minDistMultiBulgeSize );
 
     HessenbergSchurInfo info;
 
     w.Resize( n, 1 );
-    if( winSize < minMultiBulgeSize )
+    if( handleRedundantly(winSize) )
     {
         return multibulge::RedundantlyHandleWindow( H, w, Z, ctrl );
     }
@@ -227,6 +235,7 @@ AED
 
     Int decreaseLevel = -1;
     DistMatrix<Field,STAR,STAR> hMainWin(grid), hSubWin(grid);
+    const bool eigvalsOnly = !ctrl.fullTriangle && !ctrl.wantSchurVecs;
     while( winBeg < winEnd )
     {
         if( info.numIterations >= maxIter )
@@ -237,6 +246,38 @@ AED
                 break;
         }
 
+        if( eigvalsOnly && grid.Size() > 1 )
+        {
+            // Continue on a smaller (square) subgrid, or a single process,
+            // once the active window no longer justifies the full grid
+            const auto placement =
+              WindowPlacement<Field>
+              ( winEnd-winBeg, minBulgeChaseSize, blockSize, grid, ctrl,
+                true );
+            if( placement.placement != STAY_DISTRIBUTED )
+            {
+                const Int subgridHeight =
+                  Int(std::round(sqrt(double(placement.teamSize))));
+                if( ctrl.progress && grid.Rank() == 0 )
+                    Output
+                    ("Moving window [",winBeg,",",winEnd,") onto a ",
+                     subgridHeight," x ",subgridHeight," subgrid");
+                auto ctrlWin( ctrl );
+                ctrlWin.winBeg = winBeg;
+                ctrlWin.winEnd = winEnd;
+                HessenbergSchurInfo infoWin;
+                if( subgridHeight > 1 )
+                    infoWin =
+                      aed::EigenvaluesOnSubgrid( H, w, subgridHeight, ctrlWin );
+                else
+                    infoWin =
+                      multibulge::RedundantlyHandleWindow( H, w, Z, ctrlWin );
+                info.numIterations += infoWin.numIterations;
+                info.numUnconverged = infoWin.numUnconverged;
+                return info;
+            }
+        }
+
         // Detect an irreducible Hessenberg window, [iterBeg,winEnd)
         // ---------------------------------------------------------
         // TODO(poulson): Describe why we don't use DetectSmallSubdiagonal
@@ -252,7 +293,7 @@ AED
             Output("Iter. ",info.numIterations,": ");
             Output("  window is [",iterBeg,",",winEnd,")");
         }
-        if( winEnd-iterBeg < minMultiBulgeSize )
+        if( handleRedundantly(winEnd-iterBeg) )
         {
             // The window is small enough to switch to the simple scheme
             if( ctrl.progress && grid.Rank() == 0 )
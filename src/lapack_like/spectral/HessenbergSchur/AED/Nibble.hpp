@@ -15,61 +15,42 @@ namespace El {
 namespace hess_schur {
 namespace aed {
 
+// The control structure for computing the Schur decomposition of the
+// deflation window
+inline HessenbergSchurCtrl WindowSchurCtrl( const HessenbergSchurCtrl& ctrl )
+{
+    auto ctrlSub( ctrl );
+    ctrlSub.winBeg = 0;
+    ctrlSub.winEnd = END;
+    ctrlSub.fullTriangle = true;
+    ctrlSub.wantSchurVecs = true;
+    ctrlSub.accumulateSchurVecs = false;
+    ctrlSub.demandConverged = false;
+    ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
+                                      : HESSENBERG_SCHUR_MULTIBULGE );
+    return ctrlSub;
+}
+
+// Given the Schur decomposition H = V T V' of the deflation window, where
+// the first 'numUnconverged' eigenvalues of T did not converge, deflate
+// from the spike and return the window to Hessenberg form.
 // The spike value will be overwritten
 template<typename Real>
-AEDInfo NibbleHelper
+AEDInfo NibbleFromSchur
 ( Matrix<Real>& H,
+  Matrix<Real>& T,
+  Matrix<Real>& V,
+  Int numUnconverged,
   Real& spikeValue,
   Matrix<Complex<Real>>& w,
-  Matrix<Real>& V,
   const HessenbergSchurCtrl& ctrl )
 {
     EL_DEBUG_CSE
     const Int n = H.Height();
-    AEDInfo info;
-
     const Real zero(0);
-    const Real ulp = limits::Precision<Real>();
-    const Real safeMin = limits::SafeMin<Real>();
-    const Real smallNum = safeMin*(Real(n)/ulp);
-
-    Zeros( V, 0, 0 );
-    if( n == 1 )
-    {
-        w(0) = H(0,0);
-        if( Abs(spikeValue) <= Max( smallNum, ulp*Abs(w(0).real()) ) )
-        {
-            // The offdiagonal entry was small enough to deflate
-            info.numDeflated = 1;
-            spikeValue = zero;
-        }
-        else
-        {
-            // The offdiagonal entry was too large to deflate
-            info.numShiftCandidates = 1;
-        }
-        return info;
-    }
-
-    // NOTE(poulson): We could only copy the upper-Hessenberg portion of H
-    auto T( H ); // TODO(poulson): Reuse this matrix?
-    Identity( V, n, n );
-    auto ctrlSub( ctrl );
-    ctrlSub.winBeg = 0;
-    ctrlSub.winEnd = n;
-    ctrlSub.fullTriangle = true;
-    ctrlSub.wantSchurVecs = true;
-    ctrlSub.demandConverged = false;
-    ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
-                                      : HESSENBERG_SCHUR_MULTIBULGE );
-    auto infoSub = HessenbergSchur( T, w, V, ctrlSub );
-    EL_DEBUG_ONLY(
-      if( infoSub.numUnconverged != 0 )
-          Output(infoSub.numUnconverged," eigenvalues did not converge");
-    )
 
     vector<Real> work(2*n);
-    info = SpikeDeflation( T, V, spikeValue, infoSub.numUnconverged, work );
+    AEDInfo info = SpikeDeflation( T, V, spikeValue, numUnconverged, work );
     if( ctrl.progress )
     {
         if( info.numUnconverged > 0 )
@@ -187,60 +168,22 @@ AEDInfo NibbleHelper
 }
 
 template<typename Real>
-AEDInfo NibbleHelper
+AEDInfo NibbleFromSchur
 ( Matrix<Complex<Real>>& H,
+  Matrix<Complex<Real>>& T,
+  Matrix<Complex<Real>>& V,
+  Int numUnconverged,
   Complex<Real>& spikeValue,
   Matrix<Complex<Real>>& w,
-  Matrix<Complex<Real>>& V,
   const HessenbergSchurCtrl& ctrl )
 {
     EL_DEBUG_CSE
     typedef Complex<Real> Field;
     const Int n = H.Height();
-    AEDInfo info;
-
     const Real zero(0);
-    const Real ulp = limits::Precision<Real>();
-    const Real safeMin = limits::SafeMin<Real>();
-    const Real smallNum = safeMin*(Real(n)/ulp);
-
-    Zeros( V, 0, 0 );
-    if( n == 1 )
-    {
-        w(0) = H(0,0);
-        if( OneAbs(spikeValue) <= Max( smallNum, ulp*OneAbs(w(0)) ) )
-        {
-            // The offdiagonal entry was small enough to deflate
-            info.numDeflated = 1;
-            spikeValue = zero;
-        }
-        else
-        {
-            // The offdiagonal entry was too large to deflate
-            info.numShiftCandidates = 1;
-        }
-        return info;
-    }
-
-    // NOTE(poulson): We could only copy the upper-Hessenberg portion of H
-    auto T( H ); // TODO(poulson): Reuse this matrix?
-    Identity( V, n, n );
-    auto ctrlSub( ctrl );
-    ctrlSub.winBeg = 0;
-    ctrlSub.winEnd = n;
-    ctrlSub.fullTriangle = true;
-    ctrlSub.wantSchurVecs = true;
-    ctrlSub.demandConverged = false;
-    ctrlSub.alg = ( ctrl.recursiveAED ? HESSENBERG_SCHUR_AED
-                                      : HESSENBERG_SCHUR_MULTIBULGE );
-    auto infoSub = HessenbergSchur( T, w, V, ctrlSub );
-    EL_DEBUG_ONLY(
-      if( infoSub.numUnconverged != 0 )
-          Output(infoSub.numUnconverged," eigenvalues did not converge");
-    )
 
     vector<Field> work(2*n);
-    info = SpikeDeflation( T, V, spikeValue, infoSub.numUnconverged, work );
+    AEDInfo info = SpikeDeflation( T, V, spikeValue, numUnconverged, work );
     if( ctrl.progress )
     {
         if( info.numUnconverged > 0 )
@@ -337,6 +280,53 @@ AEDInfo NibbleHelper
     return info;
 }
 
+// The spike value will be overwritten
+template<typename Field>
+AEDInfo NibbleHelper
+( Matrix<Field>& H,
+  Field& spikeValue,
+  Matrix<Complex<Base<Field>>>& w,
+  Matrix<Field>& V,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int n = H.Height();
+    AEDInfo info;
+
+    const Real ulp = limits::Precision<Real>();
+    const Real safeMin = limits::SafeMin<Real>();
+    const Real smallNum = safeMin*(Real(n)/ulp);
+
+    Zeros( V, 0, 0 );
+    if( n == 1 )
+    {
+        w(0) = H(0,0);
+        if( OneAbs(spikeValue) <= Max( smallNum, ulp*OneAbs(w(0)) ) )
+        {
+            // The offdiagonal entry was small enough to deflate
+            info.numDeflated = 1;
+            spikeValue = Field(0);
+        }
+        else
+        {
+            // The offdiagonal entry was too large to deflate
+            info.numShiftCandidates = 1;
+        }
+        return info;
+    }
+
+    // NOTE(poulson): We could only copy the upper-Hessenberg portion of H
+    auto T( H ); // TODO(poulson): Reuse this matrix?
+    auto infoSub = HessenbergSchur( T, w, V, WindowSchurCtrl(ctrl) );
+    EL_DEBUG_ONLY(
+      if( infoSub.numUnconverged != 0 )
+          Output(infoSub.numUnconverged," eigenvalues did not converge");
+    )
+    return NibbleFromSchur
+      ( H, T, V, infoSub.numUnconverged, spikeValue, w, ctrl );
+}
+
 template<typename Field>
 AEDInfo Nibble
 ( Matrix<Field>& H,
@@ -396,6 +386,93 @@ AEDInfo Nibble
     return info;
 }
 
+// Return the height of the square subgrid over which the Schur decomposition
+// of a distributed deflation window should be computed, or one if it should
+// be computed on a single process. The subgrid is chosen so that each of its
+// process rows owns at least two distribution blocks of the window.
+template<typename Field>
+Int SubgridHeight
+( const Grid& grid,
+  Int windowSize,
+  const DistMatrix<Field,MC,MR,BLOCK>& H,
+  const HessenbergSchurCtrl& ctrl )
+{
+    if( windowSize < ctrl.minSubgridAEDSize )
+        return 1;
+    const Int maxHeight = Int(sqrt(double(grid.Size())));
+    return Max( Min( maxHeight, windowSize/(2*H.BlockHeight()) ), Int(1) );
+}
+
+// Redundantly gather the deflation window, compute its Schur decomposition
+// over a square subgrid formed from the first processes of the grid, and
+// gather the Schur factor and vectors onto the root of the subgrid. The VC
+// rank of this root within the original grid is returned. Only the eigenvalues
+// on the root are meaningful.
+//
+// This is in the spirit of ScaLAPACK's PDLAQR3, which redistributes large
+// deflation windows onto a subgrid rather than solving them on one process.
+template<typename Field>
+int SubgridSchur
+( const DistMatrix<Field,MC,MR,BLOCK>& HDefl,
+        Int subgridHeight,
+        Matrix<Field>& T,
+        Matrix<Field>& V,
+        Matrix<Complex<Base<Field>>>& w,
+        Int& numUnconverged,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = HDefl.Height();
+    const Int blockSize = HDefl.BlockHeight();
+    const Grid& grid = HDefl.Grid();
+
+    const Int subgridSize = subgridHeight*subgridHeight;
+    vector<int> subgridRanks(subgridSize);
+    for( Int q=0; q<subgridSize; ++q )
+        subgridRanks[q] = q;
+    mpi::Group subgridGroup;
+    mpi::Incl
+    ( grid.OwningGroup(), subgridSize, subgridRanks.data(), subgridGroup );
+    const Grid subgrid( grid.VCComm(), subgridGroup, subgridHeight );
+    mpi::Free( subgridGroup );
+
+    DistMatrix<Field,STAR,STAR> HDefl_STAR_STAR( grid );
+    HDefl_STAR_STAR = HDefl;
+
+    bool isRoot = false;
+    if( subgrid.InGrid() )
+    {
+        const auto& HDeflLoc = HDefl_STAR_STAR.LockedMatrix();
+        DistMatrix<Field,MC,MR,BLOCK>
+          TSub( n, n, subgrid, blockSize, blockSize ),
+          VSub( subgrid, blockSize, blockSize );
+        auto& TSubLoc = TSub.Matrix();
+        for( Int jLoc=0; jLoc<TSub.LocalWidth(); ++jLoc )
+        {
+            const Int j = TSub.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<TSub.LocalHeight(); ++iLoc )
+                TSubLoc(iLoc,jLoc) = HDeflLoc(TSub.GlobalRow(iLoc),j);
+        }
+
+        DistMatrix<Complex<Base<Field>>,STAR,STAR> wSub( subgrid );
+        auto infoSub =
+          HessenbergSchur( TSub, wSub, VSub, WindowSchurCtrl(ctrl) );
+        numUnconverged = infoSub.numUnconverged;
+
+        DistMatrix<Field,CIRC,CIRC> T_CIRC_CIRC(subgrid), V_CIRC_CIRC(subgrid);
+        T_CIRC_CIRC = TSub;
+        V_CIRC_CIRC = VSub;
+        isRoot = ( T_CIRC_CIRC.CrossRank() == T_CIRC_CIRC.Root() );
+        if( isRoot )
+        {
+            T = T_CIRC_CIRC.Matrix();
+            V = V_CIRC_CIRC.Matrix();
+            w = wSub.Matrix();
+        }
+    }
+    return mpi::AllReduce( isRoot ? grid.VCRank() : 0, grid.VCComm() );
+}
+
 template<typename Field>
 AEDInfo Nibble
 ( DistMatrix<Field,MC,MR,BLOCK>& H,
@@ -423,18 +500,35 @@ AEDInfo Nibble
     auto HDefl = H( deflateInd, deflateInd );
     auto wDefl = w( deflateInd, ALL );
 
-    const int owner = HDefl.Owner(0,0);
+    // Large deflation windows have their Schur decompositions computed over a
+    // subgrid, whose root then finishes the deflation
+    const Int subgridHeight = SubgridHeight( grid, blockSize, H, ctrl );
+    Matrix<Field> T, V;
+    Int numUnconverged = 0;
+    int owner;
+    if( subgridHeight > 1 )
+        owner = SubgridSchur
+          ( HDefl, subgridHeight, T, V, wDefl.Matrix(), numUnconverged, ctrl );
+    else
+        owner = HDefl.Owner(0,0);
+
     DistMatrix<Field,CIRC,CIRC> HDefl_CIRC_CIRC( grid, owner );
     HDefl_CIRC_CIRC = HDefl;
     Field spikeValue =
       ( deflateBeg==winBeg ? Field(0) : H.Get(deflateBeg,deflateBeg-1) );
     Int VSize = 0;
-    Matrix<Field> V;
     if( HDefl_CIRC_CIRC.CrossRank() == HDefl_CIRC_CIRC.Root() )
     {
-        info =
-          NibbleHelper
-          ( HDefl_CIRC_CIRC.Matrix(), spikeValue, wDefl.Matrix(), V, ctrl );
+        if( subgridHeight > 1 )
+            info =
+              NibbleFromSchur
+              ( HDefl_CIRC_CIRC.Matrix(), T, V, numUnconverged, spikeValue,
+                wDefl.Matrix(), ctrl );
+        else
+            info =
+              NibbleHelper
+              ( HDefl_CIRC_CIRC.Matrix(), spikeValue, wDefl.Matrix(), V,
+                ctrl );
         VSize = V.Height();
     }
     El::Broadcast( wDefl, HDefl_CIRC_CIRC.CrossComm(), HDefl_CIRC_CIRC.Root() );
@@ -0,0 +1,88 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HESS_SCHUR_AED_SHRINK_GRID_HPP
+#define EL_HESS_SCHUR_AED_SHRINK_GRID_HPP
+
+namespace El {
+namespace hess_schur {
+namespace aed {
+
+// When only eigenvalues are requested, the active window forms an independent
+// problem (see WindowPlacement). Gather it onto a square subgrid formed from
+// the first processes of the grid, compute its eigenvalues there, and
+// broadcast them to the entire grid
+template<typename Field>
+HessenbergSchurInfo
+EigenvaluesOnSubgrid
+( const DistMatrix<Field,MC,MR,BLOCK>& H,
+        DistMatrix<Complex<Base<Field>>,STAR,STAR>& w,
+        Int subgridHeight,
+  const HessenbergSchurCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int n = H.Height();
+    const Int winBeg = ( ctrl.winBeg==END ? n : ctrl.winBeg );
+    const Int winEnd = ( ctrl.winEnd==END ? n : ctrl.winEnd );
+    const Int winSize = winEnd - winBeg;
+    const Int blockSize = H.BlockHeight();
+    const Grid& grid = H.Grid();
+    const auto winInd = IR(winBeg,winEnd);
+
+    const Int subgridSize = subgridHeight*subgridHeight;
+    vector<int> subgridRanks(subgridSize);
+    for( Int q=0; q<subgridSize; ++q )
+        subgridRanks[q] = q;
+    mpi::Group subgridGroup;
+    mpi::Incl
+    ( grid.OwningGroup(), subgridSize, subgridRanks.data(), subgridGroup );
+    const Grid subgrid( grid.VCComm(), subgridGroup, subgridHeight );
+    mpi::Free( subgridGroup );
+
+    DistMatrix<Field,STAR,STAR> HWin_STAR_STAR( grid );
+    HWin_STAR_STAR = H( winInd, winInd );
+
+    HessenbergSchurInfo info;
+    bool isRoot = false;
+    auto wWin = w( winInd, ALL );
+    if( subgrid.InGrid() )
+    {
+        const auto& HWinLoc = HWin_STAR_STAR.LockedMatrix();
+        DistMatrix<Field,MC,MR,BLOCK>
+          HSub( winSize, winSize, subgrid, blockSize, blockSize );
+        auto& HSubLoc = HSub.Matrix();
+        for( Int jLoc=0; jLoc<HSub.LocalWidth(); ++jLoc )
+        {
+            const Int j = HSub.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<HSub.LocalHeight(); ++iLoc )
+                HSubLoc(iLoc,jLoc) = HWinLoc(HSub.GlobalRow(iLoc),j);
+        }
+
+        auto ctrlSub( ctrl );
+        ctrlSub.winBeg = 0;
+        ctrlSub.winEnd = END;
+        DistMatrix<Complex<Base<Field>>,STAR,STAR> wSub( subgrid );
+        info = HessenbergSchur( HSub, wSub, ctrlSub );
+
+        isRoot = ( subgrid.VCRank() == 0 );
+        if( isRoot )
+            wWin.Matrix() = wSub.LockedMatrix();
+    }
+    const int root =
+      mpi::AllReduce( isRoot ? grid.VCRank() : 0, grid.VCComm() );
+    El::Broadcast( wWin.Matrix(), grid.VCComm(), root );
+    mpi::Broadcast( info.numUnconverged, root, grid.VCComm() );
+    mpi::Broadcast( info.numIterations, root, grid.VCComm() );
+    return info;
+}
+
+} // namespace aed
+} // namespace hess_schur
+} // namespace El
+
+#endif // ifndef EL_HESS_SCHUR_AED_SHRINK_GRID_HPP
@@ -10,6 +10,7 @@
 #define EL_HESS_SCHUR_MULTIBULGE_HPP
 
 #include "./Simple.hpp"
+#include "./Placement.hpp"
 #include "./MultiBulge/TwoByTwo.hpp"
 #include "./MultiBulge/ComputeShifts.hpp"
 #include "./MultiBulge/RedundantlyHandleWindow.hpp"
@@ -149,18 +150,20 @@ MultiBulge
     const Int winSize = winEnd - winBeg;
     const Int blockSize = H.BlockHeight();
 
-    // TODO(poulson): Implement a more reasonable/configurable means of deciding
-    // when to call the sequential implementation
-    Int minMultiBulgeSize = Max( ctrl.minMultiBulgeSize, 2*blockSize );
-    // This maximum is meant to account for parallel overheads and needs to be
-    // more principled (and perhaps based upon the number of workers and the
-    // cluster characteristics)
-    minMultiBulgeSize = Max( minMultiBulgeSize, ctrl.minDistMultiBulgeSize );
+    // Windows below this size are always handled redundantly; larger windows
+    // are handled redundantly when WindowPlacement says so
+    const Int minMultiBulgeSize = Max( ctrl.minMultiBulgeSize, 2*blockSize );
+    auto handleRedundantly = [&]( Int size )
+    {
+        return WindowPlacement<Field>
+          ( size, minMultiBulgeSize, blockSize, grid, ctrl ).placement ==
+          GO_REDUNDANT;
+    };
 
     HessenbergSchurInfo info;
 
     w.Resize( n, 1 );
-    if( winSize < minMultiBulgeSize )
+    if( handleRedundantly(winSize) )
     {
         return multibulge::RedundantlyHandleWindow( H, w, Z, ctrl );
     }
@@ -235,7 +238,7 @@ MultiBulge
             numIterSinceDeflation = 0;
             continue;
         }
-        else if( iterWinSize < minMultiBulgeSize )
+        else if( handleRedundantly(iterWinSize) )
         {
             // The window is small enough to switch to the simple scheme
             if( ctrl.progress && grid.Rank() == 0 )
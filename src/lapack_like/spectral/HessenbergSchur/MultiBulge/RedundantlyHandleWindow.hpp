@@ -9,6 +9,7 @@
 #ifndef EL_HESS_SCHUR_MULTIBULGE_REDUNDANTLY_HANDLE_WINDOW_HPP
 #define EL_HESS_SCHUR_MULTIBULGE_REDUNDANTLY_HANDLE_WINDOW_HPP
 
+#include "./ComputeShifts.hpp"
 #include "./Transform.hpp"
 
 namespace El {
@@ -62,6 +63,18 @@ RedundantlyHandleWindow
     auto HWin = H(winInd,winInd);
     auto wWin = w(winInd,ALL);
 
+    if( !ctrl.fullTriangle && !ctrl.wantSchurVecs )
+    {
+        // Neither the rest of H nor Z is to be updated, so the Schur vectors
+        // of the window need not be formed (nor broadcast)
+        HessenbergSchurCtrl ctrlWin;
+        ctrlWin.fullTriangle = false;
+        ctrlWin.demandConverged = ctrl.demandConverged;
+        info.numUnconverged =
+          ConsistentlyComputeEigenvalues( HWin, wWin, ctrlWin );
+        return info;
+    }
+
     // Compute the Schur decomposition HWin = ZWin TWin ZWin',
     // where HWin is overwritten by TWin, and wWin by diag(TWin).
     Matrix<Field> ZWin;
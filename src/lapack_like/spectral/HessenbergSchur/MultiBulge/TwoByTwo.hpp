@@ -78,8 +78,10 @@ void TwoByTwo
     // can be rescaled to be real (and both equal to 'c').
     auto HSub = H( IR(offset,offset+2), IR(offset,offset+2) );
     auto wSub = w( IR(offset,offset+2), ALL );
-    Matrix<Complex<Real>> ZSub;
-    HessenbergSchur( HSub, wSub, ZSub );
+    Matrix<Complex<Real>> ZSubDyn;
+    HessenbergSchur( HSub, wSub, ZSubDyn );
+    FixedMatrix<Complex<Real>,2,2> ZSub;
+    ZSub.Load( ZSubDyn );
 
     if( ctrl.fullTriangle )
     {
@@ -88,7 +90,7 @@ void TwoByTwo
             // Overwrite H((offset,offset+1),offset+2:end) *= ZSub'
             // (applied from the left)
             auto HRight = H( ALL, IR(offset+2,END) );
-            Matrix<Complex<Real>> ZSubAdj;
+            FixedMatrix<Complex<Real>,2,2> ZSubAdj;
             Adjoint( ZSub, ZSubAdj );
             Transform2x2Rows( ZSubAdj, HRight, offset, offset+1 );
         }
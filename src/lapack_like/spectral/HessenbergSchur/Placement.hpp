@@ -0,0 +1,107 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_HESS_SCHUR_PLACEMENT_HPP
+#define EL_HESS_SCHUR_PLACEMENT_HPP
+
+namespace El {
+namespace hess_schur {
+
+// When only eigenvalues are requested, neither the portion of H outside of the
+// active window nor any Schur vectors are updated, and so the active window
+// forms an independent problem which can be moved onto fewer processes as it
+// shrinks. Return the height of the square subgrid which would give each
+// process row at least 'minDistMultiBulgeSize' rows of the active window.
+inline Int ShrunkenGridHeight
+( const Grid& grid, Int winSize, const HessenbergSchurCtrl& ctrl )
+{
+    const Int maxHeight = Int(sqrt(double(grid.Size())));
+    const Int minRowsPerProc = Max( ctrl.minDistMultiBulgeSize, Int(1) );
+    return Max( Min( maxHeight, winSize/minRowsPerProc ), Int(1) );
+}
+
+// A rough model of the multibulge QR iteration over a window of size n with
+// s shifts per sweep: roughly 3n/s sweeps are required, each of which chases
+// its bulges through n/nb diagonal blocks (with a few collectives per block)
+// and applies 10 n^2 s flops worth of reflections
+template<typename Field>
+SubproblemCost WindowCost
+( Int winSize, Int blockSize, const HessenbergSchurCtrl& ctrl )
+{
+    const double n = winSize;
+    const double nb = Max( blockSize, Int(1) );
+    const double numShifts = Max( ctrl.numShifts( winSize, winSize ), Int(2) );
+    const double numSweeps = 3*n/numShifts;
+    const bool eigvalsOnly = !ctrl.fullTriangle && !ctrl.wantSchurVecs;
+
+    SubproblemCost cost;
+    cost.flops = (IsComplex<Field>::value ? 4 : 1)*(eigvalsOnly ? 10 : 25)*
+      n*n*n;
+    cost.numInputEntries = n*n;
+    cost.numOutputEntries = ( eigvalsOnly ? n : 2*n*n );
+    cost.numSyncs = numSweeps*4*(n/nb);
+    cost.numCommEntries = numSweeps*2*n*nb;
+    cost.entrySize = sizeof(Field);
+    return cost;
+}
+
+// Decide whether the Hessenberg QR iteration over a window of H should remain
+// distributed, be moved onto a square subgrid (which is only an option when
+// 'allowSubgrid' is true, i.e., when nothing outside of the window need be
+// updated), or be handled redundantly. Windows smaller than
+// 'minMultiBulgeSize' are always handled redundantly; otherwise the heuristic
+// choice is based upon 'minDistMultiBulgeSize', and it is overridden by the
+// calibrated placement model (see ChoosePlacement) when one is active.
+template<typename Field>
+SubproblemDecision WindowPlacement
+( Int winSize,
+  Int minMultiBulgeSize,
+  Int blockSize,
+  const Grid& grid,
+  const HessenbergSchurCtrl& ctrl,
+  bool allowSubgrid=false )
+{
+    EL_DEBUG_CSE
+    SubproblemDecision heuristic;
+    heuristic.placement = STAY_DISTRIBUTED;
+    heuristic.teamSize = grid.Size();
+    if( winSize < minMultiBulgeSize )
+    {
+        heuristic.placement = GO_REDUNDANT;
+        heuristic.teamSize = 1;
+        return heuristic;
+    }
+    if( allowSubgrid )
+    {
+        const Int gridHeight = Int(sqrt(double(grid.Size())));
+        const Int subgridHeight = ShrunkenGridHeight( grid, winSize, ctrl );
+        if( subgridHeight == 1 )
+        {
+            heuristic.placement = GO_REDUNDANT;
+            heuristic.teamSize = 1;
+        }
+        else if( subgridHeight < gridHeight )
+        {
+            heuristic.placement = SHRINK_TO_SUBGRID;
+            heuristic.teamSize = subgridHeight*subgridHeight;
+        }
+    }
+    else if( winSize < ctrl.minDistMultiBulgeSize )
+    {
+        heuristic.placement = GO_REDUNDANT;
+        heuristic.teamSize = 1;
+    }
+    return ChoosePlacement
+    ( WindowCost<Field>( winSize, blockSize, ctrl ), grid.Size(), heuristic,
+      allowSubgrid );
+}
+
+} // namespace hess_schur
+} // namespace El
+
+#endif // ifndef EL_HESS_SCHUR_PLACEMENT_HPP
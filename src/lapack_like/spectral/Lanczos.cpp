@@ -12,7 +12,7 @@ namespace El {
 
 template<typename Field>
 void Lanczos
-( const SparseMatrix<Field>& A,
+( const LinearOperator<Field>& A,
         Matrix<Base<Field>>& T,
         Int basisSize )
 {
@@ -20,19 +20,22 @@ void Lanczos
     const Int n = A.Height();
     if( n != A.Width() )
         LogicError("A was not square");
+    Lanczos<Field>( n, A, T, basisSize );
+}
 
-    auto applyA =
-      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
-      {
-          Zeros( Y, n, X.Width() );
-          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
-      };
-    Lanczos<Field>( n, applyA, T, basisSize );
+template<typename Field>
+void Lanczos
+( const SparseMatrix<Field>& A,
+        Matrix<Base<Field>>& T,
+        Int basisSize )
+{
+    EL_DEBUG_CSE
+    Lanczos( LinearOperator<Field>(A), T, basisSize );
 }
 
 template<typename Field>
 Base<Field> LanczosDecomp
-( const SparseMatrix<Field>& A,
+( const LinearOperator<Field>& A,
         Matrix<Field>& V,
         Matrix<Base<Field>>& T,
         Matrix<Field>& v,
@@ -42,19 +45,24 @@ Base<Field> LanczosDecomp
     const Int n = A.Height();
     if( n != A.Width() )
         LogicError("A was not square");
+    return LanczosDecomp( n, A, V, T, v, basisSize );
+}
 
-    auto applyA =
-      [&]( const Matrix<Field>& X, Matrix<Field>& Y )
-      {
-          Zeros( Y, n, X.Width() );
-          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
-      };
-    return LanczosDecomp( n, applyA, V, T, v, basisSize );
+template<typename Field>
+Base<Field> LanczosDecomp
+( const SparseMatrix<Field>& A,
+        Matrix<Field>& V,
+        Matrix<Base<Field>>& T,
+        Matrix<Field>& v,
+        Int basisSize )
+{
+    EL_DEBUG_CSE
+    return LanczosDecomp( LinearOperator<Field>(A), V, T, v, basisSize );
 }
 
 template<typename Field>
 void Lanczos
-( const DistSparseMatrix<Field>& A,
+( const DistLinearOperator<Field>& A,
         AbstractDistMatrix<Base<Field>>& T,
         Int basisSize )
 {
@@ -62,19 +70,22 @@ void Lanczos
     const Int n = A.Height();
     if( n != A.Width() )
         LogicError("A was not square");
+    Lanczos<Field>( n, A, T, basisSize );
+}
 
-    auto applyA =
-      [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
-      {
-          Zeros( Y, n, X.Width() );
-          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
-      };
-    Lanczos<Field>( n, applyA, T, basisSize );
+template<typename Field>
+void Lanczos
+( const DistSparseMatrix<Field>& A,
+        AbstractDistMatrix<Base<Field>>& T,
+        Int basisSize )
+{
+    EL_DEBUG_CSE
+    Lanczos( DistLinearOperator<Field>(A), T, basisSize );
 }
 
 template<typename Field>
 Base<Field> LanczosDecomp
-( const DistSparseMatrix<Field>& A,
+( const DistLinearOperator<Field>& A,
         DistMultiVec<Field>& V,
         AbstractDistMatrix<Base<Field>>& T,
         DistMultiVec<Field>& v,
@@ -84,38 +95,47 @@ Base<Field> LanczosDecomp
     const Int n = A.Height();
     if( n != A.Width() )
         LogicError("A was not square");
+    return LanczosDecomp( n, A, V, T, v, basisSize );
+}
 
-    auto applyA =
-      [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
-      {
-          Zeros( Y, n, X.Width() );
-          Multiply( NORMAL, Field(1), A, X, Field(0), Y );
-      };
-    return LanczosDecomp( n, applyA, V, T, v, basisSize );
+template<typename Field>
+Base<Field> LanczosDecomp
+( const DistSparseMatrix<Field>& A,
+        DistMultiVec<Field>& V,
+        AbstractDistMatrix<Base<Field>>& T,
+        DistMultiVec<Field>& v,
+        Int basisSize )
+{
+    EL_DEBUG_CSE
+    return LanczosDecomp( DistLinearOperator<Field>(A), V, T, v, basisSize );
 }
 
-#define PROTO(Field) \
+#define PROTO_TYPES(Field,SeqType,DistType) \
   template void Lanczos \
-  ( const SparseMatrix<Field>& A, \
+  ( const SeqType<Field>& A, \
           Matrix<Base<Field>>& T, \
           Int basisSize ); \
   template void Lanczos \
-  ( const DistSparseMatrix<Field>& A, \
+  ( const DistType<Field>& A, \
           AbstractDistMatrix<Base<Field>>& T, \
           Int basisSize ); \
   template Base<Field> LanczosDecomp \
-  ( const SparseMatrix<Field>& A, \
+  ( const SeqType<Field>& A, \
           Matrix<Field>& V, \
           Matrix<Base<Field>>& T, \
           Matrix<Field>& v, \
           Int basisSize ); \
   template Base<Field> LanczosDecomp \
-  ( const DistSparseMatrix<Field>& A, \
+  ( const DistType<Field>& A, \
           DistMultiVec<Field>& V, \
           AbstractDistMatrix<Base<Field>>& T, \
           DistMultiVec<Field>& v, \
           Int basisSize );
 
+#define PROTO(Field) \
+  PROTO_TYPES(Field,SparseMatrix,DistSparseMatrix) \
+  PROTO_TYPES(Field,LinearOperator,DistLinearOperator)
+
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
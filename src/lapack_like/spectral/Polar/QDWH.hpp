@@ -24,12 +24,185 @@ namespace El {
 
 namespace polar {
 
+// Update the lower bound, L, on the smallest singular value of the iterate
+// and return the dynamically weighted Halley coefficients of the iteration
+// which produces the next iterate, alpha A + beta A (I + c A^H A)^{-1}
+template<typename Real>
+void Weights( Real& L, Real& c, Real& alpha, Real& beta, const Real& tol )
+{
+    typedef Complex<Real> Cpx;
+    const Real oneThird = Real(1)/Real(3);
+    Real L2;
+    Cpx dd, sqd;
+    if( Abs(1-L) < tol )
+    {
+        L2 = 1;
+        dd = 0;
+        sqd = 1;
+    }
+    else
+    {
+        L2 = L*L;
+        dd = Pow( 4*(1-L2)/(L2*L2), oneThird );
+        sqd = Sqrt( Real(1)+dd );
+    }
+    const Cpx arg = Real(8) - Real(4)*dd + Real(8)*(2-L2)/(L2*sqd);
+    const Real a = (sqd + Sqrt(arg)/Real(2)).real();
+    const Real b = (a-1)*(a-1)/4;
+    c = a+b-1;
+    alpha = a-b/c;
+    beta = b/c;
+
+    L = L*(a+b*L2)/(1+c*L2);
+}
+
+// Overwrite the stacked matrix [sqrt(c) A; I] with the orthonormal factor
+// from its QR decomposition. CholeskyQR2 falls back to Householder QR when
+// the stacked matrix, whose condition number is at most sqrt(1+c), is too
+// ill-conditioned.
+template<typename F>
+void OrthonormalizeStacked
+( Matrix<F>& Q, const QRCtrl<Base<F>>& qrCtrl, const QDWHCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.cholQR && !qrCtrl.colPiv )
+    {
+        Matrix<F> R;
+        qr::CholeskyQR2( Q, R );
+    }
+    else
+        qr::ExplicitUnitary( Q, true, qrCtrl );
+}
+
+template<typename F>
+void OrthonormalizeStacked
+( AbstractDistMatrix<F>& Q,
+  const QRCtrl<Base<F>>& qrCtrl,
+  const QDWHCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.cholQR && !qrCtrl.colPiv )
+    {
+        DistMatrix<F,STAR,STAR> R( Q.Grid() );
+        qr::CholeskyQR2( Q, R );
+    }
+    else
+        qr::ExplicitUnitary( Q, true, qrCtrl );
+}
+
+// The precision of the QR-based iterations when QDWHCtrl::mixedPrecision is
+// set; there is no lower precision for the remaining types
+template<typename F>
+struct LowerPrecisionHelper { typedef F type; };
+template<>
+struct LowerPrecisionHelper<double> { typedef float type; };
+template<>
+struct LowerPrecisionHelper<Complex<double>> { typedef Complex<float> type; };
+template<typename F>
+using LowerPrecision = typename LowerPrecisionHelper<F>::type;
+
+// Run the QR-based iterations, i.e., those with c > 100, in the lower
+// precision and return the updated lower bound on the smallest singular
+// value of A. The remaining (Cholesky-based) iterations are applied to a
+// well-conditioned iterate and are left to the working precision.
+//
+// NOTE: Since the iterate is rounded to the lower precision, the computed
+//       polar factor is only backward stable at the level of its unit
+//       roundoff, though it is orthonormal to the working precision.
+template<typename F>
+Base<F> LowerPrecisionIterations
+( Matrix<F>& A, Base<F> L, const QDWHCtrl& ctrl, QDWHInfo& info )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    typedef LowerPrecision<F> FLow;
+    typedef Base<FLow> RealLow;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real tol = 5*limits::Epsilon<Real>();
+
+    Real LNext = L, c, alpha, beta;
+    Weights( LNext, c, alpha, beta, tol );
+    if( c <= Real(100) )
+        return L;
+
+    QRCtrl<RealLow> qrCtrl;
+    qrCtrl.colPiv = ctrl.colPiv;
+
+    Matrix<FLow> ALow;
+    Copy( A, ALow );
+    Matrix<FLow> Q( m+n, n );
+    auto QT = Q( IR(0,m  ), ALL );
+    auto QB = Q( IR(m,END), ALL );
+    while( info.numIts < ctrl.maxIts && c > Real(100) )
+    {
+        L = LNext;
+        QT = ALow;
+        QT *= RealLow(Sqrt(c));
+        MakeIdentity( QB );
+        OrthonormalizeStacked( Q, qrCtrl, ctrl );
+        Gemm
+        ( NORMAL, ADJOINT,
+          FLow(RealLow(alpha/Sqrt(c))), QT, QB, FLow(RealLow(beta)), ALow );
+        ++info.numQRIts;
+        ++info.numIts;
+
+        Weights( LNext, c, alpha, beta, tol );
+    }
+    Copy( ALow, A );
+    return L;
+}
+
+template<typename F>
+Base<F> LowerPrecisionIterations
+( DistMatrix<F>& A, Base<F> L, const QDWHCtrl& ctrl, QDWHInfo& info )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    typedef LowerPrecision<F> FLow;
+    typedef Base<FLow> RealLow;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Real tol = 5*limits::Epsilon<Real>();
+
+    Real LNext = L, c, alpha, beta;
+    Weights( LNext, c, alpha, beta, tol );
+    if( c <= Real(100) )
+        return L;
+
+    QRCtrl<RealLow> qrCtrl;
+    qrCtrl.colPiv = ctrl.colPiv;
+
+    DistMatrix<FLow> ALow(g);
+    Copy( A, ALow );
+    DistMatrix<FLow> Q( m+n, n, g );
+    auto QT = Q( IR(0,m  ), ALL );
+    auto QB = Q( IR(m,END), ALL );
+    while( info.numIts < ctrl.maxIts && c > Real(100) )
+    {
+        L = LNext;
+        QT = ALow;
+        QT *= RealLow(Sqrt(c));
+        MakeIdentity( QB );
+        OrthonormalizeStacked( Q, qrCtrl, ctrl );
+        Gemm
+        ( NORMAL, ADJOINT,
+          FLow(RealLow(alpha/Sqrt(c))), QT, QB, FLow(RealLow(beta)), ALow );
+        ++info.numQRIts;
+        ++info.numIts;
+
+        Weights( LNext, c, alpha, beta, tol );
+    }
+    Copy( ALow, A );
+    return L;
+}
+
 template<typename F>
 QDWHInfo QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const QDWHCtrl& ctrl )
 {
     EL_DEBUG_CSE
     typedef Base<F> Real;
-    typedef Complex<Real> Cpx;
     const Int m = A.Height();
     const Int n = A.Width();
     const Real oneThird = Real(1)/Real(3);
@@ -45,6 +218,8 @@ QDWHInfo QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const QDWHCtrl& ctrl )
     const Real tol = 5*eps;
     const Real cubeRootTol = Pow(tol,oneThird);
     Real L = sMinUpper / Sqrt(Real(n));
+    if( ctrl.mixedPrecision && !IsSame<LowerPrecision<F>,F>::value )
+        L = LowerPrecisionIterations( A, L, ctrl, info );
 
     Real frobNormADiff;
     Matrix<F> ALast, ATemp, C;
@@ -55,28 +230,8 @@ QDWHInfo QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const QDWHCtrl& ctrl )
     {
         ALast = A;
 
-        Real L2;
-        Cpx dd, sqd;
-        if( Abs(1-L) < tol )
-        {
-            L2 = 1;
-            dd = 0;
-            sqd = 1;
-        }
-        else
-        {
-            L2 = L*L;
-            dd = Pow( 4*(1-L2)/(L2*L2), oneThird );
-            sqd = Sqrt( Real(1)+dd );
-        }
-        const Cpx arg = Real(8) - Real(4)*dd + Real(8)*(2-L2)/(L2*sqd);
-        const Real a = (sqd + Sqrt(arg)/Real(2)).real();
-        const Real b = (a-1)*(a-1)/4;
-        const Real c = a+b-1;
-        const Real alpha = a-b/c;
-        const Real beta = b/c;
-
-        L = L*(a+b*L2)/(1+c*L2);
+        Real c, alpha, beta;
+        Weights( L, c, alpha, beta, tol );
 
         if( c > 100 )
         {
@@ -86,7 +241,7 @@ QDWHInfo QDWHInner( Matrix<F>& A, Base<F> sMinUpper, const QDWHCtrl& ctrl )
             QT = A;
             QT *= Sqrt(c);
             MakeIdentity( QB );
-            qr::ExplicitUnitary( Q, true, qrCtrl );
+            OrthonormalizeStacked( Q, qrCtrl, ctrl );
             Gemm( NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
             ++info.numQRIts;
         }
@@ -173,7 +328,6 @@ QDWHInner
     auto& A = AProx.Get();
 
     typedef Base<F> Real;
-    typedef Complex<Real> Cpx;
     const Int m = A.Height();
     const Int n = A.Width();
     const Real oneThird = Real(1)/Real(3);
@@ -189,6 +343,8 @@ QDWHInner
     const Real tol = 5*eps;
     const Real cubeRootTol = Pow(tol,oneThird);
     Real L = sMinUpper / Sqrt(Real(n));
+    if( ctrl.mixedPrecision && !IsSame<LowerPrecision<F>,F>::value )
+        L = LowerPrecisionIterations( A, L, ctrl, info );
 
     const Grid& g = A.Grid();
     DistMatrix<F> ALast(g), ATemp(g), C(g);
@@ -201,28 +357,8 @@ QDWHInner
     {
         ALast = A;
 
-        Real L2;
-        Cpx dd, sqd;
-        if( Abs(1-L) < tol )
-        {
-            L2 = 1;
-            dd = 0;
-            sqd = 1;
-        }
-        else
-        {
-            L2 = L*L;
-            dd = Pow( 4*(1-L2)/(L2*L2), oneThird );
-            sqd = Sqrt( Real(1)+dd );
-        }
-        const Cpx arg = Real(8) - Real(4)*dd + Real(8)*(2-L2)/(L2*sqd);
-        const Real a = (sqd + Sqrt(arg)/Real(2)).real();
-        const Real b = (a-1)*(a-1)/4;
-        const Real c = a+b-1;
-        const Real alpha = a-b/c;
-        const Real beta = b/c;
-
-        L = L*(a+b*L2)/(1+c*L2);
+        Real c, alpha, beta;
+        Weights( L, c, alpha, beta, tol );
 
         if( c > 100 )
         {
@@ -232,7 +368,7 @@ QDWHInner
             QT = A;
             QT *= Sqrt(c);
             MakeIdentity( QB );
-            qr::ExplicitUnitary( Q, true, qrCtrl );
+            OrthonormalizeStacked( Q, qrCtrl, ctrl );
             Gemm( NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
             ++info.numQRIts;
         }
@@ -340,7 +476,6 @@ QDWHInner
         LogicError("Height must be same as width");
 
     typedef Base<F> Real;
-    typedef Complex<Real> Cpx;
     const Int n = A.Height();
     const Real oneThird = Real(1)/Real(3);
 
@@ -353,6 +488,11 @@ QDWHInner
     const Real tol = 5*eps;
     const Real cubeRootTol = Pow(tol,oneThird);
     Real L = sMinUpper / Sqrt(Real(n));
+    if( ctrl.mixedPrecision && !IsSame<polar::LowerPrecision<F>,F>::value )
+    {
+        MakeHermitian( uplo, A );
+        L = polar::LowerPrecisionIterations( A, L, ctrl, info );
+    }
 
     Real frobNormADiff;
     Matrix<F> ALast, ATemp, C;
@@ -364,28 +504,8 @@ QDWHInner
     {
         ALast = A;
 
-        Real L2;
-        Cpx dd, sqd;
-        if( Abs(1-L) < tol )
-        {
-            L2 = 1;
-            dd = 0;
-            sqd = 1;
-        }
-        else
-        {
-            L2 = L*L;
-            dd = Pow( 4*(1-L2)/(L2*L2), oneThird );
-            sqd = Sqrt( Real(1)+dd );
-        }
-        const Cpx arg = Real(8) - Real(4)*dd + Real(8)*(2-L2)/(L2*sqd);
-        const Real a = (sqd + Sqrt(arg)/Real(2)).real();
-        const Real b = (a-1)*(a-1)/4;
-        const Real c = a+b-1;
-        const Real alpha = a-b/c;
-        const Real beta = b/c;
-
-        L = L*(a+b*L2)/(1+c*L2);
+        Real c, alpha, beta;
+        polar::Weights( L, c, alpha, beta, tol );
 
         if( c > 100 )
         {
@@ -396,7 +516,7 @@ QDWHInner
             QT = A;
             QT *= Sqrt(c);
             MakeIdentity( QB );
-            qr::ExplicitUnitary( Q, true, qrCtrl );
+            polar::OrthonormalizeStacked( Q, qrCtrl, ctrl );
             Trrk( uplo, NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
             ++info.numQRIts;
         }
@@ -491,7 +611,6 @@ QDWHInner
     auto& A = AProx.Get();
 
     typedef Base<F> Real;
-    typedef Complex<Real> Cpx;
     const Grid& g = A.Grid();
     const Int n = A.Height();
     const Real oneThird = Real(1)/Real(3);
@@ -505,6 +624,11 @@ QDWHInner
     const Real tol = 5*eps;
     const Real cubeRootTol = Pow(tol,oneThird);
     Real L = sMinUpper / Sqrt(Real(n));
+    if( ctrl.mixedPrecision && !IsSame<polar::LowerPrecision<F>,F>::value )
+    {
+        MakeHermitian( uplo, A );
+        L = polar::LowerPrecisionIterations( A, L, ctrl, info );
+    }
 
     Real frobNormADiff;
     DistMatrix<F> ALast(g), ATemp(g), C(g);
@@ -516,28 +640,8 @@ QDWHInner
     {
         ALast = A;
 
-        Real L2;
-        Cpx dd, sqd;
-        if( Abs(1-L) < tol )
-        {
-            L2 = 1;
-            dd = 0;
-            sqd = 1;
-        }
-        else
-        {
-            L2 = L*L;
-            dd = Pow( 4*(1-L2)/(L2*L2), oneThird );
-            sqd = Sqrt( Real(1)+dd );
-        }
-        const Cpx arg = Real(8) - Real(4)*dd + Real(8)*(2-L2)/(L2*sqd);
-        const Real a = (sqd + Sqrt(arg)/Real(2)).real();
-        const Real b = (a-1)*(a-1)/4;
-        const Real c = a+b-1;
-        const Real alpha = a-b/c;
-        const Real beta = b/c;
-
-        L = L*(a+b*L2)/(1+c*L2);
+        Real c, alpha, beta;
+        polar::Weights( L, c, alpha, beta, tol );
 
         if( c > 100 )
         {
@@ -548,7 +652,7 @@ QDWHInner
             QT = A;
             QT *= Sqrt(c);
             MakeIdentity( QB );
-            qr::ExplicitUnitary( Q, true, qrCtrl );
+            polar::OrthonormalizeStacked( Q, qrCtrl, ctrl );
             Trrk( uplo, NORMAL, ADJOINT, F(alpha/Sqrt(c)), QT, QB, F(beta), A );
             ++info.numQRIts;
         }
@@ -10,47 +10,131 @@
 
 namespace El {
 
+namespace product_lanczos {
+
+// The smaller of A^H A and A A^H (only its direct application is needed)
 template<typename Field>
-void ProductLanczos
-( const SparseMatrix<Field>& A,
-        Matrix<Base<Field>>& T,
-        Int basisSize )
+LinearOperator<Field> Gram( const LinearOperator<Field>& A )
 {
     EL_DEBUG_CSE
+    if( !A.SupportsAdjoint() )
+        LogicError("Product Lanczos requires the adjoint of the operator");
     const Int m = A.Height();
     const Int n = A.Width();
-
+    const Orientation first = ( m >= n ? NORMAL : ADJOINT );
+    const Orientation second = ( m >= n ? ADJOINT : NORMAL );
+    const Int k = Max(m,n);
     Matrix<Field> S;
+    auto applyGram =
+      [&A,first,second,k,S]
+      ( Orientation orientation, Field alpha, const Matrix<Field>& X,
+        Field beta, Matrix<Field>& Y ) mutable
+      {
+          Zeros( S, k, X.Width() );
+          A.Apply( first, Field(1), X, Field(0), S );
+          A.Apply( second, alpha, S, beta, Y );
+      };
+    const Int size = Min(m,n);
+    return LinearOperator<Field>( size, size, applyGram );
+}
+
+template<typename Field>
+DistLinearOperator<Field> Gram( const DistLinearOperator<Field>& A )
+{
+    EL_DEBUG_CSE
+    if( !A.SupportsAdjoint() )
+        LogicError("Product Lanczos requires the adjoint of the operator");
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Orientation first = ( m >= n ? NORMAL : ADJOINT );
+    const Orientation second = ( m >= n ? ADJOINT : NORMAL );
+    const Int k = Max(m,n);
+    DistMultiVec<Field> S(A.Grid());
+    auto applyGram =
+      [&A,first,second,k,S]
+      ( Orientation orientation, Field alpha, const DistMultiVec<Field>& X,
+        Field beta, DistMultiVec<Field>& Y ) mutable
+      {
+          Zeros( S, k, X.Width() );
+          A.Apply( first, Field(1), X, Field(0), S );
+          A.Apply( second, alpha, S, beta, Y );
+      };
+    const Int size = Min(m,n);
+    return DistLinearOperator<Field>( size, size, A.Grid(), applyGram );
+}
+
+// Wrap A along with a cached copy of its adjoint, which is typically much
+// cheaper to multiply with than to apply A^H directly
+template<typename Field>
+LinearOperator<Field>
+WithAdjoint( const SparseMatrix<Field>& A, const SparseMatrix<Field>& AAdj )
+{
+    auto apply =
+      [&A,&AAdj]
+      ( Orientation orientation, Field alpha, const Matrix<Field>& X,
+        Field beta, Matrix<Field>& Y )
+      {
+          if( orientation == ADJOINT )
+              Multiply( NORMAL, alpha, AAdj, X, beta, Y );
+          else
+              Multiply( orientation, alpha, A, X, beta, Y );
+      };
+    return LinearOperator<Field>( A.Height(), A.Width(), apply, true );
+}
+
+template<typename Field>
+DistLinearOperator<Field>
+WithAdjoint
+( const DistSparseMatrix<Field>& A, const DistSparseMatrix<Field>& AAdj )
+{
+    auto apply =
+      [&A,&AAdj]
+      ( Orientation orientation, Field alpha, const DistMultiVec<Field>& X,
+        Field beta, DistMultiVec<Field>& Y )
+      {
+          if( orientation == ADJOINT )
+              Multiply( NORMAL, alpha, AAdj, X, beta, Y );
+          else
+              Multiply( orientation, alpha, A, X, beta, Y );
+      };
+    return DistLinearOperator<Field>
+      ( A.Height(), A.Width(), A.Grid(), apply, true );
+}
+
+} // namespace product_lanczos
+
+template<typename Field>
+void ProductLanczos
+( const LinearOperator<Field>& A,
+        Matrix<Base<Field>>& T,
+        Int basisSize )
+{
+    EL_DEBUG_CSE
+    Lanczos( product_lanczos::Gram(A), T, basisSize );
+}
 
-    // Cache the adjoint
-    // -----------------
+template<typename Field>
+void ProductLanczos
+( const SparseMatrix<Field>& A,
+        Matrix<Base<Field>>& T,
+        Int basisSize )
+{
+    EL_DEBUG_CSE
     SparseMatrix<Field> AAdj;
     Adjoint( A, AAdj );
+    ProductLanczos( product_lanczos::WithAdjoint(A,AAdj), T, basisSize );
+}
 
-    if( m >= n )
-    {
-        auto applyA =
-          [&]( const Matrix<Field>& X, Matrix<Field>& Y )
-          {
-              Zeros( S, m, X.Width() );
-              Multiply( NORMAL, Field(1), A,    X, Field(0), S );
-              Zeros( Y, n, X.Width() );
-              Multiply( NORMAL, Field(1), AAdj, S, Field(0), Y );
-          };
-        Lanczos<Field>( n, applyA, T, basisSize );
-    }
-    else
-    {
-        auto applyA =
-          [&]( const Matrix<Field>& X, Matrix<Field>& Y )
-          {
-              Zeros( S, n, X.Width() );
-              Multiply( NORMAL, Field(1), AAdj, X, Field(0), S );
-              Zeros( Y, m, X.Width() );
-              Multiply( NORMAL, Field(1), A,    S, Field(0), Y );
-          };
-        Lanczos<Field>( m, applyA, T, basisSize );
-    }
+template<typename Field>
+Base<Field> ProductLanczosDecomp
+( const LinearOperator<Field>& A,
+        Matrix<Field>& V,
+        Matrix<Base<Field>>& T,
+        Matrix<Field>& v,
+        Int basisSize )
+{
+    EL_DEBUG_CSE
+    return LanczosDecomp( product_lanczos::Gram(A), V, T, v, basisSize );
 }
 
 template<typename Field>
@@ -62,40 +146,20 @@ Base<Field> ProductLanczosDecomp
         Int basisSize )
 {
     EL_DEBUG_CSE
-    const Int m = A.Height();
-    const Int n = A.Width();
-
-    Matrix<Field> S;
-
-    // Cache the adjoint
-    // -----------------
     SparseMatrix<Field> AAdj;
     Adjoint( A, AAdj );
+    return ProductLanczosDecomp
+      ( product_lanczos::WithAdjoint(A,AAdj), V, T, v, basisSize );
+}
 
-    if( m >= n )
-    {
-        auto applyA =
-          [&]( const Matrix<Field>& X, Matrix<Field>& Y )
-          {
-              Zeros( S, m, X.Width() );
-              Multiply( NORMAL, Field(1), A,    X, Field(0), S );
-              Zeros( Y, n, X.Width() );
-              Multiply( NORMAL, Field(1), AAdj, S, Field(0), Y );
-          };
-        return LanczosDecomp( n, applyA, V, T, v, basisSize );
-    }
-    else
-    {
-        auto applyA =
-          [&]( const Matrix<Field>& X, Matrix<Field>& Y )
-          {
-              Zeros( S, n, X.Width() );
-              Multiply( NORMAL, Field(1), AAdj, X, Field(0), S );
-              Zeros( Y, m, X.Width() );
-              Multiply( NORMAL, Field(1), A,    S, Field(0), Y );
-          };
-        return LanczosDecomp( m, applyA, V, T, v, basisSize );
-    }
+template<typename Field>
+void ProductLanczos
+( const DistLinearOperator<Field>& A,
+        AbstractDistMatrix<Base<Field>>& T,
+        Int basisSize )
+{
+    EL_DEBUG_CSE
+    Lanczos( product_lanczos::Gram(A), T, basisSize );
 }
 
 template<typename Field>
@@ -105,41 +169,21 @@ void ProductLanczos
         Int basisSize )
 {
     EL_DEBUG_CSE
-    const Int m = A.Height();
-    const Int n = A.Width();
-    const Grid& grid = A.Grid();
-
-    // Cache the adjoint
-    // -----------------
-    DistSparseMatrix<Field> AAdj(grid);
+    DistSparseMatrix<Field> AAdj(A.Grid());
     Adjoint( A, AAdj );
+    ProductLanczos( product_lanczos::WithAdjoint(A,AAdj), T, basisSize );
+}
 
-    DistMultiVec<Field> S(grid);
-
-    if( m >= n )
-    {
-        auto applyA =
-          [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
-          {
-              Zeros( S, m, X.Width() );
-              Multiply( NORMAL, Field(1), A,    X, Field(0), S );
-              Zeros( Y, n, X.Width() );
-              Multiply( NORMAL, Field(1), AAdj, S, Field(0), Y );
-          };
-        Lanczos<Field>( n, applyA, T, basisSize );
-    }
-    else
-    {
-        auto applyA =
-          [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
-          {
-              Zeros( S, n, X.Width() );
-              Multiply( NORMAL, Field(1), AAdj, X, Field(0), S );
-              Zeros( Y, m, X.Width() );
-              Multiply( NORMAL, Field(1), A,    S, Field(0), Y );
-          };
-        Lanczos<Field>( m, applyA, T, basisSize );
-    }
+template<typename Field>
+Base<Field> ProductLanczosDecomp
+( const DistLinearOperator<Field>& A,
+        DistMultiVec<Field>& V,
+        AbstractDistMatrix<Base<Field>>& T,
+        DistMultiVec<Field>& v,
+        Int basisSize )
+{
+    EL_DEBUG_CSE
+    return LanczosDecomp( product_lanczos::Gram(A), V, T, v, basisSize );
 }
 
 template<typename Field>
@@ -151,65 +195,38 @@ Base<Field> ProductLanczosDecomp
         Int basisSize )
 {
     EL_DEBUG_CSE
-    const Int m = A.Height();
-    const Int n = A.Width();
-    const Grid& grid = A.Grid();
-
-    DistMultiVec<Field> S(grid);
-
-    // Cache the adjoint
-    // -----------------
-    DistSparseMatrix<Field> AAdj(grid);
+    DistSparseMatrix<Field> AAdj(A.Grid());
     Adjoint( A, AAdj );
-
-    if( m >= n )
-    {
-        auto applyA =
-          [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
-          {
-              Zeros( S, m, X.Width() );
-              Multiply( NORMAL, Field(1), A,    X, Field(0), S );
-              Zeros( Y, n, X.Width() );
-              Multiply( NORMAL, Field(1), AAdj, S, Field(0), Y );
-          };
-        return LanczosDecomp( n, applyA, V, T, v, basisSize );
-    }
-    else
-    {
-        auto applyA =
-          [&]( const DistMultiVec<Field>& X, DistMultiVec<Field>& Y )
-          {
-              Zeros( S, n, X.Width() );
-              Multiply( NORMAL, Field(1), AAdj, X, Field(0), S );
-              Zeros( Y, m, X.Width() );
-              Multiply( NORMAL, Field(1), A,    S, Field(0), Y );
-          };
-        return LanczosDecomp( m, applyA, V, T, v, basisSize );
-    }
+    return ProductLanczosDecomp
+      ( product_lanczos::WithAdjoint(A,AAdj), V, T, v, basisSize );
 }
 
-#define PROTO(Field) \
+#define PROTO_TYPES(Field,SeqType,DistType) \
   template void ProductLanczos \
-  ( const SparseMatrix<Field>& A, \
+  ( const SeqType<Field>& A, \
           Matrix<Base<Field>>& T, \
           Int basisSize ); \
   template void ProductLanczos \
-  ( const DistSparseMatrix<Field>& A, \
+  ( const DistType<Field>& A, \
           AbstractDistMatrix<Base<Field>>& T, \
           Int basisSize ); \
   template Base<Field> ProductLanczosDecomp \
-  ( const SparseMatrix<Field>& A, \
+  ( const SeqType<Field>& A, \
           Matrix<Field>& V, \
           Matrix<Base<Field>>& T, \
           Matrix<Field>& v, \
           Int basisSize ); \
   template Base<Field> ProductLanczosDecomp \
-  ( const DistSparseMatrix<Field>& A, \
+  ( const DistType<Field>& A, \
           DistMultiVec<Field>& V, \
           AbstractDistMatrix<Base<Field>>& T, \
           DistMultiVec<Field>& v, \
           Int basisSize );
 
+#define PROTO(Field) \
+  PROTO_TYPES(Field,SparseMatrix,DistSparseMatrix) \
+  PROTO_TYPES(Field,LinearOperator,DistLinearOperator)
+
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
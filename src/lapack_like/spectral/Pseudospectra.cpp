@@ -19,6 +19,8 @@
 // Higham and Tisseur will hopefully be implemented soon.
 #include "./Pseudospectra/HagerHigham.hpp"
 
+#include "./Pseudospectra/Contour.hpp"
+
 namespace El {
 
 template<typename Field>
@@ -282,6 +284,19 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
         PseudospecCtrl<Base<Field>> psCtrl )
 {
     EL_DEBUG_CSE
+    if( psCtrl.numSubgrids > 1 )
+        return pspec::SubgridCloud<Field>
+        ( UPre, nullptr, shiftsPre, invNorms, psCtrl,
+          []( const AbstractDistMatrix<Field>& UTeam,
+              const AbstractDistMatrix<Field>*,
+              const AbstractDistMatrix<Complex<Base<Field>>>& shiftsTeam,
+                    AbstractDistMatrix<Base<Field>>& invNormsTeam,
+              const PseudospecCtrl<Base<Field>>& teamCtrl )
+          {
+              return TriangularSpectralCloud
+                     ( UTeam, shiftsTeam, invNormsTeam, teamCtrl );
+          } );
+
     typedef Base<Field> Real;
     typedef Complex<Real> C;
     const Grid& g = UPre.Grid();
@@ -340,6 +355,19 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
         PseudospecCtrl<Base<Field>> psCtrl )
 {
     EL_DEBUG_CSE
+    if( psCtrl.numSubgrids > 1 )
+        return pspec::SubgridCloud<Field>
+        ( UPre, &QPre, shiftsPre, invNorms, psCtrl,
+          []( const AbstractDistMatrix<Field>& UTeam,
+              const AbstractDistMatrix<Field>* QTeam,
+              const AbstractDistMatrix<Complex<Base<Field>>>& shiftsTeam,
+                    AbstractDistMatrix<Base<Field>>& invNormsTeam,
+              const PseudospecCtrl<Base<Field>>& teamCtrl )
+          {
+              return TriangularSpectralCloud
+                     ( UTeam, *QTeam, shiftsTeam, invNormsTeam, teamCtrl );
+          } );
+
     typedef Base<Field> Real;
     typedef Complex<Real> C;
     const Grid& g = UPre.Grid();
@@ -403,6 +431,19 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
         PseudospecCtrl<Real> psCtrl )
 {
     EL_DEBUG_CSE
+    if( psCtrl.numSubgrids > 1 )
+        return pspec::SubgridCloud<Real>
+        ( UPre, nullptr, shiftsPre, invNorms, psCtrl,
+          []( const AbstractDistMatrix<Real>& UTeam,
+              const AbstractDistMatrix<Real>*,
+              const AbstractDistMatrix<Complex<Real>>& shiftsTeam,
+                    AbstractDistMatrix<Real>& invNormsTeam,
+              const PseudospecCtrl<Real>& teamCtrl )
+          {
+              return QuasiTriangularSpectralCloud
+                     ( UTeam, shiftsTeam, invNormsTeam, teamCtrl );
+          } );
+
     typedef Complex<Real> C;
     const Grid& g = UPre.Grid();
 
@@ -449,6 +490,19 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
         PseudospecCtrl<Real> psCtrl )
 {
     EL_DEBUG_CSE
+    if( psCtrl.numSubgrids > 1 )
+        return pspec::SubgridCloud<Real>
+        ( UPre, &QPre, shiftsPre, invNorms, psCtrl,
+          []( const AbstractDistMatrix<Real>& UTeam,
+              const AbstractDistMatrix<Real>* QTeam,
+              const AbstractDistMatrix<Complex<Real>>& shiftsTeam,
+                    AbstractDistMatrix<Real>& invNormsTeam,
+              const PseudospecCtrl<Real>& teamCtrl )
+          {
+              return QuasiTriangularSpectralCloud
+                     ( UTeam, *QTeam, shiftsTeam, invNormsTeam, teamCtrl );
+          } );
+
     typedef Complex<Real> C;
     const Grid& g = UPre.Grid();
 
@@ -494,6 +548,19 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
         PseudospecCtrl<Base<Field>> psCtrl )
 {
     EL_DEBUG_CSE
+    if( psCtrl.numSubgrids > 1 )
+        return pspec::SubgridCloud<Field>
+        ( HPre, nullptr, shiftsPre, invNorms, psCtrl,
+          []( const AbstractDistMatrix<Field>& UTeam,
+              const AbstractDistMatrix<Field>*,
+              const AbstractDistMatrix<Complex<Base<Field>>>& shiftsTeam,
+                    AbstractDistMatrix<Base<Field>>& invNormsTeam,
+              const PseudospecCtrl<Base<Field>>& teamCtrl )
+          {
+              return HessenbergSpectralCloud
+                     ( UTeam, shiftsTeam, invNormsTeam, teamCtrl );
+          } );
+
     typedef Base<Field> Real;
     typedef Complex<Real> C;
 
@@ -533,6 +600,19 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
         PseudospecCtrl<Base<Field>> psCtrl )
 {
     EL_DEBUG_CSE
+    if( psCtrl.numSubgrids > 1 )
+        return pspec::SubgridCloud<Field>
+        ( HPre, &QPre, shiftsPre, invNorms, psCtrl,
+          []( const AbstractDistMatrix<Field>& UTeam,
+              const AbstractDistMatrix<Field>* QTeam,
+              const AbstractDistMatrix<Complex<Base<Field>>>& shiftsTeam,
+                    AbstractDistMatrix<Base<Field>>& invNormsTeam,
+              const PseudospecCtrl<Base<Field>>& teamCtrl )
+          {
+              return HessenbergSpectralCloud
+                     ( UTeam, *QTeam, shiftsTeam, invNormsTeam, teamCtrl );
+          } );
+
     typedef Base<Field> Real;
     typedef Complex<Real> C;
 
@@ -1444,6 +1524,126 @@ DistMatrix<Int> SpectralWindow
     return itCountMap;
 }
 
+// Start from the cell centers of a tesselation of the window and repeatedly
+// refine the cells which the epsilon-contour could cross
+template<typename Field>
+Matrix<Int> SpectralContourCloud
+( const Matrix<Field>& A,
+        Matrix<Complex<Base<Field>>>& shifts,
+        Matrix<Base<Field>>& invNorms,
+  Complex<Base<Field>> center,
+  Base<Field> realWidth,
+  Base<Field> imagWidth,
+  Int realSize,
+  Int imagSize,
+  Base<Field> epsilon,
+  Int numRefinements,
+  PseudospecCtrl<Base<Field>> psCtrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    typedef Complex<Real> C;
+
+    // The refined shifts do not lie on a grid
+    psCtrl.snapCtrl.realSize = 0;
+    psCtrl.snapCtrl.imagSize = 0;
+
+    // Real matrices are refined using their complex Schur form
+    Matrix<C> U, Q;
+    Copy( A, U );
+    pspec::ComplexForm( U, Q, psCtrl );
+
+    Matrix<Int> itCounts;
+    pspec::RefineContour
+    ( shifts, invNorms, itCounts, center, realWidth, imagWidth,
+      realSize, imagSize, epsilon, numRefinements, psCtrl.progress,
+      [&]( const Matrix<C>& newShifts,
+                 Matrix<Real>& newInvNorms,
+                 Matrix<Int>& newItCounts )
+      {
+          newItCounts =
+            pspec::ComplexFormCloud( U, Q, newShifts, newInvNorms, psCtrl );
+      } );
+    return itCounts;
+}
+
+template<typename Field>
+DistMatrix<Int,VR,STAR> SpectralContourCloud
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Complex<Base<Field>>>& shiftsPre,
+        AbstractDistMatrix<Base<Field>>& invNormsPre,
+  Complex<Base<Field>> center,
+  Base<Field> realWidth,
+  Base<Field> imagWidth,
+  Int realSize,
+  Int imagSize,
+  Base<Field> epsilon,
+  Int numRefinements,
+  PseudospecCtrl<Base<Field>> psCtrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    typedef Complex<Real> C;
+    const Grid& g = A.Grid();
+
+    // The refined shifts do not lie on a grid
+    psCtrl.snapCtrl.realSize = 0;
+    psCtrl.snapCtrl.imagSize = 0;
+
+    // Real matrices are refined using their complex Schur form
+    DistMatrix<C> U(g), Q(g);
+    Copy( A, U );
+    pspec::ComplexForm( U, Q, psCtrl );
+
+    Matrix<C> shiftsLoc;
+    Matrix<Real> invNormsLoc;
+    Matrix<Int> itCountsLoc;
+    pspec::RefineContour
+    ( shiftsLoc, invNormsLoc, itCountsLoc, center, realWidth, imagWidth,
+      realSize, imagSize, epsilon, numRefinements,
+      psCtrl.progress && g.Rank() == 0,
+      [&]( const Matrix<C>& newShifts,
+                 Matrix<Real>& newInvNorms,
+                 Matrix<Int>& newItCounts )
+      {
+          DistMatrix<C,VR,STAR> shiftsDist( newShifts.Height(), 1, g );
+          for( Int iLoc=0; iLoc<shiftsDist.LocalHeight(); ++iLoc )
+          {
+              const Int i = shiftsDist.GlobalRow(iLoc);
+              shiftsDist.SetLocal( iLoc, 0, newShifts(i) );
+          }
+          DistMatrix<Real,VR,STAR> invNormsDist(g);
+          auto itCountsDist =
+            pspec::ComplexFormCloud
+            ( U, Q, shiftsDist, invNormsDist, psCtrl );
+
+          DistMatrix<Real,STAR,STAR> invNorms_STAR_STAR( invNormsDist );
+          DistMatrix<Int,STAR,STAR> itCounts_STAR_STAR( itCountsDist );
+          newInvNorms = invNorms_STAR_STAR.Matrix();
+          newItCounts = itCounts_STAR_STAR.Matrix();
+      } );
+
+    const Int numShifts = shiftsLoc.Height();
+    DistMatrixWriteProxy<C,C,VR,STAR> shiftsProx( shiftsPre );
+    DistMatrixWriteProxy<Real,Real,VR,STAR> invNormsProx( invNormsPre );
+    auto& shifts = shiftsProx.Get();
+    auto& invNorms = invNormsProx.Get();
+    shifts.Resize( numShifts, 1 );
+    invNorms.Resize( numShifts, 1 );
+    DistMatrix<Int,VR,STAR> itCounts(g);
+    itCounts.AlignWith( invNorms );
+    itCounts.Resize( numShifts, 1 );
+    for( Int iLoc=0; iLoc<invNorms.LocalHeight(); ++iLoc )
+    {
+        const Int i = invNorms.GlobalRow(iLoc);
+        invNorms.SetLocal( iLoc, 0, invNormsLoc(i) );
+        itCounts.SetLocal( iLoc, 0, itCountsLoc(i) );
+    }
+    for( Int iLoc=0; iLoc<shifts.LocalHeight(); ++iLoc )
+        shifts.SetLocal( iLoc, 0, shiftsLoc(shifts.GlobalRow(iLoc)) );
+    return itCounts;
+}
+
 template<typename Field>
 Matrix<Int> TriangularSpectralPortrait
 ( const Matrix<Field>& U,
@@ -2424,6 +2624,20 @@ DistMatrix<Int> SpectralPortrait
           AbstractDistMatrix<Base<Field>>& invNormMap, \
     Complex<Base<Field>> center, Base<Field> realWidth, Base<Field> imagWidth, \
     Int realSize, Int imagSize, PseudospecCtrl<Base<Field>> psCtrl ); \
+  template Matrix<Int> SpectralContourCloud \
+  ( const Matrix<Field>& A, \
+          Matrix<Complex<Base<Field>>>& shifts, \
+          Matrix<Base<Field>>& invNorms, \
+    Complex<Base<Field>> center, Base<Field> realWidth, Base<Field> imagWidth, \
+    Int realSize, Int imagSize, Base<Field> epsilon, Int numRefinements, \
+    PseudospecCtrl<Base<Field>> psCtrl ); \
+  template DistMatrix<Int,VR,STAR> SpectralContourCloud \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Complex<Base<Field>>>& shifts, \
+          AbstractDistMatrix<Base<Field>>& invNorms, \
+    Complex<Base<Field>> center, Base<Field> realWidth, Base<Field> imagWidth, \
+    Int realSize, Int imagSize, Base<Field> epsilon, Int numRefinements, \
+    PseudospecCtrl<Base<Field>> psCtrl ); \
   template Matrix<Int> SpectralPortrait \
   ( const Matrix<Field>& A, Matrix<Base<Field>>& invNormMap, \
     Int realSize, Int imagSize, SpectralBox<Base<Field>>& box, \
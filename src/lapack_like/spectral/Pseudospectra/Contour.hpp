@@ -0,0 +1,232 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PSEUDOSPECTRA_CONTOUR_HPP
+#define EL_PSEUDOSPECTRA_CONTOUR_HPP
+
+namespace El {
+namespace pspec {
+
+// Overwrite U with its complex Schur (or Hessenberg) form, U := Q^H U Q, where
+// Q is only formed if it is required by the norm
+template<typename Real>
+void ComplexForm
+( Matrix<Complex<Real>>& U,
+  Matrix<Complex<Real>>& Q,
+  const PseudospecCtrl<Real>& psCtrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const bool formQ = ( psCtrl.norm != PS_TWO_NORM );
+    if( psCtrl.schur )
+    {
+        Matrix<C> w;
+        auto schurCtrl( psCtrl.schurCtrl );
+        schurCtrl.hessSchurCtrl.fullTriangle = true;
+        if( formQ )
+            Schur( U, w, Q, schurCtrl );
+        else
+            Schur( U, w, schurCtrl );
+    }
+    else if( formQ )
+    {
+        Matrix<C> t;
+        Hessenberg( UPPER, U, t );
+        Identity( Q, U.Height(), U.Height() );
+        hessenberg::ApplyQ( LEFT, UPPER, NORMAL, U, t, Q );
+        MakeTrapezoidal( UPPER, U, -1 );
+    }
+    else
+        hessenberg::ExplicitCondensed( UPPER, U );
+}
+
+template<typename Real>
+void ComplexForm
+( DistMatrix<Complex<Real>>& U,
+  DistMatrix<Complex<Real>>& Q,
+  const PseudospecCtrl<Real>& psCtrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    const Grid& g = U.Grid();
+    const bool formQ = ( psCtrl.norm != PS_TWO_NORM );
+    if( psCtrl.schur )
+    {
+        DistMatrix<C,VR,STAR> w(g);
+        auto schurCtrl( psCtrl.schurCtrl );
+        schurCtrl.hessSchurCtrl.fullTriangle = true;
+        if( formQ )
+            Schur( U, w, Q, schurCtrl );
+        else
+            Schur( U, w, schurCtrl );
+    }
+    else if( formQ )
+    {
+        DistMatrix<C,STAR,STAR> t(g);
+        Hessenberg( UPPER, U, t );
+        Identity( Q, U.Height(), U.Height() );
+        hessenberg::ApplyQ( LEFT, UPPER, NORMAL, U, t, Q );
+        MakeTrapezoidal( UPPER, U, -1 );
+    }
+    else
+        hessenberg::ExplicitCondensed( UPPER, U );
+}
+
+// Compute the pseudospectra at the given shifts from the result of ComplexForm
+template<typename Real>
+Matrix<Int> ComplexFormCloud
+( const Matrix<Complex<Real>>& U,
+  const Matrix<Complex<Real>>& Q,
+  const Matrix<Complex<Real>>& shifts,
+        Matrix<Real>& invNorms,
+  const PseudospecCtrl<Real>& psCtrl )
+{
+    EL_DEBUG_CSE
+    if( psCtrl.norm == PS_TWO_NORM )
+    {
+        if( psCtrl.schur )
+            return TriangularSpectralCloud( U, shifts, invNorms, psCtrl );
+        else
+            return HessenbergSpectralCloud( U, shifts, invNorms, psCtrl );
+    }
+    else
+    {
+        if( psCtrl.schur )
+            return TriangularSpectralCloud( U, Q, shifts, invNorms, psCtrl );
+        else
+            return HessenbergSpectralCloud( U, Q, shifts, invNorms, psCtrl );
+    }
+}
+
+template<typename Real>
+DistMatrix<Int,VR,STAR> ComplexFormCloud
+( const DistMatrix<Complex<Real>>& U,
+  const DistMatrix<Complex<Real>>& Q,
+  const AbstractDistMatrix<Complex<Real>>& shifts,
+        AbstractDistMatrix<Real>& invNorms,
+  const PseudospecCtrl<Real>& psCtrl )
+{
+    EL_DEBUG_CSE
+    if( psCtrl.norm == PS_TWO_NORM )
+    {
+        if( psCtrl.schur )
+            return TriangularSpectralCloud( U, shifts, invNorms, psCtrl );
+        else
+            return HessenbergSpectralCloud( U, shifts, invNorms, psCtrl );
+    }
+    else
+    {
+        if( psCtrl.schur )
+            return TriangularSpectralCloud( U, Q, shifts, invNorms, psCtrl );
+        else
+            return HessenbergSpectralCloud( U, Q, shifts, invNorms, psCtrl );
+    }
+}
+
+// Starting from the cell centers of a realSize x imagSize tesselation of the
+// window, repeatedly split each cell which the epsilon-contour could cross
+// into four and compute the pseudospectra at the centers of the children.
+// Since the smallest singular value of A - z I, sigma(z) = 1/invNorm(z), is
+// 1-Lipschitz in z, the contour can only cross the cell with half-widths
+// (hx,hy) centered at z if |sigma(z) - epsilon| <= sqrt(hx^2+hy^2).
+//
+// The routine 'cloud' must fill the (replicated) inverse norms and iteration
+// counts for a (replicated) vector of shifts.
+template<typename Real,typename CloudFunc>
+void RefineContour
+( Matrix<Complex<Real>>& shifts,
+  Matrix<Real>& invNorms,
+  Matrix<Int>& itCounts,
+  Complex<Real> center,
+  Real realWidth,
+  Real imagWidth,
+  Int realSize,
+  Int imagSize,
+  Real epsilon,
+  Int numRefinements,
+  bool progress,
+  CloudFunc cloud )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> C;
+    if( epsilon <= Real(0) )
+        LogicError("epsilon must be positive");
+
+    const Real realStep = realWidth/realSize;
+    const Real imagStep = imagWidth/imagSize;
+    const C corner = center + C(-realWidth/2,imagWidth/2);
+    Matrix<C> newShifts( realSize*imagSize, 1 );
+    for( Int j=0; j<realSize*imagSize; ++j )
+    {
+        const Int x = j / imagSize;
+        const Int y = j % imagSize;
+        newShifts(j) = corner+C((x+0.5)*realStep,-(y+0.5)*imagStep);
+    }
+
+    vector<C> shiftList;
+    vector<Real> invNormList;
+    vector<Int> itCountList;
+    Matrix<Real> newInvNorms;
+    Matrix<Int> newItCounts;
+    Real realHalf = realStep/2;
+    Real imagHalf = imagStep/2;
+    for( Int level=0; level<=numRefinements; ++level )
+    {
+        const Int numNew = newShifts.Height();
+        if( progress )
+            Output("Level ",level," of contour refinement: ",numNew," shifts");
+        cloud( newShifts, newInvNorms, newItCounts );
+        for( Int i=0; i<numNew; ++i )
+        {
+            shiftList.push_back( newShifts(i) );
+            invNormList.push_back( newInvNorms(i) );
+            itCountList.push_back( newItCounts(i) );
+        }
+        if( level == numRefinements )
+            break;
+
+        // Split each cell which the contour could cross
+        const Real radius = Sqrt( realHalf*realHalf + imagHalf*imagHalf );
+        realHalf /= 2;
+        imagHalf /= 2;
+        vector<C> children;
+        for( Int i=0; i<numNew; ++i )
+        {
+            const Real sigma = Real(1)/newInvNorms(i);
+            if( Abs(sigma-epsilon) <= radius )
+            {
+                const C z = newShifts(i);
+                children.push_back( z + C(-realHalf, imagHalf) );
+                children.push_back( z + C(-realHalf,-imagHalf) );
+                children.push_back( z + C( realHalf, imagHalf) );
+                children.push_back( z + C( realHalf,-imagHalf) );
+            }
+        }
+        if( children.empty() )
+            break;
+        newShifts.Resize( children.size(), 1 );
+        for( Int i=0; i<Int(children.size()); ++i )
+            newShifts(i) = children[i];
+    }
+
+    const Int numShifts = shiftList.size();
+    shifts.Resize( numShifts, 1 );
+    invNorms.Resize( numShifts, 1 );
+    itCounts.Resize( numShifts, 1 );
+    for( Int i=0; i<numShifts; ++i )
+    {
+        shifts(i) = shiftList[i];
+        invNorms(i) = invNormList[i];
+        itCounts(i) = itCountList[i];
+    }
+}
+
+} // namespace pspec
+} // namespace El
+
+#endif // ifndef EL_PSEUDOSPECTRA_CONTOUR_HPP
@@ -12,5 +12,6 @@
 #include "./Util/Rearrange.hpp"
 #include "./Util/BasicMath.hpp"
 #include "./Util/Snapshot.hpp"
+#include "./Util/Subgrids.hpp"
 
 #endif // ifndef EL_PSEUDOSPECTRA_UTIL_HPP
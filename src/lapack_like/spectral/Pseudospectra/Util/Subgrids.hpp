@@ -0,0 +1,170 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PSEUDOSPECTRA_UTIL_SUBGRIDS_HPP
+#define EL_PSEUDOSPECTRA_UTIL_SUBGRIDS_HPP
+
+namespace El {
+namespace pspec {
+
+// Split the processes of the grid into 'numTeams' contiguous teams and
+// return the index of the team containing this process
+inline Int FormTeams
+( const Grid& grid, Int numTeams, vector<unique_ptr<Grid>>& teamGrids )
+{
+    EL_DEBUG_CSE
+    const Int p = grid.Size();
+    const Int rank = grid.Rank();
+    mpi::Group owningGroup = grid.OwningGroup();
+    teamGrids.resize( numTeams );
+    Int team = 0;
+    for( Int t=0; t<numTeams; ++t )
+    {
+        const Int firstRank = (t*p) / numTeams;
+        const Int teamSize = ((t+1)*p) / numTeams - firstRank;
+        if( rank >= firstRank && rank < firstRank+teamSize )
+            team = t;
+
+        vector<int> teamRanks(teamSize);
+        for( Int j=0; j<teamSize; ++j )
+            teamRanks[j] = firstRank + j;
+        mpi::Group teamGroup;
+        mpi::Incl( owningGroup, teamSize, teamRanks.data(), teamGroup );
+        teamGrids[t].reset
+        ( new Grid
+          ( grid.VCComm(), teamGroup, Grid::DefaultHeight(teamSize) ) );
+        mpi::Free( teamGroup );
+    }
+    return team;
+}
+
+// Fill the [MC,MR] matrix B, over its own (team) grid, from the replicated
+// matrix A
+template<typename T>
+void CopyToTeam( const Matrix<T>& A, DistMatrix<T>& B )
+{
+    EL_DEBUG_CSE
+    B.Resize( A.Height(), A.Width() );
+    auto& BLoc = B.Matrix();
+    for( Int jLoc=0; jLoc<B.LocalWidth(); ++jLoc )
+    {
+        const Int j = B.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<B.LocalHeight(); ++iLoc )
+            BLoc(iLoc,jLoc) = A(B.GlobalRow(iLoc),j);
+    }
+}
+
+// Partition the shifts into (at most) psCtrl.numSubgrids contiguous chunks
+// and compute the pseudospectra for each chunk with 'cloud' over its own team
+// of processes, which is given its own copy of U (and Q, if it is non-null).
+// The estimates and iteration counts are then gathered over the full grid.
+//
+// Since each team only sees its own chunk of the shifts, the teams do not
+// save intermediate snapshots.
+template<typename Field,typename CloudFunc>
+DistMatrix<Int,VR,STAR> SubgridCloud
+( const AbstractDistMatrix<Field>& U,
+  const AbstractDistMatrix<Field>* Q,
+  const AbstractDistMatrix<Complex<Base<Field>>>& shiftsPre,
+        AbstractDistMatrix<Base<Field>>& invNormsPre,
+  const PseudospecCtrl<Base<Field>>& psCtrl,
+  CloudFunc cloud )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    typedef Complex<Real> C;
+    const Grid& g = U.Grid();
+    const Int numShifts = shiftsPre.Height();
+    const Int numTeams =
+      Min( Min(psCtrl.numSubgrids,Int(g.Size())), numShifts );
+
+    auto teamCtrl( psCtrl );
+    teamCtrl.numSubgrids = 1;
+    if( numTeams <= 1 )
+        return cloud( U, Q, shiftsPre, invNormsPre, teamCtrl );
+
+    // Replicate the shifts and matrices before splitting the grid
+    DistMatrix<C,STAR,STAR> shifts_STAR_STAR( shiftsPre );
+    DistMatrix<Field,STAR,STAR> U_STAR_STAR( U ), Q_STAR_STAR( g );
+    if( Q != nullptr )
+        Q_STAR_STAR = *Q;
+
+    vector<unique_ptr<Grid>> teamGrids;
+    const Int team = FormTeams( g, numTeams, teamGrids );
+    const Grid& teamGrid = *teamGrids[team];
+    const Int firstShift = (team*numShifts) / numTeams;
+    const Int numTeamShifts = ((team+1)*numShifts) / numTeams - firstShift;
+
+    DistMatrix<C,VR,STAR> teamShifts( numTeamShifts, 1, teamGrid );
+    const auto& shiftsLoc = shifts_STAR_STAR.LockedMatrix();
+    for( Int iLoc=0; iLoc<teamShifts.LocalHeight(); ++iLoc )
+    {
+        const Int i = teamShifts.GlobalRow(iLoc);
+        teamShifts.SetLocal( iLoc, 0, shiftsLoc(firstShift+i,0) );
+    }
+    shifts_STAR_STAR.Empty();
+
+    DistMatrix<Field> UTeam(teamGrid), QTeam(teamGrid);
+    CopyToTeam( U_STAR_STAR.LockedMatrix(), UTeam );
+    U_STAR_STAR.Empty();
+    if( Q != nullptr )
+    {
+        CopyToTeam( Q_STAR_STAR.LockedMatrix(), QTeam );
+        Q_STAR_STAR.Empty();
+    }
+
+    teamCtrl.snapCtrl.realSize = 0;
+    teamCtrl.snapCtrl.imagSize = 0;
+    teamCtrl.progress = ( psCtrl.progress && team == 0 );
+    DistMatrix<Real,VR,STAR> teamInvNorms(teamGrid);
+    auto teamItCounts =
+      cloud
+      ( UTeam, ( Q != nullptr ? &QTeam : nullptr ), teamShifts, teamInvNorms,
+        teamCtrl );
+
+    // Gather the results of each team over the full grid
+    DistMatrix<Real,STAR,STAR> teamInvNorms_STAR_STAR( teamInvNorms );
+    DistMatrix<Int,STAR,STAR> teamItCounts_STAR_STAR( teamItCounts );
+    Matrix<Real> allInvNorms;
+    Matrix<Int> allItCounts;
+    Zeros( allInvNorms, numShifts, 1 );
+    Zeros( allItCounts, numShifts, 1 );
+    if( teamGrid.Rank() == 0 )
+    {
+        auto invNormsChunk =
+          allInvNorms( IR(firstShift,firstShift+numTeamShifts), ALL );
+        auto itCountsChunk =
+          allItCounts( IR(firstShift,firstShift+numTeamShifts), ALL );
+        invNormsChunk = teamInvNorms_STAR_STAR.LockedMatrix();
+        itCountsChunk = teamItCounts_STAR_STAR.LockedMatrix();
+    }
+    AllReduce( allInvNorms, g.Comm() );
+    AllReduce( allItCounts, g.Comm() );
+
+    DistMatrixWriteProxy<Real,Real,VR,STAR> invNormsProx( invNormsPre );
+    auto& invNorms = invNormsProx.Get();
+    invNorms.Resize( numShifts, 1 );
+    DistMatrix<Int,VR,STAR> itCounts(g);
+    itCounts.AlignWith( invNorms );
+    itCounts.Resize( numShifts, 1 );
+    for( Int iLoc=0; iLoc<invNorms.LocalHeight(); ++iLoc )
+    {
+        const Int i = invNorms.GlobalRow(iLoc);
+        invNorms.SetLocal( iLoc, 0, allInvNorms(i) );
+        itCounts.SetLocal( iLoc, 0, allItCounts(i) );
+    }
+
+    auto snapCtrl( psCtrl.snapCtrl );
+    FinalSnapshot( invNorms, itCounts, snapCtrl );
+    return itCounts;
+}
+
+} // namespace pspec
+} // namespace El
+
+#endif // ifndef EL_PSEUDOSPECTRA_UTIL_SUBGRIDS_HPP
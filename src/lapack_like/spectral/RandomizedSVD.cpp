@@ -0,0 +1,211 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// See Algorithm 5.1 of Halko, Martinsson, and Tropp's "Finding structure with
+// randomness: Probabilistic algorithms for constructing approximate matrix
+// decompositions".
+//
+// Given the orthonormal basis Q for the approximate range of A, the adjoint
+// of the projection Q^H A is factored as A^H Q = QB R, so that
+//
+//   A ~= Q (Q^H A) = Q R^H QB^H = (Q VR) Sigma (QB UR)^H,
+//
+// where R = UR Sigma VR^H is the SVD of the small, square matrix R.
+
+namespace El {
+namespace svd {
+
+// Overwrite UR and VR with the leading 'rank' left and right singular vectors
+// of the small matrix R
+template<typename Field>
+void TruncatedSmallSVD
+( const Matrix<Field>& R,
+        Matrix<Field>& UR,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& VR,
+        Int rank )
+{
+    EL_DEBUG_CSE
+    SVD( R, UR, s, VR );
+    const Int k = Min( rank, s.Height() );
+    s.Resize( k, 1 );
+    UR.Resize( UR.Height(), k );
+    VR.Resize( VR.Height(), k );
+}
+
+} // namespace svd
+
+template<typename Field>
+void RandomizedSVD
+( const Matrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> Q, QB, R, UR, VR;
+    RandomizedRange( NORMAL, A, Q, rank, ctrl );
+    Gemm( ADJOINT, NORMAL, Field(1), A, Q, QB );
+    qr::CholeskyQR2( QB, R );
+    svd::TruncatedSmallSVD( R, UR, s, VR, rank );
+    Gemm( NORMAL, NORMAL, Field(1), Q, VR, U );
+    Gemm( NORMAL, NORMAL, Field(1), QB, UR, V );
+}
+
+template<typename Field>
+void RandomizedSVD
+( const AbstractDistMatrix<Field>& APre,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    DistMatrixReadProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+
+    DistMatrix<Field,VC,STAR> Q(g), QB(g);
+    DistMatrix<Field,STAR,STAR> R(g);
+    RandomizedRange( NORMAL, A, Q, rank, ctrl );
+    Gemm( ADJOINT, NORMAL, Field(1), A, Q, QB );
+    qr::CholeskyQR2( QB, R );
+
+    // Every process redundantly computes the SVD of the small matrix R
+    Matrix<Field> UR, VR;
+    Matrix<Real> sSmall;
+    svd::TruncatedSmallSVD( R.LockedMatrix(), UR, sSmall, VR, rank );
+    const Int k = sSmall.Height();
+    DistMatrix<Real,STAR,STAR> s_STAR_STAR(k,1,g);
+    s_STAR_STAR.Matrix() = sSmall;
+    Copy( s_STAR_STAR, s );
+
+    DistMatrix<Field,VC,STAR> W(g);
+    W.AlignWith( Q );
+    W.Resize( Q.Height(), k );
+    Gemm
+    ( NORMAL, NORMAL,
+      Field(1), Q.LockedMatrix(), VR, Field(0), W.Matrix() );
+    Copy( W, U );
+
+    W.AlignWith( QB );
+    W.Resize( QB.Height(), k );
+    Gemm
+    ( NORMAL, NORMAL,
+      Field(1), QB.LockedMatrix(), UR, Field(0), W.Matrix() );
+    Copy( W, V );
+}
+
+template<typename Field>
+void RandomizedSVD
+( const SparseMatrix<Field>& A,
+        Matrix<Field>& U,
+        Matrix<Base<Field>>& s,
+        Matrix<Field>& V,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    Matrix<Field> Q, QB, R, UR, VR;
+    RandomizedRange( NORMAL, A, Q, rank, ctrl );
+    Zeros( QB, A.Width(), Q.Width() );
+    Multiply( ADJOINT, Field(1), A, Q, Field(0), QB );
+    qr::CholeskyQR2( QB, R );
+    svd::TruncatedSmallSVD( R, UR, s, VR, rank );
+    Gemm( NORMAL, NORMAL, Field(1), Q, VR, U );
+    Gemm( NORMAL, NORMAL, Field(1), QB, UR, V );
+}
+
+template<typename Field>
+void RandomizedSVD
+( const DistSparseMatrix<Field>& A,
+        DistMultiVec<Field>& U,
+        Matrix<Base<Field>>& s,
+        DistMultiVec<Field>& V,
+        Int rank,
+  const RandomizedRangeCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    const Grid& g = A.Grid();
+    DistMultiVec<Field> Q(g), B(g);
+    RandomizedRange( NORMAL, A, Q, rank, ctrl );
+    Zeros( B, A.Width(), Q.Width() );
+    Multiply( ADJOINT, Field(1), A, Q, Field(0), B );
+
+    DistMatrix<Field,VC,STAR> QB(g);
+    DistMatrix<Field,STAR,STAR> R(g);
+    Copy( B, QB );
+    B.Empty();
+    qr::CholeskyQR2( QB, R );
+
+    // Every process redundantly computes the SVD of the small matrix R
+    Matrix<Field> UR, VR;
+    svd::TruncatedSmallSVD( R.LockedMatrix(), UR, s, VR, rank );
+    const Int k = s.Height();
+
+    // The local rows of U are determined by those of Q
+    U.SetGrid( g );
+    Zeros( U, Q.Height(), k );
+    Gemm
+    ( NORMAL, NORMAL,
+      Field(1), Q.LockedMatrix(), VR, Field(0), U.Matrix() );
+
+    DistMatrix<Field,VC,STAR> W(g);
+    W.AlignWith( QB );
+    W.Resize( QB.Height(), k );
+    Gemm
+    ( NORMAL, NORMAL,
+      Field(1), QB.LockedMatrix(), UR, Field(0), W.Matrix() );
+    V.SetGrid( g );
+    Copy( W, V );
+}
+
+#define PROTO(Field) \
+  template void RandomizedSVD \
+  ( const Matrix<Field>& A, \
+          Matrix<Field>& U, \
+          Matrix<Base<Field>>& s, \
+          Matrix<Field>& V, \
+          Int rank, \
+    const RandomizedRangeCtrl& ctrl ); \
+  template void RandomizedSVD \
+  ( const AbstractDistMatrix<Field>& A, \
+          AbstractDistMatrix<Field>& U, \
+          AbstractDistMatrix<Base<Field>>& s, \
+          AbstractDistMatrix<Field>& V, \
+          Int rank, \
+    const RandomizedRangeCtrl& ctrl ); \
+  template void RandomizedSVD \
+  ( const SparseMatrix<Field>& A, \
+          Matrix<Field>& U, \
+          Matrix<Base<Field>>& s, \
+          Matrix<Field>& V, \
+          Int rank, \
+    const RandomizedRangeCtrl& ctrl ); \
+  template void RandomizedSVD \
+  ( const DistSparseMatrix<Field>& A, \
+          DistMultiVec<Field>& U, \
+          Matrix<Base<Field>>& s, \
+          DistMultiVec<Field>& V, \
+          Int rank, \
+    const RandomizedRangeCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -33,9 +33,17 @@ SVDInfo ScaLAPACKHelper
     SVDInfo info;
 #ifdef EL_HAVE_SCALAPACK
     typedef Base<Field> Real;
-    DistMatrix<Field,MC,MR,BLOCK> A( APre );
+    // The input is overwritten by ScaLAPACK and so it is always copied, but
+    // (when possible) with the blocking and alignments of the original
+    const auto proxyCtrl = ScaLAPACKProxyCtrl( APre );
+    DistMatrix<Field,MC,MR,BLOCK> A( APre.Grid() );
+    A.Align
+    ( proxyCtrl.blockHeight, proxyCtrl.blockWidth,
+      proxyCtrl.colAlign, proxyCtrl.rowAlign );
+    Copy( APre, A );
     DistMatrixWriteProxy<Real,Real,STAR,STAR> sProx(sPre);
-    DistMatrixWriteProxy<Field,Field,MC,MR,BLOCK> UProx(UPre);
+    DistMatrixWriteProxy<Field,Field,MC,MR,BLOCK>
+      UProx( UPre, AlignedProxyCtrl(A) );
     auto& s = sProx.Get();
     auto& U = UProx.Get();
 
@@ -48,6 +56,8 @@ SVDInfo ScaLAPACKHelper
     {
         Zeros( U, m, k );
         DistMatrix<Field,MC,MR,BLOCK> VH( A.Grid() );
+        VH.Align
+        ( A.BlockHeight(), A.BlockWidth(), A.ColAlign(), A.RowAlign() );
         Zeros( VH, k, n );
         s.Resize( k, 1 );
 
@@ -270,6 +280,44 @@ SVDInfo SVD
     return info;
 }
 
+namespace svd {
+
+// Apply svd::TSQR to A, or to A^H (with the roles of U and V swapped) if A is
+// wide
+template<typename Field>
+SVDInfo TallOrWideTSQR
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Field>& U,
+        AbstractDistMatrix<Base<Field>>& s,
+        AbstractDistMatrix<Field>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.bidiagSVDCtrl.approach != THIN_SVD )
+        LogicError("svd::TSQR only supports thin SVDs");
+    if( A.Height() >= A.Width() )
+        return TSQR( A, U, s, V, ctrl );
+    DistMatrix<Field,VC,STAR> AAdj( A.Grid() );
+    Adjoint( A, AAdj );
+    return TSQR( AAdj, V, s, U, ctrl );
+}
+
+template<typename Field>
+SVDInfo TallOrWideTSQR
+( const AbstractDistMatrix<Field>& A,
+        AbstractDistMatrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( A.Height() >= A.Width() )
+        return TSQR( A, s, ctrl );
+    DistMatrix<Field,VC,STAR> AAdj( A.Grid() );
+    Adjoint( A, AAdj );
+    return TSQR( AAdj, s, true, ctrl );
+}
+
+} // namespace svd
+
 template<typename Field>
 SVDInfo SVD
 ( const AbstractDistMatrix<Field>& A,
@@ -279,6 +327,15 @@ SVDInfo SVD
   const SVDCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
+    const auto approach = ctrl.bidiagSVDCtrl.approach;
+    if( !(IsBlasScalar<Field>::value && ctrl.useScaLAPACK) &&
+        (ctrl.useTSQR || approach == THIN_SVD) &&
+        svd::SelectTSQR( A.Height(), A.Width(), A.Grid(), ctrl ) )
+    {
+        if( !ctrl.bidiagSVDCtrl.wantU && !ctrl.bidiagSVDCtrl.wantV )
+            return svd::TallOrWideTSQR( A, s, ctrl );
+        return svd::TallOrWideTSQR( A, U, s, V, ctrl );
+    }
     DistMatrix<Field> ACopy( A );
     auto ctrlMod( ctrl );
     ctrlMod.overwrite = true;
@@ -306,6 +363,14 @@ SVDInfo SVD
     auto approach = ctrl.bidiagSVDCtrl.approach;
     const bool avoidU = !ctrl.bidiagSVDCtrl.wantU;
     const bool avoidV = !ctrl.bidiagSVDCtrl.wantV;
+    if( (ctrl.useTSQR || approach == THIN_SVD) &&
+        svd::SelectTSQR( A.Height(), A.Width(), A.Grid(), ctrl ) )
+    {
+        // svd::TSQR redistributes A rather than overwriting it
+        if( avoidU && avoidV )
+            return svd::TallOrWideTSQR( A, s, ctrl );
+        return svd::TallOrWideTSQR( A, U, s, V, ctrl );
+    }
     if( !ctrl.overwrite && approach != PRODUCT_SVD )
     {
         DistMatrix<Field> ACopy( A );
@@ -424,7 +489,14 @@ SVDInfo ScaLAPACKHelper
     SVDInfo info;
 #ifdef EL_HAVE_SCALAPACK
     typedef Base<Field> Real;
-    DistMatrix<Field,MC,MR,BLOCK> A( APre );
+    // The input is overwritten by ScaLAPACK and so it is always copied, but
+    // (when possible) with the blocking and alignments of the original
+    const auto proxyCtrl = ScaLAPACKProxyCtrl( APre );
+    DistMatrix<Field,MC,MR,BLOCK> A( APre.Grid() );
+    A.Align
+    ( proxyCtrl.blockHeight, proxyCtrl.blockWidth,
+      proxyCtrl.colAlign, proxyCtrl.rowAlign );
+    Copy( APre, A );
     DistMatrixWriteProxy<Real,Real,STAR,STAR> sProx(sPre);
     auto& s = sProx.Get();
     const int m = A.Height();
@@ -559,6 +631,8 @@ SVDInfo SVD
         ctrl.bidiagSVDCtrl.approach == COMPACT_SVD ||
         ctrl.bidiagSVDCtrl.approach == FULL_SVD )
     {
+        if( svd::SelectTSQR( A.Height(), A.Width(), A.Grid(), ctrl ) )
+            return svd::TallOrWideTSQR( A, s, ctrl );
         DistMatrix<Field> ACopy( A );
         return svd::Chan( ACopy, s, ctrl );
     }
@@ -592,6 +666,8 @@ SVDInfo SVD
         const bool relative = (tolType == RELATIVE_TO_MAX_SING_VAL_TOL);
         return svd::Product( A, s, ctrl.bidiagSVDCtrl.tol, relative );
     }
+    if( svd::SelectTSQR( A.Height(), A.Width(), A.Grid(), ctrl ) )
+        return svd::TallOrWideTSQR( A, s, ctrl );
 
     if( !ctrl.overwrite )
     {
@@ -608,24 +684,26 @@ namespace svd {
 template<typename Field>
 SVDInfo TSQR
 ( const AbstractDistMatrix<Field>& A,
-        AbstractDistMatrix<Base<Field>>& s )
+        AbstractDistMatrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
     DistMatrix<Field,VC,STAR> ACopy( A );
-    return TSQR( ACopy, s, true );
+    return TSQR( ACopy, s, true, ctrl );
 }
 
 template<typename Field>
 SVDInfo TSQR
 ( AbstractDistMatrix<Field>& APre,
   AbstractDistMatrix<Base<Field>>& sPre,
-  bool overwrite )
+  bool overwrite,
+  const SVDCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
     if( !overwrite )
     {
         DistMatrix<Field,VC,STAR> A( APre );
-        return TSQR( A, sPre, true );
+        return TSQR( A, sPre, true, ctrl );
     }
 
     DistMatrixReadProxy<Field,Field,VC,STAR> AProx( APre );
@@ -639,10 +717,16 @@ SVDInfo TSQR
     const Int minDim = Min(m,n);
     s.Resize( minDim, 1 );
 
+    // The SVD of the (small) R factor should not itself recurse into TSQR
+    auto ctrlMod( ctrl );
+    ctrlMod.overwrite = false;
+    ctrlMod.useTSQR = false;
+    ctrlMod.tsqrRatio = 0;
+
     const Int p = mpi::Size( A.ColComm() );
     if( p == 1 )
     {
-        return SVD( A, s );
+        return SVD( A, s, ctrlMod );
     }
 
     SVDInfo info;
@@ -651,7 +735,7 @@ SVDInfo TSQR
     QR( treeData.QR0, treeData.householderScalars0, treeData.signature0 );
     qr::ts::Reduce( A, treeData );
     if( A.ColRank() == 0 )
-        info = SVD( qr::ts::RootQR(A,treeData), s.Matrix() );
+        info = SVD( qr::ts::RootQR(A,treeData), s.Matrix(), ctrlMod );
     // TODO(poulson): Broadcast info from root?
     qr::ts::Scatter( A, treeData );
     return info;
@@ -662,7 +746,8 @@ SVDInfo TSQR
 ( const AbstractDistMatrix<Field>& A,
         AbstractDistMatrix<Field>& UPre,
         AbstractDistMatrix<Base<Field>>& sPre,
-        AbstractDistMatrix<Field>& VPre )
+        AbstractDistMatrix<Field>& VPre,
+  const SVDCtrl<Base<Field>>& ctrl )
 {
     EL_DEBUG_CSE
 
@@ -681,10 +766,19 @@ SVDInfo TSQR
     s.Resize( minDim, 1 );
     V.Resize( minDim, minDim );
 
+    // The SVD of the (small) R factor should not itself recurse into TSQR
+    auto ctrlMod( ctrl );
+    ctrlMod.overwrite = false;
+    ctrlMod.useTSQR = false;
+    ctrlMod.tsqrRatio = 0;
+    ctrlMod.bidiagSVDCtrl.approach = THIN_SVD;
+    ctrlMod.bidiagSVDCtrl.wantU = true;
+    ctrlMod.bidiagSVDCtrl.wantV = true;
+
     const Int p = mpi::Size( A.ColComm() );
     if( p == 1 )
     {
-        return SVD( A, U, s, V );
+        return SVD( A, U, s, V, ctrlMod );
     }
 
     SVDInfo info;
@@ -703,7 +797,7 @@ SVDInfo TSQR
         Matrix<Field> URoot, VRoot;
         URoot.Resize( mRoot, kRoot );
         VRoot.Resize( nRoot, kRoot );
-        SVD( rootQR, URoot, s.Matrix(), VRoot );
+        info = SVD( rootQR, URoot, s.Matrix(), VRoot, ctrlMod );
 
         rootQR = URoot;
         V.Matrix() = VRoot;
@@ -758,15 +852,18 @@ SVDInfo TSQR
   template SVDInfo svd::TSQR \
   ( AbstractDistMatrix<Field>& A, \
     AbstractDistMatrix<Base<Field>>& s, \
-    bool overwrite ); \
+    bool overwrite, \
+    const SVDCtrl<Base<Field>>& ctrl ); \
   template SVDInfo svd::TSQR \
   ( const AbstractDistMatrix<Field>& A, \
-    AbstractDistMatrix<Base<Field>>& s ); \
+    AbstractDistMatrix<Base<Field>>& s, \
+    const SVDCtrl<Base<Field>>& ctrl ); \
   template SVDInfo svd::TSQR \
   ( const AbstractDistMatrix<Field>& A, \
           AbstractDistMatrix<Field>& U, \
           AbstractDistMatrix<Base<Field>>& s, \
-          AbstractDistMatrix<Field>& V );
+          AbstractDistMatrix<Field>& V, \
+    const SVDCtrl<Base<Field>>& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -36,18 +36,31 @@ SVDInfo GolubReinsch
     // Bidiagonalize A
     Timer timer;
     Matrix<Field> householderScalarsP, householderScalarsQ;
+    Matrix<Base<Field>> signatureP, signatureQ;
+    BulgeReflectors<Field> reflectorsP, reflectorsQ;
+    Matrix<Base<Field>> mainDiag, offDiag;
+    const Int offdiagonal = ( m>=n ? 1 : -1 );
+    const bool twoStage = ctrl.twoStageBidiag && m >= n;
     if( ctrl.time )
         timer.Start();
-    Bidiag( A, householderScalarsP, householderScalarsQ );
+    if( twoStage )
+    {
+        bidiag::TwoStage
+        ( A, householderScalarsQ, signatureQ, householderScalarsP, signatureP,
+          mainDiag, offDiag, reflectorsQ, reflectorsP, ctrl.bidiagBandwidth );
+    }
+    else
+    {
+        Bidiag( A, householderScalarsP, householderScalarsQ );
+        GetRealPartOfDiagonal( A, mainDiag );
+        GetRealPartOfDiagonal( A, offDiag, offdiagonal );
+    }
     if( ctrl.time )
         Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
 
     // Compute the SVD of the bidiagonal matrix.
     // (We can guarantee that accumulation was not requested.)
-    const Int offdiagonal = ( m>=n ? 1 : -1 );
     const UpperOrLower uplo = ( m>=n ? UPPER : LOWER );
-    auto mainDiag = GetRealPartOfDiagonal( A );
-    auto offDiag = GetRealPartOfDiagonal( A, offdiagonal );
     if( ctrl.time )
         timer.Start();
     if( m == n || (m > n && avoidU) || (m < n && avoidV) )
@@ -86,8 +99,20 @@ SVDInfo GolubReinsch
     // Backtransform U and V
     if( ctrl.time )
         timer.Start();
-    if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, householderScalarsQ, U );
-    if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, householderScalarsP, V );
+    if( twoStage )
+    {
+        if( !avoidU )
+            bidiag::ApplyTwoStageQ
+            ( A, householderScalarsQ, signatureQ, reflectorsQ, U );
+        if( !avoidV )
+            bidiag::ApplyTwoStageP
+            ( A, householderScalarsP, signatureP, reflectorsP, V );
+    }
+    else
+    {
+        if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, householderScalarsQ, U );
+        if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, householderScalarsP, V );
+    }
     if( ctrl.time )
         Output("GolubReinsch backtransformation: ",timer.Stop()," seconds");
 
@@ -117,18 +142,31 @@ SVDInfo GolubReinsch
     // Bidiagonalize A
     Timer timer;
     DistMatrix<Field,STAR,STAR> householderScalarsP(g), householderScalarsQ(g);
+    DistMatrix<Base<Field>,STAR,STAR> signatureP(g), signatureQ(g);
+    BulgeReflectors<Field> reflectorsP, reflectorsQ;
+    DistMatrix<Base<Field>,MD,STAR> mainDiag(g), offDiag(g);
+    const UpperOrLower uplo = ( m>=n ? UPPER : LOWER );
+    const Int offdiagonal = ( m>=n ? 1 : -1 );
+    const bool twoStage = ctrl.twoStageBidiag && m >= n;
     if( ctrl.time && g.Rank() == 0 )
         timer.Start();
-    Bidiag( A, householderScalarsP, householderScalarsQ );
+    if( twoStage )
+    {
+        bidiag::TwoStage
+        ( A, householderScalarsQ, signatureQ, householderScalarsP, signatureP,
+          mainDiag, offDiag, reflectorsQ, reflectorsP, ctrl.bidiagBandwidth );
+    }
+    else
+    {
+        Bidiag( A, householderScalarsP, householderScalarsQ );
+
+        // Grab copies of the diagonal and sub/super-diagonal of A
+        GetRealPartOfDiagonal( A, mainDiag );
+        GetRealPartOfDiagonal( A, offDiag, offdiagonal );
+    }
     if( ctrl.time && g.Rank() == 0 )
         Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
 
-    // Grab copies of the diagonal and sub/super-diagonal of A
-    const UpperOrLower uplo = ( m>=n ? UPPER : LOWER );
-    const Int offdiagonal = ( m>=n ? 1 : -1 );
-    auto mainDiag = GetRealPartOfDiagonal(A);
-    auto offDiag = GetRealPartOfDiagonal(A,offdiagonal);
-
     // Run the bidiagonal SVD
     if( ctrl.time && g.Rank() == 0 )
         timer.Start();
@@ -173,8 +211,20 @@ SVDInfo GolubReinsch
     // Backtransform U and V
     if( ctrl.time && g.Rank() == 0 )
         timer.Start();
-    if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, householderScalarsQ, U );
-    if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, householderScalarsP, V );
+    if( twoStage )
+    {
+        if( !avoidU )
+            bidiag::ApplyTwoStageQ
+            ( A, householderScalarsQ, signatureQ, reflectorsQ, U );
+        if( !avoidV )
+            bidiag::ApplyTwoStageP
+            ( A, householderScalarsP, signatureP, reflectorsP, V );
+    }
+    else
+    {
+        if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, householderScalarsQ, U );
+        if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, householderScalarsP, V );
+    }
     if( ctrl.time && g.Rank() == 0 )
         Output("GolubReinsch backtransformation: ",timer.Stop()," seconds");
 
@@ -212,18 +262,26 @@ SVDInfo GolubReinsch
 
     // Bidiagonalize A
     Timer timer;
-    Matrix<Field> householderScalarsP, householderScalarsQ;
+    const UpperOrLower uplo = ( m>=n ? UPPER : LOWER );
+    const Int offdiagonal = ( uplo==UPPER ? 1 : -1 );
+    Matrix<Base<Field>> mainDiag, offDiag;
     if( ctrl.time )
         timer.Start();
-    Bidiag( A, householderScalarsP, householderScalarsQ );
+    if( ctrl.twoStageBidiag && m >= n )
+    {
+        bidiag::TwoStage( A, mainDiag, offDiag, ctrl.bidiagBandwidth );
+    }
+    else
+    {
+        Matrix<Field> householderScalarsP, householderScalarsQ;
+        Bidiag( A, householderScalarsP, householderScalarsQ );
+        GetRealPartOfDiagonal( A, mainDiag );
+        GetRealPartOfDiagonal( A, offDiag, offdiagonal );
+    }
     if( ctrl.time )
         Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
 
     // Compute the singular values of the bidiagonal matrix
-    const UpperOrLower uplo = ( m>=n ? UPPER : LOWER );
-    const Int offdiagonal = ( uplo==UPPER ? 1 : -1 );
-    auto mainDiag = GetRealPartOfDiagonal( A );
-    auto offDiag = GetRealPartOfDiagonal( A, offdiagonal );
     if( ctrl.time )
         timer.Start();
     info.bidiagSVDInfo =
@@ -248,18 +306,27 @@ SVDInfo GolubReinsch
 
     // Bidiagonalize A
     Timer timer;
-    DistMatrix<Field,STAR,STAR> householderScalarsP(g), householderScalarsQ(g);
+    const UpperOrLower uplo = ( m>=n ? UPPER : LOWER );
+    const Int offdiagonal = ( uplo==UPPER ? 1 : -1 );
+    DistMatrix<Base<Field>,MD,STAR> mainDiag(g), offDiag(g);
     if( ctrl.time && g.Rank() == 0 )
         timer.Start();
-    Bidiag( A, householderScalarsP, householderScalarsQ );
+    if( ctrl.twoStageBidiag && m >= n )
+    {
+        bidiag::TwoStage( A, mainDiag, offDiag, ctrl.bidiagBandwidth );
+    }
+    else
+    {
+        DistMatrix<Field,STAR,STAR>
+          householderScalarsP(g), householderScalarsQ(g);
+        Bidiag( A, householderScalarsP, householderScalarsQ );
+
+        // Grab copies of the diagonal and sub/super-diagonal of A
+        GetRealPartOfDiagonal( A, mainDiag );
+        GetRealPartOfDiagonal( A, offDiag, offdiagonal );
+    }
     if( ctrl.time && g.Rank() == 0 )
         Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
-
-    // Grab copies of the diagonal and sub/super-diagonal of A
-    const UpperOrLower uplo = ( m>=n ? UPPER : LOWER );
-    const Int offdiagonal = ( uplo==UPPER ? 1 : -1 );
-    auto mainDiag = GetRealPartOfDiagonal(A);
-    auto offDiag = GetRealPartOfDiagonal(A,offdiagonal);
     if( ctrl.time && g.Rank() == 0 )
         timer.Start();
     info.bidiagSVDInfo =
@@ -66,6 +66,20 @@ bool CheckScale( AbstractDistMatrix<Field>& A, Base<Field>& scale )
         return false;
 }
 
+// Decide if the SVD of an m x n matrix distributed over 'grid' should be
+// computed from a TSQR factorization of A (or A^H, if A is wide)
+template<typename Real>
+bool SelectTSQR( Int m, Int n, const Grid& grid, const SVDCtrl<Real>& ctrl )
+{
+    if( ctrl.useTSQR )
+        return true;
+    const Int p = grid.Size();
+    const Int minDim = Min(m,n);
+    const Int maxDim = Max(m,n);
+    return p > 1 && ctrl.tsqrRatio > 0. && minDim > 0 &&
+           maxDim >= ctrl.tsqrRatio*p*minDim;
+}
+
 } // namespace svd
 } // namespace El
 
@@ -0,0 +1,90 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+void SVDBatched
+( const vector<Matrix<Field>>& A,
+        vector<Matrix<Base<Field>>>& s,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_REGION("SVDBatched");
+    const Int batchSize = A.size();
+    s.resize( batchSize );
+    ParallelFor( batchSize, [&]( Int b ) { SVD( A[b], s[b], ctrl ); } );
+}
+
+template<typename Field>
+void SVDBatched
+( const vector<Matrix<Field>>& A,
+        vector<Matrix<Field>>& U,
+        vector<Matrix<Base<Field>>>& s,
+        vector<Matrix<Field>>& V,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_REGION("SVDBatched");
+    const Int batchSize = A.size();
+    U.resize( batchSize );
+    s.resize( batchSize );
+    V.resize( batchSize );
+    ParallelFor( batchSize, [&]( Int b )
+    { SVD( A[b], U[b], s[b], V[b], ctrl ); } );
+}
+
+template<typename Field>
+void SVDBatched
+( Int batchSize,
+  const Matrix<Field>& A,
+        Matrix<Base<Field>>& s,
+  const SVDCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    auto ABatch = LockedBatchView( batchSize, A );
+    const Int minDim =
+      ( batchSize == 0 ? 0 : Min(A.Height(),A.Width()/batchSize) );
+    s.Resize( minDim, batchSize );
+    auto sBatch = BatchView( batchSize, s );
+    ParallelFor( batchSize, [&]( Int b )
+    {
+        Matrix<Real> sMember;
+        SVD( ABatch[b], sMember, ctrl );
+        sBatch[b] = sMember;
+    } );
+}
+
+#define PROTO(Field) \
+  template void SVDBatched \
+  ( const vector<Matrix<Field>>& A, \
+          vector<Matrix<Base<Field>>>& s, \
+    const SVDCtrl<Base<Field>>& ctrl ); \
+  template void SVDBatched \
+  ( const vector<Matrix<Field>>& A, \
+          vector<Matrix<Field>>& U, \
+          vector<Matrix<Base<Field>>>& s, \
+          vector<Matrix<Field>>& V, \
+    const SVDCtrl<Base<Field>>& ctrl ); \
+  template void SVDBatched \
+  ( Int batchSize, \
+    const Matrix<Field>& A, \
+          Matrix<Base<Field>>& s, \
+    const SVDCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
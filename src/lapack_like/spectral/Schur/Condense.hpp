@@ -21,10 +21,17 @@ void Condense
     EL_DEBUG_CSE
     Timer timer;
 
-    Matrix<F> householderScalars;
     if( ctrl.time )
         timer.Start();
-    Hessenberg( UPPER, A, householderScalars );
+    if( ctrl.twoStageHessenberg )
+    {
+        hessenberg::TwoStage( A, ctrl.hessenbergBandwidth );
+    }
+    else
+    {
+        Matrix<F> householderScalars;
+        Hessenberg( UPPER, A, householderScalars );
+    }
     if( ctrl.time )
         Output("  Hessenberg reduction: ",timer.Stop()," seconds");
     MakeTrapezoidal( UPPER, A, -1 );
@@ -57,10 +64,26 @@ void Condense
     Matrix<F> householderScalars;
     if( ctrl.time )
         timer.Start();
-    Hessenberg( UPPER, A, householderScalars );
-    if( ctrl.time )
-        Output("  Hessenberg reduction: ",timer.Stop()," seconds");
-    hessenberg::FormQ( UPPER, A, householderScalars, Q );
+    if( ctrl.twoStageHessenberg )
+    {
+        Matrix<Base<F>> signature;
+        BulgeReflectors<F> reflectors;
+        hessenberg::TwoStage
+        ( A, householderScalars, signature, reflectors,
+          ctrl.hessenbergBandwidth );
+        if( ctrl.time )
+            Output("  Hessenberg reduction: ",timer.Stop()," seconds");
+        Identity( Q, A.Height(), A.Height() );
+        hessenberg::ApplyTwoStageQ
+        ( A, householderScalars, signature, reflectors, Q );
+    }
+    else
+    {
+        Hessenberg( UPPER, A, householderScalars );
+        if( ctrl.time )
+            Output("  Hessenberg reduction: ",timer.Stop()," seconds");
+        hessenberg::FormQ( UPPER, A, householderScalars, Q );
+    }
     MakeTrapezoidal( UPPER, A, -1 );
 
     auto hessSchurCtrl( ctrl.hessSchurCtrl );
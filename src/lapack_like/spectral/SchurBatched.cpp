@@ -0,0 +1,117 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Field>
+void SchurBatched
+( vector<Matrix<Field>>& A,
+  vector<Matrix<Complex<Base<Field>>>>& w,
+  const SchurCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_REGION("SchurBatched");
+    const Int batchSize = A.size();
+    w.resize( batchSize );
+    ParallelFor( batchSize, [&]( Int b ) { Schur( A[b], w[b], ctrl ); } );
+}
+
+template<typename Field>
+void SchurBatched
+( vector<Matrix<Field>>& A,
+  vector<Matrix<Complex<Base<Field>>>>& w,
+  vector<Matrix<Field>>& Q,
+  const SchurCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    EL_REGION("SchurBatched");
+    const Int batchSize = A.size();
+    w.resize( batchSize );
+    Q.resize( batchSize );
+    ParallelFor( batchSize, [&]( Int b )
+    { Schur( A[b], w[b], Q[b], ctrl ); } );
+}
+
+template<typename Field>
+void SchurBatched
+( Int batchSize,
+  Matrix<Field>& A,
+  Matrix<Complex<Base<Field>>>& w,
+  const SchurCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Base<Field>> CField;
+    auto ABatch = BatchView( batchSize, A );
+    w.Resize( A.Height(), batchSize );
+    auto wBatch = BatchView( batchSize, w );
+    ParallelFor( batchSize, [&]( Int b )
+    {
+        Matrix<CField> wMember;
+        Schur( ABatch[b], wMember, ctrl );
+        wBatch[b] = wMember;
+    } );
+}
+
+template<typename Field>
+void SchurBatched
+( Int batchSize,
+  Matrix<Field>& A,
+  Matrix<Complex<Base<Field>>>& w,
+  Matrix<Field>& Q,
+  const SchurCtrl<Base<Field>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Base<Field>> CField;
+    auto ABatch = BatchView( batchSize, A );
+    const Int n = A.Height();
+    w.Resize( n, batchSize );
+    Q.Resize( n, n*batchSize );
+    auto wBatch = BatchView( batchSize, w );
+    auto QBatch = BatchView( batchSize, Q );
+    ParallelFor( batchSize, [&]( Int b )
+    {
+        Matrix<CField> wMember;
+        Matrix<Field> QMember;
+        Schur( ABatch[b], wMember, QMember, ctrl );
+        wBatch[b] = wMember;
+        QBatch[b] = QMember;
+    } );
+}
+
+#define PROTO(Field) \
+  template void SchurBatched \
+  ( vector<Matrix<Field>>& A, \
+    vector<Matrix<Complex<Base<Field>>>>& w, \
+    const SchurCtrl<Base<Field>>& ctrl ); \
+  template void SchurBatched \
+  ( vector<Matrix<Field>>& A, \
+    vector<Matrix<Complex<Base<Field>>>>& w, \
+    vector<Matrix<Field>>& Q, \
+    const SchurCtrl<Base<Field>>& ctrl ); \
+  template void SchurBatched \
+  ( Int batchSize, \
+    Matrix<Field>& A, \
+    Matrix<Complex<Base<Field>>>& w, \
+    const SchurCtrl<Base<Field>>& ctrl ); \
+  template void SchurBatched \
+  ( Int batchSize, \
+    Matrix<Field>& A, \
+    Matrix<Complex<Base<Field>>>& w, \
+    Matrix<Field>& Q, \
+    const SchurCtrl<Base<Field>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -8,50 +8,191 @@
 */
 #include <El.hpp>
 
+#include <algorithm>
+
 namespace El {
 
 template<typename Real,
          typename/*=DisableIf<IsComplex<Real>>*/>
-ValueInt<Real> Median( const Matrix<Real>& x )
+ValueInt<Real> OrderStatistic( const Matrix<Real>& x, Int k )
 {
     EL_DEBUG_CSE
     const Int m = x.Height();
     const Int n = x.Width();
     if( m != 1 && n != 1 )
-        LogicError("Median is meant for a single vector");
+        LogicError("OrderStatistic is meant for a single vector");
 
-    const Int k = ( n==1 ? m : n );
+    const Int length = ( n==1 ? m : n );
+    if( k < 0 || k >= length )
+        LogicError("Invalid order statistic ",k," of ",length);
     const Int stride = ( n==1 ? 1 : x.LDim() );
     const Real* xBuffer = x.LockedBuffer();
 
-    vector<ValueInt<Real>> pairs( k );
-    for( Int i=0; i<k; ++i )
+    vector<ValueInt<Real>> pairs( length );
+    for( Int i=0; i<length; ++i )
     {
         pairs[i].value = xBuffer[i*stride];
         pairs[i].index = i;
     }
-    std::sort( pairs.begin(), pairs.end(), ValueInt<Real>::Lesser );
+    std::nth_element
+    ( pairs.begin(), pairs.begin()+k, pairs.end(),
+      ValueInt<Real>::StableLesser );
 
-    return pairs[k/2];
+    return pairs[k];
 }
 
+// A distributed selection which repeatedly partitions the remaining
+// candidates about the median of the local medians (weighted by the number
+// of local candidates), which discards at least a quarter of them per step,
+// until few enough remain to be gathered onto every process
 template<typename Real,
          typename/*=DisableIf<IsComplex<Real>>*/>
-ValueInt<Real> Median( const AbstractDistMatrix<Real>& x )
+ValueInt<Real> OrderStatistic( const AbstractDistMatrix<Real>& x, Int k )
 {
     EL_DEBUG_CSE
     if( x.ColDist() == STAR && x.RowDist() == STAR )
+        return OrderStatistic( x.LockedMatrix(), k );
+
+    const Int m = x.Height();
+    const Int n = x.Width();
+    if( m != 1 && n != 1 )
+        LogicError("OrderStatistic is meant for a single vector");
+    const Int length = ( n==1 ? m : n );
+    if( k < 0 || k >= length )
+        LogicError("Invalid order statistic ",k," of ",length);
+
+    mpi::Comm comm = x.Grid().VCComm();
+    const int commSize = mpi::Size( comm );
+    vector<ValueInt<Real>> candidates;
+    if( x.Participating() && x.RedundantRank() == 0 )
     {
-        return Median( x.LockedMatrix() );
+        const Int localHeight = x.LocalHeight();
+        const Int localWidth = x.LocalWidth();
+        const auto& xLoc = x.LockedMatrix();
+        candidates.reserve( localHeight*localWidth );
+        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        {
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                ValueInt<Real> pair;
+                pair.value = xLoc(iLoc,jLoc);
+                pair.index =
+                  ( n==1 ? x.GlobalRow(iLoc) : x.GlobalCol(jLoc) );
+                candidates.push_back( pair );
+            }
+        }
     }
-    else
+
+    const auto lesser = ValueInt<Real>::StableLesser;
+    vector<Int> counts( commSize );
+    vector<ValueInt<Real>> nominees( commSize );
+    Int numCandidates = length;
+    while( numCandidates > 16*commSize )
     {
-        DistMatrix<Real,STAR,STAR> x_STAR_STAR( x );
-        return Median( x_STAR_STAR.LockedMatrix() );
+        // Nominate the local median (if there are local candidates)
+        const Int numLocal = candidates.size();
+        ValueInt<Real> nominee;
+        nominee.value = 0;
+        nominee.index = -1;
+        if( numLocal > 0 )
+        {
+            std::nth_element
+            ( candidates.begin(), candidates.begin()+numLocal/2,
+              candidates.end(), lesser );
+            nominee = candidates[numLocal/2];
+        }
+        mpi::AllGather( &numLocal, 1, counts.data(), 1, comm );
+        mpi::AllGather( &nominee, 1, nominees.data(), 1, comm );
+
+        // Choose the weighted median of the nominees as the pivot
+        vector<Int> order( commSize );
+        for( int q=0; q<commSize; ++q )
+            order[q] = q;
+        std::sort
+        ( order.begin(), order.end(),
+          [&]( Int a, Int b ) { return lesser(nominees[a],nominees[b]); } );
+        ValueInt<Real> pivot;
+        Int weight = 0;
+        for( const Int q : order )
+        {
+            weight += counts[q];
+            if( 2*weight >= numCandidates )
+            {
+                pivot = nominees[q];
+                break;
+            }
+        }
+
+        // Partition the local candidates about the pivot (which is unique,
+        // as ties are broken by the index)
+        auto lessEnd = std::partition
+          ( candidates.begin(), candidates.end(),
+            [&]( const ValueInt<Real>& c ) { return lesser(c,pivot); } );
+        const Int numLess =
+          mpi::AllReduce( Int(lessEnd-candidates.begin()), comm );
+        if( k < numLess )
+        {
+            candidates.erase( lessEnd, candidates.end() );
+            numCandidates = numLess;
+        }
+        else if( k == numLess )
+        {
+            return pivot;
+        }
+        else
+        {
+            candidates.erase
+            ( std::remove_if
+              ( candidates.begin(), candidates.end(),
+                [&]( const ValueInt<Real>& c ) { return !lesser(pivot,c); } ),
+              candidates.end() );
+            k -= numLess+1;
+            numCandidates -= numLess+1;
+        }
     }
+
+    // Gather the remaining candidates and select sequentially
+    const int numLocal = candidates.size();
+    vector<int> sizes( commSize ), offsets;
+    mpi::AllGather( &numLocal, 1, sizes.data(), 1, comm );
+    const int numRemaining = Scan( sizes, offsets );
+    vector<ValueInt<Real>> remaining( numRemaining );
+    mpi::AllGather
+    ( candidates.data(), numLocal,
+      remaining.data(), sizes.data(), offsets.data(), comm );
+    std::nth_element
+    ( remaining.begin(), remaining.begin()+k, remaining.end(), lesser );
+    return remaining[k];
+}
+
+template<typename Real,
+         typename/*=DisableIf<IsComplex<Real>>*/>
+ValueInt<Real> Median( const Matrix<Real>& x )
+{
+    EL_DEBUG_CSE
+    const Int m = x.Height();
+    const Int n = x.Width();
+    if( m != 1 && n != 1 )
+        LogicError("Median is meant for a single vector");
+    return OrderStatistic( x, Max(m,n)/2 );
+}
+
+template<typename Real,
+         typename/*=DisableIf<IsComplex<Real>>*/>
+ValueInt<Real> Median( const AbstractDistMatrix<Real>& x )
+{
+    EL_DEBUG_CSE
+    const Int m = x.Height();
+    const Int n = x.Width();
+    if( m != 1 && n != 1 )
+        LogicError("Median is meant for a single vector");
+    return OrderStatistic( x, Max(m,n)/2 );
 }
 
 #define PROTO(Real) \
+  template ValueInt<Real> OrderStatistic( const Matrix<Real>& x, Int k ); \
+  template ValueInt<Real> OrderStatistic \
+  ( const AbstractDistMatrix<Real>& x, Int k ); \
   template ValueInt<Real> Median( const Matrix<Real>& x ); \
   template ValueInt<Real> Median( const AbstractDistMatrix<Real>& x );
 
@@ -0,0 +1,148 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace {
+
+El::PlacementModel placementModel;
+bool placementModelActive = false;
+
+} // anonymous namespace
+
+namespace El {
+
+void SetPlacementModel( const PlacementModel& model )
+{
+    EL_DEBUG_CSE
+    if( model.latency < 0 || model.inverseBandwidth < 0 ||
+        model.flopTime < 0 )
+        LogicError("Placement model parameters must be non-negative");
+    ::placementModel = model;
+    ::placementModelActive = true;
+}
+
+const PlacementModel& GetPlacementModel() { return ::placementModel; }
+
+bool PlacementModelActive() { return ::placementModelActive; }
+
+void CalibratePlacementModel( mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    CalibrateGemmCostModel( comm );
+    const GemmCostModel& gemmModel = GetGemmCostModel();
+
+    // Take the slowest process's best time for a modest local Gemm
+    const Int n = 256;
+    const Int numReps = 3;
+    Matrix<double> A, B, C;
+    Uniform( A, n, n );
+    Uniform( B, n, n );
+    Zeros( C, n, n );
+    double minTime = std::numeric_limits<double>::max();
+    for( Int rep=0; rep<numReps; ++rep )
+    {
+        const double startTime = mpi::Time();
+        Gemm( NORMAL, NORMAL, 1., A, B, 0., C );
+        minTime = Min( minTime, mpi::Time()-startTime );
+    }
+    const double time = mpi::AllReduce( minTime, mpi::MAX, comm );
+
+    PlacementModel model;
+    model.latency = gemmModel.latency;
+    model.inverseBandwidth = gemmModel.inverseBandwidth;
+    model.flopTime = time / (2.*n*n*n);
+    SetPlacementModel( model );
+}
+
+double SubproblemTime
+( const SubproblemCost& cost, int commSize, int teamSize )
+{
+    EL_DEBUG_CSE
+    if( teamSize < 1 || teamSize > commSize )
+        LogicError("Invalid team size of ",teamSize," of ",commSize);
+    const PlacementModel& model = ::placementModel;
+    const double p = commSize;
+    const double q = teamSize;
+    const double bytesPerEntry = cost.entrySize;
+
+    double time = cost.flops*model.flopTime/q;
+    if( teamSize > 1 )
+        time += cost.numSyncs*std::log2(q)*model.latency +
+          cost.numCommEntries*bytesPerEntry*model.inverseBandwidth/
+          std::sqrt(q);
+
+    if( teamSize == 1 && commSize > 1 )
+    {
+        // Every process gathers the entire input (and the output is then
+        // available without further communication)
+        time += std::log2(p)*model.latency +
+          cost.numInputEntries*bytesPerEntry*model.inverseBandwidth;
+    }
+    else if( teamSize < commSize )
+    {
+        // The input is scattered over the team and the output is sent back
+        // from it
+        const double numEntries = cost.numInputEntries+cost.numOutputEntries;
+        time += 2*std::log2(p)*model.latency +
+          numEntries*bytesPerEntry*model.inverseBandwidth/q;
+    }
+    return time;
+}
+
+SubproblemDecision ChoosePlacement
+( const SubproblemCost& cost, int commSize,
+  const SubproblemDecision& heuristic, bool allowSubgrid )
+{
+    EL_DEBUG_CSE
+    if( !::placementModelActive || commSize == 1 )
+        return heuristic;
+
+    SubproblemDecision decision;
+    decision.placement = STAY_DISTRIBUTED;
+    decision.teamSize = commSize;
+    double bestTime = SubproblemTime( cost, commSize, commSize );
+
+    const double redundantTime = SubproblemTime( cost, commSize, 1 );
+    if( redundantTime < bestTime )
+    {
+        decision.placement = GO_REDUNDANT;
+        decision.teamSize = 1;
+        bestTime = redundantTime;
+    }
+
+    if( allowSubgrid )
+    {
+        for( int height=2; height*height<commSize; ++height )
+        {
+            const int teamSize = height*height;
+            const double time = SubproblemTime( cost, commSize, teamSize );
+            if( time < bestTime )
+            {
+                decision.placement = SHRINK_TO_SUBGRID;
+                decision.teamSize = teamSize;
+                bestTime = time;
+            }
+        }
+    }
+    return decision;
+}
+
+bool RunRedundantly
+( const SubproblemCost& cost, int commSize, bool heuristicRedundant )
+{
+    EL_DEBUG_CSE
+    SubproblemDecision heuristic;
+    heuristic.placement =
+      ( heuristicRedundant ? GO_REDUNDANT : STAY_DISTRIBUTED );
+    heuristic.teamSize = ( heuristicRedundant ? 1 : commSize );
+    return ChoosePlacement( cost, commSize, heuristic, false ).placement ==
+      GO_REDUNDANT;
+}
+
+} // namespace El
@@ -12,6 +12,119 @@
 
 namespace El {
 
+namespace sorting {
+
+// Order the pairs (X(i,j),i+j*height) first by column and then by value, with
+// ties broken by the index so that the order matches that of a stable sort
+template<typename Real>
+struct ColumnOrder
+{
+    Int height;
+    bool ascending;
+
+    bool operator()( const ValueInt<Real>& a, const ValueInt<Real>& b ) const
+    {
+        const Int jA = a.index / height;
+        const Int jB = b.index / height;
+        if( jA != jB )
+            return jA < jB;
+        return ascending ? ValueInt<Real>::StableLesser( a, b )
+                         : ValueInt<Real>::StableGreater( a, b );
+    }
+};
+
+// A parallel sample sort of the pairs spread over the processes of 'comm',
+// each of which may hold any number of them. Every process sorts its pairs
+// and contributes up to commSize regularly-spaced samples, from which
+// commSize-1 splitters are chosen; after an AllToAll exchange of the
+// resulting buckets, each process sorts what it received. Upon return, each
+// process therefore holds a contiguous chunk of the sorted sequence, with the
+// chunks ordered by rank. The comparison must be a strict total order.
+template<typename Real,typename Compare>
+void SampleSort
+( vector<ValueInt<Real>>& pairs, Compare compare, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commSize = mpi::Size( comm );
+    std::sort( pairs.begin(), pairs.end(), compare );
+    if( commSize == 1 )
+        return;
+
+    // Gather the regular samples of every process
+    const Int numLocal = pairs.size();
+    const int numLocalSamples = Min( numLocal, Int(commSize) );
+    vector<ValueInt<Real>> localSamples( numLocalSamples );
+    for( int s=0; s<numLocalSamples; ++s )
+        localSamples[s] = pairs[(s*numLocal)/numLocalSamples];
+    vector<int> sampleSizes( commSize ), sampleOffsets;
+    mpi::AllGather( &numLocalSamples, 1, sampleSizes.data(), 1, comm );
+    const int numSamples = Scan( sampleSizes, sampleOffsets );
+    if( numSamples == 0 )
+        return;
+    vector<ValueInt<Real>> samples( numSamples );
+    mpi::AllGather
+    ( localSamples.data(), numLocalSamples,
+      samples.data(), sampleSizes.data(), sampleOffsets.data(), comm );
+    std::sort( samples.begin(), samples.end(), compare );
+
+    // Bucket q receives the pairs in [splitter(q),splitter(q+1))
+    vector<int> sendSizes( commSize ), sendOffsets( commSize );
+    Int offset = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        Int end = numLocal;
+        if( q+1 < commSize )
+        {
+            const auto& splitter = samples[((q+1)*Int(numSamples))/commSize];
+            end = std::lower_bound
+              ( pairs.begin()+offset, pairs.end(), splitter, compare ) -
+              pairs.begin();
+        }
+        sendOffsets[q] = offset;
+        sendSizes[q] = end - offset;
+        offset = end;
+    }
+
+    vector<int> recvSizes( commSize ), recvOffsets;
+    mpi::AllToAll( sendSizes.data(), 1, recvSizes.data(), 1, comm );
+    const int numRecv = Scan( recvSizes, recvOffsets );
+    vector<ValueInt<Real>> recvPairs( numRecv );
+    mpi::AllToAll
+    ( pairs.data(), sendSizes.data(), sendOffsets.data(),
+      recvPairs.data(), recvSizes.data(), recvOffsets.data(), comm );
+    std::sort( recvPairs.begin(), recvPairs.end(), compare );
+    pairs.swap( recvPairs );
+}
+
+// The pairs (X(i,j),i+j*height) of the entries of X owned by this process
+// (ignoring redundant copies)
+template<typename Real>
+vector<ValueInt<Real>> LocalPairs( const AbstractDistMatrix<Real>& X )
+{
+    EL_DEBUG_CSE
+    vector<ValueInt<Real>> pairs;
+    if( !X.Participating() || X.RedundantRank() != 0 )
+        return pairs;
+    const Int m = X.Height();
+    const Int localHeight = X.LocalHeight();
+    const Int localWidth = X.LocalWidth();
+    const auto& XLoc = X.LockedMatrix();
+    pairs.resize( localHeight*localWidth );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = X.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            auto& pair = pairs[iLoc+jLoc*localHeight];
+            pair.value = XLoc(iLoc,jLoc);
+            pair.index = X.GlobalRow(iLoc) + j*m;
+        }
+    }
+    return pairs;
+}
+
+} // namespace sorting
+
 // Sort each column of the real matrix X
 
 template<typename Real,
@@ -59,15 +172,57 @@ void Sort( AbstractDistMatrix<Real>& X, SortType sort, bool stable )
     }
     else
     {
-        // TODO(poulson): Distributed sort
-
-        // Get a copy on a single process, sort, and then redistribute
-        DistMatrix<Real,CIRC,CIRC> X_CIRC_CIRC( X );
-        if( X_CIRC_CIRC.Participating() )
-            Sort( X_CIRC_CIRC.Matrix(), sort, stable );
-
-        // Refill the distributed X with the sorted values
-        Copy( X_CIRC_CIRC, X );
+        // Sample sort the entries by (column,value) over the grid, which, as
+        // each pair is tagged with its original index, is always stable
+        const Int m = X.Height();
+        const Int n = X.Width();
+        if( m == 0 || n == 0 )
+            return;
+        const Grid& g = X.Grid();
+        DistMatrix<Real,VC,STAR> Y( m, n, g );
+        if( g.InGrid() )
+        {
+            mpi::Comm comm = g.VCComm();
+            const int commSize = mpi::Size( comm );
+            auto pairs = sorting::LocalPairs( X );
+            sorting::ColumnOrder<Real> order{ m, sort==ASCENDING };
+            sorting::SampleSort( pairs, order, comm );
+
+            // Send sorted entry r, which belongs at (r%m,r/m), to its
+            // owner in Y
+            const Int numLocal = pairs.size();
+            const Int firstSorted =
+              mpi::Scan( numLocal, mpi::SUM, comm ) - numLocal;
+            vector<int> sendSizes( commSize, 0 ), sendOffsets;
+            for( Int k=0; k<numLocal; ++k )
+                ++sendSizes[Y.RowOwner((firstSorted+k)%m)];
+            Scan( sendSizes, sendOffsets );
+            vector<ValueInt<Real>> sendPairs( numLocal );
+            auto offsets = sendOffsets;
+            for( Int k=0; k<numLocal; ++k )
+            {
+                const Int r = firstSorted + k;
+                auto& pair = sendPairs[offsets[Y.RowOwner(r%m)]++];
+                pair.value = pairs[k].value;
+                pair.index = r;
+            }
+            SwapClear( pairs );
+
+            vector<int> recvSizes( commSize ), recvOffsets;
+            mpi::AllToAll( sendSizes.data(), 1, recvSizes.data(), 1, comm );
+            const int numRecv = Scan( recvSizes, recvOffsets );
+            vector<ValueInt<Real>> recvPairs( numRecv );
+            mpi::AllToAll
+            ( sendPairs.data(), sendSizes.data(), sendOffsets.data(),
+              recvPairs.data(), recvSizes.data(), recvOffsets.data(), comm );
+            for( const auto& pair : recvPairs )
+            {
+                const Int i = pair.index % m;
+                const Int j = pair.index / m;
+                Y.SetLocal( Y.LocalRow(i), j, pair.value );
+            }
+        }
+        Copy( Y, X );
     }
 }
 
@@ -125,11 +280,39 @@ TaggedSort( const AbstractDistMatrix<Real>& x, SortType sort, bool stable )
     {
         return TaggedSort( x.LockedMatrix(), sort, stable );
     }
-    else
+    else if( sort == UNSORTED )
     {
         DistMatrix<Real,STAR,STAR> x_STAR_STAR( x );
         return TaggedSort( x_STAR_STAR.LockedMatrix(), sort, stable );
     }
+    else
+    {
+        const Int m = x.Height();
+        const Int n = x.Width();
+        if( m != 1 && n != 1 )
+            LogicError("TaggedSort is meant for a single vector");
+
+        // Sample sort the (value,index) pairs over the grid and then gather
+        // the sorted chunks, which are in rank order. Since ties are broken
+        // by the index, the result is that of a stable sort.
+        mpi::Comm comm = x.Grid().VCComm();
+        const int commSize = mpi::Size( comm );
+        auto pairs = sorting::LocalPairs( x );
+        if( sort == ASCENDING )
+            sorting::SampleSort( pairs, ValueInt<Real>::StableLesser, comm );
+        else
+            sorting::SampleSort( pairs, ValueInt<Real>::StableGreater, comm );
+
+        const int numLocal = pairs.size();
+        vector<int> sizes( commSize ), offsets;
+        mpi::AllGather( &numLocal, 1, sizes.data(), 1, comm );
+        const int k = Scan( sizes, offsets );
+        vector<ValueInt<Real>> sortPairs( k );
+        mpi::AllGather
+        ( pairs.data(), numLocal,
+          sortPairs.data(), sizes.data(), offsets.data(), comm );
+        return sortPairs;
+    }
 }
 
 template<typename Real,typename Field>
@@ -0,0 +1,122 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+// Return the (maximum over the grid of the) minimum time over several
+// repetitions of the given operation, which is passed a fresh copy of A
+template<typename Field,typename Operation>
+double TimeOperation
+( const DistMatrix<Field>& A, Int numReps, Operation operation )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    DistMatrix<Field> ACopy(grid);
+    double minTime = std::numeric_limits<double>::max();
+    for( Int rep=0; rep<numReps; ++rep )
+    {
+        ACopy = A;
+        mpi::Barrier( grid.Comm() );
+        const double startTime = mpi::Time();
+        operation( ACopy );
+        const double localTime = mpi::Time() - startTime;
+        const double time = mpi::AllReduce( localTime, mpi::MAX, grid.Comm() );
+        minTime = Min( minTime, time );
+    }
+    return minTime;
+}
+
+template<typename Field,typename Operation>
+void TuneRoutine
+( const string& routine,
+  const DistMatrix<Field>& A,
+  const BlocksizeTuningCtrl& ctrl,
+  Operation operation )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = A.Grid();
+    Int bestBlocksize = ctrl.candidates[0];
+    double bestTime = std::numeric_limits<double>::max();
+    for( const Int blocksize : ctrl.candidates )
+    {
+        SetTunedBlocksize<Field>
+        ( routine, grid.Height(), grid.Width(), blocksize );
+        const double time = TimeOperation( A, ctrl.numReps, operation );
+        if( ctrl.progress )
+            OutputFromRoot
+            (grid.Comm(),routine,"<",TypeName<Field>(),"> with blocksize ",
+             blocksize,": ",time," [sec]");
+        if( time < bestTime )
+        {
+            bestTime = time;
+            bestBlocksize = blocksize;
+        }
+    }
+    SetTunedBlocksize<Field>
+    ( routine, grid.Height(), grid.Width(), bestBlocksize );
+    if( ctrl.progress )
+        OutputFromRoot
+        (grid.Comm(),"Selected blocksize ",bestBlocksize," for ",routine,"<",
+         TypeName<Field>(),">");
+}
+
+} // anonymous namespace
+
+template<typename Field>
+void TuneBlocksizes( const Grid& grid, const BlocksizeTuningCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.candidates.empty() )
+        LogicError("No candidate blocksizes were specified");
+    if( !TunedBlocksizesActive() )
+        LogicError
+        ("Tuned blocksizes are overridden by an explicitly set blocksize");
+    const Int n = ctrl.size;
+
+    // A diagonally-dominant Hermitian matrix with a positive diagonal is HPD
+    DistMatrix<Field> A(grid);
+    Uniform( A, n, n );
+    MakeHermitian( LOWER, A );
+    ShiftDiagonal( A, Field(2*n) );
+
+    TuneRoutine( "Cholesky", A, ctrl,
+      []( DistMatrix<Field>& B ) { Cholesky( LOWER, B ); } );
+    TuneRoutine( "LU", A, ctrl,
+      []( DistMatrix<Field>& B )
+      {
+          DistPermutation P(B.Grid());
+          LU( B, P );
+      } );
+    TuneRoutine( "HermitianTridiag", A, ctrl,
+      []( DistMatrix<Field>& B )
+      {
+          DistMatrix<Field,STAR,STAR> householderScalars(B.Grid());
+          HermitianTridiag( LOWER, B, householderScalars );
+      } );
+
+    DistMatrix<Field> L( A );
+    MakeTrapezoidal( LOWER, L );
+    DistMatrix<Field> X(grid);
+    Uniform( X, n, n );
+    TuneRoutine( "Trsm", X, ctrl,
+      [&]( DistMatrix<Field>& B )
+      { Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Field(1), L, B ); } );
+}
+
+#define PROTO(Field) \
+  template void TuneBlocksizes<Field> \
+  ( const Grid& grid, const BlocksizeTuningCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace El
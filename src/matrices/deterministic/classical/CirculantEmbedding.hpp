@@ -0,0 +1,233 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_MATRICES_CIRCULANTEMBEDDING_HPP
+#define EL_MATRICES_CIRCULANTEMBEDDING_HPP
+
+namespace El {
+namespace circulant_embedding {
+
+// A circulant matrix of order L, C(i,j) = c((i-j) mod L), is diagonalized by
+// the unitary Fourier matrix as C = F^H diag(lambda) F, where
+// lambda = sqrt(L) F c. The routines below apply the leading m x n block
+// of C, which is how Toeplitz and Hankel matrices are applied in
+// O(L log L) work once they are embedded in a circulant matrix with
+// L >= m+n-1.
+
+template<typename Real>
+void Project( const Complex<Real>& alpha, Real& beta )
+{ beta = alpha.real(); }
+template<typename Real>
+void Project( const Complex<Real>& alpha, Complex<Real>& beta )
+{ beta = alpha; }
+
+// Y := beta Y, where Y is allowed to be uninitialized if beta is zero
+template<typename Field>
+void ScaleOutput( Field beta, Matrix<Field>& Y )
+{
+    if( beta == Field(0) )
+        Zero( Y );
+    else
+        Y *= beta;
+}
+
+// The smallest power of two which is at least n
+inline Int PowerOfTwoAtLeast( Int n )
+{
+    Int L = 1;
+    while( L < n )
+        L *= 2;
+    return L;
+}
+
+template<typename Field>
+shared_ptr<Matrix<Complex<Base<Field>>>>
+Eigenvalues( const vector<Field>& c )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int L = c.size();
+    auto lambda = make_shared<Matrix<Complex<Base<Field>>>>();
+    lambda->Resize( L, 1 );
+    for( Int i=0; i<L; ++i )
+        (*lambda)(i) = c[i];
+    FFT( *lambda );
+    *lambda *= Complex<Real>(Sqrt(Real(L)));
+    return lambda;
+}
+
+template<typename Field>
+shared_ptr<DistMultiVec<Complex<Base<Field>>>>
+Eigenvalues( const vector<Field>& c, const Grid& grid )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int L = c.size();
+    auto lambda = make_shared<DistMultiVec<Complex<Base<Field>>>>(grid);
+    lambda->Resize( L, 1 );
+    auto& lambdaLoc = lambda->Matrix();
+    const Int localHeight = lambdaLoc.Height();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        lambdaLoc(iLoc) = c[lambda->GlobalRow(iLoc)];
+    FFT( *lambda );
+    lambdaLoc *= Complex<Real>(Sqrt(Real(L)));
+    return lambda;
+}
+
+// Z := diag(lambda) Z, or diag(conj(lambda)) Z if 'adjoint'
+template<typename Real>
+void ScaleByEigenvalues
+( const Matrix<Complex<Real>>& lambda, Matrix<Complex<Real>>& Z,
+  bool adjoint )
+{
+    EL_DEBUG_CSE
+    const Int L = Z.Height();
+    const Int width = Z.Width();
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<L; ++i )
+            Z(i,j) *= ( adjoint ? Conj(lambda(i)) : lambda(i) );
+}
+
+// Y := alpha op(C(0:m,0:n)) X + beta Y, where 'lambda' holds the eigenvalues
+// of C and op(C) is C, C^T, or C^H
+template<typename Field>
+void Multiply
+( Orientation orientation,
+  const Matrix<Complex<Base<Field>>>& lambda,
+  Int m, Int n,
+  Field alpha, const Matrix<Field>& X,
+  Field beta,        Matrix<Field>& Y )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int L = lambda.Height();
+    const Int inHeight = ( orientation == NORMAL ? n : m );
+    const Int outHeight = ( orientation == NORMAL ? m : n );
+    const Int width = X.Width();
+    EL_DEBUG_ONLY(
+      if( X.Height() != inHeight )
+          LogicError
+          ("X was ",X.Height()," x ",X.Width()," but should have had ",
+           inHeight," rows");
+    )
+    // Since C^T = conj(C^H conj(.)) and C^H holds conj(lambda), the
+    // transpose conjugates the input and output of the adjoint
+    const bool conjugate =
+      ( orientation == TRANSPOSE && IsComplex<Field>::value );
+    const bool adjoint = ( orientation != NORMAL );
+
+    Matrix<Complex<Real>> Z;
+    Zeros( Z, L, width );
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<inHeight; ++i )
+            Z(i,j) = ( conjugate ? Conj(X(i,j)) : Field(X(i,j)) );
+    FFT( Z );
+    ScaleByEigenvalues( lambda, Z, adjoint );
+    FFT( Z, true );
+
+    ScaleOutput( beta, Y );
+    for( Int j=0; j<width; ++j )
+    {
+        for( Int i=0; i<outHeight; ++i )
+        {
+            Field value;
+            Project( conjugate ? Conj(Z(i,j)) : Z(i,j), value );
+            Y(i,j) += alpha*value;
+        }
+    }
+}
+
+template<typename Field>
+void Multiply
+( Orientation orientation,
+  const DistMultiVec<Complex<Base<Field>>>& lambda,
+  Int m, Int n,
+  Field alpha, const DistMultiVec<Field>& X,
+  Field beta,        DistMultiVec<Field>& Y )
+{
+    EL_DEBUG_CSE
+    EL_DEBUG_ONLY(
+      const Int inHeight = ( orientation == NORMAL ? n : m );
+      if( X.Height() != inHeight )
+          LogicError
+          ("X was ",X.Height()," x ",X.Width()," but should have had ",
+           inHeight," rows");
+    )
+    typedef Base<Field> Real;
+    const Int L = lambda.Height();
+    const Int outHeight = ( orientation == NORMAL ? m : n );
+    const Int width = X.Width();
+    const bool conjugate =
+      ( orientation == TRANSPOSE && IsComplex<Field>::value );
+    const bool adjoint = ( orientation != NORMAL );
+    const El::Grid& grid = X.Grid();
+
+    // Embed X in the first rows of Z
+    DistMultiVec<Complex<Real>> Z(grid);
+    Zeros( Z, L, width );
+    {
+        const auto& XLoc = X.LockedMatrix();
+        const Int localHeight = XLoc.Height();
+        Z.Reserve( localHeight*width );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = X.GlobalRow(iLoc);
+            for( Int j=0; j<width; ++j )
+            {
+                const Field value = XLoc(iLoc,j);
+                Z.QueueUpdate( i, j, conjugate ? Conj(value) : value );
+            }
+        }
+        Z.ProcessQueues();
+    }
+    FFT( Z );
+    ScaleByEigenvalues( lambda.LockedMatrix(), Z.Matrix(), adjoint );
+    FFT( Z, true );
+
+    // Extract the first rows of Z
+    DistMultiVec<Field> W(grid);
+    Zeros( W, outHeight, width );
+    {
+        const auto& ZLoc = Z.LockedMatrix();
+        const Int localHeight = ZLoc.Height();
+        W.Reserve( localHeight*width );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        {
+            const Int i = Z.GlobalRow(iLoc);
+            if( i >= outHeight )
+                break;
+            for( Int j=0; j<width; ++j )
+            {
+                Field value;
+                Project
+                ( conjugate ? Conj(ZLoc(iLoc,j)) : ZLoc(iLoc,j), value );
+                W.QueueUpdate( i, j, value );
+            }
+        }
+        W.ProcessQueues();
+    }
+    auto& YLoc = Y.Matrix();
+    ScaleOutput( beta, YLoc );
+    Axpy( alpha, W.LockedMatrix(), YLoc );
+}
+
+// The first column of a circulant matrix of order L >= m+n-1 whose leading
+// m x n block is the Toeplitz matrix T(i,j) = a(i-j+(n-1))
+template<typename Field>
+vector<Field> ToeplitzColumn( Int m, Int n, const vector<Field>& a, Int L )
+{
+    vector<Field> c( L, Field(0) );
+    for( Int d=-(n-1); d<m; ++d )
+        c[Mod(d,L)] = a[d+(n-1)];
+    return c;
+}
+
+} // namespace circulant_embedding
+} // namespace El
+
+#endif // ifndef EL_MATRICES_CIRCULANTEMBEDDING_HPP
@@ -0,0 +1,737 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
+#include <El/blas_like/level3.hpp>
+#include <El/matrices.hpp>
+#include "./CirculantEmbedding.hpp"
+
+namespace El {
+
+namespace {
+
+// B := A with the order of its rows reversed
+template<typename Field>
+void ReverseRows( const Matrix<Field>& A, Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    B.Resize( m, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            B(i,j) = A(m-1-i,j);
+}
+
+template<typename Field>
+void ReverseRows( const DistMultiVec<Field>& A, DistMultiVec<Field>& B )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    B.SetGrid( A.Grid() );
+    Zeros( B, m, n );
+    const auto& ALoc = A.LockedMatrix();
+    const Int localHeight = ALoc.Height();
+    B.Reserve( localHeight*n );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        for( Int j=0; j<n; ++j )
+            B.QueueUpdate( m-1-i, j, ALoc(iLoc,j) );
+    }
+    B.ProcessQueues();
+}
+
+// The binary Walsh matrix is (ones(n,n) + H)/2, so each column of H X is
+// shifted by the corresponding column sum of X and halved
+template<typename Field>
+void MakeBinaryWalsh
+( const Matrix<Field>& colSums, Matrix<Field>& Z )
+{
+    EL_DEBUG_CSE
+    const Int m = Z.Height();
+    const Int n = Z.Width();
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            Z(i,j) = (Z(i,j) + colSums(j)) / Field(2);
+}
+
+template<typename Field>
+Matrix<Field> ColumnSums( const Matrix<Field>& X )
+{
+    EL_DEBUG_CSE
+    const Int m = X.Height();
+    const Int n = X.Width();
+    Matrix<Field> colSums;
+    Zeros( colSums, n, 1 );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            colSums(j) += X(i,j);
+    return colSums;
+}
+
+void CheckWalshOrder( Int k )
+{
+    if( k < 1 )
+        LogicError("Walsh matrices are only defined for k>=1");
+}
+
+} // anonymous namespace
+
+// Circulant
+// =========
+template<typename Field>
+LinearOperator<Field> CirculantOperator( const vector<Field>& a )
+{
+    EL_DEBUG_CSE
+    const Int n = a.size();
+    auto lambda = circulant_embedding::Eigenvalues( a );
+    auto apply =
+      [=]( Orientation orientation, Field alpha, const Matrix<Field>& X,
+           Field beta, Matrix<Field>& Y )
+      {
+          circulant_embedding::Multiply
+          ( orientation, *lambda, n, n, alpha, X, beta, Y );
+      };
+    return LinearOperator<Field>( n, n, apply, true );
+}
+
+template<typename Field>
+DistLinearOperator<Field>
+CirculantOperator( const vector<Field>& a, const El::Grid& grid )
+{
+    EL_DEBUG_CSE
+    const Int n = a.size();
+    auto lambda = circulant_embedding::Eigenvalues( a, grid );
+    auto apply =
+      [=]( Orientation orientation,
+           Field alpha, const DistMultiVec<Field>& X,
+           Field beta,        DistMultiVec<Field>& Y )
+      {
+          circulant_embedding::Multiply
+          ( orientation, *lambda, n, n, alpha, X, beta, Y );
+      };
+    return DistLinearOperator<Field>( n, n, grid, apply, true );
+}
+
+// Fourier
+// =======
+template<typename Real>
+LinearOperator<Complex<Real>> FourierOperator( Int n )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> Field;
+    // F is symmetric, and so its transpose is itself
+    auto apply =
+      [=]( Orientation orientation, Field alpha, const Matrix<Field>& X,
+           Field beta, Matrix<Field>& Y )
+      {
+          Matrix<Field> Z( X );
+          FFT( Z, orientation == ADJOINT );
+          circulant_embedding::ScaleOutput( beta, Y );
+          Axpy( alpha, Z, Y );
+      };
+    return LinearOperator<Field>( n, n, apply, true );
+}
+
+template<typename Real>
+DistLinearOperator<Complex<Real>>
+FourierOperator( Int n, const El::Grid& grid )
+{
+    EL_DEBUG_CSE
+    typedef Complex<Real> Field;
+    auto apply =
+      [=]( Orientation orientation,
+           Field alpha, const DistMultiVec<Field>& X,
+           Field beta,        DistMultiVec<Field>& Y )
+      {
+          DistMultiVec<Field> Z( X );
+          FFT( Z, orientation == ADJOINT );
+          circulant_embedding::ScaleOutput( beta, Y.Matrix() );
+          Axpy( alpha, Z.LockedMatrix(), Y.Matrix() );
+      };
+    return DistLinearOperator<Field>( n, n, grid, apply, true );
+}
+
+// Hankel
+// ======
+// A(i,j) = a(i+j) = T(i,n-1-j) for the Toeplitz matrix T(i,j) = a(i-j+(n-1)),
+// and so A = T J and op(A) = J op(T) for the reversal permutation J.
+template<typename Field>
+LinearOperator<Field> HankelOperator( Int m, Int n, const vector<Field>& a )
+{
+    EL_DEBUG_CSE
+    if( a.size() != Unsigned(m+n-1) )
+        LogicError("a was the wrong size");
+    const Int L = circulant_embedding::PowerOfTwoAtLeast( m+n-1 );
+    auto lambda =
+      circulant_embedding::Eigenvalues
+      ( circulant_embedding::ToeplitzColumn( m, n, a, L ) );
+    auto apply =
+      [=]( Orientation orientation, Field alpha, const Matrix<Field>& X,
+           Field beta, Matrix<Field>& Y )
+      {
+          if( orientation == NORMAL )
+          {
+              Matrix<Field> XRev;
+              ReverseRows( X, XRev );
+              circulant_embedding::Multiply
+              ( orientation, *lambda, m, n, alpha, XRev, beta, Y );
+          }
+          else
+          {
+              Matrix<Field> Z, ZRev;
+              Zeros( Z, n, X.Width() );
+              circulant_embedding::Multiply
+              ( orientation, *lambda, m, n, alpha, X, Field(0), Z );
+              ReverseRows( Z, ZRev );
+              circulant_embedding::ScaleOutput( beta, Y );
+              Y += ZRev;
+          }
+      };
+    return LinearOperator<Field>( m, n, apply, true );
+}
+
+template<typename Field>
+DistLinearOperator<Field>
+HankelOperator( Int m, Int n, const vector<Field>& a, const El::Grid& grid )
+{
+    EL_DEBUG_CSE
+    if( a.size() != Unsigned(m+n-1) )
+        LogicError("a was the wrong size");
+    const Int L = circulant_embedding::PowerOfTwoAtLeast( m+n-1 );
+    auto lambda =
+      circulant_embedding::Eigenvalues
+      ( circulant_embedding::ToeplitzColumn( m, n, a, L ), grid );
+    auto apply =
+      [=]( Orientation orientation,
+           Field alpha, const DistMultiVec<Field>& X,
+           Field beta,        DistMultiVec<Field>& Y )
+      {
+          if( orientation == NORMAL )
+          {
+              DistMultiVec<Field> XRev(X.Grid());
+              ReverseRows( X, XRev );
+              circulant_embedding::Multiply
+              ( orientation, *lambda, m, n, alpha, XRev, beta, Y );
+          }
+          else
+          {
+              DistMultiVec<Field> Z(X.Grid()), ZRev(X.Grid());
+              Zeros( Z, n, X.Width() );
+              circulant_embedding::Multiply
+              ( orientation, *lambda, m, n, alpha, X, Field(0), Z );
+              ReverseRows( Z, ZRev );
+              circulant_embedding::ScaleOutput( beta, Y.Matrix() );
+              Y.Matrix() += ZRev.LockedMatrix();
+          }
+      };
+    return DistLinearOperator<Field>( m, n, grid, apply, true );
+}
+
+// Toeplitz
+// ========
+template<typename Field>
+LinearOperator<Field> ToeplitzOperator( Int m, Int n, const vector<Field>& a )
+{
+    EL_DEBUG_CSE
+    if( a.size() != Unsigned(m+n-1) )
+        LogicError("a was the wrong size");
+    const Int L = circulant_embedding::PowerOfTwoAtLeast( m+n-1 );
+    auto lambda =
+      circulant_embedding::Eigenvalues
+      ( circulant_embedding::ToeplitzColumn( m, n, a, L ) );
+    auto apply =
+      [=]( Orientation orientation, Field alpha, const Matrix<Field>& X,
+           Field beta, Matrix<Field>& Y )
+      {
+          circulant_embedding::Multiply
+          ( orientation, *lambda, m, n, alpha, X, beta, Y );
+      };
+    return LinearOperator<Field>( m, n, apply, true );
+}
+
+template<typename Field>
+DistLinearOperator<Field>
+ToeplitzOperator( Int m, Int n, const vector<Field>& a, const El::Grid& grid )
+{
+    EL_DEBUG_CSE
+    if( a.size() != Unsigned(m+n-1) )
+        LogicError("a was the wrong size");
+    const Int L = circulant_embedding::PowerOfTwoAtLeast( m+n-1 );
+    auto lambda =
+      circulant_embedding::Eigenvalues
+      ( circulant_embedding::ToeplitzColumn( m, n, a, L ), grid );
+    auto apply =
+      [=]( Orientation orientation,
+           Field alpha, const DistMultiVec<Field>& X,
+           Field beta,        DistMultiVec<Field>& Y )
+      {
+          circulant_embedding::Multiply
+          ( orientation, *lambda, m, n, alpha, X, beta, Y );
+      };
+    return DistLinearOperator<Field>( m, n, grid, apply, true );
+}
+
+// Walsh
+// =====
+// The Walsh matrices are real and symmetric, and so every orientation is
+// applied identically.
+template<typename Field>
+LinearOperator<Field> WalshOperator( Int k, bool binary )
+{
+    EL_DEBUG_CSE
+    CheckWalshOrder( k );
+    const Int n = Int(1) << k;
+    auto apply =
+      [=]( Orientation orientation, Field alpha, const Matrix<Field>& X,
+           Field beta, Matrix<Field>& Y )
+      {
+          Matrix<Field> Z( X );
+          WalshHadamard( Z );
+          if( binary )
+              MakeBinaryWalsh( ColumnSums(X), Z );
+          circulant_embedding::ScaleOutput( beta, Y );
+          Axpy( alpha, Z, Y );
+      };
+    return LinearOperator<Field>( n, n, apply, true );
+}
+
+template<typename Field>
+DistLinearOperator<Field>
+WalshOperator( Int k, const El::Grid& grid, bool binary )
+{
+    EL_DEBUG_CSE
+    CheckWalshOrder( k );
+    const Int n = Int(1) << k;
+    auto apply =
+      [=]( Orientation orientation,
+           Field alpha, const DistMultiVec<Field>& X,
+           Field beta,        DistMultiVec<Field>& Y )
+      {
+          DistMultiVec<Field> Z( X );
+          WalshHadamard( Z );
+          if( binary )
+          {
+              auto colSums = ColumnSums( X.LockedMatrix() );
+              mpi::AllReduce
+              ( colSums.Buffer(), colSums.Height(), X.Grid().Comm() );
+              MakeBinaryWalsh( colSums, Z.Matrix() );
+          }
+          circulant_embedding::ScaleOutput( beta, Y.Matrix() );
+          Axpy( alpha, Z.LockedMatrix(), Y.Matrix() );
+      };
+    return DistLinearOperator<Field>( n, n, grid, apply, true );
+}
+
+// Kronecker
+// =========
+// With X an nB x nA reshaping of x, (A \otimes B) x = vec(B X A^T), and so
+// op(A \otimes B) x = vec(op(B) X op(A)^T).
+namespace structured {
+
+// The shared_ptr's hold copies of the (small) factors so that the operators
+// own their data, along with conj(A) so that op(A)^T is always available to
+// Gemm for the adjoint
+template<typename Field>
+struct KroneckerFactors
+{
+    Matrix<Field> A, AConj, B;
+};
+
+template<typename Field>
+shared_ptr<KroneckerFactors<Field>>
+MakeKroneckerFactors( const Matrix<Field>& A, const Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    auto factors = make_shared<KroneckerFactors<Field>>();
+    factors->A = A;
+    Conjugate( A, factors->AConj );
+    factors->B = B;
+    return factors;
+}
+
+// Z := alpha X op(A)^T + beta Z
+template<typename Field>
+void RightMultiplyByTranspose
+( Orientation orientation,
+  const KroneckerFactors<Field>& factors,
+  Field alpha, const Matrix<Field>& X,
+  Field beta,        Matrix<Field>& Z )
+{
+    EL_DEBUG_CSE
+    const auto& AOp = ( orientation == ADJOINT ? factors.AConj : factors.A );
+    const Orientation orientA = ( orientation == NORMAL ? TRANSPOSE : NORMAL );
+    Gemm( NORMAL, orientA, alpha, X, AOp, beta, Z );
+}
+
+} // namespace structured
+
+template<typename Field>
+LinearOperator<Field>
+KroneckerOperator( const Matrix<Field>& A, const Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    const Int mA = A.Height();
+    const Int nA = A.Width();
+    const Int mB = B.Height();
+    const Int nB = B.Width();
+    auto factors = structured::MakeKroneckerFactors( A, B );
+    auto apply =
+      [=]( Orientation orientation, Field alpha, const Matrix<Field>& X,
+           Field beta, Matrix<Field>& Y )
+      {
+          const bool normal = ( orientation == NORMAL );
+          const Int inA = ( normal ? nA : mA );
+          const Int inB = ( normal ? nB : mB );
+          const Int outA = ( normal ? mA : nA );
+          const Int outB = ( normal ? mB : nB );
+          // Multiply by the factor which shrinks the intermediate the most
+          const bool opBFirst =
+            outB*inB*inA + outB*inA*outA < inB*inA*outA + outB*inB*outA;
+          Matrix<Field> Z;
+          for( Int k=0; k<X.Width(); ++k )
+          {
+              Matrix<Field> Xk, Yk;
+              Xk.LockedAttach( inB, inA, X.LockedBuffer(0,k), inB );
+              Yk.Attach( outB, outA, Y.Buffer(0,k), outB );
+              if( opBFirst )
+              {
+                  Gemm( orientation, NORMAL, Field(1), factors->B, Xk, Z );
+                  structured::RightMultiplyByTranspose
+                  ( orientation, *factors, alpha, Z, beta, Yk );
+              }
+              else
+              {
+                  Z.Resize( inB, outA );
+                  structured::RightMultiplyByTranspose
+                  ( orientation, *factors, Field(1), Xk, Field(0), Z );
+                  Gemm( orientation, NORMAL, alpha, factors->B, Z, beta, Yk );
+              }
+          }
+      };
+    return LinearOperator<Field>( mA*mB, nA*nB, apply, true );
+}
+
+template<typename Field>
+DistLinearOperator<Field>
+KroneckerOperator
+( const AbstractDistMatrix<Field>& A, const AbstractDistMatrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    const El::Grid& grid = A.Grid();
+    const Int mA = A.Height();
+    const Int nA = A.Width();
+    const Int mB = B.Height();
+    const Int nB = B.Width();
+    DistMatrix<Field,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+    auto factors =
+      structured::MakeKroneckerFactors
+      ( A_STAR_STAR.LockedMatrix(), B_STAR_STAR.LockedMatrix() );
+    auto apply =
+      [=]( Orientation orientation,
+           Field alpha, const DistMultiVec<Field>& X,
+           Field beta,        DistMultiVec<Field>& Y )
+      {
+          const El::Grid& g = X.Grid();
+          const bool normal = ( orientation == NORMAL );
+          const Int inA = ( normal ? nA : mA );
+          const Int inB = ( normal ? nB : mB );
+          const Int outA = ( normal ? mA : nA );
+          const Int outB = ( normal ? mB : nB );
+          const Int width = X.Width();
+
+          // Reshape the columns of X side by side into an
+          // inB x (inA*width) matrix whose rows are distributed
+          DistMatrix<Field,VC,STAR> XReshaped(g);
+          Zeros( XReshaped, inB, inA*width );
+          {
+              const auto& XLoc = X.LockedMatrix();
+              const Int localHeight = XLoc.Height();
+              XReshaped.Reserve( localHeight*width );
+              for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+              {
+                  const Int i = X.GlobalRow(iLoc);
+                  for( Int k=0; k<width; ++k )
+                      XReshaped.QueueUpdate
+                      ( i % inB, k*inA + i/inB, XLoc(iLoc,k) );
+              }
+              XReshaped.ProcessQueues();
+          }
+
+          // Apply op(A)^T to the locally-owned rows, redistribute so that
+          // entire columns are local, and then apply op(B)
+          DistMatrix<Field,VC,STAR> Z(g);
+          Z.AlignWith( XReshaped );
+          Z.Resize( inB, outA*width );
+          for( Int k=0; k<width; ++k )
+          {
+              auto XLoc_k =
+                XReshaped.LockedMatrix()( ALL, IR(k*inA,(k+1)*inA) );
+              auto ZLoc_k = Z.Matrix()( ALL, IR(k*outA,(k+1)*outA) );
+              structured::RightMultiplyByTranspose
+              ( orientation, *factors, Field(1), XLoc_k, Field(0), ZLoc_k );
+          }
+          DistMatrix<Field,STAR,VC> Z_STAR_VC( Z );
+          Z.Empty();
+          Matrix<Field> V;
+          Gemm
+          ( orientation, NORMAL,
+            Field(1), factors->B, Z_STAR_VC.LockedMatrix(), V );
+
+          DistMultiVec<Field> W(g);
+          Zeros( W, outA*outB, width );
+          const Int localWidth = Z_STAR_VC.LocalWidth();
+          W.Reserve( outB*localWidth );
+          for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+          {
+              const Int j = Z_STAR_VC.GlobalCol(jLoc);
+              const Int k = j / outA;
+              const Int iA = j % outA;
+              for( Int iB=0; iB<outB; ++iB )
+                  W.QueueUpdate( iA*outB + iB, k, V(iB,jLoc) );
+          }
+          W.ProcessQueues();
+
+          auto& YLoc = Y.Matrix();
+          circulant_embedding::ScaleOutput( beta, YLoc );
+          Axpy( alpha, W.LockedMatrix(), YLoc );
+      };
+    return DistLinearOperator<Field>( mA*mB, nA*nB, grid, apply, true );
+}
+
+// Khatri-Rao
+// ==========
+// The columns of the mA*mB x n operator are the Kronecker products of the
+// corresponding columns of A and B, so that, with Y an mB x mA reshaping of
+// y, (A \odot B) x = vec(B diag(x) A^T) and the j'th entry of (A \odot B)^T y
+// is b_j^T Y a_j.
+namespace structured {
+
+// z_j := sum_i op(B)(i,j) W(i,j), where op is the identity or conjugation
+template<typename Field>
+void ColumnDots
+( Orientation orientation,
+  const Matrix<Field>& B,
+  const Matrix<Field>& W,
+        Field* z )
+{
+    EL_DEBUG_CSE
+    const Int m = B.Height();
+    const Int n = B.Width();
+    const bool conjugate = ( orientation == ADJOINT );
+    for( Int j=0; j<n; ++j )
+    {
+        Field gamma = 0;
+        for( Int i=0; i<m; ++i )
+            gamma += ( conjugate ? Conj(B(i,j)) : B(i,j) )*W(i,j);
+        z[j] = gamma;
+    }
+}
+
+} // namespace structured
+
+template<typename Field>
+LinearOperator<Field>
+KhatriRaoOperator( const Matrix<Field>& A, const Matrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    if( A.Width() != B.Width() )
+        LogicError("A and B must have the same number of columns");
+    const Int mA = A.Height();
+    const Int mB = B.Height();
+    const Int n = A.Width();
+    auto factors = structured::MakeKroneckerFactors( A, B );
+    auto apply =
+      [=]( Orientation orientation, Field alpha, const Matrix<Field>& X,
+           Field beta, Matrix<Field>& Y )
+      {
+          const auto& AOp =
+            ( orientation == ADJOINT ? factors->AConj : factors->A );
+          Matrix<Field> BScaled, W, z;
+          for( Int k=0; k<X.Width(); ++k )
+          {
+              if( orientation == NORMAL )
+              {
+                  // Y_k := alpha B diag(x_k) A^T + beta Y_k
+                  Matrix<Field> Yk;
+                  Yk.Attach( mB, mA, Y.Buffer(0,k), mB );
+                  BScaled = factors->B;
+                  for( Int j=0; j<n; ++j )
+                  {
+                      auto b = BScaled( ALL, IR(j) );
+                      b *= X(j,k);
+                  }
+                  Gemm( NORMAL, TRANSPOSE, alpha, BScaled, AOp, beta, Yk );
+              }
+              else
+              {
+                  // z_j := op(b_j)^T (X_k op(a_j))
+                  Matrix<Field> Xk;
+                  Xk.LockedAttach( mB, mA, X.LockedBuffer(0,k), mB );
+                  Gemm( NORMAL, NORMAL, Field(1), Xk, AOp, W );
+                  z.Resize( n, 1 );
+                  structured::ColumnDots
+                  ( orientation, factors->B, W, z.Buffer() );
+                  auto yk = Y( ALL, IR(k) );
+                  circulant_embedding::ScaleOutput( beta, yk );
+                  Axpy( alpha, z, yk );
+              }
+          }
+      };
+    return LinearOperator<Field>( mA*mB, n, apply, true );
+}
+
+template<typename Field>
+DistLinearOperator<Field>
+KhatriRaoOperator
+( const AbstractDistMatrix<Field>& A, const AbstractDistMatrix<Field>& B )
+{
+    EL_DEBUG_CSE
+    if( A.Width() != B.Width() )
+        LogicError("A and B must have the same number of columns");
+    const El::Grid& grid = A.Grid();
+    const Int mA = A.Height();
+    const Int mB = B.Height();
+    const Int n = A.Width();
+    // A is replicated while the rows of B are distributed
+    DistMatrix<Field,STAR,STAR> A_STAR_STAR( A );
+    auto BDist = make_shared<DistMatrix<Field,VC,STAR>>( B );
+    auto factors =
+      structured::MakeKroneckerFactors
+      ( A_STAR_STAR.LockedMatrix(), Matrix<Field>() );
+    auto apply =
+      [=]( Orientation orientation,
+           Field alpha, const DistMultiVec<Field>& X,
+           Field beta,        DistMultiVec<Field>& Y )
+      {
+          const El::Grid& g = X.Grid();
+          const auto& AOp =
+            ( orientation == ADJOINT ? factors->AConj : factors->A );
+          const auto& BLoc = BDist->LockedMatrix();
+          const Int localHeightB = BLoc.Height();
+          const Int width = X.Width();
+          if( orientation == NORMAL )
+          {
+              // Every process forms the rows of B diag(x_k) A^T that
+              // correspond to its rows of B
+              Matrix<Field> XFull;
+              Zeros( XFull, n, width );
+              const auto& XLoc = X.LockedMatrix();
+              for( Int iLoc=0; iLoc<XLoc.Height(); ++iLoc )
+                  for( Int k=0; k<width; ++k )
+                      XFull(X.GlobalRow(iLoc),k) = XLoc(iLoc,k);
+              mpi::AllReduce( XFull.Buffer(), n*width, g.Comm() );
+
+              DistMultiVec<Field> W(g);
+              Zeros( W, mA*mB, width );
+              W.Reserve( localHeightB*mA*width );
+              Matrix<Field> BScaled, V;
+              for( Int k=0; k<width; ++k )
+              {
+                  BScaled = BLoc;
+                  for( Int j=0; j<n; ++j )
+                  {
+                      auto b = BScaled( ALL, IR(j) );
+                      b *= XFull(j,k);
+                  }
+                  Gemm( NORMAL, TRANSPOSE, Field(1), BScaled, AOp, V );
+                  for( Int iA=0; iA<mA; ++iA )
+                      for( Int iLoc=0; iLoc<localHeightB; ++iLoc )
+                          W.QueueUpdate
+                          ( iA*mB + BDist->GlobalRow(iLoc), k, V(iLoc,iA) );
+              }
+              W.ProcessQueues();
+
+              auto& YLoc = Y.Matrix();
+              circulant_embedding::ScaleOutput( beta, YLoc );
+              Axpy( alpha, W.LockedMatrix(), YLoc );
+          }
+          else
+          {
+              // Reshape the columns of X into mB x mA matrices whose rows are
+              // distributed like those of B
+              DistMatrix<Field,VC,STAR> XReshaped(g);
+              XReshaped.AlignWith( *BDist );
+              Zeros( XReshaped, mB, mA*width );
+              {
+                  const auto& XLoc = X.LockedMatrix();
+                  const Int localHeight = XLoc.Height();
+                  XReshaped.Reserve( localHeight*width );
+                  for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                  {
+                      const Int i = X.GlobalRow(iLoc);
+                      for( Int k=0; k<width; ++k )
+                          XReshaped.QueueUpdate
+                          ( i % mB, k*mA + i/mB, XLoc(iLoc,k) );
+                  }
+                  XReshaped.ProcessQueues();
+              }
+
+              // Sum the contributions from each process's rows of B
+              Matrix<Field> Z, W;
+              Zeros( Z, n, width );
+              for( Int k=0; k<width; ++k )
+              {
+                  auto XLoc_k =
+                    XReshaped.LockedMatrix()( ALL, IR(k*mA,(k+1)*mA) );
+                  Gemm( NORMAL, NORMAL, Field(1), XLoc_k, AOp, W );
+                  structured::ColumnDots
+                  ( orientation, BLoc, W, Z.Buffer(0,k) );
+              }
+              mpi::AllReduce( Z.Buffer(), n*width, g.Comm() );
+
+              auto& YLoc = Y.Matrix();
+              circulant_embedding::ScaleOutput( beta, YLoc );
+              for( Int iLoc=0; iLoc<YLoc.Height(); ++iLoc )
+                  for( Int k=0; k<width; ++k )
+                      YLoc(iLoc,k) += alpha*Z(Y.GlobalRow(iLoc),k);
+          }
+      };
+    return DistLinearOperator<Field>( mA*mB, n, grid, apply, true );
+}
+
+#define PROTO(Field) \
+  template LinearOperator<Field> CirculantOperator( const vector<Field>& a ); \
+  template DistLinearOperator<Field> CirculantOperator \
+  ( const vector<Field>& a, const El::Grid& grid ); \
+  template LinearOperator<Field> HankelOperator \
+  ( Int m, Int n, const vector<Field>& a ); \
+  template DistLinearOperator<Field> HankelOperator \
+  ( Int m, Int n, const vector<Field>& a, const El::Grid& grid ); \
+  template LinearOperator<Field> ToeplitzOperator \
+  ( Int m, Int n, const vector<Field>& a ); \
+  template DistLinearOperator<Field> ToeplitzOperator \
+  ( Int m, Int n, const vector<Field>& a, const El::Grid& grid ); \
+  template LinearOperator<Field> WalshOperator( Int k, bool binary ); \
+  template DistLinearOperator<Field> WalshOperator \
+  ( Int k, const El::Grid& grid, bool binary ); \
+  template LinearOperator<Field> KroneckerOperator \
+  ( const Matrix<Field>& A, const Matrix<Field>& B ); \
+  template DistLinearOperator<Field> KroneckerOperator \
+  ( const AbstractDistMatrix<Field>& A, const AbstractDistMatrix<Field>& B ); \
+  template LinearOperator<Field> KhatriRaoOperator \
+  ( const Matrix<Field>& A, const Matrix<Field>& B ); \
+  template DistLinearOperator<Field> KhatriRaoOperator \
+  ( const AbstractDistMatrix<Field>& A, const AbstractDistMatrix<Field>& B );
+
+#define PROTO_REAL(Real) \
+  PROTO(Real) \
+  template LinearOperator<Complex<Real>> FourierOperator<Real>( Int n ); \
+  template DistLinearOperator<Complex<Real>> FourierOperator<Real> \
+  ( Int n, const El::Grid& grid );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./Stencil.hpp"
+
 namespace El {
 
 // 1D Helmholtz
@@ -69,17 +71,21 @@ void Helmholtz( SparseMatrix<F>& H, Int n, F shift )
     const Real hInv = n+1; 
     const Real hInvSquared = hInv*hInv;
     const F mainTerm = 2*hInvSquared - shift;
+    const F xTerm = -hInvSquared;
 
-    H.Reserve( 3*n );
-    for( Int i=0; i<n; ++i )
+    auto fillRow = [&]( Int i, Int* cols, F* values )
     {
-        H.QueueUpdate( i, i, mainTerm );
-        if( i != 0 )
-            H.QueueUpdate( i, i-1, -hInvSquared );
-        if( i != n-1 )
-            H.QueueUpdate( i, i+1, -hInvSquared );
-    }
-    H.ProcessQueues();
+        pde::EmitStencilRow
+        ( i, n, 1, 1, mainTerm,
+          xTerm, xTerm, F(0), F(0), F(0), F(0),
+          cols, values );
+    };
+    vector<Int> offsets, cols;
+    vector<F> values;
+    pde::FormStencilRows
+    ( 0, n, n, 1, 1, fillRow, offsets, cols, values );
+    H.AdoptCompressedRows
+    ( n, n, std::move(offsets), std::move(cols), std::move(values) );
 }
 
 template<typename F>
@@ -92,19 +98,23 @@ void Helmholtz( DistSparseMatrix<F>& H, Int n, F shift )
     const Real hInv = n+1; 
     const Real hInvSquared = hInv*hInv;
     const F mainTerm = 2*hInvSquared - shift;
+    const F xTerm = -hInvSquared;
 
-    const Int localHeight = H.LocalHeight(); 
-    H.Reserve( 3*localHeight );
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    auto fillRow = [&]( Int i, Int* cols, F* values )
     {
-        const Int i = H.GlobalRow(iLoc);
-        H.QueueUpdate( i, i, mainTerm );
-        if( i != 0 )
-            H.QueueUpdate( i, i-1, -hInvSquared );
-        if( i != n-1 )
-            H.QueueUpdate( i, i+1, -hInvSquared );
-    }
-    H.ProcessQueues();
+        pde::EmitStencilRow
+        ( i, n, 1, 1, mainTerm,
+          xTerm, xTerm, F(0), F(0), F(0), F(0),
+          cols, values );
+    };
+    vector<Int> offsets, cols;
+    vector<F> values;
+    pde::FormStencilRows
+    ( H.FirstLocalRow(), H.LocalHeight(),
+      n, 1, 1,
+      fillRow, offsets, cols, values );
+    H.AdoptLocalCompressedRows
+    ( n, n, std::move(offsets), std::move(cols), std::move(values) );
 }
 
 // 2D Helmholtz
@@ -186,24 +196,22 @@ void Helmholtz( SparseMatrix<F>& H, Int nx, Int ny, F shift )
     const Real hxInvSquared = hxInv*hxInv;
     const Real hyInvSquared = hyInv*hyInv;
     const F mainTerm = 2*(hxInvSquared+hyInvSquared) - shift;
+    const F xTerm = -hxInvSquared;
+    const F yTerm = -hyInvSquared;
 
-    H.Reserve( 5*n );
-    for( Int i=0; i<n; ++i )
+    auto fillRow = [&]( Int i, Int* cols, F* values )
     {
-        const Int x = i % nx;
-        const Int y = i/nx;
-
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -hxInvSquared );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -hxInvSquared );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -hyInvSquared );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -hyInvSquared );
-    }
-    H.ProcessQueues();
+        pde::EmitStencilRow
+        ( i, nx, ny, 1, mainTerm,
+          xTerm, xTerm, yTerm, yTerm, F(0), F(0),
+          cols, values );
+    };
+    vector<Int> offsets, cols;
+    vector<F> values;
+    pde::FormStencilRows
+    ( 0, n, nx, ny, 1, fillRow, offsets, cols, values );
+    H.AdoptCompressedRows
+    ( n, n, std::move(offsets), std::move(cols), std::move(values) );
 }
 
 template<typename F>
@@ -219,26 +227,24 @@ void Helmholtz( DistSparseMatrix<F>& H, Int nx, Int ny, F shift )
     const Real hxInvSquared = hxInv*hxInv;
     const Real hyInvSquared = hyInv*hyInv;
     const F mainTerm = 2*(hxInvSquared+hyInvSquared) - shift;
+    const F xTerm = -hxInvSquared;
+    const F yTerm = -hyInvSquared;
 
-    const Int localHeight = H.LocalHeight();
-    H.Reserve( 5*localHeight );
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    auto fillRow = [&]( Int i, Int* cols, F* values )
     {
-        const Int i = H.GlobalRow(iLoc);
-        const Int x = i % nx;
-        const Int y = i/nx;
-
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -hxInvSquared );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -hxInvSquared );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -hyInvSquared );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -hyInvSquared );
-    }
-    H.ProcessQueues();
+        pde::EmitStencilRow
+        ( i, nx, ny, 1, mainTerm,
+          xTerm, xTerm, yTerm, yTerm, F(0), F(0),
+          cols, values );
+    };
+    vector<Int> offsets, cols;
+    vector<F> values;
+    pde::FormStencilRows
+    ( H.FirstLocalRow(), H.LocalHeight(),
+      nx, ny, 1,
+      fillRow, offsets, cols, values );
+    H.AdoptLocalCompressedRows
+    ( n, n, std::move(offsets), std::move(cols), std::move(values) );
 }
 
 // 3D Helmholtz
@@ -336,29 +342,23 @@ void Helmholtz( SparseMatrix<F>& H, Int nx, Int ny, Int nz, F shift )
     const Real hyInvSquared = hyInv*hyInv;
     const Real hzInvSquared = hzInv*hzInv;
     const F mainTerm = 2*(hxInvSquared+hyInvSquared+hzInvSquared) - shift;
+    const F xTerm = -hxInvSquared;
+    const F yTerm = -hyInvSquared;
+    const F zTerm = -hzInvSquared;
 
-    H.Reserve( 7*n );
-    for( Int i=0; i<n; ++i )
+    auto fillRow = [&]( Int i, Int* cols, F* values )
     {
-        const Int x = i % nx;
-        const Int y = (i/nx) % ny;
-        const Int z = i/(nx*ny);
-
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -hxInvSquared );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -hxInvSquared );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -hyInvSquared );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -hyInvSquared );
-        if( z != 0 )
-            H.QueueUpdate( i, i-nx*ny, -hzInvSquared );
-        if( z != nz-1 )
-            H.QueueUpdate( i, i+nx*ny, -hzInvSquared );
-    }
-    H.ProcessQueues();
+        pde::EmitStencilRow
+        ( i, nx, ny, nz, mainTerm,
+          xTerm, xTerm, yTerm, yTerm, zTerm, zTerm,
+          cols, values );
+    };
+    vector<Int> offsets, cols;
+    vector<F> values;
+    pde::FormStencilRows
+    ( 0, n, nx, ny, nz, fillRow, offsets, cols, values );
+    H.AdoptCompressedRows
+    ( n, n, std::move(offsets), std::move(cols), std::move(values) );
 }
 
 template<typename F> 
@@ -376,31 +376,25 @@ void Helmholtz( DistSparseMatrix<F>& H, Int nx, Int ny, Int nz, F shift )
     const Real hyInvSquared = hyInv*hyInv;
     const Real hzInvSquared = hzInv*hzInv;
     const F mainTerm = 2*(hxInvSquared+hyInvSquared+hzInvSquared) - shift;
+    const F xTerm = -hxInvSquared;
+    const F yTerm = -hyInvSquared;
+    const F zTerm = -hzInvSquared;
 
-    const Int localHeight = H.LocalHeight();
-    H.Reserve( 7*localHeight );
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    auto fillRow = [&]( Int i, Int* cols, F* values )
     {
-        const Int i = H.GlobalRow(iLoc);
-        const Int x = i % nx;
-        const Int y = (i/nx) % ny;
-        const Int z = i/(nx*ny);
-
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -hxInvSquared );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -hxInvSquared );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -hyInvSquared );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -hyInvSquared );
-        if( z != 0 )
-            H.QueueUpdate( i, i-nx*ny, -hzInvSquared );
-        if( z != nz-1 )
-            H.QueueUpdate( i, i+nx*ny, -hzInvSquared );
-    }
-    H.ProcessQueues();
+        pde::EmitStencilRow
+        ( i, nx, ny, nz, mainTerm,
+          xTerm, xTerm, yTerm, yTerm, zTerm, zTerm,
+          cols, values );
+    };
+    vector<Int> offsets, cols;
+    vector<F> values;
+    pde::FormStencilRows
+    ( H.FirstLocalRow(), H.LocalHeight(),
+      nx, ny, nz,
+      fillRow, offsets, cols, values );
+    H.AdoptLocalCompressedRows
+    ( n, n, std::move(offsets), std::move(cols), std::move(values) );
 }
 
 #define PROTO(F) \
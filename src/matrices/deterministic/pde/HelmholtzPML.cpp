@@ -10,6 +10,8 @@
 #include <El/blas_like/level1.hpp>
 #include <El/matrices.hpp>
 
+#include "./Stencil.hpp"
+
 namespace El {
 
 namespace pml {
@@ -142,8 +144,7 @@ void HelmholtzPML
     const Real h = Real(1)/(n+1);
     const Real hSquared = h*h;
  
-    H.Reserve( 3*n );
-    for( Int i=0; i<n; ++i )
+    auto fillRow = [&]( Int i, Int* cols, C* values )
     {
         const Int x = i;
 
@@ -161,13 +162,17 @@ void HelmholtzPML
 
         const C mainTerm = (xTermL+xTermR) - omega*omega*sInvM;
 
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -xTermL );
-        if( x != n-1 )
-            H.QueueUpdate( i, i+1, -xTermR );
-    }
-    H.ProcessQueues();
+        pde::EmitStencilRow
+        ( i, n, 1, 1, mainTerm,
+          -xTermL, -xTermR, C(0), C(0), C(0), C(0),
+          cols, values );
+    };
+    vector<Int> offsets, cols;
+    vector<C> values;
+    pde::FormStencilRows
+    ( 0, n, n, 1, 1, fillRow, offsets, cols, values );
+    H.AdoptCompressedRows
+    ( n, n, std::move(offsets), std::move(cols), std::move(values) );
 }
 
 template<typename Real> 
@@ -184,11 +189,8 @@ void HelmholtzPML
     const Real h = Real(1)/(n+1);
     const Real hSquared = h*h;
  
-    const Int localHeight = H.LocalHeight();
-    H.Reserve( 3*localHeight );
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    auto fillRow = [&]( Int i, Int* cols, C* values )
     {
-        const Int i = H.GlobalRow(iLoc);
         const Int x = i;
 
         const C sInvL = sInv( x-1, n, numPmlPoints, h, pmlExp, sigma, k );
@@ -205,13 +207,18 @@ void HelmholtzPML
 
         const C mainTerm = (xTermL+xTermR) - omega*omega*sInvM;
 
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -xTermL );
-        if( x != n-1 )
-            H.QueueUpdate( i, i+1, -xTermR );
-    }
-    H.ProcessQueues();
+        pde::EmitStencilRow
+        ( i, n, 1, 1, mainTerm,
+          -xTermL, -xTermR, C(0), C(0), C(0), C(0),
+          cols, values );
+    };
+    vector<Int> offsets, cols;
+    vector<C> values;
+    pde::FormStencilRows
+    ( H.FirstLocalRow(), H.LocalHeight(),
+      n, 1, 1, fillRow, offsets, cols, values );
+    H.AdoptLocalCompressedRows
+    ( n, n, std::move(offsets), std::move(cols), std::move(values) );
 }
 
 // 2D Helmholtz with PML
@@ -352,8 +359,7 @@ void HelmholtzPML
     const Real hxSquared = hx*hx;
     const Real hySquared = hy*hy;
 
-    H.Reserve( 5*n );
-    for( Int i=0; i<n; ++i )
+    auto fillRow = [&]( Int i, Int* cols, C* values )
     {
         const Int x = i % nx;
         const Int y = i / nx; 
@@ -383,17 +389,17 @@ void HelmholtzPML
         const C mainTerm = (xTermL+xTermR+yTermL+yTermR) - 
                            omega*omega*sxInvM*syInvM;
 
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -xTermL );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -xTermR );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -yTermL );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -yTermR );
-    }
-    H.ProcessQueues();
+        pde::EmitStencilRow
+        ( i, nx, ny, 1, mainTerm,
+          -xTermL, -xTermR, -yTermL, -yTermR, C(0), C(0),
+          cols, values );
+    };
+    vector<Int> offsets, cols;
+    vector<C> values;
+    pde::FormStencilRows
+    ( 0, n, nx, ny, 1, fillRow, offsets, cols, values );
+    H.AdoptCompressedRows
+    ( n, n, std::move(offsets), std::move(cols), std::move(values) );
 }
 
 template<typename Real> 
@@ -413,11 +419,8 @@ void HelmholtzPML
     const Real hxSquared = hx*hx;
     const Real hySquared = hy*hy;
 
-    const Int localHeight = H.LocalHeight();
-    H.Reserve( 5*localHeight );
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    auto fillRow = [&]( Int i, Int* cols, C* values )
     {
-        const Int i = H.GlobalRow(iLoc);
         const Int x = i % nx;
         const Int y = i / nx; 
 
@@ -446,17 +449,18 @@ void HelmholtzPML
         const C mainTerm = (xTermL+xTermR+yTermL+yTermR) - 
                            omega*omega*sxInvM*syInvM;
 
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -xTermL );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -xTermR );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -yTermL );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -yTermR );
-    }
-    H.ProcessQueues();
+        pde::EmitStencilRow
+        ( i, nx, ny, 1, mainTerm,
+          -xTermL, -xTermR, -yTermL, -yTermR, C(0), C(0),
+          cols, values );
+    };
+    vector<Int> offsets, cols;
+    vector<C> values;
+    pde::FormStencilRows
+    ( H.FirstLocalRow(), H.LocalHeight(),
+      nx, ny, 1, fillRow, offsets, cols, values );
+    H.AdoptLocalCompressedRows
+    ( n, n, std::move(offsets), std::move(cols), std::move(values) );
 }
 
 // 3D Helmholtz with PML
@@ -635,8 +639,7 @@ void HelmholtzPML
     const Real hySquared = hy*hy;
     const Real hzSquared = hz*hz;
 
-    H.Reserve( 7*n );
-    for( Int i=0; i<n; ++i )
+    auto fillRow = [&]( Int i, Int* cols, C* values )
     {
         const Int x = i % nx;
         const Int y = (i/nx) % ny; 
@@ -678,21 +681,18 @@ void HelmholtzPML
         const C mainTerm = (xTermL+xTermR+yTermL+yTermR+zTermL+zTermR) - 
                            omega*omega*sxInvM*syInvM*szInvM;
 
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -xTermL );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -xTermR );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -yTermL );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -yTermR );
-        if( z != 0 )
-            H.QueueUpdate( i, i-nx*ny, -zTermL );
-        if( z != nz-1 )
-            H.QueueUpdate( i, i+nx*ny, -zTermR );
-    }
-    H.ProcessQueues();
+        pde::EmitStencilRow
+        ( i, nx, ny, nz, mainTerm,
+          -xTermL, -xTermR, -yTermL, -yTermR,
+          -zTermL, -zTermR,
+          cols, values );
+    };
+    vector<Int> offsets, cols;
+    vector<C> values;
+    pde::FormStencilRows
+    ( 0, n, nx, ny, nz, fillRow, offsets, cols, values );
+    H.AdoptCompressedRows
+    ( n, n, std::move(offsets), std::move(cols), std::move(values) );
 }
 
 template<typename Real> 
@@ -714,11 +714,8 @@ void HelmholtzPML
     const Real hySquared = hy*hy;
     const Real hzSquared = hz*hz;
 
-    const Int localHeight = H.LocalHeight();
-    H.Reserve( 7*localHeight );
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    auto fillRow = [&]( Int i, Int* cols, C* values )
     {
-        const Int i = H.GlobalRow(iLoc);
         const Int x = i % nx;
         const Int y = (i/nx) % ny; 
         const Int z = i/(nx*ny);
@@ -759,21 +756,19 @@ void HelmholtzPML
         const C mainTerm = (xTermL+xTermR+yTermL+yTermR+zTermL+zTermR) - 
                            omega*omega*sxInvM*syInvM*szInvM;
 
-        H.QueueUpdate( i, i, mainTerm );
-        if( x != 0 )
-            H.QueueUpdate( i, i-1, -xTermL );
-        if( x != nx-1 )
-            H.QueueUpdate( i, i+1, -xTermR );
-        if( y != 0 )
-            H.QueueUpdate( i, i-nx, -yTermL );
-        if( y != ny-1 )
-            H.QueueUpdate( i, i+nx, -yTermR );
-        if( z != 0 )
-            H.QueueUpdate( i, i-nx*ny, -zTermL );
-        if( z != nz-1 )
-            H.QueueUpdate( i, i+nx*ny, -zTermR );
-    }
-    H.ProcessQueues();
+        pde::EmitStencilRow
+        ( i, nx, ny, nz, mainTerm,
+          -xTermL, -xTermR, -yTermL, -yTermR,
+          -zTermL, -zTermR,
+          cols, values );
+    };
+    vector<Int> offsets, cols;
+    vector<C> values;
+    pde::FormStencilRows
+    ( H.FirstLocalRow(), H.LocalHeight(),
+      nx, ny, nz, fillRow, offsets, cols, values );
+    H.AdoptLocalCompressedRows
+    ( n, n, std::move(offsets), std::move(cols), std::move(values) );
 }
 
 #define PROTO(Real) \
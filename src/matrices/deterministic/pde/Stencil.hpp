@@ -0,0 +1,88 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_MATRICES_PDE_STENCIL_HPP
+#define EL_MATRICES_PDE_STENCIL_HPP
+
+namespace El {
+namespace pde {
+
+// Direct formation of the compressed rows of (2d+1)-point stencils
+// ================================================================
+// Since the sparsity pattern of each row of a finite-difference operator over
+// an nx x ny x nz grid is known in closed form (with ny=nz=1 in 1D and nz=1
+// in 2D), the row offsets, sorted column indices, and values can be written
+// directly (and in parallel) rather than queued, sorted, and combined.
+
+inline Int StencilRowSize( Int i, Int nx, Int ny, Int nz )
+{
+    const Int x = i % nx;
+    const Int y = (i/nx) % ny;
+    const Int z = i/(nx*ny);
+    return 1 + (x!=0) + (x!=nx-1) + (y!=0) + (y!=ny-1) + (z!=0) + (z!=nz-1);
+}
+
+// Write row i in increasing column order; the left and right terms are the
+// values of the connections to the previous and next points in each dimension
+template<typename F>
+void EmitStencilRow
+( Int i, Int nx, Int ny, Int nz,
+  const F& mainTerm,
+  const F& xTermL, const F& xTermR,
+  const F& yTermL, const F& yTermR,
+  const F& zTermL, const F& zTermR,
+  Int* cols, F* values )
+{
+    const Int x = i % nx;
+    const Int y = (i/nx) % ny;
+    const Int z = i/(nx*ny);
+    Int k = 0;
+    if( z != 0 )
+    { cols[k] = i-nx*ny; values[k] = zTermL; ++k; }
+    if( y != 0 )
+    { cols[k] = i-nx; values[k] = yTermL; ++k; }
+    if( x != 0 )
+    { cols[k] = i-1; values[k] = xTermL; ++k; }
+    cols[k] = i; values[k] = mainTerm; ++k;
+    if( x != nx-1 )
+    { cols[k] = i+1; values[k] = xTermR; ++k; }
+    if( y != ny-1 )
+    { cols[k] = i+nx; values[k] = yTermR; ++k; }
+    if( z != nz-1 )
+    { cols[k] = i+nx*ny; values[k] = zTermR; ++k; }
+}
+
+// Form the compressed rows [firstRow,firstRow+numRows), where
+// fillRow( i, cols, values ) writes row i via EmitStencilRow
+template<typename F,class RowFunctor>
+void FormStencilRows
+( Int firstRow, Int numRows, Int nx, Int ny, Int nz,
+  const RowFunctor& fillRow,
+  vector<Int>& offsets, vector<Int>& cols, vector<F>& values )
+{
+    EL_DEBUG_CSE
+    offsets.resize( numRows+1 );
+    offsets[0] = 0;
+    EL_PARALLEL_FOR
+    for( Int iLoc=0; iLoc<numRows; ++iLoc )
+        offsets[iLoc+1] = StencilRowSize( firstRow+iLoc, nx, ny, nz );
+    for( Int iLoc=0; iLoc<numRows; ++iLoc )
+        offsets[iLoc+1] += offsets[iLoc];
+
+    cols.resize( offsets[numRows] );
+    values.resize( offsets[numRows] );
+    EL_PARALLEL_FOR
+    for( Int iLoc=0; iLoc<numRows; ++iLoc )
+        fillRow
+        ( firstRow+iLoc, &cols[offsets[iLoc]], &values[offsets[iLoc]] );
+}
+
+} // namespace pde
+} // namespace El
+
+#endif // ifndef EL_MATRICES_PDE_STENCIL_HPP
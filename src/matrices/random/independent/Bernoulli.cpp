@@ -12,6 +12,18 @@
 
 namespace El {
 
+namespace {
+
+template<typename T>
+T BernoulliSample( const CounterRNG& rng, Int i, Int j, double q )
+{
+    double alpha, unused;
+    rng.Uniform( i, j, alpha, unused );
+    return ( alpha <= q ? T(0) : T(1) );
+}
+
+} // anonymous namespace
+
 template<typename T>
 void Bernoulli( Matrix<T>& A, Int m, Int n, double p )
 { 
@@ -21,6 +33,13 @@ void Bernoulli( Matrix<T>& A, Int m, Int n, double p )
         ("Invalid choice of parameter p for Bernoulli distribution: ",p);
     A.Resize( m, n );
     const double q = 1-p;
+    if( CounterBasedRandom() )
+    {
+        const CounterRNG rng = NewCounterRNG( false );
+        IndexDependentFill
+        ( A, [&]( Int i, Int j ) { return BernoulliSample<T>(rng,i,j,q); } );
+        return;
+    }
     auto doubleCoin = [=]() -> T
     {
         const double alpha = SampleUniform<double>(0,1);
@@ -39,6 +58,13 @@ void Bernoulli( AbstractDistMatrix<T>& A, Int m, Int n, double p )
         ("Invalid choice of parameter p for Bernoulli distribution: ",p);
     A.Resize( m, n );
     const double q = 1-p;
+    if( CounterBasedRandom() )
+    {
+        const CounterRNG rng = NewCounterRNG( true );
+        IndexDependentFill
+        ( A, [&]( Int i, Int j ) { return BernoulliSample<T>(rng,i,j,q); } );
+        return;
+    }
     auto doubleCoin = [=]() -> T
     {
         const double alpha = SampleUniform<double>(0,1);
@@ -17,6 +17,14 @@ template<typename F>
 void MakeGaussian( Matrix<F>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
+    if( CounterBasedRandom() )
+    {
+        const CounterRNG rng = NewCounterRNG( false );
+        IndexDependentFill
+        ( A, [&]( Int i, Int j )
+          { return SampleNormal( rng, i, j, mean, stddev ); } );
+        return;
+    }
     auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
     EntrywiseFill( A, function<F()>(sampleNormal) );
 }
@@ -25,6 +33,15 @@ template<typename F>
 void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
+    if( CounterBasedRandom() )
+    {
+        // Every redundant copy generates identical entries
+        const CounterRNG rng = NewCounterRNG( true );
+        IndexDependentFill
+        ( A, [&]( Int i, Int j )
+          { return SampleNormal( rng, i, j, mean, stddev ); } );
+        return;
+    }
     if( A.RedundantRank() == 0 )
         MakeGaussian( A.Matrix(), mean, stddev );
     Broadcast( A, A.RedundantComm(), 0 );
@@ -34,6 +51,14 @@ template<typename F>
 void MakeGaussian( DistMultiVec<F>& A, F mean, Base<F> stddev )
 {
     EL_DEBUG_CSE
+    if( CounterBasedRandom() )
+    {
+        const CounterRNG rng = NewCounterRNG( true );
+        IndexDependentFill
+        ( A, [&]( Int i, Int j )
+          { return SampleNormal( rng, i, j, mean, stddev ); } );
+        return;
+    }
     auto sampleNormal = [=]() { return SampleNormal(mean,stddev); };
     EntrywiseFill( A, function<F()>(sampleNormal) );
 }
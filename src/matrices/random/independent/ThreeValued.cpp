@@ -12,11 +12,32 @@
 
 namespace El {
 
+namespace {
+
+template<typename T>
+T ThreeValuedSample( const CounterRNG& rng, Int i, Int j, double p )
+{
+    double alpha, unused;
+    rng.Uniform( i, j, alpha, unused );
+    if( alpha <= p/2 ) return T(-1);
+    else if( alpha <= p ) return T(1);
+    else return T(0);
+}
+
+} // anonymous namespace
+
 template<typename T>
 void ThreeValued( Matrix<T>& A, Int m, Int n, double p )
 {
     EL_DEBUG_CSE
     A.Resize( m, n );
+    if( CounterBasedRandom() )
+    {
+        const CounterRNG rng = NewCounterRNG( false );
+        IndexDependentFill
+        ( A, [&]( Int i, Int j ) { return ThreeValuedSample<T>(rng,i,j,p); } );
+        return;
+    }
     auto tripleCoin = [=]() -> T
     { 
         const double alpha = SampleUniform<double>(0,1);
@@ -32,6 +53,14 @@ void ThreeValued( AbstractDistMatrix<T>& A, Int m, Int n, double p )
 {
     EL_DEBUG_CSE
     A.Resize( m, n );
+    if( CounterBasedRandom() )
+    {
+        // Every redundant copy generates identical entries
+        const CounterRNG rng = NewCounterRNG( true );
+        IndexDependentFill
+        ( A, [&]( Int i, Int j ) { return ThreeValuedSample<T>(rng,i,j,p); } );
+        return;
+    }
     if( A.RedundantRank() == 0 )
         ThreeValued( A.Matrix(), A.LocalHeight(), A.LocalWidth(), p );
     Broadcast( A, A.RedundantComm(), 0 );
@@ -18,6 +18,14 @@ template<typename T>
 void MakeUniform( Matrix<T>& A, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
+    if( CounterBasedRandom() )
+    {
+        const CounterRNG rng = NewCounterRNG( false );
+        IndexDependentFill
+        ( A, [&]( Int i, Int j )
+          { return SampleBall( rng, i, j, center, radius ); } );
+        return;
+    }
     auto sampleBall = [=]() { return SampleBall(center,radius); };
     EntrywiseFill( A, function<T()>(sampleBall) );
 }
@@ -34,6 +42,15 @@ template<typename T>
 void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
+    if( CounterBasedRandom() )
+    {
+        // Every redundant copy generates identical entries
+        const CounterRNG rng = NewCounterRNG( true );
+        IndexDependentFill
+        ( A, [&]( Int i, Int j )
+          { return SampleBall( rng, i, j, center, radius ); } );
+        return;
+    }
     if( A.RedundantRank() == 0 )
         MakeUniform( A.Matrix(), center, radius );
     Broadcast( A, A.RedundantComm(), 0 );
@@ -51,6 +68,14 @@ template<typename T>
 void MakeUniform( DistMultiVec<T>& X, T center, Base<T> radius )
 {
     EL_DEBUG_CSE
+    if( CounterBasedRandom() )
+    {
+        const CounterRNG rng = NewCounterRNG( true );
+        IndexDependentFill
+        ( X, [&]( Int i, Int j )
+          { return SampleBall( rng, i, j, center, radius ); } );
+        return;
+    }
     const int localHeight = X.LocalHeight();
     const int width = X.Width();
     for( int j=0; j<width; ++j )
@@ -7,52 +7,127 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El-lite.hpp>
+#include <El/blas_like/level1.hpp>
 #include <El/lapack_like/factor.hpp>
+#include <El/lapack_like/reflect.hpp>
 #include <El/matrices.hpp>
 
 namespace El {
 
+// Since applying a Householder reflector to a Gaussian vector leaves the
+// trailing entries independent and Gaussian, the reflectors of the QR
+// factorization of a Gaussian matrix are distributed identically to those of
+// the columns of an independent Gaussian matrix. Forming each reflector
+// directly from its column (as in Stewart's scheme) therefore yields a
+// Haar-distributed implicit unitary in quadratic time, and stopping after
+// the first 'numReflectors' columns yields a cheaper random unitary which
+// is not Haar-distributed (but may suffice for generating test matrices).
+
 template<typename F>
-void Haar( Matrix<F>& A, Int n )
+void ImplicitRandomReflectors
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature, Int n, Int numReflectors )
 {
     EL_DEBUG_CSE
-    // TODO: Replace this with a quadratic scheme similar to Stewart's, which
-    //       essentially generates random Householder reflectors
-    Gaussian( A, n, n );
-    qr::ExplicitUnitary( A );
+    typedef Base<F> Real;
+    if( numReflectors < 0 || numReflectors > n )
+        LogicError("Invalid number of reflectors: ",numReflectors);
+    Gaussian( A, n, numReflectors );
+    householderScalars.Resize( numReflectors, 1 );
+    signature.Resize( numReflectors, 1 );
+    for( Int k=0; k<numReflectors; ++k )
+    {
+        auto alpha11 = A( IR(k), IR(k) );
+        auto a21 = A( IR(k+1,END), IR(k) );
+        householderScalars(k) = LeftReflector( alpha11, a21 );
+        signature(k) = ( RealPart(alpha11(0)) >= Real(0) ? 1 : -1 );
+    }
 }
 
 template<typename F>
-void ImplicitHaar( Matrix<F>& A, Matrix<F>& t, Matrix<Base<F>>& d, Int n )
+void ImplicitRandomReflectors
+( ElementalMatrix<F>& A,
+  ElementalMatrix<F>& householderScalars,
+  ElementalMatrix<Base<F>>& signature, Int n, Int numReflectors )
 {
     EL_DEBUG_CSE
-    // TODO: Replace this with a quadratic scheme similar to Stewart's, which
-    //       essentially generates random Householder reflectors
-    Gaussian( A, n, n );
-    QR( A, t, d );
+    typedef Base<F> Real;
+    if( numReflectors < 0 || numReflectors > n )
+        LogicError("Invalid number of reflectors: ",numReflectors);
+    const Grid& grid = A.Grid();
+
+    // Each column (and its scalars) is owned by a single process, so the
+    // reflectors can be formed without any communication
+    DistMatrix<F,STAR,VR> A_STAR_VR(grid);
+    DistMatrix<F,VR,STAR> householderScalars_VR_STAR(grid);
+    DistMatrix<Real,VR,STAR> signature_VR_STAR(grid);
+    Gaussian( A_STAR_VR, n, numReflectors );
+    householderScalars_VR_STAR.Resize( numReflectors, 1 );
+    signature_VR_STAR.Resize( numReflectors, 1 );
+
+    auto& ALoc = A_STAR_VR.Matrix();
+    const Int localWidth = A_STAR_VR.LocalWidth();
+    for( Int kLoc=0; kLoc<localWidth; ++kLoc )
+    {
+        const Int k = A_STAR_VR.GlobalCol(kLoc);
+        auto alpha11 = ALoc( IR(k), IR(kLoc) );
+        auto a21 = ALoc( IR(k+1,END), IR(kLoc) );
+        householderScalars_VR_STAR.SetLocal
+        ( kLoc, 0, LeftReflector( alpha11, a21 ) );
+        signature_VR_STAR.SetLocal
+        ( kLoc, 0, RealPart(alpha11(0)) >= Real(0) ? Real(1) : Real(-1) );
+    }
+    Copy( A_STAR_VR, A );
+    Copy( householderScalars_VR_STAR, householderScalars );
+    Copy( signature_VR_STAR, signature );
 }
 
 template<typename F>
-void Haar( ElementalMatrix<F>& A, Int n )
+void ImplicitHaar
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature, Int n )
 {
     EL_DEBUG_CSE
-    // TODO: Replace this with a quadratic scheme similar to Stewart's, which
-    //       essentially generates random Householder reflectors
-    Gaussian( A, n, n );
-    qr::ExplicitUnitary( A );
+    ImplicitRandomReflectors( A, householderScalars, signature, n, n );
 }
 
 template<typename F>
 void ImplicitHaar
 ( ElementalMatrix<F>& A,
-  ElementalMatrix<F>& t, 
-  ElementalMatrix<Base<F>>& d, Int n )
+  ElementalMatrix<F>& householderScalars,
+  ElementalMatrix<Base<F>>& signature, Int n )
+{
+    EL_DEBUG_CSE
+    ImplicitRandomReflectors( A, householderScalars, signature, n, n );
+}
+
+template<typename F>
+void Haar( Matrix<F>& A, Int n )
 {
     EL_DEBUG_CSE
-    // TODO: Replace this with a quadratic scheme similar to Stewart's, which
-    //       essentially generates random Householder reflectors
-    Gaussian( A, n, n );
-    QR( A, t, d );
+    Matrix<F> Q, householderScalars;
+    Matrix<Base<F>> signature;
+    ImplicitHaar( Q, householderScalars, signature, n );
+    Identity( A, n, n );
+    qr::ApplyQ( LEFT, NORMAL, Q, householderScalars, signature, A );
+}
+
+template<typename F>
+void Haar( ElementalMatrix<F>& APre, Int n )
+{
+    EL_DEBUG_CSE
+    DistMatrixWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    const Grid& grid = A.Grid();
+
+    DistMatrix<F> Q(grid);
+    DistMatrix<F,MD,STAR> householderScalars(grid);
+    DistMatrix<Base<F>,MD,STAR> signature(grid);
+    ImplicitHaar( Q, householderScalars, signature, n );
+    Identity( A, n, n );
+    qr::ApplyQ( LEFT, NORMAL, Q, householderScalars, signature, A );
 }
 
 #define PROTO(F) \
@@ -65,7 +140,15 @@ void ImplicitHaar
   template void ImplicitHaar \
   ( ElementalMatrix<F>& A, \
     ElementalMatrix<F>& t, \
-    ElementalMatrix<Base<F>>& d, Int n );
+    ElementalMatrix<Base<F>>& d, Int n ); \
+  template void ImplicitRandomReflectors \
+  ( Matrix<F>& A, \
+    Matrix<F>& t, \
+    Matrix<Base<F>>& d, Int n, Int numReflectors ); \
+  template void ImplicitRandomReflectors \
+  ( ElementalMatrix<F>& A, \
+    ElementalMatrix<F>& t, \
+    ElementalMatrix<Base<F>>& d, Int n, Int numReflectors );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
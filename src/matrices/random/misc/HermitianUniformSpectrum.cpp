@@ -16,11 +16,12 @@
 namespace El {
 
 // Draw the spectrum from the specified half-open interval on the real line,
-// then rotate with a Haar matrix
+// then rotate with a Haar matrix (or, if numReflectors is nonnegative, with
+// the product of that many random reflectors)
 
 template<typename F>
 void HermitianUniformSpectrum
-( Matrix<F>& A, Int n, Base<F> lower, Base<F> upper )
+( Matrix<F>& A, Int n, Base<F> lower, Base<F> upper, Int numReflectors )
 {
     EL_DEBUG_CSE
     A.Resize( n, n );
@@ -35,7 +36,10 @@ void HermitianUniformSpectrum
     // Apply a Haar matrix from both sides
     Matrix<F> Q, t;
     Matrix<Real> s;
-    ImplicitHaar( Q, t, s, n );
+    if( numReflectors < 0 )
+        ImplicitHaar( Q, t, s, n );
+    else
+        ImplicitRandomReflectors( Q, t, s, n, numReflectors );
     qr::ApplyQ( LEFT, NORMAL, Q, t, s, A );
     qr::ApplyQ( RIGHT, ADJOINT, Q, t, s, A );
 
@@ -44,7 +48,8 @@ void HermitianUniformSpectrum
 
 template<typename F>
 void HermitianUniformSpectrum
-( ElementalMatrix<F>& APre, Int n, Base<F> lower, Base<F> upper )
+( ElementalMatrix<F>& APre, Int n, Base<F> lower, Base<F> upper,
+  Int numReflectors )
 {
     EL_DEBUG_CSE
     APre.Resize( n, n );
@@ -67,7 +72,10 @@ void HermitianUniformSpectrum
     DistMatrix<F> Q(grid);
     DistMatrix<F,MD,STAR> t(grid);
     DistMatrix<Real,MD,STAR> s(grid);
-    ImplicitHaar( Q, t, s, n );
+    if( numReflectors < 0 )
+        ImplicitHaar( Q, t, s, n );
+    else
+        ImplicitRandomReflectors( Q, t, s, n, numReflectors );
 
     // Copy the result into the correct distribution
     qr::ApplyQ( LEFT, NORMAL, Q, t, s, A );
@@ -79,9 +87,11 @@ void HermitianUniformSpectrum
 
 #define PROTO(F) \
   template void HermitianUniformSpectrum \
-  ( Matrix<F>& A, Int n, Base<F> lower, Base<F> upper ); \
+  ( Matrix<F>& A, Int n, Base<F> lower, Base<F> upper, \
+    Int numReflectors ); \
   template void HermitianUniformSpectrum \
-  ( ElementalMatrix<F>& A, Int n, Base<F> lower, Base<F> upper );
+  ( ElementalMatrix<F>& A, Int n, Base<F> lower, Base<F> upper, \
+    Int numReflectors );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -14,11 +14,13 @@
 namespace El {
 
 // Draw the spectrum from the specified half-open interval on the real line,
-// then rotate with a Haar matrix
+// then rotate with a Haar matrix (or, if numReflectors is nonnegative, with
+// the product of that many random reflectors)
 
 template<typename Real>
 void NormalUniformSpectrum
-( Matrix<Complex<Real>>& A, Int n, Complex<Real> center, Real radius )
+( Matrix<Complex<Real>>& A, Int n, Complex<Real> center, Real radius,
+  Int numReflectors )
 {
     EL_DEBUG_CSE
     typedef Complex<Real> C;
@@ -33,7 +35,10 @@ void NormalUniformSpectrum
     // Apply a Haar matrix from both sides
     Matrix<C> Q, t;
     Matrix<Real> s;
-    ImplicitHaar( Q, t, s, n );
+    if( numReflectors < 0 )
+        ImplicitHaar( Q, t, s, n );
+    else
+        ImplicitRandomReflectors( Q, t, s, n, numReflectors );
     qr::ApplyQ( LEFT, NORMAL, Q, t, s, A );
     qr::ApplyQ( RIGHT, ADJOINT, Q, t, s, A );
 }
@@ -41,7 +46,7 @@ void NormalUniformSpectrum
 template<typename Real>
 void NormalUniformSpectrum
 ( ElementalMatrix<Complex<Real>>& APre, Int n, 
-  Complex<Real> center, Real radius )
+  Complex<Real> center, Real radius, Int numReflectors )
 {
     EL_DEBUG_CSE
     typedef Complex<Real> C;
@@ -64,7 +69,10 @@ void NormalUniformSpectrum
     DistMatrix<C> Q(grid);
     DistMatrix<C,MD,STAR> t(grid);
     DistMatrix<Real,MD,STAR> s(grid);
-    ImplicitHaar( Q, t, s, n );
+    if( numReflectors < 0 )
+        ImplicitHaar( Q, t, s, n );
+    else
+        ImplicitRandomReflectors( Q, t, s, n, numReflectors );
 
     // Copy the result into the correct distribution
     qr::ApplyQ( LEFT, NORMAL, Q, t, s, A );
@@ -73,10 +81,11 @@ void NormalUniformSpectrum
 
 #define PROTO(Real) \
   template void NormalUniformSpectrum \
-  ( Matrix<Complex<Real>>& A, Int n, Complex<Real> center, Real radius ); \
+  ( Matrix<Complex<Real>>& A, Int n, Complex<Real> center, Real radius, \
+    Int numReflectors ); \
   template void NormalUniformSpectrum \
   ( ElementalMatrix<Complex<Real>>& A, Int n, \
-    Complex<Real> center, Real radius );
+    Complex<Real> center, Real radius, Int numReflectors );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
@@ -37,6 +37,10 @@ ElError ElLLLCtrlDefault_s( ElLLLCtrl_s* ctrl )
     ctrl->time = false;
     ctrl->jumpstart = false;
     ctrl->startCol = 0;
+    ctrl->deepInsertionDepth = 0;
+    ctrl->segmented = false;
+    ctrl->segmentSize = 32;
+    ctrl->maxSegmentSweeps = 8;
     return EL_SUCCESS;
 }
 
@@ -62,6 +66,10 @@ ElError ElLLLCtrlDefault_d( ElLLLCtrl_d* ctrl )
     ctrl->time = false;
     ctrl->jumpstart = false;
     ctrl->startCol = 0;
+    ctrl->deepInsertionDepth = 0;
+    ctrl->segmented = false;
+    ctrl->segmentSize = 32;
+    ctrl->maxSegmentSweeps = 8;
     return EL_SUCCESS;
 }
 
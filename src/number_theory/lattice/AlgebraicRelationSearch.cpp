@@ -10,6 +10,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./BatchSearch.hpp"
 
 namespace El {
 
@@ -41,6 +42,51 @@ Int AlgebraicRelationSearch
     return info.nullity;
 }
 
+template<typename Field>
+void AlgebraicRelationSearchBatch
+( const Matrix<Field>& alphas,
+        Int n,
+        Base<Field> NSqrt,
+        Matrix<Int>& numExact,
+        Matrix<Field>& relations,
+  const LLLCtrl<Base<Field>>& ctrl,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    if( alphas.Width() != 1 )
+        LogicError("alphas was assumed to be a column vector");
+    const Int numQueries = alphas.Height();
+    const Int m = n+1;
+
+    // Each query is owned by a single process, so the results are zeroed
+    // and then summed over the communicator
+    Zeros( numExact, numQueries, 1 );
+    Zeros( relations, n, numQueries );
+
+    // The basis scaffold, the transformation, and the R factor are reused
+    // between the queries handled by each process
+    Matrix<Field> B, U, R;
+    auto search =
+      [&]( Int q )
+      {
+          Identity( B, m, n );
+          auto bLastRow = B( IR(m-1), ALL );
+          for( Int j=0; j<n; ++j )
+              bLastRow(0,j) = Pow(alphas(q),Real(j));
+          Scale( NSqrt, bLastRow );
+
+          auto info = AdaptiveLLL( B, U, R, ctrl );
+          numExact(q) = info.nullity;
+          auto relation = relations( ALL, IR(q) );
+          Copy( U( ALL, IR(0) ), relation );
+      };
+    lattice::DynamicallyScheduleQueries( numQueries, search, comm );
+
+    mpi::AllReduce( numExact.Buffer(), numQueries, mpi::SUM, comm );
+    mpi::AllReduce( relations.Buffer(), n*numQueries, mpi::SUM, comm );
+}
+
 #define PROTO(Field) \
   template Int AlgebraicRelationSearch \
   ( Field alpha, \
@@ -48,7 +94,15 @@ Int AlgebraicRelationSearch
     Base<Field> NSqrt, \
     Matrix<Field>& B, \
     Matrix<Field>& U, \
-    const LLLCtrl<Base<Field>>& ctrl );
+    const LLLCtrl<Base<Field>>& ctrl ); \
+  template void AlgebraicRelationSearchBatch \
+  ( const Matrix<Field>& alphas, \
+          Int n, \
+          Base<Field> NSqrt, \
+          Matrix<Int>& numExact, \
+          Matrix<Field>& relations, \
+    const LLLCtrl<Base<Field>>& ctrl, \
+          mpi::Comm comm );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -0,0 +1,83 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LATTICE_BATCH_SEARCH_HPP
+#define EL_LATTICE_BATCH_SEARCH_HPP
+
+namespace El {
+namespace lattice {
+
+// Apply 'search' to each query index in [0,numQueries), with the indices
+// dealt out dynamically over the processes of 'comm' since the cost of a
+// lattice reduction varies widely between queries. The root process hands out
+// one index per request in between its own searches, and every other process
+// requests its next index before beginning its current one so that the
+// exchange is overlapped with the search.
+template<typename Search>
+void DynamicallyScheduleQueries
+( Int numQueries, Search& search, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    if( commSize == 1 )
+    {
+        for( Int q=0; q<numQueries; ++q )
+            search( q );
+        return;
+    }
+
+    const int root = 0;
+    const int requestTag = 0;
+    const int replyTag = 1;
+    if( commRank == root )
+    {
+        Int nextQuery = 0;
+        int numActive = commSize-1;
+        mpi::Status status;
+        while( true )
+        {
+            // Answer each of the pending requests, where a negative reply
+            // retires the requesting process
+            while( mpi::IProbe( mpi::ANY_SOURCE, requestTag, comm, status ) )
+            {
+                const int source = status.MPI_SOURCE;
+                mpi::TaggedRecv<int>( source, requestTag, comm );
+                const Int reply =
+                  ( nextQuery < numQueries ? nextQuery++ : Int(-1) );
+                if( reply < 0 )
+                    --numActive;
+                mpi::TaggedSend( reply, source, replyTag, comm );
+            }
+            if( nextQuery < numQueries )
+                search( nextQuery++ );
+            else if( numActive == 0 )
+                break;
+        }
+    }
+    else
+    {
+        mpi::TaggedSend( commRank, root, requestTag, comm );
+        Int query = mpi::TaggedRecv<Int>( root, replyTag, comm );
+        while( query >= 0 )
+        {
+            Int nextQuery;
+            mpi::Request<Int> request;
+            mpi::TaggedSend( commRank, root, requestTag, comm );
+            mpi::TaggedIRecv( &nextQuery, 1, root, replyTag, comm, request );
+            search( query );
+            mpi::Wait( request );
+            query = nextQuery;
+        }
+    }
+}
+
+} // namespace lattice
+} // namespace El
+
+#endif // ifndef EL_LATTICE_BATCH_SEARCH_HPP
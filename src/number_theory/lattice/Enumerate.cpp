@@ -10,6 +10,8 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include <map>
+#include <tuple>
 
 namespace El {
 
@@ -195,18 +197,36 @@ Matrix<Real> AonoPruning()
 }
 
 template<typename Real>
-Matrix<Real> PrunedUpperBounds( Int n, Real normUpperBound, bool linear )
+Matrix<Real> PrunedUpperBounds
+( Int n, Real normUpperBound, const EnumCtrl<Real>& ctrl )
 {
     // TODO: Support more general pruning
     Matrix<Real> upperBounds( n, 1 );
-    if( linear )
+    if( ctrl.linearBounding )
     {
         for( Int j=0; j<n; ++j )
             upperBounds(j) = Sqrt(Real(j+1)/Real(n))*normUpperBound;
         return upperBounds;
     }
 
-    auto controlBounds = AonoPruning<Real>();
+    Matrix<Real> controlBounds;
+    if( ctrl.customPruning )
+    {
+        const Int numCoefficients = ctrl.pruningCoefficients.size();
+        if( numCoefficients == 0 )
+            LogicError("Custom pruning requires coefficients");
+        controlBounds.Resize( numCoefficients, 1 );
+        for( Int j=0; j<numCoefficients; ++j )
+            controlBounds(j) = Real(ctrl.pruningCoefficients[j]);
+        if( numCoefficients == n )
+        {
+            for( Int j=0; j<n; ++j )
+                upperBounds(j) = Sqrt(controlBounds(j))*normUpperBound;
+            return upperBounds;
+        }
+    }
+    else
+        controlBounds = AonoPruning<Real>();
     const Int numPoints = controlBounds.Height();
     for( Int j=0; j<n; ++j )
     {
@@ -228,6 +248,261 @@ Matrix<Real> PrunedUpperBounds( Int n, Real normUpperBound, bool linear )
     return upperBounds;
 }
 
+// See Section 4 of
+//
+//   Yuanmi Chen and Phong Q. Nguyen,
+//   "BKZ 2.0: Better Lattice Security Estimates", ASIACRYPT 2011,
+//
+// and Section 3 of
+//
+//   Nicolas Gama, Phong Q. Nguyen, and Oded Regev,
+//   "Lattice enumeration using extreme pruning", Eurocrypt 2010.
+//
+// Under the Gaussian heuristic, the expected number of nodes at depth k of
+// the pruned enumeration tree is half of the volume of the cylinder
+// intersection of dimension k divided by the product of the last k
+// Gram-Schmidt norms, and the cylinder intersection is the k-ball of the
+// radius times the probability, P_k, that a uniform sample from the ball
+// satisfies the first k bounds. As in GNR, only the bounds on an even number
+// of levels are taken into account, so that, with u_l the squared norm of the
+// l-th pair of coordinates (relative to the squared radius),
+//
+//   P_{2m} = m! vol { u >= 0 : u_1 + ... + u_l <= c_{2l-1}, l=1,...,m },
+//
+// and the success probability is the analogous fraction of the simplex
+// u_1 + ... + u_{n/2} = 1. We evaluate the iterated integrals on a uniform
+// grid over [0,1] rather than symbolically.
+
+namespace pruning {
+
+const Int numGridPoints = 4096;
+const Int numControlPoints = 17;
+const Int maxSweeps = 20;
+const double minSuccessProb = 1e-6;
+
+// An (inexact) extrapolation of the root-Hermite factor of BKZ with the given
+// blocksize, the exponent of which is linearly interpolated from that of LLL
+// for blocksizes below 50
+double RootHermiteFactor( Int blocksize )
+{
+    auto asymptotic = []( double beta )
+      {
+          const double pi = 3.141592653589793;
+          const double e = 2.718281828459045;
+          return std::pow
+            ( beta/(2*pi*e)*std::pow(pi*beta,1/beta), 1/(2*(beta-1)) );
+      };
+    const double lllFactor = 1.0219;
+    const Int minBlocksize = 50;
+    if( blocksize >= minBlocksize )
+        return asymptotic( double(blocksize) );
+    const double theta = double(Max(blocksize,Int(2))-2)/(minBlocksize-2);
+    const double logFactor =
+      (1-theta)*std::log(lllFactor) + theta*std::log(asymptotic(minBlocksize));
+    return std::exp( logFactor );
+}
+
+// Linearly interpolate the control points onto n (nondecreasing) coefficients
+vector<double> Interpolate( const vector<double>& controls, Int n )
+{
+    const Int numPoints = controls.size();
+    vector<double> coefficients( n );
+    for( Int j=0; j<n; ++j )
+    {
+        const double realIndex = double(j+1)/double(n)*(numPoints-1);
+        const Int floorIndex = Int(std::floor(realIndex));
+        const Int ceilIndex = Min( Int(std::ceil(realIndex)), numPoints-1 );
+        const double indexFrac = realIndex-floorIndex;
+        coefficients[j] =
+          controls[ceilIndex]*indexFrac + controls[floorIndex]*(1-indexFrac);
+        if( j > 0 )
+            coefficients[j] = Max( coefficients[j], coefficients[j-1] );
+    }
+    return coefficients;
+}
+
+// Return the logarithm of the expected number of nodes per trial and the
+// success probability
+pair<double,double> Estimate
+( const vector<double>& coefficients,
+  const vector<double>& logBaseNodes )
+{
+    EL_DEBUG_CSE
+    const Int n = coefficients.size();
+    const Int numPairs = n/2;
+    const double ds = 1./numGridPoints;
+
+    // We maintain g_l(s) (l-1)!, where g_l(s) is the density of the sum of
+    // the first l squared pair norms over the admissible region
+    vector<double> g( numGridPoints+1 ), integral( numGridPoints+1 );
+    vector<double> logProbs( n+1, 0. );
+    double successProb = 1;
+    for( Int l=1; l<=numPairs; ++l )
+    {
+        if( l > 1 )
+        {
+            integral[0] = 0;
+            for( Int i=1; i<=numGridPoints; ++i )
+                integral[i] = integral[i-1] + (g[i-1]+g[i])*ds/2;
+            if( l == numPairs )
+                successProb = (l-1)*integral[numGridPoints];
+        }
+        const double bound = coefficients[2*l-1];
+        double volume = 0;
+        for( Int i=0; i<=numGridPoints; ++i )
+        {
+            const double value = ( l == 1 ? 1. : (l-1)*integral[i] );
+            g[i] = ( i*ds <= bound ? value : 0. );
+            if( i > 0 )
+                volume += (g[i-1]+g[i])*ds/2;
+        }
+        logProbs[2*l] = std::log( Max(l*volume,1e-300) );
+        logProbs[2*l-1] = (logProbs[2*l-2]+logProbs[2*l])/2;
+    }
+    if( n % 2 == 1 )
+        logProbs[n] = logProbs[n-1];
+    if( successProb < minSuccessProb )
+        return pair<double,double>( 0, 0 );
+
+    // Sum the nodes over the levels in a numerically stable manner
+    double maxLogNodes = -std::numeric_limits<double>::infinity();
+    for( Int j=0; j<n; ++j )
+        maxLogNodes = Max( maxLogNodes, logBaseNodes[j]+logProbs[j+1] );
+    double sum = 0;
+    for( Int j=0; j<n; ++j )
+        sum += std::exp( logBaseNodes[j]+logProbs[j+1]-maxLogNodes );
+    return pair<double,double>( maxLogNodes+std::log(sum), successProb );
+}
+
+PruningInfo Optimize( Int n, Int blocksize, double preprocessCost )
+{
+    EL_DEBUG_CSE
+    PruningInfo info;
+    if( n <= 2 )
+    {
+        info.coefficients.resize( n, 1. );
+        info.successProb = 1;
+        info.logNodes = 0;
+        return info;
+    }
+
+    // Under the GSA, the Gram-Schmidt norms of the (unit volume) block decay
+    // geometrically by the square of the root-Hermite factor, and the
+    // radius is the first of them. The nodes at depth j+1 of the unpruned
+    // tree are then half of the volume of the (j+1)-ball of the radius over
+    // the product of the last j+1 Gram-Schmidt norms.
+    const double logDelta = std::log( RootHermiteFactor(blocksize) );
+    const double logRadius = (n-1)*logDelta;
+    const double logPi = std::log( 3.141592653589793 );
+    vector<double> logBaseNodes( n );
+    double logProfileSum = 0;
+    for( Int j=0; j<n; ++j )
+    {
+        const Int i = (n-1)-j;
+        logProfileSum += (n-1-2*i)*logDelta;
+        const double k = j+1;
+        const double logBallVolume = k/2*logPi - std::lgamma(k/2+1);
+        logBaseNodes[j] =
+          std::log(0.5) + k*logRadius + logBallVolume - logProfileSum;
+    }
+
+    auto objective =
+      [&]( const vector<double>& controls, pair<double,double>& estimate )
+      {
+          estimate = Estimate( Interpolate(controls,n), logBaseNodes );
+          if( estimate.second == 0 )
+              return std::numeric_limits<double>::infinity();
+          const double logNodes = estimate.first;
+          const double logMax = Max( logNodes, std::log(preprocessCost) );
+          const double logCost = logMax +
+            std::log( std::exp(logNodes-logMax) +
+                      std::exp(std::log(preprocessCost)-logMax) );
+          return logCost - std::log(estimate.second);
+      };
+
+    // Begin from Aono's coefficients and perform a multiplicative coordinate
+    // descent which preserves monotonicity
+    auto aono = AonoPruning<double>();
+    vector<double> controls( numControlPoints );
+    for( Int i=0; i<numControlPoints; ++i )
+        controls[i] = aono(i);
+    pair<double,double> estimate;
+    double bestValue = objective( controls, estimate );
+    if( bestValue == std::numeric_limits<double>::infinity() )
+    {
+        // Fall back to the linear pruning of GNR
+        for( Int i=0; i<numControlPoints; ++i )
+            controls[i] = double(i+1)/numControlPoints;
+        bestValue = objective( controls, estimate );
+    }
+    auto bestEstimate = estimate;
+
+    double step = 0.25;
+    for( Int sweep=0; sweep<maxSweeps && step > 1e-3; ++sweep )
+    {
+        bool improved = false;
+        for( Int i=0; i<numControlPoints-1; ++i )
+        {
+            const double lower = ( i == 0 ? 1e-3 : controls[i-1] );
+            const double upper = controls[i+1];
+            for( const double scale : { 1-step, 1+step } )
+            {
+                const double oldValue = controls[i];
+                controls[i] = Min( Max( oldValue*scale, lower ), upper );
+                const double value = objective( controls, estimate );
+                if( value < bestValue )
+                {
+                    bestValue = value;
+                    bestEstimate = estimate;
+                    improved = true;
+                }
+                else
+                    controls[i] = oldValue;
+            }
+        }
+        if( !improved )
+            step /= 2;
+    }
+
+    info.coefficients = Interpolate( controls, n );
+    info.logNodes = bestEstimate.first;
+    info.successProb = bestEstimate.second;
+    return info;
+}
+
+} // namespace pruning
+
+PruningInfo OptimizedPruning( Int n, Int blocksize, double preprocessCost )
+{
+    EL_DEBUG_CSE
+    typedef std::tuple<Int,Int,double> Key;
+    static std::map<Key,PruningInfo> cache;
+
+    const Key key( n, blocksize, preprocessCost );
+    bool cached = false;
+    PruningInfo info;
+#ifdef EL_HYBRID
+    _Pragma("omp critical(ElPruningCache)")
+#endif
+    {
+        auto it = cache.find( key );
+        if( it != cache.end() )
+        {
+            info = it->second;
+            cached = true;
+        }
+    }
+    if( cached )
+        return info;
+
+    info = pruning::Optimize( n, blocksize, preprocessCost );
+#ifdef EL_HYBRID
+    _Pragma("omp critical(ElPruningCache)")
+#endif
+    cache[key] = info;
+    return info;
+}
+
 } // namespace svp
 
 // NOTE: This norm upper bound is *non-inclusive*
@@ -297,7 +572,7 @@ Base<Field> ShortVectorEnumeration
     if( ctrl.enumType == GNR_ENUM )
     {
         auto upperBounds =
-          svp::PrunedUpperBounds( n, normUpperBound, ctrl.linearBounding );
+          svp::PrunedUpperBounds( n, normUpperBound, ctrl );
 
         // Since we will manually build up a (weakly) pseudorandom
         // unimodular matrix so that the probabalistic enumerations traverse
@@ -306,9 +581,14 @@ Base<Field> ShortVectorEnumeration
         auto RNew( R );
         Matrix<Field> BNew, U;
 
+        // Rerandomize the projected basis so that each trial searches the
+        // same (projected) lattice
+        Matrix<Field> RProj( R( IR(0,minDim), ALL ) );
+        MakeTrapezoidal( UPPER, RProj );
+
         for( Int trial=0; trial<ctrl.numTrials; ++trial )
         {
-            BNew = B;
+            BNew = RProj;
             Identity( U, n, n );
             if( trial != 0 )
             {
@@ -333,14 +613,21 @@ Base<Field> ShortVectorEnumeration
                 }
 
                 // The BKZ does not need to be particularly powerful
-                BKZCtrl<Real> ctrl;
-                ctrl.jumpstart = true; // accumulate into U
-                ctrl.blocksize = 10;
-                ctrl.recursive = false;
-                ctrl.lllCtrl.recursive = false;
+                BKZCtrl<Real> bkzCtrl;
+                bkzCtrl.jumpstart = true; // accumulate into U
+                bkzCtrl.blocksize = ctrl.preprocessBlocksize;
+                bkzCtrl.recursive = false;
+                bkzCtrl.lllCtrl.recursive = false;
+                if( ctrl.recursivePreprocess )
+                {
+                    bkzCtrl.progressive = true;
+                    bkzCtrl.extremePruning = true;
+                    bkzCtrl.enumCtrl.parallel = ctrl.parallel;
+                    bkzCtrl.enumCtrl.splitDepth = ctrl.splitDepth;
+                }
                 if( ctrl.time )
                     timer.Start();
-                BKZ( BNew, U, RNew, ctrl );
+                BKZ( BNew, U, RNew, bkzCtrl );
                 if( ctrl.time )
                     Output("  Fix-up BKZ: ",timer.Stop()," seconds");
             }
@@ -513,7 +800,7 @@ MultiShortVectorEnumeration
         const Real normUpperBound = modNormUpperBounds(0);
 
         auto upperBounds =
-          svp::PrunedUpperBounds( n, normUpperBound, ctrl.linearBounding );
+          svp::PrunedUpperBounds( n, normUpperBound, ctrl );
 
         // Since we will manually build up a (weakly) pseudorandom
         // unimodular matrix so that the probabalistic enumerations traverse
@@ -522,9 +809,14 @@ MultiShortVectorEnumeration
         auto RNew( R );
         Matrix<Field> BNew, U;
 
+        // Rerandomize the projected basis so that each trial searches the
+        // same (projected) lattice
+        Matrix<Field> RProj( R( IR(0,minDim), ALL ) );
+        MakeTrapezoidal( UPPER, RProj );
+
         for( Int trial=0; trial<ctrl.numTrials; ++trial )
         {
-            BNew = B;
+            BNew = RProj;
             Identity( U, n, n );
             if( trial != 0 )
             {
@@ -549,14 +841,21 @@ MultiShortVectorEnumeration
                 }
 
                 // The BKZ does not need to be particularly powerful
-                BKZCtrl<Real> ctrl;
-                ctrl.jumpstart = true; // accumulate into U
-                ctrl.blocksize = 10;
-                ctrl.recursive = false;
-                ctrl.lllCtrl.recursive = false;
+                BKZCtrl<Real> bkzCtrl;
+                bkzCtrl.jumpstart = true; // accumulate into U
+                bkzCtrl.blocksize = ctrl.preprocessBlocksize;
+                bkzCtrl.recursive = false;
+                bkzCtrl.lllCtrl.recursive = false;
+                if( ctrl.recursivePreprocess )
+                {
+                    bkzCtrl.progressive = true;
+                    bkzCtrl.extremePruning = true;
+                    bkzCtrl.enumCtrl.parallel = ctrl.parallel;
+                    bkzCtrl.enumCtrl.splitDepth = ctrl.splitDepth;
+                }
                 if( ctrl.time )
                     timer.Start();
-                BKZ( BNew, U, RNew, ctrl );
+                BKZ( BNew, U, RNew, bkzCtrl );
                 if( ctrl.time )
                     Output("  Fix-up BKZ: ",timer.Stop()," seconds");
             }
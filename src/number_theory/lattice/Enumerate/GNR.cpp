@@ -230,6 +230,329 @@ Base<F> TransposedHelper
     }
 }
 
+// Parallel enumeration
+// ====================
+// The levels [splitIndex,n) of the enumeration tree are first traversed in
+// order to list the nonzero prefixes (v(splitIndex),...,v(n-1)), modulo
+// multiplication by a unit, whose projections satisfy the bounds. Each such
+// prefix, as well as the zero prefix, is the root of an independent subtree
+// over the levels [0,splitIndex), and so the subtrees may be searched by any
+// thread of any process in any order, with the only necessary communication
+// being the reductions of the radius.
+
+// Traverse the levels [bottom,top) of the enumeration tree beneath the fixed
+// entries v(top:n-1), whose projection has norm 'topNorm' and whose last
+// nonzero index is 'lastNonzero' (which should be less than 'top' if they are
+// all zero), and call 'visit' to update the radius upon reaching each leaf
+// beneath min(upperBounds,radius). The 'refresh' function is periodically
+// called to synchronize the radius with any other searches.
+template<typename F,typename VisitFunc,typename RefreshFunc>
+void Traverse
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& NTrans,
+  const Matrix<Base<F>>& upperBounds,
+        Int bottom,
+        Int top,
+        Base<F> topNorm,
+        Int lastNonzero,
+        Base<F> radius,
+        Matrix<F>& v,
+        VisitFunc visit,
+        RefreshFunc refresh )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = NTrans.Height();
+    const Int refreshInterval = 4096;
+
+    // None of the partial sums are initially synchronized
+    Matrix<F> partialSums;
+    Zeros( partialSums, n+1, n );
+    Matrix<Int> sumIndices;
+    Zeros( sumIndices, n+1, 1 );
+    Fill( sumIndices, n-1 );
+
+    // Note: We maintain the norms rather than their squares
+    Matrix<Real> partialNorms;
+    Zeros( partialNorms, n+1, 1 );
+    partialNorms(top) = topNorm;
+
+    Matrix<F> centers;
+    Zeros( centers, n, 1 );
+
+    vector<SpiralState<F>> spiralStates(n);
+
+    F* vBuf = v.Buffer();
+    Int k = top;
+    bool descend = ( lastNonzero >= top );
+    if( !descend )
+    {
+        // Seed a constrained spiral out from zero at the bottom level
+        for( Int j=bottom; j<top; ++j )
+            vBuf[j] = F(0);
+        k = bottom;
+        spiralStates[k].Initialize( true );
+        vBuf[k] = spiralStates[k].Step();
+        lastNonzero = k;
+    }
+
+    Int numNodes = 0;
+    while( true )
+    {
+        if( descend )
+        {
+            // Move down the tree
+            --k;
+            sumIndices(k) = Max(sumIndices(k),sumIndices(k+1));
+
+                  F* s = &partialSums(0,k);
+            const F* nBuf = &NTrans(0,k);
+            for( Int i=sumIndices(k+1); i>=k+1; --i )
+                s[i] = s[i+1] + nBuf[i]*vBuf[i];
+
+            centers(k) = -partialSums(k+1,k);
+            vBuf[k] = Round(centers(k));
+            spiralStates[k].Initialize( centers(k) );
+        }
+        if( ++numNodes % refreshInterval == 0 )
+            radius = Min( radius, refresh() );
+
+        const F entry = d(k)*(vBuf[k] - centers(k));
+        const Real partialNorm = SafeNorm( partialNorms(k+1), entry );
+        partialNorms(k) = partialNorm;
+        if( partialNorm < Min(upperBounds((n-1)-k),radius) )
+        {
+            if( k > bottom )
+            {
+                descend = true;
+                continue;
+            }
+            // Visit the leaf and then continue with its sibling
+            radius = Min( radius, visit( partialNorm, lastNonzero ) );
+        }
+        else
+        {
+            // Move up the tree
+            ++k;
+            if( k == top )
+                return;
+        }
+        descend = false;
+        sumIndices(k) = k; // indicate that (i,j) are not synchronized
+        if( k > lastNonzero )
+        {
+            // Seed a constrained spiral out from zero
+            spiralStates[k].Initialize( true );
+            vBuf[k] = spiralStates[k].Step();
+            lastNonzero = k;
+        }
+        else
+        {
+            vBuf[k] = spiralStates[k].Step();
+        }
+    }
+}
+
+// The shortest member found by a process and the radius known to it
+template<typename F>
+class SharedBest
+{
+private:
+    Base<F> radius_, norm_;
+    Matrix<F> v_;
+
+public:
+    SharedBest( Base<F> radius, Base<F> norm )
+    : radius_(radius), norm_(norm)
+    { }
+
+    Base<F> Radius()
+    {
+        Base<F> radius;
+#ifdef EL_HYBRID
+        _Pragma("omp critical(ElEnumBest)")
+#endif
+        radius = radius_;
+        return radius;
+    }
+
+    // Record a (possibly) shorter member and return the radius
+    Base<F> Update( Base<F> norm, const Matrix<F>& v )
+    {
+        Base<F> radius;
+#ifdef EL_HYBRID
+        _Pragma("omp critical(ElEnumBest)")
+#endif
+        {
+            if( norm < norm_ )
+            {
+                norm_ = norm;
+                v_ = v;
+            }
+            radius_ = Min( radius_, norm );
+            radius = radius_;
+        }
+        return radius;
+    }
+
+    void Shrink( Base<F> radius ) { radius_ = Min( radius_, radius ); }
+
+    Base<F> Norm() const { return norm_; }
+    const Matrix<F>& Vector() const { return v_; }
+};
+
+template<typename F>
+Base<F> ParallelHelper
+( const Matrix<Base<F>>& d,
+  const Matrix<F>& N,
+  const Matrix<Base<F>>& upperBounds,
+        Matrix<F>& v,
+  const EnumCtrl<Base<F>>& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = N.Height();
+    const Int n = N.Width();
+    if( n > m )
+        LogicError("Expected height(N) >= width(N)");
+    if( ctrl.splitDepth < 1 )
+        LogicError("The split depth must be positive");
+
+    Zeros( v, n, 1 );
+    if( n == 0 )
+        return Real(0);
+    const Real maxBound = upperBounds(n-1);
+    const Real failure = 2*maxBound+1;
+
+    Matrix<F> NTrans;
+    Transpose( N, NTrans );
+
+    // List the roots of the subtrees, beginning with the zero prefix
+    const Int splitIndex = Max( n-ctrl.splitDepth, Int(1) );
+    const Int prefixSize = n-splitIndex;
+    vector<F> prefixes( prefixSize, F(0) );
+    vector<Real> prefixNorms( 1, Real(0) );
+    vector<Int> prefixLastNonzeros( 1, Int(-1) );
+    {
+        Matrix<F> w;
+        Zeros( w, n, 1 );
+        auto visit =
+          [&]( Real norm, Int lastNonzero )
+          {
+              for( Int j=splitIndex; j<n; ++j )
+                  prefixes.push_back( w(j) );
+              prefixNorms.push_back( norm );
+              prefixLastNonzeros.push_back( lastNonzero );
+              return maxBound;
+          };
+        auto refresh = [&]() { return maxBound; };
+        Traverse
+        ( d, NTrans, upperBounds, splitIndex, n, Real(0), splitIndex-1,
+          maxBound, w, visit, refresh );
+    }
+    const Int numSubtrees = prefixNorms.size();
+
+    // Search the subtrees with the shortest prefixes first, since they are
+    // typically both the largest and the most likely to contain short members
+    vector<Int> order( numSubtrees );
+    for( Int t=0; t<numSubtrees; ++t )
+        order[t] = t;
+    std::stable_sort
+    ( order.begin(), order.end(),
+      [&]( Int s, Int t ) { return prefixNorms[s] < prefixNorms[t]; } );
+
+    const int commRank = mpi::Rank( ctrl.comm );
+    const int commSize = mpi::Size( ctrl.comm );
+    if( ctrl.progress && commRank == 0 )
+        Output
+        ("Parallel enumeration with ",numSubtrees," subtrees rooted at level ",
+         splitIndex);
+
+    SharedBest<F> best( maxBound, failure );
+    auto searchSubtree =
+      [&]( Int t )
+      {
+          if( prefixNorms[t] >= best.Radius() )
+              return;
+          Matrix<F> w;
+          Zeros( w, n, 1 );
+          for( Int j=splitIndex; j<n; ++j )
+              w(j) = prefixes[t*prefixSize+(j-splitIndex)];
+          auto visit =
+            [&]( Real norm, Int ) { return best.Update( norm, w ); };
+          auto refresh = [&]() { return best.Radius(); };
+          Traverse
+          ( d, NTrans, upperBounds, 0, splitIndex, prefixNorms[t],
+            prefixLastNonzeros[t], best.Radius(), w, visit, refresh );
+      };
+
+    // Deal the subtrees out cyclically in batches, and reduce the radius
+    // over the processes after each batch
+    const Int batchSize = Max(ctrl.subtreesPerSync,Int(1))*commSize;
+    vector<Int> localSubtrees;
+    for( Int batchBeg=0; batchBeg<numSubtrees; batchBeg+=batchSize )
+    {
+        const Int batchEnd = Min(batchBeg+batchSize,numSubtrees);
+        localSubtrees.clear();
+        for( Int t=batchBeg+commRank; t<batchEnd; t+=commSize )
+            localSubtrees.push_back( order[t] );
+        const Int numLocalSubtrees = localSubtrees.size();
+
+        // The idle threads of a process pull the next unsearched subtree
+        bool concurrent = true;
+#ifdef EL_HYBRID
+        const int numThreads = blas::FallbackThreads();
+        concurrent = numThreads > 1 && numLocalSubtrees > 1 &&
+                     !omp_in_parallel();
+        if( concurrent )
+        {
+            std::exception_ptr error;
+            _Pragma("omp parallel for schedule(dynamic,1) num_threads(numThreads)")
+            for( Int s=0; s<numLocalSubtrees; ++s )
+            {
+                try { searchSubtree( localSubtrees[s] ); }
+                catch( ... )
+                {
+                    _Pragma("omp critical")
+                    {
+                        if( !error )
+                            error = std::current_exception();
+                    }
+                }
+            }
+            if( error )
+                std::rethrow_exception( error );
+        }
+#else
+        concurrent = false;
+#endif
+        if( !concurrent )
+            for( Int s=0; s<numLocalSubtrees; ++s )
+                searchSubtree( localSubtrees[s] );
+
+        if( commSize > 1 )
+            best.Shrink( mpi::AllReduce( best.Radius(), mpi::MIN, ctrl.comm ) );
+    }
+
+    // Broadcast the shortest member from the lowest process which found it
+    Real result = best.Norm();
+    if( commSize > 1 )
+    {
+        result = mpi::AllReduce( result, mpi::MIN, ctrl.comm );
+        const int owner =
+          mpi::AllReduce
+          ( best.Norm() == result ? commRank : commSize, mpi::MIN, ctrl.comm );
+        if( commRank == owner )
+            v = best.Vector();
+        mpi::Broadcast( v.Buffer(), n, owner, ctrl.comm );
+    }
+    else if( result < maxBound )
+        v = best.Vector();
+    if( ctrl.progress && commRank == 0 )
+        Output("Parallel enumeration result: ",result);
+    return ( result < maxBound ? result : failure );
+}
+
 } // namespace gnr_enum
 
 template<typename F>
@@ -241,6 +564,9 @@ Base<F> GNREnumeration
   const EnumCtrl<Base<F>>& ctrl )
 {
     EL_DEBUG_CSE
+    // The default precision of BigFloat is not shared with other threads
+    if( ctrl.parallel && IsFixedPrecision<Base<F>>::value )
+        return gnr_enum::ParallelHelper( d, N, upperBounds, v, ctrl );
     if( ctrl.explicitTranspose )
     {
         Matrix<F> NTrans;
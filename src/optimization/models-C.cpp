@@ -83,6 +83,10 @@ ElError ElBPDNADMMCtrlDefault_s( ElBPDNADMMCtrl_s* ctrl )
     ctrl->relTol = 1e-4;
     ctrl->inv = true;
     ctrl->progress = true;
+    ctrl->adaptiveRho = false;
+    ctrl->rhoBalance = 10;
+    ctrl->rhoScale = 2;
+    ctrl->checkFrequency = 1;
     return EL_SUCCESS;
 }
 
@@ -95,6 +99,10 @@ ElError ElBPDNADMMCtrlDefault_d( ElBPDNADMMCtrl_d* ctrl )
     ctrl->relTol = 1e-4;
     ctrl->inv = true;
     ctrl->progress = true;
+    ctrl->adaptiveRho = false;
+    ctrl->rhoBalance = 10;
+    ctrl->rhoScale = 2;
+    ctrl->checkFrequency = 1;
     return EL_SUCCESS;
 }
 
@@ -140,6 +148,8 @@ ElError ElNMFCtrlDefault_s( ElNMFCtrl_s* ctrl )
 {
     ElNNLSCtrlDefault_s( &ctrl->nnlsCtrl );
     ctrl->maxIter = 20;
+    ctrl->approach = EL_NMF_NNLS;
+    ctrl->numInnerIts = 1;
     return EL_SUCCESS;
 }
 
@@ -147,6 +157,8 @@ ElError ElNMFCtrlDefault_d( ElNMFCtrl_d* ctrl )
 {
     ElNNLSCtrlDefault_d( &ctrl->nnlsCtrl );
     ctrl->maxIter = 20;
+    ctrl->approach = EL_NMF_NNLS;
+    ctrl->numInnerIts = 1;
     return EL_SUCCESS;
 }
 
@@ -163,6 +175,9 @@ ElError ElRPCACtrlDefault_s( ElRPCACtrl_s* ctrl )
     ctrl->beta = 1;
     ctrl->rho = 6;
     ctrl->tol = 1e-5;
+    ctrl->randomizedSVT = true;
+    ctrl->svtRankPad = 10;
+    ctrl->svtMaxRankRatio = 0.1;
     return EL_SUCCESS;
 }
 
@@ -177,6 +192,9 @@ ElError ElRPCACtrlDefault_d( ElRPCACtrl_d* ctrl )
     ctrl->beta = 1;
     ctrl->rho = 6;
     ctrl->tol = 1e-5;
+    ctrl->randomizedSVT = true;
+    ctrl->svtRankPad = 10;
+    ctrl->svtMaxRankRatio = 0.1;
     return EL_SUCCESS;
 }
 
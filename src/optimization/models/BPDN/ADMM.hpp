@@ -44,21 +44,17 @@ Int ADMM
     const Int m = A.Height();
     const Int n = A.Width();
 
+    const Int checkFrequency = Max( ctrl.checkFrequency, Int(1) );
+
+    // Cache the factorization of either A^H A + rho I or, when A is wide,
+    // A A^H + rho I
     Matrix<Field> P;
     if( m >= n )
-    {
-        Identity( P, n, n );
-        Herk( LOWER, ADJOINT, Real(1), A, ctrl.rho, P );
-    }
-    else
-    {
-        Identity( P, m, m );
-        Herk( LOWER, NORMAL, Real(1), A, ctrl.rho, P );
-    }
-    if( ctrl.inv )
-        HPDInverse( LOWER, P );
+        Herk( LOWER, ADJOINT, Real(1), A, P );
     else
-        Cholesky( LOWER, P );
+        Herk( LOWER, NORMAL, Real(1), A, P );
+    ShiftedHermitianSolver<Field>
+      solver( P, ctrl.rho, ctrl.adaptiveRho, ctrl.inv );
 
     // Cache w := A^H b
     Matrix<Field> w;
@@ -72,40 +68,23 @@ Int ADMM
     Zeros( u, n, 1 );
     while( numIter < ctrl.maxIter )
     {
+        const Real rho = solver.Shift();
         zOld = z;
 
         // x := (A^H A + rho) \ (A^H b + rho*(z-u))
         x = w;
-        Axpy(  ctrl.rho, z, x );
-        Axpy( -ctrl.rho, u, x );
+        Axpy(  rho, z, x );
+        Axpy( -rho, u, x );
         if( m >= n )
         {
-            if( ctrl.inv )
-            {
-                s = x;
-                Hemv( LOWER, Field(1), P, s, Field(0), x );
-            }
-            else
-            {
-                Trsv( LOWER, NORMAL, NON_UNIT, P, x );
-                Trsv( LOWER, ADJOINT, NON_UNIT, P, x );
-            }
+            solver.Solve( x );
         }
         else
         {
             Gemv( NORMAL, Field(1), A, x, s );
-            if( ctrl.inv )
-            {
-                auto t( s );
-                Hemv( LOWER, Field(1), P, t, Field(0), s );
-            }
-            else
-            {
-                Trsv( LOWER, NORMAL, NON_UNIT, P, s );
-                Trsv( LOWER, ADJOINT, NON_UNIT, P, s );
-            }
+            solver.Solve( s );
             Gemv( ADJOINT, Field(-1), A, s, Field(1), x );
-            x *= 1/ctrl.rho;
+            x *= 1/rho;
         }
 
         // xHat := alpha x + (1-alpha) zOld
@@ -116,12 +95,19 @@ Int ADMM
         // z := SoftThresh(xHat+u,lambda/rho)
         z = xHat;
         z += u;
-        SoftThreshold( z, lambda/ctrl.rho );
+        SoftThreshold( z, lambda/rho );
 
         // u := u + (xHat - z)
         u += xHat;
         u -= z;
 
+        const bool check = Mod(numIter+1,checkFrequency) == 0;
+        if( !check && !ctrl.progress )
+        {
+            ++numIter;
+            continue;
+        }
+
         // rNorm := || x - z ||_2
         s = x;
         s -= z;
@@ -130,12 +116,12 @@ Int ADMM
         // sNorm := || rho*(z-zOld) ||_2
         s = z;
         s -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
+        const Real sNorm = Abs(rho)*FrobeniusNorm( s );
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
             ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+            ctrl.relTol*Abs(rho)*FrobeniusNorm(u);
 
         if( ctrl.progress )
         {
@@ -149,8 +135,25 @@ Int ADMM
              ", objective=",obj);
         }
 
-        if( rNorm < epsPri && sNorm < epsDual )
-            break;
+        if( check )
+        {
+            if( rNorm < epsPri && sNorm < epsDual )
+                break;
+            if( ctrl.adaptiveRho )
+            {
+                // Balance the residuals, rescaling the scaled dual variable
+                if( rNorm > ctrl.rhoBalance*sNorm )
+                {
+                    solver.SetShift( rho*ctrl.rhoScale );
+                    u *= 1/ctrl.rhoScale;
+                }
+                else if( sNorm > ctrl.rhoBalance*rNorm )
+                {
+                    solver.SetShift( rho/ctrl.rhoScale );
+                    u *= ctrl.rhoScale;
+                }
+            }
+        }
         ++numIter;
     }
     if( ctrl.maxIter == numIter )
@@ -182,21 +185,17 @@ Int ADMM
     const Int n = A.Width();
     const Grid& g = A.Grid();
 
+    const Int checkFrequency = Max( ctrl.checkFrequency, Int(1) );
+
+    // Cache the factorization of either A^H A + rho I or, when A is wide,
+    // A A^H + rho I
     DistMatrix<Field> P(g);
     if( m >= n )
-    {
-        Identity( P, n, n );
-        Herk( LOWER, ADJOINT, Real(1), A, ctrl.rho, P );
-    }
-    else
-    {
-        Identity( P, m, m );
-        Herk( LOWER, NORMAL, Real(1), A, ctrl.rho, P );
-    }
-    if( ctrl.inv )
-        HPDInverse( LOWER, P );
+        Herk( LOWER, ADJOINT, Real(1), A, P );
     else
-        Cholesky( LOWER, P );
+        Herk( LOWER, NORMAL, Real(1), A, P );
+    DistShiftedHermitianSolver<Field>
+      solver( P, ctrl.rho, ctrl.adaptiveRho, ctrl.inv );
 
     // Cache w := A^H b
     DistMatrix<Field> w(g);
@@ -210,40 +209,23 @@ Int ADMM
     Zeros( u, n, 1 );
     while( numIter < ctrl.maxIter )
     {
+        const Real rho = solver.Shift();
         zOld = z;
 
         // x := (A^H A + rho) \ (A^H b + rho*(z-u))
         x = w;
-        Axpy(  ctrl.rho, z, x );
-        Axpy( -ctrl.rho, u, x );
+        Axpy(  rho, z, x );
+        Axpy( -rho, u, x );
         if( m >= n )
         {
-            if( ctrl.inv )
-            {
-                s = x;
-                Hemv( LOWER, Field(1), P, s, Field(0), x );
-            }
-            else
-            {
-                Trsv( LOWER, NORMAL, NON_UNIT, P, x );
-                Trsv( LOWER, ADJOINT, NON_UNIT, P, x );
-            }
+            solver.Solve( x );
         }
         else
         {
             Gemv( NORMAL, Field(1), A, x, s );
-            if( ctrl.inv )
-            {
-                auto t( s );
-                Hemv( LOWER, Field(1), P, t, Field(0), s );
-            }
-            else
-            {
-                Trsv( LOWER, NORMAL, NON_UNIT, P, s );
-                Trsv( LOWER, ADJOINT, NON_UNIT, P, s );
-            }
+            solver.Solve( s );
             Gemv( ADJOINT, Field(-1), A, s, Field(1), x );
-            x *= 1/ctrl.rho;
+            x *= 1/rho;
         }
 
         // xHat := alpha x + (1-alpha) zOld
@@ -254,12 +236,19 @@ Int ADMM
         // z := SoftThresh(xHat+u,lambda/rho)
         z = xHat;
         z += u;
-        SoftThreshold( z, lambda/ctrl.rho );
+        SoftThreshold( z, lambda/rho );
 
         // u := u + (xHat - z)
         u += xHat;
         u -= z;
 
+        const bool check = Mod(numIter+1,checkFrequency) == 0;
+        if( !check && !ctrl.progress )
+        {
+            ++numIter;
+            continue;
+        }
+
         // rNorm := || x - z ||_2
         s = x;
         s -= z;
@@ -268,12 +257,12 @@ Int ADMM
         // sNorm := || rho*(z-zOld) ||_2
         s = z;
         s -= zOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( s );
+        const Real sNorm = Abs(rho)*FrobeniusNorm( s );
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
             ctrl.relTol*Max(FrobeniusNorm(x),FrobeniusNorm(z));
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(u);
+            ctrl.relTol*Abs(rho)*FrobeniusNorm(u);
 
         if( ctrl.progress )
         {
@@ -290,8 +279,25 @@ Int ADMM
             }
         }
 
-        if( rNorm < epsPri && sNorm < epsDual )
-            break;
+        if( check )
+        {
+            if( rNorm < epsPri && sNorm < epsDual )
+                break;
+            if( ctrl.adaptiveRho )
+            {
+                // Balance the residuals, rescaling the scaled dual variable
+                if( rNorm > ctrl.rhoBalance*sNorm )
+                {
+                    solver.SetShift( rho*ctrl.rhoScale );
+                    u *= 1/ctrl.rhoScale;
+                }
+                else if( sNorm > ctrl.rhoBalance*rNorm )
+                {
+                    solver.SetShift( rho/ctrl.rhoScale );
+                    u *= ctrl.rhoScale;
+                }
+            }
+        }
         ++numIter;
     }
     if( ctrl.maxIter == numIter )
@@ -14,6 +14,217 @@ namespace El {
 // Better convergence criterions. E.g., accept a relative tolerance in addition
 // to the maximum number of iterations.
 
+namespace nmf {
+
+// Both fast approaches update the q x r factor W to (approximately) solve
+//
+//   min_{W >= 0} || A - W C^T ||_F,
+//
+// given only the r x r Gram matrix G = C^T C and the q x r matrix B = A C.
+// Since the rows of W are decoupled, each process may independently update
+// the rows that it owns.
+
+// A single sweep of HALS over the columns of W, i.e.,
+//
+//   w_k := max(w_k + (b_k - W g_k) / G(k,k), 0),  k=0,...,r-1.
+//
+template<typename Real>
+void HALSSweep( const Matrix<Real>& G, const Matrix<Real>& B, Matrix<Real>& W )
+{
+    EL_DEBUG_CSE
+    const Int q = W.Height();
+    const Int r = W.Width();
+    Matrix<Real> t;
+    for( Int k=0; k<r; ++k )
+    {
+        // A column of C which is identically zero does not determine w_k
+        const Real gamma = G(k,k);
+        if( gamma == Real(0) )
+            continue;
+
+        auto wk = W( ALL, IR(k) );
+        t = B( ALL, IR(k) );
+        Gemv( NORMAL, Real(-1), W, G(ALL,IR(k)), Real(1), t );
+        Axpy( Real(1)/gamma, t, wk );
+        for( Int i=0; i<q; ++i )
+            wk(i) = Max( wk(i), Real(0) );
+    }
+}
+
+// Solve for the columns of X
+//
+//   X(P,j) := G(P,P) \ F(P,j),  X(~P,j) := 0,
+//   Y(~P,j) := G(~P,P) X(P,j) - F(~P,j),  Y(P,j) := 0,
+//
+// for each of the given columns j with passive set P. The columns sharing a
+// passive set are solved together using a single Cholesky factorization.
+template<typename Real>
+void PassiveSolve
+( const Matrix<Real>& G,
+  const Matrix<Real>& F,
+  const vector<vector<bool>>& passive,
+        vector<Int>& cols,
+        Matrix<Real>& X,
+        Matrix<Real>& Y )
+{
+    EL_DEBUG_CSE
+    const Int r = G.Height();
+    const Int numCols = cols.size();
+    std::sort
+    ( cols.begin(), cols.end(),
+      [&]( Int j0, Int j1 ) { return passive[j0] < passive[j1]; } );
+
+    Matrix<Real> GPP, XGroup, YGroup;
+    vector<Int> pInd, group;
+    for( Int groupBeg=0; groupBeg<numCols; groupBeg=groupBeg+group.size() )
+    {
+        const vector<bool>& P = passive[cols[groupBeg]];
+        group.clear();
+        for( Int c=groupBeg; c<numCols && passive[cols[c]]==P; ++c )
+            group.push_back( cols[c] );
+        const Int groupSize = group.size();
+
+        pInd.clear();
+        for( Int i=0; i<r; ++i )
+            if( P[i] )
+                pInd.push_back( i );
+        const Int numPassive = pInd.size();
+
+        Zeros( XGroup, r, groupSize );
+        if( numPassive > 0 )
+        {
+            GPP = G( pInd, pInd );
+            Matrix<Real> XPassive = F( pInd, group );
+            Cholesky( LOWER, GPP );
+            cholesky::SolveAfter( LOWER, NORMAL, GPP, XPassive );
+            for( Int c=0; c<groupSize; ++c )
+                for( Int k=0; k<numPassive; ++k )
+                    XGroup(pInd[k],c) = XPassive(k,c);
+        }
+        YGroup = F( ALL, group );
+        Gemm( NORMAL, NORMAL, Real(1), G, XGroup, Real(-1), YGroup );
+
+        for( Int c=0; c<groupSize; ++c )
+        {
+            const Int j = group[c];
+            for( Int i=0; i<r; ++i )
+            {
+                X(i,j) = XGroup(i,c);
+                Y(i,j) = ( P[i] ? Real(0) : YGroup(i,c) );
+            }
+        }
+    }
+}
+
+// The Block Principal Pivoting method of
+//
+//   Jingu Kim and Haesun Park,
+//   "Fast nonnegative matrix factorization: An active-set-like method and
+//    comparisons", SIAM J. Sci. Comput., 33(6), pp. 3261--3281, 2011,
+//
+// for min_{X >= 0} || C X - A^T ||_F with multiple right-hand sides, given
+// G = C^T C and F = C^T A^T. The passive sets are warm-started from the
+// support of the input X.
+template<typename Real>
+void BPP( const Matrix<Real>& G, const Matrix<Real>& F, Matrix<Real>& X )
+{
+    EL_DEBUG_CSE
+    const Int r = F.Height();
+    const Int q = F.Width();
+    const Real tol = 10*r*limits::Epsilon<Real>()*MaxNorm(F);
+
+    // Variables whose column of C is zero are never made passive so that
+    // the passive submatrices of G remain nonsingular
+    vector<vector<bool>> passive( q, vector<bool>(r,false) );
+    for( Int j=0; j<q; ++j )
+        for( Int i=0; i<r; ++i )
+            passive[j][i] = ( X(i,j) > Real(0) && G(i,i) > Real(0) );
+
+    Matrix<Real> Y;
+    Zeros( Y, r, q );
+    vector<Int> cols(q);
+    for( Int j=0; j<q; ++j )
+        cols[j] = j;
+    PassiveSolve( G, F, passive, cols, X, Y );
+
+    // The number of full exchanges allowed before falling back to the
+    // (finitely terminating) single exchange rule, and the smallest number
+    // of infeasibilities yet seen, for each column
+    vector<Int> numFullExchanges( q, 3 ), minInfeasible( q, r+1 );
+    while( true )
+    {
+        cols.clear();
+        for( Int j=0; j<q; ++j )
+        {
+            Int numInfeasible=0, lastInfeasible=-1;
+            for( Int i=0; i<r; ++i )
+            {
+                const bool infeasible =
+                  ( passive[j][i] ? X(i,j) < Real(0) : Y(i,j) < -tol );
+                if( infeasible )
+                {
+                    ++numInfeasible;
+                    lastInfeasible = i;
+                }
+            }
+            if( numInfeasible == 0 )
+                continue;
+            cols.push_back( j );
+
+            bool fullExchange = true;
+            if( numInfeasible < minInfeasible[j] )
+            {
+                minInfeasible[j] = numInfeasible;
+                numFullExchanges[j] = 3;
+            }
+            else if( numFullExchanges[j] > 0 )
+                --numFullExchanges[j];
+            else
+                fullExchange = false;
+
+            if( fullExchange )
+            {
+                for( Int i=0; i<r; ++i )
+                {
+                    if( passive[j][i] ? X(i,j) < Real(0) : Y(i,j) < -tol )
+                        passive[j][i] = !passive[j][i];
+                }
+            }
+            else
+                passive[j][lastInfeasible] = !passive[j][lastInfeasible];
+        }
+        if( cols.empty() )
+            break;
+        PassiveSolve( G, F, passive, cols, X, Y );
+    }
+}
+
+// Update the rows of W with the requested approach
+template<typename Real>
+void UpdateFactor
+( const Matrix<Real>& G,
+  const Matrix<Real>& B,
+        Matrix<Real>& W,
+  const NMFCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.approach == NMF_HALS )
+    {
+        for( Int it=0; it<ctrl.numInnerIts; ++it )
+            HALSSweep( G, B, W );
+    }
+    else
+    {
+        Matrix<Real> F, XAdj;
+        Transpose( B, F );
+        Transpose( W, XAdj );
+        BPP( G, F, XAdj );
+        Transpose( XAdj, W );
+    }
+}
+
+} // namespace nmf
+
 template<typename Real>
 void NMF
 ( const Matrix<Real>& A,
@@ -22,6 +233,24 @@ void NMF
   const NMFCtrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
+    if( ctrl.approach != NMF_NNLS )
+    {
+        Zeros( Y, A.Width(), X.Width() );
+        Matrix<Real> G, B;
+        for( Int iter=0; iter<ctrl.maxIter; ++iter )
+        {
+            Herk( LOWER, ADJOINT, Real(1), X, G );
+            MakeSymmetric( LOWER, G );
+            Gemm( ADJOINT, NORMAL, Real(1), A, X, B );
+            nmf::UpdateFactor( G, B, Y, ctrl );
+
+            Herk( LOWER, ADJOINT, Real(1), Y, G );
+            MakeSymmetric( LOWER, G );
+            Gemm( NORMAL, NORMAL, Real(1), A, Y, B );
+            nmf::UpdateFactor( G, B, X, ctrl );
+        }
+        return;
+    }
 
     Matrix<Real> AAdj, XAdj, YAdj;
     Adjoint( A, AAdj );
@@ -53,8 +282,42 @@ void NMF
     auto& A = AProx.GetLocked();
     auto& X = XProx.Get();
     auto& Y = YProx.Get();
+    const Grid& g = A.Grid();
+
+    if( ctrl.approach != NMF_NNLS )
+    {
+        // The small Gram matrix is redundantly stored and the rows of the
+        // updated factor are distributed so that the updates are local
+        Zeros( Y, A.Width(), X.Width() );
+        DistMatrix<Real> G(g), B(g);
+        DistMatrix<Real,STAR,STAR> G_STAR_STAR(g);
+        DistMatrix<Real,VC,STAR> B_VC_STAR(g), W_VC_STAR(g);
+        auto updateFactor = [&]( DistMatrix<Real>& W )
+          {
+              MakeSymmetric( LOWER, G );
+              G_STAR_STAR = G;
+              B_VC_STAR = B;
+              W_VC_STAR.AlignWith( B_VC_STAR );
+              W_VC_STAR = W;
+              nmf::UpdateFactor
+              ( G_STAR_STAR.LockedMatrix(), B_VC_STAR.LockedMatrix(),
+                W_VC_STAR.Matrix(), ctrl );
+              W = W_VC_STAR;
+          };
+        for( Int iter=0; iter<ctrl.maxIter; ++iter )
+        {
+            Herk( LOWER, ADJOINT, Real(1), X, G );
+            Gemm( ADJOINT, NORMAL, Real(1), A, X, B );
+            updateFactor( Y );
+
+            Herk( LOWER, ADJOINT, Real(1), Y, G );
+            Gemm( NORMAL, NORMAL, Real(1), A, Y, B );
+            updateFactor( X );
+        }
+        return;
+    }
 
-    DistMatrix<Real> AAdj(A.Grid()), XAdj(A.Grid()), YAdj(A.Grid());
+    DistMatrix<Real> AAdj(g), XAdj(g), YAdj(g);
     Adjoint( A, AAdj );
 
     for( Int iter=0; iter<ctrl.maxIter; ++iter )
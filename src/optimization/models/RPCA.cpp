@@ -34,6 +34,23 @@ void NormalizeEntries( AbstractDistMatrix<Field>& A )
     EntrywiseMap( A, MakeFunction(unitMap) );
 }
 
+// Singular value thresholding of the low-rank iterate given the rank of the
+// previous iterate. When few singular values are predicted to survive, only
+// the leading singular triplets are computed with a randomized partial SVD.
+template<class MatrixType,typename Real>
+Int LowRankThreshold
+( MatrixType& L, Real tau, Int lastRank, const RPCACtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    if( ctrl.usePivQR )
+        return SVT( L, tau, ctrl.numPivSteps );
+    const Int minDim = Min(L.Height(),L.Width());
+    const Int rank = lastRank + ctrl.svtRankPad;
+    if( ctrl.randomizedSVT && Real(rank) <= ctrl.svtMaxRankRatio*minDim )
+        return svt::Randomized( L, tau, rank );
+    return SVT( L, tau );
+}
+
 // NOTE: If 'tau' is passed in as zero, it is set to 1/sqrt(max(m,n))
 
 template<typename Field>
@@ -73,32 +90,22 @@ void ADMM
     Zeros( L, m, n );
     Zeros( S, m, n );
 
-    Int numIts = 0;
+    Int numIts=0, rank=0;
     while( true )
     {
         ++numIts;
 
         // ST_{tau/beta}(M - L + Y/beta)
-        S = M;
-        S -= L;
-        Axpy( Field(1)/beta, Y, S );
+        Evaluate( Lazy(M) - Lazy(L) + (Field(1)/beta)*Lazy(Y), S );
         SoftThreshold( S, tau/beta );
         const Int numNonzeros = ZeroNorm( S );
 
         // SVT_{1/beta}(M - S + Y/beta)
-        L = M;
-        L -= S;
-        Axpy( Field(1)/beta, Y, L );
-        Int rank;
-        if( ctrl.usePivQR )
-            rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
-        else
-            rank = SVT( L, Real(1)/beta );
+        Evaluate( Lazy(M) - Lazy(S) + (Field(1)/beta)*Lazy(Y), L );
+        rank = LowRankThreshold( L, Real(1)/beta, rank, ctrl );
 
         // E := M - (L + S)
-        E = M;
-        E -= L;
-        E -= S;
+        Evaluate( Lazy(M) - Lazy(L) - Lazy(S), E );
         const Real frobE = FrobeniusNorm( E );
 
         if( frobE/frobM <= tol )
@@ -179,7 +186,7 @@ void ADMM
     Zeros( L, m, n );
     Zeros( S, m, n );
 
-    Int numIts = 0;
+    Int numIts=0, rank=0;
     while( true )
     {
         ++numIts;
@@ -195,11 +202,7 @@ void ADMM
         L = M;
         L -= S;
         Axpy( Field(1)/beta, Y, L );
-        Int rank;
-        if( ctrl.usePivQR )
-            rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
-        else
-            rank = SVT( L, Real(1)/beta );
+        rank = LowRankThreshold( L, Real(1)/beta, rank, ctrl );
 
         // E := M - (L + S)
         E = M;
@@ -284,13 +287,13 @@ void ALM
     Zeros( L, m, n );
     Zeros( S, m, n );
 
-    Int numIts=0, numPrimalIts=0;
+    Int numIts=0, numPrimalIts=0, rank=0;
     Matrix<Field> LLast, SLast, E;
     while( true )
     {
         ++numIts;
 
-        Int rank, numNonzeros;
+        Int numNonzeros;
         while( true )
         {
             ++numPrimalIts;
@@ -299,20 +302,13 @@ void ALM
             SLast = S;
 
             // ST_{tau/beta}(M - L + Y/beta)
-            S = M;
-            S -= L;
-            Axpy( Field(1)/beta, Y, S );
+            Evaluate( Lazy(M) - Lazy(L) + (Field(1)/beta)*Lazy(Y), S );
             SoftThreshold( S, tau/beta );
             numNonzeros = ZeroNorm( S );
 
             // SVT_{1/beta}(M - S + Y/beta)
-            L = M;
-            L -= S;
-            Axpy( Field(1)/beta, Y, L );
-            if( ctrl.usePivQR )
-                rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
-            else
-                rank = SVT( L, Real(1)/beta );
+            Evaluate( Lazy(M) - Lazy(S) + (Field(1)/beta)*Lazy(Y), L );
+            rank = LowRankThreshold( L, Real(1)/beta, rank, ctrl );
 
             LLast -= L;
             SLast -= S;
@@ -342,9 +338,7 @@ void ALM
         }
 
         // E := M - (L + S)
-        E = M;
-        E -= L;
-        E -= S;
+        Evaluate( Lazy(M) - Lazy(L) - Lazy(S), E );
         const Real frobE = FrobeniusNorm( E );
 
         if( frobE/frobM <= tol )
@@ -433,13 +427,13 @@ void ALM
     Zeros( L, m, n );
     Zeros( S, m, n );
 
-    Int numIts=0, numPrimalIts=0;
+    Int numIts=0, numPrimalIts=0, rank=0;
     DistMatrix<Field> LLast( M.Grid() ), SLast( M.Grid() ), E( M.Grid() );
     while( true )
     {
         ++numIts;
 
-        Int rank, numNonzeros;
+        Int numNonzeros;
         while( true )
         {
             ++numPrimalIts;
@@ -458,10 +452,7 @@ void ALM
             L = M;
             L -= S;
             Axpy( Field(1)/beta, Y, L );
-            if( ctrl.usePivQR )
-                rank = SVT( L, Real(1)/beta, ctrl.numPivSteps );
-            else
-                rank = SVT( L, Real(1)/beta );
+            rank = LowRankThreshold( L, Real(1)/beta, rank, ctrl );
 
             LLast -= L;
             SLast -= S;
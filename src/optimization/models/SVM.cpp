@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./SVM/IPM.hpp"
+#include "./SVM/Streaming.hpp"
 
 namespace El {
 
@@ -59,7 +60,49 @@ void SVM
     svm::IPM( A, d, lambda, x, ctrl.ipmCtrl );
 }
 
+template<typename Real>
+SVMBlockLoader<Real> SVMBlockFiles
+( const string& featurePrefix,
+  const string& labelPrefix,
+  const string& extension )
+{
+    EL_DEBUG_CSE
+    return
+      [=]( Int block, SparseMatrix<Real>& A, Matrix<Real>& d )
+      {
+          Read( A, BuildString(featurePrefix,block,extension) );
+          Read( d, BuildString(labelPrefix,block,extension) );
+      };
+}
+
+template<typename Real>
+Int StreamingSVM
+( Int numFeatures,
+  Int numBlocks,
+  const SVMBlockLoader<Real>& loadBlock,
+        Real lambda,
+        Matrix<Real>& x,
+  const StreamingSVMCtrl<Real>& ctrl,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    return svm::Streaming
+      ( numFeatures, numBlocks, loadBlock, lambda, x, ctrl, comm );
+}
+
 #define PROTO(Real) \
+  template SVMBlockLoader<Real> SVMBlockFiles \
+  ( const string& featurePrefix, \
+    const string& labelPrefix, \
+    const string& extension ); \
+  template Int StreamingSVM \
+  ( Int numFeatures, \
+    Int numBlocks, \
+    const SVMBlockLoader<Real>& loadBlock, \
+          Real lambda, \
+          Matrix<Real>& x, \
+    const StreamingSVMCtrl<Real>& ctrl, \
+          mpi::Comm comm ); \
   template void SVM \
   ( const Matrix<Real>& A, \
     const Matrix<Real>& d, \
@@ -0,0 +1,326 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// The soft-margin SVM is separable over the training examples, so splitting
+// them into the blocks (A_b, d_b), b=0,...,N-1, leads to the consensus form
+//
+//   min_{x_b,z} sum_b lambda 1^T max(1 - diag(d_b)(A_b w_b + beta_b),0)
+//               + (1/2) || w ||_2^2
+//
+//   s.t. x_b = [w_b; beta_b] = [w; beta] = z,
+//
+// which is solved with the consensus ADMM of Section 7.1 of Boyd et al.'s
+// "Distributed Optimization and Statistical Learning via the Alternating
+// Direction Method of Multipliers". Each pass over the data computes
+//
+//   x_b := arg min_x hinge_b(x) + (rho/2) || x - (z - u_b) ||_2^2
+//
+// for every block with the sparse QP IPM, and then
+//
+//   z   := arg min_z (1/2) || z_w ||_2^2 + (N rho/2) || z - avg(x_b+u_b) ||^2,
+//   u_b := u_b + x_b - z.
+//
+
+namespace El {
+namespace svm {
+
+namespace {
+
+// Run the two functions simultaneously within OpenMP sections, if available
+// and requested, and otherwise in sequence. Since exceptions cannot leave the
+// sections, they are recorded and the first is rethrown afterwards.
+template<typename Function1,typename Function2>
+void RunConcurrently( Function1 first, Function2 second, bool concurrent )
+{
+#ifdef EL_HYBRID
+    if( concurrent )
+    {
+        std::exception_ptr errors[2];
+        #pragma omp parallel sections num_threads(2)
+        {
+            #pragma omp section
+            {
+                try { first(); }
+                catch( ... ) { errors[0] = std::current_exception(); }
+            }
+            #pragma omp section
+            {
+                try { second(); }
+                catch( ... ) { errors[1] = std::current_exception(); }
+            }
+        }
+        for( Int j=0; j<2; ++j )
+            if( errors[j] )
+                std::rethrow_exception( errors[j] );
+        return;
+    }
+#endif
+    first();
+    second();
+}
+
+} // anonymous namespace
+
+// Solve
+//
+//   min_{w,beta,z} (rho/2) || [w; beta] - v ||_2^2 + lambda 1^T z
+//
+//   s.t. |-diag(d) A, -d, -I | | w    | <= | -1 |
+//        |      0,     0, -I | | beta |    |  0 |
+//                              | z    |
+//
+// and return x := [w; beta].
+template<typename Real>
+void ProximalBlock
+( const SparseMatrix<Real>& A,
+  const Matrix<Real>& d,
+        Real lambda,
+        Real rho,
+  const Matrix<Real>& v,
+        Matrix<Real>& x,
+  const qp::affine::Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Range<Int> xInd(0,n+1), zInd(n+1,n+m+1);
+
+    SparseMatrix<Real> Q, AHat, G;
+    Matrix<Real> c, b, h;
+
+    // Q := | rho I 0 |
+    //      |   0   0 |
+    // ================
+    Zeros( Q, n+m+1, n+m+1 );
+    Q.Reserve( n+1 );
+    for( Int e=0; e<n+1; ++e )
+        Q.QueueUpdate( e, e, rho );
+    Q.ProcessQueues();
+
+    // c := [-rho v; lambda]
+    // =====================
+    Zeros( c, n+m+1, 1 );
+    auto cx = c( xInd, ALL );
+    auto cz = c( zInd, ALL );
+    cx = v;
+    cx *= -rho;
+    Fill( cz, lambda );
+
+    // AHat = [], b = []
+    // =================
+    Zeros( AHat, 0, n+m+1 );
+    Zeros( b, 0, 1 );
+
+    // G := |-diag(d) A, -d, -I|
+    //      |      0,     0, -I|
+    // =========================
+    Zeros( G, 2*m, n+m+1 );
+    const Int numEntriesA = A.NumEntries();
+    G.Reserve( numEntriesA+3*m );
+    for( Int e=0; e<numEntriesA; ++e )
+        G.QueueUpdate( A.Row(e), A.Col(e), -d(A.Row(e))*A.Value(e) );
+    for( Int e=0; e<m; ++e )
+        G.QueueUpdate( e, n, -d(e) );
+    for( Int e=0; e<m; ++e )
+    {
+        G.QueueUpdate( e,   e+n+1, Real(-1) );
+        G.QueueUpdate( e+m, e+n+1, Real(-1) );
+    }
+    G.ProcessQueues();
+
+    // h := [-ones(m,1); zeros(m,1)]
+    // =============================
+    Zeros( h, 2*m, 1 );
+    auto h0 = h( IR(0,m), ALL );
+    Fill( h0, Real(-1) );
+
+    // Solve the affine QP
+    // ===================
+    Matrix<Real> xHat, y, z, s;
+    QP( Q, AHat, G, b, c, h, xHat, y, z, s, ctrl );
+    x = xHat( xInd, ALL );
+}
+
+template<typename Real>
+Int Streaming
+( Int n,
+  Int numBlocks,
+  const SVMBlockLoader<Real>& loadBlock,
+        Real lambda,
+        Matrix<Real>& x,
+  const StreamingSVMCtrl<Real>& ctrl,
+        mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+    const Real rho = ctrl.rho;
+    if( numBlocks <= 0 )
+        LogicError("There must be at least one block");
+
+    // The blocks are assigned to the processes in a round-robin manner
+    vector<Int> blocks;
+    for( Int block=commRank; block<numBlocks; block+=commSize )
+        blocks.push_back( block );
+    const Int numLocalBlocks = blocks.size();
+
+    // Column j of U is the scaled dual variable of local block j
+    Matrix<Real> z, U;
+    Zeros( z, n+1, 1 );
+    Zeros( U, n+1, numLocalBlocks );
+
+    string checkpointBase, checkpointFile;
+    if( !ctrl.checkpoint.empty() )
+    {
+        checkpointBase = BuildString(ctrl.checkpoint,"_",commRank);
+        checkpointFile = checkpointBase + "." + FileExtension(BINARY);
+        std::ifstream file( checkpointFile.c_str() );
+        if( file.is_open() )
+        {
+            file.close();
+            Matrix<Real> zU;
+            Read( zU, checkpointFile, BINARY );
+            if( zU.Height() != n+1 || zU.Width() != numLocalBlocks+1 )
+                LogicError
+                ("The checkpoint ",checkpointFile," does not match the "
+                 "problem");
+            z = zU( ALL, IR(0) );
+            U = zU( ALL, IR(1,END) );
+        }
+    }
+
+    // The blocks are double-buffered so that the next one may be read while
+    // the current one is solved. A single local block is only read once.
+    SparseMatrix<Real> ABlocks[2];
+    Matrix<Real> dBlocks[2];
+    auto load = [&]( Int localBlock, Int buffer )
+      {
+          loadBlock( blocks[localBlock], ABlocks[buffer], dBlocks[buffer] );
+          const SparseMatrix<Real>& A = ABlocks[buffer];
+          const Matrix<Real>& d = dBlocks[buffer];
+          if( A.Width() != n )
+              LogicError
+              ("Block ",blocks[localBlock]," had ",A.Width(),
+               " features rather than ",n);
+          if( d.Height() != A.Height() || d.Width() != 1 )
+              LogicError
+              ("The labels of block ",blocks[localBlock]," were ",
+               d.Height()," x ",d.Width()," rather than ",A.Height()," x 1");
+      };
+    const bool reload = ( numLocalBlocks > 1 );
+    Int buffer = 0;
+    if( numLocalBlocks > 0 )
+        load( 0, buffer );
+
+    const Real sqrtSize = Sqrt(Real(numBlocks*(n+1)));
+    const Real sqrtBlocks = Sqrt(Real(numBlocks));
+    Int numPasses = 0;
+    Matrix<Real> v, xBlock, xSum, uxSum, zOld;
+    while( true )
+    {
+        // Update each x_b, overwriting u_b with x_b + u_b
+        Zeros( xSum, n+1, 1 );
+        Real xNormSquared = 0;
+        for( Int localBlock=0; localBlock<numLocalBlocks; ++localBlock )
+        {
+            auto u = U( ALL, IR(localBlock) );
+            v = z;
+            v -= u;
+            RunConcurrently
+            ( [&]()
+              { ProximalBlock
+                ( ABlocks[buffer], dBlocks[buffer], lambda, rho, v, xBlock,
+                  ctrl.ipmCtrl ); },
+              [&]()
+              { if( reload )
+                    load( Mod(localBlock+1,numLocalBlocks), 1-buffer ); },
+              ctrl.prefetch );
+            if( reload )
+                buffer = 1-buffer;
+
+            xSum += xBlock;
+            const Real xBlockNorm = FrobeniusNorm( xBlock );
+            xNormSquared += xBlockNorm*xBlockNorm;
+            u += xBlock;
+        }
+        Zeros( uxSum, n+1, 1 );
+        for( Int localBlock=0; localBlock<numLocalBlocks; ++localBlock )
+            uxSum += U( ALL, IR(localBlock) );
+        mpi::AllReduce( xSum.Buffer(), n+1, comm );
+        mpi::AllReduce( uxSum.Buffer(), n+1, comm );
+        xNormSquared = mpi::AllReduce( xNormSquared, comm );
+
+        // z := avg(x_b+u_b), with the w component shrunk by N rho/(1+N rho)
+        zOld = z;
+        z = uxSum;
+        z *= Real(1)/Real(numBlocks);
+        auto zw = z( IR(0,n), ALL );
+        zw *= numBlocks*rho / (1+numBlocks*rho);
+
+        // u_b := (x_b + u_b) - z
+        for( Int localBlock=0; localBlock<numLocalBlocks; ++localBlock )
+        {
+            auto u = U( ALL, IR(localBlock) );
+            u -= z;
+        }
+        const Real UFrob = FrobeniusNorm( U );
+        const Real uNormSquared = mpi::AllReduce( UFrob*UFrob, comm );
+        ++numPasses;
+
+        // || [x_0 - z; ...; x_{N-1} - z] ||_2^2 =
+        //   sum_b || x_b ||_2^2 - 2 z^T sum_b x_b + N || z ||_2^2
+        const Real zNorm = FrobeniusNorm( z );
+        const Real rNorm =
+          Sqrt(Max(xNormSquared-2*Dot(z,xSum)+numBlocks*zNorm*zNorm,Real(0)));
+        zOld -= z;
+        const Real sNorm = rho*sqrtBlocks*FrobeniusNorm( zOld );
+        const Real epsPri = sqrtSize*ctrl.absTol +
+          ctrl.relTol*Max(Sqrt(xNormSquared),sqrtBlocks*zNorm);
+        const Real epsDual = sqrtSize*ctrl.absTol +
+          ctrl.relTol*rho*Sqrt(uNormSquared);
+
+        if( !checkpointBase.empty() )
+        {
+            // Write to a temporary file so that an interrupted write cannot
+            // destroy the previous checkpoint
+            Matrix<Real> zU;
+            Zeros( zU, n+1, numLocalBlocks+1 );
+            auto zUz = zU( ALL, IR(0) );
+            auto zUU = zU( ALL, IR(1,END) );
+            zUz = z;
+            zUU = U;
+            const string tmpBase = checkpointBase + "_tmp";
+            Write( zU, tmpBase, BINARY );
+            const string tmpFile = tmpBase + "." + FileExtension(BINARY);
+            if( std::rename( tmpFile.c_str(), checkpointFile.c_str() ) != 0 )
+                RuntimeError("Could not rename ",tmpFile," to ",checkpointFile);
+        }
+
+        if( ctrl.progress && commRank == 0 )
+            Output
+            ("Pass ",numPasses,": ||x-z||_2=",rNorm,", epsPri=",epsPri,
+             ", rho sqrt(N) ||z-zOld||_2=",sNorm,", epsDual=",epsDual);
+        if( rNorm < epsPri && sNorm < epsDual )
+            break;
+        if( numPasses >= ctrl.maxPasses )
+        {
+            if( commRank == 0 )
+                Output
+                ("WARNING: Streaming SVM did not converge after ",numPasses,
+                 " passes");
+            break;
+        }
+    }
+    x = z;
+    return numPasses;
+}
+
+} // namespace svm
+} // namespace El
@@ -7,6 +7,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include "./SparseInvCov/QUIC.hpp"
 
 // These implementations are adaptations of the solver described at
 //    http://www.stanford.edu/~boyd/papers/admm/covsel/covsel.html
@@ -213,6 +214,25 @@ Int SparseInvCov
           AbstractDistMatrix<Field>& Z, \
     const SparseInvCovCtrl<Base<Field>>& ctrl );
 
+template<typename Real>
+Int SparseInvCov
+( const Matrix<Real>& D,
+        Real lambda,
+        SparseMatrix<Real>& X,
+  const SparseInvCovQUICCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    return sparse_inv_cov::QUIC( D, lambda, X, ctrl );
+}
+
+#define PROTO_REAL(Real) \
+  PROTO(Real) \
+  template Int SparseInvCov \
+  ( const Matrix<Real>& D, \
+          Real lambda, \
+          SparseMatrix<Real>& X, \
+    const SparseInvCovQUICCtrl<Real>& ctrl );
+
 #define EL_NO_INT_PROTO
 #include <El/macros/Instantiate.h>
 
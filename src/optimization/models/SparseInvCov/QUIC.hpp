@@ -0,0 +1,286 @@
+/*
+   Copyright (c) 2009-2017, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// This is an implementation of the QUIC algorithm from
+//
+//   Cho-Jui Hsieh, Matyas A. Sustik, Inderjit S. Dhillon, and
+//   Pradeep Ravikumar, "QUIC: Quadratic Approximation for Sparse Inverse
+//   Covariance Estimation", J. Machine Learning Research, 15, 2014.
+//
+// for the problem
+//
+//   min_{X > 0} f(X) = -log det X + Tr(S X) + lambda || X ||_1.
+//
+// Each iteration minimizes the quadratic model
+//
+//   Tr((S-W) Delta) + (1/2) Tr(W Delta W Delta) + lambda || X + Delta ||_1,
+//
+// where W = inv(X), over the free set of entries which are either nonzero or
+// have a gradient exceeding lambda in magnitude, via coordinate descent while
+// maintaining U = Delta W. The iterate is only stored (and factored) as a
+// sparse matrix, though the inverse W is formed column by column from the
+// sparse factorization. Positive-definiteness and log det X are read off of
+// the diagonal of the (unpivoted) sparse LDL^T factorization.
+//
+
+namespace El {
+namespace sparse_inv_cov {
+
+// A free (lower-triangular) coordinate (i,j) of the iterate, its current
+// value, and its value within the Newton direction
+template<typename Real>
+struct FreeEntry
+{
+    Int i, j;
+    Real x, delta;
+};
+
+// Fill a symmetric sparse matrix with x + alpha delta over the free set
+template<typename Real>
+void FormIterate
+( Int p,
+  const vector<FreeEntry<Real>>& free,
+        Real alpha,
+        SparseMatrix<Real>& X )
+{
+    EL_DEBUG_CSE
+    Zeros( X, p, p );
+    X.Reserve( 2*free.size() );
+    for( const auto& entry : free )
+    {
+        const Real value = entry.x + alpha*entry.delta;
+        X.QueueUpdate( entry.i, entry.j, value );
+        if( entry.i != entry.j )
+            X.QueueUpdate( entry.j, entry.i, value );
+    }
+    X.ProcessQueues();
+}
+
+// Factor X and return whether it is positive-definite, as well as its
+// log-determinant if so.
+template<typename Real>
+bool FactorIterate
+( const SparseMatrix<Real>& X,
+        SparseLDLFactorization<Real>& factorization,
+        bool initialize,
+        Real& logDet )
+{
+    EL_DEBUG_CSE
+    if( initialize )
+        factorization.Initialize( X, true );
+    else
+        factorization.ChangeNonzeroValues( X );
+    try { factorization.Factor( LDL_2D ); }
+    catch( const ZeroPivotException& ) { return false; }
+
+    // Since the factorization is unpivoted, D = diag(d) and d = D 1
+    Matrix<Real> d;
+    Ones( d, X.Height(), 1 );
+    factorization.MultiplyWithD( NORMAL, d );
+    logDet = 0;
+    for( Int i=0; i<d.Height(); ++i )
+    {
+        if( d(i) <= Real(0) )
+            return false;
+        logDet += Log( d(i) );
+    }
+    return true;
+}
+
+// Tr(S X) + lambda || X ||_1 for X = x + alpha delta over the free set
+template<typename Real>
+Real TraceAndPenalty
+( const Matrix<Real>& S,
+  const vector<FreeEntry<Real>>& free,
+        Real alpha,
+        Real lambda )
+{
+    EL_DEBUG_CSE
+    Real value = 0;
+    for( const auto& entry : free )
+    {
+        const Real chi = entry.x + alpha*entry.delta;
+        const Real scale = ( entry.i == entry.j ? Real(1) : Real(2) );
+        value += scale*(S(entry.i,entry.j)*chi + lambda*Abs(chi));
+    }
+    return value;
+}
+
+template<typename Real>
+Int QUIC
+( const Matrix<Real>& D,
+        Real lambda,
+        SparseMatrix<Real>& X,
+  const SparseInvCovQUICCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    const Int p = D.Width();
+
+    Matrix<Real> S;
+    Covariance( D, S );
+    MakeSymmetric( LOWER, S );
+
+    // Start from the solution restricted to diagonal matrices,
+    // X = inv(diag(S) + lambda I)
+    Matrix<Real> W;
+    Zeros( W, p, p );
+    Zeros( X, p, p );
+    X.Reserve( p );
+    Real f = 0;
+    for( Int i=0; i<p; ++i )
+    {
+        const Real omega = S(i,i) + lambda;
+        if( omega <= Real(0) )
+            LogicError("The diagonal of S + lambda I must be positive");
+        W(i,i) = omega;
+        X.QueueUpdate( i, i, 1/omega );
+        // -log(1/omega) + (S(i,i)+lambda)/omega
+        f += Log(omega) + 1;
+    }
+    X.ProcessQueues();
+
+    SparseLDLFactorization<Real> factorization;
+    SparseMatrix<Real> XTrial;
+    vector<FreeEntry<Real>> free;
+    Matrix<Real> U;
+    Int numIter=0;
+    while( true )
+    {
+        // Form the free set over the lower triangle while computing the
+        // one-norms of the minimum-norm subgradient and of X
+        free.clear();
+        Real subgradNorm=0, XOneNorm=0;
+        for( Int j=0; j<p; ++j )
+        {
+            // Merge the entries of row j of the symmetric X, which are sorted
+            // by their column indices, with the rows i >= j of column j
+            Int e = X.RowOffset(j);
+            const Int eEnd = X.RowOffset(j+1);
+            while( e < eEnd && X.Col(e) < j )
+                ++e;
+            for( Int i=j; i<p; ++i )
+            {
+                const Real scale = ( i == j ? Real(1) : Real(2) );
+                const Real gamma = S(i,j) - W(i,j);
+                Real chi = 0;
+                if( e < eEnd && X.Col(e) == i )
+                {
+                    chi = X.Value(e);
+                    ++e;
+                }
+                if( chi != Real(0) )
+                {
+                    subgradNorm += scale*Abs(gamma+lambda*Sgn(chi,false));
+                    XOneNorm += scale*Abs(chi);
+                    free.push_back( FreeEntry<Real>{i,j,chi,Real(0)} );
+                }
+                else if( Abs(gamma) > lambda )
+                {
+                    subgradNorm += scale*(Abs(gamma)-lambda);
+                    free.push_back( FreeEntry<Real>{i,j,Real(0),Real(0)} );
+                }
+            }
+        }
+        if( ctrl.progress )
+            Output
+            (numIter,": f=",f,", ||subgrad||_1=",subgradNorm,
+             ", ||X||_1=",XOneNorm,", |free|=",free.size());
+        if( subgradNorm <= ctrl.tol*XOneNorm )
+            break;
+        if( numIter == ctrl.maxIter )
+            RuntimeError("QUIC failed to converge");
+
+        // Find the Newton direction via (an increasing number of) coordinate
+        // descent sweeps over the free set, maintaining U = Delta W, where
+        // (W Delta W)_{ij} = w_i^T u_j
+        Zeros( U, p, p );
+        const Int numSweeps = 1 + numIter/3;
+        for( Int sweep=0; sweep<numSweeps; ++sweep )
+        {
+            for( auto& entry : free )
+            {
+                const Int i = entry.i;
+                const Int j = entry.j;
+                const Real a = ( i == j ? W(i,i)*W(i,i) :
+                                          W(i,j)*W(i,j) + W(i,i)*W(j,j) );
+                const Real b = S(i,j) - W(i,j) +
+                  blas::Dot
+                  ( p, W.LockedBuffer(0,i), 1, U.LockedBuffer(0,j), 1 );
+                const Real c = entry.x + entry.delta;
+                const Real mu = -c + SoftThreshold( c-b/a, lambda/a );
+                if( mu == Real(0) )
+                    continue;
+                entry.delta += mu;
+                blas::Axpy
+                ( p, mu, W.LockedBuffer(0,j), 1, U.Buffer(i,0), U.LDim() );
+                if( i != j )
+                    blas::Axpy
+                    ( p, mu, W.LockedBuffer(0,i), 1, U.Buffer(j,0), U.LDim() );
+            }
+        }
+
+        // The predicted decrease,
+        //   Tr((S-W) Delta) + lambda (|| X + Delta ||_1 - || X ||_1)
+        Real deltaPred = 0;
+        for( const auto& entry : free )
+        {
+            const Real scale = ( entry.i == entry.j ? Real(1) : Real(2) );
+            deltaPred += scale*
+              ((S(entry.i,entry.j)-W(entry.i,entry.j))*entry.delta +
+               lambda*(Abs(entry.x+entry.delta)-Abs(entry.x)));
+        }
+
+        // Backtrack until X + alpha Delta is positive-definite and satisfies
+        // the Armijo condition. The free set fixes the sparsity pattern, so
+        // the reordering is only computed once per iteration.
+        Real alpha = 1;
+        bool accepted = false;
+        for( Int k=0; k<ctrl.maxBacktracks; ++k )
+        {
+            FormIterate( p, free, alpha, XTrial );
+            Real logDet;
+            if( FactorIterate( XTrial, factorization, k==0, logDet ) )
+            {
+                const Real fTrial =
+                  -logDet + TraceAndPenalty( S, free, alpha, lambda );
+                if( fTrial <= f + alpha*ctrl.sufficientDecrease*deltaPred )
+                {
+                    f = fTrial;
+                    accepted = true;
+                    break;
+                }
+            }
+            alpha *= ctrl.backtrackRatio;
+        }
+        if( !accepted )
+            RuntimeError("QUIC line search failed");
+
+        // Keep only the nonzeros of the new iterate and form its inverse
+        Zeros( X, p, p );
+        X.Reserve( 2*free.size() );
+        for( auto& entry : free )
+        {
+            entry.x += alpha*entry.delta;
+            if( entry.x == Real(0) )
+                continue;
+            X.QueueUpdate( entry.i, entry.j, entry.x );
+            if( entry.i != entry.j )
+                X.QueueUpdate( entry.j, entry.i, entry.x );
+        }
+        X.ProcessQueues();
+        Identity( W, p, p );
+        factorization.Solve( W );
+        ++numIter;
+    }
+    return numIter;
+}
+
+} // namespace sparse_inv_cov
+} // namespace El
@@ -12,6 +12,7 @@
 #include "./SVT/Cross.hpp"
 #include "./SVT/PivotedQR.hpp"
 #include "./SVT/TSQR.hpp"
+#include "./SVT/Randomized.hpp"
 
 namespace El {
 
@@ -85,6 +86,12 @@ Int SVT( DistMatrix<Field,U,STAR>& A, const Base<Field>& tau, bool relative )
     bool relative ); \
   template Int svt::TSQR \
   ( AbstractDistMatrix<Field>& A, const Base<Field>& tau, bool relative ); \
+  template Int svt::Randomized \
+  ( Matrix<Field>& A, const Base<Field>& tau, Int rank, bool relative, \
+    const RandomizedRangeCtrl& ctrl ); \
+  template Int svt::Randomized \
+  ( AbstractDistMatrix<Field>& A, const Base<Field>& tau, Int rank, \
+    bool relative, const RandomizedRangeCtrl& ctrl ); \
   PROTO_DIST(Field,MC  ) \
   PROTO_DIST(Field,MD  ) \
   PROTO_DIST(Field,MR  ) \
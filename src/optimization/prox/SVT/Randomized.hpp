@@ -0,0 +1,85 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_SVT_RANDOMIZED_HPP
+#define EL_SVT_RANDOMIZED_HPP
+
+namespace El {
+namespace svt {
+
+// Only compute the leading singular triplets with a randomized partial SVD,
+// starting from the predicted rank and doubling it until the smallest of the
+// computed singular values falls below the threshold (at which point every
+// surviving singular value has been found). If the rank grows beyond half of
+// the smaller dimension, fall back to a full SVD.
+
+template<typename Field>
+Int Randomized
+( Matrix<Field>& A, const Base<Field>& tau, Int rank, bool relative,
+  const RandomizedRangeCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+    const Int minDim = Min(A.Height(),A.Width());
+
+    Matrix<Field> U, V;
+    Matrix<Real> s;
+    Int k = Max(rank,Int(1));
+    while( true )
+    {
+        if( 2*k > minDim )
+            return Normal( A, tau, relative );
+        RandomizedSVD( A, U, s, V, k, ctrl );
+        const Real thresh = ( relative ? tau*s(0) : tau );
+        if( s(s.Height()-1) <= thresh )
+            break;
+        k *= 2;
+    }
+    SoftThreshold( s, tau, relative );
+    DiagonalScale( RIGHT, NORMAL, s, U );
+    Gemm( NORMAL, ADJOINT, Field(1), U, V, Field(0), A );
+
+    return ZeroNorm( s );
+}
+
+template<typename Field>
+Int Randomized
+( AbstractDistMatrix<Field>& APre, const Base<Field>& tau, Int rank,
+  bool relative, const RandomizedRangeCtrl& ctrl )
+{
+    EL_DEBUG_CSE
+    typedef Base<Field> Real;
+
+    DistMatrixReadWriteProxy<Field,Field,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+    const Int minDim = Min(A.Height(),A.Width());
+
+    DistMatrix<Real,VR,STAR> s( A.Grid() );
+    DistMatrix<Field> U( A.Grid() ), V( A.Grid() );
+    Int k = Max(rank,Int(1));
+    while( true )
+    {
+        if( 2*k > minDim )
+            return Normal( A, tau, relative );
+        RandomizedSVD( A, U, s, V, k, ctrl );
+        const Real thresh = ( relative ? tau*s.Get(0,0) : tau );
+        if( s.Get(s.Height()-1,0) <= thresh )
+            break;
+        k *= 2;
+    }
+    SoftThreshold( s, tau, relative );
+    DiagonalScale( RIGHT, NORMAL, s, U );
+    Gemm( NORMAL, ADJOINT, Field(1), U, V, Field(0), A );
+
+    return ZeroNorm( s );
+}
+
+} // namespace svt
+} // namespace El
+
+#endif // ifndef EL_SVT_RANDOMIZED_HPP
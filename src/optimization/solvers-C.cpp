@@ -20,22 +20,30 @@ ElError ElMehrotraCtrlDefault_s( ElMehrotraCtrl_s* ctrl )
 
     ctrl->primalInit = false;
     ctrl->dualInit = false;
+    ctrl->warmStartShift = true;
+    ctrl->warmStartMinMu = Pow(eps,float(0.25));
     ctrl->minTol = 1e-2;
     ctrl->targetTol = 1e-4;
     ctrl->maxIts = 100;
     ctrl->maxStepRatio = 0.99;
     ctrl->system = EL_FULL_KKT;
     ctrl->mehrotra = true;
+    ctrl->maxGondzioCorrs = 0;
+    ctrl->adaptiveGondzio = true;
     ctrl->centralityRule = &StepLengthCentrality<float>;
     ctrl->standardInitShift = true;
     ctrl->balanceTol = Pow(eps,float(-0.19));
     ctrl->forceSameStep = true;
     ElRegSolveCtrlDefault_s( &ctrl->solveCtrl );
     ctrl->resolveReg = true;
+    ctrl->lowerPrecisionFactor = false;
     ctrl->outerEquil = true;
     ctrl->basisSize = 6;
     ctrl->print = false;
     ctrl->time = false;
+    ctrl->checkpointFile = "";
+    ctrl->checkpointFreq = 0;
+    ctrl->restart = false;
 
     ctrl->wSafeMaxNorm = Pow(eps,float(-0.15));
     ctrl->wMaxLimit = Pow(eps,float(-0.4));
@@ -60,22 +68,30 @@ ElError ElMehrotraCtrlDefault_d( ElMehrotraCtrl_d* ctrl )
 
     ctrl->primalInit = false;
     ctrl->dualInit = false;
+    ctrl->warmStartShift = true;
+    ctrl->warmStartMinMu = Pow(eps,double(0.25));
     ctrl->minTol = 1e-5;
     ctrl->targetTol = 1e-8;
     ctrl->maxIts = 100;
     ctrl->maxStepRatio = 0.99;
     ctrl->system = EL_FULL_KKT;
     ctrl->mehrotra = true;
+    ctrl->maxGondzioCorrs = 0;
+    ctrl->adaptiveGondzio = true;
     ctrl->centralityRule = &StepLengthCentrality<double>;
     ctrl->standardInitShift = true;
     ctrl->balanceTol = Pow(eps,double(-0.19));
     ctrl->forceSameStep = true;
     ElRegSolveCtrlDefault_d( &ctrl->solveCtrl );
     ctrl->resolveReg = true;
+    ctrl->lowerPrecisionFactor = false;
     ctrl->outerEquil = true;
     ctrl->basisSize = 6;
     ctrl->print = false;
     ctrl->time = false;
+    ctrl->checkpointFile = "";
+    ctrl->checkpointFreq = 0;
+    ctrl->restart = false;
 
     ctrl->wSafeMaxNorm = Pow(eps,double(-0.15));
     ctrl->wMaxLimit = Pow(eps,double(-0.4));
@@ -105,6 +121,10 @@ ElError ElADMMCtrlDefault_s( ElADMMCtrl_s* ctrl )
     ctrl->relTol = 1e-2;
     ctrl->inv = true;
     ctrl->print = true;
+    ctrl->adaptiveRho = false;
+    ctrl->rhoBalance = 10;
+    ctrl->rhoScale = 2;
+    ctrl->checkFrequency = 1;
     return EL_SUCCESS;
 }
 
@@ -117,6 +137,10 @@ ElError ElADMMCtrlDefault_d( ElADMMCtrl_d* ctrl )
     ctrl->relTol = 1e-4;
     ctrl->inv = true;
     ctrl->print = true;
+    ctrl->adaptiveRho = false;
+    ctrl->rhoBalance = 10;
+    ctrl->rhoScale = 2;
+    ctrl->checkFrequency = 1;
     return EL_SUCCESS;
 }
 
@@ -155,6 +179,7 @@ ElError ElLPAffineCtrlDefault_s( ElLPAffineCtrl_s* ctrl )
 {
     ctrl->approach = EL_LP_MEHROTRA;
     ElMehrotraCtrlDefault_s( &ctrl->mehrotraCtrl );
+    ctrl->presolve = false;
     return EL_SUCCESS;
 }
 
@@ -162,6 +187,7 @@ ElError ElLPAffineCtrlDefault_d( ElLPAffineCtrl_d* ctrl )
 {
     ctrl->approach = EL_LP_MEHROTRA;
     ElMehrotraCtrlDefault_d( &ctrl->mehrotraCtrl );
+    ctrl->presolve = false;
     return EL_SUCCESS;
 }
 
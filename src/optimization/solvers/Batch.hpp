@@ -0,0 +1,220 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_OPTIMIZATION_SOLVERS_BATCH_HPP
+#define EL_OPTIMIZATION_SOLVERS_BATCH_HPP
+
+namespace El {
+namespace batch {
+
+// The (rough) relative costs of the Interior Point Methods for a model,
+// which are only used to order and balance the work
+template<typename Real>
+double EstimatedCost
+( const AffineLPProblem<Matrix<Real>,Matrix<Real>>& problem )
+{
+    const double n = problem.c.Height();
+    const double m = problem.b.Height();
+    const double k = problem.h.Height();
+    return Pow( n+m+k, 3. );
+}
+
+template<typename Real>
+double EstimatedCost
+( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem )
+{
+    const double numEntries =
+      problem.A.NumEntries() + problem.G.NumEntries() +
+      problem.c.Height() + problem.b.Height() + problem.h.Height();
+    return Pow( numEntries, 1.5 );
+}
+
+template<typename Real>
+double EstimatedCost
+( const AffineQPProblem<Matrix<Real>,Matrix<Real>>& problem )
+{
+    const double n = problem.c.Height();
+    const double m = problem.b.Height();
+    const double k = problem.h.Height();
+    return Pow( n+m+k, 3. );
+}
+
+template<typename Real>
+double EstimatedCost
+( const AffineQPProblem<SparseMatrix<Real>,Matrix<Real>>& problem )
+{
+    const double numEntries =
+      problem.Q.NumEntries() + problem.A.NumEntries() +
+      problem.G.NumEntries() + problem.c.Height() + problem.b.Height() +
+      problem.h.Height();
+    return Pow( numEntries, 1.5 );
+}
+
+// The models are handed out largest-first by a dispatching process once there
+// are at least this many processes; otherwise their (estimated) costs are
+// statically balanced over all of the processes.
+const int minDynamicCommSize = 4;
+
+// Solve each of a batch of independent models, which are stored redundantly
+// on every process of 'comm', using a single process per model. The
+// solutions are returned on every process.
+template<typename Real,class ProblemType>
+void Solve
+( const vector<ProblemType>& problems,
+        vector<AffineLPSolution<Matrix<Real>>>& solutions,
+  function<void(const ProblemType&,AffineLPSolution<Matrix<Real>>&)> solve,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    const Int numModels = problems.size();
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    solutions.resize( numModels );
+
+    // Order the models from most to least expensive
+    vector<double> costs(numModels);
+    for( Int model=0; model<numModels; ++model )
+        costs[model] = EstimatedCost( problems[model] );
+    vector<Int> order(numModels);
+    for( Int model=0; model<numModels; ++model )
+        order[model] = model;
+    std::stable_sort
+    ( order.begin(), order.end(),
+      [&]( const Int& a, const Int& b ) { return costs[a] > costs[b]; } );
+
+    // Each model is solved independently so that a failure (e.g., an
+    // infeasible model) does not leave the remaining processes hanging.
+    vector<Int> failed(numModels,0);
+    auto localSolve =
+      [&]( Int model )
+      {
+          try { solve( problems[model], solutions[model] ); }
+          catch( std::exception& e )
+          {
+              Output
+              ("Process ",commRank," failed to solve model ",model,": ",
+               e.what());
+              failed[model] = 1;
+          }
+      };
+
+    vector<bool> local(numModels,false);
+    if( commSize >= minDynamicCommSize )
+    {
+        // Process 0 hands out the models in order as the other processes
+        // request work and then signals each of them to stop with a -1
+        if( commRank == 0 )
+        {
+            Int next = 0;
+            for( int numStopped=0; numStopped<commSize-1; )
+            {
+                const Int worker = mpi::Recv<Int>( mpi::ANY_SOURCE, comm );
+                if( next < numModels )
+                {
+                    mpi::Send( order[next++], int(worker), comm );
+                }
+                else
+                {
+                    mpi::Send( Int(-1), int(worker), comm );
+                    ++numStopped;
+                }
+            }
+        }
+        else
+        {
+            while( true )
+            {
+                mpi::Send( Int(commRank), 0, comm );
+                const Int model = mpi::Recv<Int>( 0, comm );
+                if( model < 0 )
+                    break;
+                localSolve( model );
+                local[model] = true;
+            }
+        }
+    }
+    else
+    {
+        // Greedily assign each model to the least-loaded process
+        vector<double> loads(commSize,0.);
+        for( Int j=0; j<numModels; ++j )
+        {
+            const Int model = order[j];
+            const int owner =
+              std::min_element(loads.begin(),loads.end()) - loads.begin();
+            loads[owner] += costs[model];
+            if( owner == commRank )
+            {
+                localSolve( model );
+                local[model] = true;
+            }
+        }
+    }
+
+    // Pack the local solutions into a zero-initialized buffer for all of the
+    // models and sum the contributions of every process
+    vector<Int> offsets(numModels+1);
+    offsets[0] = 0;
+    for( Int model=0; model<numModels; ++model )
+    {
+        const Int n = problems[model].c.Height();
+        const Int m = problems[model].b.Height();
+        const Int k = problems[model].h.Height();
+        offsets[model+1] = offsets[model] + n + m + 2*k;
+    }
+    vector<Real> buffer(offsets[numModels],Real(0));
+    for( Int model=0; model<numModels; ++model )
+    {
+        if( !local[model] || failed[model] )
+            continue;
+        const auto& solution = solutions[model];
+        Real* packBuf = &buffer[offsets[model]];
+        const Int n = problems[model].c.Height();
+        const Int m = problems[model].b.Height();
+        const Int k = problems[model].h.Height();
+        MemCopy( packBuf, solution.x.LockedBuffer(), n ); packBuf += n;
+        MemCopy( packBuf, solution.y.LockedBuffer(), m ); packBuf += m;
+        MemCopy( packBuf, solution.z.LockedBuffer(), k ); packBuf += k;
+        MemCopy( packBuf, solution.s.LockedBuffer(), k );
+    }
+    mpi::AllReduce( buffer.data(), int(buffer.size()), mpi::SUM, comm );
+    mpi::AllReduce( failed.data(), int(numModels), mpi::SUM, comm );
+
+    Int numFailed = 0, firstFailure = -1;
+    for( Int model=0; model<numModels; ++model )
+    {
+        if( failed[model] )
+        {
+            if( numFailed++ == 0 )
+                firstFailure = model;
+            continue;
+        }
+        auto& solution = solutions[model];
+        const Real* unpackBuf = &buffer[offsets[model]];
+        const Int n = problems[model].c.Height();
+        const Int m = problems[model].b.Height();
+        const Int k = problems[model].h.Height();
+        solution.x.Resize( n, 1 );
+        solution.y.Resize( m, 1 );
+        solution.z.Resize( k, 1 );
+        solution.s.Resize( k, 1 );
+        MemCopy( solution.x.Buffer(), unpackBuf, n ); unpackBuf += n;
+        MemCopy( solution.y.Buffer(), unpackBuf, m ); unpackBuf += m;
+        MemCopy( solution.z.Buffer(), unpackBuf, k ); unpackBuf += k;
+        MemCopy( solution.s.Buffer(), unpackBuf, k );
+    }
+    if( numFailed > 0 )
+        RuntimeError
+        (numFailed," of the ",numModels," models could not be solved "
+         "(the first was model ",firstFailure,")");
+}
+
+} // namespace batch
+} // namespace El
+
+#endif // ifndef EL_OPTIMIZATION_SOLVERS_BATCH_HPP
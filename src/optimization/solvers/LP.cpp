@@ -10,9 +10,46 @@
 #include "./LP/direct/IPM.hpp"
 #include "./LP/affine/IPM.hpp"
 #include "./LP/MPS.hpp"
+#include "./Batch.hpp"
 
 namespace El {
 
+namespace lp {
+namespace affine {
+
+// Solve the presolved problem and then expand its solution into one of the
+// original problem
+template<class MatrixType,class VectorType,typename Real>
+void PresolvedLP
+( const AffineLPProblem<MatrixType,VectorType>& problem,
+        AffineLPSolution<VectorType>& solution,
+  const Ctrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    AffineLPProblem<MatrixType,VectorType> reducedProblem;
+    AffineLPSolution<VectorType> reducedSolution;
+    PresolveInfo<Real> info;
+    Presolve( problem, reducedProblem, info, ctrl.mehrotraCtrl.print );
+    if( reducedProblem.c.Height() > 0 )
+    {
+        auto reducedCtrl = ctrl;
+        reducedCtrl.presolve = false;
+        LP( reducedProblem, reducedSolution, reducedCtrl );
+    }
+    else
+    {
+        // Every variable was fixed, and so the reduced problem is empty
+        reducedSolution.x = reducedProblem.c;
+        reducedSolution.y = reducedProblem.b;
+        reducedSolution.z = reducedProblem.h;
+        reducedSolution.s = reducedProblem.h;
+    }
+    Postsolve( info, reducedSolution, solution );
+}
+
+} // namespace affine
+} // namespace lp
+
 template<typename Real>
 void LP
 ( const DirectLPProblem<Matrix<Real>,Matrix<Real>>& problem,
@@ -239,7 +276,9 @@ void LP
   const lp::affine::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.approach == LP_MEHROTRA )
+    if( ctrl.presolve )
+        lp::affine::PresolvedLP( problem, solution, ctrl );
+    else if( ctrl.approach == LP_MEHROTRA )
         lp::affine::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
     else
         LogicError("Unsupported solver");
@@ -329,7 +368,9 @@ void LP
   const lp::affine::Ctrl<Real>& ctrl )
 {
     EL_DEBUG_CSE
-    if( ctrl.approach == LP_MEHROTRA )
+    if( ctrl.presolve )
+        lp::affine::PresolvedLP( problem, solution, ctrl );
+    else if( ctrl.approach == LP_MEHROTRA )
         lp::affine::Mehrotra( problem, solution, ctrl.mehrotraCtrl );
     else
         LogicError("Unsupported solver");
@@ -373,6 +414,38 @@ void LP
     s = solution.s;
 }
 
+template<typename Real>
+void LP
+( const vector<AffineLPProblem<Matrix<Real>,Matrix<Real>>>& problems,
+        vector<AffineLPSolution<Matrix<Real>>>& solutions,
+  const lp::affine::Ctrl<Real>& ctrl,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef AffineLPProblem<Matrix<Real>,Matrix<Real>> ProblemType;
+    auto solve =
+      [&]( const ProblemType& problem,
+           AffineLPSolution<Matrix<Real>>& solution )
+      { LP( problem, solution, ctrl ); };
+    batch::Solve<Real,ProblemType>( problems, solutions, solve, comm );
+}
+
+template<typename Real>
+void LP
+( const vector<AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>>& problems,
+        vector<AffineLPSolution<Matrix<Real>>>& solutions,
+  const lp::affine::Ctrl<Real>& ctrl,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef AffineLPProblem<SparseMatrix<Real>,Matrix<Real>> ProblemType;
+    auto solve =
+      [&]( const ProblemType& problem,
+           AffineLPSolution<Matrix<Real>>& solution )
+      { LP( problem, solution, ctrl ); };
+    batch::Solve<Real,ProblemType>( problems, solutions, solve, comm );
+}
+
 #define PROTO(Real) \
   template void LP \
   ( const DirectLPProblem<Matrix<Real>,Matrix<Real>>& problem, \
@@ -482,6 +555,16 @@ void LP
           DistMultiVec<Real>& z, \
           DistMultiVec<Real>& s, \
     const lp::affine::Ctrl<Real>& ctrl ); \
+  template void LP \
+  ( const vector<AffineLPProblem<Matrix<Real>,Matrix<Real>>>& problems, \
+          vector<AffineLPSolution<Matrix<Real>>>& solutions, \
+    const lp::affine::Ctrl<Real>& ctrl, \
+    mpi::Comm comm ); \
+  template void LP \
+  ( const vector<AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>>& problems, \
+          vector<AffineLPSolution<Matrix<Real>>>& solutions, \
+    const lp::affine::Ctrl<Real>& ctrl, \
+    mpi::Comm comm ); \
   template void ReadMPS \
   ( AffineLPProblem<Matrix<Real>,Matrix<Real>>& problem, \
     const string& filename, \
@@ -182,6 +182,74 @@ struct AffineLPEntry
   Real value;
 };
 
+// A lightweight replacement for a std::stringstream over a single line of an
+// in-memory MPS file which avoids the allocation and locale overhead of the
+// latter. Only the operations required by 'MPSReader' are supported: peeking
+// at the first character, extracting whitespace-delimited tokens, and
+// extracting floating-point values (via strtod). As with a stream, a failed
+// extraction causes all subsequent extractions to fail.
+class MPSLineStream
+{
+public:
+    MPSLineStream( const char* lineBeg, const char* lineEnd )
+    : pos_(lineBeg), end_(lineEnd)
+    { }
+
+    int peek() const
+    { return pos_ == end_ ? EOF : int(*pos_); }
+
+    MPSLineStream& operator>>( string& token )
+    {
+        if( SkipWhitespace() )
+        {
+            const char* tokenBeg = pos_;
+            while( pos_ != end_ && !IsWhitespace(*pos_) )
+                ++pos_;
+            token.assign( tokenBeg, pos_ );
+        }
+        return *this;
+    }
+
+    MPSLineStream& operator>>( double& value )
+    {
+        if( SkipWhitespace() )
+        {
+            // The line is terminated by either a newline or the trailing NULL
+            // of the buffer, so strtod cannot read past its end.
+            char* valueEnd;
+            value = std::strtod( pos_, &valueEnd );
+            if( valueEnd == pos_ || valueEnd > end_ )
+                good_ = false;
+            else
+                pos_ = valueEnd;
+        }
+        return *this;
+    }
+
+    explicit operator bool() const { return good_; }
+
+private:
+    const char* pos_;
+    const char* end_;
+    bool good_=true;
+
+    static bool IsWhitespace( char c )
+    { return c == ' ' || c == '\t' || c == '\r' || c == '\n' ||
+             c == '\v' || c == '\f'; }
+
+    bool SkipWhitespace()
+    {
+        if( good_ )
+        {
+            while( pos_ != end_ && IsWhitespace(*pos_) )
+                ++pos_;
+            if( pos_ == end_ )
+                good_ = false;
+        }
+        return good_;
+    }
+};
+
 // We form the primal problem
 //
 //   arginf_{x,s} { c^T x | A x = b, G x + s = h, s >= 0 },
@@ -213,6 +281,15 @@ struct AffineLPEntry
 // set of nonpositive bounds, and 'G5 x <= h5' is the set of nonnegative
 // bounds.
 //
+// The file is read into memory in a single pass (on the root process of
+// 'comm', which then broadcasts its contents) so that neither pass over the
+// model is bound by per-line stream overhead. If 'distributeColumns' is true,
+// the data lines of the COLUMNS section -- which typically contain nearly
+// all of the model -- are split into contiguous byte ranges over the
+// processes of 'comm' during the 'QueuedEntry'/'GetEntry' cycle, and all
+// other entries are only enqueued on the root process, so that the union of
+// the entries enqueued over the processes is that of a sequential read.
+//
 class MPSReader
 {
 public:
@@ -220,7 +297,9 @@ public:
     ( const string& filename,
       bool compressed=false,
       bool minimize=true,
-      bool keepNonnegativeWithZeroUpperBound=true );
+      bool keepNonnegativeWithZeroUpperBound=true,
+      mpi::Comm comm=mpi::COMM_SELF,
+      bool distributeColumns=false );
     // The PILOT netlib lp_data model appears to require
     // 'keepNonnegativeWithZeroUpperBound=true'.
 
@@ -234,7 +313,24 @@ public:
 
 private:
     string filename_;
-    std::ifstream file_;
+
+    // The contents of the file (followed by an implicit NULL terminator) and
+    // the offset of the beginning of the next line to be read.
+    string contents_;
+    size_t position_=0;
+
+    // The byte range of the data lines of the COLUMNS section and the portion
+    // of it which is assigned to this process.
+    bool distributeColumns_;
+    int commRank_;
+    size_t columnsBeg_=0, columnsEnd_=0;
+    size_t localColumnsBeg_=0, localColumnsEnd_=0;
+
+    // Return the next line of the file (excluding its newline), if any.
+    bool NextLine( const char*& lineBeg, const char*& lineEnd );
+
+    // Return the offset of the first line which begins at or after 'offset'.
+    size_t LineStart( size_t offset ) const;
 
     bool minimize_;
     bool keepNonnegativeWithZeroUpperBound_;
@@ -257,7 +353,6 @@ private:
     bool boundsHasName_;
 
     // Temporaries for the metadata extraction process.
-    string line_;
     string token_, rowType_, rowName_, variableName_, boundMark_;
     double value_;
 
@@ -270,16 +365,53 @@ MPSReader::MPSReader
 ( const string& filename,
   bool compressed,
   bool minimize,
-  bool keepNonnegativeWithZeroUpperBound )
+  bool keepNonnegativeWithZeroUpperBound,
+  mpi::Comm comm,
+  bool distributeColumns )
 : filename_(filename),
-  file_(filename.c_str()),
+  distributeColumns_(distributeColumns),
+  commRank_(mpi::Rank(comm)),
   minimize_(minimize),
   keepNonnegativeWithZeroUpperBound_(keepNonnegativeWithZeroUpperBound)
 {
     EL_DEBUG_CSE
     if( compressed )
         LogicError("Compressed reads are not yet supported");
-    if( !file_.is_open() )
+
+    // Read the entire file on the root process with a single request and then
+    // broadcast the result (a negative size signals a failed read).
+    Int numBytes = 0;
+    if( commRank_ == 0 )
+    {
+        std::ifstream file( filename.c_str(), std::ios::binary );
+        if( file.is_open() )
+        {
+            file.seekg( 0, std::ios::end );
+            numBytes = file.tellg();
+            file.seekg( 0, std::ios::beg );
+            contents_.resize( numBytes );
+            if( numBytes > 0 && !file.read( &contents_[0], numBytes ) )
+                numBytes = -1;
+        }
+        else
+            numBytes = -1;
+    }
+    if( mpi::Size(comm) > 1 )
+    {
+        mpi::Broadcast( numBytes, 0, comm );
+        if( numBytes > 0 )
+        {
+            if( commRank_ != 0 )
+                contents_.resize( numBytes );
+            // Avoid overflowing the 'int' counts of MPI
+            const Int maxChunk = Int(1) << 30;
+            for( Int offset=0; offset<numBytes; offset+=maxChunk )
+                mpi::Broadcast
+                ( reinterpret_cast<byte*>(&contents_[offset]),
+                  int(Min(maxChunk,numBytes-offset)), 0, comm );
+        }
+    }
+    if( numBytes < 0 )
         RuntimeError("Could not open ",filename);
 
     // Rather than assuming that std::map<string,Int>::size() is constant-time,
@@ -295,12 +427,13 @@ MPSReader::MPSReader
     // comparison. While capital letters are used by convention, they are
     // not required.
     MPSSection section = MPS_NONE;
-    string line;
-    while( std::getline( file_, line ) )
+    const char* lineBeg;
+    const char* lineEnd;
+    while( NextLine( lineBeg, lineEnd ) )
     {
         // We first determine which section we are in
         // ------------------------------------------
-        std::stringstream sectionStream( line );
+        MPSLineStream sectionStream( lineBeg, lineEnd );
         const char firstChar = sectionStream.peek();
         const bool isDataLine =
           firstChar == ' ' ||
@@ -318,6 +451,8 @@ MPSReader::MPSReader
 
         if( !isDataLine )
         {
+            if( section == MPS_COLUMNS )
+                columnsEnd_ = lineBeg - contents_.data();
             if( token == "NAME" )
             {
                 if( meta_.name != "" )
@@ -345,6 +480,7 @@ MPSReader::MPSReader
                     meta_.numInequalityEntries > 0 )
                     LogicError("Multiple 'COLUMNS' sections");
                 section = MPS_COLUMNS;
+                columnsBeg_ = position_;
             }
             else if( token == "RHS" )
             {
@@ -389,7 +525,7 @@ MPSReader::MPSReader
         // No section marker was found, so handle this data line.
         if( section == MPS_ROWS )
         {
-            std::stringstream rowStream( line );
+            MPSLineStream rowStream( lineBeg, lineEnd );
             if( !(rowStream >> rowType) )
                 LogicError("Invalid 'ROWS' section");
             if( !(rowStream >> rowName) )
@@ -424,7 +560,7 @@ MPSReader::MPSReader
         }
         else if( section == MPS_COLUMNS )
         {
-            std::stringstream columnStream( line );
+            MPSLineStream columnStream( lineBeg, lineEnd );
             if( !(columnStream >> variableName) )
                 LogicError("Invalid 'COLUMNS' section");
             auto variableIter = meta_.variableDict.find( variableName );
@@ -487,7 +623,7 @@ MPSReader::MPSReader
         {
             if( !initializedRHSSection_ )
             {
-                std::stringstream rhsTestStream( line );
+                MPSLineStream rhsTestStream( lineBeg, lineEnd );
                 Int numTokens=0;
                 string rhsToken;
                 while( rhsTestStream >> rhsToken )
@@ -511,7 +647,7 @@ MPSReader::MPSReader
                 initializedRHSSection_ = true;
             }
 
-            std::stringstream rhsStream( line );
+            MPSLineStream rhsStream( lineBeg, lineEnd );
             if( rhsHasName_ )
             {
                 if( !(rhsStream >> rhsNameCandidate) )
@@ -547,7 +683,7 @@ MPSReader::MPSReader
         {
             if( !initializedBoundsSection_ )
             {
-                std::stringstream boundsTestStream( line );
+                MPSLineStream boundsTestStream( lineBeg, lineEnd );
                 if( !(boundsTestStream >> boundMark) )
                     LogicError("Invalid 'BOUNDS' section");
                 if( !(boundsTestStream >> token) )
@@ -589,7 +725,7 @@ MPSReader::MPSReader
                 initializedBoundsSection_ = true;
             }
 
-            std::stringstream boundStream( line );
+            MPSLineStream boundStream( lineBeg, lineEnd );
             // We already have the first token of a bounding row, which should
             // be of the same general form as
             //
@@ -654,6 +790,8 @@ MPSReader::MPSReader
             LogicError("Invalid MPS file");
         }
     }
+    if( section == MPS_COLUMNS )
+        columnsEnd_ = contents_.size();
     if( meta_.name == "" )
         LogicError("No nontrivial 'NAME' was found");
     if( meta_.numRHS == 0 )
@@ -857,13 +995,28 @@ MPSReader::MPSReader
     // 'QueuedEntry'/'GetEntry' cycle.
 
     // Reset the file.
-    file_.clear();
-    file_.seekg( 0, std::ios::beg );
+    position_ = 0;
+
+    // Split the data lines of the COLUMNS section into (roughly) equal byte
+    // ranges which begin on line boundaries.
+    if( distributeColumns_ )
+    {
+        const size_t numColumnsBytes = columnsEnd_ - columnsBeg_;
+        const size_t commSize = mpi::Size( comm );
+        localColumnsBeg_ =
+          LineStart( columnsBeg_ + (numColumnsBytes*commRank_)/commSize );
+        localColumnsEnd_ =
+          LineStart( columnsBeg_ + (numColumnsBytes*(commRank_+1))/commSize );
+    }
 
     // Extract the number of variables
     // (the matrix 'A' is 'm x n' and 'G' is 'k x n').
     meta_.n = meta_.variableDict.size();
-    variableIter_ = meta_.variableDict.cbegin();
+    // Only the root process enqueues the bound entries of a distributed read.
+    if( distributeColumns_ && commRank_ != 0 )
+        variableIter_ = meta_.variableDict.cend();
+    else
+        variableIter_ = meta_.variableDict.cbegin();
 
     //
     //   | A0 | x = | b0 |
@@ -891,15 +1044,49 @@ MPSReader::MPSReader
     meta_.k = meta_.nonnegativeOffset + meta_.numNonnegativeBounds;
 }
 
+bool MPSReader::NextLine( const char*& lineBeg, const char*& lineEnd )
+{
+    EL_DEBUG_CSE
+    const size_t numBytes = contents_.size();
+    if( position_ >= numBytes )
+        return false;
+    lineBeg = contents_.data() + position_;
+    lineEnd = static_cast<const char*>
+      (std::memchr( lineBeg, '\n', numBytes-position_ ));
+    if( lineEnd == nullptr )
+    {
+        lineEnd = contents_.data() + numBytes;
+        position_ = numBytes;
+    }
+    else
+        position_ = (lineEnd - contents_.data()) + 1;
+    return true;
+}
+
+size_t MPSReader::LineStart( size_t offset ) const
+{
+    EL_DEBUG_CSE
+    const size_t numBytes = contents_.size();
+    if( offset == 0 || offset >= numBytes || contents_[offset-1] == '\n' )
+        return Min( offset, numBytes );
+    const void* newline =
+      std::memchr( contents_.data()+offset, '\n', numBytes-offset );
+    if( newline == nullptr )
+        return numBytes;
+    return (static_cast<const char*>(newline) - contents_.data()) + 1;
+}
+
 bool MPSReader::QueuedEntry()
 {
     EL_DEBUG_CSE
 
+    const char* lineBeg;
+    const char* lineEnd;
     while( queuedEntries_.size() == 0 &&
            section_ != MPS_END &&
-           std::getline( file_, line_ ) )
+           NextLine( lineBeg, lineEnd ) )
     {
-        std::stringstream sectionStream( line_ );
+        MPSLineStream sectionStream( lineBeg, lineEnd );
         const char firstChar = sectionStream.peek();
         const bool isDataLine =
           firstChar == ' ' ||
@@ -932,6 +1119,8 @@ bool MPSReader::QueuedEntry()
             else if( token_ == "COLUMNS" )
             {
                 section_ = MPS_COLUMNS;
+                if( distributeColumns_ )
+                    position_ = localColumnsBeg_;
             }
             else if( token_ == "RHS" )
             {
@@ -964,10 +1153,23 @@ bool MPSReader::QueuedEntry()
         }
         else if( section_ == MPS_COLUMNS )
         {
-           double columnValue;
-           std::stringstream columnStream( line_ );
+            if( distributeColumns_ &&
+                size_t(lineBeg-contents_.data()) >= localColumnsEnd_ )
+            {
+                // The remainder of the COLUMNS section belongs to other
+                // processes, and only the root process handles the rest of
+                // the file.
+                if( commRank_ == 0 )
+                    position_ = columnsEnd_;
+                else
+                    section_ = MPS_END;
+                continue;
+            }
+
+            double columnValue;
+            MPSLineStream columnStream( lineBeg, lineEnd );
 
-           if( !(columnStream >> variableName_) )
+            if( !(columnStream >> variableName_) )
                 LogicError("Invalid 'COLUMNS' section");
             auto variableIter = meta_.variableDict.find( variableName_ );
             if( variableIter == meta_.variableDict.end() )
@@ -1041,7 +1243,7 @@ bool MPSReader::QueuedEntry()
         else if( section_ == MPS_RHS )
         {
             double rhsValue;
-            std::stringstream rhsStream( line_ );
+            MPSLineStream rhsStream( lineBeg, lineEnd );
 
             if( rhsHasName_ )
             {
@@ -1313,14 +1515,13 @@ void Helper
 {
     EL_DEBUG_CSE
 
-    // TODO(poulson): Consider loading on a single process and then distributing
-    // the results instead.
-
     if( compressed )
         LogicError("Compressed MPS is not yet supported");
 
+    // The file is only read from disk by the root process.
     MPSReader reader
-      ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound );
+      ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound,
+        problem.A.Grid().Comm() );
     const MPSMeta& meta = reader.Meta();
     if( metadataSummary && problem.A.Grid().Rank() == 0 )
         meta.PrintSummary();
@@ -1405,8 +1606,16 @@ void Helper
     if( compressed )
         LogicError("Compressed MPS is not yet supported");
 
+    // Rather than having each process parse the entire model and keep its
+    // local entries, the file is read from disk by the root process, the
+    // COLUMNS section is parsed in disjoint pieces by each process, and the
+    // resulting entries are sent to their owners in a single exchange per
+    // object.
+    const mpi::Comm comm = problem.A.Grid().Comm();
+    const bool distributeColumns = true;
     MPSReader reader
-      ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound );
+      ( filename, compressed, minimize, keepNonnegativeWithZeroUpperBound,
+        comm, distributeColumns );
     const MPSMeta& meta = reader.Meta();
     if( metadataSummary && problem.A.Grid().Rank() == 0 )
         meta.PrintSummary();
@@ -1417,27 +1626,30 @@ void Helper
     Zeros( problem.G, meta.k, meta.n );
     Zeros( problem.h, meta.k, 1 );
 
-    bool passive=true;
-    problem.A.Reserve( meta.numEqualityEntries );
-    problem.G.Reserve( meta.numInequalityEntries );
+    const Int commSize = mpi::Size( comm );
+    const Int numLocalEqualityEntries = meta.numEqualityEntries / commSize;
+    const Int numLocalInequalityEntries = meta.numInequalityEntries / commSize;
+    problem.A.Reserve( numLocalEqualityEntries, numLocalEqualityEntries );
+    problem.G.Reserve( numLocalInequalityEntries, numLocalInequalityEntries );
     while( reader.QueuedEntry() )
     {
         const AffineLPEntry<double> entry = reader.GetEntry();
         if( entry.type == AFFINE_LP_COST_VECTOR )
-            problem.c.Set( entry.row, 0, entry.value );
+            problem.c.QueueUpdate( entry.row, 0, entry.value );
         else if( entry.type == AFFINE_LP_EQUALITY_MATRIX )
-            problem.A.QueueUpdate
-            ( entry.row, entry.column, entry.value, passive );
+            problem.A.QueueUpdate( entry.row, entry.column, entry.value );
         else if( entry.type == AFFINE_LP_EQUALITY_VECTOR )
-            problem.b.Set( entry.row, 0, entry.value );
+            problem.b.QueueUpdate( entry.row, 0, entry.value );
         else if( entry.type == AFFINE_LP_INEQUALITY_MATRIX )
-            problem.G.QueueUpdate
-            ( entry.row, entry.column, entry.value, passive );
+            problem.G.QueueUpdate( entry.row, entry.column, entry.value );
         else /* entry.type == AFFINE_LP_INEQUALITY_VECTOR */
-            problem.h.Set( entry.row, 0, entry.value );
+            problem.h.QueueUpdate( entry.row, 0, entry.value );
     }
-    problem.A.ProcessLocalQueues();
-    problem.G.ProcessLocalQueues();
+    problem.A.ProcessQueues();
+    problem.G.ProcessQueues();
+    problem.c.ProcessQueues();
+    problem.b.ProcessQueues();
+    problem.h.ProcessQueues();
 }
 
 } // namespace read_mps
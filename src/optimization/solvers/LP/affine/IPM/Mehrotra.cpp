@@ -450,6 +450,9 @@ void EquilibratedMehrotra
     Initialize
     ( problem, solution,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+    if( ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        pos_orth::WarmStartShift
+        ( solution.s, solution.z, ctrl.warmStartMinMu );
 
     Real relError = 1;
     Matrix<Real> J, d;
@@ -480,11 +483,14 @@ void EquilibratedMehrotra
         return true;
       };
 
-    AffineLPSolution<Matrix<Real>> affineCorrection, correction;
+    AffineLPSolution<Matrix<Real>> affineCorrection, correction,
+      trialCorrection;
     AffineLPResidual<Matrix<Real>> residual, error;
+    Timer gondzioTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        EL_REGION("lp::affine::Mehrotra iteration");
         // Ensure that s and z are in the cone
         // ===================================
         const Int sNumNonPos = pos_orth::NumOutside( solution.s );
@@ -589,10 +595,14 @@ void EquilibratedMehrotra
 
         // Solve for the direction
         // -----------------------
+        gondzioTimer.Start();
         if( !attemptToFactor() )
             break;
+        double factorTime = gondzioTimer.Stop();
+        gondzioTimer.Start();
         if( !attemptToSolve(d) )
             break;
+        double solveTime = gondzioTimer.Stop();
         ExpandSolution
         ( m, n, d, residual.dualConic, solution.s, solution.z,
           affineCorrection.x,
@@ -637,10 +647,10 @@ void EquilibratedMehrotra
 
         // Compute a centrality parameter
         // ==============================
-        Real alphaAffPri =
-          pos_orth::MaxStep( solution.s, affineCorrection.s, Real(1) );
-        Real alphaAffDual =
-          pos_orth::MaxStep( solution.z, affineCorrection.z, Real(1) );
+        Real alphaAffPri, alphaAffDual;
+        pos_orth::MaxSteps
+        ( solution.s, affineCorrection.s, solution.z, affineCorrection.z,
+          Real(1), alphaAffPri, alphaAffDual );
         if( ctrl.forceSameStep )
             alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
         if( ctrl.print )
@@ -690,14 +700,50 @@ void EquilibratedMehrotra
         ExpandSolution
         ( m, n, d, residual.dualConic, solution.s, solution.z,
           correction.x, correction.y, correction.z, correction.s );
+
+        // Apply Gondzio's multiple centrality correctors
+        // ----------------------------------------------
+        const Int numCorrs =
+          NumCentralityCorrectors( ctrl, factorTime, solveTime );
+        if( numCorrs > 0 )
+        {
+            auto solveTrial = [&]()
+              {
+                KKTRHS
+                ( residual.dualEquality,
+                  residual.primalEquality,
+                  residual.primalConic,
+                  residual.dualConic,
+                  solution.z, d );
+                if( !attemptToSolve(d) )
+                    return false;
+                ExpandSolution
+                ( m, n, d, residual.dualConic, solution.s, solution.z,
+                  trialCorrection.x, trialCorrection.y,
+                  trialCorrection.z, trialCorrection.s );
+                return true;
+              };
+            auto acceptTrial = [&]() { correction = trialCorrection; };
+            const Int numAccepted =
+              CentralityCorrectors
+              ( ctrl, numCorrs, sigma*mu,
+                solution.s, solution.z,
+                correction.s, correction.z,
+                trialCorrection.s, trialCorrection.z,
+                residual.dualConic, solveTrial, acceptTrial );
+            if( ctrl.print )
+                Output
+                ("Accepted ",numAccepted," of ",numCorrs,
+                 " centrality correctors");
+        }
         // TODO(poulson): Residual checks
 
         // Update the current estimates
         // ============================
-        Real alphaPri =
-          pos_orth::MaxStep( solution.s, correction.s, 1/ctrl.maxStepRatio );
-        Real alphaDual =
-          pos_orth::MaxStep( solution.z, correction.z, 1/ctrl.maxStepRatio );
+        Real alphaPri, alphaDual;
+        pos_orth::MaxSteps
+        ( solution.s, correction.s, solution.z, correction.z,
+          1/ctrl.maxStepRatio, alphaPri, alphaDual );
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
@@ -792,6 +838,9 @@ void EquilibratedMehrotra
     Initialize
     ( problem, solution,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+    if( ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        pos_orth::WarmStartShift
+        ( solution.s, solution.z, ctrl.warmStartMinMu );
 
     Real relError = 1;
     DistMatrix<Real> J(grid), d(grid);
@@ -823,15 +872,19 @@ void EquilibratedMehrotra
       };
 
     AffineLPResidual<DistMatrix<Real>> residual, error;
-    AffineLPSolution<DistMatrix<Real>> affineCorrection, correction;
+    AffineLPSolution<DistMatrix<Real>> affineCorrection, correction,
+      trialCorrection;
     ForceSimpleAlignments( residual, grid );
     ForceSimpleAlignments( error, grid );
     ForceSimpleAlignments( affineCorrection, grid );
     ForceSimpleAlignments( correction, grid );
+    ForceSimpleAlignments( trialCorrection, grid );
 
+    Timer gondzioTimer;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        EL_REGION("lp::affine::Mehrotra iteration");
         // Ensure that s and z are in the cone
         // ===================================
         const Int sNumNonPos = pos_orth::NumOutside( solution.s );
@@ -933,10 +986,14 @@ void EquilibratedMehrotra
           solution.z, d );
         // Solve for the proposed step
         // ---------------------------
+        gondzioTimer.Start();
         if( !attemptToFactor() )
             break;
+        double factorTime = gondzioTimer.Stop();
+        gondzioTimer.Start();
         if( !attemptToSolve(d) )
             break;
+        double solveTime = gondzioTimer.Stop();
         ExpandSolution
         ( m, n, d, residual.dualConic, solution.s, solution.z,
           affineCorrection.x,
@@ -982,10 +1039,10 @@ void EquilibratedMehrotra
 
         // Compute a centrality parameter
         // ==============================
-        Real alphaAffPri =
-          pos_orth::MaxStep( solution.s, affineCorrection.s, Real(1) );
-        Real alphaAffDual =
-          pos_orth::MaxStep( solution.z, affineCorrection.z, Real(1) );
+        Real alphaAffPri, alphaAffDual;
+        pos_orth::MaxSteps
+        ( solution.s, affineCorrection.s, solution.z, affineCorrection.z,
+          Real(1), alphaAffPri, alphaAffDual );
         if( ctrl.forceSameStep )
             alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
         if( ctrl.print && commRank == 0 )
@@ -1035,14 +1092,56 @@ void EquilibratedMehrotra
         ExpandSolution
         ( m, n, d, residual.dualConic, solution.s, solution.z,
           correction.x, correction.y, correction.z, correction.s );
+
+        // Apply Gondzio's multiple centrality correctors
+        // ----------------------------------------------
+        if( ctrl.maxGondzioCorrs > 0 )
+        {
+            // Ensure that every process attempts the same number
+            factorTime = mpi::AllReduce( factorTime, mpi::MAX, grid.Comm() );
+            solveTime = mpi::AllReduce( solveTime, mpi::MAX, grid.Comm() );
+        }
+        const Int numCorrs =
+          NumCentralityCorrectors( ctrl, factorTime, solveTime );
+        if( numCorrs > 0 )
+        {
+            auto solveTrial = [&]()
+              {
+                KKTRHS
+                ( residual.dualEquality,
+                  residual.primalEquality,
+                  residual.primalConic,
+                  residual.dualConic,
+                  solution.z, d );
+                if( !attemptToSolve(d) )
+                    return false;
+                ExpandSolution
+                ( m, n, d, residual.dualConic, solution.s, solution.z,
+                  trialCorrection.x, trialCorrection.y,
+                  trialCorrection.z, trialCorrection.s );
+                return true;
+              };
+            auto acceptTrial = [&]() { correction = trialCorrection; };
+            const Int numAccepted =
+              CentralityCorrectors
+              ( ctrl, numCorrs, sigma*mu,
+                solution.s, solution.z,
+                correction.s, correction.z,
+                trialCorrection.s, trialCorrection.z,
+                residual.dualConic, solveTrial, acceptTrial );
+            if( ctrl.print && commRank == 0 )
+                Output
+                ("Accepted ",numAccepted," of ",numCorrs,
+                 " centrality correctors");
+        }
         // TODO(poulson): Residual checks
 
         // Update the current estimates
         // ============================
-        Real alphaPri =
-          pos_orth::MaxStep( solution.s, correction.s, 1/ctrl.maxStepRatio );
-        Real alphaDual =
-          pos_orth::MaxStep( solution.z, correction.z, 1/ctrl.maxStepRatio );
+        Real alphaPri, alphaDual;
+        pos_orth::MaxSteps
+        ( solution.s, correction.s, solution.z, correction.z,
+          1/ctrl.maxStepRatio, alphaPri, alphaDual );
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
@@ -1181,12 +1280,33 @@ void EquilibratedMehrotra
     ( problem, solution, JStatic, regTmp,
       sparseLDLFact,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
+    if( ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        pos_orth::WarmStartShift
+        ( solution.s, solution.z, ctrl.warmStartMinMu );
 
     Int numIts = 0;
     Real relError = 1;
     Matrix<Real> dInner;
     SparseMatrix<Real> J, JOrig;
     Matrix<Real> d, w;
+
+    // The record of the current iteration for ctrl.iterationCallback
+    MehrotraIterationInfo<Real> info;
+    Timer iterationTimer, kktTimer, solveTimer;
+    const Real maxRegTmp = MaxNorm( regTmp );
+    auto finishIteration = [&]()
+      {
+        info.iterationTime = iterationTimer.Stop();
+        if( ctrl.iterationCallback )
+            ctrl.iterationCallback( info );
+      };
+
+    // An optional factorization of the KKT system in a lower precision
+    typedef Demote<Real> LowReal;
+    const bool lowerPrecision =
+      ctrl.lowerPrecisionFactor && !IsSame<LowReal,Real>::value;
+    SparseLDLFactorization<LowReal> lowLDLFact;
+    SparseMatrix<LowReal> JLow;
     auto attemptToFactor = [&]( const Real& wMaxNorm )
       {
         try
@@ -1198,7 +1318,21 @@ void EquilibratedMehrotra
             else
                 Ones( dInner, J.Height(), 1 );
 
-            if( numIts == 0 && ctrl.primalInit && ctrl.dualInit )
+            if( lowerPrecision )
+            {
+                Copy( J, JLow );
+                if( !lowLDLFact.Factored() )
+                {
+                    const bool hermitian = true;
+                    const BisectCtrl bisectCtrl;
+                    lowLDLFact.Initialize( JLow, hermitian, bisectCtrl );
+                }
+                else
+                {
+                    lowLDLFact.ChangeNonzeroValues( JLow );
+                }
+            }
+            else if( numIts == 0 && ctrl.primalInit && ctrl.dualInit )
             {
                 const bool hermitian = true;
                 const BisectCtrl bisectCtrl;
@@ -1208,7 +1342,10 @@ void EquilibratedMehrotra
             {
                 sparseLDLFact.ChangeNonzeroValues( J );
             }
-            sparseLDLFact.Factor();
+            if( lowerPrecision )
+                lowLDLFact.Factor();
+            else
+                sparseLDLFact.Factor();
         }
         catch(...)
         {
@@ -1223,15 +1360,27 @@ void EquilibratedMehrotra
       {
         try
         {
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
+            solveTimer.Start();
+            if( lowerPrecision && ctrl.resolveReg )
+                info.numRefineIts += reg_ldl::SolveAfter
+                ( JOrig, regTmp, dInner, lowLDLFact, rhs, ctrl.solveCtrl );
+            else if( lowerPrecision )
+                info.numRefineIts += reg_ldl::RegularizedSolveAfter
+                ( JOrig, regTmp, dInner, lowLDLFact, rhs,
+                  ctrl.solveCtrl.relTol,
+                  ctrl.solveCtrl.maxRefineIts,
+                  ctrl.solveCtrl.progress );
+            else if( ctrl.resolveReg )
+                info.numRefineIts += reg_ldl::SolveAfter
                 ( JOrig, regTmp, dInner, sparseLDLFact, rhs, ctrl.solveCtrl );
             else
-                reg_ldl::RegularizedSolveAfter
+                info.numRefineIts += reg_ldl::RegularizedSolveAfter
                 ( JOrig, regTmp, dInner, sparseLDLFact, rhs,
                   ctrl.solveCtrl.relTol,
                   ctrl.solveCtrl.maxRefineIts,
                   ctrl.solveCtrl.progress );
+            info.solveTime += solveTimer.Stop();
+            ++info.numSolves;
         }
         catch(...)
         {
@@ -1244,11 +1393,17 @@ void EquilibratedMehrotra
       };
 
     AffineLPResidual<Matrix<Real>> residual, error;
-    AffineLPSolution<Matrix<Real>> affineCorrection, correction;
+    AffineLPSolution<Matrix<Real>> affineCorrection, correction,
+      trialCorrection;
 
+    Timer gondzioTimer;
     const Int indent = PushIndent();
     for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        info = MehrotraIterationInfo<Real>();
+        info.numIts = numIts;
+        iterationTimer.Start();
+
         // Ensure that s and z are in the cone
         // ===================================
         const Int sNumNonPos = pos_orth::NumOutside( solution.s );
@@ -1335,8 +1490,14 @@ void EquilibratedMehrotra
              "  dual   = ",dualObj,"\n",Indent(),
              "  |primal - dual| / (1 + |primal|) = ",objConv);
         }
+        info.mu = mu;
+        info.relError = relError;
+        info.wMaxNorm = wMaxNorm;
         if( relError <= ctrl.targetTol )
+        {
+            finishIteration();
             break;
+        }
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -1352,6 +1513,7 @@ void EquilibratedMehrotra
 
         // Construct the KKT system
         // ------------------------
+        kktTimer.Start();
         JOrig = JStatic;
         JOrig.FreezeSparsity();
         FinishKKT( m, n, solution.s, solution.z, JOrig );
@@ -1364,13 +1526,24 @@ void EquilibratedMehrotra
         J = JOrig;
         J.FreezeSparsity();
         UpdateDiagonal( J, Real(1), regTmp );
+        info.kktTime = kktTimer.Stop();
+        info.kktHeight = J.Height();
+        info.kktNumEntries = JOrig.NumEntries();
+        info.maxRegTmp = maxRegTmp;
 
         // Solve for the direction
         // -----------------------
+        gondzioTimer.Start();
         if( !attemptToFactor(wMaxNorm) )
             break;
+        double factorTime = gondzioTimer.Stop();
+        info.factorTime = factorTime;
+        info.factorNumEntries =
+          lowerPrecision ? lowLDLFact.NumEntries() : sparseLDLFact.NumEntries();
+        gondzioTimer.Start();
         if( !attemptToSolve(d) )
             break;
+        double solveTime = gondzioTimer.Stop();
         ExpandSolution
         ( m, n, d, residual.dualConic, solution.s, solution.z,
           affineCorrection.x,
@@ -1417,10 +1590,10 @@ void EquilibratedMehrotra
 
         // Compute a centrality parameter
         // ==============================
-        Real alphaAffPri =
-          pos_orth::MaxStep( solution.s, affineCorrection.s, Real(1) );
-        Real alphaAffDual =
-          pos_orth::MaxStep( solution.z, affineCorrection.z, Real(1) );
+        Real alphaAffPri, alphaAffDual;
+        pos_orth::MaxSteps
+        ( solution.s, affineCorrection.s, solution.z, affineCorrection.z,
+          Real(1), alphaAffPri, alphaAffDual );
         if( ctrl.forceSameStep )
             alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
         if( ctrl.print )
@@ -1438,6 +1611,9 @@ void EquilibratedMehrotra
           ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print )
             Output("sigma=",sigma);
+        info.alphaAffPri = alphaAffPri;
+        info.alphaAffDual = alphaAffDual;
+        info.sigma = sigma;
 
         // Solve for the combined direction
         // ================================
@@ -1471,12 +1647,49 @@ void EquilibratedMehrotra
         ( m, n, d, residual.dualConic, solution.s, solution.z,
           correction.x, correction.y, correction.z, correction.s );
 
+        // Apply Gondzio's multiple centrality correctors
+        // ----------------------------------------------
+        const Int numCorrs =
+          NumCentralityCorrectors( ctrl, factorTime, solveTime );
+        if( numCorrs > 0 )
+        {
+            auto solveTrial = [&]()
+              {
+                KKTRHS
+                ( residual.dualEquality,
+                  residual.primalEquality,
+                  residual.primalConic,
+                  residual.dualConic,
+                  solution.z, d );
+                if( !attemptToSolve(d) )
+                    return false;
+                ExpandSolution
+                ( m, n, d, residual.dualConic, solution.s, solution.z,
+                  trialCorrection.x, trialCorrection.y,
+                  trialCorrection.z, trialCorrection.s );
+                return true;
+              };
+            auto acceptTrial = [&]() { correction = trialCorrection; };
+            const Int numAccepted =
+              CentralityCorrectors
+              ( ctrl, numCorrs, sigma*mu,
+                solution.s, solution.z,
+                correction.s, correction.z,
+                trialCorrection.s, trialCorrection.z,
+                residual.dualConic, solveTrial, acceptTrial );
+            info.numCorrectors = numAccepted;
+            if( ctrl.print )
+                Output
+                ("Accepted ",numAccepted," of ",numCorrs,
+                 " centrality correctors");
+        }
+
         // Update the current estimates
         // ============================
-        Real alphaPri =
-          pos_orth::MaxStep( solution.s, correction.s, 1/ctrl.maxStepRatio );
-        Real alphaDual =
-          pos_orth::MaxStep( solution.z, correction.z, 1/ctrl.maxStepRatio );
+        Real alphaPri, alphaDual;
+        pos_orth::MaxSteps
+        ( solution.s, correction.s, solution.z, correction.z,
+          1/ctrl.maxStepRatio, alphaPri, alphaDual );
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
@@ -1487,6 +1700,9 @@ void EquilibratedMehrotra
         Axpy( alphaPri,  correction.s, solution.s );
         Axpy( alphaDual, correction.y, solution.y );
         Axpy( alphaDual, correction.z, solution.z );
+        info.alphaPri = alphaPri;
+        info.alphaDual = alphaDual;
+        finishIteration();
         if( alphaPri == Real(0) && alphaDual == Real(0) )
         {
             if( relError <= ctrl.minTol )
@@ -1537,7 +1753,7 @@ void EquilibratedMehrotra
     const Int degree = k;
     const Grid& grid = problem.A.Grid();
     const int commRank = grid.Rank();
-    Timer timer;
+    Timer timer, gondzioTimer;
 
     const Real bNrm2 = Nrm2( problem.b );
     const Real cNrm2 = Nrm2( problem.c );
@@ -1597,6 +1813,9 @@ void EquilibratedMehrotra
     ( problem, solution, JStatic, regTmp,
       sparseLDLFact,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
+    if( ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        pos_orth::WarmStartShift
+        ( solution.s, solution.z, ctrl.warmStartMinMu );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
 
@@ -1604,6 +1823,24 @@ void EquilibratedMehrotra
     Real relError = 1;
     DistSparseMatrix<Real> J(grid), JOrig(grid);
     DistMultiVec<Real> d(grid), w(grid), dInner(grid);
+
+    // The record of the current iteration for ctrl.iterationCallback
+    MehrotraIterationInfo<Real> info;
+    Timer iterationTimer, kktTimer, solveTimer;
+    const Real maxRegTmp = MaxNorm( regTmp );
+    auto finishIteration = [&]()
+      {
+        info.iterationTime = iterationTimer.Stop();
+        if( ctrl.iterationCallback )
+            ctrl.iterationCallback( info );
+      };
+
+    // An optional factorization of the KKT system in a lower precision
+    typedef Demote<Real> LowReal;
+    const bool lowerPrecision =
+      ctrl.lowerPrecisionFactor && !IsSame<LowReal,Real>::value;
+    DistSparseLDLFactorization<LowReal> lowLDLFact;
+    DistSparseMatrix<LowReal> JLow(grid);
     auto attemptToFactor = [&]( const Real& wMaxNorm )
       {
         try
@@ -1619,7 +1856,21 @@ void EquilibratedMehrotra
             if( commRank == 0 && ctrl.time )
                 Output("Equilibration: ",timer.Stop()," secs");
 
-            if( numIts == 0 && ctrl.primalInit && ctrl.dualInit )
+            if( lowerPrecision )
+            {
+                Copy( J, JLow );
+                if( !lowLDLFact.Factored() )
+                {
+                    const bool hermitian = true;
+                    const BisectCtrl bisectCtrl;
+                    lowLDLFact.Initialize( JLow, hermitian, bisectCtrl );
+                }
+                else
+                {
+                    lowLDLFact.ChangeNonzeroValues( JLow );
+                }
+            }
+            else if( numIts == 0 && ctrl.primalInit && ctrl.dualInit )
             {
                 const bool hermitian = true;
                 const BisectCtrl bisectCtrl;
@@ -1632,7 +1883,10 @@ void EquilibratedMehrotra
 
             if( commRank == 0 && ctrl.time )
                 timer.Start();
-            sparseLDLFact.Factor( LDL_2D );
+            if( lowerPrecision )
+                lowLDLFact.Factor( LDL_2D );
+            else
+                sparseLDLFact.Factor( LDL_2D );
             if( commRank == 0 && ctrl.time )
                 Output("LDL: ",timer.Stop()," secs");
         }
@@ -1651,15 +1905,27 @@ void EquilibratedMehrotra
         {
             if( commRank == 0 && ctrl.time )
                 timer.Start();
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
+            solveTimer.Start();
+            if( lowerPrecision && ctrl.resolveReg )
+                info.numRefineIts += reg_ldl::SolveAfter
+                ( JOrig, regTmp, dInner, lowLDLFact, rhs, ctrl.solveCtrl );
+            else if( lowerPrecision )
+                info.numRefineIts += reg_ldl::RegularizedSolveAfter
+                ( JOrig, regTmp, dInner, lowLDLFact, rhs,
+                  ctrl.solveCtrl.relTol,
+                  ctrl.solveCtrl.maxRefineIts,
+                  ctrl.solveCtrl.progress );
+            else if( ctrl.resolveReg )
+                info.numRefineIts += reg_ldl::SolveAfter
                 ( JOrig, regTmp, dInner, sparseLDLFact, rhs, ctrl.solveCtrl );
             else
-                reg_ldl::RegularizedSolveAfter
+                info.numRefineIts += reg_ldl::RegularizedSolveAfter
                 ( JOrig, regTmp, dInner, sparseLDLFact, rhs,
                   ctrl.solveCtrl.relTol,
                   ctrl.solveCtrl.maxRefineIts,
                   ctrl.solveCtrl.progress );
+            info.solveTime += solveTimer.Stop();
+            ++info.numSolves;
             if( commRank == 0 && ctrl.time )
                 Output("Affine: ",timer.Stop()," secs");
         }
@@ -1674,16 +1940,22 @@ void EquilibratedMehrotra
       };
 
     AffineLPResidual<DistMultiVec<Real>> residual, error;
-    AffineLPSolution<DistMultiVec<Real>> affineCorrection, correction;
+    AffineLPSolution<DistMultiVec<Real>> affineCorrection, correction,
+      trialCorrection;
 
     ForceSimpleAlignments( residual, grid );
     ForceSimpleAlignments( error, grid );
     ForceSimpleAlignments( affineCorrection, grid );
     ForceSimpleAlignments( correction, grid );
+    ForceSimpleAlignments( trialCorrection, grid );
 
     const Int indent = PushIndent();
     for( ; numIts<=ctrl.maxIts; ++numIts )
     {
+        info = MehrotraIterationInfo<Real>();
+        info.numIts = numIts;
+        iterationTimer.Start();
+
         // Ensure that s and z are in the cone
         // ===================================
         const Int sNumNonPos = pos_orth::NumOutside( solution.s );
@@ -1771,8 +2043,14 @@ void EquilibratedMehrotra
                  "  dual   = ",dualObj,"\n",Indent(),
                  "  |primal - dual| / (1 + |primal|) = ",objConv);
         }
+        info.mu = mu;
+        info.relError = relError;
+        info.wMaxNorm = wMaxNorm;
         if( relError <= ctrl.targetTol )
+        {
+            finishIteration();
             break;
+        }
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -1788,6 +2066,7 @@ void EquilibratedMehrotra
 
         // Construct the KKT system
         // ------------------------
+        kktTimer.Start();
         JOrig = JStatic;
         JOrig.FreezeSparsity();
         JOrig.LockedDistGraph().multMeta = JStatic.LockedDistGraph().multMeta;
@@ -1802,13 +2081,29 @@ void EquilibratedMehrotra
         J.FreezeSparsity();
         J.LockedDistGraph().multMeta = JStatic.LockedDistGraph().multMeta;
         UpdateDiagonal( J, Real(1), regTmp );
+        info.kktTime = kktTimer.Stop();
+        info.kktHeight = J.Height();
+        info.maxRegTmp = maxRegTmp;
+        if( ctrl.iterationCallback )
+            info.kktNumEntries = JOrig.NumEntries();
 
         // Solve for the direction
         // -----------------------
+        gondzioTimer.Start();
         if( !attemptToFactor(wMaxNorm) )
             break;
+        double factorTime = gondzioTimer.Stop();
+        info.factorTime = factorTime;
+        if( ctrl.iterationCallback )
+            info.factorNumEntries =
+              mpi::AllReduce
+              ( lowerPrecision ? lowLDLFact.NumLocalEntries()
+                               : sparseLDLFact.NumLocalEntries(),
+                grid.Comm() );
+        gondzioTimer.Start();
         if( !attemptToSolve(d) )
             break;
+        double solveTime = gondzioTimer.Stop();
         ExpandSolution
         ( m, n, d, residual.dualConic, solution.s, solution.z,
           affineCorrection.x,
@@ -1856,10 +2151,10 @@ void EquilibratedMehrotra
 
         // Compute a centrality parameter
         // ==============================
-        Real alphaAffPri =
-          pos_orth::MaxStep( solution.s, affineCorrection.s, Real(1) );
-        Real alphaAffDual =
-          pos_orth::MaxStep( solution.z, affineCorrection.z, Real(1) );
+        Real alphaAffPri, alphaAffDual;
+        pos_orth::MaxSteps
+        ( solution.s, affineCorrection.s, solution.z, affineCorrection.z,
+          Real(1), alphaAffPri, alphaAffDual );
         if( ctrl.forceSameStep )
             alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
         if( ctrl.print && commRank == 0 )
@@ -1877,6 +2172,9 @@ void EquilibratedMehrotra
           ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print && commRank == 0 )
             Output("sigma=",sigma);
+        info.alphaAffPri = alphaAffPri;
+        info.alphaAffDual = alphaAffDual;
+        info.sigma = sigma;
 
         // Solve for the combined direction
         // ================================
@@ -1910,12 +2208,55 @@ void EquilibratedMehrotra
         ( m, n, d, residual.dualConic, solution.s, solution.z,
           correction.x, correction.y, correction.z, correction.s );
 
+        // Apply Gondzio's multiple centrality correctors
+        // ----------------------------------------------
+        if( ctrl.maxGondzioCorrs > 0 )
+        {
+            // Ensure that every process attempts the same number
+            factorTime = mpi::AllReduce( factorTime, mpi::MAX, grid.Comm() );
+            solveTime = mpi::AllReduce( solveTime, mpi::MAX, grid.Comm() );
+        }
+        const Int numCorrs =
+          NumCentralityCorrectors( ctrl, factorTime, solveTime );
+        if( numCorrs > 0 )
+        {
+            auto solveTrial = [&]()
+              {
+                KKTRHS
+                ( residual.dualEquality,
+                  residual.primalEquality,
+                  residual.primalConic,
+                  residual.dualConic,
+                  solution.z, d );
+                if( !attemptToSolve(d) )
+                    return false;
+                ExpandSolution
+                ( m, n, d, residual.dualConic, solution.s, solution.z,
+                  trialCorrection.x, trialCorrection.y,
+                  trialCorrection.z, trialCorrection.s );
+                return true;
+              };
+            auto acceptTrial = [&]() { correction = trialCorrection; };
+            const Int numAccepted =
+              CentralityCorrectors
+              ( ctrl, numCorrs, sigma*mu,
+                solution.s, solution.z,
+                correction.s, correction.z,
+                trialCorrection.s, trialCorrection.z,
+                residual.dualConic, solveTrial, acceptTrial );
+            info.numCorrectors = numAccepted;
+            if( ctrl.print && commRank == 0 )
+                Output
+                ("Accepted ",numAccepted," of ",numCorrs,
+                 " centrality correctors");
+        }
+
         // Update the current estimates
         // ============================
-        Real alphaPri =
-          pos_orth::MaxStep( solution.s, correction.s, 1/ctrl.maxStepRatio );
-        Real alphaDual =
-          pos_orth::MaxStep( solution.z, correction.z, 1/ctrl.maxStepRatio );
+        Real alphaPri, alphaDual;
+        pos_orth::MaxSteps
+        ( solution.s, correction.s, solution.z, correction.z,
+          1/ctrl.maxStepRatio, alphaPri, alphaDual );
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
@@ -1926,6 +2267,9 @@ void EquilibratedMehrotra
         Axpy( alphaPri,  correction.s, solution.s );
         Axpy( alphaDual, correction.y, solution.y );
         Axpy( alphaDual, correction.z, solution.z );
+        info.alphaPri = alphaPri;
+        info.alphaDual = alphaDual;
+        finishIteration();
         if( alphaPri == Real(0) && alphaDual == Real(0) )
         {
             if( relError <= ctrl.minTol )
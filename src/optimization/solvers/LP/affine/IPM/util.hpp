@@ -104,6 +104,8 @@ using qp::affine::FinishKKT;
 using qp::affine::KKTRHS;
 using qp::affine::ExpandCoreSolution;
 using qp::affine::ExpandSolution;
+using qp::affine::NumCentralityCorrectors;
+using qp::affine::CentralityCorrectors;
 
 } // namespace affine
 } // namespace lp
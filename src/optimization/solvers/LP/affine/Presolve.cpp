@@ -0,0 +1,808 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+// The presolve repeatedly applies the following standard reductions to the
+// affine LP
+//
+//   min c^T x, s.t. A x = b, G x + s = h, s >= 0,
+//
+// until none of them apply:
+//
+//  1) Empty equalities are removed (or infeasibility is detected).
+//  2) Singleton equalities, a x_j = beta, fix x_j := beta / a.
+//  3) Empty inequalities are removed (or infeasibility is detected).
+//  4) Of the singleton inequalities (i.e., bounds) involving the same
+//     variable and of the same sign, all but the tightest are dominated and
+//     removed.
+//  5) A variable whose tightest lower and upper bounds coincide is fixed.
+//  6) A variable which no longer appears in any constraint is fixed at zero
+//     if it has a zero cost (otherwise the LP is unbounded or infeasible).
+//  7) Equalities which are multiples of another equality are removed (or
+//     infeasibility is detected), and inequalities which are positive
+//     multiples of another inequality are removed if they are dominated.
+//
+// Removed constraints are assigned zero dual variables during the postsolve,
+// with the exception of those which were eliminated along with a fixed
+// variable, whose dual variables are chosen (in the reverse of the order in
+// which the variables were fixed) so that the dual equality
+// A^T y + G^T z + c = 0 holds for the fixed variable.
+
+namespace El {
+namespace lp {
+namespace affine {
+
+namespace presolve {
+
+// A column-major copy of the structure and values of a sparse matrix
+template<typename Real>
+struct ColumnLists
+{
+    vector<Int> offsets, rows;
+    vector<Real> values;
+
+    Int Offset( Int j ) const { return offsets[j]; }
+    Int NumConnections( Int j ) const { return offsets[j+1]-offsets[j]; }
+};
+
+template<typename Real>
+void FormColumnLists( const SparseMatrix<Real>& A, ColumnLists<Real>& lists )
+{
+    EL_DEBUG_CSE
+    const Int n = A.Width();
+    const Int numEntries = A.NumEntries();
+    lists.offsets.assign( n+1, 0 );
+    for( Int e=0; e<numEntries; ++e )
+        ++lists.offsets[A.Col(e)+1];
+    for( Int j=0; j<n; ++j )
+        lists.offsets[j+1] += lists.offsets[j];
+    lists.rows.resize( numEntries );
+    FastResize( lists.values, numEntries );
+    vector<Int> next( lists.offsets.begin(), lists.offsets.end()-1 );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        const Int j = A.Col(e);
+        lists.rows[next[j]] = A.Row(e);
+        lists.values[next[j]] = A.Value(e);
+        ++next[j];
+    }
+}
+
+// The active portion of the problem as it is reduced
+template<typename Real>
+struct State
+{
+    const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem;
+    PresolveInfo<Real>& info;
+    Real tol;
+
+    ColumnLists<Real> AColumns, GColumns;
+    vector<bool> activeVar, activeEq, activeIneq;
+    vector<Int> varCount, eqCount, ineqCount;
+    vector<Real> b, h;
+
+    State
+    ( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problemIn,
+      PresolveInfo<Real>& infoIn )
+    : problem(problemIn), info(infoIn)
+    {
+        const auto& A = problem.A;
+        const auto& G = problem.G;
+        const Int n = problem.c.Height();
+        const Int mA = A.Height();
+        const Int mG = G.Height();
+        tol = Sqrt(limits::Epsilon<Real>());
+
+        FormColumnLists( A, AColumns );
+        FormColumnLists( G, GColumns );
+        activeVar.assign( n, true );
+        activeEq.assign( mA, true );
+        activeIneq.assign( mG, true );
+
+        varCount.resize( n );
+        for( Int j=0; j<n; ++j )
+            varCount[j] =
+              AColumns.NumConnections(j) + GColumns.NumConnections(j);
+        eqCount.resize( mA );
+        FastResize( b, mA );
+        for( Int i=0; i<mA; ++i )
+        {
+            eqCount[i] = A.NumConnections(i);
+            b[i] = problem.b(i);
+        }
+        ineqCount.resize( mG );
+        FastResize( h, mG );
+        for( Int i=0; i<mG; ++i )
+        {
+            ineqCount[i] = G.NumConnections(i);
+            h[i] = problem.h(i);
+        }
+    }
+
+    // Return the index of the (first) entry of row i of M involving an
+    // active variable
+    Int ActiveEntry( const SparseMatrix<Real>& M, Int i ) const
+    {
+        const Int offset = M.RowOffset(i);
+        const Int numConn = M.NumConnections(i);
+        for( Int e=offset; e<offset+numConn; ++e )
+            if( activeVar[M.Col(e)] )
+                return e;
+        return -1;
+    }
+
+    void RemoveEquality( Int i )
+    {
+        const auto& A = problem.A;
+        activeEq[i] = false;
+        const Int offset = A.RowOffset(i);
+        const Int numConn = A.NumConnections(i);
+        for( Int e=offset; e<offset+numConn; ++e )
+            if( activeVar[A.Col(e)] )
+                --varCount[A.Col(e)];
+    }
+
+    void RemoveInequality( Int i )
+    {
+        const auto& G = problem.G;
+        activeIneq[i] = false;
+        const Int offset = G.RowOffset(i);
+        const Int numConn = G.NumConnections(i);
+        for( Int e=offset; e<offset+numConn; ++e )
+            if( activeVar[G.Col(e)] )
+                --varCount[G.Col(e)];
+    }
+
+    void FixVariable( const PresolveFixing<Real>& fixing )
+    {
+        const Int j = fixing.variable;
+        const Real value = fixing.value;
+        activeVar[j] = false;
+        const Int AOffset = AColumns.Offset(j);
+        for( Int e=AOffset; e<AOffset+AColumns.NumConnections(j); ++e )
+        {
+            const Int i = AColumns.rows[e];
+            if( activeEq[i] )
+            {
+                b[i] -= AColumns.values[e]*value;
+                --eqCount[i];
+            }
+        }
+        const Int GOffset = GColumns.Offset(j);
+        for( Int e=GOffset; e<GOffset+GColumns.NumConnections(j); ++e )
+        {
+            const Int i = GColumns.rows[e];
+            if( activeIneq[i] )
+            {
+                h[i] -= GColumns.values[e]*value;
+                --ineqCount[i];
+            }
+        }
+        if( fixing.equality >= 0 )
+            RemoveEquality( fixing.equality );
+        if( fixing.lowerInequality >= 0 )
+            RemoveInequality( fixing.lowerInequality );
+        if( fixing.upperInequality >= 0 )
+            RemoveInequality( fixing.upperInequality );
+        info.fixings.push_back( fixing );
+    }
+
+    bool Negligible( const Real& alpha, const Real& scale ) const
+    { return Abs(alpha) <= tol*Max(Real(1),Abs(scale)); }
+};
+
+// Find rows of M which are nonzero multiples of each other (over the active
+// variables). The first of each such group of rows is the representative,
+// and each other row i is returned alongside its representative k and the
+// ratio of row i to row k.
+template<typename Real>
+void FindParallelRows
+( const State<Real>& state,
+  const SparseMatrix<Real>& M,
+  const vector<bool>& activeRows,
+  const vector<Int>& rowCounts,
+  vector<Int>& duplicates,
+  vector<Int>& representatives,
+  vector<Real>& ratios )
+{
+    EL_DEBUG_CSE
+    duplicates.resize( 0 );
+    representatives.resize( 0 );
+    ratios.resize( 0 );
+
+    std::map<vector<Int>,vector<Int>> patternRows;
+    vector<Int> pattern;
+    const Int m = M.Height();
+    for( Int i=0; i<m; ++i )
+    {
+        if( !activeRows[i] || rowCounts[i] < 2 )
+            continue;
+        pattern.resize( 0 );
+        const Int offset = M.RowOffset(i);
+        const Int numConn = M.NumConnections(i);
+        for( Int e=offset; e<offset+numConn; ++e )
+            if( state.activeVar[M.Col(e)] )
+                pattern.push_back( M.Col(e) );
+        patternRows[pattern].push_back( i );
+    }
+
+    vector<Real> values, repValues;
+    auto activeValues =
+      [&]( Int i, vector<Real>& rowValues )
+      {
+          rowValues.resize( 0 );
+          const Int offset = M.RowOffset(i);
+          const Int numConn = M.NumConnections(i);
+          for( Int e=offset; e<offset+numConn; ++e )
+              if( state.activeVar[M.Col(e)] )
+                  rowValues.push_back( M.Value(e) );
+      };
+    for( const auto& entry : patternRows )
+    {
+        const auto& rows = entry.second;
+        if( rows.size() < 2 )
+            continue;
+        vector<bool> matched( rows.size(), false );
+        for( Int s=0; s<Int(rows.size()); ++s )
+        {
+            if( matched[s] )
+                continue;
+            const Int k = rows[s];
+            activeValues( k, repValues );
+            if( repValues[0] == Real(0) )
+                continue;
+            for( Int t=s+1; t<Int(rows.size()); ++t )
+            {
+                if( matched[t] )
+                    continue;
+                const Int i = rows[t];
+                activeValues( i, values );
+                const Real ratio = values[0] / repValues[0];
+                if( ratio == Real(0) )
+                    continue;
+                bool parallel = true;
+                for( Int l=1; l<Int(values.size()); ++l )
+                {
+                    if( !state.Negligible
+                        ( values[l]-ratio*repValues[l], values[l] ) )
+                    {
+                        parallel = false;
+                        break;
+                    }
+                }
+                if( parallel )
+                {
+                    matched[t] = true;
+                    duplicates.push_back( i );
+                    representatives.push_back( k );
+                    ratios.push_back( ratio );
+                }
+            }
+        }
+    }
+}
+
+// Distribute a vector stored on the root process (which is assumed to be of
+// the given height)
+template<typename Real>
+void ScatterFromRoot
+( const Matrix<Real>& x, DistMultiVec<Real>& xDist, Int height,
+  const Grid& grid, int root=0 )
+{
+    EL_DEBUG_CSE
+    xDist.SetGrid( grid );
+    Zeros( xDist, height, 1 );
+    if( grid.Rank() == root )
+    {
+        xDist.Reserve( height );
+        for( Int i=0; i<height; ++i )
+            xDist.QueueUpdate( i, 0, x(i) );
+    }
+    xDist.ProcessQueues();
+}
+
+} // namespace presolve
+
+template<typename Real>
+void Presolve
+( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem,
+        AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& reducedProblem,
+        PresolveInfo<Real>& info,
+  bool progress )
+{
+    EL_DEBUG_CSE
+    const auto& A = problem.A;
+    const auto& G = problem.G;
+    const Int n = problem.c.Height();
+    const Int mA = A.Height();
+    const Int mG = G.Height();
+    if( A.Width() != n || G.Width() != n )
+        LogicError("A and G must have as many columns as c has rows");
+    if( problem.b.Height() != mA || problem.h.Height() != mG )
+        LogicError("b and h must be conformal with A and G");
+
+    info.fixings.resize( 0 );
+    info.original = problem;
+    presolve::State<Real> state( problem, info );
+
+    Int numEmptyEqs=0, numEmptyIneqs=0, numDominated=0,
+        numParallelEqs=0, numParallelIneqs=0;
+    vector<Int> lowerIneq, upperIneq;
+    vector<Real> lowerCoef, upperCoef;
+    vector<Int> duplicates, representatives;
+    vector<Real> ratios;
+    bool changed = true;
+    while( changed )
+    {
+        changed = false;
+
+        // Empty and singleton equalities
+        for( Int i=0; i<mA; ++i )
+        {
+            if( !state.activeEq[i] || state.eqCount[i] > 1 )
+                continue;
+            const Int e = state.ActiveEntry( A, i );
+            if( e < 0 || A.Value(e) == Real(0) )
+            {
+                // Any remaining entries are explicit zeros
+                if( !state.Negligible( state.b[i], problem.b(i) ) )
+                    RuntimeError
+                    ("Presolve detected primal infeasibility (equality ",i,
+                     " is empty but has a nonzero right-hand side)");
+                state.RemoveEquality( i );
+                ++numEmptyEqs;
+            }
+            else
+            {
+                PresolveFixing<Real> fixing;
+                fixing.variable = A.Col(e);
+                fixing.value = state.b[i] / A.Value(e);
+                fixing.equality = i;
+                fixing.equalityCoef = A.Value(e);
+                state.FixVariable( fixing );
+            }
+            changed = true;
+        }
+
+        // Empty inequalities and bounds
+        lowerIneq.assign( n, -1 );
+        upperIneq.assign( n, -1 );
+        FastResize( lowerCoef, n );
+        FastResize( upperCoef, n );
+        for( Int i=0; i<mG; ++i )
+        {
+            if( !state.activeIneq[i] || state.ineqCount[i] > 1 )
+                continue;
+            const Int e = state.ActiveEntry( G, i );
+            if( e < 0 || G.Value(e) == Real(0) )
+            {
+                if( state.h[i] < Real(0) &&
+                    !state.Negligible( state.h[i], problem.h(i) ) )
+                    RuntimeError
+                    ("Presolve detected primal infeasibility (inequality ",i,
+                     " is empty but has a negative right-hand side)");
+                state.RemoveInequality( i );
+                ++numEmptyIneqs;
+                changed = true;
+                continue;
+            }
+            const Int j = G.Col(e);
+            const Real gamma = G.Value(e);
+            const Real bound = state.h[i] / gamma;
+            auto& bestIneq = ( gamma > Real(0) ? upperIneq[j] : lowerIneq[j] );
+            auto& bestCoef = ( gamma > Real(0) ? upperCoef[j] : lowerCoef[j] );
+            if( bestIneq < 0 )
+            {
+                bestIneq = i;
+                bestCoef = gamma;
+                continue;
+            }
+            const Real bestBound = state.h[bestIneq] / bestCoef;
+            const bool tighter =
+              ( gamma > Real(0) ? bound < bestBound : bound > bestBound );
+            if( tighter )
+            {
+                state.RemoveInequality( bestIneq );
+                bestIneq = i;
+                bestCoef = gamma;
+            }
+            else
+            {
+                state.RemoveInequality( i );
+            }
+            ++numDominated;
+            changed = true;
+        }
+
+        // Variables whose lower and upper bounds coincide
+        for( Int j=0; j<n; ++j )
+        {
+            if( !state.activeVar[j] || lowerIneq[j] < 0 || upperIneq[j] < 0 )
+                continue;
+            const Real lower = state.h[lowerIneq[j]] / lowerCoef[j];
+            const Real upper = state.h[upperIneq[j]] / upperCoef[j];
+            if( lower > upper && !state.Negligible( lower-upper, upper ) )
+                RuntimeError
+                ("Presolve detected primal infeasibility (the lower bound of ",
+                 lower," on variable ",j," exceeds its upper bound of ",
+                 upper,")");
+            if( state.Negligible( upper-lower, upper ) )
+            {
+                PresolveFixing<Real> fixing;
+                fixing.variable = j;
+                fixing.value = upper;
+                fixing.lowerInequality = lowerIneq[j];
+                fixing.lowerCoef = lowerCoef[j];
+                fixing.upperInequality = upperIneq[j];
+                fixing.upperCoef = upperCoef[j];
+                state.FixVariable( fixing );
+                changed = true;
+            }
+        }
+
+        // Variables which no longer appear in any constraint
+        for( Int j=0; j<n; ++j )
+        {
+            if( !state.activeVar[j] || state.varCount[j] > 0 )
+                continue;
+            if( problem.c(j) != Real(0) )
+                RuntimeError
+                ("Presolve detected that the LP is unbounded or infeasible ",
+                 "(variable ",j," is unconstrained but has a nonzero cost)");
+            PresolveFixing<Real> fixing;
+            fixing.variable = j;
+            fixing.value = 0;
+            state.FixVariable( fixing );
+            changed = true;
+        }
+        if( changed )
+            continue;
+
+        // Parallel equalities
+        presolve::FindParallelRows
+        ( state, A, state.activeEq, state.eqCount,
+          duplicates, representatives, ratios );
+        for( Int l=0; l<Int(duplicates.size()); ++l )
+        {
+            const Int i = duplicates[l];
+            const Real beta = ratios[l]*state.b[representatives[l]];
+            if( !state.Negligible( state.b[i]-beta, state.b[i] ) )
+                RuntimeError
+                ("Presolve detected primal infeasibility (equalities ",
+                 representatives[l]," and ",i," are inconsistent)");
+            state.RemoveEquality( i );
+            ++numParallelEqs;
+            changed = true;
+        }
+
+        // Dominated parallel inequalities
+        presolve::FindParallelRows
+        ( state, G, state.activeIneq, state.ineqCount,
+          duplicates, representatives, ratios );
+        for( Int l=0; l<Int(duplicates.size()); ++l )
+        {
+            const Int i = duplicates[l];
+            const Int k = representatives[l];
+            if( ratios[l] < Real(0) || !state.activeIneq[k] )
+                continue;
+            // Row i is ratio times row k, and so row k implies
+            // G(i,:) x <= ratio h(k)
+            if( state.h[i] >= ratios[l]*state.h[k] )
+                state.RemoveInequality( i );
+            else
+                state.RemoveInequality( k );
+            ++numParallelIneqs;
+            changed = true;
+        }
+    }
+
+    // Form the reduced problem
+    // ========================
+    vector<Int> newVar( n, -1 ), newEq( mA, -1 ), newIneq( mG, -1 );
+    info.keptVariables.resize( 0 );
+    info.keptEqualities.resize( 0 );
+    info.keptInequalities.resize( 0 );
+    for( Int j=0; j<n; ++j )
+    {
+        if( state.activeVar[j] )
+        {
+            newVar[j] = info.keptVariables.size();
+            info.keptVariables.push_back( j );
+        }
+    }
+    for( Int i=0; i<mA; ++i )
+    {
+        if( state.activeEq[i] )
+        {
+            newEq[i] = info.keptEqualities.size();
+            info.keptEqualities.push_back( i );
+        }
+    }
+    for( Int i=0; i<mG; ++i )
+    {
+        if( state.activeIneq[i] )
+        {
+            newIneq[i] = info.keptInequalities.size();
+            info.keptInequalities.push_back( i );
+        }
+    }
+    const Int nRed = info.keptVariables.size();
+    const Int mARed = info.keptEqualities.size();
+    const Int mGRed = info.keptInequalities.size();
+
+    Zeros( reducedProblem.c, nRed, 1 );
+    for( Int j=0; j<nRed; ++j )
+        reducedProblem.c(j) = problem.c(info.keptVariables[j]);
+
+    auto formReduced =
+      [&]( const SparseMatrix<Real>& M,
+           const vector<Int>& keptRows,
+           const vector<Real>& rhs,
+           SparseMatrix<Real>& MRed,
+           Matrix<Real>& rhsRed )
+      {
+          const Int mRed = keptRows.size();
+          Zeros( MRed, mRed, nRed );
+          Zeros( rhsRed, mRed, 1 );
+          Int numEntries = 0;
+          for( Int iRed=0; iRed<mRed; ++iRed )
+              numEntries += M.NumConnections(keptRows[iRed]);
+          MRed.Reserve( numEntries );
+          for( Int iRed=0; iRed<mRed; ++iRed )
+          {
+              const Int i = keptRows[iRed];
+              rhsRed(iRed) = rhs[i];
+              const Int offset = M.RowOffset(i);
+              const Int numConn = M.NumConnections(i);
+              for( Int e=offset; e<offset+numConn; ++e )
+              {
+                  const Int j = M.Col(e);
+                  if( state.activeVar[j] )
+                      MRed.QueueUpdate( iRed, newVar[j], M.Value(e) );
+              }
+          }
+          MRed.ProcessQueues();
+      };
+    formReduced
+    ( A, info.keptEqualities, state.b, reducedProblem.A, reducedProblem.b );
+    formReduced
+    ( G, info.keptInequalities, state.h, reducedProblem.G, reducedProblem.h );
+
+    if( progress )
+        Output
+        ("Presolve reduced the LP from ",n," variables, ",mA," equalities, "
+         "and ",mG," inequalities to ",nRed," variables, ",mARed,
+         " equalities, and ",mGRed," inequalities: ",info.fixings.size(),
+         " variables were fixed, ",numEmptyEqs," empty and ",numParallelEqs,
+         " parallel equalities were removed, and ",numEmptyIneqs," empty, ",
+         numDominated," dominated bound, and ",numParallelIneqs,
+         " dominated parallel inequalities were removed");
+}
+
+template<typename Real>
+void Presolve
+( const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
+        AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>&
+          reducedProblem,
+        PresolveInfo<Real>& info,
+  bool progress )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = problem.A.Grid();
+    const int root = 0;
+    const bool isRoot = ( grid.Rank() == root );
+
+    // Gather the problem onto the root process, presolve it there, and then
+    // distribute the reduced problem
+    AffineLPProblem<SparseMatrix<Real>,Matrix<Real>> seqProblem, seqReduced;
+    if( isRoot )
+    {
+        CopyFromRoot( problem.c, seqProblem.c );
+        CopyFromRoot( problem.A, seqProblem.A );
+        CopyFromRoot( problem.b, seqProblem.b );
+        CopyFromRoot( problem.G, seqProblem.G );
+        CopyFromRoot( problem.h, seqProblem.h );
+    }
+    else
+    {
+        CopyFromNonRoot( problem.c, root );
+        CopyFromNonRoot( problem.A, root );
+        CopyFromNonRoot( problem.b, root );
+        CopyFromNonRoot( problem.G, root );
+        CopyFromNonRoot( problem.h, root );
+    }
+
+    // Since an infeasibility is only detected on the root, its message is
+    // broadcast so that every process can throw
+    string errorMsg;
+    Int dims[3] = { 0, 0, 0 };
+    if( isRoot )
+    {
+        try
+        {
+            Presolve( seqProblem, seqReduced, info, progress );
+            dims[0] = seqReduced.c.Height();
+            dims[1] = seqReduced.A.Height();
+            dims[2] = seqReduced.G.Height();
+        }
+        catch( std::exception& e ) { errorMsg = e.what(); }
+    }
+    Int errorLength = errorMsg.size();
+    mpi::Broadcast( errorLength, root, grid.Comm() );
+    if( errorLength > 0 )
+    {
+        errorMsg.resize( errorLength );
+        mpi::Broadcast
+        ( reinterpret_cast<byte*>(&errorMsg[0]), errorLength, root,
+          grid.Comm() );
+        RuntimeError(errorMsg);
+    }
+    mpi::Broadcast( dims, 3, root, grid.Comm() );
+
+    auto scatterMatrix =
+      [&]( const SparseMatrix<Real>& M, DistSparseMatrix<Real>& MDist,
+           Int height, Int width )
+      {
+          MDist.SetGrid( grid );
+          Zeros( MDist, height, width );
+          if( isRoot )
+          {
+              const Int numEntries = M.NumEntries();
+              MDist.Reserve( numEntries, numEntries );
+              for( Int e=0; e<numEntries; ++e )
+                  MDist.QueueUpdate( M.Row(e), M.Col(e), M.Value(e) );
+          }
+          MDist.ProcessQueues();
+      };
+    presolve::ScatterFromRoot( seqReduced.c, reducedProblem.c, dims[0], grid );
+    scatterMatrix( seqReduced.A, reducedProblem.A, dims[1], dims[0] );
+    presolve::ScatterFromRoot( seqReduced.b, reducedProblem.b, dims[1], grid );
+    scatterMatrix( seqReduced.G, reducedProblem.G, dims[2], dims[0] );
+    presolve::ScatterFromRoot( seqReduced.h, reducedProblem.h, dims[2], grid );
+}
+
+template<typename Real>
+void Postsolve
+( const PresolveInfo<Real>& info,
+  const AffineLPSolution<Matrix<Real>>& reducedSolution,
+        AffineLPSolution<Matrix<Real>>& solution )
+{
+    EL_DEBUG_CSE
+    const auto& problem = info.original;
+    const auto& A = problem.A;
+    const auto& G = problem.G;
+    const Int n = problem.c.Height();
+    const Int mA = A.Height();
+    const Int mG = G.Height();
+
+    Zeros( solution.x, n, 1 );
+    Zeros( solution.y, mA, 1 );
+    Zeros( solution.z, mG, 1 );
+    for( Int j=0; j<Int(info.keptVariables.size()); ++j )
+        solution.x(info.keptVariables[j]) = reducedSolution.x(j);
+    for( Int i=0; i<Int(info.keptEqualities.size()); ++i )
+        solution.y(info.keptEqualities[i]) = reducedSolution.y(i);
+    for( Int i=0; i<Int(info.keptInequalities.size()); ++i )
+        solution.z(info.keptInequalities[i]) = reducedSolution.z(i);
+    for( const auto& fixing : info.fixings )
+        solution.x(fixing.variable) = fixing.value;
+
+    // Recover the dual variables of the constraints eliminated alongside
+    // each fixed variable, in the reverse order of the fixings
+    presolve::ColumnLists<Real> AColumns, GColumns;
+    presolve::FormColumnLists( A, AColumns );
+    presolve::FormColumnLists( G, GColumns );
+    for( auto it=info.fixings.rbegin(); it!=info.fixings.rend(); ++it )
+    {
+        const auto& fixing = *it;
+        const Int j = fixing.variable;
+        // r := (A^T y + G^T z + c)_j
+        Real r = problem.c(j);
+        const Int AOffset = AColumns.Offset(j);
+        for( Int e=AOffset; e<AOffset+AColumns.NumConnections(j); ++e )
+            r += AColumns.values[e]*solution.y(AColumns.rows[e]);
+        const Int GOffset = GColumns.Offset(j);
+        for( Int e=GOffset; e<GOffset+GColumns.NumConnections(j); ++e )
+            r += GColumns.values[e]*solution.z(GColumns.rows[e]);
+
+        if( fixing.equality >= 0 )
+        {
+            solution.y(fixing.equality) = -r / fixing.equalityCoef;
+        }
+        else if( fixing.upperInequality >= 0 )
+        {
+            // Choose the bound multiplier which keeps z nonnegative
+            if( r <= Real(0) )
+                solution.z(fixing.upperInequality) = -r / fixing.upperCoef;
+            else
+                solution.z(fixing.lowerInequality) = -r / fixing.lowerCoef;
+        }
+    }
+
+    // s := h - G x
+    solution.s = problem.h;
+    Multiply( NORMAL, Real(-1), G, solution.x, Real(1), solution.s );
+}
+
+template<typename Real>
+void Postsolve
+( const PresolveInfo<Real>& info,
+  const AffineLPSolution<DistMultiVec<Real>>& reducedSolution,
+        AffineLPSolution<DistMultiVec<Real>>& solution )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = reducedSolution.x.Grid();
+    const int root = 0;
+    const bool isRoot = ( grid.Rank() == root );
+
+    AffineLPSolution<Matrix<Real>> seqReduced, seqSolution;
+    if( isRoot )
+    {
+        CopyFromRoot( reducedSolution.x, seqReduced.x );
+        CopyFromRoot( reducedSolution.s, seqReduced.s );
+        CopyFromRoot( reducedSolution.y, seqReduced.y );
+        CopyFromRoot( reducedSolution.z, seqReduced.z );
+        Postsolve( info, seqReduced, seqSolution );
+    }
+    else
+    {
+        CopyFromNonRoot( reducedSolution.x, root );
+        CopyFromNonRoot( reducedSolution.s, root );
+        CopyFromNonRoot( reducedSolution.y, root );
+        CopyFromNonRoot( reducedSolution.z, root );
+    }
+
+    Int dims[3] = { 0, 0, 0 };
+    if( isRoot )
+    {
+        dims[0] = seqSolution.x.Height();
+        dims[1] = seqSolution.y.Height();
+        dims[2] = seqSolution.z.Height();
+    }
+    mpi::Broadcast( dims, 3, root, grid.Comm() );
+
+    presolve::ScatterFromRoot( seqSolution.x, solution.x, dims[0], grid );
+    presolve::ScatterFromRoot( seqSolution.y, solution.y, dims[1], grid );
+    presolve::ScatterFromRoot( seqSolution.z, solution.z, dims[2], grid );
+    presolve::ScatterFromRoot( seqSolution.s, solution.s, dims[2], grid );
+}
+
+#define PROTO(Real) \
+  template void Presolve \
+  ( const AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& problem, \
+          AffineLPProblem<SparseMatrix<Real>,Matrix<Real>>& reducedProblem, \
+          PresolveInfo<Real>& info, \
+    bool progress ); \
+  template void Presolve \
+  ( const AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& \
+      problem, \
+          AffineLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& \
+            reducedProblem, \
+          PresolveInfo<Real>& info, \
+    bool progress ); \
+  template void Postsolve \
+  ( const PresolveInfo<Real>& info, \
+    const AffineLPSolution<Matrix<Real>>& reducedSolution, \
+          AffineLPSolution<Matrix<Real>>& solution ); \
+  template void Postsolve \
+  ( const PresolveInfo<Real>& info, \
+    const AffineLPSolution<DistMultiVec<Real>>& reducedSolution, \
+          AffineLPSolution<DistMultiVec<Real>>& solution );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace affine
+} // namespace lp
+} // namespace El
@@ -8,6 +8,7 @@
 */
 #include <El.hpp>
 #include "./util.hpp"
+#include "../../../../../io/MPIIO.hpp"
 
 namespace El {
 
@@ -462,8 +463,10 @@ void DirectState<Real,Matrix<Real>,Matrix<Real>>::Update
 
     // Compute the new barrier parameter
     // ---------------------------------
-    barrier = Dot(solution.x,solution.z) / degree;
-    const Real compRatio = pos_orth::ComplementRatio( solution.x, solution.z );
+    const auto complementarity =
+      pos_orth::Complementarity( solution.x, solution.z );
+    barrier = complementarity.sum / degree;
+    const Real compRatio = complementarity.Ratio();
     barrier = compRatio > ctrl.balanceTol ? barrierOld
       : Min(barrier,barrierOld);
     barrierOld = barrier;
@@ -697,6 +700,9 @@ void EquilibratedMehrotra
     Initialize
     ( problem, solution,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+    if( ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        pos_orth::WarmStartShift
+        ( solution.x, solution.z, ctrl.warmStartMinMu );
     DirectKKTSolver<Real,Matrix<Real>,Matrix<Real>> solver;
     DirectLPSolution<Matrix<Real>> affineCorrection, correction;
     for( state.numIts=0; state.numIts<ctrl.maxIts; ++state.numIts )
@@ -734,10 +740,10 @@ void EquilibratedMehrotra
 
         // Compute a centrality parameter
         // ==============================
-        Real alphaAffPri =
-          pos_orth::MaxStep( solution.x, affineCorrection.x, Real(1) );
-        Real alphaAffDual =
-          pos_orth::MaxStep( solution.z, affineCorrection.z, Real(1) );
+        Real alphaAffPri, alphaAffDual;
+        pos_orth::MaxSteps
+        ( solution.x, affineCorrection.x, solution.z, affineCorrection.z,
+          Real(1), alphaAffPri, alphaAffDual );
         if( ctrl.forceSameStep )
             alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
         if( ctrl.print && outputRoot )
@@ -782,10 +788,10 @@ void EquilibratedMehrotra
 
         // Update the current estimates
         // ============================
-        Real alphaPri =
-          pos_orth::MaxStep( solution.x, correction.x, 1/ctrl.maxStepRatio );
-        Real alphaDual =
-          pos_orth::MaxStep( solution.z, correction.z, 1/ctrl.maxStepRatio );
+        Real alphaPri, alphaDual;
+        pos_orth::MaxSteps
+        ( solution.x, correction.x, solution.z, correction.z,
+          1/ctrl.maxStepRatio, alphaPri, alphaDual );
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
@@ -908,6 +914,9 @@ void EquilibratedMehrotra
     Initialize
     ( problem, solution,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+    if( ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        pos_orth::WarmStartShift
+        ( solution.x, solution.z, ctrl.warmStartMinMu );
 
     Real muOld = 0.1;
     Real relError = 1;
@@ -951,6 +960,7 @@ void EquilibratedMehrotra
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        EL_REGION("lp::direct::Mehrotra iteration");
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( solution.x );
@@ -962,9 +972,10 @@ void EquilibratedMehrotra
 
         // Compute the barrier parameter
         // =============================
-        Real mu = Dot(solution.x,solution.z) / degree;
-        const Real compRatio =
-          pos_orth::ComplementRatio( solution.x, solution.z );
+        const auto complementarity =
+          pos_orth::Complementarity( solution.x, solution.z );
+        Real mu = complementarity.sum / degree;
+        const Real compRatio = complementarity.Ratio();
         mu = compRatio > ctrl.balanceTol ? muOld : Min(mu,muOld);
         muOld = mu;
 
@@ -1132,10 +1143,10 @@ void EquilibratedMehrotra
 
         // Compute a centrality parameter
         // ==============================
-        Real alphaAffPri =
-          pos_orth::MaxStep( solution.x, affineCorrection.x, Real(1) );
-        Real alphaAffDual =
-          pos_orth::MaxStep( solution.z, affineCorrection.z, Real(1) );
+        Real alphaAffPri, alphaAffDual;
+        pos_orth::MaxSteps
+        ( solution.x, affineCorrection.x, solution.z, affineCorrection.z,
+          Real(1), alphaAffPri, alphaAffDual );
         if( ctrl.forceSameStep )
             alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
         if( ctrl.print && commRank == 0 )
@@ -1221,10 +1232,10 @@ void EquilibratedMehrotra
 
         // Update the current estimates
         // ============================
-        Real alphaPri =
-          pos_orth::MaxStep( solution.x, correction.x, 1/ctrl.maxStepRatio );
-        Real alphaDual =
-          pos_orth::MaxStep( solution.z, correction.z, 1/ctrl.maxStepRatio );
+        Real alphaPri, alphaDual;
+        pos_orth::MaxSteps
+        ( solution.x, correction.x, solution.z, correction.z,
+          1/ctrl.maxStepRatio, alphaPri, alphaDual );
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
@@ -1413,6 +1424,9 @@ void EquilibratedMehrotra
           ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
+    if( ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        pos_orth::WarmStartShift
+        ( solution.x, solution.z, ctrl.warmStartMinMu );
 
     Matrix<Real> regTmp;
     if( ctrl.system == FULL_KKT )
@@ -1447,6 +1461,45 @@ void EquilibratedMehrotra
     Matrix<Real> d, w;
     Matrix<Real> dInner;
 
+    // The record of the current iteration for ctrl.iterationCallback
+    MehrotraIterationInfo<Real> info;
+    Timer iterationTimer, kktTimer, factorTimer, solveTimer;
+    const Real maxRegTmp = MaxNorm( regTmp );
+    auto finishIteration = [&]()
+      {
+        info.iterationTime = iterationTimer.Stop();
+        if( ctrl.iterationCallback )
+            ctrl.iterationCallback( info );
+      };
+    auto solveKKT = [&]( Matrix<Real>& rhs )
+      {
+        solveTimer.Start();
+        if( ctrl.resolveReg )
+            info.numRefineIts += reg_ldl::SolveAfter
+            ( JOrig, regTmp, dInner, sparseLDLFact, rhs, ctrl.solveCtrl );
+        else
+            info.numRefineIts += reg_ldl::RegularizedSolveAfter
+            ( JOrig, regTmp, dInner, sparseLDLFact, rhs,
+              ctrl.solveCtrl.relTol,
+              ctrl.solveCtrl.maxRefineIts,
+              ctrl.solveCtrl.progress );
+        info.solveTime += solveTimer.Stop();
+        ++info.numSolves;
+      };
+    auto solveNormalKKT = [&]( Matrix<Real>& rhs )
+      {
+        // NOTE: regTmp should be all zeros; replace with unregularized
+        solveTimer.Start();
+        info.numRefineIts += reg_ldl::RegularizedSolveAfter
+        ( J, regTmp, sparseLDLFact, rhs,
+          ctrl.solveCtrl.relTol,
+          ctrl.solveCtrl.maxRefineIts,
+          ctrl.solveCtrl.progress,
+          ctrl.solveCtrl.time );
+        info.solveTime += solveTimer.Stop();
+        ++info.numSolves;
+      };
+
     DirectLPSolution<Matrix<Real>> affineCorrection, correction;
     DirectLPResidual<Matrix<Real>> residual, error;
 
@@ -1454,6 +1507,10 @@ void EquilibratedMehrotra
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        EL_REGION("lp::direct::Mehrotra iteration");
+        info = MehrotraIterationInfo<Real>();
+        info.numIts = numIts;
+        iterationTimer.Start();
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( solution.x );
@@ -1500,9 +1557,10 @@ void EquilibratedMehrotra
 
         // Compute the barrier parameter
         // =============================
-        Real mu = Dot(solution.x,solution.z) / degree;
-        const Real compRatio =
-          pos_orth::ComplementRatio( solution.x, solution.z );
+        const auto complementarity =
+          pos_orth::Complementarity( solution.x, solution.z );
+        Real mu = complementarity.sum / degree;
+        const Real compRatio = complementarity.Ratio();
         mu = compRatio > ctrl.balanceTol ? muOld : Min(mu,muOld);
         muOld = mu;
 
@@ -1526,8 +1584,14 @@ void EquilibratedMehrotra
              "  dual      = ",dualObj,"\n",Indent(),
              "  |primal - dual| / (1 + |primal|) = ",objConv);
         }
+        info.mu = mu;
+        info.relError = relError;
+        info.wMaxNorm = wMaxNorm;
         if( relError <= ctrl.targetTol )
+        {
+            finishIteration();
             break;
+        }
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -1545,6 +1609,7 @@ void EquilibratedMehrotra
         {
             // Construct the KKT system
             // ------------------------
+            kktTimer.Start();
             if( ctrl.system == FULL_KKT )
             {
                 KKT
@@ -1565,6 +1630,10 @@ void EquilibratedMehrotra
             }
             J = JOrig;
             UpdateDiagonal( J, Real(1), regTmp );
+            info.kktTime = kktTimer.Stop();
+            info.kktHeight = J.Height();
+            info.maxRegTmp = maxRegTmp;
+            info.kktNumEntries = JOrig.NumEntries();
 
             // Solve for the direction
             // -----------------------
@@ -1599,16 +1668,11 @@ void EquilibratedMehrotra
                     sparseLDLFact.ChangeNonzeroValues( J );
                 }
 
+                factorTimer.Start();
                 sparseLDLFact.Factor( LDL_2D );
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
+                info.factorTime = factorTimer.Stop();
+                info.factorNumEntries = sparseLDLFact.NumEntries();
+                solveKKT( d );
             }
             catch(...)
             {
@@ -1633,6 +1697,7 @@ void EquilibratedMehrotra
             // ------------------------
             // TODO(poulson): Apply updates to a matrix of explicit zeros
             // (with the correct sparsity pattern)
+            kktTimer.Start();
             NormalKKT
             ( problem.A, gammaPerm, deltaPerm,
               solution.x, solution.z, J, false );
@@ -1640,6 +1705,10 @@ void EquilibratedMehrotra
             ( problem.A, gammaPerm, solution.x, solution.z,
               residual.dualEquality, residual.primalEquality,
               residual.dualConic, affineCorrection.y );
+            info.kktTime = kktTimer.Stop();
+            info.kktHeight = J.Height();
+            info.maxRegTmp = maxRegTmp;
+            info.kktNumEntries = J.NumEntries();
 
             // Solve for the direction
             // -----------------------
@@ -1656,15 +1725,12 @@ void EquilibratedMehrotra
                     sparseLDLFact.ChangeNonzeroValues( J );
                 }
 
+                factorTimer.Start();
                 sparseLDLFact.Factor( LDL_2D );
+                info.factorTime = factorTimer.Stop();
+                info.factorNumEntries = sparseLDLFact.NumEntries();
 
-                // NOTE: regTmp should be all zeros; replace with unregularized
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, sparseLDLFact, affineCorrection.y,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress,
-                  ctrl.solveCtrl.time );
+                solveNormalKKT( affineCorrection.y );
             }
             catch(...)
             {
@@ -1719,10 +1785,10 @@ void EquilibratedMehrotra
 
         // Compute a centrality parameter
         // ==============================
-        Real alphaAffPri =
-          pos_orth::MaxStep( solution.x, affineCorrection.x, Real(1) );
-        Real alphaAffDual =
-          pos_orth::MaxStep( solution.z, affineCorrection.z, Real(1) );
+        Real alphaAffPri, alphaAffDual;
+        pos_orth::MaxSteps
+        ( solution.x, affineCorrection.x, solution.z, affineCorrection.z,
+          Real(1), alphaAffPri, alphaAffDual );
         if( ctrl.forceSameStep )
             alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
         if( ctrl.print )
@@ -1740,6 +1806,9 @@ void EquilibratedMehrotra
           ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print )
             Output("sigma=",sigma);
+        info.alphaAffPri = alphaAffPri;
+        info.alphaAffDual = alphaAffDual;
+        info.sigma = sigma;
 
         // Solve for the combined direction
         // ================================
@@ -1764,15 +1833,7 @@ void EquilibratedMehrotra
               residual.dualConic, solution.z, d );
             try
             {
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
+                solveKKT( d );
             }
             catch(...)
             {
@@ -1791,15 +1852,7 @@ void EquilibratedMehrotra
               residual.dualConic, d );
             try
             {
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
+                solveKKT( d );
             }
             catch(...)
             {
@@ -1821,13 +1874,7 @@ void EquilibratedMehrotra
               residual.dualConic, correction.y );
             try
             {
-                // NOTE: regTmp should be all zeros; replace with unregularized
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, sparseLDLFact, correction.y,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress,
-                  ctrl.solveCtrl.time );
+                solveNormalKKT( correction.y );
             }
             catch(...)
             {
@@ -1846,10 +1893,10 @@ void EquilibratedMehrotra
 
         // Update the current estimates
         // ============================
-        Real alphaPri =
-          pos_orth::MaxStep( solution.x, correction.x, 1/ctrl.maxStepRatio );
-        Real alphaDual =
-          pos_orth::MaxStep( solution.z, correction.z, 1/ctrl.maxStepRatio );
+        Real alphaPri, alphaDual;
+        pos_orth::MaxSteps
+        ( solution.x, correction.x, solution.z, correction.z,
+          1/ctrl.maxStepRatio, alphaPri, alphaDual );
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
@@ -1859,6 +1906,9 @@ void EquilibratedMehrotra
         Axpy( alphaPri,  correction.x, solution.x );
         Axpy( alphaDual, correction.y, solution.y );
         Axpy( alphaDual, correction.z, solution.z );
+        info.alphaPri = alphaPri;
+        info.alphaDual = alphaDual;
+        finishIteration();
         if( alphaPri == Real(0) && alphaDual == Real(0) )
         {
             if( relError <= ctrl.minTol )
@@ -1939,6 +1989,90 @@ void Mehrotra
 }
 
 // TODO(poulson): Not use temporary regularization except in final iterations?
+// A checkpoint of the iterate consists of the index of the next iteration,
+// the dimensions of the problem, and the barrier parameter, followed by x, y,
+// and z in the order of their rows
+template<typename Real>
+void WriteCheckpoint
+( const string& filename,
+  Int numIts,
+  const Real& mu,
+  const DirectLPSolution<DistMultiVec<Real>>& solution )
+{
+    EL_DEBUG_CSE
+    if( !IsPacked<Real>::value )
+        LogicError("Only packed datatypes can be checkpointed");
+    mpi::Comm comm = solution.x.Grid().Comm();
+    const Int n = solution.x.Height();
+    const Int m = solution.y.Height();
+    MPI_File file;
+    const int error =
+      MPI_File_open
+      ( comm.comm, const_cast<char*>(filename.c_str()),
+        MPI_MODE_WRONLY | MPI_MODE_CREATE, MPI_INFO_NULL, &file );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+    const MPI_Offset metaBytes = 3*sizeof(Int) + sizeof(Real);
+    const MPI_Offset numBytes =
+      metaBytes + MPI_Offset(2*n+m)*MPI_Offset(sizeof(Real));
+    mpi_io::Check( MPI_File_set_size( file, numBytes ), "MPI_File_set_size" );
+    if( mpi::Rank(comm) == 0 )
+    {
+        const Int meta[3] = { numIts, n, m };
+        mpi_io::WriteBytes
+        ( file, 0, reinterpret_cast<const byte*>(meta), 3*sizeof(Int) );
+        mpi_io::WriteBytes
+        ( file, 3*sizeof(Int), reinterpret_cast<const byte*>(&mu),
+          sizeof(Real) );
+    }
+    const MPI_Offset realSize = sizeof(Real);
+    mpi_io::WriteVector( file, metaBytes, solution.x );
+    mpi_io::WriteVector( file, metaBytes+n*realSize, solution.y );
+    mpi_io::WriteVector( file, metaBytes+(n+m)*realSize, solution.z );
+    mpi_io::Check( MPI_File_close( &file ), "MPI_File_close" );
+}
+
+template<typename Real>
+void ReadCheckpoint
+( const string& filename,
+  Int m,
+  Int n,
+  Int& numIts,
+  Real& mu,
+  DirectLPSolution<DistMultiVec<Real>>& solution )
+{
+    EL_DEBUG_CSE
+    if( !IsPacked<Real>::value )
+        LogicError("Only packed datatypes can be checkpointed");
+    mpi::Comm comm = solution.x.Grid().Comm();
+    MPI_File file;
+    const int error =
+      MPI_File_open
+      ( comm.comm, const_cast<char*>(filename.c_str()), MPI_MODE_RDONLY,
+        MPI_INFO_NULL, &file );
+    if( error != MPI_SUCCESS )
+        RuntimeError("Could not open ",filename);
+    Int meta[3];
+    mpi_io::ReadBytes
+    ( file, 0, reinterpret_cast<byte*>(meta), 3*sizeof(Int) );
+    mpi_io::ReadBytes
+    ( file, 3*sizeof(Int), reinterpret_cast<byte*>(&mu), sizeof(Real) );
+    numIts = meta[0];
+    if( meta[1] != n || meta[2] != m )
+    {
+        MPI_File_close( &file );
+        RuntimeError
+        (filename," is for a problem with ",meta[1]," variables and ",
+         meta[2]," constraints");
+    }
+    const MPI_Offset metaBytes = 3*sizeof(Int) + sizeof(Real);
+    const MPI_Offset realSize = sizeof(Real);
+    mpi_io::ReadVector( file, metaBytes, n, solution.x );
+    mpi_io::ReadVector( file, metaBytes+n*realSize, m, solution.y );
+    mpi_io::ReadVector( file, metaBytes+(n+m)*realSize, n, solution.z );
+    mpi_io::Check( MPI_File_close( &file ), "MPI_File_close" );
+}
+
 template<typename Real>
 void EquilibratedMehrotra
 ( const DirectLPProblem<DistSparseMatrix<Real>,DistMultiVec<Real>>& problem,
@@ -1991,7 +2125,19 @@ void EquilibratedMehrotra
     // augmented formulation
     if( commRank == 0 && ctrl.time )
         timer.Start();
-    if( ctrl.system == AUGMENTED_KKT )
+    const bool checkpoint = ctrl.checkpointFreq > 0;
+    const string analysisFile = ctrl.checkpointFile + ".ldl";
+    Int firstIt = 0;
+    Real muOld = 0.1;
+    if( ctrl.restart )
+    {
+        ForceSimpleAlignments( solution, grid );
+        ReadCheckpoint
+        ( ctrl.checkpointFile, m, n, firstIt, muOld, solution );
+        if( ctrl.print && commRank == 0 )
+            Output("Restarting from iteration ",firstIt);
+    }
+    else if( ctrl.system == AUGMENTED_KKT )
     {
         Initialize
         ( problem, solution, sparseLDLFact,
@@ -2006,6 +2152,10 @@ void EquilibratedMehrotra
           ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
+    if( !ctrl.restart &&
+        ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        pos_orth::WarmStartShift
+        ( solution.x, solution.z, ctrl.warmStartMinMu );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
 
@@ -2038,14 +2188,77 @@ void EquilibratedMehrotra
     }
     regTmp *= origTwoNormEst;
 
-    Real muOld = 0.1;
     Real relError = 1;
 
-    DistGraphMultMeta metaOrig, meta;
+    DistGraphMultMeta meta;
+    DistSparseRefillMap kktMap;
     DistSparseMatrix<Real> J(grid), JOrig(grid);
     DistMultiVec<Real> d(grid), w(grid);
     DistMultiVec<Real> dInner(grid);
 
+    // The record of the current iteration for ctrl.iterationCallback
+    MehrotraIterationInfo<Real> info;
+    Timer iterationTimer, kktTimer, factorTimer, solveTimer;
+    const Real maxRegTmp = MaxNorm( regTmp );
+    auto finishIteration = [&]()
+      {
+        info.iterationTime = iterationTimer.Stop();
+        if( ctrl.iterationCallback )
+            ctrl.iterationCallback( info );
+      };
+    auto solveKKT = [&]( DistMultiVec<Real>& rhs )
+      {
+        solveTimer.Start();
+        if( ctrl.resolveReg )
+            info.numRefineIts += reg_ldl::SolveAfter
+            ( JOrig, regTmp, dInner, sparseLDLFact, rhs, ctrl.solveCtrl );
+        else
+            info.numRefineIts += reg_ldl::RegularizedSolveAfter
+            ( JOrig, regTmp, dInner, sparseLDLFact, rhs,
+              ctrl.solveCtrl.relTol,
+              ctrl.solveCtrl.maxRefineIts,
+              ctrl.solveCtrl.progress );
+        info.solveTime += solveTimer.Stop();
+        ++info.numSolves;
+      };
+    auto solveNormalKKT = [&]( DistMultiVec<Real>& rhs )
+      {
+        // NOTE: regTmp should be all zeros; replace with unregularized
+        solveTimer.Start();
+        info.numRefineIts += reg_ldl::RegularizedSolveAfter
+        ( J, regTmp, sparseLDLFact, rhs,
+          ctrl.solveCtrl.relTol,
+          ctrl.solveCtrl.maxRefineIts,
+          ctrl.solveCtrl.progress,
+          ctrl.solveCtrl.time );
+        info.solveTime += solveTimer.Stop();
+        ++info.numSolves;
+      };
+
+    // Reuse the checkpointed reordering of the KKT system when restarting
+    // over the same number of processes
+    auto analyze = [&]()
+      {
+        const bool hermitian = true;
+        const BisectCtrl bisectCtrl;
+        if( ctrl.restart )
+        {
+            try
+            {
+                sparseLDLFact.Load( J, analysisFile, bisectCtrl );
+                return;
+            }
+            catch( std::exception& e )
+            {
+                if( ctrl.print && commRank == 0 )
+                    Output("Recomputing the analysis: ",e.what());
+            }
+        }
+        sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+        if( checkpoint )
+            sparseLDLFact.Save( analysisFile, false );
+      };
+
     DirectLPSolution<DistMultiVec<Real>> affineCorrection, correction;
     DirectLPResidual<DistMultiVec<Real>> residual, error;
     ForceSimpleAlignments( affineCorrection, grid );
@@ -2055,8 +2268,12 @@ void EquilibratedMehrotra
 
     DistMultiVec<Real> prod(grid);
     const Int indent = PushIndent();
-    for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
+    for( Int numIts=firstIt; numIts<=ctrl.maxIts; ++numIts )
     {
+        EL_REGION("lp::direct::Mehrotra iteration");
+        info = MehrotraIterationInfo<Real>();
+        info.numIts = numIts;
+        iterationTimer.Start();
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( solution.x );
@@ -2068,9 +2285,10 @@ void EquilibratedMehrotra
 
         // Compute the barrier parameter
         // =============================
-        Real mu = Dot(solution.x,solution.z) / degree;
-        const Real compRatio =
-          pos_orth::ComplementRatio( solution.x, solution.z );
+        const auto complementarity =
+          pos_orth::Complementarity( solution.x, solution.z );
+        Real mu = complementarity.sum / degree;
+        const Real compRatio = complementarity.Ratio();
         mu = compRatio > ctrl.balanceTol ? muOld : Min(mu,muOld);
         muOld = mu;
 
@@ -2079,28 +2297,43 @@ void EquilibratedMehrotra
 
         // Check for convergence
         // =====================
-        // |primal - dual| / (1 + |primal|) <= tol ?
-        // -----------------------------------------
-        const Real primObj = Dot(problem.c,solution.x);
-        const Real dualObj = -Dot(problem.b,solution.y);
-        const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
-        // || r_b ||_2 / (1 + || b ||_2) <= tol ?
-        // --------------------------------------
+        // The objectives and the residual norms (and, if printing, the norms
+        // of the iterates) are combined with a single AllReduce
         residual.primalEquality = problem.b;
         Gemv
         ( NORMAL, Real(1), problem.A, solution.x,
           Real(-1), residual.primalEquality );
-        const Real rbNrm2 = FrobeniusNorm( residual.primalEquality );
-        const Real rbConv = rbNrm2 / (1+bNrm2);
-        Axpy( -deltaPerm*deltaPerm, solution.y, residual.primalEquality );
-        // || r_c ||_2 / (1 + || c ||_2) <= tol ?
-        // --------------------------------------
         residual.dualEquality = problem.c;
         Gemv
         ( TRANSPOSE, Real(1), problem.A, solution.y,
           Real(1), residual.dualEquality );
         residual.dualEquality -= solution.z;
-        const Real rcNrm2 = FrobeniusNorm( residual.dualEquality );
+        ReductionBatch<Real> reductions;
+        const Int primObjIndex = reductions.QueueDot( problem.c, solution.x );
+        const Int dualObjIndex = reductions.QueueDot( problem.b, solution.y );
+        const Int rbIndex = reductions.QueueNrm2( residual.primalEquality );
+        const Int rcIndex = reductions.QueueNrm2( residual.dualEquality );
+        Int xIndex=-1, yIndex=-1, zIndex=-1;
+        if( ctrl.print )
+        {
+            xIndex = reductions.QueueNrm2( solution.x );
+            yIndex = reductions.QueueNrm2( solution.y );
+            zIndex = reductions.QueueNrm2( solution.z );
+        }
+        reductions.Execute();
+        // |primal - dual| / (1 + |primal|) <= tol ?
+        // -----------------------------------------
+        const Real primObj = reductions.Dot( primObjIndex );
+        const Real dualObj = -reductions.Dot( dualObjIndex );
+        const Real objConv = Abs(primObj-dualObj) / (1+Abs(primObj));
+        // || r_b ||_2 / (1 + || b ||_2) <= tol ?
+        // --------------------------------------
+        const Real rbNrm2 = reductions.Nrm2( rbIndex );
+        const Real rbConv = rbNrm2 / (1+bNrm2);
+        Axpy( -deltaPerm*deltaPerm, solution.y, residual.primalEquality );
+        // || r_c ||_2 / (1 + || c ||_2) <= tol ?
+        // --------------------------------------
+        const Real rcNrm2 = reductions.Nrm2( rcIndex );
         const Real rcConv = rcNrm2 / (1+cNrm2);
         Axpy( gammaPerm*gammaPerm, solution.x, residual.dualEquality );
         // Now check the pieces
@@ -2108,9 +2341,9 @@ void EquilibratedMehrotra
         relError = Max(Max(objConv,rbConv),rcConv);
         if( ctrl.print )
         {
-            const Real xNrm2 = FrobeniusNorm( solution.x );
-            const Real yNrm2 = FrobeniusNorm( solution.y );
-            const Real zNrm2 = FrobeniusNorm( solution.z );
+            const Real xNrm2 = reductions.Nrm2( xIndex );
+            const Real yNrm2 = reductions.Nrm2( yIndex );
+            const Real zNrm2 = reductions.Nrm2( zIndex );
             if( commRank == 0 )
                 Output
                 ("iter ",numIts,":\n",Indent(),
@@ -2126,8 +2359,14 @@ void EquilibratedMehrotra
                  "  dual   = ",dualObj,"\n",Indent(),
                  "  |primal - dual| / (1 + |primal|) = ",objConv);
         }
+        info.mu = mu;
+        info.relError = relError;
+        info.wMaxNorm = wMaxNorm;
         if( relError <= ctrl.targetTol )
+        {
+            finishIteration();
             break;
+        }
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -2145,29 +2384,45 @@ void EquilibratedMehrotra
         {
             // Assemble the KKT system
             // -----------------------
+            // After the first iteration, only the barrier block of the
+            // (frozen) KKT matrix is overwritten
+            kktTimer.Start();
             if( ctrl.system == FULL_KKT )
             {
-                KKT
-                ( problem.A, gammaPerm, deltaPerm, betaPerm,
-                  solution.x, solution.z, JOrig, false );
+                if( numIts == firstIt )
+                    KKT
+                    ( problem.A, gammaPerm, deltaPerm, betaPerm,
+                      solution.x, solution.z, JOrig, false );
+                else
+                    RefillKKT
+                    ( m, betaPerm, solution.x, solution.z, JOrig, kktMap );
                 KKTRHS
                 ( residual.dualEquality, residual.primalEquality,
                   residual.dualConic, solution.z, d );
             }
             else
             {
-                AugmentedKKT
-                ( problem.A, gammaPerm, deltaPerm, solution.x, solution.z,
-                  JOrig, false );
+                if( numIts == firstIt )
+                    AugmentedKKT
+                    ( problem.A, gammaPerm, deltaPerm, solution.x, solution.z,
+                      JOrig, false );
+                else
+                    RefillAugmentedKKT
+                    ( gammaPerm, solution.x, solution.z, JOrig, kktMap );
                 AugmentedKKTRHS
                 ( solution.x, residual.dualEquality, residual.primalEquality,
                   residual.dualConic, d );
             }
             J = JOrig;
             UpdateDiagonal( J, Real(1), regTmp );
-            if( numIts == 0 )
+            info.kktTime = kktTimer.Stop();
+            info.kktHeight = J.Height();
+            info.maxRegTmp = maxRegTmp;
+            if( ctrl.iterationCallback )
+                info.kktNumEntries = JOrig.NumEntries();
+            if( numIts == firstIt )
             {
-                metaOrig = JOrig.InitializeMultMeta();
+                JOrig.InitializeMultMeta();
                 meta = J.InitializeMultMeta();
                 if( ctrl.print )
                 {
@@ -2178,7 +2433,6 @@ void EquilibratedMehrotra
             }
             else
             {
-                JOrig.LockedDistGraph().multMeta = metaOrig;
                 J.LockedDistGraph().multMeta = meta;
             }
 
@@ -2206,38 +2460,38 @@ void EquilibratedMehrotra
                 if( commRank == 0 && ctrl.time )
                     Output("Equilibration: ",timer.Stop()," secs");
 
-                if( numIts == 0 &&
-                    (ctrl.system != AUGMENTED_KKT ||
+                if( numIts == firstIt &&
+                    (ctrl.system != AUGMENTED_KKT || ctrl.restart ||
                      (ctrl.primalInit && ctrl.dualInit)) )
                 {
                     if( commRank == 0 && ctrl.time )
                         timer.Start();
-                    const bool hermitian = true;
-                    const BisectCtrl bisectCtrl;
-                    sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    analyze();
                     if( commRank == 0 && ctrl.time )
                         Output("Analysis: ",timer.Stop()," secs");
                 }
                 else
+                {
                     sparseLDLFact.ChangeNonzeroValues( J );
+                    if( numIts == firstIt && checkpoint )
+                        sparseLDLFact.Save( analysisFile, false );
+                }
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
+                factorTimer.Start();
                 sparseLDLFact.Factor( LDL_2D );
+                info.factorTime = factorTimer.Stop();
+                if( ctrl.iterationCallback )
+                    info.factorNumEntries =
+                      mpi::AllReduce
+                      ( sparseLDLFact.NumLocalEntries(), grid.Comm() );
                 if( commRank == 0 && ctrl.time )
                     Output("LDL: ",timer.Stop()," secs");
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
+                solveKKT( d );
                 if( commRank == 0 && ctrl.time )
                     Output("Affine: ",timer.Stop()," secs");
             }
@@ -2264,6 +2518,7 @@ void EquilibratedMehrotra
             // Assemble the KKT system
             // -----------------------
             // TODO(poulson): Apply updates on top of explicit zeros
+            kktTimer.Start();
             NormalKKT
             ( problem.A, gammaPerm, deltaPerm, solution.x, solution.z,
               J, false );
@@ -2271,7 +2526,12 @@ void EquilibratedMehrotra
             ( problem.A, gammaPerm, solution.x, solution.z,
               residual.dualEquality, residual.primalEquality,
               residual.dualConic, affineCorrection.y );
-            if( numIts == 0 )
+            info.kktTime = kktTimer.Stop();
+            info.kktHeight = J.Height();
+            info.maxRegTmp = maxRegTmp;
+            if( ctrl.iterationCallback )
+                info.kktNumEntries = J.NumEntries();
+            if( numIts == firstIt )
             {
                 if( ctrl.print )
                 {
@@ -2290,13 +2550,11 @@ void EquilibratedMehrotra
             // -----------------------
             try
             {
-                if( numIts == 0 )
+                if( numIts == firstIt )
                 {
                     if( commRank == 0 && ctrl.time )
                         timer.Start();
-                    const bool hermitian = true;
-                    const BisectCtrl bisectCtrl;
-                    sparseLDLFact.Initialize( J, hermitian, bisectCtrl );
+                    analyze();
                     if( commRank == 0 && ctrl.time )
                         Output("Analysis: ",timer.Stop()," secs");
                 }
@@ -2307,18 +2565,19 @@ void EquilibratedMehrotra
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
+                factorTimer.Start();
                 sparseLDLFact.Factor( LDL_2D );
+                info.factorTime = factorTimer.Stop();
+                if( ctrl.iterationCallback )
+                    info.factorNumEntries =
+                      mpi::AllReduce
+                      ( sparseLDLFact.NumLocalEntries(), grid.Comm() );
                 if( commRank == 0 && ctrl.time )
                     Output("LDL: ",timer.Stop()," secs");
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, sparseLDLFact, affineCorrection.y,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress,
-                  ctrl.solveCtrl.time );
+                solveNormalKKT( affineCorrection.y );
                 if( commRank == 0 && ctrl.time )
                     Output("Affine: ",timer.Stop()," secs");
             }
@@ -2376,10 +2635,10 @@ void EquilibratedMehrotra
 
         // Compute a centrality parameter
         // ==============================
-        Real alphaAffPri =
-          pos_orth::MaxStep( solution.x, affineCorrection.x, Real(1) );
-        Real alphaAffDual =
-          pos_orth::MaxStep( solution.z, affineCorrection.z, Real(1) );
+        Real alphaAffPri, alphaAffDual;
+        pos_orth::MaxSteps
+        ( solution.x, affineCorrection.x, solution.z, affineCorrection.z,
+          Real(1), alphaAffPri, alphaAffDual );
         if( ctrl.forceSameStep )
             alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
         if( ctrl.print && commRank == 0 )
@@ -2397,6 +2656,9 @@ void EquilibratedMehrotra
           ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print && commRank == 0 )
             Output("sigma=",sigma);
+        info.alphaAffPri = alphaAffPri;
+        info.alphaAffDual = alphaAffDual;
+        info.sigma = sigma;
 
         // Solve for the combined direction
         // ================================
@@ -2422,15 +2684,7 @@ void EquilibratedMehrotra
             {
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
+                solveKKT( d );
                 if( commRank == 0 && ctrl.time )
                     Output("Corrector: ",timer.Stop()," secs");
             }
@@ -2453,15 +2707,7 @@ void EquilibratedMehrotra
             {
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
+                solveKKT( d );
                 if( commRank == 0 && ctrl.time )
                     Output("Corrector: ",timer.Stop()," secs");
             }
@@ -2487,12 +2733,7 @@ void EquilibratedMehrotra
             {
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
-                reg_ldl::RegularizedSolveAfter
-                ( J, regTmp, sparseLDLFact, correction.y,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress,
-                  ctrl.solveCtrl.time );
+                solveNormalKKT( correction.y );
                 if( commRank == 0 && ctrl.time )
                     Output("Corrector: ",timer.Stop()," secs");
             }
@@ -2513,10 +2754,10 @@ void EquilibratedMehrotra
 
         // Update the current estimates
         // ============================
-        Real alphaPri =
-          pos_orth::MaxStep( solution.x, correction.x, 1/ctrl.maxStepRatio );
-        Real alphaDual =
-          pos_orth::MaxStep( solution.z, correction.z, 1/ctrl.maxStepRatio );
+        Real alphaPri, alphaDual;
+        pos_orth::MaxSteps
+        ( solution.x, correction.x, solution.z, correction.z,
+          1/ctrl.maxStepRatio, alphaPri, alphaDual );
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
@@ -2526,6 +2767,11 @@ void EquilibratedMehrotra
         Axpy( alphaPri,  correction.x, solution.x );
         Axpy( alphaDual, correction.y, solution.y );
         Axpy( alphaDual, correction.z, solution.z );
+        info.alphaPri = alphaPri;
+        info.alphaDual = alphaDual;
+        if( checkpoint && (numIts+1) % ctrl.checkpointFreq == 0 )
+            WriteCheckpoint( ctrl.checkpointFile, numIts+1, muOld, solution );
+        finishIteration();
         if( alphaPri == Real(0) && alphaDual == Real(0) )
         {
             if( relError <= ctrl.minTol )
@@ -77,6 +77,18 @@ void KKT
         DistSparseMatrix<Real>& J,
   bool onlyLower=true );
 
+// Overwrite the -x o inv(z) - beta^2*I block of a KKT matrix formed by the
+// above routine (with the same A, gamma, delta, and beta) without reassembling
+// it. The refill map is formed on the first call.
+template<typename Real>
+void RefillKKT
+( Int m,
+  Real beta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J,
+        DistSparseRefillMap& map );
+
 using qp::direct::KKTRHS;
 using qp::direct::ExpandSolution;
 
@@ -115,6 +127,17 @@ void AugmentedKKT
         DistSparseMatrix<Real>& J,
   bool onlyLower=true );
 
+// Overwrite the z o inv(x) + gamma^2*I block of an augmented KKT matrix formed
+// by the above routine (with the same A, gamma, and delta) without
+// reassembling it. The refill map is formed on the first call.
+template<typename Real>
+void RefillAugmentedKKT
+( Real gamma,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J,
+        DistSparseRefillMap& map );
+
 using qp::direct::AugmentedKKTRHS;
 using qp::direct::ExpandAugmentedSolution;
 
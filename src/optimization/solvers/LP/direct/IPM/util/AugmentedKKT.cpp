@@ -114,6 +114,31 @@ void AugmentedKKT
     qp::direct::AugmentedKKT( Q, A, gamma, delta, x, z, J, onlyLower );
 }
 
+template<typename Real>
+void RefillAugmentedKKT
+( Real gamma,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J,
+        DistSparseRefillMap& map )
+{
+    EL_DEBUG_CSE
+    const Int xLocalHeight = x.LocalHeight();
+    if( !map.ready )
+    {
+        vector<Int> rows( xLocalHeight );
+        for( Int iLoc=0; iLoc<xLocalHeight; ++iLoc )
+            rows[iLoc] = x.GlobalRow(iLoc);
+        J.FormRefillMap( rows, rows, map );
+    }
+    auto& xLoc = x.LockedMatrix();
+    auto& zLoc = z.LockedMatrix();
+    vector<Real> values( xLocalHeight );
+    for( Int iLoc=0; iLoc<xLocalHeight; ++iLoc )
+        values[iLoc] = zLoc(iLoc)/xLoc(iLoc)+gamma*gamma;
+    J.Refill( map, values );
+}
+
 #define PROTO(Real) \
   template void AugmentedKKT \
   ( const Matrix<Real>& A, \
@@ -142,7 +167,13 @@ void AugmentedKKT
     const DistMultiVec<Real>& x, \
     const DistMultiVec<Real>& z, \
           DistSparseMatrix<Real>& J, \
-    bool onlyLower );
+    bool onlyLower ); \
+  template void RefillAugmentedKKT \
+  ( Real gamma, \
+    const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& z, \
+          DistSparseMatrix<Real>& J, \
+          DistSparseRefillMap& map );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
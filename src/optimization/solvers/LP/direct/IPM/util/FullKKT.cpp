@@ -161,6 +161,33 @@ void KKT
     qp::direct::KKT( Q, A, gamma, delta, beta, x, z, J, onlyLower );
 }
 
+template<typename Real>
+void RefillKKT
+( Int m,
+  Real beta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J,
+        DistSparseRefillMap& map )
+{
+    EL_DEBUG_CSE
+    const Int n = x.Height();
+    const Int xLocalHeight = x.LocalHeight();
+    if( !map.ready )
+    {
+        vector<Int> rows( xLocalHeight );
+        for( Int iLoc=0; iLoc<xLocalHeight; ++iLoc )
+            rows[iLoc] = n+m + x.GlobalRow(iLoc);
+        J.FormRefillMap( rows, rows, map );
+    }
+    auto& xLoc = x.LockedMatrix();
+    auto& zLoc = z.LockedMatrix();
+    vector<Real> values( xLocalHeight );
+    for( Int iLoc=0; iLoc<xLocalHeight; ++iLoc )
+        values[iLoc] = -xLoc(iLoc)/zLoc(iLoc)-beta*beta;
+    J.Refill( map, values );
+}
+
 #define PROTO(Real) \
   template void KKT \
   ( const Matrix<Real>& A, \
@@ -187,7 +214,14 @@ void KKT
           Real beta, \
     const DistMultiVec<Real>& x, \
     const DistMultiVec<Real>& z, \
-          DistSparseMatrix<Real>& J, bool onlyLower );
+          DistSparseMatrix<Real>& J, bool onlyLower ); \
+  template void RefillKKT \
+  ( Int m, \
+    Real beta, \
+    const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& z, \
+          DistSparseMatrix<Real>& J, \
+          DistSparseRefillMap& map );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
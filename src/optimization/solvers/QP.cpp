@@ -9,6 +9,7 @@
 #include <El.hpp>
 #include "./QP/direct/IPM.hpp"
 #include "./QP/affine/IPM.hpp"
+#include "./Batch.hpp"
 
 namespace El {
 
@@ -172,6 +173,46 @@ void QP
         LogicError("Unsupported solver");
 }
 
+template<typename Real>
+void QP
+( const vector<AffineQPProblem<Matrix<Real>,Matrix<Real>>>& problems,
+        vector<AffineLPSolution<Matrix<Real>>>& solutions,
+  const qp::affine::Ctrl<Real>& ctrl,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef AffineQPProblem<Matrix<Real>,Matrix<Real>> ProblemType;
+    auto solve =
+      [&]( const ProblemType& problem,
+           AffineLPSolution<Matrix<Real>>& solution )
+      {
+          QP
+          ( problem.Q, problem.A, problem.G, problem.b, problem.c, problem.h,
+            solution.x, solution.y, solution.z, solution.s, ctrl );
+      };
+    batch::Solve<Real,ProblemType>( problems, solutions, solve, comm );
+}
+
+template<typename Real>
+void QP
+( const vector<AffineQPProblem<SparseMatrix<Real>,Matrix<Real>>>& problems,
+        vector<AffineLPSolution<Matrix<Real>>>& solutions,
+  const qp::affine::Ctrl<Real>& ctrl,
+  mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    typedef AffineQPProblem<SparseMatrix<Real>,Matrix<Real>> ProblemType;
+    auto solve =
+      [&]( const ProblemType& problem,
+           AffineLPSolution<Matrix<Real>>& solution )
+      {
+          QP
+          ( problem.Q, problem.A, problem.G, problem.b, problem.c, problem.h,
+            solution.x, solution.y, solution.z, solution.s, ctrl );
+      };
+    batch::Solve<Real,ProblemType>( problems, solutions, solve, comm );
+}
+
 #define PROTO(Real) \
   template void QP \
   ( const Matrix<Real>& Q, \
@@ -256,7 +297,17 @@ void QP
           DistMultiVec<Real>& y, \
           DistMultiVec<Real>& z, \
           DistMultiVec<Real>& s, \
-    const qp::affine::Ctrl<Real>& ctrl );
+    const qp::affine::Ctrl<Real>& ctrl ); \
+  template void QP \
+  ( const vector<AffineQPProblem<Matrix<Real>,Matrix<Real>>>& problems, \
+          vector<AffineLPSolution<Matrix<Real>>>& solutions, \
+    const qp::affine::Ctrl<Real>& ctrl, \
+    mpi::Comm comm ); \
+  template void QP \
+  ( const vector<AffineQPProblem<SparseMatrix<Real>,Matrix<Real>>>& problems, \
+          vector<AffineLPSolution<Matrix<Real>>>& solutions, \
+    const qp::affine::Ctrl<Real>& ctrl, \
+    mpi::Comm comm );
 
 #define EL_NO_INT_PROTO
 #define EL_NO_COMPLEX_PROTO
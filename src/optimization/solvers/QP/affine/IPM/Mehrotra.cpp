@@ -109,6 +109,8 @@ void Mehrotra
     Initialize
     ( Q, A, G, b, c, h, x, y, z, s,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+    if( ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        pos_orth::WarmStartShift( s, z, ctrl.warmStartMinMu );
 
     Real relError = 1;
     Matrix<Real> J, d,
@@ -121,6 +123,7 @@ void Mehrotra
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        EL_REGION("qp::affine::Mehrotra iteration");
         // Ensure that s and z are in the cone
         // ===================================
         const Int sNumNonPos = pos_orth::NumOutside( s );
@@ -450,6 +453,8 @@ void Mehrotra
     Initialize
     ( Q, A, G, b, c, h, x, y, z, s,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+    if( ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        pos_orth::WarmStartShift( s, z, ctrl.warmStartMinMu );
     if( ctrl.time && commRank == 0 )
         Output("Init time: ",timer.Stop()," secs");
 
@@ -470,6 +475,7 @@ void Mehrotra
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        EL_REGION("qp::affine::Mehrotra iteration");
         // Ensure that s and z are in the cone
         // ===================================
         const Int sNumNonPos = pos_orth::NumOutside( s );
@@ -808,20 +814,55 @@ void Mehrotra
     ( JStatic, regTmp, b, c, h, x, y, z, s,
       sparseLDLFact,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
+    if( ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        pos_orth::WarmStartShift( s, z, ctrl.warmStartMinMu );
 
     SparseMatrix<Real> J, JOrig;
     Matrix<Real> d,
                  w,
                  rc,    rb,    rh,    rmu,
                  dxAff, dyAff, dzAff, dsAff,
-                 dx,    dy,    dz,    ds;
+                 dx,    dy,    dz,    ds,
+                 dxTrial, dyTrial, dzTrial, dsTrial;
 
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError;
+
+    // The record of the current iteration for ctrl.iterationCallback
+    MehrotraIterationInfo<Real> info;
+    Timer iterationTimer, kktTimer, solveTimer;
+    const Real maxRegTmp = MaxNorm( regTmp );
+    auto finishIteration = [&]()
+      {
+        info.iterationTime = iterationTimer.Stop();
+        if( ctrl.iterationCallback )
+            ctrl.iterationCallback( info );
+      };
+    auto solveKKT = [&]( Matrix<Real>& rhs )
+      {
+        solveTimer.Start();
+        if( ctrl.resolveReg )
+            info.numRefineIts += reg_ldl::SolveAfter
+            ( JOrig, regTmp, dInner, sparseLDLFact, rhs, ctrl.solveCtrl );
+        else
+            info.numRefineIts += reg_ldl::RegularizedSolveAfter
+            ( JOrig, regTmp, dInner, sparseLDLFact, rhs,
+              ctrl.solveCtrl.relTol,
+              ctrl.solveCtrl.maxRefineIts,
+              ctrl.solveCtrl.progress );
+        info.solveTime += solveTimer.Stop();
+        ++info.numSolves;
+      };
+    Timer gondzioTimer;
+    double factorTime=0, solveTime=0;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        EL_REGION("qp::affine::Mehrotra iteration");
+        info = MehrotraIterationInfo<Real>();
+        info.numIts = numIts;
+        iterationTimer.Start();
         // Ensure that s and z are in the cone
         // ===================================
         const Int sNumNonPos = pos_orth::NumOutside( s );
@@ -897,8 +938,14 @@ void Mehrotra
              "  dual   = ",dualObj,"\n",Indent(),
              "  |primal - dual| / (1 + |primal|) = ",objConv);
         }
+        info.mu = mu;
+        info.relError = relError;
+        info.wMaxNorm = wMaxNorm;
         if( relError <= ctrl.targetTol )
+        {
+            finishIteration();
             break;
+        }
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -914,6 +961,7 @@ void Mehrotra
 
         // Construct the KKT system
         // ------------------------
+        kktTimer.Start();
         JOrig = JStatic;
         JOrig.FreezeSparsity();
         FinishKKT( m, n, s, z, JOrig );
@@ -926,6 +974,10 @@ void Mehrotra
             J = JOrig;
             J.FreezeSparsity();
             UpdateDiagonal( J, Real(1), regTmp );
+            info.kktTime = kktTimer.Stop();
+            info.kktHeight = J.Height();
+            info.maxRegTmp = maxRegTmp;
+            info.kktNumEntries = JOrig.NumEntries();
 
             if( wMaxNorm >= ctrl.ruizEquilTol )
                 SymmetricRuizEquil( J, dInner, ctrl.ruizMaxIter, ctrl.print );
@@ -934,6 +986,7 @@ void Mehrotra
             else
                 Ones( dInner, n+m+k, 1 );
 
+            gondzioTimer.Start();
             if( numIts == 0 && ctrl.primalInit && ctrl.dualInit )
             {
                 const bool hermitian = true;
@@ -946,16 +999,13 @@ void Mehrotra
             }
 
             sparseLDLFact.Factor();
+            factorTime = gondzioTimer.Stop();
+            info.factorTime = factorTime;
+            info.factorNumEntries = sparseLDLFact.NumEntries();
+            gondzioTimer.Start();
 
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress );
+            solveKKT( d );
+            solveTime = gondzioTimer.Stop();
         }
         catch(...)
         {
@@ -1018,6 +1068,9 @@ void Mehrotra
           ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print )
             Output("sigma=",sigma);
+        info.alphaAffPri = alphaAffPri;
+        info.alphaAffDual = alphaAffDual;
+        info.sigma = sigma;
 
         // Solve for the combined direction
         // ================================
@@ -1042,15 +1095,7 @@ void Mehrotra
         // ---------------------------
         try
         {
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress );
+            solveKKT( d );
         }
         catch(...)
         {
@@ -1062,6 +1107,43 @@ void Mehrotra
         }
         ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
 
+        // Apply Gondzio's multiple centrality correctors
+        // ----------------------------------------------
+        const Int numCorrs =
+          NumCentralityCorrectors( ctrl, factorTime, solveTime );
+        if( numCorrs > 0 )
+        {
+            auto solveTrial = [&]()
+              {
+                KKTRHS( rc, rb, rh, rmu, z, d );
+                try
+                {
+                    solveKKT( d );
+                }
+                catch(...) { return false; }
+                ExpandSolution
+                ( m, n, d, rmu, s, z, dxTrial, dyTrial, dzTrial, dsTrial );
+                return true;
+              };
+            auto acceptTrial =
+              [&]()
+              {
+                dx = dxTrial;
+                dy = dyTrial;
+                dz = dzTrial;
+                ds = dsTrial;
+              };
+            const Int numAccepted =
+              CentralityCorrectors
+              ( ctrl, numCorrs, sigma*mu, s, z, ds, dz, dsTrial, dzTrial,
+                rmu, solveTrial, acceptTrial );
+            info.numCorrectors = numAccepted;
+            if( ctrl.print )
+                Output
+                ("Accepted ",numAccepted," of ",numCorrs,
+                 " centrality correctors");
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( s, ds, 1/ctrl.maxStepRatio );
@@ -1076,6 +1158,9 @@ void Mehrotra
         Axpy( alphaPri,  ds, s );
         Axpy( alphaDual, dy, y );
         Axpy( alphaDual, dz, z );
+        info.alphaPri = alphaPri;
+        info.alphaDual = alphaDual;
+        finishIteration();
         if( alphaPri == Real(0) && alphaDual == Real(0) )
         {
             if( relError <= ctrl.minTol )
@@ -1117,7 +1202,7 @@ void Mehrotra
 
     const Grid& grid = APre.Grid();
     const int commRank = grid.Rank();
-    Timer timer, iterTimer;
+    Timer timer, iterTimer, gondzioTimer;
 
     // Equilibrate the QP by diagonally scaling [A;G]
     auto Q = QPre;
@@ -1225,6 +1310,8 @@ void Mehrotra
     ( JStatic, regTmp, b, c, h, x, y, z, s,
       sparseLDLFact,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
+    if( ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        pos_orth::WarmStartShift( s, z, ctrl.warmStartMinMu );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
 
@@ -1232,14 +1319,47 @@ void Mehrotra
     DistMultiVec<Real> d(grid), w(grid),
                        rc(grid),    rb(grid),    rh(grid),    rmu(grid),
                        dxAff(grid), dyAff(grid), dzAff(grid), dsAff(grid),
-                       dx(grid),    dy(grid),    dz(grid),    ds(grid);
+                       dx(grid),    dy(grid),    dz(grid),    ds(grid),
+                       dxTrial(grid), dyTrial(grid),
+                       dzTrial(grid), dsTrial(grid);
 
     Real relError = 1;
     DistMultiVec<Real> dInner(grid);
     DistMultiVec<Real> dxError(grid), dyError(grid), dzError(grid);
+
+    // The record of the current iteration for ctrl.iterationCallback
+    MehrotraIterationInfo<Real> info;
+    Timer iterationTimer, kktTimer, solveTimer;
+    const Real maxRegTmp = MaxNorm( regTmp );
+    auto finishIteration = [&]()
+      {
+        info.iterationTime = iterationTimer.Stop();
+        if( ctrl.iterationCallback )
+            ctrl.iterationCallback( info );
+      };
+    auto solveKKT = [&]( DistMultiVec<Real>& rhs )
+      {
+        solveTimer.Start();
+        if( ctrl.resolveReg )
+            info.numRefineIts += reg_ldl::SolveAfter
+            ( JOrig, regTmp, dInner, sparseLDLFact, rhs, ctrl.solveCtrl );
+        else
+            info.numRefineIts += reg_ldl::RegularizedSolveAfter
+            ( JOrig, regTmp, dInner, sparseLDLFact, rhs,
+              ctrl.solveCtrl.relTol,
+              ctrl.solveCtrl.maxRefineIts,
+              ctrl.solveCtrl.progress );
+        info.solveTime += solveTimer.Stop();
+        ++info.numSolves;
+      };
+    double factorTime=0, solveTime=0;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        EL_REGION("qp::affine::Mehrotra iteration");
+        info = MehrotraIterationInfo<Real>();
+        info.numIts = numIts;
+        iterationTimer.Start();
         if( ctrl.time && commRank == 0 )
             iterTimer.Start();
 
@@ -1320,8 +1440,14 @@ void Mehrotra
                  "  dual   = ",dualObj,"\n",Indent(),
                  "  |primal - dual| / (1 + |primal|) = ",objConv);
         }
+        info.mu = mu;
+        info.relError = relError;
+        info.wMaxNorm = wMaxNorm;
         if( relError <= ctrl.targetTol )
+        {
+            finishIteration();
             break;
+        }
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without "
@@ -1337,6 +1463,7 @@ void Mehrotra
 
         // Construct the KKT system
         // ------------------------
+        kktTimer.Start();
         JOrig = JStatic;
         JOrig.FreezeSparsity();
         JOrig.LockedDistGraph().multMeta = JStatic.LockedDistGraph().multMeta;
@@ -1351,6 +1478,11 @@ void Mehrotra
             J.FreezeSparsity();
             J.LockedDistGraph().multMeta = JStatic.LockedDistGraph().multMeta;
             UpdateDiagonal( J, Real(1), regTmp );
+            info.kktTime = kktTimer.Stop();
+            info.kktHeight = J.Height();
+            info.maxRegTmp = maxRegTmp;
+            if( ctrl.iterationCallback )
+                info.kktNumEntries = JOrig.NumEntries();
 
             if( commRank == 0 && ctrl.time )
                 timer.Start();
@@ -1363,6 +1495,7 @@ void Mehrotra
             if( commRank == 0 && ctrl.time )
                 Output("Equilibration: ",timer.Stop()," secs");
 
+            gondzioTimer.Start();
             if( numIts == 0 && ctrl.primalInit && ctrl.dualInit )
             {
                 const bool hermitian = true;
@@ -1380,20 +1513,20 @@ void Mehrotra
                 sparseLDLFact.Factor( LDL_2D );
             else
                 sparseLDLFact.Factor( LDL_SELINV_2D );
+            factorTime = gondzioTimer.Stop();
+            info.factorTime = factorTime;
+            if( ctrl.iterationCallback )
+                info.factorNumEntries =
+                  mpi::AllReduce
+                  ( sparseLDLFact.NumLocalEntries(), grid.Comm() );
+            gondzioTimer.Start();
             if( commRank == 0 && ctrl.time )
                 Output("LDL: ",timer.Stop()," secs");
 
             if( commRank == 0 && ctrl.time )
                 timer.Start();
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress );
+            solveKKT( d );
+            solveTime = gondzioTimer.Stop();
             if( commRank == 0 && ctrl.time )
                 Output("Affine solve: ",timer.Stop()," secs");
         }
@@ -1459,6 +1592,9 @@ void Mehrotra
           ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print && commRank == 0 )
             Output("sigma=",sigma);
+        info.alphaAffPri = alphaAffPri;
+        info.alphaAffDual = alphaAffDual;
+        info.sigma = sigma;
 
         // Solve for the combined direction
         // ================================
@@ -1485,15 +1621,7 @@ void Mehrotra
         {
             if( commRank == 0 && ctrl.time )
                 timer.Start();
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress );
+            solveKKT( d );
             if( commRank == 0 && ctrl.time )
                 Output("Corrector solver: ",timer.Stop()," secs");
         }
@@ -1507,6 +1635,49 @@ void Mehrotra
         }
         ExpandSolution( m, n, d, rmu, s, z, dx, dy, dz, ds );
 
+        // Apply Gondzio's multiple centrality correctors
+        // ----------------------------------------------
+        if( ctrl.maxGondzioCorrs > 0 )
+        {
+            // Ensure that every process attempts the same number
+            factorTime = mpi::AllReduce( factorTime, mpi::MAX, grid.Comm() );
+            solveTime = mpi::AllReduce( solveTime, mpi::MAX, grid.Comm() );
+        }
+        const Int numCorrs =
+          NumCentralityCorrectors( ctrl, factorTime, solveTime );
+        if( numCorrs > 0 )
+        {
+            auto solveTrial = [&]()
+              {
+                KKTRHS( rc, rb, rh, rmu, z, d );
+                try
+                {
+                    solveKKT( d );
+                }
+                catch(...) { return false; }
+                ExpandSolution
+                ( m, n, d, rmu, s, z, dxTrial, dyTrial, dzTrial, dsTrial );
+                return true;
+              };
+            auto acceptTrial =
+              [&]()
+              {
+                dx = dxTrial;
+                dy = dyTrial;
+                dz = dzTrial;
+                ds = dsTrial;
+              };
+            const Int numAccepted =
+              CentralityCorrectors
+              ( ctrl, numCorrs, sigma*mu, s, z, ds, dz, dsTrial, dzTrial,
+                rmu, solveTrial, acceptTrial );
+            info.numCorrectors = numAccepted;
+            if( ctrl.print && commRank == 0 )
+                Output
+                ("Accepted ",numAccepted," of ",numCorrs,
+                 " centrality correctors");
+        }
+
         // Update the current estimates
         // ============================
         Real alphaPri = pos_orth::MaxStep( s, ds, 1/ctrl.maxStepRatio );
@@ -1521,6 +1692,9 @@ void Mehrotra
         Axpy( alphaPri,  ds, s );
         Axpy( alphaDual, dy, y );
         Axpy( alphaDual, dz, z );
+        info.alphaPri = alphaPri;
+        info.alphaDual = alphaDual;
+        finishIteration();
         if( ctrl.time && commRank == 0 )
             Output("iteration: ",iterTimer.Stop()," secs");
         if( alphaPri == Real(0) && alphaDual == Real(0) )
@@ -221,6 +221,111 @@ void ExpandSolution
         DistMultiVec<Real>& dz,
         DistMultiVec<Real>& ds );
 
+// Gondzio's multiple centrality correctors
+// ========================================
+
+// Return the number of centrality correctors to attempt given the time
+// required for factoring the KKT system and for a single solve against the
+// factorization. Since each corrector costs a single solve, the more
+// expensive the factorization is relative to a solve, the more correctors
+// can be afforded.
+template<typename Real>
+Int NumCentralityCorrectors
+( const MehrotraCtrl<Real>& ctrl, double factorTime, double solveTime )
+{
+    if( ctrl.maxGondzioCorrs <= 0 )
+        return 0;
+    if( !ctrl.adaptiveGondzio || solveTime <= 0. )
+        return ctrl.maxGondzioCorrs;
+    const double ratio = factorTime / solveTime;
+    Int numCorrs;
+    if( ratio <= 10. )
+        numCorrs = 1;
+    else if( ratio <= 30. )
+        numCorrs = 2;
+    else if( ratio <= 50. )
+        numCorrs = 3;
+    else
+        numCorrs = 4;
+    return Min( numCorrs, ctrl.maxGondzioCorrs );
+}
+
+// Attempt to lengthen the step along the (primal-dual) direction with conic
+// components (ds,dz) by repeatedly targeting the complementarity products of
+// a trial point with a slightly longer step toward a neighborhood of the
+// central path. 'solveTrial()' should compute a trial direction, with conic
+// components (dsTrial,dzTrial), from the current value of the
+// complementarity residual 'rmu', and 'acceptTrial()' should overwrite the
+// direction with the trial direction. A trial direction is only accepted if
+// it increases the step length by a fixed fraction of the targeted increase;
+// otherwise, the modification of 'rmu' is reverted and the process stops.
+// The number of accepted correctors is returned.
+template<typename Real,class VectorType,class SolveType,class AcceptType>
+Int CentralityCorrectors
+( const MehrotraCtrl<Real>& ctrl,
+  Int numCorrs,
+  Real mu,
+  const VectorType& s,
+  const VectorType& z,
+  const VectorType& ds,
+  const VectorType& dz,
+  const VectorType& dsTrial,
+  const VectorType& dzTrial,
+        VectorType& rmu,
+  const SolveType& solveTrial,
+  const AcceptType& acceptTrial )
+{
+    EL_DEBUG_CSE
+    // The amount by which the step length is targeted to increase, and the
+    // fraction of said amount which must be achieved
+    const Real stepIncrease = Real(1)/Real(10);
+    const Real minIncrease = stepIncrease/Real(10);
+
+    auto stepLengths =
+      [&]( const VectorType& dsDir, const VectorType& dzDir,
+           Real& alphaPri, Real& alphaDual )
+      {
+          alphaPri = pos_orth::MaxStep( s, dsDir, 1/ctrl.maxStepRatio );
+          alphaDual = pos_orth::MaxStep( z, dzDir, 1/ctrl.maxStepRatio );
+          alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
+          alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
+          if( ctrl.forceSameStep )
+              alphaPri = alphaDual = Min(alphaPri,alphaDual);
+      };
+
+    Real alphaPri, alphaDual;
+    stepLengths( ds, dz, alphaPri, alphaDual );
+    VectorType correction( rmu );
+    Int numAccepted = 0;
+    for( Int corr=0; corr<numCorrs; ++corr )
+    {
+        const Real alpha = Min(alphaPri,alphaDual);
+        if( alpha >= Real(1) )
+            break;
+        pos_orth::CentralityCorrection
+        ( s, ds, z, dz,
+          Min(alphaPri+stepIncrease,Real(1)),
+          Min(alphaDual+stepIncrease,Real(1)),
+          mu, correction );
+        Axpy( Real(1), correction, rmu );
+
+        Real alphaPriTrial=0, alphaDualTrial=0;
+        const bool solved = solveTrial();
+        if( solved )
+            stepLengths( dsTrial, dzTrial, alphaPriTrial, alphaDualTrial );
+        if( !solved || Min(alphaPriTrial,alphaDualTrial) < alpha+minIncrease )
+        {
+            Axpy( Real(-1), correction, rmu );
+            break;
+        }
+        acceptTrial();
+        alphaPri = alphaPriTrial;
+        alphaDual = alphaDualTrial;
+        ++numAccepted;
+    }
+    return numAccepted;
+}
+
 } // namespace affine
 } // namespace qp
 } // namespace El
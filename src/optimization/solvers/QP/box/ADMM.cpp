@@ -30,6 +30,7 @@ template<typename Real,
 Int
 ADMM
 ( const Matrix<Real>& Q,
+        ShiftedHermitianSolver<Real>& solver,
   const Matrix<Real>& C,
         Real lb,
         Real ub,
@@ -39,19 +40,12 @@ ADMM
     EL_DEBUG_CSE
     const Int n = Q.Height();
     const Int k = C.Width();
+    const Int checkFrequency = Max( ctrl.checkFrequency, Int(1) );
 
-    // Cache the factorization of Q + rho*I
-    Matrix<Real> LMod( Q );
-    ShiftDiagonal( LMod, ctrl.rho );
-    if( ctrl.inv )
-    {
-        HPDInverse( LOWER, LMod );
-    }
-    else
-    {
-        Cholesky( LOWER, LMod );
-        MakeTrapezoidal( LOWER, LMod );
-    }
+    // Cache the factorization of Q + rho*I (unless it was kept from a
+    // previous call)
+    if( !solver.Initialized() )
+        solver.Initialize( Q, ctrl.rho, ctrl.adaptiveRho, ctrl.inv );
 
     // Start the ADMM
     Int numIter=0;
@@ -61,23 +55,15 @@ ADMM
     Zeros( T, n, k );
     while( numIter < ctrl.maxIter )
     {
+        const Real rho = solver.Shift();
         ZOld = Z;
 
         // x := (Q+rho*I)^{-1} (rho(z-u)-q)
         X = Z;
         X -= U;
-        X *= ctrl.rho;
+        X *= rho;
         X -= C;
-        if( ctrl.inv )
-        {
-            auto Y( X );
-            Hemm( LEFT, LOWER, Real(1), LMod, Y, Real(0), X );
-        }
-        else
-        {
-            Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Real(1), LMod, X );
-            Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, Real(1), LMod, X );
-        }
+        solver.Solve( X );
 
         // xHat := alpha*x + (1-alpha)*zOld
         XHat = X;
@@ -93,6 +79,13 @@ ADMM
         U += XHat;
         U -= Z;
 
+        const bool check = Mod(numIter+1,checkFrequency) == 0;
+        if( !check && !ctrl.print )
+        {
+            ++numIter;
+            continue;
+        }
+
         // rNorm := || x - z ||_2
         T = X;
         T -= Z;
@@ -101,12 +94,12 @@ ADMM
         // sNorm := |rho| || z - zOld ||_2
         T = Z;
         T -= ZOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( T );
+        const Real sNorm = Abs(rho)*FrobeniusNorm( T );
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
             ctrl.relTol*Max(FrobeniusNorm(X),FrobeniusNorm(Z));
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(U);
+            ctrl.relTol*Abs(rho)*FrobeniusNorm(U);
 
         if( ctrl.print )
         {
@@ -127,8 +120,25 @@ ADMM
               << "||X-Clip(X,lb,ub)||_F=" << clipDist << ", "
               << "(1/2) <X,Q X> + <C,X>=" << objective << endl;
         }
-        if( rNorm < epsPri && sNorm < epsDual )
-            break;
+        if( check )
+        {
+            if( rNorm < epsPri && sNorm < epsDual )
+                break;
+            if( ctrl.adaptiveRho )
+            {
+                // Balance the residuals, rescaling the scaled dual variable
+                if( rNorm > ctrl.rhoBalance*sNorm )
+                {
+                    solver.SetShift( rho*ctrl.rhoScale );
+                    U *= 1/ctrl.rhoScale;
+                }
+                else if( sNorm > ctrl.rhoBalance*rNorm )
+                {
+                    solver.SetShift( rho/ctrl.rhoScale );
+                    U *= ctrl.rhoScale;
+                }
+            }
+        }
         ++numIter;
     }
     if( ctrl.maxIter == numIter )
@@ -136,11 +146,28 @@ ADMM
     return numIter;
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+Int
+ADMM
+( const Matrix<Real>& Q,
+  const Matrix<Real>& C,
+        Real lb,
+        Real ub,
+        Matrix<Real>& Z,
+  const ADMMCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    ShiftedHermitianSolver<Real> solver;
+    return ADMM( Q, solver, C, lb, ub, Z, ctrl );
+}
+
 template<typename Real,
          typename/*=EnableIf<IsReal<Real>>*/>
 Int
 ADMM
 ( const AbstractDistMatrix<Real>& QPre,
+        DistShiftedHermitianSolver<Real>& solver,
   const AbstractDistMatrix<Real>& CPre,
         Real lb,
         Real ub,
@@ -161,19 +188,12 @@ ADMM
     const Grid& grid = Q.Grid();
     const Int n = Q.Height();
     const Int k = C.Width();
+    const Int checkFrequency = Max( ctrl.checkFrequency, Int(1) );
 
-    // Cache the factorization of Q + rho*I
-    DistMatrix<Real> LMod( Q );
-    ShiftDiagonal( LMod, ctrl.rho );
-    if( ctrl.inv )
-    {
-        HPDInverse( LOWER, LMod );
-    }
-    else
-    {
-        Cholesky( LOWER, LMod );
-        MakeTrapezoidal( LOWER, LMod );
-    }
+    // Cache the factorization of Q + rho*I (unless it was kept from a
+    // previous call)
+    if( !solver.Initialized() )
+        solver.Initialize( Q, ctrl.rho, ctrl.adaptiveRho, ctrl.inv );
 
     // Start the ADMM
     Int numIter=0;
@@ -183,23 +203,15 @@ ADMM
     Zeros( T, n, k );
     while( numIter < ctrl.maxIter )
     {
+        const Real rho = solver.Shift();
         ZOld = Z;
 
         // x := (Q+rho*I)^{-1} (rho(z-u)-q)
         X = Z;
         X -= U;
-        X *= ctrl.rho;
+        X *= rho;
         X -= C;
-        if( ctrl.inv )
-        {
-            auto Y( X );
-            Hemm( LEFT, LOWER, Real(1), LMod, Y, Real(0), X );
-        }
-        else
-        {
-            Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Real(1), LMod, X );
-            Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, Real(1), LMod, X );
-        }
+        solver.Solve( X );
 
         // xHat := alpha*x + (1-alpha)*zOld
         XHat = X;
@@ -215,6 +227,13 @@ ADMM
         U += XHat;
         U -= Z;
 
+        const bool check = Mod(numIter+1,checkFrequency) == 0;
+        if( !check && !ctrl.print )
+        {
+            ++numIter;
+            continue;
+        }
+
         // rNorm := || x - z ||_2
         T = X;
         T -= Z;
@@ -223,12 +242,12 @@ ADMM
         // sNorm := |rho| || z - zOld ||_2
         T = Z;
         T -= ZOld;
-        const Real sNorm = Abs(ctrl.rho)*FrobeniusNorm( T );
+        const Real sNorm = Abs(rho)*FrobeniusNorm( T );
 
         const Real epsPri = Sqrt(Real(n))*ctrl.absTol +
             ctrl.relTol*Max(FrobeniusNorm(X),FrobeniusNorm(Z));
         const Real epsDual = Sqrt(Real(n))*ctrl.absTol +
-            ctrl.relTol*Abs(ctrl.rho)*FrobeniusNorm(U);
+            ctrl.relTol*Abs(rho)*FrobeniusNorm(U);
 
         if( ctrl.print )
         {
@@ -250,8 +269,25 @@ ADMM
                   << "||X-Clip(X,lb,ub)||_2=" << clipDist << ", "
                   << "(1/2) <X,Q X> + <C,X>=" << objective << endl;
         }
-        if( rNorm < epsPri && sNorm < epsDual )
-            break;
+        if( check )
+        {
+            if( rNorm < epsPri && sNorm < epsDual )
+                break;
+            if( ctrl.adaptiveRho )
+            {
+                // Balance the residuals, rescaling the scaled dual variable
+                if( rNorm > ctrl.rhoBalance*sNorm )
+                {
+                    solver.SetShift( rho*ctrl.rhoScale );
+                    U *= 1/ctrl.rhoScale;
+                }
+                else if( sNorm > ctrl.rhoBalance*rNorm )
+                {
+                    solver.SetShift( rho/ctrl.rhoScale );
+                    U *= ctrl.rhoScale;
+                }
+            }
+        }
         ++numIter;
     }
     if( ctrl.maxIter == numIter )
@@ -259,8 +295,32 @@ ADMM
     return numIter;
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+Int
+ADMM
+( const AbstractDistMatrix<Real>& Q,
+  const AbstractDistMatrix<Real>& C,
+        Real lb,
+        Real ub,
+        AbstractDistMatrix<Real>& Z,
+  const ADMMCtrl<Real>& ctrl )
+{
+    EL_DEBUG_CSE
+    DistShiftedHermitianSolver<Real> solver;
+    return ADMM( Q, solver, C, lb, ub, Z, ctrl );
+}
+
 #define PROTO(Real) \
   template Int ADMM \
+  ( const Matrix<Real>& Q, \
+          ShiftedHermitianSolver<Real>& solver, \
+    const Matrix<Real>& C, \
+          Real lb, \
+          Real ub, \
+          Matrix<Real>& Z, \
+    const ADMMCtrl<Real>& ctrl ); \
+  template Int ADMM \
   ( const Matrix<Real>& Q, \
     const Matrix<Real>& C, \
           Real lb, \
@@ -268,6 +328,14 @@ ADMM
           Matrix<Real>& Z, \
     const ADMMCtrl<Real>& ctrl ); \
   template Int ADMM \
+  ( const AbstractDistMatrix<Real>& Q, \
+          DistShiftedHermitianSolver<Real>& solver, \
+    const AbstractDistMatrix<Real>& C, \
+          Real lb, \
+          Real ub, \
+          AbstractDistMatrix<Real>& Z, \
+    const ADMMCtrl<Real>& ctrl ); \
+  template Int ADMM \
   ( const AbstractDistMatrix<Real>& Q, \
     const AbstractDistMatrix<Real>& C, \
           Real lb, \
@@ -94,6 +94,8 @@ void Mehrotra
     Initialize
     ( Q, A, b, c, x, y, z,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+    if( ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        pos_orth::WarmStartShift( x, z, ctrl.warmStartMinMu );
 
     Real relError = 1;
     Matrix<Real> J, d,
@@ -106,6 +108,7 @@ void Mehrotra
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        EL_REGION("qp::direct::Mehrotra iteration");
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( x );
@@ -464,6 +467,8 @@ void Mehrotra
     Initialize
     ( Q, A, b, c, x, y, z,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+    if( ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        pos_orth::WarmStartShift( x, z, ctrl.warmStartMinMu );
 
     Real relError = 1;
     DistMatrix<Real>
@@ -483,6 +488,7 @@ void Mehrotra
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        EL_REGION("qp::direct::Mehrotra iteration");
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( x );
@@ -834,6 +840,8 @@ void Mehrotra
           ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
+    if( ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        pos_orth::WarmStartShift( x, z, ctrl.warmStartMinMu );
 
     Matrix<Real> regTmp;
     if( ctrl.system == FULL_KKT )
@@ -867,9 +875,39 @@ void Mehrotra
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError, prod;
+
+    // The record of the current iteration for ctrl.iterationCallback
+    MehrotraIterationInfo<Real> info;
+    Timer iterationTimer, kktTimer, factorTimer, solveTimer;
+    const Real maxRegTmp = MaxNorm( regTmp );
+    auto finishIteration = [&]()
+      {
+        info.iterationTime = iterationTimer.Stop();
+        if( ctrl.iterationCallback )
+            ctrl.iterationCallback( info );
+      };
+    auto solveKKT = [&]( Matrix<Real>& rhs )
+      {
+        solveTimer.Start();
+        if( ctrl.resolveReg )
+            info.numRefineIts += reg_ldl::SolveAfter
+            ( JOrig, regTmp, dInner, sparseLDLFact, rhs, ctrl.solveCtrl );
+        else
+            info.numRefineIts += reg_ldl::RegularizedSolveAfter
+            ( JOrig, regTmp, dInner, sparseLDLFact, rhs,
+              ctrl.solveCtrl.relTol,
+              ctrl.solveCtrl.maxRefineIts,
+              ctrl.solveCtrl.progress );
+        info.solveTime += solveTimer.Stop();
+        ++info.numSolves;
+      };
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        EL_REGION("qp::direct::Mehrotra iteration");
+        info = MehrotraIterationInfo<Real>();
+        info.numIts = numIts;
+        iterationTimer.Start();
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( x );
@@ -934,8 +972,14 @@ void Mehrotra
              "  dual   = ",dualObj,"\n",Indent(),
              "  |primal - dual| / (1 + |primal|) = ",objConv);
         }
+        info.mu = mu;
+        info.relError = relError;
+        info.wMaxNorm = wMaxNorm;
         if( relError <= ctrl.targetTol )
+        {
+            finishIteration();
             break;
+        }
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -953,6 +997,7 @@ void Mehrotra
         {
             // Form the KKT system
             // -------------------
+            kktTimer.Start();
             if( ctrl.system == FULL_KKT )
             {
                 KKT
@@ -969,6 +1014,10 @@ void Mehrotra
             }
             J = JOrig;
             UpdateDiagonal( J, Real(1), regTmp );
+            info.kktTime = kktTimer.Stop();
+            info.kktHeight = J.Height();
+            info.maxRegTmp = maxRegTmp;
+            info.kktNumEntries = JOrig.NumEntries();
 
             // Solve for the direction
             // -----------------------
@@ -995,16 +1044,11 @@ void Mehrotra
                     sparseLDLFact.ChangeNonzeroValues( J );
                 }
 
+                factorTimer.Start();
                 sparseLDLFact.Factor( LDL_2D );
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
+                info.factorTime = factorTimer.Stop();
+                info.factorNumEntries = sparseLDLFact.NumEntries();
+                solveKKT( d );
             }
             catch(...)
             {
@@ -1074,6 +1118,9 @@ void Mehrotra
           ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print )
             Output("sigma=",sigma);
+        info.alphaAffPri = alphaAffPri;
+        info.alphaAffDual = alphaAffDual;
+        info.sigma = sigma;
 
         // Compute the combined direction
         // ==============================
@@ -1099,15 +1146,7 @@ void Mehrotra
             // -----------------------
             try
             {
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
+                solveKKT( d );
             }
             catch(...)
             {
@@ -1128,15 +1167,7 @@ void Mehrotra
             // -----------------------
             try
             {
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
+                solveKKT( d );
             }
             catch(...)
             {
@@ -1165,6 +1196,9 @@ void Mehrotra
         Axpy( alphaPri,  dx, x );
         Axpy( alphaDual, dy, y );
         Axpy( alphaDual, dz, z );
+        info.alphaPri = alphaPri;
+        info.alphaDual = alphaDual;
+        finishIteration();
         if( alphaPri == Real(0) && alphaDual == Real(0) )
         {
             if( relError <= ctrl.minTol )
@@ -1282,6 +1316,8 @@ void Mehrotra
           ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift,
           ctrl.solveCtrl );
     }
+    if( ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        pos_orth::WarmStartShift( x, z, ctrl.warmStartMinMu );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
 
@@ -1322,9 +1358,39 @@ void Mehrotra
     Real relError = 1;
     DistMultiVec<Real> dInner(grid);
     DistMultiVec<Real> dxError(grid), dyError(grid), dzError(grid), prod(grid);
+
+    // The record of the current iteration for ctrl.iterationCallback
+    MehrotraIterationInfo<Real> info;
+    Timer iterationTimer, kktTimer, factorTimer, solveTimer;
+    const Real maxRegTmp = MaxNorm( regTmp );
+    auto finishIteration = [&]()
+      {
+        info.iterationTime = iterationTimer.Stop();
+        if( ctrl.iterationCallback )
+            ctrl.iterationCallback( info );
+      };
+    auto solveKKT = [&]( DistMultiVec<Real>& rhs )
+      {
+        solveTimer.Start();
+        if( ctrl.resolveReg )
+            info.numRefineIts += reg_ldl::SolveAfter
+            ( JOrig, regTmp, dInner, sparseLDLFact, rhs, ctrl.solveCtrl );
+        else
+            info.numRefineIts += reg_ldl::RegularizedSolveAfter
+            ( JOrig, regTmp, dInner, sparseLDLFact, rhs,
+              ctrl.solveCtrl.relTol,
+              ctrl.solveCtrl.maxRefineIts,
+              ctrl.solveCtrl.progress );
+        info.solveTime += solveTimer.Stop();
+        ++info.numSolves;
+      };
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        EL_REGION("qp::direct::Mehrotra iteration");
+        info = MehrotraIterationInfo<Real>();
+        info.numIts = numIts;
+        iterationTimer.Start();
         // Ensure that x and z are in the cone
         // ===================================
         const Int xNumNonPos = pos_orth::NumOutside( x );
@@ -1388,8 +1454,14 @@ void Mehrotra
                  "  dual   = ",dualObj,"\n",Indent(),
                  "  |primal - dual| / (1 + |primal|) = ",objConv);
         }
+        info.mu = mu;
+        info.relError = relError;
+        info.wMaxNorm = wMaxNorm;
         if( relError <= ctrl.targetTol )
+        {
+            finishIteration();
             break;
+        }
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Maximum number of iterations (",ctrl.maxIts,") exceeded without ",
@@ -1407,6 +1479,7 @@ void Mehrotra
         {
             // Form the KKT system
             // -------------------
+            kktTimer.Start();
             if( ctrl.system == FULL_KKT )
             {
                 KKT
@@ -1422,6 +1495,11 @@ void Mehrotra
             }
             J = JOrig;
             UpdateDiagonal( J, Real(1), regTmp );
+            info.kktTime = kktTimer.Stop();
+            info.kktHeight = J.Height();
+            info.maxRegTmp = maxRegTmp;
+            if( ctrl.iterationCallback )
+                info.kktNumEntries = JOrig.NumEntries();
             if( numIts == 0 )
             {
                 if( ctrl.print )
@@ -1472,21 +1550,19 @@ void Mehrotra
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
+                factorTimer.Start();
                 sparseLDLFact.Factor( LDL_2D );
+                info.factorTime = factorTimer.Stop();
+                if( ctrl.iterationCallback )
+                    info.factorNumEntries =
+                      mpi::AllReduce
+                      ( sparseLDLFact.NumLocalEntries(), grid.Comm() );
                 if( commRank == 0 && ctrl.time )
                     Output("LDL: ",timer.Stop()," secs");
 
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
+                solveKKT( d );
                 if( commRank == 0 && ctrl.time )
                     Output("Affine: ",timer.Stop()," secs");
             }
@@ -1559,6 +1635,9 @@ void Mehrotra
           ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print )
             Output("sigma=",sigma);
+        info.alphaAffPri = alphaAffPri;
+        info.alphaAffDual = alphaAffDual;
+        info.sigma = sigma;
 
         // Solve for the combined direction
         // ================================
@@ -1586,15 +1665,7 @@ void Mehrotra
             {
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
+                solveKKT( d );
                 if( commRank == 0 && ctrl.time )
                     Output("Corrector: ",timer.Stop()," secs");
             }
@@ -1619,15 +1690,7 @@ void Mehrotra
             {
                 if( commRank == 0 && ctrl.time )
                     timer.Start();
-                if( ctrl.resolveReg )
-                    reg_ldl::SolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-                else
-                    reg_ldl::RegularizedSolveAfter
-                    ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                      ctrl.solveCtrl.relTol,
-                      ctrl.solveCtrl.maxRefineIts,
-                      ctrl.solveCtrl.progress );
+                solveKKT( d );
                 if( commRank == 0 && ctrl.time )
                     Output("Corrector: ",timer.Stop()," secs");
             }
@@ -1658,6 +1721,9 @@ void Mehrotra
         Axpy( alphaPri,  dx, x );
         Axpy( alphaDual, dy, y );
         Axpy( alphaDual, dz, z );
+        info.alphaPri = alphaPri;
+        info.alphaDual = alphaDual;
+        finishIteration();
         if( alphaPri == Real(0) && alphaDual == Real(0) )
         {
             if( relError <= ctrl.minTol )
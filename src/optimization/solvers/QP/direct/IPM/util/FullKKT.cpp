@@ -321,7 +321,7 @@ void KKT
     {
         const Int i = m+n + x.GlobalRow(iLoc);
         const Real value = -x.GetLocal(iLoc,0)/z.GetLocal(iLoc,0)-beta*beta;
-        J.QueueUpdate( i+(n+m), i+(n+m), value );
+        J.QueueUpdate( i, i, value );
     }
     J.ProcessQueues();
     J.FreezeSparsity();
@@ -103,6 +103,9 @@ void Mehrotra
     Initialize
     ( A, G, b, c, h, orders, firstInds, x, y, z, s,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift );
+    if( ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        soc::WarmStartShift
+        ( s, z, orders, firstInds, ctrl.warmStartMinMu );
 
     Real relError = 1;
     Matrix<Real> J, d,
@@ -118,6 +121,7 @@ void Mehrotra
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        EL_REGION("socp::affine::Mehrotra iteration");
         // Ensure that s and z are in the cone
         // ===================================
         const Real minDist = eps;
@@ -461,6 +465,10 @@ void Mehrotra
     Initialize
     ( A, G, b, c, h, orders, firstInds, x, y, z, s,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift, cutoffPar );
+    if( ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        soc::WarmStartShift
+        ( s, z, orders, firstInds, ctrl.warmStartMinMu, Real(0.1),
+          cutoffPar );
 
     Real relError = 1;
     DistMatrix<Real> J(grid),     d(grid),
@@ -488,6 +496,7 @@ void Mehrotra
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        EL_REGION("socp::affine::Mehrotra iteration");
         // Ensure that s and z are in the cone
         // ===================================
         const Real minDist = eps;
@@ -823,6 +832,9 @@ void Mehrotra
     Initialize
     ( A, G, b, c, h, orders, firstInds, x, y, z, s,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift, ctrl.solveCtrl );
+    if( ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        soc::WarmStartShift
+        ( s, z, orders, firstInds, ctrl.warmStartMinMu );
 
     // Form the offsets for the sparse embedding of the barrier's Hessian
     // ==================================================================
@@ -895,9 +907,40 @@ void Mehrotra
     Real relError = 1;
     Matrix<Real> dInner;
     Matrix<Real> dxError, dyError, dzError, dmuError;
+
+    // The record of the current iteration for ctrl.iterationCallback
+    MehrotraIterationInfo<Real> info;
+    Timer iterationTimer, kktTimer, factorTimer, solveTimer;
+    const Real maxRegTmp = MaxNorm( regTmp );
+    auto finishIteration = [&]()
+      {
+        info.iterationTime = iterationTimer.Stop();
+        if( ctrl.iterationCallback )
+            ctrl.iterationCallback( info );
+      };
+    auto solveKKT = [&]( Matrix<Real>& rhs )
+      {
+        // TODO(poulson): Make use of a better interface to these routines.
+        solveTimer.Start();
+        if( ctrl.resolveReg )
+            info.numRefineIts += reg_ldl::SolveAfter
+            ( JOrig, regTmp, dInner, sparseLDLFact, rhs, ctrl.solveCtrl );
+        else
+            info.numRefineIts += reg_ldl::RegularizedSolveAfter
+            ( JOrig, regTmp, dInner, sparseLDLFact, rhs,
+              ctrl.solveCtrl.relTol,
+              ctrl.solveCtrl.maxRefineIts,
+              ctrl.solveCtrl.progress );
+        info.solveTime += solveTimer.Stop();
+        ++info.numSolves;
+      };
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        EL_REGION("socp::affine::Mehrotra iteration");
+        info = MehrotraIterationInfo<Real>();
+        info.numIts = numIts;
+        iterationTimer.Start();
         // Ensure that s and z are in the cone
         // ===================================
         const Real minDist = eps;
@@ -960,16 +1003,24 @@ void Mehrotra
              "  dual   = ",dualObj,"\n",Indent(),
              "  |primal - dual| / (1 + |primal|) = ",objConv);
         }
+        info.relError = relError;
         if( relError <= ctrl.targetTol )
+        {
+            finishIteration();
             break;
+        }
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Reached maximum number of iterations, ",ctrl.maxIts,
              ", with rel. error ",relError," which does not meet the minimum ",
              "tolerance of ",ctrl.minTol);
         Real wMaxNorm = MaxNorm(w);
+        info.wMaxNorm = wMaxNorm;
         if( wMaxNorm >= ctrl.wMaxLimit && relError <= ctrl.minTol )
+        {
+            finishIteration();
             break;
+        }
 
         // Compute the affine search direction
         // ===================================
@@ -986,6 +1037,8 @@ void Mehrotra
         soc::ApplyQuadratic( wRoot, z, l, orders, firstInds );
         soc::Inverse( l, lInv, orders, firstInds );
         const Real mu = Dot(s,z) / degree;
+        info.mu = mu;
+        info.wMaxNorm = wMaxNorm;
 
         // r_mu := l
         // ---------
@@ -993,6 +1046,7 @@ void Mehrotra
 
         // Form the KKT system
         // -------------------
+        kktTimer.Start();
         JOrig = JStatic;
         JOrig.FreezeSparsity();
         FinishKKT
@@ -1006,6 +1060,10 @@ void Mehrotra
         J = JOrig;
         J.FreezeSparsity();
         UpdateDiagonal( J, Real(1), regTmp );
+        info.kktTime = kktTimer.Stop();
+        info.kktHeight = J.Height();
+        info.maxRegTmp = maxRegTmp;
+        info.kktNumEntries = JOrig.NumEntries();
 
         // Solve for the direction
         // -----------------------
@@ -1018,18 +1076,12 @@ void Mehrotra
             else
                 Ones( dInner, n+m+kSparse, 1 );
 
+            factorTimer.Start();
             sparseLDLFact.ChangeNonzeroValues( J );
             sparseLDLFact.Factor();
-            // TODO(poulson): Make use of a better interface to these routines.
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress );
+            info.factorTime = factorTimer.Stop();
+            info.factorNumEntries = sparseLDLFact.NumEntries();
+            solveKKT( d );
         }
         catch(...)
         {
@@ -1107,6 +1159,9 @@ void Mehrotra
           ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print )
             Output("sigma=",sigma);
+        info.alphaAffPri = alphaAffPri;
+        info.alphaAffDual = alphaAffDual;
+        info.sigma = sigma;
 
         // Solve for the combined direction
         // ================================
@@ -1136,16 +1191,7 @@ void Mehrotra
           orders, firstInds, origToSparseFirstInds, kSparse, d );
         try
         {
-            // TODO(poulson): Make use of a better interface to these routines.
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress );
+            solveKKT( d );
         }
         catch(...)
         {
@@ -1179,6 +1225,9 @@ void Mehrotra
         Axpy( alphaPri,  ds, s );
         Axpy( alphaDual, dy, y );
         Axpy( alphaDual, dz, z );
+        info.alphaPri = alphaPri;
+        info.alphaDual = alphaDual;
+        finishIteration();
         if( alphaPri == Real(0) && alphaDual == Real(0) )
         {
             if( relError < ctrl.minTol )
@@ -1294,6 +1343,10 @@ void Mehrotra
     ( A, G, b, c, h, orders, firstInds, x, y, z, s,
       ctrl.primalInit, ctrl.dualInit, ctrl.standardInitShift, cutoffPar,
       ctrl.solveCtrl );
+    if( ctrl.primalInit && ctrl.dualInit && ctrl.warmStartShift )
+        soc::WarmStartShift
+        ( s, z, orders, firstInds, ctrl.warmStartMinMu, Real(0.1),
+          cutoffPar );
     if( commRank == 0 && ctrl.time )
         Output("Init: ",timer.Stop()," secs");
 
@@ -1389,9 +1442,40 @@ void Mehrotra
     DistMultiVec<Real> dInner(grid);
     DistMultiVec<Real> dxError(grid), dyError(grid),
                        dzError(grid), dmuError(grid);
+
+    // The record of the current iteration for ctrl.iterationCallback
+    MehrotraIterationInfo<Real> info;
+    Timer iterationTimer, kktTimer, factorTimer, solveTimer;
+    const Real maxRegTmp = MaxNorm( regTmp );
+    auto finishIteration = [&]()
+      {
+        info.iterationTime = iterationTimer.Stop();
+        if( ctrl.iterationCallback )
+            ctrl.iterationCallback( info );
+      };
+    auto solveKKT = [&]( DistMultiVec<Real>& rhs )
+      {
+        // TODO(poulson): Make use of a better interface to these routines.
+        solveTimer.Start();
+        if( ctrl.resolveReg )
+            info.numRefineIts += reg_ldl::SolveAfter
+            ( JOrig, regTmp, dInner, sparseLDLFact, rhs, ctrl.solveCtrl );
+        else
+            info.numRefineIts += reg_ldl::RegularizedSolveAfter
+            ( JOrig, regTmp, dInner, sparseLDLFact, rhs,
+              ctrl.solveCtrl.relTol,
+              ctrl.solveCtrl.maxRefineIts,
+              ctrl.solveCtrl.progress );
+        info.solveTime += solveTimer.Stop();
+        ++info.numSolves;
+      };
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
+        EL_REGION("socp::affine::Mehrotra iteration");
+        info = MehrotraIterationInfo<Real>();
+        info.numIts = numIts;
+        iterationTimer.Start();
         if( ctrl.time && commRank == 0 )
             iterTimer.Start();
         // Ensure that s and z are in the cone
@@ -1461,16 +1545,24 @@ void Mehrotra
                  "  dual   = ",dualObj,"\n",Indent(),
                  "  |primal - dual| / (1 + |primal|) = ",objConv);
         }
+        info.relError = relError;
         if( relError <= ctrl.targetTol )
+        {
+            finishIteration();
             break;
+        }
         if( numIts == ctrl.maxIts && relError > ctrl.minTol )
             RuntimeError
             ("Reached maximum number of iterations, ",ctrl.maxIts,
              ", with rel. error ",relError," which does not meet the minimum ",
              "tolerance of ",ctrl.minTol);
         Real wMaxNorm = MaxNorm(w);
+        info.wMaxNorm = wMaxNorm;
         if( wMaxNorm >= ctrl.wMaxLimit && relError <= ctrl.minTol )
+        {
+            finishIteration();
             break;
+        }
 
         // Compute the affine search direction
         // ===================================
@@ -1496,6 +1588,8 @@ void Mehrotra
         soc::ApplyQuadratic( wRoot, z, l, orders, firstInds, cutoffPar );
         soc::Inverse( l, lInv, orders, firstInds, cutoffPar );
         const Real mu = Dot(s,z) / degree;
+        info.mu = mu;
+        info.wMaxNorm = wMaxNorm;
 
         // r_mu := l
         // ---------
@@ -1505,6 +1599,7 @@ void Mehrotra
         // ------------------------
         if( ctrl.time && commRank == 0 )
             timer.Start();
+        kktTimer.Start();
         JOrig = JStatic;
         JOrig.FreezeSparsity();
         FinishKKT
@@ -1527,6 +1622,11 @@ void Mehrotra
         J = JOrig;
         J.FreezeSparsity();
         UpdateDiagonal( J, Real(1), regTmp );
+        info.kktTime = kktTimer.Stop();
+        info.kktHeight = J.Height();
+        info.maxRegTmp = maxRegTmp;
+        if( ctrl.iterationCallback )
+            info.kktNumEntries = JOrig.NumEntries();
         J.LockedDistGraph().multMeta = meta;
 
         // Solve for the direction
@@ -1546,6 +1646,7 @@ void Mehrotra
 
             if( ctrl.time && commRank == 0 )
                 timer.Start();
+            factorTimer.Start();
             sparseLDLFact.ChangeNonzeroValues( J );
             if( ctrl.time && commRank == 0 )
                 Output("Front pull: ",timer.Stop()," secs");
@@ -1553,21 +1654,17 @@ void Mehrotra
             if( commRank == 0 && ctrl.time )
                 timer.Start();
             sparseLDLFact.Factor( LDL_2D );
+            info.factorTime = factorTimer.Stop();
+            if( ctrl.iterationCallback )
+                info.factorNumEntries =
+                  mpi::AllReduce
+                  ( sparseLDLFact.NumLocalEntries(), grid.Comm() );
             if( commRank == 0 && ctrl.time )
                 Output("LDL: ",timer.Stop()," secs");
 
             if( commRank == 0 && ctrl.time )
                 timer.Start();
-            // TODO(poulson): Make use of a better interface to these routines.
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress );
+            solveKKT( d );
             if( commRank == 0 && ctrl.time )
                 Output("Affine: ",timer.Stop()," secs");
         }
@@ -1663,6 +1760,9 @@ void Mehrotra
           ctrl.centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
         if( ctrl.print && commRank == 0 )
             Output("sigma=",sigma);
+        info.alphaAffPri = alphaAffPri;
+        info.alphaAffDual = alphaAffDual;
+        info.sigma = sigma;
 
         // Solve for the combined direction
         // ================================
@@ -1699,16 +1799,7 @@ void Mehrotra
         {
             if( commRank == 0 && ctrl.time )
                 timer.Start();
-            // TODO(poulson): Make use of a better interface to these routines.
-            if( ctrl.resolveReg )
-                reg_ldl::SolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d, ctrl.solveCtrl );
-            else
-                reg_ldl::RegularizedSolveAfter
-                ( JOrig, regTmp, dInner, sparseLDLFact, d,
-                  ctrl.solveCtrl.relTol,
-                  ctrl.solveCtrl.maxRefineIts,
-                  ctrl.solveCtrl.progress );
+            solveKKT( d );
             if( commRank == 0 && ctrl.time )
                 Output("Corrector solver: ",timer.Stop()," secs");
         }
@@ -1754,6 +1845,9 @@ void Mehrotra
         Axpy( alphaPri,  ds, s );
         Axpy( alphaDual, dy, y );
         Axpy( alphaDual, dz, z );
+        info.alphaPri = alphaPri;
+        info.alphaDual = alphaDual;
+        finishIteration();
         if( ctrl.time && commRank == 0 )
             Output("Iteration: ",iterTimer.Stop()," secs");
         if( alphaPri == Real(0) && alphaDual == Real(0) )
@@ -52,12 +52,12 @@ void Mehrotra
     Matrix<Real> h;
     Zeros( h, n, 1 );
 
-    MehrotraCtrl<Real> affineCtrl = ctrl;
-    affineCtrl.primalInit = false;
-    affineCtrl.dualInit = false;
-
+    // Since G = -I and h = 0, the affine slack is s = h - G x = x, and so a
+    // user-provided initial point (e.g., for a warm start) carries over.
     Matrix<Real> s;
-    socp::affine::Mehrotra(A,G,b,c,h,orders,firstInds,x,y,z,s,affineCtrl);
+    if( ctrl.primalInit )
+        s = x;
+    socp::affine::Mehrotra(A,G,b,c,h,orders,firstInds,x,y,z,s,ctrl);
 }
 
 template<typename Real>
@@ -83,12 +83,12 @@ void Mehrotra
     DistMatrix<Real> h(grid);
     Zeros( h, n, 1 );
 
-    MehrotraCtrl<Real> affineCtrl = ctrl;
-    affineCtrl.primalInit = false;
-    affineCtrl.dualInit = false;
-
+    // Since G = -I and h = 0, the affine slack is s = h - G x = x, and so a
+    // user-provided initial point (e.g., for a warm start) carries over.
     DistMatrix<Real> s(grid);
-    socp::affine::Mehrotra(A,G,b,c,h,orders,firstInds,x,y,z,s,affineCtrl);
+    if( ctrl.primalInit )
+        Copy( x, s );
+    socp::affine::Mehrotra(A,G,b,c,h,orders,firstInds,x,y,z,s,ctrl);
 }
 
 template<typename Real>
@@ -113,12 +113,12 @@ void Mehrotra
     Matrix<Real> h;
     Zeros( h, n, 1 );
 
-    MehrotraCtrl<Real> affineCtrl = ctrl;
-    affineCtrl.primalInit = false;
-    affineCtrl.dualInit = false;
-
+    // Since G = -I and h = 0, the affine slack is s = h - G x = x, and so a
+    // user-provided initial point (e.g., for a warm start) carries over.
     Matrix<Real> s;
-    socp::affine::Mehrotra(A,G,b,c,h,orders,firstInds,x,y,z,s,affineCtrl);
+    if( ctrl.primalInit )
+        s = x;
+    socp::affine::Mehrotra(A,G,b,c,h,orders,firstInds,x,y,z,s,ctrl);
 }
 
 template<typename Real>
@@ -144,12 +144,12 @@ void Mehrotra
     DistMultiVec<Real> h(grid);
     Zeros( h, n, 1 );
 
-    MehrotraCtrl<Real> affineCtrl = ctrl;
-    affineCtrl.primalInit = false;
-    affineCtrl.dualInit = false;
-
+    // Since G = -I and h = 0, the affine slack is s = h - G x = x, and so a
+    // user-provided initial point (e.g., for a warm start) carries over.
     DistMultiVec<Real> s(grid);
-    socp::affine::Mehrotra(A,G,b,c,h,orders,firstInds,x,y,z,s,affineCtrl);
+    if( ctrl.primalInit )
+        s = x;
+    socp::affine::Mehrotra(A,G,b,c,h,orders,firstInds,x,y,z,s,ctrl);
 }
 
 #define PROTO(Real) \
@@ -0,0 +1,269 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+template<typename Real>
+function<void(const MehrotraIterationInfo<Real>&)>
+MehrotraIterationLog( const string& filename, mpi::Comm comm )
+{
+    EL_DEBUG_CSE
+    // The file is shared by the copies of the callback and closed along with
+    // the last of them
+    shared_ptr<ofstream> file;
+    if( mpi::Rank(comm) == 0 )
+    {
+        file = make_shared<ofstream>( filename.c_str() );
+        if( !file->is_open() )
+            RuntimeError("Could not open ",filename);
+        file->precision( 16 );
+        *file << "iteration,mu,relError,wMaxNorm,kktHeight,kktNumEntries,"
+                 "factorNumEntries,maxRegTmp,numSolves,numRefineIts,"
+                 "alphaAffPri,alphaAffDual,sigma,alphaPri,alphaDual,"
+                 "numCorrectors,kktTime,factorTime,solveTime,iterationTime"
+              << std::endl;
+    }
+    return
+      [=]( const MehrotraIterationInfo<Real>& info )
+      {
+          if( !file )
+              return;
+          *file << info.numIts << ","
+                << info.mu << ","
+                << info.relError << ","
+                << info.wMaxNorm << ","
+                << info.kktHeight << ","
+                << info.kktNumEntries << ","
+                << info.factorNumEntries << ","
+                << info.maxRegTmp << ","
+                << info.numSolves << ","
+                << info.numRefineIts << ","
+                << info.alphaAffPri << ","
+                << info.alphaAffDual << ","
+                << info.sigma << ","
+                << info.alphaPri << ","
+                << info.alphaDual << ","
+                << info.numCorrectors << ","
+                << info.kktTime << ","
+                << info.factorTime << ","
+                << info.solveTime << ","
+                << info.iterationTime << std::endl;
+      };
+}
+
+template<typename Field>
+ShiftedHermitianSolver<Field>::ShiftedHermitianSolver
+( const Matrix<Field>& Q, Base<Field> rho, bool spectral, bool inv )
+{
+    EL_DEBUG_CSE
+    Initialize( Q, rho, spectral, inv );
+}
+
+template<typename Field>
+void ShiftedHermitianSolver<Field>::Initialize
+( const Matrix<Field>& Q, Base<Field> rho, bool spectral, bool inv )
+{
+    EL_DEBUG_CSE
+    if( Q.Height() != Q.Width() )
+        LogicError("Q must be square");
+    Q_ = Q;
+    rho_ = rho;
+    spectral_ = spectral;
+    inv_ = inv;
+    if( spectral_ )
+    {
+        // Q = F diag(eigs) F^H
+        auto QCopy( Q_ );
+        HermitianEig( LOWER, QCopy, eigs_, F_ );
+        shiftedEigs_ = eigs_;
+        El::Shift( shiftedEigs_, rho_ );
+    }
+    else
+        Factor();
+    initialized_ = true;
+}
+
+template<typename Field>
+void ShiftedHermitianSolver<Field>::Factor()
+{
+    EL_DEBUG_CSE
+    F_ = Q_;
+    ShiftDiagonal( F_, Field(rho_) );
+    if( inv_ )
+    {
+        HPDInverse( LOWER, F_ );
+    }
+    else
+    {
+        Cholesky( LOWER, F_ );
+        MakeTrapezoidal( LOWER, F_ );
+    }
+}
+
+template<typename Field>
+void ShiftedHermitianSolver<Field>::SetShift( Base<Field> rho )
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The solver has not been initialized");
+    if( rho == rho_ )
+        return;
+    rho_ = rho;
+    if( spectral_ )
+    {
+        shiftedEigs_ = eigs_;
+        El::Shift( shiftedEigs_, rho_ );
+    }
+    else
+        Factor();
+}
+
+template<typename Field>
+void ShiftedHermitianSolver<Field>::Solve( Matrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The solver has not been initialized");
+    if( spectral_ )
+    {
+        // B := F inv(diag(eigs) + rho I) F^H B
+        Matrix<Field> T;
+        Gemm( ADJOINT, NORMAL, Field(1), F_, B, T );
+        DiagonalSolve( LEFT, NORMAL, shiftedEigs_, T );
+        Gemm( NORMAL, NORMAL, Field(1), F_, T, Field(0), B );
+    }
+    else if( inv_ )
+    {
+        auto Y( B );
+        Hemm( LEFT, LOWER, Field(1), F_, Y, Field(0), B );
+    }
+    else
+    {
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Field(1), F_, B );
+        Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, Field(1), F_, B );
+    }
+}
+
+template<typename Field>
+DistShiftedHermitianSolver<Field>::DistShiftedHermitianSolver
+( const AbstractDistMatrix<Field>& Q, Base<Field> rho, bool spectral, bool inv )
+{
+    EL_DEBUG_CSE
+    Initialize( Q, rho, spectral, inv );
+}
+
+template<typename Field>
+void DistShiftedHermitianSolver<Field>::Initialize
+( const AbstractDistMatrix<Field>& Q, Base<Field> rho, bool spectral, bool inv )
+{
+    EL_DEBUG_CSE
+    if( Q.Height() != Q.Width() )
+        LogicError("Q must be square");
+    const Grid& grid = Q.Grid();
+    Q_.SetGrid( grid );
+    F_.SetGrid( grid );
+    eigs_.SetGrid( grid );
+    shiftedEigs_.SetGrid( grid );
+
+    Copy( Q, Q_ );
+    rho_ = rho;
+    spectral_ = spectral;
+    inv_ = inv;
+    if( spectral_ )
+    {
+        // Q = F diag(eigs) F^H
+        DistMatrix<Field> QCopy( Q_ );
+        HermitianEig( LOWER, QCopy, eigs_, F_ );
+        shiftedEigs_ = eigs_;
+        El::Shift( shiftedEigs_, rho_ );
+    }
+    else
+        Factor();
+    initialized_ = true;
+}
+
+template<typename Field>
+void DistShiftedHermitianSolver<Field>::Factor()
+{
+    EL_DEBUG_CSE
+    F_ = Q_;
+    ShiftDiagonal( F_, Field(rho_) );
+    if( inv_ )
+    {
+        HPDInverse( LOWER, F_ );
+    }
+    else
+    {
+        Cholesky( LOWER, F_ );
+        MakeTrapezoidal( LOWER, F_ );
+    }
+}
+
+template<typename Field>
+void DistShiftedHermitianSolver<Field>::SetShift( Base<Field> rho )
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The solver has not been initialized");
+    if( rho == rho_ )
+        return;
+    rho_ = rho;
+    if( spectral_ )
+    {
+        shiftedEigs_ = eigs_;
+        El::Shift( shiftedEigs_, rho_ );
+    }
+    else
+        Factor();
+}
+
+template<typename Field>
+void DistShiftedHermitianSolver<Field>::Solve( DistMatrix<Field>& B ) const
+{
+    EL_DEBUG_CSE
+    if( !initialized_ )
+        LogicError("The solver has not been initialized");
+    if( spectral_ )
+    {
+        // B := F inv(diag(eigs) + rho I) F^H B
+        DistMatrix<Field> T(B.Grid());
+        Gemm( ADJOINT, NORMAL, Field(1), F_, B, T );
+        DiagonalSolve( LEFT, NORMAL, shiftedEigs_, T );
+        Gemm( NORMAL, NORMAL, Field(1), F_, T, Field(0), B );
+    }
+    else if( inv_ )
+    {
+        DistMatrix<Field> Y( B );
+        Hemm( LEFT, LOWER, Field(1), F_, Y, Field(0), B );
+    }
+    else
+    {
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Field(1), F_, B );
+        Trsm( LEFT, LOWER, ADJOINT, NON_UNIT, Field(1), F_, B );
+    }
+}
+
+#define PROTO(Field) \
+  template class ShiftedHermitianSolver<Field>; \
+  template class DistShiftedHermitianSolver<Field>;
+
+#define PROTO_REAL(Real) \
+  PROTO(Real) \
+  template function<void(const MehrotraIterationInfo<Real>&)> \
+  MehrotraIterationLog<Real>( const string& filename, mpi::Comm comm );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
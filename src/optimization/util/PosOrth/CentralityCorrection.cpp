@@ -0,0 +1,193 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace pos_orth {
+
+// Form the modification of the complementarity residual, r_mu, of a
+// Gondzio multiple centrality corrector for the trial point
+//
+//   (sTrial,zTrial) = (s + alphaPri ds, z + alphaDual dz).
+//
+// Each complementarity product sTrial_i zTrial_i lying outside of the
+// interval [betaMin mu, betaMax mu] is targeted toward the nearest endpoint,
+// though decreases of products above the interval are limited to
+// betaMax mu so that a few outliers cannot dominate the correction. Since
+// the search direction satisfies s o dz + z o ds = -r_mu, the returned
+// vector is the difference between the trial products and their targets.
+
+namespace {
+
+template<typename Real>
+Real CorrectionEntry
+( Real sTrial, Real zTrial, Real lower, Real upper )
+{
+    const Real prod = sTrial*zTrial;
+    if( prod < lower )
+        return prod - lower;
+    else if( prod > upper )
+        return Min( prod-upper, upper );
+    else
+        return Real(0);
+}
+
+} // anonymous namespace
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void CentralityCorrection
+( const Matrix<Real>& s,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& z,
+  const Matrix<Real>& dz,
+        Real alphaPri,
+        Real alphaDual,
+        Real mu,
+        Matrix<Real>& correction,
+        Real betaMin,
+        Real betaMax )
+{
+    EL_DEBUG_CSE
+    const Int k = s.Height();
+    const Real lower = betaMin*mu;
+    const Real upper = betaMax*mu;
+    correction.Resize( k, 1 );
+    for( Int i=0; i<k; ++i )
+        correction(i) =
+          CorrectionEntry
+          ( s(i)+alphaPri*ds(i), z(i)+alphaDual*dz(i), lower, upper );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void CentralityCorrection
+( const AbstractDistMatrix<Real>& sPre,
+  const AbstractDistMatrix<Real>& dsPre,
+  const AbstractDistMatrix<Real>& zPre,
+  const AbstractDistMatrix<Real>& dzPre,
+        Real alphaPri,
+        Real alphaDual,
+        Real mu,
+        AbstractDistMatrix<Real>& correctionPre,
+        Real betaMin,
+        Real betaMax )
+{
+    EL_DEBUG_CSE
+
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.colAlign = 0;
+
+    DistMatrixReadProxy<Real,Real,VC,STAR>
+      sProx( sPre, ctrl ),
+      dsProx( dsPre, ctrl ),
+      zProx( zPre, ctrl ),
+      dzProx( dzPre, ctrl );
+    DistMatrixWriteProxy<Real,Real,VC,STAR>
+      correctionProx( correctionPre, ctrl );
+    auto& s = sProx.GetLocked();
+    auto& ds = dsProx.GetLocked();
+    auto& z = zProx.GetLocked();
+    auto& dz = dzProx.GetLocked();
+    auto& correction = correctionProx.Get();
+
+    const Real lower = betaMin*mu;
+    const Real upper = betaMax*mu;
+    correction.Resize( s.Height(), 1 );
+    const Int localHeight = s.LocalHeight();
+    const Real* sBuf = s.LockedBuffer();
+    const Real* dsBuf = ds.LockedBuffer();
+    const Real* zBuf = z.LockedBuffer();
+    const Real* dzBuf = dz.LockedBuffer();
+    Real* correctionBuf = correction.Buffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        correctionBuf[iLoc] =
+          CorrectionEntry
+          ( sBuf[iLoc]+alphaPri*dsBuf[iLoc],
+            zBuf[iLoc]+alphaDual*dzBuf[iLoc], lower, upper );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void CentralityCorrection
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& dz,
+        Real alphaPri,
+        Real alphaDual,
+        Real mu,
+        DistMultiVec<Real>& correction,
+        Real betaMin,
+        Real betaMax )
+{
+    EL_DEBUG_CSE
+    const Real lower = betaMin*mu;
+    const Real upper = betaMax*mu;
+    correction.SetGrid( s.Grid() );
+    correction.Resize( s.Height(), 1 );
+    const Int localHeight = s.LocalHeight();
+    const Real* sBuf = s.LockedMatrix().LockedBuffer();
+    const Real* dsBuf = ds.LockedMatrix().LockedBuffer();
+    const Real* zBuf = z.LockedMatrix().LockedBuffer();
+    const Real* dzBuf = dz.LockedMatrix().LockedBuffer();
+    Real* correctionBuf = correction.Matrix().Buffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        correctionBuf[iLoc] =
+          CorrectionEntry
+          ( sBuf[iLoc]+alphaPri*dsBuf[iLoc],
+            zBuf[iLoc]+alphaDual*dzBuf[iLoc], lower, upper );
+}
+
+#define PROTO(Real) \
+  template void CentralityCorrection \
+  ( const Matrix<Real>& s, \
+    const Matrix<Real>& ds, \
+    const Matrix<Real>& z, \
+    const Matrix<Real>& dz, \
+          Real alphaPri, \
+          Real alphaDual, \
+          Real mu, \
+          Matrix<Real>& correction, \
+          Real betaMin, \
+          Real betaMax ); \
+  template void CentralityCorrection \
+  ( const AbstractDistMatrix<Real>& s, \
+    const AbstractDistMatrix<Real>& ds, \
+    const AbstractDistMatrix<Real>& z, \
+    const AbstractDistMatrix<Real>& dz, \
+          Real alphaPri, \
+          Real alphaDual, \
+          Real mu, \
+          AbstractDistMatrix<Real>& correction, \
+          Real betaMin, \
+          Real betaMax ); \
+  template void CentralityCorrection \
+  ( const DistMultiVec<Real>& s, \
+    const DistMultiVec<Real>& ds, \
+    const DistMultiVec<Real>& z, \
+    const DistMultiVec<Real>& dz, \
+          Real alphaPri, \
+          Real alphaDual, \
+          Real mu, \
+          DistMultiVec<Real>& correction, \
+          Real betaMin, \
+          Real betaMax );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace pos_orth
+} // namespace El
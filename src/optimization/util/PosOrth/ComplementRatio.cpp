@@ -11,33 +11,63 @@
 namespace El {
 namespace pos_orth {
 
-// Compute Max( s o z ) / Min( s o z ) to determine if we need to recenter
+namespace {
+
+// Compute the sum, maximum, and minimum of s o z in a single pass
+template<typename Real>
+void LocalComplementarity
+( Int k, const Real* sBuf, const Real* zBuf,
+  Real& sum, Real& maxProd, Real& minProd )
+{
+    sum = 0;
+    maxProd = 0;
+    minProd = limits::Max<Real>();
+    for( Int i=0; i<k; ++i )
+    {
+        const Real prod = sBuf[i]*zBuf[i];
+        sum += prod;
+        maxProd = Max( prod, maxProd );
+        minProd = Min( prod, minProd );
+    }
+}
+
+// Combine the local results with a summation and a single AllReduce of the
+// maximum and the negated minimum
+template<typename Real>
+ComplementarityInfo<Real> CombineComplementarity
+( Real localSum, Real localMaxProd, Real localMinProd, mpi::Comm comm )
+{
+    ComplementarityInfo<Real> info;
+    info.sum = mpi::AllReduce( localSum, comm );
+    Real extremes[2] = { localMaxProd, -localMinProd };
+    mpi::AllReduce( extremes, 2, mpi::MAX, comm );
+    info.maxProd = extremes[0];
+    // As in ComplementRatio, the minimum is bounded by the (nonnegative)
+    // maximum
+    info.minProd = Min( -extremes[1], info.maxProd );
+    return info;
+}
+
+} // anonymous namespace
 
 template<typename Real,
          typename/*=EnableIf<IsReal<Real>>*/>
-Real ComplementRatio
+ComplementarityInfo<Real> Complementarity
 ( const Matrix<Real>& s,
   const Matrix<Real>& z )
 {
     EL_DEBUG_CSE
-    const Int k = s.Height();
-    const Real* sBuf = s.LockedBuffer();
-    const Real* zBuf = z.LockedBuffer();
-
-    Real maxProd = 0;
-    for( Int i=0; i<k; ++i )
-        maxProd = Max( sBuf[i]*zBuf[i], maxProd );
-
-    Real minProd = maxProd;
-    for( Int i=0; i<k; ++i )
-        minProd = Min( sBuf[i]*zBuf[i], minProd );
-
-    return maxProd/minProd;
+    ComplementarityInfo<Real> info;
+    LocalComplementarity
+    ( s.Height(), s.LockedBuffer(), z.LockedBuffer(),
+      info.sum, info.maxProd, info.minProd );
+    info.minProd = Min( info.minProd, info.maxProd );
+    return info;
 }
 
 template<typename Real,
          typename/*=EnableIf<IsReal<Real>>*/>
-Real ComplementRatio
+ComplementarityInfo<Real> Complementarity
 ( const AbstractDistMatrix<Real>& sPre,
   const AbstractDistMatrix<Real>& zPre )
 {
@@ -53,21 +83,48 @@ Real ComplementRatio
     auto& s = sProx.GetLocked();
     auto& z = zProx.GetLocked();
 
-    const Int localHeight = s.LocalHeight();
-    const Real* sBuf = s.LockedBuffer();
-    const Real* zBuf = z.LockedBuffer();
+    Real sum, maxProd, minProd;
+    LocalComplementarity
+    ( s.LocalHeight(), s.LockedBuffer(), z.LockedBuffer(),
+      sum, maxProd, minProd );
+    return CombineComplementarity( sum, maxProd, minProd, s.DistComm() );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+ComplementarityInfo<Real> Complementarity
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& z )
+{
+    EL_DEBUG_CSE
+    Real sum, maxProd, minProd;
+    LocalComplementarity
+    ( s.LocalHeight(),
+      s.LockedMatrix().LockedBuffer(), z.LockedMatrix().LockedBuffer(),
+      sum, maxProd, minProd );
+    return CombineComplementarity( sum, maxProd, minProd, s.Grid().Comm() );
+}
 
-    Real maxLocProd = 0;
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-        maxLocProd = Max( sBuf[iLoc]*zBuf[iLoc], maxLocProd );
-    const Real maxProd = mpi::AllReduce( maxLocProd, mpi::MAX, s.DistComm() );
+// Compute Max( s o z ) / Min( s o z ) to determine if we need to recenter
 
-    Real minLocProd = maxProd;
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-        minLocProd = Min( sBuf[iLoc]*zBuf[iLoc], minLocProd );
-    const Real minProd = mpi::AllReduce( minLocProd, mpi::MIN, s.DistComm() );
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+Real ComplementRatio
+( const Matrix<Real>& s,
+  const Matrix<Real>& z )
+{
+    EL_DEBUG_CSE
+    return Complementarity( s, z ).Ratio();
+}
 
-    return maxProd/minProd;
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+Real ComplementRatio
+( const AbstractDistMatrix<Real>& s,
+  const AbstractDistMatrix<Real>& z )
+{
+    EL_DEBUG_CSE
+    return Complementarity( s, z ).Ratio();
 }
 
 template<typename Real,
@@ -77,25 +134,19 @@ Real ComplementRatio
   const DistMultiVec<Real>& z )
 {
     EL_DEBUG_CSE
-    const Grid& grid = s.Grid();
-    const Int localHeight = s.LocalHeight();
-    const Real* sBuf = s.LockedMatrix().LockedBuffer();
-    const Real* zBuf = z.LockedMatrix().LockedBuffer();
-
-    Real maxLocProd = 0;
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-        maxLocProd = Max( sBuf[iLoc]*zBuf[iLoc], maxLocProd );
-    const Real maxProd = mpi::AllReduce( maxLocProd, mpi::MAX, grid.Comm() );
-
-    Real minLocProd = maxProd;
-    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-        minLocProd = Min( sBuf[iLoc]*zBuf[iLoc], minLocProd );
-    const Real minProd = mpi::AllReduce( minLocProd, mpi::MIN, grid.Comm() );
-
-    return maxProd/minProd;
+    return Complementarity( s, z ).Ratio();
 }
 
 #define PROTO(Real) \
+  template ComplementarityInfo<Real> Complementarity \
+  ( const Matrix<Real>& s, \
+    const Matrix<Real>& z ); \
+  template ComplementarityInfo<Real> Complementarity \
+  ( const AbstractDistMatrix<Real>& s, \
+    const AbstractDistMatrix<Real>& z ); \
+  template ComplementarityInfo<Real> Complementarity \
+  ( const DistMultiVec<Real>& s, \
+    const DistMultiVec<Real>& z ); \
   template Real ComplementRatio \
   ( const Matrix<Real>& s, \
     const Matrix<Real>& z ); \
@@ -93,7 +93,109 @@ Real MaxStep
     return mpi::AllReduce( alpha, mpi::MIN, s.Grid().Comm() );
 }
 
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void MaxSteps
+( const Matrix<Real>& s,
+  const Matrix<Real>& ds,
+  const Matrix<Real>& z,
+  const Matrix<Real>& dz,
+        Real upperBound,
+        Real& alphaPri,
+        Real& alphaDual )
+{
+    EL_DEBUG_CSE
+    alphaPri = MaxStep( s, ds, upperBound );
+    alphaDual = MaxStep( z, dz, upperBound );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void MaxSteps
+( const AbstractDistMatrix<Real>& sPre,
+  const AbstractDistMatrix<Real>& dsPre,
+  const AbstractDistMatrix<Real>& zPre,
+  const AbstractDistMatrix<Real>& dzPre,
+        Real upperBound,
+        Real& alphaPri,
+        Real& alphaDual )
+{
+    EL_DEBUG_CSE
+    DistMatrixReadProxy<Real,Real,MC,MR> sProx( sPre ), zProx( zPre );
+    auto& s = sProx.GetLocked();
+    auto& z = zProx.GetLocked();
+
+    ElementalProxyCtrl sControl, zControl;
+    sControl.colConstrain = true;
+    sControl.rowConstrain = true;
+    sControl.colAlign = s.ColAlign();
+    sControl.rowAlign = s.RowAlign();
+    zControl.colConstrain = true;
+    zControl.rowConstrain = true;
+    zControl.colAlign = z.ColAlign();
+    zControl.rowAlign = z.RowAlign();
+
+    DistMatrixReadProxy<Real,Real,MC,MR>
+      dsProx( dsPre, sControl ),
+      dzProx( dzPre, zControl );
+    auto& ds = dsProx.GetLocked();
+    auto& dz = dzProx.GetLocked();
+
+    Real alphas[2] = { upperBound, upperBound };
+    if( s.IsLocalCol(0) )
+        alphas[0] = MaxStep( s.LockedMatrix(), ds.LockedMatrix(), upperBound );
+    if( z.IsLocalCol(0) )
+        alphas[1] = MaxStep( z.LockedMatrix(), dz.LockedMatrix(), upperBound );
+    mpi::AllReduce( alphas, 2, mpi::MIN, s.DistComm() );
+    alphaPri = alphas[0];
+    alphaDual = alphas[1];
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void MaxSteps
+( const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& ds,
+  const DistMultiVec<Real>& z,
+  const DistMultiVec<Real>& dz,
+        Real upperBound,
+        Real& alphaPri,
+        Real& alphaDual )
+{
+    EL_DEBUG_CSE
+    Real alphas[2];
+    alphas[0] = MaxStep( s.LockedMatrix(), ds.LockedMatrix(), upperBound );
+    alphas[1] = MaxStep( z.LockedMatrix(), dz.LockedMatrix(), upperBound );
+    mpi::AllReduce( alphas, 2, mpi::MIN, s.Grid().Comm() );
+    alphaPri = alphas[0];
+    alphaDual = alphas[1];
+}
+
 #define PROTO(Real) \
+  template void MaxSteps \
+  ( const Matrix<Real>& s, \
+    const Matrix<Real>& ds, \
+    const Matrix<Real>& z, \
+    const Matrix<Real>& dz, \
+          Real upperBound, \
+          Real& alphaPri, \
+          Real& alphaDual ); \
+  template void MaxSteps \
+  ( const AbstractDistMatrix<Real>& s, \
+    const AbstractDistMatrix<Real>& ds, \
+    const AbstractDistMatrix<Real>& z, \
+    const AbstractDistMatrix<Real>& dz, \
+          Real upperBound, \
+          Real& alphaPri, \
+          Real& alphaDual ); \
+  template void MaxSteps \
+  ( const DistMultiVec<Real>& s, \
+    const DistMultiVec<Real>& ds, \
+    const DistMultiVec<Real>& z, \
+    const DistMultiVec<Real>& dz, \
+          Real upperBound, \
+          Real& alphaPri, \
+          Real& alphaDual ); \
   template Real MaxStep \
   ( const Matrix<Real>& s, \
     const Matrix<Real>& ds, \
@@ -0,0 +1,135 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace pos_orth {
+
+// Shift a user-provided primal-dual pair (s,z), e.g., the solution of a
+// nearby problem, into a neighborhood of the central path so that it can
+// be used to warm-start an Interior Point Method. With
+//
+//   mu := max(s^T z / k, minMu),
+//
+// each entry of s and z is first raised to at least beta sqrt(beta mu), and
+// then the smaller member of each pair with s_i z_i < beta mu is raised
+// until s_i z_i = beta mu. Since the optimal point of a previous problem
+// lies on the boundary of the orthant, skipping such a shift typically leads
+// to a long sequence of tiny steps, whereas the modification of each pair
+// is kept as small as possible so that most of the previous information is
+// retained (cf. the modified slacks of Gondzio and of Yildirim and Wright).
+
+namespace {
+
+template<typename Real>
+void ShiftPair( Real& s, Real& z, Real lower, Real minEntry )
+{
+    s = Max( s, minEntry );
+    z = Max( z, minEntry );
+    if( s*z < lower )
+    {
+        if( s < z )
+            s = lower / z;
+        else
+            z = lower / s;
+    }
+}
+
+} // anonymous namespace
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void WarmStartShift
+( Matrix<Real>& s, Matrix<Real>& z, Real minMu, Real beta )
+{
+    EL_DEBUG_CSE
+    const Int k = s.Height();
+    if( k == 0 )
+        return;
+    const Real mu = Max( Dot(s,z) / k, minMu );
+    const Real lower = beta*mu;
+    const Real minEntry = beta*Sqrt(lower);
+    for( Int i=0; i<k; ++i )
+        ShiftPair( s(i), z(i), lower, minEntry );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void WarmStartShift
+( AbstractDistMatrix<Real>& sPre,
+  AbstractDistMatrix<Real>& zPre,
+  Real minMu,
+  Real beta )
+{
+    EL_DEBUG_CSE
+    AssertSameGrids( sPre, zPre );
+    const Int k = sPre.Height();
+    if( k == 0 )
+        return;
+
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.colAlign = 0;
+
+    DistMatrixReadWriteProxy<Real,Real,VC,STAR>
+      sProx( sPre, ctrl ),
+      zProx( zPre, ctrl );
+    auto& s = sProx.Get();
+    auto& z = zProx.Get();
+
+    const Real mu = Max( Dot(s,z) / k, minMu );
+    const Real lower = beta*mu;
+    const Real minEntry = beta*Sqrt(lower);
+    const Int localHeight = s.LocalHeight();
+    Real* sBuf = s.Buffer();
+    Real* zBuf = z.Buffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        ShiftPair( sBuf[iLoc], zBuf[iLoc], lower, minEntry );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void WarmStartShift
+( DistMultiVec<Real>& s, DistMultiVec<Real>& z, Real minMu, Real beta )
+{
+    EL_DEBUG_CSE
+    const Int k = s.Height();
+    if( k == 0 )
+        return;
+    const Real mu = Max( Dot(s,z) / k, minMu );
+    const Real lower = beta*mu;
+    const Real minEntry = beta*Sqrt(lower);
+    const Int localHeight = s.LocalHeight();
+    Real* sBuf = s.Matrix().Buffer();
+    Real* zBuf = z.Matrix().Buffer();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        ShiftPair( sBuf[iLoc], zBuf[iLoc], lower, minEntry );
+}
+
+#define PROTO(Real) \
+  template void WarmStartShift \
+  ( Matrix<Real>& s, Matrix<Real>& z, Real minMu, Real beta ); \
+  template void WarmStartShift \
+  ( AbstractDistMatrix<Real>& s, \
+    AbstractDistMatrix<Real>& z, \
+    Real minMu, \
+    Real beta ); \
+  template void WarmStartShift \
+  ( DistMultiVec<Real>& s, DistMultiVec<Real>& z, Real minMu, Real beta );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace pos_orth
+} // namespace El
@@ -0,0 +1,108 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace pos_orth {
+
+namespace {
+
+template<typename Real>
+Real LocalWeightedDot
+( Int k, const Real* wBuf, const Real* sBuf, const Real* zBuf )
+{
+    Real sum = 0;
+    for( Int i=0; i<k; ++i )
+        sum += wBuf[i]*sBuf[i]*zBuf[i];
+    return sum;
+}
+
+} // anonymous namespace
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+Real WeightedDot
+( const Matrix<Real>& w,
+  const Matrix<Real>& s,
+  const Matrix<Real>& z )
+{
+    EL_DEBUG_CSE
+    return LocalWeightedDot
+    ( s.Height(), w.LockedBuffer(), s.LockedBuffer(), z.LockedBuffer() );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+Real WeightedDot
+( const AbstractDistMatrix<Real>& wPre,
+  const AbstractDistMatrix<Real>& sPre,
+  const AbstractDistMatrix<Real>& zPre )
+{
+    EL_DEBUG_CSE
+
+    ElementalProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.colAlign = 0;
+
+    DistMatrixReadProxy<Real,Real,VC,STAR>
+      wProx( wPre, ctrl ),
+      sProx( sPre, ctrl ),
+      zProx( zPre, ctrl );
+    auto& w = wProx.GetLocked();
+    auto& s = sProx.GetLocked();
+    auto& z = zProx.GetLocked();
+
+    const Real localSum =
+      LocalWeightedDot
+      ( s.LocalHeight(),
+        w.LockedBuffer(), s.LockedBuffer(), z.LockedBuffer() );
+    return mpi::AllReduce( localSum, s.DistComm() );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+Real WeightedDot
+( const DistMultiVec<Real>& w,
+  const DistMultiVec<Real>& s,
+  const DistMultiVec<Real>& z )
+{
+    EL_DEBUG_CSE
+    const Real localSum =
+      LocalWeightedDot
+      ( s.LocalHeight(),
+        w.LockedMatrix().LockedBuffer(),
+        s.LockedMatrix().LockedBuffer(),
+        z.LockedMatrix().LockedBuffer() );
+    return mpi::AllReduce( localSum, s.Grid().Comm() );
+}
+
+#define PROTO(Real) \
+  template Real WeightedDot \
+  ( const Matrix<Real>& w, \
+    const Matrix<Real>& s, \
+    const Matrix<Real>& z ); \
+  template Real WeightedDot \
+  ( const AbstractDistMatrix<Real>& w, \
+    const AbstractDistMatrix<Real>& s, \
+    const AbstractDistMatrix<Real>& z ); \
+  template Real WeightedDot \
+  ( const DistMultiVec<Real>& w, \
+    const DistMultiVec<Real>& s, \
+    const DistMultiVec<Real>& z );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace pos_orth
+} // namespace El
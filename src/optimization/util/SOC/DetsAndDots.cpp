@@ -0,0 +1,318 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace soc {
+
+// Rather than separately computing (and then broadcasting) the Jordan
+// determinants of two members of a product of second-order cones and their
+// cone-wise inner products, which requires six passes over the cones (and
+// as many rounds of communication), accumulate all three quantities for each
+// contiguous segment of a cone in a single pass.
+
+namespace {
+
+// Accumulate the contributions of entries [iBeg,iEnd) of a cone whose root
+// lies at index 'firstInd', i.e.,
+//
+//   xDet += x_0^2 - ||x_1||^2, yDet += y_0^2 - ||y_1||^2, dot += x^T y,
+//
+// where only the entries of the segment contribute.
+template<typename Real>
+void AccumulateSegment
+( const Real* xBuf, const Real* yBuf, Int iBeg, Int iEnd, Int firstInd,
+  Real& xDet, Real& yDet, Real& dot )
+{
+    Int i = iBeg;
+    if( i == firstInd )
+    {
+        xDet += xBuf[0]*xBuf[0];
+        yDet += yBuf[0]*yBuf[0];
+        dot += xBuf[0]*yBuf[0];
+        ++i;
+    }
+    for( ; i<iEnd; ++i )
+    {
+        const Real xi = xBuf[i-iBeg];
+        const Real yi = yBuf[i-iBeg];
+        xDet -= xi*xi;
+        yDet -= yi*yi;
+        dot += xi*yi;
+    }
+}
+
+template<typename Real>
+void FillSegment
+( Real* xDetBuf, Real* yDetBuf, Real* dotBuf, Int num,
+  Real xDet, Real yDet, Real dot )
+{
+    for( Int i=0; i<num; ++i )
+    {
+        xDetBuf[i] = xDet;
+        yDetBuf[i] = yDet;
+        dotBuf[i] = dot;
+    }
+}
+
+// Handle all of the cones lying entirely within [iBeg,iEnd) in a single pass,
+// with straight-line code for the (common) three-dimensional cones, and
+// return the number of leading entries that were skipped because they belong
+// to a cone beginning before 'iBeg'. The loop stops at the first cone that
+// extends past 'iEnd', whose offset is returned in 'tailOff'.
+template<typename Real>
+Int LocalPass
+( const Real* xBuf, const Real* yBuf,
+        Real* xDetBuf, Real* yDetBuf, Real* dotBuf,
+  const Int* orderBuf, const Int* firstIndBuf,
+  Int iBeg, Int iEnd, Int& tailOff )
+{
+    const Int numLocal = iEnd - iBeg;
+    Int iLoc = 0;
+    while( iLoc < numLocal && firstIndBuf[iLoc] < iBeg )
+        ++iLoc;
+    const Int headLength = iLoc;
+    while( iLoc < numLocal )
+    {
+        const Int order = orderBuf[iLoc];
+        EL_DEBUG_ONLY(
+          if( firstIndBuf[iLoc] != iBeg+iLoc )
+              LogicError("Inconsistency in orders and firstInds");
+        )
+        if( iLoc+order > numLocal )
+            break;
+        if( order == 3 )
+        {
+            const Real* x = &xBuf[iLoc];
+            const Real* y = &yBuf[iLoc];
+            const Real xDet = x[0]*x[0] - x[1]*x[1] - x[2]*x[2];
+            const Real yDet = y[0]*y[0] - y[1]*y[1] - y[2]*y[2];
+            const Real dot = x[0]*y[0] + x[1]*y[1] + x[2]*y[2];
+            xDetBuf[iLoc] = xDetBuf[iLoc+1] = xDetBuf[iLoc+2] = xDet;
+            yDetBuf[iLoc] = yDetBuf[iLoc+1] = yDetBuf[iLoc+2] = yDet;
+            dotBuf[iLoc] = dotBuf[iLoc+1] = dotBuf[iLoc+2] = dot;
+        }
+        else
+        {
+            Real xDet=0, yDet=0, dot=0;
+            AccumulateSegment
+            ( &xBuf[iLoc], &yBuf[iLoc], iBeg+iLoc, iBeg+iLoc+order,
+              iBeg+iLoc, xDet, yDet, dot );
+            FillSegment
+            ( &xDetBuf[iLoc], &yDetBuf[iLoc], &dotBuf[iLoc], order,
+              xDet, yDet, dot );
+        }
+        iLoc += order;
+    }
+    tailOff = iLoc;
+    return headLength;
+}
+
+} // anonymous namespace
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void DetsAndDots
+( const Matrix<Real>& x,
+  const Matrix<Real>& y,
+        Matrix<Real>& xDets,
+        Matrix<Real>& yDets,
+        Matrix<Real>& dots,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds )
+{
+    EL_DEBUG_CSE
+    const Int height = x.Height();
+    EL_DEBUG_ONLY(
+      if( x.Width() != 1 || orders.Width() != 1 || firstInds.Width() != 1 )
+          LogicError("x, orders, and firstInds should be column vectors");
+      if( orders.Height() != height || firstInds.Height() != height )
+          LogicError("orders and firstInds should be of the same height as x");
+      if( y.Height() != x.Height() || y.Width() != x.Width() )
+          LogicError("x and y must be the same size");
+    )
+    xDets.Resize( height, 1 );
+    yDets.Resize( height, 1 );
+    dots.Resize( height, 1 );
+
+    Int tailOff;
+    LocalPass
+    ( x.LockedBuffer(), y.LockedBuffer(),
+      xDets.Buffer(), yDets.Buffer(), dots.Buffer(),
+      orders.LockedBuffer(), firstInds.LockedBuffer(), Int(0), height,
+      tailOff );
+    if( tailOff != height )
+        LogicError("The last cone extended past the end of the vector");
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void DetsAndDots
+( const AbstractDistMatrix<Real>& x,
+  const AbstractDistMatrix<Real>& y,
+        AbstractDistMatrix<Real>& xDets,
+        AbstractDistMatrix<Real>& yDets,
+        AbstractDistMatrix<Real>& dots,
+  const AbstractDistMatrix<Int>& orders,
+  const AbstractDistMatrix<Int>& firstInds,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    // The members of each cone are not contiguous within the local portions
+    // of the elemental distributions, so the quantities are formed separately
+    soc::Dets( x, xDets, orders, firstInds, cutoff );
+    soc::Dets( y, yDets, orders, firstInds, cutoff );
+    soc::Dots( x, y, dots, orders, firstInds, cutoff );
+    cone::Broadcast( xDets, orders, firstInds, cutoff );
+    cone::Broadcast( yDets, orders, firstInds, cutoff );
+    cone::Broadcast( dots, orders, firstInds, cutoff );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void DetsAndDots
+( const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& y,
+        DistMultiVec<Real>& xDets,
+        DistMultiVec<Real>& yDets,
+        DistMultiVec<Real>& dots,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds )
+{
+    EL_DEBUG_CSE
+    const Grid& grid = x.Grid();
+    mpi::Comm comm = grid.Comm();
+    const int commSize = grid.Size();
+    const Int height = x.Height();
+    const Int localHeight = x.LocalHeight();
+    const Int firstLocalRow = x.FirstLocalRow();
+    EL_DEBUG_ONLY(
+      if( x.Width() != 1 || orders.Width() != 1 || firstInds.Width() != 1 )
+          LogicError("x, orders, and firstInds should be column vectors");
+      if( orders.Height() != height || firstInds.Height() != height )
+          LogicError("orders and firstInds should be of the same height as x");
+      if( y.Height() != x.Height() || y.Width() != x.Width() )
+          LogicError("x and y must be the same size");
+    )
+    xDets.SetGrid( grid );
+    yDets.SetGrid( grid );
+    dots.SetGrid( grid );
+    xDets.Resize( height, 1 );
+    yDets.Resize( height, 1 );
+    dots.Resize( height, 1 );
+
+    const Real* xBuf = x.LockedMatrix().LockedBuffer();
+    const Real* yBuf = y.LockedMatrix().LockedBuffer();
+          Real* xDetBuf = xDets.Matrix().Buffer();
+          Real* yDetBuf = yDets.Matrix().Buffer();
+          Real* dotBuf = dots.Matrix().Buffer();
+    const Int* orderBuf = orders.LockedMatrix().LockedBuffer();
+    const Int* firstIndBuf = firstInds.LockedMatrix().LockedBuffer();
+
+    // Handle the cones that are entirely local
+    // ========================================
+    Int tailOff;
+    const Int headLength =
+      LocalPass
+      ( xBuf, yBuf, xDetBuf, yDetBuf, dotBuf, orderBuf, firstIndBuf,
+        firstLocalRow, firstLocalRow+localHeight, tailOff );
+
+    // Form the partial sums of the (at most two) cones which straddle the
+    // boundaries of the local rows
+    // ===================================================================
+    // Each process contributes the root index (or -1) and the partial
+    // [xDet,yDet,dot] of its leading and trailing segments.
+    Int segBegs[2] = { 0, tailOff };
+    Int segEnds[2] = { headLength, localHeight };
+    if( headLength == localHeight )
+    {
+        // A single cone covers all of the local rows.
+        segEnds[0] = localHeight;
+        segBegs[1] = segEnds[1] = localHeight;
+    }
+    Int sendInds[2] = { -1, -1 };
+    Real sendSums[6] = { Real(0), Real(0), Real(0), Real(0), Real(0), Real(0) };
+    for( Int seg=0; seg<2; ++seg )
+    {
+        const Int segBeg = segBegs[seg];
+        const Int segEnd = segEnds[seg];
+        if( segBeg == segEnd )
+            continue;
+        const Int firstInd = firstIndBuf[segBeg];
+        sendInds[seg] = firstInd;
+        AccumulateSegment
+        ( &xBuf[segBeg], &yBuf[segBeg],
+          firstLocalRow+segBeg, firstLocalRow+segEnd, firstInd,
+          sendSums[3*seg+0], sendSums[3*seg+1], sendSums[3*seg+2] );
+    }
+    vector<Int> recvInds(2*commSize);
+    vector<Real> recvSums(6*commSize);
+    mpi::AllGather( sendInds, 2, recvInds.data(), 2, comm );
+    mpi::AllGather( sendSums, 6, recvSums.data(), 6, comm );
+
+    // Combine the partial sums of each of the local straddling cones
+    // ==============================================================
+    for( Int seg=0; seg<2; ++seg )
+    {
+        if( sendInds[seg] < 0 )
+            continue;
+        Real xDet=0, yDet=0, dot=0;
+        for( Int j=0; j<2*commSize; ++j )
+        {
+            if( recvInds[j] == sendInds[seg] )
+            {
+                xDet += recvSums[3*j+0];
+                yDet += recvSums[3*j+1];
+                dot += recvSums[3*j+2];
+            }
+        }
+        const Int segBeg = segBegs[seg];
+        FillSegment
+        ( &xDetBuf[segBeg], &yDetBuf[segBeg], &dotBuf[segBeg],
+          segEnds[seg]-segBeg, xDet, yDet, dot );
+    }
+}
+
+#define PROTO(Real) \
+  template void DetsAndDots \
+  ( const Matrix<Real>& x, \
+    const Matrix<Real>& y, \
+          Matrix<Real>& xDets, \
+          Matrix<Real>& yDets, \
+          Matrix<Real>& dots, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds ); \
+  template void DetsAndDots \
+  ( const AbstractDistMatrix<Real>& x, \
+    const AbstractDistMatrix<Real>& y, \
+          AbstractDistMatrix<Real>& xDets, \
+          AbstractDistMatrix<Real>& yDets, \
+          AbstractDistMatrix<Real>& dots, \
+    const AbstractDistMatrix<Int>& orders, \
+    const AbstractDistMatrix<Int>& firstInds, \
+    Int cutoff ); \
+  template void DetsAndDots \
+  ( const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& y, \
+          DistMultiVec<Real>& xDets, \
+          DistMultiVec<Real>& yDets, \
+          DistMultiVec<Real>& dots, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace soc
+} // namespace El
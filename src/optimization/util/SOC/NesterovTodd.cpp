@@ -172,26 +172,23 @@ void VandenbergheNT
     Copy( s, sProm );
     Copy( z, zProm );
 
-    // Normalize with respect to the Jordan determinant
-    // ================================================
-    Matrix<PReal> sDets, zDets;
-    soc::Dets( sProm, sDets, orders, firstInds );
-    soc::Dets( zProm, zDets, orders, firstInds );
-    cone::Broadcast( sDets, orders, firstInds );
-    cone::Broadcast( zDets, orders, firstInds );
+    // Normalize with respect to the Jordan determinant and compute the
+    // 'gamma' coefficients
+    // =================================================================
+    // The inner products of the normalized members are the inner products of
+    // the original members divided by the square-roots of both determinants.
+    Matrix<PReal> sDets, zDets, gammas;
+    soc::DetsAndDots
+    ( sProm, zProm, sDets, zDets, gammas, orders, firstInds );
     for( Int i=0; i<n; ++i )
     {
-        sProm(i) /= Sqrt(sDets(i));
-        zProm(i) /= Sqrt(zDets(i));
-    }
-
-    // Compute the 'gamma' coefficients
-    // ================================
-    Matrix<PReal> gammas;
-    soc::Dots( zProm, sProm, gammas, orders, firstInds );
-    cone::Broadcast( gammas, orders, firstInds );
-    for( Int i=0; i<n; ++i )
+        const PReal sDetRoot = Sqrt(sDets(i));
+        const PReal zDetRoot = Sqrt(zDets(i));
+        sProm(i) /= sDetRoot;
+        zProm(i) /= zDetRoot;
+        gammas(i) /= sDetRoot*zDetRoot;
         gammas(i) = Sqrt((PReal(1)+gammas(i))/PReal(2));
+    }
 
     // Compute the normalized scaling point
     // ====================================
@@ -309,32 +306,31 @@ void VandenbergheNT
     Copy( s, sProm );
     Copy( z, zProm );
 
-    // Normalize with respect to the Jordan determinant
-    // ================================================
+    // Normalize with respect to the Jordan determinant and compute the
+    // 'gamma' coefficients
+    // =================================================================
+    // A single pass (and a single exchange of the partial sums of the cones
+    // which straddle process boundaries) suffices since the inner products
+    // of the normalized members are the inner products of the original
+    // members divided by the square-roots of both determinants.
     const Int nLocal = sProm.LocalHeight();
-    DistMultiVec<PReal> sDets(grid), zDets(grid);
-    soc::Dets( sProm, sDets, orders, firstInds, cutoff );
-    soc::Dets( zProm, zDets, orders, firstInds, cutoff );
-    cone::Broadcast( sDets, orders, firstInds, cutoff );
-    cone::Broadcast( zDets, orders, firstInds, cutoff );
+    DistMultiVec<PReal> sDets(grid), zDets(grid), gammas(grid);
+    soc::DetsAndDots
+    ( sProm, zProm, sDets, zDets, gammas, orders, firstInds );
     auto& sPromLoc = sProm.Matrix();
     auto& zPromLoc = zProm.Matrix();
     auto& sDetsLoc = sDets.LockedMatrix();
     auto& zDetsLoc = zDets.LockedMatrix();
-    for( Int iLoc=0; iLoc<nLocal; ++iLoc )
-    {
-        sPromLoc(iLoc) /= Sqrt(sDetsLoc(iLoc));
-        zPromLoc(iLoc) /= Sqrt(zDetsLoc(iLoc));
-    }
-
-    // Compute the 'gamma' coefficients
-    // ================================
-    DistMultiVec<PReal> gammas(grid);
-    soc::Dots( zProm, sProm, gammas, orders, firstInds, cutoff );
-    cone::Broadcast( gammas, orders, firstInds, cutoff );
     auto& gammasLoc = gammas.Matrix();
     for( Int iLoc=0; iLoc<nLocal; ++iLoc )
+    {
+        const PReal sDetRoot = Sqrt(sDetsLoc(iLoc));
+        const PReal zDetRoot = Sqrt(zDetsLoc(iLoc));
+        sPromLoc(iLoc) /= sDetRoot;
+        zPromLoc(iLoc) /= zDetRoot;
+        gammasLoc(iLoc) /= sDetRoot*zDetRoot;
         gammasLoc(iLoc) = Sqrt((PReal(1)+gammasLoc(iLoc))/PReal(2));
+    }
 
     // Compute the normalized scaling point
     // ====================================
@@ -0,0 +1,120 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace soc {
+
+// Shift a user-provided primal-dual pair (s,z), e.g., the solution of a
+// nearby problem, into the interior of the product of second-order cones so
+// that it can be used to warm-start an Interior Point Method. With
+//
+//   mu := max(s^T z / degree, minMu),
+//
+// the root of each cone member of s and z is raised until its distance from
+// the boundary of the cone is at least sqrt(beta mu), which leaves members
+// that are already sufficiently interior untouched.
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void WarmStartShift
+(       Matrix<Real>& s,
+        Matrix<Real>& z,
+  const Matrix<Int>& orders,
+  const Matrix<Int>& firstInds,
+  Real minMu,
+  Real beta )
+{
+    EL_DEBUG_CSE
+    const Int degree = soc::Degree( firstInds );
+    if( degree == 0 )
+        return;
+    const Real mu = Max( Dot(s,z) / degree, minMu );
+    const Real minDist = Sqrt(beta*mu);
+    soc::PushInto( s, orders, firstInds, minDist );
+    soc::PushInto( z, orders, firstInds, minDist );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void WarmStartShift
+(       AbstractDistMatrix<Real>& s,
+        AbstractDistMatrix<Real>& z,
+  const AbstractDistMatrix<Int>& orders,
+  const AbstractDistMatrix<Int>& firstInds,
+  Real minMu,
+  Real beta,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    const Int degree = soc::Degree( firstInds );
+    if( degree == 0 )
+        return;
+    const Real mu = Max( Dot(s,z) / degree, minMu );
+    const Real minDist = Sqrt(beta*mu);
+    soc::PushInto( s, orders, firstInds, minDist, cutoff );
+    soc::PushInto( z, orders, firstInds, minDist, cutoff );
+}
+
+template<typename Real,
+         typename/*=EnableIf<IsReal<Real>>*/>
+void WarmStartShift
+(       DistMultiVec<Real>& s,
+        DistMultiVec<Real>& z,
+  const DistMultiVec<Int>& orders,
+  const DistMultiVec<Int>& firstInds,
+  Real minMu,
+  Real beta,
+  Int cutoff )
+{
+    EL_DEBUG_CSE
+    const Int degree = soc::Degree( firstInds );
+    if( degree == 0 )
+        return;
+    const Real mu = Max( Dot(s,z) / degree, minMu );
+    const Real minDist = Sqrt(beta*mu);
+    soc::PushInto( s, orders, firstInds, minDist, cutoff );
+    soc::PushInto( z, orders, firstInds, minDist, cutoff );
+}
+
+#define PROTO(Real) \
+  template void WarmStartShift \
+  (       Matrix<Real>& s, \
+          Matrix<Real>& z, \
+    const Matrix<Int>& orders, \
+    const Matrix<Int>& firstInds, \
+    Real minMu, \
+    Real beta ); \
+  template void WarmStartShift \
+  (       AbstractDistMatrix<Real>& s, \
+          AbstractDistMatrix<Real>& z, \
+    const AbstractDistMatrix<Int>& orders, \
+    const AbstractDistMatrix<Int>& firstInds, \
+    Real minMu, \
+    Real beta, \
+    Int cutoff ); \
+  template void WarmStartShift \
+  (       DistMultiVec<Real>& s, \
+          DistMultiVec<Real>& z, \
+    const DistMultiVec<Int>& orders, \
+    const DistMultiVec<Int>& firstInds, \
+    Real minMu, \
+    Real beta, \
+    Int cutoff );
+
+#define EL_NO_INT_PROTO
+#define EL_NO_COMPLEX_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace soc
+} // namespace El
@@ -0,0 +1,89 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the wavefront application of several Givens sequences against
+// applying each sequence in turn
+template<typename F>
+void TestSequences
+( LeftOrRight side, ForwardOrBackward direction,
+  Int m, Int n, Int numSeqs )
+{
+    typedef Base<F> Real;
+    Output
+    ("Testing ",(side==LEFT?"LEFT":"RIGHT")," ",
+     (direction==FORWARD?"FORWARD":"BACKWARD")," with ",TypeName<F>());
+    const Int numRots = ( side==LEFT ? m : n ) - 1;
+    Matrix<Real> cLists, sLists;
+    Uniform( cLists, numRots, numSeqs );
+    Uniform( sLists, numRots, numSeqs );
+    for( Int p=0; p<numSeqs; ++p )
+    {
+        for( Int k=0; k<numRots; ++k )
+        {
+            // Normalize each rotation and leave a few as the identity
+            const Real rho = SafeNorm( cLists(k,p), sLists(k,p) );
+            cLists(k,p) /= rho;
+            sLists(k,p) /= rho;
+            if( (k+p) % 7 == 0 )
+            {
+                cLists(k,p) = Real(1);
+                sLists(k,p) = Real(0);
+            }
+        }
+    }
+
+    Matrix<F> A, B;
+    Uniform( A, m, n );
+    B = A;
+    ApplyGivensSequences( side, direction, cLists, sLists, A );
+    for( Int p=0; p<numSeqs; ++p )
+    {
+        auto cList = cLists( ALL, IR(p) );
+        auto sList = sLists( ALL, IR(p) );
+        ApplyGivensSequence
+        ( side, VARIABLE_GIVENS_SEQUENCE, direction, cList, sList, B );
+    }
+
+    const Real BFrob = FrobeniusNorm( B );
+    B -= A;
+    const Real relError = FrobeniusNorm( B ) / BFrob;
+    Output("|| B - A ||_F / || B ||_F = ",relError);
+    if( relError > numSeqs*limits::Epsilon<Real>()*100 )
+        LogicError("Relative error was unacceptably large");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",300);
+        const Int n = Input("--n","width of matrix",200);
+        const Int numSeqs = Input("--numSeqs","number of sequences",13);
+        ProcessInput();
+        PrintInputReport();
+
+        for( LeftOrRight side : { LEFT, RIGHT } )
+        {
+            for( ForwardOrBackward direction : { FORWARD, BACKWARD } )
+            {
+                TestSequences<float>( side, direction, m, n, numSeqs );
+                TestSequences<double>( side, direction, m, n, numSeqs );
+                TestSequences<Complex<double>>
+                ( side, direction, m, n, numSeqs );
+            }
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
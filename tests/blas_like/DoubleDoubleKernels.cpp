@@ -0,0 +1,258 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+#ifdef EL_HAVE_QD
+// Compare the native double-double BLAS kernels against the generic
+// element-by-element implementations (and, if Quad is available, against
+// Gemm and Gemv evaluated in quad precision) over every orientation and
+// with dimensions which are not multiples of the register tile.
+
+// Fill a matrix, whose leading dimension exceeds its height, with entries
+// whose trailing words are nonzero
+void MakeDoubleDouble( Matrix<DoubleDouble>& A, Int m, Int n )
+{
+    A.Resize( m, n, m+3 );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+        {
+            const double hi = SampleUniform<double>(-1,1);
+            const double lo = hi*1e-17*SampleUniform<double>(-1,1);
+            A(i,j) = DoubleDouble(hi) + DoubleDouble(lo);
+        }
+}
+
+void CheckClose
+( const string& label,
+  const Matrix<DoubleDouble>& native,
+  const Matrix<DoubleDouble>& reference,
+  double scale,
+  double tol )
+{
+    double maxDiff = 0;
+    for( Int j=0; j<native.Width(); ++j )
+        for( Int i=0; i<native.Height(); ++i )
+        {
+            const DoubleDouble diff = native(i,j) - reference(i,j);
+            maxDiff = Max( maxDiff, std::abs(diff.x[0]) );
+        }
+    const double relDiff = maxDiff / scale;
+    if( relDiff > tol )
+        LogicError(label," differed by a relative amount of ",relDiff);
+}
+
+#ifdef EL_HAVE_QUAD
+Quad ToQuad( const DoubleDouble& alpha )
+{ return Quad(alpha.x[0]) + Quad(alpha.x[1]); }
+
+void CheckQuad
+( const string& label,
+  const Matrix<DoubleDouble>& native,
+  const Matrix<Quad>& reference,
+  double scale,
+  double tol )
+{
+    double maxDiff = 0;
+    for( Int j=0; j<native.Width(); ++j )
+        for( Int i=0; i<native.Height(); ++i )
+        {
+            const Quad diff = ToQuad(native(i,j)) - reference(i,j);
+            maxDiff = Max( maxDiff, std::abs(double(diff)) );
+        }
+    const double relDiff = maxDiff / scale;
+    if( relDiff > tol )
+        LogicError
+        (label," differed from quad precision by a relative amount of ",
+         relDiff);
+}
+
+Matrix<Quad> ToQuad( const Matrix<DoubleDouble>& A )
+{
+    Matrix<Quad> AQuad( A.Height(), A.Width() );
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            AQuad(i,j) = ToQuad(A(i,j));
+    return AQuad;
+}
+#endif // ifdef EL_HAVE_QUAD
+
+// The relative accuracy expected of a length-k double-double inner product
+double Tolerance( Int k ) { return 10*(k+1)*Pow(2.,-104); }
+
+void TestGemm( Int m, Int n, Int k )
+{
+    const DoubleDouble alpha(0.75), beta(-1.25);
+    for( const char transA : { 'N', 'T', 'C' } )
+    for( const char transB : { 'N', 'T', 'C' } )
+    {
+        const bool normalA = ( transA == 'N' ), normalB = ( transB == 'N' );
+        Matrix<DoubleDouble> A, B, C;
+        MakeDoubleDouble( A, normalA ? m : k, normalA ? k : m );
+        MakeDoubleDouble( B, normalB ? k : n, normalB ? n : k );
+        MakeDoubleDouble( C, m, n );
+        Matrix<DoubleDouble> CRef( C );
+        blas::Gemm
+        ( transA, transB, m, n, k,
+          alpha, A.LockedBuffer(), A.LDim(), B.LockedBuffer(), B.LDim(),
+          beta, C.Buffer(), C.LDim() );
+        blas::Gemm<DoubleDouble>
+        ( transA, transB, m, n, k,
+          alpha, A.LockedBuffer(), A.LDim(), B.LockedBuffer(), B.LDim(),
+          beta, CRef.Buffer(), CRef.LDim() );
+        const string label = string("Gemm(")+transA+","+transB+")";
+        // The entries of A and B are bounded by one, as are those of C
+        const double scale = 0.75*k + 1.25;
+        CheckClose( label, C, CRef, scale, Tolerance(k) );
+#ifdef EL_HAVE_QUAD
+        // Compare alpha op(A) op(B) against its quad-precision evaluation
+        Matrix<Quad> AQuad=ToQuad(A), BQuad=ToQuad(B), CQuad;
+        Zeros( CQuad, m, n );
+        blas::Gemm
+        ( transA, transB, m, n, k,
+          ToQuad(alpha), AQuad.LockedBuffer(), AQuad.LDim(),
+          BQuad.LockedBuffer(), BQuad.LDim(),
+          Quad(0), CQuad.Buffer(), CQuad.LDim() );
+        blas::Gemm
+        ( transA, transB, m, n, k,
+          alpha, A.LockedBuffer(), A.LDim(), B.LockedBuffer(), B.LDim(),
+          DoubleDouble(0), C.Buffer(), C.LDim() );
+        CheckQuad( label, C, CQuad, scale, Tolerance(k) );
+#endif
+    }
+    Output("Gemm passed");
+}
+
+void TestGemv( Int m, Int n )
+{
+    const DoubleDouble alpha(-0.5), beta(2);
+    for( const char trans : { 'N', 'T', 'C' } )
+    {
+        const bool normal = ( trans == 'N' );
+        const Int xLength = ( normal ? n : m ), yLength = ( normal ? m : n );
+        Matrix<DoubleDouble> A, x, y;
+        MakeDoubleDouble( A, m, n );
+        // Use strided vectors
+        MakeDoubleDouble( x, 2, xLength );
+        MakeDoubleDouble( y, 3, yLength );
+        Matrix<DoubleDouble> yRef( y );
+        blas::Gemv
+        ( trans, m, n, alpha, A.LockedBuffer(), A.LDim(),
+          x.LockedBuffer(), x.LDim(), beta, y.Buffer(), y.LDim() );
+        blas::Gemv<DoubleDouble>
+        ( trans, m, n, alpha, A.LockedBuffer(), A.LDim(),
+          x.LockedBuffer(), x.LDim(), beta, yRef.Buffer(), yRef.LDim() );
+        const string label = string("Gemv(")+trans+")";
+        const Int k = ( normal ? n : m );
+        CheckClose( label, y, yRef, 0.5*k+2, Tolerance(k) );
+#ifdef EL_HAVE_QUAD
+        Matrix<Quad> AQuad=ToQuad(A), xQuad=ToQuad(x);
+        Matrix<Quad> yQuad;
+        Zeros( yQuad, 3, yLength );
+        blas::Gemv
+        ( trans, m, n, ToQuad(alpha), AQuad.LockedBuffer(), AQuad.LDim(),
+          xQuad.LockedBuffer(), xQuad.LDim(),
+          Quad(0), yQuad.Buffer(), yQuad.LDim() );
+        blas::Gemv
+        ( trans, m, n, alpha, A.LockedBuffer(), A.LDim(),
+          x.LockedBuffer(), x.LDim(), DoubleDouble(0), y.Buffer(), y.LDim() );
+        auto yRow = y( IR(0), ALL );
+        auto yQuadRow = yQuad( IR(0), ALL );
+        CheckQuad( label, yRow, yQuadRow, 0.5*k, Tolerance(k) );
+#endif
+    }
+    Output("Gemv passed");
+}
+
+void TestSyrk( Int n, Int k )
+{
+    const DoubleDouble alpha(1.5), beta(-0.5);
+    for( const char uplo : { 'L', 'U' } )
+    for( const char trans : { 'N', 'T', 'C' } )
+    {
+        const bool normal = ( trans == 'N' );
+        Matrix<DoubleDouble> A, C;
+        MakeDoubleDouble( A, normal ? n : k, normal ? k : n );
+        MakeDoubleDouble( C, n, n );
+        Matrix<DoubleDouble> CRef( C );
+        blas::Syrk
+        ( uplo, trans, n, k, alpha, A.LockedBuffer(), A.LDim(),
+          beta, C.Buffer(), C.LDim() );
+        blas::Syrk<DoubleDouble>
+        ( uplo, trans, n, k, alpha, A.LockedBuffer(), A.LDim(),
+          beta, CRef.Buffer(), CRef.LDim() );
+        // Both the referenced triangle and the untouched one must agree
+        const string label = string("Syrk(")+uplo+","+trans+")";
+        CheckClose( label, C, CRef, 1.5*k+0.5, Tolerance(k) );
+    }
+    Output("Syrk passed");
+}
+
+void TestTrsm( Int m, Int n )
+{
+    const DoubleDouble alpha(3);
+    for( const char side : { 'L', 'R' } )
+    for( const char uplo : { 'L', 'U' } )
+    for( const char trans : { 'N', 'T', 'C' } )
+    for( const char unit : { 'N', 'U' } )
+    {
+        // Make the triangular matrix diagonally dominant so that the solves
+        // are well-conditioned
+        const Int order = ( side == 'L' ? m : n );
+        Matrix<DoubleDouble> A, B;
+        MakeDoubleDouble( A, order, order );
+        for( Int j=0; j<order; ++j )
+            for( Int i=0; i<order; ++i )
+                A(i,j) *= DoubleDouble(1)/DoubleDouble(double(order));
+        if( unit == 'N' )
+            for( Int j=0; j<order; ++j )
+                A(j,j) += DoubleDouble(2);
+        MakeDoubleDouble( B, m, n );
+        Matrix<DoubleDouble> BRef( B );
+        blas::Trsm
+        ( side, uplo, trans, unit, m, n, alpha,
+          A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
+        blas::Trsm<DoubleDouble>
+        ( side, uplo, trans, unit, m, n, alpha,
+          A.LockedBuffer(), A.LDim(), BRef.Buffer(), BRef.LDim() );
+        const string label =
+          string("Trsm(")+side+","+uplo+","+trans+","+unit+")";
+        CheckClose( label, B, BRef, 3, 10*Tolerance(order) );
+    }
+    Output("Trsm passed");
+}
+#endif // ifdef EL_HAVE_QD
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of result",37);
+        const Int n = Input("--n","width of result",29);
+        const Int k = Input("--k","inner dimension",41);
+        ProcessInput();
+        PrintInputReport();
+
+#ifdef EL_HAVE_QD
+        TestGemm( m, n, k );
+        TestGemv( m, n );
+        TestSyrk( n, k );
+        TestTrsm( m, n );
+#else
+        Output
+        ("Elemental was not built with QD support, so the ",m," x ",n," x ",k,
+         " double-double kernel tests were skipped");
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
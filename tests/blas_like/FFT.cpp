@@ -0,0 +1,189 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A deterministic fill so that every process can form the dense reference
+template<typename Field>
+Field TestEntry( Int i, Int j )
+{
+    Field value = Base<Field>((7*i+3*j) % 11) - 5;
+    if( IsComplex<Field>::value )
+        SetImagPart( value, Base<Field>((5*i+j) % 13) - 6 );
+    return value;
+}
+
+// Check the local rows of Y against those of the dense product op(A) X
+template<typename Field>
+void CheckOperator
+( const string& name,
+  Orientation orientation,
+  const Matrix<Field>& A,
+  const DistLinearOperator<Field>& AOp,
+  Int numRHS )
+{
+    typedef Base<Field> Real;
+    const Grid& grid = AOp.Grid();
+    const Int inHeight = ( orientation == NORMAL ? A.Width() : A.Height() );
+    const Int outHeight = ( orientation == NORMAL ? A.Height() : A.Width() );
+
+    Matrix<Field> X, Y;
+    X.Resize( inHeight, numRHS );
+    for( Int j=0; j<numRHS; ++j )
+        for( Int i=0; i<inHeight; ++i )
+            X(i,j) = TestEntry<Field>( i, j );
+    Gemm( orientation, NORMAL, Field(1), A, X, Y );
+
+    DistMultiVec<Field> XDist(grid), YDist(grid);
+    XDist.Resize( inHeight, numRHS );
+    for( Int iLoc=0; iLoc<XDist.LocalHeight(); ++iLoc )
+        for( Int j=0; j<numRHS; ++j )
+            XDist.SetLocal
+            ( iLoc, j, TestEntry<Field>( XDist.GlobalRow(iLoc), j ) );
+    Zeros( YDist, outHeight, numRHS );
+    AOp.Apply( orientation, Field(1), XDist, Field(0), YDist );
+
+    Real localError = 0;
+    for( Int iLoc=0; iLoc<YDist.LocalHeight(); ++iLoc )
+    {
+        const Int i = YDist.GlobalRow(iLoc);
+        for( Int j=0; j<numRHS; ++j )
+            localError =
+              Max( localError, Abs(YDist.GetLocal(iLoc,j)-Y(i,j)) );
+    }
+    const Real error = mpi::AllReduce( localError, mpi::MAX, grid.Comm() );
+    const Real relError = error / MaxNorm( Y );
+    OutputFromRoot
+    (grid.Comm(),name," (",OrientationToChar(orientation),"): ",
+     "|| Y - op(A) X ||_max / || op(A) X ||_max = ",relError);
+    const Int n = Max( inHeight, outHeight );
+    if( relError > n*limits::Epsilon<Real>()*100 )
+        LogicError("Relative error was unacceptably large");
+}
+
+template<typename Field>
+void TestStructuredOperators( Int n, Int numRHS, const Grid& grid )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    const Int m = n + 3;
+
+    vector<Field> a(m+n-1);
+    for( Int i=0; i<m+n-1; ++i )
+        a[i] = TestEntry<Field>( i, 1 );
+    Matrix<Field> A;
+
+    Toeplitz( A, m, n, a );
+    auto toeplitzOp = ToeplitzOperator( m, n, a, grid );
+    CheckOperator( "Toeplitz", NORMAL, A, toeplitzOp, numRHS );
+    CheckOperator( "Toeplitz", TRANSPOSE, A, toeplitzOp, numRHS );
+    CheckOperator( "Toeplitz", ADJOINT, A, toeplitzOp, numRHS );
+
+    Hankel( A, m, n, a );
+    auto hankelOp = HankelOperator( m, n, a, grid );
+    CheckOperator( "Hankel", NORMAL, A, hankelOp, numRHS );
+    CheckOperator( "Hankel", ADJOINT, A, hankelOp, numRHS );
+
+    a.resize( n );
+    Circulant( A, a );
+    auto circulantOp = CirculantOperator( a, grid );
+    CheckOperator( "Circulant", NORMAL, A, circulantOp, numRHS );
+    CheckOperator( "Circulant", ADJOINT, A, circulantOp, numRHS );
+
+    Int k = 1;
+    while( (Int(2) << k) <= n )
+        ++k;
+    for( bool binary : { false, true } )
+    {
+        Walsh( A, k, binary );
+        auto walshOp = WalshOperator<Field>( k, grid, binary );
+        CheckOperator
+        ( binary ? "Binary Walsh" : "Walsh", NORMAL, A, walshOp, numRHS );
+    }
+}
+
+// The Kronecker and Khatri-Rao operators are checked against the explicit
+// products of small deterministic factors
+template<typename Field>
+void TestKroneckerOperators( Int numRHS, const Grid& grid )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    const Int mA=7, nA=5, mB=4, nB=6;
+    Matrix<Field> A, B, C;
+    A.Resize( mA, nA );
+    B.Resize( mB, nB );
+    for( Int j=0; j<nA; ++j )
+        for( Int i=0; i<mA; ++i )
+            A(i,j) = TestEntry<Field>( i, j+1 );
+    for( Int j=0; j<nB; ++j )
+        for( Int i=0; i<mB; ++i )
+            B(i,j) = TestEntry<Field>( i+2, j );
+    DistMatrix<Field,STAR,STAR> ADist(grid), BDist(grid);
+    ADist.Resize( mA, nA );
+    BDist.Resize( mB, nB );
+    Copy( A, ADist.Matrix() );
+    Copy( B, BDist.Matrix() );
+
+    Kronecker( A, B, C );
+    auto kroneckerOp = KroneckerOperator( ADist, BDist );
+    CheckOperator( "Kronecker", NORMAL, C, kroneckerOp, numRHS );
+    CheckOperator( "Kronecker", TRANSPOSE, C, kroneckerOp, numRHS );
+    CheckOperator( "Kronecker", ADJOINT, C, kroneckerOp, numRHS );
+
+    // Truncate B to have as many columns as A
+    auto BTrunc = B( ALL, IR(0,nA) );
+    auto BTruncDist = BDist( ALL, IR(0,nA) );
+    Zeros( C, mA*mB, nA );
+    for( Int j=0; j<nA; ++j )
+        for( Int iA=0; iA<mA; ++iA )
+            for( Int iB=0; iB<mB; ++iB )
+                C(iA*mB+iB,j) = A(iA,j)*BTrunc(iB,j);
+    auto khatriRaoOp = KhatriRaoOperator( ADist, BTruncDist );
+    CheckOperator( "Khatri-Rao", NORMAL, C, khatriRaoOp, numRHS );
+    CheckOperator( "Khatri-Rao", TRANSPOSE, C, khatriRaoOp, numRHS );
+    CheckOperator( "Khatri-Rao", ADJOINT, C, khatriRaoOp, numRHS );
+}
+
+template<typename Real>
+void TestFourier( Int n, Int numRHS, const Grid& grid )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Complex<Real>>());
+    Matrix<Complex<Real>> F;
+    Fourier( F, n );
+    auto fourierOp = FourierOperator<Real>( n, grid );
+    CheckOperator( "Fourier", NORMAL, F, fourierOp, numRHS );
+    CheckOperator( "Fourier", ADJOINT, F, fourierOp, numRHS );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","order of the matrices",100);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestFourier<float>( n, numRHS, grid );
+        TestFourier<double>( n, numRHS, grid );
+        // A prime order exercises Bluestein's algorithm
+        TestFourier<double>( 97, numRHS, grid );
+        TestStructuredOperators<float>( n, numRHS, grid );
+        TestStructuredOperators<double>( n, numRHS, grid );
+        TestStructuredOperators<Complex<double>>( n, numRHS, grid );
+        TestKroneckerOperators<double>( numRHS, grid );
+        TestKroneckerOperators<Complex<double>>( numRHS, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
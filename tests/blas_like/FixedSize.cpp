@@ -0,0 +1,95 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the fixed-size kernels against their dynamic counterparts
+template<typename Field>
+void TestFixedSize( Int n )
+{
+    typedef Base<Field> Real;
+    Output("Testing with ",TypeName<Field>());
+    const Real tol = 100*limits::Epsilon<Real>();
+
+    Matrix<Field> A, B, C;
+    Uniform( A, 3, 2 );
+    Uniform( B, 2, 3 );
+    Uniform( C, 3, 3 );
+    FixedMatrix<Field,3,2> AFixed;
+    FixedMatrix<Field,2,3> BFixed;
+    FixedMatrix<Field,3,3> CFixed;
+    AFixed.Load( A );
+    BFixed.Load( B );
+    CFixed.Load( C );
+    const Field alpha( 2 ), beta( -1 );
+    Gemm( NORMAL, NORMAL, alpha, A, B, beta, C );
+    Gemm( alpha, AFixed, BFixed, beta, CFixed );
+    Matrix<Field> CFromFixed( 3, 3 );
+    CFixed.Store( CFromFixed );
+    CFromFixed -= C;
+    if( MaxNorm(CFromFixed) > tol*MaxNorm(C) )
+        LogicError("Fixed-size Gemm was incorrect");
+
+    // Invert a (Hermitian) 2x2 pivot with a dominant off-diagonal entry
+    for( const bool conjugate : { false, true } )
+    {
+        Matrix<Field> D( 2, 2 );
+        D(0,0) = Field(Real(0.25));
+        D(1,1) = Field(Real(-0.5));
+        D(1,0) = Field(Real(2));
+        D(0,1) = conjugate ? Conj(D(1,0)) : D(1,0);
+        FixedMatrix<Field,2,2> DInv;
+        DInv.Load( D );
+        Symmetric2x2Inv( LOWER, DInv, conjugate );
+        MakeSymmetric( LOWER, DInv, conjugate );
+        Matrix<Field> DInvDyn( 2, 2 ), Id;
+        DInv.Store( DInvDyn );
+        Identity( Id, 2, 2 );
+        Gemm( NORMAL, NORMAL, Field(1), D, DInvDyn, Field(-1), Id );
+        if( MaxNorm(Id) > tol )
+            LogicError("Fixed-size Symmetric2x2Inv was incorrect");
+    }
+
+    // Apply a 2x2 transformation to two rows and two columns
+    Matrix<Field> G, X, XFixed;
+    Uniform( G, 2, 2 );
+    Uniform( X, n, n );
+    XFixed = X;
+    FixedMatrix<Field,2,2> GFixed;
+    GFixed.Load( G );
+    Transform2x2Rows( G, X, 1, n-1 );
+    Transform2x2Rows( GFixed, XFixed, 1, n-1 );
+    Transform2x2Cols( G, X, 0, n/2 );
+    Transform2x2Cols( GFixed, XFixed, 0, n/2 );
+    XFixed -= X;
+    if( MaxNorm(XFixed) > tol*MaxNorm(X) )
+        LogicError("Fixed-size Transform2x2 was incorrect");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","size of transformed matrix",20);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+        {
+            TestFixedSize<float>( n );
+            TestFixedSize<double>( n );
+            TestFixedSize<Complex<double>>( n );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+#include <El.hpp>
+using namespace El;
+
+template <typename T, DistWrap W>
+void TestFused(Int m, Int n, const Grid& g, bool print)
+{
+  const T alpha = T(2);
+  const T beta = T(-3);
+  DistMatrix<T, MC, MR, W> X(g), Y(g), U(g);
+  Uniform(X, m, n);
+  Uniform(Y, m, n);
+  Uniform(U, m, n);
+  if (print)
+  {
+    Print(X, "X");
+    Print(Y, "Y");
+    Print(U, "U");
+  }
+
+  // Form Z := alpha X .* Y + beta U with the unfused routines.
+  DistMatrix<T, MC, MR, W> ZUnfused(g);
+  Hadamard(X, Y, ZUnfused);
+  ZUnfused *= alpha;
+  Axpy(beta, U, ZUnfused);
+
+  // Form the same update in a single pass, then overwrite U in-place with the
+  // absolute values of its sum with X.
+  DistMatrix<T, MC, MR, W> Z(g);
+  Evaluate(alpha*Lazy(X)*Lazy(Y) + beta*Lazy(U), Z);
+  DistMatrix<T, MC, MR, W> V(U);
+  Evaluate(Map(Lazy(U) + Lazy(X), [](const T& eta) { return T(Abs(eta)); }),
+           U);
+  mpi::Barrier(g.Comm());
+  if (print)
+  {
+    Print(ZUnfused, "ZUnfused");
+    Print(Z, "Z");
+  }
+
+  const Base<T> tol = 10 * limits::Epsilon<El::Base<T>>();
+  for (Int j = 0; j < Z.LocalWidth(); ++j)
+  {
+    for (Int i = 0; i < Z.LocalHeight(); ++i)
+    {
+      const T got = Z.GetLocal(i, j);
+      const T expected = ZUnfused.GetLocal(i, j);
+      if (Abs(got - expected) > tol)
+      {
+        Output("Results do not match, Z(", i, ",", j, ")=", got,
+               " instead of ", expected);
+        RuntimeError("got != expected");
+      }
+      const T gotMap = U.GetLocal(i, j);
+      const T expectedMap = Abs(V.GetLocal(i, j) + X.GetLocal(i, j));
+      if (Abs(gotMap - expectedMap) > tol)
+      {
+        Output("Results do not match, U(", i, ",", j, ")=", gotMap,
+               " instead of ", expectedMap);
+        RuntimeError("got != expected");
+      }
+    }
+  }
+}
+
+int main(int argc, char** argv)
+{
+  Environment env(argc, argv);
+  mpi::Comm comm = mpi::COMM_WORLD;
+  try
+  {
+    const Int m = Input("--m", "height", 100);
+    const Int n = Input("--n", "width", 100);
+    const bool print = Input("--print", "print matrices?", false);
+    ProcessInput();
+    PrintInputReport();
+
+    const Grid g(comm);
+    OutputFromRoot(comm, "Testing fused entrywise expressions");
+    TestFused<float, ELEMENT>(m, n, g, print);
+    TestFused<float, BLOCK>(m, n, g, print);
+    TestFused<Complex<float>, ELEMENT>(m, n, g, print);
+    TestFused<Complex<float>, BLOCK>(m, n, g, print);
+    TestFused<double, ELEMENT>(m, n, g, print);
+    TestFused<double, BLOCK>(m, n, g, print);
+    TestFused<Complex<double>, ELEMENT>(m, n, g, print);
+    TestFused<Complex<double>, BLOCK>(m, n, g, print);
+#if defined(EL_HAVE_QD)
+    TestFused<DoubleDouble, ELEMENT>(m, n, g, print);
+    TestFused<DoubleDouble, BLOCK>(m, n, g, print);
+    TestFused<QuadDouble, ELEMENT>(m, n, g, print);
+    TestFused<QuadDouble, BLOCK>(m, n, g, print);
+#endif
+#if defined(EL_HAVE_QUAD)
+    TestFused<Quad, ELEMENT>(m, n, g, print);
+    TestFused<Quad, BLOCK>(m, n, g, print);
+#endif
+#if defined(EL_HAVE_MPC)
+    TestFused<BigFloat, ELEMENT>(m, n, g, print);
+    TestFused<BigFloat, BLOCK>(m, n, g, print);
+#endif
+  }
+  catch (exception& e)
+  {
+    ReportException(e);
+  }
+}
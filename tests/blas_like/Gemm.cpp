@@ -53,6 +53,7 @@ void TestGemm
   const Grid& g,
   bool print,
   bool correctness,
+  int numLayers,
   Int colAlignA=0, Int rowAlignA=0,
   Int colAlignB=0, Int rowAlignB=0,
   Int colAlignC=0, Int rowAlignC=0 )
@@ -165,6 +166,51 @@ void TestGemm
             ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
         PopIndent();
     }
+
+    // Test Cannon's algorithm
+    OutputFromRoot(g.Comm(),"Cannon's Algorithm:");
+    PushIndent();
+    C = COrig;
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_CANNON );
+    mpi::Barrier( g.Comm() );
+    runTime = timer.Stop();
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+    OutputFromRoot
+    (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+    if( correctness )
+        TestAssociativity
+        ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+    PopIndent();
+
+    if( numLayers > 1 && g.Size() % numLayers == 0 )
+    {
+        // Test the 2.5D variant of Gemm
+        OutputFromRoot(g.Comm(),"2.5D Algorithm with ",numLayers," layers:");
+        PushIndent();
+        SetGemmNumLayers( numLayers );
+        C = COrig;
+        mpi::Barrier( g.Comm() );
+        timer.Start();
+        Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_25D );
+        mpi::Barrier( g.Comm() );
+        runTime = timer.Stop();
+        SetGemmNumLayers( 1 );
+        realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+        gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+        OutputFromRoot
+        (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+        if( print )
+            Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+        if( correctness )
+            TestAssociativity
+            ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+        PopIndent();
+    }
     PopIndent();
 }
 
@@ -186,6 +232,8 @@ main( int argc, char* argv[] )
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const bool print = Input("--print","print matrices?",false);
         const bool correctness = Input("--correctness","correctness?",true);
+        const int numLayers =
+          Input("--numLayers","number of layers for 2.5D Gemm",2);
         const Int colAlignA = Input("--colAlignA","column align of A",0);
         const Int colAlignB = Input("--colAlignB","column align of B",0);
         const Int colAlignC = Input("--colAlignC","column align of C",0);
@@ -211,7 +259,7 @@ main( int argc, char* argv[] )
           m, n, k,
           float(3), float(4),
           g,
-          print, correctness,
+          print, correctness, numLayers,
           colAlignA, rowAlignA,
           colAlignB, rowAlignB,
           colAlignC, rowAlignC );
@@ -220,7 +268,7 @@ main( int argc, char* argv[] )
           m, n, k,
           Complex<float>(3), Complex<float>(4),
           g,
-          print, correctness,
+          print, correctness, numLayers,
           colAlignA, rowAlignA,
           colAlignB, rowAlignB,
           colAlignC, rowAlignC );
@@ -230,7 +278,7 @@ main( int argc, char* argv[] )
           m, n, k,
           double(3), double(4),
           g,
-          print, correctness,
+          print, correctness, numLayers,
           colAlignA, rowAlignA,
           colAlignB, rowAlignB,
           colAlignC, rowAlignC );
@@ -239,7 +287,7 @@ main( int argc, char* argv[] )
           m, n, k,
           Complex<double>(3), Complex<double>(4),
           g,
-          print, correctness,
+          print, correctness, numLayers,
           colAlignA, rowAlignA,
           colAlignB, rowAlignB,
           colAlignC, rowAlignC );
@@ -250,7 +298,7 @@ main( int argc, char* argv[] )
           m, n, k,
           DoubleDouble(3), DoubleDouble(4),
           g,
-          print, correctness,
+          print, correctness, numLayers,
           colAlignA, rowAlignA,
           colAlignB, rowAlignB,
           colAlignC, rowAlignC );
@@ -259,7 +307,7 @@ main( int argc, char* argv[] )
           m, n, k,
           QuadDouble(3), QuadDouble(4),
           g,
-          print, correctness,
+          print, correctness, numLayers,
           colAlignA, rowAlignA,
           colAlignB, rowAlignB,
           colAlignC, rowAlignC );
@@ -269,7 +317,7 @@ main( int argc, char* argv[] )
           m, n, k,
           Complex<DoubleDouble>(3), Complex<DoubleDouble>(4),
           g,
-          print, correctness,
+          print, correctness, numLayers,
           colAlignA, rowAlignA,
           colAlignB, rowAlignB,
           colAlignC, rowAlignC );
@@ -278,7 +326,7 @@ main( int argc, char* argv[] )
           m, n, k,
           Complex<QuadDouble>(3), Complex<QuadDouble>(4),
           g,
-          print, correctness,
+          print, correctness, numLayers,
           colAlignA, rowAlignA,
           colAlignB, rowAlignB,
           colAlignC, rowAlignC );
@@ -290,7 +338,7 @@ main( int argc, char* argv[] )
           m, n, k,
           Quad(3), Quad(4),
           g,
-          print, correctness,
+          print, correctness, numLayers,
           colAlignA, rowAlignA,
           colAlignB, rowAlignB,
           colAlignC, rowAlignC );
@@ -299,7 +347,7 @@ main( int argc, char* argv[] )
           m, n, k,
           Complex<Quad>(3), Complex<Quad>(4),
           g,
-          print, correctness,
+          print, correctness, numLayers,
           colAlignA, rowAlignA,
           colAlignB, rowAlignB,
           colAlignC, rowAlignC );
@@ -311,7 +359,7 @@ main( int argc, char* argv[] )
           m, n, k,
           BigFloat(3), BigFloat(4),
           g,
-          print, correctness,
+          print, correctness, numLayers,
           colAlignA, rowAlignA,
           colAlignB, rowAlignB,
           colAlignC, rowAlignC );
@@ -320,7 +368,7 @@ main( int argc, char* argv[] )
           m, n, k,
           Complex<BigFloat>(3), Complex<BigFloat>(4),
           g,
-          print, correctness,
+          print, correctness, numLayers,
           colAlignA, rowAlignA,
           colAlignB, rowAlignB,
           colAlignC, rowAlignC );
@@ -41,30 +41,70 @@ void TestMultiply(Int m, Int n=1)
         Output("|| A B - G B ||_F = ",DFrob);
         RuntimeError("Sparse(I)*x != Graph(I)*x");
     }
+
+    // Compare the CSR and sliced ELLPACK products of a matrix with rows of
+    // varying lengths
+    SparseMatrix<T> S( m, m );
+    for( Int i=0; i<m; ++i )
+        for( Int j=i; j<Min(i+1+i%7,m); ++j )
+            S.QueueUpdate( i, j, T(i-j+1) );
+    S.ProcessQueues();
+    S.FreezeSparsity();
+    Matrix<T> E, F;
+    Ones( E, m, n );
+    Ones( F, m, n );
+    Multiply( NORMAL, T(2), S, B, T(-1), E );
+    S.EnableSlicedEllpack( 4, 16 );
+    Multiply( NORMAL, T(2), S, B, T(-1), F );
+    Axpy( T(-1), E, F );
+    auto FFrob = FrobeniusNorm(F);
+    if( FFrob > m*limits::Epsilon<Real>()*FrobeniusNorm(E) )
+    {
+        Output("|| S_CSR B - S_SELL B ||_F = ",FFrob);
+        RuntimeError("CSR and sliced ELLPACK products differ");
+    }
+
+    // Compare the sparse product (S S) B with S (S B)
+    SparseMatrix<T> SS;
+    Multiply( S, S, SS );
+    Matrix<T> SB, G1, G2;
+    Zeros( SB, m, n );
+    Zeros( G1, m, n );
+    Zeros( G2, m, n );
+    Multiply( NORMAL, T(1), S, B, T(0), SB );
+    Multiply( NORMAL, T(1), S, SB, T(0), G1 );
+    Multiply( NORMAL, T(1), SS, B, T(0), G2 );
+    Axpy( T(-1), G1, G2 );
+    auto GFrob = FrobeniusNorm(G2);
+    if( GFrob > m*limits::Epsilon<Real>()*FrobeniusNorm(G1) )
+    {
+        Output("|| (S S) B - S (S B) ||_F = ",GFrob);
+        RuntimeError("Sparse-sparse product was incorrect");
+    }
     else
         Output("Test passed");
 }
 
-void RunTests( Int m )
+void RunTests( Int m, Int n )
 {
     PushIndent();
-    TestMultiply<float>(m);
-    TestMultiply<Complex<float>>(m);
-    TestMultiply<double>(m);
-    TestMultiply<Complex<double>>(m);
+    TestMultiply<float>(m,n);
+    TestMultiply<Complex<float>>(m,n);
+    TestMultiply<double>(m,n);
+    TestMultiply<Complex<double>>(m,n);
 #ifdef EL_HAVE_QD
-    TestMultiply<DoubleDouble>(m);
-    TestMultiply<Complex<DoubleDouble>>(m);
-    TestMultiply<QuadDouble>(m);
-    TestMultiply<Complex<QuadDouble>>(m);
+    TestMultiply<DoubleDouble>(m,n);
+    TestMultiply<Complex<DoubleDouble>>(m,n);
+    TestMultiply<QuadDouble>(m,n);
+    TestMultiply<Complex<QuadDouble>>(m,n);
 #endif
 #ifdef EL_HAVE_QUAD
-    TestMultiply<Quad>(m);
-    TestMultiply<Complex<Quad>>(m);
+    TestMultiply<Quad>(m,n);
+    TestMultiply<Complex<Quad>>(m,n);
 #endif
 #ifdef EL_HAVE_MPC
-    TestMultiply<BigFloat>(m);
-    TestMultiply<Complex<BigFloat>>(m);
+    TestMultiply<BigFloat>(m,n);
+    TestMultiply<Complex<BigFloat>>(m,n);
 #endif
     PopIndent();
 }
@@ -78,8 +118,11 @@ int main( int argc, char* argv[] )
         for( Int e=1; e<4; ++e )
         {    
             m *= 10;    
-            Output("Testing with matrix height of ",m);
-            RunTests(m);
+            Output("Testing with matrix height of ",m," and one column");
+            RunTests(m,1);
+            // Exercise the row-major multi-vector kernels
+            Output("Testing with matrix height of ",m," and 20 columns");
+            RunTests(m,20);
         }
     }
     catch( exception& e ) { ReportException(e); }
@@ -0,0 +1,76 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the zero-copy reshapes, orientation-tagged views, and distributed
+// vector transposes against their explicitly-formed counterparts
+template<typename F>
+void TestViews( Int m, Int n, const Grid& g )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+
+    Matrix<F> A, AReshape;
+    Uniform( A, m, n );
+    Reshape( n, m, A, AReshape );
+    auto AReshapeView = LockedReshapeView( n, m, A );
+    if( AReshapeView.LockedBuffer() != A.LockedBuffer() )
+        LogicError("ReshapeView copied its data");
+    AReshape -= AReshapeView;
+    if( FrobeniusNorm( AReshape ) != Real(0) )
+        LogicError("ReshapeView did not match Reshape");
+
+    // C := A^H B is formed both explicitly and through views, and then
+    // CView := CView - (C^H)^H
+    Matrix<F> B, C, CView, AAdj, CAdj;
+    Uniform( B, m, n );
+    Adjoint( A, AAdj );
+    Gemm( NORMAL, NORMAL, F(1), AAdj, B, C );
+    Zeros( CView, n, n );
+    Gemm( F(1), AdjointView(A), NormalView(B), F(0), CView );
+    Adjoint( C, CAdj );
+    Axpy( F(-1), AdjointView(CAdj), CView );
+    const Real relError = FrobeniusNorm( CView ) / FrobeniusNorm( C );
+    OutputFromRoot(g.Comm(),"Oriented Gemm/Axpy relative error: ",relError);
+    if( relError > n*limits::Epsilon<Real>()*100 )
+        LogicError("Oriented Gemm/Axpy did not match");
+
+    DistMatrix<F> x(g), xAdj(g);
+    Uniform( x, m, 1 );
+    Adjoint( x, xAdj );
+    DistMatrix<F,STAR,STAR> x_STAR_STAR( x ), xAdj_STAR_STAR( xAdj );
+    Matrix<F> xAdjSeq;
+    Adjoint( x_STAR_STAR.Matrix(), xAdjSeq );
+    xAdj_STAR_STAR.Matrix() -= xAdjSeq;
+    if( FrobeniusNorm( xAdj_STAR_STAR.Matrix() ) != Real(0) )
+        LogicError("Distributed vector transpose did not match");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",50);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestViews<float>( m, n, g );
+        TestViews<double>( m, n, g );
+        TestViews<Complex<double>>( m, n, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,144 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The batched and reference results only differ in their order of summation,
+// so their difference should be bounded by a modest multiple of
+// size*eps*scale, where scale is || A || || B || for an inner product and the
+// norm itself otherwise
+template<typename Field>
+void CheckResult
+( const Grid& grid,
+  const string& label,
+  Field batched,
+  Field reference,
+  Base<Field> scale,
+  Int size )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real error = Abs(batched-reference);
+    OutputFromRoot
+    (grid.Comm(),label,": batched=",batched,", reference=",reference);
+    if( error > 10*size*eps*scale )
+        LogicError(label," differed by ",error);
+}
+
+template<typename Field>
+void TestDistMatrix( const Grid& grid, Int m, Int n )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(grid.Comm(),"DistMatrix batch:");
+    PushIndent();
+    DistMatrix<Field> A(grid), B(grid), C(grid);
+    Gaussian( A, m, n );
+    Gaussian( B, m, n );
+    Gaussian( C, m, n );
+    // Scale C so that squaring most of its entries overflows
+    C *= Field(Sqrt(limits::Max<Real>()));
+
+    ReductionBatch<Field> batch;
+    const Int abIndex = batch.QueueDot( A, B );
+    const Int aIndex = batch.QueueNrm2( A );
+    const Int bIndex = batch.QueueNrm2( B );
+    const Int cIndex = batch.QueueNrm2( C );
+    batch.Execute();
+
+    const Int size = m*n;
+    const Real ANorm = FrobeniusNorm( A );
+    const Real BNorm = FrobeniusNorm( B );
+    const Real CNorm = FrobeniusNorm( C );
+    if( !limits::IsFinite(CNorm) )
+        LogicError("The reference norm of C was not finite");
+    CheckResult
+    ( grid, "A^H B", batch.Dot(abIndex), Dot(A,B), ANorm*BNorm, size );
+    CheckResult( grid, "|| A ||_F", batch.Nrm2(aIndex), ANorm, ANorm, size );
+    CheckResult( grid, "|| B ||_F", batch.Nrm2(bIndex), BNorm, BNorm, size );
+    CheckResult( grid, "|| C ||_F", batch.Nrm2(cIndex), CNorm, CNorm, size );
+    PopIndent();
+}
+
+template<typename Field>
+void TestDistMultiVec( const Grid& grid, Int m, Int n )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(grid.Comm(),"DistMultiVec batch of mixed heights:");
+    PushIndent();
+    // Mimic the residual checks of an interior point method, with m x 1
+    // primal and n x 1 dual quantities
+    DistMultiVec<Field> b(grid), y(grid), rb(grid), c(grid), x(grid), rc(grid);
+    Gaussian( b, m, 1 );
+    Gaussian( y, m, 1 );
+    Gaussian( rb, m, 1 );
+    Gaussian( c, n, 1 );
+    Gaussian( x, n, 1 );
+    Gaussian( rc, n, 1 );
+
+    ReductionBatch<Field> batch;
+    const Int cxIndex = batch.QueueDot( c, x );
+    const Int byIndex = batch.QueueDot( b, y );
+    const Int rbIndex = batch.QueueNrm2( rb );
+    const Int rcIndex = batch.QueueNrm2( rc );
+    const Int xIndex = batch.QueueNrm2( x );
+    batch.Execute();
+
+    const Real bNorm = FrobeniusNorm( b );
+    const Real yNorm = FrobeniusNorm( y );
+    const Real cNorm = FrobeniusNorm( c );
+    const Real xNorm = FrobeniusNorm( x );
+    const Real rbNorm = FrobeniusNorm( rb );
+    const Real rcNorm = FrobeniusNorm( rc );
+    CheckResult( grid, "c^H x", batch.Dot(cxIndex), Dot(c,x), cNorm*xNorm, n );
+    CheckResult( grid, "b^H y", batch.Dot(byIndex), Dot(b,y), bNorm*yNorm, m );
+    CheckResult
+    ( grid, "|| r_b ||_2", batch.Nrm2(rbIndex), rbNorm, rbNorm, m );
+    CheckResult
+    ( grid, "|| r_c ||_2", batch.Nrm2(rcIndex), rcNorm, rcNorm, n );
+    CheckResult( grid, "|| x ||_2", batch.Nrm2(xIndex), xNorm, xNorm, n );
+
+    bool caught = false;
+    try { batch.QueueDot( b, x ); }
+    catch( std::exception& ) { caught = true; }
+    if( !caught )
+        LogicError("Nonconforming inner product was not rejected");
+    PopIndent();
+}
+
+template<typename Field>
+void TestReductionBatch( const Grid& grid, Int m, Int n )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+    TestDistMatrix<Field>( grid, m, n );
+    TestDistMultiVec<Field>( grid, m, n );
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height",1000);
+        const Int n = Input("--n","width (or dual height)",700);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestReductionBatch<float>( grid, m, n );
+        TestReductionBatch<double>( grid, m, n );
+        TestReductionBatch<Complex<double>>( grid, m, n );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,164 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the level-scheduled sparse Trsm against the dense Trsm of the same
+// triangle for each combination of LOWER/UPPER and UNIT/NON_UNIT with several
+// right-hand sides, then add entries to the pattern and require that the
+// cached level schedule is rebuilt rather than reused.
+
+// Require that each row of the schedule only depends upon rows of previous
+// levels and that the diagonal offsets point at the diagonal entries
+template<typename F>
+void CheckSchedule( const SparseMatrix<F>& A, UpperOrLower uplo )
+{
+    const auto& schedule = A.LockedLevelSchedule( uplo );
+    const Int n = A.Height();
+    if( !schedule.ready || schedule.uplo != uplo || schedule.height != n )
+        LogicError("Level schedule was not rebuilt for the current pattern");
+    vector<Int> rowLevels( n, -1 );
+    for( Int level=0; level<schedule.NumLevels(); ++level )
+        for( Int k=schedule.levelOffsets[level];
+                 k<schedule.levelOffsets[level+1]; ++k )
+            rowLevels[schedule.rows[k]] = level;
+
+    const Int* offsets = A.LockedOffsetBuffer();
+    const Int* cols = A.LockedTargetBuffer();
+    for( Int i=0; i<n; ++i )
+    {
+        if( rowLevels[i] < 0 )
+            LogicError("Row ",i," was missing from the level schedule");
+        Int diagOffset = -1;
+        for( Int e=offsets[i]; e<offsets[i+1]; ++e )
+        {
+            const Int j = cols[e];
+            if( j == i )
+                diagOffset = e;
+            else if( ((uplo == LOWER && j < i) || (uplo == UPPER && j > i)) &&
+                     rowLevels[j] >= rowLevels[i] )
+                LogicError
+                ("Row ",i," was scheduled no later than its dependency ",j);
+        }
+        if( schedule.diagOffsets[i] != diagOffset )
+            LogicError
+            ("Diagonal offset of row ",i," was ",schedule.diagOffsets[i],
+             " rather than ",diagOffset);
+    }
+}
+
+template<typename F>
+void CompareWithDense
+( const string& label,
+  UpperOrLower uplo, UnitOrNonUnit diag, F alpha,
+  const SparseMatrix<F>& A, const Matrix<F>& B )
+{
+    typedef Base<F> Real;
+    Matrix<F> X( B );
+    Trsm( uplo, diag, alpha, A, X );
+
+    // The dense Trsm also ignores the opposite triangle (and, for UNIT, the
+    // diagonal), so both solves see the same triangular matrix
+    Matrix<F> ADense, XDense( B );
+    Copy( A, ADense );
+    Trsm( LEFT, uplo, NORMAL, diag, alpha, ADense, XDense );
+
+    const Real XFrob = FrobeniusNorm( XDense );
+    XDense -= X;
+    const Real relError = FrobeniusNorm( XDense ) / XFrob;
+    const Real eps = limits::Epsilon<Real>();
+    Output(label,": || X_dense - X_sparse ||_F / || X_dense ||_F = ",relError);
+    if( relError > 100*A.Height()*eps )
+        LogicError(label," differed from the dense Trsm");
+}
+
+template<typename F>
+void TestSparseTrsm( Int n, Int numRHS )
+{
+    Output("Testing with ",TypeName<F>());
+    PushIndent();
+
+    // A pseudo-random pattern in both triangles (which each solve must ignore
+    // one of) with a dominant diagonal
+    SparseMatrix<F> A( n, n );
+    for( Int i=0; i<n; ++i )
+    {
+        A.QueueUpdate( i, i, F(n) + SampleUniform<F>() );
+        for( Int j=0; j<n; ++j )
+            if( j != i && (7*i+13*j) % 5 == 0 )
+                A.QueueUpdate( i, j, SampleUniform<F>() );
+    }
+    A.ProcessQueues();
+
+    Matrix<F> B;
+    Uniform( B, n, numRHS );
+    const F alpha = F(3)/F(2);
+    for( const UpperOrLower uplo : { LOWER, UPPER } )
+    {
+        for( const UnitOrNonUnit diag : { UNIT, NON_UNIT } )
+        {
+            const string label =
+              string(uplo == LOWER ? "LOWER" : "UPPER") + " " +
+              string(diag == UNIT ? "UNIT" : "NON_UNIT");
+            CompareWithDense( label, uplo, diag, alpha, A, B );
+        }
+        CheckSchedule( A, uplo );
+    }
+
+    // Lengthen the dependency chains of both triangles so that the cached
+    // schedules (and every diagonal offset after the first row) are stale
+    for( Int i=1; i<n; ++i )
+    {
+        A.QueueUpdate( i, i-1, SampleUniform<F>() );
+        A.QueueUpdate( i-1, i, SampleUniform<F>() );
+    }
+    A.ProcessQueues();
+    for( const UpperOrLower uplo : { LOWER, UPPER } )
+    {
+        CheckSchedule( A, uplo );
+        if( A.LockedLevelSchedule(uplo).NumLevels() != n )
+            LogicError("The tridiagonal chain should require ",n," levels");
+        const string label =
+          string(uplo == LOWER ? "LOWER" : "UPPER") +
+          " NON_UNIT after a pattern change";
+        CompareWithDense( label, uplo, NON_UNIT, alpha, A, B );
+    }
+
+    // Modifying values alone leaves the schedule valid
+    A.ValueBuffer()[0] *= F(2);
+    CheckSchedule( A, LOWER );
+    CompareWithDense( "LOWER NON_UNIT after a value change", LOWER, NON_UNIT,
+      alpha, A, B );
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","height of matrix",100);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",7);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestSparseTrsm<float>( n, numRHS );
+            TestSparseTrsm<double>( n, numRHS );
+            TestSparseTrsm<Complex<double>>( n, numRHS );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
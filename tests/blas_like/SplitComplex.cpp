@@ -0,0 +1,83 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the split-complex kernels against their interleaved counterparts
+template<typename Real>
+void TestSplitComplex( Int m, Int n )
+{
+    typedef Complex<Real> C;
+    Output("Testing with ",TypeName<C>());
+    const Real tol = 100*limits::Epsilon<Real>();
+    const C alpha( Real(0.5), Real(-2) );
+
+    Matrix<C> A, B, C0;
+    Uniform( A, m, n );
+    Uniform( B, m, n );
+    Matrix<Real> AReal, AImag, BReal, BImag, CReal, CImag;
+    SplitComplex( A, AReal, AImag );
+    SplitComplex( B, BReal, BImag );
+
+    Matrix<C> AMerged;
+    MergeComplex( AReal, AImag, AMerged );
+    AMerged -= A;
+    if( MaxNorm(AMerged) != Real(0) )
+        LogicError("Split and merge did not round-trip");
+
+    Hadamard( A, B, C0 );
+    Hadamard( AReal, AImag, BReal, BImag, CReal, CImag );
+    Matrix<C> CMerged;
+    MergeComplex( CReal, CImag, CMerged );
+    CMerged -= C0;
+    if( MaxNorm(CMerged) > tol )
+        LogicError("Split Hadamard product was incorrect");
+
+    Axpy( alpha, A, B );
+    Axpy( alpha, AReal, AImag, BReal, BImag );
+    Matrix<C> BMerged;
+    MergeComplex( BReal, BImag, BMerged );
+    BMerged -= B;
+    if( MaxNorm(BMerged) > tol )
+        LogicError("Split Axpy was incorrect");
+
+    const C dot = Dot( A, B );
+    const C splitDot = Dot( AReal, AImag, BReal, BImag );
+    if( Abs(dot-splitDot) > tol*m*n )
+        LogicError("Split Dot was incorrect");
+
+    Scale( alpha, A );
+    Scale( alpha, AReal, AImag );
+    MergeComplex( AReal, AImag, AMerged );
+    AMerged -= A;
+    if( MaxNorm(AMerged) > tol )
+        LogicError("Split Scale was incorrect");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height",100);
+        const Int n = Input("--n","width",50);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+        {
+            TestSplitComplex<float>( m, n );
+            TestSplitComplex<double>( m, n );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the planned transfers of scattered submatrices against the queued
+// implementations, replaying each plan to ensure that it may be reused
+template<typename T,Dist U,Dist V>
+void TestSubmatrixPlan( Int m, Int n, const Grid& g )
+{
+    if( g.Rank() == 0 )
+        Output("Testing [",DistToString(U),",",DistToString(V),"]");
+    // Mix contiguous runs with scattered (and unsorted) indices
+    vector<Int> I, J;
+    for( Int i=m/4; i<m/2; ++i )
+        I.push_back( i );
+    for( Int i=m-1; i>=m/2; i-=3 )
+        I.push_back( i );
+    for( Int j=0; j<n; j+=2 )
+        J.push_back( j );
+    J.push_back( n-1 );
+
+    DistMatrix<T,U,V> A(g), ASub(g), ASubPlan(g);
+    Uniform( A, m, n );
+    SubmatrixPlan<T> plan;
+    for( Int rep=0; rep<2; ++rep )
+    {
+        GetSubmatrix( A, I, J, ASub );
+        GetSubmatrix( A, I, J, ASubPlan, plan );
+        ASubPlan -= ASub;
+        if( MaxNorm(ASubPlan) != Base<T>(0) )
+            LogicError("Planned GetSubmatrix was incorrect");
+    }
+
+    DistMatrix<T,U,V> B(g), BPlan(g);
+    Uniform( ASub, I.size(), J.size() );
+    const T alpha = T(3);
+    for( Int rep=0; rep<2; ++rep )
+    {
+        Uniform( B, m, n );
+        BPlan = B;
+        SetSubmatrix( B, I, J, ASub );
+        SetSubmatrix( BPlan, I, J, ASub, plan );
+        UpdateSubmatrix( B, I, J, alpha, ASub );
+        UpdateSubmatrix( BPlan, I, J, alpha, ASub, plan );
+        BPlan -= B;
+        const Base<T> tol = 10*limits::Epsilon<Base<T>>()*MaxNorm(B);
+        if( MaxNorm(BPlan) > tol )
+            LogicError("Planned Set/UpdateSubmatrix was incorrect");
+    }
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height",100);
+        const Int n = Input("--n","width",80);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestSubmatrixPlan<double,MC,MR>( m, n, g );
+        TestSubmatrixPlan<double,VC,STAR>( m, n, g );
+        TestSubmatrixPlan<Complex<double>,STAR,VR>( m, n, g );
+        TestSubmatrixPlan<float,MC,STAR>( m, n, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
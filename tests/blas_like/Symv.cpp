@@ -36,6 +36,24 @@ void TestSymv
         Print( y, "y" );
     }
 
+    // Compare the fused local kernel against the blocked one
+    {
+        SymvCtrl<T> ctrl;
+        ctrl.fuseLocalSymv = false;
+        auto yBlocked( y );
+        auto yFused( y );
+        Symv( uplo, alpha, A, x, beta, yBlocked, false, ctrl );
+        ctrl.fuseLocalSymv = true;
+        Symv( uplo, alpha, A, x, beta, yFused, false, ctrl );
+        const Base<T> yFrob = FrobeniusNorm( yBlocked );
+        yFused -= yBlocked;
+        const Base<T> relError = FrobeniusNorm( yFused ) / yFrob;
+        OutputFromRoot
+        (g.Comm(),"|| yFused - yBlocked ||_F / || y ||_F = ",relError);
+        if( relError > m*limits::Epsilon<Base<T>>()*10 )
+            LogicError("Fused local Symv did not match");
+    }
+
     // Test Symv
     OutputFromRoot(g.Comm(),"Starting Symv");
     mpi::Barrier( g.Comm() );
@@ -156,6 +156,24 @@ void TestSyrk
         MakeSymmetric( uplo, C, conjugate );
         TestAssociativity
         ( conjugate, uplo, orientation, alpha, A, beta, COrig, C, print );
+
+        // Compare against the sequential (recursive) implementation
+        DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC(A), C_CIRC_CIRC(C),
+                                CSeq_CIRC_CIRC(COrig);
+        if( C_CIRC_CIRC.CrossRank() == C_CIRC_CIRC.Root() )
+        {
+            auto& CSeq = CSeq_CIRC_CIRC.Matrix();
+            Syrk
+            ( uplo, orientation, alpha, A_CIRC_CIRC.LockedMatrix(),
+              beta, CSeq, conjugate );
+            MakeSymmetric( uplo, CSeq, conjugate );
+            const Base<T> CFrobNorm = FrobeniusNorm( C_CIRC_CIRC.Matrix() );
+            CSeq -= C_CIRC_CIRC.Matrix();
+            const Base<T> EFrobNorm = FrobeniusNorm( CSeq );
+            Output
+            ("|| C_seq - C ||_F / || C ||_F = ",
+             EFrobNorm,"/",CFrobNorm,"=",EFrobNorm/CFrobNorm);
+        }
     }
 
     PopIndent();
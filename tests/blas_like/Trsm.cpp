@@ -18,6 +18,7 @@ void TestTrsm
   Int m,
   Int n,
   F alpha,
+  TrsmAlgorithm alg,
   const Grid& g,
   bool print )
 {
@@ -53,7 +54,7 @@ void TestTrsm
     mpi::Barrier( g.Comm() );
     Timer timer;
     timer.Start();
-    Trsm( side, uplo, orientation, diag, alpha, A, Y );
+    Trsm( side, uplo, orientation, diag, alpha, A, Y, false, alg );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops =
@@ -97,6 +98,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--m","height of result",100);
         const Int n = Input("--n","width of result",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool inverse =
+          Input("--inverse","use the block-inverse algorithm?",false);
         const bool print = Input("--print","print matrices?",false);
         ProcessInput();
         PrintInputReport();
@@ -109,6 +112,7 @@ main( int argc, char* argv[] )
         const UpperOrLower uplo = CharToUpperOrLower( uploChar );
         const Orientation orientation = CharToOrientation( transChar );
         const UnitOrNonUnit diag = CharToUnitOrNonUnit( diagChar );
+        const TrsmAlgorithm alg = ( inverse ? TRSM_INVERSE : TRSM_DEFAULT );
         SetBlocksize( nb );
 
         ComplainIfDebug();
@@ -119,46 +123,46 @@ main( int argc, char* argv[] )
         ( side, uplo, orientation, diag,
           m, n,
           float(3),
-          g, print );
+          alg, g, print );
         TestTrsm<Complex<float>>
         ( side, uplo, orientation, diag,
           m, n,
           Complex<float>(3),
-          g, print );
+          alg, g, print );
 
         TestTrsm<double>
         ( side, uplo, orientation, diag,
           m, n,
           double(3),
-          g, print );
+          alg, g, print );
         TestTrsm<Complex<double>>
         ( side, uplo, orientation, diag,
           m, n,
           Complex<double>(3),
-          g, print );
+          alg, g, print );
 
 #ifdef EL_HAVE_QD
         TestTrsm<DoubleDouble>
         ( side, uplo, orientation, diag,
           m, n,
           DoubleDouble(3),
-          g, print );
+          alg, g, print );
         TestTrsm<QuadDouble>
         ( side, uplo, orientation, diag,
           m, n,
           QuadDouble(3),
-          g, print );
+          alg, g, print );
 
         TestTrsm<Complex<DoubleDouble>>
         ( side, uplo, orientation, diag,
           m, n,
           Complex<DoubleDouble>(3),
-          g, print );
+          alg, g, print );
         TestTrsm<Complex<QuadDouble>>
         ( side, uplo, orientation, diag,
           m, n,
           Complex<QuadDouble>(3),
-          g, print );
+          alg, g, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
@@ -166,12 +170,12 @@ main( int argc, char* argv[] )
         ( side, uplo, orientation, diag,
           m, n,
           Quad(3),
-          g, print );
+          alg, g, print );
         TestTrsm<Complex<Quad>>
         ( side, uplo, orientation, diag,
           m, n,
           Complex<Quad>(3),
-          g, print );
+          alg, g, print );
 #endif
 
 #ifdef EL_HAVE_MPC
@@ -179,12 +183,12 @@ main( int argc, char* argv[] )
         ( side, uplo, orientation, diag,
           m, n,
           BigFloat(3),
-          g, print );
+          alg, g, print );
         TestTrsm<Complex<BigFloat>>
         ( side, uplo, orientation, diag,
           m, n,
           Complex<BigFloat>(3),
-          g, print );
+          alg, g, print );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
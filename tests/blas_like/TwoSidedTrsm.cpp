@@ -91,7 +91,8 @@ void TestTwoSidedTrsm
   const Grid& g,
   bool scalapack,
   bool print,
-  bool correctness )
+  bool correctness,
+  Int lookahead )
 {
     Output("Testing with ",TypeName<F>());
     PushIndent();
@@ -126,7 +127,7 @@ void TestTwoSidedTrsm
     OutputFromRoot(g.Comm(),"Starting Elemental TwoSidedTrsm");
     mpi::Barrier( g.Comm() );
     timer.Start();
-    TwoSidedTrsm( uplo, diag, A, B );
+    TwoSidedTrsm( uplo, diag, A, B, lookahead );
     mpi::Barrier( g.Comm() );
     double runTime = timer.Stop();
     double gFlops = Pow(double(m),3.)/(runTime*1.e9);
@@ -148,7 +149,8 @@ void TestTwoSidedTrsm
   Int m,
   const Grid& g,
   bool print,
-  bool correctness )
+  bool correctness,
+  Int lookahead )
 {
     OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
     PushIndent();
@@ -169,7 +171,7 @@ void TestTwoSidedTrsm
     mpi::Barrier( g.Comm() );
     Timer timer;
     timer.Start();
-    TwoSidedTrsm( uplo, diag, A, B );
+    TwoSidedTrsm( uplo, diag, A, B, lookahead );
     mpi::Barrier( g.Comm() );
     double runTime = timer.Stop();
     double gFlops = Pow(double(m),3.)/(runTime*1.e9);
@@ -199,6 +201,7 @@ main( int argc, char* argv[] )
         const char diagChar = Input("--unit","(non-)unit diagonal: N/U",'N');
         const Int m = Input("--m","height of matrix",100);
         const Int blocksize = Input("--blocksize","algorithmic blocksize",96);
+        const Int lookahead = Input("--lookahead","panel lookahead depth",0);
 #ifdef EL_HAVE_SCALAPACK
         const bool scalapack = Input("--scalapack","test ScaLAPACK?",true);
         const Int mb = Input("--mb","block height",32);
@@ -228,39 +231,39 @@ main( int argc, char* argv[] )
         OutputFromRoot(comm,"Will test TwoSidedTrsm",uploChar,diagChar);
 
         TestTwoSidedTrsm<float>
-        ( uplo, diag, m, g, scalapack, print, correctness );
+        ( uplo, diag, m, g, scalapack, print, correctness, lookahead );
         TestTwoSidedTrsm<Complex<float>>
-        ( uplo, diag, m, g, scalapack, print, correctness );
+        ( uplo, diag, m, g, scalapack, print, correctness, lookahead );
 
         TestTwoSidedTrsm<double>
-        ( uplo, diag, m, g, scalapack, print, correctness );
+        ( uplo, diag, m, g, scalapack, print, correctness, lookahead );
         TestTwoSidedTrsm<Complex<double>>
-        ( uplo, diag, m, g, scalapack, print, correctness );
+        ( uplo, diag, m, g, scalapack, print, correctness, lookahead );
 
 #ifdef EL_HAVE_QD
        TestTwoSidedTrsm<DoubleDouble>
-        ( uplo, diag, m, g, print, correctness );
+        ( uplo, diag, m, g, print, correctness, lookahead );
        TestTwoSidedTrsm<QuadDouble>
-        ( uplo, diag, m, g, print, correctness );
+        ( uplo, diag, m, g, print, correctness, lookahead );
 
        TestTwoSidedTrsm<Complex<DoubleDouble>>
-        ( uplo, diag, m, g, print, correctness );
+        ( uplo, diag, m, g, print, correctness, lookahead );
        TestTwoSidedTrsm<Complex<QuadDouble>>
-        ( uplo, diag, m, g, print, correctness );
+        ( uplo, diag, m, g, print, correctness, lookahead );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestTwoSidedTrsm<Quad>
-        ( uplo, diag, m, g, print, correctness );
+        ( uplo, diag, m, g, print, correctness, lookahead );
         TestTwoSidedTrsm<Complex<Quad>>
-        ( uplo, diag, m, g, print, correctness );
+        ( uplo, diag, m, g, print, correctness, lookahead );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestTwoSidedTrsm<BigFloat>
-        ( uplo, diag, m, g, print, correctness );
+        ( uplo, diag, m, g, print, correctness, lookahead );
         TestTwoSidedTrsm<Complex<BigFloat>>
-        ( uplo, diag, m, g, print, correctness );
+        ( uplo, diag, m, g, print, correctness, lookahead );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -0,0 +1,117 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Solve Lyapunov and Riccati equations involving a 1D Laplacian with low-rank
+// right-hand sides and check the residuals of X = Z Z^H densely.
+
+template<typename Field>
+void Laplacian1D( Int n, DistSparseMatrix<Field>& H )
+{
+    Zeros( H, n, n );
+    const Int localHeight = H.LocalHeight();
+    H.Reserve( 3*localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = H.GlobalRow(iLoc);
+        H.QueueLocalUpdate( iLoc, i, Field(2) );
+        if( i > 0 )
+            H.QueueLocalUpdate( iLoc, i-1, Field(-1) );
+        if( i+1 < n )
+            H.QueueLocalUpdate( iLoc, i+1, Field(-1) );
+    }
+    H.ProcessLocalQueues();
+}
+
+template<typename Field>
+void TestLowRank( Int n, Int rank, bool progress, const Grid& grid )
+{
+    typedef Base<Field> Real;
+    if( grid.Rank() == 0 )
+        Output("Testing with ",TypeName<Field>());
+    const Real tol = Real(1e-6);
+
+    DistSparseMatrix<Field> H(grid);
+    Laplacian1D( n, H );
+    DistMultiVec<Field> G(grid), Z(grid);
+    Gaussian( G, n, rank );
+
+    // H X + X H = G G^H
+    LowRankADICtrl<Real> adiCtrl;
+    adiCtrl.progress = progress;
+    const Int numADIIts = LowRankLyapunov( H, G, Z, adiCtrl );
+
+    DistMatrix<Field> HDense(grid), ZDense(grid), GDense(grid), X(grid),
+      R(grid);
+    Copy( H, HDense );
+    Copy( Z, ZDense );
+    Copy( G, GDense );
+    Zeros( X, n, n );
+    Gemm( NORMAL, ADJOINT, Field(1), ZDense, ZDense, Field(0), X );
+    Zeros( R, n, n );
+    Gemm( NORMAL, ADJOINT, Field(-1), GDense, GDense, Field(0), R );
+    const Real CNorm = FrobeniusNorm( R );
+    Gemm( NORMAL, NORMAL, Field(1), HDense, X, Field(1), R );
+    Gemm( NORMAL, NORMAL, Field(1), X, HDense, Field(1), R );
+    const Real lyapunovResid = FrobeniusNorm( R ) / CNorm;
+    if( grid.Rank() == 0 )
+        Output
+        ("  Lyapunov: ",numADIIts," iterations, rank ",Z.Width(),
+         ", relative residual ",lyapunovResid);
+    if( lyapunovResid > tol )
+        LogicError("The low-rank Lyapunov solution was inaccurate");
+
+    // X B B^H X - A^H X - X A = C^H C with A = -H, B = G, and C^H = G
+    NewtonKleinmanCtrl<Real> nkCtrl;
+    nkCtrl.progress = progress;
+    DistSparseMatrix<Field> A( H );
+    Scale( Real(-1), A );
+    const Int numNewtonIts = LowRankRiccati( A, G, G, Z, nkCtrl );
+
+    Copy( Z, ZDense );
+    Gemm( NORMAL, ADJOINT, Field(1), ZDense, ZDense, Field(0), X );
+    DistMatrix<Field> XG(grid);
+    Zeros( XG, n, rank );
+    Gemm( NORMAL, NORMAL, Field(1), X, GDense, Field(0), XG );
+    Gemm( NORMAL, ADJOINT, Field(-1), GDense, GDense, Field(0), R );
+    Gemm( NORMAL, ADJOINT, Field(1), XG, XG, Field(1), R );
+    Gemm( NORMAL, NORMAL, Field(1), HDense, X, Field(1), R );
+    Gemm( NORMAL, NORMAL, Field(1), X, HDense, Field(1), R );
+    const Real riccatiResid = FrobeniusNorm( R ) / CNorm;
+    if( grid.Rank() == 0 )
+        Output
+        ("  Riccati: ",numNewtonIts," Newton iterations, rank ",Z.Width(),
+         ", relative residual ",riccatiResid);
+    if( riccatiResid > tol )
+        LogicError("The low-rank Riccati solution was inaccurate");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","problem size",200);
+        const Int rank = Input("--rank","rank of right-hand side",2);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestLowRank<double>( n, rank, progress, grid );
+        TestLowRank<Complex<double>>( n, rank, progress, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
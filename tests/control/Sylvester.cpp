@@ -0,0 +1,117 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Solve shifted random Sylvester and Lyapunov equations with both the sign
+// function and Bartels-Stewart and check the relative residuals.
+
+template<typename Field>
+void StableMatrix( Int n, DistMatrix<Field>& A )
+{
+    // Shifting by 2 sqrt(n) moves the spectrum into the right-half plane
+    Gaussian( A, n, n );
+    ShiftDiagonal( A, Field(2*Sqrt(Base<Field>(n))) );
+}
+
+template<typename Field>
+Base<Field> SylvesterResidual
+( const DistMatrix<Field>& A, const DistMatrix<Field>& B,
+  const DistMatrix<Field>& C, const DistMatrix<Field>& X )
+{
+    DistMatrix<Field> R( C );
+    Gemm( NORMAL, NORMAL, Field(-1), A, X, Field(1), R );
+    Gemm( NORMAL, NORMAL, Field(-1), X, B, Field(1), R );
+    return FrobeniusNorm( R ) / FrobeniusNorm( C );
+}
+
+template<typename Field>
+void TestSylvester
+( Int m, Int n, Int cutoff, bool sequential, const Grid& grid )
+{
+    typedef Base<Field> Real;
+    if( grid.Rank() == 0 )
+        Output("Testing with ",TypeName<Field>());
+    const Real tol = Sqrt(limits::Epsilon<Real>());
+
+    DistMatrix<Field> A(grid), B(grid), C(grid), X(grid), AAdj(grid);
+    StableMatrix( m, A );
+    StableMatrix( n, B );
+    Gaussian( C, m, n );
+
+    const SylvesterApproach approaches[2] =
+      { SYLVESTER_SIGN, SYLVESTER_BARTELS_STEWART };
+    const string names[2] = { "sign", "Bartels-Stewart" };
+    SylvesterCtrl<Real> ctrl;
+    ctrl.cutoff = cutoff;
+    for( Int k=0; k<2; ++k )
+    {
+        ctrl.approach = approaches[k];
+
+        Sylvester( A, B, C, X, ctrl );
+        const Real sylvesterResid = SylvesterResidual( A, B, C, X );
+        if( grid.Rank() == 0 )
+            Output
+            ("  Sylvester with ",names[k],": relative residual ",
+             sylvesterResid);
+        if( sylvesterResid > tol )
+            LogicError("The Sylvester solution was inaccurate");
+
+        // With a single process, the local matrices are the full matrices
+        if( sequential )
+        {
+            Matrix<Field> XSeq;
+            Sylvester
+            ( A.LockedMatrix(), B.LockedMatrix(), C.LockedMatrix(), XSeq,
+              ctrl );
+            Matrix<Field> E( X.LockedMatrix() );
+            E -= XSeq;
+            const Real seqDiff = FrobeniusNorm( E ) / FrobeniusNorm( XSeq );
+            Output("  || X - XSeq ||_F / || XSeq ||_F = ",seqDiff);
+            if( seqDiff > tol )
+                LogicError("The sequential and distributed solutions differ");
+        }
+
+        DistMatrix<Field> CSquare(grid);
+        Gaussian( CSquare, m, m );
+        Lyapunov( A, CSquare, X, ctrl );
+        Adjoint( A, AAdj );
+        const Real lyapunovResid = SylvesterResidual( A, AAdj, CSquare, X );
+        if( grid.Rank() == 0 )
+            Output
+            ("  Lyapunov with ",names[k],": relative residual ",
+             lyapunovResid);
+        if( lyapunovResid > tol )
+            LogicError("The Lyapunov solution was inaccurate");
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of X",100);
+        const Int n = Input("--n","width of X",60);
+        const Int cutoff = Input("--cutoff","recursion cutoff",16);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        const bool sequential = ( grid.Size() == 1 );
+        TestSylvester<double>( m, n, cutoff, sequential, grid );
+        TestSylvester<Complex<double>>( m, n, cutoff, sequential, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,326 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <random>
+using namespace El;
+
+// Adopt valid compressed rows into a Graph, a SparseMatrix, and a
+// DistSparseMatrix and require that each matches its counterpart assembled
+// from queued updates, then require that compressed rows with unsorted,
+// repeated, or out-of-range columns (or inconsistent offsets) are rejected
+// with a LogicError.
+
+// Every process forms the same random compressed rows, with sorted and
+// unique columns
+void RandomCompressedRows
+( Int numRows, Int numCols, Int maxRowSize,
+  vector<Int>& offsets, vector<Int>& cols, vector<double>& values )
+{
+    std::mt19937 gen( 31 );
+    std::uniform_int_distribution<Int> colDist(0,numCols-1);
+    std::uniform_real_distribution<double> valueDist(-1.,1.);
+    offsets.assign( 1, 0 );
+    cols.clear();
+    values.clear();
+    for( Int i=0; i<numRows; ++i )
+    {
+        vector<Int> rowCols( i % (maxRowSize+1) );
+        for( auto& col : rowCols )
+            col = colDist(gen);
+        std::sort( rowCols.begin(), rowCols.end() );
+        rowCols.erase
+        ( std::unique(rowCols.begin(),rowCols.end()), rowCols.end() );
+        for( const Int col : rowCols )
+        {
+            cols.push_back( col );
+            values.push_back( valueDist(gen) );
+        }
+        offsets.push_back( cols.size() );
+    }
+}
+
+template<typename T>
+void CheckBuffer
+( const string& label, const T* buffer, const vector<T>& expected )
+{
+    for( Int e=0; e<Int(expected.size()); ++e )
+        if( buffer[e] != expected[e] )
+            LogicError
+            (label," entry ",e," was ",buffer[e]," rather than ",expected[e]);
+}
+
+void TestGraph
+( Int numRows, Int numCols,
+  const vector<Int>& offsets, const vector<Int>& cols )
+{
+    Graph queued( numRows, numCols );
+    for( Int i=0; i<numRows; ++i )
+        for( Int e=offsets[i]; e<offsets[i+1]; ++e )
+            queued.QueueConnection( i, cols[e] );
+    queued.ProcessQueues();
+
+    Graph adopted;
+    vector<Int> offsetsCopy( offsets ), colsCopy( cols );
+    adopted.AdoptCompressedRows
+    ( numRows, numCols, std::move(offsetsCopy), std::move(colsCopy) );
+    if( !adopted.Consistent() || adopted.NumSources() != numRows ||
+        adopted.NumTargets() != numCols ||
+        adopted.NumEdges() != queued.NumEdges() )
+        LogicError("The adopted graph did not match the queued one");
+    CheckBuffer
+    ( "Graph offsets", adopted.LockedOffsetBuffer(),
+      vector<Int>(queued.LockedOffsetBuffer(),
+                  queued.LockedOffsetBuffer()+numRows+1) );
+    CheckBuffer
+    ( "Graph sources", adopted.LockedSourceBuffer(),
+      vector<Int>(queued.LockedSourceBuffer(),
+                  queued.LockedSourceBuffer()+queued.NumEdges()) );
+    CheckBuffer( "Graph targets", adopted.LockedTargetBuffer(), cols );
+    Output("Adopted Graph matched the queued one");
+}
+
+void TestSparseMatrix
+( Int numRows, Int numCols,
+  const vector<Int>& offsets,
+  const vector<Int>& cols,
+  const vector<double>& values )
+{
+    SparseMatrix<double> queued;
+    Zeros( queued, numRows, numCols );
+    for( Int i=0; i<numRows; ++i )
+        for( Int e=offsets[i]; e<offsets[i+1]; ++e )
+            queued.QueueUpdate( i, cols[e], values[e] );
+    queued.ProcessQueues();
+
+    vector<Int> offsetsCopy( offsets ), colsCopy( cols );
+    vector<double> valuesCopy( values );
+    SparseMatrix<double> adopted
+    ( numRows, numCols,
+      std::move(offsetsCopy), std::move(colsCopy), std::move(valuesCopy) );
+    if( adopted.Height() != numRows || adopted.Width() != numCols ||
+        adopted.NumEntries() != queued.NumEntries() )
+        LogicError("The adopted matrix did not match the queued one");
+    CheckBuffer( "SparseMatrix offsets", adopted.LockedOffsetBuffer(),
+      offsets );
+    for( Int e=0; e<queued.NumEntries(); ++e )
+        if( adopted.Row(e) != queued.Row(e) ||
+            adopted.Col(e) != queued.Col(e) ||
+            adopted.Value(e) != queued.Value(e) )
+            LogicError
+            ("Adopted entry ",e," was (",adopted.Row(e),",",adopted.Col(e),
+             ",",adopted.Value(e),") rather than (",queued.Row(e),",",
+             queued.Col(e),",",queued.Value(e),")");
+
+    // The adopted matrix must be usable as any other
+    Matrix<double> X, YAdopted, YQueued;
+    Uniform( X, numCols, 3 );
+    Zeros( YAdopted, numRows, 3 );
+    Zeros( YQueued, numRows, 3 );
+    Multiply( NORMAL, 1., adopted, X, 0., YAdopted );
+    Multiply( NORMAL, 1., queued, X, 0., YQueued );
+    YAdopted -= YQueued;
+    if( MaxNorm(YAdopted) != 0. )
+        LogicError("Products with the adopted matrix differed");
+    Output("Adopted SparseMatrix matched the queued one");
+}
+
+void TestDistSparseMatrix
+( const Grid& grid, Int numRows, Int numCols,
+  const vector<Int>& offsets,
+  const vector<Int>& cols,
+  const vector<double>& values )
+{
+    DistSparseMatrix<double> queued(grid);
+    Zeros( queued, numRows, numCols );
+    const Int firstLocalRow = queued.FirstLocalRow();
+    const Int localHeight = queued.LocalHeight();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = firstLocalRow + iLoc;
+        for( Int e=offsets[i]; e<offsets[i+1]; ++e )
+            queued.QueueLocalUpdate( iLoc, cols[e], values[e] );
+    }
+    queued.ProcessLocalQueues();
+
+    // Extract the compressed rows assigned to this process
+    const Int firstEntry = offsets[firstLocalRow];
+    const Int lastEntry = offsets[firstLocalRow+localHeight];
+    vector<Int> localOffsets( localHeight+1 );
+    for( Int iLoc=0; iLoc<=localHeight; ++iLoc )
+        localOffsets[iLoc] = offsets[firstLocalRow+iLoc] - firstEntry;
+    vector<Int> localCols( cols.begin()+firstEntry, cols.begin()+lastEntry );
+    vector<double>
+      localValues( values.begin()+firstEntry, values.begin()+lastEntry );
+    const vector<Int> expectedOffsets( localOffsets );
+
+    DistSparseMatrix<double> adopted
+    ( numRows, numCols,
+      std::move(localOffsets), std::move(localCols), std::move(localValues),
+      grid );
+    if( adopted.Height() != numRows || adopted.Width() != numCols ||
+        adopted.FirstLocalRow() != firstLocalRow ||
+        adopted.LocalHeight() != localHeight ||
+        adopted.NumLocalEntries() != queued.NumLocalEntries() )
+        LogicError("The adopted matrix did not match the queued one");
+    CheckBuffer
+    ( "DistSparseMatrix offsets", adopted.LockedOffsetBuffer(),
+      expectedOffsets );
+    for( Int e=0; e<queued.NumLocalEntries(); ++e )
+        if( adopted.Row(e) != queued.Row(e) ||
+            adopted.Col(e) != queued.Col(e) ||
+            adopted.Value(e) != queued.Value(e) )
+            LogicError
+            ("Adopted local entry ",e," was (",adopted.Row(e),",",
+             adopted.Col(e),",",adopted.Value(e),") rather than (",
+             queued.Row(e),",",queued.Col(e),",",queued.Value(e),")");
+
+    // The adopted matrix must be usable as any other (including in products,
+    // which require communication metadata)
+    DistMultiVec<double> X(grid), YAdopted(grid), YQueued(grid);
+    Uniform( X, numCols, 3 );
+    Zeros( YAdopted, numRows, 3 );
+    Zeros( YQueued, numRows, 3 );
+    Multiply( NORMAL, 1., adopted, X, 0., YAdopted );
+    Multiply( NORMAL, 1., queued, X, 0., YQueued );
+    Axpy( -1., YQueued, YAdopted );
+    if( MaxNorm(YAdopted) != 0. )
+        LogicError("Products with the adopted matrix differed");
+    OutputFromRoot
+    (grid.Comm(),"Adopted DistSparseMatrix matched the queued one");
+}
+
+// Form numRows rows of two columns each, {0,numCols-1}, before corrupting
+// the first row in the manner described by 'flaw'
+enum Flaw
+{ UNSORTED_COLS, REPEATED_COLS, LARGE_COL, NEGATIVE_COL,
+  NONZERO_FIRST_OFFSET, WRONG_LAST_OFFSET };
+
+void FlawedCompressedRows
+( Flaw flaw, Int numRows, Int numCols,
+  vector<Int>& offsets, vector<Int>& cols, vector<double>& values )
+{
+    offsets.resize( numRows+1 );
+    cols.resize( 2*numRows );
+    for( Int i=0; i<=numRows; ++i )
+        offsets[i] = 2*i;
+    for( Int i=0; i<numRows; ++i )
+    {
+        cols[2*i] = 0;
+        cols[2*i+1] = numCols-1;
+    }
+    values.assign( cols.size(), 1. );
+    if( flaw == UNSORTED_COLS ) { cols[0] = numCols-1; cols[1] = 0; }
+    else if( flaw == REPEATED_COLS ) cols[0] = numCols-1;
+    else if( flaw == LARGE_COL ) cols[1] = numCols;
+    else if( flaw == NEGATIVE_COL ) cols[0] = -1;
+    else if( flaw == NONZERO_FIRST_OFFSET ) offsets[0] = 1;
+    else offsets[numRows] = 2*numRows-1;
+}
+
+template<typename Function>
+void RequireLogicError( const string& label, Function adopt )
+{
+    bool caught = false;
+    try { adopt(); }
+    catch( std::logic_error& ) { caught = true; }
+    if( !caught )
+        LogicError(label," was not rejected");
+}
+
+void TestFlaws( const Grid& grid, Int numRows, Int numCols )
+{
+    const pair<Flaw,string> flaws[] =
+      { { UNSORTED_COLS, "Unsorted columns" },
+        { REPEATED_COLS, "Repeated columns" },
+        { LARGE_COL, "Too large a column" },
+        { NEGATIVE_COL, "A negative column" },
+        { NONZERO_FIRST_OFFSET, "A nonzero first offset" },
+        { WRONG_LAST_OFFSET, "An inconsistent last offset" } };
+    for( const auto& flaw : flaws )
+    {
+        vector<Int> offsets, cols;
+        vector<double> values;
+        if( grid.Rank() == 0 )
+        {
+            FlawedCompressedRows
+            ( flaw.first, numRows, numCols, offsets, cols, values );
+            RequireLogicError
+            ( flaw.second+" (AssertCompressedRows)",
+              [&]() { AssertCompressedRows( numRows, numCols, offsets, cols ); }
+            );
+            RequireLogicError
+            ( flaw.second+" (Graph)",
+              [&]()
+              { Graph graph;
+                vector<Int> offsetsCopy( offsets ), colsCopy( cols );
+                graph.AdoptCompressedRows
+                ( numRows, numCols,
+                  std::move(offsetsCopy), std::move(colsCopy) ); } );
+            RequireLogicError
+            ( flaw.second+" (SparseMatrix)",
+              [&]()
+              { SparseMatrix<double> A;
+                vector<Int> offsetsCopy( offsets ), colsCopy( cols );
+                vector<double> valuesCopy( values );
+                A.AdoptCompressedRows
+                ( numRows, numCols, std::move(offsetsCopy),
+                  std::move(colsCopy), std::move(valuesCopy) ); } );
+        }
+
+        // Each process with at least one row corrupts its first local row
+        DistSparseMatrix<double> A(grid);
+        Zeros( A, numRows, numCols );
+        const Int localHeight = A.LocalHeight();
+        if( localHeight > 0 )
+        {
+            FlawedCompressedRows
+            ( flaw.first, localHeight, numCols, offsets, cols, values );
+            RequireLogicError
+            ( flaw.second+" (DistSparseMatrix)",
+              [&]()
+              { A.AdoptLocalCompressedRows
+                ( numRows, numCols, std::move(offsets), std::move(cols),
+                  std::move(values) ); } );
+        }
+        OutputFromRoot(grid.Comm(),flaw.second," was rejected");
+    }
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int numRows = Input("--numRows","number of rows",200);
+        const Int numCols = Input("--numCols","number of columns",150);
+        const Int maxRowSize =
+          Input("--maxRowSize","maximum number of entries per row",20);
+        ProcessInput();
+        PrintInputReport();
+
+        vector<Int> offsets, cols;
+        vector<double> values;
+        RandomCompressedRows
+        ( numRows, numCols, maxRowSize, offsets, cols, values );
+
+        const Grid grid( comm );
+        if( grid.Rank() == 0 )
+        {
+            TestGraph( numRows, numCols, offsets, cols );
+            TestSparseMatrix( numRows, numCols, offsets, cols, values );
+        }
+        TestDistSparseMatrix( grid, numRows, numCols, offsets, cols, values );
+        TestFlaws( grid, numRows, numCols );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
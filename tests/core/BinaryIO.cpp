@@ -0,0 +1,123 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Write [MC,MR], [VC,STAR], and block-cyclic [MC,MR] matrices to BINARY and
+// BINARY_FLAT files and read each file back into all three distributions,
+// both collectively (through MPI-IO where it applies) and sequentially
+// (through a [CIRC,CIRC] copy), requiring that every result matches the
+// original exactly.
+
+template<typename T>
+void CheckEqual
+( const string& label,
+  const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(label," was read back with the wrong dimensions");
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+    Matrix<T> E( A_STAR_STAR.Matrix() );
+    E -= B_STAR_STAR.Matrix();
+    if( MaxNorm( E ) != Base<T>(0) )
+        LogicError(label," did not round-trip exactly");
+}
+
+// Each read is into a fresh copy of the empty 'prototype' so that the block
+// sizes of a block distribution are retained
+template<typename T,class DistType>
+void ReadBack
+( const string& label,
+  const AbstractDistMatrix<T>& A,
+  const string& filename,
+  FileFormat format,
+  const DistType& prototype )
+{
+    for( const bool sequential : { false, true } )
+    {
+        // BINARY_FLAT files do not store their dimensions
+        DistType B( prototype );
+        if( format == BINARY_FLAT )
+            B.Resize( A.Height(), A.Width() );
+        Read( B, filename, format, sequential );
+        CheckEqual
+        ( label+(sequential ? " (sequential)" : " (collective)"), A, B );
+    }
+}
+
+template<typename T>
+void TestFormat
+( const string& label,
+  const AbstractDistMatrix<T>& A,
+  FileFormat format,
+  Int mb, Int nb )
+{
+    const Grid& grid = A.Grid();
+    const string basename = "BinaryIO";
+    const string filename = basename + "." + FileExtension(format);
+    Write( A, basename, format );
+
+    ReadBack
+    ( label+" into [MC,MR]", A, filename, format, DistMatrix<T>(grid) );
+    ReadBack
+    ( label+" into [VC,STAR]", A, filename, format,
+      DistMatrix<T,VC,STAR>(grid) );
+    ReadBack
+    ( label+" into block [MC,MR]", A, filename, format,
+      DistMatrix<T,MC,MR,BLOCK>(grid,mb,nb) );
+
+    mpi::Barrier( grid.Comm() );
+    if( grid.Rank() == 0 )
+        std::remove( filename.c_str() );
+}
+
+template<typename T>
+void TestBinaryIO( const Grid& grid, Int m, Int n, Int mb, Int nb )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+    DistMatrix<T> A(grid);
+    Uniform( A, m, n );
+    DistMatrix<T,VC,STAR> A_VC_STAR( A );
+    DistMatrix<T,MC,MR,BLOCK> ABlock(grid,mb,nb);
+    ABlock = A;
+    for( const FileFormat format : { BINARY, BINARY_FLAT } )
+    {
+        const string formatName =
+          ( format == BINARY ? "BINARY" : "BINARY_FLAT" );
+        TestFormat( formatName+" [MC,MR]", A, format, mb, nb );
+        TestFormat( formatName+" [VC,STAR]", A_VC_STAR, format, mb, nb );
+        TestFormat( formatName+" block [MC,MR]", ABlock, format, mb, nb );
+        OutputFromRoot(grid.Comm(),formatName," round-trips passed");
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",37);
+        const Int n = Input("--n","width of matrix",29);
+        const Int mb = Input("--mb","height of distribution blocks",4);
+        const Int nb = Input("--nb","width of distribution blocks",3);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestBinaryIO<double>( grid, m, n, mb, nb );
+        TestBinaryIO<Complex<float>>( grid, m, n, mb, nb );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
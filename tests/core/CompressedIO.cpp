@@ -0,0 +1,147 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+#ifdef EL_HAVE_ZLIB
+// Every matrix is written to a BINARY_COMPRESSED file and read back, and the
+// result must match the original exactly
+
+template<typename T>
+void CheckEqual
+( const Grid& grid, const string& label,
+  const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(label," was read back with the wrong dimensions");
+    // B may live on a different grid, so gather both onto every process
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+    Matrix<T> E( A_STAR_STAR.Matrix() );
+    E -= B_STAR_STAR.Matrix();
+    const Base<T> maxError = MaxNorm( E );
+    OutputFromRoot(grid.Comm(),label,": || A - B ||_max = ",maxError);
+    if( maxError != Base<T>(0) )
+        LogicError(label," did not round-trip exactly");
+}
+
+template<typename T>
+void CheckEqual
+( const Grid& grid, const string& label,
+  const Matrix<T>& A, const Matrix<T>& B )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(label," was read back with the wrong dimensions");
+    Matrix<T> E( A );
+    E -= B;
+    const Base<T> maxError = MaxNorm( E );
+    OutputFromRoot(grid.Comm(),label,": || A - B ||_max = ",maxError);
+    if( maxError != Base<T>(0) )
+        LogicError(label," did not round-trip exactly");
+}
+
+template<typename T>
+void TestCompressed
+( const Grid& grid, Int m, Int n, const CompressionCtrl& ctrl )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+    const bool root = ( grid.Rank() == 0 );
+
+    // Random entries are nearly incompressible, whereas constant columns
+    // compress well, so use a mixture of the two
+    if( root )
+    {
+        Matrix<T> A, B;
+        Uniform( A, m, n );
+        auto ARight = A( ALL, IR(n/2,END) );
+        Fill( ARight, T(1) );
+        WriteCompressed( A, "CompressedMatrix", ctrl );
+        ReadCompressed( B, "CompressedMatrix.binz" );
+        CheckEqual( grid, "Matrix", A, B );
+        std::remove( "CompressedMatrix.binz" );
+    }
+    mpi::Barrier( grid.Comm() );
+
+    // Read the file back over a differently-shaped grid
+    DistMatrix<T> A(grid);
+    Uniform( A, m, n );
+    auto ARight = A( ALL, IR(n/2,END) );
+    Fill( ARight, T(1) );
+    WriteCompressed( A, "CompressedDistMatrix", ctrl );
+    const Grid otherGrid( grid.Comm(), 1 );
+    DistMatrix<T,VC,STAR> B(otherGrid);
+    ReadCompressed( B, "CompressedDistMatrix.binz" );
+    CheckEqual( grid, "DistMatrix", A, B );
+
+    // Round-trip through the generic Write and Read routines
+    DistMatrix<T,MR,MC> C(grid);
+    Write( A, "CompressedGeneric", BINARY_COMPRESSED );
+    Read( C, "CompressedGeneric.binz" );
+    CheckEqual( grid, "Generic DistMatrix", A, C );
+
+    mpi::Barrier( grid.Comm() );
+    if( root )
+    {
+        std::remove( "CompressedDistMatrix.binz" );
+        std::remove( "CompressedGeneric.binz" );
+    }
+    PopIndent();
+}
+#endif // ifdef EL_HAVE_ZLIB
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",70);
+        const Int chunkWidth = Input("--chunkWidth","columns per chunk",7);
+        ProcessInput();
+        PrintInputReport();
+
+#ifdef EL_HAVE_ZLIB
+        const Grid grid( comm );
+        for( Int variant=0; variant<3; ++variant )
+        {
+            // The default chunking, small unshuffled chunks which do not
+            // evenly divide the width, and the strongest compression
+            CompressionCtrl ctrl;
+            if( variant == 1 )
+            {
+                ctrl.chunkWidth = chunkWidth;
+                ctrl.shuffle = false;
+            }
+            else if( variant == 2 )
+            {
+                ctrl.chunkWidth = chunkWidth;
+                ctrl.level = 9;
+            }
+            OutputFromRoot
+            (comm,"chunkWidth=",ctrl.chunkWidth,", level=",ctrl.level,
+             ", shuffle=",ctrl.shuffle);
+            PushIndent();
+            TestCompressed<float>( grid, m, n, ctrl );
+            TestCompressed<double>( grid, m, n, ctrl );
+            TestCompressed<Complex<double>>( grid, m, n, ctrl );
+            PopIndent();
+        }
+#else
+        EL_UNUSED( chunkWidth );
+        OutputFromRoot
+        (comm,"Elemental was not built with zlib support, so the ",m," x ",n,
+         " round-trip tests were skipped");
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
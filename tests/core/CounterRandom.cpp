@@ -0,0 +1,132 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Check CounterRNG against the Philox4x32-10 known-answer vectors of
+// Random123 and require that, with counter-based random generation, Uniform
+// and Gaussian fill distributed matrices identically over differently-shaped
+// grids and distributions.
+
+void CheckKnownAnswer
+( const string& label,
+  std::uint64_t seed, std::uint32_t stream, Int i, Int j,
+  const std::array<std::uint32_t,4>& expected )
+{
+    const CounterRNG rng( seed, stream );
+    const auto bits = rng.Bits( i, j );
+    if( bits != expected )
+        LogicError
+        (label,": expected ",expected[0],",",expected[1],",",expected[2],",",
+         expected[3]," but found ",bits[0],",",bits[1],",",bits[2],",",
+         bits[3]);
+    Output(label," passed");
+}
+
+void TestKnownAnswers()
+{
+    // The counter of entry (i,j) is (i,j,hi16(i) | hi16(j) << 16,stream),
+    // and the key is (lo32(seed),hi32(seed))
+    CheckKnownAnswer
+    ( "Zero counter and key", 0, 0, 0, 0,
+      {{0x6627e8d5u,0xe169c58du,0xbc57ac4cu,0x9b00dbd8u}} );
+    CheckKnownAnswer
+    ( "All-ones counter and key", ~std::uint64_t(0), 0xffffffffu, -1, -1,
+      {{0x408f276du,0x41c83b0eu,0xa20bc7c6u,0x6d5451fdu}} );
+#ifdef EL_USE_64BIT_INTS
+    CheckKnownAnswer
+    ( "Digits of pi",
+      (std::uint64_t(0x299f31d0u)<<32) | 0xa4093822u, 0x03707344u,
+      (Int(0x8a2e)<<32) | Int(0x243f6a88u),
+      (Int(0x1319)<<32) | Int(0x85a308d3u),
+      {{0xd16cfe09u,0x94fdccebu,0x5001e420u,0x24126ea1u}} );
+#endif
+}
+
+template<typename T>
+void CheckIdentical
+( const string& label,
+  const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B );
+    const Int m = A.Height(), n = A.Width();
+    const auto& ALoc = A_STAR_STAR.LockedMatrix();
+    const auto& BLoc = B_STAR_STAR.LockedMatrix();
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            if( ALoc(i,j) != BLoc(i,j) )
+                LogicError
+                (label,": entry (",i,",",j,") was ",BLoc(i,j)," rather than ",
+                 ALoc(i,j));
+}
+
+// Draw a Uniform and then a Gaussian matrix after resetting the seed
+template<typename T>
+void DrawMatrices
+( AbstractDistMatrix<T>& U, AbstractDistMatrix<T>& G, Int m, Int n )
+{
+    SetCounterBasedSeed( 1234567 );
+    Uniform( U, m, n, T(1), Base<T>(2) );
+    Gaussian( G, m, n, T(-1), Base<T>(3) );
+}
+
+template<typename T>
+void TestGridIndependence( mpi::Comm comm, Int m, Int n )
+{
+    OutputFromRoot(comm,"Testing with ",TypeName<T>());
+    PushIndent();
+    const Grid grid( comm );
+    DistMatrix<T> U(grid), G(grid);
+    DrawMatrices( U, G, m, n );
+
+    // A single process row and a single process column
+    const Grid rowGrid( comm, 1 ), colGrid( comm, mpi::Size(comm) );
+    DistMatrix<T> URow(rowGrid), GRow(rowGrid);
+    DrawMatrices( URow, GRow, m, n );
+    CheckIdentical( "Uniform over a 1 x p grid", U, URow );
+    CheckIdentical( "Gaussian over a 1 x p grid", G, GRow );
+    DistMatrix<T,VC,STAR> UCol(colGrid), GCol(colGrid);
+    DrawMatrices( UCol, GCol, m, n );
+    CheckIdentical( "Uniform in [VC,STAR] over a p x 1 grid", U, UCol );
+    CheckIdentical( "Gaussian in [VC,STAR] over a p x 1 grid", G, GCol );
+
+    // Every process owns a redundant copy
+    DistMatrix<T,STAR,STAR> UStar(grid), GStar(grid);
+    DrawMatrices( UStar, GStar, m, n );
+    CheckIdentical( "Uniform in [STAR,STAR]", U, UStar );
+    CheckIdentical( "Gaussian in [STAR,STAR]", G, GStar );
+    OutputFromRoot(comm,"Grid independence passed");
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",57);
+        const Int n = Input("--n","width of matrix",43);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(comm) == 0 )
+            TestKnownAnswers();
+
+        const bool wasCounterBased = CounterBasedRandom();
+        SetCounterBasedRandom( true );
+        TestGridIndependence<double>( comm, m, n );
+        TestGridIndependence<Complex<float>>( comm, m, n );
+        SetCounterBasedRandom( wasCounterBased );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
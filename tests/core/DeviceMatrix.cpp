@@ -0,0 +1,87 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+#ifdef EL_HAVE_CUDA
+// Compare the device kernels against their host counterparts
+template<typename Field>
+void Compare
+( const DeviceMatrix<Field>& ADev, const Matrix<Field>& A, const string& label )
+{
+    typedef Base<Field> Real;
+    Matrix<Field> E;
+    CopyToHost( ADev, E );
+    E -= A;
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( A );
+    Output(label,": || ADev - A ||_F / || A ||_F = ",relError);
+    if( relError > A.Height()*limits::Epsilon<Real>()*100 )
+        LogicError("Relative error was unacceptably large");
+}
+
+template<typename Field>
+void TestDevice( Int n )
+{
+    typedef Base<Field> Real;
+    Output("Testing with ",TypeName<Field>());
+    Matrix<Field> A, B, C, H;
+    Uniform( A, n, n );
+    Uniform( B, n, n );
+    Uniform( C, n, n );
+    Identity( H, n, n );
+    H *= Field(n);
+
+    DeviceMatrix<Field> ADev, BDev, CDev, HDev;
+    CopyToDevice( A, ADev );
+    CopyToDevice( B, BDev );
+    CopyToDevice( C, CDev );
+    CopyToDevice( H, HDev );
+
+    Gemm( NORMAL, ADJOINT, Field(2), A, B, Field(-1), C );
+    Gemm( NORMAL, ADJOINT, Field(2), ADev, BDev, Field(-1), CDev );
+    Compare( CDev, C, "Gemm" );
+
+    // Only the lower triangle of H is overwritten by Herk and Cholesky
+    Herk( LOWER, ADJOINT, Real(1), A, Real(1), H );
+    Herk( LOWER, ADJOINT, Real(1), ADev, Real(1), HDev );
+    Compare( HDev, H, "Herk" );
+    Cholesky( LOWER, H );
+    Cholesky( LOWER, HDev );
+    Compare( HDev, H, "Cholesky" );
+
+    Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Field(1), H, B );
+    Trsm( LEFT, LOWER, NORMAL, NON_UNIT, Field(1), HDev, BDev );
+    Compare( BDev, B, "Trsm" );
+}
+#endif
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","size of matrices",100);
+        ProcessInput();
+        PrintInputReport();
+
+#ifdef EL_HAVE_CUDA
+        TestDevice<float>( n );
+        TestDevice<double>( n );
+        TestDevice<Complex<double>>( n );
+#else
+        Output
+        ("Elemental was not built with CUDA support, so the ",n," x ",n,
+         " device tests were skipped");
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
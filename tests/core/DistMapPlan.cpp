@@ -0,0 +1,69 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Translate a set of indices (with duplicates and out-of-bounds entries)
+// directly and by replaying a plan through two maps with the same
+// distribution
+void TestPlan( Int n, Int numLocalInds, const Grid& g )
+{
+    const int commRank = mpi::Rank( g.Comm() );
+    DistMap map(n,g), otherMap(n,g);
+    const Int firstLocalSource = map.FirstLocalSource();
+    for( Int sLoc=0; sLoc<map.NumLocalSources(); ++sLoc )
+    {
+        const Int s = firstLocalSource + sLoc;
+        map.SetLocal( sLoc, (7*s+3) % n );
+        otherMap.SetLocal( sLoc, n-1-s );
+    }
+
+    vector<Int> inds( numLocalInds );
+    for( Int k=0; k<numLocalInds; ++k )
+        inds[k] = ( k % 11 == 0 ? n+k : (k*k+commRank) % n );
+    const auto origInds = inds;
+
+    DistMapPlan plan;
+    map.FormTranslationPlan( inds, plan );
+    auto directInds = inds;
+    map.Translate( directInds );
+    map.Translate( inds, plan );
+    auto otherInds = origInds;
+    otherMap.Translate( otherInds, plan );
+    for( Int k=0; k<numLocalInds; ++k )
+    {
+        const Int i = origInds[k];
+        const Int image = ( i < n ? (7*i+3) % n : i );
+        const Int otherImage = ( i < n ? n-1-i : i );
+        if( inds[k] != image || directInds[k] != image ||
+            otherInds[k] != otherImage )
+            LogicError("Translation of index ",i," was incorrect");
+    }
+    OutputFromRoot(g.Comm(),"Translations were correct");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","number of sources",1000);
+        const Int numLocalInds = Input("--numLocalInds","local indices",500);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestPlan( n, numLocalInds, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
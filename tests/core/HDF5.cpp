@@ -0,0 +1,186 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+#ifdef EL_HAVE_HDF5
+// Every object is written to an HDF5 file and read back, and the result must
+// match the original exactly
+
+template<typename T>
+void CheckEqual
+( const Grid& grid, const string& label,
+  const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+{
+    DistMatrix<T> E( A );
+    DistMatrix<T> BCopy( B );
+    if( E.Height() != BCopy.Height() || E.Width() != BCopy.Width() )
+        LogicError(label," was read back with the wrong dimensions");
+    E -= BCopy;
+    const Base<T> maxError = MaxNorm( E );
+    OutputFromRoot(grid.Comm(),label,": || A - B ||_max = ",maxError);
+    if( maxError != Base<T>(0) )
+        LogicError(label," did not round-trip exactly");
+}
+
+template<typename T>
+void CheckEqual
+( const Grid& grid, const string& label,
+  const Matrix<T>& A, const Matrix<T>& B )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(label," was read back with the wrong dimensions");
+    Matrix<T> E( A );
+    E -= B;
+    const Base<T> maxError = MaxNorm( E );
+    OutputFromRoot(grid.Comm(),label,": || A - B ||_max = ",maxError);
+    if( maxError != Base<T>(0) )
+        LogicError(label," did not round-trip exactly");
+}
+
+template<typename T>
+void TestDense( const Grid& grid, Int m, Int n, const HDF5Ctrl& ctrl )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+    const bool root = ( grid.Rank() == 0 );
+
+    if( root )
+    {
+        Matrix<T> A, B;
+        Uniform( A, m, n );
+        WriteHDF5( A, "HDF5Matrix", ctrl );
+        ReadHDF5( B, "HDF5Matrix.h5", ctrl );
+        CheckEqual( grid, "Matrix", A, B );
+        std::remove( "HDF5Matrix.h5" );
+    }
+    mpi::Barrier( grid.Comm() );
+
+    // Read back into a different distribution than the one written
+    DistMatrix<T> A(grid);
+    DistMatrix<T,VC,STAR> B(grid);
+    Uniform( A, m, n );
+    WriteHDF5( A, "HDF5DistMatrix", ctrl );
+    ReadHDF5( B, "HDF5DistMatrix.h5", ctrl );
+    CheckEqual( grid, "DistMatrix", A, B );
+
+    DistMultiVec<T> X(grid), Y(grid);
+    Uniform( X, m, n );
+    WriteHDF5( X, "HDF5DistMultiVec", ctrl );
+    ReadHDF5( Y, "HDF5DistMultiVec.h5", ctrl );
+    DistMatrix<T> XDense(grid), YDense(grid);
+    Copy( X, XDense );
+    Copy( Y, YDense );
+    CheckEqual( grid, "DistMultiVec", XDense, YDense );
+
+    mpi::Barrier( grid.Comm() );
+    if( root )
+    {
+        std::remove( "HDF5DistMatrix.h5" );
+        std::remove( "HDF5DistMultiVec.h5" );
+    }
+    PopIndent();
+}
+
+void TestSparse( const Grid& grid, Int n, const HDF5Ctrl& ctrl )
+{
+    OutputFromRoot(grid.Comm(),"Testing sparse matrices");
+    PushIndent();
+    const bool root = ( grid.Rank() == 0 );
+
+    if( root )
+    {
+        SparseMatrix<double> A, B;
+        Laplacian( A, n, n );
+        WriteHDF5( A, "HDF5SparseMatrix", ctrl );
+        ReadHDF5( B, "HDF5SparseMatrix.h5", ctrl );
+        if( A.Height() != B.Height() || A.Width() != B.Width() ||
+            A.NumEntries() != B.NumEntries() )
+            LogicError("SparseMatrix was read back with the wrong shape");
+        for( Int e=0; e<A.NumEntries(); ++e )
+            if( A.Row(e) != B.Row(e) || A.Col(e) != B.Col(e) ||
+                A.Value(e) != B.Value(e) )
+                LogicError("SparseMatrix entry ",e," did not round-trip");
+        Output("SparseMatrix round-tripped");
+        std::remove( "HDF5SparseMatrix.h5" );
+    }
+    mpi::Barrier( grid.Comm() );
+
+    // The read-back matrix must act identically on a random block of vectors
+    DistSparseMatrix<double> A(grid), B(grid);
+    Laplacian( A, n, n );
+    WriteHDF5( A, "HDF5DistSparseMatrix", ctrl );
+    ReadHDF5( B, "HDF5DistSparseMatrix.h5", ctrl );
+    if( A.Height() != B.Height() || A.Width() != B.Width() ||
+        A.NumEntries() != B.NumEntries() )
+        LogicError("DistSparseMatrix was read back with the wrong shape");
+    DistMultiVec<double> X(grid), AX(grid), BX(grid);
+    Uniform( X, A.Width(), 3 );
+    Zeros( AX, A.Height(), 3 );
+    Zeros( BX, A.Height(), 3 );
+    Multiply( NORMAL, 1., A, X, 0., AX );
+    Multiply( NORMAL, 1., B, X, 0., BX );
+    DistMatrix<double> AXDense(grid), BXDense(grid);
+    Copy( AX, AXDense );
+    Copy( BX, BXDense );
+    CheckEqual( grid, "DistSparseMatrix", AXDense, BXDense );
+
+    mpi::Barrier( grid.Comm() );
+    if( root )
+        std::remove( "HDF5DistSparseMatrix.h5" );
+    PopIndent();
+}
+#endif // ifdef EL_HAVE_HDF5
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",70);
+        const Int chunk = Input("--chunk","chunk height and width",16);
+        const int level = Input("--level","deflate level",1);
+        ProcessInput();
+        PrintInputReport();
+
+#ifdef EL_HAVE_HDF5
+        const Grid grid( comm );
+        for( const bool compress : { false, true } )
+        {
+            HDF5Ctrl ctrl;
+            if( compress )
+            {
+                ctrl.chunkHeight = chunk;
+                ctrl.chunkWidth = chunk;
+                ctrl.compressionLevel = level;
+            }
+            OutputFromRoot
+            (comm,compress ? "Chunked and compressed:" : "Contiguous:");
+            PushIndent();
+            TestDense<float>( grid, m, n, ctrl );
+            TestDense<double>( grid, m, n, ctrl );
+            TestDense<Complex<double>>( grid, m, n, ctrl );
+            TestSparse( grid, 10, ctrl );
+            PopIndent();
+        }
+#else
+        EL_UNUSED( chunk );
+        EL_UNUSED( level );
+        OutputFromRoot
+        (comm,"Elemental was not built with HDF5 support, so the ",m," x ",n,
+         " round-trip tests were skipped");
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,141 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <fstream>
+using namespace El;
+
+// Write BINARY and BINARY_FLAT files, memory-map them with MappedMatrix under
+// each access pattern (with and without populating and prefetching), and
+// require that the mapped entries exactly match those of Read. Files whose
+// sizes disagree with their dimensions must be rejected.
+
+template<typename T>
+void CheckEqual
+( const string& label, const Matrix<T>& A, const Matrix<T>& B )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError
+        (label,": mapped a ",A.Height()," x ",A.Width()," matrix rather than ",
+         B.Height()," x ",B.Width());
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A(i,j) != B(i,j) )
+                LogicError
+                (label,": entry (",i,",",j,") was ",A(i,j)," rather than ",
+                 B(i,j));
+}
+
+template<typename T>
+void TestMappedMatrix( Int m, Int n )
+{
+    Output("Testing with ",TypeName<T>());
+    PushIndent();
+    Matrix<T> A;
+    Uniform( A, m, n );
+
+    const string basename = "MappedMatrix";
+    const AccessPattern patterns[] =
+      { NORMAL_ACCESS, SEQUENTIAL_ACCESS, RANDOM_ACCESS };
+    for( const FileFormat format : { BINARY, BINARY_FLAT } )
+    {
+        const bool flat = ( format == BINARY_FLAT );
+        const string filename = basename + "." + FileExtension(format);
+        Write( A, basename, format );
+        Matrix<T> ARead;
+        if( flat )
+            ARead.Resize( m, n );
+        Read( ARead, filename, format );
+        CheckEqual( "Read", ARead, A );
+
+        for( const AccessPattern pattern : patterns )
+        {
+            for( const bool eager : { false, true } )
+            {
+                MappedCtrl ctrl;
+                ctrl.pattern = pattern;
+                ctrl.populate = eager;
+                ctrl.prefetch = eager;
+                const string label =
+                  string(flat ? "BINARY_FLAT" : "BINARY") +
+                  " with access pattern " + std::to_string(int(pattern)) +
+                  (eager ? " (populated and prefetched)" : "");
+                if( flat )
+                {
+                    MappedMatrix<T> AMapped( filename, m, n, ctrl );
+                    CheckEqual( label, AMapped.LockedMatrix(), ARead );
+                }
+                else
+                {
+                    MappedMatrix<T> AMapped( filename, ctrl );
+                    CheckEqual( label, AMapped.LockedMatrix(), ARead );
+                }
+            }
+        }
+
+        // The file holds m n entries (after any header)
+        bool caught = false;
+        try
+        {
+            if( flat )
+                MappedMatrix<T> AMapped( filename, m+1, n );
+            else
+            {
+                std::ofstream file
+                ( filename.c_str(), std::ios::binary | std::ios::app );
+                const T extra(0);
+                file.write( reinterpret_cast<const char*>(&extra), sizeof(T) );
+                file.close();
+                MappedMatrix<T> AMapped( filename );
+            }
+        }
+        catch( std::exception& ) { caught = true; }
+        if( !caught )
+            LogicError("A file of the wrong size was not rejected");
+        std::remove( filename.c_str() );
+        Output((flat ? "BINARY_FLAT" : "BINARY")," passed");
+    }
+
+    // Empty matrices are not mapped at all
+    Matrix<T> AEmpty( 0, n );
+    Write( AEmpty, basename, BINARY );
+    {
+        MappedMatrix<T> AMapped( basename+".bin" );
+        CheckEqual( "Empty BINARY", AMapped.LockedMatrix(), AEmpty );
+    }
+    std::remove( (basename+".bin").c_str() );
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",200);
+        const Int n = Input("--n","width of matrix",150);
+        ProcessInput();
+        PrintInputReport();
+
+#ifdef EL_HAVE_MMAP
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestMappedMatrix<double>( m, n );
+            TestMappedMatrix<Complex<float>>( m, n );
+            TestMappedMatrix<Int>( m, n );
+        }
+#else
+        OutputFromRoot(comm,"Memory mapping is not supported; skipping");
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <fstream>
+#include <random>
+#include <set>
+using namespace El;
+
+// Write general, symmetric, skew-symmetric, Hermitian, and pattern Matrix
+// Market files (including values with more than 19 significant digits and
+// decimal exponents beyond +-22, which the fast path of the parallel reader
+// must hand to strtod) and require that reading them into a DistSparseMatrix
+// (through the memory-mapped reader, when it is available, with each process
+// parsing its share of the bytes) exactly reproduces the sequential stream
+// reader of SparseMatrix. Infinities, which the stream reader does not
+// accept, are checked against strtod.
+
+// Values which cannot be exactly parsed through Clinger's fast path
+const char* hardValues[] =
+  { "3.14159265358979323846264338327950288",
+    "-123456789012345678901234567890",
+    "0.000000000000000000000000001234567",
+    "1e23",
+    "-4.5e-23",
+    "1.7976931348623157e308",
+    "2.2250738585072011e-308",
+    "4.9406564584124654e-324",
+    "9007199254740993",
+    "0.1000000000000000055511151231257827" };
+const Int numHardValues = sizeof(hardValues)/sizeof(hardValues[0]);
+
+// Form a random lower-triangular (or, if 'general', arbitrary) pattern with
+// unique coordinates
+vector<pair<Int,Int>> RandomCoordinates
+( std::mt19937& gen, Int n, Int numEntries, bool general, bool strictlyLower )
+{
+    std::uniform_int_distribution<Int> indexDist(0,n-1);
+    std::set<pair<Int,Int>> coordinates;
+    while( Int(coordinates.size()) < numEntries )
+    {
+        Int i = indexDist(gen), j = indexDist(gen);
+        if( !general && i < j )
+            std::swap( i, j );
+        if( strictlyLower && i == j )
+            continue;
+        coordinates.insert( pair<Int,Int>(i,j) );
+    }
+    return vector<pair<Int,Int>>( coordinates.begin(), coordinates.end() );
+}
+
+// Every tenth value (starting with the first) is a hard one
+string RandomValue( std::mt19937& gen, Int k )
+{
+    if( k % 10 == 0 )
+        return hardValues[(k/10) % numHardValues];
+    std::uniform_real_distribution<double> valueDist(-1.,1.);
+    std::ostringstream os;
+    os.precision( 17 );
+    os << valueDist(gen);
+    return os.str();
+}
+
+void WriteFile
+( const string& filename, const string& field, const string& symmetry,
+  Int n, Int numEntries )
+{
+    std::mt19937 gen( 37 );
+    const bool general = ( symmetry == "general" );
+    const bool skew = ( symmetry == "skew-symmetric" );
+    const bool hermitian = ( symmetry == "hermitian" );
+    const auto coordinates =
+      RandomCoordinates( gen, n, numEntries, general, skew );
+
+    std::ofstream file( filename.c_str() );
+    file << "%%MatrixMarket matrix coordinate " << field << " " << symmetry
+         << "\n% Generated by the MatrixMarketMapped test\n"
+         << n << " " << n << " " << numEntries << "\n";
+    for( Int k=0; k<numEntries; ++k )
+    {
+        const Int i = coordinates[k].first, j = coordinates[k].second;
+        file << i+1 << " " << j+1;
+        if( field != "pattern" )
+            file << " " << RandomValue( gen, k );
+        // The diagonal of a Hermitian matrix is real
+        if( field == "complex" )
+            file << " " << ( hermitian && i == j ? "0" : RandomValue(gen,k+5) );
+        file << "\n";
+    }
+}
+
+template<typename T>
+void CompareWithSequential( const string& label, const string& filename )
+{
+    DistSparseMatrix<T> ADist;
+    Read( ADist, filename, MATRIX_MARKET );
+    mpi::Comm comm = ADist.Grid().Comm();
+    if( mpi::Rank(comm) != 0 )
+    {
+        CopyFromNonRoot( ADist );
+        OutputFromRoot(comm,label," passed");
+        return;
+    }
+    SparseMatrix<T> AMapped, A;
+    CopyFromRoot( ADist, AMapped );
+    Read( A, filename, MATRIX_MARKET );
+    if( AMapped.Height() != A.Height() || AMapped.Width() != A.Width() ||
+        AMapped.NumEntries() != A.NumEntries() )
+        LogicError
+        (label,": read a ",AMapped.Height()," x ",AMapped.Width(),
+         " matrix with ",AMapped.NumEntries()," entries rather than a ",
+         A.Height()," x ",A.Width()," matrix with ",A.NumEntries());
+    for( Int e=0; e<A.NumEntries(); ++e )
+        if( AMapped.Row(e) != A.Row(e) || AMapped.Col(e) != A.Col(e) ||
+            AMapped.Value(e) != A.Value(e) )
+            LogicError
+            (label,": entry ",e," was (",AMapped.Row(e),",",AMapped.Col(e),
+             ",",AMapped.Value(e),") rather than (",A.Row(e),",",A.Col(e),
+             ",",A.Value(e),")");
+    OutputFromRoot(comm,label," passed");
+}
+
+// Place every hard value (and infinities) on the diagonal of a general
+// matrix, one per row, and compare with strtod
+void TestHardValues( mpi::Comm comm )
+{
+    vector<string> values( hardValues, hardValues+numHardValues );
+    values.push_back( "inf" );
+    values.push_back( "-Infinity" );
+    values.push_back( "+INF" );
+    const Int n = values.size();
+    const string filename = "MatrixMarketMappedHard.mtx";
+    if( mpi::Rank(comm) == 0 )
+    {
+        std::ofstream file( filename.c_str() );
+        file << "%%MatrixMarket matrix coordinate real general\n"
+             << n << " " << n << " " << n << "\n";
+        for( Int i=0; i<n; ++i )
+            file << i+1 << " " << i+1 << " " << values[i] << "\n";
+    }
+    mpi::Barrier( comm );
+
+    DistSparseMatrix<double> A;
+    Read( A, filename, MATRIX_MARKET );
+    for( Int e=0; e<A.NumLocalEntries(); ++e )
+    {
+        const Int i = A.Row(e);
+        const double expected = std::strtod( values[i].c_str(), nullptr );
+        if( A.Col(e) != i || A.Value(e) != expected )
+            LogicError
+            ("Entry (",i,",",A.Col(e),") was ",A.Value(e)," rather than ",
+             values[i]);
+    }
+    const Int numEntries = mpi::AllReduce( A.NumLocalEntries(), comm );
+    if( numEntries != n )
+        LogicError("Read ",numEntries," hard values rather than ",n);
+    OutputFromRoot(comm,"Hard values passed");
+
+    mpi::Barrier( comm );
+    if( mpi::Rank(comm) == 0 )
+        std::remove( filename.c_str() );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","height of matrix",300);
+        const Int numEntries = Input("--numEntries","number of entries",2000);
+        ProcessInput();
+        PrintInputReport();
+
+        struct Case { string field, symmetry; bool isComplex; };
+        const Case cases[] =
+          { { "real", "general", false },
+            { "real", "symmetric", false },
+            { "real", "skew-symmetric", false },
+            { "complex", "general", true },
+            { "complex", "hermitian", true },
+            { "pattern", "general", false },
+            { "pattern", "symmetric", false } };
+        const string filename = "MatrixMarketMapped.mtx";
+        for( const auto& c : cases )
+        {
+            if( mpi::Rank(comm) == 0 )
+                WriteFile( filename, c.field, c.symmetry, n, numEntries );
+            mpi::Barrier( comm );
+            const string label = c.field + " " + c.symmetry;
+            if( c.isComplex )
+                CompareWithSequential<Complex<double>>( label, filename );
+            else
+                CompareWithSequential<double>( label, filename );
+            mpi::Barrier( comm );
+        }
+        if( mpi::Rank(comm) == 0 )
+            std::remove( filename.c_str() );
+
+        TestHardValues( comm );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Ensure that matrices placed under each memory policy (which fall back to
+// ordinary pages whenever a policy is unavailable) behave identically
+void TestPolicy( const MemoryPolicy& policy, Int n, const Matrix<double>& A )
+{
+    Matrix<double> B;
+    B.SetMemoryPolicy( policy );
+    B = A;
+    if( B.MemoryPolicy().numa != policy.numa ||
+        B.MemoryPolicy().hugePages != policy.hugePages )
+        LogicError("The memory policy was not retained");
+
+    Matrix<double> C, CPolicy;
+    CPolicy.SetMemoryPolicy( policy );
+    Gemm( NORMAL, NORMAL, 1., A, A, C );
+    Gemm( NORMAL, NORMAL, 1., B, B, CPolicy );
+    CPolicy -= C;
+    if( MaxNorm(CPolicy) != 0. )
+        LogicError("Products differed under a memory policy");
+
+    // Buffers which follow a policy must still be resizable
+    B.Resize( 2*n, n );
+    Fill( B, 1. );
+    if( B.Get(2*n-1,n-1) != 1. )
+        LogicError("Resized buffer was incorrect");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","matrix size",600);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+        {
+            Matrix<double> A;
+            Uniform( A, n, n );
+            const NumaPolicy numaPolicies[] =
+              { NUMA_DEFAULT, NUMA_INTERLEAVED, NUMA_FIRST_TOUCH };
+            const HugePagePolicy hugePagePolicies[] =
+              { HUGE_PAGES_NONE, HUGE_PAGES_TRANSPARENT, HUGE_PAGES_2MB,
+                HUGE_PAGES_1GB };
+            for( auto numa : numaPolicies )
+                for( auto hugePages : hugePagePolicies )
+                {
+                    MemoryPolicy policy;
+                    policy.numa = numa;
+                    policy.hugePages = hugePages;
+                    TestPolicy( policy, n, A );
+                }
+
+            // The default policy applies to matrices without their own
+            MemoryPolicy interleaved;
+            interleaved.numa = NUMA_INTERLEAVED;
+            SetDefaultMemoryPolicy( interleaved );
+            Matrix<double> B( n, n );
+            if( B.MemoryPolicy().numa != NUMA_INTERLEAVED )
+                LogicError("The default memory policy was not used");
+            SetDefaultMemoryPolicy( MemoryPolicy() );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
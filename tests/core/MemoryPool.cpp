@@ -0,0 +1,104 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Allocate and release buffers through Memory<double> with the pool disabled
+// and enabled, and require that the hit, miss, return, discard, and cached
+// byte counters of the pool account for each of them.
+
+void CheckStats
+( const string& label,
+  size_t numHits, size_t numMisses, size_t numReturns, size_t numDiscards,
+  size_t numCachedBytes )
+{
+    const auto stats = MemoryPoolStats();
+    if( stats.numHits != numHits || stats.numMisses != numMisses ||
+        stats.numReturns != numReturns || stats.numDiscards != numDiscards ||
+        stats.numCachedBytes != numCachedBytes )
+        LogicError
+        (label,": expected (hits,misses,returns,discards,cached)=(",
+         numHits,",",numMisses,",",numReturns,",",numDiscards,",",
+         numCachedBytes,") but found (",stats.numHits,",",stats.numMisses,",",
+         stats.numReturns,",",stats.numDiscards,",",stats.numCachedBytes,")");
+    Output(label," passed");
+}
+
+void TestMemoryPool()
+{
+    // 1000 doubles occupy 8000 bytes and are rounded up to the 8 KiB class,
+    // as are 900 doubles, whereas 100 doubles are too few to be pooled
+    const size_t classBytes = 8192;
+    const bool wasEnabled = MemoryPoolEnabled();
+
+    // Nothing is pooled (or counted) while the pool is disabled, including a
+    // buffer which is released after the pool has been enabled
+    EnableMemoryPool( false );
+    ResetMemoryPoolStats();
+    {
+        Memory<double> unpooled( 1000 );
+        CheckStats( "Disabled pool", 0, 0, 0, 0, 0 );
+        EnableMemoryPool( true );
+    }
+    CheckStats( "Unpooled release", 0, 0, 0, 0, 0 );
+
+    SetMemoryPoolCapacity( size_t(1) << 30 );
+    {
+        Memory<double> buffer( 1000 );
+        CheckStats( "Miss", 0, 1, 0, 0, 0 );
+        buffer.Empty();
+        CheckStats( "Return", 0, 1, 1, 0, classBytes );
+        buffer.Require( 900 );
+        CheckStats( "Hit", 1, 1, 1, 0, 0 );
+        Memory<double> small( 100 );
+        CheckStats( "Small allocation", 1, 1, 1, 0, 0 );
+    }
+    CheckStats( "Scope exit", 1, 1, 2, 0, classBytes );
+
+    // With room for a single cached buffer, the second release is discarded
+    SetMemoryPoolCapacity( classBytes );
+    {
+        Memory<double> first( 1000 ), second( 1000 );
+        CheckStats( "Second miss", 2, 2, 2, 0, 0 );
+    }
+    CheckStats( "Capacity", 2, 2, 3, 1, classBytes );
+
+    TrimMemoryPool();
+    CheckStats( "Trim", 2, 2, 3, 1, 0 );
+
+    // Disabling the pool returns its cached buffers to the system
+    {
+        Memory<double> buffer( 1000 );
+    }
+    CheckStats( "Cached", 2, 3, 4, 1, classBytes );
+    EnableMemoryPool( false );
+    CheckStats( "Disable", 2, 3, 4, 1, 0 );
+
+    SetMemoryPoolCapacity( size_t(1) << 30 );
+    EnableMemoryPool( wasEnabled );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        ProcessInput();
+        PrintInputReport();
+
+        // The pool is process-wide, so each process tests its own
+        if( mpi::Rank(comm) == 0 )
+            TestMemoryPool();
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the shared-memory AllGather of NodeAwareComm against mpi::AllGather
+// over the communicators of a grid for a sequence of growing and shrinking
+// contribution sizes which are not multiples of a word, and require that
+// redistributions whose local sizes are uneven produce the same result with
+// and without node-aware collectives.
+
+byte Pattern( int rank, Int i, Int trial )
+{ return byte((rank*131+i*7+trial*29) % 251); }
+
+void TestAllGather( const string& label, NodeAwareComm& nodeAware )
+{
+    const mpi::Comm comm = nodeAware.Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const Int sizes[] = { 1, 3, 17, 1001, 5, 40003, 2, 40003 };
+    Int trial = 0;
+    for( const Int numBytes : sizes )
+    {
+        vector<byte> sendBuf( numBytes );
+        for( Int i=0; i<numBytes; ++i )
+            sendBuf[i] = Pattern( commRank, i, trial );
+        vector<byte> recvBuf( commSize*numBytes ),
+                     recvBufMPI( commSize*numBytes );
+        nodeAware.AllGather( sendBuf.data(), numBytes, recvBuf.data() );
+        mpi::AllGather
+        ( sendBuf.data(), int(numBytes), recvBufMPI.data(), int(numBytes),
+          comm );
+        if( recvBuf != recvBufMPI )
+            LogicError
+            (label," AllGather of ",numBytes," bytes differed from MPI's");
+        ++trial;
+    }
+    OutputFromRoot
+    (comm,label," (",nodeAware.NumNodes()," nodes, shared collectives ",
+     (nodeAware.SharedCollectives() ? "on" : "off"),") passed");
+}
+
+template<Dist U,Dist V>
+void TestRedistribution
+( const string& label, const DistMatrix<double>& A )
+{
+    EnableNodeAwareCollectives( false );
+    DistMatrix<double,U,V> B( A );
+    EnableNodeAwareCollectives( true );
+    DistMatrix<double,U,V> BNodeAware( A );
+    BNodeAware.Matrix() -= B.Matrix();
+    const double maxDiff =
+      mpi::AllReduce
+      ( MaxNorm(BNodeAware.LockedMatrix()), mpi::MAX, A.Grid().Comm() );
+    if( maxDiff != 0. )
+        LogicError(label," differed with node-aware collectives");
+    OutputFromRoot(A.Grid().Comm(),label," passed");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",103);
+        const Int n = Input("--n","width of matrix",71);
+        ProcessInput();
+        PrintInputReport();
+
+        const bool wasEnabled = NodeAwareCollectivesEnabled();
+        EnableNodeAwareCollectives( true );
+
+        NodeAwareComm worldNodeAware( comm );
+        TestAllGather( "World", worldNodeAware );
+        const Grid grid( comm );
+        TestAllGather( "MC", *grid.NodeAware(grid.MCComm()) );
+        TestAllGather( "MR", *grid.NodeAware(grid.MRComm()) );
+        TestAllGather( "VC", *grid.NodeAware(grid.VCComm()) );
+        TestAllGather( "VR", *grid.NodeAware(grid.VRComm()) );
+
+        DistMatrix<double> A(grid);
+        Uniform( A, m, n );
+        TestRedistribution<STAR,STAR>( "[MC,MR] -> [STAR,STAR]", A );
+        TestRedistribution<STAR,MR>( "[MC,MR] -> [STAR,MR]", A );
+        TestRedistribution<MC,STAR>( "[MC,MR] -> [MC,STAR]", A );
+
+        EnableNodeAwareCollectives( wasEnabled );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Every process queues the same pseudo-random updates (scaled by its rank)
+// through the per-thread queues, and the result is compared against the
+// sum formed redundantly on each process
+template<typename T>
+void TestQueues
+( Int m, Int n, Int numUpdates, bool compress, const Grid& g )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing with ",TypeName<T>(),(compress?" (compressed)":""));
+    const int commRank = mpi::Rank( g.Comm() );
+    const int commSize = mpi::Size( g.Comm() );
+    DistMatrix<T> A(g);
+    Zeros( A, m, n );
+    Matrix<T> ASum;
+    Zeros( ASum, m, n );
+
+    const int numThreads = 4;
+    A.ReserveThreadQueues( numThreads, numUpdates/numThreads+1 );
+    EL_PARALLEL_FOR
+    for( int t=0; t<numThreads; ++t )
+    {
+        for( Int k=t; k<numUpdates; k+=numThreads )
+        {
+            const Int i = (k*7919) % m;
+            const Int j = (k*104729) % n;
+            A.QueueThreadUpdate( t, i, j, T(commRank+1) );
+        }
+    }
+    A.ProcessQueues( true, compress );
+
+    for( Int k=0; k<numUpdates; ++k )
+        ASum.Update( (k*7919) % m, (k*104729) % n, T(1) );
+    ASum *= T(commSize*(commSize+1)/2);
+
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    A_STAR_STAR.Matrix() -= ASum;
+    if( FrobeniusNorm( A_STAR_STAR.Matrix() ) != Base<T>(0) )
+        LogicError("Queued updates were incorrectly applied");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",100);
+        const Int numUpdates = Input("--numUpdates","updates per process",5000);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        for( bool compress : { false, true } )
+        {
+            TestQueues<double>( m, n, numUpdates, compress, g );
+            TestQueues<Complex<float>>( m, n, numUpdates, compress, g );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
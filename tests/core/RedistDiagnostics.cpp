@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+Int NumEvents( const string& kind, const string& callSite )
+{
+    Int numCalls = 0;
+    for( const auto& event : RedistEvents() )
+        if( event.kind == kind && event.callSite == callSite )
+            numCalls += event.numCalls;
+    return numCalls;
+}
+
+void TestDiagnostics( Int n, const Grid& g )
+{
+    EnableRegionTimers();
+    EnableRedistDiagnostics();
+    ResetRedistDiagnostics();
+
+    DistMatrix<double> A(g);
+    Uniform( A, n, n );
+    {
+        EL_REGION("UnalignedGather");
+        DistMatrix<double,MC,STAR> A_MC_STAR(g);
+        A_MC_STAR.AlignCols( Mod(A.ColAlign()+1,g.Height()) );
+        A_MC_STAR = A;
+    }
+    const Int numRealigns = NumEvents( "realign", "UnalignedGather" );
+    if( g.Height() > 1 && numRealigns == 0 )
+        LogicError("Unaligned [MC,MR] -> [MC,* ] was not recorded");
+    if( g.Height() == 1 && numRealigns != 0 )
+        LogicError("Aligned [MC,MR] -> [MC,* ] was recorded");
+
+    // Pre-aligning the inputs of Gemm must not change the result
+    DistMatrix<double> B(g), C(g), CPre(g);
+    Uniform( B, n, n );
+    C.Align( Mod(1,g.Height()), Mod(1,g.Width()) );
+    CPre.Align( Mod(1,g.Height()), Mod(1,g.Width()) );
+    Zeros( C, n, n );
+    Zeros( CPre, n, n );
+    Gemm( NORMAL, NORMAL, 1., A, B, 0., C, GEMM_SUMMA_C );
+    SetPreAlignInputs( true );
+    Gemm( NORMAL, NORMAL, 1., A, B, 0., CPre, GEMM_SUMMA_C );
+    SetPreAlignInputs( false );
+    CPre -= C;
+    const double error = FrobeniusNorm( CPre );
+    if( error > n*n*limits::Epsilon<double>()*FrobeniusNorm(C) )
+        LogicError("Pre-aligned Gemm differed by ",error);
+
+    if( g.Rank() == 0 )
+        PrintRedistDiagnostics();
+    EnableRedistDiagnostics( false );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","matrix size",100);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestDiagnostics( n, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
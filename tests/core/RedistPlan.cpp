@@ -0,0 +1,110 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T,Dist BColDist,Dist BRowDist>
+void Check
+( const DistMatrix<T>& A, Int numReplays, bool persistent, bool print )
+{
+    EL_DEBUG_ONLY(CallStackEntry cse("Check"))
+    const Grid& g = A.Grid();
+    OutputFromRoot
+    (g.Comm(),
+     "Testing [",DistToString(BColDist),",",DistToString(BRowDist),"]",
+     " <- [MC,MR] with ",(persistent?"persistent":"collective")," plan");
+
+    DistMatrix<T,BColDist,BRowDist> B(g);
+    Int colAlign = SampleUniform<Int>(0,B.ColStride());
+    Int rowAlign = SampleUniform<Int>(0,B.RowStride());
+    mpi::Broadcast( colAlign, 0, g.Comm() );
+    mpi::Broadcast( rowAlign, 0, g.Comm() );
+    B.Align( colAlign, rowAlign );
+
+    RedistPlan<T> plan( A, B, persistent );
+    DistMatrix<T> ACopy(A);
+    Int myErrorFlag = 0;
+    for( Int replay=0; replay<numReplays; ++replay )
+    {
+        // Modify the source so that each replay transfers fresh data
+        ACopy *= T(2);
+        plan.Execute( ACopy, B );
+
+        DistMatrix<T,STAR,STAR> A_STAR_STAR(ACopy), B_STAR_STAR(B);
+        for( Int j=0; j<A.Width(); ++j )
+            for( Int i=0; i<A.Height(); ++i )
+                if( A_STAR_STAR.GetLocal(i,j) != B_STAR_STAR.GetLocal(i,j) )
+                    myErrorFlag = 1;
+    }
+
+    Int summedErrorFlag;
+    mpi::AllReduce( &myErrorFlag, &summedErrorFlag, 1, mpi::SUM, g.Comm() );
+    if( summedErrorFlag == 0 )
+    {
+        OutputFromRoot(g.Comm(),"PASSED");
+        if( print )
+            Print( B, "B" );
+    }
+    else
+    {
+        OutputFromRoot(g.Comm(),"FAILED");
+        if( print )
+            Print( ACopy, "A" );
+        if( print )
+            Print( B, "B" );
+        LogicError("RedistPlan test failed");
+    }
+}
+
+template<typename T>
+void CheckAll
+( Int m, Int n, Int numReplays, const Grid& grid, bool persistent, bool print )
+{
+    DistMatrix<T> A(grid);
+    Uniform( A, m, n );
+    Check<T,MC,  MR  >( A, numReplays, persistent, print );
+    Check<T,MR,  MC  >( A, numReplays, persistent, print );
+    Check<T,VC,  STAR>( A, numReplays, persistent, print );
+    Check<T,STAR,VR  >( A, numReplays, persistent, print );
+    Check<T,MC,  STAR>( A, numReplays, persistent, print );
+    Check<T,STAR,MR  >( A, numReplays, persistent, print );
+    Check<T,STAR,STAR>( A, numReplays, persistent, print );
+    Check<T,CIRC,CIRC>( A, numReplays, persistent, print );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",50);
+        const Int n = Input("--width","width of matrix",50);
+        const Int numReplays = Input("--numReplays","number of replays",3);
+        const bool print = Input("--print","print wrong matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, order );
+
+        OutputFromRoot(comm,"Testing with doubles");
+        CheckAll<double>( m, n, numReplays, g, true, print );
+        CheckAll<double>( m, n, numReplays, g, false, print );
+
+        OutputFromRoot(comm,"Testing with double-precision complex");
+        CheckAll<Complex<double>>( m, n, numReplays, g, true, print );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
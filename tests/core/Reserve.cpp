@@ -0,0 +1,85 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Ensure that reserved buffers preserve their entries and survive the
+// resizes (and non-freeing empties) of an iterative solver
+void TestMatrix( Int n )
+{
+    Matrix<double> A;
+    Uniform( A, n, 2 );
+    const double alpha = A(n-1,1);
+    A.Reserve( 4*n*n );
+    if( A(n-1,1) != alpha )
+        LogicError("Reserve did not preserve the entries");
+    if( A.MemorySize() < 4*n*n )
+        LogicError("Reserve did not increase the capacity");
+
+    const double* buffer = A.LockedBuffer();
+    A.Resize( 2*n, 2*n );
+    A.Empty( false );
+    A.Resize( n, 4*n );
+    A.Resize( 4*n, n );
+    if( A.LockedBuffer() != buffer )
+        LogicError("Resize reallocated a reserved Matrix");
+}
+
+void TestDistMatrix( Int n, const Grid& g )
+{
+    DistMatrix<double> A(g);
+    A.Resize( n, n );
+    A.ReserveLocal
+    ( 4*MaxLength(n,g.Height())*MaxLength(n,g.Width()) );
+    const double* buffer = A.LockedBuffer();
+    A.Empty( false );
+    A.Resize( 2*n, n );
+    if( A.LocalHeight()*A.LocalWidth() > 0 && A.LockedBuffer() != buffer )
+        LogicError("Resize reallocated a reserved DistMatrix");
+}
+
+void TestDistMultiVec( Int n, const Grid& g )
+{
+    DistMultiVec<double> X(g);
+    Zeros( X, n, 1 );
+    X.ReserveLocal( 4*X.Blocksize() );
+    const double* buffer = X.LockedMatrix().LockedBuffer();
+    for( Int rep=0; rep<3; ++rep )
+    {
+        Zeros( X, 2*n, 1 );
+        X.Reserve( 1 );
+        X.QueueUpdate( 0, 0, double(1) );
+        X.ProcessQueues();
+        X.Empty( false );
+        Zeros( X, n, 2 );
+    }
+    if( X.LocalHeight() > 0 && X.LockedMatrix().LockedBuffer() != buffer )
+        LogicError("Resize reallocated a reserved DistMultiVec");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","matrix size",50);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestMatrix( n );
+        TestDistMatrix( n, g );
+        TestDistMultiVec( n, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
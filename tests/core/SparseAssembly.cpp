@@ -0,0 +1,204 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <map>
+#include <random>
+using namespace El;
+
+// Compare the bucket-sorted assembly of queued sparse entries against a
+// std::map which sums the duplicates of each (row,column) pair.
+
+typedef std::map<pair<Int,Int>,double> Reference;
+
+// Compare sorted, compressed triplets against the reference entries whose
+// rows lie in [firstRow,firstRow+numRows)
+void CheckTriplets
+( const string& label,
+  const Reference& reference,
+  Int firstRow,
+  Int numRows,
+  const vector<Int>& rows,
+  const vector<Int>& cols,
+  const vector<double>& values )
+{
+    const double tol = 100*limits::Epsilon<double>();
+    auto it = reference.lower_bound( pair<Int,Int>(firstRow,0) );
+    const auto end = reference.lower_bound( pair<Int,Int>(firstRow+numRows,0) );
+    const Int numEntries = rows.size();
+    for( Int e=0; e<numEntries; ++e, ++it )
+    {
+        if( it == end )
+            LogicError(label," had more entries than the reference");
+        if( rows[e] != it->first.first || cols[e] != it->first.second )
+            LogicError
+            (label," entry ",e," was (",rows[e],",",cols[e],") rather than (",
+             it->first.first,",",it->first.second,")");
+        if( Abs(values[e]-it->second) > tol*Max(Abs(it->second),1.) )
+            LogicError
+            (label," entry ",e," had value ",values[e]," rather than ",
+             it->second);
+    }
+    if( it != end )
+        LogicError(label," had fewer entries than the reference");
+}
+
+// Form random triplets over a few short rows and a few long ones (so that
+// both the insertion sort and the stable sort are exercised) with many
+// duplicates
+void RandomTriplets
+( std::mt19937& gen, Int numRows, Int numCols, Int numEntries,
+  vector<Int>& rows, vector<Int>& cols, vector<double>& values )
+{
+    std::uniform_int_distribution<Int> rowDist(0,numRows-1);
+    std::uniform_int_distribution<Int> longRowDist(0,Min(numRows,Int(4))-1);
+    std::uniform_int_distribution<Int> colDist(0,numCols-1);
+    std::uniform_real_distribution<double> valueDist(-1.,1.);
+    rows.resize( numEntries );
+    cols.resize( numEntries );
+    values.resize( numEntries );
+    for( Int e=0; e<numEntries; ++e )
+    {
+        rows[e] = ( e % 4 == 0 ? longRowDist(gen) : rowDist(gen) );
+        cols[e] = colDist(gen);
+        values[e] = valueDist(gen);
+    }
+}
+
+void TestAssembleTriplets( Int numRows, Int numCols, Int numEntries )
+{
+    std::mt19937 gen( 17 );
+    vector<Int> rows, cols;
+    vector<double> values;
+    RandomTriplets( gen, numRows, numCols, numEntries, rows, cols, values );
+
+    Reference reference;
+    for( Int e=0; e<numEntries; ++e )
+        reference[pair<Int,Int>(rows[e],cols[e])] += values[e];
+
+    // Shift the rows to test a nonzero first source
+    const Int firstRow = 7;
+    for( Int e=0; e<numEntries; ++e )
+        rows[e] += firstRow;
+    AssembleTriplets( firstRow, numRows, rows, cols, values );
+    for( Int e=0; e<Int(rows.size()); ++e )
+        rows[e] -= firstRow;
+    CheckTriplets
+    ( "AssembleTriplets", reference, 0, numRows, rows, cols, values );
+    Output("AssembleTriplets matched the reference");
+}
+
+void TestSparseMatrix( Int numRows, Int numCols, Int numEntries )
+{
+    std::mt19937 gen( 23 );
+    vector<Int> rows, cols;
+    vector<double> values;
+    RandomTriplets( gen, numRows, numCols, numEntries, rows, cols, values );
+
+    // Queue the updates in two batches, removing a few existing entries
+    // along with the second batch
+    SparseMatrix<double> A;
+    Zeros( A, numRows, numCols );
+    Reference reference;
+    const Int half = numEntries / 2;
+    for( Int e=0; e<half; ++e )
+    {
+        A.QueueUpdate( rows[e], cols[e], values[e] );
+        reference[pair<Int,Int>(rows[e],cols[e])] += values[e];
+    }
+    A.ProcessQueues();
+    for( Int e=half; e<numEntries; ++e )
+    {
+        A.QueueUpdate( rows[e], cols[e], values[e] );
+        reference[pair<Int,Int>(rows[e],cols[e])] += values[e];
+    }
+    for( Int e=0; e<half; e+=97 )
+    {
+        A.QueueZero( rows[e], cols[e] );
+        reference.erase( pair<Int,Int>(rows[e],cols[e]) );
+    }
+    A.ProcessQueues();
+
+    const Int numAssembled = A.NumEntries();
+    vector<Int> assembledRows( numAssembled ), assembledCols( numAssembled );
+    vector<double> assembledValues( numAssembled );
+    for( Int e=0; e<numAssembled; ++e )
+    {
+        assembledRows[e] = A.Row(e);
+        assembledCols[e] = A.Col(e);
+        assembledValues[e] = A.Value(e);
+    }
+    CheckTriplets
+    ( "SparseMatrix", reference, 0, numRows,
+      assembledRows, assembledCols, assembledValues );
+    Output("SparseMatrix matched the reference");
+}
+
+void TestDistSparseMatrix
+( const Grid& grid, Int numRows, Int numCols, Int numEntries )
+{
+    // Every process generates the same triplets and queues them all, with
+    // those of nonlocal rows sent to their owners
+    std::mt19937 gen( 29 );
+    vector<Int> rows, cols;
+    vector<double> values;
+    RandomTriplets( gen, numRows, numCols, numEntries, rows, cols, values );
+    const Int commSize = grid.Size();
+
+    DistSparseMatrix<double> A(grid);
+    Zeros( A, numRows, numCols );
+    A.Reserve( numEntries, numEntries );
+    Reference reference;
+    for( Int e=0; e<numEntries; ++e )
+    {
+        A.QueueUpdate( rows[e], cols[e], values[e] );
+        reference[pair<Int,Int>(rows[e],cols[e])] += commSize*values[e];
+    }
+    A.ProcessQueues();
+
+    const Int numLocal = A.NumLocalEntries();
+    vector<Int> localRows( numLocal ), localCols( numLocal );
+    vector<double> localValues( numLocal );
+    for( Int e=0; e<numLocal; ++e )
+    {
+        localRows[e] = A.Row(e);
+        localCols[e] = A.Col(e);
+        localValues[e] = A.Value(e);
+    }
+    CheckTriplets
+    ( "DistSparseMatrix", reference, A.FirstLocalRow(), A.LocalHeight(),
+      localRows, localCols, localValues );
+    OutputFromRoot(grid.Comm(),"DistSparseMatrix matched the reference");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int numRows = Input("--numRows","number of rows",500);
+        const Int numCols = Input("--numCols","number of columns",300);
+        const Int numEntries =
+          Input("--numEntries","number of queued entries",200000);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        if( grid.Rank() == 0 )
+        {
+            TestAssembleTriplets( numRows, numCols, numEntries );
+            TestSparseMatrix( numRows, numCols, numEntries );
+        }
+        TestDistSparseMatrix( grid, numRows, numCols, numEntries );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
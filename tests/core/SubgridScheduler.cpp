@@ -0,0 +1,80 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Concurrently factor two HPD matrices on separate subgrids, then solve with
+// both factors within a dependent task, and compare against the results over
+// the full grid
+template<typename Field>
+void TestScheduler( Int n, int numSubgrids, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    typedef Base<Field> Real;
+    DistMatrix<Field> A(g), B(g), X(g), Y(g);
+    HermitianUniformSpectrum( A, n, Real(1), Real(10) );
+    HermitianUniformSpectrum( B, n, Real(1), Real(10) );
+    Uniform( X, n, 1 );
+    Y = X;
+
+    SubgridScheduler scheduler( g, numSubgrids );
+    DistMatrix<Field> ASub(g), BSub(g), LA(g), LB(g), XSub(g);
+    const Int factorA = scheduler.AddTask
+    ( [&]( const Grid& ) { Cholesky( LOWER, ASub ); } );
+    scheduler.AddInput( factorA, A, ASub );
+    const Int factorB = scheduler.AddTask
+    ( [&]( const Grid& ) { Cholesky( LOWER, BSub ); } );
+    scheduler.AddInput( factorB, B, BSub );
+
+    const Int solve = scheduler.AddTask
+    ( [&]( const Grid& )
+      {
+          cholesky::SolveAfter( LOWER, NORMAL, LA, XSub );
+          cholesky::SolveAfter( LOWER, NORMAL, LB, XSub );
+      },
+      { factorA, factorB } );
+    scheduler.AddInput( solve, ASub, LA );
+    scheduler.AddInput( solve, BSub, LB );
+    scheduler.AddInput( solve, X, XSub );
+    scheduler.AddOutput( solve, XSub, X );
+    scheduler.Run();
+
+    Cholesky( LOWER, A );
+    Cholesky( LOWER, B );
+    cholesky::SolveAfter( LOWER, NORMAL, A, Y );
+    cholesky::SolveAfter( LOWER, NORMAL, B, Y );
+    X -= Y;
+    const Real relError = FrobeniusNorm( X ) / FrobeniusNorm( Y );
+    OutputFromRoot
+    (g.Comm(),"|| X - Y ||_F / || Y ||_F = ",relError);
+    if( relError > n*limits::Epsilon<Real>()*100 )
+        LogicError("Relative error was unacceptably large");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of matrices",100);
+        const int numSubgrids = Input("--numSubgrids","number of subgrids",2);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        const int subgrids = Min( numSubgrids, g.Size() );
+        TestScheduler<double>( n, subgrids, g );
+        TestScheduler<Complex<double>>( n, subgrids, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
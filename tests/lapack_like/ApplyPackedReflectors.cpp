@@ -181,6 +181,10 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int offset = Input("--offset","diagonal offset for storage",0);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int numPanels =
+          Input("--numPanels","number of panels per UT transform",1);
+        const bool pipeline =
+          Input("--pipeline","pipeline the reflector broadcasts?",false);
         const bool correctness  = Input
             ("--correctness","test correctness?",true);
         const bool printMatrices = Input("--print","print matrices?",false);
@@ -204,6 +208,8 @@ main( int argc, char* argv[] )
         const Conjugation conjugation =
             ( conjugate ? CONJUGATED : UNCONJUGATED );
         SetBlocksize( nb );
+        SetApplyPackedReflectorsAggregation( numPanels );
+        SetApplyPackedReflectorsPipelining( pipeline );
         if( uplo == LOWER && offset > 0 )
             LogicError
             ("Offset cannot be positive if transforms are in lower triangle");
@@ -0,0 +1,92 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A deterministic band entry so that the sequential and distributed matrices
+// agree. The diagonal is only weakly dominant in the non-Hermitian case so
+// that the row interchanges are exercised.
+template<typename Field>
+Field BandEntry( Int i, Int j, bool hermitian )
+{
+    typedef Base<Field> Real;
+    if( i == j )
+        return Field( hermitian ? Real(10) : Real(1)/Real(3) );
+    const Int lo = Min(i,j), hi = Max(i,j);
+    Field value = Real((7*lo+3*hi) % 11)/Real(11) - Real(1)/Real(2);
+    if( IsComplex<Field>::value )
+    {
+        const Real imag = Real((5*lo+hi) % 13)/Real(13) - Real(1)/Real(2);
+        SetImagPart( value, i > j || !hermitian ? imag : -imag );
+    }
+    return value;
+}
+
+template<typename Field>
+void TestBandSolve
+( Int n, Int kl, Int ku, Int numRHS, bool hermitian, const Grid& grid )
+{
+    typedef Base<Field> Real;
+    if( hermitian )
+        ku = kl;
+    OutputFromRoot
+    (grid.Comm(),"Testing ",(hermitian ? "HPD" : "linear")," band solve with ",
+     TypeName<Field>());
+
+    DistBandMatrix<Field> A( n, kl, ku, grid );
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int i=Max(j-ku,Int(0)); i<=Min(j+kl,n-1); ++i )
+            A.SetLocal( i, jLoc, BandEntry<Field>( i, j, hermitian ) );
+    }
+
+    DistMultiVec<Field> X(grid), B(grid);
+    Uniform( X, n, numRHS );
+    Zeros( B, n, numRHS );
+    A.Multiply( Field(1), X, Field(0), B );
+    if( hermitian )
+        HPDSolve( A, B );
+    else
+        LinearSolve( A, B );
+
+    B -= X;
+    const Real relError = FrobeniusNorm( B ) / FrobeniusNorm( X );
+    OutputFromRoot(grid.Comm(),"|| X - inv(A) (A X) ||_F / || X ||_F = ",
+     relError);
+    if( relError > n*limits::Epsilon<Real>()*1000 )
+        LogicError("Relative error was unacceptably large");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","order of the matrices",200);
+        const Int kl = Input("--kl","lower bandwidth",3);
+        const Int ku = Input("--ku","upper bandwidth",2);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        for( bool hermitian : { false, true } )
+        {
+            TestBandSolve<double>( n, kl, ku, numRHS, hermitian, grid );
+            TestBandSolve<Complex<double>>
+            ( n, kl, ku, numRHS, hermitian, grid );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,311 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void CheckMember
+( const string& label, Int b,
+  const Matrix<Field>& batched, const Matrix<Field>& reference )
+{
+    typedef Base<Field> Real;
+    const Real tol = 100*reference.Height()*limits::Epsilon<Real>();
+    Matrix<Field> E( batched );
+    E -= reference;
+    const Real refNorm = FrobeniusNorm( reference );
+    if( FrobeniusNorm(E) > tol*Max(refNorm,Real(1)) )
+        LogicError(label," disagreed with its unbatched version for member ",b);
+}
+
+// Compare each batched routine (including the batched Hermitian eigensolvers
+// and Schur decompositions), in both its vector and side-by-side forms,
+// against the unbatched routine applied to each member
+template<typename Field>
+void TestBatched( Int batchSize, Int n, Int k )
+{
+    typedef Base<Field> Real;
+    Output("Testing with ",TypeName<Field>());
+    PushIndent();
+
+    // Gemm
+    Matrix<Field> ASide, BSide, CSide;
+    Gaussian( ASide, n, batchSize*k );
+    Gaussian( BSide, k, batchSize*n );
+    Gaussian( CSide, n, batchSize*n );
+    auto A = LockedBatchView( batchSize, ASide );
+    auto B = LockedBatchView( batchSize, BSide );
+    vector<Matrix<Field>> C( batchSize );
+    for( Int b=0; b<batchSize; ++b )
+        C[b] = CSide( ALL, IR(b*n,(b+1)*n) );
+    const Field alpha( 2 ), beta( -1 );
+    vector<Matrix<Field>> CRef( C );
+    for( Int b=0; b<batchSize; ++b )
+        Gemm( NORMAL, NORMAL, alpha, A[b], B[b], beta, CRef[b] );
+    GemmBatched( NORMAL, NORMAL, alpha, A, B, beta, C );
+    GemmBatched( NORMAL, NORMAL, batchSize, alpha, ASide, BSide, beta, CSide );
+    auto CFromSide = LockedBatchView( batchSize, CSide );
+    for( Int b=0; b<batchSize; ++b )
+    {
+        CheckMember( "GemmBatched", b, C[b], CRef[b] );
+        CheckMember( "Side-by-side GemmBatched", b, CFromSide[b], CRef[b] );
+    }
+    Output("GemmBatched passed");
+
+    // Cholesky and Trsm on a batch of HPD matrices
+    Matrix<Field> HSide( n, batchSize*n );
+    for( Int b=0; b<batchSize; ++b )
+    {
+        auto Hb = HSide( ALL, IR(b*n,(b+1)*n) );
+        HermitianUniformSpectrum( Hb, n, Real(1), Real(10) );
+    }
+    vector<Matrix<Field>> H( batchSize );
+    vector<Matrix<Field>> HRef( batchSize );
+    for( Int b=0; b<batchSize; ++b )
+    {
+        H[b] = HSide( ALL, IR(b*n,(b+1)*n) );
+        HRef[b] = H[b];
+        Cholesky( LOWER, HRef[b] );
+    }
+    CholeskyBatched( LOWER, H );
+    CholeskyBatched( LOWER, batchSize, HSide );
+    auto HFromSide = LockedBatchView( batchSize, HSide );
+    for( Int b=0; b<batchSize; ++b )
+    {
+        MakeTrapezoidal( LOWER, H[b] );
+        MakeTrapezoidal( LOWER, HRef[b] );
+        Matrix<Field> HSideb( HFromSide[b] );
+        MakeTrapezoidal( LOWER, HSideb );
+        CheckMember( "CholeskyBatched", b, H[b], HRef[b] );
+        CheckMember( "Side-by-side CholeskyBatched", b, HSideb, HRef[b] );
+    }
+    Output("CholeskyBatched passed");
+
+    Matrix<Field> XSide;
+    Gaussian( XSide, n, batchSize*k );
+    vector<Matrix<Field>> X( batchSize ), XRef( batchSize );
+    for( Int b=0; b<batchSize; ++b )
+    {
+        X[b] = XSide( ALL, IR(b*k,(b+1)*k) );
+        XRef[b] = X[b];
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, alpha, H[b], XRef[b] );
+    }
+    TrsmBatched( LEFT, LOWER, NORMAL, NON_UNIT, alpha, H, X );
+    TrsmBatched
+    ( LEFT, LOWER, NORMAL, NON_UNIT, batchSize, alpha, HSide, XSide );
+    auto XFromSide = LockedBatchView( batchSize, XSide );
+    for( Int b=0; b<batchSize; ++b )
+    {
+        CheckMember( "TrsmBatched", b, X[b], XRef[b] );
+        CheckMember( "Side-by-side TrsmBatched", b, XFromSide[b], XRef[b] );
+    }
+    Output("TrsmBatched passed");
+
+    // LU with partial pivoting
+    Matrix<Field> LUSide;
+    Gaussian( LUSide, n, batchSize*n );
+    vector<Matrix<Field>> LUs( batchSize ), LURef( batchSize );
+    vector<Permutation> P, PSide, PRef( batchSize );
+    for( Int b=0; b<batchSize; ++b )
+    {
+        LUs[b] = LUSide( ALL, IR(b*n,(b+1)*n) );
+        LURef[b] = LUs[b];
+        LU( LURef[b], PRef[b] );
+    }
+    LUBatched( LUs, P );
+    LUBatched( batchSize, LUSide, PSide );
+    auto LUFromSide = LockedBatchView( batchSize, LUSide );
+    for( Int b=0; b<batchSize; ++b )
+    {
+        CheckMember( "LUBatched", b, LUs[b], LURef[b] );
+        CheckMember( "Side-by-side LUBatched", b, LUFromSide[b], LURef[b] );
+        Matrix<Int> p, pSide, pRef;
+        P[b].ExplicitVector( p );
+        PSide[b].ExplicitVector( pSide );
+        PRef[b].ExplicitVector( pRef );
+        for( Int i=0; i<n; ++i )
+            if( p(i) != pRef(i) || pSide(i) != pRef(i) )
+                LogicError("LUBatched pivots disagreed for member ",b);
+    }
+    Output("LUBatched passed");
+
+    // Singular values
+    Matrix<Field> SVDSide;
+    Gaussian( SVDSide, n, batchSize*k );
+    auto SVDMembers = LockedBatchView( batchSize, SVDSide );
+    vector<Matrix<Field>> SVDInputs( batchSize );
+    for( Int b=0; b<batchSize; ++b )
+        SVDInputs[b] = SVDMembers[b];
+    vector<Matrix<Real>> s;
+    Matrix<Real> sSide;
+    SVDBatched( SVDInputs, s );
+    SVDBatched( batchSize, SVDSide, sSide );
+    for( Int b=0; b<batchSize; ++b )
+    {
+        Matrix<Field> AMember( SVDInputs[b] );
+        Matrix<Real> sRef;
+        SVD( AMember, sRef );
+        Matrix<Real> sSideb( sSide( ALL, IR(b) ) );
+        CheckMember( "SVDBatched", b, s[b], sRef );
+        CheckMember( "Side-by-side SVDBatched", b, sSideb, sRef );
+    }
+    Output("SVDBatched passed");
+
+    // Hermitian eigensolvers (the side-by-side eigenvectors of each member
+    // occupy a block of n columns)
+    Matrix<Field> HermSide;
+    Gaussian( HermSide, n, batchSize*n );
+    auto HermMembers = LockedBatchView( batchSize, HermSide );
+    vector<Matrix<Field>> HermInputs( batchSize ), HermVecInputs( batchSize );
+    for( Int b=0; b<batchSize; ++b )
+    {
+        HermInputs[b] = HermMembers[b];
+        HermVecInputs[b] = HermMembers[b];
+    }
+    Matrix<Field> HermVecSide( HermSide );
+    vector<Matrix<Real>> wHerm, wHermVec;
+    vector<Matrix<Field>> QHerm;
+    Matrix<Real> wHermSide, wHermVecSide;
+    Matrix<Field> QHermSide;
+    vector<Matrix<Field>> HermRefs( HermInputs );
+    HermitianEigBatched( LOWER, HermInputs, wHerm );
+    HermitianEigBatched( LOWER, HermVecInputs, wHermVec, QHerm );
+    HermitianEigBatched( LOWER, batchSize, HermSide, wHermSide );
+    HermitianEigBatched
+    ( LOWER, batchSize, HermVecSide, wHermVecSide, QHermSide );
+    auto QHermFromSide = LockedBatchView( batchSize, QHermSide );
+    for( Int b=0; b<batchSize; ++b )
+    {
+        Matrix<Field> AMember( HermRefs[b] );
+        Matrix<Real> wRef;
+        HermitianEig( LOWER, AMember, wRef );
+        AMember = HermRefs[b];
+        Matrix<Real> wVecRef;
+        Matrix<Field> QRef;
+        HermitianEig( LOWER, AMember, wVecRef, QRef );
+        Matrix<Real> wSideb( wHermSide( ALL, IR(b) ) ),
+                     wVecSideb( wHermVecSide( ALL, IR(b) ) );
+        Matrix<Field> QSideb( QHermFromSide[b] );
+        CheckMember( "HermitianEigBatched", b, wHerm[b], wRef );
+        CheckMember( "HermitianEigBatched", b, wHermVec[b], wVecRef );
+        CheckMember( "HermitianEigBatched", b, QHerm[b], QRef );
+        CheckMember( "Side-by-side HermitianEigBatched", b, wSideb, wRef );
+        CheckMember
+        ( "Side-by-side HermitianEigBatched", b, wVecSideb, wVecRef );
+        CheckMember( "Side-by-side HermitianEigBatched", b, QSideb, QRef );
+    }
+
+    // An index subset shrinks the side-by-side eigenvalues to one column of
+    // (upperIndex-lowerIndex+1) entries per member, whereas a value range
+    // could produce a different number of eigenvalues for each member
+    HermitianEigCtrl<Field> subsetCtrl;
+    subsetCtrl.tridiagEigCtrl.subset.indexSubset = true;
+    subsetCtrl.tridiagEigCtrl.subset.lowerIndex = 1;
+    subsetCtrl.tridiagEigCtrl.subset.upperIndex = n-2;
+    Matrix<Field> HermSubsetSide;
+    Gaussian( HermSubsetSide, n, batchSize*n );
+    const Matrix<Field> HermSubsetInput( HermSubsetSide );
+    Matrix<Real> wSubsetSide;
+    HermitianEigBatched
+    ( LOWER, batchSize, HermSubsetSide, wSubsetSide, subsetCtrl );
+    if( wSubsetSide.Height() != n-2 || wSubsetSide.Width() != batchSize )
+        LogicError("Side-by-side index subsets had the wrong dimensions");
+    auto HermSubsetMembers = LockedBatchView( batchSize, HermSubsetInput );
+    for( Int b=0; b<batchSize; ++b )
+    {
+        Matrix<Field> AMember( HermSubsetMembers[b] );
+        Matrix<Real> wRef;
+        HermitianEig( LOWER, AMember, wRef, subsetCtrl );
+        Matrix<Real> wSideb( wSubsetSide( ALL, IR(b) ) );
+        CheckMember
+        ( "Side-by-side HermitianEigBatched subset", b, wSideb, wRef );
+    }
+    HermitianEigCtrl<Field> rangeCtrl;
+    rangeCtrl.tridiagEigCtrl.subset.rangeSubset = true;
+    rangeCtrl.tridiagEigCtrl.subset.lowerBound = Real(-1);
+    rangeCtrl.tridiagEigCtrl.subset.upperBound = Real(1);
+    bool caught = false;
+    try
+    { HermitianEigBatched
+      ( LOWER, batchSize, HermSubsetSide, wSubsetSide, rangeCtrl ); }
+    catch( std::exception& ) { caught = true; }
+    if( !caught )
+        LogicError("Side-by-side value-range subsets were not rejected");
+    Output("HermitianEigBatched passed");
+
+    // Schur decompositions
+    Matrix<Field> SchurSide;
+    Gaussian( SchurSide, n, batchSize*n );
+    auto SchurMembers = LockedBatchView( batchSize, SchurSide );
+    vector<Matrix<Field>> SchurInputs( batchSize ), SchurVecInputs( batchSize );
+    for( Int b=0; b<batchSize; ++b )
+    {
+        SchurInputs[b] = SchurMembers[b];
+        SchurVecInputs[b] = SchurMembers[b];
+    }
+    const vector<Matrix<Field>> SchurRefs( SchurInputs );
+    Matrix<Field> SchurVecSide( SchurSide );
+    vector<Matrix<Complex<Real>>> wSchur, wSchurVec;
+    vector<Matrix<Field>> QSchur;
+    Matrix<Complex<Real>> wSchurSide, wSchurVecSide;
+    Matrix<Field> QSchurSide;
+    SchurBatched( SchurInputs, wSchur );
+    SchurBatched( SchurVecInputs, wSchurVec, QSchur );
+    SchurBatched( batchSize, SchurSide, wSchurSide );
+    SchurBatched( batchSize, SchurVecSide, wSchurVecSide, QSchurSide );
+    auto TFromSide = LockedBatchView( batchSize, SchurSide );
+    auto TVecFromSide = LockedBatchView( batchSize, SchurVecSide );
+    auto QSchurFromSide = LockedBatchView( batchSize, QSchurSide );
+    for( Int b=0; b<batchSize; ++b )
+    {
+        Matrix<Field> TRef( SchurRefs[b] );
+        Matrix<Complex<Real>> wRef;
+        Schur( TRef, wRef );
+        Matrix<Field> TVecRef( SchurRefs[b] ), QRef;
+        Matrix<Complex<Real>> wVecRef;
+        Schur( TVecRef, wVecRef, QRef );
+        Matrix<Complex<Real>> wSideb( wSchurSide( ALL, IR(b) ) ),
+                              wVecSideb( wSchurVecSide( ALL, IR(b) ) );
+        Matrix<Field> TSideb( TFromSide[b] ), TVecSideb( TVecFromSide[b] ),
+                      QSideb( QSchurFromSide[b] );
+        CheckMember( "SchurBatched", b, SchurInputs[b], TRef );
+        CheckMember( "SchurBatched", b, wSchur[b], wRef );
+        CheckMember( "SchurBatched", b, SchurVecInputs[b], TVecRef );
+        CheckMember( "SchurBatched", b, wSchurVec[b], wVecRef );
+        CheckMember( "SchurBatched", b, QSchur[b], QRef );
+        CheckMember( "Side-by-side SchurBatched", b, TSideb, TRef );
+        CheckMember( "Side-by-side SchurBatched", b, wSideb, wRef );
+        CheckMember( "Side-by-side SchurBatched", b, TVecSideb, TVecRef );
+        CheckMember( "Side-by-side SchurBatched", b, wVecSideb, wVecRef );
+        CheckMember( "Side-by-side SchurBatched", b, QSideb, QRef );
+    }
+    Output("SchurBatched passed");
+
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int batchSize = Input("--batchSize","number of matrices",50);
+        const Int n = Input("--n","size of each matrix",8);
+        const Int k = Input("--k","inner dimension / number of RHS",5);
+        ProcessInput();
+        PrintInputReport();
+
+        TestBatched<float>( batchSize, n, k );
+        TestBatched<double>( batchSize, n, k );
+        TestBatched<Complex<double>>( batchSize, n, k );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,113 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the results of the native block-cyclic algorithms against those of
+// their element-wise counterparts
+
+template<typename Field>
+void Compare
+( const DistMatrix<Field,MC,MR,BLOCK>& ABlock,
+  const DistMatrix<Field>& AElem, const string& label )
+{
+    typedef Base<Field> Real;
+    DistMatrix<Field> E( ABlock );
+    E -= AElem;
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( AElem );
+    OutputFromRoot(AElem.Grid().Comm(),label,": || ABlock - AElem ||_F / "
+      "|| AElem ||_F = ",relError);
+    if( relError > AElem.Height()*limits::Epsilon<Real>()*100 )
+        LogicError("Relative error was unacceptably large");
+}
+
+template<typename Field>
+void TestBlockCyclic( Int n, Int mb, Int nb, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    DistMatrix<Field> AElem(g), BElem(g), CElem(g);
+    Uniform( AElem, n, n );
+    Uniform( BElem, n, n );
+    Uniform( CElem, n, n );
+    ShiftDiagonal( AElem, Field(n) );
+
+    DistMatrix<Field,MC,MR,BLOCK> A(g,mb,nb), B(g,mb,nb), C(g,mb,nb);
+    A = AElem;
+
+    for( Orientation orientA : { NORMAL, TRANSPOSE } )
+    {
+        for( Orientation orientB : { NORMAL, ADJOINT } )
+        {
+            B = BElem;
+            C = CElem;
+            auto DElem( CElem );
+            Gemm( orientA, orientB, Field(2), AElem, BElem, Field(-1), DElem );
+            Gemm( orientA, orientB, Field(2), A, B, Field(-1), C );
+            Compare( C, DElem, "Gemm" );
+        }
+    }
+
+    for( LeftOrRight side : { LEFT, RIGHT } )
+    {
+        for( UpperOrLower uplo : { LOWER, UPPER } )
+        {
+            for( Orientation orient : { NORMAL, ADJOINT } )
+            {
+                B = BElem;
+                auto XElem( BElem );
+                Trsm( side, uplo, orient, NON_UNIT, Field(3), AElem, XElem );
+                Trsm( side, uplo, orient, NON_UNIT, Field(3), A, B );
+                Compare( B, XElem, "Trsm" );
+            }
+        }
+    }
+
+    for( UpperOrLower uplo : { LOWER, UPPER } )
+    {
+        DistMatrix<Field> HElem(g);
+        Herk( uplo, ADJOINT, Base<Field>(1), BElem, HElem );
+        ShiftDiagonal( HElem, Field(n) );
+        A = HElem;
+        Cholesky( uplo, HElem );
+        Cholesky( uplo, A );
+        Compare( A, HElem, "Cholesky" );
+    }
+
+    DistPermutation PElem(g), P(g);
+    auto LUElem( BElem );
+    A = BElem;
+    LU( LUElem, PElem );
+    LU( A, P );
+    Compare( A, LUElem, "LU" );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const Int n = Input("--n","size of matrices",100);
+        const Int mb = Input("--blockHeight","height of dist block",16);
+        const Int nb = Input("--blockWidth","width of dist block",16);
+        ProcessInput();
+        PrintInputReport();
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const Grid g( comm, gridHeight );
+        TestBlockCyclic<double>( n, mb, nb, g );
+        TestBlockCyclic<Complex<double>>( n, mb, nb, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
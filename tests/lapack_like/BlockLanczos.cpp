@@ -0,0 +1,129 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestBlockLanczos
+( Int nx,
+  Int ny,
+  Int numEigs,
+  const BlockLanczosCtrl<Base<Field>>& ctrl,
+  bool matrixFree,
+  const Grid& grid )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+
+    const Int n = nx*ny;
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, nx, ny );
+
+    Timer timer;
+    OutputFromRoot(grid.Comm(),"Computing ",numEigs," extremal eigenpairs...");
+    timer.Start();
+    Matrix<Real> w;
+    DistMultiVec<Field> X(grid);
+    Int numRestarts;
+    if( matrixFree )
+    {
+        // Only access A through its action
+        auto applyA =
+          [&]( Orientation orientation,
+               Field alpha, const DistMultiVec<Field>& V,
+               Field beta,        DistMultiVec<Field>& W )
+          { Multiply( orientation, alpha, A, V, beta, W ); };
+        const DistLinearOperator<Field> AOp( n, n, grid, applyA );
+        numRestarts = BlockLanczosEig( AOp, w, X, numEigs, ctrl );
+    }
+    else
+        numRestarts = BlockLanczosEig( A, w, X, numEigs, ctrl );
+    timer.Stop();
+    OutputFromRoot
+    (grid.Comm(),timer.Partial()," seconds and ",numRestarts," restarts");
+    if( ctrl.progress )
+        Print( w, "w" );
+
+    // Check the residual A X - X diag(w)
+    DistMultiVec<Field> R(grid);
+    Zeros( R, n, numEigs );
+    Multiply( NORMAL, Field(1), A, X, Field(0), R );
+    auto& RLoc = R.Matrix();
+    const auto& XLoc = X.LockedMatrix();
+    for( Int j=0; j<numEigs; ++j )
+        for( Int iLoc=0; iLoc<XLoc.Height(); ++iLoc )
+            RLoc(iLoc,j) -= w(j)*XLoc(iLoc,j);
+    const Real residNorm = FrobeniusNorm( R );
+    const Real wMax = MaxNorm( w );
+    const Real relResid = residNorm / wMax;
+
+    // Check the orthonormality of X
+    Matrix<Field> Z;
+    Gemm( ADJOINT, NORMAL, Field(1), XLoc, XLoc, Z );
+    AllReduce( Z, grid.Comm() );
+    ShiftDiagonal( Z, Field(-1) );
+    const Real orthogError = FrobeniusNorm( Z );
+    OutputFromRoot
+    (grid.Comm(),
+     "|| A X - X diag(w) ||_F / || w ||_max = ",relResid,"\n",Indent(),
+     "|| X^H X - I ||_F = ",orthogError);
+    if( relResid > 10*Sqrt(Real(numEigs))*ctrl.tol )
+        LogicError("Relative residual was unacceptably large");
+    if( orthogError > numEigs*Sqrt(eps) )
+        LogicError("Eigenvectors were not sufficiently orthonormal");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int nx = Input("--nx","first grid dimension",20);
+        const Int ny = Input("--ny","second grid dimension",20);
+        const Int numEigs = Input("--numEigs","number of eigenpairs",5);
+        const Int blockSize = Input("--blockSize","Lanczos block size",4);
+        const Int maxBlocks =
+          Input("--maxBlocks","max number of blocks before restart",10);
+        const Int maxRestarts =
+          Input("--maxRestarts","max number of restarts",500);
+        const bool largest = Input("--largest","largest eigenvalues?",true);
+        const bool matrixFree =
+          Input("--matrixFree","use a matrix-free operator?",false);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+
+        const Grid grid( comm );
+
+        BlockLanczosCtrl<float> ctrlFloat;
+        ctrlFloat.blockSize = blockSize;
+        ctrlFloat.maxBlocks = maxBlocks;
+        ctrlFloat.maxRestarts = maxRestarts;
+        ctrlFloat.largest = largest;
+        ctrlFloat.progress = progress;
+        TestBlockLanczos<float>
+        ( nx, ny, numEigs, ctrlFloat, matrixFree, grid );
+
+        BlockLanczosCtrl<double> ctrlDouble;
+        ctrlDouble.blockSize = blockSize;
+        ctrlDouble.maxBlocks = maxBlocks;
+        ctrlDouble.maxRestarts = maxRestarts;
+        ctrlDouble.largest = largest;
+        ctrlDouble.progress = progress;
+        TestBlockLanczos<double>
+        ( nx, ny, numEigs, ctrlDouble, matrixFree, grid );
+        TestBlockLanczos<Complex<double>>
+        ( nx, ny, numEigs, ctrlDouble, matrixFree, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
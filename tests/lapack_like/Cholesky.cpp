@@ -85,6 +85,7 @@ template<typename F>
 void TestSequentialCholesky
 ( UpperOrLower uplo,
   bool pivot,
+  bool tiled,
   Int m,
   bool print,
   bool printDiag,
@@ -106,6 +107,8 @@ void TestSequentialCholesky
     timer.Start();
     if( pivot )
         Cholesky( uplo, A, p );
+    else if( tiled )
+        CholeskyTiled( uplo, A );
     else
         Cholesky( uplo, A );
     const double runTime = timer.Stop();
@@ -139,7 +142,9 @@ void TestCholesky
   bool print,
   bool printDiag,
   bool correctness,
-  bool scalapack )
+  bool scalapack,
+  Int lookahead,
+  bool packed )
 {
     OutputFromRoot(g.Comm(),"Testing distributed Cholesky with ",TypeName<F>());
     PushIndent();
@@ -164,8 +169,15 @@ void TestCholesky
     timer.Start();
     if( pivot )
         Cholesky( uplo, A, p );
+    else if( packed )
+    {
+        DistPackedMatrix<F> APacked(g);
+        Pack( A, APacked );
+        Cholesky( APacked );
+        Unpack( APacked, A );
+    }
     else
-        Cholesky( uplo, A, scalapack );
+        Cholesky( uplo, A, scalapack, lookahead );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops = 1./3.*Pow(double(m),3.)/(1.e9*runTime);
@@ -208,6 +220,11 @@ main( int argc, char* argv[] )
         const bool print = Input("--print","print matrices?",false);
         const bool printDiag = Input("--printDiag","print diag of fact?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
+        const bool tiled =
+          Input("--tiled","use task-based tiled sequential Cholesky?",false);
+        const Int lookahead = Input("--lookahead","panel lookahead depth",0);
+        const bool packed =
+          Input("--packed","factor in packed lower storage?",false);
 #ifdef EL_HAVE_SCALAPACK
         const bool scalapack = Input("--scalapack","test ScaLAPACK?",false);
 #else
@@ -227,7 +244,8 @@ main( int argc, char* argv[] )
             gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
         const GridOrder order = colMajor ? COLUMN_MAJOR : ROW_MAJOR;
         const Grid g( comm, gridHeight, order );
-        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        const UpperOrLower uplo =
+          ( packed ? LOWER : CharToUpperOrLower( uploChar ) );
         SetBlocksize( nb );
 
         ComplainIfDebug();
@@ -235,86 +253,86 @@ main( int argc, char* argv[] )
         if( sequential && mpi::Rank(comm) == 0 )
         {
             TestSequentialCholesky<float>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
             TestSequentialCholesky<Complex<float>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
             TestSequentialCholesky<double>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
             TestSequentialCholesky<Complex<double>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
 
 #ifdef EL_HAVE_QD
             TestSequentialCholesky<DoubleDouble>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
             TestSequentialCholesky<QuadDouble>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
 
             TestSequentialCholesky<Complex<DoubleDouble>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
             TestSequentialCholesky<Complex<QuadDouble>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
 #endif
 
 #ifdef EL_HAVE_QUAD
             TestSequentialCholesky<Quad>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
             TestSequentialCholesky<Complex<Quad>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
 #endif
 
 #ifdef EL_HAVE_MPC
             TestSequentialCholesky<BigFloat>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
             TestSequentialCholesky<Complex<BigFloat>>
-            ( uplo, pivot, m, print, printDiag, correctness );
+            ( uplo, pivot, tiled, m, print, printDiag, correctness );
 #endif
         }
 
         TestCholesky<float>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead, packed );
         TestCholesky<Complex<float>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead, packed );
         TestCholesky<double>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead, packed );
         TestCholesky<Complex<double>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead, packed );
 
 #ifdef EL_HAVE_QD
         TestCholesky<DoubleDouble>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead, packed );
         TestCholesky<QuadDouble>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead, packed );
 
         TestCholesky<Complex<DoubleDouble>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead, packed );
         TestCholesky<Complex<QuadDouble>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead, packed );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestCholesky<Quad>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead, packed );
         TestCholesky<Complex<Quad>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead, packed );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestCholesky<BigFloat>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead, packed );
         TestCholesky<Complex<BigFloat>>
         ( g, uplo, pivot, m, nbLocal,
-          print, printDiag, correctness, scalapack );
+          print, printDiag, correctness, scalapack, lookahead, packed );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
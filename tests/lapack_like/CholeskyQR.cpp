@@ -58,6 +58,7 @@ void TestQR
 ( const Grid& g,
   Int m, 
   Int n,
+  Int variant,
   bool testCorrectness,
   bool print )
 {
@@ -75,7 +76,12 @@ void TestQR
     mpi::Barrier( g.Comm() );
     Timer timer;
     timer.Start();
-    qr::Cholesky( Q, R );
+    if( variant == 3 )
+        qr::ShiftedCholeskyQR3( Q, R );
+    else if( variant == 2 )
+        qr::CholeskyQR2( Q, R );
+    else
+        qr::Cholesky( Q, R );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double mD = double(m);
@@ -104,6 +110,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int variant =
+          Input("--variant","1: CholeskyQR, 2: CholeskyQR2, 3: shifted CQR3",1);
         const bool testCorrectness = Input
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -122,25 +130,25 @@ main( int argc, char* argv[] )
         SetBlocksize( nb );
         ComplainIfDebug();
 
-        TestQR<float>( g, m, n, testCorrectness, print );
-        TestQR<Complex<float>>( g, m, n, testCorrectness, print );
+        TestQR<float>( g, m, n, variant, testCorrectness, print );
+        TestQR<Complex<float>>( g, m, n, variant, testCorrectness, print );
 
-        TestQR<double>( g, m, n, testCorrectness, print );
-        TestQR<Complex<double>>( g, m, n, testCorrectness, print );
+        TestQR<double>( g, m, n, variant, testCorrectness, print );
+        TestQR<Complex<double>>( g, m, n, variant, testCorrectness, print );
 
 #ifdef EL_HAVE_QD
-        TestQR<DoubleDouble>( g, m, n, testCorrectness, print );
-        TestQR<QuadDouble>( g, m, n, testCorrectness, print );
+        TestQR<DoubleDouble>( g, m, n, variant, testCorrectness, print );
+        TestQR<QuadDouble>( g, m, n, variant, testCorrectness, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
-        TestQR<Quad>( g, m, n, testCorrectness, print );
-        TestQR<Complex<Quad>>( g, m, n, testCorrectness, print );
+        TestQR<Quad>( g, m, n, variant, testCorrectness, print );
+        TestQR<Complex<Quad>>( g, m, n, variant, testCorrectness, print );
 #endif
 
 #ifdef EL_HAVE_MPC
-        TestQR<BigFloat>( g, m, n, testCorrectness, print );
-        TestQR<Complex<BigFloat>>( g, m, n, testCorrectness, print );
+        TestQR<BigFloat>( g, m, n, variant, testCorrectness, print );
+        TestQR<Complex<BigFloat>>( g, m, n, variant, testCorrectness, print );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -0,0 +1,175 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <random>
+using namespace El;
+
+// Apply swap sequences (with implicit and explicit origins and a nonzero
+// offset) and explicit permutations through DistPermutation to the rows and
+// columns of matrices in several distributions, including those whose
+// permuted dimension is not distributed and which are therefore permuted in
+// place, and require exact agreement with the sequential Permutation, which
+// applies one swap at a time. Each permutation is applied repeatedly (reusing
+// its cached composition) and again after appending further swaps.
+
+template<typename T>
+void CheckEqual
+( const string& label,
+  const AbstractDistMatrix<T>& A, const Matrix<T>& ARef )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    Matrix<T> E( A_STAR_STAR.Matrix() );
+    E -= ARef;
+    if( MaxNorm( E ) != Base<T>(0) )
+        LogicError(label," disagreed with the sequential permutation");
+}
+
+// Apply P (and then its inverse) to the rows and columns of a copy of A in
+// the distribution of 'prototype' and compare with PSeq
+template<typename T,class DistType>
+void TestApplications
+( const string& label,
+  const DistPermutation& P,
+  const Permutation& PSeq,
+  const DistMatrix<T,STAR,STAR>& A,
+  Int offset,
+  const DistType& prototype )
+{
+    Matrix<T> ARef( A.LockedMatrix() );
+    DistType B( prototype );
+    B = A;
+
+    // The second application reuses the cached metadata
+    for( Int rep=0; rep<2; ++rep )
+    {
+        P.PermuteRows( B, offset );
+        PSeq.PermuteRows( ARef, offset );
+        CheckEqual( label+" PermuteRows", B, ARef );
+        P.PermuteCols( B, offset );
+        PSeq.PermuteCols( ARef, offset );
+        CheckEqual( label+" PermuteCols", B, ARef );
+    }
+    P.InversePermuteCols( B, offset );
+    PSeq.InversePermuteCols( ARef, offset );
+    CheckEqual( label+" InversePermuteCols", B, ARef );
+    P.InversePermuteRows( B, offset );
+    PSeq.InversePermuteRows( ARef, offset );
+    CheckEqual( label+" InversePermuteRows", B, ARef );
+}
+
+template<typename T>
+void TestDistributions
+( const string& label,
+  const DistPermutation& P,
+  const Permutation& PSeq,
+  const DistMatrix<T,STAR,STAR>& A,
+  Int offset )
+{
+    const Grid& grid = A.Grid();
+    TestApplications( label+" [MC,MR]", P, PSeq, A, offset,
+      DistMatrix<T,MC,MR>(grid) );
+    // The rows of [STAR,VR] and the columns of [VC,STAR] are local
+    TestApplications( label+" [VC,STAR]", P, PSeq, A, offset,
+      DistMatrix<T,VC,STAR>(grid) );
+    TestApplications( label+" [STAR,VR]", P, PSeq, A, offset,
+      DistMatrix<T,STAR,VR>(grid) );
+    TestApplications( label+" [STAR,STAR]", P, PSeq, A, offset,
+      DistMatrix<T,STAR,STAR>(grid) );
+    OutputFromRoot(grid.Comm(),label," passed");
+}
+
+// Every process draws the same swaps, which each move index j to a random
+// index in [j,size) or, if 'explicitOrigins', swap two random indices
+void AppendSwaps
+( std::mt19937& gen, Int firstSwap, Int numSwaps, Int size,
+  bool explicitOrigins, DistPermutation& P, Permutation& PSeq )
+{
+    for( Int j=firstSwap; j<firstSwap+numSwaps; ++j )
+    {
+        Int origin = j % size;
+        std::uniform_int_distribution<Int> destDist(origin,size-1);
+        Int dest = destDist(gen);
+        if( explicitOrigins )
+        {
+            std::uniform_int_distribution<Int> indexDist(0,size-1);
+            origin = indexDist(gen);
+            dest = indexDist(gen);
+        }
+        P.Swap( origin, dest );
+        PSeq.Swap( origin, dest );
+    }
+}
+
+template<typename T>
+void TestDistPermutation( const Grid& grid, Int n, Int offset )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<T>());
+    PushIndent();
+    DistMatrix<T,STAR,STAR> A(grid);
+    Uniform( A, n, n );
+    const Int size = n - offset;
+    const Int numSwaps = size / 2;
+    std::mt19937 gen( 41 );
+
+    for( const bool explicitOrigins : { false, true } )
+    {
+        const string kind =
+          string(explicitOrigins ? "Explicit" : "Implicit") + "-origin swaps";
+        DistPermutation P(grid);
+        Permutation PSeq;
+        P.MakeIdentity( size );
+        PSeq.MakeIdentity( size );
+        P.ReserveSwaps( 2*numSwaps );
+        PSeq.ReserveSwaps( 2*numSwaps );
+        AppendSwaps( gen, 0, numSwaps, size, explicitOrigins, P, PSeq );
+        if( !P.IsSwapSequence() )
+            LogicError("The permutation was not a swap sequence");
+        TestDistributions( kind, P, PSeq, A, Int(0) );
+        TestDistributions( kind+" with an offset", P, PSeq, A, offset );
+
+        // Appending swaps must invalidate the cached compositions
+        AppendSwaps
+        ( gen, numSwaps, numSwaps, size, explicitOrigins, P, PSeq );
+        TestDistributions( kind+" after appending", P, PSeq, A, offset );
+    }
+
+    // Exceeding the reserved number of swaps forms an explicit permutation
+    DistPermutation P(grid);
+    Permutation PSeq;
+    P.MakeIdentity( n );
+    PSeq.MakeIdentity( n );
+    P.ReserveSwaps( 1 );
+    PSeq.ReserveSwaps( 1 );
+    AppendSwaps( gen, 0, n, n, false, P, PSeq );
+    if( P.IsSwapSequence() )
+        LogicError("The permutation was not made explicit");
+    TestDistributions( "Explicit permutation", P, PSeq, A, Int(0) );
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of matrix",97);
+        const Int offset = Input("--offset","offset of the swaps",13);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestDistPermutation<double>( grid, n, offset );
+        TestDistPermutation<Complex<float>>( grid, n, offset );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the distributed sample sort and selection against their
+// sequential counterparts
+template<typename Real>
+void TestSort( Int m, Int n, const Grid& g )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Real>());
+    DistMatrix<Real> X(g);
+    Uniform( X, m, n );
+    // Introduce ties
+    Round( X );
+
+    for( SortType sort : { ASCENDING, DESCENDING } )
+    {
+        DistMatrix<Real,STAR,STAR> XSeq( X );
+        auto XDist( X );
+        Sort( XSeq, sort );
+        Sort( XDist, sort );
+        DistMatrix<Real,STAR,STAR> XDist_STAR_STAR( XDist );
+        XDist_STAR_STAR -= XSeq;
+        if( FrobeniusNorm( XDist_STAR_STAR ) != Real(0) )
+            LogicError("Distributed Sort did not match");
+
+        auto x = X( ALL, IR(0) );
+        DistMatrix<Real,STAR,STAR> x_STAR_STAR( x );
+        auto seqPairs = TaggedSort( x_STAR_STAR, sort, true );
+        auto distPairs = TaggedSort( x, sort );
+        for( Int i=0; i<m; ++i )
+            if( seqPairs[i].value != distPairs[i].value ||
+                seqPairs[i].index != distPairs[i].index )
+                LogicError("Distributed TaggedSort did not match");
+    }
+
+    auto x = X( ALL, IR(0) );
+    DistMatrix<Real,STAR,STAR> x_STAR_STAR( x );
+    for( Int k : { Int(0), m/3, m/2, m-1 } )
+    {
+        const auto seqStat = OrderStatistic( x_STAR_STAR, k );
+        const auto distStat = OrderStatistic( x, k );
+        if( seqStat.value != distStat.value || seqStat.index != distStat.index )
+            LogicError("Distributed OrderStatistic did not match");
+    }
+    const auto median = Median( x );
+    OutputFromRoot
+    (g.Comm(),"Median was ",median.value," at index ",median.index);
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",1000);
+        const Int n = Input("--n","width of matrix",3);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestSort<float>( m, n, g );
+        TestSort<double>( m, n, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
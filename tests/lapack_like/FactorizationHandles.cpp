@@ -0,0 +1,122 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void CheckSolution
+( const string& label,
+  const DistMatrix<Field>& X, const DistMatrix<Field>& XRef )
+{
+    typedef Base<Field> Real;
+    DistMatrix<Field> E( XRef );
+    E -= X;
+    const Real relError = FrobeniusNorm(E) / FrobeniusNorm(XRef);
+    OutputFromRoot(X.Grid().Comm(),label,": ||X - XRef||_F / ||XRef||_F = ",
+      relError);
+    if( relError > Sqrt(limits::Epsilon<Real>()) )
+        LogicError(label," was inaccurate");
+}
+
+template<typename Field>
+void TestHandles( Int n, Int numRHS, const Grid& g )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+
+    DistMatrix<Field> A(g), AHPD(g), ASymm(g);
+    Gaussian( A, n, n );
+    ShiftDiagonal( A, Field(n) );
+    HermitianUniformSpectrum( AHPD, n, Real(1), Real(10) );
+    Gaussian( ASymm, n, n );
+    MakeSymmetric( LOWER, ASymm );
+    ShiftDiagonal( ASymm, Field(n) );
+
+    DistLUFactorization<Field> luFact;
+    luFact.Factor( A );
+    DistCholeskyFactorization<Field> cholFact;
+    cholFact.Factor( LOWER, AHPD );
+    DistLDLFactorization<Field> ldlFact;
+    ldlFact.Factor( ASymm, false );
+
+    // Solve a sequence of right-hand sides, both in place and through the
+    // replayed redistributions
+    for( Int k=0; k<2; ++k )
+    {
+        DistMatrix<Field> B(g), XRef(g);
+        DistMatrix<Field,VC,STAR> BVC(g);
+        Uniform( B, n, numRHS );
+
+        XRef = B;
+        LinearSolve( A, XRef );
+        auto X( B );
+        luFact.Solve( X );
+        CheckSolution( "LU", X, XRef );
+        BVC = B;
+        luFact.Solve( BVC );
+        X = BVC;
+        CheckSolution( "LU [VC,* ]", X, XRef );
+
+        XRef = B;
+        HPDSolve( LOWER, NORMAL, AHPD, XRef );
+        BVC = B;
+        cholFact.Solve( BVC );
+        X = BVC;
+        CheckSolution( "Cholesky [VC,* ]", X, XRef );
+
+        XRef = B;
+        SymmetricSolve( LOWER, NORMAL, ASymm, XRef );
+        BVC = B;
+        ldlFact.Solve( BVC );
+        X = BVC;
+        CheckSolution( "LDL [VC,* ]", X, XRef );
+    }
+
+    // Low-rank updates
+    DistMatrix<Field> U(g), V(g), B(g), XRef(g);
+    Uniform( U, n, 2 );
+    Uniform( V, n, 2 );
+    Uniform( B, n, numRHS );
+    luFact.Update( U, V );
+    Gemm( NORMAL, ADJOINT, Field(1), U, V, Field(1), A );
+    XRef = B;
+    LinearSolve( A, XRef );
+    auto X( B );
+    luFact.Solve( X );
+    CheckSolution( "Updated LU", X, XRef );
+
+    cholFact.Update( Real(1), U );
+    Herk( LOWER, NORMAL, Real(1), U, Real(1), AHPD );
+    XRef = B;
+    HPDSolve( LOWER, NORMAL, AHPD, XRef );
+    X = B;
+    cholFact.Solve( X );
+    CheckSolution( "Updated Cholesky", X, XRef );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","matrix size",100);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",5);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestHandles<double>( n, numRHS, g );
+        TestHandles<Complex<double>>( n, numRHS, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
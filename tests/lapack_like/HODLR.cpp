@@ -0,0 +1,88 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestHODLR
+( Int n,
+  Int numRHS,
+  const HODLRCtrl<Base<Field>>& ctrl,
+  const Grid& grid )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+
+    // A shifted Cauchy kernel over equispaced points, which is Hermitian
+    // positive-definite and has numerically low-rank off-diagonal blocks
+    auto generator =
+      [&]( Int i, Int j )
+      {
+          const Real dist = Real(i-j) / Real(n);
+          const Real value = Real(1) / (Real(1)+Real(100)*dist*dist);
+          return Field( i == j ? value+Real(1) : value );
+      };
+
+    Timer timer;
+    timer.Start();
+    DistHODLR<Field> A( n, generator, grid, ctrl );
+    OutputFromRoot(grid.Comm(),"Build: ",timer.Stop()," seconds");
+    OutputFromRoot
+    (grid.Comm(),"max rank: ",A.MaxRank(),", entries: ",A.NumEntries(),
+     " vs. ",n*n);
+
+    timer.Start();
+    A.Factor();
+    OutputFromRoot(grid.Comm(),"Factor: ",timer.Stop()," seconds");
+
+    DistMultiVec<Field> B(grid), X(grid);
+    Uniform( B, n, numRHS );
+    X = B;
+    timer.Start();
+    A.Solve( X );
+    OutputFromRoot(grid.Comm(),"Solve: ",timer.Stop()," seconds");
+
+    // Check || B - A X ||_F / || B ||_F
+    const Real frobB = FrobeniusNorm( B );
+    A.Multiply( Field(-1), X, Field(1), B );
+    const Real relResid = FrobeniusNorm( B ) / frobB;
+    OutputFromRoot(grid.Comm(),"|| B - A X ||_F / || B ||_F = ",relResid);
+    if( relResid > Sqrt(Real(n))*eps*100 )
+        LogicError("Relative residual was unacceptably large");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","height of matrix",1000);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",5);
+        const Int leafSize = Input("--leafSize","largest dense block",64);
+        const bool hermitian =
+          Input("--hermitian","exploit Hermiticity?",false);
+        ProcessInput();
+
+        const Grid grid( comm );
+        HODLRCtrl<float> ctrlFloat;
+        HODLRCtrl<double> ctrlDouble;
+        ctrlFloat.leafSize = ctrlDouble.leafSize = leafSize;
+        ctrlFloat.hermitian = ctrlDouble.hermitian = hermitian;
+
+        TestHODLR<float>( n, numRHS, ctrlFloat, grid );
+        TestHODLR<double>( n, numRHS, ctrlDouble, grid );
+        TestHODLR<Complex<double>>( n, numRHS, ctrlDouble, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -224,6 +224,9 @@ void TestSuite
     ctrl.tridiagEigCtrl.alg = ctrlDbl.tridiagEigCtrl.alg;
     ctrl.tridiagEigCtrl.subset = subset;
     ctrl.tridiagEigCtrl.progress = ctrlDbl.tridiagEigCtrl.progress;
+    ctrl.tridiagEigCtrl.numSlices = ctrlDbl.tridiagEigCtrl.numSlices;
+    ctrl.twoStage = ctrlDbl.twoStage;
+    ctrl.twoStageBandwidth = ctrlDbl.twoStageBandwidth;
 
     if( sequential && g.Rank() == 0 )
     {
@@ -301,6 +304,12 @@ main( int argc, char* argv[] )
         const bool testReal = Input("--testReal","test real matrices?",true);
         const bool testCpx = Input("--testCpx","test complex matrices?",true);
         const bool timeStages = Input("--timeStages","time stages?",true);
+        const bool twoStage =
+          Input("--twoStage","tridiagonalize through a band?",false);
+        const Int bandwidth =
+          Input("--bandwidth","two-stage bandwidth (0 for default)",0);
+        const Int numSlices =
+          Input("--numSlices","number of spectrum slices for subsets",1);
         ProcessInput();
         PrintInputReport();
 
@@ -338,12 +347,15 @@ main( int argc, char* argv[] )
         HermitianEigCtrl<double> ctrl;
         ctrl.timeStages = timeStages;
         ctrl.useScaLAPACK = useScaLAPACK;
+        ctrl.twoStage = twoStage;
+        ctrl.twoStageBandwidth = bandwidth;
         ctrl.tridiagCtrl.symvCtrl.bsize = nbLocal;
         ctrl.tridiagCtrl.symvCtrl.avoidTrmvBasedLocalSymv = avoidTrmv;
         ctrl.tridiagEigCtrl.sort = sort;
         ctrl.tridiagEigCtrl.alg = alg;
         ctrl.tridiagEigCtrl.subset = subset;
         ctrl.tridiagEigCtrl.progress = progress;
+        ctrl.tridiagEigCtrl.numSlices = numSlices;
 
         if( testReal )
         {
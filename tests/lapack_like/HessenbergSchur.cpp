@@ -305,6 +305,10 @@ int main( int argc, char* argv[] )
           Input
           ("--minMultiBulgeSize",
            "minimum size for using a multi-bulge algorithm",75);
+        const Int minSubgridAEDSize =
+          Input
+          ("--minSubgridAEDSize",
+           "minimum AED window size for using a subgrid",1000);
         const bool accumulate =
           Input("--accumulate","accumulate reflections?",true);
         const bool sortShifts =
@@ -322,6 +326,7 @@ int main( int argc, char* argv[] )
         HessenbergSchurCtrl ctrl;
         ctrl.alg = static_cast<HessenbergSchurAlg>(algInt);
         ctrl.minMultiBulgeSize = minMultiBulgeSize;
+        ctrl.minSubgridAEDSize = minSubgridAEDSize;
         ctrl.accumulateReflections = accumulate;
         ctrl.sortShifts = sortShifts;
         ctrl.progress = progress;
@@ -0,0 +1,221 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestCorrectness
+( const Matrix<Field>& A,
+  const Matrix<Field>& AOrig )
+{
+    typedef Base<Field> Real;
+    const Int m = AOrig.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = OneNorm( AOrig );
+    const Real oneNormAInv = OneNorm( A );
+
+    // Test I - inv(A) A
+    Matrix<Field> X;
+    Identity( X, m, m );
+    Gemm( NORMAL, NORMAL, Field(-1), A, AOrig, Field(1), X );
+    const Real relError = OneNorm( X ) / (eps*m*oneNormA*oneNormAInv);
+    Output("||I - inv(A) A||_1 / (eps m ||A||_1 ||inv(A)||_1) = ",relError);
+
+    // TODO: More rigorous failure condition
+    if( relError > Real(10) )
+        LogicError("Unacceptably large relative error");
+}
+
+template<typename Field>
+void TestCorrectness
+( const DistMatrix<Field>& A,
+  const DistMatrix<Field>& AOrig )
+{
+    typedef Base<Field> Real;
+    const Grid& g = A.Grid();
+    const Int m = AOrig.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = OneNorm( AOrig );
+    const Real oneNormAInv = OneNorm( A );
+
+    // Test I - inv(A) A
+    DistMatrix<Field> X(g);
+    Identity( X, m, m );
+    Gemm( NORMAL, NORMAL, Field(-1), A, AOrig, Field(1), X );
+    const Real relError = OneNorm( X ) / (eps*m*oneNormA*oneNormAInv);
+    OutputFromRoot
+    (g.Comm(),
+     "||I - inv(A) A||_1 / (eps m ||A||_1 ||inv(A)||_1) = ",relError);
+
+    // TODO: More rigorous failure condition
+    if( relError > Real(10) )
+        LogicError("Unacceptably large relative error");
+}
+
+template<typename Field>
+void TestInverse( Int m, bool gaussJordan, bool correctness, bool print )
+{
+    Output("Testing with ",TypeName<Field>());
+    PushIndent();
+
+    Matrix<Field> A, AOrig;
+    Uniform( A, m, m );
+    if( correctness )
+        AOrig = A;
+    if( print )
+        Print( A, "A" );
+
+    Output("Starting inversion...");
+    Timer timer;
+    timer.Start();
+    if( gaussJordan )
+        inverse::GaussJordan( A );
+    else
+        inverse::LUPartialPiv( A );
+    const double runTime = timer.Stop();
+    const double realGFlops = 2.*Pow(double(m),3.)/(1.e9*runTime);
+    const double gFlops = IsComplex<Field>::value ? 4*realGFlops : realGFlops;
+    Output("Time = ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( A, "A after inversion" );
+    if( correctness )
+        TestCorrectness( A, AOrig );
+    PopIndent();
+}
+
+template<typename Field>
+void TestInverse
+( const Grid& g, Int m, bool gaussJordan, bool correctness, bool print )
+{
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    DistMatrix<Field> A(g), AOrig(g);
+    Uniform( A, m, m );
+    if( correctness )
+        AOrig = A;
+    if( print )
+        Print( A, "A" );
+
+    OutputFromRoot(g.Comm(),"Starting inversion...");
+    mpi::Barrier( g.Comm() );
+    Timer timer;
+    timer.Start();
+    if( gaussJordan )
+        inverse::GaussJordan( A );
+    else
+        inverse::LUPartialPiv( A );
+    mpi::Barrier( g.Comm() );
+    const double runTime = timer.Stop();
+    const double realGFlops = 2.*Pow(double(m),3.)/(1.e9*runTime);
+    const double gFlops = IsComplex<Field>::value ? 4*realGFlops : realGFlops;
+    OutputFromRoot(g.Comm(),"Time = ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( A, "A after inversion" );
+    if( correctness )
+        TestCorrectness( A, AOrig );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        int gridHeight = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",100);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool gaussJordan =
+          Input("--gaussJordan","use Gauss-Jordan elimination?",true);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        const bool correctness =
+          Input("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+#ifdef EL_HAVE_MPC
+        const mpfr_prec_t prec = Input("--prec","MPFR precision",256);
+#endif
+        ProcessInput();
+        PrintInputReport();
+
+#ifdef EL_HAVE_MPC
+        mpfr::SetPrecision( prec );
+#endif
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::DefaultHeight( mpi::Size(comm) );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, gridHeight, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( sequential && mpi::Rank() == 0 )
+        {
+            TestInverse<float>( m, gaussJordan, correctness, print );
+            TestInverse<Complex<float>>( m, gaussJordan, correctness, print );
+
+            TestInverse<double>( m, gaussJordan, correctness, print );
+            TestInverse<Complex<double>>( m, gaussJordan, correctness, print );
+
+#ifdef EL_HAVE_QD
+            TestInverse<DoubleDouble>( m, gaussJordan, correctness, print );
+            TestInverse<QuadDouble>( m, gaussJordan, correctness, print );
+
+            TestInverse<Complex<DoubleDouble>>
+            ( m, gaussJordan, correctness, print );
+            TestInverse<Complex<QuadDouble>>
+            ( m, gaussJordan, correctness, print );
+#endif
+
+#ifdef EL_HAVE_QUAD
+            TestInverse<Quad>( m, gaussJordan, correctness, print );
+            TestInverse<Complex<Quad>>( m, gaussJordan, correctness, print );
+#endif
+
+#ifdef EL_HAVE_MPC
+            TestInverse<BigFloat>( m, gaussJordan, correctness, print );
+            TestInverse<Complex<BigFloat>>
+            ( m, gaussJordan, correctness, print );
+#endif
+        }
+
+        TestInverse<float>( g, m, gaussJordan, correctness, print );
+        TestInverse<Complex<float>>( g, m, gaussJordan, correctness, print );
+
+        TestInverse<double>( g, m, gaussJordan, correctness, print );
+        TestInverse<Complex<double>>( g, m, gaussJordan, correctness, print );
+
+#ifdef EL_HAVE_QD
+        TestInverse<DoubleDouble>( g, m, gaussJordan, correctness, print );
+        TestInverse<QuadDouble>( g, m, gaussJordan, correctness, print );
+
+        TestInverse<Complex<DoubleDouble>>
+        ( g, m, gaussJordan, correctness, print );
+        TestInverse<Complex<QuadDouble>>
+        ( g, m, gaussJordan, correctness, print );
+#endif
+
+#ifdef EL_HAVE_QUAD
+        TestInverse<Quad>( g, m, gaussJordan, correctness, print );
+        TestInverse<Complex<Quad>>( g, m, gaussJordan, correctness, print );
+#endif
+
+#ifdef EL_HAVE_MPC
+        TestInverse<BigFloat>( g, m, gaussJordan, correctness, print );
+        TestInverse<Complex<BigFloat>>
+        ( g, m, gaussJordan, correctness, print );
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -97,6 +97,7 @@ template<typename Field>
 void TestLDL
 ( Int m,
   bool conjugated,
+  LDLPivotType pivotType,
   Int nbLocal,
   bool correctness,
   bool print )
@@ -121,7 +122,7 @@ void TestLDL
     timer.Start();
     Matrix<Field> dSub;
     Permutation p;
-    LDL( A, dSub, p, conjugated );
+    LDL( A, dSub, p, conjugated, LDLPivotCtrl<Base<Field>>(pivotType) );
     const double runTime = timer.Stop();
     const double realGFlops = 1./3.*Pow(double(m),3.)/(1.e9*runTime);
     const double gFlops = IsComplex<Field>::value ? 4*realGFlops : realGFlops;
@@ -143,6 +144,7 @@ void TestLDL
 ( const Grid& grid,
   Int m,
   bool conjugated,
+  LDLPivotType pivotType,
   Int nbLocal,
   bool correctness,
   bool print )
@@ -168,7 +170,7 @@ void TestLDL
     timer.Start();
     DistMatrix<Field,MD,STAR> dSub(grid);
     DistPermutation p(grid);
-    LDL( A, dSub, p, conjugated );
+    LDL( A, dSub, p, conjugated, LDLPivotCtrl<Base<Field>>(pivotType) );
     mpi::Barrier( grid.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops = 1./3.*Pow(double(m),3.)/(1.e9*runTime);
@@ -200,6 +202,8 @@ main( int argc, char* argv[] )
         const Int nb = Input("--nb","algorithmic blocksize",96);
         const Int nbLocal = Input("--nbLocal","local blocksize",32);
         const bool conjugated = Input("--conjugate","conjugate LDL?",false);
+        const bool bounded =
+          Input("--bounded","bounded Bunch-Kaufman pivoting?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
         const bool correctness =
           Input("--correctness","test correctness?",true);
@@ -220,80 +224,82 @@ main( int argc, char* argv[] )
         const Grid grid( comm, gridHeight, order );
         SetBlocksize( nb );
         ComplainIfDebug();
+        const LDLPivotType pivotType =
+          bounded ? BUNCH_KAUFMAN_BOUNDED : BUNCH_KAUFMAN_A;
 
         if( sequential && mpi::Rank() == 0 )
         {
             TestLDL<float>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( m, conjugated, pivotType, nbLocal, correctness, print );
             TestLDL<Complex<float>>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( m, conjugated, pivotType, nbLocal, correctness, print );
 
             TestLDL<double>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( m, conjugated, pivotType, nbLocal, correctness, print );
             TestLDL<Complex<double>>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( m, conjugated, pivotType, nbLocal, correctness, print );
 
 #ifdef EL_HAVE_QD
             TestLDL<DoubleDouble>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( m, conjugated, pivotType, nbLocal, correctness, print );
             TestLDL<QuadDouble>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( m, conjugated, pivotType, nbLocal, correctness, print );
 
             TestLDL<Complex<DoubleDouble>>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( m, conjugated, pivotType, nbLocal, correctness, print );
             TestLDL<Complex<QuadDouble>>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( m, conjugated, pivotType, nbLocal, correctness, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
             TestLDL<Quad>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( m, conjugated, pivotType, nbLocal, correctness, print );
             TestLDL<Complex<Quad>>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( m, conjugated, pivotType, nbLocal, correctness, print );
 #endif
 
 #ifdef EL_HAVE_MPC
             TestLDL<BigFloat>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( m, conjugated, pivotType, nbLocal, correctness, print );
             TestLDL<Complex<BigFloat>>
-            ( m, conjugated, nbLocal, correctness, print );
+            ( m, conjugated, pivotType, nbLocal, correctness, print );
 #endif
         }
 
         TestLDL<float>
-        ( grid, m, conjugated, nbLocal, correctness, print );
+        ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
         TestLDL<Complex<float>>
-        ( grid, m, conjugated, nbLocal, correctness, print );
+        ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
 
         TestLDL<double>
-        ( grid, m, conjugated, nbLocal, correctness, print );
+        ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
         TestLDL<Complex<double>>
-        ( grid, m, conjugated, nbLocal, correctness, print );
+        ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
 
 #ifdef EL_HAVE_QD
         TestLDL<DoubleDouble>
-        ( grid, m, conjugated, nbLocal, correctness, print );
+        ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
         TestLDL<QuadDouble>
-        ( grid, m, conjugated, nbLocal, correctness, print );
+        ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
 
         TestLDL<Complex<DoubleDouble>>
-        ( grid, m, conjugated, nbLocal, correctness, print );
+        ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
         TestLDL<Complex<QuadDouble>>
-        ( grid, m, conjugated, nbLocal, correctness, print );
+        ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestLDL<Quad>
-        ( grid, m, conjugated, nbLocal, correctness, print );
+        ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
         TestLDL<Complex<Quad>>
-        ( grid, m, conjugated, nbLocal, correctness, print );
+        ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestLDL<BigFloat>
-        ( grid, m, conjugated, nbLocal, correctness, print );
+        ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
         TestLDL<Complex<BigFloat>>
-        ( grid, m, conjugated, nbLocal, correctness, print );
+        ( grid, m, conjugated, pivotType, nbLocal, correctness, print );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
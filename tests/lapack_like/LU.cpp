@@ -35,7 +35,7 @@ void TestCorrectness
     const Real oneNormY = OneNorm( Y );
     if( pivoting == 0 )
         lu::SolveAfter( NORMAL, A, Y );
-    else if( pivoting == 1 )
+    else if( pivoting == 1 || pivoting == 3 )
         lu::SolveAfter( NORMAL, A, P, Y );
     else
         lu::SolveAfter( NORMAL, A, P, Q, Y );
@@ -52,6 +52,16 @@ void TestCorrectness
     if( pivoting > 0 && relError > Real(100) )
         LogicError("Relative error was unacceptably large");
 
+    if( pivoting == 1 || pivoting == 3 )
+    {
+        // Compare the O(n^2) condition estimate against the explicit one
+        const Real condEst = lu::OneConditionEstimate( A, P, oneNormAOrig );
+        const Real cond = OneCondition( AOrig );
+        Output("kappa_1(A) estimate = ",condEst,", exact = ",cond);
+        if( condEst > 2*cond || 10*condEst < cond )
+            LogicError("Condition estimate was unacceptably inaccurate");
+    }
+
     PopIndent();
 }
 
@@ -82,7 +92,7 @@ void TestCorrectness
     const Real oneNormY = OneNorm( Y );
     if( pivoting == 0 )
         lu::SolveAfter( NORMAL, A, Y );
-    else if( pivoting == 1 )
+    else if( pivoting == 1 || pivoting == 3 )
         lu::SolveAfter( NORMAL, A, P, Y );
     else
         lu::SolveAfter( NORMAL, A, P, Q, Y );
@@ -100,6 +110,17 @@ void TestCorrectness
     if( pivoting > 0 && relError > Real(100) )
         LogicError("Relative error was unacceptably large");
 
+    if( pivoting == 1 || pivoting == 3 )
+    {
+        // Compare the O(n^2) condition estimate against the explicit one
+        const Real condEst = lu::OneConditionEstimate( A, P, oneNormAOrig );
+        const Real cond = OneCondition( AOrig );
+        OutputFromRoot
+        (grid.Comm(),"kappa_1(A) estimate = ",condEst,", exact = ",cond);
+        if( condEst > 2*cond || 10*condEst < cond )
+            LogicError("Condition estimate was unacceptably inaccurate");
+    }
+
     PopIndent();
 }
 
@@ -107,6 +128,7 @@ template<typename Field>
 void TestLU
 ( Int m,
   Int pivoting,
+  bool tiled,
   bool correctness,
   bool forceGrowth,
   bool print )
@@ -131,7 +153,9 @@ void TestLU
     timer.Start();
     if( pivoting == 0 )
         LU( A );
-    else if( pivoting == 1 )
+    else if( ( pivoting == 1 || pivoting == 3 ) && tiled )
+        LUTiled( A, P );
+    else if( pivoting == 1 || pivoting == 3 )
         LU( A, P );
     else if( pivoting == 2 )
         LU( A, P, Q );
@@ -208,6 +232,8 @@ void TestLU
         LU( A, P );
     else if( pivoting == 2 )
         LU( A, P, Q );
+    else if( pivoting == 3 )
+        LU( A, P, LU_TOURNAMENT );
     mpi::Barrier( grid.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops = 2./3.*Pow(double(m),3.)/(1.e9*runTime);
@@ -260,10 +286,13 @@ main( int argc, char* argv[] )
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
-        const Int pivot = Input("--pivot","0: none, 1: partial, 2: full",1);
+        const Int pivot = Input
+          ("--pivot","0: none, 1: partial, 2: full, 3: tournament",1);
         const bool forceGrowth = Input
             ("--forceGrowth","force element growth?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
+        const bool tiled =
+          Input("--tiled","use task-based tiled sequential LU?",false);
         const bool correctness =
           Input("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -272,7 +301,7 @@ main( int argc, char* argv[] )
 #endif
         ProcessInput();
         PrintInputReport();
-        if( pivot < 0 || pivot > 2 )
+        if( pivot < 0 || pivot > 3 )
             LogicError("Invalid pivot value");
 
 #ifdef EL_HAVE_MPC
@@ -291,43 +320,46 @@ main( int argc, char* argv[] )
             OutputFromRoot(grid.Comm(),"Testing LU with partial pivoting");
         else if( pivot == 2 )
             OutputFromRoot(grid.Comm(),"Testing LU with full pivoting");
+        else if( pivot == 3 )
+            OutputFromRoot
+            (grid.Comm(),"Testing LU with tournament pivoting");
 
         if( sequential && mpi::Rank() == 0 )
         {
             TestLU<float>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tiled, correctness, forceGrowth, print );
             TestLU<Complex<float>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tiled, correctness, forceGrowth, print );
 
             TestLU<double>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tiled, correctness, forceGrowth, print );
             TestLU<Complex<double>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tiled, correctness, forceGrowth, print );
 
 #ifdef EL_HAVE_QD
             TestLU<DoubleDouble>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tiled, correctness, forceGrowth, print );
             TestLU<QuadDouble>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tiled, correctness, forceGrowth, print );
 
             TestLU<Complex<DoubleDouble>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tiled, correctness, forceGrowth, print );
             TestLU<Complex<QuadDouble>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tiled, correctness, forceGrowth, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
             TestLU<Quad>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tiled, correctness, forceGrowth, print );
             TestLU<Complex<Quad>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tiled, correctness, forceGrowth, print );
 #endif
 
 #ifdef EL_HAVE_MPC
             TestLU<BigFloat>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tiled, correctness, forceGrowth, print );
             TestLU<Complex<BigFloat>>
-            ( m, pivot, correctness, forceGrowth, print );
+            ( m, pivot, tiled, correctness, forceGrowth, print );
 #endif
         }
 
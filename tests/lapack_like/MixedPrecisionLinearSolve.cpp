@@ -0,0 +1,140 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void CheckResidual
+( const Grid& grid,
+  const string& label,
+  const DistMatrix<Field>& A,
+  const DistMatrix<Field>& B,
+  const DistMatrix<Field>& X )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    DistMatrix<Field> R( B );
+    Gemm( NORMAL, NORMAL, Field(-1), A, X, Field(1), R );
+    const Real ANorm = FrobeniusNorm( A );
+    const Real BNorm = FrobeniusNorm( B );
+    const Real XNorm = FrobeniusNorm( X );
+    const Real residNorm = FrobeniusNorm( R );
+    const Real relResid = residNorm / (ANorm*XNorm+BNorm);
+    OutputFromRoot
+    (grid.Comm(),label,": || B - A X ||_F / ( || A ||_F || X ||_F + "
+     "|| B ||_F ) = ",relResid);
+    if( relResid > A.Height()*eps )
+        LogicError(label," residual was unacceptably large");
+}
+
+template<typename Field>
+void TestMixedPrecisionLinearSolve
+( const Grid& grid,
+  Int m,
+  Int numRHS,
+  bool progress,
+  bool print )
+{
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    LinearSolveCtrl<Base<Field>> ctrl;
+    ctrl.mixedPrecision = true;
+    ctrl.progress = progress;
+
+    // A well-conditioned matrix and one whose condition number is near the
+    // inverse of the single-precision unit roundoff
+    for( Int k=0; k<2; ++k )
+    {
+        OutputFromRoot
+        (grid.Comm(),k == 0 ? "Shifted Gaussian:" : "Ill-conditioned:");
+        PushIndent();
+        DistMatrix<Field> A(grid), B(grid);
+        if( k == 0 )
+        {
+            Gaussian( A, m, m );
+            ShiftDiagonal( A, Field(Sqrt(Base<Field>(m))) );
+        }
+        else
+        {
+            // A = U diag(sigma) V^H with log-spaced singular values
+            DistMatrix<Field> U(grid), V(grid);
+            Gaussian( U, m, m );
+            Gaussian( V, m, m );
+            qr::ExplicitUnitary( U );
+            qr::ExplicitUnitary( V );
+            for( Int j=0; j<m; ++j )
+            {
+                const Base<Field> sigma =
+                  Pow( Base<Field>(10), -6*Base<Field>(j)/Max(m-1,Int(1)) );
+                auto uj = U( ALL, IR(j) );
+                uj *= sigma;
+            }
+            Gemm( NORMAL, ADJOINT, Field(1), U, V, A );
+        }
+        Gaussian( B, m, numRHS );
+        if( print )
+            Print( A, "A" );
+
+        Timer timer;
+        DistMatrix<Field> X( B ), XFull( B );
+        timer.Start();
+        LinearSolve( A, X, ctrl );
+        OutputFromRoot(grid.Comm(),"Mixed precision: ",timer.Stop()," secs");
+        timer.Start();
+        LinearSolve( A, XFull );
+        OutputFromRoot(grid.Comm(),"Full precision: ",timer.Stop()," secs");
+        CheckResidual( grid, "Mixed precision", A, B, X );
+        CheckResidual( grid, "Full precision", A, B, XFull );
+
+        // Repeat the mixed-precision solve sequentially
+        Matrix<Field> ALoc, XLoc;
+        {
+            DistMatrix<Field,CIRC,CIRC> A_CIRC_CIRC( A ), B_CIRC_CIRC( B );
+            if( grid.Rank() == 0 )
+            {
+                ALoc = A_CIRC_CIRC.Matrix();
+                XLoc = B_CIRC_CIRC.Matrix();
+                LinearSolve( ALoc, XLoc, ctrl );
+            }
+        }
+        DistMatrix<Field,CIRC,CIRC> XSeq_CIRC_CIRC(m,numRHS,grid);
+        if( grid.Rank() == 0 )
+            XSeq_CIRC_CIRC.Matrix() = XLoc;
+        DistMatrix<Field> XSeq( XSeq_CIRC_CIRC );
+        CheckResidual( grid, "Sequential mixed precision", A, B, XSeq );
+        PopIndent();
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",200);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",3);
+        const Int nb = Input("--nb","algorithmic blocksize",64);
+        const bool progress = Input("--progress","print progress?",false);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+
+        SetBlocksize( nb );
+        const Grid grid( comm );
+        TestMixedPrecisionLinearSolve<double>( grid, m, numRHS, progress, print );
+        TestMixedPrecisionLinearSolve<Complex<double>>
+        ( grid, m, numRHS, progress, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -180,6 +180,7 @@ void TestHessenberg
   Orientation orientation,
   Int m,
   Int n, 
+  const MultiShiftHessCtrl& ctrl,
   bool correctness,
   bool print,
   bool display )
@@ -206,7 +207,10 @@ void TestHessenberg
     mpi::Barrier( g.Comm() );
     Timer timer;
     timer.Start();
-    MultiShiftHessSolve( uplo, orientation, F(1), H, shifts, X );
+    if( ctrl.numSubgrids > 0 )
+        MultiShiftHessSolve( uplo, orientation, F(1), H, shifts, X, ctrl );
+    else
+        MultiShiftHessSolve( uplo, orientation, F(1), H, shifts, X );
     mpi::Barrier( mpi::COMM_WORLD );
     const double runTime = timer.Stop();
     // TODO: Flop calculation
@@ -230,6 +234,10 @@ main( int argc, char* argv[] )
         const Int m = Input("--m","height of Hessenberg matrix",100);
         const Int n = Input("--n","number of right-hand sides",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int numSubgrids = Input
+            ("--numSubgrids","number of teams caching H (0 for default)",0);
+        const Int batchSize = Input
+            ("--batchSize","max number of local shifts per batch",0);
         const bool sequential = Input("--sequential","test sequential?",true);
         const bool correctness = Input
             ("--correctness","test correctness?",true);
@@ -252,6 +260,10 @@ main( int argc, char* argv[] )
         SetBlocksize( nb );
         ComplainIfDebug();
 
+        MultiShiftHessCtrl ctrl;
+        ctrl.numSubgrids = numSubgrids;
+        ctrl.batchSize = batchSize;
+
         if( sequential && mpi::Rank() == 0 )
         {
             TestHessenberg<float>
@@ -290,37 +302,37 @@ main( int argc, char* argv[] )
         }
 
         TestHessenberg<float>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, ctrl, correctness, print, display );
         TestHessenberg<Complex<float>>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, ctrl, correctness, print, display );
 
         TestHessenberg<double>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, ctrl, correctness, print, display );
         TestHessenberg<Complex<double>>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, ctrl, correctness, print, display );
 
 #ifdef EL_HAVE_QD
         TestHessenberg<DoubleDouble>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, ctrl, correctness, print, display );
         TestHessenberg<QuadDouble>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, ctrl, correctness, print, display );
 
         TestHessenberg<Complex<DoubleDouble>>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, ctrl, correctness, print, display );
         TestHessenberg<Complex<QuadDouble>>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, ctrl, correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestHessenberg<Quad>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, ctrl, correctness, print, display );
         TestHessenberg<Complex<Quad>>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, ctrl, correctness, print, display );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestHessenberg<BigFloat>
-        ( grid, uplo, orient, m, n, correctness, print, display );
+        ( grid, uplo, orient, m, n, ctrl, correctness, print, display );
 #endif
     }
     catch( std::exception& e ) { ReportException(e); }
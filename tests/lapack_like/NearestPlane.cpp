@@ -0,0 +1,125 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Run Babai's nearest plane algorithm on an LLL-reduced integer basis for
+// several targets at once (some far from the origin and some close enough
+// that most of their coordinates vanish), with blocksizes smaller than,
+// dividing, and exceeding the rank of the lattice, and with blocking
+// thresholds which force both the Gemm and the sparse Axpy updates. The
+// lattice points must exactly match those of the unblocked recurrence
+// applied to one target at a time.
+
+// The unblocked recurrence, one target at a time
+template<typename F>
+void NearestPlaneReference
+( const Matrix<F>& B,
+  const Matrix<F>& QR,
+  const Matrix<F>& t,
+  const Matrix<Base<F>>& d,
+  const Matrix<F>& T,
+        Matrix<F>& Y,
+  const LLLCtrl<Base<F>>& ctrl )
+{
+    const Int n = B.Width();
+    const Int numRHS = T.Width();
+    Matrix<F> RY( T );
+    qr::ApplyQ( LEFT, ADJOINT, QR, t, d, RY );
+
+    Matrix<F> X;
+    Zeros( X, n, numRHS );
+    for( Int j=0; j<numRHS; ++j )
+    {
+        for( Int i=n-1; i>=0; --i )
+        {
+            F chi = RY(i,j) / QR(i,i);
+            if( Abs(RealPart(chi)) > ctrl.eta ||
+                Abs(ImagPart(chi)) > ctrl.eta )
+            {
+                chi = Round(chi);
+                for( Int k=0; k<=i; ++k )
+                    RY(k,j) -= chi*QR(k,i);
+                X(i,j) = chi;
+            }
+        }
+    }
+    Gemm( NORMAL, NORMAL, F(1), B, X, Y );
+}
+
+template<typename F>
+void TestNearestPlane( Int n, Int numRHS )
+{
+    typedef Base<F> Real;
+    Output("Testing with ",TypeName<F>());
+    PushIndent();
+
+    Matrix<F> B;
+    Uniform( B, n, n, F(0), Real(10) );
+    Round( B );
+    Matrix<F> QR, t;
+    Matrix<Real> d;
+    LLLCtrl<Real> ctrl;
+    auto info = LLLWithQ( B, QR, t, d, ctrl );
+    if( info.rank != n )
+        LogicError("The random basis was rank-deficient");
+
+    // The second half of the targets lie close enough to the origin that
+    // most of their coordinates round to zero
+    Matrix<F> T;
+    Gaussian( T, n, numRHS, F(0), Real(100) );
+    auto TNear = T( ALL, IR(numRHS/2,numRHS) );
+    TNear *= F(Real(1)/Real(50));
+
+    Matrix<F> YRef;
+    NearestPlaneReference( B, QR, t, d, T, YRef, ctrl );
+
+    for( const Int bsize : { Int(1), Int(4), n, n+3 } )
+    {
+        PushBlocksizeStack( bsize );
+        for( const float thresh : { 0.f, 0.5f, 1.f } )
+        {
+            ctrl.blockingThresh = thresh;
+            Matrix<F> Y;
+            NearestPlane( B, QR, t, d, T, Y, ctrl );
+            Y -= YRef;
+            if( MaxNorm( Y ) != Real(0) )
+                LogicError
+                ("NearestPlane with blocksize ",bsize," and blocking "
+                 "threshold ",thresh," disagreed with the unblocked "
+                 "recurrence");
+        }
+        PopBlocksizeStack();
+    }
+    Output("Blocked and sparse updates passed");
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","rank of the lattice",20);
+        const Int numRHS = Input("--numRHS","number of targets",12);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestNearestPlane<double>( n, numRHS );
+            TestNearestPlane<Complex<double>>( n, numRHS );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
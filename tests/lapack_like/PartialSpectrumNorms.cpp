@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Real>
+void CheckNorm
+( const string& label, Real estimate, Real exact, Real tol, const Grid& g )
+{
+    const Real relError = Abs(estimate-exact) / exact;
+    OutputFromRoot
+    (g.Comm(),label,": estimate=",estimate,", exact=",exact,
+     ", relative error=",relError);
+    if( relError > tol )
+        LogicError(label," estimate was inaccurate");
+}
+
+template<typename Field>
+void TestNorms( Int m, Int n, Int k, const Grid& g )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<Field>());
+
+    // A matrix with rapidly decaying singular values for the top-k solver
+    DistMatrix<Field> X(g), Y(g), D(g), XD(g), A(g);
+    Gaussian( X, m, n );
+    Gaussian( Y, n, n );
+    Zeros( D, n, n );
+    for( Int j=0; j<n; ++j )
+        D.Set( j, j, Pow(Real(0.7),Real(j)) );
+    Gemm( NORMAL, NORMAL, Field(1), X, D, XD );
+    Gemm( NORMAL, ADJOINT, Field(1), XD, Y, A );
+
+    PartialSpectrumCtrl<Real> ctrl;
+    ctrl.tol = Real(1)/Real(10000);
+    CheckNorm
+    ("KyFan", KyFanNorm(A,k,ctrl), KyFanNorm(A,k), Real(1)/Real(100), g);
+    CheckNorm
+    ("Two", TwoNorm(A,ctrl), TwoNorm(A), Real(1)/Real(100), g);
+
+    // A well-conditioned matrix for stochastic Lanczos quadrature
+    Gaussian( A, m, n );
+    ctrl.tol = Real(1)/Real(100);
+    ctrl.lanczosSteps = 20;
+    ctrl.blockSize = 5;
+    CheckNorm
+    ("Nuclear", NuclearNorm(A,ctrl), NuclearNorm(A), Real(1)/Real(20), g);
+    CheckNorm
+    ("Schatten-3", SchattenNorm(A,Real(3),ctrl), SchattenNorm(A,Real(3)),
+     Real(1)/Real(20), g);
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height",300);
+        const Int n = Input("--n","width",200);
+        const Int k = Input("--k","Ky-Fan index",5);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestNorms<double>( m, n, k, g );
+        TestNorms<Complex<double>>( m, n, k, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
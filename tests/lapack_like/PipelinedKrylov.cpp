@@ -0,0 +1,185 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Solve a 2D Laplacian with pipelined CG and a convection-diffusion operator
+// (the Laplacian plus a skew-symmetric first-difference term) with pipelined
+// GMRES, both Jacobi-preconditioned, and require that the true residuals
+// converge to the requested tolerance.
+
+template<typename Field>
+bool OwnsRow( const SparseMatrix<Field>& A, Int i ) { return true; }
+template<typename Field>
+bool OwnsRow( const DistSparseMatrix<Field>& A, Int i )
+{ return i >= A.FirstLocalRow() && i < A.FirstLocalRow()+A.LocalHeight(); }
+
+template<typename Field>
+Int NumLocalEntries( const SparseMatrix<Field>& A ) { return A.NumEntries(); }
+template<typename Field>
+Int NumLocalEntries( const DistSparseMatrix<Field>& A )
+{ return A.NumLocalEntries(); }
+
+template<typename Field>
+Matrix<Field>& Local( Matrix<Field>& x ) { return x; }
+template<typename Field>
+Matrix<Field>& Local( DistMultiVec<Field>& x ) { return x.Matrix(); }
+template<typename Field>
+Int FirstLocalRow( const Matrix<Field>& x ) { return 0; }
+template<typename Field>
+Int FirstLocalRow( const DistMultiVec<Field>& x ) { return x.FirstLocalRow(); }
+
+template<typename Field,class MatrixType,class VectorType>
+void TestSolver
+( const string& label,
+  const MatrixType& A,
+  const VectorType& B,
+  bool gmres,
+  Base<Field> relTol,
+  Int restart,
+  Int maxIts,
+  bool progress,
+  const Grid& grid )
+{
+    typedef Base<Field> Real;
+    const Int n = A.Height();
+
+    // Form the inverse of the diagonal of A for a Jacobi preconditioner
+    VectorType dInv( B );
+    Zeros( dInv, n, 1 );
+    auto& dInvLoc = Local( dInv );
+    const Int firstLocalRow = FirstLocalRow( dInv );
+    for( Int e=0; e<NumLocalEntries(A); ++e )
+    {
+        const Int i = A.Row(e);
+        if( A.Col(e) == i )
+            dInvLoc(i-firstLocalRow) = Field(1)/A.Value(e);
+    }
+
+    auto applyA =
+      [&]( Field alpha, const VectorType& x, Field beta, VectorType& y )
+      { Multiply( NORMAL, alpha, A, x, beta, y ); };
+    auto precond = [&]( VectorType& b )
+      {
+          auto& bLoc = Local( b );
+          for( Int j=0; j<bLoc.Width(); ++j )
+              for( Int iLoc=0; iLoc<bLoc.Height(); ++iLoc )
+                  bLoc(iLoc,j) *= dInvLoc(iLoc);
+      };
+
+    VectorType X( B );
+    const Int numIts =
+      gmres ?
+      PipelinedGMRES( applyA, precond, X, relTol, restart, maxIts, progress ) :
+      PipelinedCG( applyA, precond, X, relTol, maxIts, progress );
+
+    // Require || b - A x ||_2 <= 10 relTol || b ||_2 for each column
+    VectorType R( B );
+    Multiply( NORMAL, Field(-1), A, X, Field(1), R );
+    Matrix<Real> residNorms, rhsNorms;
+    ColumnTwoNorms( R, residNorms );
+    ColumnTwoNorms( B, rhsNorms );
+    for( Int j=0; j<B.Width(); ++j )
+    {
+        const Real relResid = residNorms(j) / rhsNorms(j);
+        OutputFromRoot
+        (grid.Comm(),label,": ",numIts," iterations, || b - A x ||_2 / "
+         "|| b ||_2 = ",relResid," for column ",j);
+        if( relResid > 10*relTol )
+            LogicError(label," did not converge to the requested tolerance");
+    }
+}
+
+template<typename Field,class MatrixType,class VectorType>
+void TestPipelined
+( const string& label,
+  MatrixType& A,
+  VectorType& B,
+  Int nx,
+  Int ny,
+  Int numRHS,
+  Base<Field> relTol,
+  Int restart,
+  Int maxIts,
+  bool progress,
+  const Grid& grid )
+{
+    OutputFromRoot(grid.Comm(),"Testing ",label," with ",TypeName<Field>());
+    PushIndent();
+    const Int n = nx*ny;
+    Laplacian( A, nx, ny );
+    Uniform( B, n, numRHS );
+    TestSolver<Field>
+    ( "Pipelined CG", A, B, false, relTol, restart, maxIts, progress, grid );
+
+    // Add a skew-symmetric convection term along the x direction
+    const Field gamma = Field(nx+1);
+    A.Reserve( 2*n );
+    for( Int i=0; i<n; ++i )
+    {
+        if( !OwnsRow( A, i ) )
+            continue;
+        if( i % nx != nx-1 )
+            A.QueueUpdate( i, i+1, gamma );
+        if( i % nx != 0 )
+            A.QueueUpdate( i, i-1, -gamma );
+    }
+    A.ProcessQueues();
+    TestSolver<Field>
+    ( "Pipelined GMRES", A, B, true, relTol, restart, maxIts, progress, grid );
+    PopIndent();
+}
+
+template<typename Field>
+void TestPipelined
+( Int nx, Int ny, Int numRHS, Base<Field> relTol, Int restart, Int maxIts,
+  bool progress, const Grid& grid )
+{
+    if( grid.Rank() == 0 )
+    {
+        SparseMatrix<Field> A;
+        Matrix<Field> B;
+        TestPipelined<Field>
+        ( "sequential", A, B, nx, ny, numRHS, relTol, restart, maxIts,
+          progress, Grid::Trivial() );
+    }
+    DistSparseMatrix<Field> A(grid);
+    DistMultiVec<Field> B(grid);
+    TestPipelined<Field>
+    ( "distributed", A, B, nx, ny, numRHS, relTol, restart, maxIts,
+      progress, grid );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int nx = Input("--nx","first grid dimension",30);
+        const Int ny = Input("--ny","second grid dimension",30);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",2);
+        const double relTol = Input("--relTol","relative tolerance",1e-6);
+        const Int restart = Input("--restart","GMRES restart parameter",30);
+        const Int maxIts = Input("--maxIts","maximum iterations",2000);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestPipelined<double>
+        ( nx, ny, numRHS, relTol, restart, maxIts, progress, grid );
+        TestPipelined<Complex<double>>
+        ( nx, ny, numRHS, relTol, restart, maxIts, progress, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
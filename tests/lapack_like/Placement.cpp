@@ -0,0 +1,77 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The cost of a dense O(n^3) subproblem of size n with n/8 synchronizations
+SubproblemCost DenseCost( double n )
+{
+    SubproblemCost cost;
+    cost.flops = n*n*n;
+    cost.numInputEntries = n*n;
+    cost.numOutputEntries = n*n;
+    cost.numSyncs = n/8;
+    cost.numCommEntries = 2*n*n;
+    return cost;
+}
+
+void TestPlacement( int commSize )
+{
+    SubproblemDecision heuristic;
+    heuristic.placement = STAY_DISTRIBUTED;
+    heuristic.teamSize = commSize;
+    if( !PlacementModelActive() )
+    {
+        auto decision = ChoosePlacement( DenseCost(10), commSize, heuristic );
+        if( decision.placement != STAY_DISTRIBUTED )
+            LogicError("Heuristic was not respected by an inactive model");
+    }
+
+    PlacementModel model;
+    model.latency = 1e-5;
+    model.inverseBandwidth = 1e-9;
+    model.flopTime = 1e-10;
+    SetPlacementModel( model );
+
+    auto small = ChoosePlacement( DenseCost(10), commSize, heuristic );
+    if( commSize > 1 && small.placement != GO_REDUNDANT )
+        LogicError("Tiny subproblem was not run redundantly");
+    auto large = ChoosePlacement( DenseCost(1e5), commSize, heuristic );
+    if( large.placement != STAY_DISTRIBUTED || large.teamSize != commSize )
+        LogicError("Large subproblem was not kept distributed");
+    for( Int n=10; n<=100000; n*=10 )
+    {
+        auto decision = ChoosePlacement( DenseCost(n), commSize, heuristic );
+        const double time = SubproblemTime( DenseCost(n), commSize, 1 );
+        if( SubproblemTime(DenseCost(n),commSize,decision.teamSize) >
+            time*(1+1e-12) )
+            LogicError("Placement was more expensive than redundancy");
+        Output
+        ("n=",n," over ",commSize," processes: placement=",
+         decision.placement,", teamSize=",decision.teamSize);
+    }
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const int commSize = Input("--commSize","modeled team size",64);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+            TestPlacement( commSize );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -129,7 +129,8 @@ void TestQR
 ( Int m,
   Int n,
   bool correctness,
-  bool print )
+  bool print,
+  bool tiled )
 {
     Output("Testing with ",TypeName<Field>());
     PushIndent();
@@ -148,7 +149,10 @@ void TestQR
     Timer timer;
     Output("Starting QR factorization...");
     timer.Start();
-    QR( A, householderScalars, signature );
+    if( tiled )
+        QRTiled( A, householderScalars, signature );
+    else
+        QR( A, householderScalars, signature );
     const double runTime = timer.Stop();
     const double realGFlops = (2.*mD*nD*nD - 2./3.*nD*nD*nD)/(1.e9*runTime);
     const double gFlops = IsComplex<Field>::value ? 4*realGFlops : realGFlops;
@@ -170,7 +174,8 @@ void TestQR
   Int m,
   Int n,
   bool correctness,
-  bool print )
+  bool print,
+  bool caqr )
 {
     OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
     PushIndent();
@@ -189,7 +194,10 @@ void TestQR
     OutputFromRoot(grid.Comm(),"Starting QR factorization...");
     mpi::Barrier( grid.Comm() );
     const double startTime = mpi::Time();
-    QR( A, householderScalars, signature );
+    if( caqr )
+        qr::CommunicationAvoiding( A, householderScalars, signature );
+    else
+        QR( A, householderScalars, signature );
     mpi::Barrier( grid.Comm() );
     const double runTime = mpi::Time() - startTime;
     const double realGFlops = (2.*mD*nD*nD - 2./3.*nD*nD*nD)/(1.e9*runTime);
@@ -221,6 +229,10 @@ main( int argc, char* argv[] )
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",64);
         const bool sequential = Input("--sequential","test sequential?",true);
+        const bool caqr =
+          Input("--caqr","use communication-avoiding QR?",false);
+        const bool tiled =
+          Input("--tiled","use task-based tiled sequential QR?",false);
         const bool correctness =
           Input("--correctness","test correctness?",true);
 #ifdef EL_HAVE_MPC
@@ -244,76 +256,76 @@ main( int argc, char* argv[] )
         if( sequential && mpi::Rank() == 0 )
         {
             TestQR<float>
-            ( m, n, correctness, print );
+            ( m, n, correctness, print, tiled );
             TestQR<Complex<float>>
-            ( m, n, correctness, print );
+            ( m, n, correctness, print, tiled );
 
             TestQR<double>
-            ( m, n, correctness, print );
+            ( m, n, correctness, print, tiled );
             TestQR<Complex<double>>
-            ( m, n, correctness, print );
+            ( m, n, correctness, print, tiled );
 
 #ifdef EL_HAVE_QD
             TestQR<DoubleDouble>
-            ( m, n, correctness, print );
+            ( m, n, correctness, print, tiled );
             TestQR<QuadDouble>
-            ( m, n, correctness, print );
+            ( m, n, correctness, print, tiled );
 
             TestQR<Complex<DoubleDouble>>
-            ( m, n, correctness, print );
+            ( m, n, correctness, print, tiled );
             TestQR<Complex<QuadDouble>>
-            ( m, n, correctness, print );
+            ( m, n, correctness, print, tiled );
 #endif
 
 #ifdef EL_HAVE_QUAD
             TestQR<Quad>
-            ( m, n, correctness, print );
+            ( m, n, correctness, print, tiled );
             TestQR<Complex<Quad>>
-            ( m, n, correctness, print );
+            ( m, n, correctness, print, tiled );
 #endif
 
 #ifdef EL_HAVE_MPC
             TestQR<BigFloat>
-            ( m, n, correctness, print );
+            ( m, n, correctness, print, tiled );
             TestQR<Complex<BigFloat>>
-            ( m, n, correctness, print );
+            ( m, n, correctness, print, tiled );
 #endif
         }
 
         TestQR<float>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, correctness, print, caqr );
         TestQR<Complex<float>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, correctness, print, caqr );
 
         TestQR<double>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, correctness, print, caqr );
         TestQR<Complex<double>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, correctness, print, caqr );
 
 #ifdef EL_HAVE_QD
         TestQR<DoubleDouble>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, correctness, print, caqr );
         TestQR<QuadDouble>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, correctness, print, caqr );
 
         TestQR<Complex<DoubleDouble>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, correctness, print, caqr );
         TestQR<Complex<QuadDouble>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, correctness, print, caqr );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestQR<Quad>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, correctness, print, caqr );
         TestQR<Complex<Quad>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, correctness, print, caqr );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestQR<BigFloat>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, correctness, print, caqr );
         TestQR<Complex<BigFloat>>
-        ( grid, m, n, correctness, print );
+        ( grid, m, n, correctness, print, caqr );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
@@ -0,0 +1,65 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Ensure that the (partial) products of random reflectors are unitary and
+// that rotating a uniform spectrum by them preserves it
+template<typename F>
+void TestReflectors( Int n, Int numReflectors, const Grid& g )
+{
+    typedef Base<F> Real;
+    OutputFromRoot
+    (g.Comm(),"Testing ",numReflectors," reflectors with ",TypeName<F>());
+    DistMatrix<F> Q(g), QImpl(g), Z(g);
+    DistMatrix<F,MD,STAR> householderScalars(g);
+    DistMatrix<Real,MD,STAR> signature(g);
+    ImplicitRandomReflectors
+    ( QImpl, householderScalars, signature, n, numReflectors );
+    Identity( Q, n, n );
+    qr::ApplyQ( LEFT, NORMAL, QImpl, householderScalars, signature, Q );
+    Identity( Z, n, n );
+    Herk( LOWER, ADJOINT, Real(-1), Q, Real(1), Z );
+    const Real orthError = HermitianFrobeniusNorm( LOWER, Z );
+    OutputFromRoot(g.Comm(),"|| I - Q^H Q ||_F = ",orthError);
+    if( orthError > n*limits::Epsilon<Real>()*10 )
+        LogicError("Product of reflectors was not unitary");
+
+    const Real lower = 1, upper = 2;
+    DistMatrix<F> A(g);
+    HermitianUniformSpectrum( A, n, lower, upper, numReflectors );
+    DistMatrix<Real,VR,STAR> w(g);
+    HermitianEig( LOWER, A, w );
+    const Real tol = n*limits::Epsilon<Real>()*100;
+    if( Min(w) < lower-tol || Max(w) > upper+tol )
+        LogicError("Spectrum was not preserved");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","matrix size",100);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        for( Int numReflectors : { Int(0), Int(5), n } )
+        {
+            TestReflectors<double>( n, numReflectors, g );
+            TestReflectors<Complex<double>>( n, numReflectors, g );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
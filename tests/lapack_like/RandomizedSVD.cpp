@@ -0,0 +1,83 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestRandomizedSVD
+( Int m,
+  Int n,
+  Int rank,
+  const RandomizedRangeCtrl& ctrl,
+  const Grid& grid,
+  bool print )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+
+    // Form an exactly rank-'rank' matrix
+    DistMatrix<Field> X(grid), Y(grid), A(grid);
+    Gaussian( X, m, rank );
+    Gaussian( Y, rank, n );
+    Gemm( NORMAL, NORMAL, Field(1), X, Y, A );
+    const Real frobA = FrobeniusNorm( A );
+
+    Timer timer;
+    DistMatrix<Field> U(grid), V(grid);
+    DistMatrix<Real,VR,STAR> s(grid);
+    timer.Start();
+    RandomizedSVD( A, U, s, V, rank, ctrl );
+    OutputFromRoot(grid.Comm(),"RandomizedSVD: ",timer.Stop()," seconds");
+    if( print )
+        Print( s, "s" );
+
+    // Check || A - U diag(s) V^H ||_F / || A ||_F
+    DiagonalScale( RIGHT, NORMAL, s, U );
+    Gemm( NORMAL, ADJOINT, Field(-1), U, V, Field(1), A );
+    const Real relError = FrobeniusNorm( A ) / frobA;
+    OutputFromRoot
+    (grid.Comm(),"|| A - U diag(s) V^H ||_F / || A ||_F = ",relError);
+    if( relError > Sqrt(Real(m*n))*eps*100 )
+        LogicError("Relative error was unacceptably large");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",200);
+        const Int n = Input("--n","width of matrix",100);
+        const Int rank = Input("--rank","rank of matrix",10);
+        const Int oversampling =
+          Input("--oversampling","number of extra samples",10);
+        const Int numPowerIts =
+          Input("--numPowerIts","number of power iterations",1);
+        const bool sparseSign =
+          Input("--sparseSign","use a sparse sign sketch?",false);
+        const bool print = Input("--print","print singular values?",false);
+        ProcessInput();
+
+        const Grid grid( comm );
+        RandomizedRangeCtrl ctrl;
+        ctrl.oversampling = oversampling;
+        ctrl.numPowerIts = numPowerIts;
+        ctrl.sketch = ( sparseSign ? SPARSE_SIGN_SKETCH : GAUSSIAN_SKETCH );
+
+        TestRandomizedSVD<float>( m, n, rank, ctrl, grid, print );
+        TestRandomizedSVD<double>( m, n, rank, ctrl, grid, print );
+        TestRandomizedSVD<Complex<double>>( m, n, rank, ctrl, grid, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestRidgePath
+( const Grid& grid,
+  Int m,
+  Int n,
+  Int numRHS,
+  Int numGammas,
+  bool print )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    DistMatrix<Field> A(grid), B(grid), X(grid);
+    Gaussian( A, m, n );
+    Gaussian( B, m, numRHS );
+
+    // Logarithmically space the parameters over [1e-4,1e2]
+    Matrix<Real> gammas( numGammas, 1 );
+    for( Int l=0; l<numGammas; ++l )
+        gammas(l) = Pow( Real(10), Real(-4) + (Real(6)*l)/Max(numGammas-1,1) );
+
+    Timer timer;
+    Matrix<Real> residNorms;
+    timer.Start();
+    RidgePath( NORMAL, A, B, gammas, X, residNorms );
+    OutputFromRoot(grid.Comm(),"RidgePath: ",timer.Stop()," seconds");
+    if( print )
+        Print( residNorms, "residNorms" );
+
+    // Compare each member of the path against a standalone Ridge solve
+    DistMatrix<Field> XRidge(grid), E(grid);
+    for( Int l=0; l<numGammas; ++l )
+    {
+        auto XPath = X( ALL, IR(l*numRHS,(l+1)*numRHS) );
+        Ridge( NORMAL, A, B, gammas(l), XRidge, RIDGE_QR );
+        E = XRidge;
+        E -= XPath;
+        const Real relError = FrobeniusNorm(E) / FrobeniusNorm(XRidge);
+
+        E = B;
+        Gemm( NORMAL, NORMAL, Field(-1), A, XPath, Field(1), E );
+        DistMatrix<Real,MR,STAR> norms(grid);
+        ColumnTwoNorms( E, norms );
+        DistMatrix<Real,STAR,STAR> norms_STAR_STAR( norms );
+        Real residError = 0;
+        for( Int j=0; j<numRHS; ++j )
+            residError =
+              Max( residError,
+                   Abs(norms_STAR_STAR.Get(j,0)-residNorms(j,l)) /
+                   norms_STAR_STAR.Get(j,0) );
+        OutputFromRoot
+        (grid.Comm(),"gamma=",gammas(l),": solution error=",relError,
+         ", residual norm error=",residError);
+        if( relError > Sqrt(eps) || residError > Sqrt(eps) )
+            LogicError("Path solution differed too much from Ridge");
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",300);
+        const Int n = Input("--n","width of matrix",100);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",2);
+        const Int numGammas =
+          Input("--numGammas","number of regularization parameters",8);
+        const bool print = Input("--print","print residual norms?",false);
+        ProcessInput();
+
+        const Grid grid( comm );
+        TestRidgePath<double>( grid, m, n, numRHS, numGammas, print );
+        TestRidgePath<Complex<double>>( grid, m, n, numRHS, numGammas, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
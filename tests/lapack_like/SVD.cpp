@@ -20,6 +20,7 @@ void TestSequentialSVD
   bool wantU,
   bool wantV,
   bool useQR,
+  bool twoStage,
   bool penalizeDerivative,
   Int divideCutoff,
   bool print )
@@ -40,6 +41,7 @@ void TestSequentialSVD
 
     SVDCtrl<Real> ctrl;
     ctrl.bidiagSVDCtrl.useQR = useQR;
+    ctrl.twoStageBidiag = twoStage;
     ctrl.bidiagSVDCtrl.wantU = wantU; 
     ctrl.bidiagSVDCtrl.wantV = wantV;
     ctrl.bidiagSVDCtrl.approach = approach;
@@ -166,6 +168,7 @@ void TestDistributedSVD
   bool wantU,
   bool wantV,
   bool useQR,
+  bool twoStage,
   bool penalizeDerivative,
   Int divideCutoff,
   bool print )
@@ -189,6 +192,7 @@ void TestDistributedSVD
     // Compute the SVD of A 
     SVDCtrl<Real> ctrl;
     ctrl.bidiagSVDCtrl.useQR = useQR;
+    ctrl.twoStageBidiag = twoStage;
     ctrl.bidiagSVDCtrl.wantU = wantU; 
     ctrl.bidiagSVDCtrl.wantV = wantV;
     ctrl.bidiagSVDCtrl.approach = approach;
@@ -344,6 +348,7 @@ void TestSVD
   bool wantU,
   bool wantV,
   bool useQR,
+  bool twoStage,
   bool penalizeDerivative,
   Int divideCutoff,
   bool print )
@@ -353,13 +358,14 @@ void TestSVD
     {
         TestSequentialSVD<F>
         ( m, n, rank, approach, tolType, tol, time, progress, wantU, wantV,
-          useQR, penalizeDerivative, divideCutoff, print );
+          useQR, twoStage, penalizeDerivative, divideCutoff, print );
     }
     if( testDist )
     {
         TestDistributedSVD<F> 
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          wantU, wantV, useQR, penalizeDerivative, divideCutoff, print );
+          wantU, wantV, useQR, twoStage, penalizeDerivative, divideCutoff,
+          print );
     }
 }
 
@@ -394,6 +400,8 @@ main( int argc, char* argv[] )
         const bool wantU = Input("--wantU","compute U?",true);
         const bool wantV = Input("--wantV","compute V?",true);
         const bool useQR = Input("--useQR","force use of QR algorithm?",false);
+        const bool twoStage =
+          Input("--twoStage","bidiagonalize through a band?",false);
         const bool penalizeDerivative =
           Input
           ("--penalizeDerivative","penalize secular derivative in D&C?",false);
@@ -421,62 +429,62 @@ main( int argc, char* argv[] )
 
         TestSVD<float>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, twoStage,
+          penalizeDerivative, divideCutoff, print );
         TestSVD<Complex<float>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, twoStage,
+          penalizeDerivative, divideCutoff, print );
 
         TestSVD<double>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, twoStage,
+          penalizeDerivative, divideCutoff, print );
         TestSVD<Complex<double>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, twoStage,
+          penalizeDerivative, divideCutoff, print );
 
 #ifdef EL_HAVE_QD
         TestSVD<DoubleDouble>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, twoStage,
+          penalizeDerivative, divideCutoff, print );
         TestSVD<Complex<DoubleDouble>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, twoStage,
+          penalizeDerivative, divideCutoff, print );
 
         TestSVD<QuadDouble>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, twoStage,
+          penalizeDerivative, divideCutoff, print );
         TestSVD<Complex<QuadDouble>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, twoStage,
+          penalizeDerivative, divideCutoff, print );
 #endif
 
 #ifdef EL_HAVE_QUAD
         TestSVD<Quad>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, twoStage,
+          penalizeDerivative, divideCutoff, print );
         TestSVD<Complex<Quad>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, twoStage,
+          penalizeDerivative, divideCutoff, print );
 #endif
 
 #ifdef EL_HAVE_MPC
         TestSVD<BigFloat>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, twoStage,
+          penalizeDerivative, divideCutoff, print );
         TestSVD<Complex<BigFloat>>
         ( m, n, rank, approach, tolType, tol, time, progress, scalapack,
-          testSeq, testDist, wantU, wantV, useQR, penalizeDerivative,
-          divideCutoff, print );
+          testSeq, testDist, wantU, wantV, useQR, twoStage,
+          penalizeDerivative, divideCutoff, print );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
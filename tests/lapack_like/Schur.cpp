@@ -13,6 +13,7 @@ template<typename F>
 void TestRandomHelper
 ( const Matrix<F>& A, 
   const HessenbergSchurCtrl& hessSchurCtrl,
+  bool twoStage,
   bool print )
 {
     EL_DEBUG_CSE
@@ -22,6 +23,7 @@ void TestRandomHelper
 
     SchurCtrl<Base<F>> ctrl;
     ctrl.hessSchurCtrl = hessSchurCtrl;
+    ctrl.twoStageHessenberg = twoStage;
 
     Matrix<F> T, Z;
     Matrix<Complex<Real>> w;
@@ -110,7 +112,8 @@ void TestRandomHelper
 }
 
 template<typename F>
-void TestRandom( Int n, const HessenbergSchurCtrl& ctrl, bool print )
+void TestRandom
+( Int n, const HessenbergSchurCtrl& ctrl, bool twoStage, bool print )
 {
     EL_DEBUG_CSE
     Output("Testing uniform with ",TypeName<F>());
@@ -118,7 +121,7 @@ void TestRandom( Int n, const HessenbergSchurCtrl& ctrl, bool print )
     Uniform( A, n, n );
     if( print )
         Print( A, "A" );
-    TestRandomHelper( A, ctrl, print );
+    TestRandomHelper( A, ctrl, twoStage, print );
 }
 
 template<typename F>
@@ -151,6 +154,10 @@ int main( int argc, char* argv[] )
         const bool sortShifts =
           Input("--sortShifts","sort shifts for AED?",true);
         const bool sequential = Input("--sequential","test sequential?",true);
+        const bool twoStage =
+          Input
+          ("--twoStage","sequential Hessenberg reduction through a band?",
+           false);
         const bool distributed =
           Input("--distributed","test distributed?",true);
         const bool progress = Input("--progress","print progress?",true);
@@ -170,23 +177,23 @@ int main( int argc, char* argv[] )
 
         if( sequential && grid.Rank() == 0 )
         {
-            TestRandom<float>( n, ctrl, print );
-            TestRandom<Complex<float>>( n, ctrl, print );
-            TestRandom<double>( n, ctrl, print );
-            TestRandom<Complex<double>>( n, ctrl, print );
+            TestRandom<float>( n, ctrl, twoStage, print );
+            TestRandom<Complex<float>>( n, ctrl, twoStage, print );
+            TestRandom<double>( n, ctrl, twoStage, print );
+            TestRandom<Complex<double>>( n, ctrl, twoStage, print );
 #ifdef EL_HAVE_QUAD
-            TestRandom<Quad>( n, ctrl, print );
-            TestRandom<Complex<Quad>>( n, ctrl, print );
+            TestRandom<Quad>( n, ctrl, twoStage, print );
+            TestRandom<Complex<Quad>>( n, ctrl, twoStage, print );
 #endif
 #ifdef EL_HAVE_QD
-            TestRandom<DoubleDouble>( n, ctrl, print );
-            TestRandom<Complex<DoubleDouble>>( n, ctrl, print );
-            TestRandom<QuadDouble>( n, ctrl, print );
-            TestRandom<Complex<QuadDouble>>( n, ctrl, print );
+            TestRandom<DoubleDouble>( n, ctrl, twoStage, print );
+            TestRandom<Complex<DoubleDouble>>( n, ctrl, twoStage, print );
+            TestRandom<QuadDouble>( n, ctrl, twoStage, print );
+            TestRandom<Complex<QuadDouble>>( n, ctrl, twoStage, print );
 #endif
 #ifdef EL_HAVE_MPC
-            TestRandom<BigFloat>( n, ctrl, print );
-            TestRandom<Complex<BigFloat>>( n, ctrl, print );
+            TestRandom<BigFloat>( n, ctrl, twoStage, print );
+            TestRandom<Complex<BigFloat>>( n, ctrl, twoStage, print );
 #endif
         }
         if( distributed )
@@ -0,0 +1,94 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestSketchedLeastSquares
+( const Grid& grid,
+  Int m,
+  Int n,
+  Int numRHS,
+  double sketchRatio,
+  Int sketchSparsity,
+  bool progress )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    // Form an ill-conditioned A by scaling the columns of a Gaussian matrix
+    DistMatrix<Field> A(grid), B(grid), X(grid), XDirect(grid);
+    Gaussian( A, m, n );
+    Matrix<Real> d( n, 1 );
+    for( Int j=0; j<n; ++j )
+        d(j) = Pow( Real(10), Real(-6*j)/n );
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR( grid );
+    d_STAR_STAR.Resize( n, 1 );
+    d_STAR_STAR.Matrix() = d;
+    DiagonalScale( RIGHT, NORMAL, d_STAR_STAR, A );
+    Gaussian( B, m, numRHS );
+
+    LeastSquaresCtrl<Real> ctrl;
+    ctrl.alg = LS_SKETCH_AND_PRECONDITION;
+    ctrl.sketchRatio = sketchRatio;
+    ctrl.sketchSparsity = sketchSparsity;
+    ctrl.progress = progress;
+
+    Timer timer;
+    timer.Start();
+    LeastSquares( NORMAL, A, B, X, ctrl );
+    OutputFromRoot(grid.Comm(),"Sketched: ",timer.Stop()," seconds");
+    timer.Start();
+    LeastSquares( NORMAL, A, B, XDirect );
+    OutputFromRoot(grid.Comm(),"Direct: ",timer.Stop()," seconds");
+
+    // Compare the residuals of the two solutions
+    DistMatrix<Field> R( B ), RDirect( B );
+    Gemm( NORMAL, NORMAL, Field(-1), A, X, Field(1), R );
+    Gemm( NORMAL, NORMAL, Field(-1), A, XDirect, Field(1), RDirect );
+    const Real residNorm = FrobeniusNorm( R );
+    const Real directResidNorm = FrobeniusNorm( RDirect );
+    const Real relDiff = Abs(residNorm-directResidNorm) / directResidNorm;
+    OutputFromRoot
+    (grid.Comm(),"|| B - A X ||_F = ",residNorm,", || B - A XDirect ||_F = ",
+     directResidNorm);
+    if( relDiff > Sqrt(eps) )
+        LogicError("Sketched residual differed too much from the direct one");
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",2000);
+        const Int n = Input("--n","width of matrix",50);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",2);
+        const double sketchRatio =
+          Input("--sketchRatio","ratio of sketch height to width",4.);
+        const Int sketchSparsity =
+          Input("--sketchSparsity","nonzeros per column of sketch",4);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+
+        const Grid grid( comm );
+        TestSketchedLeastSquares<double>
+        ( grid, m, n, numRHS, sketchRatio, sketchSparsity, progress );
+        TestSketchedLeastSquares<Complex<double>>
+        ( grid, m, n, numRHS, sketchRatio, sketchSparsity, progress );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,87 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Ensure that the fused sparse equilibration sweeps produce a factorization
+// A = diag(dRow) AEquil diag(dCol) with entries of AEquil bounded by one
+template<typename Real>
+void TestEquil( Int m, Int n, bool geometric, const Grid& grid )
+{
+    OutputFromRoot
+    (grid.Comm(),"Testing ",(geometric?"GeomEquil":"RuizEquil")," with ",
+     TypeName<Real>());
+    DistSparseMatrix<Real> A(grid);
+    A.Resize( m, n );
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( 4*localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        const Real rowScale = Pow( Real(10), Real(i%7-3) );
+        for( Int k=0; k<4; ++k )
+        {
+            const Int j = (i*(2*k+1)+k) % n;
+            const Real colScale = Pow( Real(10), Real(j%5-2) );
+            A.QueueLocalUpdate( iLoc, j, rowScale*colScale*Real(k+1) );
+        }
+    }
+    A.ProcessLocalQueues();
+
+    auto AEquil( A );
+    DistMultiVec<Real> dRow(grid), dCol(grid);
+    if( geometric )
+        GeomEquil( AEquil, dRow, dCol );
+    else
+        RuizEquil( AEquil, dRow, dCol );
+    const Real maxAbs = MaxNorm( AEquil );
+    OutputFromRoot(grid.Comm(),"|| AEquil ||_max = ",maxAbs);
+    if( maxAbs > Real(1) + Real(10)*limits::Epsilon<Real>() )
+        LogicError("Equilibrated entries were not bounded by one");
+
+    // Compare A x against diag(dRow) AEquil diag(dCol) x
+    DistMultiVec<Real> x(grid), y(grid), yEquil(grid);
+    Uniform( x, n, 1 );
+    Zeros( y, m, 1 );
+    Multiply( NORMAL, Real(1), A, x, Real(0), y );
+    DiagonalScale( LEFT, NORMAL, dCol, x );
+    Zeros( yEquil, m, 1 );
+    Multiply( NORMAL, Real(1), AEquil, x, Real(0), yEquil );
+    DiagonalScale( LEFT, NORMAL, dRow, yEquil );
+    const Real yNorm = FrobeniusNorm( y );
+    yEquil -= y;
+    const Real relError = FrobeniusNorm( yEquil ) / yNorm;
+    OutputFromRoot(grid.Comm(),"Relative reconstruction error: ",relError);
+    if( relError > Real(100)*limits::Epsilon<Real>() )
+        LogicError("Equilibration did not preserve the matrix");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",1000);
+        const Int n = Input("--n","width of matrix",700);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        for( bool geometric : { false, true } )
+        {
+            TestEquil<float>( m, n, geometric, grid );
+            TestEquil<double>( m, n, geometric, grid );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -34,12 +34,15 @@ void TestSparseDirect
   bool solve2d,
   bool selInv,
   bool intraPiv,
+  bool blr,
   Int nbFact,
   Int nbSolve,
   bool natural,
   bool unpack,
   bool print,
   bool display,
+  const string& oocDir,
+  Int kernelSize,
   const BisectCtrl& ctrl,
   const El::Grid& grid )
 {
@@ -94,6 +97,33 @@ void TestSparseDirect
         ( n1, n2, n3, A, hermitian, ctrl );
     else
         sparseLDLFact.Initialize( A, hermitian, ctrl );
+    if( !oocDir.empty() )
+        sparseLDLFact.EnableOutOfCore( oocDir );
+    if( kernelSize > 0 )
+    {
+        // Stand in for an accelerated kernel using the dense routines
+        ldl::DenseFrontKernel<Field> kernel;
+        kernel.minSize = kernelSize;
+        kernel.factor =
+          []( Matrix<Field>& AL, Matrix<Field>& ABR, bool conjugate )
+          {
+              const Int n = AL.Width();
+              const Orientation orientation =
+                ( conjugate ? ADJOINT : TRANSPOSE );
+              auto ATL = AL( IR(0,n), ALL );
+              auto ABL = AL( IR(n,END), ALL );
+              LDL( ATL, conjugate );
+              Matrix<Field> d;
+              GetDiagonal( ATL, d );
+              Trsm( RIGHT, LOWER, orientation, UNIT, Field(1), ATL, ABL );
+              auto SBL = ABL;
+              DiagonalSolve( RIGHT, NORMAL, d, ABL );
+              Trrk
+              ( LOWER, NORMAL, orientation,
+                Field(-1), SBL, ABL, Field(1), ABR );
+          };
+        sparseLDLFact.SetDenseFrontKernel( kernel );
+    }
     mpi::Barrier( grid.Comm() );
     timer.Stop();
     OutputFromRoot(grid.Comm(),timer.Partial()," seconds");
@@ -140,12 +170,12 @@ void TestSparseDirect
      "  max entries:   ",maxLocalEntriesBefore,"\n",Indent(),
      "  total entries: ",entriesBefore,"\n");
 
-    OutputFromRoot(grid.Comm(),"Running LDL^T and redistribution...");
-    SetBlocksize( nbFact );
-    mpi::Barrier( grid.Comm() );
-    timer.Start();
     LDLFrontType type;
-    if( solve2d )
+    if( blr )
+    {
+        type = solve2d ? BLR_LDL_2D : BLR_LDL_1D;
+    }
+    else if( solve2d )
     {
         if( intraPiv )
             type = selInv ? LDL_INTRAPIV_SELINV_2D : LDL_INTRAPIV_2D;
@@ -159,6 +189,21 @@ void TestSparseDirect
         else
             type = selInv ? LDL_SELINV_1D : LDL_1D;
     }
+    const auto prediction =
+      ldl::PredictFactorization<Field>( sparseLDLFact.NodeInfo(), type );
+    const double maxPeakBytes =
+      mpi::AllReduce( prediction.peakBytes, mpi::MAX, grid.Comm() );
+    const double predictedGFlops =
+      mpi::AllReduce( prediction.factorGFlops, grid.Comm() );
+    OutputFromRoot
+    (grid.Comm(),
+     "Predicted max peak bytes: ",maxPeakBytes,", total GFlops: ",
+     predictedGFlops);
+
+    OutputFromRoot(grid.Comm(),"Running LDL^T and redistribution...");
+    SetBlocksize( nbFact );
+    mpi::Barrier( grid.Comm() );
+    timer.Start();
     sparseLDLFact.Factor( type );
     mpi::Barrier( grid.Comm() );
     const double factTime = timer.Stop();
@@ -208,6 +253,36 @@ void TestSparseDirect
          "|| x     ||_2 = ",XNorms.Get(j,0),"\n",Indent(),
          "|| error ||_2 = ",errorNorms.Get(j,0),"\n",Indent(),
          "|| A x   ||_2 = ",YOrigNorms.Get(j,0),"\n");
+
+    if( !intraPiv )
+    {
+        OutputFromRoot(grid.Comm(),"Checking diagonal of selected inverse...");
+        DistMultiVec<Field> d(grid);
+        sparseLDLFact.InverseDiagonal( d );
+
+        // Compare against solves with a few of the unit vectors
+        const Int numChecks = Min(N,3);
+        DistMultiVec<Field> E(grid);
+        Zeros( E, N, numChecks );
+        if( grid.Rank() == 0 )
+        {
+            E.Reserve( numChecks );
+            for( Int k=0; k<numChecks; ++k )
+                E.QueueUpdate( (k*(N-1))/Max(numChecks-1,1), k, Field(1) );
+        }
+        E.ProcessQueues();
+        sparseLDLFact.Solve( E );
+        for( Int k=0; k<numChecks; ++k )
+        {
+            const Int i = (k*(N-1))/Max(numChecks-1,1);
+            const Field solveValue = E.Get( i, k );
+            const Real error = Abs(d.Get(i,0)-solveValue);
+            OutputFromRoot
+            (grid.Comm(),
+             "|inv(A)(",i,",",i,") - e_i^T inv(A) e_i| = ",error," (",
+             "|e_i^T inv(A) e_i| = ",Abs(solveValue),")");
+        }
+    }
 }
 
 int main( int argc, char* argv[] )
@@ -224,6 +299,7 @@ int main( int argc, char* argv[] )
         const bool solve2d = Input("--solve2d","use 2d solve?",false);
         const bool selInv = Input("--selInv","selectively invert?",false);
         const bool intraPiv = Input("--intraPiv","pivot within fronts?",false);
+        const bool blr = Input("--blr","compress fronts in BLR form?",false);
         const bool natural = Input("--natural","analytical nested-diss?",true);
         const bool sequential = Input
             ("--sequential","sequential partitions?",true);
@@ -236,9 +312,19 @@ int main( int argc, char* argv[] )
         const Int nbFact = Input("--nbFact","factorization blocksize",96);
         const Int nbSolve = Input("--nbSolve","solve blocksize",96);
         const Int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const bool amalgamate =
+          Input("--amalgamate","relaxed amalgamation of fronts?",false);
+        const Int minFrontSize =
+          Input("--minFrontSize","minimum size of amalgamated fronts",32);
+        const double maxZeroFraction =
+          Input("--maxZeroFraction","max fraction of explicit zeros",0.1);
         const bool unpack = Input("--unpack","unpack frontal matrix?",true);
         const bool print = Input("--print","print matrix?",false);
         const bool display = Input("--display","display matrix?",false);
+        const string oocDir =
+          Input("--oocDir","directory for out-of-core fronts",string(""));
+        const Int kernelSize =
+          Input("--kernelSize","min. width for custom front kernel (0=off)",0);
 #ifdef EL_HAVE_MPC
         const mpfr_prec_t prec = Input("--prec","MPFR precision",256);
 #endif
@@ -249,34 +335,38 @@ int main( int argc, char* argv[] )
         ctrl.numSeqSeps = numSeqSeps;
         ctrl.numDistSeps = numDistSeps;
         ctrl.cutoff = cutoff;
+        ctrl.amalgamate = amalgamate;
+        ctrl.minFrontSize = minFrontSize;
+        ctrl.maxZeroFraction = maxZeroFraction;
         const El::Grid grid(comm);
 
         // TODO(poulson): Call complex variants as well
 
         TestSparseDirect<float>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, blr, nbFact, nbSolve,
+          natural, unpack, print, display, oocDir, kernelSize, ctrl, grid );
         TestSparseDirect<double>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, blr, nbFact, nbSolve,
+          natural, unpack, print, display, oocDir, kernelSize, ctrl, grid );
 #ifdef EL_HAVE_QD
         TestSparseDirect<DoubleDouble>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, blr, nbFact, nbSolve,
+          natural, unpack, print, display, oocDir, kernelSize, ctrl, grid );
         TestSparseDirect<QuadDouble>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, blr, nbFact, nbSolve,
+          natural, unpack, print, display, oocDir, kernelSize, ctrl, grid );
 #endif
 #ifdef EL_HAVE_QUAD
         TestSparseDirect<Quad>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, blr, nbFact, nbSolve,
+          natural, unpack, print, display, oocDir, kernelSize, ctrl, grid );
 #endif
 #ifdef EL_HAVE_MPC
         mpfr::SetPrecision( prec );
+        // BigFloat factors cannot be stored out-of-core
         TestSparseDirect<BigFloat>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, unpack, print, display, ctrl, grid );
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, blr, nbFact, nbSolve,
+          natural, unpack, print, display, string(""), kernelSize, ctrl, grid );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
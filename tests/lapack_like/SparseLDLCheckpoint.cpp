@@ -0,0 +1,107 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Save a factored and an unfactored sparse LDL factorization, load each into
+// a fresh factorization, and require that the restored factorizations solve
+// A x = b as accurately as the original one.
+
+template<typename Field>
+Base<Field> SolveError
+( const DistSparseMatrix<Field>& A,
+  const DistSparseLDLFactorization<Field>& sparseLDLFact,
+  const DistMultiVec<Field>& x )
+{
+    const Int N = A.Height();
+    DistMultiVec<Field> y( N, 1, A.Grid() );
+    Zeros( y, N, 1 );
+    Multiply( NORMAL, Field(1), A, x, Field(0), y );
+    sparseLDLFact.Solve( y );
+    y -= x;
+    return FrobeniusNorm(y) / FrobeniusNorm(x);
+}
+
+template<typename Field>
+void TestCheckpoint( Int n1, Int n2, Int n3, const Grid& grid )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+    const Int N = n1*n2*n3;
+    const Real tol = N*limits::Epsilon<Real>();
+    const string filename = "SparseLDLCheckpoint";
+
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+    DistMultiVec<Field> x( N, 1, grid );
+    MakeUniform( x );
+
+    const bool hermitian = false;
+    DistSparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.Initialize( A, hermitian );
+    sparseLDLFact.Factor( LDL_1D );
+    const Real origError = SolveError( A, sparseLDLFact, x );
+    OutputFromRoot
+    (grid.Comm(),"Original: || x - inv(A) A x ||_2 / || x ||_2 = ",origError);
+    if( origError > tol )
+        LogicError("The original factorization was inaccurate");
+
+    // Restore the factored fronts
+    sparseLDLFact.Save( filename );
+    DistSparseLDLFactorization<Field> numericFact;
+    numericFact.Load( A, filename );
+    const Real numericError = SolveError( A, numericFact, x );
+    OutputFromRoot
+    (grid.Comm(),"Factored checkpoint: || x - inv(A) A x ||_2 / || x ||_2 = ",
+     numericError);
+    if( numericError > tol )
+        LogicError("The restored factorization was inaccurate");
+
+    // Restore only the analysis and then factor
+    sparseLDLFact.Save( filename, false );
+    DistSparseLDLFactorization<Field> symbolicFact;
+    symbolicFact.Load( A, filename );
+    symbolicFact.Factor( LDL_1D );
+    const Real symbolicError = SolveError( A, symbolicFact, x );
+    OutputFromRoot
+    (grid.Comm(),"Symbolic checkpoint: || x - inv(A) A x ||_2 / || x ||_2 = ",
+     symbolicError);
+    if( symbolicError > tol )
+        LogicError("The refactored restored analysis was inaccurate");
+
+    mpi::Barrier( grid.Comm() );
+    if( grid.Rank() == 0 )
+        std::remove( filename.c_str() );
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",15);
+        const Int n2 = Input("--n2","second grid dimension",15);
+        const Int n3 = Input("--n3","third grid dimension",15);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestCheckpoint<float>( n1, n2, n3, grid );
+        TestCheckpoint<double>( n1, n2, n3, grid );
+        TestCheckpoint<Complex<double>>( n1, n2, n3, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -105,6 +105,29 @@ void TestSparseDirect
 
         // TODO(poulson): Check residual error
     }
+
+    // Refill the fronts with the original matrix and refactor, reusing the
+    // frontal storage and the extend-add communication metadata
+    for( Int repeat=0; repeat<numRepeats; ++repeat )
+    {
+        OutputFromRoot(grid.Comm(),"Refactoring...");
+        mpi::Barrier( grid.Comm() );
+        timer.Start();
+        sparseLDLFact.Refactor( A );
+        mpi::Barrier( grid.Comm() );
+        timer.Stop();
+        OutputFromRoot(grid.Comm(),timer.Partial()," seconds");
+
+        DistMultiVec<Field> x( N, 1, grid ), y( N, 1, grid );
+        MakeUniform( x );
+        Zeros( y, N, 1 );
+        Multiply( NORMAL, Field(1), A, x, Field(0), y );
+        sparseLDLFact.Solve( y );
+        y -= x;
+        const Base<Field> relError = FrobeniusNorm(y) / FrobeniusNorm(x);
+        OutputFromRoot(grid.Comm(),"|| x - inv(A) A x ||_2 / || x ||_2 = ",
+          relError);
+    }
 }
 
 int main( int argc, char* argv[] )
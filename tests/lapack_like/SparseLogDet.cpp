@@ -0,0 +1,87 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestSparseLogDet( Int n1, Int n2, Int n3, bool intraPiv, const Grid& grid )
+{
+    typedef Base<Field> Real;
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    const Real tol = Sqrt(limits::Epsilon<Real>());
+
+    const Int N = n1*n2*n3;
+    DistSparseMatrix<Field> A(grid);
+    Laplacian( A, n1, n2, n3 );
+    A *= -1;
+    DistMatrix<Field> ADense(grid);
+    Copy( A, ADense );
+
+    DistSparseLDLFactorization<Field> sparseLDLFact;
+    sparseLDLFact.Initialize( A, true );
+    sparseLDLFact.Factor( intraPiv ? LDL_INTRAPIV_2D : LDL_2D );
+
+    // log det(A) from the sparse factorization versus a dense Cholesky
+    auto det = SafeDeterminant( sparseLDLFact );
+    auto hpdDet = SafeHPDDeterminant( LOWER, ADense );
+    const Real logDet = det.kappa*det.n;
+    const Real denseLogDet = hpdDet.kappa*hpdDet.n;
+    OutputFromRoot
+    (grid.Comm(),"log det(A): sparse=",logDet,", dense=",denseLogDet);
+    if( Abs(det.rho-Field(1)) > tol ||
+        Abs(logDet-denseLogDet) > tol*Abs(denseLogDet) )
+        LogicError("Sparse log-determinant was incorrect");
+
+    // Hutch++ recovers tr(inv(A) dA) exactly when the rank of dA is smaller
+    // than its sketch
+    const Int i0 = 0, i1 = N/2;
+    DistSparseMatrix<Field> dA(grid);
+    Zeros( dA, N, N );
+    if( grid.Rank() == 0 )
+    {
+        dA.Reserve( 2, 2 );
+        dA.QueueUpdate( i0, i0, Field(1) );
+        dA.QueueUpdate( i1, i1, Field(2) );
+    }
+    dA.ProcessQueues();
+    HPDInverse( LOWER, ADense );
+    const Field trace = ADense.Get(i0,i0) + Field(2)*ADense.Get(i1,i1);
+
+    TraceEstimateCtrl<Real> ctrl;
+    ctrl.numProbes = 12;
+    ctrl.blockSize = 4;
+    const Field estimate = EstimateTrace( sparseLDLFact, dA, ctrl );
+    OutputFromRoot
+    (grid.Comm(),"tr(inv(A) dA): estimate=",estimate,", exact=",trace);
+    if( Abs(estimate-trace) > tol*Abs(trace) )
+        LogicError("Deflated trace estimate was incorrect");
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",8);
+        const Int n2 = Input("--n2","second grid dimension",8);
+        const Int n3 = Input("--n3","third grid dimension",8);
+        const bool intraPiv = Input("--intraPiv","frontal pivoting?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestSparseLogDet<double>( n1, n2, n3, intraPiv, grid );
+        TestSparseLogDet<Complex<double>>( n1, n2, n3, intraPiv, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename Field>
+void TestSparseQRLeastSquares
+( const Grid& grid,
+  Int nx,
+  Int ny,
+  Int numRHS,
+  Int cutoff,
+  bool progress )
+{
+    typedef Base<Field> Real;
+    const Real eps = limits::Epsilon<Real>();
+    OutputFromRoot(grid.Comm(),"Testing with ",TypeName<Field>());
+    PushIndent();
+
+    // Form the overdetermined A = [L; I], with L a 2D Laplacian
+    const Int n = nx*ny;
+    DistSparseMatrix<Field> L(grid), I(grid), A(grid);
+    Laplacian( L, nx, ny );
+    Identity( I, n, n );
+    VCat( L, I, A );
+
+    LeastSquaresCtrl<Real> ctrl;
+    ctrl.alg = LS_MULTIFRONTAL_QR;
+    ctrl.qrBisectCtrl.cutoff = cutoff;
+    ctrl.progress = progress;
+
+    for( Int k=0; k<2; ++k )
+    {
+        // Solve a least squares problem with A and then a minimum-length
+        // problem with A^H
+        const Orientation orientation = ( k == 0 ? NORMAL : ADJOINT );
+        const Int height = ( k == 0 ? 2*n : n );
+        OutputFromRoot
+        (grid.Comm(),
+         k == 0 ? "Least squares:" : "Minimum length:");
+        PushIndent();
+
+        DistMultiVec<Field> B(grid), X(grid), XDirect(grid);
+        Gaussian( B, height, numRHS );
+        Timer timer;
+        timer.Start();
+        LeastSquares( orientation, A, B, X, ctrl );
+        OutputFromRoot(grid.Comm(),"Multifrontal QR: ",timer.Stop()," seconds");
+        timer.Start();
+        LeastSquares( orientation, A, B, XDirect );
+        OutputFromRoot(grid.Comm(),"Direct: ",timer.Stop()," seconds");
+
+        DistMultiVec<Field> R( B ), RDirect( B );
+        Multiply( orientation, Field(-1), A, X, Field(1), R );
+        Multiply( orientation, Field(-1), A, XDirect, Field(1), RDirect );
+        const Real BNorm = FrobeniusNorm( B );
+        const Real residNorm = FrobeniusNorm( R );
+        const Real directResidNorm = FrobeniusNorm( RDirect );
+        const Real XNorm = FrobeniusNorm( X );
+        const Real XDirectNorm = FrobeniusNorm( XDirect );
+        OutputFromRoot
+        (grid.Comm(),"|| B - op(A) X ||_F = ",residNorm,
+         ", || B - op(A) XDirect ||_F = ",directResidNorm);
+        OutputFromRoot
+        (grid.Comm(),"|| X ||_F = ",XNorm,", || XDirect ||_F = ",XDirectNorm);
+        if( k == 0 )
+        {
+            const Real relDiff =
+              Abs(residNorm-directResidNorm) / directResidNorm;
+            if( relDiff > Sqrt(eps) )
+                LogicError("QR residual differed too much from the direct one");
+        }
+        else
+        {
+            if( residNorm > Sqrt(eps)*BNorm )
+                LogicError("QR solution was not sufficiently feasible");
+            if( Abs(XNorm-XDirectNorm) > Sqrt(eps)*XDirectNorm )
+                LogicError("QR solution norm differed from the direct one");
+        }
+        PopIndent();
+    }
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int nx = Input("--nx","size of grid in x dimension",30);
+        const Int ny = Input("--ny","size of grid in y dimension",30);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",2);
+        const Int cutoff =
+          Input("--cutoff","maximum size of a leaf of the dissection",64);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+
+        const Grid grid( comm );
+        TestSparseQRLeastSquares<double>
+        ( grid, nx, ny, numRHS, cutoff, progress );
+        TestSparseQRLeastSquares<Complex<double>>
+        ( grid, nx, ny, numRHS, cutoff, progress );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
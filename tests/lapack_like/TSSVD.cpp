@@ -77,6 +77,7 @@ void TestSVD
 ( const Grid& g,
   Int m,
   Int n,
+  bool driver,
   bool correctness,
   bool print )
 {
@@ -95,7 +96,14 @@ void TestSVD
     mpi::Barrier( g.Comm() );
     Timer timer;
     timer.Start();
-    svd::TSQR( A, U, s, V );
+    if( driver )
+    {
+        SVDCtrl<Base<F>> ctrl;
+        ctrl.useTSQR = true;
+        SVD( A, U, s, V, ctrl );
+    }
+    else
+        svd::TSQR( A, U, s, V );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     OutputFromRoot(g.Comm(),"Time = ",runTime," seconds");
@@ -122,6 +130,8 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int n = Input("--width","width of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool driver =
+          Input("--driver","call TSQR through the SVD driver?",false);
         const bool correctness =
           Input("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
@@ -135,14 +145,14 @@ main( int argc, char* argv[] )
         OutputFromRoot(g.Comm(),"Will test TSSVD");
 
         TestSVD<float>
-        ( g, m, n, correctness, print );
+        ( g, m, n, driver, correctness, print );
         TestSVD<Complex<float>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, driver, correctness, print );
 
         TestSVD<double>
-        ( g, m, n, correctness, print );
+        ( g, m, n, driver, correctness, print );
         TestSVD<Complex<double>>
-        ( g, m, n, correctness, print );
+        ( g, m, n, driver, correctness, print );
     }
     catch( exception& e ) { ReportException(e); }
 
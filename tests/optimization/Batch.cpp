@@ -0,0 +1,181 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Solve a batch of random feasible LPs and QPs of varying sizes over all of
+// the processes and check each of the returned solutions on every process.
+
+template<typename Real>
+Real RelativeResidual
+( const Matrix<Real>& Q,
+  const Matrix<Real>& A,
+  const Matrix<Real>& G,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+  const AffineLPSolution<Matrix<Real>>& solution )
+{
+    Matrix<Real> rb, rh, rc;
+    rb = b;
+    Gemv( NORMAL, Real(1), A, solution.x, Real(-1), rb );
+    rh = h;
+    Gemv( NORMAL, Real(1), G, solution.x, Real(-1), rh );
+    rh += solution.s;
+    rc = c;
+    Gemv( NORMAL, Real(1), Q, solution.x, Real(1), rc );
+    Gemv( TRANSPOSE, Real(1), A, solution.y, Real(1), rc );
+    Gemv( TRANSPOSE, Real(1), G, solution.z, Real(1), rc );
+    const Real rbRel = FrobeniusNorm(rb) / Max(FrobeniusNorm(b),Real(1));
+    const Real rhRel = FrobeniusNorm(rh) / Max(FrobeniusNorm(h),Real(1));
+    const Real rcRel = FrobeniusNorm(rc) / Max(FrobeniusNorm(c),Real(1));
+    return Max( Max(rbRel,rhRel), rcRel );
+}
+
+// Form a primal-feasible and dual-feasible (and so bounded) model
+template<typename Real>
+void RandomFeasible
+( Int m, Int n, Int k,
+  Matrix<Real>& A,
+  Matrix<Real>& G,
+  Matrix<Real>& b,
+  Matrix<Real>& c,
+  Matrix<Real>& h )
+{
+    Matrix<Real> xFeas, sFeas, yFeas, zFeas;
+    Uniform( A, m, n );
+    Uniform( G, k, n );
+    Uniform( xFeas, n, 1 );
+    Uniform( sFeas, k, 1, Real(1), Real(1) );
+    Uniform( yFeas, m, 1 );
+    Uniform( zFeas, k, 1, Real(1), Real(1) );
+    Gemv( NORMAL, Real(1), A, xFeas, b );
+    Gemv( NORMAL, Real(1), G, xFeas, h );
+    h += sFeas;
+    Gemv( TRANSPOSE, Real(-1), A, yFeas, c );
+    Gemv( TRANSPOSE, Real(-1), G, zFeas, Real(1), c );
+}
+
+// The random number generators of the processes differ, so make every process
+// use the models of the root process
+template<typename Real>
+void Synchronize( Matrix<Real>& A, mpi::Comm comm )
+{
+    if( A.Height() != A.LDim() )
+        LogicError("Expected a contiguous matrix");
+    mpi::Broadcast( A.Buffer(), A.Height()*A.Width(), 0, comm );
+}
+
+template<typename Real>
+void TestBatch( Int numModels, Int m, Int n, Int k, bool print )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = Pow(eps,Real(0.25));
+
+    vector<AffineLPProblem<Matrix<Real>,Matrix<Real>>> lpProblems(numModels);
+    vector<AffineQPProblem<Matrix<Real>,Matrix<Real>>> qpProblems(numModels);
+    for( Int model=0; model<numModels; ++model )
+    {
+        const Int scale = 1 + Mod(model,3);
+        auto& lpProblem = lpProblems[model];
+        RandomFeasible
+        ( scale*m, scale*n, scale*k,
+          lpProblem.A, lpProblem.G, lpProblem.b, lpProblem.c, lpProblem.h );
+
+        auto& qpProblem = qpProblems[model];
+        RandomFeasible
+        ( scale*m, scale*n, scale*k,
+          qpProblem.A, qpProblem.G, qpProblem.b, qpProblem.c, qpProblem.h );
+        Matrix<Real> B;
+        Uniform( B, scale*n, scale*n );
+        Zeros( qpProblem.Q, scale*n, scale*n );
+        Gemm( TRANSPOSE, NORMAL, Real(1), B, B, qpProblem.Q );
+
+        Synchronize( lpProblem.A, comm );
+        Synchronize( lpProblem.G, comm );
+        Synchronize( lpProblem.b, comm );
+        Synchronize( lpProblem.c, comm );
+        Synchronize( lpProblem.h, comm );
+        Synchronize( qpProblem.Q, comm );
+        Synchronize( qpProblem.A, comm );
+        Synchronize( qpProblem.G, comm );
+        Synchronize( qpProblem.b, comm );
+        Synchronize( qpProblem.c, comm );
+        Synchronize( qpProblem.h, comm );
+    }
+
+    lp::affine::Ctrl<Real> lpCtrl;
+    lpCtrl.mehrotraCtrl.print = print;
+    vector<AffineLPSolution<Matrix<Real>>> lpSolutions;
+    Timer timer;
+    if( commRank == 0 )
+        timer.Start();
+    LP( lpProblems, lpSolutions, lpCtrl, comm );
+    if( commRank == 0 )
+        Output("  Batch of ",numModels," LPs: ",timer.Stop()," seconds");
+
+    qp::affine::Ctrl<Real> qpCtrl;
+    qpCtrl.mehrotraCtrl.print = print;
+    vector<AffineLPSolution<Matrix<Real>>> qpSolutions;
+    if( commRank == 0 )
+        timer.Start();
+    QP( qpProblems, qpSolutions, qpCtrl, comm );
+    if( commRank == 0 )
+        Output("  Batch of ",numModels," QPs: ",timer.Stop()," seconds");
+
+    for( Int model=0; model<numModels; ++model )
+    {
+        const auto& lpProblem = lpProblems[model];
+        Matrix<Real> Q;
+        Zeros( Q, lpProblem.c.Height(), lpProblem.c.Height() );
+        const Real lpResid =
+          RelativeResidual
+          ( Q, lpProblem.A, lpProblem.G, lpProblem.b, lpProblem.c,
+            lpProblem.h, lpSolutions[model] );
+        const auto& qpProblem = qpProblems[model];
+        const Real qpResid =
+          RelativeResidual
+          ( qpProblem.Q, qpProblem.A, qpProblem.G, qpProblem.b, qpProblem.c,
+            qpProblem.h, qpSolutions[model] );
+        if( lpResid > tol || qpResid > tol )
+            LogicError
+            ("Model ",model," had relative residuals of ",lpResid," (LP) and ",
+             qpResid," (QP)");
+    }
+    if( commRank == 0 )
+        Output("  All of the solutions were sufficiently accurate");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int numModels = Input("--numModels","number of models",12);
+        const Int m = Input("--m","base height of A",10);
+        const Int n = Input("--n","base width of A",20);
+        const Int k = Input("--k","base height of G",25);
+        const bool print = Input("--print","print IPM progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+            Output("Testing with doubles:");
+        TestBatch<double>( numModels, m, n, k, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Solve box-constrained QPs with known solutions via ADMM, both with a fixed
+// penalty parameter and with an adaptive one whose (spectral) factorization
+// is reused across two calls with different bounds.
+
+template<typename Real>
+void BoxModel
+( const DistMatrix<Real>& Q,
+  Real lb,
+  Real ub,
+  DistMatrix<Real>& c,
+  DistMatrix<Real>& xTrue )
+{
+    // Alternate the entries of xTrue between lb and ub and set
+    // c := - Q xTrue - du + dl so that xTrue is optimal
+    const Int n = Q.Height();
+    Zeros( xTrue, n, 1 );
+    Zeros( c, n, 1 );
+    for( Int iLoc=0; iLoc<xTrue.LocalHeight(); ++iLoc )
+        if( xTrue.LocalWidth() == 1 )
+            xTrue.SetLocal
+            ( iLoc, 0, Mod(xTrue.GlobalRow(iLoc),2)==0 ? lb : ub );
+    Hemv( LOWER, Real(-1), Q, xTrue, Real(0), c );
+    for( Int iLoc=0; iLoc<c.LocalHeight(); ++iLoc )
+        if( c.LocalWidth() == 1 )
+            c.UpdateLocal
+            ( iLoc, 0, Mod(c.GlobalRow(iLoc),2)==0 ? Real(0.5) : Real(-0.5) );
+}
+
+template<typename Real>
+void TestBoxADMM( Int n, const Grid& grid, bool print )
+{
+    if( grid.Rank() == 0 )
+        Output("Testing with ",TypeName<Real>());
+    DistMatrix<Real> Q(grid), c(grid), xTrue(grid), x(grid);
+    HermitianUniformSpectrum( Q, n, Real(1), Real(100) );
+
+    ADMMCtrl<Real> ctrl;
+    ctrl.maxIter = 5000;
+    ctrl.absTol = Real(1e-8);
+    ctrl.relTol = Real(1e-6);
+    ctrl.print = print;
+    const Real tol = Real(1e-3);
+
+    BoxModel( Q, Real(0.5), Real(1), c, xTrue );
+    const Int numIts = qp::box::ADMM( Q, c, Real(0.5), Real(1), x, ctrl );
+    x -= xTrue;
+    const Real error = FrobeniusNorm(x) / FrobeniusNorm(xTrue);
+    if( grid.Rank() == 0 )
+        Output("  fixed rho: ",numIts," iterations, relative error ",error);
+    if( error > tol )
+        LogicError("The fixed-rho ADMM solution was inaccurate");
+
+    ctrl.adaptiveRho = true;
+    ctrl.checkFrequency = 5;
+    DistShiftedHermitianSolver<Real> solver;
+    for( Int trial=0; trial<2; ++trial )
+    {
+        const Real lb = trial == 0 ? Real(0.5) : Real(-1);
+        BoxModel( Q, lb, Real(1), c, xTrue );
+        const Int numAdaptiveIts =
+          qp::box::ADMM( Q, solver, c, lb, Real(1), x, ctrl );
+        x -= xTrue;
+        const Real adaptiveError = FrobeniusNorm(x) / FrobeniusNorm(xTrue);
+        if( grid.Rank() == 0 )
+            Output
+            ("  adaptive rho (final value ",solver.Shift(),"): ",
+             numAdaptiveIts," iterations, relative error ",adaptiveError);
+        if( adaptiveError > tol )
+            LogicError("The adaptive-rho ADMM solution was inaccurate");
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","problem size",100);
+        const bool print = Input("--print","print ADMM progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestBoxADMM<double>( n, grid, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
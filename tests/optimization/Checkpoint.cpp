@@ -0,0 +1,143 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Interrupt a checkpointing sparse LP IPM after a few iterations, restart it
+// from its checkpoint, and require that the restarted solve resumes where the
+// interrupted one stopped and converges to the objective of an uninterrupted
+// solve.
+
+struct Interruption : public std::runtime_error
+{
+    Interruption() : std::runtime_error("Interrupted") { }
+};
+
+// The entries are deterministic so that every process forms the same problem
+double Pseudorandom( Int i, Int j )
+{ return double((i*37+j*19)%23)/23. - 0.5; }
+
+// Form a primal and dual feasible (and so bounded) direct-form LP with
+// b = A x for x_j = 1 + |Pseudorandom(j,j)| and c = z - A^T y for
+// y_i = Pseudorandom(i,0) and z_j = 1 + |Pseudorandom(j,2j+1)|
+void FormProblem
+( DirectLPProblem<DistSparseMatrix<double>,DistMultiVec<double>>& problem,
+  Int m, Int n )
+{
+    Zeros( problem.A, m, n );
+    Zeros( problem.b, m, 1 );
+    Zeros( problem.c, n, 1 );
+    problem.A.Reserve( 4*problem.A.LocalHeight() );
+    vector<double> b( m, 0. ), c( n, 0. );
+    for( Int i=0; i<m; ++i )
+    {
+        const Int cols[4] = { i % n, (2*i+1) % n, (5*i+3) % n, (7*i+2) % n };
+        for( Int t=0; t<4; ++t )
+        {
+            bool repeat = false;
+            for( Int s=0; s<t; ++s )
+                repeat = repeat || cols[s] == cols[t];
+            if( repeat )
+                continue;
+            const double value = Pseudorandom(i,cols[t]);
+            const Int iLoc = i - problem.A.FirstLocalRow();
+            if( iLoc >= 0 && iLoc < problem.A.LocalHeight() )
+                problem.A.QueueUpdate( i, cols[t], value );
+            b[i] += value*(1+Abs(Pseudorandom(cols[t],cols[t])));
+            c[cols[t]] -= value*Pseudorandom(i,0);
+        }
+    }
+    problem.A.ProcessQueues();
+    for( Int i=0; i<m; ++i )
+        problem.b.Set( i, 0, b[i] );
+    for( Int j=0; j<n; ++j )
+        problem.c.Set( j, 0, c[j] + 1 + Abs(Pseudorandom(j,2*j+1)) );
+}
+
+void TestRestart( Int m, Int n, Int interruptIt, bool print, const Grid& grid )
+{
+    const double tol = Pow(limits::Epsilon<double>(),0.25);
+    const string filename = "LPCheckpoint";
+
+    DirectLPProblem<DistSparseMatrix<double>,DistMultiVec<double>> problem;
+    ForceSimpleAlignments( problem, grid );
+    FormProblem( problem, m, n );
+
+    lp::direct::Ctrl<double> ctrl(true);
+    ctrl.mehrotraCtrl.print = print;
+    DirectLPSolution<DistMultiVec<double>> solution;
+    ForceSimpleAlignments( solution, grid );
+    LP( problem, solution, ctrl );
+    const double objective = Dot( problem.c, solution.x );
+    OutputFromRoot(grid.Comm(),"Uninterrupted: c^T x = ",objective);
+
+    ctrl.mehrotraCtrl.checkpointFile = filename;
+    ctrl.mehrotraCtrl.checkpointFreq = 1;
+    ctrl.mehrotraCtrl.iterationCallback =
+      [&]( const MehrotraIterationInfo<double>& info )
+      {
+          if( info.numIts+1 == interruptIt )
+              throw Interruption();
+      };
+    bool interrupted = false;
+    try { LP( problem, solution, ctrl ); }
+    catch( Interruption& ) { interrupted = true; }
+    if( !interrupted )
+        LogicError("The IPM converged before it could be interrupted");
+
+    Int firstIt = -1;
+    ctrl.mehrotraCtrl.restart = true;
+    ctrl.mehrotraCtrl.iterationCallback =
+      [&]( const MehrotraIterationInfo<double>& info )
+      {
+          if( firstIt < 0 )
+              firstIt = info.numIts;
+      };
+    LP( problem, solution, ctrl );
+    const double restartedObjective = Dot( problem.c, solution.x );
+    OutputFromRoot
+    (grid.Comm(),"Restarted from iteration ",firstIt,": c^T x = ",
+     restartedObjective);
+    if( firstIt != interruptIt )
+        LogicError
+        ("The restart began at iteration ",firstIt," rather than ",
+         interruptIt);
+    if( Abs(objective-restartedObjective) > tol*Max(Abs(objective),1.) )
+        LogicError("The restarted objective differed from ",objective);
+
+    mpi::Barrier( grid.Comm() );
+    if( grid.Rank() == 0 )
+    {
+        std::remove( filename.c_str() );
+        std::remove( (filename+".ldl").c_str() );
+    }
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","number of equality constraints",100);
+        const Int n = Input("--n","number of variables",200);
+        const Int interruptIt =
+          Input("--interruptIt","iteration to interrupt after",3);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestRestart( m, n, interruptIt, print, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Assemble a full LP KKT matrix, refill its -x o inv(z) - beta^2 I block over
+// several iterations (both from the distribution of x, as the IPM does, and
+// from the rows owned by each process), and require that each refilled
+// matrix equals a freshly assembled one and still multiplies correctly with
+// its original communication metadata.
+
+// The entries are deterministic so that every process forms the same problem
+double Pseudorandom( Int i, Int j )
+{ return double((i*37+j*19)%23)/23. - 0.5; }
+
+// The primal and dual iterates of a (pretend) IPM iteration
+double XValue( Int i, Int it ) { return 1 + Abs(Pseudorandom(i,it)); }
+double ZValue( Int i, Int it ) { return 2 + Pseudorandom(it,3*i+1); }
+
+void FormA( DistSparseMatrix<double>& A, Int m, Int n )
+{
+    Zeros( A, m, n );
+    A.Reserve( 3*A.LocalHeight() );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        const Int cols[3] = { i % n, (3*i+1) % n, (7*i+2) % n };
+        for( Int t=0; t<3; ++t )
+        {
+            bool repeat = false;
+            for( Int s=0; s<t; ++s )
+                repeat = repeat || cols[s] == cols[t];
+            if( !repeat )
+                A.QueueUpdate( i, cols[t], Pseudorandom(i,cols[t]) );
+        }
+    }
+    A.ProcessQueues();
+}
+
+// Form
+//
+//   J = | gamma^2 I,       A^T,                  -I        |
+//       |     A,     -delta^2 I,                  0        |
+//       |    -I,            0,  -x o inv(z) - beta^2 I     |,
+//
+// with the barrier block queued from the distribution of x (so that most of
+// its entries are sent to other processes), as lp::direct::KKT does
+void FormKKT
+( const DistSparseMatrix<double>& A,
+  const DistMultiVec<double>& x,
+  double gamma, double delta, double beta, Int it,
+  DistSparseMatrix<double>& J )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int numEntriesA = A.NumLocalEntries();
+    const Int xLocalHeight = x.LocalHeight();
+    J.SetGrid( A.Grid() );
+    Zeros( J, m+2*n, m+2*n );
+    const Int JLocalHeight = J.LocalHeight();
+    J.Reserve
+    ( 2*JLocalHeight+2*numEntriesA+xLocalHeight, 2*numEntriesA+xLocalHeight );
+    for( Int iLoc=0; iLoc<JLocalHeight; ++iLoc )
+    {
+        const Int i = J.GlobalRow(iLoc);
+        if( i < n )
+        {
+            J.QueueUpdate( i, i, gamma*gamma );
+            J.QueueUpdate( i, i+(n+m), -1. );
+        }
+        else if( i < n+m )
+            J.QueueUpdate( i, i, -delta*delta );
+        else
+            J.QueueUpdate( i, i-(n+m), -1. );
+    }
+    for( Int e=0; e<numEntriesA; ++e )
+    {
+        J.QueueUpdate( n+A.Row(e), A.Col(e), A.Value(e) );
+        J.QueueUpdate( A.Col(e), n+A.Row(e), A.Value(e) );
+    }
+    for( Int iLoc=0; iLoc<xLocalHeight; ++iLoc )
+    {
+        const Int i = x.GlobalRow(iLoc);
+        J.QueueUpdate
+        ( n+m+i, n+m+i, -XValue(i,it)/ZValue(i,it)-beta*beta );
+    }
+    J.ProcessQueues();
+    J.FreezeSparsity();
+}
+
+void CheckRefill
+( const string& label,
+  const DistSparseMatrix<double>& JRefill,
+  const DistSparseMatrix<double>& JFresh,
+  const DistMultiVec<double>& v )
+{
+    const Grid& grid = JRefill.Grid();
+    if( !JRefill.LockedDistGraph().multMeta.ready )
+        LogicError(label," invalidated the multiplication metadata");
+
+    bool equal = ( JRefill.NumLocalEntries() == JFresh.NumLocalEntries() );
+    for( Int e=0; e<JRefill.NumLocalEntries() && equal; ++e )
+        equal = JRefill.Row(e) == JFresh.Row(e) &&
+                JRefill.Col(e) == JFresh.Col(e) &&
+                JRefill.Value(e) == JFresh.Value(e);
+    if( !mpi::AllReduce( Int(equal), mpi::BINARY_AND, grid.Comm() ) )
+        LogicError(label," differed from the freshly assembled matrix");
+
+    // Multiply using the metadata formed before any refill
+    const Int N = JRefill.Height();
+    DistMultiVec<double> y(grid), yFresh(grid);
+    Zeros( y, N, 1 );
+    Zeros( yFresh, N, 1 );
+    Multiply( NORMAL, 1., JRefill, v, 0., y );
+    Multiply( NORMAL, 1., JFresh, v, 0., yFresh );
+    yFresh -= y;
+    const double error = FrobeniusNorm( yFresh ) / FrobeniusNorm( y );
+    OutputFromRoot
+    (grid.Comm(),label,": || J_fresh v - J_refill v ||_2 / "
+     "|| J_refill v ||_2 = ",error);
+    if( error > 10*N*limits::Epsilon<double>() )
+        LogicError(label," did not multiply like the fresh matrix");
+}
+
+void TestRefill( Int m, Int n, Int numIts, const Grid& grid )
+{
+    const double gamma=1e-3, delta=1e-3, beta=1e-2;
+    DistSparseMatrix<double> A(grid);
+    FormA( A, m, n );
+    DistMultiVec<double> x(grid);
+    Zeros( x, n, 1 );
+
+    DistSparseMatrix<double> J(grid), JLocal(grid), JFresh(grid);
+    FormKKT( A, x, gamma, delta, beta, 0, J );
+    FormKKT( A, x, gamma, delta, beta, 0, JLocal );
+    J.InitializeMultMeta();
+    JLocal.InitializeMultMeta();
+
+    DistMultiVec<double> v(grid);
+    Uniform( v, J.Height(), 1 );
+
+    // Map the barrier block from the distribution of x
+    vector<Int> rows( x.LocalHeight() );
+    for( Int iLoc=0; iLoc<x.LocalHeight(); ++iLoc )
+        rows[iLoc] = n+m + x.GlobalRow(iLoc);
+    DistSparseRefillMap map;
+    J.FormRefillMap( rows, rows, map );
+
+    // Map the barrier rows owned by each process, which avoids communication
+    vector<Int> localRows;
+    for( Int iLoc=0; iLoc<JLocal.LocalHeight(); ++iLoc )
+        if( JLocal.GlobalRow(iLoc) >= n+m )
+            localRows.push_back( JLocal.GlobalRow(iLoc) );
+    DistSparseRefillMap localMap;
+    JLocal.FormRefillMap( localRows, localRows, localMap );
+    if( localMap.communicates )
+        LogicError("The map of locally-owned entries communicates");
+
+    for( Int it=1; it<=numIts; ++it )
+    {
+        OutputFromRoot(grid.Comm(),"Iteration ",it);
+        PushIndent();
+        FormKKT( A, x, gamma, delta, beta, it, JFresh );
+
+        vector<double> values( rows.size() );
+        for( Int k=0; k<Int(rows.size()); ++k )
+        {
+            const Int i = rows[k] - (n+m);
+            values[k] = -XValue(i,it)/ZValue(i,it)-beta*beta;
+        }
+        J.Refill( map, values );
+        CheckRefill( "Refill", J, JFresh, v );
+
+        vector<double> localValues( localRows.size() );
+        for( Int k=0; k<Int(localRows.size()); ++k )
+        {
+            const Int i = localRows[k] - (n+m);
+            localValues[k] = -XValue(i,it)/ZValue(i,it)-beta*beta;
+        }
+        JLocal.Refill( localMap, localValues );
+        CheckRefill( "Local refill", JLocal, JFresh, v );
+        PopIndent();
+    }
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","number of equality constraints",100);
+        const Int n = Input("--n","number of variables",200);
+        const Int numIts = Input("--numIts","number of refills",3);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestRefill( m, n, numIts, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
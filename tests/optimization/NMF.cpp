@@ -0,0 +1,111 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Factor a nonnegative matrix of low nonnegative rank with the HALS and BPP
+// approaches, checking that the residual decreases and that the final BPP
+// update of Y satisfies the optimality conditions of its NNLS problem.
+
+template<typename Real>
+Real Residual
+( const DistMatrix<Real>& A, const DistMatrix<Real>& X,
+  const DistMatrix<Real>& Y )
+{
+    DistMatrix<Real> E( A );
+    Gemm( NORMAL, ADJOINT, Real(-1), X, Y, Real(1), E );
+    return FrobeniusNorm( E ) / FrobeniusNorm( A );
+}
+
+template<typename Real>
+void TestNMF
+( Int m, Int n, Int rank, NMFApproach approach, const Grid& grid )
+{
+    if( grid.Rank() == 0 )
+        Output
+        ("Testing ",(approach==NMF_HALS ? "HALS" : "BPP")," with ",
+         TypeName<Real>());
+    DistMatrix<Real> XTrue(grid), YTrue(grid), A(grid);
+    Uniform( XTrue, m, rank, Real(1), Real(1) );
+    Uniform( YTrue, n, rank, Real(1), Real(1) );
+    Zeros( A, m, n );
+    Gemm( NORMAL, ADJOINT, Real(1), XTrue, YTrue, Real(0), A );
+
+    NMFCtrl<Real> ctrl;
+    ctrl.approach = approach;
+    ctrl.numInnerIts = 2;
+    DistMatrix<Real> X(grid), Y(grid);
+    Uniform( X, m, rank, Real(1), Real(1) );
+
+    ctrl.maxIter = 1;
+    NMF( A, X, Y, ctrl );
+    const Real initialResidual = Residual( A, X, Y );
+    ctrl.maxIter = 50;
+    NMF( A, X, Y, ctrl );
+    const Real residual = Residual( A, X, Y );
+    if( grid.Rank() == 0 )
+        Output
+        ("  relative residual of ",initialResidual," after one iteration and ",
+         residual," after ",ctrl.maxIter+1);
+    if( residual > initialResidual )
+        LogicError("The NMF residual increased");
+
+    if( approach == NMF_BPP )
+    {
+        // X was last updated for the fixed Y, so the gradient
+        // Z := X (Y^T Y) - A Y should be nonnegative and vanish on supp(X)
+        DistMatrix<Real> G(grid), Z(grid);
+        Zeros( G, rank, rank );
+        Zeros( Z, m, rank );
+        Gemm( ADJOINT, NORMAL, Real(1), Y, Y, Real(0), G );
+        Gemm( NORMAL, NORMAL, Real(-1), A, Y, Real(0), Z );
+        Gemm( NORMAL, NORMAL, Real(1), X, G, Real(1), Z );
+        const Real tol =
+          Pow(limits::Epsilon<Real>(),Real(0.5))*FrobeniusNorm(A);
+        Real violation = 0;
+        for( Int jLoc=0; jLoc<Z.LocalWidth(); ++jLoc )
+            for( Int iLoc=0; iLoc<Z.LocalHeight(); ++iLoc )
+            {
+                const Real zeta = Z.GetLocal(iLoc,jLoc);
+                const Real chi = X.GetLocal(iLoc,jLoc);
+                violation = Max( violation, -zeta );
+                if( chi > Real(0) )
+                    violation = Max( violation, Abs(zeta) );
+                violation = Max( violation, -chi );
+            }
+        violation = mpi::AllReduce( violation, mpi::MAX, grid.Comm() );
+        if( grid.Rank() == 0 )
+            Output("  BPP optimality violation of ",violation);
+        if( violation > tol )
+            LogicError("The BPP update was not optimal");
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","matrix height",100);
+        const Int n = Input("--n","matrix width",80);
+        const Int rank = Input("--rank","nonnegative rank",4);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestNMF<double>( m, n, rank, NMF_HALS, grid );
+        TestNMF<double>( m, n, rank, NMF_BPP, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the fused positive-orthant reductions against their separate
+// counterparts for DistMultiVec and DistMatrix vectors.
+
+template<typename Real,class Vector>
+void TestReductions( Int n, const Grid& grid )
+{
+    Vector s(grid), ds(grid), z(grid), dz(grid), w(grid);
+    Uniform( s, n, 1, Real(2), Real(1) );
+    Uniform( z, n, 1, Real(2), Real(1) );
+    Uniform( ds, n, 1 );
+    Uniform( dz, n, 1 );
+    Uniform( w, n, 1 );
+    const Real tol = 10*n*limits::Epsilon<Real>();
+
+    auto complementarity = pos_orth::Complementarity( s, z );
+    const Real dot = Dot( s, z );
+    if( Abs(complementarity.sum-dot) > tol*Abs(dot) )
+        LogicError("Complementarity sum was ",complementarity.sum," not ",dot);
+    if( complementarity.Ratio() != pos_orth::ComplementRatio( s, z ) )
+        LogicError("Complementarity ratio was inconsistent");
+
+    Real alphaPri, alphaDual;
+    pos_orth::MaxSteps( s, ds, z, dz, Real(1), alphaPri, alphaDual );
+    if( alphaPri != pos_orth::MaxStep( s, ds, Real(1) ) ||
+        alphaDual != pos_orth::MaxStep( z, dz, Real(1) ) )
+        LogicError("Fused maximum steps were inconsistent");
+
+    Vector ws(grid);
+    Copy( s, ws );
+    DiagonalScale( LEFT, NORMAL, w, ws );
+    const Real weightedDot = pos_orth::WeightedDot( w, s, z );
+    const Real weightedDotRef = Dot( ws, z );
+    if( Abs(weightedDot-weightedDotRef) > tol*Max(Abs(weightedDotRef),Real(1)) )
+        LogicError("Weighted inner product was inaccurate");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","vector length",1000);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestReductions<float,DistMultiVec<float>>( n, grid );
+        TestReductions<double,DistMultiVec<double>>( n, grid );
+        TestReductions<double,DistMatrix<double>>( n, grid );
+        if( grid.Rank() == 0 )
+            Output("Fused reductions agreed with the separate ones");
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,206 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Solve a sparse affine LP containing redundancies which the presolve removes
+// (an empty equality and inequality, a singleton equality, a variable fixed
+// by coinciding bounds, and dominated and parallel bounds) with and without
+// the presolve. The postsolved solution must be feasible and dual feasible
+// for the original problem and attain the same objective.
+
+inline bool OwnsRow( const SparseMatrix<double>& A, Int i ) { return true; }
+
+inline bool OwnsRow( const DistSparseMatrix<double>& A, Int i )
+{ return i >= A.FirstLocalRow() && i < A.FirstLocalRow()+A.LocalHeight(); }
+
+// The entries are deterministic so that every process forms the same problem
+template<typename Real>
+Real Pseudorandom( Int i, Int j )
+{ return Real((i*37+j*19)%23)/Real(23) - Real(1)/Real(2); }
+
+template<class MatrixType,class VectorType>
+void FormProblem
+( AffineLPProblem<MatrixType,VectorType>& problem, Int m, Int n )
+{
+    typedef double Real;
+    if( n < 4 )
+        LogicError("The test requires at least four variables");
+
+    // A feasible point with x_0 = 1/2 and x_1 = 1/4
+    vector<Real> xFeas( n );
+    for( Int j=0; j<n; ++j )
+        xFeas[j] = Pseudorandom<Real>(j,j);
+    xFeas[0] = Real(1)/Real(2);
+    xFeas[1] = Real(1)/Real(4);
+
+    // Equality 0 is the singleton 2 x_0 = 1, equality 1 is empty, and the
+    // remaining m equalities each involve three variables
+    const Int numEqualities = m + 2;
+    Zeros( problem.A, numEqualities, n );
+    Zeros( problem.b, numEqualities, 1 );
+    problem.A.Reserve( 3*m+1 );
+    if( OwnsRow( problem.A, 0 ) )
+        problem.A.QueueUpdate( 0, 0, Real(2) );
+    for( Int i=2; i<numEqualities; ++i )
+    {
+        Real beta = 0;
+        const Int cols[3] = { (3*i) % n, (3*i+1) % n, (3*i+5) % n };
+        for( Int t=0; t<3; ++t )
+        {
+            if( t > 0 && (cols[t] == cols[0] || cols[t] == cols[t-1]) )
+                continue;
+            const Real value = Pseudorandom<Real>(i,cols[t]) + Real(2);
+            if( OwnsRow( problem.A, i ) )
+                problem.A.QueueUpdate( i, cols[t], value );
+            beta += value*xFeas[cols[t]];
+        }
+        problem.b.Set( i, 0, beta );
+    }
+    problem.A.ProcessQueues();
+    problem.b.Set( 0, 0, Real(1) );
+
+    // Inequalities 0 through 2n-1 are the box constraints -1 <= x <= 1.
+    // Inequalities 2n and 2n+1 fix x_1 = 1/4, inequality 2n+2 is empty, and
+    // inequality 2n+3 is a scaled copy of the box constraint x_2 <= 1.
+    const Int numInequalities = 2*n + 4;
+    Zeros( problem.G, numInequalities, n );
+    Zeros( problem.h, numInequalities, 1 );
+    problem.G.Reserve( 2*n+3 );
+    for( Int j=0; j<n; ++j )
+    {
+        if( OwnsRow( problem.G, j ) )
+            problem.G.QueueUpdate( j, j, Real(1) );
+        if( OwnsRow( problem.G, n+j ) )
+            problem.G.QueueUpdate( n+j, j, Real(-1) );
+        problem.h.Set( j, 0, Real(1) );
+        problem.h.Set( n+j, 0, Real(1) );
+    }
+    if( OwnsRow( problem.G, 2*n ) )
+        problem.G.QueueUpdate( 2*n, 1, Real(1) );
+    if( OwnsRow( problem.G, 2*n+1 ) )
+        problem.G.QueueUpdate( 2*n+1, 1, Real(-1) );
+    if( OwnsRow( problem.G, 2*n+3 ) )
+        problem.G.QueueUpdate( 2*n+3, 2, Real(2) );
+    problem.G.ProcessQueues();
+    problem.h.Set( 2*n, 0, Real(1)/Real(4) );
+    problem.h.Set( 2*n+1, 0, -Real(1)/Real(4) );
+    problem.h.Set( 2*n+2, 0, Real(1) );
+    problem.h.Set( 2*n+3, 0, Real(2) );
+
+    Zeros( problem.c, n, 1 );
+    for( Int j=0; j<n; ++j )
+        problem.c.Set( j, 0, Pseudorandom<Real>(j,2*j+1) );
+}
+
+template<class MatrixType,class VectorType>
+double CheckSolution
+( const string& label,
+  const AffineLPProblem<MatrixType,VectorType>& problem,
+  const AffineLPSolution<VectorType>& solution,
+  const Grid& grid )
+{
+    typedef double Real;
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.25));
+
+    VectorType rb( problem.b ), rh( problem.h ), rc( problem.c );
+    Multiply( NORMAL, Real(1), problem.A, solution.x, Real(-1), rb );
+    Multiply( NORMAL, Real(1), problem.G, solution.x, Real(-1), rh );
+    rh += solution.s;
+    Multiply( TRANSPOSE, Real(1), problem.A, solution.y, Real(1), rc );
+    Multiply( TRANSPOSE, Real(1), problem.G, solution.z, Real(1), rc );
+    const Real rbRel =
+      FrobeniusNorm(rb) / Max(FrobeniusNorm(problem.b),Real(1));
+    const Real rhRel =
+      FrobeniusNorm(rh) / Max(FrobeniusNorm(problem.h),Real(1));
+    const Real rcRel =
+      FrobeniusNorm(rc) / Max(FrobeniusNorm(problem.c),Real(1));
+    const Real primal = Dot( problem.c, solution.x );
+    const Real dual = -Dot(problem.b,solution.y) - Dot(problem.h,solution.z);
+    const Real relGap = Abs(primal-dual) / Max(Abs(dual),Real(1));
+    OutputFromRoot
+    (grid.Comm(),label,":\n",
+     "  c^T x = ",primal,"\n",
+     "  || r_b ||_2 / max(|| b ||_2,1) = ",rbRel,"\n",
+     "  || r_h ||_2 / max(|| h ||_2,1) = ",rhRel,"\n",
+     "  || r_c ||_2 / max(|| c ||_2,1) = ",rcRel,"\n",
+     "  |gap| / max(|dual|,1) = ",relGap);
+    if( Max(Max(rbRel,rhRel),Max(rcRel,relGap)) > tol )
+        LogicError(label," solution was not sufficiently accurate");
+    return primal;
+}
+
+template<class MatrixType,class VectorType>
+void TestPresolve
+( const string& label,
+  AffineLPProblem<MatrixType,VectorType>& problem,
+  AffineLPSolution<VectorType>& solution,
+  Int m, Int n, bool print, const Grid& grid )
+{
+    typedef double Real;
+    OutputFromRoot(grid.Comm(),"Testing ",label);
+    PushIndent();
+    FormProblem( problem, m, n );
+
+    lp::affine::Ctrl<Real> ctrl;
+    ctrl.mehrotraCtrl.print = print;
+    LP( problem, solution, ctrl );
+    const Real objective =
+      CheckSolution( "Without presolve", problem, solution, grid );
+
+    ctrl.presolve = true;
+    LP( problem, solution, ctrl );
+    const Real presolvedObjective =
+      CheckSolution( "With presolve", problem, solution, grid );
+
+    const Real tol = Pow(limits::Epsilon<Real>(),Real(0.25));
+    if( Abs(objective-presolvedObjective) > tol*Max(Abs(objective),Real(1)) )
+        LogicError
+        ("Presolved objective ",presolvedObjective," differed from ",
+         objective);
+    if( Abs(solution.x.Get(0,0)-Real(1)/Real(2)) > tol ||
+        Abs(solution.x.Get(1,0)-Real(1)/Real(4)) > tol )
+        LogicError("The fixed variables were not recovered");
+    PopIndent();
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","number of general equalities",60);
+        const Int n = Input("--n","number of variables",100);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        if( mpi::Rank(comm) == 0 )
+        {
+            AffineLPProblem<SparseMatrix<double>,Matrix<double>> problem;
+            AffineLPSolution<Matrix<double>> solution;
+            TestPresolve
+            ( "sequential presolve", problem, solution, m, n, print,
+              Grid::Trivial() );
+        }
+        AffineLPProblem<DistSparseMatrix<double>,DistMultiVec<double>>
+          problem;
+        ForceSimpleAlignments( problem, grid );
+        AffineLPSolution<DistMultiVec<double>> solution;
+        ForceSimpleAlignments( solution, grid );
+        TestPresolve
+        ( "distributed presolve", problem, solution, m, n, print, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+/*
+   Copyright (c) 2009-2017, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the sparse inverse covariance estimate of QUIC against that of the
+// (dense) ADMM for samples of a random sparse precision matrix.
+
+template<typename Real>
+void TestQUIC( Int p, Int numSamples, Real lambda, bool progress )
+{
+    Output("Testing with ",TypeName<Real>());
+
+    // Draw samples with covariance inv(K), where K is tridiagonal and
+    // diagonally dominant, by solving against its Cholesky factor
+    Matrix<Real> K, D;
+    Zeros( K, p, p );
+    for( Int i=0; i<p; ++i )
+    {
+        K(i,i) = Real(2);
+        if( i+1 < p )
+        {
+            K(i+1,i) = Real(-0.5);
+            K(i,i+1) = Real(-0.5);
+        }
+    }
+    Cholesky( UPPER, K );
+    Gaussian( D, numSamples, p );
+    Trsm( RIGHT, UPPER, ADJOINT, NON_UNIT, Real(1), K, D );
+
+    SparseInvCovQUICCtrl<Real> quicCtrl;
+    quicCtrl.progress = progress;
+    SparseMatrix<Real> X;
+    const Int numQUICIts = SparseInvCov( D, lambda, X, quicCtrl );
+
+    SparseInvCovCtrl<Real> admmCtrl;
+    admmCtrl.progress = false;
+    admmCtrl.maxIter = 5000;
+    admmCtrl.absTol = Real(1e-8);
+    admmCtrl.relTol = Real(1e-6);
+    Matrix<Real> Z;
+    const Int numADMMIts = SparseInvCov( D, lambda, Z, admmCtrl );
+
+    const Real ZFrob = FrobeniusNorm( Z );
+    for( Int e=0; e<X.NumEntries(); ++e )
+        Z(X.Row(e),X.Col(e)) -= X.Value(e);
+    const Real error = FrobeniusNorm( Z ) / ZFrob;
+    Output
+    ("  QUIC: ",numQUICIts," iterations with ",X.NumEntries()," nonzeros, "
+     "ADMM: ",numADMMIts," iterations, relative difference ",error);
+    if( error > Real(1e-3) )
+        LogicError("QUIC and ADMM disagreed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int p = Input("--p","number of variables",30);
+        const Int numSamples = Input("--numSamples","number of samples",300);
+        const double lambda = Input("--lambda","l1 penalty",0.05);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+            TestQUIC<double>( p, numSamples, lambda, progress );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
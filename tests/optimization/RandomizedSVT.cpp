@@ -0,0 +1,74 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the randomized partial singular value thresholding of a low-rank
+// matrix against the thresholding based upon a full SVD, starting from an
+// underestimate of the rank so that the rank must be grown.
+
+template<typename Field>
+void TestRandomizedSVT
+( Int m, Int n, Int rank, Int rankGuess, Base<Field> tau, bool relative,
+  const Grid& grid )
+{
+    typedef Base<Field> Real;
+    if( grid.Rank() == 0 )
+        Output
+        ("Testing with ",TypeName<Field>(),
+         (relative ? " and a relative threshold" : ""));
+
+    DistMatrix<Field> X(grid), Y(grid), A(grid);
+    Gaussian( X, m, rank );
+    Gaussian( Y, n, rank );
+    Zeros( A, m, n );
+    Gemm( NORMAL, ADJOINT, Field(1), X, Y, Field(0), A );
+
+    DistMatrix<Field> B( A ), BNormal( A );
+    const Int numKept = svt::Randomized( B, tau, rankGuess, relative );
+    const Int numKeptNormal = svt::Normal( BNormal, tau, relative );
+    BNormal -= B;
+    const Real error = FrobeniusNorm( BNormal ) / FrobeniusNorm( A );
+    if( grid.Rank() == 0 )
+        Output
+        ("  kept ",numKept," (",numKeptNormal," with a full SVD) singular "
+         "values with a relative error of ",error);
+    if( numKept != numKeptNormal )
+        LogicError("The randomized SVT kept the wrong number of values");
+    if( error > Pow(limits::Epsilon<Real>(),Real(0.5)) )
+        LogicError("The randomized SVT was inaccurate");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",200);
+        const Int n = Input("--n","width of matrix",150);
+        const Int rank = Input("--rank","rank of matrix",6);
+        const Int rankGuess = Input("--rankGuess","initial rank",2);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestRandomizedSVT<double>
+        ( m, n, rank, rankGuess, double(1), false, grid );
+        TestRandomizedSVT<double>
+        ( m, n, rank, rankGuess, double(0.5), true, grid );
+        TestRandomizedSVT<Complex<double>>
+        ( m, n, rank, rankGuess, double(1), false, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
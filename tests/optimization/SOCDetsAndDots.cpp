@@ -0,0 +1,111 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Compare the fused single-pass cone determinants and inner products against
+// the separate (and broadcast) soc::Dets and soc::Dots for a product of cones
+// of varying orders, some of which straddle process boundaries.
+
+template<typename Real>
+void TestDetsAndDots( Int numCones, Int maxOrder, const Grid& grid )
+{
+    const Int commRank = grid.Rank();
+    if( commRank == 0 )
+        Output("Testing with ",TypeName<Real>());
+
+    // Cycle through the cone orders 1, 2, ..., maxOrder
+    Int n = 0;
+    for( Int cone=0; cone<numCones; ++cone )
+        n += 1 + Mod(cone,maxOrder);
+    DistMultiVec<Int> orders(grid), firstInds(grid);
+    Zeros( orders, n, 1 );
+    Zeros( firstInds, n, 1 );
+    for( Int iLoc=0; iLoc<orders.LocalHeight(); ++iLoc )
+    {
+        const Int i = orders.GlobalRow(iLoc);
+        Int firstInd = 0;
+        for( Int cone=0; cone<numCones; ++cone )
+        {
+            const Int order = 1 + Mod(cone,maxOrder);
+            if( i < firstInd+order )
+            {
+                orders.SetLocal( iLoc, 0, order );
+                firstInds.SetLocal( iLoc, 0, firstInd );
+                break;
+            }
+            firstInd += order;
+        }
+    }
+
+    DistMultiVec<Real> x(grid), y(grid);
+    Uniform( x, n, 1 );
+    Uniform( y, n, 1 );
+
+    DistMultiVec<Real> xDets(grid), yDets(grid), dots(grid);
+    soc::DetsAndDots( x, y, xDets, yDets, dots, orders, firstInds );
+
+    DistMultiVec<Real> xDetsRef(grid), yDetsRef(grid), dotsRef(grid);
+    soc::Dets( x, xDetsRef, orders, firstInds );
+    soc::Dets( y, yDetsRef, orders, firstInds );
+    soc::Dots( x, y, dotsRef, orders, firstInds );
+    cone::Broadcast( xDetsRef, orders, firstInds );
+    cone::Broadcast( yDetsRef, orders, firstInds );
+    cone::Broadcast( dotsRef, orders, firstInds );
+
+    xDetsRef -= xDets;
+    yDetsRef -= yDets;
+    dotsRef -= dots;
+    const Real error =
+      Max( Max(MaxNorm(xDetsRef),MaxNorm(yDetsRef)), MaxNorm(dotsRef) );
+    const Real tol = 100*maxOrder*limits::Epsilon<Real>();
+    if( commRank == 0 )
+        Output("  max error = ",error);
+    if( error > tol )
+        LogicError("The fused cone reductions were inaccurate");
+
+    // The sequential variant should agree with the distributed one
+    Matrix<Int> ordersSeq, firstIndsSeq;
+    Matrix<Real> xSeq, ySeq, xDetsSeq, yDetsSeq, dotsSeq, dotsDist;
+    CopyFromRoot( orders, ordersSeq );
+    CopyFromRoot( firstInds, firstIndsSeq );
+    CopyFromRoot( x, xSeq );
+    CopyFromRoot( y, ySeq );
+    CopyFromRoot( dots, dotsDist );
+    if( commRank == 0 )
+    {
+        soc::DetsAndDots
+        ( xSeq, ySeq, xDetsSeq, yDetsSeq, dotsSeq, ordersSeq, firstIndsSeq );
+        dotsSeq -= dotsDist;
+        if( MaxNorm(dotsSeq) > tol )
+            LogicError("The sequential and distributed results differed");
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int numCones = Input("--numCones","number of cones",1000);
+        const Int maxOrder = Input("--maxOrder","maximum cone order",5);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid grid( comm );
+        TestDetsAndDots<float>( numCones, maxOrder, grid );
+        TestDetsAndDots<double>( numCones, maxOrder, grid );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
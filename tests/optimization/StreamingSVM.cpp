@@ -0,0 +1,129 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Train the streaming SVM over blocks of a (deterministically generated)
+// sparse training set, interrupting and resuming from a checkpoint, and
+// compare its training accuracy against that of the in-memory SVM.
+
+// The processes must agree upon the data, so it is generated without the
+// (per-process) random number generators
+template<typename Real>
+void TrainingBlock
+( Int block, Int blockHeight, Int n, SparseMatrix<Real>& A, Matrix<Real>& d )
+{
+    Zeros( A, blockHeight, n );
+    Zeros( d, blockHeight, 1 );
+    A.Reserve( 3*blockHeight );
+    for( Int iLoc=0; iLoc<blockHeight; ++iLoc )
+    {
+        const Int i = block*blockHeight + iLoc;
+        Real margin = Sin(Real(i));
+        for( Int k=0; k<3; ++k )
+        {
+            const Int j = Mod(7*i+3*k,n);
+            const Real value = Cos(Real(11*i+5*k));
+            A.QueueUpdate( iLoc, j, value );
+            margin += ( Mod(j,2)==0 ? value : -value );
+        }
+        d(iLoc) = ( margin >= Real(0) ? Real(1) : Real(-1) );
+    }
+    A.ProcessQueues();
+}
+
+template<typename Real>
+Real Accuracy
+( const SparseMatrix<Real>& A, const Matrix<Real>& d, const Matrix<Real>& x )
+{
+    const Int m = A.Height();
+    const Int n = A.Width();
+    auto w = x( IR(0,n), ALL );
+    Matrix<Real> r;
+    Zeros( r, m, 1 );
+    Multiply( NORMAL, Real(1), A, w, Real(0), r );
+    Int numCorrect = 0;
+    for( Int i=0; i<m; ++i )
+        if( d(i)*(r(i)+x(n)) > Real(0) )
+            ++numCorrect;
+    return Real(numCorrect) / Real(m);
+}
+
+template<typename Real>
+void TestStreamingSVM
+( Int numBlocks, Int blockHeight, Int n, Real lambda, bool progress )
+{
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    SparseMatrix<Real> A;
+    Matrix<Real> d;
+    TrainingBlock( Int(0), numBlocks*blockHeight, n, A, d );
+    SVMBlockLoader<Real> loadBlock =
+      [&]( Int block, SparseMatrix<Real>& ABlock, Matrix<Real>& dBlock )
+      {
+          Zeros( ABlock, blockHeight, n );
+          ABlock.Reserve( 3*blockHeight );
+          const Int iBeg = block*blockHeight;
+          const Int eBeg = A.RowOffset( iBeg );
+          const Int eEnd = A.RowOffset( iBeg+blockHeight );
+          for( Int e=eBeg; e<eEnd; ++e )
+              ABlock.QueueUpdate( A.Row(e)-iBeg, A.Col(e), A.Value(e) );
+          ABlock.ProcessQueues();
+          dBlock = d( IR(iBeg,iBeg+blockHeight), ALL );
+      };
+
+    // Interrupt the streaming SVM after a few passes and then resume it
+    StreamingSVMCtrl<Real> ctrl;
+    ctrl.progress = progress;
+    ctrl.checkpoint = "StreamingSVMCheckpoint";
+    ctrl.maxPasses = 3;
+    Matrix<Real> x;
+    const Int numInitialPasses =
+      StreamingSVM( n, numBlocks, loadBlock, lambda, x, ctrl, comm );
+    ctrl.maxPasses = 500;
+    const Int numPasses =
+      StreamingSVM( n, numBlocks, loadBlock, lambda, x, ctrl, comm );
+    const string checkpointFile =
+      BuildString(ctrl.checkpoint,"_",commRank,".",FileExtension(BINARY));
+    std::remove( checkpointFile.c_str() );
+
+    Matrix<Real> xFull;
+    SVM( A, d, lambda, xFull );
+    const Real accuracy = Accuracy( A, d, x );
+    const Real fullAccuracy = Accuracy( A, d, xFull );
+    if( commRank == 0 )
+        Output
+        ("  ",numInitialPasses,"+",numPasses," passes with a training "
+         "accuracy of ",accuracy," (",fullAccuracy," in memory)");
+    if( accuracy < fullAccuracy - Real(0.02) )
+        LogicError("The streaming SVM was substantially less accurate");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int numBlocks = Input("--numBlocks","number of blocks",4);
+        const Int blockHeight = Input("--blockHeight","examples per block",50);
+        const Int n = Input("--n","number of features",10);
+        const double lambda = Input("--lambda","hinge-loss weight",1.);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        TestStreamingSVM<double>( numBlocks, blockHeight, n, lambda, progress );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,229 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Solve a random feasible problem from scratch, perturb its objective, and
+// then warm-start the solution of the perturbed problem from the solution of
+// the original one. Both solutions are required to be accurate.
+
+template<typename Real>
+void CheckAffine
+( const Matrix<Real>& Q,
+  const Matrix<Real>& A,
+  const Matrix<Real>& G,
+  const Matrix<Real>& b,
+  const Matrix<Real>& c,
+  const Matrix<Real>& h,
+  const Matrix<Real>& x,
+  const Matrix<Real>& y,
+  const Matrix<Real>& z,
+  const Matrix<Real>& s )
+{
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = Pow(eps,Real(0.25));
+
+    Matrix<Real> rb, rh, rc;
+    rb = b;
+    Gemv( NORMAL, Real(1), A, x, Real(-1), rb );
+    rh = h;
+    Gemv( NORMAL, Real(1), G, x, Real(-1), rh );
+    rh += s;
+    rc = c;
+    Gemv( NORMAL, Real(1), Q, x, Real(1), rc );
+    Gemv( TRANSPOSE, Real(1), A, y, Real(1), rc );
+    Gemv( TRANSPOSE, Real(1), G, z, Real(1), rc );
+    const Real rbRel = FrobeniusNorm(rb) / Max(FrobeniusNorm(b),Real(1));
+    const Real rhRel = FrobeniusNorm(rh) / Max(FrobeniusNorm(h),Real(1));
+    const Real rcRel = FrobeniusNorm(rc) / Max(FrobeniusNorm(c),Real(1));
+
+    Matrix<Real> Qx;
+    Gemv( NORMAL, Real(1), Q, x, Qx );
+    const Real xQx = Dot( x, Qx );
+    const Real primal = xQx/2 + Dot(c,x);
+    const Real dual = -xQx/2 - Dot(b,y) - Dot(h,z);
+    const Real relGap = Abs(primal-dual) / Max(Abs(dual),Real(1));
+    Output
+    ("    || r_b ||_2 / max(|| b ||_2,1) = ",rbRel,"\n",
+     "    || r_h ||_2 / max(|| h ||_2,1) = ",rhRel,"\n",
+     "    || r_c ||_2 / max(|| c ||_2,1) = ",rcRel,"\n",
+     "    |gap| / max(|dual|,1) = ",relGap);
+    if( Max(Max(rbRel,rhRel),Max(rcRel,relGap)) > tol )
+        LogicError("The solution was not sufficiently accurate");
+}
+
+template<typename Real>
+void TestLP( Int m, Int n, Int k, Real perturb, bool print )
+{
+    Output("  Testing the affine LP IPM");
+    // Form a primal-feasible and dual-feasible (and so bounded) LP
+    AffineLPProblem<Matrix<Real>,Matrix<Real>> problem;
+    Matrix<Real> xFeas, sFeas, yFeas, zFeas;
+    Uniform( problem.A, m, n );
+    Uniform( problem.G, k, n );
+    Uniform( xFeas, n, 1 );
+    Uniform( sFeas, k, 1, Real(1), Real(1) );
+    Uniform( yFeas, m, 1 );
+    Uniform( zFeas, k, 1, Real(1), Real(1) );
+    Gemv( NORMAL, Real(1), problem.A, xFeas, problem.b );
+    Gemv( NORMAL, Real(1), problem.G, xFeas, problem.h );
+    problem.h += sFeas;
+    Gemv( TRANSPOSE, Real(-1), problem.A, yFeas, problem.c );
+    Gemv( TRANSPOSE, Real(-1), problem.G, zFeas, Real(1), problem.c );
+
+    lp::affine::Ctrl<Real> ctrl;
+    ctrl.mehrotraCtrl.print = print;
+    AffineLPSolution<Matrix<Real>> solution;
+    Matrix<Real> Q;
+    Zeros( Q, n, n );
+    Timer timer;
+    timer.Start();
+    LP( problem, solution, ctrl );
+    Output("    Cold start: ",timer.Stop()," seconds");
+    CheckAffine
+    ( Q, problem.A, problem.G, problem.b, problem.c, problem.h,
+      solution.x, solution.y, solution.z, solution.s );
+
+    Matrix<Real> dc;
+    Uniform( dc, n, 1 );
+    const Real cNorm = FrobeniusNorm( problem.c );
+    Axpy( perturb*cNorm/Max(FrobeniusNorm(dc),Real(1)), dc, problem.c );
+    ctrl.mehrotraCtrl.primalInit = true;
+    ctrl.mehrotraCtrl.dualInit = true;
+    timer.Start();
+    LP( problem, solution, ctrl );
+    Output("    Warm start: ",timer.Stop()," seconds");
+    CheckAffine
+    ( Q, problem.A, problem.G, problem.b, problem.c, problem.h,
+      solution.x, solution.y, solution.z, solution.s );
+}
+
+template<typename Real>
+void TestQP( Int m, Int n, Int k, Real perturb, bool print )
+{
+    Output("  Testing the affine QP IPM");
+    Matrix<Real> Q, B, A, G, b, c, h, xFeas, sFeas;
+    Uniform( B, n, n );
+    Zeros( Q, n, n );
+    Gemm( TRANSPOSE, NORMAL, Real(1), B, B, Q );
+    Uniform( A, m, n );
+    Uniform( G, k, n );
+    Uniform( xFeas, n, 1 );
+    Uniform( sFeas, k, 1, Real(1), Real(1) );
+    Gemv( NORMAL, Real(1), A, xFeas, b );
+    Gemv( NORMAL, Real(1), G, xFeas, h );
+    h += sFeas;
+    Uniform( c, n, 1 );
+
+    qp::affine::Ctrl<Real> ctrl;
+    ctrl.mehrotraCtrl.print = print;
+    Matrix<Real> x, y, z, s;
+    Timer timer;
+    timer.Start();
+    QP( Q, A, G, b, c, h, x, y, z, s, ctrl );
+    Output("    Cold start: ",timer.Stop()," seconds");
+    CheckAffine( Q, A, G, b, c, h, x, y, z, s );
+
+    Matrix<Real> dc;
+    Uniform( dc, n, 1 );
+    Axpy( perturb*FrobeniusNorm(c)/Max(FrobeniusNorm(dc),Real(1)), dc, c );
+    ctrl.mehrotraCtrl.primalInit = true;
+    ctrl.mehrotraCtrl.dualInit = true;
+    timer.Start();
+    QP( Q, A, G, b, c, h, x, y, z, s, ctrl );
+    Output("    Warm start: ",timer.Stop()," seconds");
+    CheckAffine( Q, A, G, b, c, h, x, y, z, s );
+}
+
+template<typename Real>
+void TestSOCP( Int m, Int n, Real perturb, bool print )
+{
+    Output("  Testing the direct SOCP IPM");
+    // Partition x into cones of dimension three (and possibly a final cone
+    // of a smaller dimension)
+    const Int coneSize = 3;
+    Matrix<Int> orders, firstInds;
+    Zeros( orders, n, 1 );
+    Zeros( firstInds, n, 1 );
+    for( Int i=0; i<n; ++i )
+    {
+        const Int firstInd = i - Mod(i,coneSize);
+        firstInds(i) = firstInd;
+        orders(i) = Min(coneSize,n-firstInd);
+    }
+
+    // Push random vectors into the interior of the cones to form a feasible
+    // primal point and a dual-feasible objective
+    Matrix<Real> A, b, c, xFeas, yFeas, zFeas;
+    Uniform( A, m, n );
+    Uniform( xFeas, n, 1 );
+    Uniform( yFeas, m, 1 );
+    Uniform( zFeas, n, 1 );
+    soc::PushInto( xFeas, orders, firstInds, Real(1) );
+    soc::PushInto( zFeas, orders, firstInds, Real(1) );
+    Gemv( NORMAL, Real(1), A, xFeas, b );
+    c = zFeas;
+    Gemv( TRANSPOSE, Real(-1), A, yFeas, Real(1), c );
+
+    socp::direct::Ctrl<Real> ctrl;
+    ctrl.mehrotraCtrl.print = print;
+    Matrix<Real> Q, G, h, x, y, z;
+    Zeros( Q, n, n );
+    Identity( G, n, n );
+    G *= -1;
+    Zeros( h, n, 1 );
+    Timer timer;
+    timer.Start();
+    SOCP( A, b, c, orders, firstInds, x, y, z, ctrl );
+    Output("    Cold start: ",timer.Stop()," seconds");
+    // The direct form is the affine form with G = -I, h = 0, and s = x
+    CheckAffine( Q, A, G, b, c, h, x, y, z, x );
+
+    Matrix<Real> dc;
+    Uniform( dc, n, 1 );
+    Axpy( perturb*FrobeniusNorm(c)/Max(FrobeniusNorm(dc),Real(1)), dc, c );
+    ctrl.mehrotraCtrl.primalInit = true;
+    ctrl.mehrotraCtrl.dualInit = true;
+    timer.Start();
+    SOCP( A, b, c, orders, firstInds, x, y, z, ctrl );
+    Output("    Warm start: ",timer.Stop()," seconds");
+    CheckAffine( Q, A, G, b, c, h, x, y, z, x );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--m","height of A",30);
+        const Int n = Input("--n","width of A",60);
+        const Int k = Input("--k","height of G",70);
+        const double perturb =
+          Input("--perturb","relative perturbation of c",1e-3);
+        const bool print = Input("--print","print IPM progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        // Each test is sequential, so only run them on the root process
+        if( commRank == 0 )
+        {
+            Output("Testing with doubles:");
+            TestLP<double>( m, n, k, perturb, print );
+            TestQP<double>( m, n, k, perturb, print );
+            TestSOCP<double>( m, n, perturb, print );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}